@@ -4,6 +4,7 @@ import (
 	"fmt"
 	"reflect"
 	"regexp"
+	"strconv"
 	"strings"
 
 	"github.com/milvus-io/milvus-proto/go-api/v3/schemapb"
@@ -17,23 +18,29 @@ const (
 	kAvg   = "avg"
 	kMin   = "min"
 	kMax   = "max"
+
+	kApproxCountDistinct = "approx_count_distinct"
+	kApproxPercentile    = "approx_percentile"
 )
 
 var (
 	// Define the regular expression pattern once to avoid repeated concatenation.
-	aggregationTypes   = kSum + `|` + kCount + `|` + kAvg + `|` + kMin + `|` + kMax
-	aggregationPattern = regexp.MustCompile(`(?i)^(` + aggregationTypes + `)\s*\(\s*([\w\*]*)\s*\)$`)
+	aggregationTypes = kSum + `|` + kCount + `|` + kAvg + `|` + kMin + `|` + kMax + `|` +
+		kApproxCountDistinct + `|` + kApproxPercentile
+	aggregationPattern = regexp.MustCompile(`(?i)^(` + aggregationTypes + `)\s*\(\s*([\w\*]*)\s*(?:,\s*([^,()\s]+)\s*)?\)$`)
 )
 
 // MatchAggregationExpression return isAgg, operator name, operator parameter
-func MatchAggregationExpression(expression string) (bool, string, string) {
+// and the optional second argument, such as the percentile of
+// approx_percentile(field, 0.95)
+func MatchAggregationExpression(expression string) (bool, string, string, string) {
 	// FindStringSubmatch returns the full match and submatches.
 	matches := aggregationPattern.FindStringSubmatch(expression)
 	if len(matches) > 0 {
-		// Return true, the operator, and the captured parameter.
-		return true, strings.ToLower(matches[1]), strings.TrimSpace(matches[2])
+		// Return true, the operator, and the captured parameters.
+		return true, strings.ToLower(matches[1]), strings.TrimSpace(matches[2]), matches[3]
 	}
-	return false, "", ""
+	return false, "", "", ""
 }
 
 type AggregateBase interface {
@@ -49,7 +56,7 @@ type AggregateBase interface {
 
 func isSupportedAggregateName(aggregateName string) bool {
 	switch aggregateName {
-	case kCount, kSum, kAvg, kMin, kMax:
+	case kCount, kSum, kAvg, kMin, kMax, kApproxCountDistinct, kApproxPercentile:
 		return true
 	default:
 		return false
@@ -57,6 +64,13 @@ func isSupportedAggregateName(aggregateName string) bool {
 }
 
 func NewAggregate(aggregateName string, aggFieldID int64, originalName string, fieldType schemapb.DataType) ([]AggregateBase, error) {
+	return NewAggregateWithArgument(aggregateName, aggFieldID, originalName, fieldType, "")
+}
+
+// NewAggregateWithArgument is NewAggregate for an operator that may take a
+// second argument, only approx_percentile requires one: the percentile in
+// [0, 1].
+func NewAggregateWithArgument(aggregateName string, aggFieldID int64, originalName string, fieldType schemapb.DataType, argument string) ([]AggregateBase, error) {
 	if !isSupportedAggregateName(aggregateName) {
 		return nil, merr.WrapErrParameterInvalidMsg("invalid Aggregation operator %s", aggregateName)
 	}
@@ -65,6 +79,17 @@ func NewAggregate(aggregateName string, aggFieldID int64, originalName string, f
 		return nil, err
 	}
 
+	if aggregateName == kApproxPercentile {
+		percentile, err := strconv.ParseFloat(argument, 64)
+		if err != nil || percentile < 0 || percentile > 1 {
+			return nil, merr.WrapErrParameterInvalidMsg("%s expects a percentile in [0, 1] as its second argument, got '%s'", aggregateName, argument)
+		}
+		return []AggregateBase{&ApproxPercentileAggregate{fieldID: aggFieldID, originalName: originalName, percentile: percentile}}, nil
+	}
+	if argument != "" {
+		return nil, merr.WrapErrParameterInvalidMsg("aggregation operator %s takes a single field, got the extra argument '%s'", aggregateName, argument)
+	}
+
 	switch aggregateName {
 	case kCount:
 		return []AggregateBase{&CountAggregate{fieldID: aggFieldID, originalName: originalName, isAvg: false}}, nil
@@ -77,6 +102,8 @@ func NewAggregate(aggregateName string, aggFieldID int64, originalName string, f
 		return []AggregateBase{&MinAggregate{fieldID: aggFieldID, originalName: originalName}}, nil
 	case kMax:
 		return []AggregateBase{&MaxAggregate{fieldID: aggFieldID, originalName: originalName}}, nil
+	case kApproxCountDistinct:
+		return []AggregateBase{&ApproxCountDistinctAggregate{fieldID: aggFieldID, originalName: originalName}}, nil
 	default:
 		// should never happen due to isSupportedAggregateName check
 		return nil, merr.WrapErrParameterInvalidMsg("invalid Aggregation operator %s", aggregateName)
@@ -93,6 +120,10 @@ func FromPB(pb *planpb.Aggregate) (AggregateBase, error) {
 		return &MinAggregate{fieldID: pb.GetFieldId()}, nil
 	case planpb.AggregateOp_max:
 		return &MaxAggregate{fieldID: pb.GetFieldId()}, nil
+	case planpb.AggregateOp_approx_count_distinct:
+		return &ApproxCountDistinctAggregate{fieldID: pb.GetFieldId()}, nil
+	case planpb.AggregateOp_approx_percentile:
+		return &ApproxPercentileAggregate{fieldID: pb.GetFieldId(), percentile: pb.GetPercentile()}, nil
 	default:
 		return nil, merr.WrapErrParameterInvalidMsg("invalid Aggregation operator %d", pb.Op)
 	}
@@ -84,6 +84,16 @@ func (reducer *GroupAggReducer) EmptyAggResult() (*AggregationResult, error) {
 		if agg.GetOp() == planpb.AggregateOp_count {
 			countField := genEmptyLongFieldData(schemapb.DataType_Int64, []int64{0})
 			ret.fieldDatas = append(ret.fieldDatas, countField)
+		} else if isSketchAggregateOp(agg.GetOp()) {
+			// the empty state, finalized as the answer over no rows
+			ret.fieldDatas = append(ret.fieldDatas, &schemapb.FieldData{
+				Type: schemapb.DataType_VarChar,
+				Field: &schemapb.FieldData_Scalars{
+					Scalars: &schemapb.ScalarField{
+						Data: &schemapb.ScalarField_StringData{StringData: &schemapb.StringArray{Data: []string{""}}},
+					},
+				},
+			})
 		} else {
 			field, err := helper.GetFieldFromID(agg.GetFieldId())
 			if err != nil {
@@ -163,10 +173,17 @@ func genEmptyFieldDataByType(dataType schemapb.DataType) (*schemapb.FieldData, e
 	}
 }
 
+func isSketchAggregateOp(op planpb.AggregateOp) bool {
+	return op == planpb.AggregateOp_approx_count_distinct || op == planpb.AggregateOp_approx_percentile
+}
+
 // getAggregateResultType returns the expected result type for an aggregate operation
 // based on the aggregate operator type and the input field type.
 func getAggregateResultType(op planpb.AggregateOp, inputType schemapb.DataType) (schemapb.DataType, error) {
 	switch op {
+	case planpb.AggregateOp_approx_count_distinct, planpb.AggregateOp_approx_percentile:
+		// the serialized sketch, finalized by the proxy
+		return schemapb.DataType_VarChar, nil
 	case planpb.AggregateOp_count:
 		// count aggregation always returns Int64
 		return schemapb.DataType_Int64, nil
@@ -297,3 +297,78 @@ func TestGroupAggReducer_MaxGroupByGroupsJustOverLimit(t *testing.T) {
 	require.Error(t, err)
 	assert.True(t, strings.Contains(err.Error(), "too many groups"))
 }
+
+func TestReduceMergesSketchStates(t *testing.T) {
+	schema := makeTestSchema()
+	aggregates := []*planpb.Aggregate{
+		{Op: planpb.AggregateOp_approx_count_distinct, FieldId: 2},
+		{Op: planpb.AggregateOp_approx_percentile, FieldId: 2, Percentile: 0.5},
+	}
+	reducer := NewGroupAggReducer([]int64{1}, aggregates, -1, schema)
+
+	stringField := func(values ...string) *schemapb.FieldData {
+		return &schemapb.FieldData{
+			Type: schemapb.DataType_VarChar,
+			Field: &schemapb.FieldData_Scalars{
+				Scalars: &schemapb.ScalarField{
+					Data: &schemapb.ScalarField_StringData{
+						StringData: &schemapb.StringArray{Data: values},
+					},
+				},
+			},
+		}
+	}
+	results := []*AggregationResult{
+		NewAggregationResult([]*schemapb.FieldData{
+			stringField("a"), stringField(segcoreHyperLogLogA), stringField(segcoreTDigestD),
+		}, 5),
+		NewAggregationResult([]*schemapb.FieldData{
+			stringField("a"), stringField(segcoreHyperLogLogB), stringField(segcoreTDigestE),
+		}, 6),
+	}
+
+	out, err := reducer.Reduce(context.Background(), results)
+	require.NoError(t, err)
+	require.Len(t, out.GetFieldDatas(), 3)
+	assert.Equal(t, []string{"010400010000000003000004000100000300"},
+		out.GetFieldDatas()[1].GetScalars().GetStringData().GetData())
+
+	outputFields := []string{"category", "approx_count_distinct(value)", "approx_percentile(value, 0.5)"}
+	aggs := make([]AggregateBase, 0, 2)
+	for _, outputField := range outputFields[1:] {
+		_, op, _, argument := MatchAggregationExpression(outputField)
+		created, err := NewAggregateWithArgument(op, 2, outputField, schemapb.DataType_Int64, argument)
+		require.NoError(t, err)
+		aggs = append(aggs, created...)
+	}
+	outputMap, err := NewAggregationFieldMap(outputFields, []string{"category"}, aggs)
+	require.NoError(t, err)
+
+	category, err := outputMap.FinalizeAt(0, out.GetFieldDatas()[0])
+	require.NoError(t, err)
+	assert.Equal(t, out.GetFieldDatas()[0], category)
+	distinct, err := outputMap.FinalizeAt(1, out.GetFieldDatas()[1])
+	require.NoError(t, err)
+	assert.Equal(t, []int64{6}, distinct.GetScalars().GetLongData().GetData())
+	median, err := outputMap.FinalizeAt(2, out.GetFieldDatas()[2])
+	require.NoError(t, err)
+	assert.Equal(t, schemapb.DataType_Double, median.GetType())
+	assert.InDelta(t, 3, median.GetScalars().GetDoubleData().GetData()[0], 1e-9)
+}
+
+func TestEmptyResultFinalizesSketches(t *testing.T) {
+	aggregates := []*planpb.Aggregate{
+		{Op: planpb.AggregateOp_approx_count_distinct, FieldId: 2},
+		{Op: planpb.AggregateOp_approx_percentile, FieldId: 2, Percentile: 0.95},
+	}
+	reducer := NewGroupAggReducer(nil, aggregates, -1, makeTestSchema())
+	out, err := reducer.Reduce(context.Background(), nil)
+	require.NoError(t, err)
+
+	distinct, err := (&ApproxCountDistinctAggregate{}).Finalize(out.GetFieldDatas()[0])
+	require.NoError(t, err)
+	assert.Equal(t, []int64{0}, distinct.GetScalars().GetLongData().GetData())
+	percentile, err := (&ApproxPercentileAggregate{percentile: 0.95}).Finalize(out.GetFieldDatas()[1])
+	require.NoError(t, err)
+	assert.Equal(t, []bool{false}, percentile.GetValidData())
+}
@@ -469,7 +469,8 @@ func AssembleSingleValue(fv *FieldValue, fieldData *schemapb.FieldData) error {
 
 type AggregationFieldMap struct {
 	userOriginalOutputFields     []string
-	userOriginalOutputFieldIdxes [][]int // Each user output field can map to multiple field indices (e.g., avg maps to sum and count)
+	userOriginalOutputFieldIdxes [][]int           // Each user output field can map to multiple field indices (e.g., avg maps to sum and count)
+	userOriginalOutputSketches   []SketchAggregate // The approximate aggregate of each user output field, nil for the others
 }
 
 func (aggMap *AggregationFieldMap) Count() int {
@@ -497,6 +498,16 @@ func (aggMap *AggregationFieldMap) NameAt(idx int) string {
 	return aggMap.userOriginalOutputFields[idx]
 }
 
+// FinalizeAt returns the user-facing column of the given user output field
+// from its single reduced column: approximate aggregates carry a sketch up
+// to here, the other columns are returned as they are.
+func (aggMap *AggregationFieldMap) FinalizeAt(idx int, fieldData *schemapb.FieldData) (*schemapb.FieldData, error) {
+	if idx >= len(aggMap.userOriginalOutputSketches) || aggMap.userOriginalOutputSketches[idx] == nil {
+		return fieldData, nil
+	}
+	return aggMap.userOriginalOutputSketches[idx].Finalize(fieldData)
+}
+
 func NewAggregationFieldMap(originalUserOutputFields []string, groupByFields []string, aggs []AggregateBase) (*AggregationFieldMap, error) {
 	numGroupingKeys := len(groupByFields)
 
@@ -507,9 +518,13 @@ func NewAggregationFieldMap(originalUserOutputFields []string, groupByFields []s
 
 	// Build a map from originalName to all indices (for avg, this will include both sum and count indices)
 	aggFieldMap := make(map[string][]int, len(aggs))
+	sketchMap := make(map[string]SketchAggregate)
 	for i, agg := range aggs {
 		originalName := agg.OriginalName()
 		idx := i + numGroupingKeys
+		if sketch, ok := agg.(SketchAggregate); ok {
+			sketchMap[originalName] = sketch
+		}
 
 		// Check if this aggregate is part of an avg aggregation
 		var isAvg bool
@@ -531,6 +546,7 @@ func NewAggregationFieldMap(originalUserOutputFields []string, groupByFields []s
 	}
 
 	userOriginalOutputFieldIdxes := make([][]int, len(originalUserOutputFields))
+	userOriginalOutputSketches := make([]SketchAggregate, len(originalUserOutputFields))
 	for i, outputField := range originalUserOutputFields {
 		if idx, exist := groupByFieldMap[outputField]; exist {
 			// Group by field maps to a single index
@@ -538,6 +554,7 @@ func NewAggregationFieldMap(originalUserOutputFields []string, groupByFields []s
 		} else if indices, exist := aggFieldMap[outputField]; exist {
 			// Aggregate field may map to multiple indices (for avg: sum and count)
 			userOriginalOutputFieldIdxes[i] = indices
+			userOriginalOutputSketches[i] = sketchMap[outputField]
 		} else {
 			// Field is neither a group_by field nor an aggregation — reject early.
 			// This covers two cases:
@@ -559,7 +576,7 @@ func NewAggregationFieldMap(originalUserOutputFields []string, groupByFields []s
 		}
 	}
 
-	return &AggregationFieldMap{originalUserOutputFields, userOriginalOutputFieldIdxes}, nil
+	return &AggregationFieldMap{originalUserOutputFields, userOriginalOutputFieldIdxes, userOriginalOutputSketches}, nil
 }
 
 // ComputeAvgFromSumAndCount computes average from sum and count field data.
@@ -1,6 +1,9 @@
 package agg
 
 import (
+	"math"
+
+	"github.com/milvus-io/milvus-proto/go-api/v3/schemapb"
 	"github.com/milvus-io/milvus/pkg/v3/proto/planpb"
 	"github.com/milvus-io/milvus/pkg/v3/util/merr"
 )
@@ -358,3 +361,214 @@ func (max *MaxAggregate) FieldID() int64 {
 func (max *MaxAggregate) OriginalName() string {
 	return max.originalName
 }
+
+// SketchAggregate is an approximate aggregate whose partial state is a
+// serialized sketch. The reducers merge the states and the proxy finalizes
+// the reduced column into the value the user asked for.
+type SketchAggregate interface {
+	AggregateBase
+	Finalize(states *schemapb.FieldData) (*schemapb.FieldData, error)
+}
+
+// updateSketchState merges the sketch in new into target. An empty state is
+// the one of a reducer that saw no result at all.
+func updateSketchState(target *FieldValue, new *FieldValue, merge func(string, string) (string, error)) error {
+	if target == nil || new == nil {
+		return merr.WrapErrServiceInternalMsg("target or new field value is nil")
+	}
+	if new.IsNull() {
+		return nil
+	}
+	newState, ok := new.val.(string)
+	if !ok {
+		return merr.WrapErrParameterInvalidMsg("sketch state must be a string, got %T", new.val)
+	}
+	if newState == "" {
+		return nil
+	}
+	targetState, _ := target.val.(string)
+	if target.IsNull() || targetState == "" {
+		target.val = newState
+		target.isNull = false
+		return nil
+	}
+	merged, err := merge(targetState, newState)
+	if err != nil {
+		return err
+	}
+	target.val = merged
+	return nil
+}
+
+func sketchStateAt(states *schemapb.FieldData, row int) string {
+	validData := states.GetValidData()
+	if len(validData) > 0 && !validData[row] {
+		return ""
+	}
+	return states.GetScalars().GetStringData().GetData()[row]
+}
+
+type ApproxCountDistinctAggregate struct {
+	fieldID      int64
+	originalName string
+}
+
+func (acd *ApproxCountDistinctAggregate) Name() string {
+	return kApproxCountDistinct
+}
+
+func (acd *ApproxCountDistinctAggregate) Update(target *FieldValue, new *FieldValue) error {
+	return updateSketchState(target, new, mergeHyperLogLogStates)
+}
+
+func (acd *ApproxCountDistinctAggregate) NewState() []*FieldValue {
+	return newSingleSlotState()
+}
+
+func (acd *ApproxCountDistinctAggregate) UpdateState(slots []*FieldValue, new *FieldValue) error {
+	if len(slots) != 1 {
+		return merr.WrapErrParameterInvalidMsg("aggregate expects 1 accumulator slot, got %d", len(slots))
+	}
+	return acd.Update(slots[0], new)
+}
+
+func (acd *ApproxCountDistinctAggregate) Terminate(slots []*FieldValue) (any, error) {
+	state, err := terminateSingleSlot(slots)
+	if err != nil {
+		return nil, err
+	}
+	if s, _ := state.(string); s != "" {
+		hll, err := decodeHyperLogLog(s)
+		if err != nil {
+			return nil, err
+		}
+		return hll.estimate(), nil
+	}
+	return int64(0), nil
+}
+
+// Finalize estimates the distinct count of every group, zero for a group
+// that saw no value.
+func (acd *ApproxCountDistinctAggregate) Finalize(states *schemapb.FieldData) (*schemapb.FieldData, error) {
+	rowCount := len(states.GetScalars().GetStringData().GetData())
+	estimates := make([]int64, rowCount)
+	for row := 0; row < rowCount; row++ {
+		state := sketchStateAt(states, row)
+		if state == "" {
+			continue
+		}
+		hll, err := decodeHyperLogLog(state)
+		if err != nil {
+			return nil, err
+		}
+		estimates[row] = hll.estimate()
+	}
+	return genEmptyLongFieldData(schemapb.DataType_Int64, estimates), nil
+}
+
+func (acd *ApproxCountDistinctAggregate) ToPB() *planpb.Aggregate {
+	return &planpb.Aggregate{Op: planpb.AggregateOp_approx_count_distinct, FieldId: acd.FieldID()}
+}
+
+func (acd *ApproxCountDistinctAggregate) FieldID() int64 {
+	return acd.fieldID
+}
+
+func (acd *ApproxCountDistinctAggregate) OriginalName() string {
+	return acd.originalName
+}
+
+type ApproxPercentileAggregate struct {
+	fieldID      int64
+	originalName string
+	percentile   float64
+}
+
+func (ap *ApproxPercentileAggregate) Name() string {
+	return kApproxPercentile
+}
+
+func (ap *ApproxPercentileAggregate) Update(target *FieldValue, new *FieldValue) error {
+	return updateSketchState(target, new, mergeTDigestStates)
+}
+
+func (ap *ApproxPercentileAggregate) NewState() []*FieldValue {
+	return newSingleSlotState()
+}
+
+func (ap *ApproxPercentileAggregate) UpdateState(slots []*FieldValue, new *FieldValue) error {
+	if len(slots) != 1 {
+		return merr.WrapErrParameterInvalidMsg("aggregate expects 1 accumulator slot, got %d", len(slots))
+	}
+	return ap.Update(slots[0], new)
+}
+
+func (ap *ApproxPercentileAggregate) quantileOf(state string) (float64, bool, error) {
+	if state == "" {
+		return 0, false, nil
+	}
+	digest, err := decodeTDigest(state)
+	if err != nil {
+		return 0, false, err
+	}
+	value := digest.quantile(ap.percentile)
+	if math.IsNaN(value) {
+		return 0, false, nil
+	}
+	return value, true, nil
+}
+
+func (ap *ApproxPercentileAggregate) Terminate(slots []*FieldValue) (any, error) {
+	state, err := terminateSingleSlot(slots)
+	if err != nil {
+		return nil, err
+	}
+	s, _ := state.(string)
+	value, ok, err := ap.quantileOf(s)
+	if err != nil || !ok {
+		return nil, err
+	}
+	return value, nil
+}
+
+// Finalize reads the percentile off the digest of every group, null for a
+// group that saw no value.
+func (ap *ApproxPercentileAggregate) Finalize(states *schemapb.FieldData) (*schemapb.FieldData, error) {
+	rowCount := len(states.GetScalars().GetStringData().GetData())
+	values := make([]float64, rowCount)
+	validData := make([]bool, rowCount)
+	hasNull := false
+	for row := 0; row < rowCount; row++ {
+		value, ok, err := ap.quantileOf(sketchStateAt(states, row))
+		if err != nil {
+			return nil, err
+		}
+		values[row] = value
+		validData[row] = ok
+		hasNull = hasNull || !ok
+	}
+	result := &schemapb.FieldData{
+		Type: schemapb.DataType_Double,
+		Field: &schemapb.FieldData_Scalars{
+			Scalars: &schemapb.ScalarField{
+				Data: &schemapb.ScalarField_DoubleData{DoubleData: &schemapb.DoubleArray{Data: values}},
+			},
+		},
+	}
+	if hasNull {
+		result.ValidData = validData
+	}
+	return result, nil
+}
+
+func (ap *ApproxPercentileAggregate) ToPB() *planpb.Aggregate {
+	return &planpb.Aggregate{Op: planpb.AggregateOp_approx_percentile, FieldId: ap.FieldID(), Percentile: ap.percentile}
+}
+
+func (ap *ApproxPercentileAggregate) FieldID() int64 {
+	return ap.fieldID
+}
+
+func (ap *ApproxPercentileAggregate) OriginalName() string {
+	return ap.originalName
+}
@@ -348,3 +348,70 @@ func TestAvgTerminateRejectsNonNumericState(t *testing.T) {
 	require.Error(t, err)
 	require.Contains(t, err.Error(), "avg expects numeric accumulator")
 }
+
+func TestMatchApproxAggregationExpression(t *testing.T) {
+	isAgg, op, field, argument := MatchAggregationExpression("APPROX_PERCENTILE(latency, 0.95)")
+	require.True(t, isAgg)
+	require.Equal(t, kApproxPercentile, op)
+	require.Equal(t, "latency", field)
+	require.Equal(t, "0.95", argument)
+
+	isAgg, op, field, argument = MatchAggregationExpression("approx_count_distinct( user_id )")
+	require.True(t, isAgg)
+	require.Equal(t, kApproxCountDistinct, op)
+	require.Equal(t, "user_id", field)
+	require.Empty(t, argument)
+
+	isAgg, _, _, _ = MatchAggregationExpression("approx_percentile(latency, 0.5, 0.9)")
+	require.False(t, isAgg)
+}
+
+func TestNewApproxAggregates(t *testing.T) {
+	aggs, err := NewAggregateWithArgument(kApproxPercentile, 7, "approx_percentile(v, 0.95)", schemapb.DataType_Float, "0.95")
+	require.NoError(t, err)
+	require.Len(t, aggs, 1)
+	pb := aggs[0].ToPB()
+	require.Equal(t, planpb.AggregateOp_approx_percentile, pb.GetOp())
+	require.Equal(t, int64(7), pb.GetFieldId())
+	require.Equal(t, 0.95, pb.GetPercentile())
+	fromPB, err := FromPB(aggs[0].ToPB())
+	require.NoError(t, err)
+	require.Equal(t, 0.95, fromPB.(*ApproxPercentileAggregate).percentile)
+
+	for _, argument := range []string{"", "1.5", "-0.1", "p95"} {
+		_, err = NewAggregateWithArgument(kApproxPercentile, 7, "p", schemapb.DataType_Float, argument)
+		require.Error(t, err, argument)
+	}
+	_, err = NewAggregateWithArgument(kApproxPercentile, 7, "p", schemapb.DataType_VarChar, "0.5")
+	require.Error(t, err)
+	_, err = NewAggregateWithArgument(kSum, 7, "s", schemapb.DataType_Int64, "0.5")
+	require.Error(t, err)
+
+	aggs, err = NewAggregate(kApproxCountDistinct, 8, "approx_count_distinct(s)", schemapb.DataType_VarChar)
+	require.NoError(t, err)
+	require.Equal(t, planpb.AggregateOp_approx_count_distinct, aggs[0].ToPB().GetOp())
+}
+
+func TestSketchAggregateUpdateMergesStates(t *testing.T) {
+	acd := &ApproxCountDistinctAggregate{}
+	target := NewNullFieldValue()
+	require.NoError(t, acd.Update(target, NewFieldValue("")))
+	require.True(t, target.IsNull())
+	require.NoError(t, acd.Update(target, NewFieldValue(segcoreHyperLogLogA)))
+	require.NoError(t, acd.Update(target, NewNullFieldValue()))
+	require.NoError(t, acd.Update(target, NewFieldValue(segcoreHyperLogLogB)))
+	estimate, err := acd.Terminate([]*FieldValue{target})
+	require.NoError(t, err)
+	require.Equal(t, int64(6), estimate)
+	require.Error(t, acd.Update(target, NewFieldValue(int64(1))))
+
+	ap := &ApproxPercentileAggregate{percentile: 0.5}
+	state := ap.NewState()
+	value, err := ap.Terminate(state)
+	require.NoError(t, err)
+	require.Nil(t, value)
+	require.NoError(t, ap.UpdateState(state, NewFieldValue(segcoreTDigestD)))
+	value, err = ap.Terminate(state)
+	require.NoError(t, err)
+	require.Equal(t, 2.0, value)
+}
@@ -0,0 +1,269 @@
+package agg
+
+import (
+	"encoding/binary"
+	"encoding/hex"
+	"math"
+	"sort"
+
+	"github.com/milvus-io/milvus/pkg/v3/util/merr"
+)
+
+// The approximate aggregates reduce the sketches segcore emits as their
+// partial states, see exec/operator/query-agg/HyperLogLog.h and TDigest.h.
+// A state is the hex encoded serialization of the sketch, the reducers only
+// have to merge them and the proxy reads the final answer off the merged
+// sketch, so the values themselves are never hashed here.
+
+const (
+	hyperLogLogStateVersion = 1
+	hyperLogLogMinPrecision = 4
+	hyperLogLogMaxPrecision = 18
+
+	tDigestStateVersion   = 1
+	tDigestMinCompression = 10
+)
+
+type hyperLogLog struct {
+	precision uint8
+	registers []uint8
+}
+
+func decodeHyperLogLog(state string) (*hyperLogLog, error) {
+	data, err := hex.DecodeString(state)
+	if err != nil {
+		return nil, merr.WrapErrServiceInternalMsg("invalid hyperloglog state: %s", err.Error())
+	}
+	if len(data) < 2 {
+		return nil, merr.WrapErrServiceInternalMsg("hyperloglog state too short")
+	}
+	if data[0] != hyperLogLogStateVersion {
+		return nil, merr.WrapErrServiceInternalMsg("unknown hyperloglog state version %d", data[0])
+	}
+	precision := data[1]
+	if precision < hyperLogLogMinPrecision || precision > hyperLogLogMaxPrecision {
+		return nil, merr.WrapErrServiceInternalMsg("hyperloglog precision %d out of range [%d, %d]",
+			precision, hyperLogLogMinPrecision, hyperLogLogMaxPrecision)
+	}
+	if len(data) != 2+(1<<precision) {
+		return nil, merr.WrapErrServiceInternalMsg("hyperloglog state size %d mismatches precision %d", len(data), precision)
+	}
+	return &hyperLogLog{precision: precision, registers: data[2:]}, nil
+}
+
+func (hll *hyperLogLog) merge(other *hyperLogLog) error {
+	if hll.precision != other.precision {
+		return merr.WrapErrServiceInternalMsg("cannot merge hyperloglog of precision %d into %d", other.precision, hll.precision)
+	}
+	for i, r := range other.registers {
+		if r > hll.registers[i] {
+			hll.registers[i] = r
+		}
+	}
+	return nil
+}
+
+func (hll *hyperLogLog) estimate() int64 {
+	m := float64(len(hll.registers))
+	sum := 0.0
+	zeros := 0
+	for _, r := range hll.registers {
+		sum += math.Ldexp(1, -int(r))
+		if r == 0 {
+			zeros++
+		}
+	}
+	alpha := 0.7213 / (1 + 1.079/m)
+	estimate := alpha * m * m / sum
+	// linear counting is far more accurate while many registers are empty
+	if estimate <= 2.5*m && zeros > 0 {
+		estimate = m * math.Log(m/float64(zeros))
+	}
+	return int64(math.Round(estimate))
+}
+
+func (hll *hyperLogLog) encode() string {
+	data := make([]byte, 0, 2+len(hll.registers))
+	data = append(data, hyperLogLogStateVersion, hll.precision)
+	data = append(data, hll.registers...)
+	return hex.EncodeToString(data)
+}
+
+type tDigestCentroid struct {
+	mean   float64
+	weight float64
+}
+
+type tDigest struct {
+	compression  float64
+	centroids    []tDigestCentroid
+	totalWeight  float64
+	buffer       []tDigestCentroid
+	bufferWeight float64
+	min          float64
+	max          float64
+}
+
+func decodeTDigest(state string) (*tDigest, error) {
+	data, err := hex.DecodeString(state)
+	if err != nil {
+		return nil, merr.WrapErrServiceInternalMsg("invalid t-digest state: %s", err.Error())
+	}
+	const headerSize = 1 + 8*3 + 4
+	if len(data) < headerSize {
+		return nil, merr.WrapErrServiceInternalMsg("t-digest state truncated")
+	}
+	if data[0] != tDigestStateVersion {
+		return nil, merr.WrapErrServiceInternalMsg("unknown t-digest state version %d", data[0])
+	}
+	readFloat := func(pos int) float64 {
+		return math.Float64frombits(binary.LittleEndian.Uint64(data[pos:]))
+	}
+	digest := &tDigest{
+		compression: readFloat(1),
+		min:         readFloat(9),
+		max:         readFloat(17),
+	}
+	if digest.compression < tDigestMinCompression {
+		return nil, merr.WrapErrServiceInternalMsg("t-digest compression %v is too small", digest.compression)
+	}
+	count := int(binary.LittleEndian.Uint32(data[25:]))
+	if len(data) != headerSize+count*16 {
+		return nil, merr.WrapErrServiceInternalMsg("t-digest state size %d mismatches %d centroids", len(data), count)
+	}
+	digest.centroids = make([]tDigestCentroid, count)
+	for i := range digest.centroids {
+		pos := headerSize + i*16
+		digest.centroids[i] = tDigestCentroid{mean: readFloat(pos), weight: readFloat(pos + 8)}
+		digest.totalWeight += digest.centroids[i].weight
+	}
+	return digest, nil
+}
+
+func (digest *tDigest) merge(other *tDigest) {
+	for _, c := range other.centroids {
+		digest.buffer = append(digest.buffer, c)
+		digest.bufferWeight += c.weight
+	}
+	for _, c := range other.buffer {
+		digest.buffer = append(digest.buffer, c)
+		digest.bufferWeight += c.weight
+	}
+	digest.min = math.Min(digest.min, other.min)
+	digest.max = math.Max(digest.max, other.max)
+	digest.compress()
+}
+
+// compress folds the buffered centroids into the digest, a cluster may grow
+// while its weight stays under 4 * N * q * (1 - q) / compression, q being the
+// quantile at its center.
+func (digest *tDigest) compress() {
+	if len(digest.buffer) == 0 {
+		return
+	}
+	all := append(digest.buffer, digest.centroids...)
+	sort.Slice(all, func(i, j int) bool { return all[i].mean < all[j].mean })
+	digest.totalWeight += digest.bufferWeight
+	centroids := make([]tDigestCentroid, 0, len(digest.centroids))
+
+	before := 0.0
+	current := all[0]
+	for _, next := range all[1:] {
+		merged := current.weight + next.weight
+		q := (before + merged/2) / digest.totalWeight
+		limit := 4 * digest.totalWeight * q * (1 - q) / digest.compression
+		if merged <= limit {
+			current.mean += (next.mean - current.mean) * next.weight / merged
+			current.weight = merged
+		} else {
+			before += current.weight
+			centroids = append(centroids, current)
+			current = next
+		}
+	}
+	digest.centroids = append(centroids, current)
+	digest.buffer = nil
+	digest.bufferWeight = 0
+}
+
+// quantile returns NaN when the digest is empty, q is clamped to [0, 1].
+func (digest *tDigest) quantile(q float64) float64 {
+	digest.compress()
+	centroids := digest.centroids
+	if len(centroids) == 0 {
+		return math.NaN()
+	}
+	q = math.Max(0, math.Min(1, q))
+	if len(centroids) == 1 {
+		return centroids[0].mean
+	}
+	target := q * digest.totalWeight
+	// each centroid sits at the center of the weight it covers, values are
+	// interpolated between neighbouring centers and the observed extremes
+	firstCenter := centroids[0].weight / 2
+	if target <= firstCenter {
+		frac := 0.0
+		if firstCenter > 0 {
+			frac = target / firstCenter
+		}
+		return digest.min + (centroids[0].mean-digest.min)*frac
+	}
+	cumulative := 0.0
+	for i := 0; i+1 < len(centroids); i++ {
+		left, right := centroids[i], centroids[i+1]
+		leftCenter := cumulative + left.weight/2
+		rightCenter := cumulative + left.weight + right.weight/2
+		if target <= rightCenter {
+			frac := (target - leftCenter) / (rightCenter - leftCenter)
+			return left.mean + (right.mean-left.mean)*frac
+		}
+		cumulative += left.weight
+	}
+	last := centroids[len(centroids)-1]
+	lastCenter := digest.totalWeight - last.weight/2
+	frac := (target - lastCenter) / (last.weight / 2)
+	return last.mean + (digest.max-last.mean)*math.Min(frac, 1)
+}
+
+func (digest *tDigest) encode() string {
+	digest.compress()
+	data := make([]byte, 0, 1+8*3+4+len(digest.centroids)*16)
+	data = append(data, tDigestStateVersion)
+	data = binary.LittleEndian.AppendUint64(data, math.Float64bits(digest.compression))
+	data = binary.LittleEndian.AppendUint64(data, math.Float64bits(digest.min))
+	data = binary.LittleEndian.AppendUint64(data, math.Float64bits(digest.max))
+	data = binary.LittleEndian.AppendUint32(data, uint32(len(digest.centroids)))
+	for _, c := range digest.centroids {
+		data = binary.LittleEndian.AppendUint64(data, math.Float64bits(c.mean))
+		data = binary.LittleEndian.AppendUint64(data, math.Float64bits(c.weight))
+	}
+	return hex.EncodeToString(data)
+}
+
+func mergeHyperLogLogStates(target, new string) (string, error) {
+	left, err := decodeHyperLogLog(target)
+	if err != nil {
+		return "", err
+	}
+	right, err := decodeHyperLogLog(new)
+	if err != nil {
+		return "", err
+	}
+	if err := left.merge(right); err != nil {
+		return "", err
+	}
+	return left.encode(), nil
+}
+
+func mergeTDigestStates(target, new string) (string, error) {
+	left, err := decodeTDigest(target)
+	if err != nil {
+		return "", err
+	}
+	right, err := decodeTDigest(new)
+	if err != nil {
+		return "", err
+	}
+	left.merge(right)
+	return left.encode(), nil
+}
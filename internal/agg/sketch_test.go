@@ -0,0 +1,106 @@
+package agg
+
+import (
+	"math"
+	"math/bits"
+	"testing"
+
+	"github.com/stretchr/testify/assert"
+	"github.com/stretchr/testify/require"
+)
+
+// States serialized by segcore: a precision 4 HyperLogLog over the hashes of
+// 0..4 and of 3..8, and t-digests of {1, 2, 3} and {10, 20}.
+const (
+	segcoreHyperLogLogA = "010400010000000001000004000000000300"
+	segcoreHyperLogLogB = "010400010000000003000001000100000000"
+	segcoreTDigestD     = "010000000000005940000000000000f03f000000000000084003000000000000000000f03f000000000000f03f0000000000000040000000000000f03f0000000000000840000000000000f03f"
+	segcoreTDigestE     = "01000000000000594000000000000024400000000000003440020000000000000000002440000000000000f03f0000000000003440000000000000f03f"
+)
+
+func TestHyperLogLogState(t *testing.T) {
+	a, err := decodeHyperLogLog(segcoreHyperLogLogA)
+	require.NoError(t, err)
+	assert.Equal(t, int64(5), a.estimate())
+	assert.Equal(t, segcoreHyperLogLogA, a.encode())
+
+	merged, err := mergeHyperLogLogStates(segcoreHyperLogLogA, segcoreHyperLogLogB)
+	require.NoError(t, err)
+	assert.Equal(t, "010400010000000003000004000100000300", merged)
+
+	_, err = decodeHyperLogLog("01")
+	assert.Error(t, err)
+	_, err = decodeHyperLogLog("0104")
+	assert.Error(t, err)
+	_, err = decodeHyperLogLog("zz")
+	assert.Error(t, err)
+
+	other := &hyperLogLog{precision: 5, registers: make([]uint8, 32)}
+	assert.Error(t, a.merge(other))
+}
+
+func TestHyperLogLogEstimate(t *testing.T) {
+	// registers as segcore fills them from well mixed hashes
+	hll := &hyperLogLog{precision: 12, registers: make([]uint8, 1<<12)}
+	assert.Equal(t, int64(0), hll.estimate())
+	for i := uint64(0); i < 100000; i++ {
+		hash := splitMix64(i)
+		index := hash >> (64 - 12)
+		rest := (hash << 12) | (1 << 11)
+		rank := uint8(bits.LeadingZeros64(rest) + 1)
+		if rank > hll.registers[index] {
+			hll.registers[index] = rank
+		}
+	}
+	assert.InDelta(t, 100000, hll.estimate(), 5000)
+
+	restored, err := decodeHyperLogLog(hll.encode())
+	require.NoError(t, err)
+	assert.Equal(t, hll.estimate(), restored.estimate())
+}
+
+func TestTDigestState(t *testing.T) {
+	d, err := decodeTDigest(segcoreTDigestD)
+	require.NoError(t, err)
+	assert.Equal(t, 2.0, d.quantile(0.5))
+	assert.Equal(t, segcoreTDigestD, d.encode())
+
+	merged, err := mergeTDigestStates(segcoreTDigestD, segcoreTDigestE)
+	require.NoError(t, err)
+	digest, err := decodeTDigest(merged)
+	require.NoError(t, err)
+	// the quantiles segcore reads off the same merged digest
+	for q, expected := range map[float64]float64{0: 1, 0.25: 1.75, 0.5: 3, 0.95: 20, 1: 20} {
+		assert.InDelta(t, expected, digest.quantile(q), 1e-9, "q=%v", q)
+	}
+
+	assert.True(t, math.IsNaN((&tDigest{compression: 100}).quantile(0.5)))
+	_, err = decodeTDigest("01")
+	assert.Error(t, err)
+	_, err = decodeTDigest(segcoreTDigestD[:len(segcoreTDigestD)-2])
+	assert.Error(t, err)
+}
+
+func TestTDigestMergeAccuracy(t *testing.T) {
+	low := &tDigest{compression: 100, min: math.Inf(1), max: math.Inf(-1)}
+	high := &tDigest{compression: 100, min: math.Inf(1), max: math.Inf(-1)}
+	for i := 0; i < 50000; i++ {
+		low.merge(&tDigest{centroids: []tDigestCentroid{{float64(i), 1}}, min: float64(i), max: float64(i)})
+		high.merge(&tDigest{centroids: []tDigestCentroid{{float64(50000 + i), 1}}, min: float64(50000 + i), max: float64(50000 + i)})
+	}
+	restored, err := decodeTDigest(high.encode())
+	require.NoError(t, err)
+	low.merge(restored)
+	assert.Equal(t, 100000.0, low.totalWeight)
+	assert.InDelta(t, 50000, low.quantile(0.5), 200)
+	assert.InDelta(t, 99000, low.quantile(0.99), 200)
+	assert.Equal(t, 0.0, low.quantile(0))
+	assert.Equal(t, 99999.0, low.quantile(1))
+}
+
+func splitMix64(x uint64) uint64 {
+	x += 0x9e3779b97f4a7c15
+	x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9
+	x = (x ^ (x >> 27)) * 0x94d049bb133111eb
+	return x ^ (x >> 31)
+}
@@ -0,0 +1,88 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "BenchmarkEnv.h"
+
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+
+#include "cachinglayer/Manager.h"
+#include "common/EasyAssert.h"
+#include "common/common_type_c.h"
+#include "exec/expression/function/init_c.h"
+#include "folly/init/Init.h"
+#include "index/Meta.h"
+#include "segcore/arrow_fs_c.h"
+#include "storage/LocalChunkManagerSingleton.h"
+#include "storage/MmapManager.h"
+#include "storage/RemoteChunkManagerSingleton.h"
+#include "test_utils/Constants.h"
+#include "test_utils/storage_test_utils.h"
+
+// Referenced by the shared test utilities.
+std::string TestLocalPath;
+std::string TestRemotePath;
+std::string TestMmapPath;
+
+namespace milvus::bench {
+
+void
+InitBenchmarkEnvironment(int* argc, char*** argv, const std::string& name) {
+    static std::unique_ptr<folly::Init> folly_init;
+    folly_init = std::make_unique<folly::Init>(argc, argv, false);
+
+    auto base_dir = (std::filesystem::temp_directory_path() /
+                     (name + "_" + std::to_string(getpid())))
+                        .string();
+    TestLocalPath = base_dir + "/local_data/";
+    TestRemotePath = base_dir + "/remote_data/";
+    TestMmapPath = base_dir + "/mmap_data/";
+    std::filesystem::create_directories(TestLocalPath);
+    std::filesystem::create_directories(TestRemotePath);
+    std::filesystem::create_directories(TestMmapPath);
+
+    InitExecExpressionFunctionFactory();
+    storage::LocalChunkManagerSingleton::GetInstance().Init(TestLocalPath);
+    storage::RemoteChunkManagerSingleton::GetInstance().Init(
+        get_default_local_storage_config());
+    storage::MmapManager::GetInstance().Init(get_default_mmap_config());
+
+    CStorageConfig arrow_fs_config = {};
+    arrow_fs_config.root_path = TestLocalPath.c_str();
+    arrow_fs_config.storage_type = "local";
+    auto c_status = InitArrowFileSystem(arrow_fs_config);
+    AssertInfo(c_status.error_code == 0, "failed to init arrow filesystem");
+
+    static const int64_t mb = 1024 * 1024;
+    cachinglayer::Manager::ConfigureTieredStorage(
+        {CacheWarmupPolicy::CacheWarmupPolicy_Disable,
+         CacheWarmupPolicy::CacheWarmupPolicy_Disable,
+         CacheWarmupPolicy::CacheWarmupPolicy_Disable,
+         CacheWarmupPolicy::CacheWarmupPolicy_Disable},
+        {8192 * mb, 8192 * mb, 8192 * mb, 8192 * mb, 8192 * mb, 8192 * mb},
+        true,
+        true,
+        {10, true, 30},
+        std::chrono::milliseconds(0),
+        std::chrono::milliseconds(-1));
+    index::kOverrideRootPathForUT = "files";
+}
+
+}  // namespace milvus::bench
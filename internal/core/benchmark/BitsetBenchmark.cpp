@@ -0,0 +1,361 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Benchmark of the bitset kernels of every implementation the CPU runs,
+// side by side: the element-wise code, the vectorized x86 (AVX2, AVX-512)
+// and ARM (NEON, SVE) kernels, and the Dynamic dispatch the engine uses,
+// which should match the best of them. A Dynamic as slow as ElementWise
+// means the dispatch fell back to the scalar code.
+//
+// Kernels, each over `size` rows starting `offset` elements (and bits) into
+// the data, so offset 1 runs every kernel unaligned:
+//   CompareVal      values > 50
+//   CompareColumn   a < b, element-wise over two columns
+//   WithinRange     20 <= values < 80
+//   ArithCompare    values + 1 == 50
+//   And / Or / Xor  in place with a second bitset
+//   Count           popcount
+//   FindNext        visits every set bit of a 1/64 dense bitset
+// Count and FindNext have no platform kernels and run the same code under
+// every policy, they are there to compare against the others.
+//
+// Example:
+//   bitset_benchmark --benchmark_filter='CompareVal/.*/int32.*'
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "bitset/bitset.h"
+#include "bitset/common.h"
+#include "bitset/detail/element_vectorized.h"
+#include "bitset/detail/element_wise.h"
+#include "bitset/detail/platform/dynamic.h"
+
+#if defined(__x86_64__)
+#include "bitset/detail/platform/x86/avx2.h"
+#include "bitset/detail/platform/x86/avx512.h"
+#include "bitset/detail/platform/x86/instruction_set.h"
+#endif
+
+#if defined(__aarch64__)
+#include "bitset/detail/platform/arm/instruction_set.h"
+#include "bitset/detail/platform/arm/neon.h"
+#if defined(BITSET_ENABLE_SVE_SUPPORT)
+#include "bitset/detail/platform/arm/sve.h"
+#endif
+#endif
+
+namespace milvus::bitset::bench {
+namespace {
+
+using ElementWiseBitset =
+    Bitset<detail::ElementWiseBitsetPolicy<uint64_t>,
+           std::vector<uint8_t>,
+           false>;
+
+template <typename VectorizerT>
+using VectorizedBitset =
+    Bitset<detail::VectorizedElementWiseBitsetPolicy<uint64_t, VectorizerT>,
+           std::vector<uint8_t>,
+           false>;
+
+// one more than the largest offset, keeps the offset views in bounds
+constexpr size_t kSlack = 64;
+
+template <typename T>
+std::vector<T>
+Values(size_t size, uint32_t seed) {
+    std::default_random_engine er(seed);
+    std::uniform_int_distribution<int> dist(0, 99);
+    std::vector<T> values(size + kSlack);
+    for (auto& value : values) {
+        value = static_cast<T>(dist(er));
+    }
+    return values;
+}
+
+// a bitset of `size` + kSlack bits, one in `one_in` set
+template <typename BitsetT>
+BitsetT
+RandomBits(size_t size, int one_in, uint32_t seed) {
+    std::default_random_engine er(seed);
+    std::uniform_int_distribution<int> dist(0, one_in - 1);
+    BitsetT bits(size + kSlack, false);
+    for (size_t i = 0; i < bits.size(); ++i) {
+        if (dist(er) == 0) {
+            bits[i] = true;
+        }
+    }
+    return bits;
+}
+
+// items are rows (bits), bytes what one iteration reads
+void
+Report(benchmark::State& state, size_t size, size_t bytes) {
+    state.SetItemsProcessed(state.iterations() * size);
+    state.SetBytesProcessed(state.iterations() * bytes);
+}
+
+// state.range(0) is the size, state.range(1) the offset
+template <typename BitsetT, typename T>
+void
+CompareValBenchmark(benchmark::State& state) {
+    size_t size = state.range(0);
+    size_t offset = state.range(1);
+    auto values = Values<T>(size, 42);
+    BitsetT bits(size + kSlack);
+    auto view = bits.view(offset, size);
+    const T value = 50;
+    for (auto _ : state) {
+        view.template inplace_compare_val<T, CompareOpType::GT>(
+            values.data() + offset, size, value);
+        benchmark::ClobberMemory();
+    }
+    Report(state, size, size * sizeof(T));
+}
+
+template <typename BitsetT, typename T>
+void
+CompareColumnBenchmark(benchmark::State& state) {
+    size_t size = state.range(0);
+    size_t offset = state.range(1);
+    auto left = Values<T>(size, 42);
+    auto right = Values<T>(size, 43);
+    BitsetT bits(size + kSlack);
+    auto view = bits.view(offset, size);
+    for (auto _ : state) {
+        view.template inplace_compare_column<T, T, CompareOpType::LT>(
+            left.data() + offset, right.data() + offset, size);
+        benchmark::ClobberMemory();
+    }
+    Report(state, size, size * 2 * sizeof(T));
+}
+
+template <typename BitsetT, typename T>
+void
+WithinRangeBenchmark(benchmark::State& state) {
+    size_t size = state.range(0);
+    size_t offset = state.range(1);
+    auto values = Values<T>(size, 42);
+    BitsetT bits(size + kSlack);
+    auto view = bits.view(offset, size);
+    const T lower = 20;
+    const T upper = 80;
+    for (auto _ : state) {
+        view.template inplace_within_range_val<T, RangeType::IncExc>(
+            lower, upper, values.data() + offset, size);
+        benchmark::ClobberMemory();
+    }
+    Report(state, size, size * sizeof(T));
+}
+
+template <typename BitsetT, typename T>
+void
+ArithCompareBenchmark(benchmark::State& state) {
+    size_t size = state.range(0);
+    size_t offset = state.range(1);
+    auto values = Values<T>(size, 42);
+    BitsetT bits(size + kSlack);
+    auto view = bits.view(offset, size);
+    const ArithHighPrecisionType<T> right_operand = 1;
+    const ArithHighPrecisionType<T> value = 50;
+    for (auto _ : state) {
+        view.template inplace_arith_compare<T,
+                                            ArithOpType::Add,
+                                            CompareOpType::EQ>(
+            values.data() + offset, right_operand, value, size);
+        benchmark::ClobberMemory();
+    }
+    Report(state, size, size * sizeof(T));
+}
+
+enum class LogicOp { kAnd, kOr, kXor };
+
+template <typename BitsetT, LogicOp Op>
+void
+LogicBenchmark(benchmark::State& state) {
+    size_t size = state.range(0);
+    size_t offset = state.range(1);
+    auto bits = RandomBits<BitsetT>(size, 2, 42);
+    auto other = RandomBits<BitsetT>(size, 2, 43);
+    auto view = bits.view(offset, size);
+    auto other_view = other.view(offset, size);
+    for (auto _ : state) {
+        if constexpr (Op == LogicOp::kAnd) {
+            view.inplace_and(other_view, size);
+        } else if constexpr (Op == LogicOp::kOr) {
+            view.inplace_or(other_view, size);
+        } else {
+            view.inplace_xor(other_view, size);
+        }
+        benchmark::ClobberMemory();
+    }
+    Report(state, size, size / 8 * 2);
+}
+
+template <typename BitsetT>
+void
+CountBenchmark(benchmark::State& state) {
+    size_t size = state.range(0);
+    size_t offset = state.range(1);
+    auto bits = RandomBits<BitsetT>(size, 2, 42);
+    auto view = bits.view(offset, size);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(view.count());
+    }
+    Report(state, size, size / 8);
+}
+
+template <typename BitsetT>
+void
+FindNextBenchmark(benchmark::State& state) {
+    size_t size = state.range(0);
+    size_t offset = state.range(1);
+    auto bits = RandomBits<BitsetT>(size, 64, 42);
+    auto view = bits.view(offset, size);
+    for (auto _ : state) {
+        size_t found = 0;
+        for (auto i = view.find_first(); i.has_value();
+             i = view.find_next(*i)) {
+            ++found;
+        }
+        benchmark::DoNotOptimize(found);
+    }
+    Report(state, size, size / 8);
+}
+
+void
+ApplyArgs(benchmark::internal::Benchmark* benchmark) {
+    benchmark->ArgNames({"size", "offset"})
+        ->ArgsProduct({{1 << 10, 1 << 14, 1 << 20}, {0, 1}});
+}
+
+template <typename T>
+const char*
+TypeName() {
+    if constexpr (std::is_same_v<T, int8_t>) {
+        return "int8";
+    } else if constexpr (std::is_same_v<T, int16_t>) {
+        return "int16";
+    } else if constexpr (std::is_same_v<T, int32_t>) {
+        return "int32";
+    } else if constexpr (std::is_same_v<T, int64_t>) {
+        return "int64";
+    } else if constexpr (std::is_same_v<T, float>) {
+        return "float";
+    } else {
+        return "double";
+    }
+}
+
+template <typename BitsetT, typename T>
+void
+RegisterTypedBenchmarks(const std::string& impl) {
+    auto name = [&impl](const char* kernel) {
+        return std::string(kernel) + "/" + impl + "/" + TypeName<T>();
+    };
+    benchmark::RegisterBenchmark(name("CompareVal").c_str(),
+                                 CompareValBenchmark<BitsetT, T>)
+        ->Apply(ApplyArgs);
+    benchmark::RegisterBenchmark(name("CompareColumn").c_str(),
+                                 CompareColumnBenchmark<BitsetT, T>)
+        ->Apply(ApplyArgs);
+    benchmark::RegisterBenchmark(name("WithinRange").c_str(),
+                                 WithinRangeBenchmark<BitsetT, T>)
+        ->Apply(ApplyArgs);
+    benchmark::RegisterBenchmark(name("ArithCompare").c_str(),
+                                 ArithCompareBenchmark<BitsetT, T>)
+        ->Apply(ApplyArgs);
+}
+
+template <typename BitsetT>
+void
+RegisterBenchmarks(const std::string& impl) {
+    RegisterTypedBenchmarks<BitsetT, int8_t>(impl);
+    RegisterTypedBenchmarks<BitsetT, int16_t>(impl);
+    RegisterTypedBenchmarks<BitsetT, int32_t>(impl);
+    RegisterTypedBenchmarks<BitsetT, int64_t>(impl);
+    RegisterTypedBenchmarks<BitsetT, float>(impl);
+    RegisterTypedBenchmarks<BitsetT, double>(impl);
+
+    benchmark::RegisterBenchmark(("And/" + impl).c_str(),
+                                 LogicBenchmark<BitsetT, LogicOp::kAnd>)
+        ->Apply(ApplyArgs);
+    benchmark::RegisterBenchmark(("Or/" + impl).c_str(),
+                                 LogicBenchmark<BitsetT, LogicOp::kOr>)
+        ->Apply(ApplyArgs);
+    benchmark::RegisterBenchmark(("Xor/" + impl).c_str(),
+                                 LogicBenchmark<BitsetT, LogicOp::kXor>)
+        ->Apply(ApplyArgs);
+    benchmark::RegisterBenchmark(("Count/" + impl).c_str(),
+                                 CountBenchmark<BitsetT>)
+        ->Apply(ApplyArgs);
+    benchmark::RegisterBenchmark(("FindNext/" + impl).c_str(),
+                                 FindNextBenchmark<BitsetT>)
+        ->Apply(ApplyArgs);
+}
+
+// Registers the implementations this CPU can run.
+void
+RegisterImplementations() {
+    RegisterBenchmarks<ElementWiseBitset>("ElementWise");
+#if defined(__x86_64__)
+    if (detail::x86::cpu_support_avx2()) {
+        RegisterBenchmarks<VectorizedBitset<detail::x86::VectorizedAvx2>>(
+            "Avx2");
+    }
+    if (detail::x86::cpu_support_avx512()) {
+        RegisterBenchmarks<VectorizedBitset<detail::x86::VectorizedAvx512>>(
+            "Avx512");
+    }
+#endif
+#if defined(__aarch64__)
+    RegisterBenchmarks<VectorizedBitset<detail::arm::VectorizedNeon>>("Neon");
+#if defined(BITSET_ENABLE_SVE_SUPPORT)
+    if (detail::arm::InstructionSet::GetInstance().supports_sve()) {
+        RegisterBenchmarks<VectorizedBitset<detail::arm::VectorizedSve>>(
+            "Sve");
+    }
+#endif
+#endif
+    RegisterBenchmarks<VectorizedBitset<detail::VectorizedDynamic>>(
+        "Dynamic");
+}
+
+}  // namespace
+}  // namespace milvus::bitset::bench
+
+int
+main(int argc, char** argv) {
+    using namespace milvus::bitset;
+    benchmark::Initialize(&argc, argv);
+    benchmark::AddCustomContext("dynamic_implementation",
+                                detail::dynamic_implementation());
+    if (detail::dynamic_implementation_limited_by_build()) {
+        benchmark::AddCustomContext("dynamic_limited_by_build", "true");
+    }
+    bench::RegisterImplementations();
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,581 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Benchmarks for the expression engine hot paths.
+//
+// Builds one synthetic collection and loads it three ways: a sealed segment
+// with raw data only, a sealed segment with scalar indexes on every scalar
+// field, and a growing segment. Every expression family then runs against
+// each of them through the regular FilterBitsNode pipeline.
+//
+// Extra flags (parsed before the google benchmark flags are handed over):
+//   --expr_bench_rows=N        rows per segment (default 1000000)
+//   --expr_bench_types=a,b,..  field types to generate, any of
+//                              int8,int16,int32,int64,float,double,varchar,json
+//                              (default: all)
+//   --expr_bench_simd=LEVEL    baseline | avx2 | avx512, caps the SIMD level
+//                              of simdFilterChunk (default: best available)
+//
+// Example:
+//   expr_benchmark --expr_bench_rows=200000 --expr_bench_simd=avx2 \
+//       --benchmark_filter='Term/.*'
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "BenchmarkEnv.h"
+#include "common/Consts.h"
+#include "common/Schema.h"
+#include "common/Types.h"
+#include "exec/expression/SimdFilter.h"
+#include "expr/ITypeExpr.h"
+#include "index/ScalarIndexSort.h"
+#include "index/StringIndexMarisa.h"
+#include "plan/PlanNode.h"
+#include "query/ExecPlanNodeVisitor.h"
+#include "segcore/ChunkedSegmentSealedImpl.h"
+#include "segcore/SegmentGrowingImpl.h"
+#include "test_utils/DataGen.h"
+#include "test_utils/cachinglayer_test_utils.h"
+#include "test_utils/storage_test_utils.h"
+
+namespace milvus::exec::bench {
+namespace {
+
+using proto::plan::GenericValue;
+using proto::plan::OpType;
+using segcore::DataGen;
+using segcore::GeneratedData;
+
+// Number of values kept per field to derive predicates from.
+constexpr size_t kSampleSize = 4096;
+
+struct BenchConfig {
+    int64_t rows{1000000};
+    std::vector<std::pair<std::string, DataType>> types{
+        {"int8", DataType::INT8},
+        {"int16", DataType::INT16},
+        {"int32", DataType::INT32},
+        {"int64", DataType::INT64},
+        {"float", DataType::FLOAT},
+        {"double", DataType::DOUBLE},
+        {"varchar", DataType::VARCHAR},
+        {"json", DataType::JSON},
+    };
+    SimdFilterLevel simd_level{detectSimdFilterLevel()};
+};
+
+BenchConfig&
+Config() {
+    static BenchConfig config;
+    return config;
+}
+
+enum class SegmentKind { kSealed = 0, kSealedIndexed = 1, kGrowing = 2 };
+
+const char*
+SegmentKindName(SegmentKind kind) {
+    switch (kind) {
+        case SegmentKind::kSealed:
+            return "sealed";
+        case SegmentKind::kSealedIndexed:
+            return "sealed_index";
+        case SegmentKind::kGrowing:
+            return "growing";
+    }
+    return "unknown";
+}
+
+const char*
+SimdLevelName(SimdFilterLevel level) {
+    switch (level) {
+        case SimdFilterLevel::kBaseline:
+            return "baseline";
+        case SimdFilterLevel::kAvx2:
+            return "avx2";
+        case SimdFilterLevel::kAvx512:
+            return "avx512";
+    }
+    return "unknown";
+}
+
+template <typename T>
+GenericValue
+ToGenericValue(const T& value) {
+    GenericValue generic;
+    if constexpr (std::is_same_v<T, std::string>) {
+        generic.set_string_val(value);
+    } else if constexpr (std::is_floating_point_v<T>) {
+        generic.set_float_val(static_cast<double>(value));
+    } else {
+        generic.set_int64_val(static_cast<int64_t>(value));
+    }
+    return generic;
+}
+
+template <typename F>
+void
+VisitScalarType(DataType type, F&& f) {
+    switch (type) {
+        case DataType::INT8:
+            return f(int8_t{});
+        case DataType::INT16:
+            return f(int16_t{});
+        case DataType::INT32:
+            return f(int32_t{});
+        case DataType::INT64:
+            return f(int64_t{});
+        case DataType::FLOAT:
+            return f(float{});
+        case DataType::DOUBLE:
+            return f(double{});
+        case DataType::VARCHAR:
+            return f(std::string{});
+        default:
+            ThrowInfo(DataTypeInvalid,
+                      "unsupported benchmark field type {}",
+                      GetDataTypeName(type));
+    }
+}
+
+// Synthetic collection shared by all benchmarks, built on first use.
+struct BenchData {
+    SchemaPtr schema;
+    std::map<DataType, FieldId> fields;
+    // sorted, deduplicated sample of every scalar field
+    std::map<DataType, std::vector<GenericValue>> samples;
+    segcore::SegmentSealedUPtr sealed;
+    segcore::SegmentSealedUPtr sealed_indexed;
+    segcore::SegmentGrowingPtr growing;
+
+    const segcore::SegmentInternalInterface*
+    Segment(SegmentKind kind) const {
+        switch (kind) {
+            case SegmentKind::kSealed:
+                return sealed.get();
+            case SegmentKind::kSealedIndexed:
+                return sealed_indexed.get();
+            case SegmentKind::kGrowing:
+                return growing.get();
+        }
+        return nullptr;
+    }
+
+    // q in [0, 1]
+    const GenericValue&
+    Quantile(DataType type, double q) const {
+        auto& sample = samples.at(type);
+        return sample[static_cast<size_t>(q * (sample.size() - 1))];
+    }
+
+    // `count` evenly spaced distinct values of the field.
+    std::vector<GenericValue>
+    InValues(DataType type, size_t count) const {
+        auto& sample = samples.at(type);
+        count = std::min(count, sample.size());
+        std::vector<GenericValue> values;
+        values.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            values.push_back(sample[i * sample.size() / count]);
+        }
+        return values;
+    }
+};
+
+template <typename T>
+std::vector<GenericValue>
+SampleColumn(const GeneratedData& data, FieldId field_id) {
+    auto col = data.get_col<T>(field_id);
+    std::vector<T> sample;
+    auto step = std::max<size_t>(1, col.size() / kSampleSize);
+    for (size_t i = 0; i < col.size(); i += step) {
+        sample.push_back(col[i]);
+    }
+    std::sort(sample.begin(), sample.end());
+    sample.erase(std::unique(sample.begin(), sample.end()), sample.end());
+
+    std::vector<GenericValue> values;
+    values.reserve(sample.size());
+    for (const auto& v : sample) {
+        values.push_back(ToGenericValue(v));
+    }
+    return values;
+}
+
+template <typename T>
+void
+LoadScalarIndex(segcore::SegmentSealed* segment,
+                const GeneratedData& data,
+                FieldId field_id,
+                DataType type) {
+    auto col = data.get_col<T>(field_id);
+    std::unique_ptr<index::IndexBase> scalar_index;
+    if constexpr (std::is_same_v<T, std::string>) {
+        auto string_index = index::CreateStringIndexMarisa();
+        string_index->Build(col.size(), col.data());
+        scalar_index = std::move(string_index);
+    } else {
+        auto sort_index = index::CreateScalarIndexSort<T>();
+        sort_index->Build(col.size(), col.data(), nullptr);
+        scalar_index = std::move(sort_index);
+    }
+    segcore::LoadIndexInfo load_index_info;
+    load_index_info.field_id = field_id.get();
+    load_index_info.field_type = type;
+    load_index_info.index_params = GenIndexParams(scalar_index.get());
+    load_index_info.cache_index =
+        CreateTestCacheIndex("expr_bench", std::move(scalar_index));
+    segment->LoadIndex(load_index_info);
+}
+
+const BenchData&
+Data() {
+    static const auto data = []() {
+        auto& config = Config();
+        auto result = std::make_unique<BenchData>();
+        result->schema = std::make_shared<Schema>();
+        auto pk_fid = result->schema->AddDebugField("pk", DataType::INT64);
+        result->schema->set_primary_field_id(pk_fid);
+        for (const auto& [name, type] : config.types) {
+            result->fields[type] =
+                result->schema->AddDebugField("f_" + name, type);
+        }
+
+        auto raw_data = DataGen(result->schema, config.rows);
+
+        result->sealed = segcore::CreateSealedSegment(result->schema);
+        LoadGeneratedDataIntoSegment(raw_data, result->sealed.get());
+
+        result->sealed_indexed = segcore::CreateSealedSegment(result->schema);
+        LoadGeneratedDataIntoSegment(raw_data, result->sealed_indexed.get());
+
+        result->growing =
+            segcore::CreateGrowingSegment(result->schema, empty_index_meta);
+        result->growing->PreInsert(config.rows);
+        result->growing->Insert(0,
+                                config.rows,
+                                raw_data.row_ids_.data(),
+                                raw_data.timestamps_.data(),
+                                raw_data.raw_);
+
+        for (const auto& [type, field_id] : result->fields) {
+            if (type == DataType::JSON) {
+                continue;
+            }
+            VisitScalarType(type, [&](auto tag) {
+                using T = decltype(tag);
+                result->samples[type] = SampleColumn<T>(raw_data, field_id);
+                LoadScalarIndex<T>(result->sealed_indexed.get(),
+                                   raw_data,
+                                   field_id,
+                                   type);
+            });
+        }
+        return result;
+    }();
+    return *data;
+}
+
+void
+RunFilter(benchmark::State& state,
+          SegmentKind kind,
+          const std::function<expr::TypedExprPtr(const BenchData&)>& build) {
+    auto& data = Data();
+    auto expr = build(data);
+    auto plannode =
+        std::make_shared<plan::FilterBitsNode>(DEFAULT_PLANNODE_ID, expr);
+    auto segment = data.Segment(kind);
+    auto rows = Config().rows;
+    int64_t hits = 0;
+    for (auto _ : state) {
+        auto bitset =
+            query::ExecuteQueryExpr(plannode, segment, rows, MAX_TIMESTAMP);
+        hits = bitset.count();
+        benchmark::DoNotOptimize(bitset.data());
+    }
+    state.SetItemsProcessed(state.iterations() * rows);
+    state.counters["selectivity"] =
+        static_cast<double>(hits) / static_cast<double>(rows);
+}
+
+using BenchFn = std::function<void(benchmark::State&)>;
+
+void
+Register(const std::string& name, BenchFn fn) {
+    benchmark::RegisterBenchmark(name.c_str(), std::move(fn))
+        ->Unit(benchmark::kMicrosecond);
+}
+
+// All scalar types and segment kinds for one expression family.
+void
+RegisterScalarFamily(
+    const std::string& family,
+    const std::function<expr::TypedExprPtr(
+        const BenchData&, FieldId, DataType)>& build,
+    bool numeric_only = false) {
+    for (const auto& [name, type] : Config().types) {
+        if (type == DataType::JSON ||
+            (numeric_only && type == DataType::VARCHAR)) {
+            continue;
+        }
+        for (auto kind : {SegmentKind::kSealed,
+                          SegmentKind::kSealedIndexed,
+                          SegmentKind::kGrowing}) {
+            auto type_copy = type;
+            Register(family + "/" + name + "/" + SegmentKindName(kind),
+                     [=](benchmark::State& state) {
+                         RunFilter(state, kind, [&](const BenchData& data) {
+                             return build(
+                                 data, data.fields.at(type_copy), type_copy);
+                         });
+                     });
+        }
+    }
+}
+
+bool
+HasType(DataType type) {
+    for (const auto& [name, t] : Config().types) {
+        if (t == type) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void
+RegisterUnaryRange() {
+    // ~50% selectivity
+    RegisterScalarFamily(
+        "UnaryRange", [](const BenchData& data, FieldId fid, DataType type) {
+            return std::make_shared<expr::UnaryRangeFilterExpr>(
+                expr::ColumnInfo(fid, type),
+                OpType::LessThan,
+                data.Quantile(type, 0.5));
+        });
+}
+
+void
+RegisterBinaryRange() {
+    // ~50% selectivity, centred
+    RegisterScalarFamily(
+        "BinaryRange", [](const BenchData& data, FieldId fid, DataType type) {
+            return std::make_shared<expr::BinaryRangeFilterExpr>(
+                expr::ColumnInfo(fid, type),
+                data.Quantile(type, 0.25),
+                data.Quantile(type, 0.75),
+                true,
+                false);
+        });
+}
+
+void
+RegisterTerm() {
+    // Sizes around the SIMD / hash crossovers of TermExpr.
+    for (size_t in_size : {4, 16, 64, 256, 1024}) {
+        RegisterScalarFamily(
+            "Term/in" + std::to_string(in_size),
+            [in_size](const BenchData& data, FieldId fid, DataType type) {
+                return std::make_shared<expr::TermFilterExpr>(
+                    expr::ColumnInfo(fid, type),
+                    data.InValues(type, in_size));
+            });
+    }
+}
+
+void
+RegisterJsonContains() {
+    if (!HasType(DataType::JSON)) {
+        return;
+    }
+    // DataGen writes "array": [1,2,3] into every row, so 2 matches all rows
+    // and 7 none; both sides of the short-circuit are measured.
+    for (int64_t value : {2, 7}) {
+        for (auto kind : {SegmentKind::kSealed, SegmentKind::kGrowing}) {
+            Register("JsonContains/value" + std::to_string(value) + "/" +
+                         SegmentKindName(kind),
+                     [=](benchmark::State& state) {
+                         RunFilter(state, kind, [&](const BenchData& data) {
+                             return std::make_shared<expr::JsonContainsExpr>(
+                                 expr::ColumnInfo(
+                                     data.fields.at(DataType::JSON),
+                                     DataType::JSON,
+                                     std::vector<std::string>{"array"}),
+                                 proto::plan::JSONContainsExpr_JSONOp_Contains,
+                                 true,
+                                 std::vector<GenericValue>{
+                                     ToGenericValue(value)});
+                         });
+                     });
+        }
+    }
+}
+
+void
+RegisterLikeConjunct() {
+    if (!HasType(DataType::VARCHAR)) {
+        return;
+    }
+    // Two LIKE predicates on the same field under AND, the shape that
+    // ConjunctExpr batches into a LikeConjunctExpr.
+    for (auto kind : {SegmentKind::kSealed,
+                      SegmentKind::kSealedIndexed,
+                      SegmentKind::kGrowing}) {
+        Register(std::string("LikeConjunct/varchar/") + SegmentKindName(kind),
+                 [=](benchmark::State& state) {
+                     RunFilter(state, kind, [&](const BenchData& data) {
+                         auto fid = data.fields.at(DataType::VARCHAR);
+                         auto like = [fid](const std::string& pattern) {
+                             return std::make_shared<
+                                 expr::UnaryRangeFilterExpr>(
+                                 expr::ColumnInfo(fid, DataType::VARCHAR),
+                                 OpType::Match,
+                                 ToGenericValue(pattern));
+                         };
+                         return std::make_shared<expr::LogicalBinaryExpr>(
+                             expr::LogicalBinaryExpr::OpType::And,
+                             like("%12%"),
+                             like("%3%"));
+                     });
+                 });
+    }
+}
+
+template <typename T>
+void
+SimdFilterChunkBenchmark(benchmark::State& state) {
+    constexpr int kChunkRows = 8192;
+    auto num_vals = static_cast<int>(state.range(0));
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> dist(0, 127);
+    std::vector<T> data(kChunkRows);
+    for (auto& v : data) {
+        v = static_cast<T>(dist(rng));
+    }
+    std::vector<T> vals;
+    for (int i = 0; i < num_vals; ++i) {
+        vals.push_back(static_cast<T>(i * 128 / num_vals));
+    }
+    std::sort(vals.begin(), vals.end());
+    vals.erase(std::unique(vals.begin(), vals.end()), vals.end());
+    std::vector<uint8_t> bitmap(kChunkRows / 8);
+    for (auto _ : state) {
+        std::fill(bitmap.begin(), bitmap.end(), 0);
+        simdFilterChunk<T>(data.data(),
+                           kChunkRows,
+                           bitmap.data(),
+                           vals.data(),
+                           static_cast<int>(vals.size()));
+        benchmark::DoNotOptimize(bitmap.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * kChunkRows);
+}
+
+void
+RegisterSimdFilterChunk() {
+    auto add = [](const std::string& name, void (*fn)(benchmark::State&)) {
+        auto bench = benchmark::RegisterBenchmark(
+            ("SimdFilterChunk/" + name).c_str(), fn);
+        for (int64_t num_vals : {1, 4, 16, 64}) {
+            bench->Arg(num_vals);
+        }
+    };
+    add("int8", SimdFilterChunkBenchmark<int8_t>);
+    add("int16", SimdFilterChunkBenchmark<int16_t>);
+    add("int32", SimdFilterChunkBenchmark<int32_t>);
+    add("int64", SimdFilterChunkBenchmark<int64_t>);
+    add("float", SimdFilterChunkBenchmark<float>);
+    add("double", SimdFilterChunkBenchmark<double>);
+}
+
+// Consumes the --expr_bench_* flags, leaves everything else in argv.
+void
+ParseFlags(int* argc, char** argv) {
+    auto& config = Config();
+    int out = 1;
+    for (int i = 1; i < *argc; ++i) {
+        std::string arg = argv[i];
+        auto value_of = [&arg](const std::string& flag) -> const char* {
+            auto prefix = "--" + flag + "=";
+            return arg.rfind(prefix, 0) == 0 ? arg.c_str() + prefix.size()
+                                             : nullptr;
+        };
+        if (auto v = value_of("expr_bench_rows")) {
+            config.rows = std::max<int64_t>(1, std::atoll(v));
+        } else if (auto v = value_of("expr_bench_types")) {
+            BenchConfig defaults;
+            std::string list = v;
+            config.types.clear();
+            for (const auto& [name, type] : defaults.types) {
+                if (("," + list + ",").find("," + name + ",") !=
+                    std::string::npos) {
+                    config.types.emplace_back(name, type);
+                }
+            }
+        } else if (auto v = value_of("expr_bench_simd")) {
+            std::string level = v;
+            if (level == "baseline") {
+                config.simd_level = SimdFilterLevel::kBaseline;
+            } else if (level == "avx2") {
+                config.simd_level = SimdFilterLevel::kAvx2;
+            } else if (level == "avx512") {
+                config.simd_level = SimdFilterLevel::kAvx512;
+            } else {
+                ThrowInfo(InvalidParameter, "unknown simd level {}", level);
+            }
+        } else {
+            argv[out++] = argv[i];
+        }
+    }
+    *argc = out;
+}
+
+}  // namespace
+}  // namespace milvus::exec::bench
+
+int
+main(int argc, char** argv) {
+    using namespace milvus::exec::bench;
+    ParseFlags(&argc, argv);
+    benchmark::Initialize(&argc, argv);
+    milvus::bench::InitBenchmarkEnvironment(&argc, &argv, "expr_benchmark");
+
+    milvus::exec::setSimdFilterLevel(Config().simd_level);
+    benchmark::AddCustomContext("rows", std::to_string(Config().rows));
+    benchmark::AddCustomContext(
+        "simd_level", SimdLevelName(milvus::exec::simdFilterLevel()));
+
+    RegisterUnaryRange();
+    RegisterBinaryRange();
+    RegisterTerm();
+    RegisterJsonContains();
+    RegisterLikeConjunct();
+    RegisterSimdFilterChunk();
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
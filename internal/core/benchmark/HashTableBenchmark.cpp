@@ -0,0 +1,175 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Benchmark of the GROUP BY hash table probe, exec::HashTable::groupProbe.
+//
+// Every iteration aggregates the same int64 key stream into a fresh table, in
+// input vectors of the size the operator pipeline uses, once with the
+// lookahead probe (prefetching buckets and candidate groups several rows
+// ahead) and once probing one row at a time. The sweep covers the number of
+// distinct keys: small tables stay in cache, large ones make every probe a
+// cache miss, which is where the lookahead pays off.
+//
+// Extra flags (parsed before the google benchmark flags are handed over):
+//   --hash_bench_rows=N         keys aggregated per iteration (default 8M)
+//   --hash_bench_batch_rows=N   rows per input vector (default 8192)
+//
+// Example:
+//   hashtable_benchmark --benchmark_filter='GroupProbe/.*/4194304/.*'
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "BenchmarkEnv.h"
+#include "common/Types.h"
+#include "common/Vector.h"
+#include "exec/HashTable.h"
+#include "exec/VectorHasher.h"
+
+namespace milvus::exec::bench {
+namespace {
+
+struct BenchConfig {
+    int64_t rows{8 << 20};
+    int64_t batch_rows{8192};
+};
+
+BenchConfig&
+Config() {
+    static BenchConfig config;
+    return config;
+}
+
+// Uniform keys over `num_groups` distinct values, cut into input vectors.
+const std::vector<RowVectorPtr>&
+Inputs(int64_t num_groups) {
+    static int64_t cached_groups = -1;
+    static std::vector<RowVectorPtr> inputs;
+    if (cached_groups == num_groups) {
+        return inputs;
+    }
+    inputs.clear();
+    std::default_random_engine er(42);
+    std::uniform_int_distribution<int64_t> dist(0, num_groups - 1);
+    auto& config = Config();
+    for (int64_t begin = 0; begin < config.rows; begin += config.batch_rows) {
+        auto rows = std::min(config.batch_rows, config.rows - begin);
+        auto column = std::make_shared<ColumnVector>(DataType::INT64, rows);
+        for (int64_t i = 0; i < rows; ++i) {
+            column->SetValueAt<int64_t>(i, dist(er));
+        }
+        inputs.push_back(
+            std::make_shared<RowVector>(std::vector<VectorPtr>{column}));
+    }
+    cached_groups = num_groups;
+    return inputs;
+}
+
+void
+BM_GroupProbe(benchmark::State& state) {
+    auto num_groups = state.range(0);
+    bool batch_probe = state.range(1) != 0;
+    const auto& inputs = Inputs(num_groups);
+
+    int64_t groups = 0;
+    for (auto _ : state) {
+        std::vector<std::unique_ptr<VectorHasher>> hashers;
+        hashers.push_back(VectorHasher::create(DataType::INT64, 0));
+        HashTable table(
+            std::move(hashers), std::vector<Accumulator>{}, num_groups + 1);
+        table.setBatchProbe(batch_probe);
+        HashLookup lookup(table.hashers());
+        for (const auto& input : inputs) {
+            table.prepareForGroupProbe(lookup, input);
+            table.groupProbe(lookup);
+        }
+        groups = table.rows()->allRows().size();
+        benchmark::DoNotOptimize(lookup.hits_.data());
+    }
+    state.SetItemsProcessed(state.iterations() * Config().rows);
+    state.counters["groups"] = static_cast<double>(groups);
+}
+
+void
+RegisterGroupProbe() {
+    for (int64_t groups : {int64_t(1) << 10,
+                           int64_t(1) << 16,
+                           int64_t(1) << 20,
+                           int64_t(1) << 22,
+                           int64_t(1) << 23}) {
+        for (int64_t batch_probe : {0, 1}) {
+            benchmark::RegisterBenchmark(
+                (std::string("GroupProbe/") +
+                 (batch_probe ? "lookahead" : "row_by_row"))
+                    .c_str(),
+                BM_GroupProbe)
+                ->Args({groups, batch_probe})
+                ->Unit(benchmark::kMillisecond);
+        }
+    }
+}
+
+// Consumes the --hash_bench_* flags, leaves everything else in argv.
+void
+ParseFlags(int* argc, char** argv) {
+    auto& config = Config();
+    int out = 1;
+    for (int i = 1; i < *argc; ++i) {
+        std::string arg = argv[i];
+        auto value_of = [&arg](const std::string& flag) -> const char* {
+            auto prefix = "--" + flag + "=";
+            return arg.rfind(prefix, 0) == 0 ? arg.c_str() + prefix.size()
+                                             : nullptr;
+        };
+        if (auto v = value_of("hash_bench_rows")) {
+            config.rows = std::max<int64_t>(1, std::atoll(v));
+        } else if (auto v = value_of("hash_bench_batch_rows")) {
+            config.batch_rows = std::max<int64_t>(1, std::atoll(v));
+        } else {
+            argv[out++] = argv[i];
+        }
+    }
+    *argc = out;
+}
+
+}  // namespace
+}  // namespace milvus::exec::bench
+
+int
+main(int argc, char** argv) {
+    using namespace milvus::exec::bench;
+    ParseFlags(&argc, argv);
+    benchmark::Initialize(&argc, argv);
+    milvus::bench::InitBenchmarkEnvironment(
+        &argc, &argv, "hashtable_benchmark");
+
+    benchmark::AddCustomContext("rows", std::to_string(Config().rows));
+    benchmark::AddCustomContext("batch_rows",
+                                std::to_string(Config().batch_rows));
+
+    RegisterGroupProbe();
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
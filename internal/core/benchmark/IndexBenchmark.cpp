@@ -0,0 +1,624 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Benchmark of scalar index queries, to tune the index selection of HYBRID
+// (bitmap_cardinality_limit) and of the autoindex from data.
+//
+// One column of rows over a value domain of configurable cardinality is
+// uploaded as a binlog, every index type is built from it once and loaded
+// with mmap off and on:
+//   Bitmap, Sort (ScalarIndexSort / StringIndexSort), Marisa, Inverted,
+//   Hybrid, Ngram and JsonFlat (the values under the "k" key of a JSON)
+// over INT64 and VARCHAR values, the VARCHAR value of id i is "key_<i>"
+// zero padded to 8 digits. The workloads per index are
+//   In / NotIn     `values` distinct values spread over the domain
+//   Range          a range covering `percent` of the domain
+//   PrefixMatch    a prefix leaving the last `free_digits` digits open
+//   PatternMatch   LIKE "%<3 digits>", a postfix match
+// an index without the op is skipped. Ngram only answers pattern ops and
+// is measured by its index phase, the candidates before the post filter
+// over the raw data, which expr_benchmark covers.
+//
+// Reported next to the latency: rows/s (items), qps, the rows matched
+// (hits), the footprint the index accounts for (index_MB), its serialized
+// size and the RSS the load added (load_rss_MB).
+//
+// Extra flags (parsed before the google benchmark flags are handed over):
+//   --index_bench_rows=N          rows of the column (default 1M)
+//   --index_bench_cardinality=N   distinct values (default 1000)
+//   --index_bench_distribution=D  uniform or zipf (default uniform)
+//   --index_bench_bitmap_cardinality_limit=N
+//                                 HYBRID bitmap threshold (default 100)
+//
+// Example:
+//   index_benchmark --index_bench_cardinality=100000 \
+//       --benchmark_filter='Range/(Bitmap|Hybrid|Sort)/int64.*'
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <fmt/core.h>
+
+#include "BenchmarkEnv.h"
+#include "common/Consts.h"
+#include "common/Json.h"
+#include "common/Types.h"
+#include "common/init_c.h"
+#include "index/IndexFactory.h"
+#include "index/JsonFlatIndex.h"
+#include "index/Meta.h"
+#include "index/NgramInvertedIndex.h"
+#include "index/ScalarIndex.h"
+#include "indexbuilder/IndexFactory.h"
+#include "pb/common.pb.h"
+#include "simdjson/padded_string.h"
+#include "storage/InsertData.h"
+#include "storage/PayloadReader.h"
+#include "storage/RemoteChunkManagerSingleton.h"
+#include "storage/Util.h"
+#include "test_utils/DataGen.h"
+#include "test_utils/storage_test_utils.h"
+
+namespace milvus::index::bench {
+namespace {
+
+constexpr double kMB = 1024.0 * 1024.0;
+constexpr uintptr_t kMinGram = 2;
+constexpr uintptr_t kMaxGram = 4;
+
+struct BenchConfig {
+    int64_t rows{1 << 20};
+    int64_t cardinality{1000};
+    bool zipf{false};
+    int64_t bitmap_cardinality_limit{100};
+};
+
+BenchConfig&
+Config() {
+    static BenchConfig config;
+    return config;
+}
+
+enum class ValueType { kInt64, kVarChar };
+
+struct IndexSpec {
+    std::string name;
+    std::string index_type;
+    DataType field_type;
+    ValueType value_type;
+};
+
+const std::vector<IndexSpec>&
+Specs() {
+    static const std::vector<IndexSpec> specs = {
+        {"Bitmap/int64", BITMAP_INDEX_TYPE, DataType::INT64, ValueType::kInt64},
+        {"Bitmap/varchar",
+         BITMAP_INDEX_TYPE,
+         DataType::VARCHAR,
+         ValueType::kVarChar},
+        {"Sort/int64", ASCENDING_SORT, DataType::INT64, ValueType::kInt64},
+        {"Sort/varchar",
+         ASCENDING_SORT,
+         DataType::VARCHAR,
+         ValueType::kVarChar},
+        {"Marisa/varchar", MARISA_TRIE, DataType::VARCHAR, ValueType::kVarChar},
+        {"Inverted/int64",
+         INVERTED_INDEX_TYPE,
+         DataType::INT64,
+         ValueType::kInt64},
+        {"Inverted/varchar",
+         INVERTED_INDEX_TYPE,
+         DataType::VARCHAR,
+         ValueType::kVarChar},
+        {"Hybrid/int64", HYBRID_INDEX_TYPE, DataType::INT64, ValueType::kInt64},
+        {"Hybrid/varchar",
+         HYBRID_INDEX_TYPE,
+         DataType::VARCHAR,
+         ValueType::kVarChar},
+        {"Ngram/varchar",
+         NGRAM_INDEX_TYPE,
+         DataType::VARCHAR,
+         ValueType::kVarChar},
+        {"JsonFlat/int64",
+         INVERTED_INDEX_TYPE,
+         DataType::JSON,
+         ValueType::kInt64},
+        {"JsonFlat/varchar",
+         INVERTED_INDEX_TYPE,
+         DataType::JSON,
+         ValueType::kVarChar},
+    };
+    return specs;
+}
+
+std::string
+Key(int64_t id) {
+    return fmt::format("key_{:08}", id);
+}
+
+// The value id of every row. Zipf ranks are mapped to ids through a fixed
+// permutation, so the hot values are not all at the low end of a range.
+const std::vector<int64_t>&
+RowIds() {
+    static const auto ids = []() {
+        auto& config = Config();
+        std::default_random_engine er(42);
+        std::vector<int64_t> result(config.rows);
+        if (!config.zipf) {
+            std::uniform_int_distribution<int64_t> dist(
+                0, config.cardinality - 1);
+            for (auto& id : result) {
+                id = dist(er);
+            }
+            return result;
+        }
+        std::vector<double> weights(config.cardinality);
+        for (int64_t rank = 0; rank < config.cardinality; ++rank) {
+            weights[rank] = 1.0 / (rank + 1);
+        }
+        std::vector<int64_t> id_of_rank(config.cardinality);
+        std::iota(id_of_rank.begin(), id_of_rank.end(), 0);
+        std::shuffle(id_of_rank.begin(), id_of_rank.end(), er);
+        std::discrete_distribution<int64_t> dist(weights.begin(),
+                                                 weights.end());
+        for (auto& id : result) {
+            id = id_of_rank[dist(er)];
+        }
+        return result;
+    }();
+    return ids;
+}
+
+FieldDataPtr
+ColumnData(const IndexSpec& spec) {
+    const auto& ids = RowIds();
+    auto field_data =
+        storage::CreateFieldData(spec.field_type, DataType::NONE);
+    if (spec.field_type == DataType::INT64) {
+        field_data->FillFieldData(ids.data(), ids.size());
+    } else if (spec.field_type == DataType::VARCHAR) {
+        std::vector<std::string> keys;
+        keys.reserve(ids.size());
+        for (auto id : ids) {
+            keys.push_back(Key(id));
+        }
+        field_data->FillFieldData(keys.data(), keys.size());
+    } else {
+        std::vector<Json> docs;
+        docs.reserve(ids.size());
+        for (auto id : ids) {
+            auto doc = spec.value_type == ValueType::kInt64
+                           ? fmt::format(R"({{"k": {}}})", id)
+                           : fmt::format(R"({{"k": "{}"}})", Key(id));
+            docs.emplace_back(simdjson::padded_string(doc));
+        }
+        field_data->FillFieldData(docs.data(), docs.size());
+    }
+    return field_data;
+}
+
+int64_t
+FieldIdOf(const IndexSpec& spec) {
+    const auto& specs = Specs();
+    return 100 + std::distance(specs.data(), &spec);
+}
+
+storage::FileManagerContext
+IndexContext(const IndexSpec& spec) {
+    auto field_id = FieldIdOf(spec);
+    auto field_meta = segcore::gen_field_meta(segcore::kCollectionID,
+                                              segcore::kPartitionID,
+                                              segcore::kSegmentID,
+                                              field_id,
+                                              spec.field_type,
+                                              DataType::NONE,
+                                              false,
+                                              65535);
+    auto index_meta = gen_index_meta(segcore::kSegmentID, field_id, field_id);
+    auto cm = storage::RemoteChunkManagerSingleton::GetInstance()
+                  .GetRemoteChunkManager();
+    auto fs = storage::InitArrowFileSystem(get_default_local_storage_config());
+    return storage::FileManagerContext(field_meta, index_meta, cm, fs);
+}
+
+milvus::Config
+BuildConfig(const IndexSpec& spec, const std::string& insert_file) {
+    milvus::Config config;
+    config[INDEX_TYPE] = spec.index_type;
+    config[INSERT_FILES_KEY] = std::vector<std::string>{insert_file};
+    config[INDEX_NUM_ROWS_KEY] = Config().rows;
+    config[SCALAR_INDEX_ENGINE_VERSION] = 3;
+    if (spec.index_type == HYBRID_INDEX_TYPE) {
+        config[BITMAP_INDEX_CARDINALITY_LIMIT] =
+            std::to_string(Config().bitmap_cardinality_limit);
+    } else if (spec.index_type == NGRAM_INDEX_TYPE) {
+        config[MIN_GRAM] = std::to_string(kMinGram);
+        config[MAX_GRAM] = std::to_string(kMaxGram);
+    }
+    if (spec.field_type == DataType::JSON) {
+        config[JSON_CAST_TYPE] = "JSON";
+        config[JSON_PATH] = "";
+    }
+    return config;
+}
+
+struct BuiltIndex {
+    std::vector<std::string> files;
+    int64_t serialized_bytes{0};
+};
+
+// Uploads the column of `spec` and builds its index, once per spec.
+const BuiltIndex&
+Build(const IndexSpec& spec) {
+    static std::map<const IndexSpec*, BuiltIndex> built;
+    auto it = built.find(&spec);
+    if (it != built.end()) {
+        return it->second;
+    }
+    auto ctx = IndexContext(spec);
+    auto field_data = ColumnData(spec);
+    auto payload_reader = std::make_shared<storage::PayloadReader>(field_data);
+    storage::InsertData insert_data(payload_reader);
+    insert_data.SetFieldDataMeta(ctx.fieldDataMeta);
+    insert_data.SetTimestamps(0, 100);
+    auto serialized = insert_data.Serialize(storage::Remote);
+    auto insert_file = fmt::format("{}/index_bench/{}/0",
+                                   ctx.chunkManagerPtr->GetRootPath(),
+                                   FieldIdOf(spec));
+    ctx.chunkManagerPtr->Write(
+        insert_file, serialized.data(), serialized.size());
+
+    auto config = BuildConfig(spec, insert_file);
+    auto creator = indexbuilder::IndexFactory::GetInstance().CreateIndex(
+        spec.field_type, config, ctx);
+    creator->Build();
+    auto stats = creator->Upload();
+    auto& result = built[&spec];
+    result.files = stats->GetIndexFiles();
+    result.serialized_bytes = stats->GetSerializedSize();
+    return result;
+}
+
+double
+RssMB() {
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.rfind("VmRSS:", 0) == 0) {
+            return std::atof(line.c_str() + 6) / 1024.0;
+        }
+    }
+    return 0;
+}
+
+struct LoadedIndex {
+    const IndexSpec* spec{nullptr};
+    bool mmap{false};
+    IndexBasePtr index;
+    // what the workloads query: the index, or the executor of the "k" key
+    // for a JSON flat index
+    std::shared_ptr<IndexBase> executor;
+    IndexBase* target{nullptr};
+    double load_rss_mb{0};
+};
+
+// Loads the index of `spec`. Only the last loaded index is kept, the
+// benchmarks of one spec and mmap mode are registered next to each other.
+const LoadedIndex&
+Load(const IndexSpec& spec, bool mmap) {
+    static LoadedIndex loaded;
+    if (loaded.spec == &spec && loaded.mmap == mmap) {
+        return loaded;
+    }
+    loaded = LoadedIndex{};
+    const auto& built = Build(spec);
+
+    CreateIndexInfo index_info{};
+    index_info.index_type = spec.index_type;
+    index_info.field_type = spec.field_type;
+    if (spec.index_type == NGRAM_INDEX_TYPE) {
+        index_info.ngram_params = NgramParams{true, kMinGram, kMaxGram};
+    }
+    if (spec.field_type == DataType::JSON) {
+        index_info.json_cast_type = JsonCastType::FromString("JSON");
+        index_info.json_path = "";
+    }
+    milvus::Config load_config;
+    load_config[INDEX_FILES] = built.files;
+    load_config[ENABLE_MMAP] = mmap;
+    load_config[LOAD_PRIORITY] = proto::common::LoadPriority::HIGH;
+
+    auto ctx = IndexContext(spec);
+    ctx.set_for_loading_index(true);
+    auto rss_before = RssMB();
+    loaded.index = IndexFactory::GetInstance().CreateIndex(index_info, ctx);
+    loaded.index->LoadUnified(load_config);
+    loaded.load_rss_mb = RssMB() - rss_before;
+
+    loaded.target = loaded.index.get();
+    if (spec.field_type == DataType::JSON) {
+        auto* flat = dynamic_cast<JsonFlatIndex*>(loaded.index.get());
+        AssertInfo(flat != nullptr, "json index is not a flat index");
+        if (spec.value_type == ValueType::kInt64) {
+            loaded.executor = flat->create_executor<int64_t>("/k");
+        } else {
+            loaded.executor = flat->create_executor<std::string>("/k");
+        }
+        loaded.target = loaded.executor.get();
+    }
+    loaded.spec = &spec;
+    loaded.mmap = mmap;
+    return loaded;
+}
+
+template <typename T>
+T
+ValueOf(int64_t id) {
+    if constexpr (std::is_same_v<T, std::string>) {
+        return Key(id);
+    } else {
+        return id;
+    }
+}
+
+void
+Report(benchmark::State& state,
+       const IndexSpec& spec,
+       const LoadedIndex& loaded,
+       int64_t hits) {
+    state.SetItemsProcessed(state.iterations() * Config().rows);
+    state.counters["qps"] = benchmark::Counter(
+        1, benchmark::Counter::kIsIterationInvariantRate);
+    state.counters["hits"] = hits;
+    state.counters["index_MB"] = loaded.index->ByteSize() / kMB;
+    state.counters["serialized_MB"] = Build(spec).serialized_bytes / kMB;
+    state.counters["load_rss_MB"] = loaded.load_rss_mb;
+}
+
+// Runs `query(index)` on the loaded index of `spec`, state.range(0) is the
+// mmap mode.
+template <typename T, typename Query>
+void
+Run(benchmark::State& state, const IndexSpec& spec, Query query) {
+    const auto& loaded = Load(spec, state.range(0) != 0);
+    auto* index = dynamic_cast<ScalarIndex<T>*>(loaded.target);
+    if (index == nullptr) {
+        state.SkipWithError("not a scalar index of the value type");
+        return;
+    }
+    int64_t hits = 0;
+    for (auto _ : state) {
+        auto result = query(index);
+        hits = result.count();
+        benchmark::DoNotOptimize(result);
+    }
+    Report(state, spec, loaded, hits);
+}
+
+template <typename T>
+std::vector<T>
+SpreadValues(int64_t n) {
+    auto cardinality = Config().cardinality;
+    n = std::min(n, cardinality);
+    std::vector<T> values;
+    values.reserve(n);
+    for (int64_t i = 0; i < n; ++i) {
+        values.push_back(ValueOf<T>(i * cardinality / n));
+    }
+    return values;
+}
+
+template <typename T>
+void
+InBenchmark(benchmark::State& state, const IndexSpec& spec) {
+    auto values = SpreadValues<T>(state.range(1));
+    Run<T>(state, spec, [&](ScalarIndex<T>* index) {
+        return index->In(values.size(), values.data());
+    });
+}
+
+template <typename T>
+void
+NotInBenchmark(benchmark::State& state, const IndexSpec& spec) {
+    auto values = SpreadValues<T>(state.range(1));
+    Run<T>(state, spec, [&](ScalarIndex<T>* index) {
+        return index->NotIn(values.size(), values.data());
+    });
+}
+
+template <typename T>
+void
+RangeBenchmark(benchmark::State& state, const IndexSpec& spec) {
+    auto cardinality = Config().cardinality;
+    auto lower = cardinality / 4;
+    auto width = std::max<int64_t>(1, cardinality * state.range(1) / 100);
+    auto upper = lower + width;
+    auto lower_value = ValueOf<T>(lower);
+    auto upper_value = ValueOf<T>(upper);
+    Run<T>(state, spec, [&](ScalarIndex<T>* index) {
+        return index->Range(lower_value, true, upper_value, false);
+    });
+}
+
+// Ngram is measured by ExecutePhase1, the other indexes by PatternMatch.
+void
+PatternBenchmark(benchmark::State& state,
+                 const IndexSpec& spec,
+                 const std::string& pattern,
+                 proto::plan::OpType op) {
+    const auto& loaded = Load(spec, state.range(0) != 0);
+    if (spec.index_type != NGRAM_INDEX_TYPE) {
+        auto* scalar = dynamic_cast<ScalarIndex<std::string>*>(loaded.target);
+        if (scalar == nullptr || !scalar->SupportPatternMatch()) {
+            state.SkipWithError("pattern match is not supported");
+            return;
+        }
+        Run<std::string>(state, spec, [&](ScalarIndex<std::string>* index) {
+            return index->PatternMatch(pattern, op);
+        });
+        return;
+    }
+    auto* ngram = dynamic_cast<NgramInvertedIndex*>(loaded.index.get());
+    if (ngram == nullptr || !ngram->CanHandleLiteral(pattern, op)) {
+        state.SkipWithError("literal is shorter than min_gram");
+        return;
+    }
+    auto rows = static_cast<size_t>(ngram->Count());
+    int64_t hits = 0;
+    for (auto _ : state) {
+        TargetBitmap candidates(rows, true);
+        ngram->ExecutePhase1(pattern, op, candidates);
+        hits = candidates.count();
+        benchmark::DoNotOptimize(candidates);
+    }
+    Report(state, spec, loaded, hits);
+}
+
+void
+PrefixMatchBenchmark(benchmark::State& state, const IndexSpec& spec) {
+    auto prefix = Key(Config().cardinality / 3);
+    prefix.resize(prefix.size() - state.range(1));
+    PatternBenchmark(state, spec, prefix, proto::plan::OpType::PrefixMatch);
+}
+
+void
+PatternMatchBenchmark(benchmark::State& state, const IndexSpec& spec) {
+    auto pattern = fmt::format("%{:03}", Config().cardinality / 7 % 1000);
+    PatternBenchmark(state, spec, pattern, proto::plan::OpType::Match);
+}
+
+template <typename T>
+void
+RegisterValueBenchmarks(const IndexSpec& spec) {
+    auto name = [&spec](const char* workload) {
+        return fmt::format("{}/{}", workload, spec.name);
+    };
+    benchmark::RegisterBenchmark(
+        name("In"),
+        [&spec](benchmark::State& state) { InBenchmark<T>(state, spec); })
+        ->ArgNames({"mmap", "values"})
+        ->ArgsProduct({{0, 1}, {1, 16, 256}});
+    benchmark::RegisterBenchmark(
+        name("NotIn"),
+        [&spec](benchmark::State& state) { NotInBenchmark<T>(state, spec); })
+        ->ArgNames({"mmap", "values"})
+        ->ArgsProduct({{0, 1}, {16}});
+    benchmark::RegisterBenchmark(
+        name("Range"),
+        [&spec](benchmark::State& state) { RangeBenchmark<T>(state, spec); })
+        ->ArgNames({"mmap", "percent"})
+        ->ArgsProduct({{0, 1}, {1, 10, 50}});
+}
+
+void
+RegisterBenchmarks() {
+    for (const auto& spec : Specs()) {
+        if (spec.index_type != NGRAM_INDEX_TYPE) {
+            if (spec.value_type == ValueType::kInt64) {
+                RegisterValueBenchmarks<int64_t>(spec);
+            } else {
+                RegisterValueBenchmarks<std::string>(spec);
+            }
+        }
+        if (spec.value_type != ValueType::kVarChar) {
+            continue;
+        }
+        benchmark::RegisterBenchmark(
+            fmt::format("PrefixMatch/{}", spec.name),
+            [&spec](benchmark::State& state) {
+                PrefixMatchBenchmark(state, spec);
+            })
+            ->ArgNames({"mmap", "free_digits"})
+            ->ArgsProduct({{0, 1}, {1, 2, 3}});
+        benchmark::RegisterBenchmark(
+            fmt::format("PatternMatch/{}", spec.name),
+            [&spec](benchmark::State& state) {
+                PatternMatchBenchmark(state, spec);
+            })
+            ->ArgNames({"mmap"})
+            ->Args({0})
+            ->Args({1});
+    }
+}
+
+// Consumes the --index_bench_* flags, leaves everything else in argv.
+void
+ParseFlags(int* argc, char** argv) {
+    auto& config = Config();
+    int out = 1;
+    for (int i = 1; i < *argc; ++i) {
+        std::string arg = argv[i];
+        auto value_of = [&arg](const std::string& flag) -> const char* {
+            auto prefix = "--" + flag + "=";
+            return arg.rfind(prefix, 0) == 0 ? arg.c_str() + prefix.size()
+                                             : nullptr;
+        };
+        if (auto v = value_of("index_bench_rows")) {
+            config.rows = std::max<int64_t>(1, std::atoll(v));
+        } else if (auto v = value_of("index_bench_cardinality")) {
+            config.cardinality =
+                std::clamp<int64_t>(std::atoll(v), 1, 100000000);
+        } else if (auto v = value_of("index_bench_distribution")) {
+            config.zipf = std::string(v) == "zipf";
+        } else if (auto v = value_of("index_bench_bitmap_cardinality_limit")) {
+            config.bitmap_cardinality_limit =
+                std::max<int64_t>(1, std::atoll(v));
+        } else {
+            argv[out++] = argv[i];
+        }
+    }
+    *argc = out;
+}
+
+}  // namespace
+}  // namespace milvus::index::bench
+
+int
+main(int argc, char** argv) {
+    using namespace milvus::index::bench;
+    ParseFlags(&argc, argv);
+    benchmark::Initialize(&argc, argv);
+    milvus::bench::InitBenchmarkEnvironment(&argc, &argv, "index_benchmark");
+    auto cpu_num = std::max<int64_t>(1, std::thread::hardware_concurrency());
+    InitCpuNum(static_cast<int>(cpu_num));
+
+    auto& config = Config();
+    benchmark::AddCustomContext("rows", std::to_string(config.rows));
+    benchmark::AddCustomContext("cardinality",
+                                std::to_string(config.cardinality));
+    benchmark::AddCustomContext("distribution",
+                                config.zipf ? "zipf" : "uniform");
+    benchmark::AddCustomContext(
+        "bitmap_cardinality_limit",
+        std::to_string(config.bitmap_cardinality_limit));
+
+    RegisterBenchmarks();
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
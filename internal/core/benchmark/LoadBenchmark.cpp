@@ -0,0 +1,389 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Benchmark of sealed segment loading from locally generated binlogs and
+// index files, to tune the load thread pools and budgets from data.
+//
+// The data is generated and uploaded to the local remote chunk manager
+// once, every iteration then loads it into a fresh segment or index:
+//   FieldData      SegmentSealed::LoadFieldData of all fields, sweeping
+//                  mmap on/off, warmup disable/sync and the HIGH pool size
+//   DeletedRecord  SegmentSealed::LoadDeletedRecord of unsorted deletes
+//   InvertedIndex  LoadUnified of a VARCHAR inverted (tantivy) index,
+//                  mmap on/off
+// and reports the load throughput in MB/s of serialized input and the peak
+// RSS of the run, reset before every benchmark on Linux.
+//
+// Extra flags (parsed before the google benchmark flags are handed over):
+//   --load_bench_rows=N      rows of the segment (default 100000)
+//   --load_bench_dim=N       vector dimension (default 128)
+
+#include <sys/resource.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "BenchmarkEnv.h"
+#include "common/Consts.h"
+#include "common/Schema.h"
+#include "common/Types.h"
+#include "common/init_c.h"
+#include "index/IndexFactory.h"
+#include "index/Meta.h"
+#include "indexbuilder/IndexFactory.h"
+#include "knowhere/comp/index_param.h"
+#include "pb/common.pb.h"
+#include "segcore/ChunkedSegmentSealedImpl.h"
+#include "storage/RemoteChunkManagerSingleton.h"
+#include "storage/ThreadPools.h"
+#include "storage/Util.h"
+#include "test_utils/DataGen.h"
+#include "test_utils/storage_test_utils.h"
+
+namespace milvus::segcore::bench {
+namespace {
+
+constexpr double kMB = 1024.0 * 1024.0;
+
+struct BenchConfig {
+    int64_t rows{100000};
+    int64_t dim{128};
+};
+
+BenchConfig&
+Config() {
+    static BenchConfig config;
+    return config;
+}
+
+struct BenchData {
+    SchemaPtr schema;
+    FieldId pk_fid;
+    FieldId str_fid;
+    GeneratedData dataset;
+    LoadFieldDataInfo load_info;
+    int64_t load_bytes{0};
+    std::vector<std::string> index_files;
+    int64_t index_bytes{0};
+};
+
+int64_t
+SerializedBytes(const LoadFieldDataInfo& info) {
+    int64_t bytes = 0;
+    for (const auto& [_, field] : info.field_infos) {
+        bytes += std::accumulate(
+            field.memory_sizes.begin(), field.memory_sizes.end(), int64_t(0));
+    }
+    return bytes;
+}
+
+storage::FileManagerContext
+IndexContext(const BenchData& data) {
+    auto field_meta = gen_field_meta(kCollectionID,
+                                     kPartitionID,
+                                     kSegmentID,
+                                     data.str_fid.get(),
+                                     DataType::VARCHAR,
+                                     DataType::NONE,
+                                     false,
+                                     65535);
+    auto index_meta = gen_index_meta(kSegmentID, data.str_fid.get());
+    auto cm = storage::RemoteChunkManagerSingleton::GetInstance()
+                  .GetRemoteChunkManager();
+    auto fs = storage::InitArrowFileSystem(get_default_local_storage_config());
+    return storage::FileManagerContext(field_meta, index_meta, cm, fs);
+}
+
+const BenchData&
+Data() {
+    static const auto data = []() {
+        auto& config = Config();
+        auto result = std::make_unique<BenchData>();
+        result->schema = std::make_shared<Schema>();
+        result->pk_fid = result->schema->AddDebugField("pk", DataType::INT64);
+        result->schema->set_primary_field_id(result->pk_fid);
+        result->schema->AddDebugField(
+            "vec", DataType::VECTOR_FLOAT, config.dim, knowhere::metric::L2);
+        result->schema->AddDebugField("counter", DataType::INT64);
+        result->str_fid =
+            result->schema->AddDebugField("str", DataType::VARCHAR);
+
+        result->dataset = DataGen(result->schema, config.rows, 42);
+        auto cm = storage::RemoteChunkManagerSingleton::GetInstance()
+                      .GetRemoteChunkManager();
+        result->load_info = PrepareInsertBinlog(kCollectionID,
+                                                kPartitionID,
+                                                kSegmentID,
+                                                result->dataset,
+                                                cm);
+        result->load_bytes = SerializedBytes(result->load_info);
+
+        // build the inverted index from the uploaded VARCHAR binlog
+        milvus::Config build_config;
+        build_config[index::INDEX_TYPE] = index::INVERTED_INDEX_TYPE;
+        build_config[INSERT_FILES_KEY] =
+            result->load_info.field_infos.at(result->str_fid.get())
+                .insert_files;
+        build_config[INDEX_NUM_ROWS_KEY] = config.rows;
+        build_config[index::SCALAR_INDEX_ENGINE_VERSION] = 3;
+        auto ctx = IndexContext(*result);
+        auto creator = indexbuilder::IndexFactory::GetInstance().CreateIndex(
+            DataType::VARCHAR, build_config, ctx);
+        creator->Build();
+        auto stats = creator->Upload();
+        result->index_files = stats->GetIndexFiles();
+        result->index_bytes = stats->GetSerializedSize();
+        return result;
+    }();
+    return *data;
+}
+
+// VmHWM only covers the pages touched after the reset, ru_maxrss is the
+// fallback when /proc is not there and then covers the whole process.
+void
+ResetPeakRss() {
+    std::ofstream clear_refs("/proc/self/clear_refs");
+    if (clear_refs) {
+        clear_refs << "5";
+    }
+}
+
+double
+PeakRssMB() {
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.rfind("VmHWM:", 0) == 0) {
+            return std::atof(line.c_str() + 6) / 1024.0;
+        }
+    }
+    struct rusage usage {};
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss / 1024.0;
+}
+
+void
+ReportLoad(benchmark::State& state, int64_t bytes) {
+    state.SetBytesProcessed(state.iterations() * bytes);
+    state.counters["MB/s"] = benchmark::Counter(
+        bytes / kMB, benchmark::Counter::kIsIterationInvariantRate);
+    state.counters["input_MB"] = bytes / kMB;
+    state.counters["peak_rss_MB"] = PeakRssMB();
+}
+
+// Sizes the HIGH pool, which loads the fields and indexes of a HIGH
+// priority load, for one benchmark and restores it afterwards.
+class ScopedLoadThreads {
+ public:
+    explicit ScopedLoadThreads(int threads)
+        : pool_(ThreadPools::GetThreadPool(ThreadPoolPriority::HIGH)),
+          prev_(pool_.GetMaxThreadNum()) {
+        pool_.Resize(threads);
+    }
+
+    ~ScopedLoadThreads() {
+        pool_.Resize(static_cast<int>(prev_));
+    }
+
+ private:
+    ThreadPool& pool_;
+    size_t prev_;
+};
+
+void
+FieldDataBenchmark(benchmark::State& state) {
+    auto mmap = state.range(0) != 0;
+    auto warmup = state.range(1) != 0 ? "sync" : "disable";
+    auto& data = Data();
+    ScopedLoadThreads threads(state.range(2));
+
+    auto load_info = data.load_info;
+    for (auto& [_, field] : load_info.field_infos) {
+        field.enable_mmap = mmap;
+        field.warmup_policy = warmup;
+    }
+
+    ResetPeakRss();
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto segment = CreateSealedSegment(data.schema, empty_index_meta);
+        state.ResumeTiming();
+
+        segment->LoadFieldData(load_info);
+
+        state.PauseTiming();
+        benchmark::DoNotOptimize(segment->get_row_count());
+        segment.reset();
+        state.ResumeTiming();
+    }
+    ReportLoad(state, data.load_bytes);
+}
+
+void
+DeletedRecordBenchmark(benchmark::State& state) {
+    auto delete_percent = state.range(0);
+    auto& data = Data();
+    auto rows = Config().rows;
+
+    // the pk and the system fields are enough to apply deletes
+    LoadFieldDataInfo pk_info;
+    pk_info.field_infos.emplace(
+        data.pk_fid.get(), data.load_info.field_infos.at(data.pk_fid.get()));
+    for (auto fid : {RowFieldID, TimestampFieldID}) {
+        pk_info.field_infos.emplace(fid.get(),
+                                    data.load_info.field_infos.at(fid.get()));
+    }
+
+    // delete log order is not pk order, shuffle like a compacted delta log
+    auto pks = data.dataset.get_col<int64_t>(data.pk_fid);
+    std::shuffle(pks.begin(), pks.end(), std::default_random_engine(42));
+    pks.resize(std::max<int64_t>(1, rows * delete_percent / 100));
+    auto ids = std::make_unique<IdArray>();
+    ids->mutable_int_id()->mutable_data()->Add(pks.begin(), pks.end());
+    std::vector<Timestamp> timestamps(pks.size(), rows * 2);
+    LoadDeletedRecordInfo delete_info{timestamps.data(),
+                                      ids.get(),
+                                      static_cast<int64_t>(pks.size())};
+
+    ResetPeakRss();
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto segment = CreateSealedSegment(data.schema, empty_index_meta);
+        segment->LoadFieldData(pk_info);
+        state.ResumeTiming();
+
+        segment->LoadDeletedRecord(delete_info);
+
+        state.PauseTiming();
+        benchmark::DoNotOptimize(segment->get_deleted_count());
+        segment.reset();
+        state.ResumeTiming();
+    }
+    ReportLoad(state, static_cast<int64_t>(pks.size()) * sizeof(int64_t) * 2);
+    state.SetItemsProcessed(state.iterations() * pks.size());
+}
+
+void
+InvertedIndexBenchmark(benchmark::State& state) {
+    auto mmap = state.range(0) != 0;
+    auto& data = Data();
+
+    index::CreateIndexInfo index_info{};
+    index_info.index_type = index::INVERTED_INDEX_TYPE;
+    index_info.field_type = DataType::VARCHAR;
+    milvus::Config load_config;
+    load_config[index::INDEX_FILES] = data.index_files;
+    load_config[index::ENABLE_MMAP] = mmap;
+    load_config[LOAD_PRIORITY] = proto::common::LoadPriority::HIGH;
+
+    ResetPeakRss();
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto ctx = IndexContext(data);
+        ctx.set_for_loading_index(true);
+        auto index =
+            index::IndexFactory::GetInstance().CreateIndex(index_info, ctx);
+        state.ResumeTiming();
+
+        index->LoadUnified(load_config);
+
+        state.PauseTiming();
+        benchmark::DoNotOptimize(index->Count());
+        index.reset();
+        state.ResumeTiming();
+    }
+    ReportLoad(state, data.index_bytes);
+}
+
+// Consumes the --load_bench_* flags, leaves everything else in argv.
+void
+ParseFlags(int* argc, char** argv) {
+    auto& config = Config();
+    int out = 1;
+    for (int i = 1; i < *argc; ++i) {
+        std::string arg = argv[i];
+        auto value_of = [&arg](const std::string& flag) -> const char* {
+            auto prefix = "--" + flag + "=";
+            return arg.rfind(prefix, 0) == 0 ? arg.c_str() + prefix.size()
+                                             : nullptr;
+        };
+        if (auto v = value_of("load_bench_rows")) {
+            config.rows = std::max<int64_t>(1, std::atoll(v));
+        } else if (auto v = value_of("load_bench_dim")) {
+            config.dim = std::max<int64_t>(1, std::atoll(v));
+        } else {
+            argv[out++] = argv[i];
+        }
+    }
+    *argc = out;
+}
+
+}  // namespace
+}  // namespace milvus::segcore::bench
+
+int
+main(int argc, char** argv) {
+    using namespace milvus::segcore::bench;
+    ParseFlags(&argc, argv);
+    benchmark::Initialize(&argc, argv);
+    milvus::bench::InitBenchmarkEnvironment(&argc, &argv, "load_benchmark");
+    auto cpu_num = std::max<int64_t>(1, std::thread::hardware_concurrency());
+    InitCpuNum(static_cast<int>(cpu_num));
+
+    auto& config = Config();
+    benchmark::AddCustomContext("rows", std::to_string(config.rows));
+    benchmark::AddCustomContext("dim", std::to_string(config.dim));
+
+    std::vector<int64_t> threads;
+    for (int64_t n = 1; n < cpu_num; n *= 4) {
+        threads.push_back(n);
+    }
+    threads.push_back(cpu_num);
+
+    benchmark::RegisterBenchmark("LoadFieldData", FieldDataBenchmark)
+        ->ArgNames({"mmap", "warmup", "threads"})
+        ->ArgsProduct({{0, 1}, {0, 1}, threads})
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
+    benchmark::RegisterBenchmark("LoadDeletedRecord", DeletedRecordBenchmark)
+        ->ArgNames({"delete_percent"})
+        ->Args({1})
+        ->Args({10})
+        ->Args({50})
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
+    benchmark::RegisterBenchmark("LoadInvertedIndex", InvertedIndexBenchmark)
+        ->ArgNames({"mmap"})
+        ->Args({0})
+        ->Args({1})
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
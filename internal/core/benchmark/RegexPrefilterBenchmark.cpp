@@ -0,0 +1,222 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Benchmark of the literal prefilter in front of regex and LIKE matching on
+// unindexed VARCHAR data, milvus::LiteralPrefilter.
+//
+// The rows are synthetic service log lines packed back to back like a
+// StringChunk. Each pattern is evaluated over all rows once per iteration
+// with the matcher alone (RowByRow) and with the required literals searched
+// over the packed buffer first (Prefiltered), which only hands the rows
+// holding them to the matcher.
+//
+// Extra flags (parsed before the google benchmark flags are handed over):
+//   --regex_bench_rows=N    log lines per iteration (default 1M)
+//
+// Example:
+//   regex_prefilter_benchmark --benchmark_filter='Regex/.*'
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <fmt/core.h>
+
+#include "BenchmarkEnv.h"
+#include "common/LiteralPrefilter.h"
+#include "common/RegexQuery.h"
+#include "index/NgramInvertedIndex.h"
+
+namespace milvus::bench {
+namespace {
+
+struct BenchConfig {
+    int64_t rows{1 << 20};
+};
+
+BenchConfig&
+Config() {
+    static BenchConfig config;
+    return config;
+}
+
+struct LogRows {
+    std::string buffer;
+    std::vector<std::string_view> views;
+};
+
+// One line in a hundred is an error, one in a thousand a timeout.
+const LogRows&
+Rows() {
+    static LogRows rows;
+    if (!rows.views.empty()) {
+        return rows;
+    }
+    static const char* kPaths[] = {"/api/v1/search",
+                                   "/api/v1/query",
+                                   "/api/v1/insert",
+                                   "/healthz"};
+    std::default_random_engine er(42);
+    std::uniform_int_distribution<int> percent(0, 999);
+    std::uniform_int_distribution<int> user(0, 99999);
+    std::vector<size_t> sizes;
+    sizes.reserve(Config().rows);
+    for (int64_t i = 0; i < Config().rows; ++i) {
+        auto roll = percent(er);
+        std::string line;
+        if (roll < 10) {
+            line = fmt::format(
+                "2026-03-14T12:{:02}:{:02}Z ERROR [proxy-{}] request_id={} "
+                "user_id={} {} ({})",
+                (i / 60) % 60,
+                i % 60,
+                i % 16,
+                i,
+                user(er),
+                roll == 0 ? "upstream timeout after 3000 ms"
+                          : "connection reset by peer",
+                kPaths[i % 4]);
+        } else {
+            line = fmt::format(
+                "2026-03-14T12:{:02}:{:02}Z INFO  [proxy-{}] request_id={} "
+                "user_id={} path={} status=200 latency_ms={}",
+                (i / 60) % 60,
+                i % 60,
+                i % 16,
+                i,
+                user(er),
+                kPaths[i % 4],
+                roll);
+        }
+        rows.buffer += line;
+        sizes.push_back(line.size());
+    }
+    size_t offset = 0;
+    rows.views.reserve(sizes.size());
+    for (auto size : sizes) {
+        rows.views.emplace_back(rows.buffer.data() + offset, size);
+        offset += size;
+    }
+    return rows;
+}
+
+template <typename Matcher>
+void
+RunMatch(benchmark::State& state,
+         const Matcher& matcher,
+         const LiteralPrefilter* prefilter) {
+    const auto& rows = Rows();
+    int64_t matched = 0;
+    for (auto _ : state) {
+        matched = 0;
+        if (prefilter == nullptr) {
+            for (const auto& row : rows.views) {
+                matched += matcher(row);
+            }
+        } else {
+            prefilter->ForEachCandidate(
+                rows.views.data(), rows.views.size(), [&](size_t i) {
+                    matched += matcher(rows.views[i]);
+                });
+        }
+        benchmark::DoNotOptimize(matched);
+    }
+    state.counters["matched"] = static_cast<double>(matched);
+    state.SetItemsProcessed(state.iterations() * rows.views.size());
+    state.SetBytesProcessed(state.iterations() * rows.buffer.size());
+}
+
+void
+RegisterRegex(const std::string& pattern) {
+    for (bool prefiltered : {false, true}) {
+        auto name = fmt::format(
+            "Regex/{}/{}", pattern, prefiltered ? "Prefiltered" : "RowByRow");
+        benchmark::RegisterBenchmark(
+            name.c_str(), [pattern, prefiltered](benchmark::State& state) {
+                PartialRegexMatcher matcher(pattern);
+                std::unique_ptr<LiteralPrefilter> prefilter;
+                if (prefiltered) {
+                    prefilter = std::make_unique<LiteralPrefilter>(
+                        index::extract_literals_from_regex(pattern));
+                }
+                RunMatch(state, matcher, prefilter.get());
+            });
+    }
+}
+
+void
+RegisterLike(const std::string& pattern) {
+    for (bool prefiltered : {false, true}) {
+        auto name = fmt::format(
+            "Like/{}/{}", pattern, prefiltered ? "Prefiltered" : "RowByRow");
+        benchmark::RegisterBenchmark(
+            name.c_str(), [pattern, prefiltered](benchmark::State& state) {
+                LikePatternMatcher matcher(pattern);
+                std::unique_ptr<LiteralPrefilter> prefilter;
+                if (prefiltered) {
+                    prefilter = std::make_unique<LiteralPrefilter>(
+                        matcher.RequiredLiterals());
+                }
+                RunMatch(state, matcher, prefilter.get());
+            });
+    }
+}
+
+void
+ParseFlags(int* argc, char** argv) {
+    auto& config = Config();
+    int out = 1;
+    for (int i = 1; i < *argc; ++i) {
+        std::string_view arg(argv[i]);
+        constexpr std::string_view kRows = "--regex_bench_rows=";
+        if (arg.substr(0, kRows.size()) == kRows) {
+            config.rows = std::max<int64_t>(
+                1, std::atoll(argv[i] + kRows.size()));
+        } else {
+            argv[out++] = argv[i];
+        }
+    }
+    *argc = out;
+}
+
+}  // namespace
+}  // namespace milvus::bench
+
+int
+main(int argc, char** argv) {
+    using namespace milvus::bench;
+    ParseFlags(&argc, argv);
+    benchmark::Initialize(&argc, argv);
+    InitBenchmarkEnvironment(&argc, &argv, "regex_prefilter_benchmark");
+
+    benchmark::AddCustomContext("rows", std::to_string(Config().rows));
+
+    RegisterRegex("ERROR.*timeout after [0-9]+ ms");
+    RegisterRegex("user_id=4242[0-9]? ");
+    RegisterRegex("proxy-1[0-5].*status=200");
+    RegisterLike("%connection reset%");
+    RegisterLike("%ERROR%/api/v1/insert%");
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
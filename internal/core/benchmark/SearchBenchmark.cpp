@@ -0,0 +1,332 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// End-to-end benchmark of sealed segment search, from the serialized plan to
+// ReduceHelper::PreReduce, without the Go side.
+//
+// Every iteration runs the same stages as a query node search:
+//   parse   CreateSearchPlanByExpr + ParsePlaceholderGroup
+//   search  SegmentInterface::Search on every segment, i.e. the
+//           ExecPlanNodeVisitor pipeline (MvccNode, FilterBitsNode,
+//           VectorSearchNode). Split further into
+//             filter  internal_core_search_latency_scalar
+//             vector  internal_core_search_latency_vector
+//             mvcc    the rest (MVCC, deletes, pipeline overhead)
+//   reduce  ReduceHelper::PreReduce over all segment results
+// and reports p50/p99/mean per stage as benchmark counters.
+//
+// The sweep covers nq x topk x filter selectivity (percentage of rows that
+// pass `counter < threshold`, 100 means no filter).
+//
+// Extra flags (parsed before the google benchmark flags are handed over):
+//   --search_bench_rows=N       rows per segment (default 100000)
+//   --search_bench_segments=N   sealed segments to search (default 2)
+//   --search_bench_dim=N        vector dimension (default 128)
+//   --search_bench_index=TYPE   knowhere index type, e.g. HNSW or IVF_FLAT
+//                               (default: none, brute force on raw data)
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "BenchmarkEnv.h"
+#include "common/QueryResult.h"
+#include "common/Schema.h"
+#include "common/Types.h"
+#include "knowhere/comp/index_param.h"
+#include "monitor/Monitor.h"
+#include "pb/plan.pb.h"
+#include "query/Plan.h"
+#include "query/PlanImpl.h"
+#include "segcore/ChunkedSegmentSealedImpl.h"
+#include "segcore/reduce/Reduce.h"
+#include "test_utils/DataGen.h"
+#include "test_utils/cachinglayer_test_utils.h"
+#include "test_utils/storage_test_utils.h"
+
+namespace milvus::segcore::bench {
+namespace {
+
+namespace planpb = proto::plan;
+
+struct BenchConfig {
+    int64_t rows{100000};
+    int64_t segments{2};
+    int64_t dim{128};
+    std::string index_type;
+};
+
+BenchConfig&
+Config() {
+    static BenchConfig config;
+    return config;
+}
+
+struct BenchData {
+    SchemaPtr schema;
+    FieldId vec_fid;
+    FieldId counter_fid;
+    std::vector<SegmentSealedUPtr> segments;
+};
+
+const BenchData&
+Data() {
+    static const auto data = []() {
+        auto& config = Config();
+        auto result = std::make_unique<BenchData>();
+        result->schema = std::make_shared<Schema>();
+        auto pk_fid = result->schema->AddDebugField("pk", DataType::INT64);
+        result->schema->set_primary_field_id(pk_fid);
+        result->vec_fid = result->schema->AddDebugField(
+            "vec", DataType::VECTOR_FLOAT, config.dim, knowhere::metric::L2);
+        // counter = row offset, so `counter < x` has an exact selectivity
+        result->counter_fid =
+            result->schema->AddDebugField("counter", DataType::INT64);
+
+        for (int64_t i = 0; i < config.segments; ++i) {
+            auto raw_data = DataGen(result->schema, config.rows, 42 + i);
+            auto segment =
+                CreateSealedWithFieldDataLoaded(result->schema, raw_data);
+            if (!config.index_type.empty()) {
+                auto vecs = raw_data.get_col<float>(result->vec_fid);
+                auto indexing = GenVecIndexing(config.rows,
+                                               config.dim,
+                                               vecs.data(),
+                                               config.index_type.c_str());
+                LoadIndexInfo vec_info;
+                vec_info.field_id = result->vec_fid.get();
+                vec_info.index_params = GenIndexParams(indexing.get());
+                vec_info.cache_index =
+                    CreateTestCacheIndex("search_bench", std::move(indexing));
+                vec_info.index_params["metric_type"] = knowhere::metric::L2;
+                segment->LoadIndex(vec_info);
+            }
+            result->segments.push_back(std::move(segment));
+        }
+        return result;
+    }();
+    return *data;
+}
+
+std::string
+SearchParams(int64_t topk) {
+    auto& index_type = Config().index_type;
+    if (index_type == knowhere::IndexEnum::INDEX_HNSW) {
+        return "{\"ef\": " + std::to_string(std::max<int64_t>(topk, 64)) + "}";
+    }
+    if (index_type.rfind("IVF", 0) == 0) {
+        return "{\"nprobe\": 16}";
+    }
+    return "{}";
+}
+
+std::string
+BuildPlan(const BenchData& data, int64_t topk, int64_t selectivity) {
+    planpb::PlanNode plan_node;
+    auto* anns = plan_node.mutable_vector_anns();
+    anns->set_vector_type(planpb::VectorType::FloatVector);
+    anns->set_field_id(data.vec_fid.get());
+    anns->set_placeholder_tag("$0");
+    auto* query_info = anns->mutable_query_info();
+    query_info->set_topk(topk);
+    query_info->set_metric_type(knowhere::metric::L2);
+    query_info->set_search_params(SearchParams(topk));
+    query_info->set_round_decimal(-1);
+    if (selectivity < 100) {
+        auto* unary = anns->mutable_predicates()->mutable_unary_range_expr();
+        auto* column = unary->mutable_column_info();
+        column->set_field_id(data.counter_fid.get());
+        column->set_data_type(proto::schema::DataType::Int64);
+        unary->set_op(planpb::OpType::LessThan);
+        unary->mutable_value()->set_int64_val(Config().rows * selectivity /
+                                              100);
+    }
+    return plan_node.SerializeAsString();
+}
+
+double
+HistogramSumMs(prometheus::Histogram& histogram) {
+    return histogram.Collect().histogram.sample_sum;
+}
+
+// Per-iteration samples of every stage, in microseconds.
+class StageLatency {
+ public:
+    void
+    Add(const std::string& stage, double us) {
+        samples_[stage].push_back(us);
+    }
+
+    void
+    Report(benchmark::State& state) {
+        for (auto& [stage, samples] : samples_) {
+            if (samples.empty()) {
+                continue;
+            }
+            std::sort(samples.begin(), samples.end());
+            double sum = 0;
+            for (auto v : samples) {
+                sum += v;
+            }
+            state.counters[stage + "_p50_us"] = samples[samples.size() / 2];
+            state.counters[stage + "_p99_us"] =
+                samples[std::min(samples.size() - 1,
+                                 samples.size() * 99 / 100)];
+            state.counters[stage + "_mean_us"] = sum / samples.size();
+        }
+    }
+
+ private:
+    std::map<std::string, std::vector<double>> samples_;
+};
+
+double
+ElapsedUs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::micro>(
+               std::chrono::steady_clock::now() - start)
+        .count();
+}
+
+void
+SearchBenchmark(benchmark::State& state) {
+    auto nq = state.range(0);
+    auto topk = state.range(1);
+    auto selectivity = state.range(2);
+    auto& data = Data();
+
+    auto plan_bytes = BuildPlan(data, topk, selectivity);
+    auto ph_bytes =
+        CreatePlaceholderGroup(nq, Config().dim, 1024).SerializeAsString();
+    auto& scalar_latency = monitor::internal_core_search_latency_scalar;
+    auto& vector_latency = monitor::internal_core_search_latency_vector;
+
+    StageLatency latency;
+    int64_t result_count = 0;
+    for (auto _ : state) {
+        auto start = std::chrono::steady_clock::now();
+        auto plan = query::CreateSearchPlanByExpr(
+            data.schema, plan_bytes.data(), plan_bytes.size());
+        auto ph_group = query::ParsePlaceholderGroup(plan.get(), ph_bytes);
+        latency.Add("parse", ElapsedUs(start));
+
+        auto scalar_before = HistogramSumMs(scalar_latency);
+        auto vector_before = HistogramSumMs(vector_latency);
+        start = std::chrono::steady_clock::now();
+        std::vector<std::unique_ptr<SearchResult>> results;
+        results.reserve(data.segments.size());
+        for (const auto& segment : data.segments) {
+            results.push_back(
+                segment->Search(plan.get(), ph_group.get(), MAX_TIMESTAMP));
+        }
+        auto search_us = ElapsedUs(start);
+        auto filter_us =
+            (HistogramSumMs(scalar_latency) - scalar_before) * 1000;
+        auto vector_us =
+            (HistogramSumMs(vector_latency) - vector_before) * 1000;
+        latency.Add("search", search_us);
+        latency.Add("search_filter", filter_us);
+        latency.Add("search_vector", vector_us);
+        latency.Add("search_mvcc",
+                    std::max(0.0, search_us - filter_us - vector_us));
+
+        start = std::chrono::steady_clock::now();
+        std::vector<SearchResult*> result_ptrs;
+        for (auto& result : results) {
+            result_ptrs.push_back(result.get());
+        }
+        int64_t slice_nqs[] = {nq};
+        int64_t slice_topks[] = {topk};
+        ReduceHelper helper(result_ptrs,
+                            plan.get(),
+                            ph_group.get(),
+                            slice_nqs,
+                            slice_topks,
+                            1,
+                            nullptr);
+        helper.PreReduce();
+        latency.Add("reduce", ElapsedUs(start));
+
+        result_count = 0;
+        for (auto* result : result_ptrs) {
+            result_count += result->seg_offsets_.size();
+        }
+        benchmark::DoNotOptimize(result_count);
+    }
+    latency.Report(state);
+    state.counters["results"] = static_cast<double>(result_count);
+    state.SetItemsProcessed(state.iterations() * nq);
+}
+
+// Consumes the --search_bench_* flags, leaves everything else in argv.
+void
+ParseFlags(int* argc, char** argv) {
+    auto& config = Config();
+    int out = 1;
+    for (int i = 1; i < *argc; ++i) {
+        std::string arg = argv[i];
+        auto value_of = [&arg](const std::string& flag) -> const char* {
+            auto prefix = "--" + flag + "=";
+            return arg.rfind(prefix, 0) == 0 ? arg.c_str() + prefix.size()
+                                             : nullptr;
+        };
+        if (auto v = value_of("search_bench_rows")) {
+            config.rows = std::max<int64_t>(1, std::atoll(v));
+        } else if (auto v = value_of("search_bench_segments")) {
+            config.segments = std::max<int64_t>(1, std::atoll(v));
+        } else if (auto v = value_of("search_bench_dim")) {
+            config.dim = std::max<int64_t>(1, std::atoll(v));
+        } else if (auto v = value_of("search_bench_index")) {
+            config.index_type = v;
+        } else {
+            argv[out++] = argv[i];
+        }
+    }
+    *argc = out;
+}
+
+}  // namespace
+}  // namespace milvus::segcore::bench
+
+int
+main(int argc, char** argv) {
+    using namespace milvus::segcore::bench;
+    ParseFlags(&argc, argv);
+    benchmark::Initialize(&argc, argv);
+    milvus::bench::InitBenchmarkEnvironment(&argc, &argv, "search_benchmark");
+
+    auto& config = Config();
+    benchmark::AddCustomContext("rows", std::to_string(config.rows));
+    benchmark::AddCustomContext("segments", std::to_string(config.segments));
+    benchmark::AddCustomContext("dim", std::to_string(config.dim));
+    benchmark::AddCustomContext(
+        "index", config.index_type.empty() ? "none" : config.index_type);
+
+    benchmark::RegisterBenchmark("SealedSearch", SearchBenchmark)
+        ->ArgNames({"nq", "topk", "selectivity"})
+        ->ArgsProduct({{1, 10, 100}, {10, 100}, {100, 50, 10, 1}})
+        ->Unit(benchmark::kMicrosecond);
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,245 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Benchmark of the binary and int8 brute force kernels in
+// query/VectorKernels.h.
+//
+// Every iteration scores one query against all rows, once per kernel tier
+// the CPU supports, so the baseline and accelerated rows of the report read
+// side by side. The rows are sized to stay in L2, like the blocks
+// VectorKernelSearch walks, and items/s is the rows scored per second on
+// the one core the benchmark runs on. A second group times the whole
+// VectorKernelSearch over a segment-sized set of rows.
+//
+// Extra flags (parsed before the google benchmark flags are handed over):
+//   --vector_kernel_bench_rows=N   rows of the search benchmark (default 1M)
+//
+// Example:
+//   vector_kernel_benchmark --benchmark_filter='Hamming/.*'
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "BenchmarkEnv.h"
+#include "common/BitsetView.h"
+#include "common/Types.h"
+#include "knowhere/comp/index_param.h"
+#include "query/VectorKernels.h"
+#include "query/helper.h"
+
+namespace milvus::query::bench {
+namespace {
+
+// rows a kernel benchmark scores per call
+constexpr int64_t kKernelRows = 1024;
+
+struct BenchConfig {
+    int64_t search_rows{1 << 20};
+};
+
+BenchConfig&
+Config() {
+    static BenchConfig config;
+    return config;
+}
+
+const char*
+LevelName(VectorKernelLevel level) {
+    switch (level) {
+        case VectorKernelLevel::kBaseline:
+            return "baseline";
+        case VectorKernelLevel::kAccelerated:
+            return "accelerated";
+    }
+    return "unknown";
+}
+
+template <typename T>
+std::vector<T>
+RandomValues(int64_t n) {
+    std::default_random_engine er(42);
+    std::uniform_int_distribution<int> dist(std::numeric_limits<T>::min(),
+                                            std::numeric_limits<T>::max());
+    std::vector<T> values(n);
+    for (auto& v : values) {
+        v = static_cast<T>(dist(er));
+    }
+    return values;
+}
+
+// range(0): code bytes or int8 dim, range(1): VectorKernelLevel
+template <typename T, typename Kernel>
+void
+RunKernel(benchmark::State& state, Kernel kernel) {
+    auto size = state.range(0);
+    SetVectorKernelLevel(static_cast<VectorKernelLevel>(state.range(1)));
+    auto query = RandomValues<T>(size);
+    auto rows = RandomValues<T>(kKernelRows * size);
+    std::vector<float> out(kKernelRows);
+    for (auto _ : state) {
+        kernel(query.data(), rows.data(), kKernelRows, size, out.data());
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * kKernelRows);
+    state.SetBytesProcessed(state.iterations() * kKernelRows * size);
+}
+
+void
+BM_Hamming(benchmark::State& state) {
+    RunKernel<uint8_t>(state, HammingDistances);
+}
+
+void
+BM_Jaccard(benchmark::State& state) {
+    RunKernel<uint8_t>(state, JaccardDistances);
+}
+
+void
+BM_Int8InnerProduct(benchmark::State& state) {
+    RunKernel<int8_t>(state, Int8InnerProducts);
+}
+
+// range(0): 0 for binary HAMMING, 1 for int8 IP, range(1): nq,
+// range(2): VectorKernelLevel
+void
+BM_Search(benchmark::State& state) {
+    const bool binary = state.range(0) == 0;
+    const auto nq = state.range(1);
+    SetVectorKernelLevel(static_cast<VectorKernelLevel>(state.range(2)));
+    // 768 bit codes, 128 dim int8 vectors
+    const int64_t dim = binary ? 768 : 128;
+    const int64_t row_size = binary ? dim / 8 : dim;
+    const int64_t topk = 10;
+    const auto rows = Config().search_rows;
+    auto data = RandomValues<int8_t>(rows * row_size);
+    auto queries = RandomValues<int8_t>(nq * row_size);
+    const MetricType metric =
+        binary ? knowhere::metric::HAMMING : knowhere::metric::IP;
+    const auto data_type =
+        binary ? DataType::VECTOR_BINARY : DataType::VECTOR_INT8;
+
+    dataset::SearchDataset query_ds{
+        metric, nq, topk, -1, dim, queries.data()};
+    dataset::RawDataset raw_ds{0, dim, rows, data.data()};
+    std::vector<int64_t> offsets(nq * topk);
+    std::vector<float> distances(nq * topk);
+    for (auto _ : state) {
+        VectorKernelSearch(query_ds,
+                           raw_ds,
+                           metric,
+                           data_type,
+                           BitsetView{},
+                           offsets.data(),
+                           distances.data());
+        benchmark::DoNotOptimize(offsets.data());
+    }
+    state.SetItemsProcessed(state.iterations() * rows * nq);
+}
+
+void
+RegisterKernels() {
+    std::vector<VectorKernelLevel> levels{VectorKernelLevel::kBaseline};
+    if (DetectVectorKernelLevel() != VectorKernelLevel::kBaseline) {
+        levels.push_back(DetectVectorKernelLevel());
+    }
+    struct Kernel {
+        const char* name;
+        void (*fn)(benchmark::State&);
+        std::vector<int64_t> sizes;
+    };
+    // code bytes of 128 to 2048 bit vectors, int8 dims
+    const std::vector<Kernel> kernels{
+        {"Hamming", BM_Hamming, {16, 32, 64, 128, 256}},
+        {"Jaccard", BM_Jaccard, {16, 32, 64, 128, 256}},
+        {"Int8InnerProduct", BM_Int8InnerProduct, {64, 128, 256, 768}}};
+    for (const auto& kernel : kernels) {
+        for (auto size : kernel.sizes) {
+            for (auto level : levels) {
+                benchmark::RegisterBenchmark(
+                    (std::string(kernel.name) + "/" + LevelName(level))
+                        .c_str(),
+                    kernel.fn)
+                    ->Args({size, static_cast<int64_t>(level)});
+            }
+        }
+    }
+    for (int64_t int8 : {0, 1}) {
+        for (int64_t nq : {1, 16}) {
+            for (auto level : levels) {
+                benchmark::RegisterBenchmark(
+                    (std::string("Search/") + (int8 ? "int8_ip" : "hamming") +
+                     "/" + LevelName(level))
+                        .c_str(),
+                    BM_Search)
+                    ->Args({int8, nq, static_cast<int64_t>(level)})
+                    ->Unit(benchmark::kMillisecond);
+            }
+        }
+    }
+}
+
+// Consumes the --vector_kernel_bench_* flags, leaves everything else in argv.
+void
+ParseFlags(int* argc, char** argv) {
+    auto& config = Config();
+    int out = 1;
+    for (int i = 1; i < *argc; ++i) {
+        std::string arg = argv[i];
+        auto value_of = [&arg](const std::string& flag) -> const char* {
+            auto prefix = "--" + flag + "=";
+            return arg.rfind(prefix, 0) == 0 ? arg.c_str() + prefix.size()
+                                             : nullptr;
+        };
+        if (auto v = value_of("vector_kernel_bench_rows")) {
+            config.search_rows = std::max<int64_t>(1, std::atoll(v));
+        } else {
+            argv[out++] = argv[i];
+        }
+    }
+    *argc = out;
+}
+
+}  // namespace
+}  // namespace milvus::query::bench
+
+int
+main(int argc, char** argv) {
+    using namespace milvus::query;
+    using namespace milvus::query::bench;
+    ParseFlags(&argc, argv);
+    benchmark::Initialize(&argc, argv);
+    milvus::bench::InitBenchmarkEnvironment(
+        &argc, &argv, "vector_kernel_benchmark");
+
+    benchmark::AddCustomContext("search_rows",
+                                std::to_string(Config().search_rows));
+    benchmark::AddCustomContext("detected_level",
+                                LevelName(DetectVectorKernelLevel()));
+
+    RegisterKernels();
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
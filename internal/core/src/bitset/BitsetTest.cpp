@@ -2694,6 +2694,226 @@ INSTANTIATE_TYPED_TEST_SUITE_P(InplaceOpMultipleTest,
 
 //////////////////////////////////////////////////////////////////////////////////////////
 
+//
+bool
+EvalFusedRef(const std::vector<FusedOp>& program,
+             const std::vector<const std::vector<bool>*>& operands,
+             const size_t idx) {
+    std::vector<bool> stack;
+    for (const auto& op : program) {
+        if (op.type == FusedOpType::LOAD) {
+            stack.push_back((*operands[op.operand])[idx]);
+            continue;
+        }
+
+        const bool b = stack.back();
+        if (op.type == FusedOpType::NOT) {
+            stack.back() = !b;
+            continue;
+        }
+
+        stack.pop_back();
+        if (op.type == FusedOpType::AND) {
+            stack.back() = stack.back() && b;
+        } else if (op.type == FusedOpType::OR) {
+            stack.back() = stack.back() || b;
+        } else {
+            stack.back() = stack.back() && !b;
+        }
+    }
+
+    return stack.back();
+}
+
+template <typename BitsetT, typename OtherT>
+void
+TestFusedImpl(BitsetT& bitset, std::vector<OtherT>& bitset_others) {
+    const size_t n = bitset.size();
+    const size_t n_others = bitset_others.size();
+
+    using L = FusedOpType;
+    // the validity of a three-valued AND, and a mixed tree
+    const std::vector<std::vector<FusedOp>> programs = {
+        {{L::LOAD, 2},
+         {L::LOAD, 1},
+         {L::NOT},
+         {L::OR},
+         {L::LOAD, 0},
+         {L::AND},
+         {L::LOAD, 2},
+         {L::LOAD, 3},
+         {L::AND_NOT},
+         {L::OR}},
+        {{L::LOAD, 0},
+         {L::LOAD, 1},
+         {L::AND},
+         {L::LOAD, 2},
+         {L::OR},
+         {L::LOAD, 3},
+         {L::AND_NOT},
+         {L::NOT}},
+    };
+
+    std::default_random_engine rng(345);
+    std::uniform_int_distribution<int8_t> u(0, 1);
+
+    for (const auto& program : programs) {
+        ASSERT_GT(fused_program_depth(
+                      program.data(), program.size(), n_others + 1),
+                  0);
+
+        std::vector<std::vector<bool>> ref(n_others + 1,
+                                           std::vector<bool>(n, false));
+        for (size_t i = 0; i < n; i++) {
+            ref[0][i] = (u(rng) == 0);
+            bitset[i] = ref[0][i];
+            for (size_t j = 0; j < n_others; j++) {
+                ref[j + 1][i] = (u(rng) == 0);
+                bitset_others[j][i] = ref[j + 1][i];
+            }
+        }
+
+        std::vector<const std::vector<bool>*> ref_operands;
+        for (const auto& r : ref) {
+            ref_operands.push_back(&r);
+        }
+
+        std::vector<bool> expected(n, false);
+        std::vector<size_t> expected_found;
+        for (size_t i = 0; i < n; i++) {
+            expected[i] = EvalFusedRef(program, ref_operands, i);
+            if (expected[i]) {
+                expected_found.push_back(i);
+            }
+        }
+
+        std::vector<decltype(bitset_others[0].view())> views;
+        for (auto& other : bitset_others) {
+            views.push_back(other.view());
+        }
+
+        // count and find, which leave the bitset intact
+        ASSERT_EQ(bitset.count_fused(
+                      views.data(), n_others, program.data(), program.size()),
+                  expected_found.size());
+
+        for (const size_t max_found : {size_t(1), size_t(7), n + 1}) {
+            std::vector<size_t> found(max_found, 0);
+            const size_t n_found = bitset.find_fused(views.data(),
+                                                     n_others,
+                                                     program.data(),
+                                                     program.size(),
+                                                     found.data(),
+                                                     max_found);
+            ASSERT_EQ(n_found, std::min(max_found, expected_found.size()));
+            for (size_t i = 0; i < n_found; i++) {
+                ASSERT_EQ(found[i], expected_found[i]);
+            }
+        }
+
+        for (size_t i = 0; i < n; i++) {
+            ASSERT_EQ(bitset[i], ref[0][i]);
+        }
+
+        // evaluate
+        ASSERT_EQ(bitset.inplace_fused(
+                      views.data(), n_others, program.data(), program.size()),
+                  expected_found.size());
+
+        for (size_t i = 0; i < n; i++) {
+            ASSERT_EQ(bitset[i], expected[i]);
+        }
+    }
+}
+
+template <typename BitsetT>
+void
+TestFusedImpl() {
+    // and a size spanning several blocks of the fused ops
+    std::vector<size_t> sizes(std::begin(typical_sizes),
+                              std::end(typical_sizes));
+    sizes.push_back(10000);
+
+    for (const size_t n : sizes) {
+        BitsetT bitset(n);
+        bitset.reset();
+
+        std::vector<BitsetT> bitset_others;
+        for (size_t i = 0; i < 3; i++) {
+            BitsetT bitset_other(n);
+            bitset_other.reset();
+
+            bitset_others.push_back(std::move(bitset_other));
+        }
+
+        if (print_log) {
+            printf("Testing bitset, n=%zd\n", n);
+        }
+
+        TestFusedImpl(bitset, bitset_others);
+
+        for (const size_t offset : typical_offsets) {
+            if (offset + bitset_others.size() > n) {
+                continue;
+            }
+
+            // misalign the operands against each other
+            const size_t size = n - offset - bitset_others.size();
+
+            bitset.reset();
+            auto view = bitset.view(offset, size);
+
+            std::vector<typename BitsetT::view_type> view_others;
+            for (size_t i = 0; i < bitset_others.size(); i++) {
+                bitset_others[i].reset();
+                auto view_other = bitset_others[i].view(offset + i + 1, size);
+
+                view_others.push_back(std::move(view_other));
+            }
+
+            if (print_log) {
+                printf(
+                    "Testing bitset view, n=%zd, offset=%zd\n", n, offset);
+            }
+
+            TestFusedImpl(view, view_others);
+        }
+    }
+}
+
+//
+template <typename T>
+class FusedSuite : public ::testing::Test {};
+
+TYPED_TEST_SUITE_P(FusedSuite);
+
+TYPED_TEST_P(FusedSuite, BitWise) {
+    using impl_traits = RefImplTraits<std::tuple_element_t<0, TypeParam>,
+                                      std::tuple_element_t<1, TypeParam>>;
+    TestFusedImpl<typename impl_traits::bitset_type>();
+}
+
+TYPED_TEST_P(FusedSuite, ElementWise) {
+    using impl_traits = ElementImplTraits<std::tuple_element_t<0, TypeParam>,
+                                          std::tuple_element_t<1, TypeParam>>;
+    TestFusedImpl<typename impl_traits::bitset_type>();
+}
+
+TYPED_TEST_P(FusedSuite, Dynamic) {
+    using impl_traits =
+        VectorizedImplTraits<std::tuple_element_t<0, TypeParam>,
+                             std::tuple_element_t<1, TypeParam>,
+                             milvus::bitset::detail::VectorizedDynamic>;
+    TestFusedImpl<typename impl_traits::bitset_type>();
+}
+
+//
+REGISTER_TYPED_TEST_SUITE_P(FusedSuite, BitWise, ElementWise, Dynamic);
+
+INSTANTIATE_TYPED_TEST_SUITE_P(FusedTest, FusedSuite, Ttypes0);
+
+//////////////////////////////////////////////////////////////////////////////////////////
+
 //
 template <typename BitsetT>
 void
@@ -953,6 +953,96 @@ class BitsetBase {
             this->data(), other.data(), this->offset(), other.offset(), size);
     }
 
+    // Evaluates a fused program (see FusedOp) in a single pass over this
+    //   bitset, which is the operand 0, and the others, which are the
+    //   operands 1 to n_others. Stores the result into this bitset.
+    //   Also, counts the number of active bits.
+    template <bool R>
+    inline size_t
+    inplace_fused(const BitsetView<PolicyT, R>* const others,
+                  const size_t n_others,
+                  const FusedOp* const program,
+                  const size_t n_program,
+                  const size_t size) {
+        detail::MaybeVector<const data_type*> tmp_data(n_others + 1);
+        detail::MaybeVector<size_t> tmp_offset(n_others + 1);
+        this->fused_operands(
+            others, n_others, program, n_program, size, tmp_data, tmp_offset);
+
+        return policy_type::op_fused(this->data(),
+                                     this->offset(),
+                                     tmp_data.data(),
+                                     tmp_offset.data(),
+                                     program,
+                                     n_program,
+                                     size);
+    }
+
+    template <bool R>
+    inline size_t
+    inplace_fused(const BitsetView<PolicyT, R>* const others,
+                  const size_t n_others,
+                  const FusedOp* const program,
+                  const size_t n_program) {
+        return this->inplace_fused(
+            others, n_others, program, n_program, this->size());
+    }
+
+    // Counts the number of active bits of a fused program (see
+    //   inplace_fused()) without storing its result anywhere.
+    template <bool R>
+    inline size_t
+    count_fused(const BitsetView<PolicyT, R>* const others,
+                const size_t n_others,
+                const FusedOp* const program,
+                const size_t n_program) const {
+        detail::MaybeVector<const data_type*> tmp_data(n_others + 1);
+        detail::MaybeVector<size_t> tmp_offset(n_others + 1);
+        this->fused_operands(others,
+                             n_others,
+                             program,
+                             n_program,
+                             this->size(),
+                             tmp_data,
+                             tmp_offset);
+
+        return policy_type::op_fused_count(tmp_data.data(),
+                                           tmp_offset.data(),
+                                           program,
+                                           n_program,
+                                           this->size());
+    }
+
+    // Finds up to max_found first active bits of a fused program (see
+    //   inplace_fused()) without storing its result anywhere. Returns the
+    //   number of the found bits.
+    template <bool R>
+    inline size_t
+    find_fused(const BitsetView<PolicyT, R>* const others,
+               const size_t n_others,
+               const FusedOp* const program,
+               const size_t n_program,
+               size_t* const found,
+               const size_t max_found) const {
+        detail::MaybeVector<const data_type*> tmp_data(n_others + 1);
+        detail::MaybeVector<size_t> tmp_offset(n_others + 1);
+        this->fused_operands(others,
+                             n_others,
+                             program,
+                             n_program,
+                             this->size(),
+                             tmp_data,
+                             tmp_offset);
+
+        return policy_type::op_fused_find(tmp_data.data(),
+                                          tmp_offset.data(),
+                                          program,
+                                          n_program,
+                                          this->size(),
+                                          found,
+                                          max_found);
+    }
+
     // Return the starting bit offset in our container.
     inline size_t
     offset() const {
@@ -960,6 +1050,29 @@ class BitsetBase {
     }
 
  private:
+    template <bool R>
+    inline void
+    fused_operands(const BitsetView<PolicyT, R>* const others,
+                   const size_t n_others,
+                   const FusedOp* const program,
+                   const size_t n_program,
+                   const size_t size,
+                   detail::MaybeVector<const data_type*>& tmp_data,
+                   detail::MaybeVector<size_t>& tmp_offset) const {
+        range_checker::le(size, this->size());
+        range_checker::lt(
+            size_t(0), fused_program_depth(program, n_program, n_others + 1));
+
+        tmp_data[0] = this->data();
+        tmp_offset[0] = this->offset();
+        for (size_t i = 0; i < n_others; i++) {
+            range_checker::le(size, others[i].size());
+
+            tmp_data[i + 1] = others[i].data();
+            tmp_offset[i + 1] = others[i].offset();
+        }
+    }
+
     // CRTP
     inline ImplT&
     as_derived() {
@@ -1078,6 +1191,13 @@ class Bitset
                     : container_data_type(0)),
           Size{size} {
     }
+    // Take over a container holding at least the given number of bits,
+    //   the reverse of into().
+    Bitset(container_type&& data, const size_t size)
+        : Data(std::move(data)), Size{size} {
+        range_checker::le(get_required_size_in_container_elements(size),
+                          Data.size());
+    }
     // Do not allow implicit copies (Rust style).
     Bitset(const Bitset&) = delete;
     // Allow default move.
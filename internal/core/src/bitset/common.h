@@ -171,5 +171,57 @@ struct CompareOpDivFlip {
                                        : CmpOp;
 };
 
+// An instruction of a fused bitwise program, which combines several bitsets
+//   in a single pass over them. The program is in postfix order over a stack:
+//   LOAD pushes an operand, AND, OR and AND_NOT replace the two topmost
+//   entries a and b with a & b, a | b and a & ~b, and NOT inverts the topmost
+//   entry. A program must leave exactly one entry, which is the result.
+enum class FusedOpType { LOAD, AND, OR, AND_NOT, NOT };
+
+struct FusedOp {
+    FusedOpType type;
+    // the operand to push, for LOAD
+    uint8_t operand = 0;
+};
+
+// The deepest stack a fused program may use.
+constexpr size_t FUSED_MAX_DEPTH = 8;
+
+// Returns the depth of the stack the program uses, or 0 if the program is
+//   malformed or loads an operand past n_operands.
+inline size_t
+fused_program_depth(const FusedOp* const program,
+                    const size_t n_program,
+                    const size_t n_operands) {
+    size_t depth = 0;
+    size_t max_depth = 0;
+    for (size_t i = 0; i < n_program; i++) {
+        switch (program[i].type) {
+            case FusedOpType::LOAD:
+                if (program[i].operand >= n_operands) {
+                    return 0;
+                }
+                depth += 1;
+                break;
+            case FusedOpType::AND:
+            case FusedOpType::OR:
+            case FusedOpType::AND_NOT:
+                if (depth < 2) {
+                    return 0;
+                }
+                depth -= 1;
+                break;
+            case FusedOpType::NOT:
+                if (depth < 1) {
+                    return 0;
+                }
+                break;
+        }
+        max_depth = (depth > max_depth) ? depth : max_depth;
+    }
+
+    return (depth == 1 && max_depth <= FUSED_MAX_DEPTH) ? max_depth : 0;
+}
+
 }  // namespace bitset
 }  // namespace milvus
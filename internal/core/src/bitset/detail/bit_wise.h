@@ -22,6 +22,8 @@
 
 #include "proxy.h"
 
+#include "bitset/common.h"
+
 namespace milvus {
 namespace bitset {
 namespace detail {
@@ -444,6 +446,100 @@ struct BitWiseBitsetPolicy {
 
         return inactive;
     }
+
+    //
+    static inline size_t
+    op_fused(data_type* const dst,
+             const size_t start_dst,
+             const data_type* const* const operands,
+             const size_t* const __restrict start_operands,
+             const FusedOp* const program,
+             const size_t n_program,
+             const size_t size) {
+        size_t active = 0;
+        for (size_t i = 0; i < size; i++) {
+            const bool b = op_fused_eval(
+                operands, start_operands, program, n_program, i);
+            get_proxy(dst, start_dst + i) = b;
+
+            active += b ? 1 : 0;
+        }
+
+        return active;
+    }
+
+    static inline size_t
+    op_fused_count(const data_type* const* const operands,
+                   const size_t* const __restrict start_operands,
+                   const FusedOp* const program,
+                   const size_t n_program,
+                   const size_t size) {
+        size_t active = 0;
+        for (size_t i = 0; i < size; i++) {
+            active +=
+                op_fused_eval(operands, start_operands, program, n_program, i)
+                    ? 1
+                    : 0;
+        }
+
+        return active;
+    }
+
+    static inline size_t
+    op_fused_find(const data_type* const* const operands,
+                  const size_t* const __restrict start_operands,
+                  const FusedOp* const program,
+                  const size_t n_program,
+                  const size_t size,
+                  size_t* const __restrict found,
+                  const size_t max_found) {
+        size_t n_found = 0;
+        for (size_t i = 0; i < size && n_found < max_found; i++) {
+            if (op_fused_eval(
+                    operands, start_operands, program, n_program, i)) {
+                found[n_found++] = i;
+            }
+        }
+
+        return n_found;
+    }
+
+ private:
+    static inline bool
+    op_fused_eval(const data_type* const* const operands,
+                  const size_t* const __restrict start_operands,
+                  const FusedOp* const program,
+                  const size_t n_program,
+                  const size_t idx) {
+        bool stack[FUSED_MAX_DEPTH];
+        size_t depth = 0;
+        for (size_t p = 0; p < n_program; p++) {
+            const FusedOp op = program[p];
+            switch (op.type) {
+                case FusedOpType::LOAD:
+                    stack[depth++] = get_proxy(
+                        operands[op.operand], start_operands[op.operand] + idx);
+                    break;
+                case FusedOpType::AND:
+                    depth -= 1;
+                    stack[depth - 1] = stack[depth - 1] & stack[depth];
+                    break;
+                case FusedOpType::OR:
+                    depth -= 1;
+                    stack[depth - 1] = stack[depth - 1] | stack[depth];
+                    break;
+                case FusedOpType::AND_NOT:
+                    depth -= 1;
+                    stack[depth - 1] = stack[depth - 1] & !stack[depth];
+                    break;
+                case FusedOpType::NOT:
+                    stack[depth - 1] = !stack[depth - 1];
+                    break;
+            }
+        }
+
+        return stack[0];
+    }
 };
 
 }  // namespace detail
@@ -413,6 +413,46 @@ struct VectorizedElementWiseBitsetPolicy {
             left, right, start_left, start_right, size);
     }
 
+    //
+    static inline size_t
+    op_fused(data_type* const dst,
+             const size_t start_dst,
+             const data_type* const* const operands,
+             const size_t* const __restrict start_operands,
+             const FusedOp* const program,
+             const size_t n_program,
+             const size_t size) {
+        return ElementWiseBitsetPolicy<ElementT>::op_fused(
+            dst, start_dst, operands, start_operands, program, n_program, size);
+    }
+
+    static inline size_t
+    op_fused_count(const data_type* const* const operands,
+                   const size_t* const __restrict start_operands,
+                   const FusedOp* const program,
+                   const size_t n_program,
+                   const size_t size) {
+        return ElementWiseBitsetPolicy<ElementT>::op_fused_count(
+            operands, start_operands, program, n_program, size);
+    }
+
+    static inline size_t
+    op_fused_find(const data_type* const* const operands,
+                  const size_t* const __restrict start_operands,
+                  const FusedOp* const program,
+                  const size_t n_program,
+                  const size_t size,
+                  size_t* const __restrict found,
+                  const size_t max_found) {
+        return ElementWiseBitsetPolicy<ElementT>::op_fused_find(operands,
+                                                               start_operands,
+                                                               program,
+                                                               n_program,
+                                                               size,
+                                                               found,
+                                                               max_found);
+    }
+
     // void FuncBaseline(const size_t starting_bit, const size_t ptr_offset, const size_t nbits)
     // bool FuncVectorized(const size_t starting_element, const size_t ptr_offset, const size_t nbits)
     template <typename FuncBaseline, typename FuncVectorized>
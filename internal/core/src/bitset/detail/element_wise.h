@@ -1034,6 +1034,245 @@ struct ElementWiseBitsetPolicy {
         return inactive;
     }
 
+    // The number of elements the fused ops evaluate at once. Every stack
+    //   entry of a block stays in L1, so the operands are read only once.
+    static constexpr size_t fused_block_elements = 64;
+
+    //
+    static inline size_t
+    op_fused(data_type* const dst,
+             const size_t start_dst,
+             const data_type* const* const operands,
+             const size_t* const __restrict start_operands,
+             const FusedOp* const program,
+             const size_t n_program,
+             const size_t size) {
+        size_t active = 0;
+
+        op_fused_func(
+            operands,
+            start_operands,
+            program,
+            n_program,
+            size,
+            [dst, start_dst, &active](const data_type* const block,
+                                      const size_t start,
+                                      const size_t block_size) {
+                const size_t size_b = (block_size / data_bits) * data_bits;
+                if (((start_dst + start) % data_bits) == 0) {
+                    data_type* const dst_ptr =
+                        dst + (start_dst + start) / data_bits;
+                    for (size_t j = 0; j < size_b / data_bits; j++) {
+                        dst_ptr[j] = block[j];
+                    }
+                } else {
+                    for (size_t i = 0, j = 0; i < size_b;
+                         i += data_bits, j += 1) {
+                        op_write(
+                            dst, start_dst + start + i, data_bits, block[j]);
+                    }
+                }
+
+                for (size_t j = 0; j < size_b / data_bits; j++) {
+                    active += PopCountHelper<data_type>::count(block[j]);
+                }
+
+                if (size_b != block_size) {
+                    const data_type result_v = block[size_b / data_bits];
+                    op_write(dst,
+                             start_dst + start + size_b,
+                             block_size - size_b,
+                             result_v);
+                    active += PopCountHelper<data_type>::count(result_v);
+                }
+
+                return true;
+            });
+
+        return active;
+    }
+
+    static inline size_t
+    op_fused_count(const data_type* const* const operands,
+                   const size_t* const __restrict start_operands,
+                   const FusedOp* const program,
+                   const size_t n_program,
+                   const size_t size) {
+        size_t active = 0;
+
+        op_fused_func(operands,
+                      start_operands,
+                      program,
+                      n_program,
+                      size,
+                      [&active](const data_type* const block,
+                                const size_t,
+                                const size_t block_size) {
+                          const size_t n_elements =
+                              (block_size + data_bits - 1) / data_bits;
+                          for (size_t j = 0; j < n_elements; j++) {
+                              active +=
+                                  PopCountHelper<data_type>::count(block[j]);
+                          }
+
+                          return true;
+                      });
+
+        return active;
+    }
+
+    static inline size_t
+    op_fused_find(const data_type* const* const operands,
+                  const size_t* const __restrict start_operands,
+                  const FusedOp* const program,
+                  const size_t n_program,
+                  const size_t size,
+                  size_t* const __restrict found,
+                  const size_t max_found) {
+        size_t n_found = 0;
+        if (max_found == 0) {
+            return 0;
+        }
+
+        op_fused_func(operands,
+                      start_operands,
+                      program,
+                      n_program,
+                      size,
+                      [found, max_found, &n_found](const data_type* const block,
+                                                   const size_t start,
+                                                   const size_t block_size) {
+                          const size_t n_elements =
+                              (block_size + data_bits - 1) / data_bits;
+                          for (size_t j = 0; j < n_elements; j++) {
+                              data_type v = block[j];
+                              while (v != 0) {
+                                  const size_t ctz =
+                                      CtzHelper<data_type>::ctz(v);
+                                  found[n_found++] =
+                                      start + j * data_bits + ctz;
+                                  if (n_found == max_found) {
+                                      return false;
+                                  }
+
+                                  v &= (v - 1);
+                              }
+                          }
+
+                          return true;
+                      });
+
+        return n_found;
+    }
+
+    // bool Func(const data_type* const block, const size_t start,
+    //   const size_t block_size);
+    // Evaluates a fused program block by block and passes every result block,
+    //   which holds the bits [start, start + block_size), to func. The bits
+    //   past block_size in the last element are zero. Stops once func returns
+    //   false.
+    template <typename Func>
+    static BITSET_ALWAYS_INLINE inline void
+    op_fused_func(const data_type* const* const operands,
+                  const size_t* const __restrict start_operands,
+                  const FusedOp* const program,
+                  const size_t n_program,
+                  const size_t size,
+                  Func func) {
+        constexpr size_t block_bits = fused_block_elements * data_bits;
+        data_type stack[FUSED_MAX_DEPTH][fused_block_elements];
+
+        for (size_t start = 0; start < size; start += block_bits) {
+            const size_t block_size =
+                (size - start < block_bits) ? (size - start) : block_bits;
+            const size_t n_elements = (block_size + data_bits - 1) / data_bits;
+
+            // a compiler auto-vectorization is expected for the loops below
+            size_t depth = 0;
+            for (size_t p = 0; p < n_program; p++) {
+                const FusedOp op = program[p];
+                switch (op.type) {
+                    case FusedOpType::LOAD: {
+                        op_fused_load(operands[op.operand],
+                                      start_operands[op.operand] + start,
+                                      block_size,
+                                      stack[depth]);
+                        depth += 1;
+                        break;
+                    }
+                    case FusedOpType::AND: {
+                        depth -= 1;
+                        data_type* const __restrict a = stack[depth - 1];
+                        const data_type* const __restrict b = stack[depth];
+                        for (size_t j = 0; j < n_elements; j++) {
+                            a[j] &= b[j];
+                        }
+                        break;
+                    }
+                    case FusedOpType::OR: {
+                        depth -= 1;
+                        data_type* const __restrict a = stack[depth - 1];
+                        const data_type* const __restrict b = stack[depth];
+                        for (size_t j = 0; j < n_elements; j++) {
+                            a[j] |= b[j];
+                        }
+                        break;
+                    }
+                    case FusedOpType::AND_NOT: {
+                        depth -= 1;
+                        data_type* const __restrict a = stack[depth - 1];
+                        const data_type* const __restrict b = stack[depth];
+                        for (size_t j = 0; j < n_elements; j++) {
+                            a[j] &= ~b[j];
+                        }
+                        break;
+                    }
+                    case FusedOpType::NOT: {
+                        data_type* const __restrict a = stack[depth - 1];
+                        for (size_t j = 0; j < n_elements; j++) {
+                            a[j] = ~a[j];
+                        }
+                        break;
+                    }
+                }
+            }
+
+            // NOT sets the bits past the end of the last element
+            if ((block_size % data_bits) != 0) {
+                stack[0][n_elements - 1] &=
+                    get_shift_mask_begin(block_size % data_bits);
+            }
+
+            if (!func(stack[0], start, block_size)) {
+                return;
+            }
+        }
+    }
+
+    // Reads the bits [start, start + size) of src into the elements of dst.
+    static BITSET_ALWAYS_INLINE inline void
+    op_fused_load(const data_type* const src,
+                  const size_t start,
+                  const size_t size,
+                  data_type* const __restrict dst) {
+        const size_t size_b = (size / data_bits) * data_bits;
+        if ((start % data_bits) == 0) {
+            const data_type* const src_ptr = src + start / data_bits;
+            for (size_t j = 0; j < size_b / data_bits; j++) {
+                dst[j] = src_ptr[j];
+            }
+        } else {
+            for (size_t i = 0, j = 0; i < size_b; i += data_bits, j += 1) {
+                dst[j] = op_read(src, start + i, data_bits);
+            }
+        }
+
+        if (size_b != size) {
+            dst[size_b / data_bits] =
+                op_read(src, start + size_b, size - size_b);
+        }
+    }
+
     // data_type Func(const data_type left_v, const data_type right_v);
     template <typename Func>
     static BITSET_ALWAYS_INLINE inline void
@@ -97,6 +97,23 @@ namespace milvus {
 namespace bitset {
 namespace detail {
 
+// set by init_dynamic_hook()
+static const char* dynamic_implementation_name = "ref";
+
+const char*
+dynamic_implementation() {
+    return dynamic_implementation_name;
+}
+
+bool
+dynamic_implementation_limited_by_build() {
+#if defined(__aarch64__) && !defined(BITSET_ENABLE_SVE_SUPPORT)
+    return arm::InstructionSet::GetInstance().supports_sve();
+#else
+    return false;
+#endif
+}
+
 /////////////////////////////////////////////////////////////////////////////
 // op_compare_column
 
@@ -534,6 +551,7 @@ init_dynamic_hook() {
 #undef SET_ARITH_COMPARE_AVX512
 #undef SET_FORWARD_OPS_AVX512
 
+        dynamic_implementation_name = "avx512";
         return;
     }
 
@@ -616,6 +634,7 @@ init_dynamic_hook() {
 #undef SET_ARITH_COMPARE_AVX2
 #undef SET_FORWARD_OPS_AVX2
 
+        dynamic_implementation_name = "avx2";
         return;
     }
 #endif
@@ -701,6 +720,7 @@ init_dynamic_hook() {
 #undef SET_ARITH_COMPARE_SVE
 #undef SET_FORWARD_OPS_SVE
 
+        dynamic_implementation_name = "sve";
         return;
     }
 #endif
@@ -784,6 +804,7 @@ init_dynamic_hook() {
 #undef SET_ARITH_COMPARE_NEON
 #undef SET_FORWARD_OPS_NEON
 
+        dynamic_implementation_name = "neon";
         return;
     }
 
@@ -440,6 +440,17 @@ struct VectorizedDynamic {
     }
 };
 
+// The implementation VectorizedDynamic dispatches to, picked from the CPU
+// when the library is loaded: "avx512", "avx2", "sve", "neon" or "ref"
+// (no vectorized kernels, the element-wise code runs).
+const char*
+dynamic_implementation();
+
+// Whether the CPU supports a better implementation than the picked one
+// which this build left out, SVE without BITSET_ENABLE_SVE_SUPPORT.
+bool
+dynamic_implementation_limited_by_build();
+
 }  // namespace detail
 }  // namespace bitset
 }  // namespace milvus
\ No newline at end of file
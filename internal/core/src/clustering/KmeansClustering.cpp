@@ -21,6 +21,8 @@
 #include <atomic>
 #include <cstdint>
 #include <ctime>
+#include <deque>
+#include <future>
 #include <iosfwd>
 #include <numeric>
 #include <random>
@@ -45,6 +47,8 @@
 #include "log/Log.h"
 #include "nlohmann/json.hpp"
 #include "pb/schema.pb.h"
+#include "storage/ThreadPools.h"
+#include "storage/Util.h"
 
 namespace milvus::clustering {
 
@@ -276,48 +280,94 @@ KmeansClustering::StreamingAssignandUpload(
     LOG_INFO(msg_header_ + "start upload cluster id mapping file");
     std::vector<int64_t> num_vectors_each_centroid(num_clusters, 0);
 
+    // id mappings are uploaded on the MIDDLE pool while the next segment is
+    // assigned, each upload returns the file it wrote
+    auto& pool = ThreadPools::GetThreadPool(milvus::ThreadPoolPriority::MIDDLE);
+    std::vector<std::future<std::unordered_map<std::string, int64_t>>> uploads;
     auto serializeIdMappingAndUpload = [&](const int64_t segment_id,
                                            const milvus::proto::clustering::
                                                ClusteringCentroidIdMappingStats&
                                                    id_mapping_pb) {
         auto byte_size = id_mapping_pb.ByteSizeLong();
-        std::unique_ptr<uint8_t[]> data =
-            std::make_unique<uint8_t[]>(byte_size);
+        std::shared_ptr<uint8_t[]> data(new uint8_t[byte_size]);
         id_mapping_pb.SerializeToArray(data.get(), byte_size);
-        AddClusteringResultFiles(
-            file_manager_->GetChunkManager().get(),
-            data.get(),
-            byte_size,
-            GetRemoteCentroidIdMappingObjectPrefix(segment_id) + "/" +
-                std::string(OFFSET_MAPPING_NAME),
-            remote_paths_to_size);
-        LOG_INFO(
-            msg_header_ +
-                "upload segment {} cluster id mapping file with size {} B done",
-            segment_id,
-            byte_size);
+        uploads.emplace_back(pool.Submit([this, segment_id, data, byte_size]() {
+            std::unordered_map<std::string, int64_t> uploaded;
+            AddClusteringResultFiles(
+                file_manager_->GetChunkManager().get(),
+                data.get(),
+                byte_size,
+                GetRemoteCentroidIdMappingObjectPrefix(segment_id) + "/" +
+                    std::string(OFFSET_MAPPING_NAME),
+                uploaded);
+            LOG_INFO(msg_header_ +
+                         "upload segment {} cluster id mapping file with size "
+                         "{} B done",
+                     segment_id,
+                     byte_size);
+            return uploaded;
+        }));
     };
 
-    for (size_t i = 0; i < segment_ids.size(); i++) {
-        int64_t segment_id = segment_ids[i];
+    // raw data of the segments left to assign is downloaded ahead on its
+    // own threads, for as many segments as fit in the memory training
+    // used, so downloading overlaps the assignment of earlier segments
+    struct FetchingSegment {
+        int64_t segment_id;
+        int64_t byte_size;
+        std::future<std::unique_ptr<T[]>> data;
+    };
+    std::deque<FetchingSegment> fetching;
+    // raw data fetched or being fetched and not assigned yet
+    int64_t fetched_bytes = 0;
+    size_t next_fetch = trained_segments_num;
+    auto fetchAhead = [&]() {
+        for (; next_fetch < segment_ids.size(); next_fetch++) {
+            int64_t segment_id = segment_ids[next_fetch];
+            int64_t num_row = num_rows.at(segment_id);
+            int64_t byte_size = num_row * dim * sizeof(T);
+            // a segment larger than the budget is still fetched on its own
+            if (fetched_bytes > 0 &&
+                fetched_bytes + byte_size > config.train_size()) {
+                break;
+            }
+            auto data = std::async(
+                std::launch::async,
+                [this, &insert_files, segment_id, num_row, byte_size, dim]() {
+                    auto buf = std::make_unique<T[]>(num_row * dim);
+                    int64_t offset = 0;
+                    FetchDataFiles<T>(reinterpret_cast<uint8_t*>(buf.get()),
+                                      INT64_MAX,
+                                      byte_size,
+                                      insert_files.at(segment_id),
+                                      dim,
+                                      offset);
+                    return buf;
+                });
+            fetching.push_back({segment_id, byte_size, std::move(data)});
+            fetched_bytes += byte_size;
+        }
+    };
+
+    try {
         // id mapping has been computed, just upload to remote
-        if (i < trained_segments_num) {
-            serializeIdMappingAndUpload(segment_id, id_mapping_stats[i]);
+        for (size_t i = 0; i < trained_segments_num; i++) {
+            serializeIdMappingAndUpload(segment_ids[i], id_mapping_stats[i]);
             for (int64_t j = 0; j < num_clusters; ++j) {
                 num_vectors_each_centroid[j] +=
                     id_mapping_stats[i].num_in_centroid(j);
             }
-        } else {  // streaming download raw data, assign id mapping, then upload
-            int64_t num_row = num_rows.at(segment_id);
-            std::unique_ptr<T[]> buf = std::make_unique<T[]>(num_row * dim);
-            int64_t offset = 0;
-            FetchDataFiles<T>(reinterpret_cast<uint8_t*>(buf.get()),
-                              INT64_MAX,
-                              num_row * dim * sizeof(T),
-                              insert_files.at(segment_id),
-                              dim,
-                              offset);
-            auto dataset = GenDataset(num_row, dim, buf.release());
+        }
+        // streaming download raw data, assign id mapping, then upload
+        fetchAhead();
+        while (!fetching.empty()) {
+            auto segment = std::move(fetching.front());
+            fetching.pop_front();
+            auto buf = segment.data.get();
+            fetchAhead();
+
+            auto dataset = GenDataset(
+                num_rows.at(segment.segment_id), dim, buf.release());
             dataset->SetIsOwner(true);
             auto res = cluster_node.Assign(*dataset);
             if (!res.has_value()) {
@@ -327,17 +377,31 @@ KmeansClustering::StreamingAssignandUpload(
                                       res.what()));
             }
             res.value()->SetIsOwner(true);
+            dataset.reset();
+            fetched_bytes -= segment.byte_size;
             auto id_mapping =
                 reinterpret_cast<const uint32_t*>(res.value()->GetTensor());
 
             auto id_mapping_pb = CentroidIdMappingToPB(
-                id_mapping, {segment_id}, 1, num_rows, num_clusters)[0];
+                id_mapping, {segment.segment_id}, 1, num_rows, num_clusters)[0];
             for (int64_t j = 0; j < num_clusters; ++j) {
                 num_vectors_each_centroid[j] +=
                     id_mapping_pb.num_in_centroid(j);
             }
-            serializeIdMappingAndUpload(segment_id, id_mapping_pb);
+            serializeIdMappingAndUpload(segment.segment_id, id_mapping_pb);
         }
+    } catch (...) {
+        // the downloads and uploads in flight use this object
+        for (auto& segment : fetching) {
+            segment.data.wait();
+        }
+        for (auto& upload : uploads) {
+            upload.wait();
+        }
+        throw;
+    }
+    for (auto& uploaded : storage::WaitAllFutures(std::move(uploads))) {
+        remote_paths_to_size.insert(uploaded.begin(), uploaded.end());
     }
     if (IsDataSkew<T>(config, dim, num_vectors_each_centroid)) {
         LOG_INFO(msg_header_ + "data skew! skip clustering");
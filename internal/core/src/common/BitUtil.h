@@ -468,5 +468,30 @@ extractBits(T a, T mask) {
 #endif
 }
 #endif
+
+/// Return the bit index of the n-th (counting from zero) set bit of 'word';
+/// 'n' must be less than the number of set bits in 'word'.
+inline int32_t
+selectBit(uint64_t word, int32_t n) {
+#ifdef __BMI2__
+    return __builtin_ctzll(_pdep_u64(uint64_t{1} << n, word));
+#else
+    // narrow down to the byte holding the bit, then clear the lower ones
+    int32_t position = 0;
+    for (int32_t width = 32; width >= 8; width /= 2) {
+        const int32_t low =
+            __builtin_popcountll(word & ((uint64_t{1} << width) - 1));
+        if (n >= low) {
+            n -= low;
+            word >>= width;
+            position += width;
+        }
+    }
+    for (; n > 0; --n) {
+        word &= word - 1;
+    }
+    return position + __builtin_ctzll(word);
+#endif
+}
 }  // namespace bits
 }  // namespace milvus
\ No newline at end of file
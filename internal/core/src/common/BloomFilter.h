@@ -239,6 +239,136 @@ class BlockedBloomFilter : public BloomFilter {
     uint32_t k_;
 };
 
+// In-memory bloom filter that keeps all bits of a key in one 32-byte block,
+// so a probe costs one cache miss instead of BlockedBloomFilter's k misses
+// spread over the whole bit array. A key sets one bit in each of the eight
+// 32-bit words of its block (split block layout, as in Parquet), which turns
+// a probe into eight independent multiply-shift-test lanes that compile to a
+// single vector compare. Not serialized: the layout of BlockedBloomFilter is
+// fixed by the stats it is persisted in, this one is rebuilt on load.
+class SplitBlockBloomFilter {
+ public:
+    static constexpr uint32_t kWordsPerBlock = 8;
+    // probes BatchTestHashes looks ahead to prefetch their blocks
+    static constexpr size_t kPrefetchDistance = 16;
+
+    SplitBlockBloomFilter(uint64_t capacity, double fp)
+        : num_blocks_(NumBlocksFor(capacity, fp)) {
+        blocks_.resize(num_blocks_);
+    }
+
+    // memory_size() of a filter built with these arguments
+    static size_t
+    MemorySizeFor(uint64_t capacity, double fp) {
+        return NumBlocksFor(capacity, fp) * sizeof(Block);
+    }
+
+    static uint64_t
+    Hash(const void* data, size_t len) {
+        return XXH3_64bits(data, len);
+    }
+
+    static uint64_t
+    Hash(std::string_view data) {
+        return XXH3_64bits(data.data(), data.size());
+    }
+
+    void
+    Add(std::string_view data) {
+        AddHash(Hash(data));
+    }
+
+    bool
+    Test(std::string_view data) const {
+        return TestHash(Hash(data));
+    }
+
+    void
+    AddHash(uint64_t hash) {
+        auto& block = blocks_[BlockIndex(hash)];
+        auto key = static_cast<uint32_t>(hash);
+        for (uint32_t i = 0; i < kWordsPerBlock; ++i) {
+            block.words[i] |= Mask(key, i);
+        }
+    }
+
+    bool
+    TestHash(uint64_t hash) const {
+        const auto& block = blocks_[BlockIndex(hash)];
+        auto key = static_cast<uint32_t>(hash);
+        uint32_t missing = 0;
+        for (uint32_t i = 0; i < kWordsPerBlock; ++i) {
+            missing |= Mask(key, i) & ~block.words[i];
+        }
+        return missing == 0;
+    }
+
+    // Sets out[i] = TestHash(hashes[i]) and returns how many passed. Blocks
+    // are prefetched ahead so the misses of a batch overlap.
+    size_t
+    BatchTestHashes(const uint64_t* hashes, size_t n, bool* out) const {
+        size_t passed = 0;
+        for (size_t i = 0; i < n; ++i) {
+            if (i + kPrefetchDistance < n) {
+                __builtin_prefetch(
+                    &blocks_[BlockIndex(hashes[i + kPrefetchDistance])]);
+            }
+            out[i] = TestHash(hashes[i]);
+            passed += out[i];
+        }
+        return passed;
+    }
+
+    uint64_t
+    NumBlocks() const {
+        return num_blocks_;
+    }
+
+    size_t
+    memory_size() const {
+        return blocks_.size() * sizeof(Block);
+    }
+
+ private:
+    struct alignas(32) Block {
+        uint32_t words[kWordsPerBlock] = {};
+    };
+
+    static uint64_t
+    NumBlocksFor(uint64_t capacity, double fp) {
+        fp = std::clamp(fp, 1e-9, 0.5);
+        // 8 bits per key, one in each word: m = -8n / ln(1 - fp^(1/8))
+        auto n = static_cast<double>(std::max<uint64_t>(capacity, 1));
+        double m =
+            -8.0 * n / std::log(1.0 - std::pow(fp, 1.0 / kWordsPerBlock));
+        return std::max<uint64_t>(
+            1, static_cast<uint64_t>(std::ceil(m / (32 * kWordsPerBlock))));
+    }
+
+    uint64_t
+    BlockIndex(uint64_t hash) const {
+        // multiply-shift instead of modulo, the high half picks the block
+        return ((hash >> 32) * num_blocks_) >> 32;
+    }
+
+    static uint32_t
+    Mask(uint32_t key, uint32_t word) {
+        static constexpr uint32_t kSalt[kWordsPerBlock] = {0x47b6137bU,
+                                                           0x44974d91U,
+                                                           0x8824ad5bU,
+                                                           0xa2b7289dU,
+                                                           0x705495c7U,
+                                                           0x2df1424bU,
+                                                           0x9efc4947U,
+                                                           0x5c6bfb31U};
+        return 1U << ((key * kSalt[word]) >> 27);
+    }
+
+ private:
+    std::vector<Block> blocks_;
+    uint64_t num_blocks_;
+};
+
 class AlwaysTrueBloomFilter : public BloomFilter {
  public:
     BFType
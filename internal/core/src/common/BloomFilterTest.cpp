@@ -306,3 +306,64 @@ TEST(BloomFilterTest, LocationsConsistency) {
     auto locs3 = Locations(data3, 7, BFType::Blocked);
     EXPECT_NE(locs1, locs3);
 }
+
+TEST(BloomFilterTest, SplitBlockBF_NoFalseNegatives) {
+    SplitBlockBloomFilter bf(10000, 0.01);
+    for (int64_t i = 0; i < 10000; ++i) {
+        bf.AddHash(SplitBlockBloomFilter::Hash(&i, sizeof(i)));
+    }
+    for (int64_t i = 0; i < 10000; ++i) {
+        ASSERT_TRUE(bf.TestHash(SplitBlockBloomFilter::Hash(&i, sizeof(i))))
+            << "key " << i;
+    }
+
+    bf.Add("milvus");
+    EXPECT_TRUE(bf.Test("milvus"));
+}
+
+TEST(BloomFilterTest, SplitBlockBF_FalsePositiveRate) {
+    constexpr int64_t kKeys = 100000;
+    SplitBlockBloomFilter bf(kKeys, 0.01);
+    for (int64_t i = 0; i < kKeys; ++i) {
+        bf.AddHash(SplitBlockBloomFilter::Hash(&i, sizeof(i)));
+    }
+    int64_t false_positives = 0;
+    for (int64_t i = kKeys; i < 2 * kKeys; ++i) {
+        false_positives +=
+            bf.TestHash(SplitBlockBloomFilter::Hash(&i, sizeof(i)));
+    }
+    // blocking costs a little accuracy, stay well below twice the target
+    EXPECT_LT(false_positives, kKeys * 2 / 100);
+    EXPECT_EQ(bf.memory_size(),
+              SplitBlockBloomFilter::MemorySizeFor(kKeys, 0.01));
+    // ~10 bits per key
+    EXPECT_LT(bf.memory_size(), kKeys * 2);
+}
+
+TEST(BloomFilterTest, SplitBlockBF_BatchTestHashes) {
+    SplitBlockBloomFilter bf(1000, 0.01);
+    std::vector<uint64_t> hashes;
+    for (int64_t i = 0; i < 3000; ++i) {
+        auto hash = SplitBlockBloomFilter::Hash(&i, sizeof(i));
+        if (i % 3 == 0) {
+            bf.AddHash(hash);
+        }
+        hashes.push_back(hash);
+    }
+    auto passed = std::make_unique<bool[]>(hashes.size());
+    auto num_passed =
+        bf.BatchTestHashes(hashes.data(), hashes.size(), passed.get());
+    size_t expected_passed = 0;
+    for (size_t i = 0; i < hashes.size(); ++i) {
+        ASSERT_EQ(passed[i], bf.TestHash(hashes[i])) << "key " << i;
+        if (i % 3 == 0) {
+            ASSERT_TRUE(passed[i]) << "key " << i;
+        }
+        expected_passed += passed[i];
+    }
+    EXPECT_EQ(num_passed, expected_passed);
+
+    SplitBlockBloomFilter empty(0, 0.01);
+    EXPECT_EQ(empty.NumBlocks(), 1);
+    EXPECT_FALSE(empty.Test("milvus"));
+}
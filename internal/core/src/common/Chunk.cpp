@@ -44,7 +44,7 @@ StringChunk::StringViews(
     ret.reserve(len);
     auto end_offset = start_offset + len;
     for (auto i = start_offset; i < end_offset; i++) {
-        ret.emplace_back(data_ + offsets_[i], offsets_[i + 1] - offsets_[i]);
+        ret.emplace_back(ViewAt(i));
     }
     if (nullable_) {
         FixedVector<bool> res_valid(valid_.begin() + start_offset,
@@ -63,8 +63,7 @@ StringChunk::ViewsByOffsets(const FixedVector<int32_t>& offsets) {
     valid_res.reserve(size);
     for (auto i = 0; i < size; ++i) {
         auto idx = offsets[i];
-        auto start = offsets_[idx];
-        ret.emplace_back(data_ + start, offsets_[idx + 1] - start);
+        ret.emplace_back(ViewAt(idx));
         valid_res.emplace_back(isValid(idx));
     }
     return {ret, valid_res};
@@ -15,6 +15,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -66,6 +67,19 @@ class ChunkMmapGuard {
         return !file_path_.empty();
     }
 
+    // madvise the pages of [addr, addr + len) in the file-backed region.
+    // Only a hint: failures are ignored and anonymous regions are skipped.
+    void
+    Advise(const char* addr, size_t len, int advice) const {
+        if (!is_file_backed() || len == 0) {
+            return;
+        }
+        static const uintptr_t page_size = sysconf(_SC_PAGESIZE);
+        auto beg = reinterpret_cast<uintptr_t>(addr) & ~(page_size - 1);
+        auto end = reinterpret_cast<uintptr_t>(addr) + len;
+        madvise(reinterpret_cast<void*>(beg), end - beg, advice);
+    }
+
  private:
     char* mmap_ptr_;
     size_t mmap_size_;
@@ -88,7 +102,17 @@ class Chunk {
         if (nullable) {
             valid_.reserve(row_nums);
             for (int i = 0; i < row_nums; i++) {
-                valid_.push_back((data[i >> 3] >> (i & 0x07)) & 1);
+                bool valid = (data[i >> 3] >> (i & 0x07)) & 1;
+                valid_.push_back(valid);
+                null_count_ += valid ? 0 : 1;
+            }
+            if (null_count_ > 0) {
+                valid_bitmap_ = TargetBitmap(row_nums, true);
+                for (int i = 0; i < row_nums; i++) {
+                    if (!valid_[i]) {
+                        valid_bitmap_.reset(i);
+                    }
+                }
             }
         }
     }
@@ -103,10 +127,11 @@ class Chunk {
 
     cachinglayer::ResourceUsage
     CellByteSize() const {
+        auto size = static_cast<int64_t>(constant_ ? charged_size_ : size_);
         if (chunk_mmap_guard_ && chunk_mmap_guard_->is_file_backed()) {
-            return cachinglayer::ResourceUsage(0, static_cast<int64_t>(size_));
+            return cachinglayer::ResourceUsage(0, size);
         }
-        return cachinglayer::ResourceUsage(static_cast<int64_t>(size_), 0);
+        return cachinglayer::ResourceUsage(size, 0);
     }
 
     int64_t
@@ -114,6 +139,54 @@ class Chunk {
         return row_nums_;
     }
 
+    bool
+    IsNullable() const {
+        return nullable_;
+    }
+
+    int64_t
+    NullCount() const {
+        return null_count_;
+    }
+
+    // A nullable chunk may still have no null row, its validity then needs
+    // no handling at all.
+    bool
+    HasNulls() const {
+        return null_count_ > 0;
+    }
+
+    // Valid() as a bitmap, to be combined with filter results word by word.
+    // Only built when the chunk HasNulls().
+    const TargetBitmap&
+    ValidBitmap() const {
+        return valid_bitmap_;
+    }
+
+    // Whether every row holds the value, or the null, of the first row, as
+    // in the chunks of a field filled with its default value. Kernels may
+    // evaluate the first row for all of them.
+    bool
+    IsConstant() const {
+        return constant_;
+    }
+
+    // Constant chunks share their buffer with the other chunks of the
+    // field, a chunk charges its cell `charged_size` bytes of it.
+    void
+    MarkConstant(uint64_t charged_size) {
+        constant_ = true;
+        charged_size_ = charged_size;
+    }
+
+    // madvise the chunk memory if it is mapped from a file.
+    void
+    Advise(int advice) const {
+        if (chunk_mmap_guard_) {
+            chunk_mmap_guard_->Advise(data_, size_, advice);
+        }
+    }
+
     virtual const char*
     ValueAt(int64_t idx) const = 0;
 
@@ -188,14 +261,48 @@ class Chunk {
     int64_t row_nums_;
     uint64_t size_;
     bool nullable_;
+    bool constant_{false};
+    uint64_t charged_size_{0};
     FixedVector<bool>
         valid_;  // parse null bitmap to valid_ to be compatible with SpanBase
+    int64_t null_count_{0};
+    TargetBitmap valid_bitmap_;
 
     std::shared_ptr<ChunkMmapGuard> chunk_mmap_guard_{nullptr};
     mutable std::once_flag valid_rank_blocks_once_;
     mutable std::vector<int64_t> valid_rank_blocks_;
 };
 
+// Frame-of-reference bit-packed layout of an integer FixedWidthChunk, used instead of the raw values when it is
+// smaller:
+//
+// [null_bitmap][magic, num_blocks][blocks][packed_deltas][8 zero bytes]
+//
+// Rows are packed in blocks of PACKED_INT_BLOCK_ROWS. A block keeps its minimum and the bit width of its largest
+// delta from it, and each of its rows stores its delta in that many bits, so monotonic columns such as timestamps
+// pack as well as small ranged ones. The tail padding lets every delta be read with one unaligned 64-bit load.
+constexpr uint32_t PACKED_INT_MAGIC = 0x31544e50;  // "PNT1"
+constexpr int64_t PACKED_INT_BLOCK_ROWS = 128;
+constexpr uint32_t PACKED_INT_MAX_BITS = 56;
+constexpr size_t PACKED_INT_TAIL_PADDING = sizeof(uint64_t);
+
+// Value types a packed chunk decodes to.
+template <typename T>
+constexpr bool IsPackableInt =
+    std::is_same_v<T, int32_t> || std::is_same_v<T, int64_t>;
+
+struct PackedIntHeader {
+    uint32_t magic;
+    uint32_t num_blocks;
+};
+
+struct PackedIntBlock {
+    int64_t min;
+    // offset of the deltas from the start of packed_deltas
+    uint32_t offset;
+    uint32_t bits;
+};
+
 // for fixed size data, includes fixed size array
 class FixedWidthChunk : public Chunk {
  public:
@@ -205,36 +312,134 @@ class FixedWidthChunk : public Chunk {
                     uint64_t size,
                     uint64_t element_size,
                     bool nullable,
-                    std::shared_ptr<ChunkMmapGuard> chunk_mmap_guard)
+                    std::shared_ptr<ChunkMmapGuard> chunk_mmap_guard,
+                    bool packed = false)
         : Chunk(row_nums, data, size, nullable, chunk_mmap_guard),
           dim_(dim),
           element_size_(element_size) {
         auto null_bitmap_bytes_num = nullable_ ? (row_nums_ + 7) / 8 : 0;
         data_start_ = data_ + null_bitmap_bytes_num;
+        if (packed) {
+            auto header = reinterpret_cast<const PackedIntHeader*>(data_start_);
+            AssertInfo(header->magic == PACKED_INT_MAGIC &&
+                           dim_ == 1 &&
+                           (element_size_ == 4 || element_size_ == 8),
+                       "invalid packed int chunk");
+            packed_blocks_ =
+                reinterpret_cast<const PackedIntBlock*>(header + 1);
+            packed_deltas_ = reinterpret_cast<const char*>(packed_blocks_ +
+                                                           header->num_blocks);
+            data_start_ = nullptr;
+        }
     };
 
+    // Raw accesses of a packed chunk decode it once and keep the values.
     milvus::SpanBase
     Span() const {
-        return milvus::SpanBase(data_start_,
-                                nullable_ ? valid_.data() : nullptr,
+        return milvus::SpanBase(RawValues(),
+                                HasNulls() ? valid_.data() : nullptr,
                                 row_nums_,
                                 element_size_ * dim_);
     }
 
     const char*
     ValueAt(int64_t idx) const override {
-        return data_start_ + idx * element_size_ * dim_;
+        return RawValues() + idx * element_size_ * dim_;
     }
 
     const char*
     Data() const override {
-        return data_start_;
+        return RawValues();
+    }
+
+    bool
+    IsPacked() const {
+        return packed_blocks_ != nullptr;
+    }
+
+    // nullptr when no row is null, so that kernels skip the validity of
+    // the chunk
+    const bool*
+    ValidData() const {
+        return HasNulls() ? valid_.data() : nullptr;
+    }
+
+    const PackedIntBlock&
+    PackedBlock(int64_t block_id) const {
+        return packed_blocks_[block_id];
+    }
+
+    // Delta of row `idx` from the minimum of its block.
+    uint64_t
+    PackedDeltaAt(int64_t idx) const {
+        const auto& block = packed_blocks_[idx / PACKED_INT_BLOCK_ROWS];
+        auto bit = (idx % PACKED_INT_BLOCK_ROWS) * block.bits;
+        uint64_t word;
+        std::memcpy(&word, packed_deltas_ + block.offset + (bit >> 3), 8);
+        return (word >> (bit & 7)) & ((uint64_t{1} << block.bits) - 1);
+    }
+
+    int64_t
+    PackedValueAt(int64_t idx) const {
+        return packed_blocks_[idx / PACKED_INT_BLOCK_ROWS].min +
+               static_cast<int64_t>(PackedDeltaAt(idx));
+    }
+
+    // Decodes rows [start, start + n) of a packed chunk into `out`.
+    template <typename T>
+    void
+    DecodePacked(int64_t start, int64_t n, T* out) const {
+        int64_t end = start + n;
+        while (start < end) {
+            auto block_id = start / PACKED_INT_BLOCK_ROWS;
+            const auto& block = packed_blocks_[block_id];
+            auto block_end =
+                std::min(end, (block_id + 1) * PACKED_INT_BLOCK_ROWS);
+            const char* deltas = packed_deltas_ + block.offset;
+            uint64_t mask = (uint64_t{1} << block.bits) - 1;
+            uint64_t bit = (start % PACKED_INT_BLOCK_ROWS) * block.bits;
+            // fixed width within the block, no branch per row
+            for (int64_t i = start; i < block_end; ++i, bit += block.bits) {
+                uint64_t word;
+                std::memcpy(&word, deltas + (bit >> 3), 8);
+                *out++ = static_cast<T>(
+                    block.min +
+                    static_cast<int64_t>((word >> (bit & 7)) & mask));
+            }
+            start = block_end;
+        }
+    }
+
+    // DecodePacked into values of the chunk's element size.
+    void
+    DecodePacked(int64_t start, int64_t n, void* out) const {
+        if (element_size_ == 4) {
+            DecodePacked(start, n, static_cast<int32_t*>(out));
+        } else {
+            DecodePacked(start, n, static_cast<int64_t*>(out));
+        }
     }
 
  private:
+    const char*
+    RawValues() const {
+        if (packed_blocks_ == nullptr) {
+            return data_start_;
+        }
+        std::call_once(decoded_once_, [this]() {
+            decoded_ = std::make_unique<char[]>(row_nums_ * element_size_);
+            DecodePacked(0, row_nums_, static_cast<void*>(decoded_.get()));
+        });
+        return decoded_.get();
+    }
+
     int dim_;
     int element_size_;
     const char* data_start_;
+    const PackedIntBlock* packed_blocks_ = nullptr;
+    const char* packed_deltas_ = nullptr;
+    mutable std::once_flag decoded_once_;
+    mutable std::unique_ptr<char[]> decoded_;
 };
 // A StringChunk is a class that represents a collection of strings stored in a contiguous memory block.
 // It is initialized with the number of rows, a pointer to the data, the size of the data, and a boolean
@@ -257,6 +462,19 @@ class FixedWidthChunk : public Chunk {
 //
 // In this example, 'exampleChunk' is a StringChunk with 3 rows, a pointer to the data stored in 'dataPointer',
 // a total data size of 'dataSize', and it does not support nullability.
+//
+// Low-cardinality string columns may instead be dictionary encoded: every distinct value is stored once and
+// each row keeps the 1 or 2 byte code of its value:
+//
+// [null_bitmap][0, dict_size, code_bytes, 0][dict_offsets][codes][dict_data]
+// [] [0, 2, 1, 0] [31, 36, 42] [0, 1, 0] ["apple", "banana"]
+//
+// The leading 0 tells the two layouts apart, since the first offset of the plain layout always points past
+// the offsets. dict_offsets index the chunk like the plain offsets do. Null rows carry the code of "".
+
+// Codes are at most this wide, so a dictionary holds up to 65536 values.
+constexpr uint32_t STRING_DICT_MAX_CODE_BYTES = 2;
+constexpr uint32_t STRING_DICT_HEADER_BYTES = 4 * sizeof(uint32_t);
 
 class StringChunk : public Chunk {
  public:
@@ -269,6 +487,15 @@ class StringChunk : public Chunk {
         : Chunk(row_nums, data, size, nullable, chunk_mmap_guard) {
         auto null_bitmap_bytes_num = nullable_ ? (row_nums_ + 7) / 8 : 0;
         offsets_ = reinterpret_cast<uint32_t*>(data + null_bitmap_bytes_num);
+        if (offsets_[0] == 0) {
+            dict_size_ = offsets_[1];
+            code_bytes_ = offsets_[2];
+            AssertInfo(code_bytes_ == 1 || code_bytes_ == 2,
+                       "invalid string dictionary code width {}",
+                       code_bytes_);
+            offsets_ += STRING_DICT_HEADER_BYTES / sizeof(uint32_t);
+            codes_ = reinterpret_cast<const char*>(offsets_ + dict_size_ + 1);
+        }
     }
 
     std::string_view
@@ -279,8 +506,43 @@ class StringChunk : public Chunk {
                       i,
                       row_nums_);
         }
+        return ViewAt(i);
+    }
 
-        return {data_ + offsets_[i], offsets_[i + 1] - offsets_[i]};
+    bool
+    IsDictEncoded() const {
+        return codes_ != nullptr;
+    }
+
+    // Number of distinct values of a dictionary encoded chunk.
+    uint32_t
+    DictSize() const {
+        return dict_size_;
+    }
+
+    std::string_view
+    DictValue(uint32_t code) const {
+        return {data_ + offsets_[code], offsets_[code + 1] - offsets_[code]};
+    }
+
+    // 1 or 2, the width of Codes() entries.
+    uint32_t
+    CodeBytes() const {
+        return code_bytes_;
+    }
+
+    // Row codes of a dictionary encoded chunk, uint8_t or uint16_t each.
+    const void*
+    Codes() const {
+        return codes_;
+    }
+
+    uint32_t
+    CodeAt(int64_t i) const {
+        if (code_bytes_ == 1) {
+            return reinterpret_cast<const uint8_t*>(codes_)[i];
+        }
+        return reinterpret_cast<const uint16_t*>(codes_)[i];
     }
 
     std::pair<std::vector<std::string_view>, FixedVector<bool>>
@@ -354,13 +616,25 @@ class StringChunk : public Chunk {
         return (*this)[idx].data();
     }
 
+    // Offsets of the rows, or of the dictionary values if IsDictEncoded().
     uint32_t*
     Offsets() {
         return offsets_;
     }
 
  protected:
+    std::string_view
+    ViewAt(int64_t i) const {
+        if (codes_ != nullptr) {
+            return DictValue(CodeAt(i));
+        }
+        return {data_ + offsets_[i], offsets_[i + 1] - offsets_[i]};
+    }
+
     uint32_t* offsets_;
+    uint32_t dict_size_ = 0;
+    uint32_t code_bytes_ = 0;
+    const char* codes_ = nullptr;
 };
 
 using JSONChunk = StringChunk;
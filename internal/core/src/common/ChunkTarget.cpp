@@ -23,6 +23,31 @@
 
 const uint32_t SYS_PAGE_SIZE = sysconf(_SC_PAGE_SIZE);
 namespace milvus {
+MemChunkTarget::MemChunkTarget(size_t cap, bool populate) : cap_(cap) {
+    auto mmap_flag = MAP_PRIVATE | MAP_ANON;
+    // pages faulted in before MADV_HUGEPAGE would stay small
+    bool huge_page = ENABLE_CHUNK_HUGE_PAGE.load() && cap >= HUGE_PAGE_SIZE;
+    if (populate && !huge_page) {
+        mmap_flag |= MAP_POPULATE;
+    }
+    auto m = mmap(nullptr, cap, PROT_READ | PROT_WRITE, mmap_flag, -1, 0);
+    AssertInfo(m != MAP_FAILED,
+               "failed to map: {}, map_size={}",
+               strerror(errno),
+               cap);
+    data_ = reinterpret_cast<char*>(m);
+#ifdef MADV_HUGEPAGE
+    if (huge_page) {
+        madvise(m, cap, MADV_HUGEPAGE);
+#ifdef MADV_POPULATE_WRITE
+        if (populate) {
+            madvise(m, cap, MADV_POPULATE_WRITE);
+        }
+#endif
+    }
+#endif
+}
+
 void
 MemChunkTarget::write(const void* data, size_t size) {
     AssertInfo(size + size_ <= cap_, "can not exceed target capacity");
@@ -40,6 +65,14 @@ MemChunkTarget::tell() {
     return size_;
 }
 
+char*
+MemChunkTarget::claim(size_t size) {
+    AssertInfo(size + size_ <= cap_, "can not exceed target capacity");
+    auto data = data_ + size_;
+    size_ += size;
+    return data;
+}
+
 void
 MmapChunkTarget::flush() {
     if (cap_ > size_) {
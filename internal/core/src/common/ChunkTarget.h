@@ -21,6 +21,7 @@
 #include <cstddef>
 #include <string>
 #include <utility>
+#include "common/Common.h"
 #include "common/EasyAssert.h"
 #include "storage/FileWriter.h"
 
@@ -53,6 +54,17 @@ class ChunkTarget {
      */
     virtual size_t
     tell() = 0;
+
+    /**
+     * @brief claim the next `size` bytes of the target to be filled in place
+     * instead of with write(), and move the current position past them
+     * @return the claimed memory, nullptr if the target has no addressable
+     * memory, in which case the position is unchanged
+     */
+    virtual char*
+    claim(size_t size) {
+        return nullptr;
+    }
 };
 
 class MmapChunkTarget : public ChunkTarget {
@@ -88,18 +100,11 @@ class MmapChunkTarget : public ChunkTarget {
 
 class MemChunkTarget : public ChunkTarget {
  public:
-    explicit MemChunkTarget(size_t cap, bool populate = true) : cap_(cap) {
-        auto mmap_flag = MAP_PRIVATE | MAP_ANON;
-        if (populate) {
-            mmap_flag |= MAP_POPULATE;
-        }
-        auto m = mmap(nullptr, cap, PROT_READ | PROT_WRITE, mmap_flag, -1, 0);
-        AssertInfo(m != MAP_FAILED,
-                   "failed to map: {}, map_size={}",
-                   strerror(errno),
-                   size_);
-        data_ = reinterpret_cast<char*>(m);
-    }
+    // Chunks at least this large are backed by transparent huge pages when
+    // ENABLE_CHUNK_HUGE_PAGE is set.
+    static constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;  // 2MB
+
+    explicit MemChunkTarget(size_t cap, bool populate = true);
 
     void
     write(const void* data, size_t size) override;
@@ -110,6 +115,9 @@ class MemChunkTarget : public ChunkTarget {
     size_t
     tell() override;
 
+    char*
+    claim(size_t size) override;
+
  private:
     char* data_;  // no need to delete in destructor, will be deleted by Chunk
     size_t cap_;
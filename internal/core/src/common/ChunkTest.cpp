@@ -14,14 +14,19 @@
 #include <folly/FBVector.h>
 #include <gtest/gtest.h>
 #include <parquet/arrow/reader.h>
+#include <parquet/arrow/writer.h>
 #include <simdjson.h>
+#include <sys/mman.h>
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <initializer_list>
 #include <memory>
 #include <optional>
+#include <random>
 #include <string>
+#include <tuple>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
@@ -30,7 +35,9 @@
 #include "boost/filesystem/operations.hpp"
 #include "common/Array.h"
 #include "common/Chunk.h"
+#include "common/ChunkTarget.h"
 #include "common/ChunkWriter.h"
+#include "common/Common.h"
 #include "common/EasyAssert.h"
 #include "common/FieldDataInterface.h"
 #include "common/FieldMeta.h"
@@ -345,15 +352,13 @@ TEST(chunk, test_json_field) {
     }
 }
 
-TEST(chunk, test_null_int64) {
-    FixedVector<int64_t> data = {1, 2, 3, 4, 5};
+// a nullable INT64 chunk of up to 8 rows, bit i of `valid_bits` tells
+// whether row i is valid
+static std::unique_ptr<Chunk>
+CreateNullableInt64Chunk(FixedVector<int64_t>& data, uint8_t valid_bits) {
     auto field_data = milvus::storage::CreateFieldData(
         storage::DataType::INT64, DataType::NONE, true);
-
-    // Set up validity bitmap: 10011 (1st, 4th, and 5th are valid)
-    uint8_t* valid_data = new uint8_t[1]{0x13};  // 10011 in binary
-    field_data->FillFieldData(data.data(), valid_data, data.size(), 0);
-    delete[] valid_data;
+    field_data->FillFieldData(data.data(), &valid_bits, data.size(), 0);
 
     storage::InsertEventData event_data;
     auto payload_reader =
@@ -381,7 +386,13 @@ TEST(chunk, test_null_int64) {
                          true,
                          std::nullopt);
     arrow::ArrayVector array_vec = read_single_column_batches(rb_reader);
-    auto chunk = create_chunk(field_meta, array_vec);
+    return create_chunk(field_meta, array_vec);
+}
+
+TEST(chunk, test_null_int64) {
+    FixedVector<int64_t> data = {1, 2, 3, 4, 5};
+    // Set up validity bitmap: 10011 (1st, 4th, and 5th are valid)
+    auto chunk = CreateNullableInt64Chunk(data, 0x13);
     auto fixed_chunk = static_cast<FixedWidthChunk*>(chunk.get());
     auto span = fixed_chunk->Span();
     EXPECT_EQ(span.row_count(), data.size());
@@ -401,6 +412,30 @@ TEST(chunk, test_null_int64) {
             EXPECT_EQ(n, data[i]);
         }
     }
+
+    EXPECT_EQ(fixed_chunk->NullCount(), 2);
+    EXPECT_TRUE(fixed_chunk->HasNulls());
+    EXPECT_NE(span.valid_data(), nullptr);
+    const auto& valid_bitmap = fixed_chunk->ValidBitmap();
+    ASSERT_EQ(valid_bitmap.size(), data.size());
+    for (size_t i = 0; i < data.size(); ++i) {
+        EXPECT_EQ(valid_bitmap[i], fixed_chunk->isValid(i));
+    }
+}
+
+TEST(chunk, test_nullable_int64_without_nulls) {
+    FixedVector<int64_t> data = {1, 2, 3};
+    auto chunk = CreateNullableInt64Chunk(data, 0x07);
+    auto fixed_chunk = static_cast<FixedWidthChunk*>(chunk.get());
+    EXPECT_TRUE(fixed_chunk->IsNullable());
+    EXPECT_EQ(fixed_chunk->NullCount(), 0);
+    EXPECT_FALSE(fixed_chunk->HasNulls());
+    // kernels see the chunk as non-nullable
+    EXPECT_EQ(fixed_chunk->Span().valid_data(), nullptr);
+    EXPECT_EQ(fixed_chunk->ValidData(), nullptr);
+    for (size_t i = 0; i < data.size(); ++i) {
+        EXPECT_TRUE(fixed_chunk->isValid(i));
+    }
 }
 
 TEST(chunk, test_array) {
@@ -1377,4 +1412,486 @@ TEST(chunk, test_create_group_chunk_nullable_fields) {
             EXPECT_EQ(str_views[i], str_data[i]);
         }
     }
-}
\ No newline at end of file
+}
+namespace {
+
+// A single-column parquet binlog payload and a reader over it.
+struct ParquetPayload {
+    std::vector<uint8_t> ser_data;
+    std::unique_ptr<parquet::arrow::FileReader> arrow_reader;
+};
+
+std::unique_ptr<ParquetPayload>
+SerializeParquetPayload(const FieldDataPtr& field_data) {
+    auto payload = std::make_unique<ParquetPayload>();
+    storage::InsertEventData event_data;
+    event_data.payload_reader =
+        std::make_shared<milvus::storage::PayloadReader>(field_data);
+    payload->ser_data = event_data.Serialize();
+    auto buffer = std::make_shared<arrow::io::BufferReader>(
+        payload->ser_data.data() + 2 * sizeof(milvus::Timestamp),
+        payload->ser_data.size() - 2 * sizeof(milvus::Timestamp));
+    parquet::arrow::FileReaderBuilder reader_builder;
+    EXPECT_TRUE(reader_builder.Open(buffer).ok());
+    EXPECT_TRUE(reader_builder.Build(&payload->arrow_reader).ok());
+    return payload;
+}
+
+void
+ExpectSameFixedWidthChunk(Chunk* actual, Chunk* expected) {
+    auto actual_span = static_cast<FixedWidthChunk*>(actual)->Span();
+    auto expected_span = static_cast<FixedWidthChunk*>(expected)->Span();
+    ASSERT_EQ(actual_span.row_count(), expected_span.row_count());
+    ASSERT_EQ(actual_span.element_sizeof(), expected_span.element_sizeof());
+    EXPECT_EQ(std::memcmp(actual_span.data(),
+                          expected_span.data(),
+                          actual_span.row_count() *
+                              actual_span.element_sizeof()),
+              0);
+}
+
+}  // namespace
+
+TEST(chunk, test_create_chunk_from_parquet) {
+    FixedVector<int64_t> int64_data = {7, -1, 42, 0, 1LL << 40};
+    auto int64_field_data = milvus::storage::CreateFieldData(
+        storage::DataType::INT64, DataType::NONE);
+    int64_field_data->FillFieldData(int64_data.data(), int64_data.size());
+
+    constexpr int64_t dim = 4;
+    std::vector<float> vector_data(16 * dim);
+    for (size_t i = 0; i < vector_data.size(); ++i) {
+        vector_data[i] = i * 0.5f;
+    }
+    auto vector_field_data = milvus::storage::CreateFieldData(
+        storage::DataType::VECTOR_FLOAT, DataType::NONE, false, dim);
+    vector_field_data->FillFieldData(vector_data.data(), 16);
+
+    FieldMeta int64_meta(FieldName("a"),
+                         milvus::FieldId(1),
+                         DataType::INT64,
+                         false,
+                         std::nullopt);
+    FieldMeta vector_meta(FieldName("b"),
+                          milvus::FieldId(2),
+                          DataType::VECTOR_FLOAT,
+                          dim,
+                          knowhere::metric::L2,
+                          false,
+                          std::nullopt);
+    for (auto& [field_meta, field_data] :
+         std::vector<std::pair<FieldMeta, FieldDataPtr>>{
+             {int64_meta, int64_field_data},
+             {vector_meta, vector_field_data}}) {
+        auto payload = SerializeParquetPayload(field_data);
+        auto chunk = create_chunk_from_parquet(
+            field_meta, *payload->arrow_reader->parquet_reader());
+        ASSERT_NE(chunk, nullptr);
+
+        std::shared_ptr<::arrow::RecordBatchReader> rb_reader;
+        ASSERT_TRUE(payload->arrow_reader->GetRecordBatchReader(&rb_reader)
+                        .ok());
+        auto expected =
+            create_chunk(field_meta, read_single_column_batches(rb_reader));
+        ExpectSameFixedWidthChunk(chunk.get(), expected.get());
+    }
+
+    // nullable fields keep the arrow path for their validity bitmap
+    auto nullable_payload = SerializeParquetPayload(int64_field_data);
+    FieldMeta nullable_meta(FieldName("c"),
+                            milvus::FieldId(3),
+                            DataType::INT64,
+                            true,
+                            std::nullopt);
+    EXPECT_EQ(create_chunk_from_parquet(
+                  nullable_meta,
+                  *nullable_payload->arrow_reader->parquet_reader()),
+              nullptr);
+}
+
+TEST(chunk, test_create_chunk_from_parquet_row_groups) {
+    constexpr int64_t row_count = 10000;
+    arrow::Int32Builder builder;
+    for (int64_t i = 0; i < row_count; ++i) {
+        ASSERT_TRUE(builder.Append(static_cast<int32_t>(i * 3)).ok());
+    }
+    std::shared_ptr<arrow::Array> array;
+    ASSERT_TRUE(builder.Finish(&array).ok());
+    auto table = arrow::Table::Make(
+        arrow::schema({arrow::field("val", arrow::int32(), false)}), {array});
+
+    auto sink = arrow::io::BufferOutputStream::Create().ValueOrDie();
+    auto writer_props = parquet::WriterProperties::Builder()
+                            .compression(arrow::Compression::ZSTD)
+                            ->build();
+    ASSERT_TRUE(parquet::arrow::WriteTable(*table,
+                                           arrow::default_memory_pool(),
+                                           sink,
+                                           /*chunk_size=*/1024,
+                                           writer_props)
+                    .ok());
+    auto parquet_buffer = sink->Finish().ValueOrDie();
+
+    auto open = [&]() {
+        return parquet::ParquetFileReader::Open(
+            std::make_shared<arrow::io::BufferReader>(parquet_buffer));
+    };
+    ASSERT_GT(open()->metadata()->num_row_groups(), 1);
+
+    FieldMeta field_meta(FieldName("a"),
+                         milvus::FieldId(1),
+                         DataType::INT32,
+                         false,
+                         std::nullopt);
+    std::string mmap_file = TestLocalPath + "test_chunk_from_parquet.bin";
+    for (const auto& file_path : {std::string(), mmap_file}) {
+        auto reader = open();
+        auto chunk =
+            create_chunk_from_parquet(field_meta, *reader, true, file_path);
+        ASSERT_NE(chunk, nullptr);
+        auto span = static_cast<FixedWidthChunk*>(chunk.get())->Span();
+        ASSERT_EQ(span.row_count(), row_count);
+        auto values = static_cast<const int32_t*>(span.data());
+        for (int64_t i = 0; i < row_count; ++i) {
+            ASSERT_EQ(values[i], i * 3);
+        }
+    }
+    boost::filesystem::remove(mmap_file);
+
+    // INT16 is stored as parquet INT32, which is not the chunk layout
+    FieldMeta int16_meta(FieldName("b"),
+                         milvus::FieldId(2),
+                         DataType::INT16,
+                         false,
+                         std::nullopt);
+    EXPECT_EQ(create_chunk_from_parquet(int16_meta, *open()), nullptr);
+}
+
+TEST(chunk, test_create_variable_width_chunk_from_parquet) {
+    FixedVector<std::string> str_data = {"", "a", "bc", "", "def", "ghij"};
+    uint8_t valid_data[1] = {0x2d};  // 101101 in binary
+    auto nullable_field_data = milvus::storage::CreateFieldData(
+        storage::DataType::VARCHAR, DataType::NONE, true);
+    nullable_field_data->FillFieldData(
+        str_data.data(), valid_data, str_data.size(), 0);
+    auto str_field_data = milvus::storage::CreateFieldData(
+        storage::DataType::VARCHAR, DataType::NONE);
+    str_field_data->FillFieldData(str_data.data(), str_data.size());
+
+    FixedVector<Json> json_data;
+    for (int i = 0; i < 50; i++) {
+        auto json_str = fmt::format("{{\"key\": {}}}", i);
+        json_data.emplace_back(json_str.data(), json_str.size());
+    }
+    auto json_field_data = milvus::storage::CreateFieldData(
+        storage::DataType::JSON, DataType::NONE);
+    json_field_data->FillFieldData(json_data.data(), json_data.size());
+
+    std::vector<std::pair<FieldMeta, FieldDataPtr>> cases = {
+        {FieldMeta(FieldName("a"),
+                   milvus::FieldId(1),
+                   DataType::VARCHAR,
+                   64,
+                   true,
+                   std::nullopt),
+         nullable_field_data},
+        {FieldMeta(FieldName("b"),
+                   milvus::FieldId(2),
+                   DataType::VARCHAR,
+                   64,
+                   false,
+                   std::nullopt),
+         str_field_data},
+        {FieldMeta(FieldName("c"),
+                   milvus::FieldId(3),
+                   DataType::JSON,
+                   false,
+                   std::nullopt),
+         json_field_data}};
+    std::string mmap_file = TestLocalPath + "test_string_chunk_parquet.bin";
+    for (auto& [field_meta, field_data] : cases) {
+        for (const auto& file_path : {std::string(), mmap_file}) {
+            auto payload = SerializeParquetPayload(field_data);
+            auto chunk = create_chunk_from_parquet(
+                field_meta,
+                *payload->arrow_reader->parquet_reader(),
+                true,
+                file_path);
+            ASSERT_NE(chunk, nullptr);
+
+            // the streamed chunk is byte for byte the one of the arrow path
+            std::shared_ptr<::arrow::RecordBatchReader> rb_reader;
+            ASSERT_TRUE(
+                payload->arrow_reader->GetRecordBatchReader(&rb_reader).ok());
+            auto expected = create_chunk(
+                field_meta, read_single_column_batches(rb_reader));
+            ASSERT_EQ(chunk->RowNums(), expected->RowNums());
+            ASSERT_EQ(chunk->Size(), expected->Size());
+            EXPECT_EQ(std::memcmp(chunk->RawData(),
+                                  expected->RawData(),
+                                  chunk->Size()),
+                      0);
+        }
+    }
+    boost::filesystem::remove(mmap_file);
+
+    auto string_chunk = create_chunk_from_parquet(
+        cases[0].first,
+        *SerializeParquetPayload(nullable_field_data)
+             ->arrow_reader->parquet_reader());
+    auto views = static_cast<StringChunk*>(string_chunk.get())
+                     ->StringViews(std::nullopt);
+    for (size_t i = 0; i < str_data.size(); ++i) {
+        EXPECT_EQ(views.second[i], ((valid_data[0] >> i) & 1) != 0);
+        if (views.second[i]) {
+            EXPECT_EQ(views.first[i], str_data[i]);
+        }
+    }
+}
+
+TEST(chunk, test_dict_encoded_string_chunk) {
+    FieldMeta field_meta(FieldName("a"),
+                         milvus::FieldId(1),
+                         DataType::VARCHAR,
+                         64,
+                         true,
+                         std::nullopt);
+    // distinct values, rows, expected code width
+    for (auto [distinct, row_count, code_bytes] :
+         std::vector<std::tuple<int, int, uint32_t>>{
+             {5, 1000, 1}, {300, 4000, 2}}) {
+        FixedVector<std::string> data;
+        std::vector<uint8_t> valid_data((row_count + 7) / 8, 0);
+        for (int i = 0; i < row_count; ++i) {
+            bool valid = i % 7 != 0;
+            data.push_back(valid ? fmt::format("value-{}", i % distinct)
+                                 : std::string());
+            valid_data[i >> 3] |= valid << (i & 7);
+        }
+        auto field_data = milvus::storage::CreateFieldData(
+            storage::DataType::VARCHAR, DataType::NONE, true);
+        field_data->FillFieldData(
+            data.data(), valid_data.data(), data.size(), 0);
+
+        auto payload = SerializeParquetPayload(field_data);
+        std::shared_ptr<::arrow::RecordBatchReader> rb_reader;
+        ASSERT_TRUE(
+            payload->arrow_reader->GetRecordBatchReader(&rb_reader).ok());
+        auto chunk =
+            create_chunk(field_meta, read_single_column_batches(rb_reader));
+        auto string_chunk = static_cast<StringChunk*>(chunk.get());
+        ASSERT_TRUE(string_chunk->IsDictEncoded());
+        // the null rows add ""
+        EXPECT_EQ(string_chunk->DictSize(), distinct + 1);
+        EXPECT_EQ(string_chunk->CodeBytes(), code_bytes);
+
+        for (int i = 0; i < row_count; ++i) {
+            ASSERT_EQ(string_chunk->isValid(i), i % 7 != 0);
+            ASSERT_EQ((*string_chunk)[i], data[i]);
+            ASSERT_EQ(string_chunk->DictValue(string_chunk->CodeAt(i)),
+                      data[i]);
+        }
+        auto [views, valid] =
+            string_chunk->StringViews(std::make_pair(int64_t{3}, int64_t{10}));
+        ASSERT_EQ(views.size(), 10);
+        for (int i = 0; i < 10; ++i) {
+            EXPECT_EQ(views[i], data[3 + i]);
+            EXPECT_EQ(valid[i], (3 + i) % 7 != 0);
+        }
+        FixedVector<int32_t> offsets = {0, 8, row_count - 1};
+        auto [offset_views, offset_valid] =
+            string_chunk->ViewsByOffsets(offsets);
+        for (size_t i = 0; i < offsets.size(); ++i) {
+            EXPECT_EQ(offset_views[i], data[offsets[i]]);
+            EXPECT_EQ(offset_valid[i], offsets[i] % 7 != 0);
+        }
+
+        // streaming from parquet pages encodes the same chunk
+        auto streamed = create_chunk_from_parquet(
+            field_meta, *payload->arrow_reader->parquet_reader());
+        ASSERT_NE(streamed, nullptr);
+        ASSERT_EQ(streamed->Size(), chunk->Size());
+        EXPECT_EQ(
+            std::memcmp(streamed->RawData(), chunk->RawData(), chunk->Size()),
+            0);
+    }
+
+    // a distinct value every other row is not worth a dictionary
+    FixedVector<std::string> data;
+    for (int i = 0; i < 1000; ++i) {
+        data.push_back(fmt::format("value-{}", i / 2));
+    }
+    auto field_data = milvus::storage::CreateFieldData(
+        storage::DataType::VARCHAR, DataType::NONE);
+    field_data->FillFieldData(data.data(), data.size());
+    auto payload = SerializeParquetPayload(field_data);
+    std::shared_ptr<::arrow::RecordBatchReader> rb_reader;
+    ASSERT_TRUE(payload->arrow_reader->GetRecordBatchReader(&rb_reader).ok());
+    FieldMeta plain_meta(FieldName("b"),
+                         milvus::FieldId(2),
+                         DataType::VARCHAR,
+                         64,
+                         false,
+                         std::nullopt);
+    auto chunk =
+        create_chunk(plain_meta, read_single_column_batches(rb_reader));
+    auto string_chunk = static_cast<StringChunk*>(chunk.get());
+    EXPECT_FALSE(string_chunk->IsDictEncoded());
+    for (int i = 0; i < 1000; ++i) {
+        ASSERT_EQ((*string_chunk)[i], data[i]);
+    }
+}
+
+TEST(chunk, test_packed_int_chunk) {
+    auto make_chunk = [](const FieldMeta& field_meta,
+                         const std::vector<int64_t>& values,
+                         const std::string& file_path) {
+        auto row_count = static_cast<int64_t>(values.size());
+        bool nullable = field_meta.is_nullable();
+        auto field_data = milvus::storage::CreateFieldData(
+            field_meta.get_data_type(), DataType::NONE, nullable);
+        std::vector<uint8_t> valid_data((row_count + 7) / 8, 0);
+        for (int64_t i = 0; i < row_count; ++i) {
+            valid_data[i >> 3] |= (i % 5 != 0) << (i & 7);
+        }
+        std::vector<int32_t> narrowed(values.begin(), values.end());
+        const void* data = field_meta.get_data_type() == DataType::INT32
+                               ? static_cast<const void*>(narrowed.data())
+                               : static_cast<const void*>(values.data());
+        if (nullable) {
+            field_data->FillFieldData(data, valid_data.data(), row_count, 0);
+        } else {
+            field_data->FillFieldData(data, row_count);
+        }
+        auto payload = SerializeParquetPayload(field_data);
+        std::shared_ptr<::arrow::RecordBatchReader> rb_reader;
+        EXPECT_TRUE(
+            payload->arrow_reader->GetRecordBatchReader(&rb_reader).ok());
+        auto chunk = create_chunk(field_meta,
+                                  read_single_column_batches(rb_reader),
+                                  true,
+                                  file_path);
+        return pack_int_chunk(field_meta, std::move(chunk), true, file_path);
+    };
+
+    const int64_t row_count = 1000;
+    // monotonic timestamps and a small range
+    std::vector<int64_t> timestamps, small;
+    for (int64_t i = 0; i < row_count; ++i) {
+        timestamps.push_back(int64_t{1700000000000} + i * 1000 + i % 3);
+        small.push_back(-50 + (i * 37) % 200);
+    }
+    std::string mmap_file = TestLocalPath + "test_packed_int_chunk.bin";
+    for (const auto& file_path : {std::string(), mmap_file}) {
+        for (auto [data_type, nullable, values] :
+             std::vector<std::tuple<DataType, bool, std::vector<int64_t>>>{
+                 {DataType::INT64, false, timestamps},
+                 {DataType::INT64, true, timestamps},
+                 {DataType::INT32, true, small}}) {
+            FieldMeta field_meta(FieldName("a"),
+                                 milvus::FieldId(1),
+                                 data_type,
+                                 nullable,
+                                 std::nullopt);
+            auto chunk = make_chunk(field_meta, values, file_path);
+            auto fixed_chunk = static_cast<FixedWidthChunk*>(chunk.get());
+            ASSERT_TRUE(fixed_chunk->IsPacked());
+            auto element_size =
+                data_type == DataType::INT32 ? sizeof(int32_t) : 8;
+            EXPECT_LE(chunk->Size(), element_size * row_count * 3 / 4);
+
+            // the values of null rows are unspecified
+            auto is_valid = [&](int64_t i) { return !nullable || i % 5 != 0; };
+            for (int64_t i = 0; i < row_count; ++i) {
+                ASSERT_EQ(fixed_chunk->isValid(i), is_valid(i));
+                if (is_valid(i)) {
+                    ASSERT_EQ(fixed_chunk->PackedValueAt(i), values[i]);
+                }
+            }
+            // a range across block boundaries
+            std::vector<int64_t> decoded(300);
+            fixed_chunk->DecodePacked(100, 300, decoded.data());
+            for (int64_t i = 0; i < 300; ++i) {
+                if (is_valid(100 + i)) {
+                    ASSERT_EQ(decoded[i], values[100 + i]);
+                }
+            }
+
+            // raw accesses see the decoded values
+            auto span = fixed_chunk->Span();
+            ASSERT_EQ(span.row_count(), row_count);
+            for (int64_t i = 0; i < row_count; ++i) {
+                auto value =
+                    data_type == DataType::INT32
+                        ? static_cast<const int32_t*>(span.data())[i]
+                        : static_cast<const int64_t*>(span.data())[i];
+                if (is_valid(i)) {
+                    ASSERT_EQ(value, values[i]);
+                }
+            }
+        }
+    }
+    boost::filesystem::remove(mmap_file);
+
+    // a wide random range is not worth packing
+    std::vector<int64_t> wide;
+    std::mt19937_64 rng(42);
+    for (int64_t i = 0; i < row_count; ++i) {
+        wide.push_back(static_cast<int64_t>(rng()));
+    }
+    FieldMeta wide_meta(FieldName("b"),
+                        milvus::FieldId(2),
+                        DataType::INT64,
+                        false,
+                        std::nullopt);
+    auto chunk = make_chunk(wide_meta, wide, "");
+    auto fixed_chunk = static_cast<FixedWidthChunk*>(chunk.get());
+    EXPECT_FALSE(fixed_chunk->IsPacked());
+    for (int64_t i = 0; i < row_count; ++i) {
+        ASSERT_EQ(
+            *reinterpret_cast<const int64_t*>(fixed_chunk->ValueAt(i)),
+            wide[i]);
+    }
+}
+
+TEST(chunk, test_chunk_memory_advice) {
+    // huge page backed chunk memory
+    ENABLE_CHUNK_HUGE_PAGE.store(true);
+    size_t cap = 2 * MemChunkTarget::HUGE_PAGE_SIZE;
+    MemChunkTarget target(cap, true);
+    std::vector<int64_t> values(cap / sizeof(int64_t));
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = i * 7;
+    }
+    target.write(values.data(), cap);
+    auto data = target.release();
+    EXPECT_EQ(std::memcmp(data, values.data(), cap), 0);
+    munmap(data, cap);
+    ENABLE_CHUNK_HUGE_PAGE.store(false);
+
+    // access advice only hints the kernel, the data is unchanged
+    ENABLE_MMAP_ACCESS_ADVICE.store(true);
+    FieldMeta field_meta(FieldName("a"),
+                         milvus::FieldId(1),
+                         DataType::INT64,
+                         false,
+                         std::nullopt);
+    auto field_data = milvus::storage::CreateFieldData(storage::DataType::INT64,
+                                                       DataType::NONE);
+    field_data->FillFieldData(values.data(), 10000);
+    auto payload = SerializeParquetPayload(field_data);
+    std::shared_ptr<::arrow::RecordBatchReader> rb_reader;
+    ASSERT_TRUE(payload->arrow_reader->GetRecordBatchReader(&rb_reader).ok());
+    std::string mmap_file = TestLocalPath + "test_chunk_memory_advice.bin";
+    auto chunk = create_chunk(
+        field_meta, read_single_column_batches(rb_reader), false, mmap_file);
+    advise_chunk_access(field_meta, *chunk);
+    chunk->Advise(MADV_WILLNEED);
+    auto span = static_cast<FixedWidthChunk*>(chunk.get())->Span();
+    ASSERT_EQ(span.row_count(), 10000);
+    EXPECT_EQ(std::memcmp(span.data(), values.data(), 10000 * sizeof(int64_t)),
+              0);
+    ENABLE_MMAP_ACCESS_ADVICE.store(false);
+    chunk.reset();
+    EXPECT_FALSE(boost::filesystem::exists(mmap_file));
+}
@@ -11,9 +11,14 @@
 
 #include "common/ChunkWriter.h"
 
+#include <algorithm>
+#include <bit>
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <memory>
+#include <optional>
+#include <string_view>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -23,8 +28,12 @@
 #include "arrow/array/array_nested.h"
 #include "arrow/record_batch.h"
 #include "arrow/result.h"
+#include "parquet/column_reader.h"
+#include "parquet/metadata.h"
+#include "parquet/schema.h"
 #include "common/Array.h"
 #include "common/Chunk.h"
+#include "common/Common.h"
 #include "common/EasyAssert.h"
 #include "common/FieldMeta.h"
 #include "common/Types.h"
@@ -37,6 +46,92 @@
 
 namespace milvus {
 
+StringDictionaryBuilder::StringDictionaryBuilder(int64_t row_nums,
+                                                 size_t null_bitmap_bytes)
+    : row_nums_(row_nums),
+      null_bitmap_bytes_(null_bitmap_bytes),
+      max_values_(std::min<size_t>(
+          row_nums / kMinRowsPerValue,
+          std::numeric_limits<uint16_t>::max() + size_t{1})) {
+    codes_.reserve(row_nums);
+}
+
+void
+StringDictionaryBuilder::Add(std::string_view value) {
+    if (failed_) {
+        return;
+    }
+    auto it = codes_by_value_.find(value);
+    if (it == codes_by_value_.end()) {
+        if (values_.size() == max_values_) {
+            failed_ = true;
+            values_ = std::deque<std::string>();
+            codes_by_value_ = std::unordered_map<std::string_view, uint16_t>();
+            codes_ = std::vector<uint16_t>();
+            return;
+        }
+        const auto& owned = values_.emplace_back(value);
+        it = codes_by_value_.emplace(owned, values_.size() - 1).first;
+        value_bytes_ += value.size();
+    }
+    codes_.push_back(it->second);
+}
+
+std::optional<size_t>
+StringDictionaryBuilder::encoded_size(size_t plain_size) const {
+    if (failed_ || row_nums_ == 0) {
+        return std::nullopt;
+    }
+    AssertInfo(static_cast<int64_t>(codes_.size()) == row_nums_,
+               "string dictionary got {} of {} rows",
+               codes_.size(),
+               row_nums_);
+    size_t size = null_bitmap_bytes_ + STRING_DICT_HEADER_BYTES +
+                  sizeof(uint32_t) * (values_.size() + 1) +
+                  code_bytes() * row_nums_ + value_bytes_ +
+                  MMAP_STRING_PADDING;
+    if (size >= plain_size ||
+        size > std::numeric_limits<uint32_t>::max()) {
+        return std::nullopt;
+    }
+    return size;
+}
+
+void
+StringDictionaryBuilder::write_to_target(
+    const std::shared_ptr<ChunkTarget>& target) const {
+    // layout after the null bitmap: header, dict offsets[size+1], codes,
+    // dict values, padding
+    uint32_t header[STRING_DICT_HEADER_BYTES / sizeof(uint32_t)] = {
+        0, static_cast<uint32_t>(values_.size()), code_bytes(), 0};
+    target->write(header, sizeof(header));
+
+    std::vector<uint32_t> offsets;
+    offsets.reserve(values_.size() + 1);
+    size_t cursor = null_bitmap_bytes_ + sizeof(header) +
+                    sizeof(uint32_t) * (values_.size() + 1) +
+                    code_bytes() * row_nums_;
+    for (const auto& value : values_) {
+        offsets.push_back(static_cast<uint32_t>(cursor));
+        cursor += value.size();
+    }
+    offsets.push_back(static_cast<uint32_t>(cursor));
+    target->write(offsets.data(), offsets.size() * sizeof(uint32_t));
+
+    if (code_bytes() == 1) {
+        std::vector<uint8_t> narrow(codes_.begin(), codes_.end());
+        target->write(narrow.data(), narrow.size());
+    } else {
+        target->write(codes_.data(), codes_.size() * sizeof(uint16_t));
+    }
+    for (const auto& value : values_) {
+        target->write(value.data(), value.size());
+    }
+
+    char padding[MMAP_STRING_PADDING] = {};
+    target->write(padding, MMAP_STRING_PADDING);
+}
+
 std::pair<size_t, size_t>
 StringChunkWriter::calculate_size(const arrow::ArrayVector& array_vec) {
     // Single pass over Arrow: compute row count, absolute offsets, total
@@ -53,6 +148,7 @@ StringChunkWriter::calculate_size(const arrow::ArrayVector& array_vec) {
 
     offsets_.clear();
     offsets_.reserve(offset_num);
+    StringDictionaryBuilder dictionary(row_nums_, null_bitmap_bytes);
     for (const auto& data : array_vec) {
         auto array = std::dynamic_pointer_cast<arrow::BinaryArray>(data);
         AssertInfo(array != nullptr,
@@ -60,18 +156,26 @@ StringChunkWriter::calculate_size(const arrow::ArrayVector& array_vec) {
                    "type id {}; upstream normalizer must coerce to BINARY",
                    data ? static_cast<int>(data->type_id()) : -1);
         for (int i = 0; i < array->length(); i++) {
+            auto str = array->GetView(i);
             offsets_.push_back(static_cast<uint32_t>(cursor));
-            cursor += array->GetView(i).size();
+            cursor += str.size();
+            dictionary.Add(str);
         }
     }
+
+    size_t size = cursor + MMAP_STRING_PADDING;
+    dictionary_.reset();
+    if (auto encoded_size = dictionary.encoded_size(size)) {
+        dictionary_.emplace(std::move(dictionary));
+        offsets_ = std::vector<uint32_t>();
+        return {*encoded_size, row_nums_};
+    }
     // String chunk uses uint32 offsets on disk; reject oversize chunks loudly
     // rather than silently wrapping.
     AssertInfo(cursor <= std::numeric_limits<uint32_t>::max(),
                "string chunk size {} exceeds uint32 offset limit",
                cursor);
     offsets_.push_back(static_cast<uint32_t>(cursor));
-
-    size_t size = cursor + MMAP_STRING_PADDING;
     return {size, row_nums_};
 }
 
@@ -89,6 +193,12 @@ StringChunkWriter::write_to_target(const arrow::ArrayVector& array_vec,
         write_null_bit_maps(null_bitmaps, target);
     }
 
+    if (dictionary_.has_value()) {
+        dictionary_->write_to_target(target);
+        dictionary_.reset();
+        return;
+    }
+
     target->write(offsets_.data(), offsets_.size() * sizeof(uint32_t));
 
     for (const auto& data : array_vec) {
@@ -788,6 +898,365 @@ make_chunk(const FieldMeta& field_meta,
     }
 }
 
+static inline std::shared_ptr<ChunkTarget>
+create_chunk_target(size_t size,
+                    bool mmap_populate,
+                    const std::string& file_path,
+                    proto::common::LoadPriority load_priority) {
+    size_t aligned_size = (size + ChunkTarget::ALIGNED_SIZE - 1) &
+                          ~(ChunkTarget::ALIGNED_SIZE - 1);
+    if (file_path.empty()) {
+        return std::make_shared<MemChunkTarget>(aligned_size, mmap_populate);
+    }
+    auto io_prio = storage::io::GetPriorityFromLoadPriority(load_priority);
+    return std::make_shared<MmapChunkTarget>(
+        file_path, mmap_populate, aligned_size, io_prio);
+}
+
+// Bytes per row of the columns create_chunk_from_parquet decodes in place:
+// non-nullable fixed-width fields whose parquet physical type holds exactly
+// the chunk layout. 0 for any other column.
+static inline int64_t
+parquet_fixed_width_row_bytes(const FieldMeta& field_meta,
+                              const parquet::ColumnDescriptor& column) {
+    if (field_meta.is_nullable() || column.max_definition_level() != 0 ||
+        column.max_repetition_level() != 0) {
+        return 0;
+    }
+    auto physical_type = column.physical_type();
+    switch (field_meta.get_data_type()) {
+        case DataType::BOOL:
+            return physical_type == parquet::Type::BOOLEAN ? sizeof(bool) : 0;
+        case DataType::INT32:
+            return physical_type == parquet::Type::INT32 ? sizeof(int32_t) : 0;
+        case DataType::INT64:
+        case DataType::TIMESTAMPTZ:
+            return physical_type == parquet::Type::INT64 ? sizeof(int64_t) : 0;
+        case DataType::FLOAT:
+            return physical_type == parquet::Type::FLOAT ? sizeof(float) : 0;
+        case DataType::DOUBLE:
+            return physical_type == parquet::Type::DOUBLE ? sizeof(double) : 0;
+        case DataType::VECTOR_FLOAT:
+        case DataType::VECTOR_BINARY:
+        case DataType::VECTOR_FLOAT16:
+        case DataType::VECTOR_BFLOAT16:
+        case DataType::VECTOR_INT8: {
+            auto row_bytes = static_cast<int64_t>(field_meta.get_sizeof());
+            return physical_type == parquet::Type::FIXED_LEN_BYTE_ARRAY &&
+                           column.type_length() == row_bytes
+                       ? row_bytes
+                       : 0;
+        }
+        default:
+            return 0;
+    }
+}
+
+template <typename DType>
+static inline void
+decode_parquet_values(parquet::ColumnReader* column_reader,
+                      int64_t num_rows,
+                      char* dst) {
+    using T = typename DType::c_type;
+    auto reader =
+        static_cast<parquet::TypedColumnReader<DType>*>(column_reader);
+    auto values = reinterpret_cast<T*>(dst);
+    int64_t decoded = 0;
+    while (decoded < num_rows) {
+        int64_t values_read = 0;
+        reader->ReadBatch(num_rows - decoded,
+                          nullptr,
+                          nullptr,
+                          values + decoded,
+                          &values_read);
+        AssertInfo(values_read > 0,
+                   "parquet column ended after {} of {} rows",
+                   decoded,
+                   num_rows);
+        decoded += values_read;
+    }
+}
+
+static inline void
+decode_parquet_fixed_len_values(parquet::ColumnReader* column_reader,
+                                int64_t num_rows,
+                                int64_t row_bytes,
+                                char* dst,
+                                std::vector<parquet::FixedLenByteArray>& refs) {
+    auto reader = static_cast<parquet::FixedLenByteArrayReader*>(column_reader);
+    refs.resize(num_rows);
+    int64_t decoded = 0;
+    while (decoded < num_rows) {
+        int64_t values_read = 0;
+        reader->ReadBatch(
+            num_rows - decoded, nullptr, nullptr, refs.data(), &values_read);
+        AssertInfo(values_read > 0,
+                   "parquet column ended after {} of {} rows",
+                   decoded,
+                   num_rows);
+        // the values point into the current page, which holds them back to
+        // back when plain encoded: copy them in runs before the next page
+        int64_t run_begin = 0;
+        for (int64_t i = 1; i <= values_read; ++i) {
+            if (i < values_read &&
+                refs[i].ptr == refs[i - 1].ptr + row_bytes) {
+                continue;
+            }
+            auto run_bytes = (i - run_begin) * row_bytes;
+            std::memcpy(dst, refs[run_begin].ptr, run_bytes);
+            dst += run_bytes;
+            run_begin = i;
+        }
+        decoded += values_read;
+    }
+}
+
+// Padding after the values of the string, JSON and geometry layouts, which
+// create_chunk_from_parquet streams from BYTE_ARRAY columns. nullopt for any
+// other column.
+static inline std::optional<size_t>
+parquet_variable_width_padding(const FieldMeta& field_meta,
+                               const parquet::ColumnDescriptor& column) {
+    if (column.physical_type() != parquet::Type::BYTE_ARRAY ||
+        column.max_repetition_level() != 0) {
+        return std::nullopt;
+    }
+    switch (field_meta.get_data_type()) {
+        case DataType::VARCHAR:
+        case DataType::STRING:
+        case DataType::TEXT:
+            return MMAP_STRING_PADDING;
+        case DataType::JSON:
+            return simdjson::SIMDJSON_PADDING;
+        case DataType::GEOMETRY:
+            return MMAP_GEOMETRY_PADDING;
+        default:
+            return std::nullopt;
+    }
+}
+
+// Calls visit(value, valid) for every row of the BYTE_ARRAY column 0 of
+// `file_reader` in order, with an empty value for a null row. The values
+// point into the current page and are only valid during the call.
+template <typename Visitor>
+static inline void
+visit_parquet_byte_arrays(parquet::ParquetFileReader& file_reader,
+                          Visitor&& visit) {
+    static constexpr int64_t kBatchRows = 64 * 1024;
+    auto metadata = file_reader.metadata();
+    auto max_def_level = metadata->schema()->Column(0)->max_definition_level();
+    std::vector<int16_t> def_levels(max_def_level > 0 ? kBatchRows : 0);
+    std::vector<parquet::ByteArray> values(kBatchRows);
+    for (int rg = 0; rg < metadata->num_row_groups(); ++rg) {
+        auto column_reader = file_reader.RowGroup(rg)->Column(0);
+        auto reader =
+            static_cast<parquet::ByteArrayReader*>(column_reader.get());
+        while (reader->HasNext()) {
+            int64_t values_read = 0;
+            auto levels_read = reader->ReadBatch(
+                kBatchRows,
+                max_def_level > 0 ? def_levels.data() : nullptr,
+                nullptr,
+                values.data(),
+                &values_read);
+            int64_t value = 0;
+            for (int64_t i = 0; i < levels_read; ++i) {
+                if (max_def_level == 0 || def_levels[i] == max_def_level) {
+                    const auto& v = values[value++];
+                    visit(std::string_view(
+                              reinterpret_cast<const char*>(v.ptr), v.len),
+                          true);
+                } else {
+                    visit(std::string_view(), false);
+                }
+            }
+        }
+    }
+}
+
+// Streams a string, JSON or geometry chunk out of `file_reader` in two
+// passes over its pages: the first one collects the offsets and validity,
+// which sizes the target, the second one copies the values into it. Only
+// one page of the column is decoded at a time. A string chunk that turns
+// out dictionary encoded is written from its dictionary instead of a
+// second pass.
+static inline std::unique_ptr<Chunk>
+create_variable_width_chunk_from_parquet(
+    const FieldMeta& field_meta,
+    parquet::ParquetFileReader& file_reader,
+    size_t padding,
+    bool mmap_populate,
+    const std::string& file_path,
+    proto::common::LoadPriority load_priority) {
+    // chunk layout: null bitmap, offsets[num_rows+1], values, padding
+    auto num_rows = file_reader.metadata()->num_rows();
+    bool nullable = field_meta.is_nullable();
+    std::vector<uint8_t> null_bitmap(nullable ? (num_rows + 7) / 8 : 0, 0);
+    std::vector<uint32_t> offsets;
+    offsets.reserve(num_rows + 1);
+    size_t cursor = null_bitmap.size() + sizeof(uint32_t) * (num_rows + 1);
+    std::optional<StringDictionaryBuilder> dictionary;
+    if (IsStringDataType(field_meta.get_data_type())) {
+        dictionary.emplace(num_rows, null_bitmap.size());
+    }
+    visit_parquet_byte_arrays(
+        file_reader, [&](std::string_view value, bool valid) {
+            auto row = static_cast<int64_t>(offsets.size());
+            AssertInfo(row < num_rows,
+                       "parquet column has more rows than its {}",
+                       num_rows);
+            if (nullable && valid) {
+                null_bitmap[row >> 3] |= 1 << (row & 7);
+            }
+            offsets.push_back(static_cast<uint32_t>(cursor));
+            cursor += value.size();
+            if (dictionary.has_value()) {
+                dictionary->Add(value);
+            }
+        });
+    AssertInfo(static_cast<int64_t>(offsets.size()) == num_rows,
+               "decoded {} rows of a parquet file of {} rows",
+               offsets.size(),
+               num_rows);
+
+    size_t size = cursor + padding;
+    std::optional<size_t> encoded_size;
+    if (dictionary.has_value()) {
+        encoded_size = dictionary->encoded_size(size);
+    }
+    if (encoded_size.has_value()) {
+        size = *encoded_size;
+        offsets = std::vector<uint32_t>();
+        auto target =
+            create_chunk_target(size, mmap_populate, file_path, load_priority);
+        target->write(null_bitmap.data(), null_bitmap.size());
+        dictionary->write_to_target(target);
+        auto data = target->release();
+        auto chunk_mmap_guard =
+            std::make_shared<ChunkMmapGuard>(data, size, file_path);
+        return make_chunk(field_meta, num_rows, data, size, chunk_mmap_guard);
+    }
+    dictionary.reset();
+    AssertInfo(cursor <= std::numeric_limits<uint32_t>::max(),
+               "variable-width chunk size {} exceeds uint32 offset limit",
+               cursor);
+    offsets.push_back(static_cast<uint32_t>(cursor));
+
+    auto target =
+        create_chunk_target(size, mmap_populate, file_path, load_priority);
+    target->write(null_bitmap.data(), null_bitmap.size());
+    target->write(offsets.data(), offsets.size() * sizeof(uint32_t));
+    offsets = std::vector<uint32_t>();
+    visit_parquet_byte_arrays(file_reader,
+                              [&](std::string_view value, bool valid) {
+                                  target->write(value.data(), value.size());
+                              });
+    AssertInfo(target->tell() == cursor,
+               "parquet column changed between passes, {} vs {} bytes",
+               target->tell(),
+               cursor);
+    std::vector<char> zeros(padding, 0);
+    target->write(zeros.data(), zeros.size());
+
+    auto data = target->release();
+    auto chunk_mmap_guard =
+        std::make_shared<ChunkMmapGuard>(data, size, file_path);
+    return make_chunk(field_meta, num_rows, data, size, chunk_mmap_guard);
+}
+
+std::unique_ptr<Chunk>
+create_chunk_from_parquet(const FieldMeta& field_meta,
+                          parquet::ParquetFileReader& file_reader,
+                          bool mmap_populate,
+                          const std::string& file_path,
+                          proto::common::LoadPriority load_priority) {
+    // decoded rows per step, bounds the staging memory of mmap targets
+    static constexpr int64_t kDecodeBatchBytes = 4 << 20;
+
+    auto metadata = file_reader.metadata();
+    if (metadata->num_columns() != 1 || metadata->num_rows() == 0) {
+        return nullptr;
+    }
+    auto column = metadata->schema()->Column(0);
+    auto padding = parquet_variable_width_padding(field_meta, *column);
+    if (padding.has_value()) {
+        return create_variable_width_chunk_from_parquet(field_meta,
+                                                        file_reader,
+                                                        *padding,
+                                                        mmap_populate,
+                                                        file_path,
+                                                        load_priority);
+    }
+    auto row_bytes = parquet_fixed_width_row_bytes(field_meta, *column);
+    if (row_bytes == 0) {
+        return nullptr;
+    }
+
+    auto num_rows = metadata->num_rows();
+    size_t size = num_rows * row_bytes;
+    auto target =
+        create_chunk_target(size, mmap_populate, file_path, load_priority);
+    auto batch_rows = std::max<int64_t>(1, kDecodeBatchBytes / row_bytes);
+    std::vector<char> staging;
+    std::vector<parquet::FixedLenByteArray> refs;
+    int64_t rows_decoded = 0;
+    for (int rg = 0; rg < metadata->num_row_groups(); ++rg) {
+        auto row_group = file_reader.RowGroup(rg);
+        auto column_reader = row_group->Column(0);
+        auto rows_left = row_group->metadata()->num_rows();
+        while (rows_left > 0) {
+            auto rows = std::min(rows_left, batch_rows);
+            auto bytes = rows * row_bytes;
+            auto dst = target->claim(bytes);
+            bool in_place = dst != nullptr;
+            if (!in_place) {
+                staging.resize(bytes);
+                dst = staging.data();
+            }
+            switch (column->physical_type()) {
+                case parquet::Type::BOOLEAN:
+                    decode_parquet_values<parquet::BooleanType>(
+                        column_reader.get(), rows, dst);
+                    break;
+                case parquet::Type::INT32:
+                    decode_parquet_values<parquet::Int32Type>(
+                        column_reader.get(), rows, dst);
+                    break;
+                case parquet::Type::INT64:
+                    decode_parquet_values<parquet::Int64Type>(
+                        column_reader.get(), rows, dst);
+                    break;
+                case parquet::Type::FLOAT:
+                    decode_parquet_values<parquet::FloatType>(
+                        column_reader.get(), rows, dst);
+                    break;
+                case parquet::Type::DOUBLE:
+                    decode_parquet_values<parquet::DoubleType>(
+                        column_reader.get(), rows, dst);
+                    break;
+                default:
+                    decode_parquet_fixed_len_values(
+                        column_reader.get(), rows, row_bytes, dst, refs);
+                    break;
+            }
+            if (!in_place) {
+                target->write(dst, bytes);
+            }
+            rows_left -= rows;
+            rows_decoded += rows;
+        }
+    }
+    AssertInfo(rows_decoded == num_rows,
+               "decoded {} rows of a parquet file of {} rows",
+               rows_decoded,
+               num_rows);
+
+    auto data = target->release();
+    auto chunk_mmap_guard =
+        std::make_shared<ChunkMmapGuard>(data, size, file_path);
+    return make_chunk(field_meta, num_rows, data, size, chunk_mmap_guard);
+}
+
 ChunkBuffer
 create_chunk_buffer(const FieldMeta& field_meta,
                     const arrow::ArrayVector& array_vec,
@@ -796,16 +1265,8 @@ create_chunk_buffer(const FieldMeta& field_meta,
                     proto::common::LoadPriority load_priority) {
     auto cw = create_chunk_writer(field_meta);
     auto [size, row_nums] = cw->calculate_size(array_vec);
-    size_t aligned_size = (size + ChunkTarget::ALIGNED_SIZE - 1) &
-                          ~(ChunkTarget::ALIGNED_SIZE - 1);
-    std::shared_ptr<ChunkTarget> target;
-    if (file_path.empty()) {
-        target = std::make_shared<MemChunkTarget>(aligned_size, mmap_populate);
-    } else {
-        auto io_prio = storage::io::GetPriorityFromLoadPriority(load_priority);
-        target = std::make_shared<MmapChunkTarget>(
-            file_path, mmap_populate, aligned_size, io_prio);
-    }
+    auto target =
+        create_chunk_target(size, mmap_populate, file_path, load_priority);
     cw->write_to_target(array_vec, target);
     auto data = target->release();
     std::shared_ptr<ChunkMmapGuard> chunk_mmap_guard = nullptr;
@@ -844,6 +1305,148 @@ create_chunk(const FieldMeta& field_meta,
     return make_chunk_from_buffer(field_meta, buffer, 0);
 }
 
+std::unique_ptr<Chunk>
+create_chunk(const FieldMeta& field_meta,
+             const ArrowDataWrapper& data,
+             bool mmap_populate,
+             const std::string& file_path,
+             proto::common::LoadPriority load_priority) {
+    if (data.arrow_reader != nullptr) {
+        auto chunk =
+            create_chunk_from_parquet(field_meta,
+                                      *data.arrow_reader->parquet_reader(),
+                                      mmap_populate,
+                                      file_path,
+                                      load_priority);
+        if (chunk != nullptr) {
+            return chunk;
+        }
+    }
+    auto array_vec = read_single_column_batches(data.reader);
+    return create_chunk(
+        field_meta, array_vec, mmap_populate, file_path, load_priority);
+}
+
+// Packs `values` in the layout after the null bitmap of a packed
+// FixedWidthChunk. Returns an empty vector if a block needs more than
+// PACKED_INT_MAX_BITS bits.
+template <typename T>
+static std::vector<char>
+encode_packed_ints(const T* values, int64_t num_rows) {
+    auto num_blocks =
+        (num_rows + PACKED_INT_BLOCK_ROWS - 1) / PACKED_INT_BLOCK_ROWS;
+    std::vector<PackedIntBlock> blocks(num_blocks);
+    size_t deltas_bytes = 0;
+    for (int64_t b = 0; b < num_blocks; ++b) {
+        auto begin = values + b * PACKED_INT_BLOCK_ROWS;
+        auto end = values + std::min(num_rows, (b + 1) * PACKED_INT_BLOCK_ROWS);
+        auto [min, max] = std::minmax_element(begin, end);
+        auto range = static_cast<uint64_t>(static_cast<int64_t>(*max) -
+                                           static_cast<int64_t>(*min));
+        auto bits = static_cast<uint32_t>(std::bit_width(range));
+        if (bits > PACKED_INT_MAX_BITS) {
+            return {};
+        }
+        blocks[b] = {static_cast<int64_t>(*min),
+                     static_cast<uint32_t>(deltas_bytes),
+                     bits};
+        deltas_bytes += ((end - begin) * bits + 7) / 8;
+    }
+
+    size_t head_bytes =
+        sizeof(PackedIntHeader) + sizeof(PackedIntBlock) * num_blocks;
+    std::vector<char> packed(
+        head_bytes + deltas_bytes + PACKED_INT_TAIL_PADDING, 0);
+    PackedIntHeader header{PACKED_INT_MAGIC, static_cast<uint32_t>(num_blocks)};
+    std::memcpy(packed.data(), &header, sizeof(header));
+    std::memcpy(packed.data() + sizeof(header),
+                blocks.data(),
+                sizeof(PackedIntBlock) * num_blocks);
+    char* deltas = packed.data() + head_bytes;
+    for (int64_t i = 0; i < num_rows; ++i) {
+        const auto& block = blocks[i / PACKED_INT_BLOCK_ROWS];
+        auto delta = static_cast<uint64_t>(static_cast<int64_t>(values[i]) -
+                                           block.min);
+        uint64_t bit = (i % PACKED_INT_BLOCK_ROWS) * block.bits;
+        char* dst = deltas + block.offset + (bit >> 3);
+        uint64_t word;
+        std::memcpy(&word, dst, sizeof(word));
+        word |= delta << (bit & 7);
+        std::memcpy(dst, &word, sizeof(word));
+    }
+    return packed;
+}
+
+std::unique_ptr<Chunk>
+pack_int_chunk(const FieldMeta& field_meta,
+               std::unique_ptr<Chunk> chunk,
+               bool mmap_populate,
+               const std::string& file_path,
+               proto::common::LoadPriority load_priority) {
+    size_t element_size;
+    switch (field_meta.get_data_type()) {
+        case DataType::INT32:
+            element_size = sizeof(int32_t);
+            break;
+        case DataType::INT64:
+        case DataType::TIMESTAMPTZ:
+            element_size = sizeof(int64_t);
+            break;
+        default:
+            return chunk;
+    }
+    auto num_rows = chunk->RowNums();
+    if (num_rows == 0) {
+        return chunk;
+    }
+    auto raw = static_cast<FixedWidthChunk*>(chunk.get());
+    AssertInfo(!raw->IsPacked(), "int chunk is already packed");
+    auto packed =
+        element_size == sizeof(int32_t)
+            ? encode_packed_ints(
+                  reinterpret_cast<const int32_t*>(raw->Data()), num_rows)
+            : encode_packed_ints(
+                  reinterpret_cast<const int64_t*>(raw->Data()), num_rows);
+    size_t raw_bytes = element_size * num_rows;
+    if (packed.empty() || packed.size() > raw_bytes * 3 / 4) {
+        return chunk;
+    }
+
+    bool nullable = field_meta.is_nullable();
+    size_t null_bitmap_bytes = nullable ? (num_rows + 7) / 8 : 0;
+    std::vector<char> null_bitmap(chunk->RawData(),
+                                  chunk->RawData() + null_bitmap_bytes);
+    // drops the raw chunk and its file before the packed one takes the path
+    chunk.reset();
+
+    size_t size = null_bitmap_bytes + packed.size();
+    auto target =
+        create_chunk_target(size, mmap_populate, file_path, load_priority);
+    target->write(null_bitmap.data(), null_bitmap.size());
+    target->write(packed.data(), packed.size());
+    auto data = target->release();
+    auto chunk_mmap_guard =
+        std::make_shared<ChunkMmapGuard>(data, size, file_path);
+    return std::make_unique<FixedWidthChunk>(num_rows,
+                                             1,
+                                             data,
+                                             size,
+                                             element_size,
+                                             nullable,
+                                             chunk_mmap_guard,
+                                             /*packed=*/true);
+}
+
+void
+advise_chunk_access(const FieldMeta& field_meta, const Chunk& chunk) {
+    if (!ENABLE_MMAP_ACCESS_ADVICE.load()) {
+        return;
+    }
+    chunk.Advise(IsVectorDataType(field_meta.get_data_type())
+                     ? MADV_RANDOM
+                     : MADV_SEQUENTIAL);
+}
+
 std::unordered_map<FieldId, std::shared_ptr<Chunk>>
 create_group_chunk(const std::vector<FieldId>& field_ids,
                    const std::vector<FieldMeta>& field_metas,
@@ -13,7 +13,9 @@
 #include <simdjson.h>
 #include <cstddef>
 #include <cstdint>
+#include <deque>
 #include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <tuple>
@@ -27,12 +29,14 @@
 #include "arrow/buffer.h"
 #include "arrow/record_batch.h"
 #include "bitset/detail/element_wise.h"
+#include "common/ArrowDataWrapper.h"
 #include "common/Chunk.h"
 #include "common/ChunkTarget.h"
 #include "common/EasyAssert.h"
 #include "common/FieldMeta.h"
 #include "common/Json.h"
 #include "common/Types.h"
+#include "parquet/file_reader.h"
 #include "pb/common.pb.h"
 
 namespace milvus {
@@ -218,6 +222,47 @@ ChunkWriter<arrow::BooleanArray, bool>::write_to_target(
     }
 }
 
+// Collects the distinct values of a string chunk while it is sized, and
+// writes the dictionary layout of StringChunk when that layout is worth it:
+// the column has few enough distinct values for 2 byte codes, at most one
+// per kMinRowsPerValue rows, and the encoded chunk is smaller than the plain
+// one. Gives up, dropping what it collected, as soon as there are too many.
+class StringDictionaryBuilder {
+ public:
+    static constexpr int64_t kMinRowsPerValue = 4;
+
+    StringDictionaryBuilder(int64_t row_nums, size_t null_bitmap_bytes);
+
+    // Null rows are added with an empty value.
+    void
+    Add(std::string_view value);
+
+    // Size of the dictionary encoded chunk, nullopt if the plain layout of
+    // `plain_size` bytes should be used instead.
+    std::optional<size_t>
+    encoded_size(size_t plain_size) const;
+
+    // Writes the chunk after its null bitmap.
+    void
+    write_to_target(const std::shared_ptr<ChunkTarget>& target) const;
+
+ private:
+    uint32_t
+    code_bytes() const {
+        return values_.size() <= 256 ? 1 : STRING_DICT_MAX_CODE_BYTES;
+    }
+
+    int64_t row_nums_;
+    size_t null_bitmap_bytes_;
+    size_t max_values_;
+    bool failed_ = false;
+    size_t value_bytes_ = 0;
+    // values_ owns the strings the keys of codes_by_value_ point to
+    std::deque<std::string> values_;
+    std::unordered_map<std::string_view, uint16_t> codes_by_value_;
+    std::vector<uint16_t> codes_;
+};
+
 class StringChunkWriter : public ChunkWriterBase {
  public:
     using ChunkWriterBase::ChunkWriterBase;
@@ -235,6 +280,8 @@ class StringChunkWriter : public ChunkWriterBase {
     // calculate_size, consumed in write_to_target to avoid a second pass over
     // Arrow for sizing.
     std::vector<uint32_t> offsets_;
+    // Set by calculate_size when the chunk is dictionary encoded.
+    std::optional<StringDictionaryBuilder> dictionary_;
 };
 
 class JSONChunkWriter : public ChunkWriterBase {
@@ -362,6 +409,54 @@ create_chunk(const FieldMeta& field_meta,
              proto::common::LoadPriority load_priority =
                  proto::common::LoadPriority::HIGH);
 
+// Create the Chunk of a field from the pages of the single-column parquet
+// file `file_reader`, without the Arrow arrays create_chunk takes:
+// - non-nullable fixed-width fields (BOOL, INT32, INT64, FLOAT, DOUBLE,
+//   TIMESTAMPTZ and the dense vectors) are decoded straight into the chunk
+//   memory;
+// - string, JSON and geometry fields are streamed in two passes over the
+//   pages, one for the offsets and one for the values, so only the chunk and
+//   one page are in memory at a time.
+// Returns nullptr, reading nothing, for any other field or file layout.
+std::unique_ptr<Chunk>
+create_chunk_from_parquet(const FieldMeta& field_meta,
+                          parquet::ParquetFileReader& file_reader,
+                          bool mmap_populate = true,
+                          const std::string& file_path = "",
+                          proto::common::LoadPriority load_priority =
+                              proto::common::LoadPriority::HIGH);
+
+// Create the Chunk of the binlog read by `data`: in place from its parquet
+// pages where create_chunk_from_parquet applies, from the batches of its
+// record batch reader otherwise.
+std::unique_ptr<Chunk>
+create_chunk(const FieldMeta& field_meta,
+             const ArrowDataWrapper& data,
+             bool mmap_populate = true,
+             const std::string& file_path = "",
+             proto::common::LoadPriority load_priority =
+                 proto::common::LoadPriority::HIGH);
+
+// Re-encode an INT32, INT64 or TIMESTAMPTZ chunk made by create_chunk in
+// the bit-packed layout of FixedWidthChunk, writing it to `file_path` in
+// place of the raw chunk if one is given. Returns `chunk` unchanged for any
+// other field or when packing would not save at least a quarter of the
+// values' bytes.
+std::unique_ptr<Chunk>
+pack_int_chunk(const FieldMeta& field_meta,
+               std::unique_ptr<Chunk> chunk,
+               bool mmap_populate = true,
+               const std::string& file_path = "",
+               proto::common::LoadPriority load_priority =
+                   proto::common::LoadPriority::HIGH);
+
+// Tell the kernel how the file-backed `chunk` of `field_meta` is read once
+// loaded, if mmap access advice is enabled: the rows of a vector chunk are
+// gathered one by one, so it gets no read-ahead, while a scalar chunk is
+// scanned by filters and gets aggressive read-ahead.
+void
+advise_chunk_access(const FieldMeta& field_meta, const Chunk& chunk);
+
 std::unordered_map<FieldId, std::shared_ptr<Chunk>>
 create_group_chunk(const std::vector<FieldId>& field_ids,
                    const std::vector<FieldMeta>& field_metas,
@@ -17,6 +17,7 @@
 #include "common/Common.h"
 
 #include <string.h>
+#include <mutex>
 
 #include "common/Consts.h"
 #include "gflags/gflags.h"
@@ -28,9 +29,31 @@
 namespace milvus {
 
 std::atomic<int64_t> FILE_SLICE_SIZE(DEFAULT_INDEX_FILE_SLICE_SIZE);
+std::atomic<int64_t> INDEX_BUILD_MEMORY_BUDGET(
+    DEFAULT_INDEX_BUILD_MEMORY_BUDGET);
+std::atomic<int64_t> DISKANN_NODE_CACHE_BUDGET(
+    DEFAULT_DISKANN_NODE_CACHE_BUDGET);
+std::atomic<int64_t> SCALAR_INDEX_BUILD_PARALLELISM(
+    DEFAULT_SCALAR_INDEX_BUILD_PARALLELISM);
 std::atomic<int64_t> EXEC_EVAL_EXPR_BATCH_SIZE(
     DEFAULT_EXEC_EVAL_EXPR_BATCH_SIZE);
+std::atomic<int64_t> EXEC_FILTER_MORSEL_PARALLELISM(
+    DEFAULT_EXEC_FILTER_MORSEL_PARALLELISM);
+std::atomic<int64_t> EXEC_FILTER_MORSEL_ROWS(DEFAULT_EXEC_FILTER_MORSEL_ROWS);
+std::atomic<int64_t> EXEC_SEARCH_NQ_SLICE_PARALLELISM(
+    DEFAULT_EXEC_SEARCH_NQ_SLICE_PARALLELISM);
+std::atomic<int64_t> EXEC_SEARCH_NQ_SLICE_SIZE(
+    DEFAULT_EXEC_SEARCH_NQ_SLICE_SIZE);
+std::atomic<int64_t> EXEC_SPILL_MEMORY_LIMIT(DEFAULT_EXEC_SPILL_MEMORY_LIMIT);
+std::atomic<int64_t> EXEC_NODE_MEMORY_BUDGET(DEFAULT_EXEC_NODE_MEMORY_BUDGET);
+std::atomic<int64_t> EXEC_QUERY_MEMORY_LIMIT(DEFAULT_EXEC_QUERY_MEMORY_LIMIT);
+std::atomic<double> EXEC_RAW_SCAN_SELECTIVITY_THRESHOLD(
+    DEFAULT_EXEC_RAW_SCAN_SELECTIVITY_THRESHOLD);
+std::atomic<double> EXEC_SKIP_DELETED_ROWS_RATIO(
+    DEFAULT_EXEC_SKIP_DELETED_ROWS_RATIO);
 std::atomic<int64_t> DELETE_DUMP_BATCH_SIZE(DEFAULT_DELETE_DUMP_BATCH_SIZE);
+std::atomic<int64_t> RANGE_SEARCH_STREAM_SCAN_LIMIT(
+    DEFAULT_RANGE_SEARCH_STREAM_SCAN_LIMIT);
 std::atomic<bool> ENABLE_LATEST_DELETE_SNAPSHOT_OPTIMIZATION(
     DEFAULT_ENABLE_LATEST_DELETE_SNAPSHOT_OPTIMIZATION);
 std::atomic<bool> OPTIMIZE_EXPR_ENABLED(DEFAULT_OPTIMIZE_EXPR_ENABLED);
@@ -43,6 +66,34 @@ std::atomic<bool> CONFIG_PARAM_TYPE_CHECK_ENABLED(
     DEFAULT_CONFIG_PARAM_TYPE_CHECK_ENABLED);
 std::atomic<bool> ENABLE_PARQUET_STATS_SKIP_INDEX(
     DEFAULT_ENABLE_PARQUET_STATS_SKIP_INDEX);
+std::atomic<bool> ENABLE_PACKED_INT_CHUNK(DEFAULT_ENABLE_PACKED_INT_CHUNK);
+std::atomic<bool> ENABLE_MMAP_ACCESS_ADVICE(DEFAULT_ENABLE_MMAP_ACCESS_ADVICE);
+std::atomic<bool> ENABLE_INDEX_MMAP_READAHEAD(
+    DEFAULT_ENABLE_INDEX_MMAP_READAHEAD);
+std::atomic<bool> ENABLE_CHUNK_HUGE_PAGE(DEFAULT_ENABLE_CHUNK_HUGE_PAGE);
+std::atomic<bool> ENABLE_PROJECTED_GROUP_LOAD(
+    DEFAULT_ENABLE_PROJECTED_GROUP_LOAD);
+std::atomic<bool> ENABLE_NUMA_AWARE_EXECUTION(
+    DEFAULT_ENABLE_NUMA_AWARE_EXECUTION);
+std::atomic<bool> ENABLE_FAIR_QUERY_SCHEDULING(
+    DEFAULT_ENABLE_FAIR_QUERY_SCHEDULING);
+std::atomic<bool> ENABLE_ADAPTIVE_PAYLOAD_ENCODING(
+    DEFAULT_ENABLE_ADAPTIVE_PAYLOAD_ENCODING);
+std::atomic<int64_t> SCAN_PREFETCH_WINDOW(DEFAULT_SCAN_PREFETCH_WINDOW);
+std::atomic<int64_t> TANTIVY_RESULT_CACHE_CAPACITY(
+    DEFAULT_TANTIVY_RESULT_CACHE_CAPACITY);
+std::atomic<int64_t> QUERY_GEOMETRY_CACHE_CAPACITY(
+    DEFAULT_QUERY_GEOMETRY_CACHE_CAPACITY);
+std::atomic<int64_t> JSON_DOC_CACHE_CAPACITY(DEFAULT_JSON_DOC_CACHE_CAPACITY);
+std::atomic<int64_t> EXTERNAL_TAKE_CACHE_CAPACITY(
+    DEFAULT_EXTERNAL_TAKE_CACHE_CAPACITY);
+std::atomic<int64_t> PLAN_CACHE_CAPACITY(DEFAULT_PLAN_CACHE_CAPACITY);
+std::atomic<int64_t> PATTERN_MATCHER_CACHE_CAPACITY(
+    DEFAULT_PATTERN_MATCHER_CACHE_CAPACITY);
+std::atomic<int64_t> QUERY_PIN_CACHE_CAPACITY(
+    DEFAULT_QUERY_PIN_CACHE_CAPACITY);
+std::atomic<int64_t> PERF_COUNTER_SAMPLE_INTERVAL(
+    DEFAULT_PERF_COUNTER_SAMPLE_INTERVAL);
 
 void
 SetIndexSliceSize(const int64_t size) {
@@ -61,6 +112,37 @@ SetLoadTransientBudgetBytes(int64_t bytes) {
     LOG_INFO("set load transient budget bytes: {}", bytes);
 }
 
+void
+SetIndexBuildMemoryBudget(int64_t bytes) {
+    if (bytes < 0) {
+        LOG_WARN("ignore invalid index build memory budget: {}", bytes);
+        return;
+    }
+    INDEX_BUILD_MEMORY_BUDGET.store(bytes);
+    LOG_INFO("set index build memory budget bytes: {}", bytes);
+}
+
+void
+SetDiskAnnNodeCacheBudget(int64_t bytes) {
+    if (bytes < 0) {
+        LOG_WARN("ignore invalid diskann node cache budget: {}", bytes);
+        return;
+    }
+    DISKANN_NODE_CACHE_BUDGET.store(bytes);
+    LOG_INFO("set diskann node cache budget bytes: {}", bytes);
+}
+
+void
+SetScalarIndexBuildParallelism(int64_t parallelism) {
+    if (parallelism < 0) {
+        LOG_WARN("ignore invalid scalar index build parallelism: {}",
+                 parallelism);
+        return;
+    }
+    SCALAR_INDEX_BUILD_PARALLELISM.store(parallelism);
+    LOG_INFO("set scalar index build parallelism: {}", parallelism);
+}
+
 void
 SetDefaultExecEvalExprBatchSize(int64_t val) {
     EXEC_EVAL_EXPR_BATCH_SIZE.store(val);
@@ -68,6 +150,105 @@ SetDefaultExecEvalExprBatchSize(int64_t val) {
              EXEC_EVAL_EXPR_BATCH_SIZE.load());
 }
 
+void
+SetDefaultExecFilterMorselParallelism(int64_t parallelism, int64_t rows) {
+    if (parallelism < 1 || rows < 1) {
+        LOG_WARN(
+            "ignore invalid filter morsel config, parallelism: {}, rows: {}",
+            parallelism,
+            rows);
+        return;
+    }
+    EXEC_FILTER_MORSEL_PARALLELISM.store(parallelism);
+    EXEC_FILTER_MORSEL_ROWS.store(rows);
+    LOG_INFO("set filter morsel parallelism: {}, morsel rows: {}",
+             parallelism,
+             rows);
+}
+
+void
+SetDefaultExecSearchNqSliceParallelism(int64_t parallelism, int64_t nq) {
+    if (parallelism < 1 || nq < 1) {
+        LOG_WARN(
+            "ignore invalid search nq slice config, parallelism: {}, nq: {}",
+            parallelism,
+            nq);
+        return;
+    }
+    EXEC_SEARCH_NQ_SLICE_PARALLELISM.store(parallelism);
+    EXEC_SEARCH_NQ_SLICE_SIZE.store(nq);
+    LOG_INFO("set search nq slice parallelism: {}, slice nq: {}",
+             parallelism,
+             nq);
+}
+
+namespace {
+std::mutex exec_spill_directory_mutex;
+std::string exec_spill_directory(DEFAULT_EXEC_SPILL_DIRECTORY);
+}  // namespace
+
+void
+SetDefaultExecSpillConfig(int64_t memory_limit, const std::string& directory) {
+    if (memory_limit < 0 || (memory_limit > 0 && directory.empty())) {
+        LOG_WARN("ignore invalid spill config, memory limit: {}, dir: {}",
+                 memory_limit,
+                 directory);
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(exec_spill_directory_mutex);
+        if (!directory.empty()) {
+            exec_spill_directory = directory;
+        }
+    }
+    EXEC_SPILL_MEMORY_LIMIT.store(memory_limit);
+    LOG_INFO("set spill memory limit: {}, spill directory: {}",
+             memory_limit,
+             GetDefaultExecSpillDirectory());
+}
+
+std::string
+GetDefaultExecSpillDirectory() {
+    std::lock_guard<std::mutex> lock(exec_spill_directory_mutex);
+    return exec_spill_directory;
+}
+
+void
+SetDefaultExecMemoryConfig(int64_t node_budget, int64_t query_limit) {
+    if (node_budget < 0 || query_limit < 0) {
+        LOG_WARN("ignore invalid memory config, node budget: {}, query: {}",
+                 node_budget,
+                 query_limit);
+        return;
+    }
+    EXEC_NODE_MEMORY_BUDGET.store(node_budget);
+    EXEC_QUERY_MEMORY_LIMIT.store(query_limit);
+    LOG_INFO("set query memory budget of node: {}, of a query: {}",
+             node_budget,
+             query_limit);
+}
+
+void
+SetDefaultExecRawScanSelectivityThreshold(double threshold) {
+    if (!(threshold >= 0)) {
+        LOG_WARN("ignore invalid raw scan selectivity threshold: {}",
+                 threshold);
+        return;
+    }
+    EXEC_RAW_SCAN_SELECTIVITY_THRESHOLD.store(threshold);
+    LOG_INFO("set raw scan selectivity threshold: {}", threshold);
+}
+
+void
+SetDefaultExecSkipDeletedRowsRatio(double ratio) {
+    if (!(ratio >= 0)) {
+        LOG_WARN("ignore invalid skip deleted rows ratio: {}", ratio);
+        return;
+    }
+    EXEC_SKIP_DELETED_ROWS_RATIO.store(ratio);
+    LOG_INFO("set skip deleted rows ratio: {}", ratio);
+}
+
 void
 SetDefaultDeleteDumpBatchSize(int64_t val) {
     DELETE_DUMP_BATCH_SIZE.store(val);
@@ -75,6 +256,16 @@ SetDefaultDeleteDumpBatchSize(int64_t val) {
              DELETE_DUMP_BATCH_SIZE.load());
 }
 
+void
+SetDefaultRangeSearchStreamScanLimit(int64_t val) {
+    if (val < 0) {
+        LOG_WARN("ignore invalid range search stream scan limit: {}", val);
+        return;
+    }
+    RANGE_SEARCH_STREAM_SCAN_LIMIT.store(val);
+    LOG_INFO("set default range search stream scan limit: {}", val);
+}
+
 void
 SetDefaultOptimizeExprEnable(bool val) {
     OPTIMIZE_EXPR_ENABLED.store(val);
@@ -110,6 +301,124 @@ SetDefaultEnableParquetStatsSkipIndex(bool val) {
              ENABLE_PARQUET_STATS_SKIP_INDEX.load());
 }
 
+void
+SetDefaultEnablePackedIntChunk(bool val) {
+    ENABLE_PACKED_INT_CHUNK.store(val);
+    LOG_INFO("set default enable packed int chunk: {}",
+             ENABLE_PACKED_INT_CHUNK.load());
+}
+
+void
+SetDefaultEnableMmapAccessAdvice(bool val) {
+    ENABLE_MMAP_ACCESS_ADVICE.store(val);
+    LOG_INFO("set default enable mmap access advice: {}",
+             ENABLE_MMAP_ACCESS_ADVICE.load());
+}
+
+void
+SetDefaultEnableIndexMmapReadahead(bool val) {
+    ENABLE_INDEX_MMAP_READAHEAD.store(val);
+    LOG_INFO("set default enable index mmap readahead: {}",
+             ENABLE_INDEX_MMAP_READAHEAD.load());
+}
+
+void
+SetDefaultEnableChunkHugePage(bool val) {
+    ENABLE_CHUNK_HUGE_PAGE.store(val);
+    LOG_INFO("set default enable chunk huge page: {}",
+             ENABLE_CHUNK_HUGE_PAGE.load());
+}
+
+void
+SetDefaultEnableProjectedGroupLoad(bool val) {
+    ENABLE_PROJECTED_GROUP_LOAD.store(val);
+    LOG_INFO("set default enable projected group load: {}",
+             ENABLE_PROJECTED_GROUP_LOAD.load());
+}
+
+void
+SetDefaultEnableNumaAwareExecution(bool val) {
+    ENABLE_NUMA_AWARE_EXECUTION.store(val);
+    LOG_INFO("set default enable numa aware execution: {}",
+             ENABLE_NUMA_AWARE_EXECUTION.load());
+}
+
+void
+SetDefaultEnableFairQueryScheduling(bool val) {
+    ENABLE_FAIR_QUERY_SCHEDULING.store(val);
+    LOG_INFO("set default enable fair query scheduling: {}",
+             ENABLE_FAIR_QUERY_SCHEDULING.load());
+}
+
+void
+SetDefaultEnableAdaptivePayloadEncoding(bool val) {
+    ENABLE_ADAPTIVE_PAYLOAD_ENCODING.store(val);
+    LOG_INFO("set default enable adaptive payload encoding: {}",
+             ENABLE_ADAPTIVE_PAYLOAD_ENCODING.load());
+}
+
+void
+SetDefaultScanPrefetchWindow(int64_t val) {
+    SCAN_PREFETCH_WINDOW.store(val);
+    LOG_INFO("set default scan prefetch window: {}",
+             SCAN_PREFETCH_WINDOW.load());
+}
+
+void
+SetDefaultTantivyResultCacheCapacity(int64_t val) {
+    TANTIVY_RESULT_CACHE_CAPACITY.store(val);
+    LOG_INFO("set default tantivy result cache capacity: {}",
+             TANTIVY_RESULT_CACHE_CAPACITY.load());
+}
+
+void
+SetDefaultQueryGeometryCacheCapacity(int64_t val) {
+    QUERY_GEOMETRY_CACHE_CAPACITY.store(val);
+    LOG_INFO("set default query geometry cache capacity: {}",
+             QUERY_GEOMETRY_CACHE_CAPACITY.load());
+}
+
+void
+SetDefaultJsonDocCacheCapacity(int64_t val) {
+    JSON_DOC_CACHE_CAPACITY.store(val);
+    LOG_INFO("set default json doc cache capacity: {}",
+             JSON_DOC_CACHE_CAPACITY.load());
+}
+
+void
+SetDefaultExternalTakeCacheCapacity(int64_t val) {
+    EXTERNAL_TAKE_CACHE_CAPACITY.store(val);
+    LOG_INFO("set default external take cache capacity: {}",
+             EXTERNAL_TAKE_CACHE_CAPACITY.load());
+}
+
+void
+SetDefaultPlanCacheCapacity(int64_t val) {
+    PLAN_CACHE_CAPACITY.store(val);
+    LOG_INFO("set default plan cache capacity: {}", PLAN_CACHE_CAPACITY.load());
+}
+
+void
+SetDefaultPatternMatcherCacheCapacity(int64_t val) {
+    PATTERN_MATCHER_CACHE_CAPACITY.store(val);
+    LOG_INFO("set default pattern matcher cache capacity: {}",
+             PATTERN_MATCHER_CACHE_CAPACITY.load());
+}
+
+void
+SetDefaultQueryPinCacheCapacity(int64_t val) {
+    QUERY_PIN_CACHE_CAPACITY.store(val);
+    LOG_INFO("set default query pin cache capacity: {}",
+             QUERY_PIN_CACHE_CAPACITY.load());
+}
+
+void
+SetDefaultPerfCounterSampleInterval(int64_t val) {
+    PERF_COUNTER_SAMPLE_INTERVAL.store(val);
+    LOG_INFO("set default perf counter sample interval: {}",
+             PERF_COUNTER_SAMPLE_INTERVAL.load());
+}
+
 void
 SetEnableLatestDeleteSnapshotOptimization(bool val) {
     ENABLE_LATEST_DELETE_SNAPSHOT_OPTIMIZATION.store(val);
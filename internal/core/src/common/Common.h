@@ -18,6 +18,7 @@
 
 #include <atomic>
 #include <iostream>
+#include <string>
 #include <utility>
 #include <variant>
 #include "common/Consts.h"
@@ -26,14 +27,44 @@
 namespace milvus {
 
 extern std::atomic<int64_t> FILE_SLICE_SIZE;
+extern std::atomic<int64_t> INDEX_BUILD_MEMORY_BUDGET;
+extern std::atomic<int64_t> DISKANN_NODE_CACHE_BUDGET;
+extern std::atomic<int64_t> SCALAR_INDEX_BUILD_PARALLELISM;
 extern std::atomic<int64_t> EXEC_EVAL_EXPR_BATCH_SIZE;
+extern std::atomic<int64_t> EXEC_FILTER_MORSEL_PARALLELISM;
+extern std::atomic<int64_t> EXEC_FILTER_MORSEL_ROWS;
+extern std::atomic<int64_t> EXEC_SEARCH_NQ_SLICE_PARALLELISM;
+extern std::atomic<int64_t> EXEC_SEARCH_NQ_SLICE_SIZE;
+extern std::atomic<int64_t> EXEC_SPILL_MEMORY_LIMIT;
+extern std::atomic<int64_t> EXEC_NODE_MEMORY_BUDGET;
+extern std::atomic<int64_t> EXEC_QUERY_MEMORY_LIMIT;
+extern std::atomic<double> EXEC_RAW_SCAN_SELECTIVITY_THRESHOLD;
+extern std::atomic<double> EXEC_SKIP_DELETED_ROWS_RATIO;
 extern std::atomic<int64_t> DELETE_DUMP_BATCH_SIZE;
+extern std::atomic<int64_t> RANGE_SEARCH_STREAM_SCAN_LIMIT;
 extern std::atomic<bool> ENABLE_LATEST_DELETE_SNAPSHOT_OPTIMIZATION;
 extern std::atomic<bool> OPTIMIZE_EXPR_ENABLED;
 extern std::atomic<bool> JSON_KEY_STATS_ENABLED;
 extern std::atomic<bool> GROWING_JSON_KEY_STATS_ENABLED;
 extern std::atomic<bool> CONFIG_PARAM_TYPE_CHECK_ENABLED;
 extern std::atomic<bool> ENABLE_PARQUET_STATS_SKIP_INDEX;
+extern std::atomic<bool> ENABLE_PACKED_INT_CHUNK;
+extern std::atomic<bool> ENABLE_MMAP_ACCESS_ADVICE;
+extern std::atomic<bool> ENABLE_INDEX_MMAP_READAHEAD;
+extern std::atomic<bool> ENABLE_CHUNK_HUGE_PAGE;
+extern std::atomic<bool> ENABLE_PROJECTED_GROUP_LOAD;
+extern std::atomic<bool> ENABLE_NUMA_AWARE_EXECUTION;
+extern std::atomic<bool> ENABLE_FAIR_QUERY_SCHEDULING;
+extern std::atomic<bool> ENABLE_ADAPTIVE_PAYLOAD_ENCODING;
+extern std::atomic<int64_t> SCAN_PREFETCH_WINDOW;
+extern std::atomic<int64_t> TANTIVY_RESULT_CACHE_CAPACITY;
+extern std::atomic<int64_t> QUERY_GEOMETRY_CACHE_CAPACITY;
+extern std::atomic<int64_t> JSON_DOC_CACHE_CAPACITY;
+extern std::atomic<int64_t> EXTERNAL_TAKE_CACHE_CAPACITY;
+extern std::atomic<int64_t> PLAN_CACHE_CAPACITY;
+extern std::atomic<int64_t> PATTERN_MATCHER_CACHE_CAPACITY;
+extern std::atomic<int64_t> QUERY_PIN_CACHE_CAPACITY;
+extern std::atomic<int64_t> PERF_COUNTER_SAMPLE_INTERVAL;
 
 void
 SetIndexSliceSize(const int64_t size);
@@ -41,12 +72,45 @@ SetIndexSliceSize(const int64_t size);
 void
 SetLoadTransientBudgetBytes(int64_t bytes);
 
+void
+SetIndexBuildMemoryBudget(int64_t bytes);
+
+void
+SetDiskAnnNodeCacheBudget(int64_t bytes);
+
+void
+SetScalarIndexBuildParallelism(int64_t parallelism);
+
 void
 SetDefaultExecEvalExprBatchSize(int64_t val);
 
+void
+SetDefaultExecFilterMorselParallelism(int64_t parallelism, int64_t rows);
+
+void
+SetDefaultExecSearchNqSliceParallelism(int64_t parallelism, int64_t nq);
+
+void
+SetDefaultExecSpillConfig(int64_t memory_limit, const std::string& directory);
+
+std::string
+GetDefaultExecSpillDirectory();
+
+void
+SetDefaultExecMemoryConfig(int64_t node_budget, int64_t query_limit);
+
+void
+SetDefaultExecRawScanSelectivityThreshold(double threshold);
+
+void
+SetDefaultExecSkipDeletedRowsRatio(double ratio);
+
 void
 SetDefaultDeleteDumpBatchSize(int64_t val);
 
+void
+SetDefaultRangeSearchStreamScanLimit(int64_t val);
+
 void
 SetDefaultOptimizeExprEnable(bool val);
 
@@ -62,6 +126,57 @@ SetDefaultConfigParamTypeCheck(bool val);
 void
 SetDefaultEnableParquetStatsSkipIndex(bool val);
 
+void
+SetDefaultEnablePackedIntChunk(bool val);
+
+void
+SetDefaultEnableMmapAccessAdvice(bool val);
+
+void
+SetDefaultEnableIndexMmapReadahead(bool val);
+
+void
+SetDefaultEnableChunkHugePage(bool val);
+
+void
+SetDefaultEnableProjectedGroupLoad(bool val);
+
+void
+SetDefaultEnableNumaAwareExecution(bool val);
+
+void
+SetDefaultEnableFairQueryScheduling(bool val);
+
+void
+SetDefaultEnableAdaptivePayloadEncoding(bool val);
+
+void
+SetDefaultScanPrefetchWindow(int64_t val);
+
+void
+SetDefaultTantivyResultCacheCapacity(int64_t val);
+
+void
+SetDefaultQueryGeometryCacheCapacity(int64_t val);
+
+void
+SetDefaultJsonDocCacheCapacity(int64_t val);
+
+void
+SetDefaultExternalTakeCacheCapacity(int64_t val);
+
+void
+SetDefaultPlanCacheCapacity(int64_t val);
+
+void
+SetDefaultPatternMatcherCacheCapacity(int64_t val);
+
+void
+SetDefaultQueryPinCacheCapacity(int64_t val);
+
+void
+SetDefaultPerfCounterSampleInterval(int64_t val);
+
 void
 SetEnableLatestDeleteSnapshotOptimization(bool val);
 
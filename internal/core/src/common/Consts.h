@@ -85,12 +85,57 @@ const char DEFAULT_TASK_ID[] = "0";
 
 const int64_t DEFAULT_FIELD_MAX_MEMORY_LIMIT = 128 << 20;  // bytes
 
+// bytes of raw vectors an index build may hold at a time, the vectors are
+// then fed to the index batch by batch; 0 builds from the whole segment
+const int64_t DEFAULT_INDEX_BUILD_MEMORY_BUDGET = 0;
+
+// bytes the diskann node caches of all loaded segments may hold together,
+// 0 lets every index cache what its own search_cache_budget_gb asks for
+const int64_t DEFAULT_DISKANN_NODE_CACHE_BUDGET = 0;
+
+// threads a scalar index build sorts and groups its rows with, 0 for the cpu
+// number of the node and 1 builds on the calling thread only
+const int64_t DEFAULT_SCALAR_INDEX_BUILD_PARALLELISM = 0;
+
 const int64_t DEFAULT_INDEX_FILE_SLICE_SIZE = 16 << 20;  // bytes
 
 const int64_t DEFAULT_EXEC_EVAL_EXPR_BATCH_SIZE = 8192;
 
+// max threads evaluating the filter of one sealed segment, 1 disables it
+const int64_t DEFAULT_EXEC_FILTER_MORSEL_PARALLELISM = 1;
+const int64_t DEFAULT_EXEC_FILTER_MORSEL_ROWS = 64 * 1024;
+
+// max threads searching the queries of one sealed segment, 1 disables it
+const int64_t DEFAULT_EXEC_SEARCH_NQ_SLICE_PARALLELISM = 1;
+const int64_t DEFAULT_EXEC_SEARCH_NQ_SLICE_SIZE = 1024;
+
+// bytes an ORDER BY or GROUP BY operator may hold before spilling to local
+// disk, 0 disables spilling
+const int64_t DEFAULT_EXEC_SPILL_MEMORY_LIMIT = 0;
+const char DEFAULT_EXEC_SPILL_DIRECTORY[] = "/tmp/milvus/spill";
+
+// bytes the operators of all executing queries may hold together, and the
+// bytes one query may hold, 0 disables the limit
+const int64_t DEFAULT_EXEC_NODE_MEMORY_BUDGET = 0;
+const int64_t DEFAULT_EXEC_QUERY_MEMORY_LIMIT = 0;
+
+// estimated fraction of a sealed segment a range filter must match before it
+// scans the loaded column instead of an INVERTED or MARISA index, above 1
+// always uses the index
+const double DEFAULT_EXEC_RAW_SCAN_SELECTIVITY_THRESHOLD = 0.3;
+
+// fraction of a sealed segment that must be deleted at the query timestamp
+// before a filter on raw data evaluates only the rows left instead of
+// scanning all of them; 0, the default, or above 1 never skips them
+const double DEFAULT_EXEC_SKIP_DELETED_ROWS_RATIO = 0;
+
 const int64_t DEFAULT_DELETE_DUMP_BATCH_SIZE = 10000;
 
+// candidates a range search pulls at most per query from the iterators it
+// streams through, the query keeps the topk found so far; 0, the default,
+// collects the whole range with a knowhere range search instead
+const int64_t DEFAULT_RANGE_SEARCH_STREAM_SCAN_LIMIT = 0;
+
 const bool DEFAULT_ENABLE_LATEST_DELETE_SNAPSHOT_OPTIMIZATION = true;
 
 constexpr const char* COLLECTION_TTL_FIELD_KEY = "ttl_field";
@@ -118,6 +163,35 @@ const bool DEFAULT_JSON_KEY_STATS_ENABLED = true;
 const bool DEFAULT_GROWING_JSON_KEY_STATS_ENABLED = false;
 const bool DEFAULT_CONFIG_PARAM_TYPE_CHECK_ENABLED = true;
 const bool DEFAULT_ENABLE_PARQUET_STATS_SKIP_INDEX = false;
+const bool DEFAULT_ENABLE_PACKED_INT_CHUNK = false;
+const bool DEFAULT_ENABLE_MMAP_ACCESS_ADVICE = false;
+// read mmap'd vector index files ahead in the background once they can serve
+const bool DEFAULT_ENABLE_INDEX_MMAP_READAHEAD = false;
+const int64_t DEFAULT_INDEX_MMAP_READAHEAD_WINDOW = 64 << 20;
+const bool DEFAULT_ENABLE_CHUNK_HUGE_PAGE = false;
+const bool DEFAULT_ENABLE_PROJECTED_GROUP_LOAD = false;
+const bool DEFAULT_ENABLE_NUMA_AWARE_EXECUTION = false;
+const bool DEFAULT_ENABLE_FAIR_QUERY_SCHEDULING = false;
+// pick the parquet encoding of a binlog column by the stats of its values
+const bool DEFAULT_ENABLE_ADAPTIVE_PAYLOAD_ENCODING = true;
+// 0 prefetches every chunk a scan needs up front
+const int64_t DEFAULT_SCAN_PREFETCH_WINDOW = 0;
+// 0 disables the per index result cache of tantivy queries
+const int64_t DEFAULT_TANTIVY_RESULT_CACHE_CAPACITY = 0;
+// bytes of parsed and prepared query geometries each thread keeps
+const int64_t DEFAULT_QUERY_GEOMETRY_CACHE_CAPACITY = 4 << 20;
+// bytes of parsed JSON documents a filter shares between its predicates
+const int64_t DEFAULT_JSON_DOC_CACHE_CAPACITY = 64 << 20;
+// bytes of decoded row groups an external segment keeps between takes
+const int64_t DEFAULT_EXTERNAL_TAKE_CACHE_CAPACITY = 64 << 20;
+// parsed plans a collection keeps by their serialized bytes, 0 disables
+const int64_t DEFAULT_PLAN_CACHE_CAPACITY = 256;
+// compiled regex and LIKE matchers shared by all segments, 0 disables
+const int64_t DEFAULT_PATTERN_MATCHER_CACHE_CAPACITY = 1024;
+// cache cells a query on a segment keeps pinned between batches, 0 disables
+const int64_t DEFAULT_QUERY_PIN_CACHE_CAPACITY = 16;
+// one in this many driver runs reads the hardware counters, 0 disables
+const int64_t DEFAULT_PERF_COUNTER_SAMPLE_INTERVAL = 0;
 
 // skipindex stats related
 const double DEFAULT_BLOOM_FILTER_FALSE_POSITIVE_RATE = 0.01;
@@ -167,3 +241,9 @@ const std::string WARMUP_VECTOR_FIELD_KEY = "warmup.vectorField";
 constexpr int32_t kHybridIndexConfigVersion = 3;
 // The last version before hybrid index config support was added
 constexpr int32_t kLastVersionWithoutHybridIndexConfig = 2;
+// Version 5 stores the STL_SORT string dictionary front coded
+constexpr int32_t kFrontCodedStringIndexVersion = 5;
+// Version 6 also encodes the STL_SORT string posting lists adaptively
+constexpr int32_t kEncodedPostingListIndexVersion = 6;
+// Version 7 builds RTREE indexes as a packed Hilbert R-tree
+constexpr int32_t kPackedRTreeIndexVersion = 7;
@@ -109,6 +109,8 @@ ElementFilterIterator::FetchAndFilterBatch() {
                "ElementFilterIterator: evaluation result size mismatch");
 
     TargetBitmapView bitsetview(col_vec->GetRawData(), col_vec_size);
+    pulled_count_ += col_vec_size;
+    passed_count_ += bitsetview.count();
 
     // Step 4: Filter elements based on evaluation results and cache them
     for (size_t i = 0; i < element_ids_buffer_.size(); ++i) {
@@ -41,6 +41,18 @@ class ElementFilterIterator : public VectorIterator {
     std::optional<std::pair<int64_t, float>>
     Next() override;
 
+    // elements pulled from the base iterator so far
+    int64_t
+    pulled_count() const {
+        return pulled_count_;
+    }
+
+    // of them, the elements that passed the filter
+    int64_t
+    passed_count() const {
+        return passed_count_;
+    }
+
  private:
     // Fetch a batch from base iterator, evaluate expression, and cache results
     // Steps:
@@ -66,6 +78,9 @@ class ElementFilterIterator : public VectorIterator {
     // Reusable buffers for batch fetching (avoid repeated allocations)
     FixedVector<int32_t> element_ids_buffer_;
     FixedVector<float> distances_buffer_;
+
+    int64_t pulled_count_{0};
+    int64_t passed_count_{0};
 };
 
 }  // namespace milvus
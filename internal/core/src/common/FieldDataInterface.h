@@ -283,6 +283,17 @@ class FieldBitsetImpl : public FieldDataBase {
         }
     }
 
+    // hands the bits back as a bitmap, leaving this empty
+    TargetBitmap
+    TakeBitmap() {
+        std::scoped_lock lck(cap_mutex_, length_mutex_);
+        TargetBitmap bitmap(std::move(data_), length_);
+        data_ = FixedVector<Type>{};
+        cap_ = 0;
+        length_ = 0;
+        return bitmap;
+    }
+
  public:
     int64_t
     get_num_rows() const override {
@@ -251,6 +251,7 @@ class Geometry {
         return degrees_distance * avgMetersPerDegree;
     }
 
+ public:
     // Haversine formula to calculate great-circle distance between two points on Earth
     static double
     haversine_distance_meters(double lat1,
@@ -278,7 +279,6 @@ class Geometry {
         return R * c;  // Distance in meters
     }
 
- public:
     // Export to WKT string
     std::string
     to_wkt_string() const {
@@ -11,6 +11,10 @@
 
 #pragma once
 
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <list>
 #include <memory>
 #include <mutex>
 #include <shared_mutex>
@@ -18,8 +22,10 @@
 #include <unordered_map>
 #include <vector>
 
+#include "common/Common.h"
 #include "common/EasyAssert.h"
 #include "common/Geometry.h"
+#include "common/PreparedGeometry.h"
 #include "common/Types.h"
 #include "geos_c.h"
 #include "log/Log.h"
@@ -44,6 +50,8 @@ class SimpleGeometryCache {
         if (size == 0 || wkb_data == nullptr) {
             // Handle null/empty geometry - add invalid geometry
             geometries_.emplace_back();
+            AppendPoint(std::numeric_limits<double>::quiet_NaN(),
+                        std::numeric_limits<double>::quiet_NaN());
         } else {
             try {
                 // Create geometry with cache's context
@@ -53,6 +61,19 @@ class SimpleGeometryCache {
                           "Failed to construct geometry from WKB data: {}",
                           e.what());
             }
+            if (all_points_) {
+                auto* geometry = geometries_.back().GetGeometry();
+                double x, y;
+                if (GEOSGeomTypeId_r(ctx, geometry) == GEOS_POINT &&
+                    GEOSGeomGetX_r(ctx, geometry, &x) == 1 &&
+                    GEOSGeomGetY_r(ctx, geometry, &y) == 1) {
+                    AppendPoint(x, y);
+                } else {
+                    all_points_ = false;
+                    std::vector<double>().swap(xs_);
+                    std::vector<double>().swap(ys_);
+                }
+            }
         }
     }
 
@@ -76,6 +97,24 @@ class SimpleGeometryCache {
         return geometry.IsValid() ? &geometry : nullptr;
     }
 
+    // Whether every loaded row is a point or null, so PointXsUnsafe and
+    // PointYsUnsafe hold the coordinates of the rows, NaN for nulls
+    // (use with AcquireReadLock)
+    bool
+    AllPointsUnsafe() const {
+        return all_points_ && !geometries_.empty();
+    }
+
+    const double*
+    PointXsUnsafe() const {
+        return xs_.data();
+    }
+
+    const double*
+    PointYsUnsafe() const {
+        return ys_.data();
+    }
+
     // Get Geometry by offset (thread-safe read for filtering)
     const Geometry*
     GetByOffset(size_t offset) const {
@@ -98,8 +137,21 @@ class SimpleGeometryCache {
     }
 
  private:
+    void
+    AppendPoint(double x, double y) {
+        if (all_points_) {
+            xs_.push_back(x);
+            ys_.push_back(y);
+        }
+    }
+
     mutable std::shared_mutex mutex_;   // For read/write operations
     std::vector<Geometry> geometries_;  // Direct storage of Geometry objects
+    // Point columns also keep their coordinates columnar, so point filters
+    // are plain arithmetic over them instead of GEOS calls per row
+    bool all_points_ = true;
+    std::vector<double> xs_;
+    std::vector<double> ys_;
 };
 
 // Global cache instance per segment+field
@@ -193,6 +245,120 @@ class SimpleGeometryCacheManager {
         caches_;
 };
 
+// A filter geometry parsed and prepared, see QueryGeometryCache.
+struct QueryGeometry {
+    QueryGeometry(GEOSContextHandle_t ctx, const std::string& wkt)
+        : wkt(wkt), geometry(ctx, wkt.c_str()), prepared(ctx, geometry) {
+        auto* geom = geometry.GetGeometry();
+        has_envelope = GEOSGeom_getXMin_r(ctx, geom, &min_x) == 1 &&
+                       GEOSGeom_getYMin_r(ctx, geom, &min_y) == 1 &&
+                       GEOSGeom_getXMax_r(ctx, geom, &max_x) == 1 &&
+                       GEOSGeom_getYMax_r(ctx, geom, &max_y) == 1;
+        is_point = has_envelope && GEOSGeomTypeId_r(ctx, geom) == GEOS_POINT;
+        // the coordinates, copied again by the prepared geometry's indexes
+        auto num_coordinates = GEOSGetNumCoordinates_r(ctx, geom);
+        byte_size = sizeof(QueryGeometry) + wkt.size() +
+                    std::max(num_coordinates, 0) * 4 * sizeof(double);
+    }
+
+    const std::string wkt;
+    Geometry geometry;
+    // references geometry, so it is declared after it
+    PreparedGeometry prepared;
+    // the bounding box of geometry if it is not empty
+    bool has_envelope = false;
+    double min_x = 0;
+    double min_y = 0;
+    double max_x = 0;
+    double max_y = 0;
+    // a non-empty point, at (min_x, min_y)
+    bool is_point = false;
+    size_t byte_size = 0;
+};
+
+// The filter geometries a thread used last, parsed and prepared, so a
+// spatial filter repeated across batches and requests neither parses nor
+// prepares its geometry again. Geometries are keyed by the hash of their
+// WKT and the least recently used ones are evicted once the cache holds
+// more than QUERY_GEOMETRY_CACHE_CAPACITY bytes.
+//
+// Thread safety: none, each thread has its own cache as GEOS prepared
+// geometries cannot be shared between threads.
+class QueryGeometryCache {
+ public:
+    static QueryGeometryCache&
+    ThreadLocal() {
+        // created first, so the context outlives the cached geometries
+        GetThreadLocalGEOSContext();
+        thread_local QueryGeometryCache cache;
+        return cache;
+    }
+
+    std::shared_ptr<const QueryGeometry>
+    Get(const std::string& wkt) {
+        return Get(wkt, QUERY_GEOMETRY_CACHE_CAPACITY.load());
+    }
+
+    std::shared_ptr<const QueryGeometry>
+    Get(const std::string& wkt, int64_t capacity) {
+        auto hash = std::hash<std::string>{}(wkt);
+        auto [begin, end] = index_.equal_range(hash);
+        for (auto it = begin; it != end; ++it) {
+            if ((*it->second)->wkt == wkt) {
+                lru_.splice(lru_.begin(), lru_, it->second);
+                return *it->second;
+            }
+        }
+
+        auto geometry = std::make_shared<const QueryGeometry>(
+            GetThreadLocalGEOSContext(), wkt);
+        if (capacity <= 0 ||
+            geometry->byte_size > static_cast<size_t>(capacity)) {
+            return geometry;
+        }
+        lru_.push_front(geometry);
+        index_.emplace(hash, lru_.begin());
+        bytes_ += geometry->byte_size;
+        while (bytes_ > static_cast<size_t>(capacity)) {
+            Evict();
+        }
+        return geometry;
+    }
+
+    size_t
+    size() const {
+        return lru_.size();
+    }
+
+    size_t
+    ByteSize() const {
+        return bytes_;
+    }
+
+ private:
+    using Entries = std::list<std::shared_ptr<const QueryGeometry>>;
+
+    void
+    Evict() {
+        auto last = std::prev(lru_.end());
+        auto [begin, end] =
+            index_.equal_range(std::hash<std::string>{}((*last)->wkt));
+        for (auto it = begin; it != end; ++it) {
+            if (it->second == last) {
+                index_.erase(it);
+                break;
+            }
+        }
+        bytes_ -= (*last)->byte_size;
+        lru_.erase(last);
+    }
+
+    // most recently used first
+    Entries lru_;
+    std::unordered_multimap<size_t, Entries::iterator> index_;
+    size_t bytes_ = 0;
+};
+
 }  // namespace exec
 
 }  // namespace milvus
@@ -0,0 +1,93 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <string>
+
+#include "common/Geometry.h"
+#include "common/GeometryCache.h"
+#include "geos_c.h"
+
+using milvus::Geometry;
+using milvus::exec::QueryGeometryCache;
+using milvus::exec::SimpleGeometryCache;
+
+namespace {
+
+void
+Append(SimpleGeometryCache& cache, GEOSContextHandle_t ctx, const char* wkt) {
+    if (wkt == nullptr) {
+        cache.AppendData(ctx, nullptr, 0);
+        return;
+    }
+    auto wkb = Geometry(ctx, wkt).to_wkb_string();
+    cache.AppendData(ctx, wkb.data(), wkb.size());
+}
+
+}  // namespace
+
+TEST(GeometryCacheTest, KeepsPointColumnsColumnar) {
+    auto ctx = milvus::GetThreadLocalGEOSContext();
+    SimpleGeometryCache points;
+    Append(points, ctx, "POINT(1 2)");
+    Append(points, ctx, nullptr);
+    Append(points, ctx, "POINT(-3.5 4)");
+    {
+        auto lock = points.AcquireReadLock();
+        ASSERT_TRUE(points.AllPointsUnsafe());
+        EXPECT_EQ(points.PointXsUnsafe()[0], 1);
+        EXPECT_EQ(points.PointYsUnsafe()[0], 2);
+        EXPECT_TRUE(std::isnan(points.PointXsUnsafe()[1]));
+        EXPECT_EQ(points.PointXsUnsafe()[2], -3.5);
+        EXPECT_EQ(points.PointYsUnsafe()[2], 4);
+    }
+
+    Append(points, ctx, "LINESTRING(0 0, 1 1)");
+    auto lock = points.AcquireReadLock();
+    EXPECT_FALSE(points.AllPointsUnsafe());
+    EXPECT_NE(points.GetByOffsetUnsafe(3), nullptr);
+}
+
+TEST(GeometryCacheTest, ReusesQueryGeometries) {
+    QueryGeometryCache cache;
+    const std::string square = "POLYGON((0 0, 10 0, 10 10, 0 10, 0 0))";
+    auto first = cache.Get(square, 1 << 20);
+    auto again = cache.Get(square, 1 << 20);
+    EXPECT_EQ(first.get(), again.get());
+    EXPECT_EQ(cache.size(), 1);
+    EXPECT_EQ(cache.ByteSize(), first->byte_size);
+
+    ASSERT_TRUE(first->has_envelope);
+    EXPECT_EQ(first->min_x, 0);
+    EXPECT_EQ(first->max_y, 10);
+    Geometry inside(milvus::GetThreadLocalGEOSContext(), "POINT(5 5)");
+    EXPECT_TRUE(first->prepared.contains(inside));
+}
+
+TEST(GeometryCacheTest, EvictsLeastRecentlyUsed) {
+    QueryGeometryCache cache;
+    auto a = cache.Get("POINT(1 1)", 1 << 20);
+    auto capacity = static_cast<int64_t>(a->byte_size * 2);
+    cache.Get("POINT(2 2)", capacity);
+    // touches POINT(1 1), so POINT(2 2) is evicted next
+    cache.Get("POINT(1 1)", capacity);
+    cache.Get("POINT(3 3)", capacity);
+    EXPECT_EQ(cache.size(), 2);
+    EXPECT_LE(cache.ByteSize(), capacity);
+    EXPECT_EQ(cache.Get("POINT(1 1)", capacity).get(), a.get());
+
+    // not cached at all without a budget
+    QueryGeometryCache disabled;
+    auto b = disabled.Get("POINT(1 1)", 0);
+    EXPECT_NE(disabled.Get("POINT(1 1)", 0).get(), b.get());
+    EXPECT_EQ(disabled.size(), 0);
+}
@@ -0,0 +1,96 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__F16C__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+#if defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+#include "common/Types.h"
+
+// Widening of half precision vectors to float, for kernels that convert a
+// block at a time as they go instead of expanding whole chunks. The vector
+// paths are picked at compile time like the rest of the SIMD code, the tail
+// and other targets go through the scalar conversion of the types.
+
+namespace milvus {
+
+inline void
+ConvertToFloat(const float16* src, float* dst, size_t n) {
+    static_assert(sizeof(float16) == sizeof(uint16_t));
+    size_t i = 0;
+#if defined(__AVX512F__)
+    for (; i + 16 <= n; i += 16) {
+        auto half =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        _mm512_storeu_ps(dst + i, _mm512_cvtph_ps(half));
+    }
+#endif
+#if defined(__F16C__)
+    for (; i + 8 <= n; i += 8) {
+        auto half = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(half));
+    }
+#elif defined(__aarch64__)
+    for (; i + 4 <= n; i += 4) {
+        auto half = vld1_u16(reinterpret_cast<const uint16_t*>(src + i));
+        vst1q_f32(dst + i, vcvt_f32_f16(vreinterpret_f16_u16(half)));
+    }
+#endif
+    for (; i < n; ++i) {
+        dst[i] = static_cast<float>(src[i]);
+    }
+}
+
+// bfloat16 is the upper half of a float, widening is a shift
+inline void
+ConvertToFloat(const bfloat16* src, float* dst, size_t n) {
+    static_assert(sizeof(bfloat16) == sizeof(uint16_t));
+    size_t i = 0;
+#if defined(__AVX2__)
+    for (; i + 8 <= n; i += 8) {
+        auto half = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        auto wide = _mm256_slli_epi32(_mm256_cvtepu16_epi32(half), 16);
+        _mm256_storeu_ps(dst + i, _mm256_castsi256_ps(wide));
+    }
+#elif defined(__aarch64__)
+    for (; i + 4 <= n; i += 4) {
+        auto half = vld1_u16(reinterpret_cast<const uint16_t*>(src + i));
+        vst1q_f32(dst + i, vreinterpretq_f32_u32(vshll_n_u16(half, 16)));
+    }
+#endif
+    for (; i < n; ++i) {
+        uint16_t bits;
+        std::memcpy(&bits, src + i, sizeof(bits));
+        const uint32_t wide = static_cast<uint32_t>(bits) << 16;
+        std::memcpy(dst + i, &wide, sizeof(wide));
+    }
+}
+
+inline void
+ConvertToFloat(const float* src, float* dst, size_t n) {
+    std::memcpy(dst, src, n * sizeof(float));
+}
+
+}  // namespace milvus
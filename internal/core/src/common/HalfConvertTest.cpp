@@ -0,0 +1,63 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "common/HalfConvert.h"
+#include "common/Types.h"
+
+namespace {
+
+// every length up to a few vector widths, so each path and tail is taken
+template <typename Half>
+void
+ExpectSameAsScalar() {
+    std::mt19937 gen(17);
+    std::normal_distribution<float> value(0, 100);
+    std::vector<Half> src;
+    src.push_back(Half(0.0f));
+    src.push_back(Half(-0.0f));
+    src.push_back(Half(std::numeric_limits<float>::infinity()));
+    src.push_back(Half(1e-6f));
+    while (src.size() < 70) {
+        src.push_back(Half(value(gen)));
+    }
+    for (size_t n = 0; n <= src.size(); ++n) {
+        std::vector<float> dst(n + 1, 42.0f);
+        milvus::ConvertToFloat(src.data(), dst.data(), n);
+        for (size_t i = 0; i < n; ++i) {
+            ASSERT_EQ(dst[i], static_cast<float>(src[i])) << n << " " << i;
+            ASSERT_EQ(std::signbit(dst[i]),
+                      std::signbit(static_cast<float>(src[i])));
+        }
+        // nothing past the end is written
+        ASSERT_EQ(dst[n], 42.0f);
+    }
+}
+
+}  // namespace
+
+TEST(HalfConvertTest, Float16MatchesScalarConversion) {
+    ExpectSameAsScalar<milvus::float16>();
+}
+
+TEST(HalfConvertTest, BFloat16MatchesScalarConversion) {
+    ExpectSameAsScalar<milvus::bfloat16>();
+}
@@ -26,6 +26,8 @@
 #include <string_view>
 
 #include "common/EasyAssert.h"
+#include "common/JsonDocCache.h"
+#include "common/JsonPointer.h"
 #include "simdjson.h"
 #include "fmt/core.h"
 #include "simdjson/common_defs.h"
@@ -46,6 +48,8 @@ bool
 isObjectEmpty(simdjson::ondemand::value value);
 bool
 isDocEmpty(simdjson::ondemand::document document);
+bool
+isElementEmpty(simdjson::dom::element element);
 
 // Extract specific top-level keys from a JSON string using simdjson ondemand.
 // Uses raw_json() to copy value fragments directly from the source without
@@ -112,6 +116,92 @@ ExtractSubJson(std::string_view json, const std::vector<std::string>& keys) {
 using document = simdjson::ondemand::document;
 template <typename T>
 using value_result = simdjson::simdjson_result<T>;
+
+// A JSON number as Json::at_numeric() reads it with a JsonPointer, from the
+// on demand parser or from a document in the JsonDocCache.
+class JsonNumber {
+ public:
+    JsonNumber() : JsonNumber(int64_t{0}) {
+    }
+
+    explicit JsonNumber(simdjson::ondemand::number number) {
+        if (number.is_int64()) {
+            *this = JsonNumber(number.get_int64());
+        } else if (number.is_uint64()) {
+            *this = JsonNumber(number.get_uint64());
+        } else {
+            *this = JsonNumber(number.get_double());
+        }
+    }
+
+    explicit JsonNumber(int64_t value)
+        : type_(simdjson::ondemand::number_type::signed_integer) {
+        int64_ = value;
+    }
+
+    explicit JsonNumber(uint64_t value)
+        : type_(simdjson::ondemand::number_type::unsigned_integer) {
+        uint64_ = value;
+    }
+
+    explicit JsonNumber(double value)
+        : type_(simdjson::ondemand::number_type::floating_point_number) {
+        double_ = value;
+    }
+
+    static value_result<JsonNumber>
+    From(simdjson::dom::element element) {
+        switch (element.type()) {
+            case simdjson::dom::element_type::INT64:
+                return JsonNumber(element.get_int64().value_unsafe());
+            case simdjson::dom::element_type::UINT64:
+                return JsonNumber(element.get_uint64().value_unsafe());
+            case simdjson::dom::element_type::DOUBLE:
+                return JsonNumber(element.get_double().value_unsafe());
+            default:
+                return simdjson::INCORRECT_TYPE;
+        }
+    }
+
+    bool
+    is_int64() const {
+        return type_ == simdjson::ondemand::number_type::signed_integer;
+    }
+
+    bool
+    is_uint64() const {
+        return type_ == simdjson::ondemand::number_type::unsigned_integer;
+    }
+
+    bool
+    is_double() const {
+        return type_ == simdjson::ondemand::number_type::floating_point_number;
+    }
+
+    int64_t
+    get_int64() const {
+        return int64_;
+    }
+
+    uint64_t
+    get_uint64() const {
+        return uint64_;
+    }
+
+    double
+    get_double() const {
+        return double_;
+    }
+
+ private:
+    simdjson::ondemand::number_type type_;
+    union {
+        int64_t int64_;
+        uint64_t uint64_;
+        double double_;
+    };
+};
+
 class Json {
  public:
     Json() = default;
@@ -218,6 +308,9 @@ class Json {
         if (data_.size() == 0) {
             return {};
         }
+        if (auto root = cached_doc()) {
+            return std::move(root.value());
+        }
         thread_local simdjson::dom::parser parser;
 
         // it's always safe to add the padding,
@@ -257,6 +350,25 @@ class Json {
         }
     }
 
+    bool
+    exist(const JsonPointer& pointer) const {
+        if (pointer.empty()) {
+            return exist(std::string_view());
+        }
+        if (auto root = cached_doc()) {
+            auto res = pointer.Find(root.value());
+            return res.error() == simdjson::SUCCESS &&
+                   !isElementEmpty(res.value_unsafe());
+        }
+        auto doc = this->doc();
+        if (doc.error()) {
+            return false;
+        }
+        auto res = pointer.Find(doc.value_unsafe());
+        return res.error() == simdjson::SUCCESS &&
+               !isObjectEmpty(res.value_unsafe());
+    }
+
     // construct JSON pointer with provided path
     static std::string
     pointer(std::vector<std::string> nested_path) {
@@ -303,6 +415,22 @@ class Json {
         return doc().at_pointer(pointer).get<T>();
     }
 
+    // at() with a pointer tokenized up front, reading a document of the
+    // current JsonDocCache when there is one
+    template <typename T>
+    value_result<T>
+    at(const JsonPointer& pointer) const {
+        if (pointer.empty()) {
+            return at<T>(std::string_view());
+        }
+        if (auto root = cached_doc()) {
+            return pointer.Find(root.value()).template get<T>();
+        }
+        auto doc = this->doc();
+        SIMDJSON_CHECK_ERROR(doc);
+        return pointer.Find(doc.value_unsafe()).template get<T>();
+    }
+
     // Extract a JSON number in a single parse, preserving the original type.
     // Returns simdjson::ondemand::number (a tagged union of int64/uint64/double).
     // Callers should branch on is_int64()/is_uint64()/is_double() to avoid
@@ -315,6 +443,22 @@ class Json {
         return doc().at_pointer(pointer).get_number();
     }
 
+    value_result<JsonNumber>
+    at_numeric(const JsonPointer& pointer) const {
+        if (auto root = cached_doc()) {
+            auto element = pointer.Find(root.value());
+            SIMDJSON_CHECK_ERROR(element);
+            return JsonNumber::From(element.value_unsafe());
+        }
+        auto doc = this->doc();
+        SIMDJSON_CHECK_ERROR(doc);
+        auto number = pointer.empty()
+                          ? doc.value_unsafe().get_number()
+                          : pointer.Find(doc.value_unsafe()).get_number();
+        SIMDJSON_CHECK_ERROR(number);
+        return JsonNumber(number.value_unsafe());
+    }
+
     value_result<std::string>
     at_string_any(std::string_view pointer) const {
         if (data_.empty()) {
@@ -358,6 +502,13 @@ class Json {
         return dom_doc().at_pointer(pointer).get_array();
     }
 
+    value_result<simdjson::dom::array>
+    array_at(const JsonPointer& pointer) const {
+        auto root = dom_doc();
+        SIMDJSON_CHECK_ERROR(root);
+        return pointer.Find(root.value_unsafe()).get_array();
+    }
+
     size_t
     size() const {
         return data_.size();
@@ -374,6 +525,15 @@ class Json {
     }
 
  private:
+    std::optional<simdjson::dom::element>
+    cached_doc() const {
+        auto cache = JsonDocCache::Current();
+        if (cache == nullptr) {
+            return std::nullopt;
+        }
+        return cache->Get(data_);
+    }
+
     std::optional<simdjson::padded_string>
         own_data_{};  // this could be empty, then the Json will be just s view on bytes
     simdjson::padded_string_view data_{};
@@ -408,6 +568,34 @@ isObjectEmpty(simdjson::ondemand::value value) {
     return false;
 }
 
+inline bool
+isElementEmpty(simdjson::dom::element element) {
+    switch (element.type()) {
+        case simdjson::dom::element_type::NULL_VALUE:
+            return true;
+        case simdjson::dom::element_type::OBJECT: {
+            simdjson::dom::object object = element.get_object().value_unsafe();
+            for (auto field : object) {
+                if (!isElementEmpty(field.value)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        case simdjson::dom::element_type::ARRAY: {
+            simdjson::dom::array array = element.get_array().value_unsafe();
+            for (auto child : array) {
+                if (!isElementEmpty(child)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
 inline bool
 isDocEmpty(simdjson::ondemand::document document) {
     if (document.is_null()) {
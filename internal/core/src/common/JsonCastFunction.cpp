@@ -98,6 +98,31 @@ JsonCastFunction::CastJsonValue(const JsonCastFunction& cast_function,
     return res;
 }
 
+template <typename T>
+std::optional<T>
+JsonCastFunction::CastJsonElement(const JsonCastFunction& cast_function,
+                                  const simdjson::dom::element& element) {
+    AssertInfo(cast_function.match<T>(), "Type mismatch");
+
+    switch (element.type()) {
+        case simdjson::dom::element_type::STRING:
+            return cast_function.cast<T, std::string>(
+                std::string(element.get_string().value_unsafe()));
+        case simdjson::dom::element_type::INT64:
+            return cast_function.cast<T, int64_t>(
+                element.get_int64().value_unsafe());
+        case simdjson::dom::element_type::UINT64:
+        case simdjson::dom::element_type::DOUBLE:
+            return cast_function.cast<T, double>(
+                element.get_double().value_unsafe());
+        case simdjson::dom::element_type::BOOL:
+            return cast_function.cast<T, bool>(
+                element.get_bool().value_unsafe());
+        default:
+            return std::nullopt;
+    }
+}
+
 template std::optional<bool>
 JsonCastFunction::CastJsonValue<bool>(const JsonCastFunction& cast_function,
                                       const Json& json,
@@ -119,4 +144,23 @@ JsonCastFunction::CastJsonValue<std::string>(
     const Json& json,
     const std::string& pointer);
 
+template std::optional<bool>
+JsonCastFunction::CastJsonElement<bool>(const JsonCastFunction& cast_function,
+                                        const simdjson::dom::element& element);
+
+template std::optional<int64_t>
+JsonCastFunction::CastJsonElement<int64_t>(
+    const JsonCastFunction& cast_function,
+    const simdjson::dom::element& element);
+
+template std::optional<double>
+JsonCastFunction::CastJsonElement<double>(
+    const JsonCastFunction& cast_function,
+    const simdjson::dom::element& element);
+
+template std::optional<std::string>
+JsonCastFunction::CastJsonElement<std::string>(
+    const JsonCastFunction& cast_function,
+    const simdjson::dom::element& element);
+
 }  // namespace milvus
@@ -53,6 +53,14 @@ class JsonCastFunction {
                   const Json& json,
                   const std::string& pointer);
 
+    // CastJsonValue() of a value already found in a parsed document, so a
+    // caller reading many paths or rows parses each document once instead
+    // of once per type check and read
+    template <typename T>
+    static std::optional<T>
+    CastJsonElement(const JsonCastFunction& cast_function,
+                    const simdjson::dom::element& element);
+
  private:
     JsonCastFunction(Type type) : cast_function_type_(type) {
     }
@@ -0,0 +1,69 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "common/JsonDocCache.h"
+
+#include "xxhash.h"  // from xxhash/xxhash
+
+namespace milvus {
+
+thread_local JsonDocCache* JsonDocCache::current_ = nullptr;
+
+namespace {
+
+// what dom::document::allocate() reserves for a document of `size` bytes
+int64_t
+ParsedByteSize(size_t size) {
+    auto tape = SIMDJSON_ROUNDUP_N(size + 3, 64) * sizeof(uint64_t);
+    auto strings = SIMDJSON_ROUNDUP_N(5 * size / 3 + simdjson::SIMDJSON_PADDING,
+                                      64);
+    return static_cast<int64_t>(tape + strings);
+}
+
+}  // namespace
+
+std::optional<simdjson::dom::element>
+JsonDocCache::Get(simdjson::padded_string_view data) {
+    if (data.empty()) {
+        return std::nullopt;
+    }
+    auto hash = XXH3_64bits(data.data(), data.size());
+    auto it = entries_.find(data.data());
+    if (it != entries_.end()) {
+        if (it->second.size == data.size() && it->second.hash == hash) {
+            return it->second.doc.root();
+        }
+        byte_size_ -= ParsedByteSize(it->second.size);
+        entries_.erase(it);
+    }
+
+    auto byte_size = ParsedByteSize(data.size());
+    if (byte_size_ + byte_size > capacity_) {
+        return std::nullopt;
+    }
+    Entry entry{data.size(), hash, {}};
+    // the padding of `data` is always allocated, see milvus::Json
+    auto root = parser_.parse_into_document(
+        entry.doc, data.data(), data.size(), false);
+    if (root.error()) {
+        return std::nullopt;
+    }
+    byte_size_ += byte_size;
+    auto [inserted, _] = entries_.emplace(data.data(), std::move(entry));
+    return inserted->second.doc.root();
+}
+
+}  // namespace milvus
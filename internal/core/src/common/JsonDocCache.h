@@ -0,0 +1,111 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+
+#include "simdjson.h"
+
+namespace milvus {
+
+// Parsed JSON documents shared by the expressions evaluating one batch.
+// Every JSON predicate of a filter parses the rows it reads on its own, so
+// `a["x"] > 1 and a["y"] == "z"` parses each document twice. While a Scope
+// is active, Json accessors on the same thread look the document up here
+// and parse it into DOM form only the first time.
+//
+// Documents are keyed by their address, and also checked by length and
+// hash since a chunk may be unpinned between two expressions and another
+// chunk loaded at the same address. Once `capacity` bytes of parsed
+// documents are held, further documents are not cached and are read with
+// the on demand parser as without a cache.
+class JsonDocCache {
+ public:
+    explicit JsonDocCache(int64_t capacity) : capacity_(capacity) {
+    }
+
+    JsonDocCache(const JsonDocCache&) = delete;
+    JsonDocCache&
+    operator=(const JsonDocCache&) = delete;
+
+    // makes `cache` the one Current() returns on this thread until the
+    // scope ends; a null cache disables caching in the scope
+    class Scope {
+     public:
+        explicit Scope(JsonDocCache* cache) : previous_(current_) {
+            current_ = cache;
+        }
+
+        ~Scope() {
+            current_ = previous_;
+        }
+
+        Scope(const Scope&) = delete;
+        Scope&
+        operator=(const Scope&) = delete;
+
+     private:
+        JsonDocCache* previous_;
+    };
+
+    static JsonDocCache*
+    Current() {
+        return current_;
+    }
+
+    // the root of the parsed `data`, nullopt when it is not cached and
+    // there is no room left, or it is not valid JSON. The element stays
+    // valid as long as the cache.
+    std::optional<simdjson::dom::element>
+    Get(simdjson::padded_string_view data);
+
+    // drops every document, before the expressions move to the next batch
+    void
+    Clear() {
+        entries_.clear();
+        byte_size_ = 0;
+    }
+
+    size_t
+    size() const {
+        return entries_.size();
+    }
+
+    int64_t
+    ByteSize() const {
+        return byte_size_;
+    }
+
+ private:
+    struct Entry {
+        size_t size;
+        uint64_t hash;
+        simdjson::dom::document doc;
+    };
+
+    static thread_local JsonDocCache* current_;
+
+    int64_t capacity_;
+    int64_t byte_size_ = 0;
+    std::unordered_map<const char*, Entry> entries_;
+    simdjson::dom::parser parser_;
+};
+
+}  // namespace milvus
@@ -0,0 +1,190 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "common/Json.h"
+#include "common/JsonDocCache.h"
+#include "common/JsonPointer.h"
+
+using milvus::Json;
+using milvus::JsonDocCache;
+using milvus::JsonPointer;
+
+namespace {
+
+const std::vector<std::string> kDocs = {
+    R"({"a": 1, "b": {"c": [10, 2.5, "x", true, null, {"d": -3}]},
+        "e~f": "tilde", "g/h": 18446744073709551615, "": {"": 7},
+        "n": null, "o": {}, "p": [[], {"q": null}]})",
+    R"([1, {"a": "one"}, [2, 3]])",
+    R"("scalar")",
+    R"({"a": {"a": {"a": 4}}, "b": [true, false]})",
+};
+
+const std::vector<std::string> kPointers = {
+    "/a",     "/b",   "/b/c",     "/b/c/0", "/b/c/1", "/b/c/2", "/b/c/3",
+    "/b/c/4", "/b/c/5/d", "/b/c/6", "/b/c/00", "/b/c/-", "/b/c/x",
+    "/e~0f",  "/g~1h", "/~2",     "/",      "//",     "/n",     "/o",
+    "/p",     "/p/1/q", "/0",     "/1/a",   "/2/1",   "/a/a/a", "/a/b",
+    "/b/1",   "a",    "/missing", "/a/x",
+};
+
+// `doc` followed by the padding simdjson reads past the end, as the columns
+// holding JSON allocate it.
+class PaddedJson {
+ public:
+    explicit PaddedJson(const std::string& doc)
+        : buffer_(doc.size() + simdjson::SIMDJSON_PADDING, '\0') {
+        std::memcpy(buffer_.data(), doc.data(), doc.size());
+        size_ = doc.size();
+    }
+
+    Json
+    json() const {
+        return Json(buffer_.data(), size_);
+    }
+
+    simdjson::padded_string_view
+    view() const {
+        return simdjson::padded_string_view(
+            buffer_.data(), size_, buffer_.size());
+    }
+
+ private:
+    std::vector<char> buffer_;
+    size_t size_;
+};
+
+// every accessor's view of `pointer`, a string or a JsonPointer
+template <typename Pointer>
+std::string
+Describe(const Json& json, const Pointer& pointer) {
+    std::string out;
+    auto i64 = json.at<int64_t>(pointer);
+    out += i64.error() ? "-" : std::to_string(i64.value());
+    auto f64 = json.at<double>(pointer);
+    out += f64.error() ? ",-" : "," + std::to_string(f64.value());
+    auto b = json.at<bool>(pointer);
+    out += b.error() ? ",-" : b.value() ? ",t" : ",f";
+    auto str = json.at<std::string_view>(pointer);
+    out += str.error() ? ",-" : "," + std::string(str.value());
+    auto num = json.at_numeric(pointer);
+    if (num.error()) {
+        out += ",-";
+    } else if (num.value().is_int64()) {
+        out += ",i" + std::to_string(num.value().get_int64());
+    } else if (num.value().is_uint64()) {
+        out += ",u" + std::to_string(num.value().get_uint64());
+    } else {
+        out += ",d" + std::to_string(num.value().get_double());
+    }
+    out += json.exist(pointer) ? ",e" : ",-";
+    auto array = json.array_at(pointer);
+    out += array.error() ? ",-" : "," + std::to_string(array.value().size());
+    return out;
+}
+
+}  // namespace
+
+TEST(JsonPointerTest, MatchesAtPointer) {
+    for (const auto& doc : kDocs) {
+        PaddedJson padded(doc);
+        auto json = padded.json();
+        for (const auto& pointer : kPointers) {
+            auto expected = Describe(json, pointer);
+            EXPECT_EQ(Describe(json, JsonPointer(pointer)), expected)
+                << pointer << " in " << doc;
+
+            JsonDocCache cache(1 << 20);
+            JsonDocCache::Scope scope(&cache);
+            EXPECT_EQ(Describe(json, JsonPointer(pointer)), expected)
+                << pointer << " in cached " << doc;
+        }
+    }
+}
+
+TEST(JsonPointerTest, NavigatesOnDemandDocuments) {
+    PaddedJson padded(kDocs[0]);
+    auto json = padded.json();
+    auto doc = json.doc();
+    auto value = JsonPointer("/b/c/5/d").Find(doc.value());
+    ASSERT_FALSE(value.error());
+    EXPECT_EQ(value.get_int64().value(), -3);
+
+    auto fresh = json.doc();
+    auto array = JsonPointer("/b/c").Find(fresh.value()).get_array();
+    ASSERT_FALSE(array.error());
+    EXPECT_EQ(array.count_elements().value(), 6);
+}
+
+TEST(JsonDocCacheTest, ParsesEachDocumentOnce) {
+    std::vector<PaddedJson> padded;
+    for (int i = 0; i < 10; i++) {
+        padded.emplace_back(R"({"x": )" + std::to_string(i) + "}");
+    }
+    JsonDocCache cache(1 << 20);
+    JsonDocCache::Scope scope(&cache);
+    JsonPointer x("/x");
+    for (int round = 0; round < 3; round++) {
+        for (int i = 0; i < 10; i++) {
+            EXPECT_EQ(padded[i].json().at<int64_t>(x).value(), i);
+        }
+    }
+    EXPECT_EQ(cache.size(), 10);
+
+    // leaving the scope stops caching
+    {
+        JsonDocCache::Scope none(nullptr);
+        EXPECT_EQ(JsonDocCache::Current(), nullptr);
+    }
+    EXPECT_EQ(JsonDocCache::Current(), &cache);
+}
+
+TEST(JsonDocCacheTest, RevalidatesReusedAddresses) {
+    std::string buffer(64, '\0');
+    JsonDocCache cache(1 << 20);
+    JsonDocCache::Scope scope(&cache);
+    JsonPointer x("/x");
+
+    std::memcpy(buffer.data(), R"({"x": 1})", 8);
+    EXPECT_EQ(Json(buffer.data(), 8).at<int64_t>(x).value(), 1);
+    // another document at the same address
+    std::memcpy(buffer.data(), R"({"x": 2})", 8);
+    EXPECT_EQ(Json(buffer.data(), 8).at<int64_t>(x).value(), 2);
+    EXPECT_EQ(cache.size(), 1);
+}
+
+TEST(JsonDocCacheTest, StopsCachingWhenFull) {
+    PaddedJson first(R"({"x": 1})");
+    PaddedJson second(R"({"x": 2})");
+    JsonDocCache probe(1 << 20);
+    ASSERT_TRUE(probe.Get(first.view()).has_value());
+
+    JsonDocCache cache(probe.ByteSize());
+    JsonDocCache::Scope scope(&cache);
+    JsonPointer x("/x");
+    EXPECT_EQ(first.json().at<int64_t>(x).value(), 1);
+    // read with the on demand parser instead
+    EXPECT_EQ(second.json().at<int64_t>(x).value(), 2);
+    EXPECT_EQ(cache.size(), 1);
+    EXPECT_EQ(cache.ByteSize(), probe.ByteSize());
+}
@@ -0,0 +1,213 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "simdjson.h"
+
+namespace milvus {
+
+// A JSON pointer split into its unescaped tokens once, so evaluating it on
+// every row walks the document field by field instead of parsing and
+// unescaping the pointer string again. Lookups fail the way simdjson's
+// at_pointer() does, callers only tell success from error.
+class JsonPointer {
+ public:
+    JsonPointer() = default;
+
+    explicit JsonPointer(std::string_view pointer) : pointer_(pointer) {
+        if (pointer.empty()) {
+            return;
+        }
+        if (pointer[0] != '/') {
+            error_ = simdjson::INVALID_JSON_POINTER;
+            return;
+        }
+        size_t begin = 1;
+        while (true) {
+            auto end = pointer.find('/', begin);
+            auto raw = pointer.substr(
+                begin, end == std::string_view::npos ? end : end - begin);
+            Token token;
+            if (!Unescape(raw, token.key)) {
+                error_ = simdjson::INVALID_JSON_POINTER;
+                return;
+            }
+            token.index_error = ParseIndex(raw, token.index);
+            tokens_.push_back(std::move(token));
+            if (end == std::string_view::npos) {
+                break;
+            }
+            begin = end + 1;
+        }
+    }
+
+    const std::string&
+    str() const {
+        return pointer_;
+    }
+
+    bool
+    empty() const {
+        return pointer_.empty();
+    }
+
+    simdjson::simdjson_result<simdjson::ondemand::value>
+    Find(simdjson::ondemand::document& doc) const {
+        if (error_ != simdjson::SUCCESS) {
+            return error_;
+        }
+        if (tokens_.empty()) {
+            return doc.get_value();
+        }
+        simdjson::ondemand::json_type type;
+        SIMDJSON_TRY(doc.type().get(type));
+        simdjson::simdjson_result<simdjson::ondemand::value> child;
+        const auto& first = tokens_[0];
+        switch (type) {
+            case simdjson::ondemand::json_type::object:
+                child = doc.get_object().find_field(first.key);
+                break;
+            case simdjson::ondemand::json_type::array:
+                if (first.index_error != simdjson::SUCCESS) {
+                    return first.index_error;
+                }
+                child = doc.get_array().at(first.index);
+                break;
+            default:
+                return simdjson::INVALID_JSON_POINTER;
+        }
+        for (size_t i = 1; i < tokens_.size() && !child.error(); i++) {
+            child = Step(child.value_unsafe(), tokens_[i]);
+        }
+        return child;
+    }
+
+    simdjson::simdjson_result<simdjson::ondemand::value>
+    Find(simdjson::simdjson_result<simdjson::ondemand::document>& doc) const {
+        SIMDJSON_TRY(doc.error());
+        return Find(doc.value_unsafe());
+    }
+
+    simdjson::simdjson_result<simdjson::dom::element>
+    Find(simdjson::dom::element element) const {
+        if (error_ != simdjson::SUCCESS) {
+            return error_;
+        }
+        simdjson::simdjson_result<simdjson::dom::element> child(
+            std::move(element));
+        for (size_t i = 0; i < tokens_.size() && !child.error(); i++) {
+            child = Step(child.value_unsafe(), tokens_[i]);
+        }
+        return child;
+    }
+
+ private:
+    struct Token {
+        std::string key;
+        // the position in an array, valid when index_error is SUCCESS
+        size_t index = 0;
+        simdjson::error_code index_error = simdjson::SUCCESS;
+    };
+
+    static bool
+    Unescape(std::string_view raw, std::string& key) {
+        key.reserve(raw.size());
+        for (size_t i = 0; i < raw.size(); i++) {
+            if (raw[i] != '~') {
+                key.push_back(raw[i]);
+                continue;
+            }
+            if (i + 1 == raw.size()) {
+                return false;
+            }
+            if (raw[i + 1] == '0') {
+                key.push_back('~');
+            } else if (raw[i + 1] == '1') {
+                key.push_back('/');
+            } else {
+                return false;
+            }
+            i++;
+        }
+        return true;
+    }
+
+    static simdjson::error_code
+    ParseIndex(std::string_view raw, size_t& index) {
+        // "-" is the position past the end, nothing can be read there
+        if (raw == "-") {
+            return simdjson::INDEX_OUT_OF_BOUNDS;
+        }
+        index = 0;
+        for (auto c : raw) {
+            auto digit = static_cast<uint8_t>(c - '0');
+            if (digit > 9) {
+                return simdjson::INCORRECT_TYPE;
+            }
+            index = index * 10 + digit;
+        }
+        if (raw.empty() || (raw.size() > 1 && raw[0] == '0')) {
+            return simdjson::INVALID_JSON_POINTER;
+        }
+        return simdjson::SUCCESS;
+    }
+
+    static simdjson::simdjson_result<simdjson::ondemand::value>
+    Step(simdjson::ondemand::value value, const Token& token) {
+        simdjson::ondemand::json_type type;
+        SIMDJSON_TRY(value.type().get(type));
+        switch (type) {
+            case simdjson::ondemand::json_type::object:
+                return value.get_object().find_field(token.key);
+            case simdjson::ondemand::json_type::array:
+                if (token.index_error != simdjson::SUCCESS) {
+                    return token.index_error;
+                }
+                return value.get_array().at(token.index);
+            default:
+                return simdjson::NO_SUCH_FIELD;
+        }
+    }
+
+    static simdjson::simdjson_result<simdjson::dom::element>
+    Step(simdjson::dom::element element, const Token& token) {
+        switch (element.type()) {
+            case simdjson::dom::element_type::OBJECT:
+                return element.get_object().value_unsafe().at_key(token.key);
+            case simdjson::dom::element_type::ARRAY:
+                if (token.index_error != simdjson::SUCCESS) {
+                    return token.index_error;
+                }
+                return element.get_array().value_unsafe().at(token.index);
+            default:
+                return simdjson::NO_SUCH_FIELD;
+        }
+    }
+
+    std::string pointer_;
+    std::vector<Token> tokens_;
+    simdjson::error_code error_ = simdjson::SUCCESS;
+};
+
+}  // namespace milvus
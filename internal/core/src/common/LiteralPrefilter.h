@@ -0,0 +1,176 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "common/Volnitsky.h"
+
+namespace milvus {
+
+/// Prefilter for pattern matching (regex, LIKE) built from the literals
+/// every match must contain: a string missing any of them is rejected
+/// without running the matcher.
+///
+/// For rows whose bytes are laid out back to back (the string views of a
+/// StringChunk), the longest literal is searched over the whole run at once
+/// instead of row by row, so the Volnitsky skip loop crosses the rows that
+/// cannot match without stopping at each of them. Only the rows holding an
+/// occurrence are checked for the other literals and handed to the matcher.
+class LiteralPrefilter {
+ public:
+    explicit LiteralPrefilter(const std::vector<std::string>& literals) {
+        // longest first: it is the most selective and gives Volnitsky the
+        // largest skips; literals contained in a kept one add nothing
+        std::vector<std::string> sorted(literals);
+        std::stable_sort(sorted.begin(),
+                         sorted.end(),
+                         [](const std::string& a, const std::string& b) {
+                             return a.size() > b.size();
+                         });
+        for (auto& literal : sorted) {
+            if (literal.empty()) {
+                continue;
+            }
+            bool redundant = std::any_of(
+                literals_.begin(),
+                literals_.end(),
+                [&](const std::string& kept) {
+                    return kept.find(literal) != std::string::npos;
+                });
+            if (!redundant) {
+                literals_.push_back(std::move(literal));
+            }
+        }
+        // the searchers keep pointers into literals_, which no longer grows
+        searchers_.reserve(literals_.size());
+        for (const auto& literal : literals_) {
+            searchers_.push_back(std::make_unique<VolnitskySearcher>(literal));
+        }
+    }
+
+    LiteralPrefilter(const LiteralPrefilter&) = delete;
+    LiteralPrefilter&
+    operator=(const LiteralPrefilter&) = delete;
+
+    bool
+    empty() const {
+        return searchers_.empty();
+    }
+
+    const std::vector<std::string>&
+    literals() const {
+        return literals_;
+    }
+
+    /// Whether `s` contains every literal.
+    bool
+    MayMatch(std::string_view s) const {
+        for (const auto& searcher : searchers_) {
+            if (!searcher->contains(s)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// Calls on_candidate(i), in increasing order of i, for each row of
+    /// src[0, size) that contains every literal.
+    template <typename T, typename Fn>
+    void
+    ForEachCandidate(const T* src, size_t size, Fn&& on_candidate) const {
+        if constexpr (!std::is_same_v<T, std::string_view>) {
+            for (size_t i = 0; i < size; ++i) {
+                if (MayMatch(src[i])) {
+                    on_candidate(i);
+                }
+            }
+        } else {
+            if (empty()) {
+                for (size_t i = 0; i < size; ++i) {
+                    on_candidate(i);
+                }
+                return;
+            }
+            size_t first = 0;
+            while (first < size) {
+                size_t last = first + 1;
+                while (last < size &&
+                       src[last].data() ==
+                           src[last - 1].data() + src[last - 1].size()) {
+                    ++last;
+                }
+                ScanContiguousRows(src, first, last, on_candidate);
+                first = last;
+            }
+        }
+    }
+
+ private:
+    // src[first, last) are back to back in memory
+    template <typename Fn>
+    void
+    ScanContiguousRows(const std::string_view* src,
+                       size_t first,
+                       size_t last,
+                       Fn& on_candidate) const {
+        const auto& lead = *searchers_.front();
+        const size_t lead_size = literals_.front().size();
+        const char* from = src[first].data();
+        const char* end = src[last - 1].data() + src[last - 1].size();
+        size_t row = first;
+        while (from < end) {
+            const char* hit = lead.find(
+                std::string_view(from, static_cast<size_t>(end - from)));
+            if (hit == nullptr) {
+                return;
+            }
+            while (src[row].data() + src[row].size() <= hit) {
+                ++row;
+            }
+            const char* row_end = src[row].data() + src[row].size();
+            // an occurrence crossing into the next row is not a match;
+            // any later start in this row would cross as well
+            if (hit + lead_size <= row_end && RestMayMatch(src[row])) {
+                on_candidate(row);
+            }
+            from = row_end;
+            ++row;
+        }
+    }
+
+    bool
+    RestMayMatch(std::string_view s) const {
+        for (size_t i = 1; i < searchers_.size(); ++i) {
+            if (!searchers_[i]->contains(s)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    std::vector<std::string> literals_;
+    std::vector<std::unique_ptr<VolnitskySearcher>> searchers_;
+};
+
+}  // namespace milvus
@@ -0,0 +1,134 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "common/LiteralPrefilter.h"
+#include "common/RegexQuery.h"
+#include "common/Volnitsky.h"
+
+using namespace milvus;
+
+namespace {
+
+// rows packed back to back the way a StringChunk stores them
+struct PackedRows {
+    std::string buffer;
+    std::vector<std::string_view> views;
+
+    explicit PackedRows(const std::vector<std::string>& rows) {
+        for (const auto& row : rows) {
+            buffer += row;
+        }
+        size_t offset = 0;
+        for (const auto& row : rows) {
+            views.emplace_back(buffer.data() + offset, row.size());
+            offset += row.size();
+        }
+    }
+};
+
+std::vector<size_t>
+Candidates(const LiteralPrefilter& prefilter,
+           const std::vector<std::string_view>& views) {
+    std::vector<size_t> out;
+    prefilter.ForEachCandidate(
+        views.data(), views.size(), [&](size_t row) { out.push_back(row); });
+    return out;
+}
+
+}  // namespace
+
+TEST(Volnitsky, FindReturnsLeftmostOccurrence) {
+    std::string haystack = "xxabcdabcdyyabcd";
+    VolnitskySearcher long_needle("abcd");
+    EXPECT_EQ(long_needle.find(haystack), haystack.data() + 2);
+    VolnitskySearcher repeated("cdab");
+    EXPECT_EQ(repeated.find(haystack), haystack.data() + 4);
+    VolnitskySearcher short_needle("yy");
+    EXPECT_EQ(short_needle.find(haystack), haystack.data() + 10);
+    VolnitskySearcher missing("abce");
+    EXPECT_EQ(missing.find(haystack), nullptr);
+    EXPECT_FALSE(missing.contains(haystack));
+
+    // several occurrences inside one skip window
+    std::string dense = "aaaaaaaaab";
+    VolnitskySearcher aaab("aaab");
+    EXPECT_EQ(aaab.find(dense), dense.data() + 6);
+}
+
+TEST(LiteralPrefilter, DropsRedundantLiterals) {
+    LiteralPrefilter prefilter({"error", "err", "", "timeout"});
+    EXPECT_EQ(prefilter.literals(),
+              (std::vector<std::string>{"timeout", "error"}));
+    EXPECT_TRUE(prefilter.MayMatch("error: timeout"));
+    EXPECT_FALSE(prefilter.MayMatch("error: refused"));
+    EXPECT_TRUE(LiteralPrefilter({}).empty());
+}
+
+TEST(LiteralPrefilter, SkipsOccurrencesAcrossRows) {
+    // "time" + "out" only meet across the row boundary
+    PackedRows rows({"read timeout", "time", "out", "", "timeout", "x"});
+    LiteralPrefilter prefilter({"timeout"});
+    EXPECT_EQ(Candidates(prefilter, rows.views),
+              (std::vector<size_t>{0, 4}));
+}
+
+TEST(LiteralPrefilter, MatchesRowByRowOnRandomRows) {
+    std::default_random_engine er(7);
+    std::uniform_int_distribution<int> len_dist(0, 12);
+    std::uniform_int_distribution<int> char_dist(0, 2);
+    std::vector<std::string> rows(2000);
+    for (auto& row : rows) {
+        auto len = len_dist(er);
+        for (int i = 0; i < len; ++i) {
+            row.push_back("abc"[char_dist(er)]);
+        }
+    }
+    PackedRows packed(rows);
+    // a copy per row: nothing is back to back, one run per row
+    std::vector<std::string_view> scattered(rows.begin(), rows.end());
+
+    for (const auto& literals :
+         std::vector<std::vector<std::string>>{{"ab"},
+                                               {"abca"},
+                                               {"bcab", "ca"},
+                                               {"aaaa", "bb"}}) {
+        LiteralPrefilter prefilter(literals);
+        std::vector<size_t> expected;
+        for (size_t i = 0; i < rows.size(); ++i) {
+            if (prefilter.MayMatch(rows[i])) {
+                expected.push_back(i);
+            }
+        }
+        EXPECT_EQ(Candidates(prefilter, packed.views), expected)
+            << literals[0];
+        EXPECT_EQ(Candidates(prefilter, scattered), expected) << literals[0];
+    }
+}
+
+TEST(LiteralPrefilter, LikePatternLiterals) {
+    EXPECT_EQ(LikePatternMatcher("%abc%d_ef%").RequiredLiterals(),
+              (std::vector<std::string>{"abc", "d", "ef"}));
+    EXPECT_EQ(LikePatternMatcher("a\\%b%").RequiredLiterals(),
+              (std::vector<std::string>{"a%b"}));
+    EXPECT_TRUE(LikePatternMatcher("%_%").RequiredLiterals().empty());
+}
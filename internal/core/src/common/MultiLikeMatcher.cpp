@@ -0,0 +1,210 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "common/MultiLikeMatcher.h"
+
+#include <algorithm>
+#include <deque>
+#include <unordered_map>
+
+#include "common/EasyAssert.h"
+#include "common/PatternMatcherCache.h"
+
+namespace milvus {
+
+AhoCorasick::AhoCorasick(const std::vector<std::string>& literals)
+    : num_literals_(literals.size()) {
+    for (const auto& literal : literals) {
+        AssertInfo(!literal.empty(), "aho-corasick literal must not be empty");
+        for (unsigned char c : literal) {
+            if (classes_[c] == 0) {
+                classes_[c] = num_classes_++;
+            }
+        }
+    }
+
+    // trie, children[state * num_classes_ + class], 0 for none: the root
+    // is never a child
+    std::vector<uint32_t> children(num_classes_, 0);
+    std::vector<std::vector<uint32_t>> own_outputs(1);
+    for (uint32_t id = 0; id < literals.size(); ++id) {
+        uint32_t state = 0;
+        for (unsigned char c : literals[id]) {
+            auto slot = state * num_classes_ + classes_[c];
+            if (children[slot] == 0) {
+                children[slot] = static_cast<uint32_t>(own_outputs.size());
+                own_outputs.emplace_back();
+                children.resize(children.size() + num_classes_, 0);
+            }
+            state = children[slot];
+        }
+        own_outputs[state].push_back(id);
+    }
+    const auto num_states = own_outputs.size();
+
+    // breadth first, so a state's failure link is done before its children
+    // and missing transitions borrow the ones of the failure state
+    next_.assign(num_states * num_classes_, 0);
+    std::vector<uint32_t> fail(num_states, 0);
+    std::vector<std::vector<uint32_t>> outputs(num_states);
+    std::deque<uint32_t> queue;
+    for (uint32_t c = 0; c < num_classes_; ++c) {
+        auto child = children[c];
+        next_[c] = child;
+        if (child != 0) {
+            queue.push_back(child);
+        }
+    }
+    while (!queue.empty()) {
+        auto state = queue.front();
+        queue.pop_front();
+        outputs[state] = own_outputs[state];
+        const auto& inherited = outputs[fail[state]];
+        outputs[state].insert(
+            outputs[state].end(), inherited.begin(), inherited.end());
+        for (uint32_t c = 0; c < num_classes_; ++c) {
+            auto child = children[state * num_classes_ + c];
+            auto fallback = next_[fail[state] * num_classes_ + c];
+            if (child == 0) {
+                next_[state * num_classes_ + c] = fallback;
+            } else {
+                next_[state * num_classes_ + c] = child;
+                fail[child] = fallback;
+                queue.push_back(child);
+            }
+        }
+    }
+
+    output_begin_.reserve(num_states + 1);
+    for (const auto& out : outputs) {
+        output_begin_.push_back(static_cast<uint32_t>(outputs_.size()));
+        outputs_.insert(outputs_.end(), out.begin(), out.end());
+    }
+    output_begin_.push_back(static_cast<uint32_t>(outputs_.size()));
+}
+
+MultiLikeMatcher::MultiLikeMatcher(
+    const std::vector<std::pair<Kind, std::string>>& patterns) {
+    std::unordered_map<std::string, uint32_t> literal_ids;
+    std::vector<std::string> literals;
+    auto add_literal = [&](Pattern& pattern, const std::string& literal) {
+        auto [it, inserted] = literal_ids.emplace(
+            literal, static_cast<uint32_t>(literals.size()));
+        if (inserted) {
+            literals.push_back(literal);
+            patterns_of_literal_.emplace_back();
+        }
+        auto& ids = pattern.literal_ids;
+        if (std::find(ids.begin(), ids.end(), it->second) == ids.end()) {
+            ids.push_back(it->second);
+            patterns_of_literal_[it->second].push_back(
+                static_cast<uint32_t>(patterns_.size()));
+        }
+    };
+
+    patterns_.reserve(patterns.size());
+    for (const auto& [kind, value] : patterns) {
+        Pattern pattern;
+        pattern.kind = kind;
+        if (kind == Kind::Like) {
+            pattern.like =
+                PatternMatcherCache::GetInstance().GetLikePatternMatcher(value);
+            for (const auto& literal : pattern.like->RequiredLiterals()) {
+                add_literal(pattern, literal);
+            }
+        } else if (value.empty()) {
+            // every string starts with, ends with and contains ""
+            always_match_ = true;
+        } else {
+            pattern.literal = value;
+            add_literal(pattern, value);
+        }
+        if (pattern.literal_ids.empty() && kind == Kind::Like) {
+            unfiltered_.push_back(static_cast<uint32_t>(patterns_.size()));
+        }
+        patterns_.push_back(std::move(pattern));
+    }
+
+    if (!literals.empty()) {
+        automaton_ = std::make_unique<AhoCorasick>(literals);
+        literal_seen_.assign(literals.size(), 0);
+    }
+}
+
+bool
+MultiLikeMatcher::Verify(const Pattern& pattern, std::string_view s) const {
+    switch (pattern.kind) {
+        case Kind::Like:
+            return (*pattern.like)(s);
+        case Kind::Prefix:
+            return s.size() >= pattern.literal.size() &&
+                   s.compare(0, pattern.literal.size(), pattern.literal) == 0;
+        case Kind::Postfix:
+            return s.size() >= pattern.literal.size() &&
+                   s.compare(s.size() - pattern.literal.size(),
+                             pattern.literal.size(),
+                             pattern.literal) == 0;
+        case Kind::Contains:
+            // only verified once its literal was found
+            return true;
+    }
+    return false;
+}
+
+bool
+MultiLikeMatcher::operator()(std::string_view s) {
+    if (always_match_) {
+        return true;
+    }
+    for (auto id : unfiltered_) {
+        if (Verify(patterns_[id], s)) {
+            return true;
+        }
+    }
+    if (automaton_ == nullptr) {
+        return false;
+    }
+
+    if (++row_stamp_ == 0) {
+        std::fill(literal_seen_.begin(), literal_seen_.end(), 0);
+        row_stamp_ = 1;
+    }
+    bool matched = false;
+    automaton_->ForEachMatch(s, [&](uint32_t literal) {
+        if (literal_seen_[literal] == row_stamp_) {
+            return true;
+        }
+        literal_seen_[literal] = row_stamp_;
+        // a pattern becomes a candidate when the last of its literals
+        // shows up, which happens once per row
+        for (auto id : patterns_of_literal_[literal]) {
+            const auto& pattern = patterns_[id];
+            bool complete = std::all_of(
+                pattern.literal_ids.begin(),
+                pattern.literal_ids.end(),
+                [&](uint32_t l) { return literal_seen_[l] == row_stamp_; });
+            if (complete && Verify(pattern, s)) {
+                matched = true;
+                return false;
+            }
+        }
+        return true;
+    });
+    return matched;
+}
+
+}  // namespace milvus
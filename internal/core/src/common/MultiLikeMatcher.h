@@ -0,0 +1,119 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "common/RegexQuery.h"
+
+namespace milvus {
+
+/// Aho-Corasick automaton over a set of literals: one pass over a text
+/// reports every occurrence of every literal. Transitions are resolved into
+/// a dense table over the bytes the literals use (all other bytes share one
+/// class), so each text byte costs one table lookup.
+class AhoCorasick {
+ public:
+    explicit AhoCorasick(const std::vector<std::string>& literals);
+
+    size_t
+    size() const {
+        return num_literals_;
+    }
+
+    /// Calls on_match(literal_index) for each occurrence in `text`, in the
+    /// order their ends appear; stops as soon as on_match returns false.
+    template <typename Fn>
+    void
+    ForEachMatch(std::string_view text, Fn&& on_match) const {
+        uint32_t state = 0;
+        for (unsigned char c : text) {
+            state = next_[state * num_classes_ + classes_[c]];
+            for (auto k = output_begin_[state]; k < output_begin_[state + 1];
+                 ++k) {
+                if (!on_match(outputs_[k])) {
+                    return;
+                }
+            }
+        }
+    }
+
+ private:
+    size_t num_literals_{0};
+    std::array<uint16_t, 256> classes_{};
+    uint32_t num_classes_{1};
+    std::vector<uint32_t> next_;
+    // outputs_[output_begin_[s], output_begin_[s + 1]) end at state s
+    std::vector<uint32_t> output_begin_;
+    std::vector<uint32_t> outputs_;
+};
+
+/// Evaluates a disjunction of LIKE style predicates on one string column in
+/// a single pass per row: the literals of all patterns are searched at once
+/// by an AhoCorasick automaton, and only the patterns whose literals all
+/// occur are verified, until one of them matches.
+class MultiLikeMatcher {
+ public:
+    enum class Kind {
+        Like,      // SQL LIKE pattern with % and _ wildcards
+        Prefix,    // starts with the literal
+        Postfix,   // ends with the literal
+        Contains,  // contains the literal
+    };
+
+    explicit MultiLikeMatcher(
+        const std::vector<std::pair<Kind, std::string>>& patterns);
+
+    /// Whether `s` matches any of the patterns. Not thread safe, the
+    /// matcher keeps per call scratch state.
+    bool
+    operator()(std::string_view s);
+
+ private:
+    struct Pattern {
+        Kind kind;
+        std::string literal;  // for all kinds but Like
+        std::shared_ptr<const LikePatternMatcher> like;
+        std::vector<uint32_t> literal_ids;
+    };
+
+    bool
+    Verify(const Pattern& pattern, std::string_view s) const;
+
+    bool always_match_{false};
+    std::vector<Pattern> patterns_;
+    // patterns with no literal to look for, verified on every row
+    std::vector<uint32_t> unfiltered_;
+    // for each literal, the patterns requiring it
+    std::vector<std::vector<uint32_t>> patterns_of_literal_;
+    std::unique_ptr<AhoCorasick> automaton_;
+
+    // scratch: each row stamps the literals it contains, so nothing needs
+    // clearing between rows
+    uint32_t row_stamp_{0};
+    std::vector<uint32_t> literal_seen_;
+};
+
+}  // namespace milvus
@@ -0,0 +1,124 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "common/MultiLikeMatcher.h"
+#include "common/RegexQuery.h"
+
+using namespace milvus;
+using Kind = MultiLikeMatcher::Kind;
+
+namespace {
+
+bool
+MatchOne(Kind kind, const std::string& value, const std::string& s) {
+    switch (kind) {
+        case Kind::Like:
+            return LikePatternMatcher(value)(s);
+        case Kind::Prefix:
+            return s.rfind(value, 0) == 0;
+        case Kind::Postfix:
+            return s.size() >= value.size() &&
+                   s.compare(s.size() - value.size(), value.size(), value) ==
+                       0;
+        case Kind::Contains:
+            return s.find(value) != std::string::npos;
+    }
+    return false;
+}
+
+}  // namespace
+
+TEST(AhoCorasickTest, ReportsEveryOccurrence) {
+    AhoCorasick automaton({"he", "she", "his", "hers"});
+    std::vector<uint32_t> found;
+    automaton.ForEachMatch("ushers", [&](uint32_t id) {
+        found.push_back(id);
+        return true;
+    });
+    // "she" and "he" end at the same byte, then "hers"
+    ASSERT_EQ(found.size(), 3);
+    EXPECT_EQ(found[0], 1);
+    EXPECT_EQ(found[1], 0);
+    EXPECT_EQ(found[2], 3);
+
+    found.clear();
+    automaton.ForEachMatch("ushers", [&](uint32_t id) {
+        found.push_back(id);
+        return false;
+    });
+    EXPECT_EQ(found.size(), 1);
+}
+
+TEST(MultiLikeMatcherTest, MatchesAnyPattern) {
+    MultiLikeMatcher matcher({{Kind::Contains, "foo"},
+                              {Kind::Like, "%ba_r%baz"},
+                              {Kind::Prefix, "pre"},
+                              {Kind::Postfix, "post"}});
+    EXPECT_TRUE(matcher("xxfooxx"));
+    EXPECT_TRUE(matcher("a baxr and baz"));
+    EXPECT_FALSE(matcher("a baxr and baz!"));
+    EXPECT_TRUE(matcher("prefix"));
+    EXPECT_FALSE(matcher("a prefix"));
+    EXPECT_TRUE(matcher("a post"));
+    EXPECT_FALSE(matcher("a poster"));
+    EXPECT_FALSE(matcher(""));
+
+    MultiLikeMatcher wildcard({{Kind::Contains, "foo"}, {Kind::Like, "___"}});
+    EXPECT_TRUE(wildcard("abc"));
+    EXPECT_FALSE(wildcard("ab"));
+
+    MultiLikeMatcher empty_prefix({{Kind::Prefix, ""}, {Kind::Like, "x"}});
+    EXPECT_TRUE(empty_prefix("anything"));
+}
+
+TEST(MultiLikeMatcherTest, AgreesWithSinglePatterns) {
+    std::mt19937 rng(7);
+    const std::string alphabet = "abc%_";
+    auto random_string = [&](size_t max_len, size_t alphabet_size) {
+        std::string s(rng() % (max_len + 1), ' ');
+        for (auto& c : s) {
+            c = alphabet[rng() % alphabet_size];
+        }
+        return s;
+    };
+    for (int round = 0; round < 200; ++round) {
+        std::vector<std::pair<Kind, std::string>> patterns;
+        auto num_patterns = 2 + rng() % 6;
+        for (size_t i = 0; i < num_patterns; ++i) {
+            auto kind = static_cast<Kind>(rng() % 4);
+            // only LIKE patterns carry wildcards
+            auto value = random_string(4, kind == Kind::Like ? 5 : 3);
+            patterns.emplace_back(kind, value);
+        }
+        MultiLikeMatcher matcher(patterns);
+        for (int row = 0; row < 50; ++row) {
+            auto s = random_string(10, 3);
+            bool expected = false;
+            for (const auto& [kind, value] : patterns) {
+                expected = expected || MatchOne(kind, value, s);
+            }
+            ASSERT_EQ(matcher(s), expected) << "row: " << s;
+        }
+    }
+}
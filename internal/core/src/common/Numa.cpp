@@ -0,0 +1,171 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "common/Numa.h"
+
+#include <exception>
+#include <fstream>
+#include <sstream>
+#include <utility>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "common/Common.h"
+#include "log/Log.h"
+
+namespace milvus {
+
+namespace {
+
+constexpr const char* kSysNodeDir = "/sys/devices/system/node";
+
+#ifdef __linux__
+// from linux/mempolicy.h
+constexpr int kMpolDefault = 0;
+constexpr int kMpolPreferred = 1;
+#endif
+
+std::string
+ReadLine(const std::string& path) {
+    std::ifstream in(path);
+    std::string line;
+    std::getline(in, line);
+    return line;
+}
+
+}  // namespace
+
+const NumaTopology&
+NumaTopology::Get() {
+    static NumaTopology topology(kSysNodeDir);
+    return topology;
+}
+
+NumaTopology::NumaTopology(const std::string& node_dir) {
+    for (auto id : ParseList(ReadLine(node_dir + "/online"))) {
+        auto cpus = ParseList(ReadLine(node_dir + "/node" +
+                                       std::to_string(id) + "/cpulist"));
+        if (!cpus.empty()) {
+            node_cpus_.push_back(std::move(cpus));
+            node_ids_.push_back(id);
+        }
+    }
+    if (node_cpus_.empty()) {
+        // unknown layout, searches and loads keep the global executors
+        node_cpus_.emplace_back();
+        node_ids_.push_back(0);
+    }
+}
+
+bool
+NumaTopology::HomesSegments() const {
+    return ENABLE_NUMA_AWARE_EXECUTION.load() && NumNodes() > 1;
+}
+
+int
+NumaTopology::HomeNode(int64_t segment_id) const {
+    if (!HomesSegments()) {
+        return -1;
+    }
+    auto nodes = static_cast<int64_t>(NumNodes());
+    return static_cast<int>(((segment_id % nodes) + nodes) % nodes);
+}
+
+std::vector<int>
+NumaTopology::ParseList(const std::string& list) {
+    std::vector<int> ids;
+    std::stringstream ss(list);
+    std::string range;
+    while (std::getline(ss, range, ',')) {
+        if (range.empty()) {
+            continue;
+        }
+        try {
+            auto dash = range.find('-');
+            auto first = std::stoi(range.substr(0, dash));
+            auto last = dash == std::string::npos
+                            ? first
+                            : std::stoi(range.substr(dash + 1));
+            for (auto id = first; id <= last; id++) {
+                ids.push_back(id);
+            }
+        } catch (const std::exception&) {
+            // a malformed list is treated as an empty one
+            return {};
+        }
+    }
+    return ids;
+}
+
+bool
+BindCurrentThread(const std::vector<int>& cpus) {
+#ifdef __linux__
+    if (cpus.empty()) {
+        return false;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (auto cpu : cpus) {
+        if (cpu >= 0 && cpu < CPU_SETSIZE) {
+            CPU_SET(cpu, &set);
+        }
+    }
+    auto ret = pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    if (ret != 0) {
+        LOG_WARN("failed to bind thread to numa node cores, error: {}", ret);
+    }
+    return ret == 0;
+#else
+    return false;
+#endif
+}
+
+ScopedPreferredNode::ScopedPreferredNode(int node) {
+#ifdef __linux__
+    auto& topology = NumaTopology::Get();
+    if (node < 0 || static_cast<size_t>(node) >= topology.NumNodes()) {
+        return;
+    }
+    // the nodes of a host fit in one word
+    unsigned long mask = 0;
+    auto id = topology.NodeId(node);
+    if (id < 0 || id >= static_cast<int>(sizeof(mask) * 8)) {
+        return;
+    }
+    mask = 1UL << id;
+    set_ = syscall(SYS_set_mempolicy,
+                   kMpolPreferred,
+                   &mask,
+                   sizeof(mask) * 8) == 0;
+#else
+    (void)node;
+#endif
+}
+
+ScopedPreferredNode::~ScopedPreferredNode() {
+#ifdef __linux__
+    if (set_) {
+        syscall(SYS_set_mempolicy, kMpolDefault, nullptr, 0);
+    }
+#endif
+}
+
+}  // namespace milvus
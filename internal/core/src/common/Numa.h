@@ -0,0 +1,102 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace milvus {
+
+// The NUMA nodes of the host and their cores, as listed under
+// /sys/devices/system/node. A host without that directory, e.g. one that is
+// not Linux, is seen as a single node.
+//
+// While NUMA aware execution is enabled and the host has several nodes,
+// every segment gets a home node: the segment is loaded by threads bound to
+// that node, so that its memory is faulted in there, and it is searched by
+// the threads of that node, so that the searches read local memory.
+class NumaTopology {
+ public:
+    // The topology of this host, read once.
+    static const NumaTopology&
+    Get();
+
+    // Reads the topology under `node_dir`, which is laid out like
+    // /sys/devices/system/node.
+    explicit NumaTopology(const std::string& node_dir);
+
+    size_t
+    NumNodes() const {
+        return node_cpus_.size();
+    }
+
+    // The cores of the `node`-th node.
+    const std::vector<int>&
+    NodeCpus(size_t node) const {
+        return node_cpus_[node];
+    }
+
+    // The sysfs id of the `node`-th node.
+    int
+    NodeId(size_t node) const {
+        return node_ids_[node];
+    }
+
+    // Whether NUMA aware execution is on and there are several nodes to
+    // home segments on.
+    bool
+    HomesSegments() const;
+
+    // The home node of `segment_id`, -1 unless HomesSegments().
+    int
+    HomeNode(int64_t segment_id) const;
+
+    // Parses a sysfs cpu or node list such as "0-23,48-71".
+    static std::vector<int>
+    ParseList(const std::string& list);
+
+ private:
+    // by node, nodes without cores are left out
+    std::vector<std::vector<int>> node_cpus_;
+    // the sysfs id of each node
+    std::vector<int> node_ids_;
+};
+
+// Binds the calling thread to `cpus`. Returns false when it could not.
+bool
+BindCurrentThread(const std::vector<int>& cpus);
+
+// Makes the pages the calling thread faults in come from the `node`-th node
+// while the scope lasts, falling back to the other nodes when it is full.
+// A `node` of -1 leaves the memory policy alone.
+class ScopedPreferredNode {
+ public:
+    explicit ScopedPreferredNode(int node);
+
+    ~ScopedPreferredNode();
+
+    ScopedPreferredNode(const ScopedPreferredNode&) = delete;
+    ScopedPreferredNode&
+    operator=(const ScopedPreferredNode&) = delete;
+
+ private:
+    bool set_{false};
+};
+
+}  // namespace milvus
@@ -0,0 +1,103 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include "common/Common.h"
+#include "common/Numa.h"
+
+using milvus::NumaTopology;
+
+namespace {
+
+void
+WriteFile(const std::filesystem::path& path, const std::string& content) {
+    std::filesystem::create_directories(path.parent_path());
+    std::ofstream(path) << content << "\n";
+}
+
+}  // namespace
+
+class NumaTest : public testing::Test {
+ protected:
+    void
+    SetUp() override {
+        dir_ = std::filesystem::temp_directory_path() /
+               ("numa_test_" + std::to_string(getpid()));
+        std::filesystem::remove_all(dir_);
+    }
+
+    void
+    TearDown() override {
+        std::filesystem::remove_all(dir_);
+        milvus::SetDefaultEnableNumaAwareExecution(false);
+    }
+
+    std::filesystem::path dir_;
+};
+
+TEST_F(NumaTest, ParsesLists) {
+    EXPECT_EQ(NumaTopology::ParseList("0-3,8,10-11"),
+              (std::vector<int>{0, 1, 2, 3, 8, 10, 11}));
+    EXPECT_EQ(NumaTopology::ParseList("5"), std::vector<int>{5});
+    EXPECT_TRUE(NumaTopology::ParseList("").empty());
+    EXPECT_TRUE(NumaTopology::ParseList("0-x").empty());
+}
+
+TEST_F(NumaTest, ReadsNodesWithCores) {
+    WriteFile(dir_ / "online", "0-2");
+    WriteFile(dir_ / "node0" / "cpulist", "0-1,4-5");
+    // a memory only node
+    WriteFile(dir_ / "node1" / "cpulist", "");
+    WriteFile(dir_ / "node2" / "cpulist", "2-3,6-7");
+
+    NumaTopology topology(dir_.string());
+    ASSERT_EQ(topology.NumNodes(), 2);
+    EXPECT_EQ(topology.NodeCpus(0), (std::vector<int>{0, 1, 4, 5}));
+    EXPECT_EQ(topology.NodeCpus(1), (std::vector<int>{2, 3, 6, 7}));
+    EXPECT_EQ(topology.NodeId(1), 2);
+}
+
+TEST_F(NumaTest, HomesSegmentsOnlyWhenEnabled) {
+    WriteFile(dir_ / "online", "0-1");
+    WriteFile(dir_ / "node0" / "cpulist", "0-1");
+    WriteFile(dir_ / "node1" / "cpulist", "2-3");
+    NumaTopology topology(dir_.string());
+
+    EXPECT_FALSE(topology.HomesSegments());
+    EXPECT_EQ(topology.HomeNode(7), -1);
+
+    milvus::SetDefaultEnableNumaAwareExecution(true);
+    EXPECT_TRUE(topology.HomesSegments());
+    EXPECT_EQ(topology.HomeNode(6), 0);
+    EXPECT_EQ(topology.HomeNode(7), 1);
+    EXPECT_EQ(topology.HomeNode(-3), 1);
+}
+
+TEST_F(NumaTest, UnknownLayoutIsOneNode) {
+    NumaTopology topology((dir_ / "missing").string());
+    EXPECT_EQ(topology.NumNodes(), 1);
+
+    milvus::SetDefaultEnableNumaAwareExecution(true);
+    EXPECT_FALSE(topology.HomesSegments());
+    EXPECT_EQ(topology.HomeNode(7), -1);
+}
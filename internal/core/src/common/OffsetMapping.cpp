@@ -1,10 +1,12 @@
 #include "common/OffsetMapping.h"
 
 #include <algorithm>
+#include <cstring>
 #include <mutex>
 #include <shared_mutex>
 #include <utility>
 
+#include "common/BitUtil.h"
 #include "common/EasyAssert.h"
 
 namespace milvus {
@@ -63,6 +65,24 @@ OffsetMapping::GetTotalCount() const {
     return 0;
 }
 
+void
+OffsetMapping::LogicalToPhysical(const int64_t* logical,
+                                 int64_t count,
+                                 int64_t* physical) const {
+    for (int64_t i = 0; i < count; ++i) {
+        physical[i] = GetPhysicalOffset(logical[i]);
+    }
+}
+
+void
+OffsetMapping::PhysicalToLogical(const int64_t* physical,
+                                 int64_t count,
+                                 int64_t* logical) const {
+    for (int64_t i = 0; i < count; ++i) {
+        logical[i] = GetLogicalOffset(physical[i]);
+    }
+}
+
 OffsetMapping::BitsetTransformStatus
 OffsetMapping::TransformBitset(const BitsetView& bitset,
                                TargetBitmap& result) const {
@@ -100,57 +120,37 @@ OffsetMapping::FilterValidLogicalOffsets(
 
 void
 SealedOffsetMapping::Build(const bool* valid_data, int64_t total_count) {
-    constexpr int64_t start_logical = 0;
-    constexpr int64_t start_physical = 0;
     if (total_count == 0 || valid_data == nullptr) {
         return;
     }
 
     enabled_ = true;
-    total_count_ = start_logical + total_count;
-    valid_count_ = 0;
-    l2p_vec_.clear();
-    p2l_vec_.clear();
-    l2p_map_.clear();
-    p2l_map_.clear();
+    total_count_ = total_count;
+    const auto words = (total_count + 63) / 64;
+    valid_words_.assign(words, 0);
+    rank_.assign(words + 1, 0);
+    select_samples_.clear();
 
     int64_t valid_count = 0;
-    for (int64_t i = 0; i < total_count; ++i) {
-        if (valid_data[i]) {
-            ++valid_count;
-        }
-    }
-
-    use_map_ = valid_count * 10 < total_count;
-
-    if (use_map_) {
-        int64_t physical_idx = start_physical;
-        for (int64_t i = 0; i < total_count; ++i) {
-            if (valid_data[i]) {
-                l2p_map_[start_logical + i] = physical_idx;
-                p2l_map_[physical_idx] = start_logical + i;
-                ++physical_idx;
-            }
+    for (int64_t w = 0; w < words; ++w) {
+        const auto begin = w * 64;
+        const auto end = std::min(begin + 64, total_count);
+        uint64_t word = 0;
+        for (auto i = begin; i < end; ++i) {
+            word |= static_cast<uint64_t>(valid_data[i]) << (i - begin);
         }
-    } else {
-        const int64_t required_size = start_logical + total_count;
-        l2p_vec_.resize(required_size, -1);
-
-        const int64_t required_p2l_size = start_physical + valid_count;
-        p2l_vec_.resize(required_p2l_size, -1);
-
-        int64_t physical_idx = start_physical;
-        for (int64_t i = 0; i < total_count; ++i) {
-            if (valid_data[i]) {
-                l2p_vec_[start_logical + i] = physical_idx;
-                p2l_vec_[physical_idx] = start_logical + i;
-                ++physical_idx;
-            } else {
-                l2p_vec_[start_logical + i] = -1;
-            }
+        valid_words_[w] = word;
+        rank_[w] = static_cast<uint32_t>(valid_count);
+        const auto next = valid_count + __builtin_popcountll(word);
+        // the words holding physical offsets k * kSelectSample
+        for (auto k = static_cast<int64_t>(select_samples_.size());
+             k * kSelectSample < next;
+             ++k) {
+            select_samples_.push_back(static_cast<uint32_t>(w));
         }
+        valid_count = next;
     }
-
+    rank_[words] = static_cast<uint32_t>(valid_count);
     valid_count_ = valid_count;
 }
 
@@ -167,13 +167,13 @@ SealedOffsetMapping::GetPhysicalOffsetInternal(int64_t logical_offset) const {
     if (logical_offset < 0 || logical_offset >= total_count_) {
         return -1;
     }
-    if (use_map_) {
-        auto it = l2p_map_.find(static_cast<int32_t>(logical_offset));
-        return it == l2p_map_.end() ? -1 : it->second;
+    const auto word = valid_words_[logical_offset >> 6];
+    const auto bit = logical_offset & 63;
+    if (((word >> bit) & 1) == 0) {
+        return -1;
     }
-    return logical_offset < static_cast<int64_t>(l2p_vec_.size())
-               ? l2p_vec_[logical_offset]
-               : -1;
+    const auto lower = word & ((uint64_t{1} << bit) - 1);
+    return rank_[logical_offset >> 6] + __builtin_popcountll(lower);
 }
 
 int64_t
@@ -181,6 +181,21 @@ SealedOffsetMapping::GetLogicalOffset(int64_t physical_offset) const {
     return GetLogicalOffsetInternal(physical_offset);
 }
 
+int64_t
+SealedOffsetMapping::SelectWord(int64_t physical_offset) const {
+    // the samples bound the search to the words between two of them
+    const auto sample = physical_offset / kSelectSample;
+    const int64_t lo = select_samples_[sample];
+    const int64_t hi =
+        sample + 1 < static_cast<int64_t>(select_samples_.size())
+            ? select_samples_[sample + 1]
+            : static_cast<int64_t>(valid_words_.size()) - 1;
+    auto it = std::upper_bound(rank_.begin() + lo + 1,
+                               rank_.begin() + hi + 1,
+                               static_cast<uint32_t>(physical_offset));
+    return (it - rank_.begin()) - 1;
+}
+
 int64_t
 SealedOffsetMapping::GetLogicalOffsetInternal(int64_t physical_offset) const {
     if (!enabled_) {
@@ -189,13 +204,9 @@ SealedOffsetMapping::GetLogicalOffsetInternal(int64_t physical_offset) const {
     if (physical_offset < 0 || physical_offset >= valid_count_) {
         return -1;
     }
-    if (use_map_) {
-        auto it = p2l_map_.find(static_cast<int32_t>(physical_offset));
-        return it == p2l_map_.end() ? -1 : it->second;
-    }
-    return physical_offset < static_cast<int64_t>(p2l_vec_.size())
-               ? p2l_vec_[physical_offset]
-               : -1;
+    const auto word = SelectWord(physical_offset);
+    return word * 64 + bits::selectBit(valid_words_[word],
+                                       physical_offset - rank_[word]);
 }
 
 int64_t
@@ -213,6 +224,56 @@ SealedOffsetMapping::GetTotalCount() const {
     return total_count_;
 }
 
+void
+SealedOffsetMapping::LogicalToPhysical(const int64_t* logical,
+                                       int64_t count,
+                                       int64_t* physical) const {
+    for (int64_t i = 0; i < count; ++i) {
+        physical[i] = GetPhysicalOffsetInternal(logical[i]);
+    }
+}
+
+void
+SealedOffsetMapping::PhysicalToLogical(const int64_t* physical,
+                                       int64_t count,
+                                       int64_t* logical) const {
+    if (!enabled_) {
+        std::copy_n(physical, count, logical);
+        return;
+    }
+    // ascending offsets, as in results sorted by offset, mostly stay in the
+    // word of the previous one
+    int64_t word = -1;
+    for (int64_t i = 0; i < count; ++i) {
+        const auto offset = physical[i];
+        if (offset < 0 || offset >= valid_count_) {
+            logical[i] = -1;
+            continue;
+        }
+        if (word < 0 || offset < rank_[word] || offset >= rank_[word + 1]) {
+            word = SelectWord(offset);
+        }
+        logical[i] = word * 64 + bits::selectBit(valid_words_[word],
+                                                 offset - rank_[word]);
+    }
+}
+
+uint64_t
+SealedOffsetMapping::LoadFilterWord(const BitsetView& bitset, int64_t word) {
+    const auto size = static_cast<int64_t>(bitset.size());
+    const auto begin = word * 64;
+    if (begin >= size) {
+        return ~uint64_t{0};
+    }
+    uint64_t bits = 0;
+    const auto bytes = std::min<int64_t>(8, (size - begin + 7) / 8);
+    std::memcpy(&bits, bitset.data() + word * 8, bytes);
+    if (size - begin < 64) {
+        bits |= ~uint64_t{0} << (size - begin);
+    }
+    return bits;
+}
+
 OffsetMapping::BitsetTransformStatus
 SealedOffsetMapping::TransformBitset(const BitsetView& bitset,
                                      TargetBitmap& result) const {
@@ -225,25 +286,36 @@ SealedOffsetMapping::TransformBitset(const BitsetView& bitset,
         return status;
     }
 
-    result.resize(valid_count_, true);
-    if (use_map_) {
-        for (int64_t physical_idx = 0; physical_idx < valid_count_;
-             ++physical_idx) {
-            auto it = p2l_map_.find(static_cast<int32_t>(physical_idx));
-            if (it != p2l_map_.end() &&
-                it->second < static_cast<int64_t>(bitset.size())) {
-                result[physical_idx] = bitset.test(it->second);
-            }
-        }
-    } else {
+    if (bitset.has_out_ids()) {
+        result.resize(valid_count_, true);
+        const auto size = static_cast<int64_t>(bitset.size());
         for (int64_t physical_idx = 0; physical_idx < valid_count_;
              ++physical_idx) {
-            auto logical_idx = p2l_vec_[physical_idx];
-            if (logical_idx >= 0 &&
-                logical_idx < static_cast<int64_t>(bitset.size())) {
+            auto logical_idx = GetLogicalOffsetInternal(physical_idx);
+            if (logical_idx < size) {
                 result[physical_idx] = bitset.test(logical_idx);
             }
         }
+        return BitsetTransformStatus::Transformed;
+    }
+
+    // compact every filter word to the bits of its valid rows and append
+    // them at the physical offset of the first one
+    result.resize(valid_count_, false);
+    auto* out = result.data();
+    for (int64_t w = 0; w < static_cast<int64_t>(valid_words_.size()); ++w) {
+        const auto valid = valid_words_[w];
+        if (valid == 0) {
+            continue;
+        }
+        const auto compact =
+            bits::extractBits<uint64_t>(LoadFilterWord(bitset, w), valid);
+        const int64_t position = rank_[w];
+        const auto shift = position & 63;
+        out[position >> 6] |= compact << shift;
+        if (shift + __builtin_popcountll(valid) > 64) {
+            out[(position >> 6) + 1] |= compact >> (64 - shift);
+        }
     }
     return BitsetTransformStatus::Transformed;
 }
@@ -253,11 +325,7 @@ SealedOffsetMapping::TransformOffsets(std::vector<int64_t>& offsets) const {
     if (!enabled_) {
         return;
     }
-    for (auto& offset : offsets) {
-        if (offset >= 0) {
-            offset = GetLogicalOffsetInternal(offset);
-        }
-    }
+    PhysicalToLogical(offsets.data(), offsets.size(), offsets.data());
 }
 
 void
@@ -266,11 +334,7 @@ SealedOffsetMapping::TransformLogicalOffsets(
     if (!enabled_) {
         return;
     }
-    for (auto& offset : offsets) {
-        if (offset >= 0) {
-            offset = GetPhysicalOffsetInternal(offset);
-        }
-    }
+    LogicalToPhysical(offsets.data(), offsets.size(), offsets.data());
 }
 
 void
@@ -386,6 +450,36 @@ GrowingOffsetMapping::GetTotalCount() const {
     return total_count_;
 }
 
+void
+GrowingOffsetMapping::LogicalToPhysical(const int64_t* logical,
+                                        int64_t count,
+                                        int64_t* physical) const {
+    std::shared_lock lock(mutex_);
+    if (!enabled_) {
+        std::copy_n(logical, count, physical);
+        return;
+    }
+    const auto total_count = total_count_;
+    for (int64_t i = 0; i < count; ++i) {
+        physical[i] = GetPhysicalOffsetInternal(logical[i], total_count);
+    }
+}
+
+void
+GrowingOffsetMapping::PhysicalToLogical(const int64_t* physical,
+                                        int64_t count,
+                                        int64_t* logical) const {
+    std::shared_lock lock(mutex_);
+    if (!enabled_) {
+        std::copy_n(physical, count, logical);
+        return;
+    }
+    const auto valid_count = valid_count_;
+    for (int64_t i = 0; i < count; ++i) {
+        logical[i] = GetLogicalOffsetInternal(physical[i], valid_count);
+    }
+}
+
 OffsetMapping::BitsetTransformStatus
 GrowingOffsetMapping::TransformBitset(const BitsetView& bitset,
                                       TargetBitmap& result) const {
@@ -65,6 +65,20 @@ class OffsetMapping {
     virtual int64_t
     GetTotalCount() const;
 
+    // Batch GetPhysicalOffset: physical[i] is the physical offset of
+    // logical[i], or -1 if it is null. The arrays may alias.
+    virtual void
+    LogicalToPhysical(const int64_t* logical,
+                      int64_t count,
+                      int64_t* physical) const;
+
+    // Batch GetLogicalOffset: logical[i] is the logical offset of
+    // physical[i], or -1 if not found. The arrays may alias.
+    virtual void
+    PhysicalToLogical(const int64_t* physical,
+                      int64_t count,
+                      int64_t* logical) const;
+
     virtual BitsetTransformStatus
     TransformBitset(const BitsetView& bitset, TargetBitmap& result) const;
 
@@ -101,6 +115,16 @@ class SealedOffsetMapping final : public OffsetMapping {
     int64_t
     GetTotalCount() const override;
 
+    void
+    LogicalToPhysical(const int64_t* logical,
+                      int64_t count,
+                      int64_t* physical) const override;
+
+    void
+    PhysicalToLogical(const int64_t* physical,
+                      int64_t count,
+                      int64_t* logical) const override;
+
     BitsetTransformStatus
     TransformBitset(const BitsetView& bitset,
                     TargetBitmap& result) const override;
@@ -125,15 +149,25 @@ class SealedOffsetMapping final : public OffsetMapping {
     int64_t
     GetLogicalOffsetInternal(int64_t physical_offset) const;
 
-    bool enabled_{false};
-    bool use_map_{false};
-    // Sealed vec mode storage (uses int32_t to save memory)
-    std::vector<int32_t> l2p_vec_;  // logical -> physical, -1 means null
-    std::vector<int32_t> p2l_vec_;  // physical -> logical
+    // the word of valid_words_ holding the n-th valid row
+    int64_t
+    SelectWord(int64_t physical_offset) const;
 
-    // Sealed map mode storage (for sparse valid data)
-    std::unordered_map<int32_t, int32_t> l2p_map_;  // logical -> physical
-    std::unordered_map<int32_t, int32_t> p2l_map_;  // physical -> logical
+    // the filter bits of logical rows [64 * word, 64 * word + 64), rows past
+    // the end of the bitset read as filtered
+    static uint64_t
+    LoadFilterWord(const BitsetView& bitset, int64_t word);
+
+    // physical offset k * kSelectSample lies in word select_samples_[k]
+    static constexpr int64_t kSelectSample = 512;
+
+    bool enabled_{false};
+    // Rank/select over the valid bitmap: the physical offset of a valid row
+    // is the number of valid rows before it, rank_[w] counts the valid rows
+    // in the words before w. This takes about 1.5 bits per row.
+    std::vector<uint64_t> valid_words_;
+    std::vector<uint32_t> rank_;
+    std::vector<uint32_t> select_samples_;
 
     int64_t valid_count_{0};
     int64_t total_count_{0};  // total logical count (including nulls)
@@ -162,6 +196,16 @@ class GrowingOffsetMapping final : public OffsetMapping {
     int64_t
     GetTotalCount() const override;
 
+    void
+    LogicalToPhysical(const int64_t* logical,
+                      int64_t count,
+                      int64_t* physical) const override;
+
+    void
+    PhysicalToLogical(const int64_t* physical,
+                      int64_t count,
+                      int64_t* logical) const override;
+
     BitsetTransformStatus
     TransformBitset(const BitsetView& bitset,
                     TargetBitmap& result) const override;
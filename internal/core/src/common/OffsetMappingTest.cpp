@@ -11,6 +11,7 @@
 
 #include <gtest/gtest.h>
 
+#include <random>
 #include <vector>
 
 #include "common/OffsetMapping.h"
@@ -202,4 +203,93 @@ TEST(OffsetMapping, OutOfBoundsReturnsMinusOne) {
     EXPECT_EQ(mapping.GetLogicalOffset(99), -1);
 }
 
+// ---------- Batch mapping and bitset transform ----------
+
+namespace {
+// rows valid with probability 0.7, over a size that is not word aligned
+std::vector<uint8_t>
+RandomValid(int64_t count, uint32_t seed) {
+    std::mt19937 gen(seed);
+    std::bernoulli_distribution dist(0.7);
+    std::vector<uint8_t> valid(count);
+    for (auto& v : valid) {
+        v = dist(gen) ? 1 : 0;
+    }
+    return valid;
+}
+}  // namespace
+
+TEST(OffsetMapping, BatchMatchesSingleOffsets) {
+    constexpr int64_t kRows = 5000 + 37;
+    auto valid = RandomValid(kRows, 7);
+    SealedOffsetMapping sealed;
+    sealed.Build(reinterpret_cast<const bool*>(valid.data()), kRows);
+    GrowingOffsetMapping growing;
+    growing.Append(reinterpret_cast<const bool*>(valid.data()), kRows);
+
+    std::vector<int64_t> logical;
+    logical.push_back(-1);
+    for (int64_t i = 0; i < kRows + 10; ++i) {
+        logical.push_back(i);
+    }
+    std::vector<int64_t> physical(logical.size());
+    sealed.LogicalToPhysical(logical.data(), logical.size(), physical.data());
+    int64_t expected_physical = 0;
+    for (size_t i = 0; i < logical.size(); ++i) {
+        const auto row = logical[i];
+        const bool is_valid = row >= 0 && row < kRows && valid[row];
+        ASSERT_EQ(physical[i], is_valid ? expected_physical++ : -1);
+        ASSERT_EQ(growing.GetPhysicalOffset(row), physical[i]);
+    }
+    ASSERT_EQ(expected_physical, sealed.GetValidCount());
+
+    // in place, out of order
+    std::vector<int64_t> offsets;
+    for (int64_t i = sealed.GetValidCount(); i >= -1; --i) {
+        offsets.push_back(i);
+    }
+    auto from_growing = offsets;
+    sealed.PhysicalToLogical(offsets.data(), offsets.size(), offsets.data());
+    growing.PhysicalToLogical(
+        from_growing.data(), from_growing.size(), from_growing.data());
+    EXPECT_EQ(offsets, from_growing);
+    EXPECT_EQ(offsets.front(), -1);
+    EXPECT_EQ(offsets.back(), -1);
+    for (size_t i = 1; i + 1 < offsets.size(); ++i) {
+        ASSERT_GE(offsets[i], 0);
+        ASSERT_TRUE(valid[offsets[i]]);
+        ASSERT_EQ(sealed.GetPhysicalOffset(offsets[i]),
+                  sealed.GetValidCount() - static_cast<int64_t>(i));
+    }
+}
+
+TEST(OffsetMapping, TransformBitsetCompactsValidRows) {
+    constexpr int64_t kRows = 3000 + 5;
+    auto valid = RandomValid(kRows, 11);
+    SealedOffsetMapping sealed;
+    sealed.Build(reinterpret_cast<const bool*>(valid.data()), kRows);
+    GrowingOffsetMapping growing;
+    growing.Append(reinterpret_cast<const bool*>(valid.data()), kRows);
+
+    std::mt19937 gen(13);
+    std::bernoulli_distribution dist(0.5);
+    // a bitset over all the rows, and one over part of them
+    for (int64_t size : {kRows, kRows - 1000 - 3}) {
+        TargetBitmap filter(size, false);
+        for (int64_t i = 0; i < size; ++i) {
+            filter[i] = dist(gen);
+        }
+        TargetBitmap expected;
+        TargetBitmap result;
+        ASSERT_EQ(growing.TransformBitset(BitsetView(filter), expected),
+                  OffsetMapping::BitsetTransformStatus::Transformed);
+        ASSERT_EQ(sealed.TransformBitset(BitsetView(filter), result),
+                  OffsetMapping::BitsetTransformStatus::Transformed);
+        ASSERT_EQ(result.size(), sealed.GetValidCount());
+        for (int64_t i = 0; i < sealed.GetValidCount(); ++i) {
+            ASSERT_EQ(result[i], expected[i]) << "physical row " << i;
+        }
+    }
+}
+
 }  // namespace milvus
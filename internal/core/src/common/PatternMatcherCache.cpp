@@ -0,0 +1,117 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "common/PatternMatcherCache.h"
+
+#include "common/Common.h"
+
+namespace milvus {
+
+PatternMatcherCache&
+PatternMatcherCache::GetInstance() {
+    static PatternMatcherCache instance;
+    return instance;
+}
+
+template <typename T, typename Build>
+std::shared_ptr<const T>
+PatternMatcherCache::GetOrBuild(Kind kind,
+                                const std::string& key,
+                                Build&& build) {
+    auto capacity = PATTERN_MATCHER_CACHE_CAPACITY.load();
+    if (capacity <= 0) {
+        return build();
+    }
+    Key cache_key{kind, key};
+    {
+        std::lock_guard lck(mutex_);
+        auto it = entries_.find(cache_key);
+        if (it != entries_.end()) {
+            lru_.splice(lru_.end(), lru_, it->second);
+            return std::get<std::shared_ptr<const T>>(it->second->second);
+        }
+    }
+
+    // compiled outside the lock, a racing caller may compile it too and
+    // the first one inserted is kept
+    std::shared_ptr<const T> built = build();
+    std::lock_guard lck(mutex_);
+    auto it = entries_.find(cache_key);
+    if (it != entries_.end()) {
+        lru_.splice(lru_.end(), lru_, it->second);
+        return std::get<std::shared_ptr<const T>>(it->second->second);
+    }
+    while (!lru_.empty() && static_cast<int64_t>(lru_.size()) >= capacity) {
+        entries_.erase(lru_.front().first);
+        lru_.pop_front();
+    }
+    lru_.emplace_back(cache_key, built);
+    entries_.emplace(std::move(cache_key), std::prev(lru_.end()));
+    return built;
+}
+
+std::shared_ptr<const PartialRegexMatcher>
+PatternMatcherCache::GetPartialRegexMatcher(const std::string& pattern) {
+    return GetOrBuild<PartialRegexMatcher>(
+        Kind::PartialRegex, pattern, [&]() {
+            return std::make_shared<const PartialRegexMatcher>(pattern);
+        });
+}
+
+std::shared_ptr<const LikePatternMatcher>
+PatternMatcherCache::GetLikePatternMatcher(const std::string& pattern) {
+    return GetOrBuild<LikePatternMatcher>(Kind::Like, pattern, [&]() {
+        return std::make_shared<const LikePatternMatcher>(pattern);
+    });
+}
+
+std::shared_ptr<const LiteralPrefilter>
+PatternMatcherCache::GetLiteralPrefilter(
+    const std::vector<std::string>& literals) {
+    // length prefixed, literals may hold any byte
+    std::string key;
+    for (const auto& literal : literals) {
+        key += std::to_string(literal.size());
+        key += ':';
+        key += literal;
+    }
+    return GetOrBuild<LiteralPrefilter>(
+        Kind::Prefilter,
+        key,
+        [&]() -> std::shared_ptr<const LiteralPrefilter> {
+            auto prefilter = std::make_shared<const LiteralPrefilter>(literals);
+            if (prefilter->empty()) {
+                return nullptr;
+            }
+            return prefilter;
+        });
+}
+
+size_t
+PatternMatcherCache::size() const {
+    std::lock_guard lck(mutex_);
+    return entries_.size();
+}
+
+void
+PatternMatcherCache::Clear() {
+    std::lock_guard lck(mutex_);
+    entries_.clear();
+    lru_.clear();
+}
+
+}  // namespace milvus
@@ -0,0 +1,83 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "common/LiteralPrefilter.h"
+#include "common/RegexQuery.h"
+
+namespace milvus {
+
+// Compiled regex and LIKE matchers by their pattern, shared by every
+// segment and query of the process. A filter is compiled again for each
+// segment it runs on, so without the cache a regex over 500 segments builds
+// the same RE2 program 500 times per query.
+//
+// The cached objects are immutable and only used through const methods,
+// which are safe to call concurrently. The capacity in entries is
+// PATTERN_MATCHER_CACHE_CAPACITY, least recently used ones are dropped
+// first; 0 compiles on every call.
+class PatternMatcherCache {
+ public:
+    static PatternMatcherCache&
+    GetInstance();
+
+    // throws like the PartialRegexMatcher constructor on an invalid regex
+    std::shared_ptr<const PartialRegexMatcher>
+    GetPartialRegexMatcher(const std::string& pattern);
+
+    std::shared_ptr<const LikePatternMatcher>
+    GetLikePatternMatcher(const std::string& pattern);
+
+    // prefilter over `literals`, nullptr when none of them is non-empty
+    std::shared_ptr<const LiteralPrefilter>
+    GetLiteralPrefilter(const std::vector<std::string>& literals);
+
+    size_t
+    size() const;
+
+    void
+    Clear();
+
+ private:
+    enum class Kind : uint8_t { PartialRegex, Like, Prefilter };
+    using Key = std::pair<Kind, std::string>;
+    using Value = std::variant<std::shared_ptr<const PartialRegexMatcher>,
+                               std::shared_ptr<const LikePatternMatcher>,
+                               std::shared_ptr<const LiteralPrefilter>>;
+
+    template <typename T, typename Build>
+    std::shared_ptr<const T>
+    GetOrBuild(Kind kind, const std::string& key, Build&& build);
+
+    mutable std::mutex mutex_;
+    // least recently used first
+    std::list<std::pair<Key, Value>> lru_;
+    std::map<Key, std::list<std::pair<Key, Value>>::iterator> entries_;
+};
+
+}  // namespace milvus
@@ -0,0 +1,134 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common/Common.h"
+#include "common/Consts.h"
+#include "common/PatternMatcherCache.h"
+
+using milvus::PatternMatcherCache;
+
+namespace {
+
+class PatternMatcherCacheTest : public ::testing::Test {
+ protected:
+    void
+    SetUp() override {
+        PatternMatcherCache::GetInstance().Clear();
+    }
+
+    void
+    TearDown() override {
+        milvus::PATTERN_MATCHER_CACHE_CAPACITY.store(
+            milvus::DEFAULT_PATTERN_MATCHER_CACHE_CAPACITY);
+        PatternMatcherCache::GetInstance().Clear();
+    }
+};
+
+}  // namespace
+
+TEST_F(PatternMatcherCacheTest, SharesMatchersByPattern) {
+    auto& cache = PatternMatcherCache::GetInstance();
+    auto regex = cache.GetPartialRegexMatcher("a.*b");
+    EXPECT_EQ(regex, cache.GetPartialRegexMatcher("a.*b"));
+    EXPECT_NE(regex, cache.GetPartialRegexMatcher("a.*c"));
+    EXPECT_TRUE((*regex)(std::string("xxaYYb")));
+    EXPECT_FALSE((*regex)(std::string("ba")));
+
+    auto like = cache.GetLikePatternMatcher("a%b");
+    EXPECT_EQ(like, cache.GetLikePatternMatcher("a%b"));
+    EXPECT_TRUE((*like)(std::string("axxb")));
+    EXPECT_FALSE((*like)(std::string("xaxxb")));
+
+    // the same text is a different pattern for each matcher kind
+    auto like_as_regex = cache.GetLikePatternMatcher("a.*b");
+    EXPECT_TRUE((*like_as_regex)(std::string("a.*b")));
+    EXPECT_FALSE((*like_as_regex)(std::string("axxb")));
+    EXPECT_EQ(cache.size(), 4);
+}
+
+TEST_F(PatternMatcherCacheTest, SharesPrefilters) {
+    auto& cache = PatternMatcherCache::GetInstance();
+    auto prefilter = cache.GetLiteralPrefilter({"ab", "c"});
+    ASSERT_NE(prefilter, nullptr);
+    EXPECT_EQ(prefilter, cache.GetLiteralPrefilter({"ab", "c"}));
+    // not the same literals once split differently
+    EXPECT_NE(prefilter, cache.GetLiteralPrefilter({"a", "bc"}));
+    EXPECT_EQ(cache.GetLiteralPrefilter({}), nullptr);
+    EXPECT_EQ(cache.GetLiteralPrefilter({""}), nullptr);
+}
+
+TEST_F(PatternMatcherCacheTest, EvictsLeastRecentlyUsed) {
+    milvus::PATTERN_MATCHER_CACHE_CAPACITY.store(2);
+    auto& cache = PatternMatcherCache::GetInstance();
+    auto a = cache.GetLikePatternMatcher("a%");
+    auto b = cache.GetLikePatternMatcher("b%");
+    // touch "a%" so that "b%" is the one dropped
+    EXPECT_EQ(a, cache.GetLikePatternMatcher("a%"));
+    cache.GetLikePatternMatcher("c%");
+    EXPECT_EQ(cache.size(), 2);
+    EXPECT_EQ(a, cache.GetLikePatternMatcher("a%"));
+    EXPECT_NE(b, cache.GetLikePatternMatcher("b%"));
+    // an evicted matcher stays usable by its holders
+    EXPECT_TRUE((*b)(std::string("bx")));
+}
+
+TEST_F(PatternMatcherCacheTest, ZeroCapacityDisablesCaching) {
+    milvus::PATTERN_MATCHER_CACHE_CAPACITY.store(0);
+    auto& cache = PatternMatcherCache::GetInstance();
+    auto first = cache.GetPartialRegexMatcher("x+");
+    auto second = cache.GetPartialRegexMatcher("x+");
+    EXPECT_NE(first, second);
+    EXPECT_TRUE((*second)(std::string("axxb")));
+    EXPECT_EQ(cache.size(), 0);
+}
+
+TEST_F(PatternMatcherCacheTest, InvalidRegexIsNotCached) {
+    auto& cache = PatternMatcherCache::GetInstance();
+    EXPECT_ANY_THROW(cache.GetPartialRegexMatcher("a(b"));
+    EXPECT_EQ(cache.size(), 0);
+    EXPECT_ANY_THROW(cache.GetPartialRegexMatcher("a(b"));
+}
+
+TEST_F(PatternMatcherCacheTest, ConcurrentCallersShareOneMatcher) {
+    auto& cache = PatternMatcherCache::GetInstance();
+    constexpr int kThreads = 8;
+    std::vector<std::shared_ptr<const milvus::PartialRegexMatcher>> got(
+        kThreads);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&cache, &got, t]() {
+            for (int i = 0; i < 100; ++i) {
+                got[t] = cache.GetPartialRegexMatcher("[0-9]+" +
+                                                      std::to_string(i % 10));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (int t = 1; t < kThreads; ++t) {
+        EXPECT_EQ(got[t], got[0]);
+    }
+    EXPECT_EQ(cache.size(), 10);
+}
@@ -0,0 +1,81 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "common/PinCache.h"
+
+namespace milvus {
+
+thread_local PinCache* PinCache::current_ = nullptr;
+
+void
+PinCache::Clear() {
+    std::unordered_map<Key, std::shared_ptr<void>, KeyHash> pins;
+    {
+        std::lock_guard lck(mutex_);
+        pins.swap(pins_);
+        order_.clear();
+    }
+    // the pins are released outside the lock
+}
+
+std::shared_ptr<void>
+PinCache::FindPins(const void* owner, const int64_t* cids, size_t count) {
+    if (count == 0) {
+        return nullptr;
+    }
+    std::lock_guard lck(mutex_);
+    const void* found = nullptr;
+    std::shared_ptr<void> pins;
+    for (size_t i = 0; i < count; ++i) {
+        auto it = pins_.find(Key{owner, cids[i]});
+        if (it == pins_.end()) {
+            it = pins_.find(Key{owner, kAllCells});
+        }
+        if (it == pins_.end() ||
+            (found != nullptr && it->second.get() != found)) {
+            return nullptr;
+        }
+        found = it->second.get();
+        pins = it->second;
+    }
+    ++hits_;
+    return pins;
+}
+
+void
+PinCache::InsertPins(const void* owner,
+                     const int64_t* cids,
+                     size_t count,
+                     std::shared_ptr<void> pins) {
+    // pins dropped to make room are released outside the lock
+    std::vector<std::shared_ptr<void>> dropped;
+    std::lock_guard lck(mutex_);
+    for (size_t i = 0; i < count; ++i) {
+        Key key{owner, cids[i]};
+        if (pins_.emplace(key, pins).second) {
+            order_.push_back(key);
+        }
+    }
+    while (static_cast<int64_t>(pins_.size()) > capacity_) {
+        auto it = pins_.find(order_.front());
+        dropped.push_back(std::move(it->second));
+        pins_.erase(it);
+        order_.pop_front();
+    }
+}
+
+}  // namespace milvus
@@ -0,0 +1,171 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "common/OpContext.h"
+
+namespace milvus {
+
+// Cache cell pins one query on a segment holds between its batches. A
+// filter scanning a 64K row cell in 8K row batches pins it 8 times, and
+// bulk_subscript pins the cells of every output field again for each batch
+// of offsets; every pin goes through the atomics the cache slot and the
+// cache manager share with all other queries. While a Scope is active,
+// columns pinning cells for the OpContext of the cache reuse the pins it
+// holds and add the ones they take, and all of them are released together
+// with the cache when the query ends.
+//
+// At most `capacity` cells are kept and the ones pinned first are dropped
+// first, so a scan keeps the cells it is on instead of every cell it went
+// through. Morsel workers of one query share its cache, so it is thread
+// safe.
+class PinCache {
+ public:
+    // stands for every cell of the owner, for pins of all cells
+    static constexpr int64_t kAllCells = -1;
+
+    PinCache(const OpContext* op_ctx, int64_t capacity)
+        : op_ctx_(op_ctx), capacity_(capacity) {
+    }
+
+    PinCache(const PinCache&) = delete;
+    PinCache&
+    operator=(const PinCache&) = delete;
+
+    // makes `cache` the one Of() returns on this thread until the scope
+    // ends; a null cache disables reuse in the scope
+    class Scope {
+     public:
+        explicit Scope(PinCache* cache) : previous_(current_) {
+            current_ = cache;
+        }
+
+        ~Scope() {
+            current_ = previous_;
+        }
+
+        Scope(const Scope&) = delete;
+        Scope&
+        operator=(const Scope&) = delete;
+
+     private:
+        PinCache* previous_;
+    };
+
+    // the cache of the active scope when it keeps the pins of `op_ctx`,
+    // nullptr otherwise
+    static PinCache*
+    Of(const OpContext* op_ctx) {
+        auto cache = current_;
+        if (cache == nullptr || op_ctx == nullptr ||
+            cache->op_ctx_ != op_ctx || cache->capacity_ <= 0) {
+            return nullptr;
+        }
+        return cache;
+    }
+
+    // the pins `owner` took that cover every cell of `cids`, nullptr unless
+    // a single pin it holds covers all of them
+    template <typename Accessor>
+    std::shared_ptr<Accessor>
+    Find(const void* owner, const std::vector<int64_t>& cids) {
+        return std::static_pointer_cast<Accessor>(
+            FindPins(owner, cids.data(), cids.size()));
+    }
+
+    // keeps `pins` of the cells `cids` of `owner`, cells already cached
+    // keep their pins
+    template <typename Accessor>
+    void
+    Insert(const void* owner,
+           const std::vector<int64_t>& cids,
+           std::shared_ptr<Accessor> pins) {
+        InsertPins(owner,
+                   cids.data(),
+                   cids.size(),
+                   std::static_pointer_cast<void>(std::move(pins)));
+    }
+
+    // releases every pin, the cache stays usable
+    void
+    Clear();
+
+    // cached cells
+    size_t
+    size() const {
+        std::lock_guard lck(mutex_);
+        return pins_.size();
+    }
+
+    // pins served from the cache instead of the cache slot
+    int64_t
+    hits() const {
+        std::lock_guard lck(mutex_);
+        return hits_;
+    }
+
+ private:
+    struct Key {
+        const void* owner;
+        int64_t cid;
+
+        bool
+        operator==(const Key& other) const {
+            return owner == other.owner && cid == other.cid;
+        }
+    };
+
+    struct KeyHash {
+        size_t
+        operator()(const Key& key) const {
+            return std::hash<const void*>()(key.owner) ^
+                   (std::hash<int64_t>()(key.cid) * 0x9e3779b97f4a7c15ULL);
+        }
+    };
+
+    std::shared_ptr<void>
+    FindPins(const void* owner, const int64_t* cids, size_t count);
+
+    void
+    InsertPins(const void* owner,
+               const int64_t* cids,
+               size_t count,
+               std::shared_ptr<void> pins);
+
+    static thread_local PinCache* current_;
+
+    const OpContext* op_ctx_;
+    const int64_t capacity_;
+    mutable std::mutex mutex_;
+    std::unordered_map<Key, std::shared_ptr<void>, KeyHash> pins_;
+    // cached keys, the oldest first
+    std::deque<Key> order_;
+    int64_t hits_ = 0;
+};
+
+}  // namespace milvus
@@ -0,0 +1,135 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "common/OpContext.h"
+#include "common/PinCache.h"
+
+using milvus::OpContext;
+using milvus::PinCache;
+
+namespace {
+
+// stands in for the cell accessor of a cache slot
+struct FakePins {
+    int id;
+};
+
+}  // namespace
+
+TEST(PinCache, ReusesPinsOfTheSameCells) {
+    OpContext op_ctx;
+    PinCache cache(&op_ctx, 8);
+    PinCache::Scope scope(&cache);
+    ASSERT_EQ(PinCache::Of(&op_ctx), &cache);
+
+    int slot = 0;
+    auto pins = std::make_shared<FakePins>(FakePins{1});
+    EXPECT_EQ(cache.Find<FakePins>(&slot, {3}), nullptr);
+    cache.Insert(&slot, {3, 4}, pins);
+    EXPECT_EQ(cache.Find<FakePins>(&slot, {3}), pins);
+    EXPECT_EQ(cache.Find<FakePins>(&slot, {4, 3}), pins);
+    EXPECT_EQ(cache.hits(), 2);
+    EXPECT_EQ(cache.size(), 2);
+
+    // other cells, or another slot, are not covered
+    EXPECT_EQ(cache.Find<FakePins>(&slot, {3, 5}), nullptr);
+    int other_slot = 0;
+    EXPECT_EQ(cache.Find<FakePins>(&other_slot, {3}), nullptr);
+    EXPECT_EQ(cache.Find<FakePins>(&slot, {}), nullptr);
+}
+
+TEST(PinCache, CellsOfDifferentPinsAreNotMerged) {
+    OpContext op_ctx;
+    PinCache cache(&op_ctx, 8);
+    int slot = 0;
+    auto first = std::make_shared<FakePins>(FakePins{1});
+    auto second = std::make_shared<FakePins>(FakePins{2});
+    cache.Insert(&slot, {1}, first);
+    cache.Insert(&slot, {1, 2}, second);
+    // a cached cell keeps the pins it was cached with
+    EXPECT_EQ(cache.Find<FakePins>(&slot, {1}), first);
+    EXPECT_EQ(cache.Find<FakePins>(&slot, {2}), second);
+    EXPECT_EQ(cache.Find<FakePins>(&slot, {1, 2}), nullptr);
+}
+
+TEST(PinCache, PinsOfAllCellsCoverEveryCell) {
+    OpContext op_ctx;
+    PinCache cache(&op_ctx, 8);
+    int slot = 0;
+    auto all = std::make_shared<FakePins>(FakePins{1});
+    cache.Insert(&slot, {PinCache::kAllCells}, all);
+    EXPECT_EQ(cache.Find<FakePins>(&slot, {PinCache::kAllCells}), all);
+    EXPECT_EQ(cache.Find<FakePins>(&slot, {0, 7, 100}), all);
+}
+
+TEST(PinCache, DropsTheOldestCellsPastCapacity) {
+    OpContext op_ctx;
+    PinCache cache(&op_ctx, 2);
+    int slot = 0;
+    std::weak_ptr<FakePins> oldest;
+    {
+        auto pins = std::make_shared<FakePins>(FakePins{0});
+        oldest = pins;
+        cache.Insert(&slot, {0}, pins);
+    }
+    cache.Insert(&slot, {1}, std::make_shared<FakePins>(FakePins{1}));
+    cache.Insert(&slot, {2}, std::make_shared<FakePins>(FakePins{2}));
+    EXPECT_EQ(cache.size(), 2);
+    EXPECT_EQ(cache.Find<FakePins>(&slot, {0}), nullptr);
+    // the pins are released once dropped
+    EXPECT_TRUE(oldest.expired());
+    EXPECT_NE(cache.Find<FakePins>(&slot, {1}), nullptr);
+    EXPECT_NE(cache.Find<FakePins>(&slot, {2}), nullptr);
+
+    std::weak_ptr<FakePins> kept = cache.Find<FakePins>(&slot, {2});
+    cache.Clear();
+    EXPECT_EQ(cache.size(), 0);
+    EXPECT_TRUE(kept.expired());
+}
+
+TEST(PinCache, ServesOnlyItsOpContextInScope) {
+    OpContext op_ctx;
+    OpContext other_ctx;
+    PinCache cache(&op_ctx, 8);
+    EXPECT_EQ(PinCache::Of(&op_ctx), nullptr);
+    {
+        PinCache::Scope scope(&cache);
+        EXPECT_EQ(PinCache::Of(&op_ctx), &cache);
+        EXPECT_EQ(PinCache::Of(&other_ctx), nullptr);
+        EXPECT_EQ(PinCache::Of(nullptr), nullptr);
+        {
+            PinCache::Scope disabled(nullptr);
+            EXPECT_EQ(PinCache::Of(&op_ctx), nullptr);
+        }
+        EXPECT_EQ(PinCache::Of(&op_ctx), &cache);
+        // the scope is per thread
+        std::thread([&] {
+            EXPECT_EQ(PinCache::Of(&op_ctx), nullptr);
+        }).join();
+    }
+    EXPECT_EQ(PinCache::Of(&op_ctx), nullptr);
+
+    PinCache disabled(&op_ctx, 0);
+    PinCache::Scope scope(&disabled);
+    EXPECT_EQ(PinCache::Of(&op_ctx), nullptr);
+}
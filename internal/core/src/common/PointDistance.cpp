@@ -0,0 +1,140 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include "common/PointDistance.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+#include <xsimd/xsimd.hpp>
+
+#include "common/SimdUtil.h"
+
+namespace milvus {
+
+namespace {
+
+// same constants as Geometry::haversine_distance_meters
+constexpr double kEarthRadius = 6371000.0;
+constexpr double kPi = 3.14159265358979323846;
+constexpr double kRadians = kPi / 180.0;
+
+// byte order, geometry type, x, y
+constexpr size_t kWkbPointSize = 1 + sizeof(uint32_t) + 2 * sizeof(double);
+constexpr uint32_t kWkbPoint = 1;
+
+bool
+IsHostLittleEndian() {
+    const uint16_t one = 1;
+    uint8_t first;
+    std::memcpy(&first, &one, 1);
+    return first == 1;
+}
+
+template <typename T>
+T
+Read(const uint8_t* ptr, bool swap) {
+    T value;
+    if (!swap) {
+        std::memcpy(&value, ptr, sizeof(T));
+        return value;
+    }
+    uint8_t bytes[sizeof(T)];
+    for (size_t i = 0; i < sizeof(T); i++) {
+        bytes[i] = ptr[sizeof(T) - 1 - i];
+    }
+    std::memcpy(&value, bytes, sizeof(T));
+    return value;
+}
+
+}  // namespace
+
+bool
+DecodeWkbPoint(const void* wkb, size_t size, double& x, double& y) {
+    if (wkb == nullptr || size != kWkbPointSize) {
+        return false;
+    }
+    auto ptr = static_cast<const uint8_t*>(wkb);
+    if (ptr[0] > 1) {
+        return false;
+    }
+    // 1 is little endian (NDR), 0 big endian (XDR)
+    bool swap = (ptr[0] == 1) != IsHostLittleEndian();
+    // Z/M dimensions and EWKB flags all change the type, so only a 2D
+    // point matches
+    if (Read<uint32_t>(ptr + 1, swap) != kWkbPoint) {
+        return false;
+    }
+    x = Read<double>(ptr + 5, swap);
+    y = Read<double>(ptr + 5 + sizeof(double), swap);
+    return true;
+}
+
+void
+PointsWithinDistance(const double* xs,
+                     const double* ys,
+                     size_t size,
+                     double query_x,
+                     double query_y,
+                     double distance,
+                     TargetBitmapView res) {
+    if (!(distance >= 0)) {
+        for (size_t i = 0; i < size; i++) {
+            res[i] = false;
+        }
+        return;
+    }
+    // haversine: d = 2R * asin(sqrt(a)), so d <= distance is
+    // a <= sin^2(distance / 2R) while distance / 2R is under pi / 2 and
+    // always true past it, half the circumference being the farthest apart
+    // two points are
+    auto half_angle = distance / (2 * kEarthRadius);
+    auto threshold = half_angle < kPi / 2
+                         ? std::sin(half_angle) * std::sin(half_angle)
+                         : std::numeric_limits<double>::infinity();
+    auto cos_query_lat = std::cos(query_y * kRadians);
+
+    using Batch = xsimd::batch<double>;
+    constexpr size_t kLanes = Batch::size;
+    const Batch half_radians(kRadians / 2);
+    const Batch radians(kRadians);
+    const Batch batch_query_x(query_x);
+    const Batch batch_query_y(query_y);
+    const Batch batch_cos_query_lat(cos_query_lat);
+    const Batch batch_threshold(threshold);
+
+    size_t pos = 0;
+    for (; pos + kLanes <= size; pos += kLanes) {
+        auto x = Batch::load_unaligned(xs + pos);
+        auto y = Batch::load_unaligned(ys + pos);
+        auto sin_dlat = xsimd::sin((y - batch_query_y) * half_radians);
+        auto sin_dlon = xsimd::sin((x - batch_query_x) * half_radians);
+        auto a = sin_dlat * sin_dlat + xsimd::cos(y * radians) *
+                                           batch_cos_query_lat * sin_dlon *
+                                           sin_dlon;
+        auto mask = toBitMask(a <= batch_threshold);
+        for (size_t lane = 0; lane < kLanes; lane++) {
+            res[pos + lane] = (mask >> lane) & 1;
+        }
+    }
+    for (; pos < size; pos++) {
+        auto sin_dlat = std::sin((ys[pos] - query_y) * (kRadians / 2));
+        auto sin_dlon = std::sin((xs[pos] - query_x) * (kRadians / 2));
+        auto a = sin_dlat * sin_dlat + std::cos(ys[pos] * kRadians) *
+                                           cos_query_lat * sin_dlon *
+                                           sin_dlon;
+        res[pos] = a <= threshold;
+    }
+}
+
+}  // namespace milvus
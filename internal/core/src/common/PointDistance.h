@@ -0,0 +1,40 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#pragma once
+
+#include <cstddef>
+
+#include "common/Types.h"
+
+namespace milvus {
+
+// Reads the coordinates of a 2D WKB point, in either byte order. Returns
+// false for any other geometry, which has to go through GEOS. An empty
+// point reads as NaN coordinates.
+bool
+DecodeWkbPoint(const void* wkb, size_t size, double& x, double& y);
+
+// Sets res[i] when point (xs[i], ys[i]) lies within `distance` meters of
+// (query_x, query_y) on the sphere, the haversine distance used by
+// Geometry::dwithin for points. Coordinates are longitude/latitude degrees;
+// NaN coordinates never match. The points are tested a SIMD batch at a
+// time as sin^2(d / 2R), so no row takes a square root or an arctangent.
+void
+PointsWithinDistance(const double* xs,
+                     const double* ys,
+                     size_t size,
+                     double query_x,
+                     double query_y,
+                     double distance,
+                     TargetBitmapView res);
+
+}  // namespace milvus
@@ -0,0 +1,129 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "common/PointDistance.h"
+#include "common/Types.h"
+
+using milvus::DecodeWkbPoint;
+using milvus::PointsWithinDistance;
+using milvus::TargetBitmap;
+using milvus::TargetBitmapView;
+
+namespace {
+
+std::string
+WkbPoint(double x, double y, bool little_endian, uint32_t type = 1) {
+    std::string wkb(21, '\0');
+    wkb[0] = little_endian ? 1 : 0;
+    auto put = [&](size_t pos, const void* value, size_t size) {
+        auto bytes = static_cast<const uint8_t*>(value);
+        for (size_t i = 0; i < size; i++) {
+            wkb[pos + i] = little_endian ? bytes[i] : bytes[size - 1 - i];
+        }
+    };
+    put(1, &type, sizeof(type));
+    put(5, &x, sizeof(x));
+    put(13, &y, sizeof(y));
+    return wkb;
+}
+
+// Geometry::haversine_distance_meters
+double
+Haversine(double lat1, double lon1, double lat2, double lon2) {
+    const double R = 6371000.0;
+    const double PI = 3.14159265358979323846;
+    double dlat = (lat2 - lat1) * PI / 180.0;
+    double dlon = (lon2 - lon1) * PI / 180.0;
+    double a = std::sin(dlat / 2.0) * std::sin(dlat / 2.0) +
+               std::cos(lat1 * PI / 180.0) * std::cos(lat2 * PI / 180.0) *
+                   std::sin(dlon / 2.0) * std::sin(dlon / 2.0);
+    return R * 2.0 * std::atan2(std::sqrt(a), std::sqrt(1.0 - a));
+}
+
+}  // namespace
+
+TEST(PointDistanceTest, DecodesWkbPoints) {
+    double x, y;
+    for (bool little_endian : {true, false}) {
+        auto wkb = WkbPoint(-73.5, 40.25, little_endian);
+        ASSERT_TRUE(DecodeWkbPoint(wkb.data(), wkb.size(), x, y));
+        EXPECT_EQ(x, -73.5);
+        EXPECT_EQ(y, 40.25);
+    }
+    // POINT Z and EWKB with an SRID are left to GEOS
+    auto point_z = WkbPoint(1, 2, true, 1001);
+    EXPECT_FALSE(DecodeWkbPoint(point_z.data(), point_z.size(), x, y));
+    auto ewkb = WkbPoint(1, 2, true, 0x20000001);
+    EXPECT_FALSE(DecodeWkbPoint(ewkb.data(), ewkb.size(), x, y));
+    // a linestring
+    auto line = WkbPoint(1, 2, true, 2);
+    EXPECT_FALSE(DecodeWkbPoint(line.data(), line.size(), x, y));
+    EXPECT_FALSE(DecodeWkbPoint(nullptr, 0, x, y));
+    auto truncated = WkbPoint(1, 2, true).substr(0, 20);
+    EXPECT_FALSE(DecodeWkbPoint(truncated.data(), truncated.size(), x, y));
+}
+
+TEST(PointDistanceTest, MatchesHaversine) {
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<double> lon(-180, 180);
+    std::uniform_real_distribution<double> lat(-90, 90);
+    const size_t n = 1003;
+    std::vector<double> xs(n), ys(n);
+    for (size_t i = 0; i < n; i++) {
+        xs[i] = lon(rng);
+        ys[i] = lat(rng);
+    }
+    xs[5] = std::numeric_limits<double>::quiet_NaN();
+
+    const double query_x = 12.5, query_y = 41.9;
+    for (double distance : {0.0, 1e5, 2e6, 1e7, 3e7}) {
+        TargetBitmap result(n);
+        PointsWithinDistance(xs.data(),
+                             ys.data(),
+                             n,
+                             query_x,
+                             query_y,
+                             distance,
+                             TargetBitmapView(result.data(), n));
+        for (size_t i = 0; i < n; i++) {
+            if (i == 5) {
+                EXPECT_FALSE(result[i]);
+                continue;
+            }
+            auto actual = Haversine(ys[i], xs[i], query_y, query_x);
+            // rounding may only differ right at the radius
+            if (std::abs(actual - distance) > 1e-3) {
+                EXPECT_EQ(result[i], actual <= distance)
+                    << i << " at " << actual << " of " << distance;
+            }
+        }
+    }
+
+    TargetBitmap none(n);
+    none.set();
+    PointsWithinDistance(xs.data(),
+                         ys.data(),
+                         n,
+                         query_x,
+                         query_y,
+                         -1,
+                         TargetBitmapView(none.data(), n));
+    EXPECT_TRUE(none.none());
+}
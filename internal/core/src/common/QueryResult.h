@@ -325,6 +325,9 @@ struct SearchResult {
         vector_iterators_;
     // record the storage usage in search
     StorageCost search_storage_cost_;
+    // per-operator runtime stats, only set when the plan asked for
+    // EXPLAIN ANALYZE
+    std::string explain_analyze_;
 
     bool element_level_{false};
     std::vector<int32_t> element_indices_;
@@ -360,6 +363,9 @@ struct RetrieveResult {
     bool has_more_result = true;
     // record the storage usage in retrieve
     StorageCost retrieve_storage_cost_;
+    // per-operator runtime stats, only set when the plan asked for
+    // EXPLAIN ANALYZE
+    std::string explain_analyze_;
 
     // Element-level query support
     // When element_level_ is true:
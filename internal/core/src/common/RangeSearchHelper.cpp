@@ -114,6 +114,96 @@ ReGenRangeSearchResult(DatasetPtr data_set,
     return GenResultDataset(nq, topk, p_id, p_dist);
 }
 
+DatasetPtr
+StreamRangeSearchResult(
+    const std::vector<knowhere::IndexNode::IteratorPtr>& iterators,
+    int64_t topk,
+    float radius,
+    std::optional<float> range_filter,
+    const std::string& metric_type,
+    int64_t scan_limit,
+    bool exact_order) {
+    auto nq = static_cast<int64_t>(iterators.size());
+    auto p_id = new int64_t[topk * nq];
+    auto p_dist = new float[topk * nq];
+    std::fill_n(p_id, topk * nq, -1);
+    std::fill_n(p_dist, topk * nq, std::numeric_limits<float>::max());
+
+    // same range as knowhere:
+    //   IP: radius < dist <= range_filter, L2: range_filter <= dist < radius
+    bool larger_is_closer = PositivelyRelated(metric_type);
+    auto beyond_radius = [&](float dist) {
+        return larger_is_closer ? dist <= radius : dist >= radius;
+    };
+    auto before_range = [&](float dist) {
+        return range_filter.has_value() &&
+               (larger_is_closer ? dist > range_filter.value()
+                                 : dist < range_filter.value());
+    };
+    std::function<bool(const ResultPair&, const ResultPair&)> cmp =
+        std::less<>();
+    if (larger_is_closer) {
+        cmp = std::greater<>();
+    }
+
+    // approximate iterators are only roughly ordered, a query ends after
+    // this many consecutive candidates beyond the radius, or that did not
+    // improve its full heap
+    auto patience = std::max<int64_t>(topk, 1);
+    for (int64_t i = 0; i < nq; i++) {
+        std::priority_queue<ResultPair, std::vector<ResultPair>, decltype(cmp)>
+            pq(cmp);
+        const auto& iterator = iterators[i];
+        int64_t beyond_run = 0;
+        int64_t stale_run = 0;
+        // a query that reaches the scan limit keeps the topk it has so far
+        for (int64_t scanned = 0;
+             scanned < scan_limit && iterator != nullptr &&
+             iterator->HasNext();
+             scanned++) {
+            auto [id, dist] = iterator->Next();
+            bool improved = false;
+            if (beyond_radius(dist)) {
+                if (exact_order) {
+                    break;
+                }
+                beyond_run++;
+            } else {
+                beyond_run = 0;
+                if (!before_range(dist)) {
+                    auto curr = ResultPair(dist, id);
+                    if (static_cast<int64_t>(pq.size()) < topk) {
+                        pq.push(curr);
+                        improved = true;
+                    } else if (topk > 0 && cmp(curr, pq.top())) {
+                        pq.pop();
+                        pq.push(curr);
+                        improved = true;
+                    }
+                }
+            }
+            if (static_cast<int64_t>(pq.size()) == topk) {
+                // in exact order a full heap already holds the topk
+                if (exact_order) {
+                    break;
+                }
+                stale_run = improved ? 0 : stale_run + 1;
+            }
+            if (beyond_run >= patience || stale_run >= patience) {
+                break;
+            }
+        }
+
+        for (int64_t j = static_cast<int64_t>(pq.size()) - 1; j >= 0; j--) {
+            auto& node = pq.top();
+            p_dist[i * topk + j] = node.first;
+            p_id[i * topk + j] = node.second;
+            pq.pop();
+        }
+    }
+    return GenResultDataset(nq, topk, p_id, p_dist);
+}
+
 void
 CheckRangeSearchParam(float radius,
                       float range_filter,
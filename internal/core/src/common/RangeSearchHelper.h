@@ -13,7 +13,11 @@
 
 #include <common/Types.h>
 #include <stdint.h>
+#include <optional>
 #include <string>
+#include <vector>
+
+#include "knowhere/index/index_node.h"
 
 namespace milvus {
 
@@ -23,6 +27,25 @@ ReGenRangeSearchResult(DatasetPtr data_set,
                        int64_t nq,
                        const std::string& metric_type);
 
+/* Range search over `iterators`, one per query yielding candidates closest
+ * first. The topk best candidates within range are kept in a bounded heap,
+ * so memory stays O(topk) however many vectors fall in range. Iterators in
+ * exact distance order (brute force) stop at the first candidate beyond the
+ * radius or once topk candidates are in range. Approximate ones stop after
+ * topk consecutive candidates beyond the radius, or once the heap is full
+ * and topk consecutive candidates did not improve it. A query stops after
+ * `scan_limit` candidates with the topk found so far. Same layout as
+ * ReGenRangeSearchResult. */
+DatasetPtr
+StreamRangeSearchResult(
+    const std::vector<knowhere::IndexNode::IteratorPtr>& iterators,
+    int64_t topk,
+    float radius,
+    std::optional<float> range_filter,
+    const std::string& metric_type,
+    int64_t scan_limit,
+    bool exact_order);
+
 void
 CheckRangeSearchParam(float radius,
                       float range_filter,
@@ -188,3 +188,126 @@ TEST_P(RangeSearchSortTest, CheckRangeSearchSort) {
     delete[] p_id;
     delete[] p_dist;
 }
+
+class VectorListIterator : public knowhere::IndexNode::iterator {
+ public:
+    explicit VectorListIterator(std::vector<std::pair<int64_t, float>> list)
+        : list_(std::move(list)) {
+    }
+
+    std::pair<int64_t, float>
+    Next() override {
+        return list_[pos_++];
+    }
+
+    bool
+    HasNext() override {
+        return pos_ < list_.size();
+    }
+
+ private:
+    std::vector<std::pair<int64_t, float>> list_;
+    size_t pos_ = 0;
+};
+
+TEST_P(RangeSearchSortTest, CheckStreamRangeSearch) {
+    auto res = milvus::ReGenRangeSearchResult(dataset, TOPK, N, metric_type);
+    auto larger_is_closer = milvus::PositivelyRelated(metric_type);
+    // every generated distance falls inside the radius
+    float radius = larger_is_closer ? dist_min - 1 : dist_max + 1;
+    auto lims = milvus::GetDatasetLims(dataset);
+    auto id = milvus::GetDatasetIDs(dataset);
+    auto dist = milvus::GetDatasetDistance(dataset);
+
+    for (bool exact_order : {true, false}) {
+        std::mt19937 e(42);
+        std::vector<knowhere::IndexNode::IteratorPtr> iterators;
+        for (int64_t i = 0; i < N; i++) {
+            std::vector<std::pair<int64_t, float>> list;
+            for (auto j = lims[i]; j < lims[i + 1]; j++) {
+                list.emplace_back(id[j], dist[j]);
+            }
+            std::sort(list.begin(), list.end(), [&](auto& a, auto& b) {
+                return larger_is_closer ? a.second > b.second
+                                        : a.second < b.second;
+            });
+            if (!exact_order) {
+                // roughly ordered: neighbours come in random order
+                for (size_t j = 0; j + 1 < list.size(); j += 2) {
+                    if (e() % 2 == 0) {
+                        std::swap(list[j], list[j + 1]);
+                    }
+                }
+            }
+            iterators.push_back(
+                std::make_shared<VectorListIterator>(std::move(list)));
+        }
+        auto stream = milvus::StreamRangeSearchResult(iterators,
+                                                      TOPK,
+                                                      radius,
+                                                      std::nullopt,
+                                                      metric_type,
+                                                      N * N,
+                                                      exact_order);
+        CheckRangeSearchSortResult(
+            const_cast<int64_t*>(milvus::GetDatasetIDs(res)),
+            const_cast<float*>(milvus::GetDatasetDistance(res)),
+            stream,
+            N * TOPK);
+    }
+}
+
+TEST(RangeSearchStreamTest, ScanLimitKeepsPartialResult) {
+    // L2, radius 10: the first four candidates are in range
+    std::vector<std::pair<int64_t, float>> list{
+        {0, 1.0f}, {1, 2.0f}, {2, 3.0f}, {3, 4.0f}, {4, 20.0f}};
+    auto stream = [&](int64_t topk, int64_t scan_limit) {
+        std::vector<knowhere::IndexNode::IteratorPtr> iterators{
+            std::make_shared<VectorListIterator>(list)};
+        return milvus::StreamRangeSearchResult(iterators,
+                                               topk,
+                                               10.0f,
+                                               std::nullopt,
+                                               knowhere::metric::L2,
+                                               scan_limit,
+                                               true);
+    };
+
+    // the limit ends the query with the candidates pulled so far
+    auto res = stream(10, 3);
+    ASSERT_NE(res, nullptr);
+    auto ids = milvus::GetDatasetIDs(res);
+    for (int64_t i = 0; i < 3; i++) {
+        EXPECT_EQ(ids[i], i);
+    }
+    EXPECT_EQ(ids[3], -1);
+
+    // the range ends within the limit
+    res = stream(10, 5);
+    ids = milvus::GetDatasetIDs(res);
+    for (int64_t i = 0; i < 4; i++) {
+        EXPECT_EQ(ids[i], i);
+    }
+    EXPECT_EQ(ids[4], -1);
+
+    // topk candidates in exact order end the query before the limit
+    res = stream(2, 2);
+    EXPECT_EQ(milvus::GetDatasetIDs(res)[1], 1);
+}
+
+TEST(RangeSearchStreamTest, ApproximateStopsOnceHeapStopsImproving) {
+    // L2, radius 10, all in range: once the heap holds {0, 1}, candidates 5
+    // and 6 do not improve it, so the closer candidate 2 is never pulled
+    std::vector<std::pair<int64_t, float>> list{{1, 2.0f},
+                                                {0, 1.0f},
+                                                {5, 6.0f},
+                                                {6, 7.0f},
+                                                {2, 0.5f}};
+    std::vector<knowhere::IndexNode::IteratorPtr> iterators{
+        std::make_shared<VectorListIterator>(list)};
+    auto res = milvus::StreamRangeSearchResult(
+        iterators, 2, 10.0f, std::nullopt, knowhere::metric::L2, 100, false);
+    auto ids = milvus::GetDatasetIDs(res);
+    EXPECT_EQ(ids[0], 0);
+    EXPECT_EQ(ids[1], 1);
+}
@@ -228,6 +228,13 @@ class LikePatternMatcher {
         ParsePattern(pattern);
     }
 
+    // Runs of literal text between wildcards. Every string the pattern
+    // matches contains all of them, which makes them a cheap prefilter.
+    const std::vector<std::string>&
+    RequiredLiterals() const {
+        return required_literals_;
+    }
+
  private:
     // A segment between % wildcards, may contain _ wildcards
     struct Segment {
@@ -251,6 +258,13 @@ class LikePatternMatcher {
         leading_wildcard_ = false;
         trailing_wildcard_ = false;
         bool first_char_processed = false;
+        std::string current_literal;
+        auto flush_literal = [&]() {
+            if (!current_literal.empty()) {
+                required_literals_.push_back(std::move(current_literal));
+                current_literal.clear();
+            }
+        };
 
         for (size_t i = 0; i < pattern.size();) {
             char c = pattern[i];
@@ -259,6 +273,7 @@ class LikePatternMatcher {
                 size_t char_len = Utf8ValidatedCharByteLen(pattern.data() + i,
                                                            pattern.size() - i);
                 current_segment.text.append(pattern, i, char_len);
+                current_literal.append(pattern, i, char_len);
                 current_segment.char_count++;
                 char_pos_in_segment++;
                 i += char_len;
@@ -269,6 +284,7 @@ class LikePatternMatcher {
                 trailing_wildcard_ = false;
                 ++i;
             } else if (c == '%') {
+                flush_literal();
                 segments_.push_back(std::move(current_segment));
                 current_segment = Segment();
                 current_segment.underscore_count = 0;
@@ -280,6 +296,7 @@ class LikePatternMatcher {
                 trailing_wildcard_ = true;
                 ++i;
             } else if (c == '_') {
+                flush_literal();
                 current_segment.underscore_char_positions.push_back(
                     char_pos_in_segment);
                 current_segment.underscore_count++;
@@ -292,6 +309,7 @@ class LikePatternMatcher {
                 size_t char_len = Utf8ValidatedCharByteLen(pattern.data() + i,
                                                            pattern.size() - i);
                 current_segment.text.append(pattern, i, char_len);
+                current_literal.append(pattern, i, char_len);
                 current_segment.char_count++;
                 char_pos_in_segment++;
                 i += char_len;
@@ -305,6 +323,7 @@ class LikePatternMatcher {
                       "to escape");
         }
         segments_.push_back(std::move(current_segment));
+        flush_literal();
 
         // Precompute minimum required byte count for early rejection.
         // For literal text, use actual byte length; for each _ wildcard,
@@ -524,6 +543,7 @@ class LikePatternMatcher {
     }
 
     std::vector<Segment> segments_;
+    std::vector<std::string> required_literals_;
     bool leading_wildcard_ = false;
     bool trailing_wildcard_ = false;
     size_t min_required_bytes_ = 0;
@@ -0,0 +1,42 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "folly/tracing/StaticTracepoint.h"
+
+// Static USDT probes of the milvus provider on the query and load paths.
+// A probe is a single nop until a tracer attaches to it, so unlike spans they
+// stay in place at full rate, e.g.
+//
+//   bpftrace -e 'usdt:/path/to/libmilvus_core.so:milvus:vector_search_end
+//                { @[arg1] = count(); }'
+//
+// Arguments are evaluated even while nothing is attached, so only pass
+// values at hand (integers and pointers), never ones that allocate.
+//
+// Most probes come in _start/_end pairs sharing their first argument, so
+// that a tracer can time the section between them:
+//   driver_run_start(driver) / driver_run_end(driver, stop reason)
+//   expr_eval_start(expr) / expr_eval_end(expr)
+//   vector_search_start(segment id, field id, nq, topk)
+//   vector_search_end(segment id, field id, result count)
+//   cache_pin_start(column, cells) / cache_pin_end(column, cells)
+//   index_download_start(file offset, bytes)
+//   index_download_end(file offset, bytes)
+// and cache_miss(translator, cells, bytes, nanoseconds) fires once a
+// translator loaded the cells the caching layer missed on.
+#define MILVUS_TRACEPOINT(name, ...) FOLLY_SDT(milvus, name, ##__VA_ARGS__)
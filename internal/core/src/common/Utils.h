@@ -494,6 +494,8 @@ inline const char* const KMin = "min";
 inline const char* const KMax = "max";
 inline const char* const KCount = "count";
 inline const char* const KAvg = "avg";
+inline const char* const KApproxCountDistinct = "approx_count_distinct";
+inline const char* const KApproxPercentile = "approx_percentile";
 
 inline DataType
 GetAggResultType(std::string func_name, DataType input_type) {
@@ -565,6 +567,10 @@ GetAggResultType(std::string func_name, DataType input_type) {
     if (func_name == KCount) {
         return DataType::INT64;
     }
+    if (func_name == KApproxCountDistinct || func_name == KApproxPercentile) {
+        // the serialized sketch, merged and finalized by the reducer
+        return DataType::VARCHAR;
+    }
     ThrowInfo(OpTypeInvalid, "Unsupported func type:{}", func_name);
 }
 
@@ -11,6 +11,8 @@
 
 #pragma once
 
+#include <iterator>
+
 #include "common/Types.h"
 #include "common/Vector.h"
 namespace milvus {
@@ -25,8 +27,10 @@ class ThreeValuedLogicOp {
         TargetBitmapView data(left->GetRawData(), left->size());
         TargetBitmapView valid_data(left->GetValidRawData(), left->size());
 
-        data.flip();
-        data.inplace_and(valid_data, left->size());
+        // data = valid & ~data
+        const TargetBitmapView others[] = {valid_data};
+        data.inplace_fused(
+            others, std::size(others), kNotProgram, std::size(kNotProgram));
     }
 
     // apply and operation to the left and right column vectors
@@ -59,21 +63,11 @@ class ThreeValuedLogicOp {
         TargetBitmapView right_data(right->GetRawData(), size);
         TargetBitmapView right_valid(right->GetValidRawData(), size);
 
-        // tmp = ~left_data | right_valid
-        TargetBitmap tmp(size, true);
-        tmp.inplace_xor(left_data, size);
-        tmp.inplace_or(right_valid, size);
-
-        // left_valid = left_valid & (right_valid | ~left_data)
-        left_valid.inplace_and(tmp, size);
-
-        // tmp = right_valid & ~right_data (reuse tmp)
-        tmp.set();
-        tmp.inplace_xor(right_data, size);   // tmp = ~right_data
-        tmp.inplace_and(right_valid, size);  // tmp = right_valid & ~right_data
-
-        // left_valid |= (right_valid & ~right_data)
-        left_valid.inplace_or(tmp, size);
+        // left_valid = left_valid & (right_valid | ~left_data) |
+        //              right_valid & ~right_data, in a single pass
+        const TargetBitmapView others[] = {left_data, right_valid, right_data};
+        left_valid.inplace_fused(
+            others, std::size(others), kAndProgram, std::size(kAndProgram));
 
         // left_data = left_data & right_data
         left_data.inplace_and(right_data, size);
@@ -109,25 +103,52 @@ class ThreeValuedLogicOp {
         TargetBitmapView right_data(right->GetRawData(), size);
         TargetBitmapView right_valid(right->GetValidRawData(), size);
 
-        // tmp = left_data | right_valid
-        TargetBitmap tmp(size);
-        tmp.inplace_or(left_data, size);
-        tmp.inplace_or(right_valid, size);
-
-        // left_valid = left_valid & (right_valid | left_data)
-        left_valid.inplace_and(tmp, size);
-
-        // tmp = right_valid & right_data (reuse tmp)
-        tmp.reset();
-        tmp.inplace_or(right_data, size);
-        tmp.inplace_and(right_valid, size);
-
-        // left_valid |= (right_valid & right_data)
-        left_valid.inplace_or(tmp, size);
+        // left_valid = left_valid & (right_valid | left_data) |
+        //              right_valid & right_data, in a single pass
+        const TargetBitmapView others[] = {left_data, right_valid, right_data};
+        left_valid.inplace_fused(
+            others, std::size(others), kOrProgram, std::size(kOrProgram));
 
         // left_data = left_data | right_data
         left_data.inplace_or(right_data, size);
     }
+
+ private:
+    using Op = bitset::FusedOp;
+    using OpType = bitset::FusedOpType;
+
+    // over data and valid
+    static constexpr Op kNotProgram[] = {
+        {OpType::LOAD, 1},
+        {OpType::LOAD, 0},
+        {OpType::AND_NOT},
+    };
+
+    // over left_valid, left_data, right_valid and right_data
+    static constexpr Op kAndProgram[] = {
+        {OpType::LOAD, 2},
+        {OpType::LOAD, 1},
+        {OpType::NOT},
+        {OpType::OR},
+        {OpType::LOAD, 0},
+        {OpType::AND},
+        {OpType::LOAD, 2},
+        {OpType::LOAD, 3},
+        {OpType::AND_NOT},
+        {OpType::OR},
+    };
+
+    static constexpr Op kOrProgram[] = {
+        {OpType::LOAD, 2},
+        {OpType::LOAD, 1},
+        {OpType::OR},
+        {OpType::LOAD, 0},
+        {OpType::AND},
+        {OpType::LOAD, 2},
+        {OpType::LOAD, 3},
+        {OpType::AND},
+        {OpType::OR},
+    };
 };
 }  // namespace common
 }  // namespace milvus
\ No newline at end of file
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <memory>
+#include <utility>
 
 #include "common/EasyAssert.h"
 #include "Types.h"
@@ -234,6 +235,20 @@ class ColumnVector final : public SimpleVector {
         return is_bitmap_;
     }
 
+    // moves the bits of a bitmap vector out so they can back another bitmap,
+    // leaving the vector empty; false when they are shared with another owner
+    bool
+    TakeBitmaps(TargetBitmap& bitmap, TargetBitmap& valid_bitmap) {
+        if (!is_bitmap_ || values_.use_count() != 1) {
+            return false;
+        }
+        bitmap =
+            static_cast<FieldBitsetImpl<uint8_t>*>(values_.get())->TakeBitmap();
+        valid_bitmap = std::exchange(valid_values_, TargetBitmap());
+        length_ = 0;
+        return true;
+    }
+
     void
     resize(vector_size_t new_size, bool setNotNull = true) override {
         AssertInfo(!is_bitmap_, "Cannot resize bitmap column vector");
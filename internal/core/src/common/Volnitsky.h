@@ -62,16 +62,23 @@ class VolnitskySearcher {
     /// Returns true if haystack contains needle as a substring.
     bool
     contains(std::string_view haystack) const {
+        return find(haystack) != nullptr;
+    }
+
+    /// Returns the leftmost occurrence of needle in haystack, nullptr if
+    /// there is none.
+    const char*
+    find(std::string_view haystack) const {
         if (needle_size_ == 0)
-            return true;
+            return haystack.data();
         if (haystack.size() < needle_size_)
-            return false;
+            return nullptr;
 
         if (!use_volnitsky_) {
-            return fallbackSearch(
-                       reinterpret_cast<const uint8_t*>(haystack.data()),
-                       reinterpret_cast<const uint8_t*>(haystack.data()) +
-                           haystack.size()) != nullptr;
+            return reinterpret_cast<const char*>(fallbackSearch(
+                reinterpret_cast<const uint8_t*>(haystack.data()),
+                reinterpret_cast<const uint8_t*>(haystack.data()) +
+                    haystack.size()));
         }
 
         const auto* h = reinterpret_cast<const uint8_t*>(haystack.data());
@@ -85,16 +92,23 @@ class VolnitskySearcher {
         for (; pos <= h_end - 2; pos += step_) {
             uint16_t bg = readBigram(pos);
 
-            // Walk the open-addressing chain
+            // Walk the open-addressing chain. Every occurrence covers one
+            // of the probed positions, so the leftmost one is the smallest
+            // candidate verified at the first position with any match.
+            const uint8_t* found = nullptr;
             for (size_t cell = bg % kHashSize; hash_[cell] != 0;
                  cell = (cell + 1) % kHashSize) {
                 // hash_[cell] = position_in_needle + 1
                 const auto* candidate = pos - (hash_[cell] - 1);
-                if (candidate >= h && candidate + needle_size_ <= h_end &&
+                if ((found == nullptr || candidate < found) &&
+                    candidate >= h && candidate + needle_size_ <= h_end &&
                     fastCompare(candidate, n, needle_size_)) {
-                    return true;
+                    found = candidate;
                 }
             }
+            if (found != nullptr) {
+                return reinterpret_cast<const char*>(found);
+            }
         }
 
         // Tail scan: the main loop may have skipped past potential
@@ -102,8 +116,8 @@ class VolnitskySearcher {
         const auto* tail_start = pos - step_ + 1;
         if (tail_start < h + needle_size_ - 2)
             tail_start = h + needle_size_ - 2;
-        return fallbackSearch(tail_start - (needle_size_ - 2), h_end) !=
-               nullptr;
+        return reinterpret_cast<const char*>(
+            fallbackSearch(tail_start - (needle_size_ - 2), h_end));
     }
 
  private:
@@ -30,6 +30,8 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <optional>
 #include <string>
 #include <string_view>
 
@@ -74,6 +76,60 @@ class array_view;
 class document_view;
 class value_view;
 
+// The number of bytes the value of a `t` element starting at `value` takes,
+// std::nullopt when `t` is not one of the types above or the value does not
+// fit in the `remaining` bytes.
+inline std::optional<size_t>
+value_size(type t, const uint8_t* value, size_t remaining) {
+    size_t size;
+    switch (t) {
+        case type::k_double:
+        case type::k_int64:
+            size = 8;
+            break;
+        case type::k_int32:
+            size = 4;
+            break;
+        case type::k_bool:
+            size = 1;
+            break;
+        case type::k_null:
+            size = 0;
+            break;
+        case type::k_string:
+        case type::k_binary:
+        case type::k_document:
+        case type::k_array: {
+            if (remaining < 4) {
+                return std::nullopt;
+            }
+            int32_t len;
+            std::memcpy(&len, value, sizeof(len));
+            // a string counts its trailing '\0', a document its length and
+            // trailing '\0', binary data is preceded by its subtype
+            int32_t min_len = t == type::k_string   ? 1
+                              : t == type::k_binary ? 0
+                                                    : 5;
+            if (len < min_len) {
+                return std::nullopt;
+            }
+            size = static_cast<size_t>(len);
+            if (t == type::k_string) {
+                size += 4;
+            } else if (t == type::k_binary) {
+                size += 5;
+            }
+            break;
+        }
+        default:
+            return std::nullopt;
+    }
+    if (size > remaining) {
+        return std::nullopt;
+    }
+    return size;
+}
+
 namespace detail {
 // Shared scalar accessors over a copied bson_value_t (used by both value_view
 // and element).
@@ -149,6 +205,11 @@ class view_base {
         return len_;
     }
 
+    // Walks the element list in place instead of through bson_iter_next,
+    // which scans every key a byte at a time: a key is found with memchr
+    // and a value skipped by the size its type implies. Iteration stops at
+    // the first element that does not fit the buffer, as bson_iter_next
+    // does, and at any type outside `type`, which Milvus never writes.
     class iterator {
      public:
         using iterator_category = std::input_iterator_tag;
@@ -160,12 +221,18 @@ class view_base {
         iterator() = default;  // end sentinel
 
         iterator(const uint8_t* data, uint32_t len) {
-            if (data == nullptr || len == 0 ||
-                !bson_init_static(&bson_, data, len) ||
-                !bson_iter_init(&iter_, &bson_)) {
-                valid_ = false;
+            int32_t declared_len = 0;
+            if (data != nullptr && len >= 5) {
+                std::memcpy(&declared_len, data, sizeof(declared_len));
+            }
+            if (declared_len < 5 ||
+                static_cast<uint32_t>(declared_len) != len ||
+                data[len - 1] != 0) {
                 return;
             }
+            next_ = data + 4;
+            // the trailing '\0' of the document
+            end_ = data + len - 1;
             advance();
         }
 
@@ -190,7 +257,7 @@ class view_base {
             if (!valid_) {
                 return true;
             }
-            return iter_.off == o.iter_.off;
+            return next_ == o.next_;
         }
         bool
         operator!=(const iterator& o) const {
@@ -200,17 +267,71 @@ class view_base {
      private:
         void
         advance() {
-            if (bson_iter_next(&iter_)) {
-                cur_ = element(std::string_view(bson_iter_key(&iter_)),
-                               *bson_iter_value(&iter_));
-                valid_ = true;
-            } else {
-                valid_ = false;
+            valid_ = false;
+            if (next_ >= end_) {
+                return;
+            }
+            auto t = static_cast<bson::type>(*next_);
+            auto key = reinterpret_cast<const char*>(next_ + 1);
+            auto key_end =
+                static_cast<const char*>(std::memchr(key, 0, end_ - next_ - 1));
+            if (key_end == nullptr) {
+                return;
+            }
+            auto value = reinterpret_cast<const uint8_t*>(key_end + 1);
+            auto size = value_size(t, value, end_ - value);
+            if (!size.has_value()) {
+                return;
+            }
+
+            bson_value_t v{};
+            v.value_type = static_cast<bson_type_t>(t);
+            int32_t len;
+            switch (t) {
+                case type::k_double:
+                    std::memcpy(&v.value.v_double, value, 8);
+                    break;
+                case type::k_int64:
+                    std::memcpy(&v.value.v_int64, value, 8);
+                    break;
+                case type::k_int32:
+                    std::memcpy(&v.value.v_int32, value, 4);
+                    break;
+                case type::k_bool:
+                    v.value.v_bool = *value != 0;
+                    break;
+                case type::k_string:
+                    std::memcpy(&len, value, sizeof(len));
+                    v.value.v_utf8.str =
+                        const_cast<char*>(reinterpret_cast<const char*>(value) +
+                                          sizeof(len));
+                    v.value.v_utf8.len = static_cast<uint32_t>(len - 1);
+                    break;
+                case type::k_binary:
+                    std::memcpy(&len, value, sizeof(len));
+                    v.value.v_binary.subtype =
+                        static_cast<bson_subtype_t>(value[sizeof(len)]);
+                    v.value.v_binary.data =
+                        const_cast<uint8_t*>(value + sizeof(len) + 1);
+                    v.value.v_binary.data_len = static_cast<uint32_t>(len);
+                    break;
+                case type::k_document:
+                case type::k_array:
+                    v.value.v_doc.data = const_cast<uint8_t*>(value);
+                    v.value.v_doc.data_len =
+                        static_cast<uint32_t>(size.value());
+                    break;
+                default:
+                    break;
             }
+            cur_ = element(std::string_view(key, key_end - key), v);
+            next_ = value + size.value();
+            valid_ = true;
         }
 
-        bson_t bson_{};
-        bson_iter_t iter_{};
+        // the element after cur_
+        const uint8_t* next_{nullptr};
+        const uint8_t* end_{nullptr};
         element cur_{};
         bool valid_{false};
     };
@@ -38,35 +38,41 @@ namespace milvus {
 
 struct BsonRawField {
     milvus::bson::type type;
-    std::string key;
+    std::string_view key;      // points into the BSON buffer
     const uint8_t* value_ptr;  // points to value (not including type/key)
 };
 
 inline int32_t
 ReadInt32(const uint8_t* ptr) {
-    return *reinterpret_cast<const int32_t*>(ptr);
+    int32_t value;
+    std::memcpy(&value, ptr, sizeof(value));
+    return value;
 }
 
 inline int64_t
 ReadInt64(const uint8_t* ptr) {
-    return *reinterpret_cast<const int64_t*>(ptr);
+    int64_t value;
+    std::memcpy(&value, ptr, sizeof(value));
+    return value;
 }
 
 inline double
 ReadDouble(const uint8_t* ptr) {
-    return *reinterpret_cast<const double*>(ptr);
+    double value;
+    std::memcpy(&value, ptr, sizeof(value));
+    return value;
 }
 
 inline std::string
 ReadUtf8(const uint8_t* ptr) {
-    int32_t len = *reinterpret_cast<const int32_t*>(ptr);
+    int32_t len = ReadInt32(ptr);
     return std::string(reinterpret_cast<const char*>(ptr + 4),
                        len - 1);  // exclude trailing '\0'
 }
 
 inline std::string_view
 ReadUtf8View(const uint8_t* ptr) {
-    int32_t len = *reinterpret_cast<const int32_t*>(ptr);
+    int32_t len = ReadInt32(ptr);
     return std::string_view(reinterpret_cast<const char*>(ptr + 4),
                             len - 1);  // exclude trailing '\0'
 }
@@ -78,19 +84,19 @@ ReadBool(const uint8_t* ptr) {
 
 inline std::vector<uint8_t>
 ReadRawDocOrArray(const uint8_t* ptr) {
-    int32_t len = *reinterpret_cast<const int32_t*>(ptr);
+    int32_t len = ReadInt32(ptr);
     return std::vector<uint8_t>(ptr, ptr + len);
 }
 
 inline milvus::bson::document_view
 ParseAsDocument(const uint8_t* ptr) {
-    int32_t len = *reinterpret_cast<const int32_t*>(ptr);
+    int32_t len = ReadInt32(ptr);
     return milvus::bson::document_view(ptr, len);
 }
 
 inline milvus::bson::array_view
 ParseAsArray(const uint8_t* ptr) {
-    int32_t len = *reinterpret_cast<const int32_t*>(ptr);
+    int32_t len = ReadInt32(ptr);
     return milvus::bson::array_view(ptr, len);
 }
 
@@ -337,7 +343,7 @@ class BsonView {
         ptr += key_len + 1;  // +1 for null terminator
         const uint8_t* view_start = ptr;
         // parse length
-        int32_t len = *reinterpret_cast<const int32_t*>(ptr);
+        int32_t len = ReadInt32(ptr);
         if (ptr + len > data_ + size_) {
             ThrowInfo(ErrorCode::UnexpectedError,
                       "ParseAsArrayAtOffset out of range");
@@ -377,93 +383,95 @@ class BsonView {
         return std::nullopt;
     }
 
-    // extract pointer to the N-th value in a BSON array
-    template <typename T>
-    static std::optional<T>
-    GetNthElementInArray(const uint8_t* array_ptr, size_t index) {
+    // locate the N-th element of a BSON array, skipping each element
+    // before it by the size of its value rather than a byte at a time
+    static std::optional<BsonRawField>
+    FindNthElementInArray(const uint8_t* array_ptr, size_t index) {
+        int32_t len = ReadInt32(array_ptr);
+        if (len < 5) {
+            return std::nullopt;
+        }
+        // stop at the trailing '\0' of the array
+        const uint8_t* end = array_ptr + len - 1;
         const uint8_t* ptr = array_ptr + 4;
-        for (size_t i = 0; i <= index; ++i) {
-            auto type_tag = *ptr++;
-            if (type_tag == 0x00)
-                break;
-
-            while (*ptr != '\0') ++ptr;
-            ++ptr;
-
+        for (size_t i = 0; ptr < end; ++i) {
+            auto type_tag = static_cast<milvus::bson::type>(*ptr++);
+            auto key = reinterpret_cast<const char*>(ptr);
+            auto key_end =
+                static_cast<const char*>(std::memchr(key, 0, end - ptr));
+            if (key_end == nullptr) {
+                return std::nullopt;
+            }
+            ptr = reinterpret_cast<const uint8_t*>(key_end + 1);
             if (i == index) {
-                switch (static_cast<milvus::bson::type>(type_tag)) {
-                    case milvus::bson::type::k_int32:
-                        if constexpr (std::is_same_v<T, int32_t>) {
-                            return ReadInt32(ptr);
-                        }
-                        break;
-                    case milvus::bson::type::k_int64:
-                        if constexpr (std::is_same_v<T, int64_t>) {
-                            return ReadInt64(ptr);
-                        }
-                        break;
-                    case milvus::bson::type::k_double:
-                        if constexpr (std::is_same_v<T, double>) {
-                            return ReadDouble(ptr);
-                        }
-                        break;
-                    case milvus::bson::type::k_bool:
-                        if constexpr (std::is_same_v<T, bool>) {
-                            return ReadBool(ptr);
-                        }
-                        break;
-                    case milvus::bson::type::k_string:
-                        if constexpr (std::is_same_v<T, std::string>) {
-                            return ReadUtf8(ptr);
-                        }
-                        if constexpr (std::is_same_v<T, std::string_view>) {
-                            return ReadUtf8View(ptr);
-                        }
-                        break;
-                    case milvus::bson::type::k_array:
-                        if constexpr (std::is_same_v<
-                                          T,
-                                          milvus::bson::array_view>) {
-                            return ParseAsArray(ptr);
-                        }
-                        break;
-                    default:
-                        return std::nullopt;
-                }
+                return BsonRawField{
+                    type_tag, std::string_view(key, key_end - key), ptr};
             }
+            auto size = milvus::bson::value_size(type_tag, ptr, end - ptr);
+            if (!size.has_value()) {
+                return std::nullopt;
+            }
+            ptr += size.value();
+        }
+        return std::nullopt;
+    }
 
-            switch (static_cast<milvus::bson::type>(type_tag)) {
-                case milvus::bson::type::k_string: {
-                    int32_t len = *reinterpret_cast<const int32_t*>(ptr);
-                    ptr += 4 + len;
-                    break;
+    // read the value of an element found by FindNthElementInArray
+    template <typename T>
+    static std::optional<T>
+    GetValueFromField(const BsonRawField& field) {
+        const uint8_t* ptr = field.value_ptr;
+        switch (field.type) {
+            case milvus::bson::type::k_int32:
+                if constexpr (std::is_same_v<T, int32_t>) {
+                    return ReadInt32(ptr);
                 }
-                case milvus::bson::type::k_int32:
-                    ptr += 4;
-                    break;
-                case milvus::bson::type::k_int64:
-                    ptr += 8;
-                    break;
-                case milvus::bson::type::k_double:
-                    ptr += 8;
-                    break;
-                case milvus::bson::type::k_bool:
-                    ptr += 1;
-                    break;
-                case milvus::bson::type::k_array:
-                case milvus::bson::type::k_document: {
-                    int32_t len = *reinterpret_cast<const int32_t*>(ptr);
-                    ptr += len;
-                    break;
+                break;
+            case milvus::bson::type::k_int64:
+                if constexpr (std::is_same_v<T, int64_t>) {
+                    return ReadInt64(ptr);
                 }
-                default:
-                    return std::nullopt;
-            }
+                break;
+            case milvus::bson::type::k_double:
+                if constexpr (std::is_same_v<T, double>) {
+                    return ReadDouble(ptr);
+                }
+                break;
+            case milvus::bson::type::k_bool:
+                if constexpr (std::is_same_v<T, bool>) {
+                    return ReadBool(ptr);
+                }
+                break;
+            case milvus::bson::type::k_string:
+                if constexpr (std::is_same_v<T, std::string>) {
+                    return ReadUtf8(ptr);
+                }
+                if constexpr (std::is_same_v<T, std::string_view>) {
+                    return ReadUtf8View(ptr);
+                }
+                break;
+            case milvus::bson::type::k_array:
+                if constexpr (std::is_same_v<T, milvus::bson::array_view>) {
+                    return ParseAsArray(ptr);
+                }
+                break;
+            default:
+                break;
         }
-
         return std::nullopt;
     }
 
+    // extract the N-th value in a BSON array
+    template <typename T>
+    static std::optional<T>
+    GetNthElementInArray(const uint8_t* array_ptr, size_t index) {
+        auto field = FindNthElementInArray(array_ptr, index);
+        if (!field.has_value()) {
+            return std::nullopt;
+        }
+        return GetValueFromField<T>(field.value());
+    }
+
     inline BsonRawField
     ParseBsonField(const uint8_t* bson_data, size_t offset) const {
         const uint8_t* ptr = bson_data + offset;
@@ -473,7 +481,8 @@ class BsonView {
         size_t key_len = strlen(key_cstr);
         ptr += key_len + 1;
 
-        return BsonRawField{type_tag, key_cstr, ptr};
+        return BsonRawField{
+            type_tag, std::string_view(key_cstr, key_len), ptr};
     }
 
     template <typename T>
@@ -32,6 +32,8 @@
 #include "storage/ThreadPool.h"
 #include "exec/expression/ExprCache.h"
 #include "log/Log.h"
+#include "segcore/SearchIteratorRegistry.h"
+#include "segcore/SearchResultCache.h"
 #include "segcore/memory_planner.h"
 #include "segcore/storagev2translator/GroupCTMeta.h"
 #include "storage/EntryStreamUtils.h"
@@ -56,6 +58,21 @@ SetLoadTransientBudgetBytes(int64_t bytes) {
     milvus::SetLoadTransientBudgetBytes(bytes);
 }
 
+void
+SetIndexBuildMemoryBudget(int64_t bytes) {
+    milvus::SetIndexBuildMemoryBudget(bytes);
+}
+
+void
+SetDiskAnnNodeCacheBudget(int64_t bytes) {
+    milvus::SetDiskAnnNodeCacheBudget(bytes);
+}
+
+void
+SetScalarIndexBuildParallelism(int64_t parallelism) {
+    milvus::SetScalarIndexBuildParallelism(parallelism);
+}
+
 void
 SetHighPriorityThreadCoreCoefficient(const float value) {
     milvus::SetHighPriorityThreadCoreCoefficient(value);
@@ -76,16 +93,56 @@ SetThreadPoolMaxThreadsSize(const int value) {
     milvus::SetThreadPoolMaxThreadsSize(value);
 }
 
+void
+SetBackgroundThreadPoolCpuShare(const float value) {
+    milvus::SetBackgroundThreadPoolCpuShare(value);
+}
+
 void
 SetDefaultExprEvalBatchSize(int64_t val) {
     milvus::SetDefaultExecEvalExprBatchSize(val);
 }
 
+void
+SetDefaultFilterMorselParallelism(int64_t parallelism, int64_t rows) {
+    milvus::SetDefaultExecFilterMorselParallelism(parallelism, rows);
+}
+
+void
+SetDefaultSearchNqSliceParallelism(int64_t parallelism, int64_t nq) {
+    milvus::SetDefaultExecSearchNqSliceParallelism(parallelism, nq);
+}
+
+void
+SetDefaultSpillConfig(int64_t memory_limit, const char* directory) {
+    milvus::SetDefaultExecSpillConfig(memory_limit, directory ? directory : "");
+}
+
+void
+SetDefaultQueryMemoryConfig(int64_t node_budget, int64_t query_limit) {
+    milvus::SetDefaultExecMemoryConfig(node_budget, query_limit);
+}
+
+void
+SetDefaultRawScanSelectivityThreshold(double threshold) {
+    milvus::SetDefaultExecRawScanSelectivityThreshold(threshold);
+}
+
+void
+SetDefaultSkipDeletedRowsRatio(double ratio) {
+    milvus::SetDefaultExecSkipDeletedRowsRatio(ratio);
+}
+
 void
 SetDefaultDeleteDumpBatchSize(int64_t val) {
     milvus::SetDefaultDeleteDumpBatchSize(val);
 }
 
+void
+SetDefaultRangeSearchStreamScanLimit(int64_t val) {
+    milvus::SetDefaultRangeSearchStreamScanLimit(val);
+}
+
 void
 SetDefaultOptimizeExprEnable(bool val) {
     milvus::SetDefaultOptimizeExprEnable(val);
@@ -111,6 +168,91 @@ SetDefaultEnableParquetStatsSkipIndex(bool val) {
     milvus::SetDefaultEnableParquetStatsSkipIndex(val);
 }
 
+void
+SetDefaultEnablePackedIntChunk(bool val) {
+    milvus::SetDefaultEnablePackedIntChunk(val);
+}
+
+void
+SetDefaultEnableMmapAccessAdvice(bool val) {
+    milvus::SetDefaultEnableMmapAccessAdvice(val);
+}
+
+void
+SetDefaultEnableIndexMmapReadahead(bool val) {
+    milvus::SetDefaultEnableIndexMmapReadahead(val);
+}
+
+void
+SetDefaultEnableChunkHugePage(bool val) {
+    milvus::SetDefaultEnableChunkHugePage(val);
+}
+
+void
+SetDefaultEnableProjectedGroupLoad(bool val) {
+    milvus::SetDefaultEnableProjectedGroupLoad(val);
+}
+
+void
+SetDefaultEnableNumaAwareExecution(bool val) {
+    milvus::SetDefaultEnableNumaAwareExecution(val);
+}
+
+void
+SetDefaultEnableFairQueryScheduling(bool val) {
+    milvus::SetDefaultEnableFairQueryScheduling(val);
+}
+
+void
+SetDefaultEnableAdaptivePayloadEncoding(bool val) {
+    milvus::SetDefaultEnableAdaptivePayloadEncoding(val);
+}
+
+void
+SetDefaultScanPrefetchWindow(int64_t val) {
+    milvus::SetDefaultScanPrefetchWindow(val);
+}
+
+void
+SetDefaultTantivyResultCacheCapacity(int64_t val) {
+    milvus::SetDefaultTantivyResultCacheCapacity(val);
+}
+
+void
+SetDefaultQueryGeometryCacheCapacity(int64_t val) {
+    milvus::SetDefaultQueryGeometryCacheCapacity(val);
+}
+
+void
+SetDefaultJsonDocCacheCapacity(int64_t val) {
+    milvus::SetDefaultJsonDocCacheCapacity(val);
+}
+
+void
+SetDefaultExternalTakeCacheCapacity(int64_t val) {
+    milvus::SetDefaultExternalTakeCacheCapacity(val);
+}
+
+void
+SetDefaultPlanCacheCapacity(int64_t val) {
+    milvus::SetDefaultPlanCacheCapacity(val);
+}
+
+void
+SetDefaultPatternMatcherCacheCapacity(int64_t val) {
+    milvus::SetDefaultPatternMatcherCacheCapacity(val);
+}
+
+void
+SetDefaultQueryPinCacheCapacity(int64_t val) {
+    milvus::SetDefaultQueryPinCacheCapacity(val);
+}
+
+void
+SetDefaultPerfCounterSampleInterval(int64_t val) {
+    milvus::SetDefaultPerfCounterSampleInterval(val);
+}
+
 void
 SetEnableLatestDeleteSnapshotOptimization(bool val) {
     milvus::SetEnableLatestDeleteSnapshotOptimization(val);
@@ -142,6 +284,8 @@ SetExprResCacheConfig(const char* mode,
         config.mode = milvus::exec::CacheMode::Disk;
     } else if (mode_value == "memory") {
         config.mode = milvus::exec::CacheMode::Memory;
+    } else if (mode_value == "hybrid") {
+        config.mode = milvus::exec::CacheMode::Hybrid;
     } else {
         LOG_WARN("invalid expr result cache mode '{}', disabling cache",
                  mode_value);
@@ -149,9 +293,8 @@ SetExprResCacheConfig(const char* mode,
         return;
     }
 
-    if ((config.mode == milvus::exec::CacheMode::Memory &&
-         mem_max_bytes <= 0) ||
-        (config.mode == milvus::exec::CacheMode::Disk &&
+    if ((config.mode != milvus::exec::CacheMode::Disk && mem_max_bytes <= 0) ||
+        (config.mode != milvus::exec::CacheMode::Memory &&
          (disk_max_bytes <= 0 || disk_max_file_size <= 0))) {
         LOG_WARN("invalid expr result cache size config, disabling cache");
         milvus::exec::ExprResCacheManager::SetEnabled(false);
@@ -180,6 +323,47 @@ SetExprResCacheConfig(const char* mode,
     milvus::exec::ExprResCacheManager::SetEnabled(applied);
 }
 
+void
+SetSearchResultCacheConfig(bool enabled,
+                           int64_t max_bytes,
+                           int32_t admission_threshold) {
+    if (enabled && max_bytes <= 0) {
+        LOG_WARN("invalid search result cache size config, disabling cache");
+        enabled = false;
+    }
+    if (admission_threshold < 1) {
+        admission_threshold = 1;
+    } else if (admission_threshold > 255) {
+        admission_threshold = 255;
+    }
+    auto& cache = milvus::segcore::SearchResultCache::Instance();
+    if (enabled) {
+        cache.Configure(static_cast<size_t>(max_bytes),
+                        static_cast<uint8_t>(admission_threshold));
+    } else {
+        cache.Clear();
+    }
+    milvus::segcore::SearchResultCache::SetEnabled(enabled);
+}
+
+void
+SetSearchIteratorRegistryConfig(bool enabled,
+                                int64_t max_bytes,
+                                int64_t ttl_ms) {
+    if (enabled && (max_bytes <= 0 || ttl_ms <= 0)) {
+        LOG_WARN(
+            "invalid search iterator registry config, disabling registry");
+        enabled = false;
+    }
+    auto& registry = milvus::segcore::SearchIteratorRegistry::Instance();
+    if (enabled) {
+        registry.Configure(static_cast<size_t>(max_bytes), ttl_ms);
+    } else {
+        registry.Clear();
+    }
+    milvus::segcore::SearchIteratorRegistry::SetEnabled(enabled);
+}
+
 void
 SetArrowIOThreadPoolCapacity(int threads) {
     if (threads <= 0) {
@@ -34,6 +34,15 @@ SetIndexSliceSize(const int64_t);
 void
 SetLoadTransientBudgetBytes(int64_t bytes);
 
+void
+SetIndexBuildMemoryBudget(int64_t bytes);
+
+void
+SetDiskAnnNodeCacheBudget(int64_t bytes);
+
+void
+SetScalarIndexBuildParallelism(int64_t parallelism);
+
 void
 SetHighPriorityThreadCoreCoefficient(const float);
 
@@ -46,12 +55,36 @@ SetLowPriorityThreadCoreCoefficient(const float);
 void
 SetThreadPoolMaxThreadsSize(const int);
 
+void
+SetBackgroundThreadPoolCpuShare(const float);
+
 void
 SetDefaultExprEvalBatchSize(int64_t val);
 
+void
+SetDefaultFilterMorselParallelism(int64_t parallelism, int64_t rows);
+
+void
+SetDefaultSearchNqSliceParallelism(int64_t parallelism, int64_t nq);
+
+void
+SetDefaultSpillConfig(int64_t memory_limit, const char* directory);
+
+void
+SetDefaultQueryMemoryConfig(int64_t node_budget, int64_t query_limit);
+
+void
+SetDefaultRawScanSelectivityThreshold(double threshold);
+
+void
+SetDefaultSkipDeletedRowsRatio(double ratio);
+
 void
 SetDefaultDeleteDumpBatchSize(int64_t val);
 
+void
+SetDefaultRangeSearchStreamScanLimit(int64_t val);
+
 void
 SetDefaultOptimizeExprEnable(bool val);
 
@@ -67,6 +100,66 @@ SetDefaultConfigParamTypeCheck(bool val);
 void
 SetDefaultEnableParquetStatsSkipIndex(bool val);
 
+void
+SetDefaultEnablePackedIntChunk(bool val);
+
+void
+SetDefaultEnableMmapAccessAdvice(bool val);
+
+void
+SetDefaultEnableIndexMmapReadahead(bool val);
+
+void
+SetDefaultEnableChunkHugePage(bool val);
+
+void
+SetDefaultEnableProjectedGroupLoad(bool val);
+
+// Must be set before the first search or load, the executors bound to the
+// NUMA nodes are created on first use.
+void
+SetDefaultEnableNumaAwareExecution(bool val);
+
+void
+SetDefaultEnableFairQueryScheduling(bool val);
+
+void
+SetDefaultEnableAdaptivePayloadEncoding(bool val);
+
+void
+SetDefaultScanPrefetchWindow(int64_t val);
+
+// Bytes of query results each sealed inverted index may cache, 0 disables it.
+void
+SetDefaultTantivyResultCacheCapacity(int64_t val);
+
+// Bytes of prepared query geometries each query thread may cache.
+void
+SetDefaultQueryGeometryCacheCapacity(int64_t val);
+
+// Bytes of parsed JSON documents a filter shares between its predicates.
+void
+SetDefaultJsonDocCacheCapacity(int64_t val);
+
+void
+SetDefaultExternalTakeCacheCapacity(int64_t val);
+
+void
+SetDefaultPlanCacheCapacity(int64_t val);
+
+// Compiled regex and LIKE matchers kept for reuse across segments.
+void
+SetDefaultPatternMatcherCacheCapacity(int64_t val);
+
+// Cache cells a query on a segment keeps pinned between its batches.
+void
+SetDefaultQueryPinCacheCapacity(int64_t val);
+
+// One in this many query driver runs reads the hardware performance
+// counters of its operators into the monitor histograms, 0 disables it.
+void
+SetDefaultPerfCounterSampleInterval(int64_t val);
+
 void
 SetEnableLatestDeleteSnapshotOptimization(bool val);
 
@@ -89,7 +182,7 @@ void
 SetExprResCacheEnable(bool val);
 
 void
-SetExprResCacheConfig(const char* mode,            // "memory" or "disk"
+SetExprResCacheConfig(const char* mode,  // "memory", "disk" or "hybrid"
                       const char* disk_base_path,  // disk mode: file path
                       int64_t mem_max_bytes,
                       bool compression_enabled,
@@ -99,6 +192,18 @@ SetExprResCacheConfig(const char* mode,            // "memory" or "disk"
                       int64_t disk_max_file_size,
                       int64_t disk_min_eval_duration_us);
 
+// Sealed segment search result cache
+void
+SetSearchResultCacheConfig(bool enabled,
+                           int64_t max_bytes,
+                           int32_t admission_threshold);
+
+// Registry keeping search iterator (v2) state between pages
+void
+SetSearchIteratorRegistryConfig(bool enabled,
+                                int64_t max_bytes,
+                                int64_t ttl_ms);
+
 // Set the capacity of arrow's internal IO thread pool. This pool runs
 // async range reads (ReadRangeCache) that issue actual S3 GetObject
 // requests, so it's the true ceiling on parallel object-storage reads —
@@ -117,6 +117,16 @@ typedef struct CArrowReaderConfig {
     int64_t range_size_limit_bytes;
 } CArrowReaderConfig;
 
+typedef struct CRemoteReadConfig {
+    int nr_threads;
+    int64_t min_part_size_bytes;
+    int64_t max_part_size_bytes;
+    double hedge_ratio;
+    // workers reading whole small objects, 0 disables them
+    int small_object_threads;
+    int64_t small_object_max_bytes;
+} CRemoteReadConfig;
+
 typedef struct CMmapConfig {
     const char* cache_read_ahead_policy;
     const char* mmap_path;
@@ -0,0 +1,102 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/BitmapPool.h"
+
+#include <optional>
+#include <utility>
+
+#include "monitor/Monitor.h"
+#include "prometheus/histogram.h"
+
+namespace milvus {
+namespace exec {
+
+thread_local BitmapPool* BitmapPool::current_ = nullptr;
+
+BitmapPool::~BitmapPool() {
+    if (allocated_bytes_ == 0 && reused_bytes_ == 0) {
+        return;
+    }
+    monitor::internal_core_query_bitmap_bytes_allocated.Observe(
+        allocated_bytes_);
+    monitor::internal_core_query_bitmap_bytes_reused.Observe(reused_bytes_);
+}
+
+TargetBitmap
+BitmapPool::Take(size_t size, bool init) {
+    if (size == 0) {
+        return TargetBitmap();
+    }
+    auto bitmap = TakeFree(size);
+    if (!bitmap.has_value()) {
+        return TargetBitmap(size, init);
+    }
+    bitmap->resize(size);
+    if (init) {
+        bitmap->set();
+    } else {
+        bitmap->reset();
+    }
+    return std::move(bitmap.value());
+}
+
+std::optional<TargetBitmap>
+BitmapPool::TakeFree(size_t size) {
+    auto bytes = static_cast<int64_t>((size + 7) / 8);
+    std::lock_guard lck(mutex_);
+    // the bitmap given back last is the likeliest to still be in cache
+    for (auto it = free_.rbegin(); it != free_.rend(); ++it) {
+        if (it->size() >= size) {
+            auto bitmap = std::move(*it);
+            free_.erase(std::next(it).base());
+            reused_bytes_ += bytes;
+            return bitmap;
+        }
+    }
+    allocated_bytes_ += bytes;
+    return std::nullopt;
+}
+
+void
+BitmapPool::Give(TargetBitmap&& bitmap) {
+    if (bitmap.empty()) {
+        return;
+    }
+    std::lock_guard lck(mutex_);
+    if (free_.size() < kMaxFreeBitmaps) {
+        free_.push_back(std::move(bitmap));
+    }
+}
+
+void
+BitmapPool::Recycle(VectorPtr& vector) {
+    if (vector == nullptr || vector.use_count() != 1) {
+        vector = nullptr;
+        return;
+    }
+    auto column = std::dynamic_pointer_cast<ColumnVector>(vector);
+    vector = nullptr;
+    TargetBitmap bitmap;
+    TargetBitmap valid_bitmap;
+    if (column != nullptr && column->TakeBitmaps(bitmap, valid_bitmap)) {
+        Give(std::move(bitmap));
+        Give(std::move(valid_bitmap));
+    }
+}
+
+}  // namespace exec
+}  // namespace milvus
@@ -0,0 +1,145 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include "common/Types.h"
+#include "common/Vector.h"
+
+namespace milvus {
+namespace exec {
+
+// Bitmaps recycled between the batches of one query. Every batch of a filter
+// allocates a result and a valid bitmap per expression and drops them once
+// they are merged into the filter result, so a query allocates and frees the
+// same few batch sized buffers thousands of times. Operators give the
+// bitmaps of results nothing else holds back to the pool of their
+// QueryContext, and the next batch takes them instead of allocating; all of
+// them are freed together with the QueryContext.
+//
+// The pool serves the expressions running on the thread of an active Scope,
+// a thread without one allocates as before. Morsel workers of one query
+// share its pool, so it is thread safe.
+class BitmapPool {
+ public:
+    // bitmaps held for reuse at most, a filter needs a couple per expression
+    static constexpr size_t kMaxFreeBitmaps = 32;
+
+    BitmapPool() = default;
+
+    BitmapPool(const BitmapPool&) = delete;
+    BitmapPool&
+    operator=(const BitmapPool&) = delete;
+
+    // reports the bytes the query allocated and reused
+    ~BitmapPool();
+
+    // makes `pool` the one Current() returns on this thread until the scope
+    // ends; a null pool disables reuse in the scope
+    class Scope {
+     public:
+        explicit Scope(BitmapPool* pool) : previous_(current_) {
+            current_ = pool;
+        }
+
+        ~Scope() {
+            current_ = previous_;
+        }
+
+        Scope(const Scope&) = delete;
+        Scope&
+        operator=(const Scope&) = delete;
+
+     private:
+        BitmapPool* previous_;
+    };
+
+    static BitmapPool*
+    Current() {
+        return current_;
+    }
+
+    // a bitmap of `size` bits all set to `init`, reusing a held bitmap of at
+    // least `size` bits when there is one
+    TargetBitmap
+    Take(size_t size, bool init);
+
+    // holds `bitmap` for a later Take, or frees it when the pool is full
+    void
+    Give(TargetBitmap&& bitmap);
+
+    // gives back both bitmaps of `vector` when it is a bitmap ColumnVector
+    // nobody else holds, and resets `vector`
+    void
+    Recycle(VectorPtr& vector);
+
+    // bytes of the bitmaps Take allocated
+    int64_t
+    allocated_bytes() const {
+        std::lock_guard lck(mutex_);
+        return allocated_bytes_;
+    }
+
+    // bytes of the bitmaps Take served from the held ones
+    int64_t
+    reused_bytes() const {
+        std::lock_guard lck(mutex_);
+        return reused_bytes_;
+    }
+
+    size_t
+    free_count() const {
+        std::lock_guard lck(mutex_);
+        return free_.size();
+    }
+
+ private:
+    // a held bitmap of at least `size` bits, counting the bytes either way
+    std::optional<TargetBitmap>
+    TakeFree(size_t size);
+
+    static thread_local BitmapPool* current_;
+
+    mutable std::mutex mutex_;
+    std::vector<TargetBitmap> free_;
+    int64_t allocated_bytes_ = 0;
+    int64_t reused_bytes_ = 0;
+};
+
+// a bitmap of `size` bits set to `init`, from the current pool if any
+inline TargetBitmap
+NewBitmap(size_t size, bool init) {
+    auto* pool = BitmapPool::Current();
+    return pool != nullptr ? pool->Take(size, init) : TargetBitmap(size, init);
+}
+
+// a bitmap ColumnVector of `size` rows, all false and all valid, the initial
+// result of most filter expressions
+inline std::shared_ptr<ColumnVector>
+NewBitmapColumn(size_t size) {
+    return std::make_shared<ColumnVector>(NewBitmap(size, false),
+                                          NewBitmap(size, true));
+}
+
+}  // namespace exec
+}  // namespace milvus
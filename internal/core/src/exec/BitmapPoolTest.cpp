@@ -0,0 +1,113 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <utility>
+
+#include "common/Types.h"
+#include "common/Vector.h"
+#include "exec/BitmapPool.h"
+
+using milvus::ColumnVector;
+using milvus::TargetBitmap;
+using milvus::VectorPtr;
+using milvus::exec::BitmapPool;
+using milvus::exec::NewBitmap;
+using milvus::exec::NewBitmapColumn;
+
+TEST(BitmapPoolTest, ReusesGivenBackBitmaps) {
+    BitmapPool pool;
+    auto bitmap = pool.Take(1000, true);
+    EXPECT_EQ(bitmap.size(), 1000);
+    EXPECT_TRUE(bitmap.all());
+    EXPECT_EQ(pool.allocated_bytes(), 125);
+
+    auto* data = bitmap.data();
+    pool.Give(std::move(bitmap));
+    EXPECT_EQ(pool.free_count(), 1);
+
+    // a smaller bitmap fits into the held one, which is filled anew
+    auto reused = pool.Take(900, false);
+    EXPECT_EQ(reused.data(), data);
+    EXPECT_EQ(reused.size(), 900);
+    EXPECT_TRUE(reused.none());
+    EXPECT_EQ(pool.reused_bytes(), 113);
+    EXPECT_EQ(pool.free_count(), 0);
+
+    // a held bitmap too small for the request is left alone
+    pool.Give(std::move(reused));
+    auto larger = pool.Take(2000, false);
+    EXPECT_NE(larger.data(), data);
+    EXPECT_EQ(pool.free_count(), 1);
+    EXPECT_EQ(pool.allocated_bytes(), 375);
+}
+
+TEST(BitmapPoolTest, HoldsLimitedBitmaps) {
+    BitmapPool pool;
+    for (size_t i = 0; i < BitmapPool::kMaxFreeBitmaps + 5; i++) {
+        pool.Give(TargetBitmap(64, false));
+    }
+    pool.Give(TargetBitmap());
+    EXPECT_EQ(pool.free_count(), BitmapPool::kMaxFreeBitmaps);
+}
+
+TEST(BitmapPoolTest, RecyclesOnlyUnsharedColumns) {
+    BitmapPool pool;
+    BitmapPool::Scope scope(&pool);
+    EXPECT_EQ(BitmapPool::Current(), &pool);
+
+    auto column = NewBitmapColumn(128);
+    EXPECT_EQ(pool.allocated_bytes(), 32);
+    auto* data = column->GetRawData();
+    VectorPtr result = column;
+
+    // still held through `column`
+    pool.Recycle(result);
+    EXPECT_EQ(result, nullptr);
+    EXPECT_EQ(pool.free_count(), 0);
+
+    result = std::move(column);
+    pool.Recycle(result);
+    EXPECT_EQ(result, nullptr);
+    EXPECT_EQ(pool.free_count(), 2);
+
+    auto next = NewBitmapColumn(128);
+    EXPECT_EQ(pool.reused_bytes(), 32);
+    EXPECT_EQ(pool.allocated_bytes(), 32);
+    EXPECT_EQ(next->size(), 128);
+    TargetBitmap reused_data(milvus::TargetBitmapView(next->GetRawData(), 128));
+    TargetBitmap reused_valid(
+        milvus::TargetBitmapView(next->GetValidRawData(), 128));
+    EXPECT_TRUE(reused_data.none());
+    EXPECT_TRUE(reused_valid.all());
+    EXPECT_TRUE(next->GetRawData() == data || next->GetValidRawData() == data);
+}
+
+TEST(BitmapPoolTest, AllocatesWithoutScope) {
+    EXPECT_EQ(BitmapPool::Current(), nullptr);
+    auto bitmap = NewBitmap(10, true);
+    EXPECT_EQ(bitmap.size(), 10);
+    EXPECT_TRUE(bitmap.all());
+
+    BitmapPool pool;
+    {
+        BitmapPool::Scope scope(&pool);
+        BitmapPool::Scope disabled(nullptr);
+        EXPECT_EQ(BitmapPool::Current(), nullptr);
+    }
+    EXPECT_EQ(BitmapPool::Current(), nullptr);
+}
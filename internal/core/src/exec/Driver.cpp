@@ -25,10 +25,13 @@
 #include <memory>
 #include <string>
 
+#include "common/Common.h"
 #include "common/EasyAssert.h"
 #include "common/Exception.h"
+#include "common/Tracepoint.h"
 #include "common/Tracer.h"
 #include "common/protobuf_utils.h"
+#include "exec/PerfCounters.h"
 #include "exec/QueryContext.h"
 #include "exec/Task.h"
 #include "exec/operator/AggregationNode.h"
@@ -39,10 +42,12 @@
 #include "exec/operator/IterativeFilterNode.h"
 #include "exec/operator/MvccNode.h"
 #include "exec/operator/Operator.h"
+#include "exec/operator/OperatorStats.h"
 #include "exec/operator/ProjectNode.h"
 #include "exec/operator/RandomSampleNode.h"
 #include "exec/operator/RescoresNode.h"
 #include "exec/operator/SearchGroupByNode.h"
+#include "exec/operator/SharedPrefilterNode.h"
 #include "exec/operator/VectorSearchNode.h"
 #include "exec/operator/QueryOrderByNode.h"
 #include "fmt/core.h"
@@ -50,6 +55,7 @@
 #include "folly/Unit.h"
 #include "glog/logging.h"
 #include "log/Log.h"
+#include "monitor/scope_metric.h"
 #include "plan/PlanNode.h"
 
 namespace milvus {
@@ -71,7 +77,25 @@ DriverFactory::CreateDriver(
     std::vector<std::unique_ptr<Operator>> operators;
     operators.reserve(plannodes_.size());
 
-    for (size_t i = 0; i < plannodes_.size(); ++i) {
+    // a pre-filter evaluated beforehand replaces the nodes feeding the
+    // vector search
+    size_t first_node = 0;
+    if (ctx->task_->query_context()->get_shared_prefilter() != nullptr) {
+        for (size_t i = 0; i < plannodes_.size(); ++i) {
+            if (std::dynamic_pointer_cast<const plan::VectorSearchNode>(
+                    plannodes_[i])) {
+                AssertInfo(i > 0, "vector search has no pre-filter to share");
+                tracer::AddEvent("create_operator: SharedPrefilterNode");
+                operators.push_back(std::make_unique<PhySharedPrefilterNode>(
+                    operators.size(), ctx.get(), plannodes_[i - 1]->id()));
+                first_node = i;
+                break;
+            }
+        }
+        AssertInfo(first_node > 0, "shared prefilter without vector search");
+    }
+
+    for (size_t i = first_node; i < plannodes_.size(); ++i) {
         auto id = operators.size();
         const auto& plannode = plannodes_[i];
         if (auto filterbitsnode =
@@ -172,7 +196,9 @@ void
 Driver::Run(std::shared_ptr<Driver> self) {
     std::shared_ptr<BlockingState> blocking_state;
     RowVectorPtr result;
+    MILVUS_TRACEPOINT(driver_run_start, self.get());
     auto reason = self->RunInternal(self, blocking_state, result);
+    MILVUS_TRACEPOINT(driver_run_end, self.get(), static_cast<int>(reason));
 
     AssertInfo(result == nullptr,
                "The last operator (sink) must not produce any results.");
@@ -230,6 +256,50 @@ Driver::Init(std::unique_ptr<DriverContext> ctx,
     AssertInfo(operators.size() != 0, "operators in driver must not empty");
     operators_ = std::move(operators);
     current_operator_index_ = operators_.size() - 1;
+    const auto& query_context = ctx_->task_->query_context();
+    explain_analyze_ = query_context && query_context->explain_analyze();
+    sample_perf_counters_ = SamplePerfCounters(explain_analyze_);
+    collect_stats_ = explain_analyze_ || sample_perf_counters_;
+}
+
+bool
+Driver::SamplePerfCounters(bool explain_analyze) {
+    static std::atomic<uint64_t> runs{0};
+    auto interval =
+        PERF_COUNTER_SAMPLE_INTERVAL.load(std::memory_order_relaxed);
+    if (interval <= 0) {
+        return false;
+    }
+    // EXPLAIN ANALYZE always shows the counters once they are enabled
+    return explain_analyze ||
+           runs.fetch_add(1, std::memory_order_relaxed) % interval == 0;
+}
+
+OperatorStatsTimer
+Driver::StatsTimer(Operator* op) {
+    if (!collect_stats_) {
+        return OperatorStatsTimer(nullptr, nullptr);
+    }
+    return OperatorStatsTimer(
+        &op->stats(),
+        ctx_->task_->query_context()->get_op_context(),
+        sample_perf_counters_ ? PerfCounters::ForCurrentThread() : nullptr);
+}
+
+void
+Driver::RecordInput(Operator* op, const RowVectorPtr& input) {
+    if (collect_stats_) {
+        op->stats().input_rows += input->size();
+        op->stats().input_batches++;
+    }
+}
+
+void
+Driver::RecordOutput(Operator* op, const RowVectorPtr& output) {
+    if (collect_stats_) {
+        op->stats().output_rows += output->size();
+        op->stats().output_batches++;
+    }
 }
 
 void
@@ -238,6 +308,38 @@ Driver::Close() {
         return;
     }
 
+    if (sample_perf_counters_) {
+        // the operators one by one, then the whole run
+        PerfCounterValues total;
+        for (auto& op : operators_) {
+            const auto& perf = op->stats().perf;
+            monitor::ObserveOperatorPerfCounters(op->ToString(),
+                                                 perf.instructions,
+                                                 perf.cycles,
+                                                 perf.llc_misses,
+                                                 perf.branch_misses);
+            total += perf;
+        }
+        monitor::ObserveOperatorPerfCounters("Driver",
+                                             total.instructions,
+                                             total.cycles,
+                                             total.llc_misses,
+                                             total.branch_misses);
+    }
+
+    if (explain_analyze_) {
+        std::vector<OperatorStats> stats;
+        stats.reserve(operators_.size());
+        for (auto& op : operators_) {
+            auto& s = stats.emplace_back(op->stats());
+            s.operator_type = op->ToString();
+            s.plannode_id = op->get_plannode_id();
+            s.operator_id = op->get_operator_id();
+            s.pipeline_id = ctx_->pipelineid_;
+        }
+        ctx_->task_->AddOperatorStats(std::move(stats));
+    }
+
     for (auto& op : operators_) {
         op->Close();
     }
@@ -317,6 +419,7 @@ Driver::RunInternal(std::shared_ptr<Driver>& self,
                     if (needs_input) {
                         RowVectorPtr result;
                         {
+                            auto timer = StatsTimer(op);
                             CALL_OPERATOR(
                                 result = op->GetOutput(), op, "GetOutput");
                             if (result) {
@@ -326,9 +429,12 @@ Driver::RunInternal(std::shared_ptr<Driver>& self,
                                         "GetOutput must return nullptr or "
                                         "a non-empty vector: {}",
                                         op->get_operator_type()));
+                                RecordOutput(op, result);
                             }
                         }
                         if (result) {
+                            RecordInput(next_op, result);
+                            auto timer = StatsTimer(next_op);
                             CALL_OPERATOR(
                                 next_op->AddInput(result), next_op, "AddInput");
                             i += 2;
@@ -349,6 +455,7 @@ Driver::RunInternal(std::shared_ptr<Driver>& self,
                                 return StopReason::kBlock;
                             }
                             if (op->IsFinished()) {
+                                auto timer = StatsTimer(next_op);
                                 CALL_OPERATOR(next_op->NoMoreInput(),
                                               next_op,
                                               "NoMoreInput");
@@ -358,6 +465,7 @@ Driver::RunInternal(std::shared_ptr<Driver>& self,
                     }
                 } else {
                     {
+                        auto timer = StatsTimer(op);
                         CALL_OPERATOR(
                             result = op->GetOutput(), op, "GetOutput");
                         if (result) {
@@ -366,6 +474,7 @@ Driver::RunInternal(std::shared_ptr<Driver>& self,
                                 fmt::format("GetOutput must return nullptr or "
                                             "a non-empty vector: {}",
                                             op->get_operator_type()));
+                            RecordOutput(op, result);
                             blocking_reason_ = BlockingReason::kWaitForConsumer;
                             return StopReason::kBlock;
                         }
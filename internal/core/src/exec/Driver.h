@@ -28,6 +28,7 @@
 #include "common/Promise.h"
 #include "common/Vector.h"
 #include "exec/QueryContext.h"
+#include "exec/operator/OperatorStats.h"
 #include "plan/PlanNode.h"
 
 namespace milvus {
@@ -240,6 +241,21 @@ class Driver : public std::enable_shared_from_this<Driver> {
     void
     Close();
 
+    // whether a run reads the hardware counters of its operators
+    static bool
+    SamplePerfCounters(bool explain_analyze);
+
+    // No-op unless the plan asked for EXPLAIN ANALYZE or the run samples the
+    // hardware counters.
+    OperatorStatsTimer
+    StatsTimer(Operator* op);
+
+    void
+    RecordInput(Operator* op, const RowVectorPtr& input);
+
+    void
+    RecordOutput(Operator* op, const RowVectorPtr& output);
+
     std::unique_ptr<DriverContext> ctx_;
 
     std::atomic_bool closed_{false};
@@ -252,6 +268,11 @@ class Driver : public std::enable_shared_from_this<Driver> {
 
     BlockingReason blocking_reason_{BlockingReason::kNotBlocked};
 
+    bool collect_stats_{false};
+    bool explain_analyze_{false};
+    // this run reads the hardware counters, see PERF_COUNTER_SAMPLE_INTERVAL
+    bool sample_perf_counters_{false};
+
     friend struct DriverFactory;
 };
 
@@ -92,8 +92,8 @@ class ProbeState {
     template <Operation op, typename Compare, typename Insert, typename Table>
     inline char*
     fullProbe(Table& table, Compare compare, Insert insert) {
-        AssertInfo(op == Operation::kInsert,
-                   "Only support insert operation for group cases");
+        static_assert(op == Operation::kInsert || op == Operation::kProbe,
+                      "Only support insert and probe for group cases");
         if (group_ && compare(group_, row_)) {
             return group_;
         }
@@ -112,8 +112,12 @@ class ProbeState {
                 milvus::toBitMask(tagsInTable_ == kEmptyGroup) & kFullMask;
             // if there are still empty slot available, try to insert into existing empty slot or tombstone slot
             if (empty > 0) {
-                auto pos = milvus::bits::getAndClearLastSetBit(empty);
-                return insert(row_, bucketOffset_ + pos);
+                if constexpr (op == Operation::kProbe) {
+                    return nullptr;
+                } else {
+                    auto pos = milvus::bits::getAndClearLastSetBit(empty);
+                    return insert(row_, bucketOffset_ + pos);
+                }
             }
             bucketOffset_ = table.nextBucketOffset(bucketOffset_);
             tagsInTable_ = table.loadTags(bucketOffset_);
@@ -257,21 +261,92 @@ HashTable::fullProbe(HashLookup& lookup, ProbeState& state) {
         });
 }
 
+FOLLY_ALWAYS_INLINE void
+HashTable::prefetchBucket(uint64_t hash) const {
+    __builtin_prefetch(table_ + bucketOffset(hash));
+}
+
+FOLLY_ALWAYS_INLINE void
+HashTable::prefetchFirstHit(uint64_t hash) const {
+    const auto offset = bucketOffset(hash);
+    const auto wantedTags = TagVector::broadcast(hashTag(hash));
+    auto hits = static_cast<MaskType>(
+        milvus::toBitMask(loadTags(offset) == wantedTags));
+    if (hits) {
+        __builtin_prefetch(row(offset, bits::getAndClearLastSetBit(hits)));
+    }
+}
+
 void
 HashTable::groupProbe(milvus::exec::HashLookup& lookup) {
     AssertInfo(hashMode_ == HashMode::kHash, "Only support kHash mode for now");
     checkSizeAndAllocateTable(0);
     ProbeState state;
-    for (int32_t idx = 0; idx < lookup.hashes_.size(); idx++) {
+    const auto numRows = static_cast<int32_t>(lookup.hashes_.size());
+    const auto* hashes = lookup.hashes_.data();
+    if (!batchProbe_) {
+        for (int32_t idx = 0; idx < numRows; idx++) {
+            if (numDistinct_ >= rehashSize()) {
+                rehash();
+            }
+            state.preProbe(*this, hashes[idx], idx);
+            state.firstProbe<ProbeState::Operation::kInsert>(*this);
+            fullProbe(lookup, state);
+        }
+        return;
+    }
+
+    // Bucket lines are requested two steps ahead of the tag compare that
+    // locates the candidate group, which in turn runs ahead of the probe
+    // that compares its keys. A rehash in between only wastes the pending
+    // prefetches.
+    for (int32_t idx = 0; idx < std::min(numRows, kBucketPrefetchDistance);
+         idx++) {
+        prefetchBucket(hashes[idx]);
+    }
+    for (int32_t idx = 0; idx < std::min(numRows, kGroupPrefetchDistance);
+         idx++) {
+        prefetchFirstHit(hashes[idx]);
+    }
+    for (int32_t idx = 0; idx < numRows; idx++) {
+        if (idx + kBucketPrefetchDistance < numRows) {
+            prefetchBucket(hashes[idx + kBucketPrefetchDistance]);
+        }
+        if (idx + kGroupPrefetchDistance < numRows) {
+            prefetchFirstHit(hashes[idx + kGroupPrefetchDistance]);
+        }
         if (numDistinct_ >= rehashSize()) {
             rehash();
         }
-        state.preProbe(*this, lookup.hashes_[idx], idx);
+        state.preProbe(*this, hashes[idx], idx);
         state.firstProbe<ProbeState::Operation::kInsert>(*this);
         fullProbe(lookup, state);
     }
 }
 
+void
+HashTable::findGroups(HashLookup& lookup) {
+    AssertInfo(hashMode_ == HashMode::kHash, "Only support kHash mode for now");
+    const auto numRows = static_cast<int32_t>(lookup.hashes_.size());
+    lookup.newGroups_.clear();
+    if (table_ == nullptr) {
+        std::fill(lookup.hits_.begin(), lookup.hits_.end(), nullptr);
+        return;
+    }
+    constexpr auto op = ProbeState::Operation::kProbe;
+    ProbeState state;
+    for (int32_t idx = 0; idx < numRows; idx++) {
+        state.preProbe(*this, lookup.hashes_[idx], idx);
+        state.firstProbe<op>(*this);
+        lookup.hits_[idx] = state.fullProbe<op>(
+            *this,
+            [&](char* group, int32_t row) {
+                return compareKeys(group, lookup, row);
+            },
+            [](int32_t, uint64_t) -> char* { return nullptr; });
+    }
+}
+
 void
 HashTable::setHashMode(HashMode mode, int32_t numNew) {
     // TODO set hash mode kArray/kHash/kNormalizedKey
@@ -164,6 +164,15 @@ class BaseHashTable {
     virtual void
     groupProbe(HashLookup& lookup) = 0;
 
+    /// Like groupProbe() but never inserts: 'lookup.hits' is nullptr for the
+    /// keys without a group.
+    virtual void
+    findGroups(HashLookup& lookup) = 0;
+
+    /// Bytes of the bucket array, the rows are accounted by rows().
+    virtual int64_t
+    tableBytes() const = 0;
+
     virtual void
     clear(bool freeTable = false) = 0;
 
@@ -196,9 +205,32 @@ class HashTable : public BaseHashTable {
     void
     setHashMode(HashMode mode, int32_t numNew) override;
 
+    /// Probes in input order, but looks ahead: the bucket of the row
+    /// kBucketPrefetchDistance rows ahead is prefetched, and the first group
+    /// whose tag matches in the bucket kGroupPrefetchDistance rows ahead, so
+    /// the cache misses of a batch overlap instead of stalling every row.
     void
     groupProbe(HashLookup& lookup) override;
 
+    void
+    findGroups(HashLookup& lookup) override;
+
+    int64_t
+    tableBytes() const override {
+        return capacity_ * tableSlotSize();
+    }
+
+    static constexpr int32_t kBucketPrefetchDistance = 16;
+    static constexpr int32_t kGroupPrefetchDistance = 8;
+
+    /// Switches groupProbe() between the lookahead probe (default) and the
+    /// plain one-row-at-a-time probe, for benchmarks and tests comparing
+    /// the two.
+    void
+    setBatchProbe(bool batchProbe) {
+        batchProbe_ = batchProbe;
+    }
+
     // The table in non-kArray mode has a power of two number of buckets each with
     // 16 slots. Each slot has a 1 byte tag (a field of hash number) and a 48 bit
     // pointer. All the tags are in a 16 byte SIMD word followed by the 6 byte
@@ -303,6 +335,14 @@ class HashTable : public BaseHashTable {
     void
     fullProbe(HashLookup& lookup, ProbeState& state);
 
+    // Lookahead steps of groupProbe(). Only hints, the tags they read may be
+    // outdated by the inserts of the rows in between.
+    void
+    prefetchBucket(uint64_t hash) const;
+
+    void
+    prefetchFirstHit(uint64_t hash) const;
+
     void
     clear(bool freeTable = false) override;
 
@@ -356,6 +396,7 @@ class HashTable : public BaseHashTable {
     char* table_ = nullptr;
     std::vector<uint64_t> rowHashes_;
     int64_t maxNumGroups_;
+    bool batchProbe_{true};
 
     HashMode
     hashMode() const override {
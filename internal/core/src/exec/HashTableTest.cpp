@@ -0,0 +1,133 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "common/Types.h"
+#include "common/Vector.h"
+#include "exec/HashTable.h"
+#include "exec/VectorHasher.h"
+
+using namespace milvus;
+using namespace milvus::exec;
+
+namespace {
+
+RowVectorPtr
+MakeInt64Input(const std::vector<int64_t>& keys) {
+    auto column = std::make_shared<ColumnVector>(DataType::INT64, keys.size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+        column->SetValueAt<int64_t>(i, keys[i]);
+    }
+    return std::make_shared<RowVector>(std::vector<VectorPtr>{column});
+}
+
+std::unique_ptr<HashTable>
+MakeInt64Table(bool batchProbe) {
+    std::vector<std::unique_ptr<VectorHasher>> hashers;
+    hashers.push_back(VectorHasher::create(DataType::INT64, 0));
+    auto table = std::make_unique<HashTable>(
+        std::move(hashers), std::vector<Accumulator>{}, 1 << 20);
+    table->setBatchProbe(batchProbe);
+    return table;
+}
+
+}  // namespace
+
+TEST(HashTable, BatchProbeMatchesRowProbe) {
+    // enough distinct keys to rehash a few times mid batch, with repeats
+    // that must land on the group created earlier in the same batch
+    std::default_random_engine er(42);
+    std::uniform_int_distribution<int64_t> dist(0, 20000);
+    constexpr int32_t kBatchRows = 4096;
+
+    auto batched = MakeInt64Table(true);
+    auto rowByRow = MakeInt64Table(false);
+    HashLookup batchedLookup(batched->hashers());
+    HashLookup rowLookup(rowByRow->hashers());
+    std::unordered_map<int64_t, char*> groupOfKey;
+    std::unordered_map<int64_t, char*> rowGroupOfKey;
+
+    for (int batch = 0; batch < 8; ++batch) {
+        std::vector<int64_t> keys(kBatchRows);
+        for (auto& key : keys) {
+            key = dist(er);
+        }
+        auto input = MakeInt64Input(keys);
+
+        batched->prepareForGroupProbe(batchedLookup, input);
+        batched->groupProbe(batchedLookup);
+        rowByRow->prepareForGroupProbe(rowLookup, input);
+        rowByRow->groupProbe(rowLookup);
+
+        ASSERT_EQ(batchedLookup.newGroups_, rowLookup.newGroups_)
+            << "batch " << batch;
+        for (int32_t i = 0; i < kBatchRows; ++i) {
+            auto* group = batchedLookup.hits_[i];
+            ASSERT_NE(group, nullptr);
+            auto [it, inserted] = groupOfKey.emplace(keys[i], group);
+            ASSERT_EQ(it->second, group) << "key " << keys[i];
+            auto [rowIt, rowInserted] =
+                rowGroupOfKey.emplace(keys[i], rowLookup.hits_[i]);
+            ASSERT_EQ(rowIt->second, rowLookup.hits_[i]) << "key " << keys[i];
+        }
+    }
+    EXPECT_EQ(batched->rows()->allRows().size(), groupOfKey.size());
+    EXPECT_EQ(rowByRow->rows()->allRows().size(), groupOfKey.size());
+}
+
+TEST(HashTable, BatchProbeShortInput) {
+    // fewer rows than the prefetch distances
+    auto table = MakeInt64Table(true);
+    HashLookup lookup(table->hashers());
+    auto input = MakeInt64Input({7, 3, 7, 7, 3});
+    table->prepareForGroupProbe(lookup, input);
+    table->groupProbe(lookup);
+    EXPECT_EQ(lookup.newGroups_, (std::vector<vector_size_t>{0, 1}));
+    EXPECT_EQ(lookup.hits_[0], lookup.hits_[2]);
+    EXPECT_EQ(lookup.hits_[0], lookup.hits_[3]);
+    EXPECT_EQ(lookup.hits_[1], lookup.hits_[4]);
+    EXPECT_NE(lookup.hits_[0], lookup.hits_[1]);
+}
+
+TEST(HashTable, FindGroupsDoesNotInsert) {
+    auto table = MakeInt64Table(true);
+    HashLookup lookup(table->hashers());
+    auto missing = MakeInt64Input({1, 2});
+    table->prepareForGroupProbe(lookup, missing);
+    table->findGroups(lookup);
+    EXPECT_EQ(lookup.hits_[0], nullptr);
+    EXPECT_EQ(lookup.hits_[1], nullptr);
+
+    table->prepareForGroupProbe(lookup, MakeInt64Input({5, 9, 5}));
+    table->groupProbe(lookup);
+    auto* five = lookup.hits_[0];
+    auto* nine = lookup.hits_[1];
+
+    table->prepareForGroupProbe(lookup, MakeInt64Input({9, 4, 5, 4}));
+    table->findGroups(lookup);
+    EXPECT_EQ(lookup.hits_[0], nine);
+    EXPECT_EQ(lookup.hits_[1], nullptr);
+    EXPECT_EQ(lookup.hits_[2], five);
+    EXPECT_EQ(lookup.hits_[3], nullptr);
+    EXPECT_TRUE(lookup.newGroups_.empty());
+    EXPECT_EQ(table->rows()->allRows().size(), 2);
+}
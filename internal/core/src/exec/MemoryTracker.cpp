@@ -0,0 +1,201 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/MemoryTracker.h"
+
+#include <algorithm>
+
+#include "common/Common.h"
+#include "common/EasyAssert.h"
+#include "fmt/core.h"
+#include "log/Log.h"
+#include "monitor/Monitor.h"
+#include "prometheus/counter.h"
+#include "prometheus/gauge.h"
+#include "prometheus/histogram.h"
+
+namespace milvus {
+namespace exec {
+
+namespace {
+
+constexpr size_t kReportedConsumers = 3;
+
+void
+UpdatePeak(std::atomic<int64_t>& peak, int64_t used) {
+    auto current = peak.load(std::memory_order_relaxed);
+    while (used > current &&
+           !peak.compare_exchange_weak(
+               current, used, std::memory_order_relaxed)) {
+    }
+}
+
+}  // namespace
+
+MemoryTracker::MemoryTracker(std::string name,
+                             MemoryTracker* parent,
+                             int64_t limit)
+    : name_(std::move(name)), parent_(parent), limit_(limit) {
+    if (parent_ != nullptr) {
+        std::lock_guard lck(parent_->children_mutex_);
+        parent_->children_.insert(this);
+    }
+}
+
+MemoryTracker::MemoryTracker(ProcessTag)
+    : name_("process"), parent_(nullptr), limit_(0), is_process_(true) {
+}
+
+MemoryTracker::~MemoryTracker() {
+    if (parent_ == nullptr) {
+        return;
+    }
+    auto held = used();
+    if (held > 0) {
+        parent_->Shrink(held);
+    }
+    if (parent_->is_process_) {
+        monitor::internal_core_query_memory_bytes_peak.Observe(peak());
+    }
+    std::lock_guard lck(parent_->children_mutex_);
+    parent_->children_.erase(this);
+}
+
+MemoryTracker&
+MemoryTracker::Process() {
+    static MemoryTracker process{ProcessTag{}};
+    return process;
+}
+
+int64_t
+MemoryTracker::limit() const {
+    return is_process_ ? EXEC_NODE_MEMORY_BUDGET.load() : limit_;
+}
+
+void
+MemoryTracker::Grow(int64_t bytes) {
+    if (bytes <= 0) {
+        Shrink(-bytes);
+        return;
+    }
+    for (auto* tracker = this; tracker != nullptr; tracker = tracker->parent_) {
+        auto used = tracker->used_.fetch_add(bytes, std::memory_order_relaxed) +
+                    bytes;
+        auto limit = tracker->limit();
+        if (limit <= 0 || used <= limit) {
+            continue;
+        }
+        // nothing of a failed growth stays held
+        for (auto* grown = this; grown != tracker->parent_;
+             grown = grown->parent_) {
+            grown->used_.fetch_sub(bytes, std::memory_order_relaxed);
+        }
+        monitor::internal_core_query_memory_rejected_total_limit.Increment();
+        ThrowInfo(ErrorCode::MemAllocateFailed,
+                  "{} would hold {} bytes, over its memory limit of {} "
+                  "bytes, top consumers: {}",
+                  tracker->name_,
+                  used,
+                  limit,
+                  tracker->DescribeTopConsumers());
+    }
+    for (auto* tracker = this; tracker != nullptr; tracker = tracker->parent_) {
+        auto used = tracker->used();
+        UpdatePeak(tracker->peak_, used);
+        if (tracker->is_process_) {
+            monitor::internal_core_exec_memory_bytes_used.Set(used);
+        }
+    }
+}
+
+void
+MemoryTracker::Shrink(int64_t bytes) {
+    if (bytes <= 0) {
+        return;
+    }
+    for (auto* tracker = this; tracker != nullptr; tracker = tracker->parent_) {
+        auto used = tracker->used_.fetch_sub(bytes, std::memory_order_relaxed) -
+                    bytes;
+        if (tracker->is_process_) {
+            monitor::internal_core_exec_memory_bytes_used.Set(used);
+        }
+    }
+}
+
+void
+MemoryTracker::Set(int64_t bytes) {
+    Grow(bytes - used());
+}
+
+void
+MemoryTracker::CheckAdmission() const {
+    auto held = used();
+    auto budget = limit();
+    if (budget <= 0 || held < budget) {
+        return;
+    }
+    monitor::internal_core_query_memory_rejected_total_admission.Increment();
+    auto consumers = DescribeTopConsumers();
+    LOG_WARN("reject query, {} holds {} bytes of its {} bytes budget, top "
+             "consumers: {}",
+             name_,
+             held,
+             budget,
+             consumers);
+    ThrowInfo(ErrorCode::MemAllocateFailed,
+              "{} holds {} bytes of its {} bytes memory budget, retry "
+              "later, top consumers: {}",
+              name_,
+              held,
+              budget,
+              consumers);
+}
+
+std::vector<std::pair<std::string, int64_t>>
+MemoryTracker::TopConsumers(size_t n) const {
+    std::vector<std::pair<std::string, int64_t>> consumers;
+    {
+        std::lock_guard lck(children_mutex_);
+        consumers.reserve(children_.size());
+        for (const auto* child : children_) {
+            consumers.emplace_back(child->name(), child->used());
+        }
+    }
+    auto top = std::min(n, consumers.size());
+    std::partial_sort(consumers.begin(),
+                      consumers.begin() + top,
+                      consumers.end(),
+                      [](const auto& a, const auto& b) {
+                          return a.second > b.second;
+                      });
+    consumers.resize(top);
+    return consumers;
+}
+
+std::string
+MemoryTracker::DescribeTopConsumers() const {
+    std::string description;
+    for (const auto& [name, bytes] : TopConsumers(kReportedConsumers)) {
+        if (!description.empty()) {
+            description += ", ";
+        }
+        description += fmt::format("{}: {} bytes", name, bytes);
+    }
+    return description.empty() ? "none" : description;
+}
+
+}  // namespace exec
+}  // namespace milvus
@@ -0,0 +1,112 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace milvus {
+namespace exec {
+
+// Bytes held by the executing queries, as a tree: the process tracker at the
+// root, one tracker per QueryContext below it and one per operator holding
+// rows (ORDER BY, GROUP BY) below that. Growing a tracker grows all of its
+// ancestors, and fails with MemAllocateFailed, holding nothing more, when
+// that would take one of them past its limit, so a query fails instead of
+// taking the node down. A limit of 0 means no limit.
+//
+// The process tracker is limited by EXEC_NODE_MEMORY_BUDGET and a query
+// tracker by EXEC_QUERY_MEMORY_LIMIT, read when the query starts.
+class MemoryTracker {
+ public:
+    MemoryTracker(std::string name, MemoryTracker* parent, int64_t limit);
+
+    // gives back to the ancestors whatever this still holds
+    ~MemoryTracker();
+
+    MemoryTracker(const MemoryTracker&) = delete;
+    MemoryTracker&
+    operator=(const MemoryTracker&) = delete;
+
+    static MemoryTracker&
+    Process();
+
+    void
+    Grow(int64_t bytes);
+
+    void
+    Shrink(int64_t bytes);
+
+    // grows or shrinks to hold `bytes`, for owners that know their total
+    void
+    Set(int64_t bytes);
+
+    // fails with MemAllocateFailed, naming the largest consumers, when this
+    // is already at its limit, so a new query is turned away before it
+    // allocates anything
+    void
+    CheckAdmission() const;
+
+    const std::string&
+    name() const {
+        return name_;
+    }
+
+    int64_t
+    used() const {
+        return used_.load(std::memory_order_relaxed);
+    }
+
+    int64_t
+    peak() const {
+        return peak_.load(std::memory_order_relaxed);
+    }
+
+    int64_t
+    limit() const;
+
+    // the children holding the most bytes, largest first, at most `n`
+    std::vector<std::pair<std::string, int64_t>>
+    TopConsumers(size_t n) const;
+
+ private:
+    // the process tracker, whose limit follows EXEC_NODE_MEMORY_BUDGET
+    struct ProcessTag {};
+    explicit MemoryTracker(ProcessTag);
+
+    std::string
+    DescribeTopConsumers() const;
+
+    std::string name_;
+    MemoryTracker* parent_;
+    int64_t limit_;
+    bool is_process_{false};
+    std::atomic<int64_t> used_{0};
+    std::atomic<int64_t> peak_{0};
+
+    mutable std::mutex children_mutex_;
+    std::unordered_set<const MemoryTracker*> children_;
+};
+
+}  // namespace exec
+}  // namespace milvus
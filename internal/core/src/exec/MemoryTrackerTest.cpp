@@ -0,0 +1,111 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <exception>
+#include <memory>
+#include <string>
+
+#include "common/Common.h"
+#include "exec/MemoryTracker.h"
+
+using milvus::exec::MemoryTracker;
+
+TEST(MemoryTrackerTest, GrowsAncestors) {
+    MemoryTracker root("root", nullptr, 0);
+    MemoryTracker query("query", &root, 0);
+    {
+        MemoryTracker sort("sort", &query, 0);
+        sort.Grow(100);
+        sort.Set(300);
+        EXPECT_EQ(sort.used(), 300);
+        EXPECT_EQ(query.used(), 300);
+        EXPECT_EQ(root.used(), 300);
+
+        sort.Set(50);
+        EXPECT_EQ(root.used(), 50);
+        EXPECT_EQ(root.peak(), 300);
+
+        MemoryTracker agg("agg", &query, 0);
+        agg.Grow(20);
+        EXPECT_EQ(query.used(), 70);
+    }
+    // trackers give back what they hold when they go away
+    EXPECT_EQ(query.used(), 0);
+    EXPECT_EQ(root.used(), 0);
+    EXPECT_EQ(query.peak(), 300);
+}
+
+TEST(MemoryTrackerTest, FailedGrowthHoldsNothing) {
+    MemoryTracker root("root", nullptr, 1000);
+    MemoryTracker query("query", &root, 400);
+    MemoryTracker other("other", &root, 0);
+    MemoryTracker sort("sort", &query, 0);
+
+    sort.Grow(300);
+    // past the limit of the query
+    EXPECT_THROW(sort.Grow(200), std::exception);
+    EXPECT_EQ(sort.used(), 300);
+    EXPECT_EQ(query.used(), 300);
+    EXPECT_EQ(root.used(), 300);
+
+    // past the limit of the root, the query itself still has room
+    other.Grow(650);
+    EXPECT_THROW(sort.Set(400), std::exception);
+    EXPECT_EQ(sort.used(), 300);
+    EXPECT_EQ(root.used(), 950);
+
+    other.Shrink(650);
+    sort.Set(400);
+    EXPECT_EQ(root.used(), 400);
+}
+
+TEST(MemoryTrackerTest, ReportsTopConsumers) {
+    MemoryTracker root("root", nullptr, 0);
+    MemoryTracker small("small", &root, 0);
+    MemoryTracker large("large", &root, 0);
+    MemoryTracker medium("medium", &root, 0);
+    small.Grow(1);
+    large.Grow(100);
+    medium.Grow(10);
+
+    auto top = root.TopConsumers(2);
+    ASSERT_EQ(top.size(), 2);
+    EXPECT_EQ(top[0].first, "large");
+    EXPECT_EQ(top[0].second, 100);
+    EXPECT_EQ(top[1].first, "medium");
+    EXPECT_EQ(root.TopConsumers(10).size(), 3);
+}
+
+TEST(MemoryTrackerTest, AdmitsQueriesUnderTheNodeBudget) {
+    auto& process = MemoryTracker::Process();
+    auto budget = milvus::EXEC_NODE_MEMORY_BUDGET.load();
+    milvus::EXEC_NODE_MEMORY_BUDGET.store(0);
+    {
+        MemoryTracker query("query", &process, 0);
+        query.Grow(1000);
+        EXPECT_NO_THROW(process.CheckAdmission());
+
+        milvus::EXEC_NODE_MEMORY_BUDGET.store(process.used() + 500);
+        EXPECT_NO_THROW(process.CheckAdmission());
+        EXPECT_THROW(query.Grow(600), std::exception);
+
+        query.Grow(500);
+        EXPECT_THROW(process.CheckAdmission(), std::exception);
+    }
+    EXPECT_NO_THROW(process.CheckAdmission());
+    milvus::EXEC_NODE_MEMORY_BUDGET.store(budget);
+}
@@ -0,0 +1,151 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/MorselDispatcher.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+
+#include "common/EasyAssert.h"
+
+namespace milvus {
+namespace exec {
+
+namespace {
+
+struct MorselState {
+    MorselState(int64_t total_rows,
+                int64_t morsel_rows,
+                const MorselDispatcher::WorkerFactory& factory)
+        : total_rows(total_rows),
+          morsel_rows(morsel_rows),
+          num_morsels((total_rows + morsel_rows - 1) / morsel_rows),
+          factory(factory) {
+    }
+
+    // Returns the next morsel index, or -1 once everything is claimed or a
+    // worker failed.
+    int64_t
+    Claim() {
+        if (failed.load(std::memory_order_relaxed)) {
+            return -1;
+        }
+        auto idx = next.fetch_add(1, std::memory_order_relaxed);
+        return idx < num_morsels ? idx : -1;
+    }
+
+    void
+    Fail(std::exception_ptr e) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!error) {
+            error = std::move(e);
+        }
+        failed.store(true, std::memory_order_relaxed);
+    }
+
+    const int64_t total_rows;
+    const int64_t morsel_rows;
+    const int64_t num_morsels;
+    // Only dereferenced by a thread holding a claimed morsel, Run doesn't
+    // return before all of them are done.
+    const MorselDispatcher::WorkerFactory& factory;
+
+    std::atomic<int64_t> next{0};
+    std::atomic<bool> failed{false};
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    int32_t active{0};
+    std::exception_ptr error;
+};
+
+void
+Work(const std::shared_ptr<MorselState>& state) {
+    {
+        // register before claiming, the caller waits for `active` to drop
+        // to zero only after the counter is exhausted
+        std::lock_guard<std::mutex> lock(state->mutex);
+        ++state->active;
+    }
+    auto idx = state->Claim();
+    if (idx >= 0) {
+        try {
+            auto worker = state->factory();
+            for (; idx >= 0; idx = state->Claim()) {
+                auto begin = idx * state->morsel_rows;
+                auto end =
+                    std::min(begin + state->morsel_rows, state->total_rows);
+                worker(begin, end);
+            }
+        } catch (...) {
+            state->Fail(std::current_exception());
+        }
+    }
+    std::lock_guard<std::mutex> lock(state->mutex);
+    if (--state->active == 0) {
+        state->cv.notify_all();
+    }
+}
+
+}  // namespace
+
+int32_t
+MorselDispatcher::AvailableHelpers(folly::CPUThreadPoolExecutor* executor,
+                                   int32_t wanted) {
+    if (executor == nullptr || wanted <= 0) {
+        return 0;
+    }
+    auto stats = executor->getPoolStats();
+    if (stats.pendingTaskCount > 0) {
+        return 0;
+    }
+    return static_cast<int32_t>(
+        std::min<size_t>(wanted, stats.idleThreadCount));
+}
+
+void
+MorselDispatcher::Run(int64_t total_rows,
+                      int64_t morsel_rows,
+                      int32_t max_workers,
+                      folly::CPUThreadPoolExecutor* executor,
+                      const WorkerFactory& factory) {
+    AssertInfo(morsel_rows > 0, "morsel rows must be positive");
+    if (total_rows <= 0) {
+        return;
+    }
+    auto state =
+        std::make_shared<MorselState>(total_rows, morsel_rows, factory);
+
+    auto helpers = std::min<int64_t>(max_workers - 1, state->num_morsels - 1);
+    helpers = AvailableHelpers(executor, static_cast<int32_t>(helpers));
+    for (int64_t i = 0; i < helpers; ++i) {
+        executor->add([state]() { Work(state); });
+    }
+    Work(state);
+
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->cv.wait(lock, [&state]() { return state->active == 0; });
+    if (state->error) {
+        std::rethrow_exception(state->error);
+    }
+}
+
+}  // namespace exec
+}  // namespace milvus
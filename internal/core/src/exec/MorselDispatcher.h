@@ -0,0 +1,68 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+#include <folly/executors/CPUThreadPoolExecutor.h>
+
+namespace milvus {
+namespace exec {
+
+// Morsel-driven execution of one row range on several threads.
+//
+// [0, total_rows) is cut into morsels of `morsel_rows` rows (the last one may
+// be shorter). The calling thread and up to `max_workers - 1` helpers on
+// `executor` pull the next unclaimed morsel from a shared counter until none
+// is left, so a slow morsel never holds back the others: whoever is free
+// takes the next one.
+//
+// Every participating thread first builds its own worker through `factory`
+// and then feeds it the morsels it claims, always in increasing order, which
+// lets stateful workers (e.g. an expression with a forward-only cursor) skip
+// ahead instead of seeking. The worker is destroyed on the thread that built
+// it before Run returns.
+//
+// The caller never waits for a helper that hasn't started: it runs morsels
+// itself and only waits for helpers that already claimed one. Helpers that
+// start late find nothing to do and exit, so Run is safe to call from a
+// thread of `executor` itself even when the pool is saturated.
+//
+// The first exception thrown by a worker stops the remaining morsels and is
+// rethrown on the calling thread.
+class MorselDispatcher {
+ public:
+    using Worker = std::function<void(int64_t begin, int64_t end)>;
+    using WorkerFactory = std::function<Worker()>;
+
+    static void
+    Run(int64_t total_rows,
+        int64_t morsel_rows,
+        int32_t max_workers,
+        folly::CPUThreadPoolExecutor* executor,
+        const WorkerFactory& factory);
+
+    // Number of helpers worth dispatching: bounded by `wanted` and by the
+    // idle threads of the executor, so a busy node stays one thread per
+    // segment.
+    static int32_t
+    AvailableHelpers(folly::CPUThreadPoolExecutor* executor, int32_t wanted);
+};
+
+}  // namespace exec
+}  // namespace milvus
@@ -0,0 +1,155 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <folly/executors/CPUThreadPoolExecutor.h>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "common/Common.h"
+#include "common/Schema.h"
+#include "common/Types.h"
+#include "exec/MorselDispatcher.h"
+#include "expr/ITypeExpr.h"
+#include "knowhere/comp/index_param.h"
+#include "plan/PlanNode.h"
+#include "query/ExecPlanNodeVisitor.h"
+#include "test_utils/DataGen.h"
+#include "test_utils/storage_test_utils.h"
+
+using namespace milvus;
+using namespace milvus::exec;
+
+TEST(MorselDispatcher, CoversEveryRowOnce) {
+    folly::CPUThreadPoolExecutor executor(4);
+    constexpr int64_t kTotal = 10000;
+    std::vector<std::atomic<int32_t>> hits(kTotal);
+    MorselDispatcher::Run(kTotal, 128, 4, &executor, [&hits]() {
+        auto last_begin = std::make_shared<int64_t>(-1);
+        return [&hits, last_begin](int64_t begin, int64_t end) {
+            // morsels reach one worker in increasing order
+            EXPECT_GT(begin, *last_begin);
+            *last_begin = begin;
+            for (auto i = begin; i < end; ++i) {
+                hits[i].fetch_add(1);
+            }
+        };
+    });
+    for (int64_t i = 0; i < kTotal; ++i) {
+        ASSERT_EQ(hits[i].load(), 1) << "row " << i;
+    }
+}
+
+TEST(MorselDispatcher, WithoutExecutor) {
+    int64_t rows = 0;
+    int32_t workers = 0;
+    MorselDispatcher::Run(1000, 100, 4, nullptr, [&]() {
+        ++workers;
+        return [&rows](int64_t begin, int64_t end) { rows += end - begin; };
+    });
+    EXPECT_EQ(rows, 1000);
+    EXPECT_EQ(workers, 1);
+}
+
+TEST(MorselDispatcher, RethrowsWorkerError) {
+    folly::CPUThreadPoolExecutor executor(2);
+    EXPECT_THROW(MorselDispatcher::Run(
+                     1000,
+                     10,
+                     3,
+                     &executor,
+                     []() {
+                         return [](int64_t begin, int64_t) {
+                             if (begin == 500) {
+                                 throw std::runtime_error("morsel failed");
+                             }
+                         };
+                     }),
+                 std::runtime_error);
+}
+
+TEST(MorselDispatcher, RunFromSaturatedExecutor) {
+    // the only pool thread is the caller, it must finish all morsels alone
+    folly::CPUThreadPoolExecutor executor(1);
+    std::promise<int64_t> done;
+    auto rows = done.get_future();
+    executor.add([&executor, &done]() {
+        int64_t total = 0;
+        MorselDispatcher::Run(1000, 10, 4, &executor, [&total]() {
+            return [&total](int64_t begin, int64_t end) {
+                total += end - begin;
+            };
+        });
+        done.set_value(total);
+    });
+    EXPECT_EQ(rows.get(), 1000);
+}
+
+TEST(MorselDispatcher, FilterMatchesSerialEval) {
+    auto schema = std::make_shared<Schema>();
+    schema->AddDebugField(
+        "vec", DataType::VECTOR_FLOAT, 16, knowhere::metric::L2);
+    auto int64_fid = schema->AddDebugField("int64", DataType::INT64);
+    auto pk_fid = schema->AddDebugField("pk", DataType::INT64);
+    schema->set_primary_field_id(pk_fid);
+
+    constexpr int64_t N = 5000;
+    auto raw_data = segcore::DataGen(schema, N);
+    auto segment = CreateSealedWithFieldDataLoaded(schema, raw_data);
+
+    auto make_range = [&](proto::plan::OpType op, int64_t value) {
+        proto::plan::GenericValue val;
+        val.set_int64_val(value);
+        return std::make_shared<expr::UnaryRangeFilterExpr>(
+            expr::ColumnInfo(int64_fid, DataType::INT64), op, val);
+    };
+    auto expr = std::make_shared<expr::LogicalBinaryExpr>(
+        expr::LogicalBinaryExpr::OpType::Or,
+        make_range(proto::plan::OpType::LessThan, 300),
+        make_range(proto::plan::OpType::GreaterEqual, 4321));
+    auto plan =
+        std::make_shared<plan::FilterBitsNode>(DEFAULT_PLANNODE_ID, expr);
+
+    auto batch_size = EXEC_EVAL_EXPR_BATCH_SIZE.load();
+    auto parallelism = EXEC_FILTER_MORSEL_PARALLELISM.load();
+    auto morsel_rows = EXEC_FILTER_MORSEL_ROWS.load();
+    // odd sizes: a morsel must still start on a batch and a word boundary
+    EXEC_EVAL_EXPR_BATCH_SIZE.store(100);
+    EXEC_FILTER_MORSEL_ROWS.store(250);
+
+    EXEC_FILTER_MORSEL_PARALLELISM.store(1);
+    auto serial =
+        query::ExecuteQueryExpr(plan, segment.get(), N, MAX_TIMESTAMP);
+    EXEC_FILTER_MORSEL_PARALLELISM.store(4);
+    auto parallel =
+        query::ExecuteQueryExpr(plan, segment.get(), N, MAX_TIMESTAMP);
+
+    EXEC_EVAL_EXPR_BATCH_SIZE.store(batch_size);
+    EXEC_FILTER_MORSEL_PARALLELISM.store(parallelism);
+    EXEC_FILTER_MORSEL_ROWS.store(morsel_rows);
+
+    ASSERT_EQ(serial.size(), N);
+    ASSERT_EQ(parallel.size(), N);
+    auto values = raw_data.get_col<int64_t>(int64_fid);
+    for (int64_t i = 0; i < N; ++i) {
+        ASSERT_EQ(parallel[i], serial[i]) << "row " << i;
+        ASSERT_EQ(parallel[i], values[i] < 300 || values[i] >= 4321)
+            << "row " << i;
+    }
+}
@@ -0,0 +1,152 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "exec/PerfCounters.h"
+
+#include <atomic>
+#include <memory>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#endif
+
+#include "log/Log.h"
+
+namespace milvus {
+namespace exec {
+
+namespace {
+
+// set once a thread found perf events unavailable, the errors are the same
+// for every thread of the process
+std::atomic<bool> unavailable{false};
+
+#ifdef __linux__
+int
+OpenEvent(uint64_t config, int group_fd) {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = config;
+    attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED |
+                       PERF_FORMAT_TOTAL_TIME_RUNNING;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    // this thread on whatever cpu it runs
+    return static_cast<int>(
+        syscall(__NR_perf_event_open, &attr, 0, -1, group_fd, 0));
+}
+#endif
+
+}  // namespace
+
+PerfCounters*
+PerfCounters::ForCurrentThread() {
+    if (unavailable.load(std::memory_order_relaxed)) {
+        return nullptr;
+    }
+    thread_local std::unique_ptr<PerfCounters> counters = [] {
+        std::unique_ptr<PerfCounters> counters(new PerfCounters());
+        if (!counters->Open()) {
+            counters.reset();
+        }
+        return counters;
+    }();
+    return counters.get();
+}
+
+PerfCounters::PerfCounters() = default;
+
+PerfCounters::~PerfCounters() {
+#ifdef __linux__
+    for (auto fd : fds_) {
+        if (fd >= 0) {
+            close(fd);
+        }
+    }
+#endif
+}
+
+bool
+PerfCounters::Open() {
+#ifdef __linux__
+    constexpr uint64_t kConfigs[kEvents] = {
+        PERF_COUNT_HW_INSTRUCTIONS,
+        PERF_COUNT_HW_CPU_CYCLES,
+        PERF_COUNT_HW_CACHE_MISSES,
+        PERF_COUNT_HW_BRANCH_MISSES,
+    };
+    leader_fd_ = OpenEvent(kConfigs[kInstructions], -1);
+    if (leader_fd_ < 0) {
+        if (!unavailable.exchange(true)) {
+            LOG_INFO("hardware perf counters unavailable: {}",
+                     std::strerror(errno));
+        }
+        return false;
+    }
+    fds_[kInstructions] = leader_fd_;
+    slots_[kInstructions] = num_slots_++;
+    for (int event = kCycles; event < kEvents; event++) {
+        fds_[event] = OpenEvent(kConfigs[event], leader_fd_);
+        if (fds_[event] >= 0) {
+            slots_[event] = num_slots_++;
+        }
+    }
+    return true;
+#else
+    unavailable.store(true);
+    return false;
+#endif
+}
+
+bool
+PerfCounters::Read(PerfCounterValues* values) const {
+#ifdef __linux__
+    // nr, time enabled, time running, then the events in group order
+    uint64_t buf[3 + kEvents];
+    auto bytes = read(leader_fd_, buf, sizeof(buf));
+    if (bytes < static_cast<ssize_t>((3 + num_slots_) * sizeof(uint64_t))) {
+        return false;
+    }
+    auto enabled = buf[1];
+    auto running = buf[2];
+    auto scale = running > 0 && running < enabled
+                     ? static_cast<double>(enabled) / running
+                     : 1.0;
+    auto value = [&](Event event) -> int64_t {
+        return slots_[event] < 0
+                   ? 0
+                   : static_cast<int64_t>(buf[3 + slots_[event]] * scale);
+    };
+    values->instructions = value(kInstructions);
+    values->cycles = value(kCycles);
+    values->llc_misses = value(kLlcMisses);
+    values->branch_misses = value(kBranchMisses);
+    return true;
+#else
+    return false;
+#endif
+}
+
+}  // namespace exec
+}  // namespace milvus
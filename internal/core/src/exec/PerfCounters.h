@@ -0,0 +1,99 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <cstdint>
+
+namespace milvus {
+namespace exec {
+
+// Hardware event counts of the calling thread, user space only.
+struct PerfCounterValues {
+    int64_t instructions{0};
+    int64_t cycles{0};
+    int64_t llc_misses{0};
+    int64_t branch_misses{0};
+
+    PerfCounterValues&
+    operator+=(const PerfCounterValues& other) {
+        instructions += other.instructions;
+        cycles += other.cycles;
+        llc_misses += other.llc_misses;
+        branch_misses += other.branch_misses;
+        return *this;
+    }
+
+    PerfCounterValues
+    operator-(const PerfCounterValues& other) const {
+        return {instructions - other.instructions,
+                cycles - other.cycles,
+                llc_misses - other.llc_misses,
+                branch_misses - other.branch_misses};
+    }
+};
+
+// A perf_event group counting instructions, cycles, last level cache misses
+// and branch misses of one thread. Wall and cpu time tell how long an
+// operator ran, the counters tell whether it was compute bound (high IPC) or
+// stalled on memory (low IPC, many cache misses).
+//
+// The group of a thread is opened the first time the thread asks for it and
+// stays open until the thread exits, a read is a single read(2) of the group.
+// Events the CPU or the kernel does not offer read as 0; without
+// perf_event_open access (perf_event_paranoid, seccomp of the container,
+// non Linux builds) there are no counters at all.
+class PerfCounters {
+ public:
+    // the counters of the calling thread, nullptr when they are unavailable
+    static PerfCounters*
+    ForCurrentThread();
+
+    ~PerfCounters();
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters&
+    operator=(const PerfCounters&) = delete;
+
+    // the counts since the group was opened, scaled up when the kernel
+    // multiplexed the group with other events; false if the read failed
+    bool
+    Read(PerfCounterValues* values) const;
+
+ private:
+    enum Event {
+        kInstructions = 0,
+        kCycles,
+        kLlcMisses,
+        kBranchMisses,
+        kEvents,
+    };
+
+    PerfCounters();
+
+    bool
+    Open();
+
+    int leader_fd_{-1};
+    int fds_[kEvents]{-1, -1, -1, -1};
+    // position of every event in the group read, -1 if it failed to open
+    int slots_[kEvents]{-1, -1, -1, -1};
+    int num_slots_{0};
+};
+
+}  // namespace exec
+}  // namespace milvus
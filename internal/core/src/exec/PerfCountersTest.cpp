@@ -0,0 +1,81 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <gtest/gtest.h>
+#include <cstdint>
+
+#include "exec/PerfCounters.h"
+#include "exec/operator/OperatorStats.h"
+
+using namespace milvus;
+
+namespace {
+
+int64_t
+Spin() {
+    volatile int64_t sum = 0;
+    for (int i = 0; i < 1000000; ++i) {
+        sum += i;
+    }
+    return sum;
+}
+
+}  // namespace
+
+TEST(PerfCounters, ReadCountsCallingThread) {
+    auto* counters = exec::PerfCounters::ForCurrentThread();
+    if (counters == nullptr) {
+        GTEST_SKIP() << "perf events are not available";
+    }
+    // the group is opened once per thread
+    EXPECT_EQ(counters, exec::PerfCounters::ForCurrentThread());
+
+    exec::PerfCounterValues start;
+    ASSERT_TRUE(counters->Read(&start));
+    Spin();
+    exec::PerfCounterValues end;
+    ASSERT_TRUE(counters->Read(&end));
+
+    auto delta = end - start;
+    EXPECT_GT(delta.instructions, 0);
+    EXPECT_GE(delta.cycles, 0);
+    EXPECT_GE(delta.llc_misses, 0);
+    EXPECT_GE(delta.branch_misses, 0);
+}
+
+TEST(PerfCounters, OperatorStatsTimer) {
+    auto* counters = exec::PerfCounters::ForCurrentThread();
+    if (counters == nullptr) {
+        GTEST_SKIP() << "perf events are not available";
+    }
+    exec::OperatorStats stats;
+    {
+        exec::OperatorStatsTimer timer(&stats, nullptr, counters);
+        Spin();
+    }
+    EXPECT_GT(stats.wall_nanos, 0);
+    EXPECT_GT(stats.perf.instructions, 0);
+
+    // without counters the timer leaves perf untouched
+    exec::OperatorStats plain;
+    {
+        exec::OperatorStatsTimer timer(&plain, nullptr);
+        Spin();
+    }
+    EXPECT_EQ(plain.perf.instructions, 0);
+    EXPECT_EQ(plain.perf.cycles, 0);
+}
@@ -18,6 +18,7 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <folly/Executor.h>
@@ -30,6 +31,11 @@
 #include "common/Exception.h"
 #include "common/ArrayOffsets.h"
 #include "common/OpContext.h"
+#include "common/PinCache.h"
+#include "common/Vector.h"
+#include "exec/BitmapPool.h"
+#include "exec/MemoryTracker.h"
+#include "futures/Executor.h"
 #include "segcore/SegmentInterface.h"
 #include "segcore/Utils.h"
 
@@ -122,6 +128,11 @@ class QueryConfig : public MemConfig {
     static constexpr const char* kExprEvalBatchSize =
         "expression.eval_batch_size";
 
+    // Bytes ORDER BY and GROUP BY may hold before spilling, 0 disables it.
+    static constexpr const char* kSpillMemoryLimit = "spill.memory_limit";
+
+    static constexpr const char* kSpillDirectory = "spill.directory";
+
     explicit QueryConfig(
         const std::unordered_map<std::string, std::string>& values)
         : MemConfig(values) {
@@ -139,6 +150,18 @@ class QueryConfig : public MemConfig {
         return BaseConfig::Get<int64_t>(kExprEvalBatchSize,
                                         EXEC_EVAL_EXPR_BATCH_SIZE.load());
     }
+
+    int64_t
+    get_spill_memory_limit() const {
+        return BaseConfig::Get<int64_t>(kSpillMemoryLimit,
+                                        EXEC_SPILL_MEMORY_LIMIT.load());
+    }
+
+    std::string
+    get_spill_directory() const {
+        return BaseConfig::Get<std::string>(kSpillDirectory,
+                                            GetDefaultExecSpillDirectory());
+    }
 };
 
 class Context {
@@ -174,6 +197,23 @@ class Context {
     //std::shared_ptr<const Config> config_;
 };
 
+// Part of a global aggregation that ProjectNode answered without
+// materializing rows: a min and a max row per fully visible sealed chunk, in
+// the projected layout, standing in for the chunks' `num_rows` rows.
+struct ChunkMinMaxSummary {
+    RowVectorPtr rows{nullptr};
+    int64_t num_rows{0};
+};
+
+// The bitset the pre-filter of a search (its FilterBitsNode and MvccNode)
+// produced on a segment, shared by the searches of a hybrid search that
+// carry the same filter so that it is evaluated once.
+struct SharedPrefilter {
+    ColumnVectorPtr bits{nullptr};
+    // MvccNode found every row visible, see set_all_rows_visible
+    bool all_rows_visible{false};
+};
+
 class QueryContext : public Context {
  public:
     QueryContext(const std::string& query_id,
@@ -204,7 +244,10 @@ class QueryContext : public Context {
           query_config_(query_config),
           executor_(executor),
           consistency_level_(consistency_level),
-          plan_options_(plan_options) {
+          plan_options_(plan_options),
+          memory_tracker_(MemoryTrackerName(query_id, segment),
+                          &MemoryTracker::Process(),
+                          EXEC_QUERY_MEMORY_LIMIT.load()) {
     }
 
     folly::Executor*
@@ -307,6 +350,18 @@ class QueryContext : public Context {
         return op_context_;
     }
 
+    // pins of the op context kept until the query ends, morsel workers
+    // install it on their threads, see PinCache
+    void
+    set_pin_cache(PinCache* pin_cache) {
+        pin_cache_ = pin_cache;
+    }
+
+    PinCache*
+    get_pin_cache() {
+        return pin_cache_;
+    }
+
     int32_t
     get_consistency_level() {
         return consistency_level_;
@@ -317,6 +372,25 @@ class QueryContext : public Context {
         return plan_options_;
     }
 
+    bool
+    explain_analyze() const {
+        return plan_options_.explain_analyze;
+    }
+
+    // appends the tree of one executed task, a query may run several
+    void
+    add_explain_analyze_result(const std::string& result) {
+        if (!explain_analyze_result_.empty()) {
+            explain_analyze_result_ += '\n';
+        }
+        explain_analyze_result_ += result;
+    }
+
+    const std::string&
+    get_explain_analyze_result() const {
+        return explain_analyze_result_;
+    }
+
     void
     set_struct_name(const std::string& field_name) {
         struct_name_ = field_name;
@@ -388,6 +462,43 @@ class QueryContext : public Context {
         return all_rows_visible_;
     }
 
+    // Set when the pre-filter of the search was evaluated beforehand, the
+    // pipeline then starts from it instead of running the pre-filter nodes
+    void
+    set_shared_prefilter(std::shared_ptr<const SharedPrefilter> prefilter) {
+        shared_prefilter_ = std::move(prefilter);
+    }
+
+    const std::shared_ptr<const SharedPrefilter>&
+    get_shared_prefilter() const {
+        return shared_prefilter_;
+    }
+
+    // The executor operators spread the work of this query over, the search
+    // executor of its collection, see Collection::set_search_pool
+    void
+    set_search_executor(folly::CPUThreadPoolExecutor* executor) {
+        search_executor_ = executor;
+    }
+
+    folly::CPUThreadPoolExecutor*
+    get_search_executor() const {
+        return search_executor_ != nullptr ? search_executor_
+                                           : futures::getSearchCPUExecutor();
+    }
+
+    // Set by ProjectNode when it pushed min/max down to chunk metrics,
+    // taken by the AggregationNode it feeds.
+    void
+    set_chunk_min_max_summary(ChunkMinMaxSummary summary) {
+        chunk_min_max_summary_ = std::move(summary);
+    }
+
+    ChunkMinMaxSummary
+    take_chunk_min_max_summary() {
+        return std::exchange(chunk_min_max_summary_, ChunkMinMaxSummary{});
+    }
+
     void
     set_enable_expr_cache(bool enable) {
         enable_expr_cache_ = enable;
@@ -408,7 +519,30 @@ class QueryContext : public Context {
         return enable_sub_expr_cache_write_;
     }
 
+    // batch bitmaps of the expressions recycled until the query ends
+    BitmapPool*
+    get_bitmap_pool() {
+        return &bitmap_pool_;
+    }
+
+    // bytes held by the operators of the query
+    MemoryTracker*
+    get_memory_tracker() {
+        return &memory_tracker_;
+    }
+
  private:
+    static std::string
+    MemoryTrackerName(
+        const std::string& query_id,
+        const milvus::segcore::SegmentInternalInterface* segment) {
+        if (segment == nullptr) {
+            return "query " + query_id;
+        }
+        return "query " + query_id + " on segment " +
+               std::to_string(segment->get_segment_id());
+    }
+
     folly::Executor* executor_;
     //folly::Executor::KeepAlive<> executor_keepalive_;
     std::unordered_map<std::string, std::shared_ptr<Config>> connector_configs_;
@@ -435,10 +569,12 @@ class QueryContext : public Context {
 
     // used for save op context
     milvus::OpContext* op_context_{nullptr};
+    PinCache* pin_cache_{nullptr};
 
     int32_t consistency_level_ = 0;
 
     query::PlanOptions plan_options_;
+    std::string explain_analyze_result_;
 
     std::string struct_name_;
     std::shared_ptr<const IArrayOffsets> array_offsets_{nullptr};
@@ -452,6 +588,12 @@ class QueryContext : public Context {
     // MVCC fast path: set true when sealed + no-filter + no-delete + no-TTL
     bool all_rows_visible_{false};
 
+    ChunkMinMaxSummary chunk_min_max_summary_;
+
+    std::shared_ptr<const SharedPrefilter> shared_prefilter_{nullptr};
+    // nullptr for the global search executor
+    folly::CPUThreadPoolExecutor* search_executor_{nullptr};
+
     // Expression filter cache for two-stage search
     bool enable_expr_cache_ = false;
     // Allow sub-expression results (for example TextMatch/PhraseMatch) to be
@@ -459,6 +601,9 @@ class QueryContext : public Context {
     // avoid duplicating the cached full-filter bitmap with cached child
     // bitmaps in the same request path.
     bool enable_sub_expr_cache_write_ = true;
+
+    BitmapPool bitmap_pool_;
+    MemoryTracker memory_tracker_;
 };
 
 // Represent the state of one thread of query execution.
@@ -27,8 +27,13 @@ namespace exec {
 
 SortBuffer::SortBuffer(const std::vector<DataType>& column_types,
                        const std::vector<SortKeyInfo>& sort_keys,
-                       int64_t limit)
-    : column_types_(column_types), sort_keys_(sort_keys), limit_(limit) {
+                       int64_t limit,
+                       const SpillConfig& spill_config)
+    : column_types_(column_types),
+      sort_keys_(sort_keys),
+      limit_(limit),
+      top_n_(limit > 0 && limit <= kMaxTopNLimit),
+      spill_config_(spill_config) {
     AssertInfo(!sort_keys_.empty(),
                "SortBuffer requires at least one sort key");
     AssertInfo(!column_types_.empty(),
@@ -47,6 +52,12 @@ SortBuffer::SortBuffer(const std::vector<DataType>& column_types,
     // Create RowContainer with no accumulators (pure data storage)
     std::vector<Accumulator> empty_accumulators;
     data_ = std::make_unique<RowContainer>(column_types_, empty_accumulators);
+
+    if (spill_config_.enabled() && !RowContainer::canSpill(column_types_)) {
+        LOG_WARN("SortBuffer: column types cannot be spilled, sorting in "
+                 "memory only");
+        spill_config_.memory_limit = 0;
+    }
 }
 
 void
@@ -58,6 +69,12 @@ SortBuffer::AddRow(const std::vector<ColumnVectorPtr>& columns,
                column_types_.size(),
                columns.size());
 
+    if (top_n_) {
+        AddTopNRow(columns, row_index);
+        num_input_rows_++;
+        return;
+    }
+
     // Allocate a new row in RowContainer
     char* row = data_->newRow();
 
@@ -67,6 +84,7 @@ SortBuffer::AddRow(const std::vector<ColumnVectorPtr>& columns,
     }
 
     num_input_rows_++;
+    MaybeSpill();
 }
 
 void
@@ -82,6 +100,14 @@ SortBuffer::AddRows(const std::vector<ColumnVectorPtr>& columns,
         return;
     }
 
+    if (top_n_) {
+        for (vector_size_t i = 0; i < num_rows; ++i) {
+            AddTopNRow(columns, i);
+        }
+        num_input_rows_ += num_rows;
+        return;
+    }
+
     // Phase 1: Batch-allocate all rows upfront
     std::vector<char*> new_rows(num_rows);
     for (vector_size_t i = 0; i < num_rows; ++i) {
@@ -98,6 +124,178 @@ SortBuffer::AddRows(const std::vector<ColumnVectorPtr>& columns,
     }
 
     num_input_rows_ += num_rows;
+    MaybeSpill();
+}
+
+void
+SortBuffer::AddTopNRow(const std::vector<ColumnVectorPtr>& columns,
+                       vector_size_t row_index) {
+    auto less = [this](const char* lhs, const char* rhs) {
+        return TopNLess(lhs, rhs);
+    };
+    if (static_cast<int64_t>(top_n_rows_.size()) < limit_) {
+        char* row = data_->newRow();
+        for (size_t col = 0; col < columns.size(); ++col) {
+            data_->store(
+                columns[col], row_index, row, static_cast<int32_t>(col));
+        }
+        top_n_rows_.push_back(row);
+        std::push_heap(top_n_rows_.begin(), top_n_rows_.end(), less);
+        return;
+    }
+
+    // Most rows of a large input lose to the Nth row on the first key, skip
+    // them before paying for the store
+    if (LosesOnFirstKey(columns, row_index, top_n_rows_.front())) {
+        return;
+    }
+    if (top_n_candidate_ == nullptr) {
+        top_n_candidate_ = data_->newRow();
+    } else {
+        data_->resetRow(top_n_candidate_);
+    }
+    for (size_t col = 0; col < columns.size(); ++col) {
+        data_->store(columns[col],
+                     row_index,
+                     top_n_candidate_,
+                     static_cast<int32_t>(col));
+    }
+    // ties keep the row already kept
+    if (Compare(top_n_candidate_, top_n_rows_.front()) < 0) {
+        std::pop_heap(top_n_rows_.begin(), top_n_rows_.end(), less);
+        std::swap(top_n_rows_.back(), top_n_candidate_);
+        std::push_heap(top_n_rows_.begin(), top_n_rows_.end(), less);
+    }
+}
+
+bool
+SortBuffer::LosesOnFirstKey(const std::vector<ColumnVectorPtr>& columns,
+                            vector_size_t row_index,
+                            const char* row) const {
+    const auto& sort_key = sort_keys_.front();
+    const auto& column = columns[sort_key.column_index];
+    const auto& row_column = data_->columnAt(sort_key.column_index);
+    bool input_null = !column->ValidAt(row_index);
+    bool row_null = RowContainer::isNullAt(
+        row, row_column.nullByte(), row_column.nullMask());
+    if (input_null || row_null) {
+        return CompareNulls(input_null, row_null, sort_key.nulls_first) > 0;
+    }
+
+    const auto offset = row_column.offset();
+    const bool asc = sort_key.ascending;
+    int result = 0;
+    switch (column_types_[sort_key.column_index]) {
+        case DataType::BOOL:
+            result =
+                CompareInputValue<bool>(column, row_index, row, offset, asc);
+            break;
+        case DataType::INT8:
+            result =
+                CompareInputValue<int8_t>(column, row_index, row, offset, asc);
+            break;
+        case DataType::INT16:
+            result =
+                CompareInputValue<int16_t>(column, row_index, row, offset, asc);
+            break;
+        case DataType::INT32:
+            result =
+                CompareInputValue<int32_t>(column, row_index, row, offset, asc);
+            break;
+        case DataType::INT64:
+        case DataType::TIMESTAMPTZ:
+            result =
+                CompareInputValue<int64_t>(column, row_index, row, offset, asc);
+            break;
+        case DataType::FLOAT:
+            result =
+                CompareInputValue<float>(column, row_index, row, offset, asc);
+            break;
+        case DataType::DOUBLE:
+            result =
+                CompareInputValue<double>(column, row_index, row, offset, asc);
+            break;
+        case DataType::VARCHAR:
+        case DataType::STRING: {
+            const auto* input_str = static_cast<const std::string*>(
+                column->RawValueAt(row_index, sizeof(std::string)));
+            const std::string* row_str = RowContainer::strAt(row, offset);
+            result = CompareNonNullValues<std::string_view>(
+                *input_str,
+                row_str ? std::string_view(*row_str) : std::string_view(),
+                asc);
+            break;
+        }
+        default:
+            // Compare() reports the unsupported type once the row is stored
+            return false;
+    }
+    return result > 0;
+}
+
+void
+SortBuffer::MaybeSpill() {
+    if (spill_config_.enabled() &&
+        data_->estimatedBytes() >= spill_config_.memory_limit) {
+        SpillRun();
+    }
+}
+
+void
+SortBuffer::SpillRun() {
+    const auto& all_rows = data_->allRows();
+    sorted_rows_.assign(all_rows.begin(), all_rows.end());
+    Sort();
+    // rows of a run past the limit can never be output
+    if (limit_ > 0 && static_cast<int64_t>(sorted_rows_.size()) > limit_) {
+        sorted_rows_.resize(limit_);
+    }
+
+    auto run = std::make_unique<SpillFile>(spill_config_.directory, "sort");
+    for (const char* row : sorted_rows_) {
+        run->append(*data_, row);
+    }
+    run->finishWrite();
+    num_spilled_runs_++;
+    num_spilled_rows_ += run->numRows();
+    LOG_DEBUG("SortBuffer: spilled run of {} rows, {} bytes to {}",
+              run->numRows(),
+              run->numBytes(),
+              run->path());
+    spilled_runs_.push_back(std::move(run));
+
+    sorted_rows_.clear();
+    data_->clear();
+}
+
+void
+SortBuffer::StartMerge() {
+    if (!sorted_rows_.empty()) {
+        MergeSource source;
+        source.block = std::move(sorted_rows_);
+        merge_sources_.push_back(std::move(source));
+    }
+    sorted_rows_.clear();
+    for (auto& run : spilled_runs_) {
+        MergeSource source;
+        source.file = std::move(run);
+        source.rows = std::make_unique<RowContainer>(
+            column_types_, std::vector<Accumulator>{});
+        if (source.file->readBlock(*source.rows, source.block)) {
+            merge_sources_.push_back(std::move(source));
+        }
+    }
+    spilled_runs_.clear();
+
+    for (size_t i = 0; i < merge_sources_.size(); ++i) {
+        merge_heap_.push_back(i);
+    }
+    std::make_heap(merge_heap_.begin(),
+                   merge_heap_.end(),
+                   [this](size_t lhs, size_t rhs) {
+                       return MergeGreater(lhs, rhs);
+                   });
+    merging_ = true;
 }
 
 void
@@ -111,7 +309,22 @@ SortBuffer::NoMoreInput() {
         return;
     }
 
-    // Collect all row pointers from RowContainer
+    if (top_n_) {
+        sorted_rows_ = std::move(top_n_rows_);
+        std::sort(sorted_rows_.begin(),
+                  sorted_rows_.end(),
+                  [this](const char* lhs, const char* rhs) {
+                      return Compare(lhs, rhs) < 0;
+                  });
+        sorted_ = true;
+        LOG_DEBUG("SortBuffer: kept top {} of {} rows",
+                  sorted_rows_.size(),
+                  num_input_rows_);
+        return;
+    }
+
+    // Collect all row pointers from RowContainer. Once runs were spilled
+    // these are the rows since the last run, the last run of the merge.
     const auto& all_rows = data_->allRows();
     sorted_rows_.reserve(all_rows.size());
     for (char* row : all_rows) {
@@ -133,6 +346,13 @@ SortBuffer::NoMoreInput() {
     LOG_DEBUG("SortBuffer: sorted {} rows, keeping {} after limit",
               num_input_rows_,
               sorted_rows_.size());
+
+    if (num_spilled_runs_ > 0) {
+        StartMerge();
+        LOG_DEBUG("SortBuffer: merging {} spilled runs of {} rows",
+                  num_spilled_runs_,
+                  num_spilled_rows_);
+    }
 }
 
 void
@@ -301,6 +521,10 @@ SortBuffer::HasOutput() const {
     if (!sorted_) {
         return false;
     }
+    if (merging_) {
+        return !merge_heap_.empty() &&
+               (limit_ <= 0 || num_output_rows_ < limit_);
+    }
     if (sorted_rows_.empty()) {
         return false;
     }
@@ -312,6 +536,10 @@ std::vector<VectorPtr>
 SortBuffer::GetOutput(int64_t max_rows) {
     AssertInfo(sorted_, "Must call NoMoreInput() before GetOutput()");
 
+    if (merging_) {
+        return GetMergedOutput(max_rows);
+    }
+
     if (sorted_rows_.empty()) {
         return {};
     }
@@ -337,7 +565,8 @@ SortBuffer::GetOutput(int64_t max_rows) {
     }
 
     // Extract output
-    auto output = ExtractOutput(batch_size);
+    auto output =
+        ExtractOutput(sorted_rows_.data() + output_cursor_, batch_size);
 
     output_cursor_ += batch_size;
     num_output_rows_ += batch_size;
@@ -346,17 +575,60 @@ SortBuffer::GetOutput(int64_t max_rows) {
 }
 
 std::vector<VectorPtr>
-SortBuffer::ExtractOutput(int64_t num_rows) {
+SortBuffer::GetMergedOutput(int64_t max_rows) {
+    int64_t batch_size = max_rows;
+    if (limit_ > 0) {
+        batch_size = std::min(batch_size, limit_ - num_output_rows_);
+    }
+    if (batch_size <= 0 || merge_heap_.empty()) {
+        return {};
+    }
+
+    auto greater = [this](size_t lhs, size_t rhs) {
+        return MergeGreater(lhs, rhs);
+    };
+    std::vector<char*> output;
+    output.reserve(batch_size);
+    // Blocks read past in this batch, freed once the output is extracted
+    std::vector<std::unique_ptr<RowContainer>> consumed;
+    while (static_cast<int64_t>(output.size()) < batch_size &&
+           !merge_heap_.empty()) {
+        std::pop_heap(merge_heap_.begin(), merge_heap_.end(), greater);
+        auto& source = merge_sources_[merge_heap_.back()];
+        output.push_back(source.block[source.pos++]);
+        if (source.pos == source.block.size()) {
+            if (source.file == nullptr) {
+                merge_heap_.pop_back();
+                continue;
+            }
+            consumed.push_back(std::move(source.rows));
+            source.rows = std::make_unique<RowContainer>(
+                column_types_, std::vector<Accumulator>{});
+            source.block.clear();
+            source.pos = 0;
+            if (!source.file->readBlock(*source.rows, source.block)) {
+                source.file.reset();
+                merge_heap_.pop_back();
+                continue;
+            }
+        }
+        std::push_heap(merge_heap_.begin(), merge_heap_.end(), greater);
+    }
+
+    auto result = ExtractOutput(output.data(), output.size());
+    num_output_rows_ += output.size();
+    return result;
+}
+
+std::vector<VectorPtr>
+SortBuffer::ExtractOutput(const char* const* rows, int64_t num_rows) {
     std::vector<VectorPtr> result;
     result.reserve(column_types_.size());
 
-    // Get row pointers for this batch
-    const char* const* rows_ptr = sorted_rows_.data() + output_cursor_;
-
     // Extract each column
     for (size_t col = 0; col < column_types_.size(); ++col) {
         auto output_vec =
-            data_->extractColumnVector(rows_ptr,
+            data_->extractColumnVector(rows,
                                        static_cast<int32_t>(num_rows),
                                        static_cast<int32_t>(col));
         result.push_back(std::move(output_vec));
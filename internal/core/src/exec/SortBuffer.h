@@ -25,6 +25,7 @@
 #include "common/EasyAssert.h"
 #include "common/Types.h"
 #include "common/Vector.h"
+#include "exec/Spill.h"
 #include "exec/operator/query-agg/RowContainer.h"
 
 namespace milvus {
@@ -52,7 +53,10 @@ struct SortKeyInfo {
  * - Pointer-based sorting: Only sorts pointers (8 bytes each), not row data
  * - Multi-field sorting: Supports compound ORDER BY (field1 ASC, field2 DESC)
  * - NULL handling: Configurable NULLS FIRST/LAST per sort key
- * - TopK optimization: Uses partial_sort when limit is small relative to input
+ * - Top-N: with a limit of at most kMaxTopNLimit rows only the best N rows
+ *   are kept, in a bounded heap, and rows that lose to the current Nth row on
+ *   the first sort key are rejected before they are stored
+ * - TopK optimization: Uses partial_sort for larger limits
  * - Batched output: Returns results in configurable batch sizes
  *
  * Usage pattern:
@@ -62,14 +66,21 @@ struct SortKeyInfo {
  *   4. Call GetOutput() repeatedly until HasOutput() returns false
  *
  * Memory model:
- *   - Current implementation is memory-only (no disk spilling)
  *   - Memory usage: O(rows * row_size) for data + O(rows * 8) for pointers
+ *   - With spilling enabled, once the rows exceed the spill memory limit they
+ *     are sorted and written to local disk as a run. NoMoreInput() then
+ *     k-way merges the runs and the rows left in memory, reading every run
+ *     back one block at a time.
  *
  * @note This class is NOT thread-safe. External synchronization is required
  *       if used from multiple threads.
  */
 class SortBuffer {
  public:
+    /// Largest limit kept in the top-N heap. Larger limits accumulate all
+    /// rows and sort them (or spill) like an unlimited sort.
+    static constexpr int64_t kMaxTopNLimit = 64 * 1024;
+
     /**
      * @brief Construct a SortBuffer for ORDER BY operations
      *
@@ -78,6 +89,8 @@ class SortBuffer {
      *                  direction, nulls handling). Only these columns are used
      *                  for sorting; other columns are just stored and returned.
      * @param limit Maximum rows to output (-1 for unlimited)
+     * @param spill_config When and where to spill sorted runs, disabled by
+     *                     default
      *
      * @note Offset is NOT supported at segment level. In distributed queries,
      *       offset must be applied at the proxy reduce level after k-way merge.
@@ -85,7 +98,8 @@ class SortBuffer {
      */
     SortBuffer(const std::vector<DataType>& column_types,
                const std::vector<SortKeyInfo>& sort_keys,
-               int64_t limit = -1);
+               int64_t limit = -1,
+               const SpillConfig& spill_config = SpillConfig());
 
     ~SortBuffer() = default;
 
@@ -191,6 +205,30 @@ class SortBuffer {
         return column_types_.size();
     }
 
+    /// Whether only the best `limit` rows are kept while adding input
+    bool
+    IsTopN() const {
+        return top_n_;
+    }
+
+    /// Number of sorted runs spilled to disk
+    int64_t
+    NumSpilledRuns() const {
+        return num_spilled_runs_;
+    }
+
+    /// Number of rows written to spilled runs
+    int64_t
+    NumSpilledRows() const {
+        return num_spilled_rows_;
+    }
+
+    /// Bytes of the rows held in memory
+    int64_t
+    EstimatedBytes() const {
+        return data_->estimatedBytes();
+    }
+
  private:
     //=========================================================================
     // Internal Methods
@@ -241,11 +279,76 @@ class SortBuffer {
     /**
      * @brief Extract output columns from sorted row pointers
      *
+     * @param rows Row pointers in output order
      * @param num_rows Number of rows to extract
      * @return Vector of column vectors
      */
     std::vector<VectorPtr>
-    ExtractOutput(int64_t num_rows);
+    ExtractOutput(const char* const* rows, int64_t num_rows);
+
+    /// Heap order of the top-N rows: the worst kept row on top
+    bool
+    TopNLess(const char* lhs, const char* rhs) const {
+        return Compare(lhs, rhs) < 0;
+    }
+
+    /// Keeps input row `row_index` if it beats the worst of the top-N rows
+    void
+    AddTopNRow(const std::vector<ColumnVectorPtr>& columns,
+               vector_size_t row_index);
+
+    /// Whether input row `row_index` sorts after `row` on the first sort key
+    /// alone, so it cannot enter the top N
+    bool
+    LosesOnFirstKey(const std::vector<ColumnVectorPtr>& columns,
+                    vector_size_t row_index,
+                    const char* row) const;
+
+    template <typename T>
+    static int
+    CompareInputValue(const ColumnVectorPtr& column,
+                      vector_size_t row_index,
+                      const char* row,
+                      int32_t offset,
+                      bool ascending) {
+        return CompareNonNullValues<T>(column->ValueAt<T>(row_index),
+                                       RowContainer::valueAt<T>(row, offset),
+                                       ascending);
+    }
+
+    /// Spills the rows once they exceed the spill memory limit
+    void
+    MaybeSpill();
+
+    /// Sorts the rows in memory, writes them as a run and clears them
+    void
+    SpillRun();
+
+    /// Sets up the merge of the spilled runs and the sorted rows in memory
+    void
+    StartMerge();
+
+    /// GetOutput() of a merge: takes the smallest current row of the runs
+    /// until the batch is full
+    std::vector<VectorPtr>
+    GetMergedOutput(int64_t max_rows);
+
+    /// Heap order of the merge: the source with the smallest row on top
+    bool
+    MergeGreater(size_t lhs, size_t rhs) const {
+        const auto& l = merge_sources_[lhs];
+        const auto& r = merge_sources_[rhs];
+        return Compare(l.block[l.pos], r.block[r.pos]) > 0;
+    }
+
+    // One sorted run of a merge: the sorted rows in data_, or a spilled
+    // run read back one block at a time into its own RowContainer
+    struct MergeSource {
+        std::unique_ptr<SpillFile> file;
+        std::unique_ptr<RowContainer> rows;
+        std::vector<char*> block;
+        size_t pos = 0;
+    };
 
     //=========================================================================
     // Data Members
@@ -268,6 +371,24 @@ class SortBuffer {
     int64_t num_input_rows_ = 0;
     int64_t num_output_rows_ = 0;
     int64_t output_cursor_ = 0;  // Current position in sorted_rows_
+
+    // Top-N: max-heap by Compare of the kept rows, and the row the next
+    // candidate is stored into, swapped with the heap top when it wins
+    bool top_n_ = false;
+    std::vector<char*> top_n_rows_;
+    char* top_n_candidate_ = nullptr;
+
+    // Spilling
+    SpillConfig spill_config_;
+    std::vector<std::unique_ptr<SpillFile>> spilled_runs_;
+    int64_t num_spilled_runs_ = 0;
+    int64_t num_spilled_rows_ = 0;
+
+    // Merging, only when runs were spilled. merge_heap_ holds the indexes of
+    // the sources with rows left.
+    bool merging_ = false;
+    std::vector<MergeSource> merge_sources_;
+    std::vector<size_t> merge_heap_;
 };
 
 //=============================================================================
@@ -0,0 +1,148 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/Spill.h"
+
+#include <unistd.h>
+
+#include <atomic>
+#include <cstring>
+#include <filesystem>
+#include <system_error>
+
+#include "common/EasyAssert.h"
+#include "exec/QueryContext.h"
+#include "fmt/format.h"
+#include "log/Log.h"
+
+namespace milvus {
+namespace exec {
+
+namespace {
+std::atomic<uint64_t> spill_file_sequence{0};
+}  // namespace
+
+SpillConfig
+SpillConfig::FromQueryConfig(const QueryConfig& config) {
+    SpillConfig spill_config;
+    spill_config.memory_limit = config.get_spill_memory_limit();
+    spill_config.directory = config.get_spill_directory();
+    return spill_config;
+}
+
+SpillFile::SpillFile(const std::string& directory, const std::string& prefix) {
+    std::error_code ec;
+    std::filesystem::create_directories(directory, ec);
+    if (ec) {
+        ThrowInfo(FileCreateFailed,
+                  "failed to create spill directory {}: {}",
+                  directory,
+                  ec.message());
+    }
+    path_ = fmt::format("{}/{}-{}-{}.spill",
+                        directory,
+                        prefix,
+                        getpid(),
+                        spill_file_sequence.fetch_add(1));
+    file_.open(path_,
+               std::ios::in | std::ios::out | std::ios::binary |
+                   std::ios::trunc);
+    if (!file_.is_open()) {
+        ThrowInfo(FileCreateFailed, "failed to create spill file {}", path_);
+    }
+}
+
+SpillFile::~SpillFile() {
+    file_.close();
+    std::error_code ec;
+    std::filesystem::remove(path_, ec);
+    if (ec) {
+        LOG_WARN("failed to remove spill file {}: {}", path_, ec.message());
+    }
+}
+
+void
+SpillFile::append(const RowContainer& rows, const char* row) {
+    AssertInfo(
+        writing_, "cannot append to spill file {} after finishWrite", path_);
+    rows.serializeRow(row, block_);
+    ++block_rows_;
+    ++num_rows_;
+    if (block_.size() >= kBlockBytes) {
+        flushBlock();
+    }
+}
+
+void
+SpillFile::flushBlock() {
+    if (block_rows_ == 0) {
+        return;
+    }
+    uint32_t header[2] = {block_rows_, static_cast<uint32_t>(block_.size())};
+    file_.write(reinterpret_cast<const char*>(header), sizeof(header));
+    file_.write(block_.data(), block_.size());
+    if (!file_) {
+        ThrowInfo(FileWriteFailed, "failed to write spill file {}", path_);
+    }
+    num_bytes_ += sizeof(header) + block_.size();
+    block_.clear();
+    block_rows_ = 0;
+}
+
+void
+SpillFile::finishWrite() {
+    if (!writing_) {
+        return;
+    }
+    flushBlock();
+    std::string().swap(block_);
+    file_.flush();
+    file_.seekg(0);
+    if (!file_) {
+        ThrowInfo(FileWriteFailed, "failed to flush spill file {}", path_);
+    }
+    writing_ = false;
+}
+
+bool
+SpillFile::readBlock(RowContainer& rows, std::vector<char*>& out) {
+    AssertInfo(!writing_, "must call finishWrite before reading {}", path_);
+    uint32_t header[2];
+    file_.read(reinterpret_cast<char*>(header), sizeof(header));
+    if (file_.gcount() == 0 && file_.eof()) {
+        return false;
+    }
+    if (file_.gcount() != sizeof(header)) {
+        ThrowInfo(FileReadFailed, "truncated block header in {}", path_);
+    }
+    block_.resize(header[1]);
+    file_.read(block_.data(), header[1]);
+    if (file_.gcount() != header[1]) {
+        ThrowInfo(FileReadFailed, "truncated block in {}", path_);
+    }
+    const char* in = block_.data();
+    out.reserve(out.size() + header[0]);
+    for (uint32_t i = 0; i < header[0]; ++i) {
+        out.push_back(rows.deserializeRow(in));
+    }
+    AssertInfo(in == block_.data() + block_.size(),
+               "corrupted block in spill file {}",
+               path_);
+    return true;
+}
+
+}  // namespace exec
+}  // namespace milvus
@@ -0,0 +1,114 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "exec/operator/query-agg/RowContainer.h"
+
+namespace milvus {
+namespace exec {
+
+class QueryConfig;
+
+// When and where an operator spills. Spilling is off unless both a memory
+// limit and a directory are set.
+struct SpillConfig {
+    // Bytes of rows an operator may hold before it spills, 0 disables it.
+    int64_t memory_limit{0};
+    // Local directory the spill files are created in.
+    std::string directory;
+
+    bool
+    enabled() const {
+        return memory_limit > 0 && !directory.empty();
+    }
+
+    static SpillConfig
+    FromQueryConfig(const QueryConfig& config);
+};
+
+// A temporary local file of RowContainer rows, written once and then read
+// back once from the start. Rows are serialized with
+// RowContainer::serializeRow() into blocks of about kBlockBytes:
+//
+//   [uint32_t num_rows][uint32_t num_bytes][num_bytes of rows]
+//
+// so reading only ever holds one block. The file is removed when the
+// SpillFile is destroyed.
+class SpillFile {
+ public:
+    static constexpr size_t kBlockBytes = 1 << 20;
+
+    // Creates `directory` if needed and a new file in it named after
+    // `prefix`, unique within the process.
+    SpillFile(const std::string& directory, const std::string& prefix);
+
+    ~SpillFile();
+
+    SpillFile(const SpillFile&) = delete;
+    SpillFile&
+    operator=(const SpillFile&) = delete;
+
+    // Appends the key columns of `row`, a row of `rows`.
+    void
+    append(const RowContainer& rows, const char* row);
+
+    // Flushes the pending block and rewinds the file for reading. No
+    // append() is allowed after it.
+    void
+    finishWrite();
+
+    // Reads the next block into new rows of `rows`, whose layout must match
+    // the container the rows were appended from, and appends them to
+    // `out`. Returns false once the file is exhausted.
+    bool
+    readBlock(RowContainer& rows, std::vector<char*>& out);
+
+    int64_t
+    numRows() const {
+        return num_rows_;
+    }
+
+    int64_t
+    numBytes() const {
+        return num_bytes_;
+    }
+
+    const std::string&
+    path() const {
+        return path_;
+    }
+
+ private:
+    void
+    flushBlock();
+
+    std::string path_;
+    std::fstream file_;
+    std::string block_;
+    uint32_t block_rows_{0};
+    int64_t num_rows_{0};
+    int64_t num_bytes_{0};
+    bool writing_{true};
+};
+
+}  // namespace exec
+}  // namespace milvus
@@ -30,6 +30,7 @@
 #include "common/protobuf_utils.h"
 #include "exec/Driver.h"
 #include "exec/QueryContext.h"
+#include "exec/operator/OperatorStats.h"
 #include "plan/PlanNode.h"
 
 namespace milvus {
@@ -179,6 +180,27 @@ class Task : public std::enable_shared_from_this<Task> {
         Terminate(TaskState::kCanceled);
     }
 
+    // Called by every driver on close when the plan asked for EXPLAIN
+    // ANALYZE, before the driver is removed from the task.
+    void
+    AddOperatorStats(std::vector<OperatorStats> stats) {
+        std::lock_guard<std::mutex> l(mutex_);
+        for (auto& s : stats) {
+            operator_stats_.push_back(std::move(s));
+        }
+    }
+
+    std::vector<OperatorStats>
+    operator_stats() const {
+        std::lock_guard<std::mutex> l(mutex_);
+        return operator_stats_;
+    }
+
+    std::string
+    ExplainAnalyze() const {
+        return FormatExplainAnalyze(operator_stats());
+    }
+
  private:
     std::string uuid_;
 
@@ -211,6 +233,8 @@ class Task : public std::enable_shared_from_this<Task> {
     uint32_t num_ungrouped_drivers_{0};
 
     uint32_t num_finished_drivers_{0};
+
+    std::vector<OperatorStats> operator_stats_;
 };
 
 }  // namespace exec
@@ -68,6 +68,25 @@ class VectorHasher {
         }
     }
 
+    // Bits a value ID of `type` takes in a normalized key, which packs the
+    // value IDs of several keys into 64 bits. ID 0 stands for null. 0 when
+    // the values of `type` have too many IDs to be packed.
+    static int32_t
+    normalizedKeyBits(DataType type) {
+        switch (type) {
+            case DataType::BOOL:
+                return 2;
+            case DataType::INT8:
+                return 9;
+            case DataType::INT16:
+                return 17;
+            case DataType::INT32:
+                return 33;
+            default:
+                return 0;
+        }
+    }
+
     template <DataType type>
     void
     hashValues(const ColumnVectorPtr& column_data, bool mix, uint64_t* result);
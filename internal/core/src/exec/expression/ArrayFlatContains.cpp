@@ -0,0 +1,98 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/expression/ArrayFlatContains.h"
+
+namespace milvus {
+namespace exec {
+
+namespace {
+
+// the elements matched by one simdFilterChunk call, a multiple of 8 so the
+// bitmap of every call starts at a byte
+constexpr int64_t kFlatFilterBatch = 1 << 16;
+
+}  // namespace
+
+void
+ArrayFlatContains::Eval(const ArrayView* arrays,
+                        int size,
+                        TargetBitmapView res) const {
+    std::visit(
+        [&](const auto& vals) {
+            if (!vals.empty()) {
+                EvalOf(arrays, size, vals, res);
+            }
+        },
+        vals_);
+}
+
+template <typename E>
+void
+ArrayFlatContains::EvalOf(const ArrayView* arrays,
+                          int size,
+                          const std::vector<E>& vals,
+                          TargetBitmapView res) {
+    std::vector<uint8_t> element_bits;
+    int begin = 0;
+    while (begin < size) {
+        // the arrays from `begin` whose elements follow each other
+        auto run = reinterpret_cast<const E*>(arrays[begin].data());
+        int64_t num_elements = arrays[begin].length();
+        int end = begin + 1;
+        while (end < size &&
+               reinterpret_cast<const E*>(arrays[end].data()) ==
+                   run + num_elements) {
+            num_elements += arrays[end].length();
+            ++end;
+        }
+
+        if (end - begin == 1) {
+            if (std::any_of(run, run + num_elements, [&](E element) {
+                    return std::binary_search(
+                        vals.begin(), vals.end(), element);
+                })) {
+                res.set(begin);
+            }
+            begin = end;
+            continue;
+        }
+
+        // whole words, the bitset reads the bits a word at a time
+        element_bits.assign((num_elements + 63) / 64 * 8, 0);
+        for (int64_t pos = 0; pos < num_elements; pos += kFlatFilterBatch) {
+            auto batch = std::min(kFlatFilterBatch, num_elements - pos);
+            simdFilterChunk<E>(run + pos,
+                               static_cast<int>(batch),
+                               element_bits.data() + pos / 8,
+                               vals.data(),
+                               static_cast<int>(vals.size()));
+        }
+        TargetBitmapView matched(element_bits.data(), num_elements);
+        int64_t offset = 0;
+        for (int i = begin; i < end; ++i) {
+            auto length = arrays[i].length();
+            if (length > 0 && matched.view(offset, length).any()) {
+                res.set(i);
+            }
+            offset += length;
+        }
+        begin = end;
+    }
+}
+
+}  // namespace exec
+}  // namespace milvus
@@ -0,0 +1,128 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+#include "common/Array.h"
+#include "common/Types.h"
+#include "exec/expression/SimdFilter.h"
+
+namespace milvus {
+namespace exec {
+
+// array_contains and array_contains_any over numeric arrays, evaluated over
+// the elements of the arrays as one flat buffer. The arrays of a sealed
+// ArrayChunk lie back to back, their elements are matched by
+// simdFilterChunk at once and the element bits are then reduced per array
+// by its range of the buffer; the arrays apart, as in a growing segment, are
+// matched one by one.
+//
+// The values are kept in the type the elements are stored as, the narrow
+// integers as int32; a value no element can equal is dropped, so the result
+// is the one of comparing the elements widened to the values.
+class ArrayFlatContains {
+ public:
+    // nullptr for the element types not stored as fixed width numbers
+    template <typename V>
+    static std::shared_ptr<const ArrayFlatContains>
+    Make(DataType element_type, const std::vector<V>& vals) {
+        switch (element_type) {
+            case DataType::INT8:
+            case DataType::INT16:
+            case DataType::INT32:
+                return MakeOf<int32_t>(element_type, vals);
+            case DataType::INT64:
+                return MakeOf<int64_t>(element_type, vals);
+            case DataType::FLOAT:
+                return MakeOf<float>(element_type, vals);
+            case DataType::DOUBLE:
+                return MakeOf<double>(element_type, vals);
+            default:
+                return nullptr;
+        }
+    }
+
+    // sets res[i] if arrays[i] holds one of the values, the other bits are
+    // left as they are
+    void
+    Eval(const ArrayView* arrays, int size, TargetBitmapView res) const;
+
+ private:
+    using Values = std::variant<std::vector<int32_t>,
+                                std::vector<int64_t>,
+                                std::vector<float>,
+                                std::vector<double>>;
+
+    ArrayFlatContains(DataType element_type, Values vals)
+        : element_type_(element_type), vals_(std::move(vals)) {
+    }
+
+    template <typename E, typename V>
+    static std::shared_ptr<const ArrayFlatContains>
+    MakeOf(DataType element_type, const std::vector<V>& vals) {
+        // integer values of float elements and the other way round are
+        // left to the row by row path
+        if constexpr (std::is_integral_v<E> != std::is_integral_v<V>) {
+            return nullptr;
+        }
+        std::vector<E> elements;
+        for (const auto& val : vals) {
+            if constexpr (std::is_integral_v<E>) {
+                if (val < std::numeric_limits<E>::min() ||
+                    val > std::numeric_limits<E>::max()) {
+                    continue;
+                }
+            }
+            auto element = static_cast<E>(val);
+            if (static_cast<V>(element) != val) {
+                continue;
+            }
+            elements.push_back(element);
+        }
+        std::sort(elements.begin(), elements.end());
+        elements.erase(std::unique(elements.begin(), elements.end()),
+                       elements.end());
+        // same crossover as SimdBatchElement, many values are faster looked
+        // up in the hash set of the row by row path
+        if (elements.size() >
+            static_cast<size_t>(simdLaneCount<E>()) * 8) {
+            return nullptr;
+        }
+        return std::shared_ptr<const ArrayFlatContains>(
+            new ArrayFlatContains(element_type, std::move(elements)));
+    }
+
+    template <typename E>
+    static void
+    EvalOf(const ArrayView* arrays,
+           int size,
+           const std::vector<E>& vals,
+           TargetBitmapView res);
+
+    DataType element_type_;
+    Values vals_;
+};
+
+}  // namespace exec
+}  // namespace milvus
@@ -0,0 +1,111 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "common/Array.h"
+#include "common/Types.h"
+#include "exec/expression/ArrayFlatContains.h"
+
+using milvus::ArrayView;
+using milvus::DataType;
+using milvus::TargetBitmap;
+using milvus::TargetBitmapView;
+using milvus::exec::ArrayFlatContains;
+
+namespace {
+
+// views of consecutive arrays of `lengths` elements in `elements`
+template <typename E>
+std::vector<ArrayView>
+ViewsOf(std::vector<E>& elements,
+        const std::vector<int>& lengths,
+        DataType element_type) {
+    std::vector<ArrayView> views;
+    size_t offset = 0;
+    for (auto length : lengths) {
+        views.emplace_back(reinterpret_cast<char*>(elements.data() + offset),
+                           length,
+                           length * sizeof(E),
+                           element_type,
+                           nullptr);
+        offset += length;
+    }
+    return views;
+}
+
+std::vector<bool>
+Bits(const TargetBitmap& bitmap) {
+    std::vector<bool> bits;
+    for (size_t i = 0; i < bitmap.size(); ++i) {
+        bits.push_back(bitmap[i]);
+    }
+    return bits;
+}
+
+}  // namespace
+
+TEST(ArrayFlatContainsTest, ContiguousIntArrays) {
+    // int8 to int32 elements are stored as int32
+    std::vector<int32_t> elements{1, 2, 3, 4, 5, 6, 7, 8, 9, 7};
+    auto views = ViewsOf(elements, {3, 0, 2, 4, 1}, DataType::INT16);
+    auto contains = ArrayFlatContains::Make<int64_t>(
+        DataType::INT16, {7, 1, int64_t(1) << 40});
+    ASSERT_NE(contains, nullptr);
+
+    TargetBitmap res(views.size());
+    contains->Eval(views.data(), views.size(), TargetBitmapView(res));
+    EXPECT_EQ(Bits(res), (std::vector<bool>{true, false, false, true, true}));
+}
+
+TEST(ArrayFlatContainsTest, ArraysApartAndLongRuns) {
+    std::vector<int64_t> first{10, 20};
+    std::vector<int64_t> second{30};
+    std::vector<ArrayView> views{ViewsOf(first, {2}, DataType::INT64)[0],
+                                 ViewsOf(second, {1}, DataType::INT64)[0]};
+    auto contains = ArrayFlatContains::Make<int64_t>(DataType::INT64, {30});
+    TargetBitmap res(views.size());
+    contains->Eval(views.data(), views.size(), TargetBitmapView(res));
+    EXPECT_EQ(Bits(res), (std::vector<bool>{false, true}));
+
+    // more elements than one filter batch
+    std::vector<int64_t> many(200000, 1);
+    many[150001] = 30;
+    auto long_views = ViewsOf(many, {100000, 50000, 50000}, DataType::INT64);
+    TargetBitmap long_res(long_views.size());
+    contains->Eval(
+        long_views.data(), long_views.size(), TargetBitmapView(long_res));
+    EXPECT_EQ(Bits(long_res), (std::vector<bool>{false, false, true}));
+}
+
+TEST(ArrayFlatContainsTest, FloatValuesMatchAsWidened) {
+    std::vector<float> elements{0.5f, 0.1f, 2.0f};
+    auto views = ViewsOf(elements, {1, 1, 1}, DataType::FLOAT);
+    // 0.1 is no float, a float element widened never equals it
+    auto contains =
+        ArrayFlatContains::Make<double>(DataType::FLOAT, {0.1, 2.0});
+    TargetBitmap res(views.size());
+    contains->Eval(views.data(), views.size(), TargetBitmapView(res));
+    EXPECT_EQ(Bits(res), (std::vector<bool>{false, false, true}));
+
+    EXPECT_EQ(ArrayFlatContains::Make<int64_t>(DataType::VARCHAR, {1}),
+              nullptr);
+    EXPECT_EQ(ArrayFlatContains::Make<double>(DataType::INT64, {1.0}),
+              nullptr);
+}
@@ -159,9 +159,7 @@ PhyBinaryArithOpEvalRangeExpr::ExecRangeVisitorImplForJson(
     if (real_batch_size == 0) {
         return nullptr;
     }
-    auto res_vec =
-        std::make_shared<ColumnVector>(TargetBitmap(real_batch_size, false),
-                                       TargetBitmap(real_batch_size, true));
+    auto res_vec = NewBitmapColumn(real_batch_size);
     TargetBitmapView res(res_vec->GetRawData(), real_batch_size);
     TargetBitmapView valid_res(res_vec->GetValidRawData(), real_batch_size);
 
@@ -175,7 +173,8 @@ PhyBinaryArithOpEvalRangeExpr::ExecRangeVisitorImplForJson(
         arg_inited_ = true;
     }
 
-    auto pointer = milvus::Json::pointer(expr_->column_.nested_path_);
+    milvus::JsonPointer pointer(
+        milvus::Json::pointer(expr_->column_.nested_path_));
     auto op_type = expr_->op_type_;
     auto arith_type = expr_->arith_op_type_;
     auto value = value_arg_.GetValue<ValueType>();
@@ -253,7 +252,7 @@ PhyBinaryArithOpEvalRangeExpr::ExecRangeVisitorImplForJson(
             }                                                   \
             int array_length = 0;                               \
             auto doc = data[offset].doc();                      \
-            auto array = doc.at_pointer(pointer).get_array();   \
+            auto array = pointer.Find(doc).get_array();         \
             if (!array.error()) {                               \
                 array_length = array.count_elements();          \
             }                                                   \
@@ -272,7 +271,7 @@ PhyBinaryArithOpEvalRangeExpr::ExecRangeVisitorImplForJson(
             TargetBitmapView valid_res,
             ValueType val,
             ValueType right_operand,
-            const std::string& pointer) {
+            const milvus::JsonPointer& pointer) {
         // If data is nullptr, this chunk was skipped by SkipIndex.
         // Nothing to do here since the caller has already handled valid_res.
         if (data == nullptr) {
@@ -582,9 +581,7 @@ PhyBinaryArithOpEvalRangeExpr::ExecRangeVisitorImplForArray(
     if (real_batch_size == 0) {
         return nullptr;
     }
-    auto res_vec =
-        std::make_shared<ColumnVector>(TargetBitmap(real_batch_size, false),
-                                       TargetBitmap(real_batch_size, true));
+    auto res_vec = NewBitmapColumn(real_batch_size);
     TargetBitmapView res(res_vec->GetRawData(), real_batch_size);
     TargetBitmapView valid_res(res_vec->GetValidRawData(), real_batch_size);
 
@@ -964,9 +961,7 @@ PhyBinaryArithOpEvalRangeExpr::ExecRangeVisitorImplForVectorArray(
         arg_inited_ = true;
     }
 
-    auto res_vec =
-        std::make_shared<ColumnVector>(TargetBitmap(real_batch_size, false),
-                                       TargetBitmap(real_batch_size, true));
+    auto res_vec = NewBitmapColumn(real_batch_size);
     TargetBitmapView res(res_vec->GetRawData(), real_batch_size);
     TargetBitmapView valid_res(res_vec->GetValidRawData(), real_batch_size);
 
@@ -1585,9 +1580,7 @@ PhyBinaryArithOpEvalRangeExpr::ExecRangeVisitorImplForData(
         return nullptr;
     }
 
-    auto res_vec =
-        std::make_shared<ColumnVector>(TargetBitmap(real_batch_size, false),
-                                       TargetBitmap(real_batch_size, true));
+    auto res_vec = NewBitmapColumn(real_batch_size);
     TargetBitmapView res(res_vec->GetRawData(), real_batch_size);
     TargetBitmapView valid_res(res_vec->GetValidRawData(), real_batch_size);
 
@@ -1602,9 +1595,25 @@ PhyBinaryArithOpEvalRangeExpr::ExecRangeVisitorImplForData(
     auto op_type = expr_->op_type_;
     auto arith_type = expr_->arith_op_type_;
 
+    // resolve the (cmp, arith) instantiation once per batch; the chunks
+    // below only call through the pointers
+    auto sequential_kernel =
+        ArithCompareKernels<T, FilterType::sequential>::Resolve(op_type,
+                                                                arith_type);
+    auto random_kernel =
+        ArithCompareKernels<T, FilterType::random>::Resolve(op_type,
+                                                            arith_type);
+    if (sequential_kernel == nullptr || random_kernel == nullptr) {
+        ThrowInfo(OpTypeInvalid,
+                  "unsupported operator type for binary arithmetic eval "
+                  "expr: {}, arith type: {}",
+                  op_type,
+                  arith_type);
+    }
+
     auto execute_sub_batch =
-        [ op_type,
-          arith_type ]<FilterType filter_type = FilterType::sequential>(
+        [ sequential_kernel,
+          random_kernel ]<FilterType filter_type = FilterType::sequential>(
             const T* data,
             const bool* valid_data,
             const int32_t* offsets,
@@ -1618,348 +1627,10 @@ PhyBinaryArithOpEvalRangeExpr::ExecRangeVisitorImplForData(
         if (data == nullptr) {
             return;
         }
-        switch (op_type) {
-            case proto::plan::OpType::Equal: {
-                switch (arith_type) {
-                    case proto::plan::ArithOpType::Add: {
-                        ArithOpElementFunc<T,
-                                           proto::plan::OpType::Equal,
-                                           proto::plan::ArithOpType::Add,
-                                           filter_type>
-                            func;
-                        func(data, size, value, right_operand, res, offsets);
-                        break;
-                    }
-                    case proto::plan::ArithOpType::Sub: {
-                        ArithOpElementFunc<T,
-                                           proto::plan::OpType::Equal,
-                                           proto::plan::ArithOpType::Sub,
-                                           filter_type>
-                            func;
-                        func(data, size, value, right_operand, res, offsets);
-                        break;
-                    }
-                    case proto::plan::ArithOpType::Mul: {
-                        ArithOpElementFunc<T,
-                                           proto::plan::OpType::Equal,
-                                           proto::plan::ArithOpType::Mul,
-                                           filter_type>
-                            func;
-                        func(data, size, value, right_operand, res, offsets);
-                        break;
-                    }
-                    case proto::plan::ArithOpType::Div: {
-                        ArithOpElementFunc<T,
-                                           proto::plan::OpType::Equal,
-                                           proto::plan::ArithOpType::Div,
-                                           filter_type>
-                            func;
-                        func(data, size, value, right_operand, res, offsets);
-                        break;
-                    }
-                    case proto::plan::ArithOpType::Mod: {
-                        ArithOpElementFunc<T,
-                                           proto::plan::OpType::Equal,
-                                           proto::plan::ArithOpType::Mod,
-                                           filter_type>
-                            func;
-                        func(data, size, value, right_operand, res, offsets);
-                        break;
-                    }
-                    default:
-                        ThrowInfo(
-                            OpTypeInvalid,
-                            fmt::format("unsupported arith type for binary "
-                                        "arithmetic eval expr: {}",
-                                        arith_type));
-                }
-                break;
-            }
-            case proto::plan::OpType::NotEqual: {
-                switch (arith_type) {
-                    case proto::plan::ArithOpType::Add: {
-                        ArithOpElementFunc<T,
-                                           proto::plan::OpType::NotEqual,
-                                           proto::plan::ArithOpType::Add,
-                                           filter_type>
-                            func;
-                        func(data, size, value, right_operand, res, offsets);
-                        break;
-                    }
-                    case proto::plan::ArithOpType::Sub: {
-                        ArithOpElementFunc<T,
-                                           proto::plan::OpType::NotEqual,
-                                           proto::plan::ArithOpType::Sub,
-                                           filter_type>
-                            func;
-                        func(data, size, value, right_operand, res, offsets);
-                        break;
-                    }
-                    case proto::plan::ArithOpType::Mul: {
-                        ArithOpElementFunc<T,
-                                           proto::plan::OpType::NotEqual,
-                                           proto::plan::ArithOpType::Mul,
-                                           filter_type>
-                            func;
-                        func(data, size, value, right_operand, res, offsets);
-                        break;
-                    }
-                    case proto::plan::ArithOpType::Div: {
-                        ArithOpElementFunc<T,
-                                           proto::plan::OpType::NotEqual,
-                                           proto::plan::ArithOpType::Div,
-                                           filter_type>
-                            func;
-                        func(data, size, value, right_operand, res, offsets);
-                        break;
-                    }
-                    case proto::plan::ArithOpType::Mod: {
-                        ArithOpElementFunc<T,
-                                           proto::plan::OpType::NotEqual,
-                                           proto::plan::ArithOpType::Mod,
-                                           filter_type>
-                            func;
-                        func(data, size, value, right_operand, res, offsets);
-                        break;
-                    }
-                    default:
-                        ThrowInfo(
-                            OpTypeInvalid,
-                            fmt::format("unsupported arith type for binary "
-                                        "arithmetic eval expr: {}",
-                                        arith_type));
-                }
-                break;
-            }
-            case proto::plan::OpType::GreaterThan: {
-                switch (arith_type) {
-                    case proto::plan::ArithOpType::Add: {
-                        ArithOpElementFunc<T,
-                                           proto::plan::OpType::GreaterThan,
-                                           proto::plan::ArithOpType::Add,
-                                           filter_type>
-                            func;
-                        func(data, size, value, right_operand, res, offsets);
-                        break;
-                    }
-                    case proto::plan::ArithOpType::Sub: {
-                        ArithOpElementFunc<T,
-                                           proto::plan::OpType::GreaterThan,
-                                           proto::plan::ArithOpType::Sub,
-                                           filter_type>
-                            func;
-                        func(data, size, value, right_operand, res, offsets);
-                        break;
-                    }
-                    case proto::plan::ArithOpType::Mul: {
-                        ArithOpElementFunc<T,
-                                           proto::plan::OpType::GreaterThan,
-                                           proto::plan::ArithOpType::Mul,
-                                           filter_type>
-                            func;
-                        func(data, size, value, right_operand, res, offsets);
-                        break;
-                    }
-                    case proto::plan::ArithOpType::Div: {
-                        ArithOpElementFunc<T,
-                                           proto::plan::OpType::GreaterThan,
-                                           proto::plan::ArithOpType::Div,
-                                           filter_type>
-                            func;
-                        func(data, size, value, right_operand, res, offsets);
-                        break;
-                    }
-                    case proto::plan::ArithOpType::Mod: {
-                        ArithOpElementFunc<T,
-                                           proto::plan::OpType::GreaterThan,
-                                           proto::plan::ArithOpType::Mod,
-                                           filter_type>
-                            func;
-                        func(data, size, value, right_operand, res, offsets);
-                        break;
-                    }
-                    default:
-                        ThrowInfo(
-                            OpTypeInvalid,
-                            fmt::format("unsupported arith type for binary "
-                                        "arithmetic eval expr: {}",
-                                        arith_type));
-                }
-                break;
-            }
-            case proto::plan::OpType::GreaterEqual: {
-                switch (arith_type) {
-                    case proto::plan::ArithOpType::Add: {
-                        ArithOpElementFunc<T,
-                                           proto::plan::OpType::GreaterEqual,
-                                           proto::plan::ArithOpType::Add,
-                                           filter_type>
-                            func;
-                        func(data, size, value, right_operand, res, offsets);
-                        break;
-                    }
-                    case proto::plan::ArithOpType::Sub: {
-                        ArithOpElementFunc<T,
-                                           proto::plan::OpType::GreaterEqual,
-                                           proto::plan::ArithOpType::Sub,
-                                           filter_type>
-                            func;
-                        func(data, size, value, right_operand, res, offsets);
-                        break;
-                    }
-                    case proto::plan::ArithOpType::Mul: {
-                        ArithOpElementFunc<T,
-                                           proto::plan::OpType::GreaterEqual,
-                                           proto::plan::ArithOpType::Mul,
-                                           filter_type>
-                            func;
-                        func(data, size, value, right_operand, res, offsets);
-                        break;
-                    }
-                    case proto::plan::ArithOpType::Div: {
-                        ArithOpElementFunc<T,
-                                           proto::plan::OpType::GreaterEqual,
-                                           proto::plan::ArithOpType::Div,
-                                           filter_type>
-                            func;
-                        func(data, size, value, right_operand, res, offsets);
-                        break;
-                    }
-                    case proto::plan::ArithOpType::Mod: {
-                        ArithOpElementFunc<T,
-                                           proto::plan::OpType::GreaterEqual,
-                                           proto::plan::ArithOpType::Mod,
-                                           filter_type>
-                            func;
-                        func(data, size, value, right_operand, res, offsets);
-                        break;
-                    }
-                    default:
-                        ThrowInfo(
-                            OpTypeInvalid,
-                            fmt::format("unsupported arith type for binary "
-                                        "arithmetic eval expr: {}",
-                                        arith_type));
-                }
-                break;
-            }
-            case proto::plan::OpType::LessThan: {
-                switch (arith_type) {
-                    case proto::plan::ArithOpType::Add: {
-                        ArithOpElementFunc<T,
-                                           proto::plan::OpType::LessThan,
-                                           proto::plan::ArithOpType::Add,
-                                           filter_type>
-                            func;
-                        func(data, size, value, right_operand, res, offsets);
-                        break;
-                    }
-                    case proto::plan::ArithOpType::Sub: {
-                        ArithOpElementFunc<T,
-                                           proto::plan::OpType::LessThan,
-                                           proto::plan::ArithOpType::Sub,
-                                           filter_type>
-                            func;
-                        func(data, size, value, right_operand, res, offsets);
-                        break;
-                    }
-                    case proto::plan::ArithOpType::Mul: {
-                        ArithOpElementFunc<T,
-                                           proto::plan::OpType::LessThan,
-                                           proto::plan::ArithOpType::Mul,
-                                           filter_type>
-                            func;
-                        func(data, size, value, right_operand, res, offsets);
-                        break;
-                    }
-                    case proto::plan::ArithOpType::Div: {
-                        ArithOpElementFunc<T,
-                                           proto::plan::OpType::LessThan,
-                                           proto::plan::ArithOpType::Div,
-                                           filter_type>
-                            func;
-                        func(data, size, value, right_operand, res, offsets);
-                        break;
-                    }
-                    case proto::plan::ArithOpType::Mod: {
-                        ArithOpElementFunc<T,
-                                           proto::plan::OpType::LessThan,
-                                           proto::plan::ArithOpType::Mod,
-                                           filter_type>
-                            func;
-                        func(data, size, value, right_operand, res, offsets);
-                        break;
-                    }
-                    default:
-                        ThrowInfo(
-                            OpTypeInvalid,
-                            fmt::format("unsupported arith type for binary "
-                                        "arithmetic eval expr: {}",
-                                        arith_type));
-                }
-                break;
-            }
-            case proto::plan::OpType::LessEqual: {
-                switch (arith_type) {
-                    case proto::plan::ArithOpType::Add: {
-                        ArithOpElementFunc<T,
-                                           proto::plan::OpType::LessEqual,
-                                           proto::plan::ArithOpType::Add,
-                                           filter_type>
-                            func;
-                        func(data, size, value, right_operand, res, offsets);
-                        break;
-                    }
-                    case proto::plan::ArithOpType::Sub: {
-                        ArithOpElementFunc<T,
-                                           proto::plan::OpType::LessEqual,
-                                           proto::plan::ArithOpType::Sub,
-                                           filter_type>
-                            func;
-                        func(data, size, value, right_operand, res, offsets);
-                        break;
-                    }
-                    case proto::plan::ArithOpType::Mul: {
-                        ArithOpElementFunc<T,
-                                           proto::plan::OpType::LessEqual,
-                                           proto::plan::ArithOpType::Mul,
-                                           filter_type>
-                            func;
-                        func(data, size, value, right_operand, res, offsets);
-                        break;
-                    }
-                    case proto::plan::ArithOpType::Div: {
-                        ArithOpElementFunc<T,
-                                           proto::plan::OpType::LessEqual,
-                                           proto::plan::ArithOpType::Div,
-                                           filter_type>
-                            func;
-                        func(data, size, value, right_operand, res, offsets);
-                        break;
-                    }
-                    case proto::plan::ArithOpType::Mod: {
-                        ArithOpElementFunc<T,
-                                           proto::plan::OpType::LessEqual,
-                                           proto::plan::ArithOpType::Mod,
-                                           filter_type>
-                            func;
-                        func(data, size, value, right_operand, res, offsets);
-                        break;
-                    }
-                    default:
-                        ThrowInfo(
-                            OpTypeInvalid,
-                            fmt::format("unsupported arith type for binary "
-                                        "arithmetic eval expr: {}",
-                                        arith_type));
-                }
-                break;
-            }
-            default:
-                ThrowInfo(OpTypeInvalid,
-                          "unsupported operator type for binary "
-                          "arithmetic eval expr: {}",
-                          op_type);
+        if constexpr (filter_type == FilterType::sequential) {
+            sequential_kernel(data, size, value, right_operand, res, offsets);
+        } else {
+            random_kernel(data, size, value, right_operand, res, offsets);
         }
         // there is a batch operation in ArithOpElementFunc,
         // so not divide data again for the reason that it may reduce performance if the null distribution is scattered
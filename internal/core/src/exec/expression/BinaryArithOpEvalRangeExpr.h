@@ -298,6 +298,78 @@ struct ArithOpElementFunc {
     }
 };
 
+// Registry of ArithOpElementFunc instantiations, one kernel per
+// (cmp_op, arith_op) pair for a column type. Resolving the pair once per
+// expression replaces walking the op x arith switch tree around every chunk,
+// so each chunk goes straight to its specialized loop.
+template <typename T, FilterType filter_type>
+struct ArithCompareKernels {
+    typedef std::conditional_t<std::is_integral_v<T> &&
+                                   !std::is_same_v<bool, T>,
+                               int64_t,
+                               T>
+        HighPrecisonType;
+    using Kernel = void (*)(const T* src,
+                            size_t size,
+                            HighPrecisonType val,
+                            HighPrecisonType right_operand,
+                            TargetBitmapView res,
+                            const int32_t* offsets);
+
+    // nullptr for a pair the expression does not support
+    static Kernel
+    Resolve(proto::plan::OpType cmp_op, proto::plan::ArithOpType arith_op) {
+        switch (cmp_op) {
+            case proto::plan::OpType::Equal:
+                return ForArith<proto::plan::OpType::Equal>(arith_op);
+            case proto::plan::OpType::NotEqual:
+                return ForArith<proto::plan::OpType::NotEqual>(arith_op);
+            case proto::plan::OpType::GreaterThan:
+                return ForArith<proto::plan::OpType::GreaterThan>(arith_op);
+            case proto::plan::OpType::GreaterEqual:
+                return ForArith<proto::plan::OpType::GreaterEqual>(arith_op);
+            case proto::plan::OpType::LessThan:
+                return ForArith<proto::plan::OpType::LessThan>(arith_op);
+            case proto::plan::OpType::LessEqual:
+                return ForArith<proto::plan::OpType::LessEqual>(arith_op);
+            default:
+                return nullptr;
+        }
+    }
+
+ private:
+    template <proto::plan::OpType cmp_op, proto::plan::ArithOpType arith_op>
+    static void
+    Run(const T* src,
+        size_t size,
+        HighPrecisonType val,
+        HighPrecisonType right_operand,
+        TargetBitmapView res,
+        const int32_t* offsets) {
+        ArithOpElementFunc<T, cmp_op, arith_op, filter_type> func;
+        func(src, size, val, right_operand, res, offsets);
+    }
+
+    template <proto::plan::OpType cmp_op>
+    static Kernel
+    ForArith(proto::plan::ArithOpType arith_op) {
+        switch (arith_op) {
+            case proto::plan::ArithOpType::Add:
+                return &Run<cmp_op, proto::plan::ArithOpType::Add>;
+            case proto::plan::ArithOpType::Sub:
+                return &Run<cmp_op, proto::plan::ArithOpType::Sub>;
+            case proto::plan::ArithOpType::Mul:
+                return &Run<cmp_op, proto::plan::ArithOpType::Mul>;
+            case proto::plan::ArithOpType::Div:
+                return &Run<cmp_op, proto::plan::ArithOpType::Div>;
+            case proto::plan::ArithOpType::Mod:
+                return &Run<cmp_op, proto::plan::ArithOpType::Mod>;
+            default:
+                return nullptr;
+        }
+    }
+};
+
 template <typename T,
           proto::plan::OpType cmp_op,
           proto::plan::ArithOpType arith_op,
@@ -26,6 +26,7 @@
 #include "common/bson_view.h"
 #include "common/type_c.h"
 #include "common/ScopedTimer.h"
+#include "exec/expression/SortedDataRange.h"
 #include "exec/expression/Utils.h"
 #include "fmt/core.h"
 #include "folly/FBVector.h"
@@ -217,6 +218,12 @@ PhyBinaryRangeFilterExpr::ExecRangeVisitorImpl(EvalCtx& context) {
         }
     }
 
+    if constexpr (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>) {
+        if (!has_offset_input_ && exec_path_ == ExprExecPath::SortedData) {
+            return ExecRangeVisitorImplForSortedData<T>();
+        }
+    }
+
     if (exec_path_ == ExprExecPath::ScalarIndex && !has_offset_input_) {
         return ExecRangeVisitorImplForIndex<T>();
     } else {
@@ -315,6 +322,10 @@ PhyBinaryRangeFilterExpr::ExecRangeVisitorImplForIndex() {
         BinaryRangeIndexFunc<T> func;
         return func(index_ptr, val1, val2, lower_inclusive, upper_inclusive);
     };
+    if (!expr_->column_.element_level_) {
+        SetRangeCacheQuery<HighPrecisionType>(
+            val1, lower_inclusive, val2, upper_inclusive);
+    }
     auto res = ProcessIndexChunks<T>(execute_sub_batch, val1, val2);
     AssertInfo(res->size() == real_batch_size,
                "internal error: expr processed rows {} not equal "
@@ -352,9 +363,7 @@ PhyBinaryRangeFilterExpr::ExecRangeVisitorImplForData(EvalCtx& context) {
     if (real_batch_size == 0) {
         return nullptr;
     }
-    auto res_vec =
-        std::make_shared<ColumnVector>(TargetBitmap(real_batch_size, false),
-                                       TargetBitmap(real_batch_size, true));
+    auto res_vec = NewBitmapColumn(real_batch_size);
     TargetBitmapView res(res_vec->GetRawData(), real_batch_size);
     TargetBitmapView valid_res(res_vec->GetValidRawData(), real_batch_size);
 
@@ -513,9 +522,7 @@ PhyBinaryRangeFilterExpr::ExecRangeVisitorImplForJson(EvalCtx& context) {
     if (real_batch_size == 0) {
         return nullptr;
     }
-    auto res_vec =
-        std::make_shared<ColumnVector>(TargetBitmap(real_batch_size, false),
-                                       TargetBitmap(real_batch_size, true));
+    auto res_vec = NewBitmapColumn(real_batch_size);
     TargetBitmapView res(res_vec->GetRawData(), real_batch_size);
     TargetBitmapView valid_res(res_vec->GetValidRawData(), real_batch_size);
 
@@ -528,7 +535,8 @@ PhyBinaryRangeFilterExpr::ExecRangeVisitorImplForJson(EvalCtx& context) {
     }
     ValueType val1 = lower_arg_.GetValue<ValueType>();
     ValueType val2 = upper_arg_.GetValue<ValueType>();
-    auto pointer = milvus::Json::pointer(expr_->column_.nested_path_);
+    milvus::JsonPointer pointer(
+        milvus::Json::pointer(expr_->column_.nested_path_));
 
     size_t processed_cursor = 0;
     auto execute_sub_batch =
@@ -834,9 +842,7 @@ PhyBinaryRangeFilterExpr::ExecRangeVisitorImplForArray(EvalCtx& context) {
     if (real_batch_size == 0) {
         return nullptr;
     }
-    auto res_vec =
-        std::make_shared<ColumnVector>(TargetBitmap(real_batch_size, false),
-                                       TargetBitmap(real_batch_size, true));
+    auto res_vec = NewBitmapColumn(real_batch_size);
     TargetBitmapView res(res_vec->GetRawData(), real_batch_size);
     TargetBitmapView valid_res(res_vec->GetValidRawData(), real_batch_size);
 
@@ -1004,6 +1010,45 @@ PhyBinaryRangeFilterExpr::ExecRangeVisitorImplForPk(EvalCtx& context) {
     return res;
 }
 
+template <typename T>
+VectorPtr
+PhyBinaryRangeFilterExpr::ExecRangeVisitorImplForSortedData() {
+    // integers compare against the bounds as int64, so one out of the
+    // field's range puts the run at an end of the segment
+    typedef std::conditional_t<std::is_integral_v<T>, int64_t, T>
+        HighPrecisionType;
+
+    auto real_batch_size = GetNextBatchSize();
+    if (real_batch_size == 0) {
+        return nullptr;
+    }
+
+    if (cached_index_chunk_id_ != 0) {
+        cached_index_chunk_id_ = 0;
+        auto val1 = GetValueFromProto<HighPrecisionType>(expr_->lower_val_);
+        auto val2 = GetValueFromProto<HighPrecisionType>(expr_->upper_val_);
+        auto begin =
+            expr_->lower_inclusive_
+                ? SortedLowerBound<T>(op_ctx_, *segment_, field_id_, val1)
+                : SortedUpperBound<T>(op_ctx_, *segment_, field_id_, val1);
+        auto end =
+            expr_->upper_inclusive_
+                ? SortedUpperBound<T>(op_ctx_, *segment_, field_id_, val2)
+                : SortedLowerBound<T>(op_ctx_, *segment_, field_id_, val2);
+        begin = std::min(begin, active_count_);
+        end = std::min(end, active_count_);
+        cached_index_chunk_res_ = std::make_shared<TargetBitmap>(active_count_);
+        if (begin < end) {
+            cached_index_chunk_res_->set(begin, end - begin, true);
+        }
+    }
+
+    auto res = MoveOrSliceBitmap(
+        *cached_index_chunk_res_, current_data_global_pos_, real_batch_size);
+    MoveCursor();
+    return res;
+}
+
 void
 PhyBinaryRangeFilterExpr::DetermineExecPath() {
     // PkIndex (binary range only supports PK on sealed segments)
@@ -1018,6 +1063,15 @@ PhyBinaryRangeFilterExpr::DetermineExecPath() {
         return;
     }
 
+    // SortedData: the matches on a field loaded in sorted order are one run
+    // of offsets, cheaper to find than an index lookup
+    if (!expr_->column_.element_level_ &&
+        CanUseSortedDataAtInit(expr_->lower_val_) &&
+        CanUseSortedDataAtInit(expr_->upper_val_)) {
+        exec_path_ = ExprExecPath::SortedData;
+        return;
+    }
+
     SegmentExpr::DetermineExecPath();
     if (exec_path_ != ExprExecPath::ScalarIndex) {
         return;
@@ -1031,6 +1085,15 @@ PhyBinaryRangeFilterExpr::DetermineExecPath() {
     // ARRAY type cannot use scalar index
     if (data_type == DataType::ARRAY) {
         exec_path_ = ExprExecPath::RawData;
+        return;
+    }
+
+    auto lower = ToMetrics(expr_->lower_val_);
+    auto upper = ToMetrics(expr_->upper_val_);
+    if (!expr_->column_.element_level_ && lower.has_value() &&
+        upper.has_value()) {
+        PreferRawScanForWideRange({lower, expr_->lower_inclusive_},
+                                  {upper, expr_->upper_inclusive_});
     }
 }
 
@@ -159,7 +159,7 @@ struct BinaryRangeElementFuncForJson {
     void
     operator()(const ValueType& val1,
                const ValueType& val2,
-               const std::string& pointer,
+               const milvus::JsonPointer& pointer,
                const milvus::Json* src,
                const bool* valid_data,
                size_t n,
@@ -369,6 +369,10 @@ class PhyBinaryRangeFilterExpr : public SegmentExpr {
     VectorPtr
     ExecRangeVisitorImplForPk(EvalCtx& context);
 
+    template <typename T>
+    VectorPtr
+    ExecRangeVisitorImplForSortedData();
+
  private:
     std::shared_ptr<const milvus::expr::BinaryRangeFilterExpr> expr_;
     int64_t overflow_check_pos_{0};
@@ -38,6 +38,7 @@ namespace exec {
 // For LZ4/Raw: payload = LZ4-compressed or raw bytes of result (+ valid if not all-ones).
 // For Roaring/RoaringInv: payload = [result_roaring_size (4B)][result_roaring][valid_roaring]
 //   (valid_roaring is absent if valid is all-ones)
+// For Rle: same layout with Rle-encoded result / valid.
 
 constexpr size_t kHeaderSize = sizeof(uint32_t) * 2;
 
@@ -46,6 +47,83 @@ constexpr double kRoaringDensityMax = 0.03;     // <= 3%  → Roaring
 constexpr double kRoaringInvDensityMin = 0.97;  // >= 97% → invert + Roaring
 constexpr double kRawDensityMin = 0.30;         // 30%-70% → Raw
 constexpr double kRawDensityMax = 0.70;
+// Rle is only picked when its estimated size is at most half of Raw, the
+// decode cost isn't worth it for smaller gains.
+constexpr double kRleMaxSizeRatio = 0.5;
+
+namespace {
+
+size_t
+VarintSize(uint64_t v) {
+    size_t n = 1;
+    while (v >= 0x80) {
+        v >>= 7;
+        ++n;
+    }
+    return n;
+}
+
+void
+AppendVarint(std::vector<char>& out, uint64_t v) {
+    while (v >= 0x80) {
+        out.push_back(static_cast<char>((v & 0x7F) | 0x80));
+        v >>= 7;
+    }
+    out.push_back(static_cast<char>(v));
+}
+
+bool
+ReadVarint(const char*& p, const char* end, uint64_t& v) {
+    v = 0;
+    for (int shift = 0; shift < 64 && p < end; shift += 7) {
+        auto byte = static_cast<uint8_t>(*p++);
+        v |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Call fn(start, len, bit) for every run of an Rle stream. Returns false if
+// the stream is truncated or doesn't cover exactly num_bits.
+template <typename Fn>
+bool
+ForEachRun(const char* data, uint32_t data_len, uint32_t num_bits, Fn&& fn) {
+    const char* p = data;
+    const char* end = data + data_len;
+    uint64_t pos = 0;
+    bool bit = false;
+    while (pos < num_bits) {
+        uint64_t len = 0;
+        if (!ReadVarint(p, end, len) || len > num_bits - pos) {
+            return false;
+        }
+        if (len > 0) {
+            fn(static_cast<size_t>(pos), static_cast<size_t>(len), bit);
+        }
+        pos += len;
+        bit = !bit;
+    }
+    return true;
+}
+
+// [result_size (4B)][result][valid]
+void
+BuildPayload(std::vector<char>& payload,
+             const std::vector<char>& result,
+             const std::vector<char>& valid) {
+    uint32_t rr_sz = static_cast<uint32_t>(result.size());
+    payload.resize(4 + result.size() + valid.size());
+    std::memcpy(payload.data(), &rr_sz, 4);
+    std::memcpy(payload.data() + 4, result.data(), result.size());
+    if (!valid.empty()) {
+        std::memcpy(
+            payload.data() + 4 + result.size(), valid.data(), valid.size());
+    }
+}
+
+}  // namespace
 
 // ---- Roaring V2 zero-copy encode ----
 
@@ -153,6 +231,68 @@ CacheCompressor::DecompressRoaring(const char* data,
     return true;
 }
 
+// ---- Rle encode / decode ----
+
+size_t
+CacheCompressor::CountRuns(const TargetBitmap& bset) {
+    const uint64_t* words = reinterpret_cast<const uint64_t*>(bset.data());
+    const size_t total_bits = bset.size();
+    const size_t total_words = (total_bits + 63) / 64;
+
+    // A run starts at every bit that differs from its predecessor, the bit
+    // before the first one is taken as 0.
+    size_t transitions = 0;
+    uint64_t carry = 0;
+    for (size_t w = 0; w < total_words; ++w) {
+        uint64_t word = words[w];
+        uint64_t mask = ~uint64_t{0};
+        if (w == total_words - 1 && total_bits % 64 != 0) {
+            mask = (uint64_t{1} << (total_bits % 64)) - 1;
+            word &= mask;
+        }
+        transitions += __builtin_popcountll((word ^ ((word << 1) | carry)) &
+                                            mask);
+        carry = word >> 63;
+    }
+    return transitions + 1;
+}
+
+std::vector<char>
+CacheCompressor::CompressRle(const TargetBitmap& bset) {
+    std::vector<char> buf;
+    const size_t total_bits = bset.size();
+    size_t pos = 0;
+    bool bit = false;
+    while (pos < total_bits) {
+        auto next = pos == 0 ? bset.find_first(!bit)
+                             : bset.find_next(pos - 1, !bit);
+        size_t end = next.value_or(total_bits);
+        AppendVarint(buf, end - pos);
+        pos = end;
+        bit = !bit;
+    }
+    return buf;
+}
+
+bool
+CacheCompressor::DecompressRle(const char* data,
+                               uint32_t data_len,
+                               uint32_t num_bits,
+                               TargetBitmap& out) {
+    TargetBitmap result(num_bits, false);
+    auto fill_run = [&result](size_t start, size_t len, bool bit) {
+        if (bit) {
+            result.set(start, len);
+        }
+    };
+    if (!ForEachRun(data, data_len, num_bits, fill_run)) {
+        LOG_WARN("CacheCompressor::DecompressRle: corrupt run stream");
+        return false;
+    }
+    out = std::move(result);
+    return true;
+}
+
 // ---- Public API ----
 
 CompressedData
@@ -188,23 +328,11 @@ CacheCompressor::Compress(const TargetBitmap& result,
         // --- Roaring path (sparse ≤3%) ---
         if (density <= kRoaringDensityMax) {
             out.comp_type = kCompTypeRoaring;
-            auto result_roaring = CompressRoaring(result);
-            uint32_t rr_sz = static_cast<uint32_t>(result_roaring.size());
-
             std::vector<char> valid_roaring;
-            uint32_t vr_sz = 0;
             if (!valid_all_ones && valid.size() > 0) {
                 valid_roaring = CompressRoaring(valid);
-                vr_sz = static_cast<uint32_t>(valid_roaring.size());
-            }
-            out.payload.resize(4 + rr_sz + vr_sz);
-            std::memcpy(out.payload.data(), &rr_sz, 4);
-            std::memcpy(out.payload.data() + 4, result_roaring.data(), rr_sz);
-            if (vr_sz > 0) {
-                std::memcpy(out.payload.data() + 4 + rr_sz,
-                            valid_roaring.data(),
-                            vr_sz);
             }
+            BuildPayload(out.payload, CompressRoaring(result), valid_roaring);
             return out;
         }
 
@@ -214,27 +342,32 @@ CacheCompressor::Compress(const TargetBitmap& result,
             TargetBitmap inverted(result.size());
             inverted.set();
             inverted -= result;
-            auto result_roaring = CompressRoaring(inverted);
-            uint32_t rr_sz = static_cast<uint32_t>(result_roaring.size());
-
             std::vector<char> valid_roaring;
-            uint32_t vr_sz = 0;
             if (!valid_all_ones && valid.size() > 0) {
                 valid_roaring = CompressRoaring(valid);
-                vr_sz = static_cast<uint32_t>(valid_roaring.size());
             }
-            out.payload.resize(4 + rr_sz + vr_sz);
-            std::memcpy(out.payload.data(), &rr_sz, 4);
-            std::memcpy(out.payload.data() + 4, result_roaring.data(), rr_sz);
-            if (vr_sz > 0) {
-                std::memcpy(out.payload.data() + 4 + rr_sz,
-                            valid_roaring.data(),
-                            vr_sz);
+            BuildPayload(
+                out.payload, CompressRoaring(inverted), valid_roaring);
+            return out;
+        }
+
+        // --- Rle path (mid density, clustered) ---
+        // Time-ordered segments often produce a few long runs at any
+        // density. The run count is exact and cheap, the varint width is
+        // estimated from the average run length.
+        const size_t runs = CountRuns(result);
+        const size_t rle_estimate = runs * VarintSize(result.size() / runs);
+        if (rle_estimate <= result_bytes * kRleMaxSizeRatio) {
+            out.comp_type = kCompTypeRle;
+            std::vector<char> valid_rle;
+            if (!valid_all_ones && valid.size() > 0) {
+                valid_rle = CompressRle(valid);
             }
+            BuildPayload(out.payload, CompressRle(result), valid_rle);
             return out;
         }
 
-        // Mid-density (3%-97%): fall through to zero-copy Raw
+        // Mid-density (3%-97%), scattered: fall through to zero-copy Raw
     }
 
     // --- Raw path: zero-copy via pointers ---
@@ -302,8 +435,17 @@ CacheCompressor::Decompress(const char* data,
     const char* payload = data + kHeaderSize;
     const uint32_t payload_len = data_len - kHeaderSize;
 
-    // --- Roaring / RoaringInv path ---
-    if (comp_type == kCompTypeRoaring || comp_type == kCompTypeRoaringInv) {
+    // --- Roaring / RoaringInv / Rle path ---
+    if (comp_type == kCompTypeRoaring || comp_type == kCompTypeRoaringInv ||
+        comp_type == kCompTypeRle) {
+        auto decode = [comp_type](const char* p,
+                                  uint32_t len,
+                                  uint32_t bits,
+                                  TargetBitmap& out) {
+            return comp_type == kCompTypeRle
+                       ? DecompressRle(p, len, bits, out)
+                       : DecompressRoaring(p, len, bits, out);
+        };
         if (payload_len < 4) {
             LOG_WARN("CacheCompressor::Decompress: roaring payload too short");
             return false;
@@ -319,7 +461,7 @@ CacheCompressor::Decompress(const char* data,
             return false;
         }
 
-        if (!DecompressRoaring(payload + 4, rr_sz, result_bits, out_result)) {
+        if (!decode(payload + 4, rr_sz, result_bits, out_result)) {
             return false;
         }
 
@@ -331,10 +473,10 @@ CacheCompressor::Decompress(const char* data,
             out_valid = TargetBitmap(valid_bits);
             out_valid.set();
         } else if (payload_len > 4 + rr_sz) {
-            if (!DecompressRoaring(payload + 4 + rr_sz,
-                                   payload_len - 4 - rr_sz,
-                                   valid_bits,
-                                   out_valid)) {
+            if (!decode(payload + 4 + rr_sz,
+                        payload_len - 4 - rr_sz,
+                        valid_bits,
+                        out_valid)) {
                 return false;
             }
         } else if (valid_bits > 0) {
@@ -393,5 +535,113 @@ CacheCompressor::Decompress(const char* data,
     return true;
 }
 
+bool
+CacheCompressor::DecompressAnd(const char* data,
+                               uint32_t data_len,
+                               uint8_t comp_type,
+                               TargetBitmapView target) {
+    if (data_len < kHeaderSize) {
+        LOG_WARN("CacheCompressor::DecompressAnd: data_len ({}) < header size",
+                 data_len);
+        return false;
+    }
+    uint32_t result_bits = 0;
+    std::memcpy(&result_bits, data, 4);
+    if (result_bits != target.size()) {
+        LOG_WARN(
+            "CacheCompressor::DecompressAnd: size mismatch (cached={}, "
+            "target={})",
+            result_bits,
+            target.size());
+        return false;
+    }
+    if (result_bits == 0) {
+        return true;
+    }
+
+    const char* payload = data + kHeaderSize;
+    const uint32_t payload_len = data_len - kHeaderSize;
+
+    if (comp_type == kCompTypeRaw) {
+        const uint32_t result_bytes = ((result_bits + 63) / 64) * 8;
+        if (payload_len < result_bytes) {
+            LOG_WARN("CacheCompressor::DecompressAnd: raw payload too short");
+            return false;
+        }
+        TargetBitmapView cached(const_cast<char*>(payload), result_bits);
+        target.inplace_and(cached, result_bits);
+        return true;
+    }
+
+    if (comp_type != kCompTypeRoaring && comp_type != kCompTypeRoaringInv &&
+        comp_type != kCompTypeRle) {
+        LOG_WARN("CacheCompressor::DecompressAnd: unknown comp_type={}",
+                 comp_type);
+        return false;
+    }
+    uint32_t rr_sz = 0;
+    if (payload_len < 4) {
+        LOG_WARN("CacheCompressor::DecompressAnd: payload too short");
+        return false;
+    }
+    std::memcpy(&rr_sz, payload, 4);
+    if (rr_sz > payload_len - 4) {
+        LOG_WARN("CacheCompressor::DecompressAnd: result payload too short");
+        return false;
+    }
+
+    // Rle: clear every zero run
+    if (comp_type == kCompTypeRle) {
+        auto clear_run = [&target](size_t start, size_t len, bool bit) {
+            if (!bit) {
+                target.reset(start, len);
+            }
+        };
+        auto ok = ForEachRun(payload + 4, rr_sz, result_bits, clear_run);
+        if (!ok) {
+            LOG_WARN("CacheCompressor::DecompressAnd: corrupt run stream");
+        }
+        return ok;
+    }
+
+    roaring_bitmap_t* r = roaring_bitmap_deserialize_safe(payload + 4, rr_sz);
+    if (!r) {
+        LOG_WARN("CacheCompressor::DecompressAnd: deserialize failed");
+        return false;
+    }
+    uint64_t card = roaring_bitmap_get_cardinality(r);
+    std::vector<uint32_t> positions(card);
+    if (card > 0) {
+        roaring_bitmap_to_uint32_array(r, positions.data());
+    }
+    roaring_bitmap_free(r);
+
+    if (comp_type == kCompTypeRoaringInv) {
+        // positions are the zero bits of the cached result
+        for (uint32_t pos : positions) {
+            if (pos < result_bits) {
+                target.reset(pos);
+            }
+        }
+        return true;
+    }
+
+    // Roaring: clear the gaps between set positions
+    size_t next = 0;
+    for (uint32_t pos : positions) {
+        if (pos >= result_bits) {
+            break;
+        }
+        if (pos > next) {
+            target.reset(next, pos - next);
+        }
+        next = pos + 1;
+    }
+    if (next < result_bits) {
+        target.reset(next, result_bits - next);
+    }
+    return true;
+}
+
 }  // namespace exec
 }  // namespace milvus
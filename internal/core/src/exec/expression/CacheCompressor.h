@@ -29,6 +29,7 @@ constexpr uint8_t kCompTypeLZ4 = 0;
 constexpr uint8_t kCompTypeRoaring = 1;
 constexpr uint8_t kCompTypeRoaringInv =
     2;  // inverted + Roaring (density > 97%)
+constexpr uint8_t kCompTypeRle = 3;  // run lengths, clustered mid density
 constexpr uint8_t kCompTypeRaw = 0xFF;
 
 // Flag in valid_bit_count high bit: valid bitset is all-ones, not stored
@@ -43,7 +44,7 @@ struct CompressedData {
     // Header (8 bytes): [result_bits][valid_bits_with_flag]
     char header[8];
 
-    // For Roaring/RoaringInv: full payload owned here
+    // For Roaring/RoaringInv/Rle: full payload owned here
     std::vector<char> payload;
 
     // For Raw: zero-copy pointers to original data (header still in `header`)
@@ -67,6 +68,7 @@ class CacheCompressor {
     // Compress result+valid bitsets, auto-selecting the best method:
     //   density <= 3%     → Roaring
     //   density >= 97%    → inverted Roaring
+    //   few long runs     → Rle (estimated from the run count)
     //   otherwise         → Raw (zero-copy)
     // Valid bitset: if all-ones, skipped entirely (flagged in header).
     static CompressedData
@@ -89,10 +91,35 @@ class CacheCompressor {
                TargetBitmap& out_result,
                TargetBitmap& out_valid);
 
+    // AND the compressed result bitset into `target` in place, without
+    // decoding it into a temporary bitmap first. The valid bitset is not
+    // read. Returns false on corrupt data or a size mismatch, `target` may
+    // be partially updated in that case.
+    static bool
+    DecompressAnd(const char* data,
+                  uint32_t data_len,
+                  uint8_t comp_type,
+                  TargetBitmapView target);
+
+    // Number of runs of equal bits, counting the leading run of zeros even
+    // when it is empty. O(words), used to estimate the Rle size.
+    static size_t
+    CountRuns(const TargetBitmap& bset);
+
  private:
     static std::vector<char>
     CompressRoaring(const TargetBitmap& bset);
 
+    // Alternating run lengths as LEB128 varints, starting with zeros.
+    static std::vector<char>
+    CompressRle(const TargetBitmap& bset);
+
+    static bool
+    DecompressRle(const char* data,
+                  uint32_t data_len,
+                  uint32_t num_bits,
+                  TargetBitmap& out);
+
     static bool
     DecompressRoaring(const char* data,
                       uint32_t data_len,
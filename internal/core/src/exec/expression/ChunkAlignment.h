@@ -0,0 +1,72 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+namespace milvus {
+namespace exec {
+
+// A cursor into a column chunked its own way: the chunk and the row in it.
+struct ChunkCursor {
+    int64_t* chunk_id;
+    int64_t* chunk_pos;
+    int64_t num_chunks;
+};
+
+// The rows ahead of two cursors over the same rows of two columns, up to the
+// nearest chunk end of either and at most `max_size`, so one kernel over two
+// contiguous arrays covers them; 0 once a column is exhausted. A cursor at
+// the end of its chunk moves to the start of the next non-empty one first,
+// the last chunk keeps it at its end. `left_rows(chunk_id)` and
+// `right_rows(chunk_id)` are the row counts of the chunks of either column.
+template <typename LeftRows, typename RightRows>
+inline int64_t
+NextAlignedSpan(const ChunkCursor& left,
+                const LeftRows& left_rows,
+                const ChunkCursor& right,
+                const RightRows& right_rows,
+                int64_t max_size) {
+    auto rows_in_chunk = [](const ChunkCursor& cursor,
+                            const auto& chunk_rows) -> int64_t {
+        while (*cursor.chunk_id < cursor.num_chunks) {
+            auto rows = chunk_rows(*cursor.chunk_id) - *cursor.chunk_pos;
+            if (rows > 0 || *cursor.chunk_id + 1 == cursor.num_chunks) {
+                return std::max<int64_t>(rows, 0);
+            }
+            ++*cursor.chunk_id;
+            *cursor.chunk_pos = 0;
+        }
+        return 0;
+    };
+    return std::min({rows_in_chunk(left, left_rows),
+                     rows_in_chunk(right, right_rows),
+                     max_size});
+}
+
+// moves both cursors past a span of NextAlignedSpan
+inline void
+AdvanceAligned(const ChunkCursor& left,
+               const ChunkCursor& right,
+               int64_t size) {
+    *left.chunk_pos += size;
+    *right.chunk_pos += size;
+}
+
+}  // namespace exec
+}  // namespace milvus
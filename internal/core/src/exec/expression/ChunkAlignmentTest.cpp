@@ -0,0 +1,80 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+#include "exec/expression/ChunkAlignment.h"
+
+using milvus::exec::AdvanceAligned;
+using milvus::exec::ChunkCursor;
+using milvus::exec::NextAlignedSpan;
+
+namespace {
+
+// (left chunk, left pos, right chunk, right pos, size) of every span
+std::vector<std::tuple<int64_t, int64_t, int64_t, int64_t, int64_t>>
+WalkSpans(const std::vector<int64_t>& left_chunks,
+          const std::vector<int64_t>& right_chunks,
+          int64_t max_size) {
+    int64_t left_id = 0, left_pos = 0, right_id = 0, right_pos = 0;
+    ChunkCursor left{&left_id, &left_pos, int64_t(left_chunks.size())};
+    ChunkCursor right{&right_id, &right_pos, int64_t(right_chunks.size())};
+    auto left_rows = [&](int64_t i) { return left_chunks[i]; };
+    auto right_rows = [&](int64_t i) { return right_chunks[i]; };
+    std::vector<std::tuple<int64_t, int64_t, int64_t, int64_t, int64_t>>
+        spans;
+    while (auto size = NextAlignedSpan(
+               left, left_rows, right, right_rows, max_size)) {
+        spans.emplace_back(left_id, left_pos, right_id, right_pos, size);
+        AdvanceAligned(left, right, size);
+    }
+    return spans;
+}
+
+}  // namespace
+
+TEST(ChunkAlignmentTest, SpansCutAtBoundariesOfBoth) {
+    auto spans = WalkSpans({3, 5, 2}, {4, 6}, 100);
+    std::vector<std::tuple<int64_t, int64_t, int64_t, int64_t, int64_t>>
+        expected{{0, 0, 0, 0, 3},
+                 {1, 0, 0, 3, 1},
+                 {1, 1, 1, 0, 4},
+                 {2, 0, 1, 4, 2}};
+    EXPECT_EQ(spans, expected);
+}
+
+TEST(ChunkAlignmentTest, SpansCutAtMaxSizeAndSkipEmptyChunks) {
+    auto spans = WalkSpans({0, 4, 0}, {2, 0, 2}, 3);
+    std::vector<std::tuple<int64_t, int64_t, int64_t, int64_t, int64_t>>
+        expected{{1, 0, 0, 0, 2}, {1, 2, 2, 0, 2}};
+    EXPECT_EQ(spans, expected);
+
+    // the cursors stay at the end of the last chunk
+    int64_t id = 0, pos = 0;
+    ChunkCursor cursor{&id, &pos, 2};
+    auto rows = [](int64_t) { return int64_t(1); };
+    EXPECT_EQ(NextAlignedSpan(cursor, rows, cursor, rows, 10), 1);
+    pos = 1;
+    EXPECT_EQ(NextAlignedSpan(cursor, rows, cursor, rows, 10), 1);
+    pos = 1;
+    EXPECT_EQ(NextAlignedSpan(cursor, rows, cursor, rows, 10), 0);
+    EXPECT_EQ(id, 1);
+    EXPECT_EQ(pos, 1);
+}
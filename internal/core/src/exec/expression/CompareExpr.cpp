@@ -58,22 +58,13 @@ PhyCompareFilterExpr::CanUseBothDataFastPath() {
         return true;
     }
 
+    // the chunks of left and right need not align, they are compared in
+    // spans within a chunk of both
     auto left_chunks = segment->num_chunk_data(left_field_);
     auto right_chunks = segment->num_chunk_data(right_field_);
-    if (left_chunks <= 0 || right_chunks <= 0 || left_chunks != right_chunks) {
-        can_use_both_data_sequential_fast_path_ = false;
-        return false;
-    }
-
-    for (int64_t i = 0; i <= left_chunks; ++i) {
-        if (segment->num_rows_until_chunk(left_field_, i) !=
-            segment->num_rows_until_chunk(right_field_, i)) {
-            can_use_both_data_sequential_fast_path_ = false;
-            return false;
-        }
-    }
-    can_use_both_data_sequential_fast_path_ = true;
-    return true;
+    can_use_both_data_sequential_fast_path_ = left_chunks > 0 &&
+                                              right_chunks > 0;
+    return can_use_both_data_sequential_fast_path_.value();
 }
 
 int64_t
@@ -96,9 +87,7 @@ PhyCompareFilterExpr::ExecCompareExprDispatcher(OpType op, EvalCtx& context) {
             return nullptr;
         }
 
-        auto res_vec =
-            std::make_shared<ColumnVector>(TargetBitmap(real_batch_size, false),
-                                           TargetBitmap(real_batch_size, true));
+        auto res_vec = NewBitmapColumn(real_batch_size);
         TargetBitmapView res(res_vec->GetRawData(), real_batch_size);
         TargetBitmapView valid_res(res_vec->GetValidRawData(), real_batch_size);
 
@@ -370,9 +359,7 @@ PhyCompareFilterExpr::ExecCompareRightType(EvalCtx& context) {
     }
 
     const auto& bitmap_input = context.get_bitmap_input();
-    auto res_vec =
-        std::make_shared<ColumnVector>(TargetBitmap(real_batch_size, false),
-                                       TargetBitmap(real_batch_size, true));
+    auto res_vec = NewBitmapColumn(real_batch_size);
     TargetBitmapView res(res_vec->GetRawData(), real_batch_size);
     TargetBitmapView valid_res(res_vec->GetValidRawData(), real_batch_size);
 
@@ -17,11 +17,13 @@
 #pragma once
 
 #include <fmt/core.h>
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <optional>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -36,6 +38,7 @@
 #include "common/Vector.h"
 #include "common/protobuf_utils.h"
 #include "common/type_c.h"
+#include "exec/expression/ChunkAlignment.h"
 #include "exec/expression/EvalCtx.h"
 #include "exec/expression/Expr.h"
 #include "expr/ITypeExpr.h"
@@ -43,6 +46,7 @@
 #include "pb/plan.pb.h"
 #include "segcore/SegmentChunkReader.h"
 #include "segcore/SegmentInterface.h"
+#include "segcore/SegmentSealed.h"
 
 namespace milvus {
 namespace exec {
@@ -116,6 +120,27 @@ struct CompareElementFunc {
             return;
         }
 
+        if constexpr (!std::is_same_v<T, U>) {
+            // the vectorized kernels take one type, mixed types compare in
+            // their common type as the code above does, the narrower side
+            // widened a block at a time
+            using C = std::common_type_t<T, U>;
+            constexpr size_t kBlockSize = 1024;
+            C left_block[std::is_same_v<T, C> ? 1 : kBlockSize];
+            C right_block[std::is_same_v<U, C> ? 1 : kBlockSize];
+            for (size_t begin = 0; begin < size; begin += kBlockSize) {
+                auto block_size = std::min(kBlockSize, size - begin);
+                CompareElementFunc<C, C, op, filter_type>{}(
+                    Widen<C>(left + begin, block_size, left_block),
+                    Widen<C>(right + begin, block_size, right_block),
+                    block_size,
+                    res + begin,
+                    bitmap_input,
+                    start_cursor + begin);
+            }
+            return;
+        }
+
         if constexpr (op == proto::plan::OpType::Equal) {
             res.inplace_compare_column<T, U, milvus::bitset::CompareOpType::EQ>(
                 left, right, size);
@@ -140,6 +165,19 @@ struct CompareElementFunc {
                           "unsupported op_type:{} for CompareElementFunc", op));
         }
     }
+
+ private:
+    // `data` as C, in `block` unless it is C already
+    template <typename C, typename V>
+    static const C*
+    Widen(const V* data, size_t size, C* block) {
+        if constexpr (std::is_same_v<V, C>) {
+            return data;
+        } else {
+            std::copy(data, data + size, block);
+            return block;
+        }
+    }
 };
 
 class PhyCompareFilterExpr : public Expr {
@@ -324,6 +362,59 @@ class PhyCompareFilterExpr : public Expr {
         }
     }
 
+    // Ascending offsets into a chunked sealed segment: the spans of both
+    // fields are pinned once for the whole batch and every row is read from
+    // the chunk run holding it, no chunk lookup or pin per row.
+    template <typename T, typename U, typename FUNC, typename... ValTypes>
+    int64_t
+    ProcessBothSealedDataByOffsets(FUNC func,
+                                   OffsetVector* input,
+                                   TargetBitmapView res,
+                                   TargetBitmapView valid_res,
+                                   const ValTypes&... values) {
+        auto segment = static_cast<const segcore::SegmentSealed*>(
+            segment_chunk_reader_.segment_);
+        int64_t size = input->size();
+        std::vector<int64_t> offsets(input->begin(), input->end());
+        auto pw_left =
+            segment->chunk_spans(op_ctx_, left_field_, offsets.data(), size);
+        auto pw_right =
+            segment->chunk_spans(op_ctx_, right_field_, offsets.data(), size);
+        const auto& left_runs = pw_left.get();
+        const auto& right_runs = pw_right.get();
+        size_t left_run = 0;
+        size_t right_run = 0;
+        for (int64_t i = 0; i < size; ++i) {
+            // both fields keep their own chunk layout
+            while (left_runs[left_run].end <= i) {
+                left_run++;
+            }
+            while (right_runs[right_run].end <= i) {
+                right_run++;
+            }
+            const auto& left = left_runs[left_run];
+            const auto& right = right_runs[right_run];
+            auto left_offset = offsets[i] - left.rows_before;
+            auto right_offset = offsets[i] - right.rows_before;
+            const bool* left_valid_data = left.span.valid_data();
+            const bool* right_valid_data = right.span.valid_data();
+            if ((left_valid_data && !left_valid_data[left_offset]) ||
+                (right_valid_data && !right_valid_data[right_offset])) {
+                res[i] = false;
+                valid_res[i] = false;
+                continue;
+            }
+            func.template operator()<FilterType::random>(
+                static_cast<const T*>(left.span.data()) + left_offset,
+                static_cast<const U*>(right.span.data()) + right_offset,
+                nullptr,
+                1,
+                res + i,
+                values...);
+        }
+        return size;
+    }
+
     template <typename T, typename U, typename FUNC, typename... ValTypes>
     int64_t
     ProcessBothDataByOffsets(FUNC func,
@@ -333,6 +424,12 @@ class PhyCompareFilterExpr : public Expr {
                              const ValTypes&... values) {
         int64_t size = input->size();
         int64_t processed_size = 0;
+        if (segment_chunk_reader_.segment_->is_chunked() &&
+            segment_chunk_reader_.segment_->type() == SegmentType::Sealed &&
+            std::is_sorted(input->begin(), input->end())) {
+            return ProcessBothSealedDataByOffsets<T, U>(
+                func, input, res, valid_res, values...);
+        }
         if (segment_chunk_reader_.segment_->is_chunked() ||
             segment_chunk_reader_.segment_->type() == SegmentType::Growing) {
             for (auto i = 0; i < size; ++i) {
@@ -507,42 +604,59 @@ class PhyCompareFilterExpr : public Expr {
                                           TargetBitmapView valid_res,
                                           const ValTypes&... values) {
         int64_t processed_size = 0;
-
-        // only call this function when left and right are not indexed, so they have the same number of chunks
-        for (size_t i = left_current_chunk_id_; i < left_num_chunk_; i++) {
-            auto pw_left = segment_chunk_reader_.segment_->chunk_data<T>(
-                op_ctx_, left_field_, i);
-            auto left_chunk = pw_left.get();
-            auto pw_right = segment_chunk_reader_.segment_->chunk_data<U>(
-                op_ctx_, right_field_, i);
-            auto right_chunk = pw_right.get();
-            auto data_pos =
-                (i == left_current_chunk_id_) ? left_current_chunk_pos_ : 0;
-            auto size = 0;
-            if (segment_chunk_reader_.segment_->type() ==
-                SegmentType::Growing) {
-                size =
-                    (i == (left_num_chunk_ - 1))
-                        ? (segment_chunk_reader_.active_count_ %
-                                       segment_chunk_reader_.SizePerChunk() ==
-                                   0
-                               ? segment_chunk_reader_.SizePerChunk() - data_pos
-                               : segment_chunk_reader_.active_count_ %
-                                         segment_chunk_reader_.SizePerChunk() -
-                                     data_pos)
-                        : segment_chunk_reader_.SizePerChunk() - data_pos;
-            } else {
-                size =
-                    segment_chunk_reader_.segment_->chunk_size(left_field_, i) -
-                    data_pos;
+        const auto batch_size = GetNextBatchSize();
+        auto segment = segment_chunk_reader_.segment_;
+        auto chunk_rows = [&](FieldId field) {
+            return [&, field](int64_t chunk_id) -> int64_t {
+                if (segment->type() == SegmentType::Growing) {
+                    auto size_per_chunk = segment_chunk_reader_.SizePerChunk();
+                    return std::min(size_per_chunk,
+                                    segment_chunk_reader_.active_count_ -
+                                        chunk_id * size_per_chunk);
+                }
+                return segment->chunk_size(field, chunk_id);
+            };
+        };
+        auto left_rows = chunk_rows(left_field_);
+        auto right_rows = chunk_rows(right_field_);
+
+        // left and right are not indexed, but may be chunked apart, they are
+        // walked in spans within a chunk of both
+        ChunkCursor left{
+            &left_current_chunk_id_, &left_current_chunk_pos_, left_num_chunk_};
+        ChunkCursor right{&right_current_chunk_id_,
+                          &right_current_chunk_pos_,
+                          right_num_chunk_};
+        std::optional<PinWrapper<Span<T>>> pw_left;
+        std::optional<PinWrapper<Span<U>>> pw_right;
+        int64_t pinned_left_id = -1;
+        int64_t pinned_right_id = -1;
+        while (processed_size < batch_size) {
+            auto size = NextAlignedSpan(left,
+                                        left_rows,
+                                        right,
+                                        right_rows,
+                                        batch_size - processed_size);
+            if (size == 0) {
+                break;
             }
-
-            if (processed_size + size >= batch_size_) {
-                size = batch_size_ - processed_size;
+            if (pinned_left_id != left_current_chunk_id_) {
+                pw_left.emplace(segment->chunk_data<T>(
+                    op_ctx_, left_field_, left_current_chunk_id_));
+                pinned_left_id = left_current_chunk_id_;
+            }
+            if (pinned_right_id != right_current_chunk_id_) {
+                pw_right.emplace(segment->chunk_data<U>(
+                    op_ctx_, right_field_, right_current_chunk_id_));
+                pinned_right_id = right_current_chunk_id_;
             }
+            auto left_chunk = pw_left->get();
+            auto right_chunk = pw_right->get();
+            auto left_pos = left_current_chunk_pos_;
+            auto right_pos = right_current_chunk_pos_;
 
-            const T* left_data = left_chunk.data() + data_pos;
-            const U* right_data = right_chunk.data() + data_pos;
+            const T* left_data = left_chunk.data() + left_pos;
+            const U* right_data = right_chunk.data() + right_pos;
             func(left_data,
                  right_data,
                  nullptr,
@@ -553,23 +667,18 @@ class PhyCompareFilterExpr : public Expr {
             const bool* right_valid_data = right_chunk.valid_data();
             // mask with valid_data
             for (int i = 0; i < size; ++i) {
-                if (left_valid_data && !left_valid_data[i + data_pos]) {
+                if (left_valid_data && !left_valid_data[i + left_pos]) {
                     res[processed_size + i] = false;
                     valid_res[processed_size + i] = false;
                     continue;
                 }
-                if (right_valid_data && !right_valid_data[i + data_pos]) {
+                if (right_valid_data && !right_valid_data[i + right_pos]) {
                     res[processed_size + i] = false;
                     valid_res[processed_size + i] = false;
                 }
             }
             processed_size += size;
-
-            if (processed_size >= batch_size_) {
-                left_current_chunk_id_ = i;
-                left_current_chunk_pos_ = data_pos + size;
-                break;
-            }
+            AdvanceAligned(left, right, size);
         }
 
         return processed_size;
@@ -17,12 +17,17 @@
 #include "ConjunctExpr.h"
 
 #include <algorithm>
+#include <chrono>
+#include <iterator>
+#include <limits>
 
 #include "LikeConjunctExpr.h"
 #include "UnaryExpr.h"
+#include "common/Common.h"
 #include "common/EasyAssert.h"
 #include "common/Tracer.h"
 #include "common/ValueOp.h"
+#include "exec/BitmapPool.h"
 #include "exec/QueryContext.h"
 #include "exec/expression/Utils.h"
 #include "fmt/core.h"
@@ -58,6 +63,11 @@ PhyConjunctFilterExpr::UpdateResult(ColumnVectorPtr& input_result,
         common::ThreeValuedLogicOp::Or(result, input_result);
     }
 
+    return CountActiveRows(result);
+}
+
+int64_t
+PhyConjunctFilterExpr::CountActiveRows(const ColumnVectorPtr& result) const {
     // Return rows that still need the following expressions.
     // For AND: TRUE or NULL rows still need evaluation; only definite FALSE can
     // stop. For OR: FALSE or NULL rows still need evaluation; only definite TRUE
@@ -65,16 +75,29 @@ PhyConjunctFilterExpr::UpdateResult(ColumnVectorPtr& input_result,
     const size_t size = result->size();
     TargetBitmapView res_data(result->GetRawData(), size);
     TargetBitmapView res_valid(result->GetValidRawData(), size);
+    using bitset::FusedOpType;
+    // over data and valid, counted in a single pass without a copy
+    static constexpr bitset::FusedOp kAndActive[] = {
+        // data | ~valid
+        {FusedOpType::LOAD, 0},
+        {FusedOpType::LOAD, 1},
+        {FusedOpType::NOT},
+        {FusedOpType::OR},
+    };
+    static constexpr bitset::FusedOp kOrActive[] = {
+        // ~(data & valid)
+        {FusedOpType::LOAD, 0},
+        {FusedOpType::LOAD, 1},
+        {FusedOpType::AND},
+        {FusedOpType::NOT},
+    };
+    const TargetBitmapView others[] = {res_valid};
     if (is_and_) {
-        TargetBitmap active_rows(res_valid);
-        active_rows.inplace_sub(res_data, size);  // valid & ~data
-        active_rows.flip();                       // data | ~valid
-        return static_cast<int64_t>(active_rows.count());
+        return static_cast<int64_t>(res_data.count_fused(
+            others, std::size(others), kAndActive, std::size(kAndActive)));
     } else {
-        TargetBitmap active_rows(res_data);
-        active_rows.inplace_and(res_valid, size);  // data & valid
-        active_rows.flip();                        // ~data | ~valid
-        return static_cast<int64_t>(active_rows.count());
+        return static_cast<int64_t>(res_data.count_fused(
+            others, std::size(others), kOrActive, std::size(kOrActive)));
     }
 }
 
@@ -99,6 +122,86 @@ PhyConjunctFilterExpr::SkipFollowingExprs(int start) {
     }
 }
 
+void
+PhyConjunctFilterExpr::RecordInputStats(size_t idx,
+                                        int64_t rows_in,
+                                        int64_t rows_out,
+                                        int64_t time_ns) {
+    auto& stats = input_stats_[idx];
+    stats.rows_in += rows_in;
+    stats.rows_decided += rows_in - rows_out;
+    stats.time_ns += time_ns;
+}
+
+void
+PhyConjunctFilterExpr::AdaptInputOrder() {
+    std::vector<double> price(inputs_.size());
+    for (size_t idx = 0; idx < inputs_.size(); ++idx) {
+        auto& stats = input_stats_[idx];
+        if (stats.rows_in == 0) {
+            // never reached since the last reorder, keep it behind the others
+            price[idx] = std::numeric_limits<double>::infinity();
+            continue;
+        }
+        // charge at least a nanosecond per row seen, so inputs too fast to
+        // time still rank by the rows they decide
+        price[idx] = static_cast<double>(stats.time_ns + stats.rows_in) /
+                     static_cast<double>(stats.rows_decided + 1);
+        // halve the history so that the order follows the recent batches
+        stats.rows_in /= 2;
+        stats.rows_decided /= 2;
+        stats.time_ns /= 2;
+    }
+    auto old_order = input_order_;
+    std::stable_sort(
+        input_order_.begin(), input_order_.end(), [&](size_t a, size_t b) {
+            return price[a] < price[b];
+        });
+    if (input_order_ != old_order) {
+        LOG_DEBUG("adaptive reorder of conjunct inputs: {}", ToString());
+    }
+}
+
+void
+PhyConjunctFilterExpr::EvalActiveRows(Expr& input,
+                                      int64_t batch_begin,
+                                      EvalCtx& context,
+                                      VectorPtr& result) {
+    auto active = context.get_bitmap_input().clone();
+    OffsetVector offsets;
+    offsets.reserve(active.count());
+    for (auto i = active.find_first(); i.has_value();
+         i = active.find_next(i.value())) {
+        offsets.push_back(static_cast<int32_t>(batch_begin + i.value()));
+    }
+    // the bitmap input is indexed by batch row, the offset path would read
+    // it by position in `offsets`
+    context.clear_bitmap_input();
+    context.set_offset_input(&offsets);
+    VectorPtr selected;
+    input.Eval(context, selected);
+    context.set_offset_input(nullptr);
+    input.SetHasOffsetInput(false);
+    input.MoveCursor();
+
+    auto selected_vec = GetColumnVector(selected);
+    AssertInfo(selected_vec->size() == offsets.size(),
+               "offset input of {} rows returned {} results",
+               offsets.size(),
+               selected_vec->size());
+    TargetBitmapView selected_data(selected_vec->GetRawData(), offsets.size());
+    TargetBitmapView selected_valid(selected_vec->GetValidRawData(),
+                                    offsets.size());
+    TargetBitmap data(active.size(), false);
+    TargetBitmap valid(active.size(), true);
+    for (size_t j = 0; j < offsets.size(); ++j) {
+        auto row = offsets[j] - batch_begin;
+        data.set(row, selected_data[j]);
+        valid.set(row, selected_valid[j]);
+    }
+    result = std::make_shared<ColumnVector>(std::move(data), std::move(valid));
+}
+
 void
 PhyConjunctFilterExpr::Eval(EvalCtx& context, VectorPtr& result) {
     tracer::AutoSpan span(
@@ -152,7 +255,25 @@ PhyConjunctFilterExpr::Eval(EvalCtx& context, VectorPtr& result) {
         }
     }
 
+    // Every input consumes its own cursor, so the order can change between
+    // batches. Not with a pending batch ngram expression, whose slot in
+    // input_order_ is fixed at compile time.
+    bool adaptive = OPTIMIZE_EXPR_ENABLED.load() && inputs_.size() > 1 &&
+                    like_indices_.size() <= 1 &&
+                    input_order_.size() == inputs_.size();
+    if (adaptive) {
+        if (input_stats_.size() != inputs_.size()) {
+            input_stats_.assign(inputs_.size(), InputStats{});
+        }
+        if (num_evaluated_batches_ > 0 &&
+            num_evaluated_batches_ % kAdaptiveReorderInterval == 0) {
+            AdaptInputOrder();
+        }
+        ++num_evaluated_batches_;
+    }
+
     bool has_result = false;
+    int64_t active_rows = 0;
     for (size_t i = 0; i < input_order_.size(); ++i) {
         size_t idx = input_order_[i];
 
@@ -162,24 +283,58 @@ PhyConjunctFilterExpr::Eval(EvalCtx& context, VectorPtr& result) {
         }
 
         VectorPtr input_result;
-        inputs_[idx]->Eval(context, input_result);
+        auto start = std::chrono::steady_clock::now();
+        std::optional<int64_t> sparse_begin;
+        if (has_result && !has_input_offset &&
+            inputs_[idx]->SupportOffsetInput()) {
+            sparse_begin = inputs_[idx]->SparseBatchBegin();
+        }
+        const auto& bitmap_input = context.get_bitmap_input();
+        if (sparse_begin.has_value() &&
+            bitmap_input.count() <
+                bitmap_input.size() * kSparseInputDensity) {
+            EvalActiveRows(
+                *inputs_[idx], sparse_begin.value(), context, input_result);
+        } else {
+            inputs_[idx]->Eval(context, input_result);
+        }
+        auto time_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                           std::chrono::steady_clock::now() - start)
+                           .count();
 
         if (!has_result) {
             result = input_result;
             has_result = true;
             auto all_flat_result = GetColumnVector(result);
+            int64_t rows_in = all_flat_result->size();
             if (CanSkipFollowingExprs(all_flat_result)) {
+                if (adaptive) {
+                    RecordInputStats(idx, rows_in, 0, time_ns);
+                }
                 SkipFollowingExprs(i + 1);
                 ClearBitmapInput(context);
                 return;
             }
+            if (adaptive) {
+                active_rows = CountActiveRows(all_flat_result);
+                RecordInputStats(idx, rows_in, active_rows, time_ns);
+            }
             SetNextExprBitmapInput(all_flat_result, context);
             continue;
         }
         auto input_flat_result = GetColumnVector(input_result);
         auto all_flat_result = GetColumnVector(result);
-        auto active_rows =
-            UpdateResult(input_flat_result, context, all_flat_result);
+        auto rows_in = active_rows;
+        active_rows = UpdateResult(input_flat_result, context, all_flat_result);
+        if (adaptive) {
+            RecordInputStats(idx, rows_in, active_rows, time_ns);
+        }
+        // merged into the result, the input's bitmaps are free for the
+        // following inputs and batches
+        if (auto* pool = BitmapPool::Current()) {
+            input_flat_result.reset();
+            pool->Recycle(input_result);
+        }
         if (active_rows == 0) {
             SkipFollowingExprs(i + 1);
             ClearBitmapInput(context);
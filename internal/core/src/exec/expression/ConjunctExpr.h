@@ -133,6 +133,21 @@ class PhyConjunctFilterExpr : public Expr {
         return true;
     }
 
+    bool
+    SupportsMorselEval() const override {
+        // multiple LIKEs may be merged into a PhyLikeConjunctExpr at runtime,
+        // which evaluates the whole segment through the ngram index
+        if (like_indices_.size() > 1) {
+            return false;
+        }
+        for (const auto& input : inputs_) {
+            if (!input->SupportsMorselEval()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
     void
     SetExecuteAllAtOnce() override {
         for (auto& input : inputs_) {
@@ -234,6 +249,49 @@ class PhyConjunctFilterExpr : public Expr {
 
     void
     SkipFollowingExprs(int start);
+
+    // Rows of `result` the following inputs still have to decide: TRUE or
+    // NULL for AND, FALSE or NULL for OR.
+    int64_t
+    CountActiveRows(const ColumnVectorPtr& result) const;
+
+    void
+    RecordInputStats(size_t idx,
+                     int64_t rows_in,
+                     int64_t rows_out,
+                     int64_t time_ns);
+
+    // Re-sorts input_order_ by the observed time each input spends per row
+    // it decides, cheapest first, see InputStats.
+    void
+    AdaptInputOrder();
+
+    // What one input cost so far: rows it saw undecided, rows it decided
+    // (dropped from the following inputs) and the time spent in its Eval.
+    // time_ns / rows_decided is the price of deciding a row with it, so the
+    // order that minimizes the total cost runs the lowest price first.
+    struct InputStats {
+        int64_t rows_in{0};
+        int64_t rows_decided{0};
+        int64_t time_ns{0};
+    };
+
+    // batches between two AdaptInputOrder
+    static constexpr int64_t kAdaptiveReorderInterval = 8;
+
+    // Evaluates `input` only on the rows the bitmap input still marks as
+    // active, gathered through the offset input, and skips the batch of
+    // its cursor. The rows not evaluated come back FALSE, which leaves them
+    // decided whether this is an AND or an OR.
+    void
+    EvalActiveRows(Expr& input,
+                   int64_t batch_begin,
+                   EvalCtx& context,
+                   VectorPtr& result);
+
+    // below this share of active rows an input that supports it is
+    // evaluated through EvalActiveRows instead of over the whole batch
+    static constexpr double kSparseInputDensity = 0.05;
     // true if conjunction (and), false if disjunction (or).
     bool is_and_;
     std::vector<size_t> input_order_;
@@ -243,6 +301,9 @@ class PhyConjunctFilterExpr : public Expr {
     bool like_batch_initialized_{false};
     // Indices of expressions executed via batch ngram (to skip in normal iteration)
     std::set<size_t> batch_ngram_indices_;
+    // indexed like inputs_
+    std::vector<InputStats> input_stats_;
+    int64_t num_evaluated_batches_{0};
 };
 }  //namespace exec
 }  // namespace milvus
@@ -16,6 +16,7 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <memory>
 #include <optional>
 #include <string>
@@ -76,6 +77,73 @@ FixedBool(const bool data, const bool valid) {
                                              std::move(valid_bitmap));
 }
 
+// Scans rows [begin, begin + size) and matches the offsets in `hits`.
+class SparseScanExpr : public Expr {
+ public:
+    SparseScanExpr(int64_t begin, size_t size, std::vector<int32_t> hits)
+        : Expr(DataType::BOOL, {}, "SparseScanExpr", nullptr),
+          begin_(begin),
+          size_(size),
+          hits_(std::move(hits)) {
+    }
+
+    void
+    Eval(EvalCtx& context, VectorPtr& result) override {
+        auto* offsets = context.get_offset_input();
+        SetHasOffsetInput(offsets != nullptr);
+        std::vector<int32_t> rows;
+        if (offsets != nullptr) {
+            rows.assign(offsets->begin(), offsets->end());
+            seen_offsets_ = rows;
+        } else {
+            ++full_evals_;
+            for (size_t i = 0; i < size_; ++i) {
+                rows.push_back(static_cast<int32_t>(begin_ + i));
+            }
+        }
+        TargetBitmap data(rows.size(), false);
+        for (size_t i = 0; i < rows.size(); ++i) {
+            data.set(i,
+                     std::find(hits_.begin(), hits_.end(), rows[i]) !=
+                         hits_.end());
+        }
+        TargetBitmap valid(rows.size(), true);
+        result =
+            std::make_shared<ColumnVector>(std::move(data), std::move(valid));
+    }
+
+    void
+    MoveCursor() override {
+        if (!has_offset_input_) {
+            ++move_count_;
+        }
+    }
+
+    std::optional<int64_t>
+    SparseBatchBegin() const override {
+        return begin_;
+    }
+
+    std::string
+    ToString() const override {
+        return "SparseScanExpr";
+    }
+
+    std::optional<milvus::expr::ColumnInfo>
+    GetColumnInfo() const override {
+        return std::nullopt;
+    }
+
+    int full_evals_ = 0;
+    int move_count_ = 0;
+    std::vector<int32_t> seen_offsets_;
+
+ private:
+    int64_t begin_;
+    size_t size_;
+    std::vector<int32_t> hits_;
+};
+
 }  // namespace
 
 TEST(ConjunctExprTest, AndKeepsUnknownRowsActiveForFollowingFalse) {
@@ -109,4 +177,130 @@ TEST(ConjunctExprTest, AndKeepsUnknownRowsActiveForFollowingFalse) {
     EXPECT_EQ(false_expr->move_count_, 0);
 }
 
+TEST(ConjunctExprTest, AndMovesSelectiveInputFirst) {
+    // the plan puts an input that keeps every row before one that drops
+    // all but the first row
+    constexpr size_t kRows = 64;
+    auto keep_all = std::make_shared<FixedBitmapExpr>(
+        TargetBitmap(kRows, true), TargetBitmap(kRows, true));
+    TargetBitmap first_only(kRows, false);
+    first_only.set(0);
+    auto drop_most = std::make_shared<FixedBitmapExpr>(
+        std::move(first_only), TargetBitmap(kRows, true));
+
+    std::vector<ExprPtr> inputs{keep_all, drop_most};
+    PhyConjunctFilterExpr conjunct(std::move(inputs), true, nullptr);
+
+    QueryContext query_context("conjunct_test", nullptr, kRows, 0);
+    ExecContext exec_context(&query_context);
+    EvalCtx eval_context(&exec_context);
+
+    for (int batch = 0; batch < 9; ++batch) {
+        VectorPtr result;
+        conjunct.Eval(eval_context, result);
+        auto output = std::dynamic_pointer_cast<ColumnVector>(result);
+        ASSERT_NE(output, nullptr);
+        TargetBitmapView data(output->GetRawData(), output->size());
+        ASSERT_EQ(data.count(), 1) << "batch " << batch;
+        EXPECT_TRUE(data[0]);
+    }
+    EXPECT_EQ(conjunct.GetReorder(), (std::vector<size_t>{1, 0}));
+    EXPECT_EQ(keep_all->eval_count_, 9);
+    EXPECT_EQ(drop_most->eval_count_, 9);
+}
+
+TEST(ConjunctExprTest, OrMovesInputDecidingMostRowsFirst) {
+    constexpr size_t kRows = 64;
+    auto none_true = std::make_shared<FixedBitmapExpr>(
+        TargetBitmap(kRows, false), TargetBitmap(kRows, true));
+    auto all_true = std::make_shared<FixedBitmapExpr>(
+        TargetBitmap(kRows, true), TargetBitmap(kRows, true));
+
+    std::vector<ExprPtr> inputs{none_true, all_true};
+    PhyConjunctFilterExpr conjunct(std::move(inputs), false, nullptr);
+
+    QueryContext query_context("conjunct_test", nullptr, kRows, 0);
+    ExecContext exec_context(&query_context);
+    EvalCtx eval_context(&exec_context);
+
+    for (int batch = 0; batch < 10; ++batch) {
+        VectorPtr result;
+        conjunct.Eval(eval_context, result);
+        auto output = std::dynamic_pointer_cast<ColumnVector>(result);
+        ASSERT_NE(output, nullptr);
+        TargetBitmapView data(output->GetRawData(), output->size());
+        ASSERT_EQ(data.count(), kRows) << "batch " << batch;
+    }
+    // once all_true runs first the batch is decided and none_true is skipped
+    EXPECT_EQ(conjunct.GetReorder(), (std::vector<size_t>{1, 0}));
+    EXPECT_EQ(all_true->eval_count_, 10);
+    EXPECT_EQ(none_true->eval_count_, 8);
+    EXPECT_EQ(none_true->move_count_, 2);
+}
+
+TEST(ConjunctExprTest, AndGathersFewActiveRowsThroughOffsets) {
+    constexpr size_t kRows = 64;
+    constexpr int64_t kBegin = 1000;
+    TargetBitmap two_rows(kRows, false);
+    two_rows.set(3);
+    two_rows.set(40);
+    auto selective = std::make_shared<FixedBitmapExpr>(
+        std::move(two_rows), TargetBitmap(kRows, true));
+    auto sparse = std::make_shared<SparseScanExpr>(
+        kBegin, kRows, std::vector<int32_t>{1003, 1010});
+
+    std::vector<ExprPtr> inputs{selective, sparse};
+    PhyConjunctFilterExpr conjunct(std::move(inputs), true, nullptr);
+
+    QueryContext query_context("conjunct_test", nullptr, kRows, 0);
+    ExecContext exec_context(&query_context);
+    EvalCtx eval_context(&exec_context);
+
+    VectorPtr result;
+    conjunct.Eval(eval_context, result);
+    auto output = std::dynamic_pointer_cast<ColumnVector>(result);
+    ASSERT_NE(output, nullptr);
+    ASSERT_EQ(output->size(), kRows);
+    TargetBitmapView data(output->GetRawData(), output->size());
+    TargetBitmapView valid(output->GetValidRawData(), output->size());
+    ASSERT_EQ(data.count(), 1);
+    EXPECT_TRUE(data[3]);
+    EXPECT_EQ(valid.count(), kRows);
+
+    EXPECT_EQ(sparse->full_evals_, 0);
+    EXPECT_EQ(sparse->seen_offsets_, (std::vector<int32_t>{1003, 1040}));
+    EXPECT_EQ(sparse->move_count_, 1);
+    EXPECT_EQ(eval_context.get_offset_input(), nullptr);
+}
+
+TEST(ConjunctExprTest, AndScansWholeBatchWhenManyRowsActive) {
+    constexpr size_t kRows = 64;
+    TargetBitmap half(kRows, false);
+    for (size_t i = 0; i < kRows; i += 2) {
+        half.set(i);
+    }
+    auto selective = std::make_shared<FixedBitmapExpr>(
+        std::move(half), TargetBitmap(kRows, true));
+    auto sparse =
+        std::make_shared<SparseScanExpr>(0, kRows, std::vector<int32_t>{2});
+
+    std::vector<ExprPtr> inputs{selective, sparse};
+    PhyConjunctFilterExpr conjunct(std::move(inputs), true, nullptr);
+
+    QueryContext query_context("conjunct_test", nullptr, kRows, 0);
+    ExecContext exec_context(&query_context);
+    EvalCtx eval_context(&exec_context);
+
+    VectorPtr result;
+    conjunct.Eval(eval_context, result);
+    auto output = std::dynamic_pointer_cast<ColumnVector>(result);
+    ASSERT_NE(output, nullptr);
+    TargetBitmapView data(output->GetRawData(), output->size());
+    ASSERT_EQ(data.count(), 1);
+    EXPECT_TRUE(data[2]);
+    EXPECT_EQ(sparse->full_evals_, 1);
+    EXPECT_TRUE(sparse->seen_offsets_.empty());
+    EXPECT_EQ(sparse->move_count_, 0);
+}
+
 }  // namespace milvus::exec
@@ -526,6 +526,184 @@ class SimdBatchElement : public MultiElement {
     }
 };
 
+// ═══════════════════════════════════════════════════════════════════════════
+// StringBatchElement: batched string IN filter.
+//
+// Every IN value is reduced to a 64-bit fingerprint of its length and its
+// first and last 4 bytes. FilterChunk() fingerprints a block of rows and
+// matches the fingerprints against the IN list with the numeric
+// simdFilterChunk<int64_t>() kernel, or a fingerprint hash table when the
+// list is too long for a linear SIMD scan. Only candidate rows are
+// confirmed with a length check + memcmp, non-matching rows never hash or
+// compare the whole string.
+//
+// Head + tail bytes are used rather than a plain 8-byte prefix because IN
+// lists of ids usually share a prefix ("tenant_0001", "tenant_0002", ...).
+// ═══════════════════════════════════════════════════════════════════════════
+class StringBatchElement : public MultiElement {
+ public:
+    explicit StringBatchElement(
+        const std::vector<proto::plan::GenericValue>& values) {
+        std::vector<std::string> strs;
+        strs.reserve(values.size());
+        for (auto& value : values) {
+            strs.push_back(GetValueWithCastNumber<std::string>(value));
+        }
+        Init(std::move(strs));
+    }
+
+    explicit StringBatchElement(std::vector<std::string> values) {
+        Init(std::move(values));
+    }
+
+    static int64_t
+    Fingerprint(std::string_view s) {
+        uint32_t head = 0;
+        uint32_t tail = 0;
+        const size_t n = s.size();
+        if (n >= 4) {
+            std::memcpy(&head, s.data(), 4);
+            std::memcpy(&tail, s.data() + n - 4, 4);
+        } else if (n > 0) {
+            std::memcpy(&head, s.data(), n);
+        }
+        uint64_t fp = ((static_cast<uint64_t>(tail) << 32) | head) ^
+                      (static_cast<uint64_t>(n) * 0x9E3779B97F4A7C15ULL);
+        return static_cast<int64_t>(fp);
+    }
+
+    bool
+    Empty() const override {
+        return values_.empty();
+    }
+
+    size_t
+    Size() const override {
+        return values_.size();
+    }
+
+    bool
+    In(const ValueType& value) const override {
+        if (auto sv = std::get_if<std::string_view>(&value)) {
+            return Contains(*sv);
+        }
+        if (auto str = std::get_if<std::string>(&value)) {
+            return Contains(*str);
+        }
+        return false;
+    }
+
+    bool
+    Contains(std::string_view s) const {
+        return Confirm(Fingerprint(s), s);
+    }
+
+    // Batch filter for std::string (growing) and std::string_view
+    // (sealed / mmap) chunks. OR's matching bits into res.
+    template <typename S>
+    void
+    FilterChunk(const S* data, const int size, TargetBitmapView res) const {
+        if (values_.empty() || size <= 0) {
+            return;
+        }
+        if (!use_simd_) {
+            for (int i = 0; i < size; ++i) {
+                if (Contains(std::string_view(data[i]))) {
+                    res[i] = true;
+                }
+            }
+            return;
+        }
+
+        constexpr int kBlock = 1024;
+        int64_t fps[kBlock];
+        uint8_t candidates[kBlock / 8];
+        for (int base = 0; base < size; base += kBlock) {
+            const int n = std::min(kBlock, size - base);
+            for (int i = 0; i < n; ++i) {
+                fps[i] = Fingerprint(std::string_view(data[base + i]));
+            }
+            const int bytes = (n + 7) / 8;
+            std::memset(candidates, 0, bytes);
+            simdFilterChunk<int64_t>(fps,
+                                     n,
+                                     candidates,
+                                     sorted_fps_.data(),
+                                     static_cast<int>(sorted_fps_.size()));
+            for (int b = 0; b < bytes; ++b) {
+                uint32_t bits = candidates[b];
+                while (bits != 0) {
+                    const int i = b * 8 + __builtin_ctz(bits);
+                    bits &= bits - 1;
+                    if (Confirm(fps[i], std::string_view(data[base + i]))) {
+                        res[base + i] = true;
+                    }
+                }
+            }
+        }
+    }
+
+    std::vector<std::string>
+    GetElements() const {
+        return values_;
+    }
+
+ private:
+    void
+    Init(std::vector<std::string> values) {
+        std::sort(values.begin(), values.end());
+        values.erase(std::unique(values.begin(), values.end()), values.end());
+        values_ = std::move(values);
+
+        std::vector<std::pair<int64_t, uint32_t>> entries;
+        entries.reserve(values_.size());
+        for (uint32_t i = 0; i < values_.size(); ++i) {
+            entries.emplace_back(Fingerprint(values_[i]), i);
+        }
+        std::sort(entries.begin(), entries.end());
+        by_fp_.reserve(entries.size());
+        for (const auto& [fp, idx] : entries) {
+            if (sorted_fps_.empty() || sorted_fps_.back() != fp) {
+                sorted_fps_.push_back(fp);
+                fp_index_.emplace(fp, static_cast<uint32_t>(by_fp_.size()));
+            }
+            by_fp_.push_back(idx);
+        }
+        // Same crossover rule as the numeric SimdBatchElement.
+        use_simd_ = sorted_fps_.size() <=
+                    static_cast<size_t>(simdLaneCount<int64_t>()) * 8;
+    }
+
+    bool
+    Confirm(int64_t fp, std::string_view s) const {
+        auto it = fp_index_.find(fp);
+        if (it == fp_index_.end()) {
+            return false;
+        }
+        for (size_t i = it->second; i < by_fp_.size(); ++i) {
+            const auto& v = values_[by_fp_[i]];
+            if (Fingerprint(v) != fp) {
+                break;
+            }
+            if (v.size() == s.size() &&
+                std::memcmp(v.data(), s.data(), s.size()) == 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // sorted and deduplicated
+    std::vector<std::string> values_;
+    // distinct fingerprints, sorted (input of simdFilterChunk)
+    std::vector<int64_t> sorted_fps_;
+    // value indexes ordered by fingerprint
+    std::vector<uint32_t> by_fp_;
+    // fingerprint -> first position in by_fp_
+    ankerl::unordered_dense::map<int64_t, uint32_t> fp_index_;
+    bool use_simd_{false};
+};
+
 // ═══════════════════════════════════════════════════════════════════════════
 // GetElementValues: extract typed element vector from any MultiElement.
 // Used by skip index to get IN values regardless of element type.
@@ -542,6 +720,11 @@ GetElementValues(const std::shared_ptr<MultiElement>& ptr) {
             return p->GetElements();
         }
     }
+    if constexpr (std::is_same_v<T, std::string>) {
+        if (auto p = std::dynamic_pointer_cast<StringBatchElement>(ptr)) {
+            return p->GetElements();
+        }
+    }
     if (auto p = std::dynamic_pointer_cast<SortVectorElement<T>>(ptr)) {
         return p->GetElements();
     }
@@ -405,6 +405,25 @@ TEST(FilterChunkTest, NonZeroOffset_Double) {
     }
 }
 
+// Every dispatch tier must give the same result; tiers above the CPU's are
+// clamped.
+TEST(FilterChunkTest, SimdLevelOverride) {
+    auto detected = detectSimdFilterLevel();
+    std::vector<int32_t> in_vals = {-7, 0, 3, 42, 1000};
+    std::vector<int32_t> data(1000);
+    std::iota(data.begin(), data.end(), -500);
+    for (auto level : {SimdFilterLevel::kBaseline,
+                       SimdFilterLevel::kAvx2,
+                       SimdFilterLevel::kAvx512}) {
+        setSimdFilterLevel(level);
+        EXPECT_LE(static_cast<int>(simdFilterLevel()),
+                  static_cast<int>(detected));
+        VerifyFilterChunk(in_vals, data, "level");
+    }
+    setSimdFilterLevel(detected);
+    EXPECT_EQ(simdFilterLevel(), detected);
+}
+
 // ═══════════════════════════════════════════════════════════════════════════
 // toBitMask tests — verify the SimdUtil.h bitmask extraction
 //
@@ -640,6 +659,115 @@ TEST(GetElementValuesTest, UnknownTypeReturnsEmpty) {
     EXPECT_TRUE(result.empty());
 }
 
+TEST(GetElementValuesTest, FromStringBatch) {
+    auto elem = std::make_shared<StringBatchElement>(
+        std::vector<std::string>{"y", "x", "y"});
+    auto result = GetElementValues<std::string>(
+        std::static_pointer_cast<MultiElement>(elem));
+    EXPECT_EQ(result, (std::vector<std::string>{"x", "y"}));
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// StringBatchElement tests
+// ═══════════════════════════════════════════════════════════════════════════
+
+namespace {
+
+std::vector<std::string>
+MakeTenantIds(int n, int start = 0) {
+    std::vector<std::string> ids;
+    for (int i = start; i < start + n; ++i) {
+        ids.push_back("tenant_" + std::to_string(100000 + i));
+    }
+    return ids;
+}
+
+// FilterChunk must agree with SetElement<std::string> row by row.
+template <typename S>
+void
+VerifyStringFilterChunk(const std::vector<std::string>& in_vals,
+                        const std::vector<S>& data,
+                        int offset = 0) {
+    StringBatchElement sb(in_vals);
+    SetElement<std::string> se(in_vals);
+    int n = static_cast<int>(data.size());
+    milvus::TargetBitmap bitmap(n + offset, false);
+    milvus::TargetBitmapView view(bitmap.data(), offset, n);
+    sb.FilterChunk(data.data(), n, view);
+    for (int i = 0; i < offset; ++i) {
+        EXPECT_FALSE(bitmap[i]) << "bit before offset set at " << i;
+    }
+    for (int i = 0; i < n; ++i) {
+        EXPECT_EQ(bool(bitmap[i + offset]),
+                  se.In(MakeVT(std::string_view(data[i]))))
+            << "mismatch at " << i << " data=" << data[i];
+    }
+}
+
+}  // namespace
+
+TEST(StringBatchElementTest, Basic) {
+    StringBatchElement sb(
+        std::vector<std::string>{"hello", "world", "test", "a", ""});
+    EXPECT_EQ(sb.Size(), 5);
+    EXPECT_TRUE(sb.In(MakeVT(std::string("hello"))));
+    EXPECT_TRUE(sb.In(MakeVT(std::string_view("world"))));
+    EXPECT_TRUE(sb.In(MakeVT(std::string("a"))));
+    EXPECT_TRUE(sb.In(MakeVT(std::string(""))));
+    EXPECT_FALSE(sb.In(MakeVT(std::string("Hello"))));
+    EXPECT_FALSE(sb.In(MakeVT(std::string("ab"))));
+    EXPECT_FALSE(sb.In(MakeVT(int64_t(1))));
+}
+
+TEST(StringBatchElementTest, Empty) {
+    StringBatchElement sb(std::vector<std::string>{});
+    EXPECT_TRUE(sb.Empty());
+    EXPECT_FALSE(sb.Contains(""));
+    std::vector<std::string> data = {"", "x"};
+    VerifyStringFilterChunk({}, data);
+}
+
+// Same head, tail and length: fingerprints collide, memcmp decides.
+TEST(StringBatchElementTest, FingerprintCollision) {
+    std::string a = "tenant_0_middle_A_0001";
+    std::string b = "tenant_0_middle_B_0001";
+    ASSERT_EQ(StringBatchElement::Fingerprint(a),
+              StringBatchElement::Fingerprint(b));
+    StringBatchElement sb(std::vector<std::string>{a, b});
+    EXPECT_TRUE(sb.Contains(a));
+    EXPECT_TRUE(sb.Contains(b));
+    EXPECT_FALSE(sb.Contains("tenant_0_middle_C_0001"));
+}
+
+TEST(StringBatchElementTest, SharedPrefixSmallList) {
+    auto in_vals = MakeTenantIds(50);
+    std::vector<std::string> data = MakeTenantIds(3000, -1000);
+    data.push_back("");
+    data.push_back("ten");
+    VerifyStringFilterChunk(in_vals, data);
+}
+
+TEST(StringBatchElementTest, SharedPrefixLargeList) {
+    auto in_vals = MakeTenantIds(500);
+    auto data = MakeTenantIds(3000, -1000);
+    VerifyStringFilterChunk(in_vals, data);
+}
+
+TEST(StringBatchElementTest, StringViewData) {
+    auto in_vals = MakeTenantIds(100);
+    auto owned = MakeTenantIds(2500, -500);
+    std::vector<std::string_view> data(owned.begin(), owned.end());
+    VerifyStringFilterChunk(in_vals, data);
+}
+
+TEST(StringBatchElementTest, NonZeroOffset) {
+    auto in_vals = MakeTenantIds(64);
+    auto data = MakeTenantIds(300, -100);
+    for (int off : {1, 3, 7, 8, 13}) {
+        VerifyStringFilterChunk(in_vals, data, off);
+    }
+}
+
 // ═══════════════════════════════════════════════════════════════════════════
 // Cross-validation: new element types must agree with SetElement
 // ═══════════════════════════════════════════════════════════════════════════
@@ -82,7 +82,9 @@ EntryPool::Put(int64_t segment_id,
                int64_t active_count,
                const TargetBitmap& result,
                const TargetBitmap& valid,
-               int64_t eval_duration_us) {
+               int64_t eval_duration_us,
+               bool disk_eligible,
+               std::vector<EvictedEntry>* evicted) {
     uint64_t sig_hash = XXH64(signature.data(), signature.size(), 0);
     Key key{segment_id, sig_hash, signature, active_count};
 
@@ -129,7 +131,7 @@ EntryPool::Put(int64_t segment_id,
         if (entries_.empty()) {
             break;
         }
-        EvictOne();
+        EvictOne(evicted);
     }
 
     // Insert
@@ -140,6 +142,7 @@ EntryPool::Put(int64_t segment_id,
     entry->comp_type = comp_type;
     entry->data = std::move(compressed_data);
     entry->usage_count.store(1, std::memory_order_relaxed);
+    entry->disk_eligible = disk_eligible;
 
     current_bytes_.fetch_add(entry->MemoryUsage(), std::memory_order_relaxed);
     entries_[key] = std::move(entry);
@@ -194,7 +197,26 @@ EntryPool::Clear() {
 }
 
 void
-EntryPool::EvictOne() {
+EntryPool::EraseAtClockHand(
+    std::unordered_map<Key, std::unique_ptr<Entry>, KeyHasher>::iterator it,
+    std::vector<EvictedEntry>* evicted) {
+    auto& entry = *it->second;
+    current_bytes_.fetch_sub(entry.MemoryUsage(), std::memory_order_relaxed);
+    if (evicted != nullptr && entry.disk_eligible) {
+        evicted->push_back(EvictedEntry{it->first.segment_id,
+                                        std::move(entry.signature),
+                                        entry.active_count,
+                                        entry.comp_type,
+                                        std::move(entry.data)});
+    }
+    // Remove from clock_keys_ (swap with last for O(1))
+    clock_keys_[clock_hand_] = clock_keys_.back();
+    clock_keys_.pop_back();
+    entries_.erase(it);
+}
+
+void
+EntryPool::EvictOne(std::vector<EvictedEntry>* evicted) {
     // Must be called under unique_lock
     if (entries_.empty()) {
         return;
@@ -232,16 +254,10 @@ EntryPool::EvictOne() {
             clock_hand_++;
         } else {
             // usage_count == 0: evict this entry
-            current_bytes_.fetch_sub(entry.MemoryUsage(),
-                                     std::memory_order_relaxed);
             LOG_DEBUG("EntryPool::EvictOne segment_id={}, sig_hash={}",
                       key.segment_id,
                       key.sig_hash);
-
-            // Remove from clock_keys_ (swap with last for O(1))
-            clock_keys_[clock_hand_] = clock_keys_.back();
-            clock_keys_.pop_back();
-            entries_.erase(it);
+            EraseAtClockHand(it, evicted);
             // Don't increment clock_hand_ — the swapped-in key is now here
             return;
         }
@@ -256,11 +272,7 @@ EntryPool::EvictOne() {
         const auto& key = clock_keys_[clock_hand_];
         auto it = entries_.find(key);
         if (it != entries_.end()) {
-            current_bytes_.fetch_sub(it->second->MemoryUsage(),
-                                     std::memory_order_relaxed);
-            clock_keys_[clock_hand_] = clock_keys_.back();
-            clock_keys_.pop_back();
-            entries_.erase(it);
+            EraseAtClockHand(it, evicted);
         }
     }
 }
@@ -80,6 +80,7 @@ class EntryPool {
         uint8_t comp_type{0};
         std::vector<char> data;  // compressed payload (header + body)
         std::atomic<uint8_t> usage_count{0};  // Clock: 0-5, accessed → ++
+        bool disk_eligible{false};  // may be demoted to disk on eviction
 
         size_t
         MemoryUsage() const {
@@ -88,6 +89,8 @@ class EntryPool {
         }
     };
 
+    using EvictedEntry = EvictedCacheEntry;
+
     explicit EntryPool(size_t max_bytes) : max_bytes_(max_bytes) {
     }
 
@@ -114,13 +117,17 @@ class EntryPool {
     // Insert a compressed entry. Compression is done internally.
     // May trigger Clock eviction if over capacity.
     // Subject to frequency and latency admission control.
+    // When `evicted` is set, evicted entries marked `disk_eligible` are
+    // moved into it instead of being dropped.
     void
     Put(int64_t segment_id,
         const std::string& signature,
         int64_t active_count,
         const TargetBitmap& result,
         const TargetBitmap& valid,
-        int64_t eval_duration_us = 0);
+        int64_t eval_duration_us = 0,
+        bool disk_eligible = false,
+        std::vector<EvictedEntry>* evicted = nullptr);
 
     // Erase all entries belonging to a segment. Returns number erased.
     size_t
@@ -149,7 +156,14 @@ class EntryPool {
     // Entries with usage_count > 0 get decremented (one "chance" per sweep).
     // Must be called under unique_lock.
     void
-    EvictOne();
+    EvictOne(std::vector<EvictedEntry>* evicted = nullptr);
+
+    // Remove the entry at clock_hand_ from the clock and the index.
+    // Must be called under unique_lock.
+    void
+    EraseAtClockHand(
+        std::unordered_map<Key, std::unique_ptr<Entry>, KeyHasher>::iterator it,
+        std::vector<EvictedEntry>* evicted);
 
     size_t max_bytes_;
     std::atomic<size_t> current_bytes_{0};
@@ -149,13 +149,12 @@ PhyExistsFilterExpr::EvalJsonExistsForDataSegment(EvalCtx& context) {
     if (real_batch_size == 0) {
         return nullptr;
     }
-    auto res_vec =
-        std::make_shared<ColumnVector>(TargetBitmap(real_batch_size, false),
-                                       TargetBitmap(real_batch_size, true));
+    auto res_vec = NewBitmapColumn(real_batch_size);
     TargetBitmapView res(res_vec->GetRawData(), real_batch_size);
     TargetBitmapView valid_res(res_vec->GetValidRawData(), real_batch_size);
 
-    auto pointer = milvus::Json::pointer(expr_->column_.nested_path_);
+    milvus::JsonPointer pointer(
+        milvus::Json::pointer(expr_->column_.nested_path_));
     int processed_cursor = 0;
     auto execute_sub_batch =
         [&bitmap_input, &
@@ -166,7 +165,7 @@ PhyExistsFilterExpr::EvalJsonExistsForDataSegment(EvalCtx& context) {
             const int size,
             TargetBitmapView res,
             TargetBitmapView valid_res,
-            const std::string& pointer) {
+            const milvus::JsonPointer& pointer) {
         // If data is nullptr, this chunk was skipped by SkipIndex.
         // We only need to update processed_cursor for bitmap_input indexing.
         if (data == nullptr) {
@@ -23,8 +23,10 @@
 
 #include "common/Common.h"
 #include "common/EasyAssert.h"
+#include "common/Tracepoint.h"
 #include "common/Tracer.h"
 #include "exec/expression/AlwaysTrueExpr.h"
+#include "exec/expression/EntityTTLFilterExpr.h"
 #include "exec/expression/BinaryArithOpEvalRangeExpr.h"
 #include "exec/expression/BinaryRangeExpr.h"
 #include "exec/expression/CallExpr.h"
@@ -37,6 +39,7 @@
 #include "exec/expression/LogicalBinaryExpr.h"
 #include "exec/expression/LogicalUnaryExpr.h"
 #include "exec/expression/MatchExpr.h"
+#include "exec/expression/MultiLikeExpr.h"
 #include "exec/expression/NullExpr.h"
 #include "exec/expression/TermExpr.h"
 #include "exec/expression/TimestamptzArithCompareExpr.h"
@@ -52,7 +55,99 @@
 namespace milvus {
 namespace exec {
 
+std::optional<index::ScalarIndexType>
+SegmentExpr::PinnedScalarIndexType() const {
+    if (pinned_index_.empty()) {
+        return std::nullopt;
+    }
+    auto* index_ptr = pinned_index_[0].get();
+    auto type_of =
+        [index_ptr](auto tag) -> std::optional<index::ScalarIndexType> {
+        using T = decltype(tag);
+        auto scalar_index =
+            dynamic_cast<const index::ScalarIndex<T>*>(index_ptr);
+        if (scalar_index == nullptr) {
+            return std::nullopt;
+        }
+        return scalar_index->GetIndexType();
+    };
+    switch (field_type_) {
+        case DataType::INT8:
+            return type_of(int8_t{});
+        case DataType::INT16:
+            return type_of(int16_t{});
+        case DataType::INT32:
+            return type_of(int32_t{});
+        case DataType::INT64:
+        case DataType::TIMESTAMPTZ:
+            return type_of(int64_t{});
+        case DataType::FLOAT:
+            return type_of(float{});
+        case DataType::DOUBLE:
+            return type_of(double{});
+        case DataType::VARCHAR:
+        case DataType::STRING:
+        case DataType::TEXT:
+            return type_of(std::string{});
+        default:
+            return std::nullopt;
+    }
+}
+
+void
+SegmentExpr::PreferRawScanForWideRange(const RangeBound& lower,
+                                       const RangeBound& upper) {
+    if (exec_path_ != ExprExecPath::ScalarIndex ||
+        segment_->type() != SegmentType::Sealed ||
+        !segment_->HasFieldData(field_id_) || !nested_path_.empty()) {
+        return;
+    }
+    auto index_type = PinnedScalarIndexType();
+    auto threshold = EXEC_RAW_SCAN_SELECTIVITY_THRESHOLD.load();
+    // decide on the index type first, the zone maps are built lazily
+    if (!index_type.has_value() ||
+        !PreferRawScanOverIndex(index_type.value(), 1.0, threshold)) {
+        return;
+    }
+
+    auto& skip_index = segment_->GetSkipIndex();
+    double matched_rows = 0;
+    int64_t total_rows = 0;
+    for (int64_t i = 0; i < num_data_chunk_; ++i) {
+        auto min_max = skip_index.GetChunkMinMax(op_ctx_, field_id_, i);
+        if (!min_max.has_value()) {
+            return;
+        }
+        auto fraction = EstimateChunkRangeFraction(
+            min_max->first, min_max->second, lower, upper);
+        if (!fraction.has_value()) {
+            return;
+        }
+        auto rows = segment_->chunk_size(field_id_, i);
+        matched_rows += fraction.value() * rows;
+        total_rows += rows;
+    }
+    if (total_rows == 0) {
+        return;
+    }
+    auto selectivity = matched_rows / total_rows;
+    if (PreferRawScanOverIndex(index_type.value(), selectivity, threshold)) {
+        LOG_DEBUG(
+            "expr {} scans raw data of field {} instead of {} index, "
+            "estimated selectivity: {}",
+            name_,
+            field_id_.get(),
+            index::ToString(index_type.value()),
+            selectivity);
+        exec_path_ = ExprExecPath::RawData;
+    }
+}
+
 SegmentExpr::~SegmentExpr() {
+    // the readahead uses op_ctx_, which may go away with this expression
+    if (prefetch_future_.valid()) {
+        prefetch_future_.wait();
+    }
     // record accumulated json filter latencies as segment-level metrics.
     // latencies are accumulated in microseconds and converted to milliseconds for Observe.
     // this avoids per-batch metric overhead and provides more meaningful
@@ -89,7 +184,9 @@ ExprSet::Eval(int32_t begin,
         exec_ctx != nullptr ? exec_ctx->get_query_context() : nullptr;
     for (size_t i = begin; i < end; ++i) {
         milvus::exec::checkCancellation(query_ctx);
+        MILVUS_TRACEPOINT(expr_eval_start, exprs_[i].get());
         exprs_[i]->Eval(context, results[i]);
+        MILVUS_TRACEPOINT(expr_eval_end, exprs_[i].get());
     }
 }
 
@@ -118,6 +215,14 @@ CreateTTLFieldFilterExpression(QueryContext* query_context) {
                                      {},
                                      ttl_field_meta.is_nullable());
 
+    // a sealed segment keeps its rows ordered by expiry, the alive rows are
+    // a bitmap from there rather than a scan of the ttl column
+    if (segment->EntityTTLAliveRows(query_context->get_op_context(),
+                                    physical_us) != nullptr) {
+        return std::make_shared<expr::EntityTTLFilterExpr>(ttl_column_info,
+                                                           physical_us);
+    }
+
     auto ttl_is_null_expr = std::make_shared<expr::NullExpr>(
         ttl_column_info, proto::plan::NullExpr_NullOp_IsNull);
 
@@ -306,11 +411,14 @@ CompileExpression(const expr::TypedExprPtr& expr,
                 milvus::expr::LogicalBinaryExpr::OpType::And ||
             casted_expr->op_type_ ==
                 milvus::expr::LogicalBinaryExpr::OpType::Or) {
+            bool is_and = casted_expr->op_type_ ==
+                          milvus::expr::LogicalBinaryExpr::OpType::And;
+            if (!is_and && OPTIMIZE_EXPR_ENABLED.load()) {
+                compiled_inputs =
+                    FuseLikeDisjuncts(std::move(compiled_inputs), context);
+            }
             result = std::make_shared<PhyConjunctFilterExpr>(
-                std::move(compiled_inputs),
-                casted_expr->op_type_ ==
-                    milvus::expr::LogicalBinaryExpr::OpType::And,
-                op_ctx);
+                std::move(compiled_inputs), is_and, op_ctx);
         } else {
             result = std::make_shared<PhyLogicalBinaryExpr>(
                 compiled_inputs, casted_expr, "PhyLogicalBinaryExpr", op_ctx);
@@ -338,27 +446,51 @@ CompileExpression(const expr::TypedExprPtr& expr,
             context->get_active_count(),
             context->query_config()->get_expr_batch_size());
     } else if (auto casted_expr = std::dynamic_pointer_cast<
-                   const milvus::expr::BinaryArithOpEvalRangeExpr>(expr)) {
-        result = std::make_shared<PhyBinaryArithOpEvalRangeExpr>(
+                   const milvus::expr::EntityTTLFilterExpr>(expr)) {
+        result = std::make_shared<PhyEntityTTLFilterExpr>(
             compiled_inputs,
             casted_expr,
-            "PhyBinaryArithOpEvalRangeExpr",
+            "PhyEntityTTLFilterExpr",
             op_ctx,
             context->get_segment(),
             context->get_active_count(),
-            context->query_config()->get_expr_batch_size(),
-            context->get_consistency_level());
+            context->query_config()->get_expr_batch_size());
     } else if (auto casted_expr = std::dynamic_pointer_cast<
-                   const milvus::expr::TimestamptzArithCompareExpr>(expr)) {
-        result = std::make_shared<PhyTimestamptzArithCompareExpr>(
+                   const milvus::expr::BinaryArithOpEvalRangeExpr>(expr)) {
+        result = std::make_shared<PhyBinaryArithOpEvalRangeExpr>(
             compiled_inputs,
             casted_expr,
-            "PhyTimestamptzArithCompareExpr",
+            "PhyBinaryArithOpEvalRangeExpr",
             op_ctx,
             context->get_segment(),
             context->get_active_count(),
             context->query_config()->get_expr_batch_size(),
             context->get_consistency_level());
+    } else if (auto casted_expr = std::dynamic_pointer_cast<
+                   const milvus::expr::TimestamptzArithCompareExpr>(expr)) {
+        if (auto folded = FoldTimestamptzArithCompare(casted_expr)) {
+            result = std::make_shared<PhyUnaryRangeFilterExpr>(
+                compiled_inputs,
+                folded,
+                "PhyUnaryRangeFilterExpr",
+                op_ctx,
+                context->get_segment(),
+                context->get_active_count(),
+                context->query_config()->get_expr_batch_size(),
+                context->get_consistency_level(),
+                plan_options,
+                context->get_enable_sub_expr_cache_write());
+        } else {
+            result = std::make_shared<PhyTimestamptzArithCompareExpr>(
+                compiled_inputs,
+                casted_expr,
+                "PhyTimestamptzArithCompareExpr",
+                op_ctx,
+                context->get_segment(),
+                context->get_active_count(),
+                context->query_config()->get_expr_batch_size(),
+                context->get_consistency_level());
+        }
     } else if (auto casted_expr =
                    std::dynamic_pointer_cast<const milvus::expr::CompareExpr>(
                        expr)) {
@@ -475,6 +607,9 @@ IsLikeExpr(std::shared_ptr<Expr> input) {
                 return false;
         }
     }
+    if (input->name() == "PhyMultiLikeFilterExpr") {
+        return true;
+    }
     // Also check NOT(like/regex) — e.g. !~ expands to NOT(RegexMatch)
     if (input->name() == "PhyUnaryExpr") {
         auto& children = input->GetInputsRef();
@@ -19,18 +19,23 @@
 #include <algorithm>
 #include <bit>
 #include <chrono>
+#include <cmath>
+#include <future>
 #include <memory>
+#include <optional>
 #include <string>
 #include <type_traits>
 
 #include "common/Array.h"
 #include "common/ArrayOffsets.h"
+#include "common/Common.h"
 #include "common/FieldDataInterface.h"
 #include "common/Json.h"
 #include "common/OpContext.h"
 #include "common/Types.h"
 #include "exec/expression/EvalCtx.h"
 #include "exec/expression/ExprCacheHelper.h"
+#include "exec/expression/ScanCostModel.h"
 #include "exec/expression/Utils.h"
 #include "exec/QueryContext.h"
 #include "expr/ITypeExpr.h"
@@ -54,6 +59,7 @@ enum class ExprExecPath {
     PkIndex,      // segment_->pk_range / search_ids
     TextIndex,    // segment_->GetTextIndex
     JsonStats,    // segment_->GetJsonStats
+    SortedData,   // binary search over segment_->IsFieldSorted raw data
 };
 
 inline std::vector<PinWrapper<const index::IndexBase*>>
@@ -183,6 +189,24 @@ class Expr {
         }
     }
 
+    // check if independent copies of this expression can evaluate disjoint
+    // row ranges of the segment concurrently, see PhyFilterBitsNode. Only
+    // batch-by-batch scans qualify: paths that compute the whole segment
+    // result up front would redo that work in every copy.
+    virtual bool
+    SupportsMorselEval() const {
+        return false;
+    }
+
+    // Segment offset the next batch of this expression starts at, when it can
+    // evaluate just a few rows of that batch through the offset input and
+    // then skip the batch with MoveCursor(), see PhyConjunctFilterExpr.
+    // nullopt when evaluating a subset costs as much as the whole batch.
+    virtual std::optional<int64_t>
+    SparseBatchBegin() const {
+        return std::nullopt;
+    }
+
     virtual bool
     IsSource() const {
         return false;
@@ -402,6 +426,33 @@ class SegmentExpr : public Expr {
         }
     }
 
+    // Range predicates on a scalar index call this before ProcessIndexChunks
+    // so that a cache miss can be patched from an overlapping cached range
+    // of the same column, see ExprCacheHelper::GetOrComputeRange.
+    template <typename V>
+    void
+    SetRangeCacheQuery(const std::optional<V>& lower,
+                       bool lower_inclusive,
+                       const std::optional<V>& upper,
+                       bool upper_inclusive) {
+        if (range_cache_query_.has_value() || !nested_path_.empty()) {
+            return;
+        }
+        CachedRange range;
+        range.signature = this->ToString();
+        if (lower.has_value()) {
+            range.lower = ExprCacheHelper::ToRangeBound(*lower);
+        }
+        range.lower_inclusive = lower_inclusive;
+        if (upper.has_value()) {
+            range.upper = ExprCacheHelper::ToRangeBound(*upper);
+        }
+        range.upper_inclusive = upper_inclusive;
+        range_cache_family_ =
+            fmt::format("range:{}:{}", field_id_.get(), field_type_);
+        range_cache_query_ = std::move(range);
+    }
+
     void
     ApplyValidData(const bool* valid_data,
                    TargetBitmapView res,
@@ -456,6 +507,7 @@ class SegmentExpr : public Expr {
         v.valid_result = cached_index_chunk_valid_res_;
         v.active_count = active_count_;
         v.eval_duration_us = eval_duration_us;
+        v.disk_eligible = segment_->type() == SegmentType::Sealed;
         ExprResCacheManager::Instance().Put(key, v);
     }
 
@@ -1080,6 +1132,51 @@ class SegmentExpr : public Expr {
         }
     }
 
+    // Prefetch data chunks to reduce cache miss latency in tiered storage.
+    // Without a scan prefetch window every remaining chunk is pinned once,
+    // up front. With one, the scan, which moves forward chunk by chunk,
+    // keeps the next SCAN_PREFETCH_WINDOW chunks loading in the background
+    // while it evaluates the current one: a new range is issued once the
+    // previous one is resident and the scan has moved past its start.
+    void
+    PrefetchDataChunks() {
+        auto window = SCAN_PREFETCH_WINDOW.load();
+        if (window <= 0) {
+            if (!prefetched_) {
+                std::vector<int64_t> pf_chunk_ids;
+                pf_chunk_ids.reserve(num_data_chunk_ - current_data_chunk_);
+                for (size_t i = current_data_chunk_; i < num_data_chunk_;
+                     i++) {
+                    pf_chunk_ids.push_back(i);
+                }
+                segment_->prefetch_chunks(op_ctx_, field_id_, pf_chunk_ids);
+                prefetched_ = true;
+            }
+            return;
+        }
+        auto begin = std::max(prefetched_until_, current_data_chunk_ + 1);
+        auto end = std::min(num_data_chunk_, current_data_chunk_ + 1 + window);
+        if (begin >= end) {
+            return;
+        }
+        if (prefetch_future_.valid()) {
+            if (prefetch_future_.wait_for(std::chrono::seconds(0)) !=
+                std::future_status::ready) {
+                return;
+            }
+            // load errors resurface when the scan pins the chunk itself
+            prefetch_future_ = {};
+        }
+        std::vector<int64_t> pf_chunk_ids;
+        pf_chunk_ids.reserve(end - begin);
+        for (auto i = begin; i < end; i++) {
+            pf_chunk_ids.push_back(i);
+        }
+        prefetch_future_ =
+            segment_->prefetch_chunks_async(op_ctx_, field_id_, pf_chunk_ids);
+        prefetched_until_ = end;
+    }
+
     // Process element-level data without offset input
     // This is the counterpart of ProcessDataChunks for element-level expressions
     // Iterates over rows in batch, but returns element-level results
@@ -1099,16 +1196,7 @@ class SegmentExpr : public Expr {
         int64_t processed_rows = 0;
         int64_t processed_elems = 0;
 
-        // Prefetch chunks to reduce cache miss latency
-        if (!prefetched_) {
-            std::vector<int64_t> pf_chunk_ids;
-            pf_chunk_ids.reserve(num_data_chunk_ - current_data_chunk_);
-            for (size_t i = current_data_chunk_; i < num_data_chunk_; i++) {
-                pf_chunk_ids.push_back(i);
-            }
-            segment_->prefetch_chunks(op_ctx_, field_id_, pf_chunk_ids);
-            prefetched_ = true;
-        }
+        PrefetchDataChunks();
 
         for (size_t i = current_data_chunk_; i < num_data_chunk_; i++) {
             auto data_pos =
@@ -1467,8 +1555,106 @@ class SegmentExpr : public Expr {
         return processed_size;
     }
 
+    // Evaluates `func` once over the dictionary of `chunk` and gives rows
+    // [data_pos, data_pos + size) the result of their value. Null rows end
+    // up false and invalid, like in the row by row kernels.
+    template <typename FUNC, typename... ValTypes>
+    void
+    ProcessDictionaryChunk(FUNC& func,
+                           const StringChunk* chunk,
+                           int64_t data_pos,
+                           int64_t size,
+                           TargetBitmapView res,
+                           TargetBitmapView valid_res,
+                           const ValTypes&... values) {
+        auto dict_size = chunk->DictSize();
+        std::vector<std::string_view> dict;
+        dict.reserve(dict_size);
+        for (uint32_t code = 0; code < dict_size; ++code) {
+            dict.push_back(chunk->DictValue(code));
+        }
+        TargetBitmap dict_res(dict_size, false);
+        TargetBitmap dict_valid(dict_size, true);
+        func(dict.data(),
+             nullptr,
+             nullptr,
+             dict_size,
+             TargetBitmapView(dict_res),
+             TargetBitmapView(dict_valid),
+             values...);
+        std::vector<int8_t> lut(dict_size);
+        for (uint32_t code = 0; code < dict_size; ++code) {
+            lut[code] = dict_res[code];
+        }
+
+        // gather the row results into bytes, then pack them into res
+        std::vector<int8_t> hits(size);
+        if (chunk->CodeBytes() == 1) {
+            auto codes = static_cast<const uint8_t*>(chunk->Codes()) + data_pos;
+            for (int64_t j = 0; j < size; ++j) {
+                hits[j] = lut[codes[j]];
+            }
+        } else {
+            auto codes =
+                static_cast<const uint16_t*>(chunk->Codes()) + data_pos;
+            for (int64_t j = 0; j < size; ++j) {
+                hits[j] = lut[codes[j]];
+            }
+        }
+        res.inplace_compare_val<int8_t, milvus::bitset::CompareOpType::NE>(
+            hits.data(), size, 0);
+
+        if (chunk->IsNullable()) {
+            for (int64_t j = 0; j < size; ++j) {
+                if (!chunk->isValid(data_pos + j)) {
+                    res[j] = valid_res[j] = false;
+                }
+            }
+        }
+    }
+
+    // Evaluates `func` on the first row of the constant chunk `chunk_id` and
+    // gives its result to all the `size` rows of the batch.
+    template <typename T, typename FUNC, typename... ValTypes>
+    void
+    ProcessConstantChunk(FUNC& func,
+                         int64_t chunk_id,
+                         int64_t size,
+                         TargetBitmapView res,
+                         TargetBitmapView valid_res,
+                         const ValTypes&... values) {
+        TargetBitmap row_res(1, false);
+        TargetBitmap row_valid(1, true);
+        auto eval = [&](const T* data, const bool* valid_data) {
+            func(data,
+                 valid_data,
+                 nullptr,
+                 1,
+                 TargetBitmapView(row_res),
+                 TargetBitmapView(row_valid),
+                 values...);
+        };
+        if constexpr (std::is_same_v<T, std::string_view> ||
+                      std::is_same_v<T, Json> ||
+                      std::is_same_v<T, ArrayView>) {
+            auto pw = segment_->get_batch_views<T>(
+                op_ctx_, field_id_, chunk_id, 0, 1);
+            const auto& [data_vec, valid_data] = pw.get();
+            eval(data_vec.data(), valid_data.data());
+        } else {
+            auto pw = segment_->chunk_data<T>(op_ctx_, field_id_, chunk_id);
+            auto chunk = pw.get();
+            eval(chunk.data(), chunk.valid_data());
+        }
+        res.set(0, size, row_res[0]);
+        valid_res.set(0, size, row_valid[0]);
+    }
+
+    // With `StatelessFunc`, `func` evaluates every row on its own, so a
+    // chunk may be evaluated through its dictionary or its first row only.
     template <typename T,
               bool NeedSegmentOffsets = false,
+              bool StatelessFunc = false,
               typename FUNC,
               typename... ValTypes>
     int64_t
@@ -1480,16 +1666,7 @@ class SegmentExpr : public Expr {
         const ValTypes&... values) {
         int64_t processed_size = 0;
 
-        // prefetch chunks to reduce cache miss latency
-        if (!prefetched_) {
-            std::vector<int64_t> pf_chunk_ids;
-            pf_chunk_ids.reserve(num_data_chunk_ - current_data_chunk_);
-            for (size_t i = current_data_chunk_; i < num_data_chunk_; i++) {
-                pf_chunk_ids.push_back(i);
-            }
-            segment_->prefetch_chunks(op_ctx_, field_id_, pf_chunk_ids);
-            prefetched_ = true;
-        }
+        PrefetchDataChunks();
 
         for (size_t i = current_data_chunk_; i < num_data_chunk_; i++) {
             auto data_pos =
@@ -1511,11 +1688,43 @@ class SegmentExpr : public Expr {
             auto& skip_index = segment_->GetSkipIndex();
             if (!skip_func || !skip_func(skip_index, field_id_, i)) {
                 bool is_seal = false;
+                if constexpr (StatelessFunc &&
+                              !std::is_same_v<T, VectorArrayView>) {
+                    // a default value field holds the same row all along
+                    auto constant_pw =
+                        segment_->constant_chunk(op_ctx_, field_id_, i);
+                    if (constant_pw.get() != nullptr) {
+                        ProcessConstantChunk<T>(func,
+                                                i,
+                                                size,
+                                                res + processed_size,
+                                                valid_res + processed_size,
+                                                values...);
+                        is_seal = true;
+                    }
+                }
                 if constexpr (std::is_same_v<T, std::string_view> ||
                               std::is_same_v<T, Json> ||
                               std::is_same_v<T, ArrayView> ||
                               std::is_same_v<T, VectorArrayView>) {
-                    if (segment_->type() == SegmentType::Sealed) {
+                    if constexpr (StatelessFunc &&
+                                  std::is_same_v<T, std::string_view>) {
+                        auto dict_pw =
+                            is_seal ? PinWrapper<const StringChunk*>(nullptr)
+                                    : segment_->dict_string_chunk(
+                                          op_ctx_, field_id_, i);
+                        if (auto chunk = dict_pw.get()) {
+                            ProcessDictionaryChunk(func,
+                                                   chunk,
+                                                   data_pos,
+                                                   size,
+                                                   res + processed_size,
+                                                   valid_res + processed_size,
+                                                   values...);
+                            is_seal = true;
+                        }
+                    }
+                    if (!is_seal && segment_->type() == SegmentType::Sealed) {
                         // first is the raw data, second is valid_data
                         // use valid_data to see if raw data is null
                         auto pw = segment_->get_batch_views<T>(
@@ -1549,16 +1758,7 @@ class SegmentExpr : public Expr {
                                "VectorArrayView must be read through chunk "
                                "views");
                 } else {
-                    if (!is_seal) {
-                        auto pw =
-                            segment_->chunk_data<T>(op_ctx_, field_id_, i);
-                        auto chunk = pw.get();
-                        const T* data = chunk.data() + data_pos;
-                        const bool* valid_data = chunk.valid_data();
-                        if (valid_data != nullptr) {
-                            valid_data += data_pos;
-                        }
-
+                    auto eval = [&](const T* data, const bool* valid_data) {
                         if constexpr (NeedSegmentOffsets) {
                             // For GIS functions: construct segment offsets array
                             func(data,
@@ -1578,6 +1778,35 @@ class SegmentExpr : public Expr {
                                  valid_res + processed_size,
                                  values...);
                         }
+                    };
+                    if constexpr (IsPackableInt<T>) {
+                        // decode only the rows of this batch
+                        using PackedPin = PinWrapper<const FixedWidthChunk*>;
+                        auto packed_pw =
+                            is_seal ? PackedPin(nullptr)
+                                    : segment_->packed_int_chunk(
+                                          op_ctx_, field_id_, i);
+                        if (auto chunk = packed_pw.get()) {
+                            std::vector<T> decoded(size);
+                            chunk->DecodePacked(data_pos, size, decoded.data());
+                            const bool* valid_data = chunk->ValidData();
+                            if (valid_data != nullptr) {
+                                valid_data += data_pos;
+                            }
+                            eval(decoded.data(), valid_data);
+                            is_seal = true;
+                        }
+                    }
+                    if (!is_seal) {
+                        auto pw =
+                            segment_->chunk_data<T>(op_ctx_, field_id_, i);
+                        auto chunk = pw.get();
+                        const T* data = chunk.data() + data_pos;
+                        const bool* valid_data = chunk.valid_data();
+                        if (valid_data != nullptr) {
+                            valid_data += data_pos;
+                        }
+                        eval(data, valid_data);
                     }
                 }
             } else {
@@ -1599,16 +1828,36 @@ class SegmentExpr : public Expr {
                                    valid_res + processed_size,
                                    size);
                 } else {
-                    auto pw = segment_->chunk_data<T>(op_ctx_, field_id_, i);
-                    auto chunk = pw.get();
-                    valid_data = chunk.valid_data();
-                    if (valid_data != nullptr) {
-                        valid_data += data_pos;
+                    bool applied = false;
+                    if constexpr (IsPackableInt<T>) {
+                        // a skipped packed chunk is never decoded
+                        auto packed_pw =
+                            segment_->packed_int_chunk(op_ctx_, field_id_, i);
+                        if (auto chunk = packed_pw.get()) {
+                            valid_data = chunk->ValidData();
+                            if (valid_data != nullptr) {
+                                valid_data += data_pos;
+                            }
+                            ApplyValidData(valid_data,
+                                           res + processed_size,
+                                           valid_res + processed_size,
+                                           size);
+                            applied = true;
+                        }
+                    }
+                    if (!applied) {
+                        auto pw =
+                            segment_->chunk_data<T>(op_ctx_, field_id_, i);
+                        auto chunk = pw.get();
+                        valid_data = chunk.valid_data();
+                        if (valid_data != nullptr) {
+                            valid_data += data_pos;
+                        }
+                        ApplyValidData(valid_data,
+                                       res + processed_size,
+                                       valid_res + processed_size,
+                                       size);
                     }
-                    ApplyValidData(valid_data,
-                                   res + processed_size,
-                                   valid_res + processed_size,
-                                   size);
                 }
                 // Call func with nullptr to update internal cursors
                 if constexpr (NeedSegmentOffsets) {
@@ -1663,6 +1912,25 @@ class SegmentExpr : public Expr {
         }
     }
 
+    // ProcessDataChunks for a `func` that evaluates every row on its own and
+    // keeps no state between rows: a dictionary encoded string chunk is
+    // evaluated once per distinct value instead of once per row, and the
+    // constant chunk of a default value field once for all its rows.
+    template <typename T, typename FUNC, typename... ValTypes>
+    int64_t
+    ProcessDataChunksByDictionary(
+        FUNC func,
+        std::function<bool(const milvus::SkipIndex&, FieldId, int)> skip_func,
+        TargetBitmapView res,
+        TargetBitmapView valid_res,
+        const ValTypes&... values) {
+        if (segment_->is_chunked()) {
+            return ProcessDataChunksForMultipleChunk<T, false, true>(
+                func, skip_func, res, valid_res, values...);
+        }
+        return ProcessDataChunks<T>(func, skip_func, res, valid_res, values...);
+    }
+
     // Specialized method for ngram post-filter: processes data in a specific range
     // - Starts from segment_offset (global offset across all chunks)
     // - Processes exactly 'size' rows
@@ -1785,22 +2053,56 @@ class SegmentExpr : public Expr {
             prepare_index();
             cached_is_nested_index_ = index_ptr->IsNestedIndex();
 
-            auto cached = ExprCacheHelper::GetOrCompute(
-                segment_,
-                this->ToString(),
-                active_count_,
-                [&]() -> ExprCacheHelper::ComputeResult {
-                    prepare_index();
-                    TargetBitmap res = func(index_ptr, values...);
-
-                    TargetBitmap valid_res;
-                    if (cached_is_nested_index_ && func_returns_row_level) {
-                        valid_res = TargetBitmap(active_count_, true);
-                    } else {
-                        valid_res = index_ptr->IsNotNull();
-                    }
-                    return {std::move(res), std::move(valid_res)};
-                });
+            auto compute = [&]() -> ExprCacheHelper::ComputeResult {
+                prepare_index();
+                TargetBitmap res = func(index_ptr, values...);
+
+                TargetBitmap valid_res;
+                if (cached_is_nested_index_ && func_returns_row_level) {
+                    valid_res = TargetBitmap(active_count_, true);
+                } else {
+                    valid_res = index_ptr->IsNotNull();
+                }
+                return {std::move(res), std::move(valid_res)};
+            };
+            ExprCacheHelper::CachedBitmaps cached;
+            if constexpr (!std::is_same_v<IndexInnerType, bool>) {
+                if (range_cache_query_.has_value() &&
+                    field_type_ != DataType::JSON &&
+                    !cached_is_nested_index_) {
+                    auto eval_range =
+                        [&](const RangeInterval<IndexInnerType>& r) {
+                            prepare_index();
+                            if (r.lower.has_value() && r.upper.has_value()) {
+                                return index_ptr->Range(*r.lower,
+                                                        r.lower_inclusive,
+                                                        *r.upper,
+                                                        r.upper_inclusive);
+                            }
+                            if (r.lower.has_value()) {
+                                return index_ptr->Range(
+                                    *r.lower,
+                                    r.lower_inclusive ? OpType::GreaterEqual
+                                                      : OpType::GreaterThan);
+                            }
+                            return index_ptr->Range(
+                                *r.upper,
+                                r.upper_inclusive ? OpType::LessEqual
+                                                  : OpType::LessThan);
+                        };
+                    cached = ExprCacheHelper::GetOrComputeRange<
+                        IndexInnerType>(segment_,
+                                        range_cache_family_,
+                                        *range_cache_query_,
+                                        active_count_,
+                                        eval_range,
+                                        compute);
+                }
+            }
+            if (!cached.result) {
+                cached = ExprCacheHelper::GetOrCompute(
+                    segment_, this->ToString(), active_count_, compute);
+            }
             cached_index_chunk_res_ = cached.result;
             cached_index_chunk_valid_res_ = cached.valid;
             cached_index_chunk_id_ = 0;
@@ -2277,6 +2579,28 @@ class SegmentExpr : public Expr {
                !nested_path_.empty() && !PathContainsInteger(nested_path_);
     }
 
+    // Determine at init time whether a compare of the field against `value`
+    // can binary search a sealed segment loaded in the field's order. A NaN
+    // literal matches no row under the scan's compares and is left to it.
+    bool
+    CanUseSortedDataAtInit(const proto::plan::GenericValue& value) const {
+        if (segment_->type() != SegmentType::Sealed || !nested_path_.empty()) {
+            return false;
+        }
+        bool literal_fits = false;
+        if (field_type_ == DataType::INT8 || field_type_ == DataType::INT16 ||
+            field_type_ == DataType::INT32 || field_type_ == DataType::INT64 ||
+            field_type_ == DataType::TIMESTAMPTZ) {
+            literal_fits =
+                value.val_case() == proto::plan::GenericValue::kInt64Val;
+        } else if (IsFloatDataType(field_type_)) {
+            literal_fits =
+                value.val_case() == proto::plan::GenericValue::kFloatVal &&
+                !std::isnan(value.float_val());
+        }
+        return literal_fits && segment_->IsFieldSorted(op_ctx_, field_id_);
+    }
+
     virtual bool
     CanUseNgramIndex() const {
         return false;
@@ -2288,6 +2612,32 @@ class SegmentExpr : public Expr {
         return exec_path_ != ExprExecPath::RawData;
     }
 
+    bool
+    SupportsMorselEval() const override {
+        return exec_path_ == ExprExecPath::RawData && !CanUseNgramIndex();
+    }
+
+    // Only a raw data scan reads per row, the other paths slice a bitmap
+    // computed for the whole segment. Element level filters count their
+    // batches in array elements, not in segment offsets.
+    std::optional<int64_t>
+    SparseBatchBegin() const override {
+        if (exec_path_ != ExprExecPath::RawData || CanUseNgramIndex() ||
+            execute_all_at_once_ || num_data_chunk_ == 0) {
+            return std::nullopt;
+        }
+        auto column = GetColumnInfo();
+        if (!column.has_value() || column->element_level_) {
+            return std::nullopt;
+        }
+        if (segment_->is_chunked()) {
+            return segment_->num_rows_until_chunk(field_id_,
+                                                  current_data_chunk_) +
+                   current_data_chunk_pos_;
+        }
+        return current_data_chunk_ * size_per_chunk_ + current_data_chunk_pos_;
+    }
+
     void
     SetExecuteAllAtOnce() override {
         batch_size_ = active_count_;
@@ -2296,7 +2646,7 @@ class SegmentExpr : public Expr {
 
     // Returns true if the expression uses the ScalarIndex cursor.
     // Only ScalarIndex maintains a separate index cursor; PkIndex, TextIndex,
-    // and JsonStats cache full results and slice via data cursor.
+    // JsonStats and SortedData cache full results and slice via data cursor.
     bool
     UseIndexCursor() const {
         return exec_path_ == ExprExecPath::ScalarIndex;
@@ -2330,6 +2680,17 @@ class SegmentExpr : public Expr {
         exec_path_ = ExprExecPath::ScalarIndex;
     }
 
+    // Falls back from a committed ScalarIndex path to RawData when the chunk
+    // zone maps estimate that [lower, upper] matches enough of this sealed
+    // segment for a scan of the loaded column to beat the index lookup, see
+    // ScanCostModel.h. Anything the model cannot estimate keeps the index.
+    void
+    PreferRawScanForWideRange(const RangeBound& lower,
+                              const RangeBound& upper);
+
+    std::optional<index::ScalarIndexType>
+    PinnedScalarIndexType() const;
+
     // Slice cached result bitmap for the current batch.
     // Used by all index paths (ScalarIndex, PkIndex, TextIndex, JsonStats).
     // Prerequisites: cached_result_ and cached_valid_result_ must be populated.
@@ -2410,6 +2771,10 @@ class SegmentExpr : public Expr {
     bool execute_all_at_once_{false};
     // used for reducing cache miss latency in tiered storage
     bool prefetched_{false};
+    // readahead of PrefetchDataChunks(): chunks before prefetched_until_
+    // were issued, prefetch_future_ is the range still loading
+    int64_t prefetched_until_{0};
+    std::future<void> prefetch_future_;
     // Scalar index is pinned lazily by EnsurePinnedIndex(). Pre-pin
     // existence checks (HasCompatibleScalarIndex) query segment metadata
     // directly, so expressions on short-circuit paths (TextIndex, PkIndex,
@@ -2447,6 +2812,10 @@ class SegmentExpr : public Expr {
     bool cached_is_nested_index_{false};
     std::shared_ptr<TargetBitmap> cached_match_res_{nullptr};
 
+    // Set by SetRangeCacheQuery() for range predicates.
+    std::optional<CachedRange> range_cache_query_;
+    std::string range_cache_family_;
+
     int32_t consistency_level_{0};
 
     // Cache for ngram Phase1 result (stays independent, not part of unified path).
@@ -2552,6 +2921,24 @@ class ExprSet {
         }
     }
 
+    bool
+    SupportsMorselEval() const {
+        for (const auto& expr : exprs_) {
+            if (!expr->SupportsMorselEval()) {
+                return false;
+            }
+        }
+        return !exprs_.empty();
+    }
+
+    // Skip the next batch of every expression without evaluating it.
+    void
+    MoveCursor() {
+        for (auto& expr : exprs_) {
+            expr->MoveCursor();
+        }
+    }
+
  private:
     std::vector<std::shared_ptr<Expr>> exprs_;
     ExecContext* exec_ctx_;
@@ -45,6 +45,7 @@
 #include "common/protobuf_utils.h"
 #include "exec/QueryContext.h"
 #include "exec/Task.h"
+#include "exec/expression/BinaryArithOpEvalRangeExpr.h"
 #include "exec/expression/EvalCtx.h"
 #include "expr/ITypeExpr.h"
 #include "gtest/gtest.h"
@@ -2263,3 +2264,106 @@ TEST_P(ExprTest, TestCompareWithScalarIndexMarisNullable2) {
         }
     }
 }
+
+TEST(Expr, ArithCompareKernelsMatchRowByRow) {
+    using proto::plan::ArithOpType;
+    using proto::plan::OpType;
+    constexpr int kRows = 200;
+    std::vector<int32_t> data(kRows);
+    for (int i = 0; i < kRows; ++i) {
+        data[i] = i - kRows / 2;
+    }
+    std::vector<int32_t> offsets;
+    for (int i = 0; i < kRows; i += 7) {
+        offsets.push_back(i);
+    }
+    const int64_t right_operand = 3;
+    const int64_t value = 4;
+
+    auto arith = [&](ArithOpType arith_op, int64_t v) -> int64_t {
+        switch (arith_op) {
+            case ArithOpType::Add:
+                return v + right_operand;
+            case ArithOpType::Sub:
+                return v - right_operand;
+            case ArithOpType::Mul:
+                return v * right_operand;
+            case ArithOpType::Div:
+                return v / right_operand;
+            default:
+                return v % right_operand;
+        }
+    };
+    auto compare = [&](OpType cmp_op, int64_t v) {
+        switch (cmp_op) {
+            case OpType::Equal:
+                return v == value;
+            case OpType::NotEqual:
+                return v != value;
+            case OpType::GreaterThan:
+                return v > value;
+            case OpType::GreaterEqual:
+                return v >= value;
+            case OpType::LessThan:
+                return v < value;
+            default:
+                return v <= value;
+        }
+    };
+
+    for (auto cmp_op : {OpType::Equal,
+                        OpType::NotEqual,
+                        OpType::GreaterThan,
+                        OpType::GreaterEqual,
+                        OpType::LessThan,
+                        OpType::LessEqual}) {
+        for (auto arith_op : {ArithOpType::Add,
+                              ArithOpType::Sub,
+                              ArithOpType::Mul,
+                              ArithOpType::Div,
+                              ArithOpType::Mod}) {
+            auto sequential =
+                exec::ArithCompareKernels<int32_t,
+                                          exec::FilterType::sequential>::
+                    Resolve(cmp_op, arith_op);
+            auto random = exec::ArithCompareKernels<
+                int32_t,
+                exec::FilterType::random>::Resolve(cmp_op, arith_op);
+            ASSERT_NE(sequential, nullptr);
+            ASSERT_NE(random, nullptr);
+
+            TargetBitmap all(kRows);
+            sequential(data.data(),
+                       kRows,
+                       value,
+                       right_operand,
+                       TargetBitmapView(all),
+                       nullptr);
+            for (int i = 0; i < kRows; ++i) {
+                ASSERT_EQ(all[i], compare(cmp_op, arith(arith_op, data[i])))
+                    << "cmp " << cmp_op << " arith " << arith_op << " row "
+                    << i;
+            }
+
+            TargetBitmap gathered(offsets.size());
+            random(data.data(),
+                   offsets.size(),
+                   value,
+                   right_operand,
+                   TargetBitmapView(gathered),
+                   offsets.data());
+            for (size_t i = 0; i < offsets.size(); ++i) {
+                ASSERT_EQ(gathered[i], all[offsets[i]]) << "offset " << i;
+            }
+        }
+    }
+
+    EXPECT_EQ((exec::ArithCompareKernels<int32_t,
+                                         exec::FilterType::sequential>::
+                   Resolve(OpType::PrefixMatch, ArithOpType::Add)),
+              nullptr);
+    EXPECT_EQ((exec::ArithCompareKernels<int32_t,
+                                         exec::FilterType::sequential>::
+                   Resolve(OpType::Equal, ArithOpType::ArrayLength)),
+              nullptr);
+}
@@ -19,8 +19,10 @@
 #include <filesystem>
 
 #include "cachinglayer/Metrics.h"
+#include "exec/expression/CacheCompressor.h"
 #include "exec/expression/DiskSlotFile.h"
 #include "exec/expression/EntryPool.h"
+#include "monitor/Monitor.h"
 #include "xxhash.h"
 
 namespace milvus {
@@ -111,7 +113,7 @@ ExprResCacheManager::SetConfig(const CacheConfig& config) {
     const auto old_mode = config_.mode;
     const auto old_disk_base_path = config_.disk_base_path;
 
-    if (config.mode == CacheMode::Disk && !config.disk_base_path.empty()) {
+    if (config.mode != CacheMode::Memory && !config.disk_base_path.empty()) {
         std::error_code ec;
         std::filesystem::create_directories(config.disk_base_path, ec);
         if (ec) {
@@ -120,18 +122,7 @@ ExprResCacheManager::SetConfig(const CacheConfig& config) {
                      ec.message());
             SetEnabled(false);
             entry_pool_.reset();
-            {
-                std::unique_lock lock(disk_files_mutex_);
-                disk_files_.clear();
-                disk_ineligible_segments_.clear();
-            }
-            {
-                std::lock_guard lock(disk_clock_mutex_);
-                disk_clock_segments_.clear();
-                disk_clock_index_.clear();
-                disk_segment_usage_.clear();
-                disk_clock_hand_ = 0;
-            }
+            ResetDiskStateLocked();
             SyncUsageMetrics(0, 0);
             return false;
         }
@@ -139,53 +130,32 @@ ExprResCacheManager::SetConfig(const CacheConfig& config) {
 
     config_ = config;
     frequency_tracker_.Reset();
-    if (config_.mode == CacheMode::Memory) {
+    promote_tracker_.Reset();
+    if (config_.mode == CacheMode::Disk) {
+        entry_pool_.reset();
+    } else {
         entry_pool_ = std::make_unique<EntryPool>(config_.mem_max_bytes);
         entry_pool_->Configure(config_.mem_max_bytes,
                                config_.compression_enabled,
                                config_.mem_min_eval_duration_us);
-        {
-            std::unique_lock lock(disk_files_mutex_);
-            disk_files_.clear();
-            disk_ineligible_segments_.clear();
-        }
-        {
-            std::lock_guard lock(disk_clock_mutex_);
-            disk_clock_segments_.clear();
-            disk_clock_index_.clear();
-            disk_segment_usage_.clear();
-            disk_clock_hand_ = 0;
-        }
-        if (old_mode == CacheMode::Disk) {
+    }
+    ResetDiskStateLocked();
+    if (config_.mode == CacheMode::Memory) {
+        if (old_mode != CacheMode::Memory) {
             RemoveCacheFilesInDir(old_disk_base_path);
         }
-        SyncUsageMetrics(0, 0);
-        return true;
     } else {
-        entry_pool_.reset();
-        {
-            std::unique_lock lock(disk_files_mutex_);
-            disk_files_.clear();
-            disk_ineligible_segments_.clear();
-        }
-        {
-            std::lock_guard lock(disk_clock_mutex_);
-            disk_clock_segments_.clear();
-            disk_clock_index_.clear();
-            disk_segment_usage_.clear();
-            disk_clock_hand_ = 0;
-        }
         // Disk cache metadata is process-local; old files are not reusable.
         if (!config_.disk_base_path.empty()) {
             RemoveCacheFilesInDir(config_.disk_base_path);
         }
-        if (old_mode == CacheMode::Disk && !old_disk_base_path.empty() &&
+        if (old_mode != CacheMode::Memory && !old_disk_base_path.empty() &&
             old_disk_base_path != config_.disk_base_path) {
             RemoveCacheFilesInDir(old_disk_base_path);
         }
-        SyncUsageMetrics(0, 0);
-        return true;
     }
+    SyncUsageMetrics(0, 0);
+    return true;
 }
 
 CacheMode
@@ -239,42 +209,58 @@ ExprResCacheManager::SetCapacityBytes(size_t capacity_bytes) {
 size_t
 ExprResCacheManager::GetCapacityBytes() const {
     std::shared_lock state_lock(state_mutex_);
-    if (config_.mode == CacheMode::Memory) {
-        return config_.mem_max_bytes;
+    switch (config_.mode) {
+        case CacheMode::Memory:
+            return config_.mem_max_bytes;
+        case CacheMode::Disk:
+            return config_.disk_max_bytes;
+        default:
+            return config_.mem_max_bytes + config_.disk_max_bytes;
     }
-    return config_.disk_max_bytes;
 }
 
 size_t
 ExprResCacheManager::GetCurrentBytes() const {
     std::shared_lock state_lock(state_mutex_);
-    if (config_.mode == CacheMode::Memory && entry_pool_) {
-        return entry_pool_->GetCurrentBytes();
+    size_t total = 0;
+    if (config_.mode != CacheMode::Disk && entry_pool_) {
+        total += entry_pool_->GetCurrentBytes();
     }
-    if (config_.mode == CacheMode::Disk) {
+    if (config_.mode != CacheMode::Memory) {
         std::shared_lock lock(disk_files_mutex_);
-        return GetDiskCurrentBytesLocked();
+        total += GetDiskCurrentBytesLocked();
     }
-    return 0;
+    return total;
 }
 
 size_t
 ExprResCacheManager::GetEntryCount() const {
     std::shared_lock state_lock(state_mutex_);
-    if (config_.mode == CacheMode::Memory && entry_pool_) {
-        return entry_pool_->GetEntryCount();
+    size_t total = 0;
+    if (config_.mode != CacheMode::Disk && entry_pool_) {
+        total += entry_pool_->GetEntryCount();
     }
-    if (config_.mode == CacheMode::Disk) {
+    if (config_.mode != CacheMode::Memory) {
         std::shared_lock lock(disk_files_mutex_);
-        size_t total = 0;
         for (const auto& [_, file] : disk_files_) {
             if (file) {
                 total += file->GetUsedCount();
             }
         }
-        return total;
     }
-    return 0;
+    return total;
+}
+
+CacheTierStats
+ExprResCacheManager::GetTierStats() const {
+    CacheTierStats stats;
+    stats.memory_hits = memory_hits_.load(std::memory_order_relaxed);
+    stats.disk_hits = disk_hits_.load(std::memory_order_relaxed);
+    stats.misses = misses_.load(std::memory_order_relaxed);
+    stats.promotions = promotions_.load(std::memory_order_relaxed);
+    stats.demotions = demotions_.load(std::memory_order_relaxed);
+    stats.range_reuses = range_reuses_.load(std::memory_order_relaxed);
+    return stats;
 }
 
 bool
@@ -287,40 +273,68 @@ ExprResCacheManager::Get(const Key& key, Value& out_value) {
     if (!IsEnabled()) {
         return false;
     }
-    if (config_.mode == CacheMode::Memory) {
-        if (!entry_pool_) {
-            return false;
-        }
-        TargetBitmap result(0), valid(0);
-        if (!entry_pool_->Get(key.segment_id,
-                              key.signature,
-                              out_value.active_count,
-                              result,
-                              valid)) {
-            return false;
-        }
-        out_value.result = std::make_shared<TargetBitmap>(std::move(result));
-        out_value.valid_result =
-            std::make_shared<TargetBitmap>(std::move(valid));
-        return true;
-    } else {
-        // Disk mode
-        std::shared_lock lock(disk_files_mutex_);
-        auto it = disk_files_.find(key.segment_id);
-        if (it == disk_files_.end()) {
-            return false;
-        }
+    if (config_.mode != CacheMode::Disk && entry_pool_) {
         TargetBitmap result(0), valid(0);
-        if (!it->second->Get(
-                key.signature, out_value.active_count, result, valid)) {
-            return false;
+        if (entry_pool_->Get(key.segment_id,
+                             key.signature,
+                             out_value.active_count,
+                             result,
+                             valid)) {
+            out_value.result =
+                std::make_shared<TargetBitmap>(std::move(result));
+            out_value.valid_result =
+                std::make_shared<TargetBitmap>(std::move(valid));
+            memory_hits_.fetch_add(1, std::memory_order_relaxed);
+            monitor::internal_core_expr_cache_memory_hit.Increment();
+            return true;
         }
-        out_value.result = std::make_shared<TargetBitmap>(std::move(result));
-        out_value.valid_result =
-            std::make_shared<TargetBitmap>(std::move(valid));
-        TryTouchDiskSegment(key.segment_id);
-        return true;
     }
+    if (config_.mode == CacheMode::Memory || !GetFromDisk(key, out_value)) {
+        misses_.fetch_add(1, std::memory_order_relaxed);
+        monitor::internal_core_expr_cache_miss.Increment();
+        return false;
+    }
+    disk_hits_.fetch_add(1, std::memory_order_relaxed);
+    monitor::internal_core_expr_cache_disk_hit.Increment();
+
+    // Hybrid: hot disk entries are promoted back to memory. The disk slot is
+    // kept, it ages out through the disk Clock once memory serves the hits.
+    if (config_.mode == CacheMode::Hybrid && entry_pool_ &&
+        promote_tracker_.RecordAndCheck(
+            XXH64(key.signature.data(), key.signature.size(), 0),
+            config_.hybrid_promote_threshold)) {
+        std::vector<EvictedCacheEntry> evicted;
+        entry_pool_->Put(key.segment_id,
+                         key.signature,
+                         out_value.active_count,
+                         *out_value.result,
+                         *out_value.valid_result,
+                         0,
+                         true,
+                         &evicted);
+        promotions_.fetch_add(1, std::memory_order_relaxed);
+        monitor::internal_core_expr_cache_promote.Increment();
+        DemoteEvicted(evicted);
+    }
+    return true;
+}
+
+bool
+ExprResCacheManager::GetFromDisk(const Key& key, Value& out_value) {
+    std::shared_lock lock(disk_files_mutex_);
+    auto it = disk_files_.find(key.segment_id);
+    if (it == disk_files_.end()) {
+        return false;
+    }
+    TargetBitmap result(0), valid(0);
+    if (!it->second->Get(
+            key.signature, out_value.active_count, result, valid)) {
+        return false;
+    }
+    out_value.result = std::make_shared<TargetBitmap>(std::move(result));
+    out_value.valid_result = std::make_shared<TargetBitmap>(std::move(valid));
+    TryTouchDiskSegment(key.segment_id);
+    return true;
 }
 
 void
@@ -336,7 +350,7 @@ ExprResCacheManager::Put(const Key& key, const Value& value) {
     if (!IsEnabled()) {
         return;
     }
-    if (config_.mode == CacheMode::Memory) {
+    if (config_.mode != CacheMode::Disk) {
         if (!entry_pool_) {
             return;
         }
@@ -353,81 +367,139 @@ ExprResCacheManager::Put(const Key& key, const Value& value) {
                 config_.admission_threshold)) {
             return;
         }
+        if (config_.mode == CacheMode::Memory) {
+            entry_pool_->Put(key.segment_id,
+                             key.signature,
+                             value.active_count,
+                             *value.result,
+                             *value.valid_result,
+                             value.eval_duration_us);
+            SyncUsageMetrics(entry_pool_->GetCurrentBytes(), 0);
+            return;
+        }
+
+        // Hybrid: evictions of sealed segment entries are demoted to disk
+        std::vector<EvictedCacheEntry> evicted;
         entry_pool_->Put(key.segment_id,
                          key.signature,
                          value.active_count,
                          *value.result,
                          *value.valid_result,
-                         value.eval_duration_us);
-        SyncUsageMetrics(entry_pool_->GetCurrentBytes(), 0);
-    } else {
-        // Disk mode
-        if (config_.disk_base_path.empty()) {
-            return;
-        }
-
-        bool replacing_existing = false;
-        {
-            std::shared_lock lock(disk_files_mutex_);
-            if (disk_ineligible_segments_.find(key.segment_id) !=
-                disk_ineligible_segments_.end()) {
-                return;
-            }
-            auto it = disk_files_.find(key.segment_id);
-            if (it != disk_files_.end()) {
-                replacing_existing = it->second->HasSignature(key.signature);
-            }
-        }
-
-        // Latency admission (disk mode)
-        if (!replacing_existing && config_.disk_min_eval_duration_us > 0 &&
-            value.eval_duration_us > 0 &&
-            value.eval_duration_us < config_.disk_min_eval_duration_us) {
-            return;
-        }
+                         value.eval_duration_us,
+                         value.disk_eligible,
+                         &evicted);
+        DemoteEvicted(evicted);
+        std::shared_lock lock(disk_files_mutex_);
+        SyncUsageMetrics(entry_pool_->GetCurrentBytes(),
+                         GetDiskCurrentBytesLocked());
+        return;
+    }
 
-        // Frequency admission is mode-independent. Applying it before opening
-        // the segment file avoids one-off expressions consuming disk slots and
-        // issuing unnecessary pwrite calls.
-        if (!replacing_existing &&
-            !frequency_tracker_.RecordAndCheck(
-                XXH64(key.signature.data(), key.signature.size(), 0),
-                config_.admission_threshold)) {
-            return;
-        }
+    // Disk mode
+    if (config_.disk_base_path.empty()) {
+        return;
+    }
 
-        std::unique_lock lock(disk_files_mutex_);
+    bool replacing_existing = false;
+    {
+        std::shared_lock lock(disk_files_mutex_);
         if (disk_ineligible_segments_.find(key.segment_id) !=
             disk_ineligible_segments_.end()) {
             return;
         }
-        std::string path = config_.disk_base_path + "/seg_" +
-                           std::to_string(key.segment_id) + ".cache";
-        auto& file = disk_files_[key.segment_id];
-        if (file &&
-            file->GetRowCount() != static_cast<int64_t>(value.result->size())) {
-            // Disk cache is sealed-only. A row-count change identifies a
-            // growing/unstable segment for this backend, so drop the old fixed
-            // file and skip future disk puts until the segment/config resets.
-            RemoveDiskSegmentFile(key.segment_id);
-            disk_ineligible_segments_.insert(key.segment_id);
-            SyncUsageMetrics(0, GetDiskCurrentBytesLocked());
-            return;
+        auto it = disk_files_.find(key.segment_id);
+        if (it != disk_files_.end()) {
+            replacing_existing = it->second->HasSignature(key.signature);
         }
-        if (!file) {
-            file = std::make_unique<DiskSlotFile>(
-                key.segment_id,
-                path,
-                static_cast<int64_t>(value.result->size()),
-                config_.disk_max_file_size);
+    }
+
+    // Latency admission (disk mode)
+    if (!replacing_existing && config_.disk_min_eval_duration_us > 0 &&
+        value.eval_duration_us > 0 &&
+        value.eval_duration_us < config_.disk_min_eval_duration_us) {
+        return;
+    }
+
+    // Frequency admission is mode-independent. Applying it before opening
+    // the segment file avoids one-off expressions consuming disk slots and
+    // issuing unnecessary pwrite calls.
+    if (!replacing_existing &&
+        !frequency_tracker_.RecordAndCheck(
+            XXH64(key.signature.data(), key.signature.size(), 0),
+            config_.admission_threshold)) {
+        return;
+    }
+
+    PutToDisk(key.segment_id,
+              key.signature,
+              value.active_count,
+              *value.result,
+              *value.valid_result);
+}
+
+void
+ExprResCacheManager::PutToDisk(int64_t segment_id,
+                               const std::string& signature,
+                               int64_t active_count,
+                               const TargetBitmap& result,
+                               const TargetBitmap& valid) {
+    if (config_.disk_base_path.empty()) {
+        return;
+    }
+    const size_t memory_bytes =
+        entry_pool_ ? entry_pool_->GetCurrentBytes() : 0;
+
+    std::unique_lock lock(disk_files_mutex_);
+    if (disk_ineligible_segments_.find(segment_id) !=
+        disk_ineligible_segments_.end()) {
+        return;
+    }
+    std::string path = config_.disk_base_path + "/seg_" +
+                       std::to_string(segment_id) + ".cache";
+    auto& file = disk_files_[segment_id];
+    if (file && file->GetRowCount() != static_cast<int64_t>(result.size())) {
+        // Disk cache is sealed-only. A row-count change identifies a
+        // growing/unstable segment for this backend, so drop the old fixed
+        // file and skip future disk puts until the segment/config resets.
+        RemoveDiskSegmentFile(segment_id);
+        disk_ineligible_segments_.insert(segment_id);
+        SyncUsageMetrics(memory_bytes, GetDiskCurrentBytesLocked());
+        return;
+    }
+    if (!file) {
+        file = std::make_unique<DiskSlotFile>(
+            segment_id,
+            path,
+            static_cast<int64_t>(result.size()),
+            config_.disk_max_file_size);
+    }
+    file->Put(signature, active_count, result, valid);
+    TouchDiskSegment(segment_id);
+    EvictDiskSegmentsUntilWithinBudget(segment_id);
+    SyncUsageMetrics(memory_bytes, GetDiskCurrentBytesLocked());
+}
+
+void
+ExprResCacheManager::DemoteEvicted(std::vector<EvictedCacheEntry>& evicted) {
+    // DiskSlotFile slots are fixed-size raw bitsets, so the compressed pool
+    // payload is decoded once here before it is written out.
+    for (auto& entry : evicted) {
+        TargetBitmap result(0), valid(0);
+        if (!CacheCompressor::Decompress(
+                entry.data.data(),
+                static_cast<uint32_t>(entry.data.size()),
+                entry.comp_type,
+                result,
+                valid)) {
+            continue;
         }
-        file->Put(key.signature,
-                  value.active_count,
-                  *value.result,
-                  *value.valid_result);
-        TouchDiskSegment(key.segment_id);
-        EvictDiskSegmentsUntilWithinBudget(key.segment_id);
-        SyncUsageMetrics(0, GetDiskCurrentBytesLocked());
+        PutToDisk(entry.segment_id,
+                  entry.signature,
+                  entry.active_count,
+                  result,
+                  valid);
+        demotions_.fetch_add(1, std::memory_order_relaxed);
+        monitor::internal_core_expr_cache_demote.Increment();
     }
 }
 
@@ -438,41 +510,106 @@ ExprResCacheManager::Clear() {
         entry_pool_->Clear();
     }
     frequency_tracker_.Reset();
-    {
-        std::unique_lock lock(disk_files_mutex_);
-        disk_files_.clear();
-        disk_ineligible_segments_.clear();
-    }
-    {
-        std::lock_guard lock(disk_clock_mutex_);
-        disk_clock_segments_.clear();
-        disk_clock_index_.clear();
-        disk_segment_usage_.clear();
-        disk_clock_hand_ = 0;
-    }
+    promote_tracker_.Reset();
+    ResetDiskStateLocked();
     if (!config_.disk_base_path.empty()) {
         RemoveCacheFilesInDir(config_.disk_base_path);
     }
+    memory_hits_.store(0, std::memory_order_relaxed);
+    disk_hits_.store(0, std::memory_order_relaxed);
+    misses_.store(0, std::memory_order_relaxed);
+    promotions_.store(0, std::memory_order_relaxed);
+    demotions_.store(0, std::memory_order_relaxed);
+    range_reuses_.store(0, std::memory_order_relaxed);
+    {
+        std::lock_guard lock(ranges_mutex_);
+        ranges_.clear();
+    }
     SyncUsageMetrics(0, 0);
 }
 
 size_t
 ExprResCacheManager::EraseSegment(int64_t segment_id) {
     std::unique_lock state_lock(state_mutex_);
+    {
+        std::lock_guard lock(ranges_mutex_);
+        ranges_.erase(segment_id);
+    }
+    size_t erased = 0;
+    if (config_.mode != CacheMode::Disk && entry_pool_) {
+        erased += entry_pool_->EraseSegment(segment_id);
+    }
+    const size_t memory_bytes =
+        entry_pool_ ? entry_pool_->GetCurrentBytes() : 0;
     if (config_.mode == CacheMode::Memory) {
-        size_t erased = entry_pool_ ? entry_pool_->EraseSegment(segment_id) : 0;
-        SyncUsageMetrics(entry_pool_ ? entry_pool_->GetCurrentBytes() : 0, 0);
+        SyncUsageMetrics(memory_bytes, 0);
         return erased;
+    }
+
+    std::unique_lock lock(disk_files_mutex_);
+    if (disk_files_.find(segment_id) == disk_files_.end()) {
+        disk_ineligible_segments_.erase(segment_id);
+        RemoveDiskClockSegment(segment_id);
     } else {
-        std::unique_lock lock(disk_files_mutex_);
-        if (disk_files_.find(segment_id) == disk_files_.end()) {
-            disk_ineligible_segments_.erase(segment_id);
-            RemoveDiskClockSegment(segment_id);
-            return 0;
-        }
         RemoveDiskSegmentFile(segment_id);
-        SyncUsageMetrics(0, GetDiskCurrentBytesLocked());
-        return 1;
+        ++erased;
+    }
+    SyncUsageMetrics(memory_bytes, GetDiskCurrentBytesLocked());
+    return erased;
+}
+
+void
+ExprResCacheManager::RegisterRange(int64_t segment_id,
+                                   const std::string& family,
+                                   const CachedRange& range) {
+    std::lock_guard lock(ranges_mutex_);
+    auto& ranges = ranges_[segment_id][family];
+    for (auto it = ranges.begin(); it != ranges.end(); ++it) {
+        if (it->signature == range.signature) {
+            ranges.erase(it);
+            break;
+        }
+    }
+    ranges.push_front(range);
+    if (ranges.size() > kMaxRangesPerFamily) {
+        ranges.pop_back();
+    }
+}
+
+std::vector<CachedRange>
+ExprResCacheManager::GetRanges(int64_t segment_id,
+                               const std::string& family) const {
+    std::lock_guard lock(ranges_mutex_);
+    auto seg_it = ranges_.find(segment_id);
+    if (seg_it == ranges_.end()) {
+        return {};
+    }
+    auto it = seg_it->second.find(family);
+    if (it == seg_it->second.end()) {
+        return {};
+    }
+    return {it->second.begin(), it->second.end()};
+}
+
+void
+ExprResCacheManager::RecordRangeReuse() {
+    range_reuses_.fetch_add(1, std::memory_order_relaxed);
+    monitor::internal_core_expr_cache_range_reuse.Increment();
+}
+
+void
+ExprResCacheManager::ResetDiskStateLocked() {
+    {
+        std::unique_lock lock(disk_files_mutex_);
+        disk_files_.clear();
+        disk_ineligible_segments_.clear();
+    }
+    {
+        std::lock_guard lock(disk_clock_mutex_);
+        disk_clock_segments_.clear();
+        disk_clock_index_.clear();
+        disk_segment_usage_.clear();
+        disk_clock_hand_ = 0;
     }
 }
 
@@ -19,12 +19,14 @@
 #include <cstddef>
 #include <cstdint>
 #include <atomic>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <shared_mutex>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <variant>
 #include <vector>
 
 #include "common/Types.h"
@@ -37,6 +39,16 @@ namespace exec {
 class EntryPool;
 class DiskSlotFile;
 
+// Entry evicted from EntryPool, handed back to the caller so it can be
+// demoted to a lower tier outside of the pool lock.
+struct EvictedCacheEntry {
+    int64_t segment_id{0};
+    std::string signature;
+    int64_t active_count{0};
+    uint8_t comp_type{0};
+    std::vector<char> data;  // compressed payload (header + body)
+};
+
 // Lightweight frequency tracker using direct-mapped counter array.
 // Used for cache admission control: only cache expressions seen >= threshold times.
 // Approximate — hash collisions cause shared counters, which is acceptable.
@@ -89,8 +101,10 @@ class FrequencyTracker {
     std::atomic<uint64_t> total_records_{0};
 };
 
-// Cache mode: Memory (EntryPool) or Disk (DiskSlotFile).
-enum class CacheMode { Memory, Disk };
+// Cache mode: Memory (EntryPool), Disk (DiskSlotFile), or Hybrid where
+// EntryPool evictions of sealed segments are demoted to DiskSlotFile and hot
+// disk hits are promoted back to memory.
+enum class CacheMode { Memory, Disk, Hybrid };
 
 // Configuration for ExprResCacheManager.
 struct CacheConfig {
@@ -105,10 +119,40 @@ struct CacheConfig {
     uint64_t disk_max_bytes{10ULL * 1024 * 1024 * 1024};
     uint64_t disk_max_file_size{256ULL * 1024 * 1024};
     int64_t disk_min_eval_duration_us{1000};
+    // Hybrid mode: promote a disk hit back to memory once its signature has
+    // been seen this many times
+    uint8_t hybrid_promote_threshold{4};
+};
+
+// Per-tier access counters, mainly useful for hybrid mode.
+struct CacheTierStats {
+    uint64_t memory_hits{0};
+    uint64_t disk_hits{0};
+    uint64_t misses{0};
+    uint64_t promotions{0};
+    uint64_t demotions{0};
+    // misses answered from an overlapping cached range
+    uint64_t range_reuses{0};
+};
+
+// Bound of a cached range predicate, std::monostate means unbounded.
+// Integral columns are widened to int64_t and floating point to double.
+using RangeBound = std::variant<std::monostate, int64_t, double, std::string>;
+
+// A range predicate whose bitmap is cached under `signature`. Range
+// predicates on the same column share a family, so a query whose range
+// overlaps a cached one only has to evaluate the difference.
+struct CachedRange {
+    std::string signature;
+    RangeBound lower;
+    bool lower_inclusive{false};
+    RangeBound upper;
+    bool upper_inclusive{false};
 };
 
 // Process-level expression result cache with mode dispatch.
-// Routes to EntryPool (memory mode) or per-segment DiskSlotFile (disk mode).
+// Routes to EntryPool (memory mode), per-segment DiskSlotFile (disk mode),
+// or both tiers (hybrid mode).
 class ExprResCacheManager {
  public:
     struct Key {
@@ -138,6 +182,7 @@ class ExprResCacheManager {
         size_t bytes{0};  // approximate size in bytes
         int64_t eval_duration_us{
             0};  // eval duration in us, 0 = skip cost check
+        bool disk_eligible{false};  // hybrid mode: sealed segment entry
     };
 
  public:
@@ -176,6 +221,10 @@ class ExprResCacheManager {
     size_t
     GetEntryCount() const;
 
+    // Counters since the last Clear().
+    CacheTierStats
+    GetTierStats() const;
+
     // Try to get cached value. If found, returns true and fills out_value.
     // NOTE: caller must pre-set out_value.active_count for staleness check.
     bool
@@ -192,6 +241,24 @@ class ExprResCacheManager {
     size_t
     EraseSegment(int64_t segment_id);
 
+    // Remember that `range` is cached for (segment_id, family). Only the
+    // most recent kMaxRangesPerFamily ranges of a family are kept.
+    void
+    RegisterRange(int64_t segment_id,
+                  const std::string& family,
+                  const CachedRange& range);
+
+    // Registered ranges of (segment_id, family), most recent first. The
+    // bitmaps may have been evicted since, callers must still Get() them.
+    std::vector<CachedRange>
+    GetRanges(int64_t segment_id, const std::string& family) const;
+
+    // Count a miss that was answered from an overlapping cached range.
+    void
+    RecordRangeReuse();
+
+    static constexpr size_t kMaxRangesPerFamily = 8;
+
  private:
     ExprResCacheManager() = default;
 
@@ -216,6 +283,25 @@ class ExprResCacheManager {
     void
     SyncUsageMetrics(size_t memory_bytes, size_t disk_bytes);
 
+    void
+    ResetDiskStateLocked();
+
+    bool
+    GetFromDisk(const Key& key, Value& out_value);
+
+    // Write a bitset into the segment's DiskSlotFile, bypassing admission.
+    // Caller must hold state_mutex_ (shared) and not disk_files_mutex_.
+    void
+    PutToDisk(int64_t segment_id,
+              const std::string& signature,
+              int64_t active_count,
+              const TargetBitmap& result,
+              const TargetBitmap& valid);
+
+    // Hybrid mode: move EntryPool evictions into the disk tier.
+    void
+    DemoteEvicted(std::vector<EvictedCacheEntry>& evicted);
+
     static std::atomic<bool> enabled_;
 
     mutable std::shared_mutex state_mutex_;
@@ -235,8 +321,24 @@ class ExprResCacheManager {
     size_t disk_clock_hand_{0};
 
     FrequencyTracker frequency_tracker_;
+    // Counts disk hits only; kept apart from the admission tracker so a
+    // promotion decision does not also bump the admission counters.
+    FrequencyTracker promote_tracker_;
+    std::atomic<uint64_t> memory_hits_{0};
+    std::atomic<uint64_t> disk_hits_{0};
+    std::atomic<uint64_t> misses_{0};
+    std::atomic<uint64_t> promotions_{0};
+    std::atomic<uint64_t> demotions_{0};
+    std::atomic<uint64_t> range_reuses_{0};
     std::atomic<size_t> reported_memory_bytes_{0};
     std::atomic<size_t> reported_disk_bytes_{0};
+
+    // Range family registry: segment_id -> family -> ranges
+    mutable std::mutex ranges_mutex_;
+    std::unordered_map<
+        int64_t,
+        std::unordered_map<std::string, std::deque<CachedRange>>>
+        ranges_;
 };
 
 // Helper API: erase all cache for a given segment id, returns erased entry count
@@ -18,8 +18,11 @@
 
 #include <chrono>
 #include <memory>
+#include <optional>
 #include <string>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "common/Types.h"
 #include "exec/expression/ExprCache.h"
@@ -30,6 +33,15 @@ namespace exec {
 
 class BatchedCachedMixin;
 
+// Typed form of a CachedRange, unset bounds are unbounded.
+template <typename T>
+struct RangeInterval {
+    std::optional<T> lower;
+    bool lower_inclusive{false};
+    std::optional<T> upper;
+    bool upper_inclusive{false};
+};
+
 // Wrapper around ExprResCacheManager to simplify the get→compute→put pattern
 // for expression implementations. Each expression only needs to:
 //   1. Provide a stable ToString() signature
@@ -135,10 +147,216 @@ class ExprCacheHelper {
         v.valid_result = valid;
         v.active_count = active_count;
         v.eval_duration_us = eval_us;
+        v.disk_eligible = segment->type() == SegmentType::Sealed;
         ExprResCacheManager::Instance().Put(key, v);
 
         return {result, valid};
     }
+
+    // GetOrCompute for range predicates (`lower < x < upper` and one-sided
+    // comparisons) on sorted scalar indexes. On a miss, the most recent
+    // cached range of the same `family` (segment + column) that overlaps
+    // `query` is patched instead of evaluating the whole range:
+    //
+    //   result = cached - range(cached \ query) + range(query \ cached)
+    //
+    // so a sliding window only pays for the slices it gained or lost.
+    //
+    // `eval_range(RangeInterval<T>)` must evaluate an interval bounded on
+    // at least one side with the same semantics and bitmap length as
+    // `compute`. The valid bitmap of the cached range is reused as-is, it
+    // must not depend on the bounds.
+    template <typename T, typename RangeFn, typename ComputeFn>
+    static CachedBitmaps
+    GetOrComputeRange(const segcore::SegmentInternalInterface* segment,
+                      const std::string& family,
+                      const CachedRange& query,
+                      int64_t active_count,
+                      RangeFn&& eval_range,
+                      ComputeFn&& compute,
+                      bool enable_cache_write = true) {
+        if (segment == nullptr || !ExprResCacheManager::IsEnabled()) {
+            return GetOrCompute(segment,
+                                query.signature,
+                                active_count,
+                                std::forward<ComputeFn>(compute),
+                                enable_cache_write);
+        }
+
+        auto reuse_or_compute = [&]() -> ComputeResult {
+            auto reused = TryReuseRange<T>(
+                segment, family, query, active_count, eval_range);
+            if (reused.has_value()) {
+                return std::move(*reused);
+            }
+            return compute();
+        };
+        auto cached = GetOrCompute(segment,
+                                   query.signature,
+                                   active_count,
+                                   reuse_or_compute,
+                                   enable_cache_write);
+        if (enable_cache_write) {
+            ExprResCacheManager::Instance().RegisterRange(
+                segment->get_segment_id(), family, query);
+        }
+        return cached;
+    }
+
+    template <typename T>
+    static RangeBound
+    ToRangeBound(const T& value) {
+        if constexpr (std::is_integral_v<T>) {
+            return static_cast<int64_t>(value);
+        } else if constexpr (std::is_floating_point_v<T>) {
+            return static_cast<double>(value);
+        } else {
+            return std::string(value);
+        }
+    }
+
+    template <typename T>
+    static std::optional<RangeInterval<T>>
+    ToRangeInterval(const CachedRange& range) {
+        RangeInterval<T> out;
+        if (!FromRangeBound(range.lower, out.lower) ||
+            !FromRangeBound(range.upper, out.upper)) {
+            return std::nullopt;
+        }
+        out.lower_inclusive = range.lower_inclusive;
+        out.upper_inclusive = range.upper_inclusive;
+        return out;
+    }
+
+    template <typename T>
+    static RangeInterval<T>
+    IntersectRange(const RangeInterval<T>& a, const RangeInterval<T>& b) {
+        RangeInterval<T> out = a;
+        if (b.lower.has_value() &&
+            (!out.lower.has_value() || *b.lower > *out.lower ||
+             (*b.lower == *out.lower && !b.lower_inclusive))) {
+            out.lower = b.lower;
+            out.lower_inclusive = b.lower_inclusive;
+        }
+        if (b.upper.has_value() &&
+            (!out.upper.has_value() || *b.upper < *out.upper ||
+             (*b.upper == *out.upper && !b.upper_inclusive))) {
+            out.upper = b.upper;
+            out.upper_inclusive = b.upper_inclusive;
+        }
+        return out;
+    }
+
+    template <typename T>
+    static bool
+    IsEmptyRange(const RangeInterval<T>& r) {
+        if (!r.lower.has_value() || !r.upper.has_value()) {
+            return false;
+        }
+        return *r.lower > *r.upper ||
+               (*r.lower == *r.upper &&
+                !(r.lower_inclusive && r.upper_inclusive));
+    }
+
+    // a \ b as at most two intervals, below and above b.
+    template <typename T>
+    static std::vector<RangeInterval<T>>
+    SubtractRange(const RangeInterval<T>& a, const RangeInterval<T>& b) {
+        std::vector<RangeInterval<T>> out;
+        if (b.lower.has_value()) {
+            RangeInterval<T> below{
+                std::nullopt, false, b.lower, !b.lower_inclusive};
+            auto piece = IntersectRange(a, below);
+            if (!IsEmptyRange(piece)) {
+                out.push_back(std::move(piece));
+            }
+        }
+        if (b.upper.has_value()) {
+            RangeInterval<T> above{
+                b.upper, !b.upper_inclusive, std::nullopt, false};
+            auto piece = IntersectRange(a, above);
+            if (!IsEmptyRange(piece)) {
+                out.push_back(std::move(piece));
+            }
+        }
+        return out;
+    }
+
+ private:
+    template <typename T>
+    static bool
+    FromRangeBound(const RangeBound& bound, std::optional<T>& out) {
+        if (std::holds_alternative<std::monostate>(bound)) {
+            out = std::nullopt;
+            return true;
+        }
+        if constexpr (std::is_integral_v<T>) {
+            if (auto v = std::get_if<int64_t>(&bound)) {
+                out = static_cast<T>(*v);
+                return true;
+            }
+        } else if constexpr (std::is_floating_point_v<T>) {
+            if (auto v = std::get_if<double>(&bound)) {
+                out = static_cast<T>(*v);
+                return true;
+            }
+        } else {
+            if (auto v = std::get_if<std::string>(&bound)) {
+                out = T(*v);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    template <typename T, typename RangeFn>
+    static std::optional<ComputeResult>
+    TryReuseRange(const segcore::SegmentInternalInterface* segment,
+                  const std::string& family,
+                  const CachedRange& query,
+                  int64_t active_count,
+                  RangeFn& eval_range) {
+        auto q = ToRangeInterval<T>(query);
+        if (!q.has_value()) {
+            return std::nullopt;
+        }
+        auto& mgr = ExprResCacheManager::Instance();
+        const auto segment_id = segment->get_segment_id();
+        for (const auto& range : mgr.GetRanges(segment_id, family)) {
+            if (range.signature == query.signature) {
+                continue;
+            }
+            auto c = ToRangeInterval<T>(range);
+            if (!c.has_value() || IsEmptyRange(IntersectRange(*c, *q))) {
+                continue;
+            }
+            ExprResCacheManager::Value got;
+            got.active_count = active_count;
+            if (!mgr.Get({segment_id, range.signature}, got)) {
+                continue;
+            }
+
+            ComputeResult out{got.result->clone(),
+                              got.valid_result->clone()};
+            for (const auto& piece : SubtractRange(*c, *q)) {
+                TargetBitmap bits = eval_range(piece);
+                if (bits.size() != out.result.size()) {
+                    return std::nullopt;
+                }
+                out.result -= bits;
+            }
+            for (const auto& piece : SubtractRange(*q, *c)) {
+                TargetBitmap bits = eval_range(piece);
+                if (bits.size() != out.result.size()) {
+                    return std::nullopt;
+                }
+                out.result |= bits;
+            }
+            mgr.RecordRangeReuse();
+            return out;
+        }
+        return std::nullopt;
+    }
 };
 
 // ============================================================
@@ -332,6 +332,7 @@ using milvus::exec::CacheCompressor;
 
 using milvus::exec::kCompTypeLZ4;
 using milvus::exec::kCompTypeRaw;
+using milvus::exec::kCompTypeRle;
 using milvus::exec::kCompTypeRoaring;
 using milvus::exec::kCompTypeRoaringInv;
 
@@ -353,6 +354,17 @@ MakeRandomBits(size_t n, double density, uint32_t seed = 42) {
     return b;
 }
 
+// Helper: alternating runs of `run_len` bits, starting with ones.
+milvus::TargetBitmap
+MakeClusteredBits(size_t n, size_t run_len) {
+    milvus::TargetBitmap b(n);
+    b.reset();
+    for (size_t start = 0; start < n; start += 2 * run_len) {
+        b.set(start, std::min(run_len, n - start));
+    }
+    return b;
+}
+
 // Helper: compare two bitsets bit-by-bit.
 void
 AssertBitsEqual(const milvus::TargetBitmap& a, const milvus::TargetBitmap& b) {
@@ -499,6 +511,7 @@ TEST(CacheCompressorTest, VariousDensities) {
                 ASSERT_TRUE(comp_type == kCompTypeLZ4 ||
                             comp_type == kCompTypeRoaring ||
                             comp_type == kCompTypeRoaringInv ||
+                            comp_type == kCompTypeRle ||
                             comp_type == kCompTypeRaw)
                     << "density=" << density;
             } else {
@@ -543,6 +556,85 @@ TEST(CacheCompressorTest, CorruptPayloadReturnsFalse) {
                                     out_valid));
 }
 
+TEST(CacheCompressorTest, RleForClusteredBits) {
+    const size_t n = 100000;
+    // ~50% density in long runs, as produced by time-ordered segments
+    auto result = MakeClusteredBits(n, 1000);
+    auto valid = MakeBits(n, true);
+    valid.reset(5000, 300);
+
+    ASSERT_EQ(CacheCompressor::CountRuns(result), 101);
+
+    uint8_t comp_type = 0;
+    auto compressed = CacheCompressor::Compress(result, valid, true, comp_type);
+    ASSERT_EQ(comp_type, kCompTypeRle);
+    ASSERT_LT(compressed.size(), result.size_in_bytes() / 2);
+
+    milvus::TargetBitmap out_result(0);
+    milvus::TargetBitmap out_valid(0);
+    ASSERT_TRUE(
+        CacheCompressor::Decompress(compressed.data(),
+                                    static_cast<uint32_t>(compressed.size()),
+                                    comp_type,
+                                    out_result,
+                                    out_valid));
+    AssertBitsEqual(result, out_result);
+    AssertBitsEqual(valid, out_valid);
+
+    // truncated run stream
+    ASSERT_FALSE(CacheCompressor::Decompress(
+        compressed.data(),
+        static_cast<uint32_t>(compressed.size() / 2),
+        comp_type,
+        out_result,
+        out_valid));
+
+    // scattered bits at the same density stay Raw
+    auto scattered = MakeRandomBits(n, 0.5, 5);
+    CacheCompressor::Compress(scattered, valid, true, comp_type);
+    ASSERT_EQ(comp_type, kCompTypeRaw);
+}
+
+TEST(CacheCompressorTest, DecompressAndIntoTarget) {
+    const size_t n = 70000;
+    const std::pair<milvus::TargetBitmap, uint8_t> cases[] = {
+        {MakeRandomBits(n, 0.01, 11), kCompTypeRoaring},
+        {MakeRandomBits(n, 0.99, 12), kCompTypeRoaringInv},
+        {MakeClusteredBits(n, 700), kCompTypeRle},
+        {MakeRandomBits(n, 0.5, 13), kCompTypeRaw},
+    };
+    auto valid = MakeBits(n, true);
+
+    for (const auto& [cached, expected_type] : cases) {
+        uint8_t comp_type = 0;
+        auto compressed =
+            CacheCompressor::Compress(cached, valid, true, comp_type);
+        ASSERT_EQ(comp_type, expected_type);
+
+        auto target = MakeRandomBits(n, 0.6, 21);
+        auto expected = target.clone();
+        expected &= cached;
+
+        ASSERT_TRUE(CacheCompressor::DecompressAnd(
+            compressed.data(),
+            static_cast<uint32_t>(compressed.size()),
+            comp_type,
+            milvus::TargetBitmapView(target)));
+        AssertBitsEqual(expected, target);
+    }
+
+    // size mismatch is rejected
+    uint8_t comp_type = 0;
+    auto compressed = CacheCompressor::Compress(
+        MakeClusteredBits(n, 700), valid, true, comp_type);
+    milvus::TargetBitmap small(n - 1);
+    ASSERT_FALSE(CacheCompressor::DecompressAnd(
+        compressed.data(),
+        static_cast<uint32_t>(compressed.size()),
+        comp_type,
+        milvus::TargetBitmapView(small)));
+}
+
 // SegmentCacheFileTest::PerfBenchmark removed — V1 mmap backend replaced.
 
 // ---- Performance benchmarks ----
@@ -2174,6 +2266,145 @@ TEST(ExprResCacheManagerV2Test, DiskModePutGet) {
     ExprResCacheManager::SetEnabled(false);
 }
 
+TEST(ExprResCacheManagerV2Test, HybridModeDemoteAndPromote) {
+    auto& mgr = ExprResCacheManager::Instance();
+    ExprResCacheManager::SetEnabled(true);
+    mgr.Clear();
+
+    auto tmpdir = std::filesystem::temp_directory_path() /
+                  ("excr_test_hybrid_" + std::to_string(getpid()) + "_" +
+                   std::to_string(rand()));
+    std::filesystem::create_directories(tmpdir);
+
+    milvus::exec::CacheConfig cfg;
+    cfg.mode = milvus::exec::CacheMode::Hybrid;
+    // tiny memory tier: every put evicts the previous entry
+    cfg.mem_max_bytes = 1;
+    cfg.mem_min_eval_duration_us = 0;
+    cfg.disk_base_path = tmpdir.string();
+    cfg.disk_max_file_size = 1ULL << 20;
+    cfg.disk_min_eval_duration_us = 0;
+    cfg.admission_threshold = 1;
+    cfg.hybrid_promote_threshold = 2;
+    mgr.SetConfig(cfg);
+
+    const size_t N = 1024;
+    auto bits1 = MakeRandomBits(N, 0.5, 7);
+    auto bits2 = MakeRandomBits(N, 0.5, 8);
+
+    ExprResCacheManager::Key k1{300, "hybrid_sig_1"};
+    ExprResCacheManager::Key k2{300, "hybrid_sig_2"};
+    ExprResCacheManager::Value v;
+    v.valid_result = std::make_shared<milvus::TargetBitmap>(MakeBits(N));
+    v.active_count = static_cast<int64_t>(N);
+    v.disk_eligible = true;
+
+    v.result = std::make_shared<milvus::TargetBitmap>(bits1.clone());
+    mgr.Put(k1, v);
+    v.result = std::make_shared<milvus::TargetBitmap>(bits2.clone());
+    mgr.Put(k2, v);
+
+    // k1 was pushed out of memory and written to the disk tier
+    auto stats = mgr.GetTierStats();
+    ASSERT_EQ(stats.demotions, 1u);
+    ASSERT_TRUE(std::filesystem::exists(tmpdir / "seg_300.cache"));
+
+    // the first disk hit of k1 stays on disk
+    ExprResCacheManager::Value got;
+    got.active_count = static_cast<int64_t>(N);
+    ASSERT_TRUE(mgr.Get(k1, got));
+    stats = mgr.GetTierStats();
+    ASSERT_EQ(stats.disk_hits, 1u);
+    ASSERT_EQ(stats.promotions, 0u);
+
+    // the second one reaches the promote threshold and moves k1 back to
+    // memory, which demotes k2 in turn
+    got.active_count = static_cast<int64_t>(N);
+    ASSERT_TRUE(mgr.Get(k1, got));
+    for (size_t i = 0; i < N; ++i) {
+        ASSERT_EQ(bool((*got.result)[i]), bool(bits1[i])) << "bit " << i;
+    }
+    stats = mgr.GetTierStats();
+    ASSERT_EQ(stats.disk_hits, 2u);
+    ASSERT_EQ(stats.promotions, 1u);
+    ASSERT_EQ(stats.demotions, 2u);
+
+    ASSERT_TRUE(mgr.Get(k1, got));
+    ASSERT_EQ(mgr.GetTierStats().memory_hits, 1u);
+
+    got.active_count = static_cast<int64_t>(N);
+    ASSERT_TRUE(mgr.Get(k2, got));
+    for (size_t i = 0; i < N; ++i) {
+        ASSERT_EQ(bool((*got.result)[i]), bool(bits2[i])) << "bit " << i;
+    }
+
+    // non-sealed entries are dropped instead of demoted
+    ExprResCacheManager::Key k3{301, "hybrid_growing"};
+    v.disk_eligible = false;
+    mgr.Put(k3, v);
+    mgr.Put(k1, v);
+    ASSERT_FALSE(std::filesystem::exists(tmpdir / "seg_301.cache"));
+
+    mgr.Clear();
+    std::filesystem::remove_all(tmpdir);
+    ExprResCacheManager::SetEnabled(false);
+}
+
+TEST(ExprResCacheManagerV2Test, HybridPromotionIgnoresAdmissionCount) {
+    auto& mgr = ExprResCacheManager::Instance();
+    ExprResCacheManager::SetEnabled(true);
+    mgr.Clear();
+
+    auto tmpdir = std::filesystem::temp_directory_path() /
+                  ("excr_test_hybrid_count_" + std::to_string(getpid()) +
+                   "_" + std::to_string(rand()));
+    std::filesystem::create_directories(tmpdir);
+
+    milvus::exec::CacheConfig cfg;
+    cfg.mode = milvus::exec::CacheMode::Hybrid;
+    cfg.mem_max_bytes = 1;
+    cfg.mem_min_eval_duration_us = 0;
+    cfg.disk_base_path = tmpdir.string();
+    cfg.disk_max_file_size = 1ULL << 20;
+    cfg.disk_min_eval_duration_us = 0;
+    cfg.admission_threshold = 2;
+    cfg.hybrid_promote_threshold = 2;
+    mgr.SetConfig(cfg);
+
+    const size_t N = 1024;
+    ExprResCacheManager::Key k1{310, "hybrid_count_sig_1"};
+    ExprResCacheManager::Key k2{310, "hybrid_count_sig_2"};
+    ExprResCacheManager::Value v;
+    v.result =
+        std::make_shared<milvus::TargetBitmap>(MakeRandomBits(N, 0.5, 9));
+    v.valid_result = std::make_shared<milvus::TargetBitmap>(MakeBits(N));
+    v.active_count = static_cast<int64_t>(N);
+    v.disk_eligible = true;
+
+    // two puts each to pass admission; k2 pushes k1 to disk
+    mgr.Put(k1, v);
+    mgr.Put(k1, v);
+    mgr.Put(k2, v);
+    mgr.Put(k2, v);
+    ASSERT_EQ(mgr.GetTierStats().demotions, 1u);
+
+    // the admission records of k1 must not count towards its promotion
+    ExprResCacheManager::Value got;
+    got.active_count = static_cast<int64_t>(N);
+    ASSERT_TRUE(mgr.Get(k1, got));
+    auto stats = mgr.GetTierStats();
+    ASSERT_EQ(stats.disk_hits, 1u);
+    ASSERT_EQ(stats.promotions, 0u);
+
+    got.active_count = static_cast<int64_t>(N);
+    ASSERT_TRUE(mgr.Get(k1, got));
+    ASSERT_EQ(mgr.GetTierStats().promotions, 1u);
+
+    mgr.Clear();
+    std::filesystem::remove_all(tmpdir);
+    ExprResCacheManager::SetEnabled(false);
+}
+
 TEST(ExprResCacheManagerV2Test, DiskModeFrequencyAdmission) {
     auto& mgr = ExprResCacheManager::Instance();
     ExprResCacheManager::SetEnabled(true);
@@ -2857,3 +3088,143 @@ TEST(ExprResCacheV2PerfTest, EndToEndBothModes) {
 
     std::filesystem::remove_all(tmpdir);
 }
+
+TEST(ExprCacheRangeTest, SubtractRange) {
+    using milvus::exec::ExprCacheHelper;
+    using Interval = milvus::exec::RangeInterval<int64_t>;
+
+    // (10, 50) \ (20, 60) = (10, 20]
+    auto pieces =
+        ExprCacheHelper::SubtractRange(Interval{10, false, 50, false},
+                                       Interval{20, false, 60, false});
+    ASSERT_EQ(pieces.size(), 1);
+    EXPECT_EQ(pieces[0].lower, 10);
+    EXPECT_FALSE(pieces[0].lower_inclusive);
+    EXPECT_EQ(pieces[0].upper, 20);
+    EXPECT_TRUE(pieces[0].upper_inclusive);
+
+    // [0, 100] \ [20, 30) = [0, 20) and [30, 100]
+    pieces = ExprCacheHelper::SubtractRange(Interval{0, true, 100, true},
+                                            Interval{20, true, 30, false});
+    ASSERT_EQ(pieces.size(), 2);
+    EXPECT_EQ(pieces[0].upper, 20);
+    EXPECT_FALSE(pieces[0].upper_inclusive);
+    EXPECT_EQ(pieces[1].lower, 30);
+    EXPECT_TRUE(pieces[1].lower_inclusive);
+
+    // x > 5 \ x >= 5 is empty, x >= 5 \ x > 5 is [5, 5]
+    EXPECT_TRUE(ExprCacheHelper::SubtractRange(
+                    Interval{5, false, std::nullopt, false},
+                    Interval{5, true, std::nullopt, false})
+                    .empty());
+    pieces =
+        ExprCacheHelper::SubtractRange(Interval{5, true, std::nullopt, false},
+                                       Interval{5, false, std::nullopt, false});
+    ASSERT_EQ(pieces.size(), 1);
+    EXPECT_EQ(pieces[0].lower, 5);
+    EXPECT_EQ(pieces[0].upper, 5);
+    EXPECT_TRUE(pieces[0].lower_inclusive && pieces[0].upper_inclusive);
+}
+
+TEST(ExprCacheRangeTest, SlidingWindowReusesOverlap) {
+    using milvus::exec::CachedRange;
+    using milvus::exec::ExprCacheHelper;
+    using Interval = milvus::exec::RangeInterval<int64_t>;
+
+    auto& mgr = ExprResCacheManager::Instance();
+    ExprResCacheManager::SetEnabled(true);
+    mgr.Clear();
+    milvus::exec::CacheConfig cfg;
+    cfg.mode = milvus::exec::CacheMode::Memory;
+    cfg.mem_min_eval_duration_us = 0;
+    cfg.admission_threshold = 1;
+    mgr.SetConfig(cfg);
+
+    auto schema = std::make_shared<milvus::Schema>();
+    auto pk = schema->AddDebugField("pk", milvus::DataType::INT64);
+    schema->set_primary_field_id(pk);
+    auto segment = milvus::segcore::CreateSealedSegment(
+        schema, milvus::empty_index_meta, 700);
+
+    const int64_t N = 1000;
+    std::vector<int64_t> data(N);
+    std::mt19937 rng(42);
+    for (auto& v : data) {
+        v = rng() % 200;
+    }
+    auto matches = [](const Interval& r, int64_t v) {
+        if (r.lower.has_value() &&
+            (r.lower_inclusive ? v < *r.lower : v <= *r.lower)) {
+            return false;
+        }
+        if (r.upper.has_value() &&
+            (r.upper_inclusive ? v > *r.upper : v >= *r.upper)) {
+            return false;
+        }
+        return true;
+    };
+    auto scan = [&](const Interval& r) {
+        milvus::TargetBitmap bits(N);
+        for (int64_t i = 0; i < N; ++i) {
+            bits[i] = matches(r, data[i]);
+        }
+        return bits;
+    };
+
+    int full_evals = 0;
+    int range_evals = 0;
+    auto run = [&](const Interval& q) {
+        CachedRange query;
+        query.signature = fmt::format("range {} {}", *q.lower, *q.upper);
+        query.lower = ExprCacheHelper::ToRangeBound(*q.lower);
+        query.lower_inclusive = q.lower_inclusive;
+        query.upper = ExprCacheHelper::ToRangeBound(*q.upper);
+        query.upper_inclusive = q.upper_inclusive;
+        return ExprCacheHelper::GetOrComputeRange<int64_t>(
+            segment.get(),
+            "range:pk",
+            query,
+            N,
+            [&](const Interval& r) {
+                ++range_evals;
+                return scan(r);
+            },
+            [&]() -> ExprCacheHelper::ComputeResult {
+                ++full_evals;
+                return {scan(q), MakeBits(N)};
+            });
+    };
+
+    Interval first{10, false, 50, false};
+    auto got = run(first);
+    EXPECT_EQ(full_evals, 1);
+    EXPECT_EQ(range_evals, 0);
+
+    // slide the window: one slice dropped and one slice gained
+    Interval second{20, true, 60, true};
+    got = run(second);
+    EXPECT_EQ(full_evals, 1);
+    EXPECT_EQ(range_evals, 2);
+    EXPECT_EQ(mgr.GetTierStats().range_reuses, 1);
+    ASSERT_EQ(got.result->size(), N);
+    auto expected = scan(second);
+    for (int64_t i = 0; i < N; ++i) {
+        ASSERT_EQ(bool((*got.result)[i]), bool(expected[i])) << "row " << i;
+    }
+
+    // exact hit of the patched result, no evaluation at all
+    got = run(second);
+    EXPECT_EQ(full_evals, 1);
+    EXPECT_EQ(range_evals, 2);
+
+    // disjoint range can't reuse anything
+    run(Interval{150, false, 160, false});
+    EXPECT_EQ(full_evals, 2);
+
+    EXPECT_EQ(mgr.GetRanges(700, "range:pk").size(), 3);
+    mgr.EraseSegment(700);
+    EXPECT_TRUE(mgr.GetRanges(700, "range:pk").empty());
+
+    mgr.Clear();
+    ExprResCacheManager::SetEnabled(false);
+}
@@ -149,7 +149,7 @@ TEST(JsonNumericTest, BinaryRangeUint64OutsideSmallRange) {
     col.push_back(makeJson(R"({"k": -50})"));                  // negative int64
     col.push_back(makeJson(R"({"k": 9223372036854775807})"));  // INT64_MAX
 
-    std::string pointer = "/k";
+    milvus::JsonPointer pointer("/k");
     int64_t lo = -1000, hi = 1000;
     TargetBitmap res_bm(N, false);
     TargetBitmap valid_res_bm(N, true);
@@ -185,7 +185,7 @@ TEST(JsonNumericTest, BinaryRangeUint64WithMaxRange) {
     col.push_back(makeJson(R"({"k": 9223372036854775807})"));  // INT64_MAX
     col.push_back(makeJson(R"({"k": 100})"));                  // normal
 
-    std::string pointer = "/k";
+    milvus::JsonPointer pointer("/k");
     int64_t lo = 0, hi = std::numeric_limits<int64_t>::max();
     TargetBitmap res_bm(N, false);
     TargetBitmap valid_res_bm(N, true);
@@ -217,7 +217,7 @@ TEST(JsonNumericTest, DoubleValuesStillWorkInBinaryRange) {
     col.push_back(makeJson(R"({"k": 50.0})"));
     col.push_back(makeJson(R"({"k": -10.5})"));
 
-    std::string pointer = "/k";
+    milvus::JsonPointer pointer("/k");
     int64_t lo = 0, hi = 100;
     TargetBitmap res_bm(N, false);
     TargetBitmap valid_res_bm(N, true);
@@ -251,7 +251,7 @@ TEST(JsonNumericTest, MixedTypeBinaryRange) {
     col.push_back(makeJson(R"({"other": 50})"));                // missing "k"
     col.push_back(makeJson(R"({"k": 100})"));                   // int64
 
-    std::string pointer = "/k";
+    milvus::JsonPointer pointer("/k");
     int64_t lo = 0, hi = 100;
     TargetBitmap res_bm(N, false);
     TargetBitmap valid_res_bm(N, true);
@@ -297,7 +297,7 @@ TEST(JsonNumericTest, Int64PrecisionPreservedInBinaryRange) {
     col.push_back(makeJson(R"({"k": 9007199254740993})"));  // 2^53 + 1
     col.push_back(makeJson(R"({"k": 9007199254740992})"));  // 2^53
 
-    std::string pointer = "/k";
+    milvus::JsonPointer pointer("/k");
     // Range: [2^53 + 1, 2^53 + 1] — only exact match should pass.
     int64_t lo = precise_val, hi = precise_val;
     TargetBitmap res_bm(N, false);
@@ -17,6 +17,7 @@
 #include <cstdint>
 #include <cstdlib>
 #include <iosfwd>
+#include <limits>
 #include <string_view>
 
 #include "bitset/bitset.h"
@@ -25,6 +26,7 @@
 #include "common/Geometry.h"
 #include "common/GeometryCache.h"
 #include "common/OpContext.h"
+#include "common/PointDistance.h"
 #include "common/PreparedGeometry.h"
 #include "common/Types.h"
 #include "geos_c.h"
@@ -40,54 +42,103 @@
 namespace milvus {
 namespace exec {
 
-#define GEOMETRY_EXECUTE_SUB_BATCH_WITH_COMPARISON(_DataType, method)       \
-    auto execute_sub_batch = [this](const _DataType* data,                  \
-                                    const bool* valid_data,                 \
-                                    const int32_t* offsets,                 \
-                                    const int32_t* segment_offsets,         \
-                                    const int size,                         \
-                                    TargetBitmapView res,                   \
-                                    TargetBitmapView valid_res,             \
-                                    const Geometry& right_source) {         \
-        AssertInfo(segment_offsets != nullptr,                              \
-                   "segment_offsets should not be nullptr");                \
-        auto* geometry_cache =                                              \
-            SimpleGeometryCacheManager::Instance().GetCache(                \
-                this->segment_->get_segment_id(), field_id_);               \
-        if (geometry_cache) {                                               \
-            auto cache_lock = geometry_cache->AcquireReadLock();            \
-            for (int i = 0; i < size; ++i) {                                \
-                if (valid_data != nullptr && !valid_data[i]) {              \
-                    res[i] = valid_res[i] = false;                          \
-                    continue;                                               \
-                }                                                           \
-                auto absolute_offset = segment_offsets[i];                  \
-                auto cached_geometry =                                      \
-                    geometry_cache->GetByOffsetUnsafe(absolute_offset);     \
-                AssertInfo(cached_geometry != nullptr,                      \
-                           "cached geometry is nullptr");                   \
-                res[i] = cached_geometry->method(right_source);             \
-            }                                                               \
-        } else {                                                            \
-            GEOSContextHandle_t ctx_ = GEOS_init_r();                       \
-            for (int i = 0; i < size; ++i) {                                \
-                if (valid_data != nullptr && !valid_data[i]) {              \
-                    res[i] = valid_res[i] = false;                          \
-                    continue;                                               \
-                }                                                           \
-                res[i] = Geometry(ctx_, data[i].data(), data[i].size())     \
-                             .method(right_source);                         \
-            }                                                               \
-            GEOS_finish_r(ctx_);                                            \
-        }                                                                   \
-    };                                                                      \
-    int64_t processed_size = ProcessDataChunks<_DataType, true>(            \
-        execute_sub_batch, std::nullptr_t{}, res, valid_res, right_source); \
-    AssertInfo(processed_size == real_batch_size,                           \
-               "internal error: expr processed rows {} not equal "          \
-               "expect batch size {}",                                      \
-               processed_size,                                              \
-               real_batch_size);                                            \
+namespace {
+
+void
+MarkInvalid(const bool* valid_data,
+            int size,
+            TargetBitmapView res,
+            TargetBitmapView valid_res) {
+    if (valid_data == nullptr) {
+        return;
+    }
+    for (int i = 0; i < size; ++i) {
+        if (!valid_data[i]) {
+            res[i] = valid_res[i] = false;
+        }
+    }
+}
+
+// ST_DWITHIN of WKB rows against a point: 2D points are read straight from
+// their WKB and tested in SIMD batches, only other geometries are parsed
+// by GEOS.
+template <typename T>
+void
+EvalPointsWithinDistance(const T* data,
+                         const bool* valid_data,
+                         int size,
+                         TargetBitmapView res,
+                         TargetBitmapView valid_res,
+                         const QueryGeometry& query,
+                         double distance) {
+    std::vector<double> xs(size);
+    std::vector<double> ys(size);
+    std::vector<int> non_points;
+    for (int i = 0; i < size; ++i) {
+        bool valid = valid_data == nullptr || valid_data[i];
+        if (!valid ||
+            !DecodeWkbPoint(data[i].data(), data[i].size(), xs[i], ys[i])) {
+            xs[i] = ys[i] = std::numeric_limits<double>::quiet_NaN();
+            if (valid) {
+                non_points.push_back(i);
+            }
+        }
+    }
+    PointsWithinDistance(
+        xs.data(), ys.data(), size, query.min_x, query.min_y, distance, res);
+    MarkInvalid(valid_data, size, res, valid_res);
+
+    auto ctx = GetThreadLocalGEOSContext();
+    for (auto i : non_points) {
+        res[i] = Geometry(ctx, data[i].data(), data[i].size())
+                     .dwithin(query.geometry, distance);
+    }
+}
+
+}  // namespace
+
+#define GEOMETRY_EXECUTE_SUB_BATCH_WITH_COMPARISON(_DataType, method)   \
+    auto execute_sub_batch = [this](const _DataType* data,              \
+                                    const bool* valid_data,             \
+                                    const int32_t* offsets,             \
+                                    const int32_t* segment_offsets,     \
+                                    const int size,                     \
+                                    TargetBitmapView res,               \
+                                    TargetBitmapView valid_res,         \
+                                    const QueryGeometry& query) {       \
+        AssertInfo(segment_offsets != nullptr,                          \
+                   "segment_offsets should not be nullptr");            \
+        auto* geometry_cache =                                          \
+            SimpleGeometryCacheManager::Instance().GetCache(            \
+                this->segment_->get_segment_id(), field_id_);           \
+        if (geometry_cache) {                                           \
+            EvalOnGeometryCache(*geometry_cache,                        \
+                                valid_data,                             \
+                                segment_offsets,                        \
+                                size,                                   \
+                                res,                                    \
+                                valid_res,                              \
+                                query);                                 \
+        } else {                                                        \
+            GEOSContextHandle_t ctx_ = GEOS_init_r();                   \
+            for (int i = 0; i < size; ++i) {                            \
+                if (valid_data != nullptr && !valid_data[i]) {          \
+                    res[i] = valid_res[i] = false;                      \
+                    continue;                                           \
+                }                                                       \
+                res[i] = Geometry(ctx_, data[i].data(), data[i].size()) \
+                             .method(query.geometry);                   \
+            }                                                           \
+            GEOS_finish_r(ctx_);                                        \
+        }                                                               \
+    };                                                                  \
+    int64_t processed_size = ProcessDataChunks<_DataType, true>(        \
+        execute_sub_batch, std::nullptr_t{}, res, valid_res, *query);   \
+    AssertInfo(processed_size == real_batch_size,                       \
+               "internal error: expr processed rows {} not equal "      \
+               "expect batch size {}",                                  \
+               processed_size,                                          \
+               real_batch_size);                                        \
     return res_vec;
 // Specialized macro for distance-based operations (ST_DWITHIN)
 #define GEOMETRY_EXECUTE_SUB_BATCH_WITH_COMPARISON_DISTANCE(_DataType, method) \
@@ -98,27 +149,28 @@ namespace exec {
                                     const int size,                            \
                                     TargetBitmapView res,                      \
                                     TargetBitmapView valid_res,                \
-                                    const Geometry& right_source) {            \
+                                    const QueryGeometry& query) {              \
         AssertInfo(segment_offsets != nullptr,                                 \
                    "segment_offsets should not be nullptr");                   \
         auto* geometry_cache =                                                 \
             SimpleGeometryCacheManager::Instance().GetCache(                   \
                 this->segment_->get_segment_id(), field_id_);                  \
         if (geometry_cache) {                                                  \
-            auto cache_lock = geometry_cache->AcquireReadLock();               \
-            for (int i = 0; i < size; ++i) {                                   \
-                if (valid_data != nullptr && !valid_data[i]) {                 \
-                    res[i] = valid_res[i] = false;                             \
-                    continue;                                                  \
-                }                                                              \
-                auto absolute_offset = segment_offsets[i];                     \
-                auto cached_geometry =                                         \
-                    geometry_cache->GetByOffsetUnsafe(absolute_offset);        \
-                AssertInfo(cached_geometry != nullptr,                         \
-                           "cached geometry is nullptr");                      \
-                res[i] =                                                       \
-                    cached_geometry->method(right_source, expr_->distance_);   \
-            }                                                                  \
+            EvalOnGeometryCache(*geometry_cache,                               \
+                                valid_data,                                    \
+                                segment_offsets,                               \
+                                size,                                          \
+                                res,                                           \
+                                valid_res,                                     \
+                                query);                                        \
+        } else if (query.is_point) {                                           \
+            EvalPointsWithinDistance(data,                                     \
+                                     valid_data,                               \
+                                     size,                                     \
+                                     res,                                      \
+                                     valid_res,                                \
+                                     query,                                    \
+                                     expr_->distance_);                        \
         } else {                                                               \
             GEOSContextHandle_t ctx_ = GEOS_init_r();                          \
             for (int i = 0; i < size; ++i) {                                   \
@@ -127,13 +179,13 @@ namespace exec {
                     continue;                                                  \
                 }                                                              \
                 res[i] = Geometry(ctx_, data[i].data(), data[i].size())        \
-                             .method(right_source, expr_->distance_);          \
+                             .method(query.geometry, expr_->distance_);        \
             }                                                                  \
             GEOS_finish_r(ctx_);                                               \
         }                                                                      \
     };                                                                         \
     int64_t processed_size = ProcessDataChunks<_DataType, true>(               \
-        execute_sub_batch, std::nullptr_t{}, res, valid_res, right_source);    \
+        execute_sub_batch, std::nullptr_t{}, res, valid_res, *query);          \
     AssertInfo(processed_size == real_batch_size,                              \
                "internal error: expr processed rows {} not equal "             \
                "expect batch size {}",                                         \
@@ -191,6 +243,123 @@ namespace exec {
                real_batch_size);                                             \
     return res_vec;
 
+// Evaluate geometry operation using PreparedGeometry for supported operations.
+// Note on predicate semantics when using prepared query:
+// - Symmetric predicates (intersects, touches, overlaps, crosses):
+//   prepared_query.op(left) == left.op(query)
+// - contains/within swap: left.contains(query) == prepared_query.within(left)
+//                         left.within(query) == prepared_query.contains(left)
+// - equals, dwithin: no prepared version, fall back to regular Geometry
+bool
+PhyGISFunctionFilterExpr::EvaluatePrepared(const Geometry& left,
+                                           const QueryGeometry& query) const {
+    const auto& prepared_query = query.prepared;
+    switch (expr_->op_) {
+        case proto::plan::GISFunctionFilterExpr_GISOp_Intersects:
+            // Symmetric
+            return prepared_query.intersects(left);
+        case proto::plan::GISFunctionFilterExpr_GISOp_Touches:
+            // Symmetric
+            return prepared_query.touches(left);
+        case proto::plan::GISFunctionFilterExpr_GISOp_Overlaps:
+            // Symmetric
+            return prepared_query.overlaps(left);
+        case proto::plan::GISFunctionFilterExpr_GISOp_Crosses:
+            // Symmetric
+            return prepared_query.crosses(left);
+        case proto::plan::GISFunctionFilterExpr_GISOp_Contains:
+            // left.contains(query) == query.within(left)
+            return prepared_query.within(left);
+        case proto::plan::GISFunctionFilterExpr_GISOp_Within:
+            // left.within(query) == query.contains(left)
+            return prepared_query.contains(left);
+        case proto::plan::GISFunctionFilterExpr_GISOp_Equals:
+            // No prepared version - fall back to regular geometry
+            return left.equals(query.geometry);
+        case proto::plan::GISFunctionFilterExpr_GISOp_DWithin:
+            // Distance-based operation - no prepared version
+            return left.dwithin(query.geometry, expr_->distance_);
+        default:
+            ThrowInfo(NotImplemented,
+                      "unknown GIS op : {}",
+                      static_cast<int>(expr_->op_));
+    }
+}
+
+void
+PhyGISFunctionFilterExpr::EvalOnGeometryCache(
+    const SimpleGeometryCache& cache,
+    const bool* valid_data,
+    const int32_t* segment_offsets,
+    int size,
+    TargetBitmapView res,
+    TargetBitmapView valid_res,
+    const QueryGeometry& query) const {
+    auto cache_lock = cache.AcquireReadLock();
+    const auto op = expr_->op_;
+
+    // Point columns: point-to-point distances are computed over the
+    // coordinates, and a point off the query's bounding box neither
+    // intersects nor lies within it, so GEOS only sees the points in it.
+    if (cache.AllPointsUnsafe()) {
+        const auto* xs = cache.PointXsUnsafe();
+        const auto* ys = cache.PointYsUnsafe();
+        if (op == proto::plan::GISFunctionFilterExpr_GISOp_DWithin &&
+            query.is_point) {
+            std::vector<double> point_xs(size);
+            std::vector<double> point_ys(size);
+            for (int i = 0; i < size; ++i) {
+                auto offset = segment_offsets[i];
+                point_xs[i] = xs[offset];
+                point_ys[i] = ys[offset];
+            }
+            // NaN coordinates of null rows never match
+            PointsWithinDistance(point_xs.data(),
+                                 point_ys.data(),
+                                 size,
+                                 query.min_x,
+                                 query.min_y,
+                                 expr_->distance_,
+                                 res);
+            MarkInvalid(valid_data, size, res, valid_res);
+            return;
+        }
+        if (op == proto::plan::GISFunctionFilterExpr_GISOp_Intersects ||
+            op == proto::plan::GISFunctionFilterExpr_GISOp_Within) {
+            for (int i = 0; i < size; ++i) {
+                if (valid_data != nullptr && !valid_data[i]) {
+                    res[i] = valid_res[i] = false;
+                    continue;
+                }
+                auto offset = segment_offsets[i];
+                auto x = xs[offset];
+                auto y = ys[offset];
+                if (!query.has_envelope || !(x >= query.min_x) ||
+                    !(x <= query.max_x) || !(y >= query.min_y) ||
+                    !(y <= query.max_y)) {
+                    res[i] = false;
+                    continue;
+                }
+                auto cached_geometry = cache.GetByOffsetUnsafe(offset);
+                AssertInfo(cached_geometry != nullptr,
+                           "cached geometry is nullptr");
+                res[i] = EvaluatePrepared(*cached_geometry, query);
+            }
+            return;
+        }
+    }
+
+    for (int i = 0; i < size; ++i) {
+        if (valid_data != nullptr && !valid_data[i]) {
+            res[i] = valid_res[i] = false;
+            continue;
+        }
+        auto cached_geometry = cache.GetByOffsetUnsafe(segment_offsets[i]);
+        AssertInfo(cached_geometry != nullptr, "cached geometry is nullptr");
+        res[i] = EvaluatePrepared(*cached_geometry, query);
+    }
+}
+
 void
 PhyGISFunctionFilterExpr::DetermineExecPath() {
     SegmentExpr::DetermineExecPath();
@@ -239,8 +408,7 @@ PhyGISFunctionFilterExpr::EvalForDataSegment() {
         return res_vec;
     }
 
-    auto right_source =
-        Geometry(GetThreadLocalGEOSContext(), expr_->geometry_wkt_.c_str());
+    auto query = QueryGeometryCache::ThreadLocal().Get(expr_->geometry_wkt_);
 
     // Choose underlying data type according to segment type to avoid element
     // size mismatch: Sealed segments and growing segments with mmap use std::string_view;
@@ -409,56 +577,16 @@ PhyGISFunctionFilterExpr::EvalForIndexSegment() {
     // and not safe for concurrent access from multiple query threads
     GEOSContextHandle_t ctx = GetThreadLocalGEOSContext();
 
-    Geometry query_geometry = Geometry(ctx, expr_->geometry_wkt_.c_str());
-
-    // Prepare the query geometry once for accelerated repeated predicate evaluation.
-    PreparedGeometry prepared_query(ctx, query_geometry);
+    // Parsed and prepared once per thread, shared by batches and requests
+    // filtering by the same geometry.
+    auto query = QueryGeometryCache::ThreadLocal().Get(expr_->geometry_wkt_);
+    const auto& query_geometry = query->geometry;
 
     /* ------------------------------------------------------------------
      * Prefetch: if coarse results are not cached yet, run a single R-Tree
      * query for all index chunks and cache their coarse bitmaps.
      * ------------------------------------------------------------------*/
 
-    // Evaluate geometry operation using PreparedGeometry for supported operations.
-    // Note on predicate semantics when using prepared query:
-    // - Symmetric predicates (intersects, touches, overlaps, crosses): prepared_query.op(left) == left.op(query)
-    // - contains/within swap: left.contains(query) == prepared_query.within(left)
-    //                         left.within(query) == prepared_query.contains(left)
-    // - equals, dwithin: no prepared version, fall back to regular Geometry
-    auto evaluate_geometry_prepared =
-        [this, &prepared_query, &query_geometry](const Geometry& left) -> bool {
-        switch (expr_->op_) {
-            case proto::plan::GISFunctionFilterExpr_GISOp_Intersects:
-                // Symmetric: prepared_query.intersects(left) == left.intersects(query)
-                return prepared_query.intersects(left);
-            case proto::plan::GISFunctionFilterExpr_GISOp_Touches:
-                // Symmetric
-                return prepared_query.touches(left);
-            case proto::plan::GISFunctionFilterExpr_GISOp_Overlaps:
-                // Symmetric
-                return prepared_query.overlaps(left);
-            case proto::plan::GISFunctionFilterExpr_GISOp_Crosses:
-                // Symmetric
-                return prepared_query.crosses(left);
-            case proto::plan::GISFunctionFilterExpr_GISOp_Contains:
-                // left.contains(query) == query.within(left)
-                return prepared_query.within(left);
-            case proto::plan::GISFunctionFilterExpr_GISOp_Within:
-                // left.within(query) == query.contains(left)
-                return prepared_query.contains(left);
-            case proto::plan::GISFunctionFilterExpr_GISOp_Equals:
-                // No prepared version - fall back to regular geometry
-                return left.equals(query_geometry);
-            case proto::plan::GISFunctionFilterExpr_GISOp_DWithin:
-                // Distance-based operation - no prepared version
-                return left.dwithin(query_geometry, expr_->distance_);
-            default:
-                ThrowInfo(NotImplemented,
-                          "unknown GIS op : {}",
-                          static_cast<int>(expr_->op_));
-        }
-    };
-
     TargetBitmap batch_result;
     TargetBitmap batch_valid;
     int processed_rows = 0;
@@ -542,7 +670,7 @@ PhyGISFunctionFilterExpr::EvalForIndexSegment() {
                         continue;
                     }
                     // Use prepared geometry for faster evaluation
-                    bool result = evaluate_geometry_prepared(*cached_geometry);
+                    bool result = EvaluatePrepared(*cached_geometry, *query);
 
                     if (result) {
                         refined.set(pos);
@@ -570,7 +698,7 @@ PhyGISFunctionFilterExpr::EvalForIndexSegment() {
                     const auto& wkb_data = geometry_array->data(i);
                     Geometry left(local_ctx, wkb_data.data(), wkb_data.size());
                     // Use prepared geometry for faster evaluation
-                    bool result = evaluate_geometry_prepared(left);
+                    bool result = EvaluatePrepared(left, *query);
 
                     if (result) {
                         refined.set(pos);
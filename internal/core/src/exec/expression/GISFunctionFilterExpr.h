@@ -19,6 +19,7 @@
 #include <utility>
 #include <vector>
 
+#include "common/GeometryCache.h"
 #include "common/OpContext.h"
 #include "common/Types.h"
 #include "common/Vector.h"
@@ -88,6 +89,22 @@ class PhyGISFunctionFilterExpr : public SegmentExpr {
     VectorPtr
     EvalForDataSegment();
 
+    // Evaluates the filter op of `left` against `query`, through the
+    // prepared query geometry where the op has a prepared form.
+    bool
+    EvaluatePrepared(const Geometry& left, const QueryGeometry& query) const;
+
+    // Evaluates the rows at `segment_offsets` from the geometry cache of
+    // the segment, as coordinate arithmetic when the column holds points.
+    void
+    EvalOnGeometryCache(const SimpleGeometryCache& cache,
+                        const bool* valid_data,
+                        const int32_t* segment_offsets,
+                        int size,
+                        TargetBitmapView res,
+                        TargetBitmapView valid_res,
+                        const QueryGeometry& query) const;
+
  private:
     std::shared_ptr<const milvus::expr::GISFunctionFilterExpr> expr_;
 
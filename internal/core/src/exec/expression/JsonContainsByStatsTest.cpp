@@ -344,3 +344,85 @@ TEST(JsonStatsUnaryRangeTest, NotEqualKeepsJsonPathErrorsButMasksFieldNull) {
     EXPECT_FALSE(result[7]);
     EXPECT_EQ(result.count(), 6);
 }
+
+TEST(JsonStatsSubJsonTest, ExtractsTypedKeysFromShredding) {
+    auto schema = std::make_shared<Schema>();
+    auto json_fid = schema->AddDebugField("json", DataType::JSON);
+
+    auto segment = segcore::CreateSealedSegment(schema);
+
+    const int N = 1000;
+    std::vector<std::string> json_raw_data;
+    json_raw_data.reserve(N);
+    for (int i = 0; i < N; ++i) {
+        nlohmann::json row;
+        row["i"] = i - 500;
+        row["s"] = i % 10 == 0 ? "" : "v\"" + std::to_string(i);
+        row["d"] = i % 3 == 0 ? 1.0 : i * 0.25 + 0.5;
+        row["b"] = i % 2 == 0;
+        if (i % 4 != 0) {
+            // present in most rows only
+            row["m"] = i;
+        }
+        // mixed types are not in a typed column
+        if (i % 2 == 0) {
+            row["x"] = i;
+        } else {
+            row["x"] = std::to_string(i);
+        }
+        json_raw_data.emplace_back(row.dump());
+    }
+
+    auto stats = BuildAndLoadJsonKeyStats(json_raw_data,
+                                          json_fid,
+                                          TestLocalPath,
+                                          1201,
+                                          2201,
+                                          3201,
+                                          json_fid.get(),
+                                          5201,
+                                          1);
+    EXPECT_FALSE(stats->GetTypedShreddingField("/i").empty());
+    EXPECT_FALSE(stats->GetTypedShreddingField("/s").empty());
+    EXPECT_TRUE(stats->GetTypedShreddingField("/x").empty());
+    segment->LoadJsonStats(json_fid, stats);
+
+    std::vector<milvus::Json> jsons;
+    for (auto& s : json_raw_data) {
+        jsons.emplace_back(simdjson::padded_string(s));
+    }
+    auto json_field =
+        std::make_shared<FieldData<milvus::Json>>(DataType::JSON, false);
+    json_field->add_json_data(jsons);
+    auto cm = milvus::storage::RemoteChunkManagerSingleton::GetInstance()
+                  .GetRemoteChunkManager();
+    auto load_info = PrepareSingleFieldInsertBinlog(
+        0, 0, 0, json_fid.get(), {json_field}, cm);
+    segment->LoadFieldData(load_info);
+
+    std::vector<int64_t> offsets;
+    for (int64_t i = N - 1; i >= 0; i -= 7) {
+        offsets.push_back(i);
+    }
+    std::vector<std::vector<std::string>> key_sets{
+        {"i", "s", "d", "b", "m"}, {"m", "i", "m"}, {"i", "x"}};
+    milvus::OpContext op_ctx;
+    for (const auto& keys : key_sets) {
+        auto result = segment->bulk_subscript(
+            &op_ctx, json_fid, offsets.data(), offsets.size(), keys);
+        const auto& data = result->scalars().json_data().data();
+        ASSERT_EQ(data.size(), offsets.size());
+        for (size_t i = 0; i < offsets.size(); ++i) {
+            auto expected = ExtractSubJson(json_raw_data[offsets[i]], keys);
+            EXPECT_EQ(nlohmann::json::parse(data[i]),
+                      nlohmann::json::parse(expected))
+                << data[i] << " vs " << expected;
+        }
+    }
+    // a double stays a float
+    auto result = segment->bulk_subscript(
+        &op_ctx, json_fid, offsets.data(), 1, std::vector<std::string>{"d"});
+    EXPECT_TRUE(
+        nlohmann::json::parse(result->scalars().json_data().data(0))["d"]
+            .is_number_float());
+}
@@ -147,9 +147,7 @@ PhyJsonContainsFilterExpr::Eval(EvalCtx& context, VectorPtr& result) {
                 TargetBitmap(real_batch_size, true),
                 TargetBitmap(real_batch_size, true));
         } else {
-            result = std::make_shared<ColumnVector>(
-                TargetBitmap(real_batch_size, false),
-                TargetBitmap(real_batch_size, true));
+            result = NewBitmapColumn(real_batch_size);
         }
         MoveCursor();
         return;
@@ -338,9 +336,7 @@ PhyJsonContainsFilterExpr::ExecArrayContains(EvalCtx& context) {
     AssertInfo(expr_->column_.nested_path_.size() == 0,
                "[ExecArrayContains]nested path must be null");
 
-    auto res_vec =
-        std::make_shared<ColumnVector>(TargetBitmap(real_batch_size, false),
-                                       TargetBitmap(real_batch_size, true));
+    auto res_vec = NewBitmapColumn(real_batch_size);
     TargetBitmapView res(res_vec->GetRawData(), real_batch_size);
     TargetBitmapView valid_res(res_vec->GetValidRawData(), real_batch_size);
 
@@ -351,14 +347,22 @@ PhyJsonContainsFilterExpr::ExecArrayContains(EvalCtx& context) {
             elements->insert(GetValueWithCastNumber<ExprValueType>(val));
         }
         arg_cached_set_ = elements;
+        if constexpr (std::is_same_v<ExprValueType, int64_t> ||
+                      std::is_same_v<ExprValueType, double>) {
+            arg_flat_contains_ = ArrayFlatContains::Make(
+                expr_->column_.element_type_,
+                std::vector<ExprValueType>(elements->begin(),
+                                           elements->end()));
+        }
         arg_inited_ = true;
     }
     auto elements = std::static_pointer_cast<TypedSet>(arg_cached_set_);
+    const auto* flat_contains = arg_flat_contains_.get();
 
     int processed_cursor = 0;
     auto execute_sub_batch =
-        [&processed_cursor, &
-         bitmap_input ]<FilterType filter_type = FilterType::sequential>(
+        [&processed_cursor, &bitmap_input, flat_contains ]<
+            FilterType filter_type = FilterType::sequential>(
             const milvus::ArrayView* data,
             const bool* valid_data,
             const int32_t* offsets,
@@ -372,6 +376,24 @@ PhyJsonContainsFilterExpr::ExecArrayContains(EvalCtx& context) {
             processed_cursor += size;
             return;
         }
+        bool has_bitmap_input = !bitmap_input.empty();
+        if constexpr (filter_type == FilterType::sequential) {
+            // all rows at once over the flat elements, the null rows and
+            // those out of bitmap_input are cleared after
+            if (flat_contains != nullptr) {
+                flat_contains->Eval(data, size, res);
+                for (int i = 0; i < size; ++i) {
+                    if (valid_data != nullptr && !valid_data[i]) {
+                        res[i] = valid_res[i] = false;
+                    } else if (has_bitmap_input &&
+                               !bitmap_input[processed_cursor + i]) {
+                        res[i] = false;
+                    }
+                }
+                processed_cursor += size;
+                return;
+            }
+        }
         auto executor = [&](size_t i) {
             const auto& array = data[i];
             for (int j = 0; j < array.length(); ++j) {
@@ -382,7 +404,6 @@ PhyJsonContainsFilterExpr::ExecArrayContains(EvalCtx& context) {
             }
             return false;
         };
-        bool has_bitmap_input = !bitmap_input.empty();
         for (int i = 0; i < size; ++i) {
             auto offset = i;
             if constexpr (filter_type == FilterType::random) {
@@ -449,13 +470,12 @@ PhyJsonContainsFilterExpr::ExecJsonContains(EvalCtx& context) {
         return nullptr;
     }
 
-    auto res_vec =
-        std::make_shared<ColumnVector>(TargetBitmap(real_batch_size, false),
-                                       TargetBitmap(real_batch_size, true));
+    auto res_vec = NewBitmapColumn(real_batch_size);
     TargetBitmapView res(res_vec->GetRawData(), real_batch_size);
     TargetBitmapView valid_res(res_vec->GetValidRawData(), real_batch_size);
 
-    auto pointer = milvus::Json::pointer(expr_->column_.nested_path_);
+    milvus::JsonPointer pointer(
+        milvus::Json::pointer(expr_->column_.nested_path_));
     if (!arg_inited_) {
         arg_set_ = std::make_shared<SetElement<GetType>>(expr_->vals_);
         arg_inited_ = true;
@@ -471,7 +491,7 @@ PhyJsonContainsFilterExpr::ExecJsonContains(EvalCtx& context) {
             const int size,
             TargetBitmapView res,
             TargetBitmapView valid_res,
-            const std::string& pointer,
+            const milvus::JsonPointer& pointer,
             const std::shared_ptr<MultiElement>& elements) {
         // If data is nullptr, this chunk was skipped by SkipIndex.
         // We only need to update processed_cursor for bitmap_input indexing.
@@ -481,7 +501,7 @@ PhyJsonContainsFilterExpr::ExecJsonContains(EvalCtx& context) {
         }
         auto executor = [&](size_t i) {
             auto doc = data[i].doc();
-            auto array = doc.at_pointer(pointer).get_array();
+            auto array = pointer.Find(doc).get_array();
             if (array.error()) {
                 return false;
             }
@@ -583,9 +603,7 @@ PhyJsonContainsFilterExpr::ExecJsonContainsByStats() {
 
     if (arg_set_->Empty()) {
         MoveCursor();
-        return std::make_shared<ColumnVector>(
-            TargetBitmap(real_batch_size, false),
-            TargetBitmap(real_batch_size, true));
+        return NewBitmapColumn(real_batch_size);
     }
 
     if (cached_index_chunk_id_ != 0 && TryCacheGet()) {
@@ -695,13 +713,12 @@ PhyJsonContainsFilterExpr::ExecJsonContainsArray(EvalCtx& context) {
         return nullptr;
     }
 
-    auto res_vec =
-        std::make_shared<ColumnVector>(TargetBitmap(real_batch_size, false),
-                                       TargetBitmap(real_batch_size, true));
+    auto res_vec = NewBitmapColumn(real_batch_size);
     TargetBitmapView res(res_vec->GetRawData(), real_batch_size);
     TargetBitmapView valid_res(res_vec->GetValidRawData(), real_batch_size);
 
-    auto pointer = milvus::Json::pointer(expr_->column_.nested_path_);
+    milvus::JsonPointer pointer(
+        milvus::Json::pointer(expr_->column_.nested_path_));
     if (!arg_inited_) {
         auto elements = std::make_shared<std::vector<proto::plan::Array>>();
         for (auto const& element : expr_->vals_) {
@@ -724,7 +741,7 @@ PhyJsonContainsFilterExpr::ExecJsonContainsArray(EvalCtx& context) {
             const int size,
             TargetBitmapView res,
             TargetBitmapView valid_res,
-            const std::string& pointer,
+            const milvus::JsonPointer& pointer,
             const std::vector<proto::plan::Array>& elements) {
         // If data is nullptr, this chunk was skipped by SkipIndex.
         // We only need to update processed_cursor for bitmap_input indexing.
@@ -734,7 +751,7 @@ PhyJsonContainsFilterExpr::ExecJsonContainsArray(EvalCtx& context) {
         }
         auto executor = [&](size_t i) -> bool {
             auto doc = data[i].doc();
-            auto array = doc.at_pointer(pointer).get_array();
+            auto array = pointer.Find(doc).get_array();
             if (array.error()) {
                 return false;
             }
@@ -815,9 +832,7 @@ PhyJsonContainsFilterExpr::ExecJsonContainsArrayByStats() {
     }
     if (elements.empty()) {
         MoveCursor();
-        return std::make_shared<ColumnVector>(
-            TargetBitmap(real_batch_size, false),
-            TargetBitmap(real_batch_size, true));
+        return NewBitmapColumn(real_batch_size);
     }
 
     if (cached_index_chunk_id_ != 0 && TryCacheGet()) {
@@ -913,9 +928,7 @@ PhyJsonContainsFilterExpr::ExecArrayContainsAll(EvalCtx& context) {
         return nullptr;
     }
 
-    auto res_vec =
-        std::make_shared<ColumnVector>(TargetBitmap(real_batch_size, false),
-                                       TargetBitmap(real_batch_size, true));
+    auto res_vec = NewBitmapColumn(real_batch_size);
     TargetBitmapView res(res_vec->GetRawData(), real_batch_size);
     TargetBitmapView valid_res(res_vec->GetValidRawData(), real_batch_size);
 
@@ -1044,13 +1057,12 @@ PhyJsonContainsFilterExpr::ExecJsonContainsAll(EvalCtx& context) {
         return nullptr;
     }
 
-    auto res_vec =
-        std::make_shared<ColumnVector>(TargetBitmap(real_batch_size, false),
-                                       TargetBitmap(real_batch_size, true));
+    auto res_vec = NewBitmapColumn(real_batch_size);
     TargetBitmapView res(res_vec->GetRawData(), real_batch_size);
     TargetBitmapView valid_res(res_vec->GetValidRawData(), real_batch_size);
 
-    auto pointer = milvus::Json::pointer(expr_->column_.nested_path_);
+    milvus::JsonPointer pointer(
+        milvus::Json::pointer(expr_->column_.nested_path_));
     if (!arg_inited_) {
         auto elements = std::make_shared<std::set<GetType>>();
         for (auto const& element : expr_->vals_) {
@@ -1075,7 +1087,7 @@ PhyJsonContainsFilterExpr::ExecJsonContainsAll(EvalCtx& context) {
             const int size,
             TargetBitmapView res,
             TargetBitmapView valid_res,
-            const std::string& pointer,
+            const milvus::JsonPointer& pointer,
             const std::set<GetType>& elements) {
         // If data is nullptr, this chunk was skipped by SkipIndex.
         // We only need to update processed_cursor for bitmap_input indexing.
@@ -1085,7 +1097,7 @@ PhyJsonContainsFilterExpr::ExecJsonContainsAll(EvalCtx& context) {
         }
         auto executor = [&](const size_t i) -> bool {
             auto doc = data[i].doc();
-            auto array = doc.at_pointer(pointer).get_array();
+            auto array = pointer.Find(doc).get_array();
             if (array.error()) {
                 return false;
             }
@@ -1212,9 +1224,7 @@ PhyJsonContainsFilterExpr::ExecJsonContainsAllByStats() {
         std::static_pointer_cast<std::set<GetType>>(arg_cached_set_);
     if (elements->empty()) {
         MoveCursor();
-        return std::make_shared<ColumnVector>(
-            TargetBitmap(real_batch_size, false),
-            TargetBitmap(real_batch_size, true));
+        return NewBitmapColumn(real_batch_size);
     }
 
     if (cached_index_chunk_id_ != 0 && TryCacheGet()) {
@@ -1374,13 +1384,12 @@ PhyJsonContainsFilterExpr::ExecJsonContainsAllWithDiffType(EvalCtx& context) {
     if (real_batch_size == 0) {
         return nullptr;
     }
-    auto res_vec =
-        std::make_shared<ColumnVector>(TargetBitmap(real_batch_size, false),
-                                       TargetBitmap(real_batch_size, true));
+    auto res_vec = NewBitmapColumn(real_batch_size);
     TargetBitmapView res(res_vec->GetRawData(), real_batch_size);
     TargetBitmapView valid_res(res_vec->GetValidRawData(), real_batch_size);
 
-    auto pointer = milvus::Json::pointer(expr_->column_.nested_path_);
+    milvus::JsonPointer pointer(
+        milvus::Json::pointer(expr_->column_.nested_path_));
 
     const auto& elements = expr_->vals_;
     std::unordered_set<int> elements_index;
@@ -1398,7 +1407,7 @@ PhyJsonContainsFilterExpr::ExecJsonContainsAllWithDiffType(EvalCtx& context) {
             const int size,
             TargetBitmapView res,
             TargetBitmapView valid_res,
-            const std::string& pointer,
+            const milvus::JsonPointer& pointer,
             const std::vector<proto::plan::GenericValue>& elements,
             const std::unordered_set<int>& elements_index) {
         // If data is nullptr, this chunk was skipped by SkipIndex.
@@ -1409,8 +1418,7 @@ PhyJsonContainsFilterExpr::ExecJsonContainsAllWithDiffType(EvalCtx& context) {
         }
         auto executor = [&](size_t i) -> bool {
             const auto& json = data[i];
-            auto doc = json.dom_doc();
-            auto array = doc.at_pointer(pointer).get_array();
+            auto array = json.array_at(pointer);
             if (array.error()) {
                 return false;
             }
@@ -1550,9 +1558,7 @@ PhyJsonContainsFilterExpr::ExecJsonContainsAllWithDiffTypeByStats() {
     }
     if (elements.empty()) {
         MoveCursor();
-        return std::make_shared<ColumnVector>(
-            TargetBitmap(real_batch_size, false),
-            TargetBitmap(real_batch_size, true));
+        return NewBitmapColumn(real_batch_size);
     }
 
     if (cached_index_chunk_id_ != 0 && TryCacheGet()) {
@@ -1724,13 +1730,12 @@ PhyJsonContainsFilterExpr::ExecJsonContainsAllArray(EvalCtx& context) {
         return nullptr;
     }
 
-    auto res_vec =
-        std::make_shared<ColumnVector>(TargetBitmap(real_batch_size, false),
-                                       TargetBitmap(real_batch_size, true));
+    auto res_vec = NewBitmapColumn(real_batch_size);
     TargetBitmapView res(res_vec->GetRawData(), real_batch_size);
     TargetBitmapView valid_res(res_vec->GetValidRawData(), real_batch_size);
 
-    auto pointer = milvus::Json::pointer(expr_->column_.nested_path_);
+    milvus::JsonPointer pointer(
+        milvus::Json::pointer(expr_->column_.nested_path_));
 
     std::vector<proto::plan::Array> elements;
     elements.reserve(expr_->vals_.size());
@@ -1748,7 +1753,7 @@ PhyJsonContainsFilterExpr::ExecJsonContainsAllArray(EvalCtx& context) {
             const int size,
             TargetBitmapView res,
             TargetBitmapView valid_res,
-            const std::string& pointer,
+            const milvus::JsonPointer& pointer,
             const std::vector<proto::plan::Array>& elements) {
         // If data is nullptr, this chunk was skipped by SkipIndex.
         // We only need to update processed_cursor for bitmap_input indexing.
@@ -1758,7 +1763,7 @@ PhyJsonContainsFilterExpr::ExecJsonContainsAllArray(EvalCtx& context) {
         }
         auto executor = [&](const size_t i) {
             auto doc = data[i].doc();
-            auto array = doc.at_pointer(pointer).get_array();
+            auto array = pointer.Find(doc).get_array();
             if (array.error()) {
                 return false;
             }
@@ -1844,9 +1849,7 @@ PhyJsonContainsFilterExpr::ExecJsonContainsAllArrayByStats() {
     }
     if (elements.empty()) {
         MoveCursor();
-        return std::make_shared<ColumnVector>(
-            TargetBitmap(real_batch_size, false),
-            TargetBitmap(real_batch_size, true));
+        return NewBitmapColumn(real_batch_size);
     }
 
     if (cached_index_chunk_id_ != 0 && TryCacheGet()) {
@@ -1954,13 +1957,12 @@ PhyJsonContainsFilterExpr::ExecJsonContainsWithDiffType(EvalCtx& context) {
         return nullptr;
     }
 
-    auto res_vec =
-        std::make_shared<ColumnVector>(TargetBitmap(real_batch_size, false),
-                                       TargetBitmap(real_batch_size, true));
+    auto res_vec = NewBitmapColumn(real_batch_size);
     TargetBitmapView res(res_vec->GetRawData(), real_batch_size);
     TargetBitmapView valid_res(res_vec->GetValidRawData(), real_batch_size);
 
-    auto pointer = milvus::Json::pointer(expr_->column_.nested_path_);
+    milvus::JsonPointer pointer(
+        milvus::Json::pointer(expr_->column_.nested_path_));
 
     const auto& elements = expr_->vals_;
 
@@ -1974,7 +1976,7 @@ PhyJsonContainsFilterExpr::ExecJsonContainsWithDiffType(EvalCtx& context) {
             const int size,
             TargetBitmapView res,
             TargetBitmapView valid_res,
-            const std::string& pointer,
+            const milvus::JsonPointer& pointer,
             const std::vector<proto::plan::GenericValue>& elements) {
         // If data is nullptr, this chunk was skipped by SkipIndex.
         // We only need to update processed_cursor for bitmap_input indexing.
@@ -1984,8 +1986,7 @@ PhyJsonContainsFilterExpr::ExecJsonContainsWithDiffType(EvalCtx& context) {
         }
         auto executor = [&](const size_t i) {
             auto& json = data[i];
-            auto doc = json.dom_doc();
-            auto array = doc.at_pointer(pointer).get_array();
+            auto array = json.array_at(pointer);
             if (array.error()) {
                 return false;
             }
@@ -2111,9 +2112,7 @@ PhyJsonContainsFilterExpr::ExecJsonContainsWithDiffTypeByStats() {
     const auto& elements = expr_->vals_;
     if (elements.empty()) {
         MoveCursor();
-        return std::make_shared<ColumnVector>(
-            TargetBitmap(real_batch_size, false),
-            TargetBitmap(real_batch_size, true));
+        return NewBitmapColumn(real_batch_size);
     }
 
     if (cached_index_chunk_id_ != 0 && TryCacheGet()) {
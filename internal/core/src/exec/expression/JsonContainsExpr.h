@@ -21,6 +21,7 @@
 #include "common/EasyAssert.h"
 #include "common/Types.h"
 #include "common/Vector.h"
+#include "exec/expression/ArrayFlatContains.h"
 #include "exec/expression/Expr.h"
 #include "exec/expression/Element.h"
 #include "segcore/SegmentInterface.h"
@@ -572,6 +573,8 @@ class PhyJsonContainsFilterExpr : public SegmentExpr {
     std::shared_ptr<MultiElement> arg_set_double_;
     std::shared_ptr<void>
         arg_cached_set_;  // For caching std::set<T> or std::vector<T>
+    // the values of array contains over numeric elements, nullptr otherwise
+    std::shared_ptr<const ArrayFlatContains> arg_flat_contains_;
     PinWrapper<index::BsonInvertedIndex*> bson_index_{nullptr};
 };
 }  //namespace exec
@@ -110,6 +110,12 @@ class PhyLogicalBinaryExpr : public Expr {
                inputs_[1]->CanExecuteAllAtOnce();
     }
 
+    bool
+    SupportsMorselEval() const override {
+        return inputs_[0]->SupportsMorselEval() &&
+               inputs_[1]->SupportsMorselEval();
+    }
+
     void
     SetExecuteAllAtOnce() override {
         inputs_[0]->SetExecuteAllAtOnce();
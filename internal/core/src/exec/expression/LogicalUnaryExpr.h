@@ -73,6 +73,11 @@ class PhyLogicalUnaryExpr : public Expr {
         return inputs_[0]->CanExecuteAllAtOnce();
     }
 
+    bool
+    SupportsMorselEval() const override {
+        return inputs_[0]->SupportsMorselEval();
+    }
+
     void
     SetExecuteAllAtOnce() override {
         inputs_[0]->SetExecuteAllAtOnce();
@@ -0,0 +1,264 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "exec/expression/MultiLikeExpr.h"
+
+#include <map>
+#include <string_view>
+#include <utility>
+
+#include "common/EasyAssert.h"
+#include "common/Tracer.h"
+#include "exec/BitmapPool.h"
+#include "exec/QueryContext.h"
+#include "exec/expression/UnaryExpr.h"
+#include "exec/expression/Utils.h"
+#include "opentelemetry/trace/span.h"
+#include "storage/MmapManager.h"
+
+namespace milvus {
+namespace exec {
+
+namespace {
+
+std::optional<MultiLikeMatcher::Kind>
+PatternKind(proto::plan::OpType op_type) {
+    switch (op_type) {
+        case proto::plan::Match:
+            return MultiLikeMatcher::Kind::Like;
+        case proto::plan::PrefixMatch:
+            return MultiLikeMatcher::Kind::Prefix;
+        case proto::plan::PostfixMatch:
+            return MultiLikeMatcher::Kind::Postfix;
+        case proto::plan::InnerMatch:
+            return MultiLikeMatcher::Kind::Contains;
+        default:
+            return std::nullopt;
+    }
+}
+
+using UnaryExprs =
+    std::vector<std::shared_ptr<const milvus::expr::UnaryRangeFilterExpr>>;
+
+std::vector<std::pair<MultiLikeMatcher::Kind, std::string>>
+ToPatterns(const UnaryExprs& exprs) {
+    std::vector<std::pair<MultiLikeMatcher::Kind, std::string>> patterns;
+    patterns.reserve(exprs.size());
+    for (const auto& expr : exprs) {
+        auto kind = PatternKind(expr->op_type_);
+        AssertInfo(kind.has_value(),
+                   "multi like expr got non pattern operator {}",
+                   expr->op_type_);
+        patterns.emplace_back(*kind,
+                              GetValueFromProto<std::string>(expr->val_));
+    }
+    return patterns;
+}
+
+}  // namespace
+
+PhyMultiLikeFilterExpr::PhyMultiLikeFilterExpr(
+    std::vector<std::shared_ptr<const milvus::expr::UnaryRangeFilterExpr>>
+        exprs,
+    milvus::OpContext* op_ctx,
+    const segcore::SegmentInternalInterface* segment,
+    int64_t active_count,
+    int64_t batch_size,
+    int32_t consistency_level)
+    : SegmentExpr({},
+                  "PhyMultiLikeFilterExpr",
+                  op_ctx,
+                  segment,
+                  exprs.front()->column_.field_id_,
+                  exprs.front()->column_.nested_path_,
+                  DataType::VARCHAR,
+                  active_count,
+                  batch_size,
+                  consistency_level),
+      exprs_(std::move(exprs)),
+      matcher_(ToPatterns(exprs_)) {
+    DetermineExecPath();
+    AssertInfo(exec_path_ == ExprExecPath::RawData,
+               "multi like expr only scans raw data");
+}
+
+bool
+PhyMultiLikeFilterExpr::CanFuse(
+    PhyUnaryRangeFilterExpr& expr,
+    const segcore::SegmentInternalInterface& segment) {
+    auto column = expr.GetColumnInfo().value();
+    // indexed columns answer each pattern from the index instead
+    return IsStringDataType(column.data_type_) && column.nested_path_.empty() &&
+           !column.element_level_ && !segment.HasIndex(column.field_id_) &&
+           PatternKind(expr.GetOpType()).has_value();
+}
+
+std::string
+PhyMultiLikeFilterExpr::ToString() const {
+    std::string patterns;
+    for (const auto& expr : exprs_) {
+        if (!patterns.empty()) {
+            patterns += ", ";
+        }
+        patterns += expr->ToString();
+    }
+    return fmt::format("PhyMultiLikeFilterExpr: [{}]", patterns);
+}
+
+void
+PhyMultiLikeFilterExpr::Eval(EvalCtx& context, VectorPtr& result) {
+    tracer::AutoSpan span(
+        "PhyMultiLikeFilterExpr::Eval", tracer::GetRootSpan(), true);
+    span.GetSpan()->SetAttribute("num_patterns",
+                                 static_cast<int>(exprs_.size()));
+
+    SetHasOffsetInput(context.get_offset_input() != nullptr);
+    if (segment_->type() == SegmentType::Growing &&
+        !storage::MmapManager::GetInstance()
+             .GetMmapConfig()
+             .growing_enable_mmap) {
+        result = ExecVisitorImpl<std::string>(context);
+    } else {
+        result = ExecVisitorImpl<std::string_view>(context);
+    }
+}
+
+template <typename T>
+VectorPtr
+PhyMultiLikeFilterExpr::ExecVisitorImpl(EvalCtx& context) {
+    auto* input = context.get_offset_input();
+    const auto& bitmap_input = context.get_bitmap_input();
+    auto real_batch_size = GetNextRealBatchSize(input, false);
+    if (real_batch_size == 0) {
+        return nullptr;
+    }
+
+    auto res_vec = NewBitmapColumn(real_batch_size);
+    TargetBitmapView res(res_vec->GetRawData(), real_batch_size);
+    TargetBitmapView valid_res(res_vec->GetValidRawData(), real_batch_size);
+
+    size_t processed_cursor = 0;
+    auto execute_sub_batch =
+        [this, &processed_cursor, &bitmap_input]<FilterType filter_type =
+                                                     FilterType::sequential>(
+            const T* data,
+            const bool* valid_data,
+            const int32_t* offsets,
+            const int size,
+            TargetBitmapView res,
+            TargetBitmapView valid_res) {
+        bool has_bitmap_input = !bitmap_input.empty();
+        for (int i = 0; i < size; ++i) {
+            if (has_bitmap_input && !bitmap_input[i + processed_cursor]) {
+                continue;
+            }
+            auto offset = i;
+            if constexpr (filter_type == FilterType::random) {
+                offset = offsets ? offsets[i] : i;
+            }
+            if (valid_data != nullptr && !valid_data[offset]) {
+                res[i] = valid_res[i] = false;
+                continue;
+            }
+            res[i] = matcher_(std::string_view(data[offset]));
+        }
+        processed_cursor += size;
+    };
+
+    int64_t processed_size;
+    if (input != nullptr) {
+        processed_size = ProcessDataByOffsets<T>(
+            execute_sub_batch, nullptr, input, res, valid_res);
+    } else if (bitmap_input.empty()) {
+        processed_size = ProcessDataChunksByDictionary<T>(
+            execute_sub_batch, nullptr, res, valid_res);
+    } else {
+        processed_size =
+            ProcessDataChunks<T>(execute_sub_batch, nullptr, res, valid_res);
+    }
+    AssertInfo(processed_size == real_batch_size,
+               "internal error: expr processed rows {} not equal "
+               "expect batch size {}",
+               processed_size,
+               real_batch_size);
+    return res_vec;
+}
+
+std::vector<ExprPtr>
+FuseLikeDisjuncts(std::vector<ExprPtr> inputs, QueryContext* context) {
+    auto* segment = context->get_segment();
+    if (segment == nullptr) {
+        return inputs;
+    }
+    // field id -> positions in inputs of the fusable predicates on it
+    std::map<int64_t, std::vector<size_t>> fusable;
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        if (inputs[i]->name() != "PhyUnaryRangeFilterExpr") {
+            continue;
+        }
+        auto unary =
+            std::static_pointer_cast<PhyUnaryRangeFilterExpr>(inputs[i]);
+        if (PhyMultiLikeFilterExpr::CanFuse(*unary, *segment)) {
+            fusable[unary->GetColumnInfo()->field_id_.get()].push_back(i);
+        }
+    }
+
+    std::vector<ExprPtr> fused(inputs.size());
+    bool changed = false;
+    for (const auto& [field_id, positions] : fusable) {
+        if (positions.size() < 2) {
+            continue;
+        }
+        std::vector<std::shared_ptr<const milvus::expr::UnaryRangeFilterExpr>>
+            exprs;
+        exprs.reserve(positions.size());
+        for (auto pos : positions) {
+            exprs.push_back(
+                std::static_pointer_cast<PhyUnaryRangeFilterExpr>(inputs[pos])
+                    ->GetLogicalExpr());
+        }
+        // the fused expression takes the place of the first predicate
+        fused[positions.front()] = std::make_shared<PhyMultiLikeFilterExpr>(
+            std::move(exprs),
+            context->get_op_context(),
+            segment,
+            context->get_active_count(),
+            context->query_config()->get_expr_batch_size(),
+            context->get_consistency_level());
+        for (auto pos : positions) {
+            inputs[pos] = nullptr;
+        }
+        changed = true;
+    }
+    if (!changed) {
+        return inputs;
+    }
+
+    std::vector<ExprPtr> result;
+    result.reserve(inputs.size());
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        if (fused[i] != nullptr) {
+            result.push_back(std::move(fused[i]));
+        } else if (inputs[i] != nullptr) {
+            result.push_back(std::move(inputs[i]));
+        }
+    }
+    return result;
+}
+
+}  // namespace exec
+}  // namespace milvus
@@ -0,0 +1,92 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <fmt/core.h>
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "common/MultiLikeMatcher.h"
+#include "common/Types.h"
+#include "common/Vector.h"
+#include "exec/expression/Expr.h"
+#include "expr/ITypeExpr.h"
+#include "segcore/SegmentInterface.h"
+
+namespace milvus {
+namespace exec {
+
+class PhyUnaryRangeFilterExpr;
+
+// PhyMultiLikeFilterExpr evaluates the LIKE predicates OR'ed together on
+// one unindexed string column in a single scan: each row is matched against
+// all the patterns at once by a MultiLikeMatcher instead of being read once
+// per pattern.
+class PhyMultiLikeFilterExpr : public SegmentExpr {
+ public:
+    PhyMultiLikeFilterExpr(
+        std::vector<std::shared_ptr<const milvus::expr::UnaryRangeFilterExpr>>
+            exprs,
+        milvus::OpContext* op_ctx,
+        const segcore::SegmentInternalInterface* segment,
+        int64_t active_count,
+        int64_t batch_size,
+        int32_t consistency_level);
+
+    // Whether `expr` can be part of a PhyMultiLikeFilterExpr
+    static bool
+    CanFuse(PhyUnaryRangeFilterExpr& expr,
+            const segcore::SegmentInternalInterface& segment);
+
+    void
+    Eval(EvalCtx& context, VectorPtr& result) override;
+
+    std::string
+    ToString() const override;
+
+    bool
+    IsSource() const override {
+        return true;
+    }
+
+    std::optional<milvus::expr::ColumnInfo>
+    GetColumnInfo() const override {
+        return exprs_.front()->column_;
+    }
+
+ private:
+    template <typename T>
+    VectorPtr
+    ExecVisitorImpl(EvalCtx& context);
+
+    std::vector<std::shared_ptr<const milvus::expr::UnaryRangeFilterExpr>>
+        exprs_;
+    MultiLikeMatcher matcher_;
+};
+
+// Replaces the LIKE predicates among the inputs of an OR that CanFuse()
+// accepts with one PhyMultiLikeFilterExpr per column, when a column has at
+// least two of them.
+std::vector<ExprPtr>
+FuseLikeDisjuncts(std::vector<ExprPtr> inputs, QueryContext* context);
+
+}  // namespace exec
+}  // namespace milvus
@@ -0,0 +1,155 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/Common.h"
+#include "common/Schema.h"
+#include "common/Types.h"
+#include "exec/QueryContext.h"
+#include "exec/expression/Expr.h"
+#include "expr/ITypeExpr.h"
+#include "knowhere/comp/index_param.h"
+#include "query/ExecPlanNodeVisitor.h"
+#include "segcore/SegmentGrowingImpl.h"
+#include "test_utils/DataGen.h"
+#include "test_utils/GenExprProto.h"
+#include "test_utils/storage_test_utils.h"
+
+using namespace milvus;
+using namespace milvus::segcore;
+
+namespace {
+
+expr::TypedExprPtr
+Pattern(FieldId field_id, proto::plan::OpType op, const std::string& value) {
+    proto::plan::GenericValue val;
+    val.set_string_val(value);
+    return std::make_shared<expr::UnaryRangeFilterExpr>(
+        expr::ColumnInfo(field_id, DataType::VARCHAR), op, val);
+}
+
+expr::TypedExprPtr
+Or(const expr::TypedExprPtr& left, const expr::TypedExprPtr& right) {
+    return std::make_shared<expr::LogicalBinaryExpr>(
+        expr::LogicalBinaryExpr::OpType::Or, left, right);
+}
+
+bool
+Reference(const std::string& s, int64_t pk) {
+    auto contains = s.find("12") != std::string::npos;
+    auto prefix = s.rfind("3", 0) == 0;
+    auto postfix = !s.empty() && s.back() == '7';
+    bool like = false;
+    for (size_t i = 0; i + 2 < s.size(); ++i) {
+        like = like || (s[i] == '4' && s[i + 2] == '5');
+    }
+    return contains || prefix || postfix || like || pk < 10;
+}
+
+class MultiLikeExprTest : public ::testing::Test {
+ protected:
+    void
+    SetUp() override {
+        schema_ = std::make_shared<Schema>();
+        schema_->AddDebugField(
+            "fakevec", DataType::VECTOR_FLOAT, 16, knowhere::metric::L2);
+        pk_fid_ = schema_->AddDebugField("pk", DataType::INT64);
+        str_fid_ = schema_->AddDebugField("str", DataType::VARCHAR);
+        schema_->set_primary_field_id(pk_fid_);
+
+        // str like '%12%' or str like '3%' or str like '%7'
+        //     or str like '%4_5%' or pk < 10
+        proto::plan::GenericValue ten;
+        ten.set_int64_val(10);
+        expr_ = Or(
+            Or(Or(Pattern(str_fid_, proto::plan::InnerMatch, "12"),
+                  Pattern(str_fid_, proto::plan::PrefixMatch, "3")),
+               Or(Pattern(str_fid_, proto::plan::PostfixMatch, "7"),
+                  Pattern(str_fid_, proto::plan::Match, "%4_5%"))),
+            std::make_shared<expr::UnaryRangeFilterExpr>(
+                expr::ColumnInfo(pk_fid_, DataType::INT64),
+                proto::plan::LessThan,
+                ten));
+    }
+
+    void
+    CheckSegment(const SegmentInternalInterface* segment,
+                 const GeneratedData& raw_data,
+                 int64_t n) {
+        auto str_col = raw_data.get_col<std::string>(str_fid_);
+        auto pk_col = raw_data.get_col<int64_t>(pk_fid_);
+
+        // the four patterns on str become one input of the OR
+        auto query_context = std::make_shared<exec::QueryContext>(
+            DEAFULT_QUERY_ID, segment, n, MAX_TIMESTAMP);
+        exec::ExecContext exec_context(query_context.get());
+        exec::ExprSet expr_set({expr_}, &exec_context);
+        const auto& inputs = expr_set.exprs()[0]->GetInputsRef();
+        ASSERT_EQ(inputs.size(), 2);
+        EXPECT_TRUE(inputs[0]->name() == "PhyMultiLikeFilterExpr" ||
+                    inputs[1]->name() == "PhyMultiLikeFilterExpr");
+
+        auto plan = test::CreateRetrievePlanByExpr(expr_);
+        auto fused =
+            query::ExecuteQueryExpr(plan, segment, n, MAX_TIMESTAMP);
+        auto prev_optimize = OPTIMIZE_EXPR_ENABLED.load();
+        OPTIMIZE_EXPR_ENABLED.store(false);
+        auto separate =
+            query::ExecuteQueryExpr(plan, segment, n, MAX_TIMESTAMP);
+        OPTIMIZE_EXPR_ENABLED.store(prev_optimize);
+
+        ASSERT_EQ(fused.size(), n);
+        for (int64_t i = 0; i < n; ++i) {
+            auto expected = Reference(str_col[i], pk_col[i]);
+            ASSERT_EQ(fused[i], expected) << i << ": " << str_col[i];
+            ASSERT_EQ(separate[i], expected) << i << ": " << str_col[i];
+        }
+    }
+
+    SchemaPtr schema_;
+    FieldId pk_fid_;
+    FieldId str_fid_;
+    expr::TypedExprPtr expr_;
+};
+
+}  // namespace
+
+TEST_F(MultiLikeExprTest, Sealed) {
+    const int64_t n = 5000;
+    auto raw_data = DataGen(schema_, n);
+    auto segment = CreateSealedWithFieldDataLoaded(schema_, raw_data);
+    CheckSegment(segment.get(), raw_data, n);
+}
+
+TEST_F(MultiLikeExprTest, Growing) {
+    const int64_t n = 5000;
+    auto raw_data = DataGen(schema_, n);
+    auto segment = CreateGrowingSegment(schema_, empty_index_meta);
+    segment->PreInsert(n);
+    segment->Insert(0,
+                    n,
+                    raw_data.row_ids_.data(),
+                    raw_data.timestamps_.data(),
+                    raw_data.raw_);
+    CheckSegment(
+        dynamic_cast<SegmentInternalInterface*>(segment.get()), raw_data, n);
+}
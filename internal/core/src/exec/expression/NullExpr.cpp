@@ -146,12 +146,14 @@ PhyNullExpr::ExecVisitorImpl(OffsetVector* input) {
         (input != nullptr)
             ? ProcessChunksForValidByOffsets<T>(UseIndexCursor(), *input)
             : ProcessChunksForValid<T>(UseIndexCursor());
-    TargetBitmap res = valid_res.clone();
+    // the validity of the rows is the IS NOT NULL result as is
+    auto size = valid_res.size();
+    TargetBitmap res = std::move(valid_res);
     if (expr_->op_ == proto::plan::NullExpr_NullOp_IsNull) {
         res.flip();
     }
-    auto res_vec = std::make_shared<ColumnVector>(
-        std::move(res), TargetBitmap(valid_res.size(), true));
+    auto res_vec = std::make_shared<ColumnVector>(std::move(res),
+                                                  TargetBitmap(size, true));
     return res_vec;
 }
 
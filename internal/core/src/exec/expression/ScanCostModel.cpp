@@ -0,0 +1,152 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/expression/ScanCostModel.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+namespace milvus {
+namespace exec {
+
+namespace {
+
+enum class OrdinalKind { Integer, Real, String };
+
+struct Ordinal {
+    OrdinalKind kind;
+    double value;
+};
+
+// big-endian value of the first 8 bytes, so the order matches the strings'
+double
+StringOrdinal(std::string_view s) {
+    uint64_t prefix = 0;
+    for (size_t i = 0; i < sizeof(prefix); ++i) {
+        prefix <<= 8;
+        if (i < s.size()) {
+            prefix |= static_cast<unsigned char>(s[i]);
+        }
+    }
+    return static_cast<double>(prefix);
+}
+
+std::optional<Ordinal>
+ToOrdinal(const index::Metrics& metrics) {
+    return std::visit(
+        [](const auto& v) -> std::optional<Ordinal> {
+            using T = std::decay_t<decltype(v)>;
+            if constexpr (std::is_same_v<T, bool>) {
+                return std::nullopt;
+            } else if constexpr (std::is_integral_v<T>) {
+                return Ordinal{OrdinalKind::Integer, static_cast<double>(v)};
+            } else if constexpr (std::is_floating_point_v<T>) {
+                return Ordinal{OrdinalKind::Real, static_cast<double>(v)};
+            } else {
+                return Ordinal{OrdinalKind::String, StringOrdinal(v)};
+            }
+        },
+        metrics);
+}
+
+bool
+Comparable(OrdinalKind a, OrdinalKind b) {
+    return (a == OrdinalKind::String) == (b == OrdinalKind::String);
+}
+
+}  // namespace
+
+std::optional<index::Metrics>
+ToMetrics(const proto::plan::GenericValue& value) {
+    switch (value.val_case()) {
+        case proto::plan::GenericValue::kInt64Val:
+            return index::Metrics(value.int64_val());
+        case proto::plan::GenericValue::kFloatVal:
+            return index::Metrics(value.float_val());
+        case proto::plan::GenericValue::kStringVal:
+            return index::Metrics(value.string_val());
+        default:
+            return std::nullopt;
+    }
+}
+
+std::optional<double>
+EstimateChunkRangeFraction(const index::Metrics& min,
+                           const index::Metrics& max,
+                           const RangeBound& lower,
+                           const RangeBound& upper) {
+    auto lo = ToOrdinal(min);
+    auto hi = ToOrdinal(max);
+    if (!lo.has_value() || !hi.has_value() || hi->value < lo->value) {
+        return std::nullopt;
+    }
+    bool discrete = lo->kind == OrdinalKind::Integer;
+    double from = lo->value;
+    double to = hi->value;
+    if (lower.value.has_value()) {
+        auto bound = ToOrdinal(lower.value.value());
+        if (!bound.has_value() || !Comparable(bound->kind, lo->kind)) {
+            return std::nullopt;
+        }
+        auto v = bound->value;
+        if (discrete) {
+            // first integer the bound admits
+            v = lower.inclusive ? std::ceil(v) : std::floor(v) + 1;
+        }
+        from = std::max(from, v);
+    }
+    if (upper.value.has_value()) {
+        auto bound = ToOrdinal(upper.value.value());
+        if (!bound.has_value() || !Comparable(bound->kind, lo->kind)) {
+            return std::nullopt;
+        }
+        auto v = bound->value;
+        if (discrete) {
+            v = upper.inclusive ? std::floor(v) : std::ceil(v) - 1;
+        }
+        to = std::min(to, v);
+    }
+    if (discrete) {
+        if (to < from) {
+            return 0.0;
+        }
+        return (to - from + 1) / (hi->value - lo->value + 1);
+    }
+    if (hi->value == lo->value) {
+        // a single value: either entirely in the range or not at all
+        return from <= to ? 1.0 : 0.0;
+    }
+    return std::max(0.0, to - from) / (hi->value - lo->value);
+}
+
+bool
+PreferRawScanOverIndex(index::ScalarIndexType index_type,
+                       double selectivity,
+                       double threshold) {
+    switch (index_type) {
+        case index::ScalarIndexType::INVERTED:
+        case index::ScalarIndexType::MARISA:
+            return selectivity >= threshold;
+        default:
+            return false;
+    }
+}
+
+}  // namespace exec
+}  // namespace milvus
@@ -0,0 +1,68 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <optional>
+
+#include "index/ScalarIndex.h"
+#include "index/skipindex_stats/SkipIndexStats.h"
+#include "pb/plan.pb.h"
+
+namespace milvus {
+namespace exec {
+
+// Cost model choosing between a scalar index lookup and a scan of the loaded
+// raw column for one range predicate on one segment.
+//
+// The selectivity estimate comes from the per-chunk min/max the skip index
+// keeps anyway: within a chunk the values are taken to be spread uniformly
+// over [min, max], so the part of that interval a range covers is the part
+// of the chunk's rows it matches. Integers are counted as discrete values,
+// strings are placed on a line by their first 8 bytes.
+
+// One side of a range predicate, nullopt for an open side.
+struct RangeBound {
+    std::optional<index::Metrics> value;
+    bool inclusive{true};
+};
+
+// The bound value of a plan literal, nullopt for kinds the model does not
+// interpolate over (bool, array, ...).
+std::optional<index::Metrics>
+ToMetrics(const proto::plan::GenericValue& value);
+
+// Estimated fraction of the rows of a chunk whose values span [min, max]
+// that fall in [lower, upper]. nullopt when the bounds and the chunk values
+// are of kinds that cannot be compared (e.g. a string bound on an int chunk).
+std::optional<double>
+EstimateChunkRangeFraction(const index::Metrics& min,
+                           const index::Metrics& max,
+                           const RangeBound& lower,
+                           const RangeBound& upper);
+
+// Whether scanning the raw column is expected to be cheaper than a lookup in
+// an index of `index_type` for a predicate matching `selectivity` of the
+// rows. Only INVERTED and MARISA pay per matched row (posting lists, trie
+// keys) enough to lose against a SIMD scan; the other index types produce
+// wide results cheaply and always keep the index.
+bool
+PreferRawScanOverIndex(index::ScalarIndexType index_type,
+                       double selectivity,
+                       double threshold);
+
+}  // namespace exec
+}  // namespace milvus
@@ -0,0 +1,126 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <string>
+
+#include "exec/expression/ScanCostModel.h"
+
+using namespace milvus;
+using namespace milvus::exec;
+
+TEST(ScanCostModel, IntegerRange) {
+    index::Metrics min = int32_t(0);
+    index::Metrics max = int32_t(99);
+    RangeBound open;
+
+    // values are counted as discrete, [0, 99] holds 100 of them
+    EXPECT_DOUBLE_EQ(
+        EstimateChunkRangeFraction(min, max, open, open).value(), 1.0);
+    EXPECT_DOUBLE_EQ(EstimateChunkRangeFraction(
+                         min, max, {int64_t(50), true}, open)
+                         .value(),
+                     0.5);
+    EXPECT_DOUBLE_EQ(EstimateChunkRangeFraction(
+                         min, max, {int64_t(49), false}, open)
+                         .value(),
+                     0.5);
+    EXPECT_DOUBLE_EQ(EstimateChunkRangeFraction(
+                         min, max, open, {int64_t(9), true})
+                         .value(),
+                     0.1);
+    EXPECT_DOUBLE_EQ(EstimateChunkRangeFraction(min,
+                                                max,
+                                                {int64_t(10), true},
+                                                {int64_t(20), false})
+                         .value(),
+                     0.1);
+    // a float bound on an int column admits the integers past it
+    EXPECT_DOUBLE_EQ(EstimateChunkRangeFraction(
+                         min, max, {double(89.5), true}, open)
+                         .value(),
+                     0.1);
+    EXPECT_DOUBLE_EQ(EstimateChunkRangeFraction(
+                         min, max, {int64_t(200), true}, open)
+                         .value(),
+                     0.0);
+    EXPECT_DOUBLE_EQ(EstimateChunkRangeFraction(min,
+                                                max,
+                                                {int64_t(30), true},
+                                                {int64_t(30), false})
+                         .value(),
+                     0.0);
+
+    index::Metrics single = int64_t(7);
+    EXPECT_DOUBLE_EQ(EstimateChunkRangeFraction(
+                         single, single, {int64_t(7), true}, open)
+                         .value(),
+                     1.0);
+    EXPECT_DOUBLE_EQ(EstimateChunkRangeFraction(
+                         single, single, {int64_t(7), false}, open)
+                         .value(),
+                     0.0);
+}
+
+TEST(ScanCostModel, StringRange) {
+    index::Metrics min = std::string("a");
+    index::Metrics max = std::string("c");
+    RangeBound open;
+
+    auto half = EstimateChunkRangeFraction(
+                    min, max, {std::string("b"), true}, open)
+                    .value();
+    EXPECT_DOUBLE_EQ(half, 0.5);
+    EXPECT_DOUBLE_EQ(EstimateChunkRangeFraction(
+                         min, max, open, {std::string("a"), false})
+                         .value(),
+                     0.0);
+    EXPECT_DOUBLE_EQ(EstimateChunkRangeFraction(
+                         min, max, {std::string("0"), true}, open)
+                         .value(),
+                     1.0);
+
+    // kinds that cannot be compared give no estimate
+    EXPECT_FALSE(
+        EstimateChunkRangeFraction(min, max, {int64_t(1), true}, open)
+            .has_value());
+    EXPECT_FALSE(EstimateChunkRangeFraction(
+                     int64_t(0), int64_t(9), {std::string("a"), true}, open)
+                     .has_value());
+    EXPECT_FALSE(
+        EstimateChunkRangeFraction(false, true, open, open).has_value());
+}
+
+TEST(ScanCostModel, ToMetrics) {
+    proto::plan::GenericValue value;
+    value.set_int64_val(3);
+    EXPECT_EQ(std::get<int64_t>(ToMetrics(value).value()), 3);
+    value.set_string_val("x");
+    EXPECT_EQ(std::get<std::string>(ToMetrics(value).value()), "x");
+    value.set_bool_val(true);
+    EXPECT_FALSE(ToMetrics(value).has_value());
+}
+
+TEST(ScanCostModel, PreferRawScanOverIndex) {
+    using index::ScalarIndexType;
+    EXPECT_TRUE(PreferRawScanOverIndex(ScalarIndexType::INVERTED, 0.5, 0.3));
+    EXPECT_TRUE(PreferRawScanOverIndex(ScalarIndexType::MARISA, 0.3, 0.3));
+    EXPECT_FALSE(PreferRawScanOverIndex(ScalarIndexType::INVERTED, 0.1, 0.3));
+    EXPECT_FALSE(PreferRawScanOverIndex(ScalarIndexType::INVERTED, 1.0, 1.5));
+    EXPECT_FALSE(PreferRawScanOverIndex(ScalarIndexType::STLSORT, 1.0, 0.3));
+    EXPECT_FALSE(PreferRawScanOverIndex(ScalarIndexType::BITMAP, 1.0, 0.3));
+}
@@ -27,6 +27,10 @@
 #include "SimdFilter.h"
 #include "SimdFilterImpl.h"
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+
 // ── CPU feature detection ───────────────────────────────────────────────
 
 #if defined(__x86_64__)
@@ -169,17 +173,32 @@ laneCount();
 
 namespace {
 
+constexpr int kNumLevels = static_cast<int>(SimdFilterLevel::kAvx512) + 1;
+
+// -1 until the first call resolves it to detectSimdFilterLevel().
+std::atomic<int> active_level{-1};
+
+int
+activeLevel() {
+    auto level = active_level.load(std::memory_order_relaxed);
+    if (level < 0) {
+        level = static_cast<int>(detectSimdFilterLevel());
+        active_level.store(level, std::memory_order_relaxed);
+    }
+    return level;
+}
+
 template <typename T>
 using FilterFn = void (*)(const T*, int, uint8_t*, const T*, int);
 
 template <typename T>
 FilterFn<T>
-selectFilterImpl() {
+selectFilterImpl(int level) {
 #if defined(__x86_64__)
-    if (hasAvx512bw()) {
+    if (level >= static_cast<int>(SimdFilterLevel::kAvx512)) {
         return avx512::filterChunk<T>;
     }
-    if (hasAvx2()) {
+    if (level >= static_cast<int>(SimdFilterLevel::kAvx2)) {
         return avx2::filterChunk<T>;
     }
 #endif
@@ -191,12 +210,12 @@ using LaneCountFn = int (*)();
 
 template <typename T>
 LaneCountFn<T>
-selectLaneCountImpl() {
+selectLaneCountImpl(int level) {
 #if defined(__x86_64__)
-    if (hasAvx512bw()) {
+    if (level >= static_cast<int>(SimdFilterLevel::kAvx512)) {
         return avx512::laneCount<T>;
     }
-    if (hasAvx2()) {
+    if (level >= static_cast<int>(SimdFilterLevel::kAvx2)) {
         return avx2::laneCount<T>;
     }
 #endif
@@ -207,20 +226,55 @@ selectLaneCountImpl() {
 
 // ── Public API ──────────────────────────────────────────────────────────
 
+SimdFilterLevel
+detectSimdFilterLevel() {
+    // CPUID is only queried once.
+    static const auto level = []() {
+#if defined(__x86_64__)
+        if (hasAvx512bw()) {
+            return SimdFilterLevel::kAvx512;
+        }
+        if (hasAvx2()) {
+            return SimdFilterLevel::kAvx2;
+        }
+#endif
+        return SimdFilterLevel::kBaseline;
+    }();
+    return level;
+}
+
+void
+setSimdFilterLevel(SimdFilterLevel level) {
+    auto capped = std::min(static_cast<int>(level),
+                           static_cast<int>(detectSimdFilterLevel()));
+    active_level.store(std::max(capped, 0), std::memory_order_relaxed);
+}
+
+SimdFilterLevel
+simdFilterLevel() {
+    return static_cast<SimdFilterLevel>(activeLevel());
+}
+
 template <typename T>
 void
 simdFilterChunk(
     const T* data, int size, uint8_t* bitmap, const T* vals, int num_vals) {
-    // Resolved once on first call, cached in static local.
-    static const auto impl = selectFilterImpl<T>();
-    impl(data, size, bitmap, vals, num_vals);
+    // One entry per tier, resolved once on first call.
+    static const std::array<FilterFn<T>, kNumLevels> impls = {
+        selectFilterImpl<T>(0),
+        selectFilterImpl<T>(1),
+        selectFilterImpl<T>(2)};
+    impls[activeLevel()](data, size, bitmap, vals, num_vals);
 }
 
 template <typename T>
 int
 simdLaneCount() {
-    static const auto impl = selectLaneCountImpl<T>();
-    return impl();
+    static const std::array<LaneCountFn<T>, kNumLevels> impls = {
+        selectLaneCountImpl<T>(0),
+        selectLaneCountImpl<T>(1),
+        selectLaneCountImpl<T>(2)};
+    return impls[activeLevel()]();
 }
 
 // Explicit instantiations for all supported numeric types.
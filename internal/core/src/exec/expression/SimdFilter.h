@@ -37,5 +37,27 @@ template <typename T>
 int
 simdLaneCount();
 
+// Instruction set tiers of the runtime dispatcher, in increasing order.
+// kAvx2 and kAvx512 only exist on x86-64; ARM always runs kBaseline (NEON).
+enum class SimdFilterLevel : int {
+    kBaseline = 0,
+    kAvx2 = 1,
+    kAvx512 = 2,
+};
+
+// Best tier supported by the CPU and OS.
+SimdFilterLevel
+detectSimdFilterLevel();
+
+// Caps the tier used by simdFilterChunk() and simdLaneCount(). Levels above
+// detectSimdFilterLevel() are clamped. Meant for benchmarks and tests that
+// compare tiers; elements built before the call keep their SIMD threshold.
+void
+setSimdFilterLevel(SimdFilterLevel level);
+
+// Tier currently used by the dispatcher.
+SimdFilterLevel
+simdFilterLevel();
+
 }  // namespace exec
 }  // namespace milvus
@@ -0,0 +1,102 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+#include "common/Types.h"
+#include "segcore/SegmentInterface.h"
+
+namespace milvus {
+namespace exec {
+
+// Range bounds over a field whose loaded rows are non-decreasing in segment
+// offset order (see SegmentInternalInterface::IsFieldSorted). The rows a
+// range matches are then one run of offsets, found by a binary search over
+// the last row of each chunk and then within the one chunk the run starts.
+
+// The first segment offset whose value does not satisfy `pred`, where `pred`
+// holds for a prefix of the rows, or the row count when it holds for all.
+template <typename T, typename Pred>
+int64_t
+SortedPartitionPoint(milvus::OpContext* op_ctx,
+                     const segcore::SegmentInternalInterface& segment,
+                     FieldId field_id,
+                     Pred pred) {
+    auto num_chunks = segment.num_chunk_data(field_id);
+    // the first chunk whose last row does not satisfy pred, an empty chunk
+    // takes the answer of the next chunk holding rows
+    int64_t lo = 0;
+    int64_t hi = num_chunks;
+    while (lo < hi) {
+        auto mid = lo + (hi - lo) / 2;
+        auto probe = mid;
+        bool satisfied = true;
+        for (; probe < hi; ++probe) {
+            auto pw = segment.chunk_data<T>(op_ctx, field_id, probe);
+            const auto& span = pw.get();
+            if (span.row_count() > 0) {
+                satisfied = pred(span.data()[span.row_count() - 1]);
+                break;
+            }
+        }
+        if (probe < hi && satisfied) {
+            lo = probe + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    // the run boundary is in the first chunk holding rows from there on
+    for (; lo < num_chunks; ++lo) {
+        auto pw = segment.chunk_data<T>(op_ctx, field_id, lo);
+        const auto& span = pw.get();
+        if (span.row_count() > 0) {
+            auto begin = span.data();
+            auto end = begin + span.row_count();
+            return segment.num_rows_until_chunk(field_id, lo) +
+                   (std::partition_point(begin, end, pred) - begin);
+        }
+    }
+    return segment.num_rows_until_chunk(field_id, num_chunks);
+}
+
+// The first offset whose value is not less than `val`.
+template <typename T, typename ValueType>
+int64_t
+SortedLowerBound(milvus::OpContext* op_ctx,
+                 const segcore::SegmentInternalInterface& segment,
+                 FieldId field_id,
+                 const ValueType& val) {
+    return SortedPartitionPoint<T>(
+        op_ctx, segment, field_id, [&val](const T& x) { return x < val; });
+}
+
+// The first offset whose value is greater than `val`.
+template <typename T, typename ValueType>
+int64_t
+SortedUpperBound(milvus::OpContext* op_ctx,
+                 const segcore::SegmentInternalInterface& segment,
+                 FieldId field_id,
+                 const ValueType& val) {
+    return SortedPartitionPoint<T>(
+        op_ctx, segment, field_id, [&val](const T& x) { return !(val < x); });
+}
+
+}  // namespace exec
+}  // namespace milvus
@@ -0,0 +1,202 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "common/Schema.h"
+#include "common/Types.h"
+#include "expr/ITypeExpr.h"
+#include "knowhere/comp/index_param.h"
+#include "pb/schema.pb.h"
+#include "plan/PlanNode.h"
+#include "query/ExecPlanNodeVisitor.h"
+#include "test_utils/DataGen.h"
+#include "test_utils/storage_test_utils.h"
+
+using namespace milvus;
+
+namespace {
+
+proto::schema::FieldData*
+FindFieldData(segcore::GeneratedData& raw_data, FieldId field_id) {
+    for (auto& fd : *raw_data.raw_->mutable_fields_data()) {
+        if (fd.field_id() == field_id.get()) {
+            return &fd;
+        }
+    }
+    return nullptr;
+}
+
+BitsetType
+Filter(segcore::SegmentSealed* segment,
+       const expr::TypedExprPtr& expr,
+       int64_t num_rows) {
+    auto plan =
+        std::make_shared<plan::FilterBitsNode>(DEFAULT_PLANNODE_ID, expr);
+    return query::ExecuteQueryExpr(plan, segment, num_rows, MAX_TIMESTAMP);
+}
+
+}  // namespace
+
+class SortedDataRangeTest : public ::testing::Test {
+ protected:
+    using Expected = std::function<bool(int64_t, proto::plan::OpType)>;
+
+    void
+    SetUp() override {
+        schema_ = std::make_shared<Schema>();
+        schema_->AddDebugField(
+            "vec", DataType::VECTOR_FLOAT, 16, knowhere::metric::L2);
+        auto pk_fid = schema_->AddDebugField("pk", DataType::INT64);
+        schema_->set_primary_field_id(pk_fid);
+        int64_fid_ = schema_->AddDebugField("int64", DataType::INT64);
+        double_fid_ = schema_->AddDebugField("double", DataType::DOUBLE);
+        unsorted_fid_ = schema_->AddDebugField("unsorted", DataType::INT64);
+
+        raw_data_ = segcore::DataGen(schema_, N);
+        // runs of three equal values, so every bound lands inside a run
+        auto int64_col = FindFieldData(raw_data_, int64_fid_)
+                             ->mutable_scalars()
+                             ->mutable_long_data()
+                             ->mutable_data();
+        auto double_col = FindFieldData(raw_data_, double_fid_)
+                              ->mutable_scalars()
+                              ->mutable_double_data()
+                              ->mutable_data();
+        auto unsorted_col = FindFieldData(raw_data_, unsorted_fid_)
+                                ->mutable_scalars()
+                                ->mutable_long_data()
+                                ->mutable_data();
+        for (int64_t i = 0; i < N; ++i) {
+            int64_col->at(i) = i / 3;
+            double_col->at(i) = (i / 3) * 0.5;
+            unsorted_col->at(i) = (N - i) / 3;
+        }
+        segment_ = CreateSealedWithFieldDataLoaded(schema_, raw_data_);
+    }
+
+    void
+    CheckUnary(FieldId field_id,
+               DataType data_type,
+               const proto::plan::GenericValue& val,
+               const Expected& expected) {
+        for (auto op : {proto::plan::OpType::GreaterThan,
+                        proto::plan::OpType::GreaterEqual,
+                        proto::plan::OpType::LessThan,
+                        proto::plan::OpType::LessEqual,
+                        proto::plan::OpType::Equal,
+                        proto::plan::OpType::NotEqual}) {
+            auto expr = std::make_shared<expr::UnaryRangeFilterExpr>(
+                expr::ColumnInfo(field_id, data_type), op, val);
+            auto res = Filter(segment_.get(), expr, N);
+            ASSERT_EQ(res.size(), N);
+            for (int64_t i = 0; i < N; ++i) {
+                ASSERT_EQ(res[i], expected(i, op))
+                    << "op " << op << " row " << i;
+            }
+        }
+    }
+
+    static constexpr int64_t N = 3000;
+    SchemaPtr schema_;
+    FieldId int64_fid_;
+    FieldId double_fid_;
+    FieldId unsorted_fid_;
+    segcore::GeneratedData raw_data_;
+    std::unique_ptr<segcore::SegmentSealed> segment_;
+};
+
+TEST_F(SortedDataRangeTest, DetectsSortedFields) {
+    ASSERT_TRUE(segment_->IsFieldSorted(nullptr, int64_fid_));
+    ASSERT_TRUE(segment_->IsFieldSorted(nullptr, double_fid_));
+    ASSERT_FALSE(segment_->IsFieldSorted(nullptr, unsorted_fid_));
+}
+
+TEST_F(SortedDataRangeTest, UnaryRangeMatchesValues) {
+    auto int64_values = raw_data_.get_col<int64_t>(int64_fid_);
+    auto double_values = raw_data_.get_col<double>(double_fid_);
+    auto compare = [](auto x, auto val, proto::plan::OpType op) {
+        switch (op) {
+            case proto::plan::OpType::GreaterThan:
+                return x > val;
+            case proto::plan::OpType::GreaterEqual:
+                return x >= val;
+            case proto::plan::OpType::LessThan:
+                return x < val;
+            case proto::plan::OpType::LessEqual:
+                return x <= val;
+            case proto::plan::OpType::Equal:
+                return x == val;
+            default:
+                return x != val;
+        }
+    };
+
+    // inside the values, below and above all of them
+    for (int64_t bound : {int64_t(0), int64_t(N / 6), int64_t(-5), N}) {
+        proto::plan::GenericValue val;
+        val.set_int64_val(bound);
+        CheckUnary(int64_fid_, DataType::INT64, val, [&](auto row, auto op) {
+            return compare(int64_values[row], bound, op);
+        });
+    }
+    for (double bound : {0.0, 100.25, 100.5, -1.0, double(N)}) {
+        proto::plan::GenericValue val;
+        val.set_float_val(bound);
+        CheckUnary(double_fid_, DataType::DOUBLE, val, [&](auto row, auto op) {
+            return compare(double_values[row], bound, op);
+        });
+    }
+}
+
+TEST_F(SortedDataRangeTest, BinaryRangeMatchesValues) {
+    auto values = raw_data_.get_col<int64_t>(int64_fid_);
+    std::vector<std::pair<int64_t, int64_t>> ranges{
+        {10, 20}, {20, 10}, {-5, 3}, {N / 3 - 2, N}, {7, 7}};
+    for (auto [lower, upper] : ranges) {
+        for (bool lower_inclusive : {false, true}) {
+            for (bool upper_inclusive : {false, true}) {
+                proto::plan::GenericValue lower_val;
+                lower_val.set_int64_val(lower);
+                proto::plan::GenericValue upper_val;
+                upper_val.set_int64_val(upper);
+                auto expr = std::make_shared<expr::BinaryRangeFilterExpr>(
+                    expr::ColumnInfo(int64_fid_, DataType::INT64),
+                    lower_val,
+                    upper_val,
+                    lower_inclusive,
+                    upper_inclusive);
+                auto res = Filter(segment_.get(), expr, N);
+                ASSERT_EQ(res.size(), N);
+                for (int64_t i = 0; i < N; ++i) {
+                    bool expected =
+                        (lower_inclusive ? values[i] >= lower
+                                         : values[i] > lower) &&
+                        (upper_inclusive ? values[i] <= upper
+                                         : values[i] < upper);
+                    ASSERT_EQ(res[i], expected)
+                        << "range " << lower << ", " << upper << " row "
+                        << i;
+                }
+            }
+        }
+    }
+}
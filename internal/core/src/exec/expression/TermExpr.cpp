@@ -20,6 +20,7 @@
 #include <simdjson.h>
 #include <algorithm>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <utility>
 #include <variant>
@@ -173,17 +174,17 @@ template <typename T>
 bool
 PhyTermFilterExpr::CanSkipSegment() {
     const auto& skip_index = segment_->GetSkipIndex();
-    T min, max;
-    for (auto i = 0; i < expr_->vals_.size(); i++) {
-        auto val = GetValueFromProto<T>(expr_->vals_[i]);
-        max = i == 0 ? val : std::max(val, max);
-        min = i == 0 ? val : std::min(val, min);
+    std::vector<T> vals;
+    vals.reserve(expr_->vals_.size());
+    for (const auto& val : expr_->vals_) {
+        vals.push_back(GetValueFromProto<T>(val));
     }
+    // per chunk, every value must be out of the chunk's range or missed by
+    // its bloom filter, tighter than the range of the whole IN list
     auto can_skip = [&]() -> bool {
         bool res = false;
         for (int i = 0; i < num_data_chunk_; ++i) {
-            if (!skip_index.CanSkipBinaryRange<T>(
-                    op_ctx_, field_id_, i, min, max, true, true)) {
+            if (!skip_index.CanSkipInQuery<T>(op_ctx_, field_id_, i, vals)) {
                 return false;
             } else {
                 res = true;
@@ -295,9 +296,7 @@ PhyTermFilterExpr::ExecTermArrayVariableInField(EvalCtx& context) {
         return nullptr;
     }
 
-    auto res_vec =
-        std::make_shared<ColumnVector>(TargetBitmap(real_batch_size, false),
-                                       TargetBitmap(real_batch_size, true));
+    auto res_vec = NewBitmapColumn(real_batch_size);
     TargetBitmapView res(res_vec->GetRawData(), real_batch_size);
     TargetBitmapView valid_res(res_vec->GetValidRawData(), real_batch_size);
 
@@ -389,9 +388,7 @@ PhyTermFilterExpr::ExecTermArrayFieldInVariable(EvalCtx& context) {
         return nullptr;
     }
 
-    auto res_vec =
-        std::make_shared<ColumnVector>(TargetBitmap(real_batch_size, false),
-                                       TargetBitmap(real_batch_size, true));
+    auto res_vec = NewBitmapColumn(real_batch_size);
     TargetBitmapView res(res_vec->GetRawData(), real_batch_size);
     TargetBitmapView valid_res(res_vec->GetValidRawData(), real_batch_size);
 
@@ -491,9 +488,7 @@ PhyTermFilterExpr::ExecTermJsonVariableInField(EvalCtx& context) {
         return nullptr;
     }
 
-    auto res_vec =
-        std::make_shared<ColumnVector>(TargetBitmap(real_batch_size, false),
-                                       TargetBitmap(real_batch_size, true));
+    auto res_vec = NewBitmapColumn(real_batch_size);
     TargetBitmapView res(res_vec->GetRawData(), real_batch_size);
     TargetBitmapView valid_res(res_vec->GetValidRawData(), real_batch_size);
 
@@ -505,7 +500,8 @@ PhyTermFilterExpr::ExecTermJsonVariableInField(EvalCtx& context) {
     }
     auto val = arg_val_.GetValue<ValueType>();
 
-    auto pointer = milvus::Json::pointer(expr_->column_.nested_path_);
+    milvus::JsonPointer pointer(
+        milvus::Json::pointer(expr_->column_.nested_path_));
 
     int processed_cursor = 0;
     auto execute_sub_batch =
@@ -517,7 +513,7 @@ PhyTermFilterExpr::ExecTermJsonVariableInField(EvalCtx& context) {
             const int size,
             TargetBitmapView res,
             TargetBitmapView valid_res,
-            const std::string& pointer,
+            const milvus::JsonPointer& pointer,
             const ValueType& target_val) {
         // If data is nullptr, this chunk was skipped by SkipIndex.
         // We only need to update processed_cursor for bitmap_input indexing.
@@ -527,7 +523,7 @@ PhyTermFilterExpr::ExecTermJsonVariableInField(EvalCtx& context) {
         }
         auto executor = [&](size_t i) {
             auto doc = data[i].doc();
-            auto array = doc.at_pointer(pointer).get_array();
+            auto array = pointer.Find(doc).get_array();
             if (array.error())
                 return false;
             for (auto it = array.begin(); it != array.end(); ++it) {
@@ -589,7 +585,12 @@ PhyTermFilterExpr::ExecJsonInVariableByStats() {
 
     auto pointer = milvus::index::JsonPointer(expr_->column_.nested_path_);
     if (!arg_inited_) {
-        arg_set_ = std::make_shared<SetElement<ValueType>>(expr_->vals_);
+        if constexpr (std::is_same_v<ValueType, std::string>) {
+            // shredded STRING columns are filtered a chunk at a time
+            arg_set_ = std::make_shared<StringBatchElement>(expr_->vals_);
+        } else {
+            arg_set_ = std::make_shared<SetElement<ValueType>>(expr_->vals_);
+        }
         if constexpr (std::is_same_v<GetType, int64_t>) {
             // for int64_t, we need to a double vector to store the values
             auto int_arg_set =
@@ -607,9 +608,7 @@ PhyTermFilterExpr::ExecJsonInVariableByStats() {
 
     if (arg_set_->Empty()) {
         MoveCursor();
-        return std::make_shared<ColumnVector>(
-            TargetBitmap(real_batch_size, false),
-            TargetBitmap(real_batch_size, true));
+        return NewBitmapColumn(real_batch_size);
     }
 
     if (cached_index_chunk_id_ != 0 && TryCacheGet()) {
@@ -641,6 +640,22 @@ PhyTermFilterExpr::ExecJsonInVariableByStats() {
                                                  size_t size,
                                                  TargetBitmapView res,
                                                  TargetBitmapView valid_res) {
+                    if constexpr (std::is_same_v<ColType, std::string_view>) {
+                        auto str_elem =
+                            std::dynamic_pointer_cast<StringBatchElement>(
+                                this->arg_set_);
+                        if (str_elem != nullptr) {
+                            str_elem->FilterChunk(src, size, res);
+                            if (valid != nullptr) {
+                                for (size_t i = 0; i < size; ++i) {
+                                    if (!valid[i]) {
+                                        res[i] = valid_res[i] = false;
+                                    }
+                                }
+                            }
+                            return;
+                        }
+                    }
                     for (size_t i = 0; i < size; ++i) {
                         if (valid != nullptr && !valid[i]) {
                             res[i] = valid_res[i] = false;
@@ -653,10 +668,35 @@ PhyTermFilterExpr::ExecJsonInVariableByStats() {
                         }
                     }
                 };
+                // chunks whose min/max or bloom filters rule out every
+                // value are not probed
+                std::function<bool(const milvus::SkipIndex&, FieldId, int)>
+                    skip_func;
+                std::vector<ColType> skip_vals;
+                if constexpr (std::is_same_v<ColType, double>) {
+                    skip_vals = GetElementValues<double>(arg_set_double_);
+                } else if constexpr (std::is_same_v<ColType, int64_t> &&
+                                     std::is_same_v<GetType, int64_t>) {
+                    skip_vals = GetElementValues<int64_t>(arg_set_);
+                }
+                std::vector<std::string> skip_strs;
+                if constexpr (std::is_same_v<ColType, std::string_view>) {
+                    skip_strs = GetElementValues<std::string>(arg_set_);
+                    skip_vals.assign(skip_strs.begin(), skip_strs.end());
+                }
+                if (!skip_vals.empty()) {
+                    skip_func = [this, &skip_vals](
+                                    const milvus::SkipIndex& skip_index,
+                                    FieldId field_id,
+                                    int chunk_id) {
+                        return skip_index.CanSkipInQuery<ColType>(
+                            op_ctx_, field_id, chunk_id, skip_vals);
+                    };
+                }
                 index->ExecutorForShreddingData<ColType>(op_ctx_,
                                                          target_field,
                                                          shredding_executor,
-                                                         nullptr,
+                                                         skip_func,
                                                          res_view,
                                                          valid_res_view);
                 LOG_DEBUG("using shredding data's field: {} count {}",
@@ -787,13 +827,12 @@ PhyTermFilterExpr::ExecTermJsonFieldInVariable(EvalCtx& context) {
         return nullptr;
     }
 
-    auto res_vec =
-        std::make_shared<ColumnVector>(TargetBitmap(real_batch_size, false),
-                                       TargetBitmap(real_batch_size, true));
+    auto res_vec = NewBitmapColumn(real_batch_size);
     TargetBitmapView res(res_vec->GetRawData(), real_batch_size);
     TargetBitmapView valid_res(res_vec->GetValidRawData(), real_batch_size);
 
-    auto pointer = milvus::Json::pointer(expr_->column_.nested_path_);
+    milvus::JsonPointer pointer(
+        milvus::Json::pointer(expr_->column_.nested_path_));
     if (!arg_inited_) {
         arg_set_ = std::make_shared<SetElement<ValueType>>(expr_->vals_);
         arg_inited_ = true;
@@ -815,7 +854,7 @@ PhyTermFilterExpr::ExecTermJsonFieldInVariable(EvalCtx& context) {
             const int size,
             TargetBitmapView res,
             TargetBitmapView valid_res,
-            const std::string& pointer,
+            const milvus::JsonPointer& pointer,
             const std::shared_ptr<MultiElement>& terms) {
         // If data is nullptr, this chunk was skipped by SkipIndex.
         // We only need to update processed_cursor for bitmap_input indexing.
@@ -996,9 +1035,7 @@ PhyTermFilterExpr::ExecVisitorImplForData(EvalCtx& context) {
         return nullptr;
     }
 
-    auto res_vec =
-        std::make_shared<ColumnVector>(TargetBitmap(real_batch_size, false),
-                                       TargetBitmap(real_batch_size, true));
+    auto res_vec = NewBitmapColumn(real_batch_size);
     TargetBitmapView res(res_vec->GetRawData(), real_batch_size);
     TargetBitmapView valid_res(res_vec->GetValidRawData(), real_batch_size);
 
@@ -1029,7 +1066,9 @@ PhyTermFilterExpr::ExecVisitorImplForData(EvalCtx& context) {
                 arg_set_ =
                     std::make_shared<FlatVectorElement<std::string>>(str_vals);
             } else {
-                arg_set_ = std::make_shared<SetElement<std::string>>(str_vals);
+                // Larger IN: fingerprint batch filter, see StringBatchElement
+                arg_set_ =
+                    std::make_shared<StringBatchElement>(std::move(str_vals));
             }
         } else if constexpr (std::is_same_v<T, bool>) {
             // Bool: use specialized SetElement<bool> (two flags, O(1)).
@@ -1051,7 +1090,7 @@ PhyTermFilterExpr::ExecVisitorImplForData(EvalCtx& context) {
                 arg_set_ = std::make_shared<SetElement<T>>(vals);
             }
         }
-        // Cache SIMD FilterChunk dispatch (numeric types only).
+        // Cache SIMD FilterChunk dispatch (numeric and string batch).
         // SIMD path runs batch filter first, then applies validity/bitmap
         // masks — avoids per-row variant construction entirely.
         if constexpr (!std::is_same_v<T, bool> &&
@@ -1067,11 +1106,19 @@ PhyTermFilterExpr::ExecVisitorImplForData(EvalCtx& context) {
                 };
             }
         }
-        // Cache string SetElement pointer for per-row direct lookup.
+        // Cache string batch element for filter chunk and per-row lookup.
         if constexpr (std::is_same_v<T, std::string> ||
                       std::is_same_v<T, std::string_view>) {
-            cached_str_set_elem_ =
-                dynamic_cast<SetElement<std::string>*>(arg_set_.get());
+            if (auto str_elem =
+                    std::dynamic_pointer_cast<StringBatchElement>(arg_set_)) {
+                cached_filter_chunk_ = [str_elem](const void* data,
+                                                  int size,
+                                                  TargetBitmapView res) {
+                    str_elem->FilterChunk(
+                        static_cast<const T*>(data), size, res);
+                };
+                cached_str_set_elem_ = str_elem.get();
+            }
         }
         // Cache element values for skip_index (avoids per-chunk copy)
         cached_skip_elements_ = GetElementValues<T>(arg_set_);
@@ -1103,13 +1150,7 @@ PhyTermFilterExpr::ExecVisitorImplForData(EvalCtx& context) {
             if (simd_filter_fn) {
                 simd_filter_fn(data, size, res);
                 // Apply validity mask
-                if (valid_data != nullptr) {
-                    for (int i = 0; i < size; ++i) {
-                        if (!valid_data[i]) {
-                            res[i] = valid_res[i] = false;
-                        }
-                    }
-                }
+                ApplyValidMask(valid_data, res, valid_res, size);
                 // Apply bitmap mask
                 if (has_bitmap_input) {
                     for (int i = 0; i < size; ++i) {
@@ -1141,9 +1182,9 @@ PhyTermFilterExpr::ExecVisitorImplForData(EvalCtx& context) {
             if constexpr (std::is_same_v<T, std::string> ||
                           std::is_same_v<T, std::string_view>) {
                 if (str_set_elem) {
-                    // Hash lookup via string_view (zero copy)
-                    res[i] = str_set_elem->values_.find(std::string_view(
-                                 data[offset])) != str_set_elem->values_.end();
+                    // Fingerprint lookup via string_view (zero copy)
+                    res[i] =
+                        str_set_elem->Contains(std::string_view(data[offset]));
                 } else {
                     // FlatVectorElement path (small IN ≤4)
                     res[i] = vals->In(MultiElement::ValueType(
@@ -1191,6 +1232,9 @@ PhyTermFilterExpr::ExecVisitorImplForData(EvalCtx& context) {
             // For element-level filtering without offset input (brute force)
             processed_size = ProcessDataChunksForElementLevel<T>(
                 execute_sub_batch, skip_index_func, res, valid_res, arg_set_);
+        } else if (bitmap_input.empty()) {
+            processed_size = ProcessDataChunksByDictionary<T>(
+                execute_sub_batch, skip_index_func, res, valid_res, arg_set_);
         } else {
             processed_size = ProcessDataChunks<T>(
                 execute_sub_batch, skip_index_func, res, valid_res, arg_set_);
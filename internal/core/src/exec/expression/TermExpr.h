@@ -172,10 +172,10 @@ class PhyTermFilterExpr : public SegmentExpr {
     using FilterChunkFn =
         std::function<void(const void* data, int size, TargetBitmapView res)>;
     FilterChunkFn cached_filter_chunk_;
-    // Cached SetElement<string> pointer for per-row string lookup without
+    // Cached StringBatchElement pointer for per-row string lookup without
     // variant construction. Set once during init; nullptr when arg_set_ is not
-    // SetElement<string> (e.g. FlatVectorElement for small IN).
-    SetElement<std::string>* cached_str_set_elem_{nullptr};
+    // StringBatchElement (e.g. FlatVectorElement for small IN).
+    StringBatchElement* cached_str_set_elem_{nullptr};
     // Cached element values for skip_index (avoids per-chunk vector copy).
     std::any cached_skip_elements_;
 };
@@ -1,9 +1,7 @@
 #include "TimestamptzArithCompareExpr.h"
 
-#include <climits>
 #include <cstddef>
 #include <cstdint>
-#include <ctime>
 #include <memory>
 #include <variant>
 
@@ -14,12 +12,181 @@
 #include "common/Vector.h"
 #include "exec/expression/EvalCtx.h"
 #include "exec/expression/Expr.h"
+#include "exec/expression/Utils.h"
 #include "expr/ITypeExpr.h"
 #include "pb/plan.pb.h"
 
 namespace milvus {
 namespace exec {
 
+namespace {
+
+constexpr int64_t kMicrosPerSecond = 1000000;
+constexpr int64_t kSecondsPerDay = 86400;
+
+int64_t
+FloorDiv(int64_t a, int64_t b) {
+    return a / b - (a % b < 0 ? 1 : 0);
+}
+
+// days since 1970-01-01 of a proleptic Gregorian date, month in [1, 12]
+// and day of month counted from 1 without an upper bound
+int64_t
+DaysFromCivil(int64_t year, int64_t month, int64_t day) {
+    year -= month <= 2;
+    const int64_t era = FloorDiv(year, 400);
+    const int64_t year_of_era = year - era * 400;
+    const int64_t day_of_year =
+        (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    const int64_t day_of_era = year_of_era * 365 + year_of_era / 4 -
+                               year_of_era / 100 + day_of_year;
+    return era * 146097 + day_of_era - 719468;
+}
+
+void
+CivilFromDays(int64_t days, int64_t& year, int64_t& month, int64_t& day) {
+    days += 719468;
+    const int64_t era = FloorDiv(days, 146097);
+    const int64_t day_of_era = days - era * 146097;
+    const int64_t year_of_era =
+        (day_of_era - day_of_era / 1460 + day_of_era / 36524 -
+         day_of_era / 146096) /
+        365;
+    const int64_t day_of_year =
+        day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+    const int64_t mp = (5 * day_of_year + 2) / 153;
+    day = day_of_year - (153 * mp + 2) / 5 + 1;
+    month = mp < 10 ? mp + 3 : mp - 9;
+    year = year_of_era + era * 400 + (month <= 2);
+}
+
+// days, hours, minutes and seconds of the interval, which fit in int64
+// for any int32 fields
+int64_t
+FixedIntervalSeconds(const proto::plan::Interval& interval) {
+    return ((static_cast<int64_t>(interval.days()) * 24 + interval.hours()) *
+                60 +
+            interval.minutes()) *
+               60 +
+           interval.seconds();
+}
+
+bool
+IsFoldableCompareOp(proto::plan::OpType op) {
+    switch (op) {
+        case proto::plan::OpType::Equal:
+        case proto::plan::OpType::NotEqual:
+        case proto::plan::OpType::GreaterThan:
+        case proto::plan::OpType::GreaterEqual:
+        case proto::plan::OpType::LessThan:
+        case proto::plan::OpType::LessEqual:
+            return true;
+        default:
+            return false;
+    }
+}
+
+template <proto::plan::OpType op>
+void
+CompareShifted(const int64_t* shifted,
+               int size,
+               int64_t compare_us,
+               TargetBitmapView res) {
+    for (int i = 0; i < size; ++i) {
+        if constexpr (op == proto::plan::OpType::Equal) {
+            res[i] = shifted[i] == compare_us;
+        } else if constexpr (op == proto::plan::OpType::NotEqual) {
+            res[i] = shifted[i] != compare_us;
+        } else if constexpr (op == proto::plan::OpType::GreaterThan) {
+            res[i] = shifted[i] > compare_us;
+        } else if constexpr (op == proto::plan::OpType::GreaterEqual) {
+            res[i] = shifted[i] >= compare_us;
+        } else if constexpr (op == proto::plan::OpType::LessThan) {
+            res[i] = shifted[i] < compare_us;
+        } else {
+            res[i] = shifted[i] <= compare_us;
+        }
+    }
+}
+
+}  // namespace
+
+std::shared_ptr<const milvus::expr::UnaryRangeFilterExpr>
+FoldTimestamptzArithCompare(
+    const std::shared_ptr<const milvus::expr::TimestamptzArithCompareExpr>&
+        expr) {
+    const auto& column = expr->column_;
+    if (column.element_level_ || !column.nested_path_.empty() ||
+        !IsFoldableCompareOp(expr->compare_op_) ||
+        expr->compare_value_.val_case() !=
+            proto::plan::GenericValue::kInt64Val) {
+        return nullptr;
+    }
+    int64_t delta_us = 0;
+    if (expr->arith_op_ != proto::plan::ArithOpType::Unknown) {
+        if (expr->arith_op_ != proto::plan::ArithOpType::Add &&
+            expr->arith_op_ != proto::plan::ArithOpType::Sub) {
+            return nullptr;
+        }
+        const auto& interval = expr->interval_;
+        // a month or a year is not a fixed number of days
+        if (interval.years() != 0 || interval.months() != 0) {
+            return nullptr;
+        }
+        if (__builtin_mul_overflow(
+                FixedIntervalSeconds(interval), kMicrosPerSecond, &delta_us)) {
+            return nullptr;
+        }
+        if (expr->arith_op_ == proto::plan::ArithOpType::Sub) {
+            delta_us = -delta_us;
+        }
+    }
+    // ts + delta op value <=> ts op value - delta
+    int64_t folded_us;
+    if (__builtin_sub_overflow(
+            expr->compare_value_.int64_val(), delta_us, &folded_us)) {
+        return nullptr;
+    }
+    proto::plan::GenericValue folded_value;
+    folded_value.set_int64_val(folded_us);
+    return std::make_shared<const milvus::expr::UnaryRangeFilterExpr>(
+        column, expr->compare_op_, folded_value);
+}
+
+int64_t
+ShiftTimestamptz(int64_t ts_us, int64_t months, int64_t seconds) {
+    int64_t epoch_sec = FloorDiv(ts_us, kMicrosPerSecond);
+    int64_t sub_sec_us = ts_us - epoch_sec * kMicrosPerSecond;
+    if (months != 0) {
+        int64_t days = FloorDiv(epoch_sec, kSecondsPerDay);
+        int64_t second_of_day = epoch_sec - days * kSecondsPerDay;
+        int64_t year, month, day;
+        CivilFromDays(days, year, month, day);
+        // years of the interval are folded into `months`, both stay far
+        // from overflow for int32 interval fields
+        int64_t total_months = year * 12 + (month - 1) + months;
+        int64_t new_year = FloorDiv(total_months, 12);
+        int64_t new_month = total_months - new_year * 12 + 1;
+        epoch_sec =
+            DaysFromCivil(new_year, new_month, day) * kSecondsPerDay +
+            second_of_day;
+    }
+    // Guard against overflow in epoch_sec * 1000000.
+    // INT64_MAX / 1000000 ≈ ±9.2e12 sec ≈ ±292,271 years from epoch.
+    constexpr int64_t kMaxSec = (INT64_MAX - 999999) / kMicrosPerSecond;
+    constexpr int64_t kMinSec = (INT64_MIN + 999999) / kMicrosPerSecond;
+    int64_t new_epoch_sec;
+    bool overflow = __builtin_add_overflow(epoch_sec, seconds, &new_epoch_sec);
+    AssertInfo(
+        !overflow && new_epoch_sec >= kMinSec && new_epoch_sec <= kMaxSec,
+        "timestamp after interval arithmetic out of representable "
+        "range: {} + {} seconds from epoch",
+        epoch_sec,
+        seconds);
+    // Restore sub-second microseconds from the original timestamp
+    return new_epoch_sec * kMicrosPerSecond + sub_sec_us;
+}
+
 std::string
 PhyTimestamptzArithCompareExpr::ToString() const {
     return expr_->ToString();
@@ -35,10 +202,10 @@ PhyTimestamptzArithCompareExpr::Eval(EvalCtx& context, VectorPtr& result) {
 template <typename T>
 VectorPtr
 PhyTimestamptzArithCompareExpr::ExecCompareVisitorImpl(OffsetVector* input) {
-    // We can not use index by transforming ts_col + interval > iso_string to ts_col > iso_string - interval
-    // Because year / month interval is not fixed days, it depends on the specific date.
-    // So, currently, we only support the data scanning path.
-    // In the future, one could add a switch here to check for index availability.
+    // Fixed duration intervals are folded into the compare value when the
+    // expression is compiled (FoldTimestamptzArithCompare), what reaches
+    // here has a year / month interval, the number of days of which depends
+    // on the specific date, so only the data scanning path applies.
     return ExecCompareVisitorImplForAll<T>(input);
 }
 
@@ -46,17 +213,21 @@ template <typename T>
 VectorPtr
 PhyTimestamptzArithCompareExpr::ExecCompareVisitorImplForAll(
     OffsetVector* input) {
+    auto arith_op = expr_->arith_op_;
     if (!arg_inited_) {
-        interval_ = expr_->interval_;
+        const auto& interval = expr_->interval_;
+        const int64_t op_sign =
+            (arith_op == proto::plan::ArithOpType::Add) ? 1 : -1;
+        interval_months_ =
+            (static_cast<int64_t>(interval.years()) * 12 + interval.months()) *
+            op_sign;
+        interval_seconds_ = FixedIntervalSeconds(interval) * op_sign;
         compare_value_.SetValue<T>(expr_->compare_value_);
         arg_inited_ = true;
     }
 
-    auto arith_op = expr_->arith_op_;
     auto compare_op = expr_->compare_op_;
     auto compare_value = this->compare_value_.GetValue<T>();
-    auto interval = interval_;
-
     if (arith_op == proto::plan::ArithOpType::Unknown) {
         if (!helperPhyExpr_) {  // reconstruct helper expr would cause an error
             proto::plan::GenericValue zeroRightOperand;
@@ -86,118 +257,54 @@ PhyTimestamptzArithCompareExpr::ExecCompareVisitorImplForAll(
         return nullptr;
     }
 
-    auto res_vec =
-        std::make_shared<ColumnVector>(TargetBitmap(real_batch_size, false),
-                                       TargetBitmap(real_batch_size, true));
+    auto res_vec = NewBitmapColumn(real_batch_size);
 
     TargetBitmapView res(res_vec->GetRawData(), real_batch_size);
     TargetBitmapView valid_res(res_vec->GetValidRawData(), real_batch_size);
     auto exec_sub_batch =
-        [ arith_op,
-          compare_op ]<FilterType filter_type = FilterType::sequential>(
+        [ this, compare_op ]<FilterType filter_type = FilterType::sequential>(
             const T* data,
             const bool* valid_data,
             const int32_t* offsets,
             const int size,
             TargetBitmapView res,
             TargetBitmapView valid_res,
-            T compare_value,
-            proto::plan::Interval interval) {
-        const int64_t compare_us = compare_value;
+            T compare_value) {
+        shifted_.resize(size);
         for (int i = 0; i < size; ++i) {
-            const int64_t current_ts_us = data[i];
-            const int op_sign =
-                (arith_op == proto::plan::ArithOpType::Add) ? 1 : -1;
-            // Floor division to correctly handle pre-epoch (negative) timestamps:
-            // C++ truncates toward zero, but we need floor for time decomposition.
-            // e.g., -1500000 us should be epoch_sec=-2, sub_sec_us=500000
-            //        not epoch_sec=-1, sub_sec_us=-500000
-            // Uses div-then-adjust pattern to avoid signed overflow near INT64_MIN.
-            std::time_t epoch_sec =
-                current_ts_us / 1000000 - (current_ts_us % 1000000 < 0 ? 1 : 0);
-            int64_t sub_sec_us = current_ts_us - epoch_sec * 1000000;
-            struct std::tm tm_buf;
-            if (::gmtime_r(&epoch_sec, &tm_buf) == nullptr) {
+            shifted_[i] =
+                ShiftTimestamptz(data[i], interval_months_, interval_seconds_);
+        }
+        const int64_t compare_us = compare_value;
+        switch (compare_op) {
+            case proto::plan::OpType::Equal:
+                CompareShifted<proto::plan::OpType::Equal>(
+                    shifted_.data(), size, compare_us, res);
+                break;
+            case proto::plan::OpType::NotEqual:
+                CompareShifted<proto::plan::OpType::NotEqual>(
+                    shifted_.data(), size, compare_us, res);
+                break;
+            case proto::plan::OpType::GreaterThan:
+                CompareShifted<proto::plan::OpType::GreaterThan>(
+                    shifted_.data(), size, compare_us, res);
+                break;
+            case proto::plan::OpType::GreaterEqual:
+                CompareShifted<proto::plan::OpType::GreaterEqual>(
+                    shifted_.data(), size, compare_us, res);
+                break;
+            case proto::plan::OpType::LessThan:
+                CompareShifted<proto::plan::OpType::LessThan>(
+                    shifted_.data(), size, compare_us, res);
+                break;
+            case proto::plan::OpType::LessEqual:
+                CompareShifted<proto::plan::OpType::LessEqual>(
+                    shifted_.data(), size, compare_us, res);
+                break;
+            default:  // Should not happen
                 ThrowInfo(OpTypeInvalid,
-                          "gmtime_r failed for timestamp {} us",
-                          current_ts_us);
-            }
-            // Apply interval fields using int64_t intermediate arithmetic
-            // to avoid int overflow UB, then validate range before assigning
-            // back to struct tm (which uses int fields).
-            auto safe_add = [](int base, int64_t delta) -> int {
-                int64_t result = static_cast<int64_t>(base) + delta;
-                AssertInfo(result >= INT_MIN && result <= INT_MAX,
-                           "timestamp interval arithmetic overflow: "
-                           "{} + {} = {}",
-                           base,
-                           delta,
-                           result);
-                return static_cast<int>(result);
-            };
-            // Cast to int64_t before multiplying to avoid int * int overflow
-            // (e.g. interval.years() == INT32_MIN, op_sign == -1).
-            tm_buf.tm_year =
-                safe_add(tm_buf.tm_year,
-                         static_cast<int64_t>(interval.years()) * op_sign);
-            tm_buf.tm_mon =
-                safe_add(tm_buf.tm_mon,
-                         static_cast<int64_t>(interval.months()) * op_sign);
-            tm_buf.tm_mday =
-                safe_add(tm_buf.tm_mday,
-                         static_cast<int64_t>(interval.days()) * op_sign);
-            tm_buf.tm_hour =
-                safe_add(tm_buf.tm_hour,
-                         static_cast<int64_t>(interval.hours()) * op_sign);
-            tm_buf.tm_min =
-                safe_add(tm_buf.tm_min,
-                         static_cast<int64_t>(interval.minutes()) * op_sign);
-            tm_buf.tm_sec =
-                safe_add(tm_buf.tm_sec,
-                         static_cast<int64_t>(interval.seconds()) * op_sign);
-            // timegm normalizes the tm fields and converts back to epoch.
-            // It succeeds for all normalized inputs from gmtime_r + safe_add.
-            // No -1 check: -1 is a valid epoch second (1969-12-31T23:59:59Z)
-            // and is reachable via legal interval arithmetic (e.g., epoch 0 - 1s).
-            std::time_t new_epoch_sec = ::timegm(&tm_buf);
-            // Guard against overflow in epoch_sec * 1000000.
-            // INT64_MAX / 1000000 ≈ ±9.2e12 sec ≈ ±292,271 years from epoch.
-            constexpr int64_t kMaxSec = (INT64_MAX - 999999) / 1000000;
-            constexpr int64_t kMinSec = (INT64_MIN + 999999) / 1000000;
-            AssertInfo(
-                new_epoch_sec >= kMinSec && new_epoch_sec <= kMaxSec,
-                "timestamp after interval arithmetic out of representable "
-                "range: {} seconds from epoch",
-                static_cast<int64_t>(new_epoch_sec));
-            // Restore sub-second microseconds from the original timestamp
-            int64_t final_us =
-                static_cast<int64_t>(new_epoch_sec) * 1000000 + sub_sec_us;
-            bool match = false;
-            switch (compare_op) {
-                case proto::plan::OpType::Equal:
-                    match = (final_us == compare_us);
-                    break;
-                case proto::plan::OpType::NotEqual:
-                    match = (final_us != compare_us);
-                    break;
-                case proto::plan::OpType::GreaterThan:
-                    match = (final_us > compare_us);
-                    break;
-                case proto::plan::OpType::GreaterEqual:
-                    match = (final_us >= compare_us);
-                    break;
-                case proto::plan::OpType::LessThan:
-                    match = (final_us < compare_us);
-                    break;
-                case proto::plan::OpType::LessEqual:
-                    match = (final_us <= compare_us);
-                    break;
-                default:  // Should not happen
-                    ThrowInfo(OpTypeInvalid,
-                              "Unsupported compare op for "
-                              "timestamptz_arith_compare_expr");
-            }
-            res[i] = match;
+                          "Unsupported compare op for "
+                          "timestamptz_arith_compare_expr");
         }
     };
     int64_t processed_size;
@@ -207,15 +314,13 @@ PhyTimestamptzArithCompareExpr::ExecCompareVisitorImplForAll(
                                                  input,
                                                  res,
                                                  valid_res,
-                                                 compare_value,
-                                                 interval);
+                                                 compare_value);
     } else {
         processed_size = ProcessDataChunks<T>(exec_sub_batch,
                                               std::nullptr_t{},
                                               res,
                                               valid_res,
-                                              compare_value,
-                                              interval);
+                                              compare_value);
     }
     AssertInfo(processed_size == real_batch_size,
                "internal error: expr processed rows {} not equal "
@@ -11,7 +11,10 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <vector>
+
 #include "common/Vector.h"
 #include "exec/expression/BinaryArithOpEvalRangeExpr.h"
 #include "exec/expression/Element.h"
@@ -21,6 +24,24 @@
 
 namespace milvus::exec {
 
+// `ts +/- interval op value` as the range compare `ts op value -/+ interval`
+// when the interval is a fixed duration, which the unary range expression
+// then evaluates with SIMD, indexes and skip indexes. nullptr when the
+// interval has a month or year part, the column is an array element or the
+// folded value does not fit in int64.
+std::shared_ptr<const milvus::expr::UnaryRangeFilterExpr>
+FoldTimestamptzArithCompare(
+    const std::shared_ptr<const milvus::expr::TimestamptzArithCompareExpr>&
+        expr);
+
+// `ts_us` moved by `months` calendar months and then by `seconds`, in UTC.
+// A day of month past the end of the new month rolls over into the next
+// one, e.g. Jan 31 + 1 month is Mar 3 (Mar 2 in leap years), as timegm
+// normalizes it. Throws when the result is not representable in int64
+// microseconds.
+int64_t
+ShiftTimestamptz(int64_t ts_us, int64_t months, int64_t seconds);
+
 class PhyTimestamptzArithCompareExpr : public SegmentExpr {
  public:
     PhyTimestamptzArithCompareExpr(
@@ -76,8 +97,13 @@ class PhyTimestamptzArithCompareExpr : public SegmentExpr {
     std::shared_ptr<PhyBinaryArithOpEvalRangeExpr> helperPhyExpr_;
     std::shared_ptr<const milvus::expr::TimestamptzArithCompareExpr> expr_;
     bool arg_inited_{false};
-    proto::plan::Interval interval_;
+    // the interval split into its calendar and fixed duration parts, signed
+    // by the arith op
+    int64_t interval_months_{0};
+    int64_t interval_seconds_{0};
     SingleElement compare_value_;
+    // rows of the current batch after the interval arithmetic
+    std::vector<int64_t> shifted_;
 };
 
 }  // namespace milvus::exec
\ No newline at end of file
@@ -0,0 +1,145 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+
+#include "common/Types.h"
+#include "exec/expression/TimestamptzArithCompareExpr.h"
+#include "expr/ITypeExpr.h"
+#include "pb/plan.pb.h"
+
+using namespace milvus;
+
+namespace {
+
+constexpr int64_t kSecond = 1000000;
+constexpr int64_t kDay = 86400 * kSecond;
+// 2024-01-31T00:00:00Z
+constexpr int64_t kJan31 = 1706659200 * kSecond;
+
+std::shared_ptr<const expr::TimestamptzArithCompareExpr>
+MakeExpr(proto::plan::ArithOpType arith_op,
+         const proto::plan::Interval& interval,
+         proto::plan::OpType compare_op,
+         int64_t compare_value,
+         bool element_level = false) {
+    proto::plan::ColumnInfo column_pb;
+    column_pb.set_field_id(100);
+    column_pb.set_data_type(
+        static_cast<proto::schema::DataType>(DataType::TIMESTAMPTZ));
+    column_pb.set_is_element_level(element_level);
+    proto::plan::GenericValue value;
+    value.set_int64_val(compare_value);
+    return std::make_shared<const expr::TimestamptzArithCompareExpr>(
+        expr::ColumnInfo(column_pb), arith_op, interval, compare_op, value);
+}
+
+}  // namespace
+
+TEST(TimestamptzArithCompare, FoldsFixedDurationIntervals) {
+    proto::plan::Interval interval;
+    interval.set_days(1);
+    interval.set_hours(2);
+    interval.set_seconds(3);
+    const int64_t delta = kDay + (2 * 3600 + 3) * kSecond;
+
+    auto added = FoldTimestamptzArithCompare(
+        MakeExpr(proto::plan::ArithOpType::Add,
+                 interval,
+                 proto::plan::OpType::GreaterThan,
+                 kJan31));
+    ASSERT_NE(added, nullptr);
+    EXPECT_EQ(added->op_type_, proto::plan::OpType::GreaterThan);
+    EXPECT_EQ(added->val_.int64_val(), kJan31 - delta);
+    EXPECT_EQ(added->column_.field_id_, FieldId(100));
+
+    auto subtracted = FoldTimestamptzArithCompare(
+        MakeExpr(proto::plan::ArithOpType::Sub,
+                 interval,
+                 proto::plan::OpType::LessEqual,
+                 kJan31));
+    ASSERT_NE(subtracted, nullptr);
+    EXPECT_EQ(subtracted->val_.int64_val(), kJan31 + delta);
+
+    // no arithmetic at all compares the column as is
+    auto plain = FoldTimestamptzArithCompare(
+        MakeExpr(proto::plan::ArithOpType::Unknown,
+                 interval,
+                 proto::plan::OpType::Equal,
+                 kJan31));
+    ASSERT_NE(plain, nullptr);
+    EXPECT_EQ(plain->val_.int64_val(), kJan31);
+}
+
+TEST(TimestamptzArithCompare, KeepsCalendarIntervalsPerRow) {
+    proto::plan::Interval months;
+    months.set_months(1);
+    EXPECT_EQ(FoldTimestamptzArithCompare(
+                  MakeExpr(proto::plan::ArithOpType::Add,
+                           months,
+                           proto::plan::OpType::Equal,
+                           kJan31)),
+              nullptr);
+
+    proto::plan::Interval years;
+    years.set_years(-1);
+    years.set_days(3);
+    EXPECT_EQ(FoldTimestamptzArithCompare(
+                  MakeExpr(proto::plan::ArithOpType::Sub,
+                           years,
+                           proto::plan::OpType::Equal,
+                           kJan31)),
+              nullptr);
+
+    proto::plan::Interval days;
+    days.set_days(1);
+    EXPECT_EQ(FoldTimestamptzArithCompare(
+                  MakeExpr(proto::plan::ArithOpType::Add,
+                           days,
+                           proto::plan::OpType::Equal,
+                           kJan31,
+                           /*element_level=*/true)),
+              nullptr);
+    // the folded value would not fit in int64
+    EXPECT_EQ(FoldTimestamptzArithCompare(
+                  MakeExpr(proto::plan::ArithOpType::Add,
+                           days,
+                           proto::plan::OpType::Equal,
+                           INT64_MIN + 1)),
+              nullptr);
+}
+
+TEST(TimestamptzArithCompare, ShiftsByCalendarMonths) {
+    // Jan 31 2024 + 1 month rolls over to Mar 2, 2024 being a leap year
+    EXPECT_EQ(ShiftTimestamptz(kJan31, 1, 0), kJan31 + 31 * kDay);
+    // + 1 year is Jan 31 2025
+    EXPECT_EQ(ShiftTimestamptz(kJan31, 12, 0), kJan31 + 366 * kDay);
+    // - 2 months is Nov 31 2023, i.e. Dec 1
+    EXPECT_EQ(ShiftTimestamptz(kJan31, -2, 0), kJan31 - 61 * kDay);
+    // the fixed part is applied after the calendar one
+    EXPECT_EQ(ShiftTimestamptz(kJan31 + 5, 1, -86400),
+              kJan31 + 30 * kDay + 5);
+    // sub-second digits of pre-epoch timestamps are kept
+    EXPECT_EQ(ShiftTimestamptz(-1500000, 0, 1), -500000);
+    EXPECT_EQ(ShiftTimestamptz(-1500000, 12, 0), 365 * kDay - 1500000);
+
+    EXPECT_ANY_THROW(ShiftTimestamptz(INT64_MAX - kDay, 0, 86400 * 2));
+    EXPECT_ANY_THROW(ShiftTimestamptz(0, int64_t{300000} * 12, 0));
+}
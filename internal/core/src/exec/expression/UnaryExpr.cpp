@@ -42,6 +42,7 @@
 #include "common/type_c.h"
 #include "exec/expression/ExprCache.h"
 #include "exec/expression/ExprCacheHelper.h"
+#include "exec/expression/SortedDataRange.h"
 #include "fmt/core.h"
 #include "folly/FBVector.h"
 #include "glog/logging.h"
@@ -345,9 +346,7 @@ PhyUnaryRangeFilterExpr::ExecRangeVisitorImplArray(EvalCtx& context) {
     if (real_batch_size == 0) {
         return nullptr;
     }
-    auto res_vec =
-        std::make_shared<ColumnVector>(TargetBitmap(real_batch_size, false),
-                                       TargetBitmap(real_batch_size, true));
+    auto res_vec = NewBitmapColumn(real_batch_size);
     TargetBitmapView res(res_vec->GetRawData(), real_batch_size);
     TargetBitmapView valid_res(res_vec->GetValidRawData(), real_batch_size);
 
@@ -733,15 +732,14 @@ PhyUnaryRangeFilterExpr::ExecRangeVisitorImplJson(EvalCtx& context) {
         value_arg_.SetValue<ExprValueType>(expr_->val_);
         arg_inited_ = true;
     }
-    auto res_vec =
-        std::make_shared<ColumnVector>(TargetBitmap(real_batch_size, false),
-                                       TargetBitmap(real_batch_size, true));
+    auto res_vec = NewBitmapColumn(real_batch_size);
     TargetBitmapView res(res_vec->GetRawData(), real_batch_size);
     TargetBitmapView valid_res(res_vec->GetValidRawData(), real_batch_size);
 
     ExprValueType val = value_arg_.GetValue<ExprValueType>();
     auto op_type = expr_->op_type_;
-    auto pointer = milvus::Json::pointer(expr_->column_.nested_path_);
+    milvus::JsonPointer pointer(
+        milvus::Json::pointer(expr_->column_.nested_path_));
 
 // For int64_t GetType, uses at_numeric() (get_number()) to extract any JSON
 // number in a single parse.  Branches on actual type to preserve int64
@@ -899,7 +897,7 @@ PhyUnaryRangeFilterExpr::ExecRangeVisitorImplJson(EvalCtx& context) {
                     }
                     if constexpr (std::is_same_v<GetType, proto::plan::Array>) {
                         auto doc = data[i].doc();
-                        auto array = doc.at_pointer(pointer).get_array();
+                        auto array = pointer.Find(doc).get_array();
                         if (array.error()) {
                             res[i] = false;
                             continue;
@@ -927,7 +925,7 @@ PhyUnaryRangeFilterExpr::ExecRangeVisitorImplJson(EvalCtx& context) {
                     }
                     if constexpr (std::is_same_v<GetType, proto::plan::Array>) {
                         auto doc = data[i].doc();
-                        auto array = doc.at_pointer(pointer).get_array();
+                        auto array = pointer.Find(doc).get_array();
                         if (array.error()) {
                             res[i] = false;
                             continue;
@@ -966,7 +964,9 @@ PhyUnaryRangeFilterExpr::ExecRangeVisitorImplJson(EvalCtx& context) {
             }
             case proto::plan::Match: {
                 if constexpr (std::is_same_v<ExprValueType, std::string>) {
-                    LikePatternMatcher matcher(val);
+                    auto& cache = PatternMatcherCache::GetInstance();
+                    auto matcher_ptr = cache.GetLikePatternMatcher(val);
+                    const auto& matcher = *matcher_ptr;
                     for (size_t i = 0; i < size; ++i) {
                         auto offset = i;
                         if constexpr (filter_type == FilterType::random) {
@@ -990,7 +990,9 @@ PhyUnaryRangeFilterExpr::ExecRangeVisitorImplJson(EvalCtx& context) {
             }
             case proto::plan::RegexMatch: {
                 if constexpr (std::is_same_v<ExprValueType, std::string>) {
-                    PartialRegexMatcher matcher(val);
+                    auto& cache = PatternMatcherCache::GetInstance();
+                    auto matcher_ptr = cache.GetPartialRegexMatcher(val);
+                    const auto& matcher = *matcher_ptr;
                     for (size_t i = 0; i < size; ++i) {
                         auto offset = i;
                         if constexpr (filter_type == FilterType::random) {
@@ -1127,10 +1129,34 @@ PhyUnaryRangeFilterExpr::ExecRangeVisitorImplJsonByStats() {
                 TargetBitmapView target_res_view(target_res);
                 ShreddingExecutor<ColType, ValType> executor(
                     op_type, pointer, val);
+                // chunks whose min/max or bloom filter rule the value out
+                // are not compared, only typed values the column can hold
+                // exactly are checked
+                std::function<bool(const milvus::SkipIndex&, FieldId, int)>
+                    skip_func;
+                if constexpr (!std::is_same_v<ColType, bool> &&
+                              (std::is_same_v<ColType, ValType> ||
+                               std::is_same_v<ColType, double>)) {
+                    bool exact = true;
+                    if constexpr (!std::is_same_v<ColType, ValType>) {
+                        constexpr int64_t kMaxExactInt = int64_t(1) << 53;
+                        exact = val >= -kMaxExactInt && val <= kMaxExactInt;
+                    }
+                    if (exact && array_index == INVALID_ARRAY_INDEX) {
+                        auto skip_val = static_cast<ColType>(val);
+                        skip_func = [this, op_type, skip_val](
+                                        const milvus::SkipIndex& skip_index,
+                                        FieldId field_id,
+                                        int chunk_id) {
+                            return skip_index.CanSkipUnaryRange<ColType>(
+                                op_ctx_, field_id, chunk_id, op_type, skip_val);
+                        };
+                    }
+                }
                 index->ExecutorForShreddingData<ColType>(op_ctx_,
                                                          target_field,
                                                          executor,
-                                                         nullptr,
+                                                         skip_func,
                                                          target_res_view,
                                                          target_res_view);
                 res_view.inplace_or_with_count(target_res_view, active_count_);
@@ -1196,19 +1222,19 @@ PhyUnaryRangeFilterExpr::ExecRangeVisitorImplJsonByStats() {
         // process shared data
         // Pre-construct context with LikePatternMatcher for Match ops on
         // string types to avoid re-parsing the pattern on every row.
-        [[maybe_unused]] std::optional<LikePatternMatcher> like_matcher;
-        [[maybe_unused]] std::optional<PartialRegexMatcher> regex_matcher;
+        [[maybe_unused]] std::shared_ptr<const LikePatternMatcher> like_matcher;
+        [[maybe_unused]] std::shared_ptr<const PartialRegexMatcher>
+            regex_matcher;
         if constexpr (std::is_same_v<GetType, std::string> ||
                       std::is_same_v<GetType, std::string_view>) {
+            auto& cache = PatternMatcherCache::GetInstance();
             if (op_type == proto::plan::OpType::Match) {
-                like_matcher.emplace(val);
+                like_matcher = cache.GetLikePatternMatcher(val);
             } else if (op_type == proto::plan::OpType::RegexMatch) {
-                regex_matcher.emplace(val);
+                regex_matcher = cache.GetPartialRegexMatcher(val);
             }
         }
-        UnaryCompareContext context{
-            like_matcher.has_value() ? &like_matcher.value() : nullptr,
-            regex_matcher.has_value() ? &regex_matcher.value() : nullptr};
+        UnaryCompareContext context{like_matcher.get(), regex_matcher.get()};
         auto shared_executor = [op_type, val, array_index, &res_view, &context](
                                    milvus::BsonView bson,
                                    uint32_t row_id,
@@ -1260,14 +1286,20 @@ PhyUnaryRangeFilterExpr::ExecRangeVisitorImplJsonByStats() {
                         set_unknown(row_id);
                         return;
                     }
-                    get_value = milvus::BsonView::GetNthElementInArray<GetType>(
+                    auto element = milvus::BsonView::FindNthElementInArray(
                         array_value.value().data(), array_index);
+                    if (!element.has_value()) {
+                        set_unknown(row_id);
+                        return;
+                    }
+                    get_value = milvus::BsonView::GetValueFromField<GetType>(
+                        element.value());
                     // If GetType is int and value is not found, try double
                     if constexpr (std::is_same_v<GetType, int64_t>) {
                         if (!get_value.has_value()) {
                             auto get_value =
-                                milvus::BsonView::GetNthElementInArray<double>(
-                                    array_value.value().data(), array_index);
+                                milvus::BsonView::GetValueFromField<double>(
+                                    element.value());
                             if (get_value.has_value()) {
                                 set_known(row_id,
                                           UnaryCompare(
@@ -1280,8 +1312,8 @@ PhyUnaryRangeFilterExpr::ExecRangeVisitorImplJsonByStats() {
                     } else if constexpr (std::is_same_v<GetType, double>) {
                         if (!get_value.has_value()) {
                             auto get_value =
-                                milvus::BsonView::GetNthElementInArray<int64_t>(
-                                    array_value.value().data(), array_index);
+                                milvus::BsonView::GetValueFromField<int64_t>(
+                                    element.value());
                             if (get_value.has_value()) {
                                 set_known(row_id,
                                           UnaryCompare(
@@ -1399,6 +1431,12 @@ PhyUnaryRangeFilterExpr::ExecRangeVisitorImpl(EvalCtx& context) {
         }
     }
 
+    if constexpr (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>) {
+        if (!has_offset_input_ && exec_path_ == ExprExecPath::SortedData) {
+            return ExecRangeVisitorImplForSortedData<T>();
+        }
+    }
+
     if (exec_path_ == ExprExecPath::ScalarIndex && !has_offset_input_) {
         return ExecRangeVisitorImplForIndex<T>();
     } else {
@@ -1447,6 +1485,70 @@ PhyUnaryRangeFilterExpr::ExecRangeVisitorImplForPk(EvalCtx& context) {
     return res;
 }
 
+template <typename T>
+VectorPtr
+PhyUnaryRangeFilterExpr::ExecRangeVisitorImplForSortedData() {
+    // integers compare against the literal as int64, so one out of the
+    // field's range puts the run at an end of the segment
+    typedef std::conditional_t<std::is_integral_v<T>, int64_t, T>
+        HighPrecisionType;
+
+    auto real_batch_size = GetNextBatchSize();
+    if (real_batch_size == 0) {
+        return nullptr;
+    }
+
+    if (cached_index_chunk_id_ != 0) {
+        cached_index_chunk_id_ = 0;
+        auto val = GetValueFromProto<HighPrecisionType>(expr_->val_);
+        auto lower_bound = [&]() {
+            return SortedLowerBound<T>(op_ctx_, *segment_, field_id_, val);
+        };
+        auto upper_bound = [&]() {
+            return SortedUpperBound<T>(op_ctx_, *segment_, field_id_, val);
+        };
+        int64_t begin = 0;
+        int64_t end = active_count_;
+        switch (expr_->op_type_) {
+            case proto::plan::GreaterThan:
+                begin = upper_bound();
+                break;
+            case proto::plan::GreaterEqual:
+                begin = lower_bound();
+                break;
+            case proto::plan::LessThan:
+                end = lower_bound();
+                break;
+            case proto::plan::LessEqual:
+                end = upper_bound();
+                break;
+            case proto::plan::Equal:
+            case proto::plan::NotEqual:
+                begin = lower_bound();
+                end = upper_bound();
+                break;
+            default:
+                ThrowInfo(OpTypeInvalid,
+                          "unsupported operator type for sorted data: {}",
+                          expr_->op_type_);
+        }
+        begin = std::min(begin, active_count_);
+        end = std::min(end, active_count_);
+        cached_index_chunk_res_ = std::make_shared<TargetBitmap>(active_count_);
+        if (begin < end) {
+            cached_index_chunk_res_->set(begin, end - begin, true);
+        }
+        if (expr_->op_type_ == proto::plan::NotEqual) {
+            cached_index_chunk_res_->flip();
+        }
+    }
+
+    auto res = MoveOrSliceBitmap(
+        *cached_index_chunk_res_, current_data_global_pos_, real_batch_size);
+    MoveCursor();
+    return res;
+}
+
 template <typename T>
 VectorPtr
 PhyUnaryRangeFilterExpr::ExecRangeVisitorImplForIndex() {
@@ -1535,6 +1637,28 @@ PhyUnaryRangeFilterExpr::ExecRangeVisitorImplForIndex() {
         return res;
     };
     IndexInnerType val = value_arg_.GetValue<IndexInnerType>();
+    if (!expr_->column_.element_level_) {
+        switch (op_type) {
+            case proto::plan::GreaterThan:
+            case proto::plan::GreaterEqual:
+                SetRangeCacheQuery<IndexInnerType>(
+                    val,
+                    op_type == proto::plan::GreaterEqual,
+                    std::nullopt,
+                    false);
+                break;
+            case proto::plan::LessThan:
+            case proto::plan::LessEqual:
+                SetRangeCacheQuery<IndexInnerType>(
+                    std::nullopt,
+                    false,
+                    val,
+                    op_type == proto::plan::LessEqual);
+                break;
+            default:
+                break;
+        }
+    }
     auto res = ProcessIndexChunks<T>(execute_sub_batch, val);
     AssertInfo(res->size() == real_batch_size,
                "internal error: expr processed rows {} not equal "
@@ -1631,9 +1755,7 @@ PhyUnaryRangeFilterExpr::ExecRangeVisitorImplForData(EvalCtx& context) {
         arg_inited_ = true;
     }
     IndexInnerType val = GetValueFromProto<IndexInnerType>(expr_->val_);
-    auto res_vec =
-        std::make_shared<ColumnVector>(TargetBitmap(real_batch_size, false),
-                                       TargetBitmap(real_batch_size, true));
+    auto res_vec = NewBitmapColumn(real_batch_size);
     TargetBitmapView res(res_vec->GetRawData(), real_batch_size);
     TargetBitmapView valid_res(res_vec->GetValidRawData(), real_batch_size);
     auto expr_type = expr_->op_type_;
@@ -1642,8 +1764,9 @@ PhyUnaryRangeFilterExpr::ExecRangeVisitorImplForData(EvalCtx& context) {
     EnsureRegexCache();
     EnsureLikeMatcherCache();
     const PartialRegexMatcher* regex_matcher_ptr = cached_regex_matcher_.get();
-    const VolnitskySearcher* volnitsky_ptr = cached_volnitsky_searcher_.get();
+    const LiteralPrefilter* regex_prefilter_ptr = cached_regex_prefilter_.get();
     const LikePatternMatcher* like_matcher_ptr = cached_like_matcher_.get();
+    const LiteralPrefilter* like_prefilter_ptr = cached_like_prefilter_.get();
 
     size_t processed_cursor = 0;
     auto execute_sub_batch =
@@ -1652,8 +1775,9 @@ PhyUnaryRangeFilterExpr::ExecRangeVisitorImplForData(EvalCtx& context) {
             &processed_cursor,
             &bitmap_input,
             regex_matcher_ptr,
-            volnitsky_ptr,
-            like_matcher_ptr
+            regex_prefilter_ptr,
+            like_matcher_ptr,
+            like_prefilter_ptr
         ]<FilterType filter_type = FilterType::sequential>(
             const T* data,
             const bool* valid_data,
@@ -1773,6 +1897,7 @@ PhyUnaryRangeFilterExpr::ExecRangeVisitorImplForData(EvalCtx& context) {
             case proto::plan::Match: {
                 UnaryElementFuncForMatch<T, filter_type> func;
                 func.matcher = like_matcher_ptr;
+                func.prefilter = like_prefilter_ptr;
                 func(data,
                      size,
                      val,
@@ -1785,7 +1910,7 @@ PhyUnaryRangeFilterExpr::ExecRangeVisitorImplForData(EvalCtx& context) {
             case proto::plan::RegexMatch: {
                 UnaryElementFuncForRegexMatch<T, filter_type> func;
                 func.matcher = regex_matcher_ptr;
-                func.searcher = volnitsky_ptr;
+                func.prefilter = regex_prefilter_ptr;
                 func(data,
                      size,
                      val,
@@ -1804,8 +1929,10 @@ PhyUnaryRangeFilterExpr::ExecRangeVisitorImplForData(EvalCtx& context) {
         // there is a batch operation in BinaryRangeElementFunc,
         // so not divide data again for the reason that it may reduce performance if the null distribution is scattered
         // but to mask res with valid_data after the batch operation.
-        if (valid_data != nullptr) {
-            bool has_bitmap_input = !bitmap_input.empty();
+        bool has_bitmap_input = !bitmap_input.empty();
+        if (filter_type == FilterType::sequential && !has_bitmap_input) {
+            ApplyValidMask(valid_data, res, valid_res, size);
+        } else if (valid_data != nullptr) {
             for (int i = 0; i < size; i++) {
                 if (has_bitmap_input && !bitmap_input[i + processed_cursor]) {
                     continue;
@@ -1844,6 +1971,9 @@ PhyUnaryRangeFilterExpr::ExecRangeVisitorImplForData(EvalCtx& context) {
             // For element-level filtering without offset input (brute force)
             processed_size = ProcessDataChunksForElementLevel<T>(
                 execute_sub_batch, skip_index_func, res, valid_res, val);
+        } else if (bitmap_input.empty()) {
+            processed_size = ProcessDataChunksByDictionary<T>(
+                execute_sub_batch, skip_index_func, res, valid_res, val);
         } else {
             processed_size = ProcessDataChunks<T>(
                 execute_sub_batch, skip_index_func, res, valid_res, val);
@@ -1884,6 +2014,14 @@ PhyUnaryRangeFilterExpr::DetermineExecPath() {
         return;
     }
 
+    // SortedData: the matches of a compare on a field loaded in sorted
+    // order are one run of offsets, cheaper to find than an index lookup.
+    if (IsCompareOp(expr_->op_type_) && !expr_->column_.element_level_ &&
+        CanUseSortedDataAtInit(expr_->val_)) {
+        exec_path_ = ExprExecPath::SortedData;
+        return;
+    }
+
     SegmentExpr::DetermineExecPath();
     if (exec_path_ != ExprExecPath::ScalarIndex) {
         return;
@@ -1956,6 +2094,28 @@ PhyUnaryRangeFilterExpr::DetermineExecPath() {
     }
     if (!can_use) {
         exec_path_ = ExprExecPath::RawData;
+        return;
+    }
+
+    auto bound = ToMetrics(expr_->val_);
+    if (expr_->column_.element_level_ || !bound.has_value()) {
+        return;
+    }
+    switch (expr_->op_type_) {
+        case proto::plan::GreaterThan:
+            PreferRawScanForWideRange({bound, false}, {});
+            break;
+        case proto::plan::GreaterEqual:
+            PreferRawScanForWideRange({bound, true}, {});
+            break;
+        case proto::plan::LessThan:
+            PreferRawScanForWideRange({}, {bound, false});
+            break;
+        case proto::plan::LessEqual:
+            PreferRawScanForWideRange({}, {bound, true});
+            break;
+        default:
+            break;
     }
 }
 
@@ -31,7 +31,8 @@
 #include "segcore/SegmentInterface.h"
 #include "query/Utils.h"
 #include "common/RegexQuery.h"
-#include "common/Volnitsky.h"
+#include "common/LiteralPrefilter.h"
+#include "common/PatternMatcherCache.h"
 #include "index/NgramInvertedIndex.h"
 #include "exec/expression/Utils.h"
 #include "common/bson_view.h"
@@ -86,7 +87,10 @@ UnaryCompare(const T& get_value,
                 if (context && context->like_matcher) {
                     return (*context->like_matcher)(get_value);
                 }
-                LikePatternMatcher fallback(val);
+                auto fallback_ptr =
+                    PatternMatcherCache::GetInstance().GetLikePatternMatcher(
+                        val);
+                const auto& fallback = *fallback_ptr;
                 return fallback(get_value);
             } else {
                 ThrowInfo(OpTypeInvalid,
@@ -98,7 +102,10 @@ UnaryCompare(const T& get_value,
                 if (context && context->regex_matcher) {
                     return (*context->regex_matcher)(get_value);
                 }
-                PartialRegexMatcher fallback(val);
+                auto fallback_ptr =
+                    PatternMatcherCache::GetInstance().GetPartialRegexMatcher(
+                        val);
+                const auto& fallback = *fallback_ptr;
                 return fallback(get_value);
             } else {
                 ThrowInfo(OpTypeInvalid,
@@ -111,6 +118,28 @@ UnaryCompare(const T& get_value,
     }
 }
 
+// Runs `matcher` only on the rows of src[0, size) the prefilter keeps and
+// writes false for the rest.
+template <typename T, typename Matcher>
+void
+MatchCandidates(const T* src,
+                size_t size,
+                const LiteralPrefilter& prefilter,
+                const Matcher& matcher,
+                TargetBitmapView res) {
+    size_t next = 0;
+    prefilter.ForEachCandidate(src, size, [&](size_t row) {
+        for (; next < row; ++next) {
+            res[next] = false;
+        }
+        res[row] = matcher(src[row]);
+        next = row + 1;
+    });
+    for (; next < size; ++next) {
+        res[next] = false;
+    }
+}
+
 template <typename T, FilterType filter_type = FilterType::sequential>
 struct UnaryElementFuncForMatch {
     using IndexInnerType =
@@ -120,6 +149,8 @@ struct UnaryElementFuncForMatch {
     // across batches; nullptr means build a local one (mirrors
     // UnaryElementFuncForRegexMatch).
     const LikePatternMatcher* matcher = nullptr;
+    // null if the pattern has no literal text
+    const LiteralPrefilter* prefilter = nullptr;
 
     void
     operator()(const T* src,
@@ -133,14 +164,20 @@ struct UnaryElementFuncForMatch {
 
         if constexpr (std::is_same_v<T, std::string> ||
                       std::is_same_v<T, std::string_view>) {
-            std::unique_ptr<LikePatternMatcher> local_matcher;
+            std::shared_ptr<const LikePatternMatcher> local_matcher;
             const LikePatternMatcher* m = matcher;
             if (m == nullptr) {
-                local_matcher = std::make_unique<LikePatternMatcher>(val);
+                local_matcher =
+                    PatternMatcherCache::GetInstance().GetLikePatternMatcher(
+                        val);
                 m = local_matcher.get();
             }
-            for (int i = 0; i < size; ++i) {
-                res[i] = (*m)(src[i]);
+            if (prefilter) {
+                MatchCandidates(src, size, *prefilter, *m, res);
+            } else {
+                for (int i = 0; i < size; ++i) {
+                    res[i] = (*m)(src[i]);
+                }
             }
         } else {
             ThrowInfo(OpTypeInvalid,
@@ -158,13 +195,21 @@ struct UnaryElementFuncForMatch {
                const int32_t* offsets = nullptr) {
         if constexpr (std::is_same_v<T, std::string> ||
                       std::is_same_v<T, std::string_view>) {
-            std::unique_ptr<LikePatternMatcher> local_matcher;
+            std::shared_ptr<const LikePatternMatcher> local_matcher;
             const LikePatternMatcher* m = matcher;
             if (m == nullptr) {
-                local_matcher = std::make_unique<LikePatternMatcher>(val);
+                local_matcher =
+                    PatternMatcherCache::GetInstance().GetLikePatternMatcher(
+                        val);
                 m = local_matcher.get();
             }
             bool has_bitmap_input = !bitmap_input.empty();
+            if constexpr (filter_type == FilterType::sequential) {
+                if (prefilter && !has_bitmap_input) {
+                    MatchCandidates(src, size, *prefilter, *m, res);
+                    return;
+                }
+            }
             for (int i = 0; i < size; ++i) {
                 if (has_bitmap_input && !bitmap_input[i + start_cursor]) {
                     continue;
@@ -191,7 +236,7 @@ struct UnaryElementFuncForRegexMatch {
     // constructed once per segment, passed by pointer to avoid per-batch
     // reconstruction.
     const PartialRegexMatcher* matcher = nullptr;
-    const VolnitskySearcher* searcher = nullptr;  // null if no literal
+    const LiteralPrefilter* prefilter = nullptr;  // null if no literal
 
     void
     operator()(const T* src,
@@ -206,17 +251,17 @@ struct UnaryElementFuncForRegexMatch {
         if constexpr (std::is_same_v<T, std::string> ||
                       std::is_same_v<T, std::string_view>) {
             // Fallback: construct locally if no pre-built objects
-            std::unique_ptr<PartialRegexMatcher> local_matcher;
+            std::shared_ptr<const PartialRegexMatcher> local_matcher;
             const PartialRegexMatcher* m = matcher;
             if (!m) {
-                local_matcher = std::make_unique<PartialRegexMatcher>(val);
+                local_matcher =
+                    PatternMatcherCache::GetInstance().GetPartialRegexMatcher(
+                        val);
                 m = local_matcher.get();
             }
 
-            if (searcher) {
-                for (int i = 0; i < size; ++i) {
-                    res[i] = searcher->contains(src[i]) && (*m)(src[i]);
-                }
+            if (prefilter) {
+                MatchCandidates(src, size, *prefilter, *m, res);
             } else {
                 for (int i = 0; i < size; ++i) {
                     res[i] = (*m)(src[i]);
@@ -238,22 +283,31 @@ struct UnaryElementFuncForRegexMatch {
                const int32_t* offsets = nullptr) {
         if constexpr (std::is_same_v<T, std::string> ||
                       std::is_same_v<T, std::string_view>) {
-            std::unique_ptr<PartialRegexMatcher> local_matcher;
+            std::shared_ptr<const PartialRegexMatcher> local_matcher;
             const PartialRegexMatcher* m = matcher;
             if (!m) {
-                local_matcher = std::make_unique<PartialRegexMatcher>(val);
+                local_matcher =
+                    PatternMatcherCache::GetInstance().GetPartialRegexMatcher(
+                        val);
                 m = local_matcher.get();
             }
 
             bool has_bitmap_input = !bitmap_input.empty();
-            if (searcher) {
+            if constexpr (filter_type == FilterType::sequential) {
+                if (prefilter && !has_bitmap_input) {
+                    MatchCandidates(src, size, *prefilter, *m, res);
+                    return;
+                }
+            }
+            if (prefilter) {
                 for (int i = 0; i < size; ++i) {
                     if (has_bitmap_input && !bitmap_input[i + start_cursor])
                         continue;
                     auto idx = (filter_type == FilterType::random && offsets)
                                    ? offsets[i]
                                    : i;
-                    res[i] = searcher->contains(src[idx]) && (*m)(src[idx]);
+                    res[i] =
+                        prefilter->MayMatch(src[idx]) && (*m)(src[idx]);
                 }
             } else {
                 for (int i = 0; i < size; ++i) {
@@ -509,16 +563,21 @@ struct UnaryElementFuncForArray {
         bool has_bitmap_input = !bitmap_input.empty();
         // Pre-construct LikePatternMatcher/PartialRegexMatcher before the loop
         // to avoid re-parsing the pattern on every row.
-        [[maybe_unused]] std::optional<LikePatternMatcher> matcher;
+        [[maybe_unused]] std::shared_ptr<const LikePatternMatcher> matcher;
         if constexpr (op == proto::plan::OpType::Match) {
             if constexpr (std::is_same_v<ValueType, std::string>) {
-                matcher.emplace(val);
+                matcher =
+                    PatternMatcherCache::GetInstance().GetLikePatternMatcher(
+                        val);
             }
         }
-        [[maybe_unused]] std::optional<PartialRegexMatcher> regex_matcher;
+        [[maybe_unused]] std::shared_ptr<const PartialRegexMatcher>
+            regex_matcher;
         if constexpr (op == proto::plan::OpType::RegexMatch) {
             if constexpr (std::is_same_v<ValueType, std::string>) {
-                regex_matcher.emplace(val);
+                regex_matcher =
+                    PatternMatcherCache::GetInstance().GetPartialRegexMatcher(
+                        val);
             }
         }
         for (int i = 0; i < size; ++i) {
@@ -658,7 +717,10 @@ struct UnaryIndexFuncForMatch {
                 }
                 return res;
             } else {
-                LikePatternMatcher matcher(val);
+                auto matcher_ptr =
+                    PatternMatcherCache::GetInstance().GetLikePatternMatcher(
+                        val);
+                const auto& matcher = *matcher_ptr;
                 for (int64_t i = 0; i < cnt; i++) {
                     auto raw = index->Reverse_Lookup(i);
                     if (!raw.has_value()) {
@@ -716,7 +778,10 @@ struct UnaryIndexFunc {
                 }
                 auto cnt = index->Count();
                 TargetBitmap res(cnt);
-                PartialRegexMatcher matcher(val);
+                auto matcher_ptr =
+                    PatternMatcherCache::GetInstance().GetPartialRegexMatcher(
+                        val);
+                const auto& matcher = *matcher_ptr;
                 for (int64_t i = 0; i < cnt; i++) {
                     auto raw = index->Reverse_Lookup(i);
                     if (!raw.has_value()) {
@@ -829,7 +894,10 @@ BatchUnaryCompare(const T* src,
         case proto::plan::Match: {
             if constexpr (std::is_same_v<U, std::string> ||
                           std::is_same_v<U, std::string_view>) {
-                LikePatternMatcher matcher(val);
+                auto matcher_ptr =
+                    PatternMatcherCache::GetInstance().GetLikePatternMatcher(
+                        val);
+                const auto& matcher = *matcher_ptr;
                 for (int i = 0; i < size; ++i) {
                     res[i] = matcher(src[i]);
                 }
@@ -839,7 +907,10 @@ BatchUnaryCompare(const T* src,
         case proto::plan::RegexMatch: {
             if constexpr (std::is_same_v<U, std::string> ||
                           std::is_same_v<U, std::string_view>) {
-                PartialRegexMatcher matcher(val);
+                auto matcher_ptr =
+                    PatternMatcherCache::GetInstance().GetPartialRegexMatcher(
+                        val);
+                const auto& matcher = *matcher_ptr;
                 for (int i = 0; i < size; ++i) {
                     res[i] = matcher(src[i]);
                 }
@@ -1114,6 +1185,10 @@ class PhyUnaryRangeFilterExpr : public SegmentExpr {
     VectorPtr
     ExecRangeVisitorImplForPk(EvalCtx& context);
 
+    template <typename T>
+    VectorPtr
+    ExecRangeVisitorImplForSortedData();
+
     template <typename ExprValueType>
     VectorPtr
     ExecRangeVisitorImplArray(EvalCtx& context);
@@ -1159,11 +1234,11 @@ class PhyUnaryRangeFilterExpr : public SegmentExpr {
     PinWrapper<index::BsonInvertedIndex*> bson_index_{nullptr};
     bool enable_sub_expr_cache_write_{true};
 
-    // Cached regex objects — constructed once per segment, reused across batches.
+    // Compiled regex objects, shared through PatternMatcherCache with every
+    // segment running the same pattern and reused across batches.
     bool regex_cache_inited_{false};
-    std::unique_ptr<PartialRegexMatcher> cached_regex_matcher_;
-    std::string cached_volnitsky_literal_;
-    std::unique_ptr<VolnitskySearcher> cached_volnitsky_searcher_;
+    std::shared_ptr<const PartialRegexMatcher> cached_regex_matcher_;
+    std::shared_ptr<const LiteralPrefilter> cached_regex_prefilter_;
 
     void
     EnsureRegexCache() {
@@ -1173,22 +1248,18 @@ class PhyUnaryRangeFilterExpr : public SegmentExpr {
         if (expr_->op_type_ != proto::plan::OpType::RegexMatch)
             return;
         auto pattern = GetValueFromProto<std::string>(expr_->val_);
-        cached_regex_matcher_ = std::make_unique<PartialRegexMatcher>(pattern);
-        auto lits = index::extract_literals_from_regex(pattern);
-        for (const auto& l : lits) {
-            if (l.size() > cached_volnitsky_literal_.size())
-                cached_volnitsky_literal_ = l;
-        }
-        if (!cached_volnitsky_literal_.empty()) {
-            cached_volnitsky_searcher_ =
-                std::make_unique<VolnitskySearcher>(cached_volnitsky_literal_);
-        }
+        auto& cache = PatternMatcherCache::GetInstance();
+        cached_regex_matcher_ = cache.GetPartialRegexMatcher(pattern);
+        // all extracted literals are required (alternations yield none)
+        cached_regex_prefilter_ = cache.GetLiteralPrefilter(
+            index::extract_literals_from_regex(pattern));
     }
 
-    // Cached LIKE pattern matcher — constructed once per segment, reused
-    // across batches (the pattern is an expression constant).
+    // Compiled LIKE pattern matcher, shared the same way (the pattern is an
+    // expression constant).
     bool like_cache_inited_{false};
-    std::unique_ptr<LikePatternMatcher> cached_like_matcher_;
+    std::shared_ptr<const LikePatternMatcher> cached_like_matcher_;
+    std::shared_ptr<const LiteralPrefilter> cached_like_prefilter_;
 
     void
     EnsureLikeMatcherCache() {
@@ -1198,7 +1269,10 @@ class PhyUnaryRangeFilterExpr : public SegmentExpr {
         if (expr_->op_type_ != proto::plan::OpType::Match)
             return;
         auto pattern = GetValueFromProto<std::string>(expr_->val_);
-        cached_like_matcher_ = std::make_unique<LikePatternMatcher>(pattern);
+        auto& cache = PatternMatcherCache::GetInstance();
+        cached_like_matcher_ = cache.GetLikePatternMatcher(pattern);
+        cached_like_prefilter_ =
+            cache.GetLiteralPrefilter(cached_like_matcher_->RequiredLiterals());
     }
 };
 }  // namespace exec
@@ -21,6 +21,7 @@
 
 #include "common/protobuf_utils.h"
 #include "exec/expression/function/impl/StringFunctions.h"
+#include "exec/operator/query-agg/ApproxAggregates.h"
 #include "exec/operator/query-agg/CountAggregateBase.h"
 #include "exec/operator/query-agg/MaxAggregateBase.h"
 #include "exec/operator/query-agg/MinAggregateBase.h"
@@ -65,6 +66,12 @@ FunctionFactory::RegisterAllFunctions() {
     RegisterFilterFunction("starts_with",
                            {DataType::VARCHAR, DataType::VARCHAR},
                            function::StartsWithVarchar);
+    RegisterFilterFunction("ends_with",
+                           {DataType::VARCHAR, DataType::VARCHAR},
+                           function::EndsWithVarchar);
+    RegisterFilterFunction("contains",
+                           {DataType::VARCHAR, DataType::VARCHAR},
+                           function::ContainsVarchar);
     LOG_INFO("{} filter functions registered", GetFilterFunctionNum());
     RegisterAggregateFunction();
 }
@@ -84,6 +91,8 @@ FunctionFactory::RegisterAggregateFunction() {
     milvus::exec::registerMinAggregate();
     milvus::exec::registerMaxAggregate();
     milvus::exec::registerSumAggregate();
+    milvus::exec::registerApproxCountDistinctAggregate();
+    milvus::exec::registerApproxPercentileAggregate();
 }
 
 const FilterFunctionPtr
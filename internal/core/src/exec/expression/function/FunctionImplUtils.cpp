@@ -15,6 +15,8 @@
 // limitations under the License.
 #include "exec/expression/function/FunctionImplUtils.h"
 
+#include <string>
+
 #include "common/EasyAssert.h"
 #include "common/Types.h"
 #include "common/Vector.h"
@@ -30,4 +32,22 @@ CheckVarcharOrStringType(std::shared_ptr<SimpleVector>& vec) {
     }
 }
 
+StringArg::StringArg(const VectorPtr& arg) {
+    auto vec = std::dynamic_pointer_cast<SimpleVector>(arg);
+    Assert(vec != nullptr);
+    CheckVarcharOrStringType(vec);
+    size_ = vec->size();
+    if (auto column = std::dynamic_pointer_cast<ColumnVector>(vec)) {
+        values_ = column->RawAsValues<std::string>();
+        valid_ = TargetBitmapView(column->GetValidRawData(), size_);
+        return;
+    }
+    auto constant =
+        std::dynamic_pointer_cast<ConstantVector<std::string>>(vec);
+    AssertInfo(constant != nullptr,
+               "string argument should be a column or a constant");
+    constant_ = &constant->GetValue();
+    constant_valid_ = !constant->IsNull();
+}
+
 }  // namespace milvus::exec::expression::function
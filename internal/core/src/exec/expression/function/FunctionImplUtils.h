@@ -15,8 +15,14 @@
 // limitations under the License.
 #pragma once
 
+#include <cstddef>
 #include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
 
+#include "bitset/bitset.h"
+#include "common/Types.h"
 #include "common/Vector.h"
 
 namespace milvus::exec::expression::function {
@@ -24,4 +30,65 @@ namespace milvus::exec::expression::function {
 void
 CheckVarcharOrStringType(std::shared_ptr<SimpleVector>& vec);
 
+// A VARCHAR or STRING argument of a batch, a column or a constant, read
+// straight from its values and validity instead of a virtual call per row.
+class StringArg {
+ public:
+    explicit StringArg(const VectorPtr& arg);
+
+    size_t
+    size() const {
+        return size_;
+    }
+
+    bool
+    is_constant() const {
+        return constant_ != nullptr;
+    }
+
+    bool
+    ValidAt(size_t i) const {
+        return is_constant() ? constant_valid_ : valid_[i];
+    }
+
+    std::string_view
+    ValueAt(size_t i) const {
+        return is_constant() ? std::string_view(*constant_)
+                             : std::string_view(values_[i]);
+    }
+
+ private:
+    size_t size_ = 0;
+    const std::string* values_ = nullptr;
+    TargetBitmapView valid_;
+    const std::string* constant_ = nullptr;
+    bool constant_valid_ = true;
+};
+
+// Evaluates `match(str, pattern)` over a batch of the string arguments
+// `strs` and `patterns` into `result`, a row with a null argument is null.
+// `match` is called with a constant pattern as the same view for every row,
+// so a kernel can prepare it once.
+template <typename Match>
+void
+EvalStringMatch(const StringArg& strs,
+                const StringArg& patterns,
+                Match&& match,
+                VectorPtr& result) {
+    auto size = strs.size();
+    TargetBitmap bitmap(size, false);
+    TargetBitmap valid_bitmap(size, true);
+    for (size_t i = 0; i < size; ++i) {
+        if (strs.ValidAt(i) && patterns.ValidAt(i)) {
+            if (match(strs.ValueAt(i), patterns.ValueAt(i))) {
+                bitmap.set(i);
+            }
+        } else {
+            valid_bitmap.reset(i);
+        }
+    }
+    result = std::make_shared<ColumnVector>(std::move(bitmap),
+                                            std::move(valid_bitmap));
+}
+
 }  // namespace milvus::exec::expression::function
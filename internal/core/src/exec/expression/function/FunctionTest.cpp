@@ -244,3 +244,109 @@ TEST_F(FunctionTest, StartsWithIncorrectArgs) {
     milvus::RowVector three_args(arg_vec);
     EXPECT_ANY_THROW(StartsWithVarchar(three_args, result));
 }
+
+TEST_F(FunctionTest, EndsWithColumnVector) {
+    std::vector<milvus::VectorPtr> arg_vec;
+
+    auto col1 = std::make_shared<milvus::ColumnVector>(milvus::DataType::STRING,
+                                                       STARTS_WITH_ROW_COUNT);
+    InitStrsForStartWith(col1);
+    arg_vec.push_back(col1);
+
+    auto col2 = std::make_shared<milvus::ColumnVector>(milvus::DataType::STRING,
+                                                       STARTS_WITH_ROW_COUNT);
+    auto* col2_data = col2->RawAsValues<std::string>();
+    col2_data[0] = "23";
+    col2_data[1] = "";
+    col2_data[3] = "baaa";
+    col2_data[4] = "bbbaa";
+    col2_data[5] = "";
+    col2_data[6] = "";
+    TargetBitmapView valid_bitmap_col2(col2->GetValidRawData(), col2->size());
+    valid_bitmap_col2[6] = false;
+    col2_data[7] = "11";
+    arg_vec.push_back(col2);
+
+    milvus::RowVector args(std::move(arg_vec));
+
+    bool valid[STARTS_WITH_ROW_COUNT] = {
+        true, true, false, true, true, true, false, true};
+    bool expected[STARTS_WITH_ROW_COUNT] = {
+        true, true, false, true, false, true, false, false};
+
+    VectorPtr result;
+    EndsWithVarchar(args, result);
+    StartWithCheck(result, valid, expected);
+}
+
+TEST_F(FunctionTest, ContainsColumnVector) {
+    std::vector<milvus::VectorPtr> arg_vec;
+
+    auto col1 = std::make_shared<milvus::ColumnVector>(milvus::DataType::STRING,
+                                                       STARTS_WITH_ROW_COUNT);
+    InitStrsForStartWith(col1);
+    arg_vec.push_back(col1);
+
+    auto col2 = std::make_shared<milvus::ColumnVector>(milvus::DataType::STRING,
+                                                       STARTS_WITH_ROW_COUNT);
+    auto* col2_data = col2->RawAsValues<std::string>();
+    col2_data[0] = "2";
+    col2_data[1] = "";
+    col2_data[3] = "abbb";
+    col2_data[4] = "bbbb";
+    col2_data[5] = "";
+    col2_data[6] = "x";
+    TargetBitmapView valid_bitmap_col2(col2->GetValidRawData(), col2->size());
+    valid_bitmap_col2[6] = false;
+    col2_data[7] = "1";
+    arg_vec.push_back(col2);
+
+    milvus::RowVector args(std::move(arg_vec));
+
+    bool valid[STARTS_WITH_ROW_COUNT] = {
+        true, true, false, true, true, true, false, true};
+    bool expected[STARTS_WITH_ROW_COUNT] = {
+        true, true, false, true, false, true, false, true};
+
+    VectorPtr result;
+    ContainsVarchar(args, result);
+    StartWithCheck(result, valid, expected);
+}
+
+TEST_F(FunctionTest, ContainsConstantVector) {
+    bool valid[STARTS_WITH_ROW_COUNT] = {
+        true, true, false, true, true, true, true, true};
+    bool expected[STARTS_WITH_ROW_COUNT] = {
+        false, false, false, true, true, false, false, false};
+
+    // a short needle and one long enough for a prepared searcher
+    for (const std::string needle : {"bba", "aabbbaaa"}) {
+        std::vector<milvus::VectorPtr> arg_vec;
+        auto col1 = std::make_shared<milvus::ColumnVector>(
+            milvus::DataType::STRING, STARTS_WITH_ROW_COUNT);
+        InitStrsForStartWith(col1);
+        arg_vec.push_back(col1);
+        arg_vec.push_back(std::make_shared<milvus::ConstantVector<std::string>>(
+            milvus::DataType::STRING, STARTS_WITH_ROW_COUNT, needle));
+        milvus::RowVector args(std::move(arg_vec));
+
+        VectorPtr result;
+        ContainsVarchar(args, result);
+        StartWithCheck(result, valid, expected);
+    }
+
+    // a null needle
+    std::vector<milvus::VectorPtr> arg_vec;
+    auto col1 = std::make_shared<milvus::ColumnVector>(milvus::DataType::STRING,
+                                                       STARTS_WITH_ROW_COUNT);
+    InitStrsForStartWith(col1);
+    arg_vec.push_back(col1);
+    arg_vec.push_back(std::make_shared<milvus::ConstantVector<std::string>>(
+        milvus::DataType::STRING, STARTS_WITH_ROW_COUNT, "", 1));
+    milvus::RowVector args(std::move(arg_vec));
+    VectorPtr result;
+    ContainsVarchar(args, result);
+    bool null_valid[STARTS_WITH_ROW_COUNT] = {};
+    bool null_expected[STARTS_WITH_ROW_COUNT] = {};
+    StartWithCheck(result, null_valid, null_expected);
+}
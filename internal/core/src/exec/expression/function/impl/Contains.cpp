@@ -0,0 +1,74 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <string_view>
+
+#include "common/EasyAssert.h"
+#include "common/Types.h"
+#include "common/Vector.h"
+#include "exec/expression/function/FunctionFactory.h"
+#include "exec/expression/function/FunctionImplUtils.h"
+#include "exec/expression/function/impl/StringFunctions.h"
+
+namespace milvus {
+namespace exec {
+namespace expression {
+namespace function {
+
+// shortest constant needle searched for with a skip table built once per
+// batch, shorter ones are found faster by the memchr of find
+constexpr size_t kMinSearcherNeedleSize = 8;
+
+void
+ContainsVarchar(const RowVector& args, FilterFunctionReturn& result) {
+    if (args.childrens().size() != 2) {
+        ThrowInfo(ExprInvalid,
+                  "invalid argument count, expect 2, actual {}",
+                  args.childrens().size());
+    }
+    StringArg strs(args.child(0));
+    StringArg needles(args.child(1));
+    if (needles.is_constant() && strs.size() > 0 &&
+        needles.ValueAt(0).size() >= kMinSearcherNeedleSize) {
+        auto needle = needles.ValueAt(0);
+        std::boyer_moore_horspool_searcher searcher(needle.begin(),
+                                                    needle.end());
+        EvalStringMatch(
+            strs,
+            needles,
+            [&](std::string_view str, std::string_view) {
+                return std::search(str.begin(), str.end(), searcher) !=
+                       str.end();
+            },
+            result);
+        return;
+    }
+    EvalStringMatch(
+        strs,
+        needles,
+        [](std::string_view str, std::string_view needle) {
+            return str.find(needle) != std::string_view::npos;
+        },
+        result);
+}
+
+}  // namespace function
+}  // namespace expression
+}  // namespace exec
+}  // namespace milvus
@@ -14,13 +14,9 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-#include <cstddef>
-#include <memory>
-#include <string>
-#include <utility>
-#include <vector>
+#include <cstring>
+#include <string_view>
 
-#include "bitset/bitset.h"
 #include "common/EasyAssert.h"
 #include "common/Types.h"
 #include "common/Vector.h"
@@ -40,31 +36,16 @@ StartsWithVarchar(const RowVector& args, FilterFunctionReturn& result) {
                   "invalid argument count, expect 2, actual {}",
                   args.childrens().size());
     }
-    auto strs = std::dynamic_pointer_cast<SimpleVector>(args.child(0));
-    Assert(strs != nullptr);
-    CheckVarcharOrStringType(strs);
-    auto prefixes = std::dynamic_pointer_cast<SimpleVector>(args.child(1));
-    Assert(prefixes != nullptr);
-    CheckVarcharOrStringType(prefixes);
-
-    TargetBitmap bitmap(strs->size(), false);
-    TargetBitmap valid_bitmap(strs->size(), true);
-    for (size_t i = 0; i < strs->size(); ++i) {
-        if (strs->ValidAt(i) && prefixes->ValidAt(i)) {
-            auto* str_ptr = reinterpret_cast<std::string*>(
-                strs->RawValueAt(i, sizeof(std::string)));
-            auto* prefix_ptr = reinterpret_cast<std::string*>(
-                prefixes->RawValueAt(i, sizeof(std::string)));
-            bitmap.set(
-                i,
-                str_ptr->size() >= prefix_ptr->size() &&
-                    str_ptr->compare(0, prefix_ptr->size(), *prefix_ptr) == 0);
-        } else {
-            valid_bitmap[i] = false;
-        }
-    }
-    result = std::make_shared<ColumnVector>(std::move(bitmap),
-                                            std::move(valid_bitmap));
+    StringArg strs(args.child(0));
+    StringArg prefixes(args.child(1));
+    EvalStringMatch(
+        strs,
+        prefixes,
+        [](std::string_view str, std::string_view prefix) {
+            return str.size() >= prefix.size() &&
+                   std::memcmp(str.data(), prefix.data(), prefix.size()) == 0;
+        },
+        result);
 }
 
 }  // namespace function
@@ -29,6 +29,12 @@ EmptyVarchar(const RowVector& args, FilterFunctionReturn& result);
 void
 StartsWithVarchar(const RowVector& args, FilterFunctionReturn& result);
 
+void
+EndsWithVarchar(const RowVector& args, FilterFunctionReturn& result);
+
+void
+ContainsVarchar(const RowVector& args, FilterFunctionReturn& result);
+
 }  // namespace function
 }  // namespace expression
 }  // namespace exec
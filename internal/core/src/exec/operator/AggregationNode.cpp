@@ -19,6 +19,8 @@
 #include <utility>
 
 #include "common/Utils.h"
+#include "exec/QueryContext.h"
+#include "exec/Spill.h"
 #include "exec/VectorHasher.h"
 #include "exec/operator/query-agg/AggregateInfo.h"
 #include "plan/PlanNode.h"
@@ -47,7 +49,11 @@ PhyAggregationNode::initialize() {
     std::vector<AggregateInfo> aggregateInfos =
         toAggregateInfo(*aggregationNode_, *operator_context_, numHashers);
     grouping_set_ = std::make_unique<GroupingSet>(
-        input_type, std::move(hashers), std::move(aggregateInfos));
+        input_type,
+        std::move(hashers),
+        std::move(aggregateInfos),
+        SpillConfig::FromQueryConfig(
+            *operator_context_->get_exec_context()->get_query_config()));
     aggregationNode_.reset();
 }
 
@@ -55,6 +61,23 @@ void
 PhyAggregationNode::AddInput(RowVectorPtr& input) {
     grouping_set_->addInput(input);
     numInputRows_ += input->size();
+    SetMemoryUsage(grouping_set_->estimatedBytes());
+}
+
+void
+PhyAggregationNode::NoMoreInput() {
+    Operator::NoMoreInput();
+    if (!isGlobal_) {
+        return;
+    }
+    // chunks the upstream ProjectNode answered from skip index min/max
+    auto summary = operator_context_->get_exec_context()
+                       ->get_query_context()
+                       ->take_chunk_min_max_summary();
+    if (summary.rows != nullptr) {
+        grouping_set_->addGlobalSummaryInput(summary.rows, summary.num_rows);
+        numInputRows_ += summary.num_rows;
+    }
 }
 
 RowVectorPtr
@@ -63,7 +86,8 @@ PhyAggregationNode::GetOutput() {
         input_ = nullptr;
         return nullptr;
     }
-    DeferLambda([&]() { finished_ = true; });
+    // groups spilled to disk come out one partition per call
+    DeferLambda([&]() { finished_ = !grouping_set_->hasPendingOutput(); });
     const auto outputRowCount = isGlobal_ ? 1 : grouping_set_->outputRowCount();
     output_ = std::make_shared<RowVector>(output_type_, outputRowCount);
     const bool hasData = grouping_set_->getOutput(output_);
@@ -45,6 +45,9 @@ class PhyAggregationNode : public Operator {
     void
     AddInput(RowVectorPtr& input) override;
 
+    void
+    NoMoreInput() override;
+
     RowVectorPtr
     GetOutput() override;
 
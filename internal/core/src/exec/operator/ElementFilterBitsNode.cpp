@@ -140,6 +140,8 @@ PhyElementFilterBitsNode::GetOutput() {
             .count();
     milvus::monitor::internal_core_search_latency_scalar.Observe(total_cost /
                                                                  1000);
+    milvus::monitor::internal_core_stage_duration_seconds_filter.Observe(
+        total_cost / 1e6);
 
     auto filtered_count = expr_result.count();
     tracer::AddEvent(
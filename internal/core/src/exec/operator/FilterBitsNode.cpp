@@ -18,18 +18,28 @@
 
 #include <algorithm>
 #include <chrono>
+#include <memory>
+#include <numeric>
+#include <optional>
 #include <ratio>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "common/Common.h"
 #include "common/EasyAssert.h"
+#include "common/JsonDocCache.h"
+#include "common/PinCache.h"
 #include "common/Tracer.h"
 #include "common/Types.h"
+#include "exec/BitmapPool.h"
 #include "exec/QueryContext.h"
 #include "exec/expression/EvalCtx.h"
+#include "exec/MorselDispatcher.h"
 #include "exec/expression/ExprCache.h"
 #include "expr/ITypeExpr.h"
 #include "fmt/core.h"
+#include "futures/Executor.h"
 #include "monitor/Monitor.h"
 #include "plan/PlanNode.h"
 #include "prometheus/histogram.h"
@@ -53,6 +63,37 @@ BuildExprCacheKey(const plan::FilterBitsNode& filter,
     return key;
 }
 
+void
+CountJsonSources(const ExprPtr& expr,
+                 std::unordered_map<int64_t, int>& counts) {
+    if (expr->IsSource()) {
+        auto column = expr->GetColumnInfo();
+        if (column.has_value() && column->data_type_ == DataType::JSON) {
+            counts[column->field_id_.get()]++;
+        }
+        return;
+    }
+    for (const auto& input : expr->GetInputsRef()) {
+        CountJsonSources(input, counts);
+    }
+}
+
+// whether several predicates read the same JSON field, so that sharing the
+// parsed documents through a JsonDocCache saves parsing them again
+bool
+ShareJsonDocs(const ExprSet& exprs) {
+    if (JSON_DOC_CACHE_CAPACITY.load() <= 0) {
+        return false;
+    }
+    std::unordered_map<int64_t, int> counts;
+    for (const auto& expr : exprs.exprs()) {
+        CountJsonSources(expr, counts);
+    }
+    return std::any_of(counts.begin(), counts.end(), [](const auto& count) {
+        return count.second > 1;
+    });
+}
+
 void
 ConvertPredicateToFilteredBitset(TargetBitmapView data,
                                  TargetBitmapView valid,
@@ -67,6 +108,89 @@ ConvertPredicateToFilteredBitset(TargetBitmapView data,
     valid.set();
 }
 
+// Evaluates the filter over the morsels claimed by one thread. Owns a private
+// copy of the expression tree, since expressions keep a forward-only cursor,
+// and ORs each batch into its range of the shared output bitmaps. Morsels are
+// word aligned, so no two threads ever write the same bitmap word.
+class FilterMorselWorker {
+ public:
+    FilterMorselWorker(QueryContext* query_context,
+                       const expr::TypedExprPtr& filter,
+                       TargetBitmap& bitset,
+                       TargetBitmap& valid_bitset)
+        : exec_ctx_(std::make_unique<ExecContext>(query_context)),
+          exprs_(std::make_unique<ExprSet>(
+              std::vector<expr::TypedExprPtr>{filter}, exec_ctx_.get())),
+          eval_ctx_(std::make_unique<EvalCtx>(exec_ctx_.get())),
+          batch_size_(query_context->query_config()->get_expr_batch_size()),
+          bitmap_pool_(query_context->get_bitmap_pool()),
+          pin_cache_(query_context->get_pin_cache()),
+          bitset_(bitset),
+          valid_bitset_(valid_bitset) {
+        if (ShareJsonDocs(*exprs_)) {
+            json_docs_ =
+                std::make_unique<JsonDocCache>(JSON_DOC_CACHE_CAPACITY.load());
+        }
+    }
+
+    void
+    operator()(int64_t begin, int64_t end) {
+        // morsels start on a batch boundary, skip whole batches to get there
+        while (pos_ < begin) {
+            exprs_->MoveCursor();
+            pos_ += batch_size_;
+        }
+        AssertInfo(pos_ == begin,
+                   "morsel begin {} is not on a batch boundary",
+                   begin);
+        JsonDocCache::Scope json_docs_scope(json_docs_.get());
+        BitmapPool::Scope bitmap_pool_scope(bitmap_pool_);
+        PinCache::Scope pin_cache_scope(pin_cache_);
+        while (pos_ < end) {
+            if (json_docs_ != nullptr) {
+                json_docs_->Clear();
+            }
+            exprs_->Eval(0, 1, true, *eval_ctx_, results_);
+            AssertInfo(results_.size() == 1 && results_[0] != nullptr,
+                       "PhyFilterBitsNode result size should be size one and "
+                       "not be nullptr");
+            auto col_vec = std::dynamic_pointer_cast<ColumnVector>(results_[0]);
+            AssertInfo(
+                col_vec && col_vec->IsBitmap(),
+                "PhyFilterBitsNode result should be bitmap ColumnVector");
+            int64_t size = col_vec->size();
+            AssertInfo(size > 0 && pos_ + size <= end,
+                       "unexpected batch size {} at row {} of morsel [{}, {})",
+                       size,
+                       pos_,
+                       begin,
+                       end);
+            TargetBitmapView(bitset_.data(), pos_, size)
+                .inplace_or(TargetBitmapView(col_vec->GetRawData(), size),
+                            size);
+            TargetBitmapView(valid_bitset_.data(), pos_, size)
+                .inplace_or(TargetBitmapView(col_vec->GetValidRawData(), size),
+                            size);
+            pos_ += size;
+            col_vec.reset();
+            bitmap_pool_->Recycle(results_[0]);
+        }
+    }
+
+ private:
+    std::unique_ptr<ExecContext> exec_ctx_;
+    std::unique_ptr<ExprSet> exprs_;
+    std::unique_ptr<EvalCtx> eval_ctx_;
+    std::vector<VectorPtr> results_;
+    std::unique_ptr<JsonDocCache> json_docs_;
+    const int64_t batch_size_;
+    BitmapPool* bitmap_pool_;
+    PinCache* pin_cache_;
+    int64_t pos_{0};
+    TargetBitmap& bitset_;
+    TargetBitmap& valid_bitset_;
+};
+
 }  // namespace
 
 PhyFilterBitsNode::PhyFilterBitsNode(
@@ -83,6 +207,7 @@ PhyFilterBitsNode::PhyFilterBitsNode(
     std::vector<expr::TypedExprPtr> filters;
     filters.emplace_back(filter->filter());
     exprs_ = std::make_unique<ExprSet>(filters, exec_context);
+    filter_ = filter->filter();
     need_process_rows_ = query_context_->get_active_count();
     num_processed_rows_ = 0;
 
@@ -111,6 +236,130 @@ PhyFilterBitsNode::IsFinished() {
     return AllInputProcessed();
 }
 
+int64_t
+PhyFilterBitsNode::MorselRows() const {
+    int64_t batch_size = std::max<int64_t>(
+        1, query_context_->query_config()->get_expr_batch_size());
+    int64_t batches =
+        std::max<int64_t>(1, EXEC_FILTER_MORSEL_ROWS.load() / batch_size);
+    // keep every morsel boundary on a bitmap word boundary
+    int64_t word_bits = sizeof(TargetBitmap::data_type) * 8;
+    int64_t align = word_bits / std::gcd(batch_size, word_bits);
+    batches = (batches + align - 1) / align * align;
+    return batches * batch_size;
+}
+
+bool
+PhyFilterBitsNode::CanEvalInMorsels() const {
+    if (EXEC_FILTER_MORSEL_PARALLELISM.load() <= 1) {
+        return false;
+    }
+    auto* segment = query_context_->get_segment();
+    return segment != nullptr && segment->type() == SegmentType::Sealed &&
+           need_process_rows_ >= 2 * MorselRows() &&
+           exprs_->SupportsMorselEval();
+}
+
+void
+PhyFilterBitsNode::EvalInMorsels(TargetBitmap& bitset,
+                                 TargetBitmap& valid_bitset) {
+    bitset = TargetBitmap(need_process_rows_, false);
+    valid_bitset = TargetBitmap(need_process_rows_, false);
+    MorselDispatcher::Run(
+        need_process_rows_,
+        MorselRows(),
+        static_cast<int32_t>(EXEC_FILTER_MORSEL_PARALLELISM.load()),
+        query_context_->get_search_executor(),
+        [&]() -> MorselDispatcher::Worker {
+            auto worker = std::make_shared<FilterMorselWorker>(
+                query_context_, filter_, bitset, valid_bitset);
+            return [worker](int64_t begin, int64_t end) {
+                (*worker)(begin, end);
+            };
+        });
+    num_processed_rows_ = need_process_rows_;
+}
+
+std::shared_ptr<const TargetBitmap>
+PhyFilterBitsNode::DeletedRowsToSkip() const {
+    auto ratio = EXEC_SKIP_DELETED_ROWS_RATIO.load();
+    auto* segment = query_context_->get_segment();
+    if (ratio <= 0 || ratio > 1 || segment == nullptr ||
+        segment->type() != SegmentType::Sealed || need_process_rows_ == 0) {
+        return nullptr;
+    }
+    auto min_deleted = static_cast<int64_t>(ratio * need_process_rows_);
+    // deletes of later timestamps count as well, it is only a bound
+    if (segment->get_deleted_count() < std::max<int64_t>(min_deleted, 1)) {
+        return nullptr;
+    }
+    // only raw data scans read row by row, a scalar index computes the
+    // result of the whole segment whatever rows are asked for
+    if (!exprs_->SupportsMorselEval()) {
+        return nullptr;
+    }
+    for (const auto& expr : exprs_->exprs()) {
+        if (!expr->SupportOffsetInput()) {
+            return nullptr;
+        }
+    }
+    auto hidden =
+        segment->SharedMvccMask(need_process_rows_,
+                                query_context_->get_query_timestamp(),
+                                query_context_->get_collection_ttl());
+    if (hidden == nullptr ||
+        static_cast<int64_t>(hidden->count()) < min_deleted) {
+        return nullptr;
+    }
+    return hidden;
+}
+
+void
+PhyFilterBitsNode::EvalAliveRows(const TargetBitmap& hidden,
+                                 TargetBitmap& bitset,
+                                 TargetBitmap& valid_bitset) {
+    // a hidden row is FALSE and valid, so it ends up filtered
+    bitset = TargetBitmap(need_process_rows_, false);
+    valid_bitset = TargetBitmap(need_process_rows_, true);
+
+    EvalCtx eval_ctx(operator_context_->get_exec_context());
+    auto batch_size = std::max<int64_t>(
+        1, query_context_->query_config()->get_expr_batch_size());
+    OffsetVector offsets;
+    offsets.reserve(batch_size);
+    auto eval_offsets = [&]() {
+        eval_ctx.set_offset_input(&offsets);
+        exprs_->Eval(0, 1, true, eval_ctx, results_);
+        eval_ctx.set_offset_input(nullptr);
+        AssertInfo(results_.size() == 1 && results_[0] != nullptr,
+                   "PhyFilterBitsNode result size should be size one and not "
+                   "be nullptr");
+        auto col_vec = std::dynamic_pointer_cast<ColumnVector>(results_[0]);
+        AssertInfo(col_vec && col_vec->IsBitmap() &&
+                       col_vec->size() == static_cast<int64_t>(offsets.size()),
+                   "offset input of {} rows returned an unexpected result",
+                   offsets.size());
+        TargetBitmapView data(col_vec->GetRawData(), offsets.size());
+        TargetBitmapView valid(col_vec->GetValidRawData(), offsets.size());
+        for (size_t i = 0; i < offsets.size(); ++i) {
+            bitset.set(offsets[i], data[i]);
+            valid_bitset.set(offsets[i], valid[i]);
+        }
+        offsets.clear();
+    };
+    for (auto row = hidden.find_first(false); row.has_value();
+         row = hidden.find_next(row.value(), false)) {
+        offsets.push_back(static_cast<int32_t>(row.value()));
+        if (static_cast<int64_t>(offsets.size()) == batch_size) {
+            eval_offsets();
+        }
+    }
+    if (!offsets.empty()) {
+        eval_offsets();
+    }
+    num_processed_rows_ = need_process_rows_;
+}
+
 RowVectorPtr
 PhyFilterBitsNode::GetOutput() {
     milvus::exec::checkCancellation(query_context_);
@@ -155,6 +404,18 @@ PhyFilterBitsNode::GetOutput() {
 
     EvalCtx eval_ctx(operator_context_->get_exec_context());
 
+    // predicates on the same JSON field share the documents parsed for the
+    // batch instead of each parsing every row
+    std::optional<JsonDocCache> json_docs;
+    if (ShareJsonDocs(*exprs_)) {
+        json_docs.emplace(JSON_DOC_CACHE_CAPACITY.load());
+    }
+    JsonDocCache::Scope json_docs_scope(json_docs ? &json_docs.value()
+                                                  : nullptr);
+    // the bitmaps of a batch result back the results of the next batch
+    auto* bitmap_pool = query_context_->get_bitmap_pool();
+    BitmapPool::Scope bitmap_pool_scope(bitmap_pool);
+
     TargetBitmap bitset;
     TargetBitmap valid_bitset;
 
@@ -190,6 +451,7 @@ PhyFilterBitsNode::GetOutput() {
             v.result = std::make_shared<TargetBitmap>(view);
             v.valid_result = std::make_shared<TargetBitmap>(valid_view);
             v.active_count = need_process_rows_;
+            v.disk_eligible = true;
             ExprResCacheManager::Instance().Put(key, v);
         }
 
@@ -203,11 +465,30 @@ PhyFilterBitsNode::GetOutput() {
                 .count();
         milvus::monitor::internal_core_search_latency_scalar.Observe(
             scalar_cost / 1000);
+        milvus::monitor::internal_core_stage_duration_seconds_filter.Observe(
+            scalar_cost / 1e6);
 
         return std::make_shared<RowVector>(col_res);
     }
 
+    // most of the segment is deleted, evaluating the rows left through the
+    // offset input beats scanning the dead ones until compaction drops them.
+    // The result depends on the deletes, so it is not cached.
+    auto hidden = DeletedRowsToSkip();
+    if (hidden != nullptr) {
+        tracer::AddEvent("expr_execute_skip_deleted_rows");
+        EvalAliveRows(*hidden, bitset, valid_bitset);
+    } else if (CanEvalInMorsels()) {
+        // a large sealed segment scanned batch by batch is split into morsels
+        // evaluated by idle search threads, see MorselDispatcher
+        tracer::AddEvent("expr_execute_in_morsels");
+        EvalInMorsels(bitset, valid_bitset);
+    }
+
     while (num_processed_rows_ < need_process_rows_) {
+        if (json_docs.has_value()) {
+            json_docs->Clear();
+        }
         exprs_->Eval(0, 1, true, eval_ctx, results_);
 
         AssertInfo(results_.size() == 1 && results_[0] != nullptr,
@@ -232,6 +513,7 @@ PhyFilterBitsNode::GetOutput() {
             ThrowInfo(ExprInvalid,
                       "PhyFilterBitsNode result should be ColumnVector");
         }
+        bitmap_pool->Recycle(results_[0]);
     }
     TargetBitmapView bitset_view(bitset);
     TargetBitmapView valid_bitset_view(valid_bitset);
@@ -247,13 +529,14 @@ PhyFilterBitsNode::GetOutput() {
     // Cache write: clone bitset into ExprResCacheManager — Stage 1 of two-stage
     // search. Must clone before move since Stage 1 still owns the bitset for
     // the ColumnVector return value below.
-    if (can_use_cache) {
+    if (can_use_cache && !deleted.has_value()) {
         ExprResCacheManager::Key key{cache_segment->get_segment_id(),
                                      expr_cache_key_};
         ExprResCacheManager::Value v;
         v.result = std::make_shared<TargetBitmap>(bitset.clone());
         v.valid_result = std::make_shared<TargetBitmap>(valid_bitset.clone());
         v.active_count = need_process_rows_;
+        v.disk_eligible = true;
         ExprResCacheManager::Instance().Put(key, v);
     }
 
@@ -268,6 +551,8 @@ PhyFilterBitsNode::GetOutput() {
             .count();
     milvus::monitor::internal_core_search_latency_scalar.Observe(scalar_cost /
                                                                  1000);
+    milvus::monitor::internal_core_stage_duration_seconds_filter.Observe(
+        scalar_cost / 1e6);
 
     return std::make_shared<RowVector>(col_res);
 }
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 
 #include "exec/Driver.h"
@@ -66,13 +67,39 @@ class PhyFilterBitsNode : public Operator {
     bool
     AllInputProcessed();
 
+    // Morsel size in rows: a whole number of expression batches that also
+    // ends on a bitmap word.
+    int64_t
+    MorselRows() const;
+
+    bool
+    CanEvalInMorsels() const;
+
     virtual std::string
     ToString() const override {
         return "PhyFilterBitsNode";
     }
 
  private:
+    void
+    EvalInMorsels(TargetBitmap& bitset, TargetBitmap& valid_bitset);
+
+    // the rows of a sealed segment hidden at the query timestamp, mostly by
+    // deletes, when there are enough of them to evaluate only the others,
+    // see EXEC_SKIP_DELETED_ROWS_RATIO. The mask is the one the MVCC node
+    // applies next, computed once per point of the segment's history.
+    std::shared_ptr<const TargetBitmap>
+    DeletedRowsToSkip() const;
+
+    // evaluates the filter on the rows not in `hidden` through the offset
+    // input, the hidden rows do not pass
+    void
+    EvalAliveRows(const TargetBitmap& hidden,
+                  TargetBitmap& bitset,
+                  TargetBitmap& valid_bitset);
+
     std::unique_ptr<ExprSet> exprs_;
+    expr::TypedExprPtr filter_;
     QueryContext* query_context_;
     int64_t num_processed_rows_;
     int64_t need_process_rows_;
@@ -0,0 +1,92 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "common/Common.h"
+#include "common/Schema.h"
+#include "common/Types.h"
+#include "expr/ITypeExpr.h"
+#include "knowhere/comp/index_param.h"
+#include "pb/schema.pb.h"
+#include "plan/PlanNode.h"
+#include "query/ExecPlanNodeVisitor.h"
+#include "test_utils/DataGen.h"
+#include "test_utils/storage_test_utils.h"
+
+using namespace milvus;
+
+TEST(FilterSkipDeletedRows, MatchesFullScan) {
+    auto schema = std::make_shared<Schema>();
+    schema->AddDebugField(
+        "vec", DataType::VECTOR_FLOAT, 16, knowhere::metric::L2);
+    auto int64_fid = schema->AddDebugField("int64", DataType::INT64);
+    auto pk_fid = schema->AddDebugField("pk", DataType::INT64);
+    schema->set_primary_field_id(pk_fid);
+
+    constexpr int64_t N = 5000;
+    auto raw_data = segcore::DataGen(schema, N);
+    auto segment = CreateSealedWithFieldDataLoaded(schema, raw_data);
+
+    // all rows but every tenth are deleted at ts N, after every insert
+    auto pks = raw_data.get_col<int64_t>(pk_fid);
+    auto ids = std::make_unique<proto::schema::IDs>();
+    for (int64_t i = 0; i < N; ++i) {
+        if (i % 10 != 0) {
+            ids->mutable_int_id()->add_data(pks[i]);
+        }
+    }
+    auto deletes = ids->int_id().data_size();
+    std::vector<Timestamp> timestamps(deletes, N);
+    segment->Delete(deletes, ids.get(), timestamps.data());
+
+    proto::plan::GenericValue val;
+    val.set_int64_val(N / 2);
+    auto expr = std::make_shared<expr::UnaryRangeFilterExpr>(
+        expr::ColumnInfo(int64_fid, DataType::INT64),
+        proto::plan::OpType::GreaterEqual,
+        val);
+    auto plan =
+        std::make_shared<plan::FilterBitsNode>(DEFAULT_PLANNODE_ID, expr);
+
+    auto ratio = EXEC_SKIP_DELETED_ROWS_RATIO.load();
+    EXEC_SKIP_DELETED_ROWS_RATIO.store(0);
+    auto scanned =
+        query::ExecuteQueryExpr(plan, segment.get(), N, MAX_TIMESTAMP);
+    EXEC_SKIP_DELETED_ROWS_RATIO.store(0.8);
+    auto skipped =
+        query::ExecuteQueryExpr(plan, segment.get(), N, MAX_TIMESTAMP);
+    // before the deletes every row is evaluated
+    auto before = query::ExecuteQueryExpr(plan, segment.get(), N, N - 1);
+    EXEC_SKIP_DELETED_ROWS_RATIO.store(ratio);
+
+    ASSERT_EQ(scanned.size(), N);
+    ASSERT_EQ(skipped.size(), N);
+    ASSERT_EQ(before.size(), N);
+    auto values = raw_data.get_col<int64_t>(int64_fid);
+    for (int64_t i = 0; i < N; ++i) {
+        ASSERT_EQ(before[i], values[i] >= N / 2) << "row " << i;
+        if (i % 10 == 0) {
+            ASSERT_EQ(skipped[i], scanned[i]) << "row " << i;
+            ASSERT_EQ(skipped[i], values[i] >= N / 2) << "row " << i;
+        } else {
+            ASSERT_FALSE(skipped[i]) << "row " << i;
+        }
+    }
+}
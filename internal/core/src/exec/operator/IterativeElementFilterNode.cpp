@@ -35,9 +35,11 @@
 #include "common/Tracer.h"
 #include "common/Utils.h"
 #include "exec/QueryContext.h"
+#include "exec/expression/EvalCtx.h"
 #include "expr/ITypeExpr.h"
 #include "fmt/core.h"
 #include "plan/PlanNode.h"
+#include "query/PlanImpl.h"
 #include "segcore/SegmentInterface.h"
 
 namespace milvus {
@@ -54,11 +56,12 @@ PhyIterativeElementFilterNode::PhyIterativeElementFilterNode(
                element_filter_node->id(),
                "PhyIterativeElementFilterNode"),
       struct_name_(element_filter_node->struct_name()),
+      element_filter_(element_filter_node->element_filter()),
       has_doc_predicate_(element_filter_node->has_doc_predicate()) {
     ExecContext* exec_context = operator_context_->get_exec_context();
     query_context_ = exec_context->get_query_context();
     std::vector<expr::TypedExprPtr> exprs;
-    exprs.emplace_back(element_filter_node->element_filter());
+    exprs.emplace_back(element_filter_);
     element_exprs_ = std::make_unique<ExprSet>(exprs, exec_context);
 }
 
@@ -120,10 +123,14 @@ PhyIterativeElementFilterNode::GetOutput() {
 
     ExecContext* exec_context = operator_context_->get_exec_context();
 
+    std::shared_ptr<ElementFilterIterator> probe;
     for (auto& base_iter : base_iterators) {
         // Wrap each iterator with ElementFilterIterator
         auto wrapped_iter = std::make_shared<ElementFilterIterator>(
             base_iter, exec_context, element_exprs_.get());
+        if (probe == nullptr) {
+            probe = wrapped_iter;
+        }
 
         wrapped_iterators.push_back(std::move(wrapped_iter));
     }
@@ -135,8 +142,13 @@ PhyIterativeElementFilterNode::GetOutput() {
                                : 0;
 
     // Step 4: If no doc-level predicate, collect results directly
-    // (otherwise, downstream IterativeFilterNode will do this)
-    if (!has_doc_predicate_) {
+    // (otherwise, downstream IterativeFilterNode will do this), unless a
+    // selective filter is cheaper pushed into the search
+    bool pushed_down = false;
+    if (!has_doc_predicate_ && probe != nullptr) {
+        pushed_down = PushdownElementFilter(*probe, search_result);
+    }
+    if (!has_doc_predicate_ && !pushed_down) {
         CollectResults(search_result, array_offsets.get());
     }
 
@@ -151,16 +163,103 @@ PhyIterativeElementFilterNode::GetOutput() {
 
     tracer::AddEvent(fmt::format(
         "PhyIterativeElementFilterNode: wrapped {} iterators, struct_name: "
-        "{}, has_doc_predicate: {}, cost_us: {}",
+        "{}, has_doc_predicate: {}, pushed_down: {}, cost_us: {}",
         num_iterators,
         struct_name_,
         has_doc_predicate_,
+        pushed_down,
         cost));
 
     // Pass through input to downstream
     return input_;
 }
 
+bool
+PhyIterativeElementFilterNode::PushdownElementFilter(
+    ElementFilterIterator& probe, SearchResult& search_result) {
+    // group by consumes the iterators downstream
+    auto search_info = query_context_->get_search_info();
+    if (search_info.has_group_by() ||
+        !query_context_->bitset_is_element_level()) {
+        return false;
+    }
+    auto col_input = GetColumnVector(input_);
+    int64_t total_elements = query_context_->get_active_element_count();
+    if (col_input->size() != total_elements) {
+        return false;
+    }
+
+    // the first batches of one query tell the pass rate of all of them
+    probe.HasNext();
+    int64_t nq = search_result.total_nq_;
+    if (!PushdownIterativeElementFilter(probe.pulled_count(),
+                                        probe.passed_count(),
+                                        nq,
+                                        search_result.unity_topK_,
+                                        total_elements)) {
+        return false;
+    }
+
+    // Full mode over all active elements, with an expression set of its own
+    // since the one of the iterators has been evaluated over offsets
+    ExecContext* exec_context = operator_context_->get_exec_context();
+    ExprSet expr_set({element_filter_}, exec_context);
+    EvalCtx eval_ctx(exec_context);
+    TargetBitmap bitset;
+    std::vector<VectorPtr> results;
+    while (static_cast<int64_t>(bitset.size()) < total_elements) {
+        expr_set.Eval(0, 1, true, eval_ctx, results);
+        AssertInfo(results.size() == 1 && results[0] != nullptr,
+                   "IterativeElementFilterNode: expression evaluation should "
+                   "return exactly one result");
+        auto col_vec = std::dynamic_pointer_cast<ColumnVector>(results[0]);
+        AssertInfo(col_vec != nullptr && col_vec->IsBitmap(),
+                   "IterativeElementFilterNode: result should be bitmap");
+        bitset.append(
+            TargetBitmapView(col_vec->GetRawData(), col_vec->size()));
+    }
+    AssertInfo(static_cast<int64_t>(bitset.size()) == total_elements,
+               "IterativeElementFilterNode result size mismatch: {} vs {}",
+               bitset.size(),
+               total_elements);
+
+    // 1 filters an element out: failing the filter or its doc filtered by
+    // the upstream bitset the iterators were searched with
+    bitset.flip();
+    bitset |= TargetBitmapView(col_input->GetRawData(), total_elements);
+
+    milvus::SearchResult pushed;
+    if (bitset.all()) {
+        pushed.total_nq_ = nq;
+        pushed.unity_topK_ = 0;
+    } else {
+        auto& ph = query_context_->get_placeholder_group()->at(0);
+        search_info.iterative_filter_execution = false;
+        search_info.array_offsets_ = query_context_->get_array_offsets();
+        query_context_->get_segment()->vector_search(
+            search_info,
+            ph.get_blob(),
+            ph.get_offsets(),
+            ph.num_of_queries_,
+            query_context_->get_query_timestamp(),
+            milvus::BitsetView(reinterpret_cast<uint8_t*>(bitset.data()),
+                               bitset.size()),
+            query_context_->get_op_context(),
+            pushed);
+    }
+    pushed.total_data_cnt_ = search_result.total_data_cnt_;
+    pushed.element_level_ = true;
+    search_result = std::move(pushed);
+
+    tracer::AddEvent(fmt::format(
+        "PhyIterativeElementFilterNode::PushdownElementFilter: pulled={}, "
+        "passed={}, total_elements={}",
+        probe.pulled_count(),
+        probe.passed_count(),
+        total_elements));
+    return true;
+}
+
 void
 PhyIterativeElementFilterNode::CollectResults(
     SearchResult& search_result, const IArrayOffsets* array_offsets) {
@@ -20,6 +20,7 @@
 #include <memory>
 #include <string>
 
+#include "common/ElementFilterIterator.h"
 #include "common/Promise.h"
 #include "common/Vector.h"
 #include "common/protobuf_utils.h"
@@ -84,6 +85,15 @@ class PhyIterativeElementFilterNode : public Operator {
     CollectResults(SearchResult& search_result,
                    const IArrayOffsets* array_offsets);
 
+    // Searches again with the element filter pushed into the search as a
+    // bitset, into `search_result`, if the pass rate `probe` observed says
+    // it is cheaper than filtering what the iterators yield. False keeps
+    // the iterators.
+    bool
+    PushdownElementFilter(ElementFilterIterator& probe,
+                          SearchResult& search_result);
+
+    expr::TypedExprPtr element_filter_;
     std::unique_ptr<ExprSet> element_exprs_;
     QueryContext* query_context_;
     std::string struct_name_;
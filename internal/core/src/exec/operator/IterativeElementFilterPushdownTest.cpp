@@ -0,0 +1,43 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "exec/operator/Utils.h"
+
+using milvus::exec::kMinIterativeElementFilterProbe;
+using milvus::exec::PushdownIterativeElementFilter;
+
+TEST(IterativeElementFilterPushdown, KeepsIteratorsUntilProbed) {
+    // a short probe, or an iterator exhausted early, says nothing
+    EXPECT_FALSE(PushdownIterativeElementFilter(
+        kMinIterativeElementFilterProbe - 1, 0, 1, 10, 1000000));
+    EXPECT_FALSE(PushdownIterativeElementFilter(
+        kMinIterativeElementFilterProbe, 0, 1, 10, 0));
+}
+
+TEST(IterativeElementFilterPushdown, SwitchesOnObservedPassRate) {
+    int64_t pulled = kMinIterativeElementFilterProbe;
+    // half pass: 10 queries of top 10 scan about 200 of 100000 elements
+    EXPECT_FALSE(
+        PushdownIterativeElementFilter(pulled, pulled / 2, 10, 10, 100000));
+    // 1 in 1024 pass: they scan about 102400, past a single pass
+    EXPECT_TRUE(PushdownIterativeElementFilter(pulled, 1, 10, 10, 100000));
+    // none pass
+    EXPECT_TRUE(PushdownIterativeElementFilter(pulled, 0, 1, 1, 100000));
+    // the same rate over more elements keeps the iterators
+    EXPECT_FALSE(PushdownIterativeElementFilter(pulled, 1, 10, 10, 1000000));
+}
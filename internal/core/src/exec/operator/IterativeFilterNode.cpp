@@ -220,14 +220,27 @@ PhyIterativeFilterNode::GetOutput() {
         std::unordered_map<int64_t, bool> doc_eval_cache;
         std::unordered_set<int64_t> unique_doc_ids;
 
+        // the pass rate of the whole segment is known up front when the
+        // filter was evaluated over all rows, otherwise it is observed
+        // batch by batch
+        int64_t segment_passed =
+            is_native_supported_ ? 0 : static_cast<int64_t>(bitset.count());
+
         for (auto& iterator : search_result.vector_iterators_.value()) {
             EvalCtx eval_ctx(operator_context_->get_exec_context());
             int topk = 0;
+            int64_t pulled = 0;
             while (iterator->HasNext() && topk < unity_topk) {
                 offsets.clear();
                 distances.clear();
-                // remain unfilled size as iterator batch size
-                int64_t batch_size = unity_topk - topk;
+                // enough candidates to fill the unfilled size at the pass
+                // rate seen so far
+                int64_t batch_size =
+                    pulled == 0 && !is_native_supported_
+                        ? NextIterativeFilterBatchSize(
+                              unity_topk, need_process_rows_, segment_passed)
+                        : NextIterativeFilterBatchSize(
+                              unity_topk - topk, pulled, topk);
                 offsets.reserve(batch_size);
                 distances.reserve(batch_size);
                 while (iterator->HasNext()) {
@@ -245,6 +258,7 @@ PhyIterativeFilterNode::GetOutput() {
                         break;
                     }
                 }
+                pulled += offsets.size();
 
                 // Clear but retain capacity
                 doc_offsets.clear();
@@ -23,6 +23,8 @@
 #include "exec/QueryContext.h"
 #include "exec/expression/Utils.h"
 #include "fmt/core.h"
+#include "monitor/Monitor.h"
+#include "monitor/scope_metric.h"
 #include "plan/PlanNode.h"
 #include "segcore/SegcoreConfig.h"
 #include "segcore/SegmentInterface.h"
@@ -72,6 +74,8 @@ PhyMvccNode::GetOutput() {
     if (!is_source_node_ && input_ == nullptr) {
         return nullptr;
     }
+    SCOPE_SEGCORE_STAGE_METRIC(
+        milvus::monitor::internal_core_stage_duration_seconds_mvcc);
 
     tracer::AddEvent(fmt::format("input_rows: {}", active_count_));
 
@@ -120,9 +124,15 @@ PhyMvccNode::GetOutput() {
                                      : GetColumnVector(input_);
 
     TargetBitmapView data(col_input->GetRawData(), col_input->size());
-    segment_->mask_with_timestamps(
-        data, query_timestamp_, collection_ttl_timestamp_);
-    segment_->mask_with_delete(data, active_count_, query_timestamp_);
+    auto shared_mask = segment_->SharedMvccMask(
+        active_count_, query_timestamp_, collection_ttl_timestamp_);
+    if (shared_mask != nullptr) {
+        data.inplace_or(*shared_mask, active_count_);
+    } else {
+        segment_->mask_with_timestamps(
+            data, query_timestamp_, collection_ttl_timestamp_);
+        segment_->mask_with_delete(data, active_count_, query_timestamp_);
+    }
     is_finished_ = true;
 
     // input_ have already been updated
@@ -16,11 +16,30 @@
 
 #include "Operator.h"
 
+#include "fmt/core.h"
+
 namespace milvus {
 namespace exec {
 void
 Operator::initialize() {
     // TODO check memory and set up memory pool in the future
 }
+
+void
+Operator::SetMemoryUsage(int64_t bytes) {
+    if (memory_tracker_ == nullptr) {
+        auto* driver_context = operator_context_->get_driver_context();
+        if (bytes == 0 || driver_context == nullptr ||
+            driver_context->task_ == nullptr) {
+            return;
+        }
+        memory_query_context_ = driver_context->task_->query_context();
+        memory_tracker_ = std::make_unique<MemoryTracker>(
+            fmt::format("{} {}", get_operator_type(), get_plannode_id()),
+            memory_query_context_->get_memory_tracker(),
+            0);
+    }
+    memory_tracker_->Set(bytes);
+}
 }  // namespace exec
 }  // namespace milvus
@@ -25,7 +25,9 @@
 #include "common/Vector.h"
 #include "exec/Driver.h"
 #include "exec/Task.h"
+#include "exec/MemoryTracker.h"
 #include "exec/QueryContext.h"
+#include "exec/operator/OperatorStats.h"
 #include "plan/PlanNode.h"
 
 namespace milvus {
@@ -173,9 +175,22 @@ class Operator {
         return output_type_;
     }
 
+    // Filled by the Driver only when the plan asks for EXPLAIN ANALYZE.
+    OperatorStats&
+    stats() {
+        return stats_;
+    }
+
+    const OperatorStats&
+    stats() const {
+        return stats_;
+    }
+
  protected:
     std::unique_ptr<OperatorContext> operator_context_;
 
+    OperatorStats stats_;
+
     RowTypePtr output_type_;
 
     RowVectorPtr input_;
@@ -183,6 +198,17 @@ class Operator {
     bool no_more_input_{false};
 
     std::vector<VectorPtr> results_;
+
+    // Holds `bytes` in the memory tracker of this operator, under the one of
+    // the query, for operators that keep rows across calls. Fails the query
+    // with MemAllocateFailed past the memory limit of the query or the node.
+    void
+    SetMemoryUsage(int64_t bytes);
+
+ private:
+    // keeps the tracker of the query alive as long as the one of this
+    std::shared_ptr<QueryContext> memory_query_context_;
+    std::unique_ptr<MemoryTracker> memory_tracker_;
 };
 
 class SourceOperator : public Operator {
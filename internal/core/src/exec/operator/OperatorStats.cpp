@@ -0,0 +1,80 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/operator/OperatorStats.h"
+
+#include <algorithm>
+#include <map>
+
+#include "fmt/core.h"
+
+namespace milvus {
+namespace exec {
+
+std::string
+FormatExplainAnalyze(const std::vector<OperatorStats>& stats) {
+    // pipeline id -> operators ordered from source to sink
+    std::map<int32_t, std::vector<const OperatorStats*>> pipelines;
+    for (const auto& s : stats) {
+        pipelines[s.pipeline_id].push_back(&s);
+    }
+
+    std::string out;
+    for (auto& [pipeline_id, ops] : pipelines) {
+        std::sort(ops.begin(),
+                  ops.end(),
+                  [](const OperatorStats* a, const OperatorStats* b) {
+                      return a->operator_id < b->operator_id;
+                  });
+        int depth = 0;
+        for (auto it = ops.rbegin(); it != ops.rend(); ++it, ++depth) {
+            const auto& op = **it;
+            if (depth > 0) {
+                out.append(2 * depth, ' ');
+                out.append("-> ");
+            }
+            out.append(fmt::format(
+                "{}[op={}, plan_node={}] wall={:.3f}ms cpu={:.3f}ms "
+                "input={} rows/{} batches output={} rows/{} batches "
+                "pinned={}B cold_loaded={}B",
+                op.operator_type,
+                op.operator_id,
+                op.plannode_id,
+                op.wall_nanos / 1e6,
+                op.cpu_nanos / 1e6,
+                op.input_rows,
+                op.input_batches,
+                op.output_rows,
+                op.output_batches,
+                op.pinned_bytes,
+                op.cold_loaded_bytes));
+            if (op.perf.cycles > 0) {
+                out.append(fmt::format(
+                    " ipc={:.2f} instructions={} llc_misses={} "
+                    "branch_misses={}",
+                    static_cast<double>(op.perf.instructions) / op.perf.cycles,
+                    op.perf.instructions,
+                    op.perf.llc_misses,
+                    op.perf.branch_misses));
+            }
+            out.push_back('\n');
+        }
+    }
+    return out;
+}
+
+}  // namespace exec
+}  // namespace milvus
@@ -0,0 +1,162 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <time.h>
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "common/OpContext.h"
+#include "exec/PerfCounters.h"
+
+namespace milvus {
+namespace exec {
+
+// Runtime statistics of one operator, accumulated by the Driver around every
+// AddInput/GetOutput/NoMoreInput call when EXPLAIN ANALYZE is requested by
+// the plan (PlanOptions::explain_analyze).
+struct OperatorStats {
+    std::string operator_type;
+    std::string plannode_id;
+    int32_t operator_id{0};
+    int32_t pipeline_id{0};
+
+    int64_t wall_nanos{0};
+    int64_t cpu_nanos{0};
+    int64_t input_rows{0};
+    int64_t input_batches{0};
+    int64_t output_rows{0};
+    int64_t output_batches{0};
+    // bytes the operator pinned through the caching layer, and the part of
+    // them that had to be loaded because the cell was not resident
+    int64_t pinned_bytes{0};
+    int64_t cold_loaded_bytes{0};
+    // hardware counters of the calls, only on the driver runs sampled by
+    // PERF_COUNTER_SAMPLE_INTERVAL
+    PerfCounterValues perf;
+
+    void
+    Merge(const OperatorStats& other) {
+        wall_nanos += other.wall_nanos;
+        cpu_nanos += other.cpu_nanos;
+        input_rows += other.input_rows;
+        input_batches += other.input_batches;
+        output_rows += other.output_rows;
+        output_batches += other.output_batches;
+        pinned_bytes += other.pinned_bytes;
+        cold_loaded_bytes += other.cold_loaded_bytes;
+        perf += other.perf;
+    }
+};
+
+// Measures a single operator call and adds it to `stats` on destruction.
+// A null `stats` makes the timer a no-op; a null OpContext leaves the caching
+// layer counters untouched and null `perf_counters` the hardware counters.
+// Only the calling thread is measured, the morsel workers an operator fans
+// out to are not.
+class OperatorStatsTimer {
+ public:
+    OperatorStatsTimer(OperatorStats* stats,
+                       const milvus::OpContext* op_ctx,
+                       const PerfCounters* perf_counters = nullptr)
+        : stats_(stats),
+          op_ctx_(stats != nullptr ? op_ctx : nullptr),
+          perf_counters_(stats != nullptr ? perf_counters : nullptr) {
+        if (stats_ == nullptr) {
+            return;
+        }
+        wall_start_ = std::chrono::steady_clock::now();
+        cpu_start_ = ThreadCpuNanos();
+        if (op_ctx_ != nullptr) {
+            total_bytes_start_ = TotalBytes(op_ctx_);
+            cold_bytes_start_ = ColdBytes(op_ctx_);
+        }
+        if (perf_counters_ != nullptr &&
+            !perf_counters_->Read(&perf_start_)) {
+            perf_counters_ = nullptr;
+        }
+    }
+
+    OperatorStatsTimer(const OperatorStatsTimer&) = delete;
+    OperatorStatsTimer&
+    operator=(const OperatorStatsTimer&) = delete;
+
+    ~OperatorStatsTimer() {
+        if (stats_ == nullptr) {
+            return;
+        }
+        auto wall = std::chrono::steady_clock::now() - wall_start_;
+        stats_->wall_nanos +=
+            std::chrono::duration_cast<std::chrono::nanoseconds>(wall).count();
+        stats_->cpu_nanos += ThreadCpuNanos() - cpu_start_;
+        if (op_ctx_ != nullptr) {
+            stats_->pinned_bytes += TotalBytes(op_ctx_) - total_bytes_start_;
+            stats_->cold_loaded_bytes +=
+                ColdBytes(op_ctx_) - cold_bytes_start_;
+        }
+        PerfCounterValues perf_end;
+        if (perf_counters_ != nullptr && perf_counters_->Read(&perf_end)) {
+            stats_->perf += perf_end - perf_start_;
+        }
+    }
+
+    static int64_t
+    ThreadCpuNanos() {
+        timespec ts;
+        if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0) {
+            return 0;
+        }
+        return static_cast<int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+    }
+
+ private:
+    static int64_t
+    TotalBytes(const milvus::OpContext* op_ctx) {
+        return static_cast<int64_t>(
+            op_ctx->storage_usage.scanned_total_bytes.load());
+    }
+
+    static int64_t
+    ColdBytes(const milvus::OpContext* op_ctx) {
+        return static_cast<int64_t>(
+            op_ctx->storage_usage.scanned_cold_bytes.load());
+    }
+
+    OperatorStats* stats_;
+    const milvus::OpContext* op_ctx_;
+    const PerfCounters* perf_counters_;
+    PerfCounterValues perf_start_;
+    std::chrono::steady_clock::time_point wall_start_;
+    int64_t cpu_start_{0};
+    int64_t total_bytes_start_{0};
+    int64_t cold_bytes_start_{0};
+};
+
+// Renders the collected stats as an EXPLAIN ANALYZE style tree, the sink of
+// every pipeline at the top and its sources indented below it, e.g.
+//
+//   PhyVectorSearchNode[op=2, plan_node=3] wall=1.200ms cpu=1.180ms ...
+//     -> PhyMvccNode[op=1, plan_node=2] wall=0.020ms cpu=0.020ms ...
+//       -> PhyFilterBitsNode[op=0, plan_node=1] wall=0.310ms cpu=0.300ms ...
+std::string
+FormatExplainAnalyze(const std::vector<OperatorStats>& stats);
+
+}  // namespace exec
+}  // namespace milvus
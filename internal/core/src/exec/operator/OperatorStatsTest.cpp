@@ -0,0 +1,199 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/QueryResult.h"
+#include "common/Schema.h"
+#include "common/Types.h"
+#include "exec/QueryContext.h"
+#include "exec/operator/OperatorStats.h"
+#include "fmt/core.h"
+#include "knowhere/comp/index_param.h"
+#include "pb/plan.pb.h"
+#include "query/ExecPlanNodeVisitor.h"
+#include "query/Plan.h"
+#include "query/PlanImpl.h"
+#include "test_utils/DataGen.h"
+#include "test_utils/storage_test_utils.h"
+
+using namespace milvus;
+using namespace milvus::segcore;
+
+namespace {
+
+namespace planpb = proto::plan;
+
+constexpr int64_t kRows = 1000;
+constexpr int64_t kDim = 16;
+
+class OperatorStatsTest : public ::testing::Test {
+ protected:
+    void
+    SetUp() override {
+        schema_ = std::make_shared<Schema>();
+        auto pk_fid = schema_->AddDebugField("pk", DataType::INT64);
+        schema_->set_primary_field_id(pk_fid);
+        vec_fid_ = schema_->AddDebugField(
+            "vec", DataType::VECTOR_FLOAT, kDim, knowhere::metric::L2);
+        counter_fid_ = schema_->AddDebugField("counter", DataType::INT64);
+        auto raw_data = DataGen(schema_, kRows);
+        segment_ = CreateSealedWithFieldDataLoaded(schema_, raw_data);
+    }
+
+    void
+    SetFilter(planpb::Expr* expr) {
+        auto* unary = expr->mutable_unary_range_expr();
+        auto* column = unary->mutable_column_info();
+        column->set_field_id(counter_fid_.get());
+        column->set_data_type(proto::schema::DataType::Int64);
+        unary->set_op(planpb::OpType::LessThan);
+        unary->mutable_value()->set_int64_val(kRows / 2);
+    }
+
+    std::unique_ptr<SearchResult>
+    Search(bool explain_analyze) {
+        planpb::PlanNode plan_node;
+        auto* anns = plan_node.mutable_vector_anns();
+        anns->set_vector_type(planpb::VectorType::FloatVector);
+        anns->set_field_id(vec_fid_.get());
+        anns->set_placeholder_tag("$0");
+        auto* query_info = anns->mutable_query_info();
+        query_info->set_topk(10);
+        query_info->set_metric_type(knowhere::metric::L2);
+        query_info->set_search_params("{}");
+        query_info->set_round_decimal(-1);
+        SetFilter(anns->mutable_predicates());
+        plan_node.mutable_plan_options()->set_explain_analyze(explain_analyze);
+
+        auto plan_bytes = plan_node.SerializeAsString();
+        auto plan = query::CreateSearchPlanByExpr(
+            schema_, plan_bytes.data(), plan_bytes.size());
+        auto ph_bytes =
+            CreatePlaceholderGroup(1, kDim, 1024).SerializeAsString();
+        auto ph_group = query::ParsePlaceholderGroup(plan.get(), ph_bytes);
+        return segment_->Search(plan.get(), ph_group.get(), MAX_TIMESTAMP);
+    }
+
+    SchemaPtr schema_;
+    FieldId vec_fid_;
+    FieldId counter_fid_;
+    SegmentSealedUPtr segment_;
+};
+
+}  // namespace
+
+TEST(OperatorStats, FormatExplainAnalyze) {
+    std::vector<exec::OperatorStats> stats(2);
+    stats[0].operator_type = "PhyMvccNode";
+    stats[0].plannode_id = "1";
+    stats[0].operator_id = 0;
+    stats[0].output_rows = 100;
+    stats[0].output_batches = 1;
+    stats[1].operator_type = "PhyFilterBitsNode";
+    stats[1].plannode_id = "2";
+    stats[1].operator_id = 1;
+    stats[1].input_rows = 100;
+    stats[1].input_batches = 1;
+    stats[1].pinned_bytes = 4096;
+    stats[1].cold_loaded_bytes = 1024;
+
+    auto text = exec::FormatExplainAnalyze(stats);
+    // the sink comes first, its source is indented below it
+    auto filter_pos = text.find("PhyFilterBitsNode[op=1, plan_node=2]");
+    auto mvcc_pos = text.find("  -> PhyMvccNode[op=0, plan_node=1]");
+    ASSERT_NE(filter_pos, std::string::npos) << text;
+    ASSERT_NE(mvcc_pos, std::string::npos) << text;
+    EXPECT_LT(filter_pos, mvcc_pos);
+    EXPECT_NE(text.find("pinned=4096B cold_loaded=1024B"), std::string::npos);
+    EXPECT_NE(text.find("output=100 rows/1 batches"), std::string::npos);
+    // no counters were sampled, the line carries no ipc
+    EXPECT_EQ(text.find("ipc="), std::string::npos) << text;
+
+    stats[1].perf.instructions = 3000;
+    stats[1].perf.cycles = 2000;
+    stats[1].perf.llc_misses = 7;
+    stats[1].perf.branch_misses = 11;
+    text = exec::FormatExplainAnalyze(stats);
+    EXPECT_NE(text.find("ipc=1.50 instructions=3000 llc_misses=7 "
+                        "branch_misses=11"),
+              std::string::npos)
+        << text;
+}
+
+TEST(OperatorStats, ExplainAnalyzeResultOfEveryTask) {
+    exec::QueryContext query_context("explain", nullptr, 0, MAX_TIMESTAMP);
+    query_context.add_explain_analyze_result("segment=1 prefilter");
+    query_context.add_explain_analyze_result("segment=1 search");
+    EXPECT_EQ(query_context.get_explain_analyze_result(),
+              "segment=1 prefilter\nsegment=1 search");
+}
+
+TEST(OperatorStats, Timer) {
+    exec::OperatorStats stats;
+    {
+        exec::OperatorStatsTimer timer(nullptr, nullptr);
+    }
+    {
+        exec::OperatorStatsTimer timer(&stats, nullptr);
+        volatile int64_t sum = 0;
+        for (int i = 0; i < 100000; ++i) {
+            sum += i;
+        }
+    }
+    EXPECT_GT(stats.wall_nanos, 0);
+    EXPECT_EQ(stats.pinned_bytes, 0);
+}
+
+TEST_F(OperatorStatsTest, SearchWithoutExplainAnalyze) {
+    auto result = Search(false);
+    EXPECT_TRUE(result->explain_analyze_.empty());
+}
+
+TEST_F(OperatorStatsTest, SearchExplainAnalyze) {
+    auto result = Search(true);
+    const auto& text = result->explain_analyze_;
+    ASSERT_FALSE(text.empty());
+    EXPECT_EQ(text.rfind("segment=", 0), 0) << text;
+    EXPECT_NE(text.find("PhyVectorSearchNode"), std::string::npos) << text;
+    EXPECT_NE(text.find("-> PhyFilterBitsNode"), std::string::npos) << text;
+    EXPECT_NE(text.find("-> PhyMvccNode"), std::string::npos) << text;
+    // the filter bitmap covers every row of the segment
+    EXPECT_NE(text.find(fmt::format("output={} rows", kRows)),
+              std::string::npos)
+        << text;
+}
+
+TEST_F(OperatorStatsTest, RetrieveExplainAnalyze) {
+    planpb::PlanNode plan_node;
+    auto* query = plan_node.mutable_query();
+    SetFilter(query->mutable_predicates());
+    query->set_limit(10);
+    plan_node.mutable_plan_options()->set_explain_analyze(true);
+    auto plan_bytes = plan_node.SerializeAsString();
+    auto plan = query::CreateRetrievePlanByExpr(
+        schema_, plan_bytes.data(), plan_bytes.size());
+
+    query::ExecPlanNodeVisitor visitor(*segment_, MAX_TIMESTAMP);
+    auto result = visitor.get_retrieve_result(*plan->plan_node_);
+    EXPECT_EQ(result.result_offsets_.size(), 10);
+    EXPECT_NE(result.explain_analyze_.find("PhyFilterBitsNode"),
+              std::string::npos)
+        << result.explain_analyze_;
+}
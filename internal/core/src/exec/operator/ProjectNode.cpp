@@ -18,7 +18,9 @@
 
 #include <algorithm>
 #include <optional>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "common/Consts.h"
 #include "common/EasyAssert.h"
@@ -27,6 +29,8 @@
 #include "exec/QueryContext.h"
 #include "exec/expression/Utils.h"
 #include "exec/operator/Operator.h"
+#include "index/ScalarIndex.h"
+#include "index/SkipIndex.h"
 #include "plan/PlanNode.h"
 #include "segcore/InsertRecord.h"
 #include "segcore/SegmentInterface.h"
@@ -92,6 +96,33 @@ MakeInt64Column(const std::vector<int64_t>& values) {
         std::move(field_data), std::move(valid_map), 0);
 }
 
+void
+SetMetricsValueAt(ColumnVector& column,
+                  size_t row,
+                  const index::Metrics& value) {
+    switch (column.type()) {
+        case DataType::INT8:
+            column.SetValueAt<int8_t>(row, std::get<int8_t>(value));
+            break;
+        case DataType::INT16:
+            column.SetValueAt<int16_t>(row, std::get<int16_t>(value));
+            break;
+        case DataType::INT32:
+            column.SetValueAt<int32_t>(row, std::get<int32_t>(value));
+            break;
+        case DataType::INT64:
+            column.SetValueAt<int64_t>(row, std::get<int64_t>(value));
+            break;
+        case DataType::VARCHAR:
+            column.SetValueAt<std::string>(row, std::get<std::string>(value));
+            break;
+        default:
+            ThrowInfo(DataTypeInvalid,
+                      "unsupported type {} for chunk min/max pushdown",
+                      GetDataTypeName(column.type()));
+    }
+}
+
 ColumnVectorPtr
 MakeElementIndexColumn(const std::vector<int32_t>& element_indices) {
     auto selected_count = element_indices.size();
@@ -118,6 +149,8 @@ PhyProjectNode::PhyProjectNode(
                projectNode->id(),
                "Project"),
       fields_to_project_(projectNode->FieldsToProject()),
+      pushdown_chunk_min_max_(projectNode->PushdownChunkMinMax()),
+      index_ordered_(projectNode->IndexOrdered()),
       query_context_(nullptr),
       op_context_(nullptr) {
     auto exec_context = operator_context_->get_exec_context();
@@ -159,7 +192,18 @@ PhyProjectNode::GetOutput() {
         return row_vector;
     }
 
-    auto selected = SelectOffsets(raw_data_view, query_context_, segment_);
+    if (pushdown_chunk_min_max_) {
+        PushdownChunkMinMax(raw_data_view);
+    }
+
+    std::optional<std::vector<int64_t>> index_ordered_offsets;
+    if (index_ordered_.has_value()) {
+        index_ordered_offsets = SelectOffsetsInIndexOrder(raw_data_view);
+    }
+    auto selected =
+        index_ordered_offsets.has_value()
+            ? SelectedOffsets{std::move(index_ordered_offsets).value(), {}}
+            : SelectOffsets(raw_data_view, query_context_, segment_);
     auto& selected_offsets = selected.row_offsets;
     auto& selected_element_indices = selected.element_indices;
     auto selected_count = selected_offsets.size();
@@ -221,5 +265,124 @@ PhyProjectNode::GetOutput() {
     return row_vector;
 }
 
+std::optional<std::vector<int64_t>>
+PhyProjectNode::SelectOffsetsInIndexOrder(
+    const TargetBitmapView& excluded) const {
+    if (segment_->type() != SegmentType::Sealed ||
+        query_context_->bitset_is_element_level()) {
+        return std::nullopt;
+    }
+    const auto& order = index_ordered_.value();
+    auto pinned = segment_->PinIndex(op_context_, order.field_id);
+    if (pinned.size() != 1) {
+        return std::nullopt;
+    }
+    auto first_rows =
+        [&](auto type_tag) -> std::optional<std::vector<int64_t>> {
+        using T = decltype(type_tag);
+        auto index =
+            dynamic_cast<const index::ScalarIndex<T>*>(pinned[0].get());
+        if (index == nullptr) {
+            return std::nullopt;
+        }
+        return index->FirstRowsInValueOrder(
+            excluded, order.ascending, order.limit);
+    };
+    switch (segment_->get_schema()[order.field_id].get_data_type()) {
+        case DataType::INT8:
+            return first_rows(int8_t{});
+        case DataType::INT16:
+            return first_rows(int16_t{});
+        case DataType::INT32:
+            return first_rows(int32_t{});
+        case DataType::INT64:
+            return first_rows(int64_t{});
+        case DataType::FLOAT:
+            return first_rows(float{});
+        case DataType::DOUBLE:
+            return first_rows(double{});
+        case DataType::VARCHAR:
+        case DataType::STRING:
+            return first_rows(std::string{});
+        default:
+            return std::nullopt;
+    }
+}
+
+void
+PhyProjectNode::PushdownChunkMinMax(TargetBitmapView excluded) {
+    if (segment_->type() != SegmentType::Sealed ||
+        query_context_->bitset_is_element_level()) {
+        return;
+    }
+    // the summary rows stand in for whole chunks of every projected field,
+    // so all of them must be chunked alike
+    const auto& fields = fields_to_project_;
+    for (const auto& field_id : fields) {
+        if (!segment_->is_field_exist(field_id)) {
+            return;
+        }
+    }
+    auto num_chunks = segment_->num_chunk_data(fields[0]);
+    for (const auto& field_id : fields) {
+        if (segment_->num_chunk_data(field_id) != num_chunks) {
+            return;
+        }
+    }
+
+    const auto& skip_index = segment_->GetSkipIndex();
+    std::vector<std::vector<index::Metrics>> values(fields.size());
+    std::vector<std::optional<std::pair<index::Metrics, index::Metrics>>>
+        chunk_min_max(fields.size());
+    int64_t covered_rows = 0;
+    for (int64_t chunk_id = 0; chunk_id < num_chunks; chunk_id++) {
+        auto begin = segment_->num_rows_until_chunk(fields[0], chunk_id);
+        auto size = segment_->chunk_size(fields[0], chunk_id);
+        // only chunks whose rows are all visible, partially covered ones are
+        // scanned
+        if (size == 0 || begin + size > excluded.size() ||
+            !excluded.view(begin, size).none()) {
+            continue;
+        }
+        bool covered = true;
+        for (size_t i = 0; i < fields.size() && covered; i++) {
+            covered =
+                segment_->num_rows_until_chunk(fields[i], chunk_id) == begin &&
+                segment_->chunk_size(fields[i], chunk_id) == size;
+            if (covered) {
+                chunk_min_max[i] =
+                    skip_index.GetChunkMinMax(op_context_, fields[i], chunk_id);
+                covered = chunk_min_max[i].has_value();
+            }
+        }
+        if (!covered) {
+            continue;
+        }
+        for (size_t i = 0; i < fields.size(); i++) {
+            values[i].push_back(std::move(chunk_min_max[i]->first));
+            values[i].push_back(std::move(chunk_min_max[i]->second));
+        }
+        excluded.set(begin, size, true);
+        covered_rows += size;
+    }
+    if (covered_rows == 0) {
+        return;
+    }
+
+    auto row_type = OutputType();
+    std::vector<VectorPtr> columns;
+    columns.reserve(fields.size());
+    for (size_t i = 0; i < fields.size(); i++) {
+        auto column = std::make_shared<ColumnVector>(row_type->column_type(i),
+                                                     values[i].size());
+        for (size_t row = 0; row < values[i].size(); row++) {
+            SetMetricsValueAt(*column, row, values[i][row]);
+        }
+        columns.emplace_back(std::move(column));
+    }
+    query_context_->set_chunk_min_max_summary(
+        {std::make_shared<RowVector>(std::move(columns)), covered_rows});
+}
+
 };  // namespace exec
 };  // namespace milvus
@@ -15,6 +15,10 @@
 // limitations under the License.
 
 #pragma once
+
+#include <optional>
+#include <vector>
+
 #include "Operator.h"
 #include "plan/PlanNode.h"
 
@@ -69,9 +73,24 @@ class PhyProjectNode : public Operator {
     }
 
  private:
+    // Answers the fully visible chunks of a sealed segment from their skip
+    // index min/max for the downstream global aggregation, and masks their
+    // rows out of `excluded` so they are not materialized.
+    void
+    PushdownChunkMinMax(TargetBitmapView excluded);
+
+    // Offsets of the rows the downstream ORDER BY ... LIMIT keeps, walked in
+    // the order of the sorted index of its key, so the other visible rows
+    // are neither materialized nor sorted. std::nullopt when the segment
+    // has no such index.
+    std::optional<std::vector<int64_t>>
+    SelectOffsetsInIndexOrder(const TargetBitmapView& excluded) const;
+
     const segcore::SegmentInternalInterface* segment_;
     bool is_finished_{false};
     const std::vector<FieldId> fields_to_project_;
+    const bool pushdown_chunk_min_max_;
+    const std::optional<plan::IndexOrderedProject> index_ordered_;
     QueryContext* query_context_;
     OpContext* op_context_;
 };
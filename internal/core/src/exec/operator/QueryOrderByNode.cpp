@@ -19,6 +19,7 @@
 #include <utility>
 
 #include "common/EasyAssert.h"
+#include "exec/QueryContext.h"
 #include "log/Log.h"
 
 namespace milvus {
@@ -86,7 +87,11 @@ PhyQueryOrderByNode::PhyQueryOrderByNode(
 
     // Create SortBuffer
     sort_buffer_ = std::make_unique<SortBuffer>(
-        column_types_, sort_key_infos, order_by_node->Limit());
+        column_types_,
+        sort_key_infos,
+        order_by_node->Limit(),
+        SpillConfig::FromQueryConfig(
+            *operator_context_->get_exec_context()->get_query_config()));
 
     LOG_DEBUG(
         "PhyQueryOrderByNode created with {} sort keys, {} columns, limit={}",
@@ -128,6 +133,7 @@ PhyQueryOrderByNode::AddInput(RowVectorPtr& input) {
     // Add rows to sort buffer
     auto num_rows = static_cast<vector_size_t>(input->size());
     sort_buffer_->AddRows(columns, num_rows);
+    SetMemoryUsage(sort_buffer_->EstimatedBytes());
 
     LOG_DEBUG("QueryOrderByNode: added {} rows, total={}",
               num_rows,
@@ -16,16 +16,14 @@
 
 #include "RandomSampleNode.h"
 
-#include <assert.h>
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <limits>
-#include <numeric>
 #include <optional>
 #include <ratio>
-#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -68,29 +66,126 @@ PhyRandomSampleNode::AddInput(RowVectorPtr& input) {
 }
 
 FixedVector<uint32_t>
-PhyRandomSampleNode::HashsetSample(const uint32_t N,
-                                   const uint32_t M,
-                                   std::mt19937& gen) {
-    std::uniform_int_distribution<> dis(0, N - 1);
-    std::unordered_set<uint32_t> sampled;
+PhyRandomSampleNode::SequentialSample(const uint32_t N,
+                                      const uint32_t M,
+                                      std::mt19937& gen) {
+    // J. S. Vitter, "An Efficient Algorithm for Sequential Random Sampling",
+    // ACM Transactions on Mathematical Software, 1987. Method D draws each
+    // skip by rejection in O(1) expected time, method A finishes the sample
+    // once it takes more than 1 / 13 of the remaining elements, where
+    // stepping over them one by one is cheaper.
+    constexpr int64_t kAlphaInverse = 13;
+    std::uniform_real_distribution<double> dis(0.0, 1.0);
+    // uniform in (0, 1), its log is finite
+    auto uniform = [&]() {
+        double u = 0;
+        while (u == 0) {
+            u = dis(gen);
+        }
+        return u;
+    };
+
+    FixedVector<uint32_t> sampled;
     sampled.reserve(M);
-    while (sampled.size() < M) {
-        sampled.insert(dis(gen));
-    }
+    int64_t next = 0;
+    auto select = [&](int64_t skip) {
+        next += skip;
+        sampled.push_back(static_cast<uint32_t>(next));
+        next++;
+    };
 
-    return FixedVector<uint32_t>(sampled.begin(), sampled.end());
-}
+    // the elements still to select and the elements left to select them from
+    int64_t n = M;
+    int64_t remaining = N;
+    double v_prime = 0;
+    if (n > 1 && n * kAlphaInverse < remaining) {
+        double n_inv = 1.0 / n;
+        v_prime = std::exp(std::log(uniform()) * n_inv);
+        int64_t qu1 = remaining - n + 1;
+        int64_t threshold = -kAlphaInverse * n;
+        while (n > 1 && threshold < remaining) {
+            double n_real = n;
+            double remaining_real = remaining;
+            double n_min1_inv = 1.0 / (n_real - 1);
+            int64_t skip = 0;
+            while (true) {
+                double x = 0;
+                while (true) {
+                    x = remaining_real * (1.0 - v_prime);
+                    skip = static_cast<int64_t>(x);
+                    if (skip < qu1) {
+                        break;
+                    }
+                    v_prime = std::exp(std::log(uniform()) * n_inv);
+                }
+                double qu1_real = qu1;
+                double y1 = std::exp(
+                    std::log(uniform() * remaining_real / qu1_real) *
+                    n_min1_inv);
+                v_prime = y1 * (1.0 - x / remaining_real) *
+                          (qu1_real / (qu1_real - skip));
+                if (v_prime <= 1.0) {
+                    // the quick acceptance, v_prime is already uniform for
+                    // the next skip
+                    break;
+                }
+                double y2 = 1.0;
+                double top = remaining_real - 1;
+                double bottom = 0;
+                int64_t limit = 0;
+                if (n - 1 > skip) {
+                    bottom = remaining_real - n_real;
+                    limit = remaining - skip;
+                } else {
+                    bottom = remaining_real - skip - 1;
+                    limit = qu1;
+                }
+                for (int64_t t = remaining - 1; t >= limit; t--) {
+                    y2 = y2 * top / bottom;
+                    top--;
+                    bottom--;
+                }
+                if (remaining_real / (remaining_real - x) >=
+                    y1 * std::exp(std::log(y2) * n_min1_inv)) {
+                    v_prime = std::exp(std::log(uniform()) * n_min1_inv);
+                    break;
+                }
+                v_prime = std::exp(std::log(uniform()) * n_inv);
+            }
+            select(skip);
+            remaining -= skip + 1;
+            n--;
+            n_inv = n_min1_inv;
+            qu1 -= skip;
+            threshold += kAlphaInverse;
+        }
+        if (n == 1) {
+            select(static_cast<int64_t>(remaining * v_prime));
+            return sampled;
+        }
+    }
 
-FixedVector<uint32_t>
-PhyRandomSampleNode::StandardSample(const uint32_t N,
-                                    const uint32_t M,
-                                    std::mt19937& gen) {
-    FixedVector<uint32_t> inputs(N);
-    FixedVector<uint32_t> outputs(M);
-    std::iota(inputs.begin(), inputs.end(), 0);
-
-    std::sample(inputs.begin(), inputs.end(), outputs.begin(), M, gen);
-    return outputs;
+    // method A
+    double top = remaining - n;
+    double remaining_real = remaining;
+    while (n >= 2) {
+        double v = dis(gen);
+        int64_t skip = 0;
+        double quot = top / remaining_real;
+        while (quot > v) {
+            skip++;
+            top--;
+            remaining_real--;
+            quot = quot * top / remaining_real;
+        }
+        select(skip);
+        remaining_real--;
+        n--;
+    }
+    if (n == 1) {
+        select(static_cast<int64_t>(remaining_real * dis(gen)));
+    }
+    return sampled;
 }
 
 FixedVector<uint32_t>
@@ -98,14 +193,41 @@ PhyRandomSampleNode::Sample(const uint32_t N, const float factor) {
     const uint32_t M = std::max(static_cast<uint32_t>(N * factor), 1u);
     std::random_device rd;
     std::mt19937 gen(rd());
-    float epsilon = std::numeric_limits<float>::epsilon();
-    // It's derived from some experiments
-    if (factor <= 0.02 + epsilon ||
-        (N <= 10000000 && factor <= 0.045 + epsilon) ||
-        (N <= 60000000 && factor <= 0.025 + epsilon)) {
-        return HashsetSample(N, M, gen);
+    return SequentialSample(N, std::min(M, N), gen);
+}
+
+FixedVector<uint32_t>
+PhyRandomSampleNode::UnsetPositions(const TargetBitmapView& bitmap,
+                                    const FixedVector<uint32_t>& ranks) {
+    FixedVector<uint32_t> positions;
+    positions.reserve(ranks.size());
+    const uint64_t* words = bitmap.data();
+    const size_t size = bitmap.size();
+    size_t word = 0;
+    // the unset bits before `word`
+    uint64_t unset_before = 0;
+    for (auto rank : ranks) {
+        uint64_t unset = 0;
+        while (true) {
+            unset = ~words[word];
+            auto bits = size - word * 64;
+            if (bits < 64) {
+                unset &= (uint64_t{1} << bits) - 1;
+            }
+            auto count = static_cast<uint64_t>(__builtin_popcountll(unset));
+            if (rank < unset_before + count) {
+                break;
+            }
+            unset_before += count;
+            word++;
+        }
+        // drop the lower unset bits of the word to reach the rank-th one
+        for (auto i = unset_before; i < rank; i++) {
+            unset &= unset - 1;
+        }
+        positions.push_back(word * 64 + __builtin_ctzll(unset));
     }
-    return StandardSample(N, M, gen);
+    return positions;
 }
 
 RowVectorPtr
@@ -144,21 +266,13 @@ PhyRandomSampleNode::GetOutput() {
         size_t input_false_count = input_data.size() - input_data.count();
 
         if (input_false_count > 0) {
-            FixedVector<uint32_t> pos{};
-            pos.reserve(input_false_count);
-            auto value = input_data.find_first(false);
-            while (value.has_value()) {
-                auto offset = value.value();
-                pos.push_back(offset);
-                value = input_data.find_next(offset, false);
-            }
-            assert(pos.size() == input_false_count);
-
+            // walk the filter result by rank, instead of collecting the
+            // positions of every row it keeps
+            auto positions = UnsetPositions(
+                input_data, Sample(input_false_count, factor_));
             input_data.set();
-            auto sampled = Sample(input_false_count, factor_);
-            assert(sampled.back() < input_false_count);
-            for (auto i = 0; i < sampled.size(); ++i) {
-                input_data[pos[sampled[i]]] = false;
+            for (auto pos : positions) {
+                input_data[pos] = false;
             }
         }
 
@@ -64,20 +64,23 @@ class PhyRandomSampleNode : public Operator {
     }
 
  private:
-    // Samples M elements from 0 to N - 1 where every element has equal probability to be selected.
+    // Samples M elements from 0 to N - 1 in increasing order where every
+    // element has equal probability to be selected, picking each next one by
+    // a random skip over the elements in between (Vitter's method D), so it
+    // takes O(M) time and no memory besides the result however large N is.
     static FixedVector<uint32_t>
-    HashsetSample(const uint32_t N, const uint32_t M, std::mt19937& gen);
+    SequentialSample(const uint32_t N, const uint32_t M, std::mt19937& gen);
 
-    // Samples M elements from 0 to N - 1 where every element has equal probability to be selected.
+    // Samples max(N * factor, 1) elements from 0 to N - 1 in increasing
+    // order where every element has equal probability to be selected.
     static FixedVector<uint32_t>
-    StandardSample(const uint32_t N, const uint32_t M, std::mt19937& gen);
+    Sample(const uint32_t N, const float factor);
 
-    // Samples M elements from 0 to N - 1 where every element has equal probability to be selected.
-    // It selects which kinds of sample method we use for sampling which is based on some experiments.
-    // Basically, the performance of HashsetSample is highly related to N * factor while StandardSample is highly
-    // related to N.
+    // The positions of the unset bits of `bitmap` whose ranks among them are
+    // `ranks`, which are increasing.
     static FixedVector<uint32_t>
-    Sample(const uint32_t N, const float factor);
+    UnsetPositions(const TargetBitmapView& bitmap,
+                   const FixedVector<uint32_t>& ranks);
 
     float factor_{0};
     int64_t active_count_{0};
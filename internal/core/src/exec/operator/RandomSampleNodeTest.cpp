@@ -190,4 +190,59 @@ TEST(RandomSampleTest, SampleWithEmptyInput) {
     int data_size = field.scalars().long_data().data_size();
 
     ASSERT_EQ(data_size, 0);
-}
\ No newline at end of file
+}
+TEST(RandomSampleTest, SampleWithSparseFilter) {
+    double sample_factor = 0.5;
+
+    auto schema = std::make_shared<Schema>();
+    auto pk_fid = schema->AddDebugField("i64", DataType::INT64);
+    schema->set_primary_field_id(pk_fid);
+    auto fid_64 = schema->AddDebugField("integer", DataType::INT64);
+
+    const int64_t N = 3000;
+    auto dataset = DataGen(schema, N);
+
+    auto size = dataset.raw_->mutable_fields_data()->size();
+    auto i64_col = dataset.raw_->mutable_fields_data()
+                       ->at(size - 1)
+                       .mutable_scalars()
+                       ->mutable_long_data()
+                       ->mutable_data();
+    // only 30 rows, spread over the segment, match the filter
+    for (int i = 0; i < N; ++i) {
+        i64_col->at(i) = i % 100 == 7 ? 1 : 2;
+    }
+
+    auto segment = CreateSealedWithFieldDataLoaded(schema, dataset);
+
+    milvus::proto::plan::GenericValue val;
+    val.set_int64_val(1);
+    auto expr = std::make_shared<milvus::expr::UnaryRangeFilterExpr>(
+        milvus::expr::ColumnInfo(
+            fid_64, DataType::INT64, std::vector<std::string>()),
+        OpType::Equal,
+        val,
+        std::vector<proto::plan::GenericValue>{});
+    auto plan = std::make_unique<query::RetrievePlan>(schema);
+    plan->plan_node_ = std::make_unique<query::RetrievePlanNode>();
+    plan->plan_node_->plannodes_ =
+        milvus::test::CreateRetrievePlanForRandomSample(sample_factor, expr);
+    std::vector<FieldId> target_offsets{pk_fid, fid_64};
+    plan->field_ids_ = target_offsets;
+
+    auto retrieve_results = RetrieveWithDefaultOutputSizeAndLargeTimestamp(
+        segment.get(), plan.get());
+    ASSERT_EQ(retrieve_results->fields_data_size(), target_offsets.size());
+    auto pks = retrieve_results->fields_data(0).scalars().long_data();
+    auto values = retrieve_results->fields_data(1).scalars().long_data();
+
+    // the sample holds exactly half of the matching rows, each of them once
+    ASSERT_EQ(values.data_size(), 15);
+    std::vector<int64_t> sampled_pks(pks.data().begin(), pks.data().end());
+    std::sort(sampled_pks.begin(), sampled_pks.end());
+    EXPECT_EQ(std::unique(sampled_pks.begin(), sampled_pks.end()),
+              sampled_pks.end());
+    for (int i = 0; i < values.data_size(); i++) {
+        ASSERT_EQ(values.data(i), 1);
+    }
+}
@@ -21,9 +21,10 @@
 #include <cstddef>
 #include <cstdint>
 #include <functional>
-#include <optional>
+#include <memory>
 #include <ratio>
 #include <utility>
+#include <vector>
 
 #include "common/EasyAssert.h"
 #include "common/QueryResult.h"
@@ -119,7 +120,10 @@ PhyRescoresNode::GetOutput() {
         return input_;
     }
 
-    std::vector<std::optional<float>> boost_scores(offsets.size());
+    std::vector<float> boost_scores(offsets.size(), 0.0F);
+    auto has_boost = std::make_unique<bool[]>(offsets.size());
+    rescores::BoostScores scores{
+        boost_scores.data(), has_boost.get(), offsets.size()};
     auto function_mode = option_->function_mode();
     rescores::ComputeFunctionScores(exec_context,
                                     op_context,
@@ -127,24 +131,22 @@ PhyRescoresNode::GetOutput() {
                                     scorers_,
                                     function_mode,
                                     offsets,
-                                    boost_scores);
+                                    scores);
 
     // calculate final score
     auto boost_mode = option_->boost_mode();
     switch (boost_mode) {
         case proto::plan::BoostModeMultiply:
             for (auto i = 0; i < offsets.size(); i++) {
-                if (boost_scores[i].has_value()) {
-                    search_result.distances_[offset_idx[i]] *=
-                        boost_scores[i].value();
+                if (has_boost[i]) {
+                    search_result.distances_[offset_idx[i]] *= boost_scores[i];
                 }
             }
             break;
         case proto::plan::BoostModeSum:
             for (auto i = 0; i < offsets.size(); i++) {
-                if (boost_scores[i].has_value()) {
-                    search_result.distances_[offset_idx[i]] +=
-                        boost_scores[i].value();
+                if (has_boost[i]) {
+                    search_result.distances_[offset_idx[i]] += boost_scores[i];
                 }
             }
 
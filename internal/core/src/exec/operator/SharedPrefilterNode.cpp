@@ -0,0 +1,71 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "SharedPrefilterNode.h"
+
+#include <utility>
+#include <vector>
+
+#include "common/EasyAssert.h"
+#include "common/Tracer.h"
+#include "exec/expression/Utils.h"
+
+namespace milvus {
+namespace exec {
+
+PhySharedPrefilterNode::PhySharedPrefilterNode(
+    int32_t operator_id,
+    DriverContext* driverctx,
+    const plan::PlanNodeId& plan_node_id)
+    : Operator(driverctx,
+               RowType::None,
+               operator_id,
+               plan_node_id,
+               "PhySharedPrefilterNode") {
+    query_context_ =
+        operator_context_->get_exec_context()->get_query_context();
+}
+
+RowVectorPtr
+PhySharedPrefilterNode::GetOutput() {
+    milvus::exec::checkCancellation(query_context_);
+
+    if (is_finished_) {
+        return nullptr;
+    }
+    is_finished_ = true;
+    if (query_context_->get_active_count() == 0) {
+        return nullptr;
+    }
+
+    const auto& prefilter = query_context_->get_shared_prefilter();
+    AssertInfo(prefilter != nullptr && prefilter->bits != nullptr,
+               "shared prefilter is not set");
+    const auto& bits = prefilter->bits;
+    TargetBitmapView data(bits->GetRawData(), bits->size());
+    TargetBitmapView valid(bits->GetValidRawData(), bits->size());
+    if (prefilter->all_rows_visible) {
+        query_context_->set_all_rows_visible(true);
+    }
+    tracer::AddEvent("shared_prefilter");
+    auto col_input =
+        std::make_shared<ColumnVector>(TargetBitmap(data), TargetBitmap(valid));
+    return std::make_shared<RowVector>(std::vector<VectorPtr>{col_input});
+}
+
+}  // namespace exec
+}  // namespace milvus
@@ -0,0 +1,82 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "exec/Driver.h"
+#include "exec/QueryContext.h"
+#include "exec/operator/Operator.h"
+
+namespace milvus {
+namespace exec {
+
+// Source of a search pipeline whose pre-filter was evaluated beforehand,
+// see QueryContext::set_shared_prefilter. It stands for the FilterBitsNode
+// and MvccNode of the plan and outputs a copy of their bitset, so that the
+// operators after it may change it in place.
+class PhySharedPrefilterNode : public Operator {
+ public:
+    PhySharedPrefilterNode(int32_t operator_id,
+                           DriverContext* ctx,
+                           const plan::PlanNodeId& plan_node_id);
+
+    bool
+    IsFilter() const override {
+        return false;
+    }
+
+    bool
+    NeedInput() const override {
+        return !is_finished_;
+    }
+
+    void
+    AddInput(RowVectorPtr& input) override {
+    }
+
+    RowVectorPtr
+    GetOutput() override;
+
+    bool
+    IsFinished() override {
+        return is_finished_;
+    }
+
+    void
+    Close() override {
+    }
+
+    BlockingReason
+    IsBlocked(ContinueFuture* /* unused */) override {
+        return BlockingReason::kNotBlocked;
+    }
+
+    virtual std::string
+    ToString() const override {
+        return "PhySharedPrefilterNode";
+    }
+
+ private:
+    QueryContext* query_context_;
+    bool is_finished_{false};
+};
+
+}  // namespace exec
+}  // namespace milvus
@@ -16,7 +16,9 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include "common/QueryInfo.h"
 #include "common/QueryResult.h"
 #include "knowhere/index/index_node.h"
@@ -46,6 +48,57 @@ find_binsert_position(const std::vector<float>& distances,
     return static_cast<size_t>(it - distances.begin());
 }
 
+// Upper bound on how many times larger than the number of missing results a
+// batch pulled from a vector iterator may grow
+constexpr int64_t kMaxIterativeFilterBatchGrowth = 64;
+
+// Number of candidates to pull from a vector iterator for the next round of
+// iterative filtering, given `remaining` results still missing and that
+// `passed` of the `pulled` candidates seen so far passed the filter.
+// The batch is sized to fill the rest at the observed pass rate, so a
+// selective filter is evaluated over a few large batches instead of one
+// short batch per hit.
+inline int64_t
+NextIterativeFilterBatchSize(int64_t remaining,
+                             int64_t pulled,
+                             int64_t passed) {
+    if (remaining <= 0 || pulled <= 0) {
+        return remaining;
+    }
+    auto max_size = remaining * kMaxIterativeFilterBatchGrowth;
+    if (passed <= 0) {
+        return max_size;
+    }
+    auto size = (remaining * pulled + passed - 1) / passed;
+    return std::clamp(size, remaining, max_size);
+}
+
+// Fewest elements a probe iterator has to pull before its pass rate is
+// trusted to choose how an element filter is evaluated
+constexpr int64_t kMinIterativeElementFilterProbe = 1024;
+
+// Whether the element filter of an iterative element-level search is better
+// evaluated over all `total_elements` once and pushed into the search as a
+// bitset, given that `passed` of the `pulled` elements of a probe iterator
+// passed it. At the observed pass rate the `nq` iterators scan about
+// nq * topk / rate elements to fill their results, once that is past the
+// number of elements a single pass over them is cheaper.
+inline bool
+PushdownIterativeElementFilter(int64_t pulled,
+                               int64_t passed,
+                               int64_t nq,
+                               int64_t topk,
+                               int64_t total_elements) {
+    if (pulled < kMinIterativeElementFilterProbe || total_elements <= 0) {
+        return false;
+    }
+    if (passed <= 0) {
+        return true;
+    }
+    auto expected_scan = static_cast<double>(nq) * topk * pulled / passed;
+    return expected_scan >= static_cast<double>(total_elements);
+}
+
 [[maybe_unused]] static bool
 UseVectorIterator(const SearchInfo& search_info) {
     return search_info.has_group_by() || search_info.iterative_filter_execution;
@@ -19,6 +19,7 @@
 #include <algorithm>
 #include <chrono>
 #include <functional>
+#include <iterator>
 #include <ratio>
 #include <utility>
 #include <vector>
@@ -26,13 +27,18 @@
 #include "bitset/bitset.h"
 #include "common/ArrayOffsets.h"
 #include "common/BitsetView.h"
+#include "common/Common.h"
 #include "common/EasyAssert.h"
+#include "common/PinCache.h"
 #include "common/QueryResult.h"
+#include "common/Tracepoint.h"
 #include "common/Tracer.h"
 #include "common/Utils.h"
+#include "exec/MorselDispatcher.h"
 #include "exec/QueryContext.h"
 #include "exec/expression/Utils.h"
 #include "exec/operator/Utils.h"
+#include "futures/Executor.h"
 #include "monitor/Monitor.h"
 #include "opentelemetry/trace/span.h"
 #include "plan/PlanNode.h"
@@ -71,6 +77,94 @@ PhyVectorSearchNode::PhyVectorSearchNode(
     search_info_ = query_context_->get_search_info();
 }
 
+int64_t
+PhyVectorSearchNode::NqSliceSize(const query::Placeholder& ph) const {
+    auto parallelism = EXEC_SEARCH_NQ_SLICE_PARALLELISM.load();
+    auto slice_nq = EXEC_SEARCH_NQ_SLICE_SIZE.load();
+    auto num_queries = ph.num_of_queries_;
+    // the vector iterators of group by and iterative filter, an embedding
+    // list and an element level search hold state across the queries
+    if (parallelism <= 1 || segment_->type() != SegmentType::Sealed ||
+        num_queries < 2 * slice_nq || ph.element_level_ ||
+        !ph.offsets_.empty() || UseVectorIterator(search_info_) ||
+        search_info_.iterator_v2_info_.has_value() ||
+        (!ph.blob_.empty() && ph.blob_.size() % num_queries != 0)) {
+        return 0;
+    }
+    return std::max(slice_nq, (num_queries + parallelism - 1) / parallelism);
+}
+
+void
+PhyVectorSearchNode::SearchInNqSlices(const query::Placeholder& ph,
+                                      int64_t slice_nq,
+                                      const BitsetView& search_view,
+                                      SearchResult& search_result) {
+    auto num_queries = ph.num_of_queries_;
+    auto num_slices = (num_queries + slice_nq - 1) / slice_nq;
+    // only one of them is set, see Placeholder
+    auto blob = static_cast<const char*>(ph.get_blob());
+    auto sparse_rows =
+        static_cast<const knowhere::sparse::SparseRow<SparseValueType>*>(
+            ph.get_blob());
+    auto query_bytes =
+        ph.blob_.empty() ? 0 : ph.blob_.size() / num_queries;
+
+    std::vector<SearchResult> slices(num_slices);
+    std::vector<SearchInfo> infos(num_slices, search_info_);
+    auto op_context = query_context_->get_op_context();
+    auto pin_cache = query_context_->get_pin_cache();
+    MorselDispatcher::Run(
+        num_queries,
+        slice_nq,
+        static_cast<int32_t>(EXEC_SEARCH_NQ_SLICE_PARALLELISM.load()),
+        query_context_->get_search_executor(),
+        [&]() -> MorselDispatcher::Worker {
+            return [&](int64_t begin, int64_t end) {
+                PinCache::Scope pin_cache_scope(pin_cache);
+                auto idx = begin / slice_nq;
+                const void* queries =
+                    ph.blob_.empty()
+                        ? static_cast<const void*>(sparse_rows + begin)
+                        : static_cast<const void*>(blob + begin * query_bytes);
+                segment_->vector_search(infos[idx],
+                                        queries,
+                                        nullptr,
+                                        end - begin,
+                                        query_timestamp_,
+                                        search_view,
+                                        op_context,
+                                        slices[idx]);
+            };
+        });
+
+    // the slices cover consecutive queries, appending them in order is
+    // the result of a single search
+    search_result.total_nq_ = num_queries;
+    search_result.unity_topK_ = slices[0].unity_topK_;
+    search_result.distances_.reserve(num_queries * slices[0].unity_topK_);
+    search_result.seg_offsets_.reserve(num_queries * slices[0].unity_topK_);
+    for (auto& slice : slices) {
+        AssertInfo(slice.unity_topK_ == search_result.unity_topK_,
+                   "nq slices of a search returned topk {} and {}",
+                   slice.unity_topK_,
+                   search_result.unity_topK_);
+        search_result.distances_.insert(search_result.distances_.end(),
+                                        slice.distances_.begin(),
+                                        slice.distances_.end());
+        search_result.seg_offsets_.insert(search_result.seg_offsets_.end(),
+                                          slice.seg_offsets_.begin(),
+                                          slice.seg_offsets_.end());
+        search_result.search_storage_cost_ += slice.search_storage_cost_;
+        std::move(slice.chunk_buffers_.begin(),
+                  slice.chunk_buffers_.end(),
+                  std::back_inserter(search_result.chunk_buffers_));
+        std::move(slice.pinned_bitsets_.begin(),
+                  slice.pinned_bitsets_.end(),
+                  std::back_inserter(search_result.pinned_bitsets_));
+    }
+    search_info_ = std::move(infos[0]);
+}
+
 void
 PhyVectorSearchNode::AddInput(RowVectorPtr& input) {
     input_ = std::move(input);
@@ -178,14 +272,31 @@ PhyVectorSearchNode::GetOutput() {
     // Single search + metrics path
     milvus::SearchResult search_result;
     auto op_context = query_context_->get_op_context();
-    segment_->vector_search(search_info_,
-                            src_data,
-                            src_offsets,
-                            num_queries,
-                            query_timestamp_,
-                            search_view,
-                            op_context,
-                            search_result);
+    MILVUS_TRACEPOINT(vector_search_start,
+                      segment_->get_segment_id(),
+                      search_info_.field_id_.get(),
+                      num_queries,
+                      search_info_.topk_);
+    auto slice_nq = NqSliceSize(ph);
+    if (slice_nq > 0) {
+        // a large nq keeps a single knowhere search on few threads, the
+        // slices are searched by idle search threads, see MorselDispatcher
+        tracer::AddEvent("vector_search_in_nq_slices");
+        SearchInNqSlices(ph, slice_nq, search_view, search_result);
+    } else {
+        segment_->vector_search(search_info_,
+                                src_data,
+                                src_offsets,
+                                num_queries,
+                                query_timestamp_,
+                                search_view,
+                                op_context,
+                                search_result);
+    }
+    MILVUS_TRACEPOINT(vector_search_end,
+                      segment_->get_segment_id(),
+                      search_info_.field_id_.get(),
+                      search_result.seg_offsets_.size());
 
     search_result.total_data_cnt_ = data_cnt;
     search_result.element_level_ = ph.element_level_;
@@ -201,6 +312,8 @@ PhyVectorSearchNode::GetOutput() {
             .count();
     milvus::monitor::internal_core_search_latency_vector.Observe(vector_cost /
                                                                  1000);
+    milvus::monitor::internal_core_stage_duration_seconds_vector_search.Observe(
+        vector_cost / 1e6);
     // vector search stores result in query_context;
     // this node returns the bitset for downstream operators
     return input_;
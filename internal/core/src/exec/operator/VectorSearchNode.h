@@ -77,6 +77,17 @@ class PhyVectorSearchNode : public Operator {
     }
 
  private:
+    // queries per slice when the search is split into nq slices, 0 when
+    // the placeholder is searched at once
+    int64_t
+    NqSliceSize(const query::Placeholder& ph) const;
+
+    void
+    SearchInNqSlices(const query::Placeholder& ph,
+                     int64_t slice_nq,
+                     const BitsetView& search_view,
+                     SearchResult& search_result);
+
     const milvus::segcore::SegmentInternalInterface* segment_;
     QueryContext* query_context_;
     milvus::Timestamp query_timestamp_;
@@ -0,0 +1,126 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/Common.h"
+#include "common/QueryResult.h"
+#include "common/Schema.h"
+#include "common/Types.h"
+#include "knowhere/comp/index_param.h"
+#include "pb/plan.pb.h"
+#include "query/Plan.h"
+#include "query/PlanImpl.h"
+#include "test_utils/DataGen.h"
+#include "test_utils/storage_test_utils.h"
+
+using namespace milvus;
+using namespace milvus::segcore;
+
+namespace {
+
+namespace planpb = proto::plan;
+
+constexpr int64_t kRows = 2000;
+constexpr int64_t kDim = 16;
+constexpr int64_t kNq = 100;
+
+class VectorSearchNqSliceTest : public ::testing::Test {
+ protected:
+    void
+    SetUp() override {
+        schema_ = std::make_shared<Schema>();
+        auto pk_fid = schema_->AddDebugField("pk", DataType::INT64);
+        schema_->set_primary_field_id(pk_fid);
+        vec_fid_ = schema_->AddDebugField(
+            "vec", DataType::VECTOR_FLOAT, kDim, knowhere::metric::L2);
+        counter_fid_ = schema_->AddDebugField("counter", DataType::INT64);
+        auto raw_data = DataGen(schema_, kRows);
+        segment_ = CreateSealedWithFieldDataLoaded(schema_, raw_data);
+        parallelism_ = EXEC_SEARCH_NQ_SLICE_PARALLELISM.load();
+        slice_nq_ = EXEC_SEARCH_NQ_SLICE_SIZE.load();
+    }
+
+    void
+    TearDown() override {
+        EXEC_SEARCH_NQ_SLICE_PARALLELISM.store(parallelism_);
+        EXEC_SEARCH_NQ_SLICE_SIZE.store(slice_nq_);
+    }
+
+    std::unique_ptr<SearchResult>
+    Search(int64_t parallelism, int64_t slice_nq, bool filtered) {
+        EXEC_SEARCH_NQ_SLICE_PARALLELISM.store(parallelism);
+        EXEC_SEARCH_NQ_SLICE_SIZE.store(slice_nq);
+
+        planpb::PlanNode plan_node;
+        auto* anns = plan_node.mutable_vector_anns();
+        anns->set_vector_type(planpb::VectorType::FloatVector);
+        anns->set_field_id(vec_fid_.get());
+        anns->set_placeholder_tag("$0");
+        auto* query_info = anns->mutable_query_info();
+        query_info->set_topk(10);
+        query_info->set_metric_type(knowhere::metric::L2);
+        query_info->set_search_params("{}");
+        query_info->set_round_decimal(-1);
+        if (filtered) {
+            auto* unary =
+                anns->mutable_predicates()->mutable_unary_range_expr();
+            auto* column = unary->mutable_column_info();
+            column->set_field_id(counter_fid_.get());
+            column->set_data_type(proto::schema::DataType::Int64);
+            unary->set_op(planpb::OpType::LessThan);
+            unary->mutable_value()->set_int64_val(kRows / 2);
+        }
+
+        auto plan_bytes = plan_node.SerializeAsString();
+        auto plan = query::CreateSearchPlanByExpr(
+            schema_, plan_bytes.data(), plan_bytes.size());
+        auto ph_bytes =
+            CreatePlaceholderGroup(kNq, kDim, 1024).SerializeAsString();
+        auto ph_group = query::ParsePlaceholderGroup(plan.get(), ph_bytes);
+        return segment_->Search(plan.get(), ph_group.get(), MAX_TIMESTAMP);
+    }
+
+    SchemaPtr schema_;
+    FieldId vec_fid_;
+    FieldId counter_fid_;
+    SegmentSealedUPtr segment_;
+    int64_t parallelism_;
+    int64_t slice_nq_;
+};
+
+}  // namespace
+
+TEST_F(VectorSearchNqSliceTest, SlicesMatchSingleSearch) {
+    for (bool filtered : {false, true}) {
+        auto single = Search(1, 16, filtered);
+        // a slice holds at least nq / parallelism queries, 16 means 25
+        for (int64_t slice_nq : {16, 30, kNq / 2}) {
+            auto sliced = Search(4, slice_nq, filtered);
+            ASSERT_EQ(sliced->total_nq_, kNq);
+            ASSERT_EQ(sliced->unity_topK_, single->unity_topK_);
+            ASSERT_EQ(sliced->total_data_cnt_, single->total_data_cnt_);
+            ASSERT_EQ(sliced->seg_offsets_, single->seg_offsets_)
+                << "slice nq " << slice_nq;
+            ASSERT_EQ(sliced->distances_, single->distances_)
+                << "slice nq " << slice_nq;
+        }
+    }
+}
@@ -0,0 +1,88 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "exec/operator/query-agg/ApproxAggregates.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/EasyAssert.h"
+#include "common/Types.h"
+#include "common/Utils.h"
+#include "exec/QueryContext.h"
+#include "log/Log.h"
+
+namespace milvus {
+namespace exec {
+
+template <template <typename> class T, bool AcceptStrings>
+void
+registerApprox(const std::string& name) {
+    exec::registerAggregateFunction(
+        name,
+        [name](const std::vector<DataType>& argumentTypes,
+               const QueryConfig& /*config*/) -> std::unique_ptr<Aggregate> {
+            AssertInfo(argumentTypes.size() == 1,
+                       "function:{} only accept one argument",
+                       name);
+            auto inputType = argumentTypes[0];
+            switch (inputType) {
+                case DataType::INT8:
+                    return std::make_unique<T<int8_t>>();
+                case DataType::INT16:
+                    return std::make_unique<T<int16_t>>();
+                case DataType::INT32:
+                    return std::make_unique<T<int32_t>>();
+                case DataType::INT64:
+                case DataType::TIMESTAMPTZ:
+                    return std::make_unique<T<int64_t>>();
+                case DataType::FLOAT:
+                    return std::make_unique<T<float>>();
+                case DataType::DOUBLE:
+                    return std::make_unique<T<double>>();
+                default:
+                    break;
+            }
+            if constexpr (AcceptStrings) {
+                if (IsStringDataType(inputType)) {
+                    return std::make_unique<T<std::string>>();
+                }
+            }
+            ThrowInfo(DataTypeInvalid,
+                      "Unknown input type for {} aggregation {}",
+                      name,
+                      GetDataTypeName(inputType));
+        });
+}
+
+void
+registerApproxCountDistinctAggregate() {
+    registerApprox<ApproxCountDistinctAggregate, true>(
+        milvus::KApproxCountDistinct);
+    LOG_INFO("Registered Approx Count Distinct Aggregate Function");
+}
+
+void
+registerApproxPercentileAggregate() {
+    // t-digests only order numbers
+    registerApprox<ApproxPercentileAggregate, false>(milvus::KApproxPercentile);
+    LOG_INFO("Registered Approx Percentile Aggregate Function");
+}
+
+}  // namespace exec
+}  // namespace milvus
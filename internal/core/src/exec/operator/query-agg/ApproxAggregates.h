@@ -0,0 +1,282 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <cmath>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "common/EasyAssert.h"
+#include "common/Utils.h"
+#include "common/Vector.h"
+#include "exec/operator/query-agg/Aggregate.h"
+#include "exec/operator/query-agg/HyperLogLog.h"
+#include "exec/operator/query-agg/TDigest.h"
+#include "xxhash.h"
+
+namespace milvus {
+namespace exec {
+
+// Approximate aggregates keep a sketch per group and emit it serialized as
+// a VARCHAR partial state. The reducer deserializes and merges the states
+// of all segments before reading the final answer off the merged sketch:
+// HyperLogLog::Estimate() for approx_count_distinct and
+// TDigest::Quantile() for approx_percentile, which is why the percentile
+// itself is not an argument of the segment-side aggregate.
+//
+// Like MinStringAggregate the sketch lives on the heap behind a pointer in
+// the group row and is released by extractValues().
+//
+// The result protos only carry valid UTF-8 in VARCHAR columns, so the binary
+// sketch travels hex encoded, see EncodeSketchState().
+
+inline std::string
+EncodeSketchState(const std::string& sketch) {
+    static constexpr char kDigits[] = "0123456789abcdef";
+    std::string state;
+    state.reserve(sketch.size() * 2);
+    for (unsigned char c : sketch) {
+        state.push_back(kDigits[c >> 4]);
+        state.push_back(kDigits[c & 0xf]);
+    }
+    return state;
+}
+
+inline std::string
+DecodeSketchState(const std::string& state) {
+    auto nibble = [](char c) -> int {
+        if (c >= '0' && c <= '9') {
+            return c - '0';
+        }
+        if (c >= 'a' && c <= 'f') {
+            return c - 'a' + 10;
+        }
+        ThrowInfo(UnexpectedError, "invalid sketch state digit {}", c);
+    };
+    AssertInfo(state.size() % 2 == 0,
+               "sketch state of odd length {}",
+               state.size());
+    std::string sketch;
+    sketch.reserve(state.size() / 2);
+    for (size_t i = 0; i < state.size(); i += 2) {
+        sketch.push_back(
+            static_cast<char>(nibble(state[i]) << 4 | nibble(state[i + 1])));
+    }
+    return sketch;
+}
+
+// Numbers are hashed through a canonical 64-bit form so the same value
+// hashes alike whatever the width of the column it was read from.
+template <typename T>
+inline uint64_t
+HashForDistinct(const T& value) {
+    if constexpr (std::is_same_v<T, std::string>) {
+        return XXH3_64bits(value.data(), value.size());
+    } else if constexpr (std::is_floating_point_v<T>) {
+        double canonical = static_cast<double>(value);
+        if (canonical == 0) {
+            canonical = 0;  // -0.0 and 0.0 are the same value
+        } else if (std::isnan(canonical)) {
+            canonical = std::nan("");
+        }
+        return XXH3_64bits(&canonical, sizeof(canonical));
+    } else {
+        auto canonical = static_cast<int64_t>(value);
+        return XXH3_64bits(&canonical, sizeof(canonical));
+    }
+}
+
+template <typename TInput, typename TSketch>
+class SketchAggregate : public Aggregate {
+ public:
+    explicit SketchAggregate(DataType resultType) : Aggregate(resultType) {
+    }
+
+    int32_t
+    accumulatorFixedWidthSize() const override {
+        return sizeof(TSketch*);
+    }
+
+    void
+    addRawInput(char** groups,
+                int numGroups,
+                const std::vector<VectorPtr>& input) override {
+        auto column = inputColumn(input);
+        auto raw = column->RawAsValues<TInput>();
+        for (auto i = 0; i < column->size(); i++) {
+            if (!column->ValidAt(i)) {
+                continue;
+            }
+            addToSketch(sketchOf(groups[i]), raw[i]);
+        }
+    }
+
+    void
+    addSingleGroupRawInput(char* group,
+                           int64_t numRows,
+                           const std::vector<VectorPtr>& input) override {
+        auto column = inputColumn(input);
+        auto raw = column->RawAsValues<TInput>();
+        auto& sketch = sketchOf(group);
+        for (auto i = 0; i < column->size(); i++) {
+            if (!column->ValidAt(i)) {
+                continue;
+            }
+            addToSketch(sketch, raw[i]);
+        }
+    }
+
+    void
+    extractValues(char** groups,
+                  int32_t numGroups,
+                  VectorPtr* result) override {
+        auto result_column = std::dynamic_pointer_cast<ColumnVector>(*result);
+        AssertInfo(result_column != nullptr,
+                   "input vector for extracting aggregation must be of Type "
+                   "ColumnVector");
+        result_column->resize(numGroups);
+        for (auto i = 0; i < numGroups; i++) {
+            char* group = groups[i];
+            auto& ptr = *value<TSketch*>(group);
+            if (emptyIsNull() && (isNull(group) || ptr == nullptr)) {
+                result_column->nullAt(i);
+            } else {
+                result_column->clearNullAt(i);
+                result_column->SetValueAt<std::string>(
+                    i,
+                    EncodeSketchState(ptr == nullptr ? TSketch().Serialize()
+                                                     : ptr->Serialize()));
+            }
+            delete ptr;
+            ptr = nullptr;
+        }
+    }
+
+    void
+    initializeNewGroupsInternal(
+        char** groups, folly::Range<const vector_size_t*> indices) override {
+        setAllNulls(groups, indices);
+        for (auto i : indices) {
+            *value<TSketch*>(groups[i]) = nullptr;
+        }
+    }
+
+ protected:
+    // whether a group that saw no value yields null instead of an empty
+    // sketch
+    virtual bool
+    emptyIsNull() const = 0;
+
+    virtual void
+    addToSketch(TSketch& sketch, const TInput& value) = 0;
+
+ private:
+    static ColumnVectorPtr
+    inputColumn(const std::vector<VectorPtr>& input) {
+        AssertInfo(input.size() == 1,
+                   "approximate aggregate expects exactly one input column");
+        auto column = std::dynamic_pointer_cast<ColumnVector>(input[0]);
+        AssertInfo(column != nullptr,
+                   "approximate aggregate input must be of type ColumnVector");
+        return column;
+    }
+
+    TSketch&
+    sketchOf(char* group) {
+        auto& ptr = *value<TSketch*>(group);
+        if (ptr == nullptr) {
+            clearNull(group);
+            ptr = new TSketch();
+        }
+        return *ptr;
+    }
+};
+
+template <typename TInput>
+class ApproxCountDistinctAggregate final
+    : public SketchAggregate<TInput, HyperLogLog> {
+ public:
+    ApproxCountDistinctAggregate()
+        : SketchAggregate<TInput, HyperLogLog>(DataType::VARCHAR) {
+    }
+
+ protected:
+    // no value counts zero distinct values, never null
+    bool
+    emptyIsNull() const override {
+        return false;
+    }
+
+    void
+    addToSketch(HyperLogLog& sketch, const TInput& value) override {
+        sketch.AddHash(HashForDistinct(value));
+    }
+};
+
+template <typename TInput>
+class ApproxPercentileAggregate final
+    : public SketchAggregate<TInput, TDigest> {
+ public:
+    ApproxPercentileAggregate()
+        : SketchAggregate<TInput, TDigest>(DataType::VARCHAR) {
+    }
+
+ protected:
+    bool
+    emptyIsNull() const override {
+        return true;
+    }
+
+    void
+    addToSketch(TDigest& sketch, const TInput& value) override {
+        sketch.Add(static_cast<double>(value));
+    }
+};
+
+// Folds the serialized partial states of several segments into one sketch,
+// for merging partial results before they reach the reducer. Emits a group
+// that saw no state the way the segment-side aggregate does.
+template <typename TSketch, bool EmptyIsNull>
+class SketchMergeAggregate final
+    : public SketchAggregate<std::string, TSketch> {
+ public:
+    SketchMergeAggregate()
+        : SketchAggregate<std::string, TSketch>(DataType::VARCHAR) {
+    }
+
+ protected:
+    bool
+    emptyIsNull() const override {
+        return EmptyIsNull;
+    }
+
+    void
+    addToSketch(TSketch& sketch, const std::string& value) override {
+        sketch.Merge(TSketch::Deserialize(DecodeSketchState(value)));
+    }
+};
+
+void
+registerApproxCountDistinctAggregate();
+
+void
+registerApproxPercentileAggregate();
+
+}  // namespace exec
+}  // namespace milvus
@@ -27,10 +27,33 @@
 #include "exec/operator/query-agg/AggregateInfo.h"
 #include "exec/operator/query-agg/RowContainer.h"
 #include "folly/Range.h"
+#include "log/Log.h"
 #include "segcore/SegcoreConfig.h"
 
 namespace milvus {
 namespace exec {
+GroupingSet::GroupingSet(const RowTypePtr& input_type,
+                         std::vector<std::unique_ptr<VectorHasher>>&& hashers,
+                         std::vector<AggregateInfo>&& aggregates,
+                         const SpillConfig& spill_config)
+    : hashers_(std::move(hashers)),
+      aggregates_(std::move(aggregates)),
+      spillConfig_(spill_config) {
+    isGlobal_ = hashers_.empty();
+    for (size_t i = 0; i < input_type->column_count(); i++) {
+        inputTypes_.push_back(input_type->column_type(i));
+    }
+    if (spillConfig_.enabled() &&
+        (isGlobal_ || !RowContainer::canSpill(inputTypes_))) {
+        // a global aggregation holds one group, nothing to spill
+        if (!isGlobal_) {
+            LOG_WARN("aggregation input types cannot be spilled, keep all "
+                     "groups in memory");
+        }
+        spillConfig_.memory_limit = 0;
+    }
+}
+
 GroupingSet::~GroupingSet() {
     if (isGlobal_ && lookup_) {
         AssertInfo(lookup_->hits_.size() == 1,
@@ -119,6 +142,20 @@ GroupingSet::addGlobalAggregationInput(const milvus::RowVectorPtr& input) {
     tempVectors_.clear();
 }
 
+void
+GroupingSet::addGlobalSummaryInput(const milvus::RowVectorPtr& summary,
+                                   int64_t numRows) {
+    AssertInfo(isGlobal_, "summary input is only for global aggregation");
+    initializeGlobalAggregation();
+    auto* group = lookup_->hits_[0];
+    for (auto i = 0; i < aggregates_.size(); i++) {
+        auto& function = aggregates_[i].function_;
+        populateTempVectors(i, summary);
+        function->addSingleGroupRawInput(group, numRows, tempVectors_);
+    }
+    tempVectors_.clear();
+}
+
 bool
 GroupingSet::getGlobalAggregationOutput(milvus::RowVectorPtr& result) {
     initializeGlobalAggregation();  // when input from upstream operator is empty, we need to initialize the accumulators for global aggregation
@@ -143,6 +180,9 @@ GroupingSet::getOutput(milvus::RowVectorPtr& result) {
     if (!hash_table_) {
         return false;
     }
+    if (spilling_) {
+        return getSpilledOutput(result);
+    }
     const auto& all_rows = hash_table_->rows()->allRows();
     if (!all_rows.empty()) {
         extractGroups(result);
@@ -161,9 +201,123 @@ GroupingSet::accumulators() {
     return accumulators;
 }
 
+bool
+GroupingSet::getSpilledOutput(RowVectorPtr& result) {
+    if (nextSpillPartition_ < 0) {
+        nextSpillPartition_ = 0;
+        for (auto& partition : spillPartitions_) {
+            partition->finishWrite();
+        }
+        if (!hash_table_->rows()->allRows().empty()) {
+            extractGroups(result);
+            return true;
+        }
+    }
+    // Each partition holds the rows of groups no other partition or the
+    // in-memory groups have, so it is aggregated into an emptied table.
+    std::vector<char*> rows;
+    while (nextSpillPartition_ <
+           static_cast<int32_t>(spillPartitions_.size())) {
+        auto partition = std::move(spillPartitions_[nextSpillPartition_++]);
+        hash_table_->clear();
+        hash_table_->rows()->clear();
+        while (partition->readBlock(*spillRows_, rows)) {
+            aggregateInput(toRowVector(rows));
+            spillRows_->clear();
+            rows.clear();
+        }
+        if (!hash_table_->rows()->allRows().empty()) {
+            extractGroups(result);
+            return true;
+        }
+    }
+    return false;
+}
+
+int64_t
+GroupingSet::estimatedBytes() const {
+    int64_t bytes = 0;
+    if (hash_table_ != nullptr) {
+        bytes +=
+            hash_table_->rows()->estimatedBytes() + hash_table_->tableBytes();
+    }
+    if (spillRows_ != nullptr) {
+        bytes += spillRows_->estimatedBytes();
+    }
+    return bytes;
+}
+
+bool
+GroupingSet::hasPendingOutput() const {
+    return spilling_ &&
+           nextSpillPartition_ < static_cast<int32_t>(spillPartitions_.size());
+}
+
 void
 GroupingSet::ensureInputFits(const RowVectorPtr& input) {
-    //TODO memory check
+    if (spilling_ || !spillConfig_.enabled()) {
+        return;
+    }
+    auto bytes =
+        hash_table_->rows()->estimatedBytes() + hash_table_->tableBytes();
+    if (bytes < spillConfig_.memory_limit) {
+        return;
+    }
+    spilling_ = true;
+    for (int32_t i = 0; i < (1 << kSpillPartitionBits); i++) {
+        spillPartitions_.push_back(
+            std::make_unique<SpillFile>(spillConfig_.directory, "agg"));
+    }
+    spillRows_ = std::make_unique<RowContainer>(inputTypes_,
+                                                std::vector<Accumulator>{});
+    LOG_INFO("aggregation holds {} groups in {} bytes, spilling new groups",
+             hash_table_->rows()->allRows().size(),
+             bytes);
+}
+
+RowVectorPtr
+GroupingSet::toRowVector(const std::vector<char*>& rows) {
+    std::vector<VectorPtr> columns;
+    columns.reserve(inputTypes_.size());
+    for (size_t i = 0; i < inputTypes_.size(); i++) {
+        columns.push_back(spillRows_->extractColumnVector(
+            rows.data(), static_cast<int32_t>(rows.size()), i));
+    }
+    return std::make_shared<RowVector>(std::move(columns));
+}
+
+void
+GroupingSet::addSpillingInput(const RowVectorPtr& input) {
+    hash_table_->prepareForGroupProbe(*lookup_, input);
+    hash_table_->findGroups(*lookup_);
+    const auto numRows = input->size();
+    std::vector<ColumnVectorPtr> columns;
+    columns.reserve(inputTypes_.size());
+    for (size_t i = 0; i < inputTypes_.size(); i++) {
+        auto column = std::dynamic_pointer_cast<ColumnVector>(input->child(i));
+        AssertInfo(column != nullptr,
+                   "aggregation input {} must be a column vector",
+                   i);
+        columns.push_back(std::move(column));
+    }
+    std::vector<char*> known;
+    for (auto row = 0; row < numRows; row++) {
+        char* staged = spillRows_->newRow();
+        for (size_t i = 0; i < columns.size(); i++) {
+            spillRows_->store(columns[i], row, staged, i);
+        }
+        if (lookup_->hits_[row] != nullptr) {
+            known.push_back(staged);
+            continue;
+        }
+        auto partition = lookup_->hashes_[row] >> (64 - kSpillPartitionBits);
+        spillPartitions_[partition]->append(*spillRows_, staged);
+        numSpilledRows_++;
+    }
+    if (!known.empty()) {
+        aggregateInput(toRowVector(known));
+    }
+    spillRows_->clear();
 }
 
 void
@@ -196,6 +350,15 @@ GroupingSet::addInputForActiveRows(const RowVectorPtr& input) {
         createHashTable();
     }
     ensureInputFits(input);
+    if (spilling_) {
+        addSpillingInput(input);
+        return;
+    }
+    aggregateInput(input);
+}
+
+void
+GroupingSet::aggregateInput(const RowVectorPtr& input) {
     hash_table_->prepareForGroupProbe(*lookup_, input);
     hash_table_->groupProbe(*lookup_);
     auto& hits = lookup_->hits_;
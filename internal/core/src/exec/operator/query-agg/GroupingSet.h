@@ -25,6 +25,7 @@
 #include "common/Types.h"
 #include "common/Vector.h"
 #include "exec/HashTable.h"
+#include "exec/Spill.h"
 #include "exec/VectorHasher.h"
 
 namespace milvus {
@@ -34,10 +35,8 @@ class GroupingSet {
  public:
     GroupingSet(const RowTypePtr& input_type,
                 std::vector<std::unique_ptr<VectorHasher>>&& hashers,
-                std::vector<AggregateInfo>&& aggregates)
-        : hashers_(std::move(hashers)), aggregates_(std::move(aggregates)) {
-        isGlobal_ = hashers_.empty();
-    }
+                std::vector<AggregateInfo>&& aggregates,
+                const SpillConfig& spill_config = SpillConfig());
 
     ~GroupingSet();
 
@@ -50,6 +49,13 @@ class GroupingSet {
     void
     addGlobalAggregationInput(const RowVectorPtr& input);
 
+    // Folds rows that summarize `numRows` input rows into the global
+    // aggregation: count(*) adds `numRows`, min() and max() consume the
+    // summary rows as they would raw rows. Only valid when every aggregate
+    // is one of those.
+    void
+    addGlobalSummaryInput(const RowVectorPtr& summary, int64_t numRows);
+
     void
     addInputForActiveRows(const RowVectorPtr& input);
 
@@ -59,15 +65,22 @@ class GroupingSet {
     std::vector<Accumulator>
     accumulators();
 
-    // Checks if input will fit in the existing memory and increases reservation
-    // if not. If reservation cannot be increased, spills enough to make 'input'
-    // fit.
+    // Switches to spilling once the groups in memory exceed the spill memory
+    // limit. From then on rows of known groups are still aggregated in
+    // memory while the rows of new groups are hash partitioned to disk, to be
+    // aggregated one partition at a time after the in-memory groups are
+    // returned.
     void
     ensureInputFits(const RowVectorPtr& input);
 
     bool
     getOutput(RowVectorPtr& result);
 
+    // Whether getOutput() has more groups to return, i.e. spilled partitions
+    // that are not aggregated yet.
+    bool
+    hasPendingOutput() const;
+
     void
     extractGroups(const RowVectorPtr& result);
 
@@ -80,7 +93,34 @@ class GroupingSet {
     int32_t
     outputRowCount() const;
 
+    // Number of input rows written to spill partitions.
+    int64_t
+    numSpilledRows() const {
+        return numSpilledRows_;
+    }
+
+    // Bytes of the groups held in memory and of the rows waiting to be
+    // spilled.
+    int64_t
+    estimatedBytes() const;
+
  private:
+    // Probes 'input' into the hash table and updates the accumulators.
+    void
+    aggregateInput(const RowVectorPtr& input);
+
+    void
+    addSpillingInput(const RowVectorPtr& input);
+
+    bool
+    getSpilledOutput(RowVectorPtr& result);
+
+    // Builds a RowVector of the input columns of 'rows', rows of
+    // 'spillRows_'.
+    RowVectorPtr
+    toRowVector(const std::vector<char*>& rows);
+
+    static constexpr int32_t kSpillPartitionBits = 3;
     bool isGlobal_;
 
     std::vector<std::unique_ptr<VectorHasher>> hashers_;
@@ -98,6 +138,17 @@ class GroupingSet {
     // Boolean indicating whether accumulators for a global aggregation (i.e. hashers_.empty()) are initialized
     // This is used to avoid segv when getting output directly without input for empty output of upstream operator
     bool globalAggregationInitialized_{false};
+
+    SpillConfig spillConfig_;
+    std::vector<DataType> inputTypes_;
+    bool spilling_{false};
+    // One file per partition of the hash of the grouping keys.
+    std::vector<std::unique_ptr<SpillFile>> spillPartitions_;
+    // Staging rows of input columns, for serializing and reading back.
+    std::unique_ptr<RowContainer> spillRows_;
+    // Next partition to aggregate, -1 until the in-memory groups are output.
+    int32_t nextSpillPartition_{-1};
+    int64_t numSpilledRows_{0};
 };
 
 }  // namespace exec
@@ -0,0 +1,112 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "exec/operator/query-agg/HyperLogLog.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "common/EasyAssert.h"
+
+namespace milvus {
+namespace exec {
+
+namespace {
+constexpr uint8_t kSerializeVersion = 1;
+}  // namespace
+
+HyperLogLog::HyperLogLog(uint8_t precision) : precision_(precision) {
+    AssertInfo(precision >= kMinPrecision && precision <= kMaxPrecision,
+               "hyperloglog precision {} out of range [{}, {}]",
+               precision,
+               kMinPrecision,
+               kMaxPrecision);
+    registers_.assign(size_t(1) << precision_, 0);
+}
+
+void
+HyperLogLog::AddHash(uint64_t hash) {
+    auto index = hash >> (64 - precision_);
+    // the sentinel bit bounds the rank when the remaining bits are all zero
+    auto rest = (hash << precision_) | (uint64_t(1) << (precision_ - 1));
+    auto rank = static_cast<uint8_t>(__builtin_clzll(rest) + 1);
+    if (rank > registers_[index]) {
+        registers_[index] = rank;
+    }
+}
+
+void
+HyperLogLog::Merge(const HyperLogLog& other) {
+    AssertInfo(precision_ == other.precision_,
+               "cannot merge hyperloglog of precision {} into {}",
+               other.precision_,
+               precision_);
+    for (size_t i = 0; i < registers_.size(); i++) {
+        if (other.registers_[i] > registers_[i]) {
+            registers_[i] = other.registers_[i];
+        }
+    }
+}
+
+uint64_t
+HyperLogLog::Estimate() const {
+    const double m = static_cast<double>(registers_.size());
+    double sum = 0;
+    size_t zeros = 0;
+    for (auto r : registers_) {
+        sum += std::ldexp(1.0, -static_cast<int>(r));
+        zeros += r == 0;
+    }
+    const double alpha = 0.7213 / (1.0 + 1.079 / m);
+    double estimate = alpha * m * m / sum;
+    // linear counting is far more accurate while many registers are empty
+    if (estimate <= 2.5 * m && zeros > 0) {
+        estimate = m * std::log(m / static_cast<double>(zeros));
+    }
+    return static_cast<uint64_t>(std::llround(estimate));
+}
+
+std::string
+HyperLogLog::Serialize() const {
+    std::string out;
+    out.reserve(2 + registers_.size());
+    out.push_back(static_cast<char>(kSerializeVersion));
+    out.push_back(static_cast<char>(precision_));
+    out.append(reinterpret_cast<const char*>(registers_.data()),
+               registers_.size());
+    return out;
+}
+
+HyperLogLog
+HyperLogLog::Deserialize(const std::string& data) {
+    AssertInfo(data.size() >= 2, "hyperloglog state too short");
+    AssertInfo(static_cast<uint8_t>(data[0]) == kSerializeVersion,
+               "unknown hyperloglog state version {}",
+               static_cast<uint8_t>(data[0]));
+    HyperLogLog sketch(static_cast<uint8_t>(data[1]));
+    AssertInfo(data.size() == 2 + sketch.registers_.size(),
+               "hyperloglog state size {} mismatches precision {}",
+               data.size(),
+               sketch.precision_);
+    std::copy(data.begin() + 2,
+              data.end(),
+              reinterpret_cast<char*>(sketch.registers_.data()));
+    return sketch;
+}
+
+}  // namespace exec
+}  // namespace milvus
@@ -0,0 +1,66 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace milvus {
+namespace exec {
+
+// Dense HyperLogLog sketch estimating the number of distinct hashes added to
+// it. Sketches of the same precision merge losslessly, so per-segment
+// partial states can be combined by the reducer without re-reading rows.
+class HyperLogLog {
+ public:
+    static constexpr uint8_t kDefaultPrecision = 12;
+    static constexpr uint8_t kMinPrecision = 4;
+    static constexpr uint8_t kMaxPrecision = 18;
+
+    explicit HyperLogLog(uint8_t precision = kDefaultPrecision);
+
+    void
+    AddHash(uint64_t hash);
+
+    // other must have the same precision
+    void
+    Merge(const HyperLogLog& other);
+
+    uint64_t
+    Estimate() const;
+
+    uint8_t
+    precision() const {
+        return precision_;
+    }
+
+    // version byte, precision byte, then one byte per register
+    std::string
+    Serialize() const;
+
+    static HyperLogLog
+    Deserialize(const std::string& data);
+
+ private:
+    uint8_t precision_;
+    std::vector<uint8_t> registers_;
+};
+
+}  // namespace exec
+}  // namespace milvus
@@ -0,0 +1,272 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/operator/query-agg/PartialAggregateMerge.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "common/EasyAssert.h"
+#include "common/Utils.h"
+#include "exec/MorselDispatcher.h"
+#include "exec/QueryContext.h"
+#include "exec/VectorHasher.h"
+#include "exec/operator/query-agg/Aggregate.h"
+#include "exec/operator/query-agg/AggregateInfo.h"
+#include "exec/operator/query-agg/ApproxAggregates.h"
+#include "exec/operator/query-agg/GroupingSet.h"
+#include "exec/operator/query-agg/RowContainer.h"
+
+namespace milvus {
+namespace exec {
+
+namespace {
+
+// fewer groups per partition are not worth a thread of their own
+constexpr int64_t kMinRowsPerPartition = 4096;
+constexpr int32_t kMaxPartitionBits = 6;
+
+// The aggregate folding the partial states the segment-side aggregate
+// `name` emits as a column of `partial_type`.
+std::unique_ptr<Aggregate>
+CreateMergeAggregate(const std::string& name,
+                     DataType partial_type,
+                     const QueryConfig& config) {
+    if (name == KCount || name == KSum) {
+        return Aggregate::create(KSum, {partial_type}, config);
+    }
+    if (name == KMin || name == KMax) {
+        return Aggregate::create(name, {partial_type}, config);
+    }
+    if (name == KApproxCountDistinct) {
+        return std::make_unique<SketchMergeAggregate<HyperLogLog, false>>();
+    }
+    if (name == KApproxPercentile) {
+        return std::make_unique<SketchMergeAggregate<TDigest, true>>();
+    }
+    ThrowInfo(OpTypeInvalid,
+              "partial states of aggregate {} cannot be merged",
+              name);
+}
+
+class PartialMerger {
+ public:
+    explicit PartialMerger(const plan::AggregationNode& node)
+        : type_(node.output_type()), num_keys_(node.GroupingKeys().size()) {
+        for (const auto& aggregate : node.aggregates()) {
+            names_.push_back(aggregate.call_->fun_name());
+        }
+        for (size_t i = 0; i < type_->column_count(); i++) {
+            column_types_.push_back(type_->column_type(i));
+        }
+    }
+
+    bool
+    isGlobal() const {
+        return num_keys_ == 0;
+    }
+
+    // Types the staging rows of a partition can hold.
+    bool
+    canPartition() const {
+        return RowContainer::canSpill(column_types_);
+    }
+
+    std::unique_ptr<GroupingSet>
+    makeGroupingSet() const {
+        std::vector<std::unique_ptr<VectorHasher>> hashers;
+        for (size_t i = 0; i < num_keys_; i++) {
+            hashers.push_back(VectorHasher::create(column_types_[i], i));
+        }
+        std::vector<AggregateInfo> aggregates;
+        aggregates.reserve(names_.size());
+        for (size_t i = 0; i < names_.size(); i++) {
+            column_index_t column = num_keys_ + i;
+            AggregateInfo info;
+            info.function_ = CreateMergeAggregate(
+                names_[i], column_types_[column], config_);
+            info.input_column_idxes_ = {column};
+            info.output_ = column;
+            aggregates.push_back(std::move(info));
+        }
+        return std::make_unique<GroupingSet>(
+            type_, std::move(hashers), std::move(aggregates));
+    }
+
+    RowVectorPtr
+    output(GroupingSet& grouping_set) const {
+        auto result =
+            std::make_shared<RowVector>(type_, isGlobal() ? 1 : 0);
+        if (!grouping_set.getOutput(result)) {
+            return nullptr;
+        }
+        return result;
+    }
+
+    // The rows of `partial` by the top `partition_bits` bits of the hash of
+    // their keys.
+    std::vector<std::vector<vector_size_t>>
+    partition(const RowVectorPtr& partial, int32_t partition_bits) const {
+        std::vector<uint64_t> hashes(partial->size());
+        for (size_t i = 0; i < num_keys_; i++) {
+            VectorHasher hasher(column_types_[i], i);
+            hasher.setColumnData(columnOf(partial, i));
+            hasher.hash(i > 0, hashes);
+        }
+        std::vector<std::vector<vector_size_t>> rows(1 << partition_bits);
+        for (size_t row = 0; row < hashes.size(); row++) {
+            rows[hashes[row] >> (64 - partition_bits)].push_back(row);
+        }
+        return rows;
+    }
+
+    // Merges the rows of one partition, `rows[k]` of the k-th partial.
+    RowVectorPtr
+    mergePartition(const std::vector<RowVectorPtr>& partials,
+                   const std::vector<const std::vector<vector_size_t>*>& rows)
+        const {
+        auto grouping_set = makeGroupingSet();
+        RowContainer staging(column_types_, std::vector<Accumulator>{});
+        std::vector<char*> staged;
+        std::vector<ColumnVectorPtr> columns(column_types_.size());
+        for (size_t k = 0; k < partials.size(); k++) {
+            if (rows[k]->empty()) {
+                continue;
+            }
+            for (size_t i = 0; i < columns.size(); i++) {
+                columns[i] = columnOf(partials[k], i);
+            }
+            staged.reserve(rows[k]->size());
+            for (auto row : *rows[k]) {
+                char* staged_row = staging.newRow();
+                for (size_t i = 0; i < columns.size(); i++) {
+                    staging.store(columns[i], row, staged_row, i);
+                }
+                staged.push_back(staged_row);
+            }
+            std::vector<VectorPtr> input;
+            input.reserve(columns.size());
+            for (size_t i = 0; i < columns.size(); i++) {
+                input.push_back(staging.extractColumnVector(
+                    staged.data(), static_cast<int32_t>(staged.size()), i));
+            }
+            grouping_set->addInput(
+                std::make_shared<RowVector>(std::move(input)));
+            staging.clear();
+            staged.clear();
+        }
+        return output(*grouping_set);
+    }
+
+ private:
+    static ColumnVectorPtr
+    columnOf(const RowVectorPtr& partial, size_t i) {
+        auto column =
+            std::dynamic_pointer_cast<ColumnVector>(partial->child(i));
+        AssertInfo(column != nullptr,
+                   "partial aggregation column {} must be a column vector",
+                   i);
+        return column;
+    }
+
+    const RowTypePtr type_;
+    const size_t num_keys_;
+    std::vector<std::string> names_;
+    std::vector<DataType> column_types_;
+    QueryConfig config_;
+};
+
+}  // namespace
+
+std::vector<RowVectorPtr>
+MergePartialAggregates(const plan::AggregationNode& node,
+                       const std::vector<RowVectorPtr>& partials,
+                       int32_t parallelism,
+                       folly::CPUThreadPoolExecutor* executor) {
+    AssertInfo(!partials.empty(), "no partial aggregation to merge");
+    PartialMerger merger(node);
+    int64_t total_rows = 0;
+    for (const auto& partial : partials) {
+        total_rows += partial->size();
+    }
+
+    int32_t partition_bits = 0;
+    if (!merger.isGlobal() && merger.canPartition()) {
+        while (partition_bits < kMaxPartitionBits &&
+               (2 << partition_bits) <= parallelism &&
+               (total_rows >> (partition_bits + 1)) >= kMinRowsPerPartition) {
+            partition_bits++;
+        }
+    }
+    if (partition_bits == 0) {
+        auto grouping_set = merger.makeGroupingSet();
+        for (const auto& partial : partials) {
+            if (partial->size() > 0) {
+                grouping_set->addInput(partial);
+            }
+        }
+        auto result = merger.output(*grouping_set);
+        if (result == nullptr) {
+            return {};
+        }
+        return {result};
+    }
+
+    auto num_partials = static_cast<int64_t>(partials.size());
+    std::vector<std::vector<std::vector<vector_size_t>>> partitions(
+        num_partials);
+    MorselDispatcher::Run(
+        num_partials,
+        1,
+        parallelism,
+        executor,
+        [&]() -> MorselDispatcher::Worker {
+            return [&](int64_t begin, int64_t end) {
+                for (auto k = begin; k < end; k++) {
+                    partitions[k] =
+                        merger.partition(partials[k], partition_bits);
+                }
+            };
+        });
+
+    auto num_partitions = int64_t{1} << partition_bits;
+    std::vector<RowVectorPtr> merged(num_partitions);
+    MorselDispatcher::Run(
+        num_partitions,
+        1,
+        parallelism,
+        executor,
+        [&]() -> MorselDispatcher::Worker {
+            return [&](int64_t begin, int64_t end) {
+                std::vector<const std::vector<vector_size_t>*> rows(
+                    num_partials);
+                for (auto p = begin; p < end; p++) {
+                    for (int64_t k = 0; k < num_partials; k++) {
+                        rows[k] = &partitions[k][p];
+                    }
+                    merged[p] = merger.mergePartition(partials, rows);
+                }
+            };
+        });
+    merged.erase(std::remove(merged.begin(), merged.end(), nullptr),
+                 merged.end());
+    return merged;
+}
+
+}  // namespace exec
+}  // namespace milvus
@@ -0,0 +1,49 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <folly/executors/CPUThreadPoolExecutor.h>
+
+#include "common/Vector.h"
+#include "plan/PlanNode.h"
+
+namespace milvus {
+namespace exec {
+
+// Merges the outputs of `node` on several segments into one output of the
+// same layout, [grouping keys..., aggregates...], the rows of equal keys
+// folded together: counts and sums are summed, minimums and maximums kept
+// and approximate sketches merged. A node hands the merged partial to the
+// reducer instead of one partial per segment.
+//
+// Without grouping keys every partial holds the one row of a global
+// aggregation. Otherwise the rows are hash partitioned on their keys and up
+// to `parallelism` threads, the caller and helpers on `executor`, each
+// merge whole partitions into their own hash table. The merged groups come
+// back one RowVector per non-empty partition, no group in two of them, so
+// they only need to be concatenated.
+std::vector<RowVectorPtr>
+MergePartialAggregates(const plan::AggregationNode& node,
+                       const std::vector<RowVectorPtr>& partials,
+                       int32_t parallelism,
+                       folly::CPUThreadPoolExecutor* executor);
+
+}  // namespace exec
+}  // namespace milvus
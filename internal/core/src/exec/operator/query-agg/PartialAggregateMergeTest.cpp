@@ -0,0 +1,290 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <folly/executors/CPUThreadPoolExecutor.h>
+
+#include "common/Utils.h"
+#include "common/Vector.h"
+#include "exec/operator/query-agg/ApproxAggregates.h"
+#include "exec/operator/query-agg/CountAggregateBase.h"
+#include "exec/operator/query-agg/HyperLogLog.h"
+#include "exec/operator/query-agg/MaxAggregateBase.h"
+#include "exec/operator/query-agg/MinAggregateBase.h"
+#include "exec/operator/query-agg/PartialAggregateMerge.h"
+#include "exec/operator/query-agg/SumAggregateBase.h"
+#include "expr/ITypeExpr.h"
+#include "plan/PlanNode.h"
+
+using namespace milvus;
+using namespace milvus::exec;
+
+namespace {
+
+class PartialAggregateMergeTest : public ::testing::Test {
+ protected:
+    static void
+    SetUpTestSuite() {
+        registerCountAggregate();
+        registerSumAggregate();
+        registerMinAggregate();
+        registerMaxAggregate();
+    }
+
+    // count(*), sum(v), min(v) and max(v) of int64 v, grouped by int64 k
+    // unless `global`
+    static std::shared_ptr<plan::AggregationNode>
+    MakeNode(bool global) {
+        std::vector<expr::FieldAccessTypeExprPtr> keys;
+        if (!global) {
+            keys.push_back(std::make_shared<expr::FieldAccessTypeExpr>(
+                DataType::INT64, "k", FieldId(100)));
+        }
+        auto v = std::make_shared<expr::FieldAccessTypeExpr>(
+            DataType::INT64, "v", FieldId(101));
+        std::vector<std::string> names{KCount, KSum, KMin, KMax};
+        std::vector<plan::AggregationNode::Aggregate> aggregates;
+        for (const auto& name : names) {
+            std::vector<expr::TypedExprPtr> inputs;
+            if (name != KCount) {
+                inputs.push_back(v);
+            }
+            aggregates.emplace_back(std::make_shared<const expr::CallExpr>(
+                name, inputs, nullptr));
+            if (name != KCount) {
+                aggregates.back().rawInputTypes_.push_back(DataType::INT64);
+            }
+            aggregates.back().resultType_ = DataType::INT64;
+        }
+        return std::make_shared<plan::AggregationNode>(
+            "agg", std::move(keys), std::move(names), std::move(aggregates));
+    }
+
+    struct Group {
+        int64_t count = 0;
+        int64_t sum = 0;
+        int64_t min = 0;
+        int64_t max = 0;
+    };
+
+    // one partial row per group, in the layout of MakeNode
+    static RowVectorPtr
+    MakePartial(const std::map<int64_t, Group>& groups, bool global) {
+        std::vector<VectorPtr> columns;
+        auto add_column = [&](auto value_of) {
+            auto column =
+                std::make_shared<ColumnVector>(DataType::INT64, groups.size());
+            int i = 0;
+            for (const auto& [key, group] : groups) {
+                column->SetValueAt<int64_t>(i++, value_of(key, group));
+            }
+            columns.push_back(column);
+        };
+        if (!global) {
+            add_column([](int64_t key, const Group&) { return key; });
+        }
+        add_column([](int64_t, const Group& group) { return group.count; });
+        add_column([](int64_t, const Group& group) { return group.sum; });
+        add_column([](int64_t, const Group& group) { return group.min; });
+        add_column([](int64_t, const Group& group) { return group.max; });
+        return std::make_shared<RowVector>(std::move(columns));
+    }
+
+    static void
+    Fold(Group& into, const Group& group) {
+        if (into.count == 0) {
+            into = group;
+            return;
+        }
+        into.count += group.count;
+        into.sum += group.sum;
+        into.min = std::min(into.min, group.min);
+        into.max = std::max(into.max, group.max);
+    }
+
+    static std::map<int64_t, Group>
+    Collect(const std::vector<RowVectorPtr>& merged, bool global) {
+        std::map<int64_t, Group> groups;
+        auto values = [](const RowVectorPtr& rows, int column) {
+            return std::dynamic_pointer_cast<ColumnVector>(rows->child(column))
+                ->RawAsValues<int64_t>();
+        };
+        int first = global ? 0 : 1;
+        for (const auto& rows : merged) {
+            for (size_t i = 0; i < rows->size(); i++) {
+                auto key = global ? 0 : values(rows, 0)[i];
+                EXPECT_EQ(groups.count(key), 0) << "group " << key;
+                groups[key] = Group{values(rows, first)[i],
+                                    values(rows, first + 1)[i],
+                                    values(rows, first + 2)[i],
+                                    values(rows, first + 3)[i]};
+            }
+        }
+        return groups;
+    }
+
+    static void
+    ExpectGroups(const std::map<int64_t, Group>& actual,
+                 const std::map<int64_t, Group>& expected) {
+        ASSERT_EQ(actual.size(), expected.size());
+        for (const auto& [key, group] : expected) {
+            auto it = actual.find(key);
+            ASSERT_NE(it, actual.end()) << "group " << key;
+            EXPECT_EQ(it->second.count, group.count) << "group " << key;
+            EXPECT_EQ(it->second.sum, group.sum) << "group " << key;
+            EXPECT_EQ(it->second.min, group.min) << "group " << key;
+            EXPECT_EQ(it->second.max, group.max) << "group " << key;
+        }
+    }
+
+    // `segments` partials over overlapping key ranges and their merge
+    static std::tuple<std::vector<RowVectorPtr>, std::map<int64_t, Group>>
+    MakePartials(int segments, int64_t keys_per_segment) {
+        std::default_random_engine er(42);
+        std::uniform_int_distribution<int64_t> dist(-1000, 1000);
+        std::vector<RowVectorPtr> partials;
+        std::map<int64_t, Group> expected;
+        for (int s = 0; s < segments; s++) {
+            std::map<int64_t, Group> groups;
+            for (int64_t key = s * keys_per_segment / 2;
+                 key < s * keys_per_segment / 2 + keys_per_segment;
+                 key++) {
+                auto a = dist(er);
+                auto b = dist(er);
+                groups[key] =
+                    Group{2, a + b, std::min(a, b), std::max(a, b)};
+                Fold(expected[key], groups[key]);
+            }
+            partials.push_back(MakePartial(groups, false));
+        }
+        return {partials, expected};
+    }
+};
+
+}  // namespace
+
+TEST_F(PartialAggregateMergeTest, MergesGroupsOfEqualKeys) {
+    auto node = MakeNode(false);
+    auto [partials, expected] = MakePartials(3, 100);
+    auto merged = MergePartialAggregates(*node, partials, 1, nullptr);
+    ASSERT_EQ(merged.size(), 1);
+    ExpectGroups(Collect(merged, false), expected);
+}
+
+TEST_F(PartialAggregateMergeTest, ParallelMergeMatchesSerial) {
+    auto node = MakeNode(false);
+    auto [partials, expected] = MakePartials(8, 20000);
+    folly::CPUThreadPoolExecutor executor(4);
+    auto merged = MergePartialAggregates(*node, partials, 8, &executor);
+    // enough groups for several partitions, each merged on its own
+    EXPECT_GT(merged.size(), 1);
+    ExpectGroups(Collect(merged, false), expected);
+    ExpectGroups(
+        Collect(MergePartialAggregates(*node, partials, 1, nullptr), false),
+        expected);
+}
+
+TEST_F(PartialAggregateMergeTest, SkipsEmptyPartials) {
+    auto node = MakeNode(false);
+    std::vector<RowVectorPtr> partials{
+        MakePartial({}, false),
+        MakePartial({{7, Group{1, 5, 5, 5}}}, false),
+        MakePartial({}, false)};
+    auto merged = MergePartialAggregates(*node, partials, 4, nullptr);
+    ExpectGroups(Collect(merged, false), {{7, Group{1, 5, 5, 5}}});
+
+    partials = {MakePartial({}, false), MakePartial({}, false)};
+    EXPECT_TRUE(MergePartialAggregates(*node, partials, 4, nullptr).empty());
+}
+
+TEST_F(PartialAggregateMergeTest, MergesGlobalAggregation) {
+    auto node = MakeNode(true);
+    std::vector<RowVectorPtr> partials{
+        MakePartial({{0, Group{3, 6, 1, 3}}}, true),
+        MakePartial({{0, Group{2, -4, -5, 1}}}, true),
+        MakePartial({{0, Group{1, 9, 9, 9}}}, true)};
+    auto merged = MergePartialAggregates(*node, partials, 4, nullptr);
+    ExpectGroups(Collect(merged, true), {{0, Group{6, 11, -5, 9}}});
+}
+
+TEST_F(PartialAggregateMergeTest, MergesSketches) {
+    std::vector<expr::FieldAccessTypeExprPtr> keys{
+        std::make_shared<expr::FieldAccessTypeExpr>(
+            DataType::INT64, "k", FieldId(100))};
+    auto v = std::make_shared<expr::FieldAccessTypeExpr>(
+        DataType::INT64, "v", FieldId(101));
+    std::vector<plan::AggregationNode::Aggregate> aggregates;
+    aggregates.emplace_back(std::make_shared<const expr::CallExpr>(
+        KApproxCountDistinct, std::vector<expr::TypedExprPtr>{v}, nullptr));
+    aggregates.back().rawInputTypes_.push_back(DataType::INT64);
+    aggregates.back().resultType_ = DataType::VARCHAR;
+    auto node = std::make_shared<plan::AggregationNode>(
+        "agg",
+        std::move(keys),
+        std::vector<std::string>{KApproxCountDistinct},
+        std::move(aggregates));
+
+    // two segments that saw 0..999 and 500..1499 of the same group
+    std::vector<RowVectorPtr> partials;
+    for (int64_t begin : {0, 500}) {
+        HyperLogLog sketch;
+        for (int64_t value = begin; value < begin + 1000; value++) {
+            sketch.AddHash(HashForDistinct(value));
+        }
+        auto key = std::make_shared<ColumnVector>(DataType::INT64, 1);
+        key->SetValueAt<int64_t>(0, 1);
+        auto state = std::make_shared<ColumnVector>(DataType::VARCHAR, 1);
+        state->SetValueAt<std::string>(
+            0, EncodeSketchState(sketch.Serialize()));
+        partials.push_back(
+            std::make_shared<RowVector>(std::vector<VectorPtr>{key, state}));
+    }
+    auto merged = MergePartialAggregates(*node, partials, 1, nullptr);
+    ASSERT_EQ(merged.size(), 1);
+    ASSERT_EQ(merged[0]->size(), 1);
+    auto state = std::dynamic_pointer_cast<ColumnVector>(merged[0]->child(1));
+    auto estimate =
+        HyperLogLog::Deserialize(
+            DecodeSketchState(state->ValueAt<std::string>(0)))
+            .Estimate();
+    EXPECT_NEAR(static_cast<double>(estimate), 1500, 1500 * 0.05);
+}
+
+TEST_F(PartialAggregateMergeTest, RejectsUnmergeableAggregate) {
+    std::vector<plan::AggregationNode::Aggregate> aggregates;
+    aggregates.emplace_back(std::make_shared<const expr::CallExpr>(
+        "avg", std::vector<expr::TypedExprPtr>{}, nullptr));
+    aggregates.back().resultType_ = DataType::DOUBLE;
+    auto node = std::make_shared<plan::AggregationNode>(
+        "agg",
+        std::vector<expr::FieldAccessTypeExprPtr>{},
+        std::vector<std::string>{"avg"},
+        std::move(aggregates));
+    auto partial = std::make_shared<RowVector>(std::vector<VectorPtr>{
+        std::make_shared<ColumnVector>(DataType::DOUBLE, 1)});
+    EXPECT_ANY_THROW(MergePartialAggregates(
+        *node, std::vector<RowVectorPtr>{partial}, 1, nullptr));
+}
@@ -85,6 +85,21 @@ RowContainer::initializeRow(char* row) {
     return row;
 }
 
+void
+RowContainer::resetRow(char* row) {
+    AssertInfo(accumulators_.empty(), "Rows with accumulators cannot be reset");
+    for (auto i = 0; i < variable_offsets_.size(); i++) {
+        const auto& row_col = columnAt(variable_idxes_[i]);
+        auto* str =
+            *reinterpret_cast<std::string**>(row + variable_offsets_[i]);
+        if (!isNullAt(row, row_col.nullByte(), row_col.nullMask()) && str) {
+            variableBytes_ -= sizeof(std::string) + str->size();
+            delete str;
+        }
+    }
+    initializeRow(row);
+}
+
 char*
 RowContainer::newRow() {
     char* row = new char[fixedRowSize_];
@@ -113,6 +128,83 @@ RowContainer::store(const milvus::ColumnVectorPtr& column_data,
                                  rowColumn.nullMask());
 }
 
+bool
+RowContainer::canSpill(const std::vector<DataType>& keyTypes) {
+    for (auto type : keyTypes) {
+        switch (type) {
+            case DataType::BOOL:
+            case DataType::INT8:
+            case DataType::INT16:
+            case DataType::INT32:
+            case DataType::INT64:
+            case DataType::TIMESTAMPTZ:
+            case DataType::FLOAT:
+            case DataType::DOUBLE:
+            case DataType::VARCHAR:
+            case DataType::STRING:
+                break;
+            default:
+                return false;
+        }
+    }
+    return true;
+}
+
+void
+RowContainer::serializeRow(const char* row, std::string& out) const {
+    AssertInfo(accumulators_.empty(),
+               "Rows with accumulators cannot be serialized");
+    for (size_t i = 0; i < keyTypes_.size(); ++i) {
+        const auto& column = rowColumns_[i];
+        const bool isNull = isNullAt(row, column.nullByte(), column.nullMask());
+        out.push_back(static_cast<char>(isNull));
+        if (isNull) {
+            continue;
+        }
+        const auto type = keyTypes_[i];
+        if (type == DataType::VARCHAR || type == DataType::STRING) {
+            const std::string* str = strAt(row, column.offset());
+            const auto size = static_cast<uint32_t>(str ? str->size() : 0);
+            out.append(reinterpret_cast<const char*>(&size), sizeof(size));
+            if (size > 0) {
+                out.append(str->data(), size);
+            }
+        } else {
+            out.append(row + column.offset(), GetDataTypeSize(type, 1));
+        }
+    }
+}
+
+char*
+RowContainer::deserializeRow(const char*& in) {
+    AssertInfo(accumulators_.empty(),
+               "Rows with accumulators cannot be deserialized");
+    char* row = newRow();
+    for (size_t i = 0; i < keyTypes_.size(); ++i) {
+        const auto& column = rowColumns_[i];
+        if (*in++ != 0) {
+            // null strings stay a nullptr, clear() skips null keys
+            row[column.nullByte()] |= column.nullMask();
+            continue;
+        }
+        const auto type = keyTypes_[i];
+        if (type == DataType::VARCHAR || type == DataType::STRING) {
+            uint32_t size;
+            std::memcpy(&size, in, sizeof(size));
+            in += sizeof(size);
+            auto* str = new std::string(in, size);
+            in += size;
+            *reinterpret_cast<std::string**>(row + column.offset()) = str;
+            variableBytes_ += sizeof(std::string) + size;
+        } else {
+            const auto size = GetDataTypeSize(type, 1);
+            std::memcpy(row + column.offset(), in, size);
+            in += size;
+        }
+    }
+    return row;
+}
+
 Accumulator::Accumulator(bool isFixedSize, int32_t fixedSize, int32_t alignment)
     : isFixedSize_(isFixedSize), fixedSize_(fixedSize), alignment_(alignment) {
 }
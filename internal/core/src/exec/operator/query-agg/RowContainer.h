@@ -251,8 +251,10 @@ class RowContainer {
             if constexpr (std::is_same_v<T, std::string>) {
                 // the string object and also the underlying char array are both allocated on the heap
                 // must call clear method to deallocate these memory allocated for varchar type to avoid memory leak
-                *reinterpret_cast<std::string**>(group + offset) =
+                auto* str =
                     new std::string(*static_cast<std::string*>(raw_val_ptr));
+                *reinterpret_cast<std::string**>(group + offset) = str;
+                variableBytes_ += sizeof(std::string) + str->size();
             } else {
                 *reinterpret_cast<T*>(group + offset) =
                     *(static_cast<T*>(raw_val_ptr));
@@ -438,6 +440,29 @@ class RowContainer {
         return rows_;
     }
 
+    /// Bytes held by the rows: the fixed width part plus the heap copies of
+    /// string keys. Used to decide when an operator spills.
+    int64_t
+    estimatedBytes() const {
+        return static_cast<int64_t>(rows_.size()) * fixedRowSize_ +
+               variableBytes_;
+    }
+
+    /// Whether rows of 'keyTypes' can be serialized by serializeRow().
+    static bool
+    canSpill(const std::vector<DataType>& keyTypes);
+
+    /// Appends the keys of 'row' to 'out': per key a null byte followed by
+    /// the value if not null, strings prefixed by a uint32_t length. Only
+    /// for containers without accumulators.
+    void
+    serializeRow(const char* row, std::string& out) const;
+
+    /// Reads a row written by serializeRow() from 'in' into a new row and
+    /// advances 'in' past it.
+    char*
+    deserializeRow(const char*& in);
+
     static inline int32_t
     nullByte(int32_t nullOffset) {
         return nullOffset / 8;
@@ -467,11 +492,18 @@ class RowContainer {
         }
         rows_.clear();
         numRows_ = 0;
+        variableBytes_ = 0;
     }
 
     char*
     initializeRow(char* row);
 
+    /// Frees the strings of 'row', one of the rows of this container, and
+    /// zeroes it, so it can be stored into again. Only for containers
+    /// without accumulators.
+    void
+    resetRow(char* row);
+
  private:
     const std::vector<DataType> keyTypes_;
     std::vector<int> variable_offsets_{};
@@ -488,6 +520,7 @@ class RowContainer {
     int alignment_ = 1;
     std::vector<Accumulator> accumulators_;
     uint64_t numRows_ = 0;
+    int64_t variableBytes_ = 0;
     std::vector<char*> rows_{};
 };
 
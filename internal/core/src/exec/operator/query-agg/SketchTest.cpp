@@ -0,0 +1,125 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "exec/operator/query-agg/ApproxAggregates.h"
+#include "exec/operator/query-agg/HyperLogLog.h"
+#include "exec/operator/query-agg/TDigest.h"
+
+using namespace milvus::exec;
+
+TEST(HyperLogLogTest, EstimateWithinError) {
+    for (int64_t n : {0, 10, 1000, 100000}) {
+        HyperLogLog sketch;
+        for (int64_t i = 0; i < n; i++) {
+            // duplicates must not be counted twice
+            sketch.AddHash(HashForDistinct(i));
+            sketch.AddHash(HashForDistinct(i));
+        }
+        auto estimate = static_cast<double>(sketch.Estimate());
+        EXPECT_NEAR(estimate, n, std::max(1.0, n * 0.05)) << "n=" << n;
+    }
+}
+
+TEST(HyperLogLogTest, MergeAndSerialize) {
+    HyperLogLog left;
+    HyperLogLog right;
+    for (int64_t i = 0; i < 60000; i++) {
+        left.AddHash(HashForDistinct(i));
+    }
+    for (int64_t i = 40000; i < 100000; i++) {
+        right.AddHash(HashForDistinct(std::to_string(i)));
+        right.AddHash(HashForDistinct(static_cast<int32_t>(i)));
+    }
+    auto restored = HyperLogLog::Deserialize(right.Serialize());
+    EXPECT_EQ(restored.Estimate(), right.Estimate());
+    left.Merge(restored);
+    // 100000 numbers plus 60000 strings
+    EXPECT_NEAR(static_cast<double>(left.Estimate()), 160000, 8000);
+
+    EXPECT_ANY_THROW(HyperLogLog::Deserialize(std::string("\x01", 1)));
+    EXPECT_ANY_THROW(left.Merge(HyperLogLog(10)));
+}
+
+TEST(HyperLogLogTest, CanonicalNumberHash) {
+    EXPECT_EQ(HashForDistinct(int8_t(7)), HashForDistinct(int64_t(7)));
+    EXPECT_EQ(HashForDistinct(1.5f), HashForDistinct(1.5));
+    EXPECT_EQ(HashForDistinct(-0.0), HashForDistinct(0.0));
+}
+
+TEST(TDigestTest, QuantileAccuracy) {
+    TDigest digest;
+    EXPECT_TRUE(std::isnan(digest.Quantile(0.5)));
+
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<double> dist(0, 1000);
+    std::vector<double> values(100000);
+    for (auto& v : values) {
+        v = dist(rng);
+        digest.Add(v);
+    }
+    std::sort(values.begin(), values.end());
+    EXPECT_EQ(digest.TotalWeight(), values.size());
+    for (double q : {0.0, 0.01, 0.25, 0.5, 0.75, 0.99, 1.0}) {
+        auto exact = values[std::min<size_t>(q * values.size(),
+                                             values.size() - 1)];
+        EXPECT_NEAR(digest.Quantile(q), exact, 5) << "q=" << q;
+    }
+}
+
+TEST(TDigestTest, MergeAndSerialize) {
+    TDigest low;
+    TDigest high;
+    for (int i = 0; i < 50000; i++) {
+        low.Add(i);
+        high.Add(50000 + i);
+    }
+    auto restored = TDigest::Deserialize(high.Serialize());
+    EXPECT_EQ(restored.TotalWeight(), high.TotalWeight());
+    EXPECT_NEAR(restored.Quantile(0.5), high.Quantile(0.5), 1e-6);
+
+    low.Merge(restored);
+    EXPECT_EQ(low.TotalWeight(), 100000);
+    EXPECT_NEAR(low.Quantile(0.5), 50000, 200);
+    EXPECT_NEAR(low.Quantile(0.99), 99000, 200);
+    EXPECT_EQ(low.Quantile(0), 0);
+    EXPECT_EQ(low.Quantile(1), 99999);
+
+    EXPECT_ANY_THROW(TDigest::Deserialize(std::string("\x01", 1)));
+}
+
+TEST(SketchStateTest, HexRoundTrip) {
+    HyperLogLog sketch;
+    for (int64_t i = 0; i < 1000; i++) {
+        sketch.AddHash(HashForDistinct(i));
+    }
+    auto binary = sketch.Serialize();
+    auto state = EncodeSketchState(binary);
+    EXPECT_EQ(state.size(), binary.size() * 2);
+    EXPECT_EQ(state.substr(0, 4), "010c");
+    EXPECT_EQ(DecodeSketchState(state), binary);
+
+    EXPECT_ANY_THROW(DecodeSketchState("0"));
+    EXPECT_ANY_THROW(DecodeSketchState("0g"));
+}
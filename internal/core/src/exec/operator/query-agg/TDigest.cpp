@@ -0,0 +1,210 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "exec/operator/query-agg/TDigest.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#include "common/EasyAssert.h"
+
+namespace milvus {
+namespace exec {
+
+namespace {
+constexpr uint8_t kSerializeVersion = 1;
+
+template <typename T>
+void
+AppendRaw(std::string& out, T value) {
+    out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+T
+ReadRaw(const std::string& data, size_t& pos) {
+    AssertInfo(pos + sizeof(T) <= data.size(), "t-digest state truncated");
+    T value;
+    std::memcpy(&value, data.data() + pos, sizeof(T));
+    pos += sizeof(T);
+    return value;
+}
+}  // namespace
+
+TDigest::TDigest(double compression)
+    : compression_(compression),
+      min_(std::numeric_limits<double>::infinity()),
+      max_(-std::numeric_limits<double>::infinity()) {
+    AssertInfo(compression_ >= 10,
+               "t-digest compression {} is too small",
+               compression_);
+}
+
+void
+TDigest::Add(double value, double weight) {
+    if (std::isnan(value) || weight <= 0) {
+        return;
+    }
+    buffer_.push_back({value, weight});
+    buffer_weight_ += weight;
+    min_ = std::min(min_, value);
+    max_ = std::max(max_, value);
+    if (buffer_.size() >= static_cast<size_t>(compression_ * 5)) {
+        Compress();
+    }
+}
+
+void
+TDigest::Merge(const TDigest& other) {
+    for (const auto& c : other.centroids_) {
+        buffer_.push_back(c);
+        buffer_weight_ += c.weight;
+    }
+    for (const auto& c : other.buffer_) {
+        buffer_.push_back(c);
+        buffer_weight_ += c.weight;
+    }
+    min_ = std::min(min_, other.min_);
+    max_ = std::max(max_, other.max_);
+    Compress();
+}
+
+void
+TDigest::Compress() {
+    if (buffer_.empty()) {
+        return;
+    }
+    buffer_.insert(buffer_.end(), centroids_.begin(), centroids_.end());
+    std::sort(buffer_.begin(),
+              buffer_.end(),
+              [](const Centroid& a, const Centroid& b) {
+                  return a.mean < b.mean;
+              });
+    total_weight_ += buffer_weight_;
+    centroids_.clear();
+
+    // a cluster may grow while its weight stays under 4 * N * q * (1 - q) /
+    // compression, q being the quantile at its center
+    double before = 0;
+    Centroid current = buffer_.front();
+    for (size_t i = 1; i < buffer_.size(); i++) {
+        const auto& next = buffer_[i];
+        auto merged = current.weight + next.weight;
+        auto q = (before + merged / 2) / total_weight_;
+        auto limit = 4 * total_weight_ * q * (1 - q) / compression_;
+        if (merged <= limit) {
+            current.mean += (next.mean - current.mean) * next.weight / merged;
+            current.weight = merged;
+        } else {
+            before += current.weight;
+            centroids_.push_back(current);
+            current = next;
+        }
+    }
+    centroids_.push_back(current);
+    buffer_.clear();
+    buffer_weight_ = 0;
+}
+
+double
+TDigest::Quantile(double q) const {
+    if (!buffer_.empty()) {
+        auto compressed = *this;
+        compressed.Compress();
+        return compressed.Quantile(q);
+    }
+    if (centroids_.empty()) {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+    q = std::clamp(q, 0.0, 1.0);
+    if (centroids_.size() == 1) {
+        return centroids_.front().mean;
+    }
+    auto target = q * total_weight_;
+    // each centroid sits at the center of the weight it covers, values are
+    // interpolated between neighbouring centers and the observed extremes
+    auto first_center = centroids_.front().weight / 2;
+    if (target <= first_center) {
+        auto frac = first_center > 0 ? target / first_center : 0;
+        return min_ + (centroids_.front().mean - min_) * frac;
+    }
+    double cumulative = 0;
+    for (size_t i = 0; i + 1 < centroids_.size(); i++) {
+        const auto& left = centroids_[i];
+        const auto& right = centroids_[i + 1];
+        auto left_center = cumulative + left.weight / 2;
+        auto right_center = cumulative + left.weight + right.weight / 2;
+        if (target <= right_center) {
+            auto frac = (target - left_center) / (right_center - left_center);
+            return left.mean + (right.mean - left.mean) * frac;
+        }
+        cumulative += left.weight;
+    }
+    const auto& last = centroids_.back();
+    auto last_center = total_weight_ - last.weight / 2;
+    auto frac = (target - last_center) / (last.weight / 2);
+    return last.mean + (max_ - last.mean) * std::min(frac, 1.0);
+}
+
+std::string
+TDigest::Serialize() const {
+    auto compressed = *this;
+    compressed.Compress();
+    std::string out;
+    out.reserve(1 + sizeof(double) * 3 + sizeof(uint32_t) +
+                compressed.centroids_.size() * sizeof(double) * 2);
+    out.push_back(static_cast<char>(kSerializeVersion));
+    AppendRaw(out, compressed.compression_);
+    AppendRaw(out, compressed.min_);
+    AppendRaw(out, compressed.max_);
+    AppendRaw(out, static_cast<uint32_t>(compressed.centroids_.size()));
+    for (const auto& c : compressed.centroids_) {
+        AppendRaw(out, c.mean);
+        AppendRaw(out, c.weight);
+    }
+    return out;
+}
+
+TDigest
+TDigest::Deserialize(const std::string& data) {
+    AssertInfo(!data.empty(), "t-digest state is empty");
+    AssertInfo(static_cast<uint8_t>(data[0]) == kSerializeVersion,
+               "unknown t-digest state version {}",
+               static_cast<uint8_t>(data[0]));
+    size_t pos = 1;
+    TDigest digest(ReadRaw<double>(data, pos));
+    digest.min_ = ReadRaw<double>(data, pos);
+    digest.max_ = ReadRaw<double>(data, pos);
+    auto count = ReadRaw<uint32_t>(data, pos);
+    AssertInfo(data.size() == pos + count * sizeof(double) * 2,
+               "t-digest state size {} mismatches {} centroids",
+               data.size(),
+               count);
+    digest.centroids_.reserve(count);
+    for (uint32_t i = 0; i < count; i++) {
+        auto mean = ReadRaw<double>(data, pos);
+        auto weight = ReadRaw<double>(data, pos);
+        digest.centroids_.push_back({mean, weight});
+        digest.total_weight_ += weight;
+    }
+    return digest;
+}
+
+}  // namespace exec
+}  // namespace milvus
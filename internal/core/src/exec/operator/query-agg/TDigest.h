@@ -0,0 +1,79 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace milvus {
+namespace exec {
+
+// Merging t-digest approximating the distribution of the values added to
+// it, with centroids kept small near the tails so extreme quantiles stay
+// accurate. Digests merge by re-clustering their centroids.
+class TDigest {
+ public:
+    static constexpr double kDefaultCompression = 100;
+
+    explicit TDigest(double compression = kDefaultCompression);
+
+    void
+    Add(double value, double weight = 1);
+
+    void
+    Merge(const TDigest& other);
+
+    // NaN when nothing was added, q is clamped to [0, 1]
+    double
+    Quantile(double q) const;
+
+    double
+    TotalWeight() const {
+        return total_weight_ + buffer_weight_;
+    }
+
+    // version byte, compression, min, max, centroid count, then the
+    // centroids as mean/weight pairs
+    std::string
+    Serialize() const;
+
+    static TDigest
+    Deserialize(const std::string& data);
+
+ private:
+    struct Centroid {
+        double mean;
+        double weight;
+    };
+
+    // folds the buffered values into the centroids
+    void
+    Compress();
+
+    double compression_;
+    std::vector<Centroid> centroids_;
+    double total_weight_{0};
+    std::vector<Centroid> buffer_;
+    double buffer_weight_{0};
+    double min_;
+    double max_;
+};
+
+}  // namespace exec
+}  // namespace milvus
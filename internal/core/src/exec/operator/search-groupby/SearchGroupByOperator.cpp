@@ -17,6 +17,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <limits>
 #include <tuple>
 #include <utility>
 #include <variant>
@@ -32,28 +33,103 @@ namespace exec {
 
 namespace {
 
+template <typename Key>
 struct GroupedResult {
     int64_t row_offset;
     int32_t element_index;
     float distance;
-    CompositeGroupKey group_key;
+    Key group_key;
 };
 
+// The value ID of `value` in a normalized key, 0 for null.
+template <typename T>
+uint64_t
+NormalizedValueId(const std::optional<T>& value) {
+    if (!value.has_value()) {
+        return 0;
+    }
+    if constexpr (std::is_same_v<T, bool>) {
+        return value.value() ? 2 : 1;
+    } else {
+        return static_cast<uint64_t>(static_cast<int64_t>(value.value()) -
+                                     std::numeric_limits<T>::min()) +
+               1;
+    }
+}
+
+template <typename T>
+GroupByValueType
+DecodeValueId(uint64_t id) {
+    if (id == 0) {
+        return std::nullopt;
+    }
+    if constexpr (std::is_same_v<T, bool>) {
+        return id == 2;
+    } else {
+        return static_cast<T>(static_cast<int64_t>(id - 1) +
+                              std::numeric_limits<T>::min());
+    }
+}
+
+// The most candidates an iterator is read ahead of grouping them, so that the
+// group-by values of a batch are fetched together.
+constexpr int64_t kGroupByBatchSize = 64;
+
 }  // namespace
 
+template <typename T>
+static FieldBatchGetter
+WrapFieldGetter(std::shared_ptr<DataGetter<T>> getter) {
+    return [getter](
+               const int64_t* offsets, int64_t count, GroupByValueType* out) {
+        std::vector<std::optional<T>> values(count);
+        getter->BulkGet(offsets, count, values.data());
+        for (int64_t i = 0; i < count; i++) {
+            out[i] = std::move(values[i]);
+        }
+    };
+}
+
+template <typename T>
+static NormalizedBatchGetter
+WrapNormalizedGetter(std::shared_ptr<DataGetter<T>> getter,
+                     int32_t key_bits) {
+    return [getter, key_bits](
+               const int64_t* offsets, int64_t count, uint64_t* out) {
+        std::vector<std::optional<T>> values(count);
+        getter->BulkGet(offsets, count, values.data());
+        for (int64_t i = 0; i < count; i++) {
+            out[i] = (out[i] << key_bits) | NormalizedValueId(values[i]);
+        }
+    };
+}
+
 // Helper to create a single-field getter that returns GroupByValueType
 template <typename T, typename InnerRawType = T>
-static std::function<GroupByValueType(int64_t)>
+static FieldBatchGetter
 CreateFieldGetter(milvus::OpContext* op_ctx,
                   const segcore::SegmentInternalInterface& segment,
                   FieldId field_id,
                   std::optional<std::string> json_path = std::nullopt,
                   std::optional<DataType> json_type = std::nullopt,
                   bool strict_cast = false) {
-    auto getter = GetDataGetter<T, InnerRawType>(
-        op_ctx, segment, field_id, json_path, json_type, strict_cast);
-    return
-        [getter](int64_t idx) -> GroupByValueType { return getter->Get(idx); };
+    return WrapFieldGetter(GetDataGetter<T, InnerRawType>(
+        op_ctx, segment, field_id, json_path, json_type, strict_cast));
+}
+
+// Helper to create the getters of a field that has normalized keys
+template <typename T>
+static void
+CreateNormalizedFieldGetters(milvus::OpContext* op_ctx,
+                             const segcore::SegmentInternalInterface& segment,
+                             FieldId field_id,
+                             DataType data_type,
+                             FieldBatchGetter& getter,
+                             NormalizedBatchGetter& normalized_getter) {
+    auto typed_getter = GetDataGetter<T>(op_ctx, segment, field_id);
+    getter = WrapFieldGetter(typed_getter);
+    normalized_getter = WrapNormalizedGetter(
+        typed_getter, VectorHasher::normalizedKeyBits(data_type));
 }
 
 MultiFieldDataGetter::MultiFieldDataGetter(
@@ -65,27 +141,51 @@ MultiFieldDataGetter::MultiFieldDataGetter(
     bool strict_cast)
     : field_count_(field_ids.size()) {
     getters_.reserve(field_ids.size());
+    std::vector<NormalizedBatchGetter> normalized_getters;
+    std::vector<DataType> normalized_types;
+    int32_t normalized_key_bits = 0;
 
     for (const auto& field_id : field_ids) {
         auto data_type = segment.GetFieldDataType(field_id);
-        std::function<GroupByValueType(int64_t)> getter;
+        FieldBatchGetter getter;
+        NormalizedBatchGetter normalized_getter;
 
         switch (data_type) {
             case DataType::INT8:
-                getter = CreateFieldGetter<int8_t>(op_ctx, segment, field_id);
+                CreateNormalizedFieldGetters<int8_t>(op_ctx,
+                                                     segment,
+                                                     field_id,
+                                                     data_type,
+                                                     getter,
+                                                     normalized_getter);
                 break;
             case DataType::INT16:
-                getter = CreateFieldGetter<int16_t>(op_ctx, segment, field_id);
+                CreateNormalizedFieldGetters<int16_t>(op_ctx,
+                                                      segment,
+                                                      field_id,
+                                                      data_type,
+                                                      getter,
+                                                      normalized_getter);
                 break;
             case DataType::INT32:
-                getter = CreateFieldGetter<int32_t>(op_ctx, segment, field_id);
+                CreateNormalizedFieldGetters<int32_t>(op_ctx,
+                                                      segment,
+                                                      field_id,
+                                                      data_type,
+                                                      getter,
+                                                      normalized_getter);
                 break;
             case DataType::INT64:
             case DataType::TIMESTAMPTZ:
                 getter = CreateFieldGetter<int64_t>(op_ctx, segment, field_id);
                 break;
             case DataType::BOOL:
-                getter = CreateFieldGetter<bool>(op_ctx, segment, field_id);
+                CreateNormalizedFieldGetters<bool>(op_ctx,
+                                                   segment,
+                                                   field_id,
+                                                   data_type,
+                                                   getter,
+                                                   normalized_getter);
                 break;
             case DataType::VARCHAR:
                 getter =
@@ -172,6 +272,16 @@ MultiFieldDataGetter::MultiFieldDataGetter(
                               data_type));
         }
         getters_.push_back(std::move(getter));
+        if (normalized_getter) {
+            normalized_key_bits += VectorHasher::normalizedKeyBits(data_type);
+            normalized_getters.push_back(std::move(normalized_getter));
+            normalized_types.push_back(data_type);
+        }
+    }
+    if (normalized_getters.size() == field_ids.size() &&
+        normalized_key_bits <= 64) {
+        normalized_getters_ = std::move(normalized_getters);
+        normalized_types_ = std::move(normalized_types);
     }
 }
 
@@ -187,13 +297,80 @@ MultiFieldDataGetter::GetInto(int64_t idx, CompositeGroupKey& out) const {
     out.Clear();
     out.Reserve(field_count_);
     for (const auto& getter : getters_) {
-        out.Add(getter(idx));
+        GroupByValueType value;
+        getter(&idx, 1, &value);
+        out.Add(std::move(value));
+    }
+}
+
+void
+MultiFieldDataGetter::GetBatch(const int64_t* offsets,
+                               int64_t count,
+                               std::vector<CompositeGroupKey>& out) const {
+    out.resize(count);
+    for (auto& key : out) {
+        key.Clear();
+        key.Reserve(field_count_);
+    }
+    column_.resize(count);
+    for (const auto& getter : getters_) {
+        getter(offsets, count, column_.data());
+        for (int64_t i = 0; i < count; i++) {
+            out[i].Add(std::move(column_[i]));
+        }
+    }
+}
+
+void
+MultiFieldDataGetter::GetNormalizedBatch(const int64_t* offsets,
+                                         int64_t count,
+                                         std::vector<uint64_t>& out) const {
+    AssertInfo(HasNormalizedKeys(), "group by fields have no normalized keys");
+    out.assign(count, 0);
+    for (const auto& getter : normalized_getters_) {
+        getter(offsets, count, out.data());
+    }
+}
+
+CompositeGroupKey
+MultiFieldDataGetter::DecodeNormalizedKey(uint64_t key) const {
+    folly::small_vector<GroupByValueType, 4> values(normalized_types_.size());
+    for (size_t i = normalized_types_.size(); i-- > 0;) {
+        auto key_bits = VectorHasher::normalizedKeyBits(normalized_types_[i]);
+        auto id = key & ((uint64_t(1) << key_bits) - 1);
+        key >>= key_bits;
+        switch (normalized_types_[i]) {
+            case DataType::BOOL:
+                values[i] = DecodeValueId<bool>(id);
+                break;
+            case DataType::INT8:
+                values[i] = DecodeValueId<int8_t>(id);
+                break;
+            case DataType::INT16:
+                values[i] = DecodeValueId<int16_t>(id);
+                break;
+            case DataType::INT32:
+                values[i] = DecodeValueId<int32_t>(id);
+                break;
+            default:
+                ThrowInfo(UnexpectedError,
+                          "data type {} has no normalized key",
+                          normalized_types_[i]);
+        }
+    }
+    CompositeGroupKey group_key(values.size());
+    for (auto& value : values) {
+        group_key.Add(std::move(value));
     }
+    return group_key;
 }
 
 // Internal helper: iterate a single iterator and collect grouped results.
 // All tunables (topk / group_size / strict_group_size / metric_type) are
 // read from `search_info` — don't duplicate them as separate parameters.
+// Rows are grouped by CompositeGroupKeys, or by the normalized keys of
+// `data_getter` when Key is uint64_t.
+template <typename Key, typename KeyHash>
 static void
 GroupIteratorResult(const std::shared_ptr<VectorIterator>& iterator,
                     const std::shared_ptr<MultiFieldDataGetter>& data_getter,
@@ -202,10 +379,12 @@ GroupIteratorResult(const std::shared_ptr<VectorIterator>& iterator,
                     std::vector<float>& distances,
                     const SearchInfo& search_info,
                     std::vector<int32_t>* element_indices) {
-    // 1. Create group map for composite keys
-    CompositeGroupByMap groupMap(search_info.topk_,
-                                 search_info.group_size_,
-                                 search_info.strict_group_size_);
+    constexpr bool normalized = std::is_same_v<Key, uint64_t>;
+    // 1. Create group map for the group keys
+    GroupByMap<Key, KeyHash> groupMap(search_info.topk_,
+                                      search_info.group_size_,
+                                      search_info.strict_group_size_,
+                                      search_info.metric_type_);
 
     auto is_element_id = search_info.element_level();
     AssertInfo(element_indices == nullptr || is_element_id,
@@ -214,35 +393,71 @@ GroupIteratorResult(const std::shared_ptr<VectorIterator>& iterator,
     //2. do iteration until fill the whole map or run out of all data
     //note it may enumerate all data inside a segment and can block following
     //query and search possibly
-    std::vector<GroupedResult> res;
-    CompositeGroupKey scratch_key;
+    std::vector<GroupedResult<Key>> res;
+    std::vector<int64_t> batch_offsets;
+    std::vector<int32_t> batch_element_indices;
+    std::vector<float> batch_distances;
+    std::vector<Key> batch_keys;
     while (iterator->HasNext() && !groupMap.IsGroupResEnough()) {
-        auto offset_dis_pair = iterator->Next();
-        AssertInfo(offset_dis_pair.has_value(),
-                   "Wrong state! iterator cannot return valid result whereas "
-                   "it still tells hasNext");
-        auto raw_offset = offset_dis_pair.value().first;
-        auto dis = offset_dis_pair.value().second;
-
-        // For element-level search, the offset is the element_id, we need to convert it to the row_id.
-        int64_t row_offset = raw_offset;
-        int32_t element_index = -1;
-        if (is_element_id) {
-            AssertInfo(search_info.array_offsets_ != nullptr,
-                       "Array offsets not available for element-level search");
-            auto [doc_id, elem_idx] =
-                search_info.array_offsets_->ElementIDToRowID(
-                    static_cast<int32_t>(raw_offset));
-            row_offset = doc_id;
-            element_index = elem_idx;
+        // a batch never holds more candidates than the map needs to fill
+        // up, so the iterator is not read past the one that fills it
+        auto batch_size =
+            std::min(kGroupByBatchSize, groupMap.MinPushesToEnough());
+        batch_offsets.clear();
+        batch_element_indices.clear();
+        batch_distances.clear();
+        while (static_cast<int64_t>(batch_offsets.size()) < batch_size &&
+               iterator->HasNext()) {
+            auto offset_dis_pair = iterator->Next();
+            AssertInfo(offset_dis_pair.has_value(),
+                       "Wrong state! iterator cannot return valid result "
+                       "whereas it still tells hasNext");
+            auto raw_offset = offset_dis_pair.value().first;
+
+            // For element-level search, the offset is the element_id, we
+            // need to convert it to the row_id.
+            int64_t row_offset = raw_offset;
+            int32_t element_index = -1;
+            if (is_element_id) {
+                AssertInfo(
+                    search_info.array_offsets_ != nullptr,
+                    "Array offsets not available for element-level search");
+                auto [doc_id, elem_idx] =
+                    search_info.array_offsets_->ElementIDToRowID(
+                        static_cast<int32_t>(raw_offset));
+                row_offset = doc_id;
+                element_index = elem_idx;
+            }
+            batch_offsets.push_back(row_offset);
+            batch_element_indices.push_back(element_index);
+            batch_distances.push_back(offset_dis_pair.value().second);
         }
 
-        data_getter->GetInto(row_offset, scratch_key);
-        if (groupMap.Push(scratch_key)) {
-            // Safe to move: next iteration's GetInto() will Clear+Reserve+Add
-            // on the moved-from small_vector, which is guaranteed empty-inline.
-            res.emplace_back(GroupedResult{
-                row_offset, element_index, dis, std::move(scratch_key)});
+        if constexpr (normalized) {
+            data_getter->GetNormalizedBatch(
+                batch_offsets.data(), batch_offsets.size(), batch_keys);
+        } else {
+            data_getter->GetBatch(
+                batch_offsets.data(), batch_offsets.size(), batch_keys);
+        }
+        for (size_t i = 0; i < batch_offsets.size(); i++) {
+            auto next_slot = static_cast<int64_t>(res.size());
+            auto slot =
+                groupMap.Push(batch_keys[i], batch_distances[i], next_slot);
+            if (slot < 0) {
+                continue;
+            }
+            // Safe to move: the next GetBatch() will Clear+Reserve+Add on
+            // the moved-from small_vector, which is guaranteed empty-inline.
+            GroupedResult<Key> result{batch_offsets[i],
+                                      batch_element_indices[i],
+                                      batch_distances[i],
+                                      std::move(batch_keys[i])};
+            if (slot == next_slot) {
+                res.push_back(std::move(result));
+            } else {
+                res[slot] = std::move(result);
+            }
         }
     }
 
@@ -260,7 +475,12 @@ GroupIteratorResult(const std::shared_ptr<VectorIterator>& iterator,
         if (element_indices != nullptr) {
             element_indices->emplace_back(iter->element_index);
         }
-        composite_group_by_values.emplace_back(std::move(iter->group_key));
+        if constexpr (normalized) {
+            composite_group_by_values.emplace_back(
+                data_getter->DecodeNormalizedKey(iter->group_key));
+        } else {
+            composite_group_by_values.emplace_back(std::move(iter->group_key));
+        }
     }
 }
 
@@ -300,13 +520,26 @@ SearchGroupBy(milvus::OpContext* op_ctx,
 
     topk_per_nq_prefix_sum.push_back(0);
     for (const auto& iterator : iterators) {
-        GroupIteratorResult(iterator,
-                            data_getter,
-                            composite_group_by_values,
-                            seg_offsets,
-                            distances,
-                            search_info,
-                            element_indices);
+        if (data_getter->HasNormalizedKeys()) {
+            GroupIteratorResult<uint64_t,
+                                ankerl::unordered_dense::hash<uint64_t>>(
+                iterator,
+                data_getter,
+                composite_group_by_values,
+                seg_offsets,
+                distances,
+                search_info,
+                element_indices);
+        } else {
+            GroupIteratorResult<CompositeGroupKey, CompositeGroupKeyHash>(
+                iterator,
+                data_getter,
+                composite_group_by_values,
+                seg_offsets,
+                distances,
+                search_info,
+                element_indices);
+        }
         topk_per_nq_prefix_sum.push_back(seg_offsets.size());
     }
 }
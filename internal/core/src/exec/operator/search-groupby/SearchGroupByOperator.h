@@ -18,9 +18,11 @@
 
 #include <simdjson.h>
 #include <stdint.h>
+#include <algorithm>
 #include <cstddef>
 #include <functional>
 #include <memory>
+#include <numeric>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -29,6 +31,7 @@
 #include <utility>
 #include <vector>
 
+#include "ankerl/unordered_dense.h"
 #include "cachinglayer/CacheSlot.h"
 #include "common/EasyAssert.h"
 #include "common/Json.h"
@@ -37,7 +40,10 @@
 #include "common/QueryInfo.h"
 #include "common/QueryResult.h"
 #include "common/Types.h"
+#include "common/Utils.h"
 #include "common/protobuf_utils.h"
+#include "exec/VectorHasher.h"
+#include "folly/small_vector.h"
 #include "index/Index.h"
 #include "index/ScalarIndex.h"
 #include "knowhere/comp/index_param.h"
@@ -113,6 +119,16 @@ class DataGetter {
     virtual std::optional<T>
     Get(int64_t idx) const = 0;
 
+    // Reads the values of `count` rows into out[0, count).
+    virtual void
+    BulkGet(const int64_t* offsets,
+            int64_t count,
+            std::optional<T>* out) const {
+        for (int64_t i = 0; i < count; i++) {
+            out[i] = Get(offsets[i]);
+        }
+    }
+
  protected:
     std::optional<std::string> json_path_;
     bool specific_json_type_ = false;
@@ -298,6 +314,50 @@ class SealedDataGetter : public DataGetter<OutputType> {
             return raw.value();
         }
     }
+
+    void
+    BulkGet(const int64_t* offsets,
+            int64_t count,
+            std::optional<OutputType>* out) const override {
+        if constexpr (std::is_same_v<InnerRawType, std::string> ||
+                      std::is_same_v<InnerRawType, milvus::Json>) {
+            // string and json chunk views are already pinned once per chunk
+            DataGetter<OutputType>::BulkGet(offsets, count, out);
+        } else {
+            if (!from_data_) {
+                DataGetter<OutputType>::BulkGet(offsets, count, out);
+                return;
+            }
+            // visit the rows in offset order, the spans of all the chunks
+            // they touch are pinned in one call and every row is read
+            // straight from its span
+            std::vector<int64_t> positions(count);
+            std::iota(positions.begin(), positions.end(), 0);
+            std::sort(positions.begin(),
+                      positions.end(),
+                      [offsets](int64_t a, int64_t b) {
+                          return offsets[a] < offsets[b];
+                      });
+            std::vector<int64_t> sorted_offsets(count);
+            for (int64_t i = 0; i < count; i++) {
+                sorted_offsets[i] = offsets[positions[i]];
+            }
+            auto pw = segment_.chunk_spans(
+                op_ctx_, field_id_, sorted_offsets.data(), count);
+            for (const auto& run : pw.get()) {
+                auto data = static_cast<const InnerRawType*>(run.span.data());
+                auto valid_data = run.span.valid_data();
+                for (auto i = run.begin; i < run.end; i++) {
+                    auto inner_offset = sorted_offsets[i] - run.rows_before;
+                    if (valid_data && !valid_data[inner_offset]) {
+                        out[positions[i]] = std::nullopt;
+                    } else {
+                        out[positions[i]] = data[inner_offset];
+                    }
+                }
+            }
+        }
+    }
 };
 
 template <typename OutputType, typename InnerRawType = OutputType>
@@ -337,23 +397,38 @@ GetDataGetter(milvus::OpContext* op_ctx,
     }
 }
 
-// GroupByMap for CompositeGroupKey
-struct CompositeGroupByMap {
+// GroupByMap for the group keys of MultiFieldDataGetter. Every group keeps its
+// closest rows in a small heap, so a row an approximately ordered iterator
+// yields late still displaces a farther row of its group once the group is
+// full.
+template <typename Key, typename KeyHash>
+struct GroupByMap {
  private:
-    std::unordered_map<CompositeGroupKey, int, CompositeGroupKeyHash>
-        group_map_{};
+    // (distance, result slot) of the rows of a group, the farthest on top
+    using GroupRows = folly::small_vector<std::pair<float, int64_t>, 4>;
+
+    ankerl::unordered_dense::map<Key, GroupRows, KeyHash> group_map_{};
     int group_capacity_{0};
     int group_size_{0};
     int enough_group_count_{0};
+    int64_t row_count_{0};
     bool strict_group_size_{false};
+    bool larger_is_closer_{false};
+
+    bool
+    Closer(float lhs, float rhs) const {
+        return larger_is_closer_ ? lhs > rhs : lhs < rhs;
+    }
 
  public:
-    CompositeGroupByMap(int group_capacity,
-                        int group_size,
-                        bool strict_group_size = false)
+    GroupByMap(int group_capacity,
+               int group_size,
+               bool strict_group_size = false,
+               const MetricType& metric_type = MetricType())
         : group_capacity_(group_capacity),
           group_size_(group_size),
-          strict_group_size_(strict_group_size) {
+          strict_group_size_(strict_group_size),
+          larger_is_closer_(PositivelyRelated(metric_type)) {
         if (group_capacity > 0) {
             group_map_.reserve(static_cast<size_t>(group_capacity));
         }
@@ -371,23 +446,51 @@ struct CompositeGroupByMap {
         return enough;
     }
 
-    bool
-    Push(const CompositeGroupKey& key) {
-        auto [it, inserted] = group_map_.try_emplace(key, 0);
+    // The fewest rows that have to be pushed before IsGroupResEnough() can
+    // hold, at least one.
+    int64_t
+    MinPushesToEnough() const {
+        int64_t pushes =
+            strict_group_size_
+                ? static_cast<int64_t>(group_capacity_) * group_size_ -
+                      row_count_
+                : group_capacity_ - static_cast<int64_t>(group_map_.size());
+        return std::max<int64_t>(pushes, 1);
+    }
+
+    // Offers a row at `distance` to the group of `key`. Returns `next_slot`
+    // when the row takes a new result slot, the slot of the farther row of
+    // its group it displaces, or -1 when the row is dropped.
+    int64_t
+    Push(const Key& key, float distance, int64_t next_slot) {
+        auto [it, inserted] = group_map_.try_emplace(key);
         if (inserted) {
             if (static_cast<int>(group_map_.size()) > group_capacity_) {
                 group_map_.erase(it);
-                return false;
+                return -1;
             }
         }
-        if (it->second >= group_size_) {
-            return false;
+        auto closer = [this](const auto& lhs, const auto& rhs) {
+            return Closer(lhs.first, rhs.first);
+        };
+        auto& rows = it->second;
+        if (static_cast<int>(rows.size()) < group_size_) {
+            rows.emplace_back(distance, next_slot);
+            std::push_heap(rows.begin(), rows.end(), closer);
+            row_count_ += 1;
+            if (static_cast<int>(rows.size()) >= group_size_) {
+                enough_group_count_ += 1;
+            }
+            return next_slot;
         }
-        it->second += 1;
-        if (it->second >= group_size_) {
-            enough_group_count_ += 1;
+        if (rows.empty() || !Closer(distance, rows.front().first)) {
+            return -1;
         }
-        return true;
+        std::pop_heap(rows.begin(), rows.end(), closer);
+        auto slot = rows.back().second;
+        rows.back() = {distance, slot};
+        std::push_heap(rows.begin(), rows.end(), closer);
+        return slot;
     }
 
     int
@@ -401,6 +504,20 @@ struct CompositeGroupByMap {
     }
 };
 
+using CompositeGroupByMap =
+    GroupByMap<CompositeGroupKey, CompositeGroupKeyHash>;
+using NormalizedGroupByMap =
+    GroupByMap<uint64_t, ankerl::unordered_dense::hash<uint64_t>>;
+
+// Reads the group-by values of `count` rows of one field into out[0, count).
+using FieldBatchGetter =
+    std::function<void(const int64_t*, int64_t, GroupByValueType*)>;
+
+// Packs the value IDs of `count` rows of one field into the low bits of
+// out[0, count), after shifting the IDs of the fields before.
+using NormalizedBatchGetter =
+    std::function<void(const int64_t*, int64_t, uint64_t*)>;
+
 // Multi-field DataGetter that reads multiple fields and builds CompositeGroupKey
 class MultiFieldDataGetter {
  public:
@@ -418,9 +535,36 @@ class MultiFieldDataGetter {
     void
     GetInto(int64_t idx, CompositeGroupKey& out) const;
 
+    // Builds the keys of `count` rows into out[0, count), reading the rows
+    // of one field at a time.
+    void
+    GetBatch(const int64_t* offsets,
+             int64_t count,
+             std::vector<CompositeGroupKey>& out) const;
+
+    // Whether the value IDs of all the fields, see
+    // VectorHasher::normalizedKeyBits, pack into one 64-bit key. Equal keys
+    // then stand for equal CompositeGroupKeys, and grouping compares plain
+    // integers without building a CompositeGroupKey per row.
+    bool
+    HasNormalizedKeys() const {
+        return !normalized_getters_.empty();
+    }
+
+    void
+    GetNormalizedBatch(const int64_t* offsets,
+                       int64_t count,
+                       std::vector<uint64_t>& out) const;
+
+    CompositeGroupKey
+    DecodeNormalizedKey(uint64_t key) const;
+
  private:
-    std::vector<std::function<GroupByValueType(int64_t)>> getters_;
+    std::vector<FieldBatchGetter> getters_;
     size_t field_count_;
+    mutable std::vector<GroupByValueType> column_;
+    std::vector<NormalizedBatchGetter> normalized_getters_;
+    std::vector<DataType> normalized_types_;
 };
 
 // Unified group by interface - always emits CompositeGroupKey
@@ -484,6 +484,24 @@ class AlwaysTrueExpr : public ITypeFilterExpr {
     }
 };
 
+// the rows not expired by entity ttl at physical_us_, evaluated from the ttl
+// index of a sealed segment instead of the ttl column
+class EntityTTLFilterExpr : public ITypeFilterExpr {
+ public:
+    EntityTTLFilterExpr(const ColumnInfo& column, int64_t physical_us)
+        : ITypeFilterExpr(), column_(column), physical_us_(physical_us) {
+    }
+
+    std::string
+    ToString() const override {
+        return "{EntityTTL Expression - Column: " + column_.ToString() +
+               ", PhysicalUs: " + std::to_string(physical_us_) + "}";
+    }
+
+    const ColumnInfo column_;
+    const int64_t physical_us_;
+};
+
 class ExistsExpr : public ITypeFilterExpr {
  public:
     explicit ExistsExpr(const ColumnInfo& column)
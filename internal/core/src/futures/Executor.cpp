@@ -11,23 +11,190 @@
 
 #include <algorithm>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include "Executor.h"
+#include "common/Numa.h"
 #include "folly/executors/CPUThreadPoolExecutor.h"
 #include "folly/executors/thread_factory/NamedThreadFactory.h"
+#include "monitor/jemalloc_stats_c.h"
 #include "storage/ThreadPool.h"
 
 namespace milvus::futures {
 
 const int kNumPriority = 3;
 
+namespace {
+
+// Threads allocate from the jemalloc arena of `arena_pool` when arenas per
+// pool are enabled.
+class ArenaThreadFactory : public folly::NamedThreadFactory {
+ public:
+    ArenaThreadFactory(const std::string& prefix, JemallocArenaPool arena_pool)
+        : folly::NamedThreadFactory(prefix), arena_pool_(arena_pool) {
+    }
+
+    std::thread
+    newThread(folly::Func&& func) override {
+        return folly::NamedThreadFactory::newThread(
+            [arena_pool = arena_pool_, func = std::move(func)]() mutable {
+                BindThreadToJemallocArena(arena_pool);
+                func();
+            });
+    }
+
+ private:
+    JemallocArenaPool arena_pool_;
+};
+
+// Threads of the executor of one NUMA node only run on the node's cores.
+class NumaThreadFactory : public folly::NamedThreadFactory {
+ public:
+    NumaThreadFactory(const std::string& prefix,
+                      std::vector<int> cpus,
+                      JemallocArenaPool arena_pool)
+        : folly::NamedThreadFactory(prefix),
+          cpus_(std::move(cpus)),
+          arena_pool_(arena_pool) {
+    }
+
+    std::thread
+    newThread(folly::Func&& func) override {
+        return folly::NamedThreadFactory::newThread(
+            [cpus = cpus_,
+             arena_pool = arena_pool_,
+             func = std::move(func)]() mutable {
+                BindCurrentThread(cpus);
+                BindThreadToJemallocArena(arena_pool);
+                func();
+            });
+    }
+
+ private:
+    std::vector<int> cpus_;
+    JemallocArenaPool arena_pool_;
+};
+
+// One executor per NUMA node, created on first use with the threads of
+// `global` spread over them.
+class NumaExecutors {
+ public:
+    NumaExecutors(const std::string& prefix,
+                  folly::CPUThreadPoolExecutor* global,
+                  JemallocArenaPool arena_pool) {
+        auto& topology = NumaTopology::Get();
+        auto thread_num = static_cast<int>(global->numThreads());
+        for (size_t node = 0; node < topology.NumNodes(); node++) {
+            executors_.push_back(std::make_unique<folly::CPUThreadPoolExecutor>(
+                NodeThreadNum(thread_num, node),
+                folly::CPUThreadPoolExecutor::makeDefaultPriorityQueue(
+                    kNumPriority),
+                std::make_shared<NumaThreadFactory>(
+                    prefix + std::to_string(node) + "_",
+                    topology.NodeCpus(node),
+                    arena_pool)));
+        }
+    }
+
+    folly::CPUThreadPoolExecutor*
+    Get(int node) {
+        return executors_.at(node).get();
+    }
+
+    void
+    SetNumThreads(int thread_num) {
+        for (size_t node = 0; node < executors_.size(); node++) {
+            executors_[node]->setNumThreads(NodeThreadNum(thread_num, node));
+        }
+    }
+
+ private:
+    // the share of `thread_num` of the `node`-th node, by its cores
+    static int
+    NodeThreadNum(int thread_num, size_t node) {
+        auto& topology = NumaTopology::Get();
+        size_t total_cpus = 0;
+        for (size_t i = 0; i < topology.NumNodes(); i++) {
+            total_cpus += topology.NodeCpus(i).size();
+        }
+        auto share = static_cast<size_t>(std::max(1, thread_num)) *
+                     topology.NodeCpus(node).size() /
+                     std::max<size_t>(1, total_cpus);
+        return std::max(1, static_cast<int>(share));
+    }
+
+    std::vector<std::unique_ptr<folly::CPUThreadPoolExecutor>> executors_;
+};
+
+NumaExecutors&
+getNumaSearchExecutors() {
+    static NumaExecutors executors(
+        "MILVUS_SEARCH_N", getSearchCPUExecutor(), JEMALLOC_ARENA_SEARCH);
+    return executors;
+}
+
+NumaExecutors&
+getNumaLoadExecutors() {
+    static NumaExecutors executors(
+        "MILVUS_LOAD_N", getLoadCPUExecutor(), JEMALLOC_ARENA_LOAD);
+    return executors;
+}
+
+// Search executors set up by name for the collections isolated from the
+// global one.
+class NamedSearchExecutors {
+ public:
+    folly::CPUThreadPoolExecutor*
+    Get(const std::string& name) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = executors_.find(name);
+        return it == executors_.end() ? nullptr : it->second.get();
+    }
+
+    void
+    SetNumThreads(const std::string& name, int thread_num) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto& executor = executors_[name];
+        if (executor == nullptr) {
+            executor = std::make_unique<folly::CPUThreadPoolExecutor>(
+                thread_num,
+                folly::CPUThreadPoolExecutor::makeDefaultPriorityQueue(
+                    kNumPriority),
+                std::make_shared<ArenaThreadFactory>(
+                    "MILVUS_SEARCH_" + name + "_", JEMALLOC_ARENA_SEARCH));
+            return;
+        }
+        executor->setNumThreads(thread_num);
+    }
+
+ private:
+    std::mutex mutex_;
+    std::unordered_map<std::string,
+                       std::unique_ptr<folly::CPUThreadPoolExecutor>>
+        executors_;
+};
+
+NamedSearchExecutors&
+getNamedSearchExecutors() {
+    static NamedSearchExecutors executors;
+    return executors;
+}
+
+}  // namespace
+
 folly::CPUThreadPoolExecutor*
 getSearchCPUExecutor() {
     auto thread_num = std::max(1, milvus::CPU_NUM);
     static folly::CPUThreadPoolExecutor executor(
         thread_num,
         folly::CPUThreadPoolExecutor::makeDefaultPriorityQueue(kNumPriority),
-        std::make_shared<folly::NamedThreadFactory>("MILVUS_SEARCH_"));
+        std::make_shared<ArenaThreadFactory>("MILVUS_SEARCH_",
+                                             JEMALLOC_ARENA_SEARCH));
     return &executor;
 }
 
@@ -37,10 +204,51 @@ getLoadCPUExecutor() {
     static folly::CPUThreadPoolExecutor executor(
         thread_num,
         folly::CPUThreadPoolExecutor::makeDefaultPriorityQueue(kNumPriority),
-        std::make_shared<folly::NamedThreadFactory>("MILVUS_LOAD_"));
+        std::make_shared<ArenaThreadFactory>("MILVUS_LOAD_",
+                                             JEMALLOC_ARENA_LOAD));
     return &executor;
 }
 
+folly::CPUThreadPoolExecutor*
+getSearchCPUExecutor(int numa_node) {
+    if (numa_node < 0) {
+        return getSearchCPUExecutor();
+    }
+    return getNumaSearchExecutors().Get(numa_node);
+}
+
+folly::CPUThreadPoolExecutor*
+getLoadCPUExecutor(int numa_node) {
+    if (numa_node < 0) {
+        return getLoadCPUExecutor();
+    }
+    return getNumaLoadExecutors().Get(numa_node);
+}
+
+void
+setNumaSearchThreadNum(int thread_num) {
+    if (NumaTopology::Get().HomesSegments()) {
+        getNumaSearchExecutors().SetNumThreads(thread_num);
+    }
+}
+
+void
+setNumaLoadThreadNum(int thread_num) {
+    if (NumaTopology::Get().HomesSegments()) {
+        getNumaLoadExecutors().SetNumThreads(thread_num);
+    }
+}
+
+folly::CPUThreadPoolExecutor*
+getNamedSearchCPUExecutor(const std::string& name) {
+    return getNamedSearchExecutors().Get(name);
+}
+
+void
+setNamedSearchThreadNum(const std::string& name, int thread_num) {
+    getNamedSearchExecutors().SetNumThreads(name, std::max(1, thread_num));
+}
+
 folly::CPUThreadPoolExecutor*
 getGlobalCPUExecutor() {
     return getSearchCPUExecutor();
@@ -12,6 +12,7 @@
 #pragma once
 
 #include <memory>
+#include <string>
 #include <folly/executors/CPUThreadPoolExecutor.h>
 #include <folly/executors/task_queue/PriorityLifoSemMPMCQueue.h>
 #include <folly/system/HardwareConcurrency.h>
@@ -33,4 +34,31 @@ getSearchCPUExecutor();
 folly::CPUThreadPoolExecutor*
 getLoadCPUExecutor();
 
+// The executors whose threads only run on the cores of the `numa_node`-th
+// NUMA node, see NumaTopology::HomeNode. A node of -1 gives the global
+// executor.
+folly::CPUThreadPoolExecutor*
+getSearchCPUExecutor(int numa_node);
+
+folly::CPUThreadPoolExecutor*
+getLoadCPUExecutor(int numa_node);
+
+// Spread `thread_num` threads over the node executors by the cores of each
+// node. Nothing to do while segments are not homed on nodes.
+void
+setNumaSearchThreadNum(int thread_num);
+
+void
+setNumaLoadThreadNum(int thread_num);
+
+// The search executor `name` the collections pinned to it search on, see
+// Collection::set_search_pool, nullptr if no such executor was set up.
+folly::CPUThreadPoolExecutor*
+getNamedSearchCPUExecutor(const std::string& name);
+
+// Creates the search executor `name` with `thread_num` threads, or resizes
+// it. Named executors live as long as the process.
+void
+setNamedSearchThreadNum(const std::string& name, int thread_num);
+
 };  // namespace milvus::futures
@@ -27,6 +27,7 @@
 
 #include "common/EasyAssert.h"
 #include "common/common_type_c.h"
+#include "futures/Executor.h"
 #include "futures/Future.h"
 #include "futures/LeakyResult.h"
 #include "futures/Ready.h"
@@ -225,4 +226,33 @@ TEST(Futures, Future) {
         ASSERT_EQ(s.error_code, milvus::FollyCancel);
         free((char*)(s.error_msg));
     }
-}
\ No newline at end of file
+}
+TEST(Futures, NamedSearchExecutor) {
+    EXPECT_EQ(getNamedSearchCPUExecutor("latency_critical"), nullptr);
+
+    setNamedSearchThreadNum("latency_critical", 2);
+    auto executor = getNamedSearchCPUExecutor("latency_critical");
+    ASSERT_NE(executor, nullptr);
+    EXPECT_NE(executor, getSearchCPUExecutor());
+    EXPECT_EQ(executor->numThreads(), 2);
+
+    // resizes the executor in place, pointers handed out stay valid
+    setNamedSearchThreadNum("latency_critical", 3);
+    EXPECT_EQ(getNamedSearchCPUExecutor("latency_critical"), executor);
+    EXPECT_EQ(executor->numThreads(), 3);
+
+    auto future = milvus::futures::Future<int>::async(
+        executor, 0, [](folly::CancellationToken token) {
+            return new int(1);
+        });
+    std::mutex mu;
+    mu.lock();
+    future->registerReadyCallback(
+        [](CLockedGoMutex* mutex) { ((std::mutex*)(mutex))->unlock(); },
+        (CLockedGoMutex*)(&mu));
+    mu.lock();
+    auto [r, s] = future->leakyGet();
+    ASSERT_EQ(s.error_code, 0);
+    ASSERT_EQ(*static_cast<int*>(r), 1);
+    delete static_cast<int*>(r);
+}
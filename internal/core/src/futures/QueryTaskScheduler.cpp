@@ -0,0 +1,196 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include "futures/QueryTaskScheduler.h"
+
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <memory>
+#include <utility>
+
+#include <folly/ScopeGuard.h>
+
+namespace milvus::futures {
+
+namespace {
+
+// What the futures of one query run on. It lives as long as the futures
+// keep it alive.
+class QueryExecutor : public folly::Executor {
+ public:
+    QueryExecutor(QueryTaskScheduler* scheduler,
+                  folly::Executor* executor,
+                  int64_t query_id,
+                  int64_t deadline_us)
+        : scheduler_(scheduler),
+          executor_(executor),
+          query_id_(query_id),
+          deadline_us_(deadline_us) {
+    }
+
+    void
+    add(folly::Func func) override {
+        addWithPriority(std::move(func), folly::Executor::MID_PRI);
+    }
+
+    void
+    addWithPriority(folly::Func func, int8_t priority) override {
+        scheduler_->Add(query_id_, deadline_us_, priority, std::move(func));
+    }
+
+    uint8_t
+    getNumPriorities() const override {
+        return executor_->getNumPriorities();
+    }
+
+ protected:
+    bool
+    keepAliveAcquire() noexcept override {
+        refs_.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    void
+    keepAliveRelease() noexcept override {
+        if (refs_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            delete this;
+        }
+    }
+
+ private:
+    QueryTaskScheduler* scheduler_;
+    folly::Executor* executor_;
+    const int64_t query_id_;
+    const int64_t deadline_us_;
+    std::atomic<int64_t> refs_{0};
+};
+
+}  // namespace
+
+QueryTaskScheduler&
+QueryTaskScheduler::ForExecutor(folly::CPUThreadPoolExecutor* executor) {
+    // one per search executor, never destroyed as the executors are not
+    static std::mutex mutex;
+    static std::unordered_map<folly::Executor*,
+                              std::unique_ptr<QueryTaskScheduler>>
+        schedulers;
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& scheduler = schedulers[executor];
+    if (scheduler == nullptr) {
+        scheduler = std::make_unique<QueryTaskScheduler>(executor);
+    }
+    return *scheduler;
+}
+
+folly::Executor::KeepAlive<>
+QueryTaskScheduler::GetExecutor(int64_t query_id, int64_t deadline_us) {
+    return folly::getKeepAliveToken(
+        new QueryExecutor(this, executor_, query_id, deadline_us));
+}
+
+void
+QueryTaskScheduler::Add(int64_t query_id,
+                        int64_t deadline_us,
+                        int8_t priority,
+                        folly::Func func) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto [it, inserted] = queries_.try_emplace(query_id);
+        auto& query = it->second;
+        if (inserted) {
+            query.seq = next_seq_++;
+        }
+        if (deadline_us > 0 &&
+            (query.deadline_us == 0 || deadline_us < query.deadline_us)) {
+            query.deadline_us = deadline_us;
+        }
+        query.tasks.push_back(std::move(func));
+        pending_++;
+    }
+    executor_->addWithPriority([this]() { RunNext(); }, priority);
+}
+
+size_t
+QueryTaskScheduler::Pending() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return pending_;
+}
+
+int64_t
+QueryTaskScheduler::NowUs() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::system_clock::now().time_since_epoch())
+        .count();
+}
+
+bool
+QueryTaskScheduler::RunsBefore(const Query& a,
+                               const Query& b,
+                               int64_t now_us) {
+    auto a_expired = a.deadline_us > 0 && a.deadline_us <= now_us;
+    auto b_expired = b.deadline_us > 0 && b.deadline_us <= now_us;
+    if (a_expired != b_expired) {
+        return a_expired;
+    }
+    if (a.started != b.started) {
+        return a.started < b.started;
+    }
+    constexpr auto kNoDeadline = std::numeric_limits<int64_t>::max();
+    auto a_deadline = a.deadline_us > 0 ? a.deadline_us : kNoDeadline;
+    auto b_deadline = b.deadline_us > 0 ? b.deadline_us : kNoDeadline;
+    if (a_deadline != b_deadline) {
+        return a_deadline < b_deadline;
+    }
+    return a.seq < b.seq;
+}
+
+void
+QueryTaskScheduler::RunNext() {
+    folly::Func func;
+    int64_t query_id = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto now_us = NowUs();
+        auto next = queries_.end();
+        for (auto it = queries_.begin(); it != queries_.end(); ++it) {
+            if (it->second.tasks.empty()) {
+                continue;
+            }
+            if (next == queries_.end() ||
+                RunsBefore(it->second, next->second, now_us)) {
+                next = it;
+            }
+        }
+        // every wakeup is queued with its task
+        if (next == queries_.end()) {
+            return;
+        }
+        auto& query = next->second;
+        func = std::move(query.tasks.front());
+        query.tasks.pop_front();
+        query.started++;
+        query.running++;
+        query_id = next->first;
+        pending_--;
+    }
+
+    auto finish = folly::makeGuard([this, query_id]() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = queries_.find(query_id);
+        if (--it->second.running == 0 && it->second.tasks.empty()) {
+            queries_.erase(it);
+        }
+    });
+    func();
+}
+
+}  // namespace milvus::futures
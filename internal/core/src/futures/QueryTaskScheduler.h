@@ -0,0 +1,94 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
+#include <folly/Executor.h>
+#include <folly/executors/CPUThreadPoolExecutor.h>
+
+namespace milvus::futures {
+
+// Shares a search executor between the queries running on it.
+//
+// The executor alone runs segment tasks in submission order, so a query
+// fanning out to hundreds of segments holds back every query submitted
+// after it. Here every task submitted for a query only queues a wakeup on
+// the executor, and the wakeup picks which task runs when it gets a thread:
+//   1. a task whose query deadline already passed, so it is abandoned at
+//      once instead of holding its request until a thread frees up;
+//   2. else the next task of the query that has started the fewest tasks,
+//      so a small query runs its few tasks between those of a large one;
+//   3. ties go to the query with the earliest deadline, then to the one
+//      submitted first.
+// Tasks of one query run in submission order. A query is forgotten once it
+// has no task queued or running.
+//
+// Thread safety: All methods are thread-safe.
+class QueryTaskScheduler {
+ public:
+    explicit QueryTaskScheduler(folly::Executor* executor)
+        : executor_(executor) {
+    }
+
+    // The scheduler in front of `executor`, created on first use.
+    static QueryTaskScheduler&
+    ForExecutor(folly::CPUThreadPoolExecutor* executor);
+
+    // An executor queuing what is added to it as tasks of `query_id`.
+    // `deadline_us` is the query deadline in microseconds since the unix
+    // epoch, 0 if it has none.
+    folly::Executor::KeepAlive<>
+    GetExecutor(int64_t query_id, int64_t deadline_us);
+
+    void
+    Add(int64_t query_id,
+        int64_t deadline_us,
+        int8_t priority,
+        folly::Func func);
+
+    // Tasks queued and not started yet.
+    size_t
+    Pending() const;
+
+    // Microseconds since the unix epoch, the clock of the deadlines.
+    static int64_t
+    NowUs();
+
+ private:
+    struct Query {
+        std::deque<folly::Func> tasks;
+        int64_t deadline_us{0};
+        int64_t started{0};
+        int64_t running{0};
+        // the order queries were first submitted in
+        uint64_t seq{0};
+    };
+
+    // Runs the task picked by the ordering above.
+    void
+    RunNext();
+
+    static bool
+    RunsBefore(const Query& a, const Query& b, int64_t now_us);
+
+    folly::Executor* executor_;
+    mutable std::mutex mutex_;
+    std::unordered_map<int64_t, Query> queries_;
+    uint64_t next_seq_{0};
+    size_t pending_{0};
+};
+
+}  // namespace milvus::futures
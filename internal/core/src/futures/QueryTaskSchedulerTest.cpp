@@ -0,0 +1,94 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <folly/executors/CPUThreadPoolExecutor.h>
+#include <folly/futures/Future.h>
+#include <gtest/gtest.h>
+#include <future>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "futures/QueryTaskScheduler.h"
+
+using milvus::futures::QueryTaskScheduler;
+
+class QueryTaskSchedulerTest : public testing::Test {
+ protected:
+    // keeps the only thread of the executor busy until Release()
+    void
+    Hold() {
+        executor_.add([future = released_.get_future()]() mutable {
+            future.wait();
+        });
+    }
+
+    void
+    Release() {
+        released_.set_value();
+        executor_.join();
+    }
+
+    void
+    Add(int64_t query_id, int64_t deadline_us, std::string name) {
+        scheduler_.Add(
+            query_id, deadline_us, 0, [this, name = std::move(name)]() {
+                std::lock_guard<std::mutex> lock(mutex_);
+                order_.push_back(name);
+            });
+    }
+
+    folly::CPUThreadPoolExecutor executor_{1};
+    QueryTaskScheduler scheduler_{&executor_};
+    std::promise<void> released_;
+    std::mutex mutex_;
+    std::vector<std::string> order_;
+};
+
+TEST_F(QueryTaskSchedulerTest, InterleavesQueries) {
+    Hold();
+    for (int i = 0; i < 4; i++) {
+        Add(1, 0, "large" + std::to_string(i));
+    }
+    Add(2, 0, "small0");
+    Add(2, 0, "small1");
+    EXPECT_EQ(scheduler_.Pending(), 6);
+    Release();
+
+    std::vector<std::string> expected{
+        "large0", "small0", "large1", "small1", "large2", "large3"};
+    EXPECT_EQ(order_, expected);
+    EXPECT_EQ(scheduler_.Pending(), 0);
+}
+
+TEST_F(QueryTaskSchedulerTest, OrdersByDeadline) {
+    auto now = QueryTaskScheduler::NowUs();
+    Hold();
+    Add(1, 0, "none");
+    Add(2, now + 60'000'000, "late");
+    Add(3, now + 30'000'000, "early");
+    // already expired, runs first to be dropped
+    Add(4, now - 1, "expired");
+    Release();
+
+    std::vector<std::string> expected{"expired", "early", "late", "none"};
+    EXPECT_EQ(order_, expected);
+}
+
+TEST_F(QueryTaskSchedulerTest, RunsFutures) {
+    auto executor = scheduler_.GetExecutor(7, 0);
+    auto result = folly::makeSemiFuture()
+                      .via(executor)
+                      .thenValue([](auto&&) { return 42; })
+                      .get();
+    EXPECT_EQ(result, 42);
+    EXPECT_EQ(scheduler_.Pending(), 0);
+}
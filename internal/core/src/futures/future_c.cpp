@@ -62,6 +62,7 @@ executor_set_thread_num(int thread_num) {
 extern "C" void
 executor_set_search_thread_num(int thread_num) {
     milvus::futures::getSearchCPUExecutor()->setNumThreads(thread_num);
+    milvus::futures::setNumaSearchThreadNum(thread_num);
     milvus::monitor::internal_cgo_pool_size_search.Set(thread_num);
     LOG_INFO("future executor setup search cpu executor with thread num: {}",
              thread_num);
@@ -70,7 +71,16 @@ executor_set_search_thread_num(int thread_num) {
 extern "C" void
 executor_set_load_thread_num(int thread_num) {
     milvus::futures::getLoadCPUExecutor()->setNumThreads(thread_num);
+    milvus::futures::setNumaLoadThreadNum(thread_num);
     milvus::monitor::internal_cgo_pool_size_load.Set(thread_num);
     LOG_INFO("future executor setup load cpu executor with thread num: {}",
              thread_num);
 }
+
+extern "C" void
+executor_set_named_search_thread_num(const char* name, int thread_num) {
+    milvus::futures::setNamedSearchThreadNum(name, thread_num);
+    LOG_INFO("future executor setup search cpu executor {} with thread num: {}",
+             name,
+             thread_num);
+}
@@ -49,6 +49,11 @@ executor_set_search_thread_num(int thread_num);
 void
 executor_set_load_thread_num(int thread_num);
 
+// Sets up the search executor `name` that collections may be pinned to with
+// SetCollectionSearchPool, or resizes it.
+void
+executor_set_named_search_thread_num(const char* name, int thread_num);
+
 #ifdef __cplusplus
 }
 #endif
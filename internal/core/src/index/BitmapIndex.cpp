@@ -18,6 +18,7 @@
 #include "common/FastMem.h"
 #include <boost/algorithm/string.hpp>
 #include <folly/ScopeGuard.h>
+#include <limits>
 #include <optional>
 #include <sys/errno.h>
 #include <unistd.h>
@@ -32,6 +33,7 @@
 #include "common/Slice.h"
 #include "common/Common.h"
 #include "index/Meta.h"
+#include "index/ParallelBuild.h"
 #include "index/ScalarIndex.h"
 #include "index/Utils.h"
 #include "pb/common.pb.h"
@@ -130,16 +132,30 @@ template <typename T>
 void
 BitmapIndex<T>::BuildPrimitiveField(
     const std::vector<FieldDataPtr>& field_datas) {
-    int64_t offset = 0;
-    for (const auto& data : field_datas) {
-        auto slice_row_num = data->get_num_rows();
-        for (size_t i = 0; i < slice_row_num; ++i) {
-            if (data->is_valid(i)) {
-                auto val = reinterpret_cast<const T*>(data->RawValue(i));
-                data_[*val].add(offset);
-                valid_bitset_.set(offset);
-            }
-            offset++;
+    // every run groups the rows of its range by value, the run bitmaps of a
+    // value are then or'ed in run order
+    auto bounds = ParallelBuildBounds(total_num_rows_);
+    auto runs = bounds.size() - 1;
+    std::vector<std::map<T, roaring::Roaring>> run_data(runs);
+    RunParallel(runs, [&](size_t run) {
+        auto& data = run_data[run];
+        ForEachRowInRange(
+            field_datas,
+            bounds[run],
+            bounds[run + 1],
+            [&](const FieldDataPtr& field_data, size_t i, size_t offset) {
+                if (field_data->is_valid(i)) {
+                    auto val =
+                        reinterpret_cast<const T*>(field_data->RawValue(i));
+                    data[*val].add(offset);
+                    valid_bitset_.set(offset);
+                }
+            });
+    });
+    data_ = std::move(run_data[0]);
+    for (size_t run = 1; run < runs; ++run) {
+        for (auto& [value, bitmap] : run_data[run]) {
+            data_[value] |= bitmap;
         }
     }
 }
@@ -473,7 +489,7 @@ BitmapIndex<T>::BuildOffsetCache() {
         mmap_offsets_cache_.resize(total_num_rows_);
         for (auto it = bitmap_info_map_.begin(); it != bitmap_info_map_.end();
              ++it) {
-            for (const auto& v : it->second) {
+            for (const auto& v : MmapBitmapView(it->second)) {
                 mmap_offsets_cache_[v] = it;
             }
         }
@@ -567,8 +583,7 @@ BitmapIndex<T>::MMapIndexData(const std::string& file_name,
     std::filesystem::create_directories(
         std::filesystem::path(file_name).parent_path());
 
-    auto file_offset = 0;
-    std::map<T, std::pair<int32_t, int32_t>> bitmaps;
+    size_t file_offset = 0;
     {
         auto file_writer = storage::FileWriter(
             file_name, storage::io::GetPriorityFromLoadPriority(priority));
@@ -592,7 +607,8 @@ BitmapIndex<T>::MMapIndexData(const std::string& file_name,
             value.writeFrozen(reinterpret_cast<char*>(buf.data()));
 
             file_writer.Write(buf.data(), aligned_size);
-            bitmaps[key] = {file_offset, frozen_size};
+            bitmap_info_map_[key] = {file_offset,
+                                     static_cast<size_t>(frozen_size)};
 
             file_offset += aligned_size;
             data_ptr += value.getSizeInBytes();
@@ -613,12 +629,6 @@ BitmapIndex<T>::MMapIndexData(const std::string& file_name,
     mmap_size_ = file_offset;
     this->mmap_file_raii_ = std::make_unique<MmapFileRAII>(file_name);
 
-    char* ptr = mmap_data_;
-    for (const auto& [key, value] : bitmaps) {
-        const auto& [offset, size] = value;
-        bitmap_info_map_[key] =
-            roaring::Roaring::frozenView(ptr + offset, size);
-    }
     is_mmap_ = true;
 }
 
@@ -673,6 +683,10 @@ BitmapIndex<T>::LoadWithoutAssemble(const BinarySet& binary_set,
                              rebuild_validity_from_postings);
     }
 
+    if (GetValueFromConfig<bool>(config, BITMAP_BIT_SLICED_RANGE)
+            .value_or(false)) {
+        BuildBitSlices();
+    }
     if (enable_offset_cache.has_value() && enable_offset_cache.value()) {
         BuildOffsetCache();
     }
@@ -725,7 +739,7 @@ BitmapIndex<T>::In(const size_t n, const T* values) {
             const auto& val = values[i];
             auto it = bitmap_info_map_.find(val);
             if (it != bitmap_info_map_.end()) {
-                for (const auto& v : it->second) {
+                for (const auto& v : MmapBitmapView(it->second)) {
                     res.set(v);
                 }
             }
@@ -767,7 +781,7 @@ BitmapIndex<T>::NotIn(const size_t n, const T* values) {
             const auto& val = values[i];
             auto it = bitmap_info_map_.find(val);
             if (it != bitmap_info_map_.end()) {
-                for (const auto& v : it->second) {
+                for (const auto& v : MmapBitmapView(it->second)) {
                     res.reset(v);
                 }
             }
@@ -894,6 +908,9 @@ BitmapIndex<T>::RangeForBitset(const T& value, const OpType op) {
 template <typename T>
 const TargetBitmap
 BitmapIndex<T>::Range(const T& value, OpType op) {
+    if (use_bit_slices_) {
+        return RangeForBitSlices(value, op);
+    }
     if (is_mmap_) {
         return std::move(RangeForMmap(value, op));
     }
@@ -960,7 +977,7 @@ BitmapIndex<T>::RangeForMmap(const T& value, const OpType op) {
     }
 
     for (; lb != ub; lb++) {
-        for (const auto& v : lb->second) {
+        for (const auto& v : MmapBitmapView(lb->second)) {
             res.set(v);
         }
     }
@@ -1096,6 +1113,10 @@ BitmapIndex<T>::Range(const T& lower_value,
                       bool lb_inclusive,
                       const T& upper_value,
                       bool ub_inclusive) {
+    if (use_bit_slices_) {
+        return RangeForBitSlices(
+            lower_value, lb_inclusive, upper_value, ub_inclusive);
+    }
     if (is_mmap_) {
         return RangeForMmap(
             lower_value, lb_inclusive, upper_value, ub_inclusive);
@@ -1163,7 +1184,7 @@ BitmapIndex<T>::RangeForMmap(const T& lower_value,
     }
 
     for (; lb != ub; lb++) {
-        for (const auto& v : lb->second) {
+        for (const auto& v : MmapBitmapView(lb->second)) {
             res.set(v);
         }
     }
@@ -1232,6 +1253,160 @@ BitmapIndex<T>::RangeForRoaring(const T& lower_value,
     return res;
 }
 
+template <typename T>
+void
+BitmapIndex<T>::BuildBitSlices() {
+    if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool>) {
+        // a row of an array field may hold several values, which a single
+        // offset per row cannot encode
+        if (build_mode_ != BitmapIndexBuildMode::ROARING ||
+            schema_.data_type() == proto::schema::DataType::Array ||
+            is_nested_index_ || Cardinality() == 0) {
+            return;
+        }
+        if (is_mmap_) {
+            bit_sliced_min_ = bitmap_info_map_.begin()->first;
+            bit_sliced_max_ = bitmap_info_map_.rbegin()->first;
+        } else {
+            bit_sliced_min_ = data_.begin()->first;
+            bit_sliced_max_ = data_.rbegin()->first;
+        }
+        // unsigned subtraction gives the right offset for every value not
+        // below bit_sliced_min_, even across the whole int64 range
+        auto offset_of = [this](T value) {
+            return static_cast<uint64_t>(value) -
+                   static_cast<uint64_t>(bit_sliced_min_);
+        };
+        size_t width = 0;
+        for (auto max_offset = offset_of(bit_sliced_max_); max_offset != 0;
+             max_offset >>= 1) {
+            ++width;
+        }
+        bit_slices_.assign(width, roaring::Roaring());
+        bit_sliced_rows_ = roaring::Roaring();
+        auto add_value = [&](T value, const roaring::Roaring& rows) {
+            bit_sliced_rows_ |= rows;
+            auto offset = offset_of(value);
+            for (size_t b = 0; offset != 0; ++b, offset >>= 1) {
+                if (offset & 1) {
+                    bit_slices_[b] |= rows;
+                }
+            }
+        };
+        if (is_mmap_) {
+            for (const auto& [value, info] : bitmap_info_map_) {
+                add_value(value, MmapBitmapView(info));
+            }
+        } else {
+            for (const auto& [value, rows] : data_) {
+                add_value(value, rows);
+            }
+        }
+        for (auto& slice : bit_slices_) {
+            slice.runOptimize();
+            slice.shrinkToFit();
+        }
+        bit_sliced_rows_.runOptimize();
+        bit_sliced_rows_.shrinkToFit();
+        use_bit_slices_ = true;
+        LOG_INFO("build {} bit slices for bitmap index with cardinality {}",
+                 width,
+                 Cardinality());
+    }
+}
+
+template <typename T>
+roaring::Roaring
+BitmapIndex<T>::BitSlicedLessEqual(uint64_t offset) const {
+    // walk the slices from the highest bit: `eq` keeps the rows equal to
+    // `offset` on the bits seen so far, `lt` collects the rows already known
+    // to be smaller
+    roaring::Roaring lt;
+    roaring::Roaring eq = bit_sliced_rows_;
+    for (size_t b = bit_slices_.size(); b-- > 0;) {
+        if ((offset >> b) & 1) {
+            lt |= eq - bit_slices_[b];
+            eq &= bit_slices_[b];
+        } else {
+            eq -= bit_slices_[b];
+        }
+    }
+    lt |= eq;
+    return lt;
+}
+
+template <typename T>
+TargetBitmap
+BitmapIndex<T>::RangeForBitSlices(const T& value, OpType op) {
+    if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool>) {
+        constexpr T kMin = std::numeric_limits<T>::lowest();
+        constexpr T kMax = std::numeric_limits<T>::max();
+        switch (op) {
+            case OpType::LessThan:
+                return RangeForBitSlices(kMin, true, value, false);
+            case OpType::LessEqual:
+                return RangeForBitSlices(kMin, true, value, true);
+            case OpType::GreaterThan:
+                return RangeForBitSlices(value, false, kMax, true);
+            case OpType::GreaterEqual:
+                return RangeForBitSlices(value, true, kMax, true);
+            default:
+                ThrowInfo(OpTypeInvalid,
+                          fmt::format("Invalid OperatorType: {}", op));
+        }
+    } else {
+        ThrowInfo(UnexpectedError,
+                  "bit slices are only built for integral types");
+    }
+}
+
+template <typename T>
+TargetBitmap
+BitmapIndex<T>::RangeForBitSlices(const T& lower_bound_value,
+                                  bool lb_inclusive,
+                                  const T& upper_bound_value,
+                                  bool ub_inclusive) {
+    tracer::AutoSpan span("BitmapIndex::RangeForBitSlices",
+                          tracer::GetRootSpan());
+
+    AssertInfo(is_built_, "index has not been built");
+    TargetBitmap res(total_num_rows_, false);
+    if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool>) {
+        // make both bounds inclusive and clamp them to the indexed values
+        T lower = lower_bound_value;
+        T upper = upper_bound_value;
+        if (!lb_inclusive) {
+            if (lower == std::numeric_limits<T>::max()) {
+                return res;
+            }
+            ++lower;
+        }
+        if (!ub_inclusive) {
+            if (upper == std::numeric_limits<T>::lowest()) {
+                return res;
+            }
+            --upper;
+        }
+        lower = std::max(lower, bit_sliced_min_);
+        upper = std::min(upper, bit_sliced_max_);
+        if (lower > upper) {
+            return res;
+        }
+        auto offset_of = [this](T value) {
+            return static_cast<uint64_t>(value) -
+                   static_cast<uint64_t>(bit_sliced_min_);
+        };
+        auto rows = BitSlicedLessEqual(offset_of(upper));
+        if (lower > bit_sliced_min_) {
+            rows -= BitSlicedLessEqual(offset_of(lower) - 1);
+        }
+        for (const auto& v : rows) {
+            res.set(v);
+        }
+    }
+    return res;
+}
+
 template <typename T>
 T
 BitmapIndex<T>::Reverse_Lookup_InCache(size_t idx) const {
@@ -1265,7 +1440,7 @@ BitmapIndex<T>::Reverse_Lookup(size_t idx) const {
     if (is_mmap_) {
         for (auto it = bitmap_info_map_.begin(); it != bitmap_info_map_.end();
              it++) {
-            if (it->second.contains(idx)) {
+            if (MmapBitmapView(it->second).contains(idx)) {
                 return it->first;
             }
         }
@@ -1381,7 +1556,7 @@ BitmapIndex<std::string>::Query(const DatasetPtr& dataset) {
              ++it) {
             const auto& key = it->first;
             if (milvus::query::Match(key, val, op)) {
-                for (const auto& v : it->second) {
+                for (const auto& v : MmapBitmapView(it->second)) {
                     res.set(v);
                 }
             }
@@ -1525,6 +1700,10 @@ BitmapIndex<T>::LoadEntries(storage::IndexEntryReader& reader,
             buf.data(), index_length, rebuild_validity_from_postings);
     }
 
+    if (GetValueFromConfig<bool>(config, BITMAP_BIT_SLICED_RANGE)
+            .value_or(false)) {
+        BuildBitSlices();
+    }
     if (enable_offset_cache.has_value() && enable_offset_cache.value()) {
         BuildOffsetCache();
     }
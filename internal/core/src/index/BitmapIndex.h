@@ -21,6 +21,7 @@
 #include <string>
 #include <roaring/roaring.hh>
 
+#include "common/PatternMatcherCache.h"
 #include "common/RegexQuery.h"
 #include "index/ScalarIndex.h"
 #include "pb/common.pb.h"
@@ -30,6 +31,7 @@
 namespace milvus {
 namespace index {
 
+// Where the frozen roaring bitmap of one value lives in the mmap file.
 struct BitmapInfo {
     size_t offset_;
     size_t size_;
@@ -131,17 +133,18 @@ class BitmapIndex : public ScalarIndex<T> {
         if (is_mmap_) {
             // mmap mode
             total += mmap_size_;
-            // bitmap_info_map_ overhead (keys and roaring metadata in memory)
+            // bitmap_info_map_ overhead (keys and file offsets in memory),
+            // the bitmaps themselves are only decoded when queried
             size_t num_entries = bitmap_info_map_.size();
             if constexpr (std::is_same_v<T, std::string>) {
-                for (const auto& [key, bitmap] : bitmap_info_map_) {
+                for (const auto& [key, info] : bitmap_info_map_) {
                     total += key.capacity();
                 }
             } else {
                 total += num_entries * sizeof(T);
             }
-            // roaring metadata + map node overhead per entry
-            total += num_entries * (sizeof(roaring::Roaring) + 40);
+            // offsets + map node overhead per entry
+            total += num_entries * (sizeof(BitmapInfo) + 40);
         } else if (build_mode_ == BitmapIndexBuildMode::ROARING) {
             // data_: map<T, roaring::Roaring>
             for (const auto& [key, bitmap] : data_) {
@@ -172,6 +175,11 @@ class BitmapIndex : public ScalarIndex<T> {
             }
         }
 
+        for (const auto& slice : bit_slices_) {
+            total += slice.getSizeInBytes();
+        }
+        total += bit_sliced_rows_.getSizeInBytes();
+
         // offset cache
         total += data_offsets_cache_.capacity() *
                  sizeof(typename decltype(data_offsets_cache_)::value_type);
@@ -235,12 +243,14 @@ class BitmapIndex : public ScalarIndex<T> {
                     return TargetBitmap{};
                 } else {
                     AssertInfo(is_built_, "index has not been built");
-                    PartialRegexMatcher matcher(pattern);
+                    auto& cache = PatternMatcherCache::GetInstance();
+                    auto matcher_ptr = cache.GetPartialRegexMatcher(pattern);
+                    const auto& matcher = *matcher_ptr;
                     TargetBitmap res(total_num_rows_, false);
                     if (is_mmap_) {
-                        for (const auto& [key, bitmap] : bitmap_info_map_) {
+                        for (const auto& [key, info] : bitmap_info_map_) {
                             if (matcher(key)) {
-                                for (const auto& v : bitmap) {
+                                for (const auto& v : MmapBitmapView(info)) {
                                     res.set(v);
                                 }
                             }
@@ -281,12 +291,14 @@ class BitmapIndex : public ScalarIndex<T> {
 
         AssertInfo(is_built_, "index has not been built");
 
-        LikePatternMatcher matcher(pattern);
+        auto matcher_ptr =
+            PatternMatcherCache::GetInstance().GetLikePatternMatcher(pattern);
+        const auto& matcher = *matcher_ptr;
         TargetBitmap res(total_num_rows_, false);
         if (is_mmap_) {
-            for (const auto& [key, bitmap] : bitmap_info_map_) {
+            for (const auto& [key, info] : bitmap_info_map_) {
                 if (matcher(key)) {
-                    for (const auto& v : bitmap) {
+                    for (const auto& v : MmapBitmapView(info)) {
                         res.set(v);
                     }
                 }
@@ -434,6 +446,34 @@ class BitmapIndex : public ScalarIndex<T> {
     void
     UnmapIndexData();
 
+    // Builds bit_slices_ from the value bitmaps, see BITMAP_BIT_SLICED_RANGE.
+    // Only integral, single valued fields loaded in roaring mode use it,
+    // bitset mode has too few values for per value unions to matter.
+    void
+    BuildBitSlices();
+
+    // Rows whose value is at most bit_sliced_min_ + offset.
+    roaring::Roaring
+    BitSlicedLessEqual(uint64_t offset) const;
+
+    TargetBitmap
+    RangeForBitSlices(const T& value, OpType op);
+
+    TargetBitmap
+    RangeForBitSlices(const T& lower_bound_value,
+                      bool lb_inclusive,
+                      const T& upper_bound_value,
+                      bool ub_inclusive);
+
+    // Zero-copy view of the frozen bitmap of one value in mmap_data_. Only
+    // the container headers are decoded, so a query pays for the values it
+    // touches rather than the load for all of them.
+    roaring::Roaring
+    MmapBitmapView(const BitmapInfo& info) const {
+        return roaring::Roaring::frozenView(mmap_data_ + info.offset_,
+                                            info.size_);
+    }
+
  public:
     bool is_built_{false};
     BitmapIndexBuildMode build_mode_;
@@ -443,7 +483,7 @@ class BitmapIndex : public ScalarIndex<T> {
     bool is_nested_index_{false};
     char* mmap_data_;
     int64_t mmap_size_;
-    std::map<T, roaring::Roaring> bitmap_info_map_;
+    std::map<T, BitmapInfo> bitmap_info_map_;
     size_t total_num_rows_{0};
     proto::schema::FieldSchema schema_;
     bool use_offset_cache_{false};
@@ -451,11 +491,21 @@ class BitmapIndex : public ScalarIndex<T> {
         data_offsets_cache_;
     std::vector<typename std::map<T, TargetBitmap>::iterator>
         bitsets_offsets_cache_;
-    std::vector<typename std::map<T, roaring::Roaring>::iterator>
+    std::vector<typename std::map<T, BitmapInfo>::iterator>
         mmap_offsets_cache_;
 
     // generate valid_bitset to speed up NotIn and IsNull and IsNotNull operate
     TargetBitmap valid_bitset_;
+
+    // bit_slices_[b] holds the rows whose value - bit_sliced_min_ has bit b
+    // set, so a range costs O(bit width) bitmap operations instead of one
+    // union per distinct value in it
+    bool use_bit_slices_{false};
+    std::vector<roaring::Roaring> bit_slices_;
+    // rows that have a value
+    roaring::Roaring bit_sliced_rows_;
+    T bit_sliced_min_{};
+    T bit_sliced_max_{};
 };
 
 }  // namespace index
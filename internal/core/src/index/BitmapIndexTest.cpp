@@ -209,6 +209,9 @@ class BitmapIndexTest : public testing::Test {
                                                   field_id);
             ;
         }
+        if (bit_sliced_range_) {
+            config[milvus::index::BITMAP_BIT_SLICED_RANGE] = "true";
+        }
         config[milvus::LOAD_PRIORITY] =
             milvus::proto::common::LoadPriority::HIGH;
         index_ =
@@ -572,6 +575,7 @@ class BitmapIndexTest : public testing::Test {
     bool has_default_value_{false};
     bool has_lack_binlog_row_{false};
     size_t lack_binlog_row_{100};
+    bool bit_sliced_range_{false};
 };
 
 TYPED_TEST_SUITE_P(BitmapIndexTest);
@@ -961,3 +965,43 @@ REGISTER_TYPED_TEST_SUITE_P(BitmapIndexTestV6,
 INSTANTIATE_TYPED_TEST_SUITE_P(BitmapIndexE2ECheck_Mmap,
                                BitmapIndexTestV6,
                                BitmapType);
+
+template <typename T>
+class BitmapIndexTestV7 : public BitmapIndexTest<T> {
+ public:
+    virtual void
+    SetParam() override {
+        this->nb_ = 10000;
+        this->cardinality_ = 2000;
+        this->nullable_ = true;
+        this->index_version_ = 3004;
+        this->index_build_id_ = 3004;
+        this->bit_sliced_range_ = true;
+    }
+
+    virtual ~BitmapIndexTestV7() {
+    }
+};
+
+TYPED_TEST_SUITE_P(BitmapIndexTestV7);
+
+TYPED_TEST_P(BitmapIndexTestV7, CompareValFuncTest) {
+    this->TestCompareValueFunc();
+}
+
+TYPED_TEST_P(BitmapIndexTestV7, TestRangeCompareFuncTest) {
+    this->TestRangeCompareFunc();
+}
+
+TYPED_TEST_P(BitmapIndexTestV7, IsNullFuncTest) {
+    this->TestIsNullFunc();
+}
+
+REGISTER_TYPED_TEST_SUITE_P(BitmapIndexTestV7,
+                            CompareValFuncTest,
+                            TestRangeCompareFuncTest,
+                            IsNullFuncTest);
+
+INSTANTIATE_TYPED_TEST_SUITE_P(BitmapIndexE2ECheck_BitSliced,
+                               BitmapIndexTestV7,
+                               BitmapType);
@@ -0,0 +1,66 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "index/DiskAnnCacheBudget.h"
+
+#include <algorithm>
+
+#include "common/EasyAssert.h"
+#include "monitor/Monitor.h"
+
+namespace milvus::index {
+
+size_t
+DiskAnnCacheBudget::Reserve(size_t requested, size_t capacity) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto granted = requested;
+    if (capacity > 0) {
+        auto left = capacity > reserved_bytes_ ? capacity - reserved_bytes_ : 0;
+        granted = std::min(requested, left);
+    }
+    if (requested > 0) {
+        if (granted == requested) {
+            monitor::internal_core_diskann_cache_admission_full.Increment();
+        } else if (granted > 0) {
+            monitor::internal_core_diskann_cache_admission_trimmed.Increment();
+        } else {
+            monitor::internal_core_diskann_cache_admission_rejected.Increment();
+        }
+    }
+    reserved_bytes_ += granted;
+    monitor::internal_core_diskann_cache_bytes_reserved.Set(reserved_bytes_);
+    return granted;
+}
+
+void
+DiskAnnCacheBudget::Release(size_t bytes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    AssertInfo(bytes <= reserved_bytes_,
+               "DiskANN cache budget over-release: release {}, reserved {}",
+               bytes,
+               reserved_bytes_);
+    reserved_bytes_ -= bytes;
+    monitor::internal_core_diskann_cache_bytes_reserved.Set(reserved_bytes_);
+}
+
+size_t
+DiskAnnCacheBudget::ReservedBytes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return reserved_bytes_;
+}
+
+}  // namespace milvus::index
@@ -0,0 +1,57 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+
+namespace milvus::index {
+
+// Node wide budget for the node caches DiskANN indexes fill at load by BFS
+// from their medoids. Each index asks for the search_cache_budget_gb it was
+// configured with and is granted what is left of the budget, so a node with
+// many DiskANN segments holds at most `capacity` bytes of cached graph nodes
+// whatever each index asks for. Grants are returned when the index goes.
+//
+// Thread safety: All methods are thread-safe.
+class DiskAnnCacheBudget {
+ public:
+    static DiskAnnCacheBudget&
+    GetInstance() {
+        static DiskAnnCacheBudget instance;
+        return instance;
+    }
+
+    // Reserves up to `requested` bytes under `capacity`, returns the bytes
+    // granted, which may be less than asked for or 0 once the budget is
+    // used up. `capacity` 0 leaves the budget unlimited.
+    size_t
+    Reserve(size_t requested, size_t capacity);
+
+    void
+    Release(size_t bytes);
+
+    size_t
+    ReservedBytes() const;
+
+ private:
+    mutable std::mutex mutex_;
+    size_t reserved_bytes_{0};
+};
+
+}  // namespace milvus::index
@@ -0,0 +1,58 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <gtest/gtest.h>
+
+#include "index/DiskAnnCacheBudget.h"
+
+using milvus::index::DiskAnnCacheBudget;
+
+TEST(DiskAnnCacheBudgetTest, TrimsToWhatIsLeft) {
+    DiskAnnCacheBudget budget;
+    EXPECT_EQ(budget.Reserve(60, 100), 60);
+    EXPECT_EQ(budget.Reserve(60, 100), 40);
+    EXPECT_EQ(budget.Reserve(60, 100), 0);
+    EXPECT_EQ(budget.ReservedBytes(), 100);
+
+    budget.Release(60);
+    EXPECT_EQ(budget.Reserve(10, 100), 10);
+    EXPECT_EQ(budget.ReservedBytes(), 50);
+    budget.Release(50);
+    EXPECT_EQ(budget.ReservedBytes(), 0);
+}
+
+TEST(DiskAnnCacheBudgetTest, ZeroCapacityIsUnlimited) {
+    DiskAnnCacheBudget budget;
+    EXPECT_EQ(budget.Reserve(1 << 30, 0), 1 << 30);
+    EXPECT_EQ(budget.Reserve(1 << 30, 0), 1 << 30);
+    budget.Release(2ull << 30);
+    EXPECT_EQ(budget.ReservedBytes(), 0);
+}
+
+TEST(DiskAnnCacheBudgetTest, ShrunkCapacityGrantsNothing) {
+    DiskAnnCacheBudget budget;
+    EXPECT_EQ(budget.Reserve(80, 100), 80);
+    EXPECT_EQ(budget.Reserve(10, 50), 0);
+    budget.Release(80);
+}
+
+TEST(DiskAnnCacheBudgetTest, OverReleaseThrows) {
+    DiskAnnCacheBudget budget;
+    budget.Reserve(10, 100);
+    EXPECT_ANY_THROW(budget.Release(20));
+    budget.Release(10);
+}
@@ -0,0 +1,255 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "index/FrontCodedStrings.h"
+
+#include <cstring>
+
+#include "common/EasyAssert.h"
+#include "fmt/core.h"
+
+namespace milvus::index {
+
+namespace {
+
+size_t
+VarintSize(uint32_t value) {
+    size_t size = 1;
+    while (value >= 0x80) {
+        value >>= 7;
+        size++;
+    }
+    return size;
+}
+
+void
+PutVarint(uint32_t value, uint8_t* ptr, size_t& offset) {
+    while (value >= 0x80) {
+        ptr[offset++] = static_cast<uint8_t>(value | 0x80);
+        value >>= 7;
+    }
+    ptr[offset++] = static_cast<uint8_t>(value);
+}
+
+uint32_t
+GetVarint(const uint8_t*& ptr) {
+    uint32_t value = 0;
+    for (int shift = 0;; shift += 7) {
+        auto byte = *ptr++;
+        value |= static_cast<uint32_t>(byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0) {
+            return value;
+        }
+    }
+}
+
+uint32_t
+SharedPrefix(const std::string& a, const std::string& b) {
+    auto len = std::min(a.size(), b.size());
+    size_t i = 0;
+    while (i < len && a[i] == b[i]) {
+        i++;
+    }
+    return static_cast<uint32_t>(i);
+}
+
+// Bytes of the blocks, the strings coded as Serialize writes them.
+size_t
+BlocksSize(const std::vector<std::string>& sorted, uint32_t block_size) {
+    size_t size = 0;
+    for (size_t i = 0; i < sorted.size(); i++) {
+        if (i % block_size == 0) {
+            size += VarintSize(sorted[i].size()) + sorted[i].size();
+            continue;
+        }
+        auto shared = SharedPrefix(sorted[i - 1], sorted[i]);
+        auto suffix = sorted[i].size() - shared;
+        size += VarintSize(shared) + VarintSize(suffix) + suffix;
+    }
+    return size;
+}
+
+}  // namespace
+
+size_t
+FrontCodedStrings::SerializedSize(const std::vector<std::string>& sorted) {
+    auto num_blocks = (sorted.size() + kBlockSize - 1) / kBlockSize;
+    return sizeof(uint32_t) * (4 + num_blocks) +
+           BlocksSize(sorted, kBlockSize);
+}
+
+void
+FrontCodedStrings::Serialize(const std::vector<std::string>& sorted,
+                             uint8_t* ptr,
+                             size_t& offset) {
+    auto put_u32 = [&](uint32_t value) {
+        memcpy(ptr + offset, &value, sizeof(uint32_t));
+        offset += sizeof(uint32_t);
+    };
+    uint32_t count = sorted.size();
+    uint32_t num_blocks = (count + kBlockSize - 1) / kBlockSize;
+    put_u32(count);
+    put_u32(kBlockSize);
+    put_u32(num_blocks);
+
+    // block offsets first, the blocks are written once they are known
+    auto offsets_start = offset;
+    offset += sizeof(uint32_t) * num_blocks;
+    auto blocks_size_offset = offset;
+    offset += sizeof(uint32_t);
+    auto blocks_start = offset;
+
+    for (uint32_t i = 0; i < count; i++) {
+        const auto& value = sorted[i];
+        if (i % kBlockSize == 0) {
+            uint32_t block_offset = offset - blocks_start;
+            memcpy(ptr + offsets_start + sizeof(uint32_t) * (i / kBlockSize),
+                   &block_offset,
+                   sizeof(uint32_t));
+            PutVarint(value.size(), ptr, offset);
+            memcpy(ptr + offset, value.data(), value.size());
+            offset += value.size();
+            continue;
+        }
+        auto shared = SharedPrefix(sorted[i - 1], value);
+        uint32_t suffix = value.size() - shared;
+        PutVarint(shared, ptr, offset);
+        PutVarint(suffix, ptr, offset);
+        memcpy(ptr + offset, value.data() + shared, suffix);
+        offset += suffix;
+    }
+
+    uint32_t blocks_size = offset - blocks_start;
+    memcpy(ptr + blocks_size_offset, &blocks_size, sizeof(uint32_t));
+}
+
+FrontCodedStrings::FrontCodedStrings(const uint8_t* data) {
+    auto ptr = data;
+    auto get_u32 = [&ptr]() {
+        uint32_t value;
+        memcpy(&value, ptr, sizeof(uint32_t));
+        ptr += sizeof(uint32_t);
+        return value;
+    };
+    count_ = get_u32();
+    block_size_ = get_u32();
+    num_blocks_ = get_u32();
+    AssertInfo(block_size_ > 0 &&
+                   num_blocks_ == (count_ + block_size_ - 1) / block_size_,
+               fmt::format("invalid front coded strings: {} strings in {} "
+                           "blocks of {}",
+                           count_,
+                           num_blocks_,
+                           block_size_));
+    block_offsets_ = reinterpret_cast<const uint32_t*>(ptr);
+    ptr += sizeof(uint32_t) * num_blocks_;
+    auto blocks_size = get_u32();
+    blocks_ = ptr;
+    byte_size_ = (ptr - data) + blocks_size;
+}
+
+void
+FrontCodedStrings::Cursor::Start(const uint8_t* block) {
+    ptr = block;
+    auto len = GetVarint(ptr);
+    value.assign(reinterpret_cast<const char*>(ptr), len);
+    ptr += len;
+}
+
+void
+FrontCodedStrings::Cursor::Next() {
+    auto shared = GetVarint(ptr);
+    auto suffix = GetVarint(ptr);
+    value.resize(shared);
+    value.append(reinterpret_cast<const char*>(ptr), suffix);
+    ptr += suffix;
+}
+
+std::string_view
+FrontCodedStrings::BlockHead(size_t block) const {
+    auto ptr = BlockStart(block);
+    auto len = GetVarint(ptr);
+    return {reinterpret_cast<const char*>(ptr), len};
+}
+
+std::string
+FrontCodedStrings::Get(size_t idx) const {
+    AssertInfo(idx < count_,
+               fmt::format("string index {} out of range {}", idx, count_));
+    Cursor cursor;
+    cursor.Start(BlockStart(idx / block_size_));
+    for (size_t i = 0; i < idx % block_size_; i++) {
+        cursor.Next();
+    }
+    return std::move(cursor.value);
+}
+
+template <typename Less>
+size_t
+FrontCodedStrings::Bound(std::string_view value, Less less) const {
+    // blocks [0, lo) have a head for which less holds
+    size_t lo = 0;
+    size_t hi = num_blocks_;
+    while (lo < hi) {
+        auto mid = lo + (hi - lo) / 2;
+        if (less(BlockHead(mid), value)) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    if (lo == 0) {
+        return 0;
+    }
+
+    // the bound is in the last of those blocks, after its head, or is the
+    // head of the next block
+    auto block = lo - 1;
+    auto idx = block * block_size_;
+    auto end = std::min<size_t>(idx + block_size_, count_);
+    Cursor cursor;
+    cursor.Start(BlockStart(block));
+    for (idx++; idx < end; idx++) {
+        cursor.Next();
+        if (!less(std::string_view(cursor.value), value)) {
+            return idx;
+        }
+    }
+    return end;
+}
+
+size_t
+FrontCodedStrings::LowerBound(std::string_view value) const {
+    return Bound(value,
+                 [](std::string_view s, std::string_view v) { return s < v; });
+}
+
+size_t
+FrontCodedStrings::UpperBound(std::string_view value) const {
+    return Bound(
+        value, [](std::string_view s, std::string_view v) { return s <= v; });
+}
+
+size_t
+FrontCodedStrings::Find(std::string_view value) const {
+    auto idx = LowerBound(value);
+    if (idx < count_ && Get(idx) == value) {
+        return idx;
+    }
+    return count_;
+}
+
+}  // namespace milvus::index
@@ -0,0 +1,141 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace milvus::index {
+
+// Sorted strings stored front coded: they are cut into blocks of
+// kBlockSize, the first string of a block is stored whole and every other
+// one as the length of the prefix it shares with the string before it plus
+// the rest of it. Sorted values such as URLs or paths share long prefixes,
+// so the section is a fraction of the strings' bytes.
+//
+// The section is :
+//   [count][block_size][num_blocks][block_offsets][blocks_size][blocks]
+// block_offsets: offset of each block into blocks
+// blocks: for each block, varint len1, str1, then for each other string
+//         varint shared_prefix_len, varint suffix_len, suffix
+//
+// A lookup binary searches the whole first strings of the blocks, then
+// decodes one block, so queries never decode more than a block per bound.
+class FrontCodedStrings {
+ public:
+    static constexpr uint32_t kBlockSize = 16;
+
+    // Bytes the section takes for `sorted`.
+    static size_t
+    SerializedSize(const std::vector<std::string>& sorted);
+
+    // Writes the section for `sorted` at `ptr + offset` and advances
+    // `offset` past it.
+    static void
+    Serialize(const std::vector<std::string>& sorted,
+              uint8_t* ptr,
+              size_t& offset);
+
+    FrontCodedStrings() = default;
+
+    // Reads the section at `data`, which must outlive this view.
+    explicit FrontCodedStrings(const uint8_t* data);
+
+    size_t
+    size() const {
+        return count_;
+    }
+
+    // Bytes of the section, from its start to the end of the blocks.
+    size_t
+    ByteSize() const {
+        return byte_size_;
+    }
+
+    std::string
+    Get(size_t idx) const;
+
+    // Index of the first string not less / greater than `value`.
+    size_t
+    LowerBound(std::string_view value) const;
+
+    size_t
+    UpperBound(std::string_view value) const;
+
+    // Index of `value`, size() if it is not there.
+    size_t
+    Find(std::string_view value) const;
+
+    // Calls func(idx, value) for the strings in [begin, end), in order. The
+    // view is only valid during the call.
+    template <typename Func>
+    void
+    ForEach(size_t begin, size_t end, Func func) const {
+        end = std::min<size_t>(end, count_);
+        Cursor cursor;
+        for (auto idx = begin - begin % block_size_; idx < end; idx++) {
+            if (idx % block_size_ == 0) {
+                cursor.Start(BlockStart(idx / block_size_));
+            } else {
+                cursor.Next();
+            }
+            if (idx >= begin) {
+                func(idx, std::string_view(cursor.value));
+            }
+        }
+    }
+
+ private:
+    // Decodes the strings of a block one after the other.
+    struct Cursor {
+        // Moves to the first string of the block at `block`.
+        void
+        Start(const uint8_t* block);
+
+        void
+        Next();
+
+        const uint8_t* ptr{nullptr};
+        std::string value;
+    };
+
+    const uint8_t*
+    BlockStart(size_t block) const {
+        return blocks_ + block_offsets_[block];
+    }
+
+    std::string_view
+    BlockHead(size_t block) const;
+
+    // Index of the first string s for which less(s, value) is false.
+    template <typename Less>
+    size_t
+    Bound(std::string_view value, Less less) const;
+
+    uint32_t count_{0};
+    uint32_t block_size_{kBlockSize};
+    uint32_t num_blocks_{0};
+    const uint32_t* block_offsets_{nullptr};
+    const uint8_t* blocks_{nullptr};
+    size_t byte_size_{0};
+};
+
+}  // namespace milvus::index
@@ -0,0 +1,92 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "index/FrontCodedStrings.h"
+
+using milvus::index::FrontCodedStrings;
+
+namespace {
+
+std::vector<uint8_t>
+Encode(const std::vector<std::string>& sorted) {
+    std::vector<uint8_t> data(FrontCodedStrings::SerializedSize(sorted));
+    size_t offset = 0;
+    FrontCodedStrings::Serialize(sorted, data.data(), offset);
+    EXPECT_EQ(offset, data.size());
+    return data;
+}
+
+}  // namespace
+
+TEST(FrontCodedStringsTest, RoundTrips) {
+    std::vector<std::string> sorted;
+    for (int i = 0; i < 100; ++i) {
+        sorted.push_back("/var/lib/milvus/" + std::to_string(1000 + i));
+    }
+    sorted.insert(sorted.begin(), "");
+    auto data = Encode(sorted);
+    FrontCodedStrings strings(data.data());
+    ASSERT_EQ(strings.size(), sorted.size());
+    ASSERT_EQ(strings.ByteSize(), data.size());
+
+    for (size_t i = 0; i < sorted.size(); ++i) {
+        EXPECT_EQ(strings.Get(i), sorted[i]);
+        EXPECT_EQ(strings.Find(sorted[i]), i);
+    }
+    EXPECT_EQ(strings.Find("/var/lib/milvus/999"), strings.size());
+
+    // starts in the middle of a block
+    std::vector<std::string> visited;
+    strings.ForEach(20, 40, [&](size_t idx, std::string_view value) {
+        EXPECT_EQ(value, sorted[idx]);
+        visited.emplace_back(value);
+    });
+    EXPECT_EQ(visited,
+              std::vector<std::string>(sorted.begin() + 20,
+                                       sorted.begin() + 40));
+}
+
+TEST(FrontCodedStringsTest, BoundsMatchStd) {
+    std::vector<std::string> sorted = {
+        "a", "ab", "abc", "abd", "b", "ba", "bab", "c"};
+    for (int i = 0; i < 40; ++i) {
+        sorted.push_back("d" + std::to_string(10 + i));
+    }
+    std::sort(sorted.begin(), sorted.end());
+    auto data = Encode(sorted);
+    FrontCodedStrings strings(data.data());
+
+    for (std::string probe :
+         {"", "a", "aa", "abc", "abz", "b", "bz", "d", "d25", "d255", "z"}) {
+        auto lower = std::lower_bound(sorted.begin(), sorted.end(), probe);
+        auto upper = std::upper_bound(sorted.begin(), sorted.end(), probe);
+        EXPECT_EQ(strings.LowerBound(probe), lower - sorted.begin()) << probe;
+        EXPECT_EQ(strings.UpperBound(probe), upper - sorted.begin()) << probe;
+    }
+}
+
+TEST(FrontCodedStringsTest, Empty) {
+    auto data = Encode({});
+    FrontCodedStrings strings(data.data());
+    EXPECT_EQ(strings.size(), 0);
+    EXPECT_EQ(strings.LowerBound("a"), 0);
+    EXPECT_EQ(strings.Find("a"), 0);
+}
@@ -33,6 +33,7 @@
 #include "boost/filesystem/path.hpp"
 #include "boost/iterator/iterator_facade.hpp"
 #include "common/Array.h"
+#include "common/Common.h"
 #include "common/FieldDataInterface.h"
 #include "common/Slice.h"
 #include "common/Tracer.h"
@@ -69,6 +70,44 @@ get_tantivy_data_type(const proto::schema::FieldSchema& schema) {
     }
 }
 
+namespace {
+
+// Kinds of queries in the result cache keys.
+enum class CachedQueryKind : char {
+    kTerms = 't',
+    kLessThan = 'l',
+    kLessEqual = 'L',
+    kGreaterThan = 'g',
+    kGreaterEqual = 'G',
+    kRange = 'r',
+    kPrefix = 'p',
+    kPattern = 'm',
+};
+
+template <typename T>
+void
+AppendKeyValue(std::string& key, const T& value) {
+    if constexpr (std::is_same_v<T, std::string>) {
+        auto len = static_cast<uint32_t>(value.size());
+        key.append(reinterpret_cast<const char*>(&len), sizeof(len));
+        key.append(value);
+    } else {
+        key.append(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+}
+
+template <typename T>
+std::string
+ResultCacheKey(CachedQueryKind kind, const T* values, size_t n) {
+    std::string key(1, static_cast<char>(kind));
+    for (size_t i = 0; i < n; i++) {
+        AppendKeyValue(key, values[i]);
+    }
+    return key;
+}
+
+}  // namespace
+
 template <typename T>
 void
 InvertedIndexTantivy<T>::InitForBuildIndex() {
@@ -115,6 +154,7 @@ InvertedIndexTantivy<T>::InvertedIndexTantivy(
 
 template <typename T>
 InvertedIndexTantivy<T>::~InvertedIndexTantivy() {
+    readahead_released_->store(true);
     if (wrapper_) {
         wrapper_->free();
     }
@@ -128,6 +168,42 @@ InvertedIndexTantivy<T>::~InvertedIndexTantivy() {
     local_chunk_manager->RemoveDir(prefix);
 }
 
+template <typename T>
+void
+InvertedIndexTantivy<T>::ReadaheadTantivyIndex(const std::string& dir) {
+    if (!ENABLE_INDEX_MMAP_READAHEAD.load()) {
+        return;
+    }
+    // a query looks its terms up in the term dictionaries (.term) then reads
+    // the postings with their skip data (.idx), the rest is read last
+    auto rank = [](const std::string& file) {
+        if (boost::algorithm::ends_with(file, ".term")) {
+            return 0;
+        }
+        if (boost::algorithm::ends_with(file, ".idx")) {
+            return 1;
+        }
+        return 2;
+    };
+    std::vector<std::string> files;
+    boost::system::error_code ec;
+    for (const auto& entry : boost::filesystem::directory_iterator(dir, ec)) {
+        if (boost::filesystem::is_regular_file(entry.status(ec))) {
+            files.push_back(entry.path().string());
+        }
+    }
+    std::stable_sort(
+        files.begin(), files.end(), [&](const auto& a, const auto& b) {
+            return rank(a) < rank(b);
+        });
+    auto& pool = ThreadPools::GetThreadPool(ThreadPoolPriority::LOW);
+    pool.Submit([files = std::move(files), released = readahead_released_]() {
+        for (const auto& file : files) {
+            ReadaheadIndexFile(file, released);
+        }
+    });
+}
+
 template <typename T>
 void
 InvertedIndexTantivy<T>::finish() {
@@ -248,7 +324,10 @@ InvertedIndexTantivy<T>::Load(milvus::tracer::TraceContext ctx,
     if (!load_in_mmap) {
         // the index is loaded in ram, so we can remove files in advance
         disk_file_manager_->RemoveIndexFiles();
+    } else {
+        ReadaheadTantivyIndex(prefix);
     }
+    cache_results_ = true;
     ComputeByteSize();
 }
 
@@ -339,8 +418,39 @@ template <typename T>
 const TargetBitmap
 InvertedIndexTantivy<T>::In(size_t n, const T* values) {
     tracer::AutoSpan span("InvertedIndexTantivy::In", tracer::GetRootSpan());
-    TargetBitmap bitset(Count());
-    wrapper_->terms_query(values, n, &bitset);
+    return TermsQuery(n, values);
+}
+
+template <typename T>
+TargetBitmap
+InvertedIndexTantivy<T>::TermsQuery(size_t n, const T* values) {
+    return CachedQuery(
+        ResultCacheKey(CachedQueryKind::kTerms, values, n),
+        [&](TargetBitmap* bitset) {
+            wrapper_->terms_query(values, n, bitset);
+        });
+}
+
+template <typename T>
+template <typename Query>
+TargetBitmap
+InvertedIndexTantivy<T>::CachedQuery(const std::string& key, Query query) {
+    auto capacity = TANTIVY_RESULT_CACHE_CAPACITY.load();
+    if (!cache_results_ || capacity <= 0) {
+        TargetBitmap bitset(Count());
+        query(&bitset);
+        return bitset;
+    }
+    auto count = Count();
+    auto cached = result_cache_.Get(wrapper_.get(), key);
+    if (cached.has_value() &&
+        static_cast<int64_t>(cached->size()) == count) {
+        return std::move(cached.value());
+    }
+    TargetBitmap bitset(count);
+    query(&bitset);
+    result_cache_.Put(
+        wrapper_.get(), key, bitset, static_cast<size_t>(capacity));
     return bitset;
 }
 
@@ -416,8 +526,7 @@ InvertedIndexTantivy<T>::InApplyFilter(
     size_t n, const T* values, const std::function<bool(size_t)>& filter) {
     tracer::AutoSpan span("InvertedIndexTantivy::InApplyFilter",
                           tracer::GetRootSpan());
-    TargetBitmap bitset(Count());
-    wrapper_->terms_query(values, n, &bitset);
+    auto bitset = TermsQuery(n, values);
     // todo(SpadeA): could push-down the filter to tantivy query
     apply_hits_with_filter(bitset, filter);
     return bitset;
@@ -429,8 +538,7 @@ InvertedIndexTantivy<T>::InApplyCallback(
     size_t n, const T* values, const std::function<void(size_t)>& callback) {
     tracer::AutoSpan span("InvertedIndexTantivy::InApplyCallback",
                           tracer::GetRootSpan());
-    TargetBitmap bitset(Count());
-    wrapper_->terms_query(values, n, &bitset);
+    auto bitset = TermsQuery(n, values);
     // todo(SpadeA): could push-down the callback to tantivy query
     apply_hits_with_callback(bitset, callback);
 }
@@ -440,8 +548,7 @@ const TargetBitmap
 InvertedIndexTantivy<T>::NotIn(size_t n, const T* values) {
     tracer::AutoSpan span("InvertedIndexTantivy::NotIn", tracer::GetRootSpan());
     int64_t count = Count();
-    TargetBitmap bitset(count);
-    wrapper_->terms_query(values, n, &bitset);
+    auto bitset = TermsQuery(n, values);
     // The expression is "not" in, so we flip the bit.
     bitset.flip();
 
@@ -467,27 +574,42 @@ template <typename T>
 const TargetBitmap
 InvertedIndexTantivy<T>::Range(const T& value, OpType op) {
     tracer::AutoSpan span("InvertedIndexTantivy::Range", tracer::GetRootSpan());
-    TargetBitmap bitset(Count());
-
+    auto kind = CachedQueryKind::kLessThan;
     switch (op) {
         case OpType::LessThan: {
-            wrapper_->upper_bound_range_query(value, false, &bitset);
+            kind = CachedQueryKind::kLessThan;
         } break;
         case OpType::LessEqual: {
-            wrapper_->upper_bound_range_query(value, true, &bitset);
+            kind = CachedQueryKind::kLessEqual;
         } break;
         case OpType::GreaterThan: {
-            wrapper_->lower_bound_range_query(value, false, &bitset);
+            kind = CachedQueryKind::kGreaterThan;
         } break;
         case OpType::GreaterEqual: {
-            wrapper_->lower_bound_range_query(value, true, &bitset);
+            kind = CachedQueryKind::kGreaterEqual;
         } break;
         default:
             ThrowInfo(OpTypeInvalid,
                       fmt::format("Invalid OperatorType: {}", op));
     }
 
-    return bitset;
+    return CachedQuery(
+        ResultCacheKey(kind, &value, 1), [&](TargetBitmap* bitset) {
+            switch (op) {
+                case OpType::LessThan: {
+                    wrapper_->upper_bound_range_query(value, false, bitset);
+                } break;
+                case OpType::LessEqual: {
+                    wrapper_->upper_bound_range_query(value, true, bitset);
+                } break;
+                case OpType::GreaterThan: {
+                    wrapper_->lower_bound_range_query(value, false, bitset);
+                } break;
+                default: {
+                    wrapper_->lower_bound_range_query(value, true, bitset);
+                } break;
+            }
+        });
 }
 
 template <typename T>
@@ -498,13 +620,17 @@ InvertedIndexTantivy<T>::Range(const T& lower_bound_value,
                                bool ub_inclusive) {
     tracer::AutoSpan span("InvertedIndexTantivy::RangeWithBounds",
                           tracer::GetRootSpan());
-    TargetBitmap bitset(Count());
-    wrapper_->range_query(lower_bound_value,
-                          upper_bound_value,
-                          lb_inclusive,
-                          ub_inclusive,
-                          &bitset);
-    return bitset;
+    auto key = ResultCacheKey(CachedQueryKind::kRange, &lower_bound_value, 1);
+    AppendKeyValue(key, upper_bound_value);
+    AppendKeyValue(key, lb_inclusive);
+    AppendKeyValue(key, ub_inclusive);
+    return CachedQuery(key, [&](TargetBitmap* bitset) {
+        wrapper_->range_query(lower_bound_value,
+                              upper_bound_value,
+                              lb_inclusive,
+                              ub_inclusive,
+                              bitset);
+    });
 }
 
 template <typename T>
@@ -512,10 +638,11 @@ const TargetBitmap
 InvertedIndexTantivy<T>::PrefixMatch(const std::string_view prefix) {
     tracer::AutoSpan span("InvertedIndexTantivy::PrefixMatch",
                           tracer::GetRootSpan());
-    TargetBitmap bitset(Count());
     std::string s(prefix);
-    wrapper_->prefix_query(s, &bitset);
-    return bitset;
+    return CachedQuery(ResultCacheKey(CachedQueryKind::kPrefix, &s, 1),
+                       [&](TargetBitmap* bitset) {
+                           wrapper_->prefix_query(s, bitset);
+                       });
 }
 
 template <typename T>
@@ -543,9 +670,11 @@ InvertedIndexTantivy<T>::PatternQuery(const std::string& pattern) {
                           tracer::GetRootSpan());
     PatternMatchTranslator translator;
     auto regex_pattern = translator(pattern);
-    TargetBitmap bitset(Count());
-    wrapper_->regex_query(regex_pattern, &bitset);
-    return bitset;
+    return CachedQuery(
+        ResultCacheKey(CachedQueryKind::kPattern, &regex_pattern, 1),
+        [&](TargetBitmap* bitset) {
+            wrapper_->regex_query(regex_pattern, bitset);
+        });
 }
 
 template <typename T>
@@ -668,17 +797,28 @@ InvertedIndexTantivy<T>::BuildWithFieldData(
             if (!inverted_index_single_segment_) {
                 int64_t offset = 0;
                 if (schema_.nullable()) {
+                    // the valid rows between two nulls are added in one batch
                     for (const auto& data : field_datas) {
                         auto n = data->get_num_rows();
-                        for (int i = 0; i < n; i++) {
-                            if (!data->is_valid(i)) {
-                                null_offset_.push_back(offset);
+                        auto values = static_cast<const T*>(data->Data());
+                        int64_t valid_begin = 0;
+                        for (int64_t i = 0; i <= n; i++) {
+                            if (i < n && data->is_valid(i)) {
+                                continue;
+                            }
+                            if (i > valid_begin) {
+                                wrapper_->add_data<T>(values + valid_begin,
+                                                      i - valid_begin,
+                                                      offset + valid_begin);
                             }
-                            wrapper_->add_array_data<T>(
-                                static_cast<const T*>(data->RawValue(i)),
-                                data->is_valid(i),
-                                offset++);
+                            if (i < n) {
+                                null_offset_.push_back(offset + i);
+                                wrapper_->add_array_data<T>(
+                                    values + i, 0, offset + i);
+                            }
+                            valid_begin = i + 1;
                         }
+                        offset += n;
                     }
                 } else {
                     for (const auto& data : field_datas) {
@@ -950,7 +1090,10 @@ InvertedIndexTantivy<T>::LoadEntries(storage::IndexEntryReader& reader,
 
     if (!load_in_mmap) {
         disk_file_manager_->RemoveIndexFiles();
+    } else {
+        ReadaheadTantivyIndex(path_);
     }
+    cache_results_ = true;
 
     ComputeByteSize();
 
@@ -13,6 +13,7 @@
 
 #include <folly/SharedMutex.h>
 #include <stdint.h>
+#include <atomic>
 #include <cstddef>
 #include <functional>
 #include <memory>
@@ -26,6 +27,7 @@
 #include "common/EasyAssert.h"
 #include "common/FieldData.h"
 #include "common/FieldDataInterface.h"
+#include "common/PatternMatcherCache.h"
 #include "common/RegexQuery.h"
 #include "common/Utils.h"
 #include "common/Tracer.h"
@@ -35,6 +37,7 @@
 #include "index/IndexStats.h"
 #include "index/Meta.h"
 #include "index/ScalarIndex.h"
+#include "index/TantivyResultCache.h"
 #include "pb/plan.pb.h"
 #include "pb/schema.pb.h"
 #include "rust-array.h"
@@ -260,13 +263,17 @@ class InvertedIndexTantivy : public ScalarIndex<T> {
             }
             case proto::plan::OpType::RegexMatch: {
                 TargetBitmap bitset(Count());
-                PartialRegexMatcher matcher(pattern);
+                auto matcher_ptr =
+                    PatternMatcherCache::GetInstance().GetPartialRegexMatcher(
+                        pattern);
+                const auto& matcher = *matcher_ptr;
                 wrapper_->regex_match_query(
-                    &matcher,
+                    const_cast<PartialRegexMatcher*>(&matcher),
                     [](void* ctx,
                        const uint8_t* term,
                        uintptr_t term_len) -> bool {
-                        auto* matcher = static_cast<PartialRegexMatcher*>(ctx);
+                        auto* matcher =
+                            static_cast<const PartialRegexMatcher*>(ctx);
                         std::string_view term_view(
                             reinterpret_cast<const char*>(term), term_len);
                         return (*matcher)(term_view);
@@ -327,6 +334,17 @@ class InvertedIndexTantivy : public ScalarIndex<T> {
     void
     finish();
 
+    // Runs `query` into a fresh bitset of Count() rows, or answers from
+    // result_cache_ the queries of a loaded index under `key`.
+    template <typename Query>
+    TargetBitmap
+    CachedQuery(const std::string& key, Query query);
+
+    // The rows holding any of the `n` values, tantivy matches all of them
+    // in a single call.
+    TargetBitmap
+    TermsQuery(size_t n, const T* values);
+
     void
     build_index_for_array(
         const std::vector<std::shared_ptr<FieldDataBase>>& field_datas);
@@ -359,6 +377,13 @@ class InvertedIndexTantivy : public ScalarIndex<T> {
     virtual nlohmann::json
     BuildTantivyMeta(const std::vector<std::string>& file_names, bool has_null);
 
+    // Reads the files of the mmap'd tantivy index in `dir` into the page cache
+    // in the background if ENABLE_INDEX_MMAP_READAHEAD, the term dictionaries
+    // and postings before the rest, so the first queries don't fault them in
+    // from disk one page at a time.
+    void
+    ReadaheadTantivyIndex(const std::string& dir);
+
  protected:
     std::shared_ptr<TantivyIndexWrapper> wrapper_;
     TantivyDataType d_type_;
@@ -406,5 +431,14 @@ class InvertedIndexTantivy : public ScalarIndex<T> {
     // `is_nested_index_` can only be true for array data type. When it's true,
     // every element in the array is treated as a separate document in the index.
     bool is_nested_index_{false};
+
+    // Only set by Load and LoadEntries, the tantivy index of a loaded
+    // segment never changes so its results can be cached.
+    bool cache_results_{false};
+    TantivyResultCache result_cache_;
+
+    // tells a background readahead of the mmap'd index files to stop
+    std::shared_ptr<std::atomic<bool>> readahead_released_ =
+        std::make_shared<std::atomic<bool>>(false);
 };
 }  // namespace milvus::index
@@ -18,6 +18,7 @@
 #include "common/FieldDataInterface.h"
 #include "common/Json.h"
 #include "common/JsonCastType.h"
+#include "common/JsonPointer.h"
 #include "common/JsonUtils.h"
 #include "folly/FBVector.h"
 #include "index/JsonIndexBuilder.h"
@@ -45,6 +46,7 @@ ProcessJsonFieldData(
         std::conditional_t<std::is_same_v<T, std::string>, std::string_view, T>;
 
     auto tokens = parse_json_pointer(nested_path);
+    JsonPointer pointer(nested_path);
 
     bool is_array = cast_type.data_type() == JsonCastType::DataType::ARRAY;
 
@@ -60,8 +62,17 @@ ProcessJsonFieldData(
                 continue;
             }
 
-            auto exists = path_exists(json_column->dom_doc(), tokens);
-            if (!exists || !json_column->exist(nested_path)) {
+            // the document is parsed once, the existence check, the type
+            // check and the read below all walk the same DOM
+            simdjson::simdjson_result<simdjson::dom::element> element =
+                simdjson::NO_SUCH_FIELD;
+            auto root = json_column->dom_doc();
+            if (root.error() == simdjson::SUCCESS &&
+                path_exists(root.value_unsafe(), tokens)) {
+                element = pointer.Find(root.value_unsafe());
+            }
+            if (element.error() != simdjson::SUCCESS ||
+                isElementEmpty(element.value_unsafe())) {
                 error_recorder(
                     *json_column, nested_path, simdjson::NO_SUCH_FIELD);
                 non_exist_adder(offset);
@@ -71,8 +82,7 @@ ProcessJsonFieldData(
 
             values.clear();
             if (is_array) {
-                auto doc = json_column->dom_doc();
-                auto array_res = doc.at_pointer(nested_path).get_array();
+                auto array_res = element.value_unsafe().get_array();
                 if (array_res.error() != simdjson::SUCCESS) {
                     error_recorder(
                         *json_column, nested_path, array_res.error());
@@ -88,14 +98,14 @@ ProcessJsonFieldData(
                 }
             } else {
                 if (cast_function.match<T>()) {
-                    auto res = JsonCastFunction::CastJsonValue<T>(
-                        cast_function, *json_column, nested_path);
+                    auto res = JsonCastFunction::CastJsonElement<T>(
+                        cast_function, element.value_unsafe());
                     if (res.has_value()) {
                         values.push_back(res.value());
                     }
                 } else {
-                    value_result<SIMDJSON_T> res =
-                        json_column->at<SIMDJSON_T>(nested_path);
+                    auto res =
+                        element.value_unsafe().template get<SIMDJSON_T>();
                     if (res.error() != simdjson::SUCCESS) {
                         error_recorder(*json_column, nested_path, res.error());
                     } else {
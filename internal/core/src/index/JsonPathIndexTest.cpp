@@ -19,6 +19,7 @@
 
 #include "common/FieldData.h"
 #include "common/Json.h"
+#include "common/JsonCastFunction.h"
 #include "common/JsonCastType.h"
 #include "common/Schema.h"
 #include "common/Types.h"
@@ -209,6 +210,45 @@ TEST(JsonPathIndexTest, ConvertVarchar) {
     EXPECT_EQ(result.non_exist_offsets[0], 2);
 }
 
+TEST(JsonPathIndexTest, ConvertDouble_StringToDoubleCast) {
+    auto json_fd = MakeJsonFieldData({
+        R"({"a": {"b": "1.5"}})",  // 0: string cast to double
+        R"({"a": {"b": 2}})",      // 1: integer
+        R"({"a": {"b": 2.5}})",    // 2: double
+        R"({"a": {"b": "x"}})",    // 3: string that is not a number
+        R"({"a": {"b": true}})",   // 4: bool, cast fails
+        R"({"a": {"c": 1}})",      // 5: path not exist
+        R"({"a": {"b": {}}})",     // 6: empty object, not exist
+    });
+    auto schema = MakeJsonSchema();
+    auto result = ConvertJsonToTypedFieldData<double>(
+        {json_fd},
+        schema,
+        "/a/b",
+        JsonCastType::FromString("DOUBLE"),
+        JsonCastFunction::FromString("STRING_TO_DOUBLE"));
+
+    auto& fd = result.field_data;
+    EXPECT_EQ(fd->get_num_rows(), 7);
+    auto value = [&](int i) {
+        return *static_cast<const double*>(fd->RawValue(i));
+    };
+    EXPECT_TRUE(fd->is_valid(0));
+    EXPECT_DOUBLE_EQ(value(0), 1.5);
+    EXPECT_TRUE(fd->is_valid(1));
+    EXPECT_DOUBLE_EQ(value(1), 2.0);
+    EXPECT_TRUE(fd->is_valid(2));
+    EXPECT_DOUBLE_EQ(value(2), 2.5);
+    EXPECT_FALSE(fd->is_valid(3));
+    EXPECT_FALSE(fd->is_valid(4));
+    EXPECT_FALSE(fd->is_valid(5));
+    EXPECT_FALSE(fd->is_valid(6));
+
+    ASSERT_EQ(result.non_exist_offsets.size(), 2);
+    EXPECT_EQ(result.non_exist_offsets[0], 5);
+    EXPECT_EQ(result.non_exist_offsets[1], 6);
+}
+
 // ============================================================
 // 2. JsonScalarIndexWrapper tests (Sort + Bitmap)
 // ============================================================
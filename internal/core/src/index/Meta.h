@@ -77,6 +77,9 @@ constexpr const char* HYBRID_LOW_CARDINALITY_INDEX_TYPE =
     "hybrid_low_cardinality_index_type";
 constexpr const char* HYBRID_HIGH_CARDINALITY_INDEX_TYPE =
     "hybrid_high_cardinality_index_type";
+// answer integral ranges on a BITMAP (or HYBRID with BITMAP inside) index
+// from bit-sliced bitmaps built on load
+constexpr const char* BITMAP_BIT_SLICED_RANGE = "bitmap_bit_sliced_range";
 
 // index config key
 constexpr const char* MMAP_FILE_PATH = "mmap_filepath";
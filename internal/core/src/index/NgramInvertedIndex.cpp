@@ -15,8 +15,10 @@
 #include <simdjson.h>
 #include <string.h>
 #include <algorithm>
+#include <cctype>
 #include <chrono>
 #include <cstdint>
+#include <cstdlib>
 #include <exception>
 #include <map>
 #include <string_view>
@@ -29,11 +31,13 @@
 #include "common/Json.h"
 #include "common/JsonCastFunction.h"
 #include "common/JsonCastType.h"
+#include "common/PatternMatcherCache.h"
 #include "common/RegexQuery.h"
 #include "exec/expression/Expr.h"
 #include "glog/logging.h"
 #include "index/JsonIndexBuilder.h"
 #include "index/Meta.h"
+#include "index/ParallelBuild.h"
 #include "index/Utils.h"
 #include "knowhere/binaryset.h"
 #include "log/Log.h"
@@ -75,6 +79,9 @@ constexpr size_t kMaxIterationsForMediumRow = 3;
 constexpr double kBreakThresholdForSmallRow = 0.01;  // 1%
 constexpr size_t kMaxIterationsForSmallRow = 2;
 
+// tantivy runs at most 8 indexing threads in one index writer
+constexpr uintptr_t kMaxNgramWriterThreads = 8;
+
 // for string/varchar type
 NgramInvertedIndex::NgramInvertedIndex(const storage::FileManagerContext& ctx,
                                        const NgramParams& params)
@@ -92,8 +99,17 @@ NgramInvertedIndex::NgramInvertedIndex(const storage::FileManagerContext& ctx,
         d_type_ = TantivyDataType::Keyword;
         std::string field_name =
             std::to_string(disk_file_manager_->GetFieldDataMeta().field_id);
+        // the n-grams of the rows are extracted by the indexing threads of
+        // the writer, each one with the memory budget of a default writer
+        auto num_threads = std::min<uintptr_t>(ScalarIndexBuildParallelism(),
+                                               kMaxNgramWriterThreads);
         wrapper_ = std::make_shared<TantivyIndexWrapper>(
-            field_name.c_str(), path_.c_str(), min_gram_, max_gram_);
+            field_name.c_str(),
+            path_.c_str(),
+            min_gram_,
+            max_gram_,
+            num_threads,
+            num_threads * DEFAULT_OVERALL_MEMORY_BUDGET_IN_BYTES);
     }
 }
 
@@ -311,6 +327,8 @@ NgramInvertedIndex::Load(milvus::tracer::TraceContext ctx,
     if (!load_in_mmap) {
         // the index is loaded in ram, so we can remove files in advance
         disk_file_manager_->RemoveNgramIndexFiles();
+    } else {
+        ReadaheadTantivyIndex(path_);
     }
 
     LOG_INFO(
@@ -347,6 +365,225 @@ split_by_wildcard(const std::string& literal) {
     return result;
 }
 
+namespace {
+
+// RE2 flag groups are (?flags) or (?flags:...) where flags are only
+// [imsU-].  Named groups like (?P<id>...) or (?<name>...) must NOT
+// be mistaken for flag groups.
+bool
+has_case_insensitive_flag(const std::string& pattern) {
+    for (size_t i = 0; i + 2 < pattern.size(); ++i) {
+        if (pattern[i] == '(' && pattern[i + 1] == '?') {
+            // Scan flag characters: only [imsU-] are valid flags
+            for (size_t j = i + 2; j < pattern.size(); ++j) {
+                char fc = pattern[j];
+                if (fc == ')' || fc == ':')
+                    break;
+                if (fc == 'i')
+                    return true;
+                // If we hit a non-flag character, this is not a flag
+                // group (e.g. (?P<...), (?<...), (?'...'))
+                if (fc != 'm' && fc != 's' && fc != 'U' && fc != '-') {
+                    break;
+                }
+            }
+        }
+    }
+    return false;
+}
+
+// Index of the ']' closing the character class opened at pattern[open];
+// a ']' right after '[' or '[^' is a member, not the end.
+size_t
+skip_char_class(const std::string& pattern, size_t open) {
+    size_t i = open + 1;
+    if (i < pattern.size() && pattern[i] == '^')
+        ++i;
+    if (i < pattern.size() && pattern[i] == ']')
+        ++i;
+    for (; i < pattern.size(); ++i) {
+        if (pattern[i] == '\\') {
+            ++i;
+            continue;
+        }
+        if (pattern[i] == ']')
+            return i;
+    }
+    return pattern.size();
+}
+
+// Index of the ')' closing the group opened at pattern[open], npos if the
+// group is not closed.
+size_t
+find_group_close(const std::string& pattern, size_t open) {
+    int depth = 0;
+    for (size_t i = open; i < pattern.size(); ++i) {
+        char c = pattern[i];
+        if (c == '\\') {
+            ++i;
+        } else if (c == '[') {
+            i = skip_char_class(pattern, i);
+        } else if (c == '(') {
+            ++depth;
+        } else if (c == ')' && --depth == 0) {
+            return i;
+        }
+    }
+    return std::string::npos;
+}
+
+// The branches of the alternations at the outermost level of `pattern`,
+// the pattern itself if it has none.
+std::vector<std::string>
+split_top_level_alternation(const std::string& pattern) {
+    std::vector<std::string> branches;
+    int depth = 0;
+    size_t start = 0;
+    for (size_t i = 0; i < pattern.size(); ++i) {
+        char c = pattern[i];
+        if (c == '\\') {
+            ++i;
+        } else if (c == '[') {
+            i = skip_char_class(pattern, i);
+        } else if (c == '(') {
+            ++depth;
+        } else if (c == ')') {
+            --depth;
+        } else if (c == '|' && depth == 0) {
+            branches.push_back(pattern.substr(start, i - start));
+            start = i + 1;
+        }
+    }
+    branches.push_back(pattern.substr(start));
+    return branches;
+}
+
+bool
+contains_alternation(const std::string& pattern) {
+    for (size_t i = 0; i < pattern.size(); ++i) {
+        char c = pattern[i];
+        if (c == '\\') {
+            ++i;
+        } else if (c == '[') {
+            i = skip_char_class(pattern, i);
+        } else if (c == '|') {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Content of a group without its (?:, (?P<name>, (?flags: prefix.
+std::string
+group_body(const std::string& group) {
+    if (group.empty() || group[0] != '?') {
+        return group;
+    }
+    bool named = group.size() > 1 &&
+                 (group[1] == 'P' || group[1] == '<' || group[1] == '\'');
+    size_t end = named ? group.find_first_of(">'", 2) : group.find(':');
+    return end == std::string::npos ? std::string() : group.substr(end + 1);
+}
+
+// Whether the quantifier at pattern[pos] lets the preceding group match
+// zero times, and where the quantifier ends.
+std::pair<bool, size_t>
+parse_group_quantifier(const std::string& pattern, size_t pos) {
+    if (pos >= pattern.size()) {
+        return {false, pos};
+    }
+    bool optional = false;
+    size_t end = pos;
+    char q = pattern[pos];
+    if (q == '?' || q == '*') {
+        optional = true;
+        end = pos + 1;
+    } else if (q == '+') {
+        end = pos + 1;
+    } else if (q == '{') {
+        size_t close = pattern.find('}', pos);
+        if (close == std::string::npos || close == pos + 1 ||
+            !std::isdigit(static_cast<unsigned char>(pattern[pos + 1]))) {
+            return {false, pos};
+        }
+        optional = std::atoi(pattern.c_str() + pos + 1) == 0;
+        end = close + 1;
+    } else {
+        return {false, pos};
+    }
+    // lazy form, e.g. `*?`
+    if (end < pattern.size() && pattern[end] == '?') {
+        ++end;
+    }
+    return {optional, end};
+}
+
+RegexLiteralQuery
+build_literal_query_impl(const std::string& pattern) {
+    auto branches = split_top_level_alternation(pattern);
+    if (branches.size() > 1) {
+        RegexLiteralQuery query;
+        query.kind = RegexLiteralQuery::Kind::Or;
+        for (const auto& branch : branches) {
+            auto child = build_literal_query_impl(branch);
+            if (child.kind == RegexLiteralQuery::Kind::All) {
+                // a branch without literals lets any row through
+                return {};
+            }
+            query.children.push_back(std::move(child));
+        }
+        return query;
+    }
+
+    // Carve the groups holding an alternation out of the sequence: each
+    // becomes an Or child, and its place in the remaining pattern is taken
+    // by `.*`, which breaks the literal runs around it without adding any.
+    RegexLiteralQuery query;
+    query.kind = RegexLiteralQuery::Kind::And;
+    std::string rest;
+    for (size_t i = 0; i < pattern.size();) {
+        char c = pattern[i];
+        if (c == '\\') {
+            rest.append(pattern, i, 2);
+            i += 2;
+        } else if (c == '[') {
+            auto close = skip_char_class(pattern, i);
+            rest.append(pattern, i, close - i + 1);
+            i = close + 1;
+        } else if (c == '(') {
+            auto close = find_group_close(pattern, i);
+            if (close == std::string::npos) {
+                return {};
+            }
+            auto group = pattern.substr(i + 1, close - i - 1);
+            if (!contains_alternation(group)) {
+                rest.append(pattern, i, close - i + 1);
+                i = close + 1;
+                continue;
+            }
+            auto [optional, end] = parse_group_quantifier(pattern, close + 1);
+            if (!optional) {
+                auto child = build_literal_query_impl(group_body(group));
+                if (child.kind != RegexLiteralQuery::Kind::All) {
+                    query.children.push_back(std::move(child));
+                }
+            }
+            rest += ".*";
+            i = end;
+        } else {
+            rest += c;
+            ++i;
+        }
+    }
+    query.literals = extract_literals_from_regex(rest);
+    if (query.literals.empty() && query.children.empty()) {
+        return {};
+    }
+    return query;
+}
+
+}  // namespace
+
 // Extract runs of literal bytes from a regex pattern that are GUARANTEED to
 // appear in any matching string.  Only these "required literals" are safe to
 // use as AND-conditions in the ngram coarse filter.
@@ -428,25 +665,8 @@ extract_literals_from_regex(const std::string& pattern) {
     }
 
     // ── Pre-scan: bail out on case-insensitive flag (?i), (?mi), etc. ──
-    // RE2 flag groups are (?flags) or (?flags:...) where flags are only
-    // [imsU-].  Named groups like (?P<id>...) or (?<name>...) must NOT
-    // be mistaken for flag groups.
-    for (size_t i = 0; i + 2 < pattern.size(); ++i) {
-        if (pattern[i] == '(' && pattern[i + 1] == '?') {
-            // Scan flag characters: only [imsU-] are valid flags
-            for (size_t j = i + 2; j < pattern.size(); ++j) {
-                char fc = pattern[j];
-                if (fc == ')' || fc == ':')
-                    break;
-                if (fc == 'i')
-                    return {};  // case-insensitive
-                // If we hit a non-flag character, this is not a flag
-                // group (e.g. (?P<...), (?<...), (?'...'))
-                if (fc != 'm' && fc != 's' && fc != 'U' && fc != '-') {
-                    break;
-                }
-            }
-        }
+    if (has_case_insensitive_flag(pattern)) {
+        return {};
     }
 
     // ── Parse {n}, {n,}, {n,m} quantifier ──
@@ -793,35 +1013,30 @@ extract_literals_from_regex(const std::string& pattern) {
     return result;
 }
 
+RegexLiteralQuery
+build_regex_literal_query(const std::string& pattern) {
+    if (has_case_insensitive_flag(pattern)) {
+        return {};
+    }
+    return build_literal_query_impl(pattern);
+}
+
 bool
 NgramInvertedIndex::CanHandleLiteral(const std::string& literal,
                                      proto::plan::OpType op_type) const {
     switch (op_type) {
         case proto::plan::OpType::Match: {
-            // For Match (LIKE pattern), check all parts after splitting by wildcard
+            // For Match (LIKE pattern), one part after splitting by wildcard
+            // long enough to have grams is a filter; phase 2 verifies the
+            // rest of the pattern either way
             auto literals = split_by_wildcard(literal);
-            if (literals.empty()) {
-                return false;
-            }
-            for (const auto& l : literals) {
-                if (l.length() < min_gram_) {
-                    return false;
-                }
-            }
-            return true;
-        }
-        case proto::plan::OpType::RegexMatch: {
-            auto literals = extract_literals_from_regex(literal);
-            if (literals.empty()) {
-                return false;
-            }
-            for (const auto& l : literals) {
-                if (l.length() >= min_gram_) {
-                    return true;
-                }
-            }
-            return false;
+            return std::any_of(
+                literals.begin(), literals.end(), [&](const std::string& l) {
+                    return l.length() >= min_gram_;
+                });
         }
+        case proto::plan::OpType::RegexMatch:
+            return ConstrainsRows(build_regex_literal_query(literal));
         case proto::plan::OpType::InnerMatch:
         case proto::plan::OpType::PrefixMatch:
         case proto::plan::OpType::PostfixMatch:
@@ -892,6 +1107,68 @@ NgramInvertedIndex::ShouldUseBatchStrategy(double pre_filter_hit_rate) const {
             pre_filter_hit_rate > kPreFilterHitRateThreshold);
 }
 
+bool
+NgramInvertedIndex::ConstrainsRows(const RegexLiteralQuery& query) const {
+    switch (query.kind) {
+        case RegexLiteralQuery::Kind::And:
+            return std::any_of(query.literals.begin(),
+                               query.literals.end(),
+                               [&](const std::string& l) {
+                                   return l.length() >= min_gram_;
+                               }) ||
+                   std::any_of(query.children.begin(),
+                               query.children.end(),
+                               [&](const RegexLiteralQuery& child) {
+                                   return ConstrainsRows(child);
+                               });
+        case RegexLiteralQuery::Kind::Or:
+            return !query.children.empty() &&
+                   std::all_of(query.children.begin(),
+                               query.children.end(),
+                               [&](const RegexLiteralQuery& child) {
+                                   return ConstrainsRows(child);
+                               });
+        default:
+            return false;
+    }
+}
+
+std::optional<TargetBitmap>
+NgramInvertedIndex::EvalLiteralQuery(const RegexLiteralQuery& query,
+                                     size_t total_count) {
+    if (!ConstrainsRows(query)) {
+        return std::nullopt;
+    }
+    if (query.kind == RegexLiteralQuery::Kind::Or) {
+        TargetBitmap rows(total_count, false);
+        for (const auto& child : query.children) {
+            rows |= EvalLiteralQuery(child, total_count).value();
+        }
+        return rows;
+    }
+    std::optional<TargetBitmap> rows;
+    auto intersect = [&](TargetBitmap&& bits) {
+        if (rows.has_value()) {
+            rows.value() &= bits;
+        } else {
+            rows = std::move(bits);
+        }
+    };
+    for (const auto& l : query.literals) {
+        if (l.length() >= min_gram_) {
+            TargetBitmap bits{total_count};
+            wrapper_->ngram_match_query(l, min_gram_, max_gram_, &bits);
+            intersect(std::move(bits));
+        }
+    }
+    for (const auto& child : query.children) {
+        if (auto bits = EvalLiteralQuery(child, total_count)) {
+            intersect(std::move(bits.value()));
+        }
+    }
+    return rows;
+}
+
 void
 NgramInvertedIndex::ExecutePhase1(const std::string& literal,
                                   proto::plan::OpType op_type,
@@ -919,27 +1196,35 @@ NgramInvertedIndex::ExecutePhase1(const std::string& literal,
 
     // Get literals to query
     std::vector<std::string> literals_vec;
+    // rows matching a regex with alternations, from its boolean query
+    std::optional<TargetBitmap> query_rows;
     if (op_type == proto::plan::OpType::Match) {
-        literals_vec = split_by_wildcard(literal);
-        AssertInfo(!literals_vec.empty(),
-                   "ExecutePhase1: Match pattern must have non-empty parts");
-        for (const auto& l : literals_vec) {
-            AssertInfo(l.length() >= min_gram_,
-                       "ExecutePhase1: part length {} < min_gram {}",
-                       l.length(),
-                       min_gram_);
-        }
-    } else if (op_type == proto::plan::OpType::RegexMatch) {
-        auto all_literals = extract_literals_from_regex(literal);
-        // Only keep literals that are long enough for ngram
-        for (const auto& l : all_literals) {
+        // Only keep parts that are long enough for ngram
+        for (auto& l : split_by_wildcard(literal)) {
             if (l.length() >= min_gram_) {
-                literals_vec.push_back(l);
+                literals_vec.push_back(std::move(l));
             }
         }
         AssertInfo(!literals_vec.empty(),
+                   "ExecutePhase1: Match pattern must have a part of at "
+                   "least min_gram {}",
+                   min_gram_);
+    } else if (op_type == proto::plan::OpType::RegexMatch) {
+        auto query = build_regex_literal_query(literal);
+        AssertInfo(ConstrainsRows(query),
                    "ExecutePhase1: RegexMatch pattern must have non-empty "
                    "literals >= min_gram");
+        if (query.kind == RegexLiteralQuery::Kind::Or ||
+            !query.children.empty()) {
+            query_rows = EvalLiteralQuery(query, total_count);
+        } else {
+            // Only keep literals that are long enough for ngram
+            for (const auto& l : query.literals) {
+                if (l.length() >= min_gram_) {
+                    literals_vec.push_back(l);
+                }
+            }
+        }
     } else {
         AssertInfo(literal.length() >= min_gram_,
                    "ExecutePhase1: literal length {} < min_gram {}",
@@ -948,10 +1233,13 @@ NgramInvertedIndex::ExecutePhase1(const std::string& literal,
         literals_vec.push_back(literal);
     }
 
-    bool use_batch_strategy = ShouldUseBatchStrategy(candidates_hit_rate);
+    bool use_batch_strategy =
+        query_rows.has_value() || ShouldUseBatchStrategy(candidates_hit_rate);
 
     // Choose strategy and execute, AND results into candidates
-    if (use_batch_strategy) {
+    if (query_rows.has_value()) {
+        candidates &= query_rows.value();
+    } else if (use_batch_strategy) {
         // Batch strategy: query all ngram terms at once
         for (const auto& l : literals_vec) {
             TargetBitmap ngram_bitset{total_count};
@@ -1065,7 +1353,10 @@ NgramInvertedIndex::ExecutePhase2(const std::string& literal,
             }
             case proto::plan::OpType::Match: {
                 // Use LikePatternMatcher optimized for LIKE patterns
-                LikePatternMatcher matcher(literal);
+                auto matcher_ptr =
+                    PatternMatcherCache::GetInstance().GetLikePatternMatcher(
+                        literal);
+                const auto& matcher = *matcher_ptr;
                 apply_predicate([&matcher, this](const milvus::Json& data) {
                     auto x =
                         data.template at<std::string_view>(this->nested_path_);
@@ -1077,7 +1368,10 @@ NgramInvertedIndex::ExecutePhase2(const std::string& literal,
                 break;
             }
             case proto::plan::OpType::RegexMatch: {
-                PartialRegexMatcher matcher(literal);
+                auto matcher_ptr =
+                    PatternMatcherCache::GetInstance().GetPartialRegexMatcher(
+                        literal);
+                const auto& matcher = *matcher_ptr;
                 apply_predicate([&matcher, this](const milvus::Json& data) {
                     auto x =
                         data.template at<std::string_view>(this->nested_path_);
@@ -1129,14 +1423,20 @@ NgramInvertedIndex::ExecutePhase2(const std::string& literal,
             }
             case proto::plan::OpType::Match: {
                 // Use LikePatternMatcher optimized for LIKE patterns
-                LikePatternMatcher matcher(literal);
+                auto matcher_ptr =
+                    PatternMatcherCache::GetInstance().GetLikePatternMatcher(
+                        literal);
+                const auto& matcher = *matcher_ptr;
                 apply_predicate([&matcher](const std::string_view& data) {
                     return matcher(data);
                 });
                 break;
             }
             case proto::plan::OpType::RegexMatch: {
-                PartialRegexMatcher matcher(literal);
+                auto matcher_ptr =
+                    PatternMatcherCache::GetInstance().GetPartialRegexMatcher(
+                        literal);
+                const auto& matcher = *matcher_ptr;
                 apply_predicate([&matcher](const std::string_view& data) {
                     return matcher(data);
                 });
@@ -28,6 +28,23 @@ namespace milvus::index {
 std::vector<std::string>
 extract_literals_from_regex(const std::string& pattern);
 
+// Boolean query over literals that every string matching a regex satisfies,
+// built the way Google Code Search derives trigram queries: alternations at
+// the top level or inside a required group become Or nodes, and the literals
+// extract_literals_from_regex finds around them are ANDed with those.
+// An All node constrains nothing; like the extraction this errs towards All.
+struct RegexLiteralQuery {
+    enum class Kind { All, And, Or };
+    Kind kind{Kind::All};
+    // And: literals every match contains
+    std::vector<std::string> literals;
+    // And: sub-queries every match satisfies; Or: the alternatives
+    std::vector<RegexLiteralQuery> children;
+};
+
+RegexLiteralQuery
+build_regex_literal_query(const std::string& pattern);
+
 class NgramInvertedIndex : public InvertedIndexTantivy<std::string> {
  public:
     // for string/varchar type
@@ -126,6 +143,16 @@ class NgramInvertedIndex : public InvertedIndexTantivy<std::string> {
     bool
     ShouldUseBatchStrategy(double pre_filter_hit_rate) const;
 
+    // Whether `query` rules out any row once literals shorter than
+    // min_gram_ are ignored
+    bool
+    ConstrainsRows(const RegexLiteralQuery& query) const;
+
+    // Rows that may satisfy `query` by their ngram postings, nullopt when
+    // it rules out none
+    std::optional<TargetBitmap>
+    EvalLiteralQuery(const RegexLiteralQuery& query, size_t total_count);
+
     uintptr_t min_gram_{0};
     uintptr_t max_gram_{0};
     int64_t field_id_{0};
@@ -385,10 +385,17 @@ TEST(NgramIndex, TestNgramSimple) {
                          proto::plan::OpType::Match,
                          std::vector<bool>(10000, true));
 
-    // should be forwarded to brute force
+    // "s" is shorter than min_gram, "ary" alone filters and phase 2
+    // verifies the whole pattern
     test_ngram_with_data(data,
                          "%ary%s%",
                          proto::plan::OpType::Match,
+                         std::vector<bool>(10000, true));
+
+    // should be forwarded to brute force
+    test_ngram_with_data(data,
+                         "%a%s%",
+                         proto::plan::OpType::Match,
                          std::vector<bool>(10000, true),
                          true);
 
@@ -398,6 +405,83 @@ TEST(NgramIndex, TestNgramSimple) {
                          std::vector<bool>(10000, true));
 }
 
+TEST(NgramIndex, TestNgramRegexAlternation) {
+    boost::container::vector<std::string> data;
+    std::vector<std::string> lines = {"error: disk full",
+                                      "warning: disk almost full",
+                                      "info: disk ok",
+                                      "error: network down"};
+    for (int i = 0; i < 1000; ++i) {
+        data.push_back(lines[i % lines.size()]);
+    }
+    auto expect_rows = [&](const std::vector<bool>& per_line) {
+        std::vector<bool> expected;
+        for (size_t i = 0; i < data.size(); ++i) {
+            expected.push_back(per_line[i % lines.size()]);
+        }
+        return expected;
+    };
+
+    test_ngram_with_data(data,
+                         "(error|warning): disk",
+                         proto::plan::OpType::RegexMatch,
+                         expect_rows({true, true, false, false}));
+    test_ngram_with_data(data,
+                         "network|almost",
+                         proto::plan::OpType::RegexMatch,
+                         expect_rows({false, true, false, true}));
+    test_ngram_with_data(data,
+                         "disk (ok|full)$",
+                         proto::plan::OpType::RegexMatch,
+                         expect_rows({true, false, true, false}));
+    // an optional alternation drops out, the literals after it still filter
+    test_ngram_with_data(data,
+                         "(?:error|warning)?: disk (almost )?full",
+                         proto::plan::OpType::RegexMatch,
+                         expect_rows({true, true, false, false}));
+    // a branch without literals lets every row through
+    test_ngram_with_data(data,
+                         "error|.",
+                         proto::plan::OpType::RegexMatch,
+                         expect_rows({true, true, true, true}),
+                         true);
+}
+
+TEST(NgramIndex, BuildRegexLiteralQuery) {
+    using Kind = index::RegexLiteralQuery::Kind;
+    using index::build_regex_literal_query;
+
+    auto plain = build_regex_literal_query("abc.*def");
+    EXPECT_EQ(plain.kind, Kind::And);
+    EXPECT_EQ(plain.literals, (std::vector<std::string>{"abc", "def"}));
+    EXPECT_TRUE(plain.children.empty());
+
+    auto top = build_regex_literal_query("foo|ba[rz]x");
+    ASSERT_EQ(top.kind, Kind::Or);
+    ASSERT_EQ(top.children.size(), 2);
+    EXPECT_EQ(top.children[0].literals, (std::vector<std::string>{"foo"}));
+    EXPECT_EQ(top.children[1].literals,
+              (std::vector<std::string>{"ba", "x"}));
+
+    auto nested = build_regex_literal_query("id=(?P<kind>user|group)s+ ok");
+    ASSERT_EQ(nested.kind, Kind::And);
+    EXPECT_EQ(nested.literals, (std::vector<std::string>{"id=", "s", "s ok"}));
+    ASSERT_EQ(nested.children.size(), 1);
+    EXPECT_EQ(nested.children[0].kind, Kind::Or);
+    EXPECT_EQ(nested.children[0].children[1].literals,
+              (std::vector<std::string>{"group"}));
+
+    // '|' inside a class or escaped is not an alternation
+    auto literal_bar = build_regex_literal_query("a[|]b\\|c");
+    EXPECT_EQ(literal_bar.kind, Kind::And);
+    EXPECT_TRUE(literal_bar.children.empty());
+
+    EXPECT_EQ(build_regex_literal_query("abc|").kind, Kind::All);
+    EXPECT_EQ(build_regex_literal_query("x(ab|cd)*").kind, Kind::And);
+    EXPECT_TRUE(build_regex_literal_query("x(ab|cd)*").children.empty());
+    EXPECT_EQ(build_regex_literal_query("(?i)foo|bar").kind, Kind::All);
+}
+
 // Test that ngram index should only be used for like operations
 // (Match, InnerMatch, PrefixMatch, PostfixMatch)
 // and NOT for other operations (Equal, NotEqual, In, NotIn, etc.)
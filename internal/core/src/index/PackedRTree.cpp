@@ -0,0 +1,396 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include "index/PackedRTree.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <numeric>
+
+#include <xsimd/xsimd.hpp>
+
+#include "common/EasyAssert.h"
+#include "common/SimdUtil.h"
+
+namespace milvus::index {
+
+namespace {
+
+constexpr uint64_t kMagic = 0x6565727472706d76;  // "vmprtree"
+constexpr uint32_t kVersion = 1;
+
+static_assert(PackedRTree::kNodeSize <= 32,
+              "the children of a node are tested into a 32 bit mask");
+
+struct Header {
+    uint64_t magic;
+    uint32_t version;
+    uint32_t node_size;
+    uint64_t num_items;
+    uint64_t num_nodes;
+    uint64_t num_levels;
+};
+
+// Offset of the level bounds, then of the k-th node array.
+size_t
+LevelBoundsOffset() {
+    return sizeof(Header);
+}
+
+size_t
+ArrayOffset(uint64_t num_levels, uint64_t num_nodes, size_t k) {
+    return LevelBoundsOffset() + num_levels * sizeof(uint64_t) +
+           k * num_nodes * sizeof(double);
+}
+
+size_t
+TreeSize(uint64_t num_levels, uint64_t num_nodes) {
+    return ArrayOffset(num_levels, num_nodes, 5);
+}
+
+// Position of (x, y) along a Hilbert curve over a 2^16 x 2^16 grid, after
+// rawrunprotected's "Fast Hilbert curve generation, sorting, and range
+// queries".
+uint32_t
+HilbertValue(uint32_t x, uint32_t y) {
+    uint32_t a = x ^ y;
+    uint32_t b = 0xFFFF ^ a;
+    uint32_t c = 0xFFFF ^ (x | y);
+    uint32_t d = x & (y ^ 0xFFFF);
+
+    uint32_t A = a | (b >> 1);
+    uint32_t B = (a >> 1) ^ a;
+    uint32_t C = ((c >> 1) ^ (b & (d >> 1))) ^ c;
+    uint32_t D = ((a & (c >> 1)) ^ (d >> 1)) ^ d;
+
+    a = A;
+    b = B;
+    c = C;
+    d = D;
+    A = ((a & (a >> 2)) ^ (b & (b >> 2)));
+    B = ((a & (b >> 2)) ^ (b & ((a ^ b) >> 2)));
+    C ^= ((a & (c >> 2)) ^ (b & (d >> 2)));
+    D ^= ((b & (c >> 2)) ^ ((a ^ b) & (d >> 2)));
+
+    a = A;
+    b = B;
+    c = C;
+    d = D;
+    A = ((a & (a >> 4)) ^ (b & (b >> 4)));
+    B = ((a & (b >> 4)) ^ (b & ((a ^ b) >> 4)));
+    C ^= ((a & (c >> 4)) ^ (b & (d >> 4)));
+    D ^= ((b & (c >> 4)) ^ ((a ^ b) & (d >> 4)));
+
+    a = A;
+    b = B;
+    c = C;
+    d = D;
+    C ^= ((a & (c >> 8)) ^ (b & (d >> 8)));
+    D ^= ((b & (c >> 8)) ^ ((a ^ b) & (d >> 8)));
+
+    a = C ^ (C >> 1);
+    b = D ^ (D >> 1);
+
+    uint32_t i0 = x ^ y;
+    uint32_t i1 = b | (0xFFFF ^ (i0 | a));
+
+    i0 = (i0 | (i0 << 8)) & 0x00FF00FF;
+    i0 = (i0 | (i0 << 4)) & 0x0F0F0F0F;
+    i0 = (i0 | (i0 << 2)) & 0x33333333;
+    i0 = (i0 | (i0 << 1)) & 0x55555555;
+
+    i1 = (i1 | (i1 << 8)) & 0x00FF00FF;
+    i1 = (i1 | (i1 << 4)) & 0x0F0F0F0F;
+    i1 = (i1 | (i1 << 2)) & 0x33333333;
+    i1 = (i1 | (i1 << 1)) & 0x55555555;
+
+    return (i1 << 1) | i0;
+}
+
+// Scales `value` of [min, min + extent] to the Hilbert grid.
+uint32_t
+ToGrid(double value, double min, double extent) {
+    constexpr double kMaxCell = 0xFFFF;
+    auto cell = extent > 0 ? (value - min) / extent * kMaxCell : 0.0;
+    // also catches NaN
+    if (!(cell > 0)) {
+        return 0;
+    }
+    return static_cast<uint32_t>(std::min(cell, kMaxCell));
+}
+
+}  // namespace
+
+PackedRTree
+PackedRTree::Build(const std::vector<Box>& boxes,
+                   const std::vector<int64_t>& offsets) {
+    AssertInfo(boxes.size() == offsets.size(),
+               "got {} boxes for {} row offsets",
+               boxes.size(),
+               offsets.size());
+    AssertInfo(boxes.size() <= std::numeric_limits<uint32_t>::max(),
+               "too many boxes to pack: {}",
+               boxes.size());
+    uint64_t num_items = boxes.size();
+    uint64_t num_nodes = num_items;
+    std::vector<uint64_t> level_bounds;
+    if (num_items > 0) {
+        level_bounds.push_back(num_nodes);
+        auto level_size = num_items;
+        do {
+            level_size = (level_size + kNodeSize - 1) / kNodeSize;
+            num_nodes += level_size;
+            level_bounds.push_back(num_nodes);
+        } while (level_size != 1);
+    }
+    uint64_t num_levels = level_bounds.size();
+
+    PackedRTree tree;
+    tree.owned_.resize(TreeSize(num_levels, num_nodes));
+    auto* data = tree.owned_.data();
+    Header header{
+        kMagic, kVersion, kNodeSize, num_items, num_nodes, num_levels};
+    memcpy(data, &header, sizeof(header));
+    memcpy(data + LevelBoundsOffset(),
+           level_bounds.data(),
+           num_levels * sizeof(uint64_t));
+    auto array = [&](size_t k) {
+        return data + ArrayOffset(num_levels, num_nodes, k);
+    };
+    auto* min_x = reinterpret_cast<double*>(array(0));
+    auto* min_y = reinterpret_cast<double*>(array(1));
+    auto* max_x = reinterpret_cast<double*>(array(2));
+    auto* max_y = reinterpret_cast<double*>(array(3));
+    auto* refs = reinterpret_cast<int64_t*>(array(4));
+
+    if (num_items > 0) {
+        // sort the leaves along the Hilbert curve through their centers
+        Box extent{std::numeric_limits<double>::infinity(),
+                   std::numeric_limits<double>::infinity(),
+                   -std::numeric_limits<double>::infinity(),
+                   -std::numeric_limits<double>::infinity()};
+        for (const auto& box : boxes) {
+            extent.min_x = std::min(extent.min_x, box.min_x);
+            extent.min_y = std::min(extent.min_y, box.min_y);
+            extent.max_x = std::max(extent.max_x, box.max_x);
+            extent.max_y = std::max(extent.max_y, box.max_y);
+        }
+        auto width = extent.max_x - extent.min_x;
+        auto height = extent.max_y - extent.min_y;
+        std::vector<std::pair<uint32_t, uint32_t>> order(num_items);
+        for (uint64_t i = 0; i < num_items; i++) {
+            const auto& box = boxes[i];
+            auto x = ToGrid((box.min_x + box.max_x) / 2, extent.min_x, width);
+            auto y = ToGrid((box.min_y + box.max_y) / 2, extent.min_y, height);
+            order[i] = {HilbertValue(x, y), static_cast<uint32_t>(i)};
+        }
+        std::sort(order.begin(), order.end());
+
+        for (uint64_t pos = 0; pos < num_items; pos++) {
+            auto i = order[pos].second;
+            min_x[pos] = boxes[i].min_x;
+            min_y[pos] = boxes[i].min_y;
+            max_x[pos] = boxes[i].max_x;
+            max_y[pos] = boxes[i].max_y;
+            refs[pos] = offsets[i];
+        }
+    }
+
+    // every other node covers the next kNodeSize nodes of the level below
+    uint64_t pos = num_items;
+    for (uint64_t level = 0; level + 1 < num_levels; level++) {
+        uint64_t begin = level == 0 ? 0 : level_bounds[level - 1];
+        uint64_t end = level_bounds[level];
+        for (auto child = begin; child < end; child += kNodeSize, pos++) {
+            auto last = std::min<uint64_t>(child + kNodeSize, end);
+            min_x[pos] = *std::min_element(min_x + child, min_x + last);
+            min_y[pos] = *std::min_element(min_y + child, min_y + last);
+            max_x[pos] = *std::max_element(max_x + child, max_x + last);
+            max_y[pos] = *std::max_element(max_y + child, max_y + last);
+            refs[pos] = static_cast<int64_t>(child);
+        }
+    }
+
+    tree.data_ = data;
+    tree.size_ = tree.owned_.size();
+    tree.Parse();
+    return tree;
+}
+
+PackedRTree&
+PackedRTree::operator=(PackedRTree&& other) noexcept {
+    if (this != &other) {
+        Reset();
+        // moving the vector keeps its buffer, so the arrays stay valid
+        owned_ = std::move(other.owned_);
+        mapped_ = other.mapped_;
+        data_ = other.data_;
+        size_ = other.size_;
+        num_items_ = other.num_items_;
+        num_nodes_ = other.num_nodes_;
+        num_levels_ = other.num_levels_;
+        node_size_ = other.node_size_;
+        level_bounds_ = other.level_bounds_;
+        min_x_ = other.min_x_;
+        min_y_ = other.min_y_;
+        max_x_ = other.max_x_;
+        max_y_ = other.max_y_;
+        refs_ = other.refs_;
+        other.mapped_ = nullptr;
+        other.Reset();
+    }
+    return *this;
+}
+
+PackedRTree::~PackedRTree() {
+    Reset();
+}
+
+void
+PackedRTree::Reset() {
+    if (mapped_ != nullptr) {
+        munmap(mapped_, size_);
+        mapped_ = nullptr;
+    }
+    owned_.clear();
+    owned_.shrink_to_fit();
+    data_ = nullptr;
+    size_ = 0;
+    num_items_ = 0;
+    num_nodes_ = 0;
+    num_levels_ = 0;
+    node_size_ = kNodeSize;
+    level_bounds_ = nullptr;
+    min_x_ = nullptr;
+    min_y_ = nullptr;
+    max_x_ = nullptr;
+    max_y_ = nullptr;
+    refs_ = nullptr;
+}
+
+void
+PackedRTree::Save(const std::string& path) const {
+    std::ofstream ofs(path, std::ios::binary | std::ios::trunc);
+    if (ofs.fail()) {
+        ThrowInfo(ErrorCode::FileOpenFailed,
+                  "Failed to open packed R-Tree file: {}",
+                  path);
+    }
+    if (!ofs.write(reinterpret_cast<const char*>(data_), size_)) {
+        ThrowInfo(ErrorCode::FileWriteFailed,
+                  "Failed to write packed R-Tree file: {}",
+                  path);
+    }
+}
+
+void
+PackedRTree::Open(const std::string& path) {
+    Reset();
+    auto fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd == -1) {
+        ThrowInfo(ErrorCode::FileOpenFailed,
+                  "Failed to open packed R-Tree file {}: {}",
+                  path,
+                  strerror(errno));
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 ||
+        static_cast<size_t>(st.st_size) < sizeof(Header)) {
+        close(fd);
+        ThrowInfo(ErrorCode::UnexpectedError,
+                  "Packed R-Tree file {} is truncated",
+                  path);
+    }
+    auto* mapped = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapped == MAP_FAILED) {
+        ThrowInfo(ErrorCode::UnexpectedError,
+                  "Failed to mmap packed R-Tree file {}: {}",
+                  path,
+                  strerror(errno));
+    }
+    mapped_ = mapped;
+    data_ = static_cast<const uint8_t*>(mapped);
+    size_ = st.st_size;
+    try {
+        Parse();
+    } catch (...) {
+        Reset();
+        throw;
+    }
+}
+
+void
+PackedRTree::Parse() {
+    AssertInfo(size_ >= sizeof(Header), "packed R-Tree is truncated");
+    Header header;
+    memcpy(&header, data_, sizeof(header));
+    AssertInfo(header.magic == kMagic, "not a packed R-Tree");
+    AssertInfo(header.version == kVersion,
+               "unsupported packed R-Tree version {}",
+               header.version);
+    AssertInfo(header.node_size > 0 && header.node_size <= kNodeSize,
+               "invalid packed R-Tree node size {}",
+               header.node_size);
+    AssertInfo(size_ >= TreeSize(header.num_levels, header.num_nodes),
+               "packed R-Tree is truncated");
+    num_items_ = header.num_items;
+    num_nodes_ = header.num_nodes;
+    num_levels_ = header.num_levels;
+    node_size_ = header.node_size;
+    level_bounds_ =
+        reinterpret_cast<const uint64_t*>(data_ + LevelBoundsOffset());
+    auto array = [&](size_t k) {
+        return data_ + ArrayOffset(num_levels_, num_nodes_, k);
+    };
+    min_x_ = reinterpret_cast<const double*>(array(0));
+    min_y_ = reinterpret_cast<const double*>(array(1));
+    max_x_ = reinterpret_cast<const double*>(array(2));
+    max_y_ = reinterpret_cast<const double*>(array(3));
+    refs_ = reinterpret_cast<const int64_t*>(array(4));
+}
+
+uint32_t
+PackedRTree::IntersectMask(uint64_t begin,
+                           uint64_t end,
+                           const Box& query) const {
+    using Batch = xsimd::batch<double>;
+    constexpr size_t kLanes = Batch::size;
+    const Batch query_min_x(query.min_x);
+    const Batch query_min_y(query.min_y);
+    const Batch query_max_x(query.max_x);
+    const Batch query_max_y(query.max_y);
+
+    uint32_t mask = 0;
+    auto pos = begin;
+    for (; pos + kLanes <= end; pos += kLanes) {
+        auto hit = (Batch::load_unaligned(min_x_ + pos) <= query_max_x) &
+                   (Batch::load_unaligned(max_x_ + pos) >= query_min_x) &
+                   (Batch::load_unaligned(min_y_ + pos) <= query_max_y) &
+                   (Batch::load_unaligned(max_y_ + pos) >= query_min_y);
+        mask |= static_cast<uint32_t>(toBitMask(hit)) << (pos - begin);
+    }
+    for (; pos < end; pos++) {
+        bool hit = min_x_[pos] <= query.max_x && max_x_[pos] >= query.min_x &&
+                   min_y_[pos] <= query.max_y && max_y_[pos] >= query.min_y;
+        mask |= static_cast<uint32_t>(hit) << (pos - begin);
+    }
+    return mask;
+}
+
+}  // namespace milvus::index
@@ -0,0 +1,145 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace milvus::index {
+
+// A static R-tree bulk loaded in one pass: the boxes are sorted by the
+// Hilbert value of their centers and packed kNodeSize to a node, then the
+// nodes of each level are packed the same way up to the root. Nodes are
+// not pointers but positions in flat arrays, leaves first and the root
+// last, and the bounds of the nodes are stored as separate min_x, min_y,
+// max_x and max_y arrays so the children of a node are tested against
+// the query box a SIMD batch at a time.
+//
+// The tree is one buffer laid out as:
+//   [header][level_bounds][min_x][min_y][max_x][max_y][refs]
+// level_bounds: end position of each level, leaves at level 0
+// refs: the row offset of a leaf, the position of the first child of any
+//       other node
+// Open maps a saved tree and searches it in place.
+class PackedRTree {
+ public:
+    static constexpr uint32_t kNodeSize = 16;
+
+    struct Box {
+        double min_x;
+        double min_y;
+        double max_x;
+        double max_y;
+    };
+
+    // Packs `boxes`, boxes[i] being the bounding box of row offsets[i].
+    static PackedRTree
+    Build(const std::vector<Box>& boxes, const std::vector<int64_t>& offsets);
+
+    PackedRTree() = default;
+
+    PackedRTree(PackedRTree&& other) noexcept {
+        *this = std::move(other);
+    }
+
+    PackedRTree&
+    operator=(PackedRTree&& other) noexcept;
+
+    PackedRTree(const PackedRTree&) = delete;
+
+    PackedRTree&
+    operator=(const PackedRTree&) = delete;
+
+    ~PackedRTree();
+
+    void
+    Save(const std::string& path) const;
+
+    // Maps the tree saved at `path`.
+    void
+    Open(const std::string& path);
+
+    size_t
+    size() const {
+        return num_items_;
+    }
+
+    // Bytes of the tree, mapped or not.
+    size_t
+    ByteSize() const {
+        return size_;
+    }
+
+    // Calls func(row_offset) for every box intersecting `query`, in no
+    // particular order.
+    template <typename Func>
+    void
+    Search(const Box& query, Func func) const {
+        if (num_items_ == 0) {
+            return;
+        }
+        // (first node, level) of the node ranges left to test
+        std::vector<std::pair<uint64_t, uint64_t>> stack;
+        stack.emplace_back(num_nodes_ - 1, num_levels_ - 1);
+        while (!stack.empty()) {
+            auto [begin, level] = stack.back();
+            stack.pop_back();
+            auto end = std::min<uint64_t>(begin + node_size_,
+                                          level_bounds_[level]);
+            auto mask = IntersectMask(begin, end, query);
+            while (mask != 0) {
+                auto pos = begin + __builtin_ctz(mask);
+                mask &= mask - 1;
+                if (level == 0) {
+                    func(refs_[pos]);
+                } else {
+                    stack.emplace_back(refs_[pos], level - 1);
+                }
+            }
+        }
+    }
+
+ private:
+    // Bit i is set if node begin + i intersects `query`.
+    uint32_t
+    IntersectMask(uint64_t begin, uint64_t end, const Box& query) const;
+
+    // Points the arrays at the tree in data_.
+    void
+    Parse();
+
+    void
+    Reset();
+
+    // owned_ for a built tree, a mapping for an opened one
+    std::vector<uint8_t> owned_;
+    void* mapped_{nullptr};
+    const uint8_t* data_{nullptr};
+    size_t size_{0};
+
+    uint64_t num_items_{0};
+    uint64_t num_nodes_{0};
+    uint64_t num_levels_{0};
+    uint32_t node_size_{kNodeSize};
+    const uint64_t* level_bounds_{nullptr};
+    const double* min_x_{nullptr};
+    const double* min_y_{nullptr};
+    const double* max_x_{nullptr};
+    const double* max_y_{nullptr};
+    const int64_t* refs_{nullptr};
+};
+
+}  // namespace milvus::index
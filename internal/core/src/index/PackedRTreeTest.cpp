@@ -0,0 +1,143 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include "index/PackedRTree.h"
+
+using milvus::index::PackedRTree;
+
+namespace {
+
+std::vector<int64_t>
+Search(const PackedRTree& tree, const PackedRTree::Box& query) {
+    std::vector<int64_t> result;
+    tree.Search(query, [&](int64_t offset) { result.push_back(offset); });
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+std::vector<int64_t>
+BruteForce(const std::vector<PackedRTree::Box>& boxes,
+           const std::vector<int64_t>& offsets,
+           const PackedRTree::Box& query) {
+    std::vector<int64_t> result;
+    for (size_t i = 0; i < boxes.size(); i++) {
+        const auto& box = boxes[i];
+        if (box.min_x <= query.max_x && box.max_x >= query.min_x &&
+            box.min_y <= query.max_y && box.max_y >= query.min_y) {
+            result.push_back(offsets[i]);
+        }
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+PackedRTree::Box
+RandomBox(std::mt19937& rng, double max_size) {
+    std::uniform_real_distribution<double> coord(-180, 180);
+    std::uniform_real_distribution<double> size(0, max_size);
+    auto x = coord(rng);
+    auto y = coord(rng) / 2;
+    return {x, y, x + size(rng), y + size(rng)};
+}
+
+}  // namespace
+
+class PackedRTreeTest : public testing::Test {
+ protected:
+    void
+    SetUp() override {
+        std::mt19937 rng(42);
+        for (int64_t i = 0; i < 5000; i++) {
+            // points and small polygons
+            boxes_.push_back(RandomBox(rng, i % 2 == 0 ? 0 : 2));
+            offsets_.push_back(i * 3);
+        }
+        for (int i = 0; i < 100; i++) {
+            queries_.push_back(RandomBox(rng, 40));
+        }
+        path_ = (std::filesystem::temp_directory_path() /
+                 ("packed_rtree_test_" + std::to_string(getpid())))
+                    .string();
+    }
+
+    void
+    TearDown() override {
+        std::filesystem::remove(path_);
+    }
+
+    std::vector<PackedRTree::Box> boxes_;
+    std::vector<int64_t> offsets_;
+    std::vector<PackedRTree::Box> queries_;
+    std::string path_;
+};
+
+TEST_F(PackedRTreeTest, SearchMatchesBruteForce) {
+    auto tree = PackedRTree::Build(boxes_, offsets_);
+    EXPECT_EQ(tree.size(), boxes_.size());
+    for (const auto& query : queries_) {
+        EXPECT_EQ(Search(tree, query), BruteForce(boxes_, offsets_, query));
+    }
+    // touching boundaries intersect
+    const auto& box = boxes_[7];
+    auto touching = Search(tree, {box.max_x, box.max_y, box.max_x + 1, 90});
+    EXPECT_TRUE(std::binary_search(
+        touching.begin(), touching.end(), offsets_[7]));
+}
+
+TEST_F(PackedRTreeTest, SearchesSavedTreeInPlace) {
+    auto tree = PackedRTree::Build(boxes_, offsets_);
+    tree.Save(path_);
+
+    PackedRTree opened;
+    opened.Open(path_);
+    EXPECT_EQ(opened.size(), tree.size());
+    EXPECT_EQ(opened.ByteSize(), std::filesystem::file_size(path_));
+    for (const auto& query : queries_) {
+        EXPECT_EQ(Search(opened, query), Search(tree, query));
+    }
+
+    auto moved = std::move(opened);
+    EXPECT_EQ(opened.size(), 0);
+    EXPECT_EQ(Search(moved, queries_[0]), Search(tree, queries_[0]));
+}
+
+TEST_F(PackedRTreeTest, SmallTrees) {
+    auto empty = PackedRTree::Build({}, {});
+    EXPECT_EQ(empty.size(), 0);
+    EXPECT_TRUE(Search(empty, {-180, -90, 180, 90}).empty());
+    empty.Save(path_);
+    PackedRTree opened;
+    opened.Open(path_);
+    EXPECT_TRUE(Search(opened, {-180, -90, 180, 90}).empty());
+
+    auto single = PackedRTree::Build({{1, 1, 2, 2}}, {9});
+    EXPECT_EQ(Search(single, {0, 0, 1, 1}), std::vector<int64_t>{9});
+    EXPECT_TRUE(Search(single, {3, 3, 4, 4}).empty());
+}
+
+TEST_F(PackedRTreeTest, RejectsOtherFiles) {
+    std::ofstream(path_) << "definitely not a packed r-tree, but long enough";
+    PackedRTree tree;
+    EXPECT_ANY_THROW(tree.Open(path_));
+    EXPECT_EQ(tree.size(), 0);
+    EXPECT_ANY_THROW(tree.Open(path_ + ".missing"));
+}
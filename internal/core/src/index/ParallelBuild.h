@@ -0,0 +1,156 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <future>
+#include <vector>
+
+#include "common/Common.h"
+#include "common/FieldDataInterface.h"
+#include "storage/ThreadPools.h"
+
+// Helpers for building a scalar index from its rows in parallel: the rows are
+// cut into runs, every run is sorted or grouped on its own thread and the
+// runs are merged in row order into the final layout.
+namespace milvus::index {
+
+// rows a run holds at least, smaller builds stay on the calling thread
+constexpr size_t kMinParallelBuildRows = 64 * 1024;
+
+// SCALAR_INDEX_BUILD_PARALLELISM, or the cpu number of the node when it's 0
+inline int64_t
+ScalarIndexBuildParallelism() {
+    auto parallelism = SCALAR_INDEX_BUILD_PARALLELISM.load();
+    if (parallelism <= 0) {
+        parallelism = CPU_NUM;
+    }
+    return std::max<int64_t>(parallelism, 1);
+}
+
+// The bounds of the runs `n` rows are built in, run i holds the rows in
+// [bounds[i], bounds[i + 1]). The runs are as many as
+// ScalarIndexBuildParallelism() and start at a multiple of 64 so that every
+// run sets the bits of its own words of a TargetBitmap.
+inline std::vector<size_t>
+ParallelBuildBounds(size_t n) {
+    auto runs = std::clamp<size_t>(
+        n / kMinParallelBuildRows, 1, ScalarIndexBuildParallelism());
+    std::vector<size_t> bounds{0};
+    for (size_t run = 1; run < runs; ++run) {
+        bounds.push_back(n * run / runs / 64 * 64);
+    }
+    bounds.push_back(n);
+    return bounds;
+}
+
+// Calls `fn(run)` for every run in [0, runs), run 0 on the calling thread and
+// the others on the MIDDLE pool. Rethrows the first error once every run has
+// returned, since the runs may hold references to the caller's frame.
+template <typename Fn>
+void
+RunParallel(size_t runs, Fn&& fn) {
+    if (runs <= 1) {
+        if (runs == 1) {
+            fn(0);
+        }
+        return;
+    }
+    auto& pool = ThreadPools::GetThreadPool(ThreadPoolPriority::MIDDLE);
+    std::vector<std::future<void>> futures;
+    futures.reserve(runs - 1);
+    for (size_t run = 1; run < runs; ++run) {
+        futures.push_back(pool.Submit([&fn, run]() { fn(run); }));
+    }
+    std::exception_ptr error = nullptr;
+    try {
+        fn(0);
+    } catch (...) {
+        error = std::current_exception();
+    }
+    for (auto& future : futures) {
+        try {
+            future.get();
+        } catch (...) {
+            if (error == nullptr) {
+                error = std::current_exception();
+            }
+        }
+    }
+    if (error != nullptr) {
+        std::rethrow_exception(error);
+    }
+}
+
+// Sorts `data` by sorting the runs in parallel, then merging neighbouring
+// runs pairwise in parallel until one is left.
+template <typename T>
+void
+ParallelSort(std::vector<T>& data) {
+    auto bounds = ParallelBuildBounds(data.size());
+    auto runs = bounds.size() - 1;
+    RunParallel(runs, [&](size_t run) {
+        std::sort(data.begin() + bounds[run], data.begin() + bounds[run + 1]);
+    });
+    while (runs > 1) {
+        RunParallel(runs / 2, [&](size_t pair) {
+            std::inplace_merge(data.begin() + bounds[2 * pair],
+                               data.begin() + bounds[2 * pair + 1],
+                               data.begin() + bounds[2 * pair + 2]);
+        });
+        std::vector<size_t> merged;
+        for (size_t i = 0; i < bounds.size(); i += 2) {
+            merged.push_back(bounds[i]);
+        }
+        if (merged.back() != bounds.back()) {
+            merged.push_back(bounds.back());
+        }
+        bounds = std::move(merged);
+        runs = bounds.size() - 1;
+    }
+}
+
+// Calls `fn(field_data, i, row)` for every row in [begin, end) of the rows of
+// `field_datas` laid one after another, `i` being its offset in `field_data`
+template <typename Fn>
+void
+ForEachRowInRange(const std::vector<FieldDataPtr>& field_datas,
+                  size_t begin,
+                  size_t end,
+                  Fn&& fn) {
+    size_t row = 0;
+    for (const auto& field_data : field_datas) {
+        size_t num_rows = field_data->get_num_rows();
+        if (row + num_rows <= begin) {
+            row += num_rows;
+            continue;
+        }
+        if (row >= end) {
+            break;
+        }
+        auto first = begin > row ? begin - row : 0;
+        auto last = std::min(num_rows, end - row);
+        for (auto i = first; i < last; ++i) {
+            fn(field_data, i, row + i);
+        }
+        row += num_rows;
+    }
+}
+
+}  // namespace milvus::index
@@ -0,0 +1,207 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "common/Common.h"
+#include "index/BitmapIndex.h"
+#include "index/IndexStructure.h"
+#include "index/ParallelBuild.h"
+#include "index/StringIndexSort.h"
+#include "storage/FileManager.h"
+#include "storage/Util.h"
+
+using namespace milvus;
+using namespace milvus::index;
+
+namespace {
+
+class ParallelBuildTest : public ::testing::Test {
+ protected:
+    void
+    SetUp() override {
+        parallelism_ = SCALAR_INDEX_BUILD_PARALLELISM.load();
+        SCALAR_INDEX_BUILD_PARALLELISM.store(5);
+    }
+
+    void
+    TearDown() override {
+        SCALAR_INDEX_BUILD_PARALLELISM.store(parallelism_);
+    }
+
+    int64_t parallelism_;
+};
+
+// `rows` rows of values in [0, cardinality), every seventh row null
+template <typename T>
+std::vector<FieldDataPtr>
+MakeFieldDatas(DataType type,
+               const std::vector<size_t>& rows,
+               int cardinality,
+               std::vector<std::optional<T>>& expected) {
+    std::mt19937 gen(17);
+    std::vector<FieldDataPtr> field_datas;
+    for (auto n : rows) {
+        std::vector<T> values(n);
+        std::vector<uint8_t> valid((n + 7) / 8, 0);
+        for (size_t i = 0; i < n; i++) {
+            auto value = static_cast<int>(gen() % cardinality);
+            if constexpr (std::is_same_v<T, std::string>) {
+                values[i] = "value_" + std::to_string(value);
+            } else {
+                values[i] = value;
+            }
+            auto is_valid = expected.size() % 7 != 0;
+            if (is_valid) {
+                valid[i >> 3] |= (1u << (i & 7));
+            }
+            expected.push_back(is_valid ? std::optional<T>(values[i])
+                                        : std::nullopt);
+        }
+        auto field_data =
+            storage::CreateFieldData(type, DataType::NONE, true, 1, n);
+        field_data->FillFieldData(values.data(), valid.data(), n, 0);
+        field_datas.push_back(field_data);
+    }
+    return field_datas;
+}
+
+template <typename T>
+void
+ExpectSameRows(ScalarIndex<T>& index,
+               const std::vector<std::optional<T>>& expected) {
+    std::map<T, std::vector<size_t>> rows;
+    size_t nulls = 0;
+    for (size_t i = 0; i < expected.size(); i++) {
+        if (expected[i].has_value()) {
+            rows[expected[i].value()].push_back(i);
+        } else {
+            nulls++;
+        }
+    }
+    EXPECT_EQ(index.IsNull().count(), nulls);
+    for (const auto& [value, value_rows] : rows) {
+        auto bitset = index.In(1, &value);
+        ASSERT_EQ(bitset.count(), value_rows.size());
+        for (auto row : value_rows) {
+            ASSERT_TRUE(bitset[row]) << "row " << row;
+        }
+    }
+}
+
+}  // namespace
+
+TEST_F(ParallelBuildTest, BoundsAreAlignedRuns) {
+    EXPECT_EQ(ParallelBuildBounds(1000), (std::vector<size_t>{0, 1000}));
+
+    size_t n = 300001;
+    auto bounds = ParallelBuildBounds(n);
+    // 4 runs of at least kMinParallelBuildRows rows fit in
+    ASSERT_EQ(bounds.size(), 5);
+    EXPECT_EQ(bounds.front(), 0);
+    EXPECT_EQ(bounds.back(), n);
+    for (size_t i = 1; i + 1 < bounds.size(); i++) {
+        EXPECT_EQ(bounds[i] % 64, 0);
+        EXPECT_LT(bounds[i - 1], bounds[i]);
+    }
+
+    SCALAR_INDEX_BUILD_PARALLELISM.store(1);
+    EXPECT_EQ(ParallelBuildBounds(n).size(), 2);
+}
+
+TEST_F(ParallelBuildTest, SortsLikeStdSort) {
+    std::mt19937 gen(42);
+    std::vector<IndexStructure<int64_t>> data;
+    for (size_t i = 0; i < 5 * kMinParallelBuildRows + 123; i++) {
+        data.emplace_back(static_cast<int64_t>(gen() % 1000), i);
+    }
+    auto expected = data;
+    std::sort(expected.begin(), expected.end());
+
+    ParallelSort(data);
+    ASSERT_EQ(data.size(), expected.size());
+    for (size_t i = 0; i < data.size(); i++) {
+        ASSERT_EQ(data[i].a_, expected[i].a_) << "position " << i;
+    }
+}
+
+TEST_F(ParallelBuildTest, VisitsEveryRowOfTheRangeOnce) {
+    std::vector<FieldDataPtr> field_datas;
+    for (auto n : {1000, 0, 70000, 5}) {
+        std::vector<int64_t> values(n);
+        for (int i = 0; i < n; i++) {
+            values[i] = i;
+        }
+        auto field_data =
+            storage::CreateFieldData(DataType::INT64, DataType::NONE);
+        field_data->FillFieldData(values.data(), n);
+        field_datas.push_back(field_data);
+    }
+
+    std::vector<size_t> rows;
+    ForEachRowInRange(
+        field_datas,
+        500,
+        71003,
+        [&](const FieldDataPtr& field_data, size_t i, size_t row) {
+            EXPECT_EQ(*static_cast<const int64_t*>(field_data->RawValue(i)),
+                      static_cast<int64_t>(i));
+            rows.push_back(row);
+        });
+    ASSERT_EQ(rows.size(), 71003 - 500);
+    for (size_t i = 0; i < rows.size(); i++) {
+        ASSERT_EQ(rows[i], 500 + i);
+    }
+}
+
+TEST_F(ParallelBuildTest, BitmapIndexMergesRuns) {
+    storage::FileManagerContext ctx;
+    ctx.fieldDataMeta.field_schema.set_data_type(
+        proto::schema::DataType::Int64);
+    ctx.fieldDataMeta.field_schema.set_nullable(true);
+    std::vector<std::optional<int64_t>> expected;
+    auto field_datas = MakeFieldDatas<int64_t>(
+        DataType::INT64, {100000, 3, 250000}, 50, expected);
+
+    BitmapIndex<int64_t> index(ctx);
+    index.BuildWithFieldData(field_datas);
+    ASSERT_EQ(index.Count(), expected.size());
+    ExpectSameRows<int64_t>(index, expected);
+}
+
+TEST_F(ParallelBuildTest, StringIndexSortMergesRuns) {
+    storage::FileManagerContext ctx;
+    ctx.fieldDataMeta.field_schema.set_data_type(
+        proto::schema::DataType::VarChar);
+    ctx.fieldDataMeta.field_schema.set_nullable(true);
+    std::vector<std::optional<std::string>> expected;
+    auto field_datas = MakeFieldDatas<std::string>(
+        DataType::VARCHAR, {200000, 90000}, 1000, expected);
+
+    StringIndexSort index(ctx);
+    index.BuildWithFieldData(field_datas);
+    ASSERT_EQ(index.Count(), expected.size());
+    ExpectSameRows<std::string>(index, expected);
+}
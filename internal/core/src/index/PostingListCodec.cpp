@@ -0,0 +1,141 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "index/PostingListCodec.h"
+
+#include <algorithm>
+
+namespace milvus::index {
+
+namespace {
+
+bool
+StrictlyAscending(const uint32_t* row_ids, size_t n) {
+    for (size_t i = 1; i < n; ++i) {
+        if (row_ids[i] <= row_ids[i - 1]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Bits needed for the largest gap minus one.
+uint32_t
+GapWidth(const uint32_t* row_ids, size_t n) {
+    uint32_t max_gap = 0;
+    for (size_t i = 1; i < n; ++i) {
+        max_gap = std::max(max_gap, row_ids[i] - row_ids[i - 1] - 1);
+    }
+    uint32_t width = 0;
+    while (width < 32 && (max_gap >> width) != 0) {
+        width++;
+    }
+    return width;
+}
+
+size_t
+BitPackedSize(size_t n, uint32_t width) {
+    return sizeof(uint32_t) + 1 + ((n - 1) * width + 7) / 8;
+}
+
+roaring::Roaring
+ToRoaring(const uint32_t* row_ids, size_t n) {
+    roaring::Roaring bitmap(n, row_ids);
+    bitmap.runOptimize();
+    return bitmap;
+}
+
+struct Choice {
+    PostingListCodec::Encoding encoding;
+    size_t payload_size;
+};
+
+Choice
+Choose(const uint32_t* row_ids, size_t n) {
+    Choice choice{PostingListCodec::kRaw, n * sizeof(uint32_t)};
+    // a couple of row ids are as small raw as anyhow
+    if (n <= 2 || !StrictlyAscending(row_ids, n)) {
+        return choice;
+    }
+    auto bit_packed = BitPackedSize(n, GapWidth(row_ids, n));
+    if (bit_packed < choice.payload_size) {
+        choice = {PostingListCodec::kBitPacked, bit_packed};
+    }
+    auto roaring =
+        sizeof(uint32_t) + ToRoaring(row_ids, n).getSizeInBytes(true);
+    if (roaring < choice.payload_size) {
+        choice = {PostingListCodec::kRoaring, roaring};
+    }
+    return choice;
+}
+
+}  // namespace
+
+size_t
+PostingListCodec::EncodedSize(const uint32_t* row_ids, size_t n) {
+    return kHeaderSize + Choose(row_ids, n).payload_size;
+}
+
+void
+PostingListCodec::Encode(const uint32_t* row_ids,
+                         size_t n,
+                         uint8_t* ptr,
+                         size_t& offset) {
+    auto choice = Choose(row_ids, n);
+    uint32_t count = n;
+    ptr[offset] = choice.encoding;
+    memcpy(ptr + offset + 1, &count, sizeof(uint32_t));
+    offset += kHeaderSize;
+
+    switch (choice.encoding) {
+        case kRaw:
+            memcpy(ptr + offset, row_ids, n * sizeof(uint32_t));
+            break;
+        case kBitPacked: {
+            auto width = GapWidth(row_ids, n);
+            auto out = ptr + offset;
+            memcpy(out, row_ids, sizeof(uint32_t));
+            out[sizeof(uint32_t)] = static_cast<uint8_t>(width);
+            out += sizeof(uint32_t) + 1;
+            uint64_t bits = 0;
+            uint32_t num_bits = 0;
+            for (size_t i = 1; i < n; ++i) {
+                bits |= uint64_t(row_ids[i] - row_ids[i - 1] - 1) << num_bits;
+                num_bits += width;
+                while (num_bits >= 8) {
+                    *out++ = static_cast<uint8_t>(bits);
+                    bits >>= 8;
+                    num_bits -= 8;
+                }
+            }
+            if (num_bits > 0) {
+                *out++ = static_cast<uint8_t>(bits);
+            }
+            break;
+        }
+        case kRoaring: {
+            auto bitmap = ToRoaring(row_ids, n);
+            uint32_t size = bitmap.getSizeInBytes(true);
+            memcpy(ptr + offset, &size, sizeof(uint32_t));
+            bitmap.write(
+                reinterpret_cast<char*>(ptr + offset + sizeof(uint32_t)), true);
+            break;
+        }
+    }
+    offset += choice.payload_size;
+}
+
+}  // namespace milvus::index
@@ -0,0 +1,119 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <roaring/roaring.hh>
+
+namespace milvus::index {
+
+// Encodes an ascending posting list with whichever of three encodings is
+// the smallest for it:
+//   kRaw:       the row ids as they are, for short or unsorted lists;
+//   kBitPacked: the first row id, then every gap minus one bit packed at
+//               the width of the largest, for sparse lists;
+//   kRoaring:   a portable roaring bitmap, for dense or clustered lists.
+//
+// An encoded list is : [encoding u8][count u32][payload]
+// kRaw payload: row_id1, row_id2, ... as u32
+// kBitPacked payload: [first u32][width u8][packed gaps, LSB first]
+// kRoaring payload: [size u32][portable roaring bitmap]
+class PostingListCodec {
+ public:
+    enum Encoding : uint8_t {
+        kRaw = 0,
+        kBitPacked = 1,
+        kRoaring = 2,
+    };
+
+    // Bytes Encode writes for `row_ids`.
+    static size_t
+    EncodedSize(const uint32_t* row_ids, size_t n);
+
+    // Writes the encoded list at `ptr + offset` and advances `offset` past
+    // it.
+    static void
+    Encode(const uint32_t* row_ids, size_t n, uint8_t* ptr, size_t& offset);
+
+    static Encoding
+    GetEncoding(const uint8_t* data) {
+        return static_cast<Encoding>(data[0]);
+    }
+
+    static uint32_t
+    Count(const uint8_t* data) {
+        uint32_t count;
+        memcpy(&count, data + 1, sizeof(uint32_t));
+        return count;
+    }
+
+    // Calls func(row_id) for the row ids of the list at `data`, in
+    // ascending order.
+    template <typename Func>
+    static void
+    ForEach(const uint8_t* data, Func func) {
+        auto count = Count(data);
+        auto ptr = data + kHeaderSize;
+        switch (GetEncoding(data)) {
+            case kRaw: {
+                for (uint32_t i = 0; i < count; ++i) {
+                    uint32_t row_id;
+                    memcpy(&row_id, ptr + i * sizeof(uint32_t), sizeof(row_id));
+                    func(row_id);
+                }
+                break;
+            }
+            case kBitPacked: {
+                uint32_t row_id;
+                memcpy(&row_id, ptr, sizeof(uint32_t));
+                const uint32_t width = ptr[sizeof(uint32_t)];
+                ptr += sizeof(uint32_t) + 1;
+                func(row_id);
+                const uint64_t mask = (uint64_t(1) << width) - 1;
+                uint64_t bits = 0;
+                uint32_t num_bits = 0;
+                for (uint32_t i = 1; i < count; ++i) {
+                    while (num_bits < width) {
+                        bits |= uint64_t(*ptr++) << num_bits;
+                        num_bits += 8;
+                    }
+                    row_id += static_cast<uint32_t>(bits & mask) + 1;
+                    bits >>= width;
+                    num_bits -= width;
+                    func(row_id);
+                }
+                break;
+            }
+            case kRoaring: {
+                auto bitmap = roaring::Roaring::portableDeserializeFrozen(
+                    reinterpret_cast<const char*>(ptr + sizeof(uint32_t)));
+                for (auto row_id : bitmap) {
+                    func(row_id);
+                }
+                break;
+            }
+        }
+    }
+
+ private:
+    static constexpr size_t kHeaderSize = 1 + sizeof(uint32_t);
+};
+
+}  // namespace milvus::index
@@ -0,0 +1,92 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <vector>
+
+#include "index/PostingListCodec.h"
+
+using milvus::index::PostingListCodec;
+
+namespace {
+
+std::vector<uint8_t>
+Encode(const std::vector<uint32_t>& row_ids) {
+    std::vector<uint8_t> data(
+        PostingListCodec::EncodedSize(row_ids.data(), row_ids.size()));
+    size_t offset = 0;
+    PostingListCodec::Encode(
+        row_ids.data(), row_ids.size(), data.data(), offset);
+    EXPECT_EQ(offset, data.size());
+    return data;
+}
+
+std::vector<uint32_t>
+Decode(const std::vector<uint8_t>& data) {
+    std::vector<uint32_t> row_ids;
+    PostingListCodec::ForEach(
+        data.data(), [&](uint32_t row_id) { row_ids.push_back(row_id); });
+    EXPECT_EQ(row_ids.size(), PostingListCodec::Count(data.data()));
+    return row_ids;
+}
+
+}  // namespace
+
+TEST(PostingListCodecTest, ShortAndUnsortedListsStayRaw) {
+    for (const auto& row_ids : std::vector<std::vector<uint32_t>>{
+             {}, {7}, {3, 9}, {9, 3, 4, 100}}) {
+        auto data = Encode(row_ids);
+        EXPECT_EQ(PostingListCodec::GetEncoding(data.data()),
+                  PostingListCodec::kRaw);
+        EXPECT_EQ(Decode(data), row_ids);
+    }
+}
+
+TEST(PostingListCodecTest, SparseListsAreBitPacked) {
+    std::vector<uint32_t> row_ids;
+    for (uint32_t i = 0; i < 1000; ++i) {
+        row_ids.push_back(i * 37 + (i % 5));
+    }
+    auto data = Encode(row_ids);
+    EXPECT_EQ(PostingListCodec::GetEncoding(data.data()),
+              PostingListCodec::kBitPacked);
+    // gaps of at most 38 take 6 bits each
+    EXPECT_LT(data.size(), row_ids.size());
+    EXPECT_EQ(Decode(data), row_ids);
+
+    // a run has only gaps of one, which take no bits at all
+    std::vector<uint32_t> run;
+    for (uint32_t i = 500; i < 600; ++i) {
+        run.push_back(i);
+    }
+    EXPECT_EQ(Decode(Encode(run)), run);
+    EXPECT_LT(Encode(run).size(), 16);
+}
+
+TEST(PostingListCodecTest, ClusteredListsUseRoaring) {
+    // dense clusters far apart need wide gaps when bit packed
+    std::vector<uint32_t> row_ids;
+    for (uint32_t cluster = 0; cluster < 8; ++cluster) {
+        for (uint32_t i = 0; i < 4096; i += 2) {
+            row_ids.push_back(cluster * 1000000 + i);
+        }
+    }
+    auto data = Encode(row_ids);
+    EXPECT_EQ(PostingListCodec::GetEncoding(data.data()),
+              PostingListCodec::kRoaring);
+    EXPECT_EQ(Decode(data), row_ids);
+}
@@ -27,6 +27,7 @@
 #include "boost/filesystem/operations.hpp"
 #include "boost/filesystem/path.hpp"
 #include "boost/iterator/iterator_facade.hpp"
+#include "common/Consts.h"
 #include "common/EasyAssert.h"
 #include "common/FieldDataInterface.h"
 #include "common/Geometry.h"
@@ -69,9 +70,18 @@ ends_with(const std::string& value, const std::string& suffix) {
                0;
 }
 
+// Whether an index built with `config` is a PackedRTree.
+static bool
+BuildsPackedRTree(const Config& config) {
+    auto engine_version =
+        GetValueFromConfig<int32_t>(config, SCALAR_INDEX_ENGINE_VERSION)
+            .value_or(1);
+    return engine_version >= kPackedRTreeIndexVersion;
+}
+
 template <typename T>
 void
-RTreeIndex<T>::InitForBuildIndex(bool is_growing) {
+RTreeIndex<T>::InitForBuildIndex(bool is_growing, bool packed) {
     std::string index_file_path;
     if (is_growing) {
         path_ = "";
@@ -80,14 +90,16 @@ RTreeIndex<T>::InitForBuildIndex(bool is_growing) {
         path_ = GetRTreeTempPrefix() + prefix;
         boost::filesystem::create_directories(path_);
         index_file_path = path_ + "/index_file";  // base path (no ext)
-        if (boost::filesystem::exists(index_file_path + ".bgi")) {
+        if (boost::filesystem::exists(index_file_path + ".bgi") ||
+            boost::filesystem::exists(index_file_path + ".prt")) {
             ThrowInfo(IndexBuildError,
                       "build rtree index temp dir:{} not empty",
                       path_);
         }
     }
 
-    wrapper_ = std::make_shared<RTreeIndexWrapper>(index_file_path, true);
+    wrapper_ = std::make_shared<RTreeIndexWrapper>(
+        index_file_path, true, packed && !is_growing);
 }
 
 template <typename T>
@@ -242,7 +254,7 @@ RTreeIndex<T>::Load(milvus::tracer::TraceContext ctx, const Config& config) {
     // Pick a .dat or .idx file explicitly; avoid meta or others.
     std::string base_path;
     for (const auto& p : local_paths) {
-        if (ends_with(p, ".bgi")) {
+        if (ends_with(p, ".bgi") || ends_with(p, ".prt")) {
             base_path = p.substr(0, p.size() - 4);
             break;
         }
@@ -279,7 +291,7 @@ RTreeIndex<T>::Load(milvus::tracer::TraceContext ctx, const Config& config) {
 template <typename T>
 void
 RTreeIndex<T>::Build(const Config& config) {
-    InitForBuildIndex(false);
+    InitForBuildIndex(false, BuildsPackedRTree(config));
 
     // load raw WKB data into memory
     auto field_datas = mem_file_manager_->CacheRawDataToMemory(config);
@@ -557,7 +569,7 @@ RTreeIndex<T>::BuildWithRawDataForUT(size_t n,
     // Guard: n should represent number of strings not raw bytes
     AssertInfo(n > 0, "BuildWithRawDataForUT expects element count > 0");
     LOG_WARN("BuildWithRawDataForUT:{}", n);
-    this->InitForBuildIndex(false);
+    this->InitForBuildIndex(false, BuildsPackedRTree(config));
 
     int64_t offset = 0;
     for (size_t i = 0; i < n; ++i) {
@@ -722,7 +734,7 @@ RTreeIndex<T>::LoadEntries(storage::IndexEntryReader& reader,
     std::string base_path;
     for (const auto& fn : file_names) {
         auto local = path_ + "/" + fn;
-        if (ends_with(local, ".bgi")) {
+        if (ends_with(local, ".bgi") || ends_with(local, ".prt")) {
             base_path = local.substr(0, local.size() - 4);
             break;
         }
@@ -56,8 +56,9 @@ class RTreeIndex : public ScalarIndex<T> {
 
     ~RTreeIndex();
 
+    // `packed` builds a PackedRTree, see kPackedRTreeIndexVersion.
     void
-    InitForBuildIndex(bool is_growing);
+    InitForBuildIndex(bool is_growing, bool packed = false);
 
     void
     Load(milvus::tracer::TraceContext ctx, const Config& config = {}) override;
@@ -38,8 +38,10 @@
 
 namespace milvus::index {
 
-RTreeIndexWrapper::RTreeIndexWrapper(std::string& path, bool is_build_mode)
-    : index_path_(path), is_build_mode_(is_build_mode) {
+RTreeIndexWrapper::RTreeIndexWrapper(std::string& path,
+                                     bool is_build_mode,
+                                     bool packed)
+    : index_path_(path), is_build_mode_(is_build_mode), packed_(packed) {
     if (is_build_mode_) {
         std::filesystem::path dir_path =
             std::filesystem::path(path).parent_path();
@@ -93,7 +95,10 @@ RTreeIndexWrapper::add_geometry(const uint8_t* wkb_data,
     Box box(Point(minX, minY), Point(maxX, maxY));
     Value val(box, row_offset);
     values_.push_back(val);
-    rtree_.insert(val);
+    // a packed tree is only built by finish()
+    if (!packed_) {
+        rtree_.insert(val);
+    }
 
     // Clean up
     GEOSGeom_destroy_r(ctx, geom);
@@ -163,6 +168,13 @@ RTreeIndexWrapper::bulk_load_from_field_data(
     GEOSWKBReader_destroy_r(ctx, reader);
     GEOS_finish_r(ctx);
     values_.swap(local_values);
+    if (packed_) {
+        auto num_values = values_.size();
+        pack_values();
+        LOG_INFO("Packed R-Tree bulk load completed with {} entries",
+                 num_values);
+        return;
+    }
     rtree_ = RTree(values_.begin(), values_.end());
     LOG_INFO("R-Tree bulk load (Boost) completed with {} entries",
              values_.size());
@@ -184,13 +196,21 @@ RTreeIndexWrapper::finish() {
 
     // Persist to disk: write meta and binary data file
     try {
-        // Write binary rtree data
-        RTreeSerializer::saveBinary(rtree_, index_path_ + ".bgi");
+        nlohmann::json meta;
+        if (packed_) {
+            if (!values_.empty() || packed_tree_.ByteSize() == 0) {
+                pack_values();
+            }
+            packed_tree_.Save(index_path_ + ".prt");
+            meta["format"] = "packed";
+        } else {
+            // Write binary rtree data
+            RTreeSerializer::saveBinary(rtree_, index_path_ + ".bgi");
+        }
 
         // Write meta json
-        nlohmann::json meta;
         meta["dimension"] = dimension_;
-        meta["count"] = static_cast<uint64_t>(values_.size());
+        meta["count"] = static_cast<uint64_t>(count());
 
         std::ofstream ofs(index_path_ + ".meta.json", std::ios::trunc);
         if (ofs.fail()) {
@@ -237,6 +257,14 @@ RTreeIndexWrapper::load() {
             LOG_WARN("Failed to read meta json: {}", e.what());
         }
 
+        // Indexes built packed are mapped, older ones read into a boost rtree
+        if (std::filesystem::exists(index_path_ + ".prt")) {
+            packed_tree_.Open(index_path_ + ".prt");
+            packed_ = true;
+            LOG_INFO("Packed R-Tree index mapped from {}", index_path_);
+            return;
+        }
+
         // Read binary data
         RTreeSerializer::loadBinary(rtree_, index_path_ + ".bgi");
 
@@ -267,6 +295,14 @@ RTreeIndexWrapper::query_candidates(proto::plan::GISFunctionFilterExpr_GISOp op,
     std::vector<Value> results;
     {
         std::shared_lock<std::shared_mutex> guard(rtree_mutex_);
+        if (packed_) {
+            packed_tree_.Search({minX, minY, maxX, maxY}, [&](int64_t offset) {
+                candidate_offsets.push_back(offset);
+            });
+            LOG_DEBUG("Packed R-Tree query returned {} candidates",
+                      candidate_offsets.size());
+            return;
+        }
         rtree_.query(boost::geometry::index::intersects(query_box),
                      std::back_inserter(results));
     }
@@ -296,8 +332,28 @@ RTreeIndexWrapper::get_bounding_box(const GEOSGeometry* geom,
     GEOSGeom_getYMax_r(ctx, geom, &maxY);
 }
 
+void
+RTreeIndexWrapper::pack_values() {
+    std::vector<PackedRTree::Box> boxes;
+    std::vector<int64_t> offsets;
+    boxes.reserve(values_.size());
+    offsets.reserve(values_.size());
+    for (const auto& [box, offset] : values_) {
+        boxes.push_back({bg::get<bg::min_corner, 0>(box),
+                         bg::get<bg::min_corner, 1>(box),
+                         bg::get<bg::max_corner, 0>(box),
+                         bg::get<bg::max_corner, 1>(box)});
+        offsets.push_back(offset);
+    }
+    packed_tree_ = PackedRTree::Build(boxes, offsets);
+    std::vector<Value>().swap(values_);
+}
+
 int64_t
 RTreeIndexWrapper::count() const {
+    if (packed_) {
+        return static_cast<int64_t>(packed_tree_.size() + values_.size());
+    }
     return static_cast<int64_t>(rtree_.size());
 }
 
@@ -305,6 +361,12 @@ int64_t
 RTreeIndexWrapper::ByteSize() const {
     int64_t total = 0;
 
+    if (packed_) {
+        total += values_.capacity() * sizeof(Value);
+        total += packed_tree_.ByteSize();
+        return total;
+    }
+
     // values_: vector<Value> where Value = std::pair<Box, int64_t>
     // Box = bg::model::box<Point> = 2 Points = 2 * 2 * sizeof(double) = 32 bytes
     // Value = Box + int64_t = 32 + 8 = 40 bytes
@@ -26,6 +26,7 @@
 #include "boost/geometry/geometries/box.hpp"
 #include "boost/geometry/geometries/point.hpp"
 #include "boost/geometry/index/parameters.hpp"
+#include "index/PackedRTree.h"
 #include "pb/plan.pb.h"
 
 // Forward declaration to avoid pulling heavy field data headers here
@@ -51,8 +52,11 @@ class RTreeIndexWrapper {
      * @brief Constructor for RTreeIndexWrapper
      * @param path Path for storing index files
      * @param is_build_mode Whether this is for building new index or loading existing one
+     * @param packed Whether a built index is a PackedRTree instead of a boost rtree
      */
-    explicit RTreeIndexWrapper(std::string& path, bool is_build_mode);
+    explicit RTreeIndexWrapper(std::string& path,
+                               bool is_build_mode,
+                               bool packed = false);
 
     /**
      * @brief Destructor
@@ -133,6 +137,12 @@ class RTreeIndexWrapper {
                      double& maxX,
                      double& maxY);
 
+    /**
+     * @brief Pack values_ into packed_tree_ and release them
+     */
+    void
+    pack_values();
+
  private:
     // Boost.Geometry types and in-memory structures
     using Point = bg::model::point<double, 2, bg::cs::cartesian>;
@@ -142,13 +152,17 @@ class RTreeIndexWrapper {
 
     RTree rtree_{};
     std::vector<Value> values_;
+    // Sealed indexes built packed and loaded from a .prt file use
+    // packed_tree_ instead of rtree_, growing ones always use rtree_.
+    bool packed_ = false;
+    PackedRTree packed_tree_;
     std::string index_path_;
     bool is_build_mode_;
 
     // Flag to guard against repeated invocations which could otherwise attempt to release resources multiple times (e.g. BuildWithRawDataForUT() calls finish(), and Upload() may call it again).
     bool finished_ = false;
 
-    // Serialize access to rtree_
+    // Serialize access to rtree_ and packed_tree_
     mutable std::shared_mutex rtree_mutex_;
 
     // R-Tree parameters
@@ -136,6 +136,46 @@ TEST_F(RTreeIndexWrapperTest, TestBuildAndLoad) {
     }
 }
 
+TEST_F(RTreeIndexWrapperTest, TestBuildAndLoadPacked) {
+    std::string index_path = test_dir_ + "/test_packed_index";
+
+    // a 20 x 20 grid of points, more than one node per level
+    {
+        milvus::index::RTreeIndexWrapper wrapper(index_path, true, true);
+        for (int64_t i = 0; i < 400; ++i) {
+            auto wkb = create_point_wkb(i % 20, i / 20);
+            wrapper.add_geometry(
+                reinterpret_cast<const uint8_t*>(wkb.data()), wkb.size(), i);
+        }
+        wrapper.finish();
+        EXPECT_EQ(wrapper.count(), 400);
+    }
+    EXPECT_TRUE(std::filesystem::exists(index_path + ".prt"));
+    EXPECT_FALSE(std::filesystem::exists(index_path + ".bgi"));
+
+    milvus::index::RTreeIndexWrapper wrapper(index_path, false);
+    wrapper.load();
+    EXPECT_EQ(wrapper.count(), 400);
+
+    auto query_polygon_wkb = create_polygon_wkb(
+        {{2.5, 3.5}, {5.5, 3.5}, {5.5, 5.5}, {2.5, 5.5}, {2.5, 3.5}});
+    milvus::Geometry query_geom(
+        ctx_,
+        reinterpret_cast<const void*>(query_polygon_wkb.data()),
+        query_polygon_wkb.size());
+    std::vector<int64_t> candidates;
+    wrapper.query_candidates(
+        milvus::proto::plan::GISFunctionFilterExpr_GISOp_Intersects,
+        query_geom.GetGeometry(),
+        ctx_,
+        candidates);
+    std::sort(candidates.begin(), candidates.end());
+
+    // x in 3..5, y in 4..5
+    std::vector<int64_t> expected{83, 84, 85, 103, 104, 105};
+    EXPECT_EQ(candidates, expected);
+}
+
 TEST_F(RTreeIndexWrapperTest, TestQueryOperations) {
     std::string index_path = test_dir_ + "/test_query_index";
 
@@ -231,8 +231,12 @@ ScalarIndex<T>::LoadUnified(const Config& config, milvus::OpContext* op_ctx) {
 
     LOG_INFO("LoadUnified: loading packed index file: {}", packed_file);
 
+    auto cancellation_token =
+        op_ctx ? op_ctx->cancellation_token : folly::CancellationToken();
+
     // Open the file using the file manager
-    auto input = file_manager_->OpenInputStream(packed_file, is_index_file_);
+    auto input = file_manager_->OpenInputStream(
+        packed_file, is_index_file_, cancellation_token);
     AssertInfo(input != nullptr,
                "failed to open input stream for packed index file: {}",
                packed_file);
@@ -246,8 +250,6 @@ ScalarIndex<T>::LoadUnified(const Config& config, milvus::OpContext* op_ctx) {
         GetValueFromConfig<milvus::proto::common::LoadPriority>(
             config, milvus::LOAD_PRIORITY)
             .value_or(milvus::proto::common::LoadPriority::HIGH);
-    auto cancellation_token =
-        op_ctx ? op_ctx->cancellation_token : folly::CancellationToken();
     auto reader =
         storage::IndexEntryReader::Open(input,
                                         file_size,
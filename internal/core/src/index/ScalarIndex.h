@@ -20,6 +20,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "common/Types.h"
 #include "common/EasyAssert.h"
@@ -158,6 +159,17 @@ class ScalarIndex : public IndexBase {
     virtual std::optional<T>
     Reverse_Lookup(size_t offset) const = 0;
 
+    // Offsets of the first `limit` rows not set in `excluded`, in the order
+    // of their values, for an ORDER BY ... LIMIT that must not sort every
+    // candidate. Null rows are skipped. Returns std::nullopt when the index
+    // does not keep its rows ordered by value.
+    virtual std::optional<std::vector<int64_t>>
+    FirstRowsInValueOrder(const TargetBitmapView& excluded,
+                          bool ascending,
+                          int64_t limit) const {
+        return std::nullopt;
+    }
+
     virtual const TargetBitmap
     Query(const DatasetPtr& dataset);
 
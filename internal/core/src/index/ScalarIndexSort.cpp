@@ -19,6 +19,7 @@
 #include <stdio.h>
 #include <string.h>
 #include <algorithm>
+#include <cmath>
 #include <cstdint>
 #include <exception>
 #include <filesystem>
@@ -26,6 +27,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include "Meta.h"
@@ -40,6 +42,7 @@
 #include "common/Types.h"
 #include "fmt/core.h"
 #include "glog/logging.h"
+#include "index/ParallelBuild.h"
 #include "index/ScalarIndex.h"
 #include "index/ScalarIndexSort.h"
 #include "index/Utils.h"
@@ -121,7 +124,7 @@ ScalarIndexSort<T>::Build(size_t n, const T* values, const bool* valid_data) {
         }
     }
 
-    std::sort(data_.begin(), data_.end());
+    ParallelSort(data_);
     for (size_t i = 0; i < data_.size(); ++i) {
         idx_to_offsets_[data_[i].idx_] = i;
     }
@@ -167,7 +170,7 @@ ScalarIndexSort<T>::BuildWithFieldData(
             offset++;
         }
     }
-    std::sort(data_.begin(), data_.end());
+    ParallelSort(data_);
     idx_to_offsets_.resize(total_num_rows_);
     for (size_t i = 0; i < length; ++i) {
         // TODO: there is an existing bug here, data_[i].idx_ is out of range, should be fixed
@@ -222,7 +225,7 @@ ScalarIndexSort<T>::BuildWithArrayDataNested(
             }
         }
     }
-    std::sort(data_.begin(), data_.end());
+    ParallelSort(data_);
     idx_to_offsets_.resize(total_num_rows_);
     for (size_t i = 0; i < total_num_rows_; ++i) {
         idx_to_offsets_[data_[i].idx_] = i;
@@ -437,26 +440,39 @@ ScalarIndexSort<T>::Load(milvus::tracer::TraceContext ctx,
     LoadWithoutAssemble(binary_set, config);
 }
 
+template <typename T>
+template <typename Func>
+void
+ScalarIndexSort<T>::ForEachRowIn(size_t n, const T* values, Func func) const {
+    std::vector<T> probes(values, values + n);
+    if constexpr (std::is_floating_point_v<T>) {
+        // NaN equals nothing and breaks the ordering sort relies on
+        probes.erase(std::remove_if(probes.begin(),
+                                    probes.end(),
+                                    [](T value) { return std::isnan(value); }),
+                     probes.end());
+    }
+    std::sort(probes.begin(), probes.end());
+    probes.erase(std::unique(probes.begin(), probes.end()), probes.end());
+
+    auto it = begin();
+    for (const auto& value : probes) {
+        it = GallopLowerBound(it, end(), IndexStructure<T>(value));
+        if (it == end()) {
+            break;
+        }
+        for (; it != end() && it->a_ == value; ++it) {
+            func(it->idx_);
+        }
+    }
+}
+
 template <typename T>
 const TargetBitmap
 ScalarIndexSort<T>::In(const size_t n, const T* values) {
     AssertInfo(is_built_, "index has not been built");
     TargetBitmap bitset(Count());
-    for (size_t i = 0; i < n; ++i) {
-        const auto target = IndexStructure<T>(*(values + i));
-        auto lb = std::lower_bound(begin(), end(), target);
-        auto ub = std::upper_bound(lb, end(), target);
-        for (; lb < ub; ++lb) {
-            if (lb->a_ != target.a_) {
-                LOG_ERROR(
-                    "error happens in ScalarIndexSort<T>::In, "
-                    "expected value is: {}, but real value is: {}",
-                    target.a_,
-                    lb->a_);
-            }
-            bitset[lb->idx_] = true;
-        }
-    }
+    ForEachRowIn(n, values, [&bitset](size_t idx) { bitset[idx] = true; });
     return bitset;
 }
 
@@ -465,21 +481,7 @@ const TargetBitmap
 ScalarIndexSort<T>::NotIn(const size_t n, const T* values) {
     AssertInfo(is_built_, "index has not been built");
     TargetBitmap bitset(Count(), true);
-    for (size_t i = 0; i < n; ++i) {
-        const auto target = IndexStructure<T>(*(values + i));
-        auto lb = std::lower_bound(begin(), end(), target);
-        auto ub = std::upper_bound(lb, end(), target);
-        for (; lb < ub; ++lb) {
-            if (lb->a_ != target.a_) {
-                LOG_ERROR(
-                    "error happens in ScalarIndexSort<T>::NotIn, "
-                    "expected value is: {}, but real value is: {}",
-                    target.a_,
-                    lb->a_);
-            }
-            bitset[lb->idx_] = false;
-        }
-    }
+    ForEachRowIn(n, values, [&bitset](size_t idx) { bitset[idx] = false; });
     // NotIn(null) and In(null) is both false, need to mask with IsNotNull operate
     bitset &= valid_bitset_;
     return bitset;
@@ -629,6 +631,36 @@ ScalarIndexSort<T>::Reverse_Lookup(size_t idx) const {
     return operator[](offset).a_;
 }
 
+template <typename T>
+std::optional<std::vector<int64_t>>
+ScalarIndexSort<T>::FirstRowsInValueOrder(const TargetBitmapView& excluded,
+                                          bool ascending,
+                                          int64_t limit) const {
+    AssertInfo(is_built_, "index has not been built");
+    if (is_nested_index_) {
+        return std::nullopt;
+    }
+    std::vector<int64_t> offsets;
+    offsets.reserve(std::min<size_t>(limit, size_));
+    auto collect = [&](auto first, auto last) {
+        for (auto it = first;
+             it != last && offsets.size() < static_cast<size_t>(limit);
+             ++it) {
+            auto offset = static_cast<size_t>(it->idx_);
+            if (offset < excluded.size() && !excluded[offset]) {
+                offsets.push_back(offset);
+            }
+        }
+    };
+    // null rows are not in the sorted data
+    if (ascending) {
+        collect(begin(), end());
+    } else {
+        collect(rbegin(), const_reverse_iterator(begin()));
+    }
+    return offsets;
+}
+
 template <typename T>
 bool
 ScalarIndexSort<T>::ShouldSkip(const T lower_value,
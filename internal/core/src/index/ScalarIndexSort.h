@@ -125,6 +125,11 @@ class ScalarIndexSort : public ScalarIndex<T> {
     std::optional<T>
     Reverse_Lookup(size_t offset) const override;
 
+    std::optional<std::vector<int64_t>>
+    FirstRowsInValueOrder(const TargetBitmapView& excluded,
+                          bool ascending,
+                          int64_t limit) const override;
+
     int64_t
     Size() override {
         return (int64_t)size_;
@@ -179,6 +184,13 @@ class ScalarIndexSort : public ScalarIndex<T> {
     bool
     ShouldSkip(const T lower_value, const T upper_value, const OpType op);
 
+    // Calls func(row offset) for the rows whose value is one of `values`.
+    // The values are sorted and deduplicated first, so a long IN list walks
+    // the index once instead of binary searching it per value.
+    template <typename Func>
+    void
+    ForEachRowIn(size_t n, const T* values, Func func) const;
+
  public:
     const IndexStructure<T>*
     GetData() {
@@ -132,6 +132,33 @@ TEST(StlSortIndexTest, TestIn) {
         data, DataType::INT64, true, exec_expr, expected_result);
 }
 
+TEST(StlSortIndexTest, TestInLongUnsortedList) {
+    std::vector<int64_t> data;
+    for (int64_t i = 0; i < 1000; ++i) {
+        data.push_back((i * 7919) % 500);
+    }
+    // unsorted, with duplicates and values missing from the index
+    std::vector<int64_t> values;
+    for (int64_t v = 1200; v >= -200; v -= 3) {
+        values.push_back(v);
+        values.push_back(v);
+    }
+    std::vector<bool> expected_result;
+    for (auto value : data) {
+        expected_result.push_back(value % 3 == 0);
+    }
+
+    auto exec_expr =
+        [&values](const std::shared_ptr<ScalarIndexSort<int64_t>>& index) {
+            return index->In(values.size(), values.data());
+        };
+    test_stlsort_for_range(
+        data, DataType::INT64, false, exec_expr, expected_result);
+
+    test_stlsort_for_range(
+        data, DataType::INT64, true, exec_expr, expected_result);
+}
+
 TEST(StlSortIndexTest, MmapByteSizeCountsValidBitsetOnce) {
     constexpr size_t kAlignment = 32;
     constexpr uint64_t kMmapIndexPadding = 1;
@@ -169,3 +196,42 @@ TEST(StlSortIndexTest, MmapByteSizeCountsValidBitsetOnce) {
 
 // V2 compat test removed: kScalarIndexUseV3 flag deleted,
 // Upload()/Load() now always route to V3 paths.
+
+TEST(StlSortIndexTest, FirstRowsInValueOrder) {
+    std::vector<int64_t> data = {10, 2, 6, 5, 9, 3, 7, 8, 4, 1};
+    auto index = std::make_shared<index::ScalarIndexSort<int64_t>>(
+        CreateScalarSortTestFileManagerContext());
+    index->Build(data.size(), data.data());
+
+    // rows 9 (value 1) and 5 (value 3) are filtered out
+    TargetBitmap excluded(data.size(), false);
+    excluded.set(9);
+    excluded.set(5);
+    TargetBitmapView view(excluded);
+
+    auto asc = index->FirstRowsInValueOrder(view, true, 3);
+    ASSERT_TRUE(asc.has_value());
+    ASSERT_EQ(asc.value(), (std::vector<int64_t>{1, 8, 3}));
+
+    auto desc = index->FirstRowsInValueOrder(view, false, 2);
+    ASSERT_TRUE(desc.has_value());
+    ASSERT_EQ(desc.value(), (std::vector<int64_t>{0, 4}));
+
+    auto all = index->FirstRowsInValueOrder(view, true, 100);
+    ASSERT_TRUE(all.has_value());
+    ASSERT_EQ(all->size(), data.size() - 2);
+}
+
+TEST(StlSortIndexTest, FirstRowsInValueOrderSkipsNulls) {
+    std::vector<int64_t> data = {3, 1, 2, 0};
+    bool valid[] = {true, true, true, false};
+    auto index = std::make_shared<index::ScalarIndexSort<int64_t>>(
+        CreateScalarSortTestFileManagerContext());
+    index->Build(data.size(), data.data(), valid);
+
+    TargetBitmap excluded(data.size(), false);
+    auto asc =
+        index->FirstRowsInValueOrder(TargetBitmapView(excluded), true, 10);
+    ASSERT_TRUE(asc.has_value());
+    ASSERT_EQ(asc.value(), (std::vector<int64_t>{1, 2, 0}));
+}
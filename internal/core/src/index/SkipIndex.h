@@ -13,6 +13,8 @@
 
 #include <cstdint>
 #include <memory>
+#include <string>
+#include <utility>
 
 #include "cachinglayer/CacheSlot.h"
 #include "cachinglayer/Manager.h"
@@ -104,11 +106,10 @@ class FieldChunkMetricsTranslatorFromStatistics
 class FieldChunkMetricsTranslator
     : public cachinglayer::Translator<index::FieldChunkMetrics> {
  public:
-    FieldChunkMetricsTranslator(int64_t segment_id,
-                                FieldId field_id,
+    FieldChunkMetricsTranslator(std::string key,
                                 milvus::DataType data_type,
                                 std::shared_ptr<ChunkedColumnInterface> column)
-        : key_(fmt::format("skip_seg_{}_f_{}", segment_id, field_id.get())),
+        : key_(std::move(key)),
           data_type_(data_type),
           column_(column),
           meta_(cachinglayer::StorageType::MEMORY,
@@ -442,13 +443,37 @@ class SkipIndex {
         return CanSkipInQuery<T>(nullptr, field_id, chunk_id, values);
     }
 
+    // Min and max of the non-null values in one chunk of the field, or
+    // nullopt when there are none to use, see FieldChunkMetrics::GetMinMax.
+    std::optional<std::pair<index::Metrics, index::Metrics>>
+    GetChunkMinMax(milvus::OpContext* op_ctx,
+                   FieldId field_id,
+                   int64_t chunk_id) const {
+        auto pw = GetFieldChunkMetrics(op_ctx, field_id, chunk_id);
+        return pw.get()->GetMinMax();
+    }
+
     void
     LoadSkip(int64_t segment_id,
              milvus::FieldId field_id,
              milvus::DataType data_type,
              std::shared_ptr<ChunkedColumnInterface> column) {
+        LoadSkip(fmt::format("skip_seg_{}_f_{}", segment_id, field_id.get()),
+                 field_id,
+                 data_type,
+                 std::move(column));
+    }
+
+    // Same as above with a caller chosen cache key, for columns whose field
+    // ids are only unique within their owner, such as the shredded columns
+    // of a JsonKeyStats.
+    void
+    LoadSkip(std::string key,
+             milvus::FieldId field_id,
+             milvus::DataType data_type,
+             std::shared_ptr<ChunkedColumnInterface> column) {
         auto translator = std::make_unique<FieldChunkMetricsTranslator>(
-            segment_id, field_id, data_type, column);
+            std::move(key), data_type, std::move(column));
         auto cache_slot = cachinglayer::Manager::GetInstance()
                               .CreateCacheSlot<index::FieldChunkMetrics>(
                                   std::move(translator));
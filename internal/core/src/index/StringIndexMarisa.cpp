@@ -40,6 +40,7 @@
 #include "common/File.h"
 #include "common/Slice.h"
 #include "common/Tracer.h"
+#include "common/PatternMatcherCache.h"
 #include "common/RegexQuery.h"
 #include "common/Types.h"
 #include "common/Utils.h"
@@ -671,7 +672,9 @@ StringIndexMarisa::PatternMatch(const std::string& pattern,
     };
 
     if (op == proto::plan::OpType::RegexMatch) {
-        PartialRegexMatcher matcher(pattern);
+        auto matcher_ptr =
+            PatternMatcherCache::GetInstance().GetPartialRegexMatcher(pattern);
+        const auto& matcher = *matcher_ptr;
         for (size_t kid = 0; kid < csr_num_keys_; kid++) {
             auto start = csr_index_ptr_[kid];
             auto end = csr_index_ptr_[kid + 1];
@@ -685,7 +688,9 @@ StringIndexMarisa::PatternMatch(const std::string& pattern,
             }
         }
     } else if (op == proto::plan::OpType::Match) {
-        LikePatternMatcher matcher(pattern);
+        auto matcher_ptr =
+            PatternMatcherCache::GetInstance().GetLikePatternMatcher(pattern);
+        const auto& matcher = *matcher_ptr;
         for (size_t kid = 0; kid < csr_num_keys_; kid++) {
             auto start = csr_index_ptr_[kid];
             auto end = csr_index_ptr_[kid + 1];
@@ -33,8 +33,10 @@
 #include "bitset/bitset.h"
 #include "bitset/detail/element_vectorized.h"
 #include "common/Array.h"
+#include "common/Consts.h"
 #include "common/EasyAssert.h"
 #include "common/FieldDataInterface.h"
+#include "common/PatternMatcherCache.h"
 #include "common/RegexQuery.h"
 #include "common/Slice.h"
 #include "common/Tracer.h"
@@ -43,6 +45,7 @@
 #include "folly/small_vector.h"
 #include "glog/logging.h"
 #include "index/Meta.h"
+#include "index/ParallelBuild.h"
 #include "index/Utils.h"
 #include "knowhere/binaryset.h"
 #include "log/Log.h"
@@ -73,6 +76,35 @@ SetIdxToOffset(std::vector<int32_t>& idx_to_offsets,
     idx_to_offsets[row_id] = unique_idx;
 }
 
+// The serialization version an index built with `config` is written with.
+uint32_t
+SerializationVersionFor(const Config& config) {
+    auto engine_version =
+        GetValueFromConfig<int32_t>(config, SCALAR_INDEX_ENGINE_VERSION)
+            .value_or(1);
+    if (engine_version >= kEncodedPostingListIndexVersion) {
+        return StringIndexSort::POSTING_CODED_SERIALIZATION_VERSION;
+    }
+    if (engine_version >= kFrontCodedStringIndexVersion) {
+        return StringIndexSort::FRONT_CODED_SERIALIZATION_VERSION;
+    }
+    return StringIndexSort::SERIALIZATION_VERSION;
+}
+
+void
+CheckSerializationVersion(uint32_t version) {
+    if (version < StringIndexSort::SERIALIZATION_VERSION ||
+        version > StringIndexSort::POSTING_CODED_SERIALIZATION_VERSION) {
+        ThrowInfo(
+            milvus::ErrorCode::Unsupported,
+            fmt::format("Unsupported StringIndexSort serialization "
+                        "version: {}, expected: {} to {}",
+                        version,
+                        StringIndexSort::SERIALIZATION_VERSION,
+                        StringIndexSort::POSTING_CODED_SERIALIZATION_VERSION));
+    }
+}
+
 }  // namespace
 
 StringIndexSortImpl::ParsedData
@@ -84,12 +116,19 @@ StringIndexSortImpl::ParseBinaryData(const uint8_t* data, size_t data_size) {
     uint64_t magic_at_end;
     milvus::fastmem::FastMemcpy(
         &magic_at_end, data + data_size - sizeof(uint64_t), sizeof(uint64_t));
-    if (magic_at_end != StringIndexSort::MAGIC_CODE) {
+    if (magic_at_end != StringIndexSort::MAGIC_CODE &&
+        magic_at_end != StringIndexSort::FRONT_CODED_MAGIC_CODE &&
+        magic_at_end != StringIndexSort::POSTING_CODED_MAGIC_CODE) {
         ThrowInfo(DataFormatBroken,
                   fmt::format("Invalid magic code: expected 0x{:X}, got 0x{:X}",
                               StringIndexSort::MAGIC_CODE,
                               magic_at_end));
     }
+    result.posting_coded =
+        magic_at_end == StringIndexSort::POSTING_CODED_MAGIC_CODE;
+    result.front_coded =
+        magic_at_end == StringIndexSort::FRONT_CODED_MAGIC_CODE ||
+        result.posting_coded;
 
     // Read unique count
     milvus::fastmem::FastMemcpy(&result.unique_count, ptr, sizeof(uint32_t));
@@ -104,24 +143,36 @@ StringIndexSortImpl::ParseBinaryData(const uint8_t* data, size_t data_size) {
         return result;
     }
 
-    // Read string offsets
-    result.string_offsets = reinterpret_cast<const uint32_t*>(ptr);
-    ptr += result.unique_count * sizeof(uint32_t);
+    if (result.front_coded) {
+        result.string_offsets = nullptr;
+        result.string_data_start = nullptr;
+        result.dictionary = FrontCodedStrings(ptr);
+        AssertInfo(result.dictionary.size() == result.unique_count,
+                   "front coded strings count {} mismatch unique count {}",
+                   result.dictionary.size(),
+                   result.unique_count);
+        ptr += result.dictionary.ByteSize();
+    } else {
+        // Read string offsets
+        result.string_offsets = reinterpret_cast<const uint32_t*>(ptr);
+        ptr += result.unique_count * sizeof(uint32_t);
 
-    result.string_data_start = ptr;
+        result.string_data_start = ptr;
 
-    // Calculate total string section size
-    auto total_string_size = 0;
-    const uint8_t* last_str_ptr =
-        result.string_data_start +
-        result.string_offsets[result.unique_count - 1];
-    uint32_t last_str_len;
-    milvus::fastmem::FastMemcpy(&last_str_len, last_str_ptr, sizeof(uint32_t));
-    total_string_size = result.string_offsets[result.unique_count - 1] +
-                        sizeof(uint32_t) + last_str_len;
+        // Calculate total string section size
+        auto total_string_size = 0;
+        const uint8_t* last_str_ptr =
+            result.string_data_start +
+            result.string_offsets[result.unique_count - 1];
+        uint32_t last_str_len;
+        milvus::fastmem::FastMemcpy(
+            &last_str_len, last_str_ptr, sizeof(uint32_t));
+        total_string_size = result.string_offsets[result.unique_count - 1] +
+                            sizeof(uint32_t) + last_str_len;
 
-    // Skip past string section to posting list offsets
-    ptr = result.string_data_start + total_string_size;
+        // Skip past string section to posting list offsets
+        ptr = result.string_data_start + total_string_size;
+    }
     result.post_list_offsets = reinterpret_cast<const uint32_t*>(ptr);
     ptr += result.unique_count * sizeof(uint32_t);
 
@@ -267,13 +318,15 @@ StringIndexSort::Serialize(const Config& config) {
 
     BinarySet res_set;
 
+    // Use MemoryImpl to serialize
+    auto* memory_impl = static_cast<StringIndexSortMemoryImpl*>(impl_.get());
+    uint32_t version = SerializationVersionFor(config);
+    memory_impl->SetSerializationVersion(version);
+
     std::shared_ptr<uint8_t[]> version_buf(new uint8_t[sizeof(uint32_t)]);
-    uint32_t version = SERIALIZATION_VERSION;
     milvus::fastmem::FastMemcpy(version_buf.get(), &version, sizeof(uint32_t));
     res_set.Append("version", version_buf, sizeof(uint32_t));
 
-    // Use MemoryImpl to serialize
-    auto* memory_impl = static_cast<StringIndexSortMemoryImpl*>(impl_.get());
     size_t total_size = memory_impl->GetSerializedSize();
 
     std::shared_ptr<uint8_t[]> data_buffer(new uint8_t[total_size]);
@@ -399,13 +452,7 @@ StringIndexSort::LoadWithoutAssemble(const BinarySet& binary_set,
     milvus::fastmem::FastMemcpy(
         &version, version_data->data.get(), sizeof(uint32_t));
 
-    if (version != SERIALIZATION_VERSION) {
-        ThrowInfo(milvus::ErrorCode::Unsupported,
-                  fmt::format("Unsupported StringIndexSort serialization "
-                              "version: {}, expected: {}",
-                              version,
-                              SERIALIZATION_VERSION));
-    }
+    CheckSerializationVersion(version);
 
     // Check if mmap is enabled
     if (config.contains(MMAP_FILE_PATH)) {
@@ -516,6 +563,31 @@ StringIndexSort::Reverse_Lookup(size_t offset) const {
                                  idx_to_offsets_size_);
 }
 
+std::optional<std::vector<int64_t>>
+StringIndexSort::FirstRowsInValueOrder(const TargetBitmapView& excluded,
+                                       bool ascending,
+                                       int64_t limit) const {
+    if (is_nested_index_ || idx_to_offsets_size_ < total_num_rows_) {
+        return std::nullopt;
+    }
+    // (value rank, row), the rank is negated for a descending order
+    std::vector<std::pair<int64_t, int64_t>> ranked;
+    auto num_rows = std::min(total_num_rows_, excluded.size());
+    for (size_t row = 0; row < num_rows; ++row) {
+        if (!excluded[row] && valid_bitset_[row]) {
+            int64_t rank = idx_to_offsets_ptr_[row];
+            ranked.emplace_back(ascending ? rank : -rank, row);
+        }
+    }
+    auto count = std::min<size_t>(ranked.size(), limit);
+    std::partial_sort(ranked.begin(), ranked.begin() + count, ranked.end());
+    std::vector<int64_t> offsets(count);
+    for (size_t i = 0; i < count; ++i) {
+        offsets[i] = ranked[i].second;
+    }
+    return offsets;
+}
+
 int64_t
 StringIndexSort::Size() {
     return total_size_;
@@ -567,6 +639,8 @@ StringIndexSort::WriteEntries(storage::IndexEntryWriter* writer) {
     auto* memory_impl = dynamic_cast<StringIndexSortMemoryImpl*>(impl_.get());
     AssertInfo(memory_impl != nullptr,
                "WriteEntries requires StringIndexSortMemoryImpl");
+    auto version = SerializationVersionFor(config_);
+    memory_impl->SetSerializationVersion(version);
 
     size_t total_size = memory_impl->GetSerializedSize();
     std::vector<uint8_t> data_buffer(total_size);
@@ -581,7 +655,7 @@ StringIndexSort::WriteEntries(storage::IndexEntryWriter* writer) {
         }
     }
 
-    writer->PutMeta("version", SERIALIZATION_VERSION);
+    writer->PutMeta("version", version);
     writer->PutMeta("num_rows", total_num_rows_);
     writer->PutMeta("is_nested", is_nested_index_);
     writer->WriteEntry("index_data", data_buffer.data(), total_size);
@@ -597,14 +671,7 @@ StringIndexSort::LoadEntries(storage::IndexEntryReader& reader,
                              const Config& config) {
     config_ = config;
 
-    uint32_t version = reader.GetMeta<uint32_t>("version");
-    if (version != SERIALIZATION_VERSION) {
-        ThrowInfo(milvus::ErrorCode::Unsupported,
-                  fmt::format("Unsupported StringIndexSort serialization "
-                              "version: {}, expected: {}",
-                              version,
-                              SERIALIZATION_VERSION));
-    }
+    CheckSerializationVersion(reader.GetMeta<uint32_t>("version"));
     total_num_rows_ = reader.GetMeta<size_t>("num_rows");
     is_nested_index_ = reader.GetMeta<bool>("is_nested");
 
@@ -805,21 +872,34 @@ StringIndexSortMemoryImpl::BuildFromFieldData(
     size_t total_num_rows,
     TargetBitmap& valid_bitset,
     std::vector<int32_t>& idx_to_offsets) {
-    // Use map to collect unique values and their posting lists
-    // std::map is sorted
-    std::map<std::string, PostingList> map;
-
-    size_t row_id = 0;
-    for (const auto& field_data : field_datas) {
-        auto slice_num = field_data->get_num_rows();
-        for (size_t i = 0; i < slice_num; ++i) {
-            if (field_data->is_valid(i)) {
-                auto value = reinterpret_cast<const std::string*>(
-                    field_data->RawValue(i));
-                map[*value].push_back(static_cast<int32_t>(row_id));
-                valid_bitset.set(row_id);
-            }
-            row_id++;
+    // Every run collects the unique values of its rows and their posting
+    // lists, std::map is sorted. The runs hold ascending rows, so appending
+    // their posting lists in run order keeps the merged lists sorted.
+    auto bounds = ParallelBuildBounds(total_num_rows);
+    auto runs = bounds.size() - 1;
+    std::vector<std::map<std::string, PostingList>> run_maps(runs);
+    RunParallel(runs, [&](size_t run) {
+        auto& map = run_maps[run];
+        ForEachRowInRange(
+            field_datas,
+            bounds[run],
+            bounds[run + 1],
+            [&](const FieldDataPtr& field_data, size_t i, size_t row_id) {
+                if (field_data->is_valid(i)) {
+                    auto value = reinterpret_cast<const std::string*>(
+                        field_data->RawValue(i));
+                    map[*value].push_back(static_cast<int32_t>(row_id));
+                    valid_bitset.set(row_id);
+                }
+            });
+    });
+
+    auto map = std::move(run_maps[0]);
+    for (size_t run = 1; run < runs; ++run) {
+        for (auto& [value, posting_list] : run_maps[run]) {
+            auto& merged = map[value];
+            merged.insert(
+                merged.end(), posting_list.begin(), posting_list.end());
         }
     }
 
@@ -858,13 +938,17 @@ size_t
 StringIndexSortMemoryImpl::GetSerializedSize() const {
     size_t total_size = sizeof(uint32_t);  // unique_count
 
-    // String offsets array
-    total_size += unique_values_.size() * sizeof(uint32_t);
+    if (front_coded_) {
+        total_size += FrontCodedStrings::SerializedSize(unique_values_);
+    } else {
+        // String offsets array
+        total_size += unique_values_.size() * sizeof(uint32_t);
 
-    // String data section
-    for (size_t i = 0; i < unique_values_.size(); ++i) {
-        total_size += sizeof(uint32_t);          // str_len
-        total_size += unique_values_[i].size();  // string content
+        // String data section
+        for (size_t i = 0; i < unique_values_.size(); ++i) {
+            total_size += sizeof(uint32_t);          // str_len
+            total_size += unique_values_[i].size();  // string content
+        }
     }
 
     // Posting list offsets array
@@ -872,6 +956,11 @@ StringIndexSortMemoryImpl::GetSerializedSize() const {
 
     // Posting list data section
     for (size_t i = 0; i < posting_lists_.size(); ++i) {
+        if (posting_coded_) {
+            total_size += PostingListCodec::EncodedSize(
+                posting_lists_[i].data(), posting_lists_[i].size());
+            continue;
+        }
         total_size += sizeof(uint32_t);  // post_list_len
         total_size += posting_lists_[i].size() * sizeof(uint32_t);  // row_ids
     }
@@ -890,32 +979,37 @@ StringIndexSortMemoryImpl::SerializeToBinary(uint8_t* ptr,
     milvus::fastmem::FastMemcpy(ptr + offset, &unique_count, sizeof(uint32_t));
     offset += sizeof(uint32_t);
 
-    // Calculate and write string offsets
-    size_t string_offsets_start = offset;
-    offset += unique_count * sizeof(uint32_t);  // Reserve space for offsets
+    if (front_coded_) {
+        FrontCodedStrings::Serialize(unique_values_, ptr, offset);
+    } else {
+        // Calculate and write string offsets
+        size_t string_offsets_start = offset;
+        offset += unique_count * sizeof(uint32_t);  // Reserve space
 
-    size_t string_data_start = offset;
-    std::vector<uint32_t> string_offsets;
-    string_offsets.reserve(unique_count);
+        size_t string_data_start = offset;
+        std::vector<uint32_t> string_offsets;
+        string_offsets.reserve(unique_count);
 
-    // Write string data section
-    for (size_t i = 0; i < unique_values_.size(); ++i) {
-        string_offsets.push_back(
-            static_cast<uint32_t>(offset - string_data_start));
+        // Write string data section
+        for (size_t i = 0; i < unique_values_.size(); ++i) {
+            string_offsets.push_back(
+                static_cast<uint32_t>(offset - string_data_start));
 
-        // Write string length and content
-        uint32_t str_len = static_cast<uint32_t>(unique_values_[i].size());
-        milvus::fastmem::FastMemcpy(ptr + offset, &str_len, sizeof(uint32_t));
-        offset += sizeof(uint32_t);
-        milvus::fastmem::FastMemcpy(
-            ptr + offset, unique_values_[i].data(), str_len);
-        offset += str_len;
-    }
+            // Write string length and content
+            uint32_t str_len = static_cast<uint32_t>(unique_values_[i].size());
+            milvus::fastmem::FastMemcpy(
+                ptr + offset, &str_len, sizeof(uint32_t));
+            offset += sizeof(uint32_t);
+            milvus::fastmem::FastMemcpy(
+                ptr + offset, unique_values_[i].data(), str_len);
+            offset += str_len;
+        }
 
-    // Write string offsets back
-    milvus::fastmem::FastMemcpy(ptr + string_offsets_start,
-                                string_offsets.data(),
-                                string_offsets.size() * sizeof(uint32_t));
+        // Write string offsets back
+        milvus::fastmem::FastMemcpy(ptr + string_offsets_start,
+                                    string_offsets.data(),
+                                    string_offsets.size() * sizeof(uint32_t));
+    }
 
     // Calculate and write posting list offsets
     size_t post_list_offsets_start = offset;
@@ -930,6 +1024,14 @@ StringIndexSortMemoryImpl::SerializeToBinary(uint8_t* ptr,
         post_list_offsets.push_back(
             static_cast<uint32_t>(offset - post_list_data_start));
 
+        if (posting_coded_) {
+            PostingListCodec::Encode(posting_lists_[i].data(),
+                                     posting_lists_[i].size(),
+                                     ptr,
+                                     offset);
+            continue;
+        }
+
         // Write posting list length and content
         uint32_t post_list_len =
             static_cast<uint32_t>(posting_lists_[i].size());
@@ -951,6 +1053,11 @@ StringIndexSortMemoryImpl::SerializeToBinary(uint8_t* ptr,
 
     // Write magic code at the very end
     uint64_t magic = StringIndexSort::MAGIC_CODE;
+    if (posting_coded_) {
+        magic = StringIndexSort::POSTING_CODED_MAGIC_CODE;
+    } else if (front_coded_) {
+        magic = StringIndexSort::FRONT_CODED_MAGIC_CODE;
+    }
     milvus::fastmem::FastMemcpy(ptr + offset, &magic, sizeof(uint64_t));
     offset += sizeof(uint64_t);
 }
@@ -986,20 +1093,40 @@ StringIndexSortMemoryImpl::LoadFromData(const uint8_t* data,
 
     std::fill(idx_to_offsets.begin(), idx_to_offsets.end(), -1);
 
+    if (parsed.front_coded) {
+        parsed.dictionary.ForEach(
+            0, parsed.unique_count, [this](size_t, std::string_view value) {
+                unique_values_.emplace_back(value);
+            });
+    }
+
     // Read strings and posting lists
     for (uint32_t unique_idx = 0; unique_idx < parsed.unique_count;
          ++unique_idx) {
-        // Read string
-        const uint8_t* str_ptr =
-            parsed.string_data_start + parsed.string_offsets[unique_idx];
-        uint32_t str_len;
-        milvus::fastmem::FastMemcpy(&str_len, str_ptr, sizeof(uint32_t));
-        str_ptr += sizeof(uint32_t);
-        std::string value(reinterpret_cast<const char*>(str_ptr), str_len);
+        if (!parsed.front_coded) {
+            // Read string
+            const uint8_t* str_ptr =
+                parsed.string_data_start + parsed.string_offsets[unique_idx];
+            uint32_t str_len;
+            milvus::fastmem::FastMemcpy(&str_len, str_ptr, sizeof(uint32_t));
+            str_ptr += sizeof(uint32_t);
+            unique_values_.emplace_back(
+                reinterpret_cast<const char*>(str_ptr), str_len);
+        }
 
         // Read posting list
         const uint8_t* post_list_ptr =
             parsed.post_list_data_start + parsed.post_list_offsets[unique_idx];
+        if (parsed.posting_coded) {
+            PostingList posting_list;
+            posting_list.reserve(PostingListCodec::Count(post_list_ptr));
+            PostingListCodec::ForEach(post_list_ptr, [&](uint32_t row_id) {
+                posting_list.push_back(row_id);
+                SetIdxToOffset(idx_to_offsets, row_id, unique_idx);
+            });
+            posting_lists_.push_back(std::move(posting_list));
+            continue;
+        }
         uint32_t post_list_len;
         milvus::fastmem::FastMemcpy(
             &post_list_len, post_list_ptr, sizeof(uint32_t));
@@ -1018,7 +1145,6 @@ StringIndexSortMemoryImpl::LoadFromData(const uint8_t* data,
             SetIdxToOffset(idx_to_offsets, row_id, unique_idx);
         }
 
-        unique_values_.push_back(std::move(value));
         posting_lists_.push_back(std::move(posting_list));
     }
 }
@@ -1039,10 +1165,20 @@ StringIndexSortMemoryImpl::In(size_t n,
                               size_t total_num_rows) {
     TargetBitmap bitset(total_num_rows, false);
 
-    for (size_t i = 0; i < n; ++i) {
-        size_t idx = FindValueIndex(values[i]);
-        if (idx != std::numeric_limits<size_t>::max()) {
-            const auto& posting_list = posting_lists_[idx];
+    // Sorted probes walk unique_values_ once instead of a binary search each
+    std::vector<std::string_view> probes(values, values + n);
+    std::sort(probes.begin(), probes.end());
+    probes.erase(std::unique(probes.begin(), probes.end()), probes.end());
+
+    auto it = unique_values_.begin();
+    for (auto value : probes) {
+        it = GallopLowerBound(it, unique_values_.end(), value);
+        if (it == unique_values_.end()) {
+            break;
+        }
+        if (*it == value) {
+            const auto& posting_list =
+                posting_lists_[it - unique_values_.begin()];
             for (uint32_t row_id : posting_list) {
                 bitset[row_id] = true;
             }
@@ -1256,7 +1392,9 @@ StringIndexSortMemoryImpl::PatternMatch(const std::string& pattern,
 
     // For RegexMatch, use PartialRegexMatcher over all unique values
     if (op == proto::plan::OpType::RegexMatch) {
-        PartialRegexMatcher matcher(pattern);
+        auto matcher_ptr =
+            PatternMatcherCache::GetInstance().GetPartialRegexMatcher(pattern);
+        const auto& matcher = *matcher_ptr;
         for (size_t idx = 0; idx < unique_values_.size(); ++idx) {
             if (matcher(unique_values_[idx])) {
                 const auto& posting_list = posting_lists_[idx];
@@ -1291,7 +1429,9 @@ StringIndexSortMemoryImpl::PatternMatch(const std::string& pattern,
     auto [start_idx, end_idx] = FindPrefixRange(prefix);
 
     // Build matcher for LIKE pattern
-    LikePatternMatcher matcher(pattern);
+    auto matcher_ptr =
+        PatternMatcherCache::GetInstance().GetLikePatternMatcher(pattern);
+    const auto& matcher = *matcher_ptr;
 
     // Iterate over unique values in range (each value checked only once)
     for (size_t idx = start_idx; idx < end_idx; ++idx) {
@@ -1459,13 +1599,16 @@ StringIndexSortMmapImpl::LoadFromBuffer(std::vector<uint8_t>&& buffer,
     string_data_start_ = parsed.string_data_start;
     post_list_offsets_ = parsed.post_list_offsets;
     post_list_data_start_ = parsed.post_list_data_start;
+    front_coded_ = parsed.front_coded;
+    dictionary_ = parsed.dictionary;
+    posting_coded_ = parsed.posting_coded;
 
     std::fill(idx_to_offsets.begin(), idx_to_offsets.end(), -1);
     for (uint32_t unique_idx = 0; unique_idx < unique_count_; ++unique_idx) {
-        MmapEntry entry = GetEntry(unique_idx);
-        entry.for_each_row_id([&idx_to_offsets, unique_idx](uint32_t row_id) {
-            SetIdxToOffset(idx_to_offsets, row_id, unique_idx);
-        });
+        ForEachRowId(unique_idx,
+                     [&idx_to_offsets, unique_idx](uint32_t row_id) {
+                         SetIdxToOffset(idx_to_offsets, row_id, unique_idx);
+                     });
     }
 }
 
@@ -1500,23 +1643,28 @@ StringIndexSortMmapImpl::MmapAndParse(size_t data_size,
     string_data_start_ = parsed.string_data_start;
     post_list_offsets_ = parsed.post_list_offsets;
     post_list_data_start_ = parsed.post_list_data_start;
+    front_coded_ = parsed.front_coded;
+    dictionary_ = parsed.dictionary;
+    posting_coded_ = parsed.posting_coded;
 
     if (!skip_idx_to_offsets) {
         // Rebuild idx_to_offsets by iterating through posting lists
         std::fill(idx_to_offsets.begin(), idx_to_offsets.end(), -1);
         for (uint32_t unique_idx = 0; unique_idx < unique_count_;
              ++unique_idx) {
-            MmapEntry entry = GetEntry(unique_idx);
-            entry.for_each_row_id(
-                [&idx_to_offsets, unique_idx](uint32_t row_id) {
-                    SetIdxToOffset(idx_to_offsets, row_id, unique_idx);
-                });
+            ForEachRowId(unique_idx,
+                         [&idx_to_offsets, unique_idx](uint32_t row_id) {
+                             SetIdxToOffset(idx_to_offsets, row_id, unique_idx);
+                         });
         }
     }
 }
 
 size_t
 StringIndexSortMmapImpl::FindValueIndex(const std::string& value) const {
+    if (front_coded_) {
+        return dictionary_.Find(value);
+    }
     std::string_view search_value(value);
     size_t left = 0;
     size_t right = unique_count_;
@@ -1541,6 +1689,9 @@ StringIndexSortMmapImpl::FindValueIndex(const std::string& value) const {
 
 size_t
 StringIndexSortMmapImpl::LowerBound(const std::string_view& value) const {
+    if (front_coded_) {
+        return dictionary_.LowerBound(value);
+    }
     size_t left = 0, right = unique_count_;
     while (left < right) {
         size_t mid = left + (right - left) / 2;
@@ -1555,6 +1706,9 @@ StringIndexSortMmapImpl::LowerBound(const std::string_view& value) const {
 
 size_t
 StringIndexSortMmapImpl::UpperBound(const std::string_view& value) const {
+    if (front_coded_) {
+        return dictionary_.UpperBound(value);
+    }
     size_t left = 0, right = unique_count_;
     while (left < right) {
         size_t mid = left + (right - left) / 2;
@@ -1576,10 +1730,9 @@ StringIndexSortMmapImpl::In(size_t n,
     for (size_t i = 0; i < n; ++i) {
         size_t idx = FindValueIndex(values[i]);
         if (idx < unique_count_) {
-            MmapEntry entry = GetEntry(idx);
             // Set bits for all row_ids in posting list
-            entry.for_each_row_id(
-                [&bitset](uint32_t row_id) { bitset.set(row_id); });
+            ForEachRowId(idx,
+                         [&bitset](uint32_t row_id) { bitset.set(row_id); });
         }
     }
 
@@ -1646,9 +1799,7 @@ StringIndexSortMmapImpl::Range(const std::string& value,
 
     // Set bits for all posting lists in range
     for (size_t i = start_idx; i < end_idx; ++i) {
-        MmapEntry entry = GetEntry(i);
-        entry.for_each_row_id(
-            [&bitset](uint32_t row_id) { bitset.set(row_id); });
+        ForEachRowId(i, [&bitset](uint32_t row_id) { bitset.set(row_id); });
     }
 
     return bitset;
@@ -1669,9 +1820,7 @@ StringIndexSortMmapImpl::Range(const std::string& lower_bound_value,
 
     // Set bits for all posting lists in range
     for (size_t i = start_idx; i < end_idx; ++i) {
-        MmapEntry entry = GetEntry(i);
-        entry.for_each_row_id(
-            [&bitset](uint32_t row_id) { bitset.set(row_id); });
+        ForEachRowId(i, [&bitset](uint32_t row_id) { bitset.set(row_id); });
     }
 
     return bitset;
@@ -1686,9 +1835,7 @@ StringIndexSortMmapImpl::PrefixMatch(const std::string_view prefix,
     auto [start_idx, end_idx] = FindPrefixRange(std::string(prefix));
 
     for (size_t idx = start_idx; idx < end_idx; ++idx) {
-        MmapEntry entry = GetEntry(idx);
-        entry.for_each_row_id(
-            [&bitset](uint32_t row_id) { bitset.set(row_id); });
+        ForEachRowId(idx, [&bitset](uint32_t row_id) { bitset.set(row_id); });
     }
 
     return bitset;
@@ -1754,16 +1901,15 @@ StringIndexSortMmapImpl::PatternMatch(const std::string& pattern,
 
     // For RegexMatch, use PartialRegexMatcher over all unique values
     if (op == proto::plan::OpType::RegexMatch) {
-        PartialRegexMatcher matcher(pattern);
-        for (size_t idx = 0; idx < unique_count_; ++idx) {
-            MmapEntry entry = GetEntry(idx);
-            std::string_view sv = entry.get_string_view();
-
+        auto matcher_ptr =
+            PatternMatcherCache::GetInstance().GetPartialRegexMatcher(pattern);
+        const auto& matcher = *matcher_ptr;
+        ForEachValue(0, unique_count_, [&](size_t idx, std::string_view sv) {
             if (matcher(sv)) {
-                entry.for_each_row_id(
-                    [&bitset](uint32_t row_id) { bitset.set(row_id); });
+                ForEachRowId(
+                    idx, [&bitset](uint32_t row_id) { bitset.set(row_id); });
             }
-        }
+        });
         return bitset;
     }
 
@@ -1771,15 +1917,12 @@ StringIndexSortMmapImpl::PatternMatch(const std::string& pattern,
     // Still benefits from unique value deduplication
     if (op == proto::plan::OpType::PostfixMatch ||
         op == proto::plan::OpType::InnerMatch) {
-        for (size_t idx = 0; idx < unique_count_; ++idx) {
-            MmapEntry entry = GetEntry(idx);
-            std::string_view sv = entry.get_string_view();
-
+        ForEachValue(0, unique_count_, [&](size_t idx, std::string_view sv) {
             if (MatchValue(sv, pattern, op)) {
-                entry.for_each_row_id(
-                    [&bitset](uint32_t row_id) { bitset.set(row_id); });
+                ForEachRowId(
+                    idx, [&bitset](uint32_t row_id) { bitset.set(row_id); });
             }
-        }
+        });
         return bitset;
     }
 
@@ -1790,19 +1933,18 @@ StringIndexSortMmapImpl::PatternMatch(const std::string& pattern,
     auto [start_idx, end_idx] = FindPrefixRange(prefix);
 
     // Build matcher for LIKE pattern
-    LikePatternMatcher matcher(pattern);
+    auto matcher_ptr =
+        PatternMatcherCache::GetInstance().GetLikePatternMatcher(pattern);
+    const auto& matcher = *matcher_ptr;
 
     // Iterate over unique values in range (each value checked only once)
-    for (size_t idx = start_idx; idx < end_idx; ++idx) {
-        MmapEntry entry = GetEntry(idx);
-        std::string_view sv = entry.get_string_view();
-
+    ForEachValue(start_idx, end_idx, [&](size_t idx, std::string_view sv) {
         if (matcher(sv)) {
             // Match found, set all row IDs in posting list
-            entry.for_each_row_id(
-                [&bitset](uint32_t row_id) { bitset.set(row_id); });
+            ForEachRowId(idx,
+                         [&bitset](uint32_t row_id) { bitset.set(row_id); });
         }
-    }
+    });
 
     return bitset;
 }
@@ -1821,6 +1963,9 @@ StringIndexSortMmapImpl::Reverse_Lookup(size_t offset,
         int32_t unique_idx = idx_to_offsets_ptr[offset];
         if (unique_idx >= 0 &&
             static_cast<size_t>(unique_idx) < unique_count_) {
+            if (front_coded_) {
+                return dictionary_.Get(unique_idx);
+            }
             MmapEntry entry = GetEntry(unique_idx);
             // Convert string_view to string for return
             std::string_view sv = entry.get_string_view();
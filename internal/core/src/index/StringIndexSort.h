@@ -28,6 +28,8 @@
 #include <boost/container/vector.hpp>
 #include <folly/small_vector.h>
 
+#include "index/FrontCodedStrings.h"
+#include "index/PostingListCodec.h"
 #include "index/StringIndex.h"
 #include "storage/MemFileManagerImpl.h"
 #include "storage/DiskFileManagerImpl.h"
@@ -45,6 +47,18 @@ class StringIndexSort : public StringIndex {
     static constexpr uint32_t SERIALIZATION_VERSION = 1;
     static constexpr uint64_t MAGIC_CODE =
         0x5354524E47534F52;  // "STRNGSOR" in hex
+    // Version 2 stores the sorted unique values front coded, see
+    // FrontCodedStrings. It is written from scalar index engine version
+    // kFrontCodedStringIndexVersion on, older nodes cannot load it.
+    static constexpr uint32_t FRONT_CODED_SERIALIZATION_VERSION = 2;
+    static constexpr uint64_t FRONT_CODED_MAGIC_CODE =
+        0x5354524E47534643;  // "STRNGSFC" in hex
+    // Version 3 also encodes every posting list with PostingListCodec. It is
+    // written from scalar index engine version kEncodedPostingListIndexVersion
+    // on.
+    static constexpr uint32_t POSTING_CODED_SERIALIZATION_VERSION = 3;
+    static constexpr uint64_t POSTING_CODED_MAGIC_CODE =
+        0x5354524E47535043;  // "STRNGSPC" in hex
 
     explicit StringIndexSort(
         const storage::FileManagerContext& file_manager_context =
@@ -138,6 +152,13 @@ class StringIndexSort : public StringIndex {
     std::optional<std::string>
     Reverse_Lookup(size_t offset) const override;
 
+    // Ranks the visible rows by the sorted position of their value, no
+    // string is compared.
+    std::optional<std::vector<int64_t>>
+    FirstRowsInValueOrder(const TargetBitmapView& excluded,
+                          bool ascending,
+                          int64_t limit) const override;
+
     int64_t
     Size() override;
 
@@ -207,6 +228,13 @@ class StringIndexSortImpl {
         const uint8_t* string_data_start;
         const uint32_t* post_list_offsets;
         const uint8_t* post_list_data_start;
+        // set instead of the string section when the magic code is
+        // FRONT_CODED_MAGIC_CODE or POSTING_CODED_MAGIC_CODE
+        bool front_coded{false};
+        FrontCodedStrings dictionary;
+        // the posting lists are PostingListCodec encoded, magic code
+        // POSTING_CODED_MAGIC_CODE
+        bool posting_coded{false};
     };
 
     static ParsedData
@@ -289,9 +317,23 @@ class StringIndexSortMemoryImpl : public StringIndexSortImpl {
     // string_data: str_len1, str1, str_len2, str2, ...
     // post_list_offsets: array of offsets into post_list_data section
     // post_list_data: post_list_len1, row_id1, row_id2, ..., post_list_len2, row_id1, row_id2, ...
+    //
+    // Front coded, string_offsets and string_data are replaced by the
+    // FrontCodedStrings section and the magic code is FRONT_CODED_MAGIC_CODE.
+    // Posting coded, every post_list_data entry is a PostingListCodec encoded
+    // list instead and the magic code is POSTING_CODED_MAGIC_CODE.
     void
     SerializeToBinary(uint8_t* ptr, size_t& offset) const;
 
+    // The StringIndexSort serialization version to serialize with.
+    void
+    SetSerializationVersion(uint32_t version) {
+        front_coded_ =
+            version >= StringIndexSort::FRONT_CODED_SERIALIZATION_VERSION;
+        posting_coded_ =
+            version >= StringIndexSort::POSTING_CODED_SERIALIZATION_VERSION;
+    }
+
     size_t
     GetSerializedSize() const;
 
@@ -379,6 +421,10 @@ class StringIndexSortMemoryImpl : public StringIndexSortImpl {
     std::vector<std::string> unique_values_;
     // Corresponding posting lists
     std::vector<PostingList> posting_lists_;
+    // Serialize the unique values front coded
+    bool front_coded_ = false;
+    // Serialize the posting lists PostingListCodec encoded
+    bool posting_coded_ = false;
 };
 
 class StringIndexSortMmapImpl : public StringIndexSortImpl {
@@ -532,6 +578,39 @@ class StringIndexSortMmapImpl : public StringIndexSortImpl {
     std::pair<size_t, size_t>
     FindPrefixRange(const std::string& prefix) const;
 
+    // Calls func(row_id) for the posting list of unique value `idx`, without
+    // touching the string section.
+    template <typename Func>
+    void
+    ForEachRowId(size_t idx, Func func) const {
+        const uint8_t* post_list_ptr =
+            post_list_data_start_ + post_list_offsets_[idx];
+        if (posting_coded_) {
+            PostingListCodec::ForEach(post_list_ptr, func);
+            return;
+        }
+        auto post_list_len = *reinterpret_cast<const uint32_t*>(post_list_ptr);
+        auto row_ids = reinterpret_cast<const uint32_t*>(post_list_ptr +
+                                                         sizeof(uint32_t));
+        for (uint32_t i = 0; i < post_list_len; ++i) {
+            func(row_ids[i]);
+        }
+    }
+
+    // Calls func(idx, value) for the unique values in [begin, end).
+    template <typename Func>
+    void
+    ForEachValue(size_t begin, size_t end, Func func) const {
+        if (front_coded_) {
+            dictionary_.ForEach(begin, end, func);
+            return;
+        }
+        for (size_t idx = begin; idx < end; ++idx) {
+            func(idx, GetEntry(idx).get_string_view());
+        }
+    }
+
+    // Only valid when neither the strings nor the posting lists are coded.
     MmapEntry
     GetEntry(size_t idx) const {
         const uint8_t* str_ptr = string_data_start_ + string_offsets_[idx];
@@ -560,6 +639,10 @@ class StringIndexSortMmapImpl : public StringIndexSortImpl {
     const uint8_t* string_data_start_ = nullptr;
     const uint32_t* post_list_offsets_ = nullptr;
     const uint8_t* post_list_data_start_ = nullptr;
+    // The string section when it is front coded
+    bool front_coded_ = false;
+    FrontCodedStrings dictionary_;
+    bool posting_coded_ = false;
 };
 
 using StringIndexSortPtr = std::unique_ptr<StringIndexSort>;
@@ -1069,3 +1069,168 @@ TEST(StringIndexSortPatternMatchTest, InnerMatchMmap) {
     ASSERT_TRUE(bitset[1]);   // category
     ASSERT_FALSE(bitset[2]);  // dog
 }
+
+TEST(StringIndexSortFrontCodedTest, SerializeAndQuery) {
+    std::vector<std::string> test_data;
+    for (int i = 0; i < 200; ++i) {
+        test_data.push_back("https://milvus.io/docs/v2/page_" +
+                            std::to_string(i % 50));
+    }
+    auto index = milvus::index::CreateStringIndexSort({});
+    index->Build(test_data.size(), test_data.data());
+
+    milvus::Config config;
+    config[milvus::index::SCALAR_INDEX_ENGINE_VERSION] =
+        milvus::kFrontCodedStringIndexVersion;
+    auto binary_set = index->Serialize(config);
+    auto version = binary_set.GetByName("version");
+    ASSERT_NE(version, nullptr);
+    ASSERT_EQ(
+        *reinterpret_cast<uint32_t*>(version->data.get()),
+        milvus::index::StringIndexSort::FRONT_CODED_SERIALIZATION_VERSION);
+
+    // the dictionary shares the long url prefix
+    auto flat_binary_set = index->Serialize({});
+    milvus::Assemble(binary_set);
+    milvus::Assemble(flat_binary_set);
+    ASSERT_LT(binary_set.GetByName("index_data")->size,
+              flat_binary_set.GetByName("index_data")->size);
+
+    milvus::Config mmap_config;
+    mmap_config[milvus::index::MMAP_FILE_PATH] =
+        TestLocalPath + "test_front_coded_mmap.idx";
+    for (const auto& load_config : {milvus::Config{}, mmap_config}) {
+        auto loaded = milvus::index::CreateStringIndexSort({});
+        loaded->Load(binary_set, load_config);
+        ASSERT_EQ(loaded->Count(), test_data.size());
+
+        std::vector<std::string> values = {test_data[7], "missing"};
+        auto in = loaded->In(values.size(), values.data());
+        ASSERT_EQ(in.count(), 4);
+        ASSERT_TRUE(in[7]);
+        ASSERT_TRUE(in[57]);
+
+        // page_40 .. page_49 and page_5 .. page_9
+        auto range = loaded->Range(test_data[40], OpType::GreaterEqual);
+        ASSERT_EQ(range.count(), 60);
+
+        auto prefix = loaded->PrefixMatch("https://milvus.io/docs/v2/page_1");
+        ASSERT_EQ(prefix.count(), 44);
+
+        auto pattern = loaded->PatternMatch("%page_4_", OpType::Match);
+        ASSERT_EQ(pattern.count(), 40);
+        auto postfix = loaded->PatternMatch("_49", OpType::PostfixMatch);
+        ASSERT_EQ(postfix.count(), 4);
+
+        for (size_t i = 0; i < test_data.size(); ++i) {
+            auto result = loaded->Reverse_Lookup(i);
+            ASSERT_TRUE(result.has_value());
+            ASSERT_EQ(result.value(), test_data[i]);
+        }
+    }
+    std::remove((TestLocalPath + "test_front_coded_mmap.idx").c_str());
+}
+
+TEST(StringIndexSortFrontCodedTest, OlderEngineVersionKeepsFlatLayout) {
+    std::vector<std::string> test_data = {"a", "b", "c"};
+    auto index = milvus::index::CreateStringIndexSort({});
+    index->Build(test_data.size(), test_data.data());
+
+    milvus::Config config;
+    config[milvus::index::SCALAR_INDEX_ENGINE_VERSION] =
+        milvus::kFrontCodedStringIndexVersion - 1;
+    auto binary_set = index->Serialize(config);
+    auto version = binary_set.GetByName("version");
+    ASSERT_NE(version, nullptr);
+    ASSERT_EQ(*reinterpret_cast<uint32_t*>(version->data.get()),
+              milvus::index::StringIndexSort::SERIALIZATION_VERSION);
+}
+
+TEST(StringIndexSortFrontCodedTest, PostingCodedSerializeAndQuery) {
+    // low cardinality, the posting lists dominate the index
+    std::vector<std::string> test_data;
+    for (int i = 0; i < 10000; ++i) {
+        test_data.push_back(i < 9000 ? "common" : "rare_" + std::to_string(i));
+    }
+    auto index = milvus::index::CreateStringIndexSort({});
+    index->Build(test_data.size(), test_data.data());
+
+    milvus::Config config;
+    config[milvus::index::SCALAR_INDEX_ENGINE_VERSION] =
+        milvus::kEncodedPostingListIndexVersion;
+    auto binary_set = index->Serialize(config);
+    auto version = binary_set.GetByName("version");
+    ASSERT_NE(version, nullptr);
+    ASSERT_EQ(
+        *reinterpret_cast<uint32_t*>(version->data.get()),
+        milvus::index::StringIndexSort::POSTING_CODED_SERIALIZATION_VERSION);
+
+    milvus::Config front_coded_config;
+    front_coded_config[milvus::index::SCALAR_INDEX_ENGINE_VERSION] =
+        milvus::kFrontCodedStringIndexVersion;
+    auto front_coded_binary_set = index->Serialize(front_coded_config);
+    milvus::Assemble(binary_set);
+    milvus::Assemble(front_coded_binary_set);
+    ASSERT_LT(binary_set.GetByName("index_data")->size * 2,
+              front_coded_binary_set.GetByName("index_data")->size);
+
+    milvus::Config mmap_config;
+    mmap_config[milvus::index::MMAP_FILE_PATH] =
+        TestLocalPath + "test_posting_coded_mmap.idx";
+    for (const auto& load_config : {milvus::Config{}, mmap_config}) {
+        auto loaded = milvus::index::CreateStringIndexSort({});
+        loaded->Load(binary_set, load_config);
+        ASSERT_EQ(loaded->Count(), test_data.size());
+
+        std::vector<std::string> values = {"common", "rare_9500"};
+        auto in = loaded->In(values.size(), values.data());
+        ASSERT_EQ(in.count(), 9001);
+        ASSERT_TRUE(in[0]);
+        ASSERT_TRUE(in[8999]);
+        ASSERT_TRUE(in[9500]);
+        ASSERT_FALSE(in[9000]);
+
+        auto range = loaded->Range("rare_", OpType::GreaterEqual);
+        ASSERT_EQ(range.count(), 1000);
+        auto prefix = loaded->PrefixMatch("rare_99");
+        ASSERT_EQ(prefix.count(), 100);
+        auto pattern = loaded->PatternMatch("mon", OpType::PostfixMatch);
+        ASSERT_EQ(pattern.count(), 9000);
+
+        for (size_t i = 0; i < test_data.size(); i += 97) {
+            ASSERT_EQ(loaded->Reverse_Lookup(i).value(), test_data[i]);
+        }
+    }
+    std::remove((TestLocalPath + "test_posting_coded_mmap.idx").c_str());
+}
+
+TEST_F(StringIndexSortTest, FirstRowsInValueOrderMemory) {
+    std::vector<std::string> values = {"d", "b", "a", "c", "b"};
+    auto index = milvus::index::CreateStringIndexSort({});
+    index->Build(values.size(), values.data());
+
+    TargetBitmap excluded(values.size(), false);
+    excluded.set(2);
+    TargetBitmapView view(excluded);
+
+    auto asc = index->FirstRowsInValueOrder(view, true, 3);
+    ASSERT_TRUE(asc.has_value());
+    ASSERT_EQ(asc.value(), (std::vector<int64_t>{1, 4, 3}));
+
+    auto desc = index->FirstRowsInValueOrder(view, false, 2);
+    ASSERT_TRUE(desc.has_value());
+    ASSERT_EQ(desc.value(), (std::vector<int64_t>{0, 3}));
+}
+
+TEST_F(StringIndexSortTest, FirstRowsInValueOrderSkipsNulls) {
+    std::vector<std::string> values = {"b", "a", "c"};
+    bool valid[] = {true, false, true};
+    auto index = milvus::index::CreateStringIndexSort({});
+    index->Build(values.size(), values.data(), valid);
+
+    TargetBitmap excluded(values.size(), false);
+    auto desc =
+        index->FirstRowsInValueOrder(TargetBitmapView(excluded), false, 10);
+    ASSERT_TRUE(desc.has_value());
+    ASSERT_EQ(desc.value(), (std::vector<int64_t>{2, 0}));
+}
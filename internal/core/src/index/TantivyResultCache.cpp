@@ -0,0 +1,101 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "index/TantivyResultCache.h"
+
+#include <utility>
+
+namespace milvus::index {
+
+std::optional<TargetBitmap>
+TantivyResultCache::Get(const void* reader, const std::string& key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    CheckReaderLocked(reader);
+    auto it = index_.find(key);
+    if (it == index_.end()) {
+        return std::nullopt;
+    }
+    entries_.splice(entries_.begin(), entries_, it->second);
+    const auto& entry = *it->second;
+    TargetBitmap bitset(entry.num_rows);
+    for (auto row : entry.rows) {
+        bitset.set(row);
+    }
+    return bitset;
+}
+
+void
+TantivyResultCache::Put(const void* reader,
+                        const std::string& key,
+                        const TargetBitmap& bitset,
+                        size_t capacity) {
+    // compressed outside of the lock, queries only serialize on the lists
+    Entry entry{key, roaring::Roaring(), bitset.size(), 0};
+    auto next = bitset.find_first();
+    while (next.has_value()) {
+        entry.rows.add(static_cast<uint32_t>(next.value()));
+        next = bitset.find_next(next.value());
+    }
+    entry.rows.runOptimize();
+    entry.rows.shrinkToFit();
+    entry.bytes = entry.rows.getSizeInBytes() + key.size() + sizeof(Entry);
+    if (entry.bytes > capacity) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    CheckReaderLocked(reader);
+    auto it = index_.find(key);
+    if (it != index_.end()) {
+        bytes_ -= it->second->bytes;
+        entries_.erase(it->second);
+        index_.erase(it);
+    }
+    bytes_ += entry.bytes;
+    entries_.push_front(std::move(entry));
+    index_.emplace(key, entries_.begin());
+    while (bytes_ > capacity) {
+        auto& last = entries_.back();
+        bytes_ -= last.bytes;
+        index_.erase(last.key);
+        entries_.pop_back();
+    }
+}
+
+size_t
+TantivyResultCache::ByteSize() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return bytes_;
+}
+
+size_t
+TantivyResultCache::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+}
+
+void
+TantivyResultCache::CheckReaderLocked(const void* reader) {
+    if (reader == reader_) {
+        return;
+    }
+    reader_ = reader;
+    entries_.clear();
+    index_.clear();
+    bytes_ = 0;
+}
+
+}  // namespace milvus::index
@@ -0,0 +1,83 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#include <roaring/roaring.hh>
+
+#include "common/Types.h"
+
+namespace milvus::index {
+
+// Least recently used results of the queries a sealed inverted index
+// answered, so a filter repeated across requests such as `tag == 'x'` skips
+// tantivy. Results are kept as run optimized roaring bitmaps, which is a
+// fraction of the bitset for the sparse or clustered hits of term filters.
+//
+// Entries are keyed by the caller with the query kind and its operands, and
+// belong to the tantivy reader they were computed with: passing another
+// reader, as after a reload, drops every entry first.
+//
+// Thread safety: All methods are thread-safe.
+class TantivyResultCache {
+ public:
+    // The result cached under `key` for `reader`, nullopt on a miss.
+    std::optional<TargetBitmap>
+    Get(const void* reader, const std::string& key);
+
+    // Caches `bitset` under `key`, then evicts the least recently used
+    // entries until the cache holds at most `capacity` bytes. A result
+    // larger than `capacity` on its own is not cached.
+    void
+    Put(const void* reader,
+        const std::string& key,
+        const TargetBitmap& bitset,
+        size_t capacity);
+
+    size_t
+    ByteSize() const;
+
+    size_t
+    size() const;
+
+ private:
+    struct Entry {
+        std::string key;
+        roaring::Roaring rows;
+        size_t num_rows{0};
+        size_t bytes{0};
+    };
+
+    // Drops every entry if they were not computed with `reader`.
+    void
+    CheckReaderLocked(const void* reader);
+
+    mutable std::mutex mutex_;
+    const void* reader_{nullptr};
+    // most recently used first
+    std::list<Entry> entries_;
+    std::unordered_map<std::string, std::list<Entry>::iterator> index_;
+    size_t bytes_{0};
+};
+
+}  // namespace milvus::index
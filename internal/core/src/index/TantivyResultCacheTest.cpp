@@ -0,0 +1,85 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <string>
+
+#include "index/TantivyResultCache.h"
+
+using milvus::TargetBitmap;
+using milvus::index::TantivyResultCache;
+
+namespace {
+
+TargetBitmap
+Bitset(size_t size, size_t step) {
+    TargetBitmap bitset(size);
+    for (size_t i = 0; i < size; i += step) {
+        bitset.set(i);
+    }
+    return bitset;
+}
+
+}  // namespace
+
+TEST(TantivyResultCacheTest, RoundTrips) {
+    TantivyResultCache cache;
+    int reader;
+    auto bitset = Bitset(10000, 7);
+    EXPECT_FALSE(cache.Get(&reader, "a").has_value());
+    cache.Put(&reader, "a", bitset, 1 << 20);
+
+    auto cached = cache.Get(&reader, "a");
+    ASSERT_TRUE(cached.has_value());
+    EXPECT_EQ(cached->size(), bitset.size());
+    EXPECT_EQ(cached->count(), bitset.count());
+    for (size_t i = 0; i < bitset.size(); i++) {
+        ASSERT_EQ((*cached)[i], bitset[i]);
+    }
+    EXPECT_EQ(cache.size(), 1);
+}
+
+TEST(TantivyResultCacheTest, EvictsLeastRecentlyUsed) {
+    TantivyResultCache cache;
+    int reader;
+    auto bitset = Bitset(10000, 3);
+    cache.Put(&reader, "a", bitset, 1 << 20);
+    auto entry_bytes = cache.ByteSize();
+    auto capacity = entry_bytes * 2;
+    cache.Put(&reader, "b", bitset, capacity);
+    // a is now more recent than b
+    EXPECT_TRUE(cache.Get(&reader, "a").has_value());
+    cache.Put(&reader, "c", bitset, capacity);
+
+    EXPECT_TRUE(cache.Get(&reader, "a").has_value());
+    EXPECT_FALSE(cache.Get(&reader, "b").has_value());
+    EXPECT_TRUE(cache.Get(&reader, "c").has_value());
+    EXPECT_LE(cache.ByteSize(), capacity);
+
+    // too large on its own
+    cache.Put(&reader, "d", bitset, entry_bytes - 1);
+    EXPECT_FALSE(cache.Get(&reader, "d").has_value());
+}
+
+TEST(TantivyResultCacheTest, DropsEntriesOfOtherReader) {
+    TantivyResultCache cache;
+    int reader;
+    int reloaded;
+    cache.Put(&reader, "a", Bitset(100, 2), 1 << 20);
+    EXPECT_FALSE(cache.Get(&reloaded, "a").has_value());
+    EXPECT_EQ(cache.size(), 0);
+    EXPECT_EQ(cache.ByteSize(), 0);
+}
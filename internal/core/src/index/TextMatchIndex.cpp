@@ -12,12 +12,16 @@
 #include <boost/uuid/random_generator.hpp>
 #include "common/FastMem.h"
 #include <boost/uuid/uuid_io.hpp>
+#include <algorithm>
+#include <chrono>
 #include <memory>
+#include <mutex>
 #include <shared_mutex>
 
 #include "index/TextMatchIndex.h"
 #include "index/InvertedIndexUtil.h"
 #include "index/Utils.h"
+#include "log/Log.h"
 #include "storage/ThreadPools.h"
 
 namespace milvus::index {
@@ -48,9 +52,15 @@ TextMatchIndex::TextMatchIndex(int64_t commit_interval_in_ms,
         ,
         analyzer_name,
         analyzer_params);
+    delta_analyzer_params_ = analyzer_params;
     set_is_growing(true);
 }
 
+TextMatchIndex::~TextMatchIndex() {
+    // the background commit uses the wrapper the base class frees
+    WaitBackgroundCommit();
+}
+
 TextMatchIndex::TextMatchIndex(const std::string& path,
                                const char* unique_id,
                                uint32_t tantivy_index_version,
@@ -244,6 +254,8 @@ TextMatchIndex::Load(const Config& config) {
     if (!load_in_mmap) {
         // the index is loaded in ram, so we can remove files in advance
         disk_file_manager_->RemoveTextLogFiles();
+    } else {
+        ReadaheadTantivyIndex(prefix);
     }
 }
 
@@ -284,8 +296,78 @@ TextMatchIndex::AddTextsGrowing(size_t n,
         }
     }
     wrapper_->add_data(texts, n, offset_begin);
+    // added to the delta only once in the writer, so a commit counting it
+    // as covered does cover it
+    AppendDelta(n, texts, valids, offset_begin);
     if (shouldTriggerCommit()) {
-        Commit();
+        ScheduleCommit();
+    }
+}
+
+void
+TextMatchIndex::AppendDelta(size_t n,
+                            const std::string* texts,
+                            const bool* valids,
+                            int64_t offset_begin) {
+    std::vector<DeltaRow> rows;
+    rows.reserve(n);
+    for (size_t i = 0; i < n; i++) {
+        if (valids != nullptr && !valids[i]) {
+            continue;
+        }
+        rows.push_back({offset_begin + static_cast<int64_t>(i),
+                        Tokenize(texts[i])});
+        auto& tokens = rows.back().tokens;
+        std::sort(tokens.begin(), tokens.end());
+        tokens.erase(std::unique(tokens.begin(), tokens.end()), tokens.end());
+    }
+
+    std::unique_lock<std::shared_mutex> lock(delta_mutex_);
+    for (auto& row : rows) {
+        delta_.push_back(std::move(row));
+    }
+    auto end = offset_begin + static_cast<int64_t>(n);
+    if (end > delta_end_.load()) {
+        delta_end_.store(end);
+    }
+}
+
+std::vector<std::string>
+TextMatchIndex::Tokenize(const std::string& text) {
+    std::vector<std::string> tokens;
+    auto& tokenizer =
+        tantivy::TokenizerCache::ThreadLocal(*delta_analyzer_params_, "");
+    auto token_stream = tokenizer.CreateTokenStreamCopyText(text);
+    while (token_stream->advance()) {
+        tokens.push_back(token_stream->get_token());
+    }
+    return tokens;
+}
+
+void
+TextMatchIndex::MatchDelta(const std::string& query,
+                           uint32_t min_should_match,
+                           TargetBitmap& bitset) {
+    auto terms = Tokenize(query);
+    if (terms.empty()) {
+        return;
+    }
+    // every term of the query is a clause, repeated ones included
+    auto required = std::max<size_t>(1, min_should_match);
+    for (const auto& row : delta_) {
+        if (row.offset >= static_cast<int64_t>(bitset.size())) {
+            continue;
+        }
+        size_t matched = 0;
+        for (const auto& term : terms) {
+            if (std::binary_search(
+                    row.tokens.begin(), row.tokens.end(), term)) {
+                matched++;
+            }
+        }
+        if (matched >= required) {
+            bitset.set(row.offset);
+        }
     }
 }
 
@@ -349,8 +431,14 @@ void
 TextMatchIndex::Commit() {
     std::unique_lock<std::mutex> lck(mtx_, std::defer_lock);
     if (lck.try_lock()) {
+        size_t delta_rows = 0;
+        if (delta_analyzer_params_.has_value()) {
+            std::shared_lock<std::shared_mutex> lock(delta_mutex_);
+            delta_rows = delta_.size();
+        }
         wrapper_->commit();
         last_commit_time_.store(stdclock::now());
+        committed_delta_rows_ = delta_rows;
     }
 }
 
@@ -359,6 +447,50 @@ TextMatchIndex::Reload() {
     std::unique_lock<std::mutex> lck(mtx_, std::defer_lock);
     if (lck.try_lock()) {
         wrapper_->reload();
+        if (committed_delta_rows_ > 0) {
+            std::unique_lock<std::shared_mutex> lock(delta_mutex_);
+            delta_.erase(delta_.begin(),
+                         delta_.begin() + committed_delta_rows_);
+            committed_delta_rows_ = 0;
+        }
+    }
+}
+
+void
+TextMatchIndex::ScheduleCommit() {
+    std::lock_guard<std::mutex> lock(background_mutex_);
+    if (background_commit_.valid()) {
+        if (background_commit_.wait_for(std::chrono::seconds(0)) !=
+            std::future_status::ready) {
+            return;
+        }
+        try {
+            background_commit_.get();
+        } catch (const std::exception& e) {
+            LOG_WARN("background commit of text index failed: {}", e.what());
+        }
+    }
+    background_commit_ =
+        ThreadPools::GetThreadPool(ThreadPoolPriority::LOW).Submit([this]() {
+            Commit();
+            Reload();
+        });
+}
+
+void
+TextMatchIndex::WaitBackgroundCommit() {
+    std::lock_guard<std::mutex> lock(background_mutex_);
+    if (background_commit_.valid()) {
+        background_commit_.wait();
+    }
+}
+
+void
+TextMatchIndex::CommitBeforeQuery() {
+    WaitBackgroundCommit();
+    if (shouldTriggerCommit()) {
+        Commit();
+        Reload();
     }
 }
 
@@ -377,16 +509,28 @@ TargetBitmap
 TextMatchIndex::MatchQuery(const std::string& query,
                            uint32_t min_should_match) {
     tracer::AutoSpan span("TextMatchIndex::MatchQuery", tracer::GetRootSpan());
-    if (shouldTriggerCommit()) {
-        Commit();
-        Reload();
+    if (!delta_analyzer_params_.has_value()) {
+        if (shouldTriggerCommit()) {
+            Commit();
+            Reload();
+        }
+        TargetBitmap bitset{static_cast<size_t>(Count())};
+        wrapper_->match_query(query, min_should_match, &bitset);
+        return bitset;
     }
 
+    // the rows not committed yet are answered from the delta, the query
+    // never waits for a commit
+    if (shouldTriggerCommit()) {
+        ScheduleCommit();
+    }
+    std::shared_lock<std::shared_mutex> lock(delta_mutex_);
     TargetBitmap bitset{static_cast<size_t>(Count())};
     // The count operation of tantivy may be get older cnt if the index is committed with new tantivy segment.
     // So we cannot use the count operation to get the total count for bitmap.
     // Just use the maximum offset of hits to get the total count for bitmap here.
     wrapper_->match_query(query, min_should_match, &bitset);
+    MatchDelta(query, min_should_match, bitset);
     return bitset;
 }
 
@@ -394,10 +538,8 @@ TargetBitmap
 TextMatchIndex::PhraseMatchQuery(const std::string& query, uint32_t slop) {
     tracer::AutoSpan span("TextMatchIndex::PhraseMatchQuery",
                           tracer::GetRootSpan());
-    if (shouldTriggerCommit()) {
-        Commit();
-        Reload();
-    }
+    // the delta keeps no positions, phrases only see committed rows
+    CommitBeforeQuery();
 
     TargetBitmap bitset{static_cast<size_t>(Count())};
     // The count operation of tantivy may be get older cnt if the index is committed with new tantivy segment.
@@ -11,12 +11,18 @@
 
 #pragma once
 
+#include <algorithm>
+#include <deque>
+#include <future>
+#include <optional>
+#include <shared_mutex>
 #include <string>
 #include <boost/filesystem.hpp>
 
 #include "cachinglayer/Manager.h"
 #include "index/InvertedIndexTantivy.h"
 #include "index/IndexStats.h"
+#include "tantivy/tokenizer.h"
 
 namespace milvus::index {
 
@@ -43,6 +49,8 @@ class TextMatchIndex : public InvertedIndexTantivy<std::string> {
     // for loading built index
     explicit TextMatchIndex(const storage::FileManagerContext& ctx);
 
+    ~TextMatchIndex() override;
+
     using InvertedIndexTantivy<std::string>::Load;
 
  public:
@@ -94,14 +102,76 @@ class TextMatchIndex : public InvertedIndexTantivy<std::string> {
     TargetBitmap
     PhraseMatchQuery(const std::string& query, uint32_t slop);
 
+ public:
+    // On growing segments, rows not committed yet are counted too.
+    int64_t
+    Count() override {
+        return std::max<int64_t>(wrapper_->count(), delta_end_.load());
+    }
+
  private:
     bool
     shouldTriggerCommit();
 
+    // Commits and reloads on the LOW pool, unless a background commit is
+    // still running.
+    void
+    ScheduleCommit();
+
+    // Waits for the background commit, if any, to finish.
+    void
+    WaitBackgroundCommit();
+
+    // Before a query that cannot read the delta: waits for the background
+    // commit, then commits inline if the commit interval passed since.
+    void
+    CommitBeforeQuery();
+
+    void
+    AppendDelta(size_t n,
+                const std::string* texts,
+                const bool* valids,
+                int64_t offset_begin);
+
+    // Sets in `bitset` the delta rows holding at least `min_should_match` of
+    // the tokens of `query`, as tantivy's match query would.
+    void
+    MatchDelta(const std::string& query,
+               uint32_t min_should_match,
+               TargetBitmap& bitset);
+
+    std::vector<std::string>
+    Tokenize(const std::string& text);
+
  private:
     mutable std::mutex mtx_;
     std::atomic<stdclock::time_point> last_commit_time_;
     int64_t commit_interval_in_ms_;
+
+    // Growing segments only. A row only reaches tantivy readers once a
+    // commit and a reload covered it, which under high insert rates lags.
+    // Until then the row stays in the delta: its tokens, matched by brute
+    // force by MatchQuery. Commits run in the background instead of on the
+    // insert path, so text match sees a row as soon as it is added.
+    struct DeltaRow {
+        int64_t offset;
+        // sorted and unique
+        std::vector<std::string> tokens;
+    };
+    // tokenized by the per thread tokenizers of TokenizerCache
+    std::optional<std::string> delta_analyzer_params_;
+    // Held shared by MatchQuery from its tantivy search to its delta scan,
+    // so a reload and the trim of the delta rows it covers are seen
+    // together.
+    std::shared_mutex delta_mutex_;
+    // in the order the rows were added
+    std::deque<DeltaRow> delta_;
+    // delta rows covered by the last commit, trimmed by the next reload
+    size_t committed_delta_rows_{0};
+    std::atomic<int64_t> delta_end_{0};
+
+    std::mutex background_mutex_;
+    std::future<void> background_commit_;
 };
 
 class TextMatchIndexHolder {
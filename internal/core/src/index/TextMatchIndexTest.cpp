@@ -312,6 +312,51 @@ TEST(TextMatch, Index) {
     }
 }
 
+TEST(TextMatch, GrowingMatchesUncommittedRows) {
+    using Index = index::TextMatchIndex;
+    // never commits on its own
+    auto index = std::make_unique<Index>(std::numeric_limits<int64_t>::max(),
+                                         "unique_id",
+                                         "milvus_tokenizer",
+                                         "{}");
+    index->Commit();
+    index->CreateReader(milvus::index::SetBitsetGrowing);
+    index->RegisterAnalyzer("milvus_tokenizer", "{}");
+
+    std::vector<std::string> texts = {
+        "football, basketball", "", "swimming, football", "tennis"};
+    bool valids[] = {true, false, true, true};
+    index->AddTextsGrowing(2, texts.data(), valids, 0);
+    index->AddTextsGrowing(2, texts.data() + 2, valids + 2, 2);
+    ASSERT_EQ(index->Count(), 4);
+
+    auto check = [&]() {
+        auto res = index->MatchQuery("football", 1);
+        ASSERT_EQ(res.size(), 4);
+        ASSERT_TRUE(res[0]);
+        ASSERT_FALSE(res[1]);
+        ASSERT_TRUE(res[2]);
+        ASSERT_FALSE(res[3]);
+
+        res = index->MatchQuery("football basketball", 2);
+        ASSERT_TRUE(res[0]);
+        ASSERT_FALSE(res[2]);
+
+        auto valid = index->IsNotNull();
+        ASSERT_EQ(valid.size(), 4);
+        ASSERT_TRUE(valid[0]);
+        ASSERT_FALSE(valid[1]);
+        ASSERT_TRUE(valid[3]);
+    };
+    // answered from the delta
+    check();
+
+    // answered from tantivy once committed
+    index->Commit();
+    index->Reload();
+    check();
+}
+
 TEST(TextMatch, UploadReturnsRelativeTextLogPaths) {
     auto ctx = CreateTextMatchTestFileManagerContext(1000);
     auto index = BuildTextMatchIndexForUpload(ctx);
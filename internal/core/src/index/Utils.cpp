@@ -16,6 +16,7 @@
 
 #include <google/protobuf/text_format.h>
 #include "common/FastMem.h"
+#include <fcntl.h>
 #include <sys/stat.h>
 #include <unistd.h>
 #include <algorithm>
@@ -543,4 +544,25 @@ CheckAndUpdateKnowhereRangeSearchParam(const SearchInfo& search_info,
     return true;
 }
 
+void
+ReadaheadIndexFile(const std::string& filepath,
+                   const std::shared_ptr<std::atomic<bool>>& released) {
+    auto fd = open(filepath.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return;
+    }
+    struct stat st;
+    if (fstat(fd, &st) == 0) {
+        const off_t window = DEFAULT_INDEX_MMAP_READAHEAD_WINDOW;
+        for (off_t offset = 0; offset < st.st_size && !released->load();
+             offset += window) {
+            auto len = std::min<off_t>(window, st.st_size - offset);
+            if (posix_fadvise(fd, offset, len, POSIX_FADV_WILLNEED) != 0) {
+                break;
+            }
+        }
+    }
+    close(fd);
+}
+
 }  // namespace milvus::index
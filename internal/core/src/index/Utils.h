@@ -16,6 +16,9 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <functional>
 #include <unordered_map>
 #include <vector>
 #include <stdio.h>
@@ -25,6 +28,7 @@
 #include <sys/stat.h>
 #include <tuple>
 #include <map>
+#include <memory>
 #include <string>
 #include <boost/algorithm/string.hpp>
 
@@ -271,4 +275,32 @@ GetStringSSOThreshold() {
     return threshold;
 }
 
+// std::lower_bound for when the result is likely close to `first`: it
+// probes first + 1, first + 2, first + 4, ... before binary searching the
+// last step. Walking a sorted range with sorted probes this way costs
+// O(log distance) per probe instead of O(log n), and never goes back.
+template <typename It, typename V, typename Less = std::less<>>
+inline It
+GallopLowerBound(It first, It last, const V& value, Less less = Less{}) {
+    if (first == last || !less(*first, value)) {
+        return first;
+    }
+    // *lo < value
+    auto lo = first;
+    size_t step = 1;
+    while (step < static_cast<size_t>(last - lo) && less(*(lo + step), value)) {
+        lo += step;
+        step *= 2;
+    }
+    auto hi = step < static_cast<size_t>(last - lo) ? lo + step : last;
+    return std::lower_bound(lo + 1, hi, value, less);
+}
+
+// Pulls a loaded mmap index file into the page cache window by window so
+// the pages searches fault in on demand are mostly resident by the time
+// they are touched. Stops early once the index is released.
+void
+ReadaheadIndexFile(const std::string& filepath,
+                   const std::shared_ptr<std::atomic<bool>>& released);
+
 }  // namespace milvus::index
@@ -27,6 +27,7 @@
 #include <stdexcept>
 #include <string>
 
+#include "common/Common.h"
 #include "common/Consts.h"
 #include "common/FastMem.h"
 #include "common/OffsetMapping.h"
@@ -40,6 +41,7 @@
 #include "filemanager/FileManager.h"
 #include "fmt/core.h"
 #include "glog/logging.h"
+#include "index/DiskAnnCacheBudget.h"
 #include "index/Meta.h"
 #include "index/Utils.h"
 #include "index/VectorIndexValidDataUtils.h"
@@ -353,6 +355,9 @@ VectorDiskAnnIndex<T>::Load(milvus::tracer::TraceContext ctx,
             nostd_span_load_engine(span_load_engine);
         auto engine_scope = opentelemetry::trace::Tracer::WithActiveSpan(
             nostd_span_load_engine);
+        if (GetIndexType() == knowhere::IndexEnum::INDEX_DISKANN) {
+            ReserveNodeCacheBudget(load_config);
+        }
         auto stat = index_.Deserialize(knowhere::BinarySet(), load_config);
         if (stat != knowhere::Status::success)
             ThrowInfo(ErrorCode::UnexpectedError,
@@ -906,6 +911,37 @@ VectorDiskAnnIndex<T>::CleanLocalData() {
         file_manager_->GetLocalRawDataObjectPrefix());
 }
 
+template <typename T>
+VectorDiskAnnIndex<T>::~VectorDiskAnnIndex() {
+    if (cache_budget_bytes_ > 0) {
+        DiskAnnCacheBudget::GetInstance().Release(cache_budget_bytes_);
+    }
+}
+
+template <typename T>
+void
+VectorDiskAnnIndex<T>::ReserveNodeCacheBudget(knowhere::Json& load_config) {
+    auto capacity = DISKANN_NODE_CACHE_BUDGET.load();
+    if (capacity <= 0 || !load_config.contains(DISK_ANN_SEARCH_CACHE_BUDGET)) {
+        return;
+    }
+    // index params come as strings from the proxy
+    const auto& value = load_config[DISK_ANN_SEARCH_CACHE_BUDGET];
+    auto requested_gb = value.is_string() ? std::stof(value.get<std::string>())
+                                          : value.get<float>();
+    auto requested =
+        static_cast<size_t>(std::max(requested_gb, 0.0f) * (1ull << 30));
+    cache_budget_bytes_ = DiskAnnCacheBudget::GetInstance().Reserve(
+        requested, static_cast<size_t>(capacity));
+    // knowhere picks the graph nodes to fill the granted cache with by how
+    // often sample queries visit them
+    load_config[DISK_ANN_SEARCH_CACHE_BUDGET] =
+        static_cast<float>(cache_budget_bytes_) / (1ull << 30);
+    LOG_INFO("diskann node cache budget, requested: {}, granted: {}",
+             requested,
+             cache_budget_bytes_);
+}
+
 template <typename T>
 inline knowhere::Json
 VectorDiskAnnIndex<T>::update_load_json(const Config& config) {
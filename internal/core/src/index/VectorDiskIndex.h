@@ -35,6 +35,8 @@ class VectorDiskAnnIndex : public VectorIndex {
         const storage::FileManagerContext& file_manager_context =
             storage::FileManagerContext());
 
+    ~VectorDiskAnnIndex() override;
+
     BinarySet
     Serialize(const Config& config) override {  // deprecated
         BinarySet binary_set;
@@ -127,6 +129,11 @@ class VectorDiskAnnIndex : public VectorIndex {
     knowhere::Json
     update_load_json(const Config& config);
 
+    // Trims the search_cache_budget_gb of `load_config` to what is left of
+    // the node wide DISKANN_NODE_CACHE_BUDGET.
+    void
+    ReserveNodeCacheBudget(knowhere::Json& load_config);
+
  private:
     knowhere::Index<knowhere::IndexNode> index_;
     std::shared_ptr<storage::DiskFileManagerImpl> file_manager_;
@@ -134,6 +141,8 @@ class VectorDiskAnnIndex : public VectorIndex {
     // used for embedding list only
     DataType elem_type_;
     std::vector<size_t> empty_emb_list_offsets_;
+    // bytes of the node wide diskann cache budget this index holds
+    size_t cache_budget_bytes_ = 0;
 };
 
 template <typename T>
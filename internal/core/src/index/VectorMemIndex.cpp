@@ -17,6 +17,9 @@
 #include "index/VectorMemIndex.h"
 
 #include <assert.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include <algorithm>
 #include <atomic>
 #include <chrono>
@@ -509,6 +512,10 @@ void
 VectorMemIndex<T>::Build(const Config& config) {
     LOG_INFO("start build memory index, build_id: {}",
              config.value("build_id", "unknown"));
+    if (CanBuildInBatches(config)) {
+        BuildInBatches(config);
+        return;
+    }
     auto field_datas = file_manager_->CacheRawDataToMemory(config);
     LOG_INFO("CacheRawDataToMemory success, build_id: {}",
              config.value("build_id", "unknown"));
@@ -699,6 +706,132 @@ VectorMemIndex<T>::Build(const Config& config) {
     }
 }
 
+template <typename T>
+bool
+VectorMemIndex<T>::CanBuildInBatches(const Config& config) const {
+    // the index types whose Add appends to what the first Build trained
+    static const std::unordered_set<IndexType> kAppendableIndexTypes = {
+        knowhere::IndexEnum::INDEX_FAISS_IVFFLAT,
+        knowhere::IndexEnum::INDEX_FAISS_IVFSQ8,
+        knowhere::IndexEnum::INDEX_FAISS_IVFPQ,
+        knowhere::IndexEnum::INDEX_HNSW,
+    };
+    if (INDEX_BUILD_MEMORY_BUDGET.load() <= 0 ||
+        elem_type_ != DataType::NONE || IndexIsSparse(GetIndexType()) ||
+        kAppendableIndexTypes.count(GetIndexType()) == 0) {
+        return false;
+    }
+    auto storage_version =
+        GetValueFromConfig<int64_t>(config, STORAGE_VERSION_KEY).value_or(0);
+    if (storage_version == STORAGE_V2 || storage_version == STORAGE_V3) {
+        return false;
+    }
+    // the scalar info of the optional fields spans the whole segment
+    return !GetValueFromConfig<OptFieldT>(config, VEC_OPT_FIELDS).has_value();
+}
+
+template <typename T>
+void
+VectorMemIndex<T>::BuildInBatches(const Config& config) {
+    auto memory_budget = INDEX_BUILD_MEMORY_BUDGET.load();
+    LOG_INFO("build memory index in batches under {} bytes, build_id: {}",
+             memory_budget,
+             config.value("build_id", "unknown"));
+    Config build_config;
+    build_config.update(config);
+    build_config.erase(INSERT_FILES_KEY);
+    build_config.erase(VEC_OPT_FIELDS);
+    knowhere::Json index_config;
+    index_config.update(build_config);
+
+    int64_t dim = 0;
+    bool built = false;
+    bool nullable = false;
+    FixedVector<bool> valid_data;
+
+    // the first rows build, and so train, the index, the next ones append
+    auto add = [&](const void* data, int64_t rows) {
+        auto dataset = GenDataset(rows, dim, data);
+        auto stat =
+            built ? index_.Add(dataset, index_config, use_knowhere_build_pool_)
+                  : index_.Build(
+                        dataset, index_config, use_knowhere_build_pool_);
+        if (stat != knowhere::Status::success) {
+            ThrowInfo(ErrorCode::IndexBuildError,
+                      "failed to {} index in batches, {}",
+                      built ? "append" : "build",
+                      KnowhereStatusString(stat));
+        }
+        built = true;
+    };
+
+    // the training rows take up to half the budget, their copy into one
+    // buffer the other half
+    std::vector<FieldDataPtr> pending;
+    int64_t pending_rows = 0;
+    int64_t pending_bytes = 0;
+    auto build_pending = [&]() {
+        if (pending_rows > 0) {
+            auto buf = std::unique_ptr<uint8_t[]>(new uint8_t[pending_bytes]);
+            int64_t offset = 0;
+            for (auto& data : pending) {
+                milvus::fastmem::FastMemcpy(
+                    buf.get() + offset, data->Data(), data->DataSize());
+                offset += data->DataSize();
+                data.reset();
+            }
+            add(buf.get(), pending_rows);
+        }
+        pending.clear();
+        pending_rows = 0;
+        pending_bytes = 0;
+    };
+
+    knowhere::TimeRecorder rc("BuildInBatches", 1);
+    file_manager_->CacheRawDataToMemoryInBatches(
+        config, memory_budget, [&](FieldDataPtr data) {
+            AssertInfo(dim == 0 || dim == data->get_dim(),
+                       "inconsistent dim value between field datas!");
+            dim = data->get_dim();
+            auto rows = data->get_num_rows();
+            nullable = nullable || data->IsNullable();
+            for (int64_t i = 0; i < rows; ++i) {
+                valid_data.push_back(!data->IsNullable() || data->is_valid(i));
+            }
+            auto valid_rows = data->get_valid_rows();
+            if (valid_rows == 0) {
+                return;
+            }
+            if (built) {
+                add(data->Data(), valid_rows);
+                return;
+            }
+            pending_rows += valid_rows;
+            pending_bytes += data->DataSize();
+            pending.push_back(std::move(data));
+            if (pending_bytes * 2 >= memory_budget) {
+                build_pending();
+            }
+        });
+    build_pending();
+    rc.ElapseFromBegin("Done");
+
+    if (built) {
+        SetDim(index_.Dim());
+    } else {
+        AssertInfo(nullable,
+                   "no vectors to build index, build_id: {}",
+                   config.value("build_id", "unknown"));
+        SetDim(dim);
+    }
+    if (nullable) {
+        BuildValidData(valid_data.data(),
+                       static_cast<int64_t>(valid_data.size()));
+    }
+    LOG_INFO("build memory index in batches done, build_id: {}",
+             config.value("build_id", "unknown"));
+}
+
 template <typename T>
 void
 VectorMemIndex<T>::AddWithDataset(const DatasetPtr& dataset,
@@ -758,6 +891,32 @@ VectorMemIndex<T>::Query(const DatasetPtr dataset,
         auto index_type = GetIndexType();
         if (CheckAndUpdateKnowhereRangeSearchParam(
                 search_info, topk, GetMetricType(), search_conf)) {
+            auto scan_limit = RANGE_SEARCH_STREAM_SCAN_LIMIT.load();
+            if (scan_limit > 0 &&
+                dataset->Get<const size_t*>(
+                    knowhere::meta::EMB_LIST_OFFSET) == nullptr) {
+                // stream through the index iterators so memory stays at
+                // topk per query rather than the whole range; indexes
+                // without iterator support fall back to range search
+                auto iterators =
+                    index_.AnnIterator(dataset, search_conf, bitset, false);
+                if (iterators.has_value()) {
+                    auto radius = search_conf[RADIUS].get<float>();
+                    std::optional<float> range_filter;
+                    if (search_conf.contains(RANGE_FILTER)) {
+                        range_filter = search_conf[RANGE_FILTER].get<float>();
+                    }
+                    auto result = StreamRangeSearchResult(iterators.value(),
+                                                          topk,
+                                                          radius,
+                                                          range_filter,
+                                                          GetMetricType(),
+                                                          scan_limit,
+                                                          false);
+                    milvus::tracer::AddEvent("finish_StreamRangeSearchResult");
+                    return result;
+                }
+            }
             milvus::tracer::AddEvent("start_knowhere_index_range_search");
             auto res =
                 index_.RangeSearch(dataset, search_conf, bitset, op_context);
@@ -1178,6 +1337,15 @@ VectorMemIndex<T>::LoadFromFile(const Config& config) {
 
     this->mmap_file_raii_ =
         std::make_unique<MmapFileRAII>(local_filepath.value());
+    if (wrote_index_data && ENABLE_INDEX_MMAP_READAHEAD.load()) {
+        // knowhere reads the graph metadata and upper layers while
+        // deserializing, only the mapped base layer is left to fault in, so
+        // the index serves right away and the rest streams in behind it
+        auto& pool = ThreadPools::GetThreadPool(ThreadPoolPriority::LOW);
+        pool.Submit(ReadaheadIndexFile,
+                    local_filepath.value(),
+                    readahead_released_);
+    }
     LOG_INFO(
         "load vector index done, mmap_file_path:{}, download_duration:{}, "
         "write_files_duration:{}, deserialize_duration:{}",
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <stdint.h>
+#include <atomic>
 #include <memory>
 #include <vector>
 
@@ -63,6 +64,10 @@ class VectorMemIndex : public VectorIndex {
                    const knowhere::ViewDataOp view_data,
                    bool use_knowhere_build_pool = true);
 
+    ~VectorMemIndex() override {
+        readahead_released_->store(true);
+    }
+
     BinarySet
     Serialize(const Config& config) override;
 
@@ -141,6 +146,17 @@ class VectorMemIndex : public VectorIndex {
     void
     LoadFromFile(const Config& config);
 
+    // Whether Build() may feed the vectors to the index batch by batch under
+    // INDEX_BUILD_MEMORY_BUDGET, which takes an index type that appends to a
+    // trained index, plain dense vectors and storage v1 insert files.
+    bool
+    CanBuildInBatches(const Config& config) const;
+
+    // Trains the index on the first batch of the vectors then adds the rest
+    // one field data at a time, never holding the segment in memory.
+    void
+    BuildInBatches(const Config& config);
+
     bool
     IsEmptyEmbListIndex() const {
         return elem_type_ != DataType::NONE && !empty_emb_list_offsets_.empty();
@@ -156,6 +172,9 @@ class VectorMemIndex : public VectorIndex {
     CreateIndexInfo create_index_info_;
     bool use_knowhere_build_pool_;
     std::vector<size_t> empty_emb_list_offsets_;
+    // tells a background readahead of the mmap'd index file to stop
+    std::shared_ptr<std::atomic<bool>> readahead_released_ =
+        std::make_shared<std::atomic<bool>>(false);
 };
 
 template <typename T>
@@ -40,6 +40,7 @@
 #include "common/Tracer.h"
 #include "common/jsmn.h"
 #include "fmt/core.h"
+#include "index/ParallelBuild.h"
 #include "index/Utils.h"
 #include "index/json_stats/JsonKeyStats.h"
 #include "index/json_stats/bson_builder.h"
@@ -278,22 +279,39 @@ JsonKeyStats::CollectSingleJsonStatsInfo(
 std::map<JsonKey, KeyStatsInfo>
 JsonKeyStats::CollectKeyInfo(const std::vector<FieldDataPtr>& field_datas,
                              bool nullable) {
-    std::map<JsonKey, KeyStatsInfo> infos;
     int64_t num_rows = 0;
     for (const auto& data : field_datas) {
-        auto n = data->get_num_rows();
-        for (int i = 0; i < n; i++) {
-            if ((nullable || data->IsNullable()) && !data->is_valid(i)) {
-                continue;
-            }
-            auto json_str = static_cast<const milvus::Json*>(data->RawValue(i))
-                                ->data()
-                                .data();
-            CollectSingleJsonStatsInfo(json_str, infos);
-        }
-        num_rows += n;
+        num_rows += data->get_num_rows();
     }
     num_rows_ = num_rows;
+
+    // every run collects the keys of its range, the hit rows of the runs
+    // are then summed up
+    auto bounds = ParallelBuildBounds(num_rows);
+    auto runs = bounds.size() - 1;
+    std::vector<std::map<JsonKey, KeyStatsInfo>> run_infos(runs);
+    RunParallel(runs, [&](size_t run) {
+        ForEachRowInRange(
+            field_datas,
+            bounds[run],
+            bounds[run + 1],
+            [&](const FieldDataPtr& data, size_t i, size_t) {
+                if ((nullable || data->IsNullable()) && !data->is_valid(i)) {
+                    return;
+                }
+                auto json_str =
+                    static_cast<const milvus::Json*>(data->RawValue(i))
+                        ->data()
+                        .data();
+                CollectSingleJsonStatsInfo(json_str, run_infos[run]);
+            });
+    });
+    auto infos = std::move(run_infos[0]);
+    for (size_t run = 1; run < runs; ++run) {
+        for (const auto& [json_key, info] : run_infos[run]) {
+            infos[json_key].hit_row_num_ += info.hit_row_num_;
+        }
+    }
     return infos;
 }
 
@@ -506,21 +524,11 @@ JsonKeyStats::TraverseJsonForBuildStats(
 }
 
 void
-JsonKeyStats::BuildKeyStatsForNullRow() {
-    // add empty value for column keys that not hit
-    for (const auto& key : column_keys_) {
-        parquet_writer_->AppendValue(key.ToColumnName(), "");
-    }
-
-    // add null bson to shared column
-    BsonDocument null_doc;
-    parquet_writer_->AppendSharedRow(null_doc.data(), null_doc.length());
-
-    parquet_writer_->AddCurrentRow();
-}
-
-void
-JsonKeyStats::BuildKeyStatsForRow(const char* json_str, uint32_t row_id) {
+JsonKeyStats::ShredRow(const char* json_str,
+                       uint32_t row_id,
+                       const std::map<JsonKey, size_t>& column_index,
+                       ShreddedRow& row,
+                       std::map<std::string, std::vector<int64_t>>& records) {
     LOG_TRACE("build key stats for row {} with json {} for segment {}",
               row_id,
               json_str,
@@ -552,41 +560,32 @@ JsonKeyStats::BuildKeyStatsForRow(const char* json_str, uint32_t row_id) {
         break;
     }
 
-    if (num_tokens == 0) {
-        return;
+    // a json without any token still takes its row, with no key hit
+    std::map<JsonKey, std::string> values;
+    if (num_tokens > 0) {
+        int index = 0;
+        std::vector<std::string> paths;
+        TraverseJsonForBuildStats(
+            json_str, tokens.data(), index, paths, values);
     }
 
-    int index = 0;
-    std::vector<std::string> paths;
-    std::map<JsonKey, std::string> values;
-    TraverseJsonForBuildStats(json_str, tokens.data(), index, paths, values);
+    // column keys that not hit are left empty
+    row.column_values.assign(column_index.size(), std::string());
     DomNode root;
-    std::set<JsonKey> hit_keys;
-    for (const auto& [key, value] : values) {
-        AssertInfo(key_types_.find(key) != key_types_.end(),
-                   "key {} not found in key types",
-                   key.key_);
-        if (key_types_[key] == JsonKeyLayoutType::SHARED) {
+    for (auto& [key, value] : values) {
+        auto it = key_types_.find(key);
+        AssertInfo(
+            it != key_types_.end(), "key {} not found in key types", key.key_);
+        if (it->second == JsonKeyLayoutType::SHARED) {
             auto path_vec = ParseJsonPointerPath(key.key_);
             BsonBuilder::AppendToDom(root, path_vec, value, key.type_);
+        } else if (key.type_ == JSONType::ARRAY) {
+            auto bson_bytes = BuildBsonArrayBytesFromJsonString(value);
+            row.column_values[column_index.at(key)].assign(
+                reinterpret_cast<const char*>(bson_bytes.data()),
+                bson_bytes.size());
         } else {
-            if (key.type_ == JSONType::ARRAY) {
-                auto bson_bytes = BuildBsonArrayBytesFromJsonString(value);
-                parquet_writer_->AppendValue(
-                    key.ToColumnName(),
-                    std::string(
-                        reinterpret_cast<const char*>(bson_bytes.data()),
-                        bson_bytes.size()));
-            } else {
-                parquet_writer_->AppendValue(key.ToColumnName(), value);
-            }
-        }
-        hit_keys.insert(key);
-    }
-    // add empty value for column keys that not hit
-    for (const auto& key : column_keys_) {
-        if (hit_keys.find(key) == hit_keys.end()) {
-            parquet_writer_->AppendValue(key.ToColumnName(), "");
+            row.column_values[column_index.at(key)] = std::move(value);
         }
     }
 
@@ -606,37 +605,86 @@ JsonKeyStats::BuildKeyStatsForRow(const char* json_str, uint32_t row_id) {
             offset,
             segment_id_,
             field_id_);
-        bson_inverted_index_->AddRecord(key, row_id, offset);
+        records[key].push_back(EncodeInvertedIndexValue(row_id, offset));
     }
-    parquet_writer_->AppendSharedRow(final_doc.data(), final_doc.length());
+    row.shared_doc.assign(reinterpret_cast<const char*>(final_doc.data()),
+                          final_doc.length());
+}
 
+void
+JsonKeyStats::AppendShreddedRow(const ShreddedRow& row,
+                                const std::vector<std::string>& column_names) {
+    for (size_t i = 0; i < column_names.size(); ++i) {
+        parquet_writer_->AppendValue(column_names[i], row.column_values[i]);
+    }
+    parquet_writer_->AppendSharedRow(
+        reinterpret_cast<const uint8_t*>(row.shared_doc.data()),
+        row.shared_doc.size());
     parquet_writer_->AddCurrentRow();
 }
 
 void
 JsonKeyStats::BuildKeyStats(const std::vector<FieldDataPtr>& field_datas,
                             bool nullable) {
-    uint32_t row_id = 0;
-    for (const auto& data : field_datas) {
-        auto n = data->get_num_rows();
-        for (uint32_t i = 0; i < n; i++) {
-            if ((nullable || data->IsNullable()) && !data->is_valid(i)) {
-                BuildKeyStatsForNullRow();
-            } else {
-                auto json_str =
-                    static_cast<const milvus::Json*>(data->RawValue(i))
-                        ->data()
-                        .data();
-
-                // some situations, such as empty json string,
-                // should be handled as null row
-                if (strlen(json_str) == 0) {
-                    BuildKeyStatsForNullRow();
-                } else {
-                    BuildKeyStatsForRow(json_str, row_id);
-                }
-            }
-            row_id++;
+    std::vector<std::string> column_names;
+    std::map<JsonKey, size_t> column_index;
+    for (const auto& key : column_keys_) {
+        column_index.emplace(key, column_names.size());
+        column_names.push_back(key.ToColumnName());
+    }
+    BsonDocument null_doc;
+    std::string null_shared_doc(reinterpret_cast<const char*>(null_doc.data()),
+                                null_doc.length());
+
+    // the rows are shredded window by window, every run of a window on its
+    // own thread, since the parquet writer is a single one the shredded rows
+    // are appended to it in row order afterwards, and the offsets of the
+    // runs are added to the inverted index in run order to keep it sorted
+    size_t num_rows = num_rows_;
+    auto window =
+        (ParallelBuildBounds(num_rows).size() - 1) * kMinParallelBuildRows;
+    std::vector<ShreddedRow> rows;
+    for (size_t begin = 0; begin < num_rows; begin += window) {
+        auto end = std::min(begin + window, num_rows);
+        rows.resize(end - begin);
+        auto bounds = ParallelBuildBounds(end - begin);
+        auto runs = bounds.size() - 1;
+        std::vector<std::map<std::string, std::vector<int64_t>>> run_records(
+            runs);
+        RunParallel(runs, [&](size_t run) {
+            ForEachRowInRange(
+                field_datas,
+                begin + bounds[run],
+                begin + bounds[run + 1],
+                [&](const FieldDataPtr& data, size_t i, size_t row_id) {
+                    auto& row = rows[row_id - begin];
+                    if (!(nullable || data->IsNullable()) ||
+                        data->is_valid(i)) {
+                        auto json_str =
+                            static_cast<const milvus::Json*>(data->RawValue(i))
+                                ->data()
+                                .data();
+                        // some situations, such as empty json string,
+                        // should be handled as null row
+                        if (strlen(json_str) != 0) {
+                            ShredRow(json_str,
+                                     row_id,
+                                     column_index,
+                                     row,
+                                     run_records[run]);
+                            return;
+                        }
+                    }
+                    row.column_values.assign(column_names.size(),
+                                             std::string());
+                    row.shared_doc = null_shared_doc;
+                });
+        });
+        for (const auto& row : rows) {
+            AppendShreddedRow(row, column_names);
+        }
+        for (auto& records : run_records) {
+            bson_inverted_index_->AddRecords(std::move(records));
         }
     }
 }
@@ -706,6 +754,7 @@ JsonKeyStats::LoadMetaFile(const std::string& local_meta_file_path) {
         local_meta_file_path, meta_content.data(), file_size);
 
     key_field_map_ = JsonStatsMeta::DeserializeToKeyFieldMap(meta_content);
+    typed_field_map_ = JsonStatsMeta::DeserializeToTypedFieldMap(meta_content);
 
     LOG_INFO(
         "loaded meta file with {} key field entries for segment {} for field "
@@ -893,6 +942,10 @@ JsonKeyStats::GetCommonMetaFromParquet(const std::string& file) {
                         continue;
                     }
                     key_field_map_[GetKeyFromColumnName(k)].insert(k);
+                    if (layout_type == JsonKeyLayoutType::TYPED ||
+                        layout_type == JsonKeyLayoutType::TYPED_NOT_ALL) {
+                        typed_field_map_[k] = layout_type;
+                    }
                 }
             } catch (const std::exception& e) {
                 ThrowInfo(
@@ -1075,10 +1128,49 @@ JsonKeyStats::LoadColumnGroup(int64_t column_group_id,
             field_id_,
             segment_id_);
         shredding_columns_[field_meta.get_name().get()] = column;
+        LoadShreddingSkipIndex(field_meta.get_name().get(), column);
     }
     shared_column_ = shredding_columns_.at(shared_column_field_name_);
 }
 
+void
+JsonKeyStats::LoadShreddingSkipIndex(
+    const std::string& field_name,
+    std::shared_ptr<milvus::ChunkedColumnInterface> column) {
+    if (field_name == shared_column_field_name_) {
+        return;
+    }
+    auto json_type = shred_field_data_type_map_[field_name];
+    auto data_type = DataType::NONE;
+    switch (json_type) {
+        case JSONType::INT8:
+        case JSONType::INT16:
+        case JSONType::INT32:
+        case JSONType::INT64:
+        case JSONType::FLOAT:
+        case JSONType::DOUBLE:
+            data_type = GetPrimitiveDataType(json_type);
+            break;
+        case JSONType::STRING:
+            // shredded strings are string chunks like VARCHAR ones
+            data_type = DataType::VARCHAR;
+            break;
+        default:
+            // bool metrics never skip, arrays are bson blobs
+            return;
+    }
+    auto inner_field_id = field_name_to_id_map_.at(field_name);
+    // the metrics of a chunk are built the first time a filter asks for
+    // them, so only the paths that are filtered on pay for it
+    skip_index_.LoadSkip(fmt::format("skip_seg_{}_jks_{}_f_{}",
+                                     segment_id_,
+                                     field_id_,
+                                     inner_field_id),
+                         FieldId(inner_field_id),
+                         data_type,
+                         std::move(column));
+}
+
 void
 JsonKeyStats::LoadShreddingData(const std::vector<std::string>& index_files,
                                 const std::string& warmup_policy) {
@@ -1291,4 +1383,156 @@ JsonKeyStats::Upload(const Config& config) {
                            std::move(index_files));
 }
 
+
+namespace {
+
+// JSON text of the values at `offsets` of a typed shredding column, empty
+// where the row does not have the key.
+void
+ReadShreddedJsonValues(milvus::OpContext* op_ctx,
+                       ChunkedColumnInterface& column,
+                       JSONType type,
+                       const int64_t* offsets,
+                       int64_t count,
+                       std::vector<std::string>& texts) {
+    if (type == JSONType::STRING) {
+        // only TYPED string fields get here, every row has the key and a
+        // null is an empty string
+        column.BulkRawStringAt(
+            op_ctx,
+            [&](std::string_view value, size_t i, bool is_valid) {
+                texts[i] =
+                    nlohmann::json(is_valid ? std::string(value) : "").dump();
+            },
+            offsets,
+            count);
+        return;
+    }
+
+    std::vector<uint8_t> valid(count, 1);
+    if (column.IsNullable()) {
+        column.BulkIsValid(
+            op_ctx,
+            [&](bool is_valid, size_t i) { valid[i] = is_valid; },
+            offsets,
+            count);
+    }
+    auto read = [&](auto zero, auto format) {
+        FixedVector<decltype(zero)> values(count);
+        column.BulkPrimitiveValueAt(op_ctx, values.data(), offsets, count);
+        for (int64_t i = 0; i < count; i++) {
+            if (valid[i]) {
+                texts[i] = format(values[i]);
+            }
+        }
+    };
+    switch (type) {
+        case JSONType::BOOL:
+            read(bool{},
+                 [](bool v) { return std::string(v ? "true" : "false"); });
+            break;
+        case JSONType::INT64:
+            read(int64_t{}, [](int64_t v) { return std::to_string(v); });
+            break;
+        case JSONType::DOUBLE:
+            read(double{}, [](double v) {
+                // keep the value a JSON float: the shortest repr of 1.0 is
+                // "1"
+                auto text = fmt::format("{}", v);
+                if (text.find_first_of(".e") == std::string::npos) {
+                    text += ".0";
+                }
+                return text;
+            });
+            break;
+        default:
+            ThrowInfo(ErrorCode::UnexpectedError,
+                      "unexpected typed shredding json type: {}",
+                      type);
+    }
+}
+
+}  // namespace
+
+std::string
+JsonKeyStats::GetTypedShreddingField(const std::string& pointer) const {
+    auto it = key_field_map_.find(pointer);
+    if (it == key_field_map_.end()) {
+        return "";
+    }
+    for (const auto& field : it->second) {
+        auto layout = typed_field_map_.find(field);
+        auto type = shred_field_data_type_map_.find(field);
+        if (layout == typed_field_map_.end() ||
+            type == shred_field_data_type_map_.end() ||
+            shredding_columns_.find(field) == shredding_columns_.end()) {
+            continue;
+        }
+        switch (type->second) {
+            case JSONType::BOOL:
+            case JSONType::INT64:
+            case JSONType::DOUBLE:
+                return field;
+            case JSONType::STRING:
+                // empty strings are shredded as nulls, so they only differ
+                // from a missing key when every row has the key
+                if (layout->second == JsonKeyLayoutType::TYPED) {
+                    return field;
+                }
+                break;
+            default:
+                // arrays are shredded as bson
+                break;
+        }
+    }
+    return "";
+}
+
+std::optional<std::vector<std::string>>
+JsonKeyStats::BulkExtractSubJson(milvus::OpContext* op_ctx,
+                                 const std::vector<std::string>& keys,
+                                 const int64_t* offsets,
+                                 int64_t count) const {
+    // `"key":` and the value of each row, for every distinct key
+    std::vector<std::pair<std::string, std::vector<std::string>>> values;
+    std::unordered_set<std::string> seen;
+    for (const auto& key : keys) {
+        if (!seen.insert(key).second) {
+            continue;
+        }
+        auto field = GetTypedShreddingField(AppendJsonPointer("", key));
+        if (field.empty()) {
+            return std::nullopt;
+        }
+        auto& [prefix, texts] = values.emplace_back(
+            nlohmann::json(key).dump() + ":", std::vector<std::string>(count));
+        ReadShreddedJsonValues(op_ctx,
+                               *shredding_columns_.at(field),
+                               shred_field_data_type_map_.at(field),
+                               offsets,
+                               count,
+                               texts);
+    }
+
+    std::vector<std::string> result(count);
+    for (int64_t i = 0; i < count; i++) {
+        auto& json = result[i];
+        json = "{";
+        bool first = true;
+        for (const auto& [prefix, texts] : values) {
+            if (texts[i].empty()) {
+                continue;
+            }
+            if (!first) {
+                json += ',';
+            }
+            json += prefix;
+            json += texts[i];
+            first = false;
+        }
+        json += '}';
+    }
+    return result;
+}
+
 }  // namespace milvus::index
@@ -278,8 +278,9 @@ class JsonKeyStats : public ScalarIndex<std::string> {
         // path is field_name in shredding_columns_
         const std::string& path,
         FUNC func,
-        std::function<bool(const milvus::SkipIndex&, std::string, int)>
-            skip_func,
+        // asked per chunk with the skip index and inner field id of the
+        // shredded column, a skipped chunk only gets its nulls applied
+        std::function<bool(const milvus::SkipIndex&, FieldId, int)> skip_func,
         TargetBitmapView res,
         TargetBitmapView valid_res,
         ValTypes... values) {
@@ -291,11 +292,12 @@ class JsonKeyStats : public ScalarIndex<std::string> {
         auto column = shredding_columns_[path];
         auto num_data_chunk = column->num_chunks();
         auto num_rows = column->NumRows();
+        auto inner_field_id = FieldId(field_name_to_id_map_.at(path));
 
         for (size_t i = 0; i < num_data_chunk; i++) {
             auto chunk_size = column->chunk_row_nums(i);
 
-            if (!skip_func || !skip_func(skip_index_, path, i)) {
+            if (!skip_func || !skip_func(skip_index_, inner_field_id, i)) {
                 if constexpr (std::is_same_v<T, std::string_view>) {
                     // first is the raw data, second is valid_data
                     // use valid_data to see if raw data is null
@@ -417,6 +419,21 @@ class JsonKeyStats : public ScalarIndex<std::string> {
         return fields;
     }
 
+    // Shredding field holding every value of the key at `pointer`: the key
+    // had a single primitive type in the segment, so a row has the key iff
+    // the field is not null there. Empty if there is no such field.
+    std::string
+    GetTypedShreddingField(const std::string& pointer) const;
+
+    // The sub-JSON of `keys` (top-level keys) for the rows at `offsets`, as
+    // ExtractSubJson returns it, read from the typed shredding fields
+    // instead of parsing the rows. nullopt if any key has no typed field.
+    std::optional<std::vector<std::string>>
+    BulkExtractSubJson(milvus::OpContext* op_ctx,
+                       const std::vector<std::string>& keys,
+                       const int64_t* offsets,
+                       int64_t count) const;
+
     JSONType
     GetShreddingJsonType(const std::string& field_name) {
         if (shred_field_data_type_map_.find(field_name) !=
@@ -473,14 +490,29 @@ class JsonKeyStats : public ScalarIndex<std::string> {
     std::map<JsonKey, JsonKeyLayoutType>
     ClassifyJsonKeyLayoutType(const std::map<JsonKey, KeyStatsInfo>& infos);
 
+    // What one row appends to the shredding files: the values of the column
+    // keys in the order of column_keys_, empty if not hit, and the bson
+    // document of its shared keys.
+    struct ShreddedRow {
+        std::vector<std::string> column_values;
+        std::string shared_doc;
+    };
+
     void
     BuildKeyStats(const std::vector<FieldDataPtr>& field_datas, bool nullable);
 
+    // Shreds one row into `row` and adds the offsets of its shared keys into
+    // `records`, touches no member so that rows can be shredded in parallel.
     void
-    BuildKeyStatsForRow(const char* json_str, uint32_t row_id);
+    ShredRow(const char* json_str,
+             uint32_t row_id,
+             const std::map<JsonKey, size_t>& column_index,
+             ShreddedRow& row,
+             std::map<std::string, std::vector<int64_t>>& records);
 
     void
-    BuildKeyStatsForNullRow();
+    AppendShreddedRow(const ShreddedRow& row,
+                      const std::vector<std::string>& column_names);
 
     std::string
     GetShreddingDir();
@@ -651,6 +683,13 @@ class JsonKeyStats : public ScalarIndex<std::string> {
                     const std::string& warmup_policy = "",
                     const std::string& override_prefix = "");
 
+    // Registers per chunk min/max (and bloom filter) metrics for a typed
+    // shredded column in skip_index_, see ExecutorForShreddingData.
+    void
+    LoadShreddingSkipIndex(
+        const std::string& field_name,
+        std::shared_ptr<milvus::ChunkedColumnInterface> column);
+
     void
     LoadShreddingMeta(
         std::vector<std::pair<int64_t, std::vector<int64_t>>> sorted_files,
@@ -695,6 +734,9 @@ class JsonKeyStats : public ScalarIndex<std::string> {
     std::unordered_map<std::string, std::set<std::string>> key_field_map_;
     // field_name -> data_type, such as json_path_int -> JSONType::INT64, only for real shredding columns
     std::unordered_map<std::string, JSONType> shred_field_data_type_map_;
+    // field_name -> layout type, only for TYPED/TYPED_NOT_ALL shredding
+    // columns
+    std::unordered_map<std::string, JsonKeyLayoutType> typed_field_map_;
     // field_name -> field_id, such as json_path_int -> 1001
     std::unordered_map<std::string, int64_t> field_name_to_id_map_;
     // field_id -> field_name, such as 1001 -> json_path_int
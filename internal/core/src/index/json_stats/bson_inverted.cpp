@@ -76,6 +76,19 @@ BsonInvertedIndex::AddRecord(const std::string& key,
         EncodeInvertedIndexValue(row_id, offset));
 }
 
+void
+BsonInvertedIndex::AddRecords(
+    std::map<std::string, std::vector<int64_t>>&& records) {
+    for (auto& [key, values] : records) {
+        auto& offsets = inverted_index_map_[key];
+        if (offsets.empty()) {
+            offsets = std::move(values);
+        } else {
+            offsets.insert(offsets.end(), values.begin(), values.end());
+        }
+    }
+}
+
 void
 BsonInvertedIndex::BuildIndex() {
     if (wrapper_ == nullptr) {
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <iostream>
+#include <map>
 #include <string>
 #include <vector>
 #include <unordered_map>
@@ -54,6 +55,11 @@ class BsonInvertedIndex {
     void
     AddRecord(const std::string& key, uint32_t row_id, uint32_t offset);
 
+    // Appends the encoded (row_id, offset) values of every key, the records
+    // must come after the ones already added in row order.
+    void
+    AddRecords(std::map<std::string, std::vector<int64_t>>&& records);
+
     void
     BuildIndex();
 
@@ -315,4 +315,30 @@ JsonStatsMeta::DeserializeToKeyFieldMap(const std::string& json_str) {
     return key_field_map;
 }
 
+std::unordered_map<std::string, JsonKeyLayoutType>
+JsonStatsMeta::DeserializeToTypedFieldMap(const std::string& json_str) {
+    std::unordered_map<std::string, JsonKeyLayoutType> typed_field_map;
+
+    try {
+        nlohmann::json root = nlohmann::json::parse(json_str);
+
+        auto it = root.find(META_KEY_LAYOUT_TYPE_MAP);
+        if (it != root.end()) {
+            for (auto& [column_name, layout_type_str] : it.value().items()) {
+                auto layout_type = JsonKeyLayoutTypeFromString(layout_type_str);
+                if (layout_type == JsonKeyLayoutType::TYPED ||
+                    layout_type == JsonKeyLayoutType::TYPED_NOT_ALL) {
+                    typed_field_map[column_name] = layout_type;
+                }
+            }
+        }
+    } catch (const std::exception& e) {
+        ThrowInfo(ErrorCode::UnexpectedError,
+                  "Failed to deserialize JsonStatsMeta to typed_field_map: {}",
+                  e.what());
+    }
+
+    return typed_field_map;
+}
+
 }  // namespace milvus::index
\ No newline at end of file
@@ -582,6 +582,10 @@ class JsonStatsMeta {
     static std::unordered_map<std::string, std::set<std::string>>
     DeserializeToKeyFieldMap(const std::string& json_str);
 
+    // column name -> layout type of the TYPED/TYPED_NOT_ALL columns
+    static std::unordered_map<std::string, JsonKeyLayoutType>
+    DeserializeToTypedFieldMap(const std::string& json_str);
+
     size_t
     GetSerializedSize() const {
         return Serialize().size();
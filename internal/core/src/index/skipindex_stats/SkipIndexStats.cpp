@@ -28,6 +28,11 @@ std::unique_ptr<FieldChunkMetrics>
 SkipIndexStatsBuilder::Build(
     DataType data_type,
     const std::shared_ptr<parquet::Statistics>& statistic) const {
+    // all-null chunks, and writers that dropped oversized values, carry no
+    // min/max; reading them anyway would yield default values
+    if (statistic == nullptr || !statistic->HasMinMax()) {
+        return std::make_unique<NoneFieldChunkMetrics>();
+    }
     std::unique_ptr<FieldChunkMetrics> chunk_metrics;
     switch (data_type) {
         case DataType::INT8: {
@@ -160,11 +165,25 @@ SkipIndexStatsBuilder::Build(DataType data_type, const Chunk* chunk) const {
         return LoadMetrics<std::string>(info);
     }
     auto fixed_chunk = static_cast<const FixedWidthChunk*>(chunk);
-    auto span = fixed_chunk->Span();
-
-    const void* chunk_data = span.data();
-    const bool* valid_data = span.valid_data();
-    int64_t count = span.row_count();
+    const void* chunk_data;
+    const bool* valid_data;
+    int64_t count;
+    // Span() would keep a decoded copy of a packed chunk for good
+    std::vector<int64_t> decoded;
+    if (fixed_chunk->IsPacked()) {
+        count = fixed_chunk->RowNums();
+        decoded.resize(count);
+        // values of the chunk's own width, int64_t is the widest
+        fixed_chunk->DecodePacked(
+            0, count, static_cast<void*>(decoded.data()));
+        chunk_data = decoded.data();
+        valid_data = fixed_chunk->ValidData();
+    } else {
+        auto span = fixed_chunk->Span();
+        chunk_data = span.data();
+        valid_data = span.valid_data();
+        count = span.row_count();
+    }
     switch (data_type) {
         case DataType::BOOL: {
             const bool* typedData = static_cast<const bool*>(chunk_data);
@@ -191,6 +191,15 @@ class FieldChunkMetrics {
         return false;
     }
 
+    // Exact min and max of the non-null values of the chunk, so aggregates
+    // can use them in place of the rows. Float metrics do not provide them:
+    // a NaN in the chunk makes their min/max differ from min()/max(), which
+    // skip NaN.
+    virtual std::optional<std::pair<Metrics, Metrics>>
+    GetMinMax() const {
+        return std::nullopt;
+    }
+
     cachinglayer::ResourceUsage
     CellByteSize() const {
         return cell_size_;
@@ -435,6 +444,14 @@ class IntFieldChunkMetrics : public FieldChunkMetrics {
         return FieldChunkMetricsType::INT;
     }
 
+    std::optional<std::pair<Metrics, Metrics>>
+    GetMinMax() const override {
+        if (!this->has_value_) {
+            return std::nullopt;
+        }
+        return std::make_pair(Metrics(min_), Metrics(max_));
+    }
+
     bool
     CanSkipUnaryRange(OpType op_type, const Metrics& val) const override {
         if (!this->has_value_) {
@@ -444,10 +461,8 @@ class IntFieldChunkMetrics : public FieldChunkMetrics {
             return false;
         }
         const T& typed_val = std::get<T>(val);
-        if (op_type == OpType::Equal && bloom_filter_) {
-            return !bloom_filter_->Test(
-                reinterpret_cast<const uint8_t*>(&typed_val),
-                sizeof(typed_val));
+        if (op_type == OpType::Equal) {
+            return !MayContain(typed_val);
         }
         return RangeShouldSkip(typed_val, min_, max_, op_type);
     }
@@ -462,26 +477,8 @@ class IntFieldChunkMetrics : public FieldChunkMetrics {
                 return false;
             }
         }
-        if (!bloom_filter_) {
-            T typed_min = std::get<T>(values[0]);
-            T typed_max = std::get<T>(values[0]);
-            for (const auto& v : values) {
-                const T& current_val = std::get<T>(v);
-                if (current_val < typed_min) {
-                    typed_min = current_val;
-                }
-                if (current_val > typed_max) {
-                    typed_max = current_val;
-                }
-            }
-            return RangeShouldSkip(
-                typed_min, typed_max, min_, max_, true, true);
-        }
         for (const auto& v : values) {
-            const T& current_val = std::get<T>(v);
-            if (bloom_filter_->Test(
-                    reinterpret_cast<const uint8_t*>(&current_val),
-                    sizeof(current_val))) {
+            if (MayContain(std::get<T>(v))) {
                 return false;
             }
         }
@@ -528,6 +525,19 @@ class IntFieldChunkMetrics : public FieldChunkMetrics {
     }
 
  private:
+    // False when `value` is outside [min_, max_] or missed by the bloom
+    // filter, the range check is cheaper and catches the filter's false
+    // positives outside it.
+    bool
+    MayContain(const T& value) const {
+        if (value < min_ || value > max_) {
+            return false;
+        }
+        return !bloom_filter_ ||
+               bloom_filter_->Test(reinterpret_cast<const uint8_t*>(&value),
+                                   sizeof(value));
+    }
+
     T min_;
     T max_;
     BloomFilterPtr bloom_filter_{nullptr};
@@ -560,6 +570,14 @@ class StringFieldChunkMetrics : public FieldChunkMetrics {
         return FieldChunkMetricsType::STRING;
     }
 
+    std::optional<std::pair<Metrics, Metrics>>
+    GetMinMax() const override {
+        if (!this->has_value_) {
+            return std::nullopt;
+        }
+        return std::make_pair(Metrics(min_), Metrics(max_));
+    }
+
     bool
     CanSkipUnaryRange(OpType op_type, const Metrics& val) const override {
         if (!this->has_value_) {
@@ -572,13 +590,7 @@ class StringFieldChunkMetrics : public FieldChunkMetrics {
         auto value = *typed_val;
         switch (op_type) {
             case OpType::Equal: {
-                if (!bloom_filter_) {
-                    return RangeShouldSkip(*typed_val,
-                                           std::string_view(min_),
-                                           std::string_view(max_),
-                                           op_type);
-                }
-                return !bloom_filter_->Test(value);
+                return !MayContain(value);
             }
             case OpType::LessThan:
             case OpType::LessEqual:
@@ -592,6 +604,9 @@ class StringFieldChunkMetrics : public FieldChunkMetrics {
             case OpType::InnerMatch:
             case OpType::PrefixMatch:
             case OpType::PostfixMatch: {
+                if (op_type == OpType::PrefixMatch && PrefixOutOfRange(value)) {
+                    return true;
+                }
                 if (!ngram_bloom_filter_ ||
                     typed_val->size() < DEFAULT_SKIPINDEX_MIN_NGRAM_LENGTH) {
                     return false;
@@ -627,25 +642,8 @@ class StringFieldChunkMetrics : public FieldChunkMetrics {
             }
             string_values.push_back(*sv);
         }
-        if (!bloom_filter_) {
-            std::string_view min, max;
-            for (auto v : string_values) {
-                if (min.empty() || v < min) {
-                    min = v;
-                }
-                if (max.empty() || v > max) {
-                    max = v;
-                }
-            }
-            return RangeShouldSkip(min,
-                                   max,
-                                   std::string_view(min_),
-                                   std::string_view(max_),
-                                   true,
-                                   true);
-        }
         for (auto v : string_values) {
-            if (bloom_filter_->Test(v)) {
+            if (MayContain(v)) {
                 return false;
             }
         }
@@ -706,6 +704,27 @@ class StringFieldChunkMetrics : public FieldChunkMetrics {
     }
 
  private:
+    // False when `value` is outside [min_, max_] or missed by the bloom
+    // filter, see IntFieldChunkMetrics::MayContain.
+    bool
+    MayContain(std::string_view value) const {
+        if (value < std::string_view(min_) || value > std::string_view(max_)) {
+            return false;
+        }
+        return !bloom_filter_ || bloom_filter_->Test(value);
+    }
+
+    // True when no string in [min_, max_] starts with `prefix`: they all
+    // sort before it, or after every string that starts with it.
+    bool
+    PrefixOutOfRange(std::string_view prefix) const {
+        std::string_view min(min_);
+        if (std::string_view(max_) < prefix) {
+            return true;
+        }
+        return min > prefix && min.substr(0, prefix.size()) != prefix;
+    }
+
     std::string min_;
     std::string max_;
     BloomFilterPtr bloom_filter_{nullptr};
@@ -1112,3 +1112,100 @@ TEST_F(SkipIndexStatsBuilderTest,
     ASSERT_TRUE(
         metrics->CanSkipUnaryRange(OpType::PostfixMatch, std::string("xyz")));
 }
+
+TEST_F(SkipIndexStatsBuilderTest, GetMinMax) {
+    // INT64 with a null, which min/max ignore
+    {
+        auto schema = arrow::schema({arrow::field("col", arrow::int64())});
+        arrow::Int64Builder builder;
+        ASSERT_TRUE(builder.Append(7).ok());
+        ASSERT_TRUE(builder.AppendNull().ok());
+        ASSERT_TRUE(builder.Append(-3).ok());
+        ASSERT_TRUE(builder.Append(42).ok());
+
+        std::shared_ptr<arrow::Array> array;
+        ASSERT_TRUE(builder.Finish(&array).ok());
+        auto batch = arrow::RecordBatch::Make(schema, 4, {array});
+        auto metrics = builder_->Build({batch}, 0, arrow::Type::INT64);
+        auto min_max = metrics->GetMinMax();
+        ASSERT_TRUE(min_max.has_value());
+        EXPECT_EQ(std::get<int64_t>(min_max->first), -3);
+        EXPECT_EQ(std::get<int64_t>(min_max->second), 42);
+    }
+
+    // STRING
+    {
+        auto schema = arrow::schema({arrow::field("col", arrow::utf8())});
+        arrow::StringBuilder builder;
+        ASSERT_TRUE(builder.AppendValues({"pear", "apple", "zoo"}).ok());
+
+        std::shared_ptr<arrow::Array> array;
+        ASSERT_TRUE(builder.Finish(&array).ok());
+        auto batch = arrow::RecordBatch::Make(schema, 3, {array});
+        auto metrics = builder_->Build({batch}, 0, arrow::Type::STRING);
+        auto min_max = metrics->GetMinMax();
+        ASSERT_TRUE(min_max.has_value());
+        EXPECT_EQ(std::get<std::string>(min_max->first), "apple");
+        EXPECT_EQ(std::get<std::string>(min_max->second), "zoo");
+    }
+
+    // all null chunks and float chunks have none
+    {
+        auto schema = arrow::schema({arrow::field("col", arrow::int32())});
+        arrow::Int32Builder builder;
+        ASSERT_TRUE(builder.AppendNulls(3).ok());
+
+        std::shared_ptr<arrow::Array> array;
+        ASSERT_TRUE(builder.Finish(&array).ok());
+        auto batch = arrow::RecordBatch::Make(schema, 3, {array});
+        auto metrics = builder_->Build({batch}, 0, arrow::Type::INT32);
+        EXPECT_FALSE(metrics->GetMinMax().has_value());
+    }
+    {
+        auto schema = arrow::schema({arrow::field("col", arrow::float64())});
+        arrow::DoubleBuilder builder;
+        ASSERT_TRUE(builder.AppendValues({1.5, -2.5}).ok());
+
+        std::shared_ptr<arrow::Array> array;
+        ASSERT_TRUE(builder.Finish(&array).ok());
+        auto batch = arrow::RecordBatch::Make(schema, 2, {array});
+        auto metrics = builder_->Build({batch}, 0, arrow::Type::DOUBLE);
+        EXPECT_FALSE(metrics->GetMinMax().has_value());
+    }
+}
+
+TEST_F(SkipIndexStatsBuilderTest, StringEqualityAndPrefixUseRange) {
+    auto schema = arrow::schema({arrow::field("col", arrow::utf8())});
+    arrow::StringBuilder builder;
+    ASSERT_TRUE(builder.AppendValues({"", "id-0042", "id-1337"}).ok());
+
+    std::shared_ptr<arrow::Array> array;
+    ASSERT_TRUE(builder.Finish(&array).ok());
+    auto batch = arrow::RecordBatch::Make(schema, 3, {array});
+    auto builder_no_bf = std::make_unique<SkipIndexStatsBuilder>();
+    for (auto* stats_builder : {builder_.get(), builder_no_bf.get()}) {
+        auto metrics = stats_builder->Build({batch}, 0, arrow::Type::STRING);
+        ASSERT_EQ(metrics->GetMetricsType(), FieldChunkMetricsType::STRING);
+
+        EXPECT_FALSE(
+            metrics->CanSkipUnaryRange(OpType::Equal, std::string("id-0042")));
+        EXPECT_TRUE(
+            metrics->CanSkipUnaryRange(OpType::Equal, std::string("zz")));
+
+        // the empty string is a value of the chunk, not a missing bound
+        std::vector<Metrics> with_empty = {std::string(""), std::string("zz")};
+        EXPECT_FALSE(metrics->CanSkipIn(with_empty));
+        std::vector<Metrics> outside = {std::string("a"), std::string("zz")};
+        EXPECT_TRUE(metrics->CanSkipIn(outside));
+
+        // prefixes shorter than an ngram still skip on the range
+        EXPECT_FALSE(
+            metrics->CanSkipUnaryRange(OpType::PrefixMatch, std::string("i")));
+        EXPECT_FALSE(metrics->CanSkipUnaryRange(OpType::PrefixMatch,
+                                                std::string("id-1")));
+        EXPECT_TRUE(
+            metrics->CanSkipUnaryRange(OpType::PrefixMatch, std::string("j")));
+        EXPECT_TRUE(metrics->CanSkipUnaryRange(OpType::PrefixMatch,
+                                               std::string("id-2")));
+    }
+}
@@ -0,0 +1,261 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include "indexbuilder/ResourceEstimator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+#include "index/Meta.h"
+#include "knowhere/comp/index_param.h"
+#include "log/Log.h"
+
+namespace milvus::indexbuilder {
+
+namespace {
+
+// multiply-adds a build thread does in a second
+constexpr double kFlopsPerCpuSecond = 2e9;
+// the bytes assumed for a row of a variable length field and of a sparse
+// vector, the calibration corrects them for the actual data
+constexpr int64_t kVariableRowBytes = 64;
+constexpr int64_t kSparseRowBytes = 1024;
+constexpr double kGB = 1024.0 * 1024 * 1024;
+
+// the params arrive as strings from the build info and as numbers from tests
+double
+GetParam(const Config& config, const char* key, double default_value) {
+    auto it = config.find(key);
+    if (it == config.end()) {
+        return default_value;
+    }
+    if (it->is_number()) {
+        return it->get<double>();
+    }
+    if (it->is_string()) {
+        try {
+            return std::stod(it->get<std::string>());
+        } catch (const std::exception&) {
+        }
+    }
+    return default_value;
+}
+
+std::string
+GetIndexType(const Config& config) {
+    auto it = config.find(index::INDEX_TYPE);
+    return it != config.end() && it->is_string() ? it->get<std::string>()
+                                                 : std::string();
+}
+
+int64_t
+RowBytes(const BuildShape& shape) {
+    if (IsSparseFloatVectorDataType(shape.field_type)) {
+        return kSparseRowBytes;
+    }
+    if (IsVectorDataType(shape.field_type)) {
+        return GetDataTypeSize(shape.field_type, shape.dim);
+    }
+    switch (shape.field_type) {
+        case DataType::BOOL:
+        case DataType::INT8:
+        case DataType::INT16:
+        case DataType::INT32:
+        case DataType::INT64:
+        case DataType::FLOAT:
+        case DataType::DOUBLE:
+        case DataType::TIMESTAMPTZ:
+            return GetDataTypeSize(shape.field_type);
+        default:
+            return kVariableRowBytes;
+    }
+}
+
+// k-means over at most 256 training rows per centroid
+double
+KmeansFlops(double rows, double centroids, double dim) {
+    constexpr double kIterations = 10;
+    auto train_rows = std::min(rows, centroids * 256);
+    return train_rows * centroids * dim * kIterations +
+           rows * centroids * dim;
+}
+
+BuildResource
+ModelVector(const BuildShape& shape,
+            const std::string& index_type,
+            double raw_bytes) {
+    double rows = shape.num_rows;
+    double dim = std::max<int64_t>(shape.dim, 1);
+    double row_bytes = RowBytes(shape);
+    BuildResource resource;
+    double index_bytes = raw_bytes;
+    double flops = rows * dim;
+
+    if (index_type == knowhere::IndexEnum::INDEX_HNSW) {
+        auto m = GetParam(shape.config, knowhere::indexparam::HNSW_M, 30);
+        auto ef =
+            GetParam(shape.config, knowhere::indexparam::EFCONSTRUCTION, 360);
+        // 2M level 0 links, the upper levels add about a tenth
+        index_bytes = raw_bytes + rows * (2 * m * 4 + 16) * 1.1;
+        flops = rows * ef * m * dim;
+    } else if (index_type == knowhere::IndexEnum::INDEX_FAISS_IVFFLAT ||
+               index_type == knowhere::IndexEnum::INDEX_FAISS_IVFFLAT_CC ||
+               index_type == knowhere::IndexEnum::INDEX_FAISS_BIN_IVFFLAT ||
+               index_type == knowhere::IndexEnum::INDEX_FAISS_IVFSQ8 ||
+               index_type == knowhere::IndexEnum::INDEX_FAISS_IVFPQ ||
+               index_type == knowhere::IndexEnum::INDEX_FAISS_SCANN) {
+        auto nlist = GetParam(shape.config, knowhere::indexparam::NLIST, 128);
+        auto codes = raw_bytes;
+        flops = KmeansFlops(rows, nlist, dim);
+        if (index_type == knowhere::IndexEnum::INDEX_FAISS_IVFSQ8) {
+            codes = rows * dim;
+        } else if (index_type == knowhere::IndexEnum::INDEX_FAISS_IVFPQ) {
+            auto m = GetParam(shape.config, knowhere::indexparam::M, dim / 4);
+            auto nbits = GetParam(shape.config, knowhere::indexparam::NBITS, 8);
+            codes = rows * m * nbits / 8;
+            flops += KmeansFlops(rows, std::exp2(nbits), dim);
+        } else if (index_type == knowhere::IndexEnum::INDEX_FAISS_SCANN) {
+            // 4 bit codes next to the refine data
+            codes = raw_bytes + rows * dim / 2;
+        }
+        index_bytes = codes + rows * sizeof(int64_t) + nlist * dim * 4;
+    } else if (index_type == knowhere::IndexEnum::INDEX_DISKANN) {
+        auto degree = GetParam(shape.config, index::DISK_ANN_MAX_DEGREE, 56);
+        auto search_list =
+            GetParam(shape.config, index::DISK_ANN_SEARCH_LIST_SIZE, 100);
+        auto pq_bytes =
+            GetParam(shape.config, index::DISK_ANN_PQ_CODE_BUDGET, 0) * kGB;
+        if (pq_bytes <= 0) {
+            pq_bytes = raw_bytes / 8;
+        }
+        auto dram_bytes =
+            GetParam(shape.config, index::DISK_ANN_BUILD_DRAM_BUDGET, 0) *
+            kGB;
+        // the graph is built in shards that fit the dram budget
+        auto graph_bytes = rows * (row_bytes + 4 + degree * 4);
+        resource.memory_bytes = static_cast<int64_t>(
+            (dram_bytes > 0 ? std::min(graph_bytes, dram_bytes)
+                            : graph_bytes) +
+            pq_bytes);
+        // the raw data is staged on disk next to the index files
+        resource.disk_bytes =
+            static_cast<int64_t>(raw_bytes + graph_bytes + pq_bytes);
+        // two passes of the graph build
+        resource.cpu_seconds =
+            2 * rows * search_list * degree * dim / kFlopsPerCpuSecond +
+            KmeansFlops(rows, 256, dim) / kFlopsPerCpuSecond;
+        return resource;
+    }
+    // the raw data stays held while the index is built
+    resource.memory_bytes = static_cast<int64_t>(raw_bytes + index_bytes);
+    resource.cpu_seconds = flops / kFlopsPerCpuSecond;
+    return resource;
+}
+
+BuildResource
+ModelScalar(const BuildShape& shape,
+            const std::string& index_type,
+            double raw_bytes) {
+    double rows = shape.num_rows;
+    BuildResource resource;
+    // the field data, the sorted or grouped structure and its serialized
+    // form
+    resource.memory_bytes = static_cast<int64_t>(3 * raw_bytes);
+    if (index_type == index::INVERTED_INDEX_TYPE ||
+        index_type == index::NGRAM_INDEX_TYPE) {
+        // tantivy writes its segments to local disk before the upload
+        resource.disk_bytes = static_cast<int64_t>(2 * raw_bytes);
+    }
+    // a sort of the rows at about 50 operations a comparison
+    resource.cpu_seconds =
+        rows * std::log2(std::max(rows, 2.0)) * 50 / kFlopsPerCpuSecond;
+    return resource;
+}
+
+double
+Scale(double measured, double modeled) {
+    return std::clamp(measured / modeled,
+                      ResourceEstimator::kMinCalibration,
+                      ResourceEstimator::kMaxCalibration);
+}
+
+}  // namespace
+
+BuildResource
+ResourceEstimator::Model(const BuildShape& shape) {
+    if (shape.num_rows <= 0) {
+        return {};
+    }
+    auto index_type = GetIndexType(shape.config);
+    double raw_bytes = static_cast<double>(shape.num_rows) * RowBytes(shape);
+    if (IsVectorDataType(shape.field_type)) {
+        return ModelVector(shape, index_type, raw_bytes);
+    }
+    return ModelScalar(shape, index_type, raw_bytes);
+}
+
+BuildResource
+ResourceEstimator::Estimate(const BuildShape& shape) const {
+    auto resource = Model(shape);
+    Calibration calibration;
+    {
+        std::lock_guard lck(mutex_);
+        auto it = calibrations_.find(GetIndexType(shape.config));
+        if (it != calibrations_.end()) {
+            calibration = it->second;
+        }
+    }
+    resource.memory_bytes =
+        static_cast<int64_t>(resource.memory_bytes * calibration.memory);
+    resource.disk_bytes =
+        static_cast<int64_t>(resource.disk_bytes * calibration.disk);
+    resource.cpu_seconds *= calibration.cpu;
+    return resource;
+}
+
+void
+ResourceEstimator::Report(const BuildShape& shape,
+                          const BuildResource& actual) {
+    auto modeled = Model(shape);
+    auto index_type = GetIndexType(shape.config);
+    std::lock_guard lck(mutex_);
+    auto& calibration = calibrations_[index_type];
+    // the mean of the first reports, then a moving average that follows
+    // changes of the data and the nodes
+    auto weight = std::max(kCalibrationWeight,
+                           1.0 / static_cast<double>(calibration.reports + 1));
+    auto update = [weight](double& scale, double measured, double model) {
+        if (measured > 0 && model > 0) {
+            scale += weight * (Scale(measured, model) - scale);
+        }
+    };
+    update(calibration.memory, actual.memory_bytes, modeled.memory_bytes);
+    update(calibration.disk, actual.disk_bytes, modeled.disk_bytes);
+    update(calibration.cpu, actual.cpu_seconds, modeled.cpu_seconds);
+    calibration.reports++;
+    LOG_DEBUG(
+        "calibrate {} build estimate with {} reports, memory: {}, disk: {}, "
+        "cpu: {}",
+        index_type,
+        calibration.reports,
+        calibration.memory,
+        calibration.disk,
+        calibration.cpu);
+}
+
+void
+ResourceEstimator::Reset() {
+    std::lock_guard lck(mutex_);
+    calibrations_.clear();
+}
+
+}  // namespace milvus::indexbuilder
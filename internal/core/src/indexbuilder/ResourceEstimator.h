@@ -0,0 +1,87 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#pragma once
+
+#include <stdint.h>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "common/Types.h"
+
+namespace milvus::indexbuilder {
+
+// What an index build takes at its peak: memory, local disk and cpu time
+// summed over all the threads of the build.
+struct BuildResource {
+    int64_t memory_bytes = 0;
+    int64_t disk_bytes = 0;
+    double cpu_seconds = 0;
+};
+
+// The index build about to be estimated, `config` holds the index and type
+// params of the build as get_config() lays them out.
+struct BuildShape {
+    DataType field_type = DataType::NONE;
+    int64_t dim = 0;
+    int64_t num_rows = 0;
+    Config config;
+};
+
+// Estimates what an index build will take before it starts, so that the
+// scheduler can place builds on index nodes with room for them instead of
+// finding out by an OOM.
+//
+// Model() is a closed form of the raw data, the index structure and the
+// build scratch space of every index type. Estimate() scales it by how far
+// the model was off for the builds of the same index type reported so far.
+class ResourceEstimator {
+ public:
+    // how much a report moves the calibration once a few are in
+    static constexpr double kCalibrationWeight = 0.2;
+    // the calibration never scales the model beyond these
+    static constexpr double kMinCalibration = 0.1;
+    static constexpr double kMaxCalibration = 10;
+
+    static ResourceEstimator&
+    GetInstance() {
+        static ResourceEstimator instance;
+        return instance;
+    }
+
+    static BuildResource
+    Model(const BuildShape& shape);
+
+    BuildResource
+    Estimate(const BuildShape& shape) const;
+
+    // what a completed build of `shape` actually took, the parts not measured
+    // are left 0 and don't move the calibration
+    void
+    Report(const BuildShape& shape, const BuildResource& actual);
+
+    void
+    Reset();
+
+ private:
+    struct Calibration {
+        double memory = 1;
+        double disk = 1;
+        double cpu = 1;
+        int64_t reports = 0;
+    };
+
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, Calibration> calibrations_;
+};
+
+}  // namespace milvus::indexbuilder
@@ -0,0 +1,113 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "index/Meta.h"
+#include "indexbuilder/ResourceEstimator.h"
+#include "knowhere/comp/index_param.h"
+
+using milvus::DataType;
+using milvus::indexbuilder::BuildResource;
+using milvus::indexbuilder::BuildShape;
+using milvus::indexbuilder::ResourceEstimator;
+
+namespace {
+
+BuildShape
+VectorShape(const std::string& index_type, int64_t num_rows = 1000000) {
+    BuildShape shape;
+    shape.field_type = DataType::VECTOR_FLOAT;
+    shape.dim = 128;
+    shape.num_rows = num_rows;
+    shape.config[milvus::index::INDEX_TYPE] = index_type;
+    return shape;
+}
+
+}  // namespace
+
+TEST(ResourceEstimatorTest, ModelsIndexTypes) {
+    const double raw_bytes = 1000000.0 * 128 * sizeof(float);
+
+    auto hnsw = VectorShape(knowhere::IndexEnum::INDEX_HNSW);
+    hnsw.config[knowhere::indexparam::HNSW_M] = "16";
+    auto small_hnsw = ResourceEstimator::Model(hnsw);
+    hnsw.config[knowhere::indexparam::HNSW_M] = "64";
+    auto large_hnsw = ResourceEstimator::Model(hnsw);
+    EXPECT_GT(small_hnsw.memory_bytes, 2 * raw_bytes);
+    EXPECT_GT(large_hnsw.memory_bytes, small_hnsw.memory_bytes);
+    EXPECT_GT(large_hnsw.cpu_seconds, small_hnsw.cpu_seconds);
+    EXPECT_EQ(small_hnsw.disk_bytes, 0);
+
+    auto ivf_flat = ResourceEstimator::Model(
+        VectorShape(knowhere::IndexEnum::INDEX_FAISS_IVFFLAT));
+    auto ivf_pq = ResourceEstimator::Model(
+        VectorShape(knowhere::IndexEnum::INDEX_FAISS_IVFPQ));
+    EXPECT_LT(ivf_pq.memory_bytes, ivf_flat.memory_bytes);
+    EXPECT_GT(ivf_pq.memory_bytes, raw_bytes);
+
+    auto diskann = VectorShape(knowhere::IndexEnum::INDEX_DISKANN);
+    auto unbounded = ResourceEstimator::Model(diskann);
+    diskann.config[milvus::index::DISK_ANN_BUILD_DRAM_BUDGET] = "0.1";
+    auto bounded = ResourceEstimator::Model(diskann);
+    EXPECT_GT(unbounded.disk_bytes, raw_bytes);
+    EXPECT_LT(bounded.memory_bytes, unbounded.memory_bytes);
+    EXPECT_EQ(bounded.disk_bytes, unbounded.disk_bytes);
+
+    BuildShape scalar;
+    scalar.field_type = DataType::INT64;
+    scalar.num_rows = 1000000;
+    scalar.config[milvus::index::INDEX_TYPE] = "STL_SORT";
+    EXPECT_EQ(ResourceEstimator::Model(scalar).disk_bytes, 0);
+    EXPECT_GT(ResourceEstimator::Model(scalar).memory_bytes, 8000000);
+    scalar.config[milvus::index::INDEX_TYPE] =
+        milvus::index::INVERTED_INDEX_TYPE;
+    EXPECT_GT(ResourceEstimator::Model(scalar).disk_bytes, 0);
+
+    EXPECT_EQ(ResourceEstimator::Model(VectorShape("HNSW", 0)).memory_bytes,
+              0);
+}
+
+TEST(ResourceEstimatorTest, CalibratesByReports) {
+    ResourceEstimator estimator;
+    auto hnsw = VectorShape(knowhere::IndexEnum::INDEX_HNSW);
+    auto ivf = VectorShape(knowhere::IndexEnum::INDEX_FAISS_IVFFLAT);
+    auto model = ResourceEstimator::Model(hnsw);
+    EXPECT_EQ(estimator.Estimate(hnsw).memory_bytes, model.memory_bytes);
+
+    // the first report sets the calibration, the cpu time wasn't measured
+    estimator.Report(hnsw, {2 * model.memory_bytes, 0, 0});
+    auto estimate = estimator.Estimate(hnsw);
+    EXPECT_NEAR(estimate.memory_bytes, 2 * model.memory_bytes, 1);
+    EXPECT_DOUBLE_EQ(estimate.cpu_seconds, model.cpu_seconds);
+    // other index types keep their own
+    EXPECT_EQ(estimator.Estimate(ivf).memory_bytes,
+              ResourceEstimator::Model(ivf).memory_bytes);
+
+    // the second one is averaged in
+    estimator.Report(hnsw, {4 * model.memory_bytes, 0, 0});
+    EXPECT_NEAR(estimator.Estimate(hnsw).memory_bytes,
+                3 * model.memory_bytes,
+                1);
+
+    // later ones move it by the calibration weight, up to the clamp
+    for (int i = 0; i < 100; i++) {
+        estimator.Report(hnsw, {1000 * model.memory_bytes, 0, 0});
+    }
+    EXPECT_NEAR(estimator.Estimate(hnsw).memory_bytes,
+                ResourceEstimator::kMaxCalibration * model.memory_bytes,
+                model.memory_bytes * 0.01);
+
+    estimator.Reset();
+    EXPECT_EQ(estimator.Estimate(hnsw).memory_bytes, model.memory_bytes);
+}
@@ -34,6 +34,7 @@
 #include "index/json_stats/JsonKeyStats.h"
 #include "indexbuilder/IndexCreatorBase.h"
 #include "indexbuilder/IndexFactory.h"
+#include "indexbuilder/ResourceEstimator.h"
 #include "indexbuilder/VecIndexCreator.h"
 #include "indexbuilder/index_c.h"
 #include "indexbuilder/type_c.h"
@@ -592,6 +593,76 @@ DeleteIndex(CIndex index) {
     return status;
 }
 
+milvus::indexbuilder::BuildShape
+get_build_shape(const uint8_t* serialized_build_index_info,
+                const uint64_t len) {
+    auto build_index_info =
+        std::make_unique<milvus::proto::indexcgo::BuildIndexInfo>();
+    auto res =
+        build_index_info->ParseFromArray(serialized_build_index_info, len);
+    AssertInfo(res, "Unmarshal build index info failed");
+
+    milvus::indexbuilder::BuildShape shape;
+    shape.field_type =
+        static_cast<DataType>(build_index_info->field_schema().data_type());
+    shape.dim = build_index_info->dim();
+    shape.num_rows = build_index_info->num_rows();
+    shape.config = get_config(build_index_info);
+    return shape;
+}
+
+CStatus
+EstimateIndexBuildResource(const uint8_t* serialized_build_index_info,
+                           const uint64_t len,
+                           CIndexBuildResource* estimate) {
+    SCOPE_CGO_CALL_METRIC();
+
+    auto status = CStatus();
+    try {
+        AssertInfo(estimate, "failed to estimate index build, null output");
+        auto shape = get_build_shape(serialized_build_index_info, len);
+        auto resource =
+            milvus::indexbuilder::ResourceEstimator::GetInstance().Estimate(
+                shape);
+        estimate->memory_bytes = resource.memory_bytes;
+        estimate->disk_bytes = resource.disk_bytes;
+        estimate->cpu_seconds = resource.cpu_seconds;
+        status.error_code = Success;
+        status.error_msg = "";
+    } catch (SegcoreError& e) {
+        status.error_code = e.get_error_code();
+        status.error_msg = strdup(e.what());
+    } catch (std::exception& e) {
+        status.error_code = UnexpectedError;
+        status.error_msg = strdup(e.what());
+    }
+    return status;
+}
+
+CStatus
+ReportIndexBuildResource(const uint8_t* serialized_build_index_info,
+                         const uint64_t len,
+                         CIndexBuildResource actual) {
+    SCOPE_CGO_CALL_METRIC();
+
+    auto status = CStatus();
+    try {
+        auto shape = get_build_shape(serialized_build_index_info, len);
+        milvus::indexbuilder::ResourceEstimator::GetInstance().Report(
+            shape,
+            {actual.memory_bytes, actual.disk_bytes, actual.cpu_seconds});
+        status.error_code = Success;
+        status.error_msg = "";
+    } catch (SegcoreError& e) {
+        status.error_code = e.get_error_code();
+        status.error_msg = strdup(e.what());
+    } catch (std::exception& e) {
+        status.error_code = UnexpectedError;
+        status.error_msg = strdup(e.what());
+    }
+    return status;
+}
+
 CStatus
 BuildFloatVecIndex(CIndex index,
                    int64_t float_value_num,
@@ -32,6 +32,19 @@ CreateIndex(CIndex* res_index,
 CStatus
 DeleteIndex(CIndex index);
 
+// Estimates what building the index of a serialized BuildIndexInfo takes,
+// calibrated by the builds reported by ReportIndexBuildResource.
+CStatus
+EstimateIndexBuildResource(const uint8_t* serialized_build_index_info,
+                           const uint64_t len,
+                           CIndexBuildResource* estimate);
+
+// Reports what a completed build actually took, 0 for what wasn't measured.
+CStatus
+ReportIndexBuildResource(const uint8_t* serialized_build_index_info,
+                         const uint64_t len,
+                         CIndexBuildResource actual);
+
 CStatus
 BuildJsonKeyIndex(ProtoLayoutInterface c_binary_set,
                   const uint8_t* serialized_build_index_info,
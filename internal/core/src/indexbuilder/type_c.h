@@ -15,3 +15,11 @@
 
 typedef void* CIndex;
 typedef void* CIndexQueryResult;
+
+// the peak memory and local disk bytes of an index build and the cpu seconds
+// of all its threads
+typedef struct CIndexBuildResource {
+    int64_t memory_bytes;
+    int64_t disk_bytes;
+    double cpu_seconds;
+} CIndexBuildResource;
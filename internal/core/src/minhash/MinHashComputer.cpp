@@ -17,14 +17,20 @@
 #include <cstdint>
 #include <cstdio>
 #include <cstring>
+#include <future>
 #include <iosfwd>
 #include <memory>
 #include <random>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "MinHashHook.h"
+#include "arrow/array/array_binary.h"
+#include "common/EasyAssert.h"
 #include "fusion_compute_native.h"
+#include "storage/ThreadPools.h"
+#include "storage/Util.h"
 #include "tantivy/token-stream.h"
 #include "tantivy/tokenizer.h"
 // xxHash from conan dependencies (includes XXH3)
@@ -94,6 +100,128 @@ ComputeBatchRotation(const uint64_t* base_hashes,
         base_hash_offset += shingle_count;
     }
 }
+
+// rows hashed together, bounding the base hashes a worker holds at once
+constexpr int64_t kBlockRows = 1024;
+
+template <typename ArrayType>
+void
+ComputeBinaryVectorsInRange(const ArrayType& texts,
+                            int64_t begin,
+                            int64_t end,
+                            void* tokenizer_ptr,
+                            int32_t shingle_size,
+                            const uint64_t* perm_a,
+                            const uint64_t* perm_b,
+                            HashFunction hash_func_type,
+                            int32_t num_hashes,
+                            uint8_t* binary_vectors) {
+    std::vector<const char*> text_ptrs;
+    std::vector<int32_t> text_lengths;
+    std::vector<uint64_t> base_hashes;
+    std::vector<int32_t> hash_counts;
+    std::vector<uint32_t> signatures;
+    for (auto block = begin; block < end; block += kBlockRows) {
+        auto rows = std::min(kBlockRows, end - block);
+        text_ptrs.resize(rows);
+        text_lengths.resize(rows);
+        for (int64_t i = 0; i < rows; i++) {
+            std::string_view text =
+                texts.IsNull(block + i) ? std::string_view("")
+                                        : texts.GetView(block + i);
+            text_ptrs[i] = text.data();
+            text_lengths[i] = static_cast<int32_t>(text.size());
+        }
+        HashNGramWindow(text_ptrs.data(),
+                        text_lengths.data(),
+                        rows,
+                        tokenizer_ptr,
+                        shingle_size,
+                        hash_func_type,
+                        base_hashes,
+                        hash_counts);
+        signatures.resize(rows * num_hashes);
+        ComputeBatchRotation(base_hashes.data(),
+                             hash_counts.data(),
+                             rows,
+                             perm_a,
+                             perm_b,
+                             num_hashes,
+                             signatures.data());
+        // a binary vector holds the signature as little-endian uint32s,
+        // the byte order of the hosts we run on
+        std::memcpy(binary_vectors + block * num_hashes * sizeof(uint32_t),
+                    signatures.data(),
+                    signatures.size() * sizeof(uint32_t));
+    }
+}
+
+template <typename ArrayType>
+void
+ComputeBinaryVectors(const ArrayType& texts,
+                     void* tokenizer_ptr,
+                     int32_t shingle_size,
+                     const uint64_t* perm_a,
+                     const uint64_t* perm_b,
+                     HashFunction hash_func_type,
+                     int32_t num_hashes,
+                     uint8_t* binary_vectors) {
+    auto num_texts = texts.length();
+    auto num_blocks = (num_texts + kBlockRows - 1) / kBlockRows;
+    auto& pool = milvus::ThreadPools::GetThreadPool(
+        milvus::ThreadPoolPriority::MIDDLE);
+    auto num_tasks = std::min<int64_t>(
+        num_blocks, std::max<int64_t>(1, pool.GetMaxThreadNum()));
+    if (num_tasks <= 1) {
+        ComputeBinaryVectorsInRange(texts,
+                                    0,
+                                    num_texts,
+                                    tokenizer_ptr,
+                                    shingle_size,
+                                    perm_a,
+                                    perm_b,
+                                    hash_func_type,
+                                    num_hashes,
+                                    binary_vectors);
+        return;
+    }
+
+    // a token stream borrows its tokenizer, so workers can't share one
+    std::vector<std::unique_ptr<milvus::tantivy::Tokenizer>> tokenizers;
+    if (tokenizer_ptr != nullptr) {
+        auto* tokenizer =
+            static_cast<milvus::tantivy::Tokenizer*>(tokenizer_ptr);
+        for (int64_t task = 0; task < num_tasks; task++) {
+            tokenizers.emplace_back(tokenizer->Clone());
+        }
+    }
+    auto blocks_per_task = (num_blocks + num_tasks - 1) / num_tasks;
+    std::vector<std::future<void>> futures;
+    futures.reserve(num_tasks);
+    for (int64_t task = 0; task < num_tasks; task++) {
+        auto begin = task * blocks_per_task * kBlockRows;
+        auto end = std::min(num_texts, begin + blocks_per_task * kBlockRows);
+        if (begin >= end) {
+            break;
+        }
+        void* task_tokenizer =
+            tokenizers.empty() ? nullptr : tokenizers[task].get();
+        futures.emplace_back(pool.Submit([&, begin, end, task_tokenizer]() {
+            ComputeBinaryVectorsInRange(texts,
+                                        begin,
+                                        end,
+                                        task_tokenizer,
+                                        shingle_size,
+                                        perm_a,
+                                        perm_b,
+                                        hash_func_type,
+                                        num_hashes,
+                                        binary_vectors);
+        }));
+    }
+    milvus::storage::WaitAllFutures(futures);
+}
+
 }  // namespace
 
 void
@@ -242,5 +370,44 @@ ComputeFromTextsDirectly(const char** texts,
                          signatures);
 }
 
+void
+ComputeBinaryVectorsFromArrow(const arrow::Array& texts,
+                              void* tokenizer_ptr,
+                              int32_t shingle_size,
+                              const uint64_t* perm_a,
+                              const uint64_t* perm_b,
+                              HashFunction hash_func_type,
+                              int32_t num_hashes,
+                              uint8_t* binary_vectors) {
+    switch (texts.type_id()) {
+        case arrow::Type::STRING:
+            ComputeBinaryVectors(
+                static_cast<const arrow::StringArray&>(texts),
+                tokenizer_ptr,
+                shingle_size,
+                perm_a,
+                perm_b,
+                hash_func_type,
+                num_hashes,
+                binary_vectors);
+            break;
+        case arrow::Type::LARGE_STRING:
+            ComputeBinaryVectors(
+                static_cast<const arrow::LargeStringArray&>(texts),
+                tokenizer_ptr,
+                shingle_size,
+                perm_a,
+                perm_b,
+                hash_func_type,
+                num_hashes,
+                binary_vectors);
+            break;
+        default:
+            ThrowInfo(milvus::DataTypeInvalid,
+                      "minhash expects a string array, got {}",
+                      texts.type()->ToString());
+    }
+}
+
 }  // namespace minhash
 }  // namespace milvus
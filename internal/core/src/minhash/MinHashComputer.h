@@ -14,6 +14,8 @@
 #include <cstdint>
 #include <vector>
 
+#include "arrow/array.h"
+
 namespace milvus {
 namespace minhash {
 // Hash function types
@@ -47,5 +49,20 @@ ComputeFromTextsDirectly(const char** texts,
                          int32_t num_hashes,
                          uint32_t* signatures);
 
+// Computes the signature of every text of `texts`, a STRING or LARGE_STRING
+// array, straight into `binary_vectors`: num_hashes * 4 bytes per text laid
+// out as a binary vector. Texts are hashed in blocks on the MIDDLE thread
+// pool, every worker tokenizing with its own clone of the tokenizer. A null
+// text gets the signature of an empty one.
+void
+ComputeBinaryVectorsFromArrow(const arrow::Array& texts,
+                              void* tokenizer_ptr,
+                              int32_t shingle_size,
+                              const uint64_t* perm_a,
+                              const uint64_t* perm_b,
+                              HashFunction hash_func_type,
+                              int32_t num_hashes,
+                              uint8_t* binary_vectors);
+
 }  // namespace minhash
 }  // namespace milvus
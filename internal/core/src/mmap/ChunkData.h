@@ -15,6 +15,9 @@
 // limitations under the License.
 #pragma once
 
+#include <memory>
+#include <vector>
+
 #include "common/Array.h"
 #include "common/FastMem.h"
 #include "common/VectorTrait.h"
@@ -58,6 +61,10 @@ struct FixedLengthChunk {
 };
 /**
  * @brief VariableLengthChunk
+ *
+ * Views of the rows into bytes copied once per set(). The bytes come from the
+ * mmap chunk manager, or without a descriptor from blocks the chunk owns, so
+ * a batch of rows is one allocation instead of one per row.
  */
 template <typename Type>
 struct VariableLengthChunk {
@@ -92,9 +99,21 @@ struct VariableLengthChunk {
     };
 
  private:
+    // room for `size` bytes of the rows of one set()
+    void*
+    allocate(size_t size) {
+        if (mmap_descriptor_ == nullptr) {
+            arena_.push_back(std::make_unique<char[]>(size));
+            return arena_.back().get();
+        }
+        auto mcm = storage::MmapManager::GetInstance().GetMmapChunkManager();
+        return mcm->Allocate(mmap_descriptor_, size);
+    }
+
     int64_t size_ = 0;
     FixedVector<ChunkViewType<Type>> data_;
     storage::MmapChunkDescriptorPtr mmap_descriptor_ = nullptr;
+    std::vector<std::unique_ptr<char[]>> arena_;
 };
 
 // Template specialization for string
@@ -105,7 +124,6 @@ VariableLengthChunk<std::string>::set(
     uint32_t begin,
     uint32_t length,
     const std::optional<CheckDataValid>& check_data_valid) {
-    auto mcm = storage::MmapManager::GetInstance().GetMmapChunkManager();
     AssertInfo(
         begin + length <= size_,
         "failed to set a chunk with length: {} from beign {}, map_size={}",
@@ -117,7 +135,7 @@ VariableLengthChunk<std::string>::set(
     for (auto i = 0; i < length; i++) {
         total_size += src[i].size() + padding_size;
     }
-    auto buf = (char*)mcm->Allocate(mmap_descriptor_, total_size);
+    auto buf = (char*)allocate(total_size);
     AssertInfo(buf != nullptr, "failed to allocate memory from mmap_manager.");
     for (auto i = 0, offset = 0; i < length; i++) {
         auto data_size = src[i].size() + padding_size;
@@ -141,7 +159,6 @@ VariableLengthChunk<knowhere::sparse::SparseRow<SparseValueType>>::set(
     uint32_t begin,
     uint32_t length,
     const std::optional<CheckDataValid>& check_data_valid) {
-    auto mcm = storage::MmapManager::GetInstance().GetMmapChunkManager();
     AssertInfo(
         begin + length <= size_,
         "failed to set a chunk with length: {} from beign {}, map_size={}",
@@ -153,7 +170,7 @@ VariableLengthChunk<knowhere::sparse::SparseRow<SparseValueType>>::set(
     for (auto i = 0; i < length; i++) {
         total_size += src[i].data_byte_size();
     }
-    auto buf = (uint8_t*)mcm->Allocate(mmap_descriptor_, total_size);
+    auto buf = (uint8_t*)allocate(total_size);
     AssertInfo(buf != nullptr, "failed to allocate memory from mmap_manager.");
     for (auto i = 0, offset = 0; i < length; i++) {
         auto data_size = src[i].data_byte_size();
@@ -174,7 +191,6 @@ VariableLengthChunk<Json>::set(
     uint32_t begin,
     uint32_t length,
     const std::optional<CheckDataValid>& check_data_valid) {
-    auto mcm = storage::MmapManager::GetInstance().GetMmapChunkManager();
     AssertInfo(
         begin + length <= size_,
         "failed to set a chunk with length: {} from beign {}, map_size={}",
@@ -186,7 +202,7 @@ VariableLengthChunk<Json>::set(
     for (auto i = 0; i < length; i++) {
         total_size += src[i].size() + padding_size;
     }
-    auto buf = (char*)mcm->Allocate(mmap_descriptor_, total_size);
+    auto buf = (char*)allocate(total_size);
     AssertInfo(buf != nullptr, "failed to allocate memory from mmap_manager.");
     for (auto i = 0, offset = 0; i < length; i++) {
         auto data_size = src[i].size() + padding_size;
@@ -211,7 +227,6 @@ VariableLengthChunk<Array>::set(
     uint32_t begin,
     uint32_t length,
     const std::optional<CheckDataValid>& check_data_valid) {
-    auto mcm = storage::MmapManager::GetInstance().GetMmapChunkManager();
     AssertInfo(
         begin + length <= size_,
         "failed to set a chunk with length: {} from begin {}, map_size={}",
@@ -226,7 +241,7 @@ VariableLengthChunk<Array>::set(
         }
     }
 
-    auto buf = (char*)mcm->Allocate(mmap_descriptor_, total_size);
+    auto buf = (char*)allocate(total_size);
     AssertInfo(buf != nullptr, "failed to allocate memory from mmap_manager.");
     char* data_ptr = buf;
     for (auto i = 0; i < length; i++) {
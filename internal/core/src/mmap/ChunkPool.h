@@ -0,0 +1,123 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "common/Types.h"
+#include "segcore/SegcoreConfig.h"
+
+namespace milvus {
+
+// bytes held by the chunk pools of all element types
+inline std::atomic<int64_t> growing_chunk_pool_bytes{0};
+
+// Process-wide pool of the in-memory fixed-width chunks of growing segments.
+//
+// A growing segment allocates a chunk every `chunk_rows` inserted rows, and
+// each fresh chunk costs page faults and a zero fill on the insert path.
+// Released segments hand their chunks back here instead of freeing them, and
+// later segments take them again. All pools together hold at most
+// SegcoreConfig::get_growing_chunk_pool_bytes() bytes; 0, the default,
+// disables pooling.
+//
+// Thread safety: All methods are thread-safe.
+template <typename Type>
+class GrowingChunkPool {
+    static_assert(std::is_trivially_copyable_v<Type>);
+
+ public:
+    static GrowingChunkPool&
+    Instance() {
+        static GrowingChunkPool pool;
+        return pool;
+    }
+
+    // Returns a zero-filled chunk of `size` elements, a pooled one if any.
+    FixedVector<Type>
+    Acquire(int64_t size) {
+        FixedVector<Type> chunk;
+        if (growing_chunk_pool_bytes.load(std::memory_order_relaxed) > 0) {
+            std::lock_guard<std::mutex> lck(mutex_);
+            auto it = free_.find(size);
+            if (it != free_.end() && !it->second.empty()) {
+                chunk = std::move(it->second.back());
+                it->second.pop_back();
+                growing_chunk_pool_bytes.fetch_sub(size * sizeof(Type));
+            }
+        }
+        if (chunk.empty()) {
+            return FixedVector<Type>(size);
+        }
+        std::fill(chunk.begin(), chunk.end(), Type{});
+        return chunk;
+    }
+
+    // Keeps `chunk` for a later Acquire, or frees it if the pool is full.
+    void
+    Release(FixedVector<Type>&& chunk) {
+        auto bytes = static_cast<int64_t>(chunk.size() * sizeof(Type));
+        auto limit = segcore::SegcoreConfig::default_config()
+                         .get_growing_chunk_pool_bytes();
+        auto pooled = growing_chunk_pool_bytes.fetch_add(bytes) + bytes;
+        if (bytes == 0 || pooled > limit) {
+            growing_chunk_pool_bytes.fetch_sub(bytes);
+            return;
+        }
+        std::lock_guard<std::mutex> lck(mutex_);
+        free_[chunk.size()].push_back(std::move(chunk));
+    }
+
+    // Frees every pooled chunk.
+    void
+    Clear() {
+        std::unordered_map<int64_t, std::vector<FixedVector<Type>>> free;
+        {
+            std::lock_guard<std::mutex> lck(mutex_);
+            free.swap(free_);
+        }
+        for (auto& [size, chunks] : free) {
+            growing_chunk_pool_bytes.fetch_sub(size * sizeof(Type) *
+                                               chunks.size());
+        }
+    }
+
+    int64_t
+    GetChunkCount() const {
+        std::lock_guard<std::mutex> lck(mutex_);
+        int64_t count = 0;
+        for (auto& [size, chunks] : free_) {
+            count += chunks.size();
+        }
+        return count;
+    }
+
+ private:
+    GrowingChunkPool() = default;
+
+    mutable std::mutex mutex_;
+    // pooled chunks by their number of elements
+    std::unordered_map<int64_t, std::vector<FixedVector<Type>>> free_;
+};
+
+}  // namespace milvus
@@ -23,6 +23,7 @@
 #include "common/TypeTraits.h"
 #include "common/Utils.h"
 #include "mmap/ChunkData.h"
+#include "mmap/ChunkPool.h"
 #include "segcore/SegcoreConfig.h"
 #include "storage/MmapManager.h"
 
@@ -71,12 +72,22 @@ template <typename Type,
           typename ChunkImpl = FixedVector<Type>,
           bool IsMmap = false>
 class ThreadSafeChunkVector : public ChunkVectorBase<Type> {
+    // in-memory fixed-width chunks can be recycled via GrowingChunkPool
+    static constexpr bool kPoolable =
+        !IsMmap && std::is_same_v<ChunkImpl, FixedVector<Type>> &&
+        std::is_trivially_copyable_v<Type>;
+
  public:
-    ThreadSafeChunkVector(
-        storage::MmapChunkDescriptorPtr descriptor = nullptr) {
+    ThreadSafeChunkVector(storage::MmapChunkDescriptorPtr descriptor = nullptr,
+                          bool pooled = false)
+        : pooled_(pooled) {
         mmap_descriptor_ = descriptor;
     }
 
+    ~ThreadSafeChunkVector() override {
+        release_chunks();
+    }
+
     void
     emplace_to_at_least(int64_t chunk_num, int64_t chunk_size) override {
         std::unique_lock<std::shared_mutex> lck(this->mutex_);
@@ -86,6 +97,13 @@ class ThreadSafeChunkVector : public ChunkVectorBase<Type> {
         while (vec_.size() < chunk_num) {
             if constexpr (IsMmap) {
                 vec_.emplace_back(chunk_size, mmap_descriptor_);
+            } else if constexpr (kPoolable) {
+                if (pooled_) {
+                    vec_.emplace_back(
+                        GrowingChunkPool<Type>::Instance().Acquire(chunk_size));
+                } else {
+                    vec_.emplace_back(chunk_size);
+                }
             } else {
                 vec_.emplace_back(chunk_size);
             }
@@ -100,21 +118,26 @@ class ThreadSafeChunkVector : public ChunkVectorBase<Type> {
         const Type* data,
         int64_t length,
         const std::optional<CheckDataValid>& check_data_valid) override {
-        std::unique_lock<std::shared_mutex> lck(mutex_);
-        const auto counter = this->counter_.load();
-        AssertInfo(chunk_id < counter,
-                   fmt::format("index out of range, index={}, counter_={}",
-                               chunk_id,
-                               counter));
         if constexpr (!IsMmap || !IsVariableType<Type>) {
-            auto ptr = (Type*)vec_[chunk_id].data();
-            AssertInfo(
-                offset + length <= vec_[chunk_id].size(),
-                fmt::format(
-                    "index out of chunk range, offset={}, length={}, size={}",
-                    offset,
-                    length,
-                    vec_[chunk_id].size()));
+            Type* ptr = nullptr;
+            {
+                // chunks never move once emplaced, and concurrent writers
+                // fill disjoint ranges, so the copy itself runs unlocked
+                std::shared_lock<std::shared_mutex> lck(mutex_);
+                const auto counter = this->counter_.load();
+                AssertInfo(
+                    chunk_id < counter,
+                    fmt::format("index out of range, index={}, counter_={}",
+                                chunk_id,
+                                counter));
+                ptr = (Type*)vec_[chunk_id].data();
+                AssertInfo(offset + length <= vec_[chunk_id].size(),
+                           fmt::format("index out of chunk range, offset={}, "
+                                       "length={}, size={}",
+                                       offset,
+                                       length,
+                                       vec_[chunk_id].size()));
+            }
             if constexpr (std::is_trivially_copyable_v<Type>) {
                 milvus::fastmem::FastMemcpy(
                     ptr + offset, data, length * sizeof(Type));
@@ -122,6 +145,12 @@ class ThreadSafeChunkVector : public ChunkVectorBase<Type> {
                 std::copy_n(data, length, ptr + offset);
             }
         } else {
+            std::unique_lock<std::shared_mutex> lck(mutex_);
+            const auto counter = this->counter_.load();
+            AssertInfo(chunk_id < counter,
+                       fmt::format("index out of range, index={}, counter_={}",
+                                   chunk_id,
+                                   counter));
             vec_[chunk_id].set(data, offset, length, check_data_valid);
         }
     }
@@ -181,6 +210,7 @@ class ThreadSafeChunkVector : public ChunkVectorBase<Type> {
 
     void
     clear() override {
+        release_chunks();
         std::unique_lock<std::shared_mutex> lck(mutex_);
         this->counter_ = 0;
         vec_.clear();
@@ -225,24 +255,44 @@ class ThreadSafeChunkVector : public ChunkVectorBase<Type> {
     }
 
  private:
+    // hands the chunks to GrowingChunkPool, leaving them empty
+    void
+    release_chunks() {
+        if constexpr (kPoolable) {
+            if (!pooled_) {
+                return;
+            }
+            std::unique_lock<std::shared_mutex> lck(mutex_);
+            auto& pool = GrowingChunkPool<Type>::Instance();
+            for (auto& chunk : vec_) {
+                pool.Release(std::move(chunk));
+            }
+        }
+    }
+
     mutable std::shared_mutex mutex_;
     storage::MmapChunkDescriptorPtr mmap_descriptor_ = nullptr;
     std::deque<ChunkImpl> vec_;
+    const bool pooled_;
 };
 
 template <typename Type>
 ChunkVectorPtr<Type>
-SelectChunkVectorPtr(storage::MmapChunkDescriptorPtr& mmap_descriptor) {
+SelectChunkVectorPtr(storage::MmapChunkDescriptorPtr& mmap_descriptor,
+                     bool pooled = false) {
     if constexpr (!IsVariableType<Type>) {
         if (mmap_descriptor != nullptr) {
             return std::make_unique<
                 ThreadSafeChunkVector<Type, FixedLengthChunk<Type>, true>>(
                 mmap_descriptor);
         } else {
-            return std::make_unique<ThreadSafeChunkVector<Type>>();
+            return std::make_unique<ThreadSafeChunkVector<Type>>(nullptr,
+                                                                 pooled);
         }
     } else if constexpr (IsVariableTypeSupportInChunk<Type>) {
-        if (mmap_descriptor != nullptr) {
+        // a Json row is a view either way, so in memory the documents go to
+        // the arena of the chunk instead of a padded string each
+        if (mmap_descriptor != nullptr || std::is_same_v<Type, Json>) {
             return std::make_unique<
                 ThreadSafeChunkVector<Type, VariableLengthChunk<Type>, true>>(
                 mmap_descriptor);
@@ -32,10 +32,13 @@
 #include "cachinglayer/Utils.h"
 #include "common/Array.h"
 #include "common/Chunk.h"
+#include "common/Common.h"
 #include "common/EasyAssert.h"
 #include "common/FastMem.h"
 #include "common/FieldMeta.h"
+#include "common/PinCache.h"
 #include "common/Span.h"
+#include "common/Tracepoint.h"
 #include "segcore/storagev1translator/ChunkTranslator.h"
 #include "cachinglayer/Translator.h"
 #include "mmap/ChunkedColumnInterface.h"
@@ -143,7 +146,7 @@ class ChunkedColumnBase : public ChunkedColumnInterface {
 
     PinWrapper<const char*>
     DataOfChunk(milvus::OpContext* op_ctx, int chunk_id) const override {
-        auto ca = SemiInlineGet(slot_->PinCells(op_ctx, {chunk_id}));
+        auto ca = PinChunks(op_ctx, {chunk_id});
         auto chunk = ca->get_cell_of(chunk_id);
         return PinWrapper<const char*>(std::move(ca), chunk->Data());
     }
@@ -154,8 +157,7 @@ class ChunkedColumnBase : public ChunkedColumnInterface {
             return true;
         }
         auto [chunk_id, offset_in_chunk] = GetChunkIDByOffset(offset);
-        auto ca = SemiInlineGet(
-            slot_->PinCells(op_ctx, {static_cast<cid_t>(chunk_id)}));
+        auto ca = PinChunks(op_ctx, {static_cast<cid_t>(chunk_id)});
         auto chunk = ca->get_cell_of(chunk_id);
         return chunk->isValid(offset_in_chunk);
     }
@@ -178,7 +180,7 @@ class ChunkedColumnBase : public ChunkedColumnInterface {
         }
         // nullable:
         if (offsets == nullptr) {
-            auto ca = SemiInlineGet(slot_->PinAllCells(op_ctx));
+            auto ca = PinAllChunks(op_ctx);
             for (int64_t i = 0; i < num_rows_; i++) {
                 auto [cid, offset_in_chunk] = GetChunkIDByOffset(i);
                 auto chunk = ca->get_cell_of(cid);
@@ -187,7 +189,7 @@ class ChunkedColumnBase : public ChunkedColumnInterface {
             }
         } else {
             auto [cids, offsets_in_chunk] = ToChunkIdAndOffset(offsets, count);
-            auto ca = SemiInlineGet(slot_->PinCells(op_ctx, cids));
+            auto ca = PinChunks(op_ctx, cids);
             for (int64_t i = 0; i < count; i++) {
                 auto chunk = ca->get_cell_of(cids[i]);
                 auto valid = chunk->isValid(offsets_in_chunk[i]);
@@ -231,7 +233,13 @@ class ChunkedColumnBase : public ChunkedColumnInterface {
     void
     PrefetchChunks(milvus::OpContext* op_ctx,
                    const std::vector<int64_t>& chunk_ids) const override {
-        SemiInlineGet(slot_->PinCells(op_ctx, chunk_ids));
+        auto ca = PinChunks(op_ctx, chunk_ids);
+        if (ENABLE_MMAP_ACCESS_ADVICE.load()) {
+            // start reading mmapped chunks before they are scanned
+            for (auto chunk_id : chunk_ids) {
+                ca->get_cell_of(chunk_id)->Advise(MADV_WILLNEED);
+            }
+        }
     }
 
     PinWrapper<SpanBase>
@@ -348,14 +356,14 @@ class ChunkedColumnBase : public ChunkedColumnInterface {
 
     PinWrapper<Chunk*>
     GetChunk(milvus::OpContext* op_ctx, int64_t chunk_id) const override {
-        auto ca = SemiInlineGet(slot_->PinCells(op_ctx, {chunk_id}));
+        auto ca = PinChunks(op_ctx, {chunk_id});
         auto chunk = ca->get_cell_of(chunk_id);
         return PinWrapper<Chunk*>(std::move(ca), chunk);
     }
 
     std::vector<PinWrapper<Chunk*>>
     GetAllChunks(milvus::OpContext* op_ctx) const override {
-        auto ca = SemiInlineGet(slot_->PinAllCells(op_ctx));
+        auto ca = PinAllChunks(op_ctx);
         std::vector<PinWrapper<Chunk*>> ret;
         ret.reserve(num_chunks_);
         for (size_t i = 0; i < num_chunks_; i++) {
@@ -378,6 +386,67 @@ class ChunkedColumnBase : public ChunkedColumnInterface {
     }
 
  protected:
+    // Pins every chunk `offsets` touch in one call and invokes
+    // fn(chunk, offset_in_chunk, i) chunk by chunk, i being the position in
+    // `offsets`, see GroupOffsetsByChunk().
+    template <typename Fn>
+    void
+    ForEachOffsetByChunk(milvus::OpContext* op_ctx,
+                         const int64_t* offsets,
+                         int64_t count,
+                         Fn&& fn) const {
+        auto grouped = GroupOffsetsByChunk(offsets, count);
+        auto ca = PinChunks(op_ctx, grouped.cids);
+        for (size_t c = 0; c < grouped.cids.size(); c++) {
+            auto chunk = ca->get_cell_of(grouped.cids[c]);
+            for (auto k = grouped.chunk_begin[c];
+                 k < grouped.chunk_begin[c + 1];
+                 k++) {
+                auto i = grouped.order[k];
+                fn(chunk, grouped.offsets_in_chunk[i], i);
+            }
+        }
+    }
+
+    // pins `cids` between the cache_pin_start and cache_pin_end probes,
+    // reusing the pins the PinCache of the query holds
+    std::shared_ptr<CellAccessor<Chunk>>
+    PinChunks(milvus::OpContext* op_ctx, const std::vector<cid_t>& cids) const {
+        auto pin_cache = PinCache::Of(op_ctx);
+        if (pin_cache != nullptr) {
+            if (auto ca = pin_cache->Find<CellAccessor<Chunk>>(slot_.get(),
+                                                               cids)) {
+                return ca;
+            }
+        }
+        MILVUS_TRACEPOINT(cache_pin_start, this, cids.size());
+        auto ca = SemiInlineGet(slot_->PinCells(op_ctx, cids));
+        MILVUS_TRACEPOINT(cache_pin_end, this, cids.size());
+        if (pin_cache != nullptr) {
+            pin_cache->Insert(slot_.get(), cids, ca);
+        }
+        return ca;
+    }
+
+    std::shared_ptr<CellAccessor<Chunk>>
+    PinAllChunks(milvus::OpContext* op_ctx) const {
+        const std::vector<int64_t> all_cells{PinCache::kAllCells};
+        auto pin_cache = PinCache::Of(op_ctx);
+        if (pin_cache != nullptr) {
+            if (auto ca = pin_cache->Find<CellAccessor<Chunk>>(slot_.get(),
+                                                               all_cells)) {
+                return ca;
+            }
+        }
+        MILVUS_TRACEPOINT(cache_pin_start, this, num_chunks_);
+        auto ca = SemiInlineGet(slot_->PinAllCells(op_ctx));
+        MILVUS_TRACEPOINT(cache_pin_end, this, num_chunks_);
+        if (pin_cache != nullptr) {
+            pin_cache->Insert(slot_.get(), all_cells, ca);
+        }
+        return ca;
+    }
+
     bool nullable_{false};
     DataType data_type_{DataType::NONE};
     size_t num_rows_{0};
@@ -399,7 +468,7 @@ class ChunkedColumn : public ChunkedColumnBase {
                 const int64_t* offsets,
                 int64_t count) override {
         auto [cids, offsets_in_chunk] = ToChunkIdAndOffset(offsets, count);
-        auto ca = SemiInlineGet(slot_->PinCells(op_ctx, cids));
+        auto ca = PinChunks(op_ctx, cids);
         for (int64_t i = 0; i < count; i++) {
             auto chunk = ca->get_cell_of(cids[i]);
             auto offset = offsets_in_chunk[i];
@@ -417,15 +486,32 @@ class ChunkedColumn : public ChunkedColumnBase {
                              const int64_t* offsets,
                              int64_t count) {
         static_assert(std::is_fundamental_v<S> && std::is_fundamental_v<T>);
-        auto [cids, offsets_in_chunk] = ToChunkIdAndOffset(offsets, count);
-        auto ca = SemiInlineGet(slot_->PinCells(op_ctx, cids));
         auto typed_dst = static_cast<T*>(dst);
-        for (int64_t i = 0; i < count; i++) {
-            auto chunk = ca->get_cell_of(cids[i]);
-            auto value = chunk->ValueAt(offsets_in_chunk[i]);
-            typed_dst[i] =
-                *static_cast<const S*>(static_cast<const void*>(value));
-        }
+        // rows come chunk by chunk, the values of a chunk are looked up once
+        // instead of a virtual ValueAt() per row
+        const FixedWidthChunk* last = nullptr;
+        const S* values = nullptr;
+        ForEachOffsetByChunk(
+            op_ctx,
+            offsets,
+            count,
+            [&](Chunk* chunk, int64_t offset_in_chunk, int64_t i) {
+                if (chunk != last) {
+                    last = static_cast<const FixedWidthChunk*>(chunk);
+                    values = nullptr;
+                    if (!(IsPackableInt<S> && last->IsPacked())) {
+                        values = reinterpret_cast<const S*>(last->Data());
+                    }
+                }
+                if constexpr (IsPackableInt<S>) {
+                    if (values == nullptr) {
+                        typed_dst[i] = static_cast<T>(
+                            last->PackedValueAt(offset_in_chunk));
+                        return;
+                    }
+                }
+                typed_dst[i] = values[offset_in_chunk];
+            });
     }
 
     void
@@ -501,28 +587,63 @@ class ChunkedColumn : public ChunkedColumnBase {
                       const int64_t* offsets,
                       int64_t element_sizeof,
                       int64_t count) override {
-        auto [cids, offsets_in_chunk] = ToChunkIdAndOffset(offsets, count);
-        auto ca = SemiInlineGet(slot_->PinCells(op_ctx, cids));
         auto dst_vec = reinterpret_cast<char*>(dst);
-        for (int64_t i = 0; i < count; i++) {
-            auto chunk = ca->get_cell_of(cids[i]);
-            auto offset = offsets_in_chunk[i];
-            if (nullable_) {
-                offset = chunk->PhysicalOffsetOf(offset);
-            }
-            auto value = chunk->ValueAt(offset);
-            milvus::fastmem::FastMemcpy(
-                dst_vec + i * element_sizeof, value, element_sizeof);
-        }
+        ForEachOffsetByChunk(
+            op_ctx,
+            offsets,
+            count,
+            [&](Chunk* chunk, int64_t offset, int64_t i) {
+                if (nullable_) {
+                    offset = chunk->PhysicalOffsetOf(offset);
+                }
+                auto value = chunk->ValueAt(offset);
+                milvus::fastmem::FastMemcpy(
+                    dst_vec + i * element_sizeof, value, element_sizeof);
+            });
     }
 
     PinWrapper<SpanBase>
     Span(milvus::OpContext* op_ctx, int64_t chunk_id) const override {
-        auto ca = SemiInlineGet(slot_->PinCells(op_ctx, {chunk_id}));
+        auto ca = PinChunks(op_ctx, {chunk_id});
         auto chunk = ca->get_cell_of(chunk_id);
         return PinWrapper<SpanBase>(
             std::move(ca), static_cast<FixedWidthChunk*>(chunk)->Span());
     }
+
+    PinWrapper<ChunkSpans>
+    SpansInRange(milvus::OpContext* op_ctx,
+                 int64_t begin,
+                 int64_t count) const override {
+        return PinSpans(op_ctx, SplitRowsByChunk(nullptr, begin, count));
+    }
+
+    PinWrapper<ChunkSpans>
+    SpansByOffsets(milvus::OpContext* op_ctx,
+                   const int64_t* offsets,
+                   int64_t count) const override {
+        return PinSpans(op_ctx, SplitRowsByChunk(offsets, 0, count));
+    }
+
+ private:
+    // pins the chunks of `spans` in one call and fills in their spans
+    PinWrapper<ChunkSpans>
+    PinSpans(milvus::OpContext* op_ctx, ChunkSpans spans) const {
+        if (spans.empty()) {
+            return PinWrapper<ChunkSpans>(std::move(spans));
+        }
+        std::vector<cid_t> cids;
+        cids.reserve(spans.size());
+        for (const auto& span : spans) {
+            cids.push_back(span.chunk_id);
+        }
+        auto ca = PinChunks(op_ctx, cids);
+        for (auto& span : spans) {
+            span.span =
+                static_cast<FixedWidthChunk*>(ca->get_cell_of(span.chunk_id))
+                    ->Span();
+        }
+        return PinWrapper<ChunkSpans>(std::move(ca), std::move(spans));
+    }
 };
 
 template <typename T>
@@ -542,7 +663,7 @@ class ChunkedVariableColumn : public ChunkedColumnBase {
                 int64_t chunk_id,
                 std::optional<std::pair<int64_t, int64_t>> offset_len =
                     std::nullopt) const override {
-        auto ca = SemiInlineGet(slot_->PinCells(op_ctx, {chunk_id}));
+        auto ca = PinChunks(op_ctx, {chunk_id});
         auto chunk = ca->get_cell_of(chunk_id);
         return PinWrapper<
             std::pair<std::vector<std::string_view>, FixedVector<bool>>>(
@@ -554,7 +675,7 @@ class ChunkedVariableColumn : public ChunkedColumnBase {
     StringViewsByOffsets(milvus::OpContext* op_ctx,
                          int64_t chunk_id,
                          const FixedVector<int32_t>& offsets) const override {
-        auto ca = SemiInlineGet(slot_->PinCells(op_ctx, {chunk_id}));
+        auto ca = PinChunks(op_ctx, {chunk_id});
         auto chunk = ca->get_cell_of(chunk_id);
         return PinWrapper<
             std::pair<std::vector<std::string_view>, FixedVector<bool>>>(
@@ -573,7 +694,7 @@ class ChunkedVariableColumn : public ChunkedColumnBase {
                       "ChunkedVariableColumn<std::string>");
         }
         if (offsets == nullptr) {
-            auto ca = SemiInlineGet(slot_->PinAllCells(op_ctx));
+            auto ca = PinAllChunks(op_ctx);
             for (int64_t i = 0; i < num_rows_; i++) {
                 auto [cid, offset_in_chunk] = GetChunkIDByOffset(i);
                 auto chunk = ca->get_cell_of(cid);
@@ -584,17 +705,18 @@ class ChunkedVariableColumn : public ChunkedColumnBase {
                    valid);
             }
         } else {
-            auto [cids, offsets_in_chunk] = ToChunkIdAndOffset(offsets, count);
-            auto ca = SemiInlineGet(slot_->PinCells(op_ctx, cids));
-            for (int64_t i = 0; i < count; i++) {
-                auto chunk = ca->get_cell_of(cids[i]);
-                auto valid =
-                    nullable_ ? chunk->isValid(offsets_in_chunk[i]) : true;
-                fn(static_cast<StringChunk*>(chunk)->operator[](
-                       offsets_in_chunk[i]),
-                   i,
-                   valid);
-            }
+            ForEachOffsetByChunk(
+                op_ctx,
+                offsets,
+                count,
+                [&](Chunk* chunk, int64_t offset_in_chunk, int64_t i) {
+                    auto valid =
+                        nullable_ ? chunk->isValid(offset_in_chunk) : true;
+                    fn(static_cast<StringChunk*>(chunk)->operator[](
+                           offset_in_chunk),
+                       i,
+                       valid);
+                });
         }
     }
 
@@ -611,15 +733,16 @@ class ChunkedVariableColumn : public ChunkedColumnBase {
         if (count == 0) {
             return;
         }
-        auto [cids, offsets_in_chunk] = ToChunkIdAndOffset(offsets, count);
-        auto ca = SemiInlineGet(slot_->PinCells(op_ctx, cids));
-        for (int64_t i = 0; i < count; i++) {
-            auto chunk = ca->get_cell_of(cids[i]);
-            auto valid = nullable_ ? chunk->isValid(offsets_in_chunk[i]) : true;
-            auto str_view = static_cast<StringChunk*>(chunk)->operator[](
-                offsets_in_chunk[i]);
-            fn(Json(str_view.data(), str_view.size()), i, valid);
-        }
+        ForEachOffsetByChunk(
+            op_ctx,
+            offsets,
+            count,
+            [&](Chunk* chunk, int64_t offset_in_chunk, int64_t i) {
+                auto valid = nullable_ ? chunk->isValid(offset_in_chunk) : true;
+                auto str_view = static_cast<StringChunk*>(chunk)->operator[](
+                    offset_in_chunk);
+                fn(Json(str_view.data(), str_view.size()), i, valid);
+            });
     }
 
     void
@@ -635,7 +758,7 @@ class ChunkedVariableColumn : public ChunkedColumnBase {
                    "row_offsets and value_offsets must be provided");
 
         auto [cids, offsets_in_chunk] = ToChunkIdAndOffset(row_offsets, count);
-        auto ca = SemiInlineGet(slot_->PinCells(op_ctx, cids));
+        auto ca = PinChunks(op_ctx, cids);
         for (int64_t i = 0; i < count; i++) {
             auto chunk = ca->get_cell_of(cids[i]);
             auto str_view = static_cast<StringChunk*>(chunk)->operator[](
@@ -660,13 +783,13 @@ class ChunkedArrayColumn : public ChunkedColumnBase {
                 std::function<void(const ArrayView&, size_t)> fn,
                 const int64_t* offsets,
                 int64_t count) const override {
-        auto [cids, offsets_in_chunk] = ToChunkIdAndOffset(offsets, count);
-        auto ca = SemiInlineGet(slot_->PinCells(op_ctx, cids));
-        for (int64_t i = 0; i < count; i++) {
-            auto view = static_cast<ArrayChunk*>(ca->get_cell_of(cids[i]))
-                            ->View(offsets_in_chunk[i]);
-            fn(view, i);
-        }
+        ForEachOffsetByChunk(
+            op_ctx,
+            offsets,
+            count,
+            [&](Chunk* chunk, int64_t offset_in_chunk, int64_t i) {
+                fn(static_cast<ArrayChunk*>(chunk)->View(offset_in_chunk), i);
+            });
     }
 
     PinWrapper<std::pair<std::vector<ArrayView>, FixedVector<bool>>>
@@ -674,8 +797,7 @@ class ChunkedArrayColumn : public ChunkedColumnBase {
                int64_t chunk_id,
                std::optional<std::pair<int64_t, int64_t>> offset_len =
                    std::nullopt) const override {
-        auto ca = SemiInlineGet(
-            slot_->PinCells(op_ctx, {static_cast<cid_t>(chunk_id)}));
+        auto ca = PinChunks(op_ctx, {static_cast<cid_t>(chunk_id)});
         auto chunk = ca->get_cell_of(chunk_id);
         return PinWrapper<std::pair<std::vector<ArrayView>, FixedVector<bool>>>(
             std::move(ca), static_cast<ArrayChunk*>(chunk)->Views(offset_len));
@@ -685,7 +807,7 @@ class ChunkedArrayColumn : public ChunkedColumnBase {
     ArrayViewsByOffsets(milvus::OpContext* op_ctx,
                         int64_t chunk_id,
                         const FixedVector<int32_t>& offsets) const override {
-        auto ca = SemiInlineGet(slot_->PinCells(op_ctx, {chunk_id}));
+        auto ca = PinChunks(op_ctx, {chunk_id});
         auto chunk = ca->get_cell_of(chunk_id);
         return PinWrapper<std::pair<std::vector<ArrayView>, FixedVector<bool>>>(
             std::move(ca),
@@ -705,15 +827,16 @@ class ChunkedVectorArrayColumn : public ChunkedColumnBase {
                       std::function<void(VectorFieldProto&&, size_t)> fn,
                       const int64_t* offsets,
                       int64_t count) const override {
-        auto [cids, offsets_in_chunk] = ToChunkIdAndOffset(offsets, count);
-        auto ca = SemiInlineGet(slot_->PinCells(op_ctx, cids));
-        for (int64_t i = 0; i < count; i++) {
-            auto chunk =
-                static_cast<VectorArrayChunk*>(ca->get_cell_of(cids[i]));
-            auto offset = offsets_in_chunk[i];
-            auto array = chunk->View(offset).output_data();
-            fn(std::move(array), i);
-        }
+        ForEachOffsetByChunk(
+            op_ctx,
+            offsets,
+            count,
+            [&](Chunk* chunk, int64_t offset_in_chunk, int64_t i) {
+                auto array = static_cast<VectorArrayChunk*>(chunk)
+                                 ->View(offset_in_chunk)
+                                 .output_data();
+                fn(std::move(array), i);
+            });
     }
 
     PinWrapper<std::pair<std::vector<VectorArrayView>, FixedVector<bool>>>
@@ -721,8 +844,7 @@ class ChunkedVectorArrayColumn : public ChunkedColumnBase {
                      int64_t chunk_id,
                      std::optional<std::pair<int64_t, int64_t>> offset_len =
                          std::nullopt) const override {
-        auto ca = SemiInlineGet(
-            slot_->PinCells(op_ctx, {static_cast<cid_t>(chunk_id)}));
+        auto ca = PinChunks(op_ctx, {static_cast<cid_t>(chunk_id)});
         auto chunk = ca->get_cell_of(chunk_id);
         return PinWrapper<
             std::pair<std::vector<VectorArrayView>, FixedVector<bool>>>(
@@ -733,8 +855,7 @@ class ChunkedVectorArrayColumn : public ChunkedColumnBase {
     PinWrapper<const size_t*>
     VectorArrayOffsets(milvus::OpContext* op_ctx,
                        int64_t chunk_id) const override {
-        auto ca = SemiInlineGet(
-            slot_->PinCells(op_ctx, {static_cast<cid_t>(chunk_id)}));
+        auto ca = PinChunks(op_ctx, {static_cast<cid_t>(chunk_id)});
         auto chunk = ca->get_cell_of(chunk_id);
         return PinWrapper<const size_t*>(
             std::move(ca), static_cast<VectorArrayChunk*>(chunk)->Offsets());
@@ -30,10 +30,12 @@
 #include "cachinglayer/Utils.h"
 
 #include "common/Chunk.h"
+#include "common/Common.h"
 #include "common/GroupChunk.h"
 #include "common/EasyAssert.h"
 #include "common/FastMem.h"
 #include "common/OpContext.h"
+#include "common/PinCache.h"
 #include "common/Span.h"
 #include "mmap/ChunkedColumnInterface.h"
 #include "segcore/storagev2translator/GroupCTMeta.h"
@@ -80,7 +82,7 @@ class ChunkedColumnGroup {
             chunk_id >= 0 && chunk_id < num_chunks_,
             "[StorageV2] chunk_id out of range: " + std::to_string(chunk_id) +
                 ", num_chunks: " + std::to_string(num_chunks_));
-        auto ca = SemiInlineGet(slot_->PinCells(op_ctx, {chunk_id}));
+        auto ca = PinGroupChunks(op_ctx, {chunk_id});
         auto chunk = ca->get_cell_of(chunk_id);
         return PinWrapper<GroupChunk*>(std::move(ca), chunk);
     }
@@ -94,12 +96,12 @@ class ChunkedColumnGroup {
                            std::to_string(chunk_id) +
                            ", num_chunks: " + std::to_string(num_chunks_));
         }
-        return SemiInlineGet(slot_->PinCells(op_ctx, chunk_ids));
+        return PinGroupChunks(op_ctx, chunk_ids);
     }
 
     std::vector<PinWrapper<GroupChunk*>>
     GetAllGroupChunks(milvus::OpContext* op_ctx) {
-        auto ca = SemiInlineGet(slot_->PinAllCells(op_ctx));
+        auto ca = PinGroupChunks(op_ctx, {PinCache::kAllCells});
         std::vector<PinWrapper<GroupChunk*>> ret;
         ret.reserve(num_chunks_);
         for (size_t i = 0; i < num_chunks_; i++) {
@@ -186,6 +188,27 @@ class ChunkedColumnGroup {
     }
 
  protected:
+    // pins `chunk_ids`, or every chunk for {PinCache::kAllCells}, reusing
+    // the pins the PinCache of the query holds
+    std::shared_ptr<CellAccessor<GroupChunk>>
+    PinGroupChunks(milvus::OpContext* op_ctx,
+                   const std::vector<int64_t>& chunk_ids) const {
+        auto pin_cache = PinCache::Of(op_ctx);
+        if (pin_cache != nullptr) {
+            if (auto ca = pin_cache->Find<CellAccessor<GroupChunk>>(
+                    slot_.get(), chunk_ids)) {
+                return ca;
+            }
+        }
+        auto ca = chunk_ids.size() == 1 && chunk_ids[0] == PinCache::kAllCells
+                      ? SemiInlineGet(slot_->PinAllCells(op_ctx))
+                      : SemiInlineGet(slot_->PinCells(op_ctx, chunk_ids));
+        if (pin_cache != nullptr) {
+            pin_cache->Insert(slot_.get(), chunk_ids, ca);
+        }
+        return ca;
+    }
+
     mutable std::shared_ptr<CacheSlot<GroupChunk>> slot_;
     size_t num_chunks_{0};
     size_t num_rows_{0};
@@ -300,7 +323,14 @@ class ProxyChunkColumn : public ChunkedColumnInterface {
     void
     PrefetchChunks(milvus::OpContext* op_ctx,
                    const std::vector<int64_t>& chunk_ids) const override {
-        group_->GetGroupChunks(op_ctx, chunk_ids);
+        auto ca = group_->GetGroupChunks(op_ctx, chunk_ids);
+        if (ENABLE_MMAP_ACCESS_ADVICE.load()) {
+            // start reading mmapped chunks before they are scanned
+            for (auto chunk_id : chunk_ids) {
+                ca->get_cell_of(chunk_id)->GetChunk(field_id_)->Advise(
+                    MADV_WILLNEED);
+            }
+        }
     }
 
     PinWrapper<SpanBase>
@@ -316,6 +346,20 @@ class ProxyChunkColumn : public ChunkedColumnInterface {
             static_cast<FixedWidthChunk*>(chunk.get())->Span());
     }
 
+    PinWrapper<ChunkSpans>
+    SpansInRange(milvus::OpContext* op_ctx,
+                 int64_t begin,
+                 int64_t count) const override {
+        return PinSpans(op_ctx, SplitRowsByChunk(nullptr, begin, count));
+    }
+
+    PinWrapper<ChunkSpans>
+    SpansByOffsets(milvus::OpContext* op_ctx,
+                   const int64_t* offsets,
+                   int64_t count) const override {
+        return PinSpans(op_ctx, SplitRowsByChunk(offsets, 0, count));
+    }
+
     PinWrapper<std::pair<std::vector<std::string_view>, FixedVector<bool>>>
     StringViews(milvus::OpContext* op_ctx,
                 int64_t chunk_id,
@@ -477,16 +521,22 @@ class ProxyChunkColumn : public ChunkedColumnInterface {
                              const int64_t* offsets,
                              int64_t count) {
         static_assert(std::is_fundamental_v<S> && std::is_fundamental_v<T>);
-        auto [cids, offsets_in_chunk] = ToChunkIdAndOffset(offsets, count);
-        auto ca = group_->GetGroupChunks(op_ctx, cids);
         auto typed_dst = static_cast<T*>(dst);
-        for (int64_t i = 0; i < count; i++) {
-            auto* group_chunk = ca->get_cell_of(cids[i]);
-            auto chunk = group_chunk->GetChunk(field_id_);
-            auto value = chunk->ValueAt(offsets_in_chunk[i]);
-            typed_dst[i] =
-                *static_cast<const S*>(static_cast<const void*>(value));
-        }
+        // rows come chunk by chunk, the values of a chunk are looked up once
+        // instead of a virtual ValueAt() per row
+        const Chunk* last = nullptr;
+        const S* values = nullptr;
+        ForEachOffsetByChunk(
+            op_ctx,
+            offsets,
+            count,
+            [&](Chunk* chunk, int64_t offset_in_chunk, int64_t i) {
+                if (chunk != last) {
+                    last = chunk;
+                    values = reinterpret_cast<const S*>(chunk->Data());
+                }
+                typed_dst[i] = values[offset_in_chunk];
+            });
     }
 
     void
@@ -562,20 +612,20 @@ class ProxyChunkColumn : public ChunkedColumnInterface {
                       const int64_t* offsets,
                       int64_t element_sizeof,
                       int64_t count) override {
-        auto [cids, offsets_in_chunk] = ToChunkIdAndOffset(offsets, count);
-        auto ca = group_->GetGroupChunks(op_ctx, cids);
         auto dst_vec = reinterpret_cast<char*>(dst);
-        for (int64_t i = 0; i < count; i++) {
-            auto* group_chunk = ca->get_cell_of(cids[i]);
-            auto chunk = group_chunk->GetChunk(field_id_);
-            auto offset = offsets_in_chunk[i];
-            if (field_meta_.is_nullable()) {
-                offset = chunk->PhysicalOffsetOf(offset);
-            }
-            auto value = chunk->ValueAt(offset);
-            milvus::fastmem::FastMemcpy(
-                dst_vec + i * element_sizeof, value, element_sizeof);
-        }
+        auto nullable = field_meta_.is_nullable();
+        ForEachOffsetByChunk(
+            op_ctx,
+            offsets,
+            count,
+            [&](Chunk* chunk, int64_t offset, int64_t i) {
+                if (nullable) {
+                    offset = chunk->PhysicalOffsetOf(offset);
+                }
+                auto value = chunk->ValueAt(offset);
+                milvus::fastmem::FastMemcpy(
+                    dst_vec + i * element_sizeof, value, element_sizeof);
+            });
     }
 
     void
@@ -605,17 +655,16 @@ class ProxyChunkColumn : public ChunkedColumnInterface {
                 current_offset += chunk_rows;
             }
         } else {
-            auto [cids, offsets_in_chunk] = ToChunkIdAndOffset(offsets, count);
-            auto ca = group_->GetGroupChunks(op_ctx, cids);
-            for (int64_t i = 0; i < count; i++) {
-                auto* group_chunk = ca->get_cell_of(cids[i]);
-                auto chunk = group_chunk->GetChunk(field_id_);
-                auto valid = chunk->isValid(offsets_in_chunk[i]);
-                auto value = static_cast<StringChunk*>(chunk.get())
-                                 ->
-                                 operator[](offsets_in_chunk[i]);
-                fn(value, i, valid);
-            }
+            ForEachOffsetByChunk(
+                op_ctx,
+                offsets,
+                count,
+                [&](Chunk* chunk, int64_t offset_in_chunk, int64_t i) {
+                    auto valid = chunk->isValid(offset_in_chunk);
+                    auto value = static_cast<StringChunk*>(chunk)->operator[](
+                        offset_in_chunk);
+                    fn(value, i, valid);
+                });
         }
     }
 
@@ -633,18 +682,16 @@ class ProxyChunkColumn : public ChunkedColumnInterface {
         if (count == 0) {
             return;
         }
-        auto [cids, offsets_in_chunk] = ToChunkIdAndOffset(offsets, count);
-        auto ca = group_->GetGroupChunks(op_ctx, cids);
-
-        for (int64_t i = 0; i < count; i++) {
-            auto* group_chunk = ca->get_cell_of(cids[i]);
-            auto chunk = group_chunk->GetChunk(field_id_);
-            auto valid = chunk->isValid(offsets_in_chunk[i]);
-            auto str_view = static_cast<StringChunk*>(chunk.get())
-                                ->
-                                operator[](offsets_in_chunk[i]);
-            fn(Json(str_view.data(), str_view.size()), i, valid);
-        }
+        ForEachOffsetByChunk(
+            op_ctx,
+            offsets,
+            count,
+            [&](Chunk* chunk, int64_t offset_in_chunk, int64_t i) {
+                auto valid = chunk->isValid(offset_in_chunk);
+                auto str_view = static_cast<StringChunk*>(chunk)->operator[](
+                    offset_in_chunk);
+                fn(Json(str_view.data(), str_view.size()), i, valid);
+            });
     }
 
     void
@@ -689,15 +736,13 @@ class ProxyChunkColumn : public ChunkedColumnInterface {
                       "[StorageV2] BulkArrayAt only supported for "
                       "ChunkedArrayColumn");
         }
-        auto [cids, offsets_in_chunk] = ToChunkIdAndOffset(offsets, count);
-        auto ca = group_->GetGroupChunks(op_ctx, cids);
-        for (int64_t i = 0; i < count; i++) {
-            auto* group_chunk = ca->get_cell_of(cids[i]);
-            auto chunk = group_chunk->GetChunk(field_id_);
-            auto view = static_cast<ArrayChunk*>(chunk.get())
-                            ->View(offsets_in_chunk[i]);
-            fn(view, i);
-        }
+        ForEachOffsetByChunk(
+            op_ctx,
+            offsets,
+            count,
+            [&](Chunk* chunk, int64_t offset_in_chunk, int64_t i) {
+                fn(static_cast<ArrayChunk*>(chunk)->View(offset_in_chunk), i);
+            });
     }
 
     void
@@ -710,20 +755,64 @@ class ProxyChunkColumn : public ChunkedColumnInterface {
                       "[StorageV2] BulkVectorArrayAt only supported for "
                       "ChunkedVectorArrayColumn");
         }
-        auto [cids, offsets_in_chunk] = ToChunkIdAndOffset(offsets, count);
+        ForEachOffsetByChunk(
+            op_ctx,
+            offsets,
+            count,
+            [&](Chunk* chunk, int64_t offset_in_chunk, int64_t i) {
+                auto array = static_cast<VectorArrayChunk*>(chunk)
+                                 ->View(offset_in_chunk)
+                                 .output_data();
+                fn(std::move(array), i);
+            });
+    }
+
+ private:
+    // Pins every group chunk `offsets` touch in one call and invokes
+    // fn(chunk, offset_in_chunk, i) chunk by chunk, i being the position in
+    // `offsets`, see GroupOffsetsByChunk().
+    template <typename Fn>
+    void
+    ForEachOffsetByChunk(milvus::OpContext* op_ctx,
+                         const int64_t* offsets,
+                         int64_t count,
+                         Fn&& fn) const {
+        auto grouped = GroupOffsetsByChunk(offsets, count);
+        auto ca = group_->GetGroupChunks(op_ctx, grouped.cids);
+        for (size_t c = 0; c < grouped.cids.size(); c++) {
+            auto chunk = ca->get_cell_of(grouped.cids[c])->GetChunk(field_id_);
+            for (auto k = grouped.chunk_begin[c];
+                 k < grouped.chunk_begin[c + 1];
+                 k++) {
+                auto i = grouped.order[k];
+                fn(chunk.get(), grouped.offsets_in_chunk[i], i);
+            }
+        }
+    }
+
+    // pins the group chunks of `spans` in one call and fills in their spans
+    PinWrapper<ChunkSpans>
+    PinSpans(milvus::OpContext* op_ctx, ChunkSpans spans) const {
+        if (!IsChunkedColumnDataType(data_type_)) {
+            ThrowInfo(ErrorCode::Unsupported,
+                      "[StorageV2] Spans only supported for ChunkedColumn");
+        }
+        if (spans.empty()) {
+            return PinWrapper<ChunkSpans>(std::move(spans));
+        }
+        std::vector<int64_t> cids;
+        cids.reserve(spans.size());
+        for (const auto& span : spans) {
+            cids.push_back(span.chunk_id);
+        }
         auto ca = group_->GetGroupChunks(op_ctx, cids);
-        for (int64_t i = 0; i < count; i++) {
-            auto* group_chunk = ca->get_cell_of(cids[i]);
-            auto chunk = group_chunk->GetChunk(field_id_);
-            auto offset = offsets_in_chunk[i];
-            auto array = static_cast<VectorArrayChunk*>(chunk.get())
-                             ->View(offset)
-                             .output_data();
-            fn(std::move(array), i);
+        for (auto& span : spans) {
+            auto chunk = ca->get_cell_of(span.chunk_id)->GetChunk(field_id_);
+            span.span = static_cast<FixedWidthChunk*>(chunk.get())->Span();
         }
+        return PinWrapper<ChunkSpans>(std::move(ca), std::move(spans));
     }
 
- private:
     std::shared_ptr<ChunkedColumnGroup> group_;
     FieldId field_id_;
     const FieldMeta field_meta_;
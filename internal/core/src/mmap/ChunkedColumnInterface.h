@@ -15,17 +15,35 @@
 // limitations under the License.
 #pragma once
 
+#include <algorithm>
 #include <atomic>
 #include <mutex>
+#include <numeric>
+#include <vector>
 
 #include "cachinglayer/CacheSlot.h"
 #include "common/Chunk.h"
 #include "common/OffsetMapping.h"
+#include "common/Span.h"
 #include "common/bson_view.h"
 namespace milvus {
 
 using namespace milvus::cachinglayer;
 
+// The rows of one chunk in a batched span access, see
+// ChunkedColumnInterface::SpansInRange(). Positions [begin, end) of the
+// request are rows of chunk `chunk_id`, and row r of the column is at
+// span[r - rows_before].
+struct ChunkSpan {
+    int64_t chunk_id;
+    int64_t rows_before;
+    int64_t begin;
+    int64_t end;
+    SpanBase span{nullptr, 0, 0};
+};
+
+using ChunkSpans = std::vector<ChunkSpan>;
+
 class ChunkedColumnInterface {
  public:
     virtual ~ChunkedColumnInterface() = default;
@@ -89,6 +107,29 @@ class ChunkedColumnInterface {
     virtual PinWrapper<SpanBase>
     Span(milvus::OpContext* op_ctx, int64_t chunk_id) const = 0;
 
+    // Spans of the chunks holding rows [begin, begin + count), one per
+    // chunk in row order, all pinned in one call, so that a loop over a
+    // batch reads contiguous memory instead of making a virtual call per
+    // row. Only fixed width columns support it; rows of a nullable vector
+    // column are stored compactly, see Chunk::PhysicalOffsetOf().
+    virtual PinWrapper<ChunkSpans>
+    SpansInRange(milvus::OpContext* op_ctx,
+                 int64_t begin,
+                 int64_t count) const {
+        ThrowInfo(ErrorCode::Unsupported,
+                  "SpansInRange only supported for fixed width columns");
+    }
+
+    // The same for `count` ascending `offsets`: positions [begin, end) of a
+    // span are the rows offsets[begin] .. offsets[end - 1].
+    virtual PinWrapper<ChunkSpans>
+    SpansByOffsets(milvus::OpContext* op_ctx,
+                   const int64_t* offsets,
+                   int64_t count) const {
+        ThrowInfo(ErrorCode::Unsupported,
+                  "SpansByOffsets only supported for fixed width columns");
+    }
+
     virtual void
     PrefetchChunks(milvus::OpContext* op_ctx,
                    const std::vector<int64_t>& chunk_ids) const = 0;
@@ -161,20 +202,18 @@ class ChunkedColumnInterface {
                    offset,
                    size,
                    chunk->RowNums());
-        auto& valid_data = chunk->Valid();
+        if (!chunk->HasNulls()) {
+            return;
+        }
+        const auto& valid_bitmap = chunk->ValidBitmap();
         AssertInfo(
-            offset + size <= static_cast<int64_t>(valid_data.size()),
+            offset + size <= static_cast<int64_t>(valid_bitmap.size()),
             "Valid-data range out of valid-data bounds, offset: {}, size: {}, "
             "valid-data size: {}",
             offset,
             size,
-            valid_data.size());
-        auto valid_data_ptr = valid_data.data() + offset;
-        for (int64_t i = 0; i < size; ++i) {
-            if (!valid_data_ptr[i]) {
-                valid_result[i] = false;
-            }
-        }
+            valid_bitmap.size());
+        valid_result.inplace_and(valid_bitmap.view(offset, size), size);
     }
 
     // Get number of rows before a specific chunk
@@ -269,6 +308,11 @@ class ChunkedColumnInterface {
                 const int64_t* offsets,
                 int64_t count) = 0;
 
+    // The Bulk*At methods below, except BulkRawBsonAt, may read `offsets`
+    // chunk by chunk rather than in input order: every chunk is pinned once,
+    // up front, and rows are copied out ascending by offset, then scattered
+    // back to their input position. Callbacks may therefore see the rows out
+    // of order and must place them by the index they are given.
     virtual void
     BulkPrimitiveValueAt(milvus::OpContext* op_ctx,
                          void* dst,
@@ -393,6 +437,87 @@ class ChunkedColumnInterface {
         return GetChunkIDsByOffsets(offsets, count);
     }
 
+    // Splits the ascending rows `offsets`, or [begin, begin + count) when
+    // `offsets` is nullptr, into runs of rows of one chunk, leaving the
+    // spans to the caller.
+    ChunkSpans
+    SplitRowsByChunk(const int64_t* offsets,
+                     int64_t begin,
+                     int64_t count) const {
+        ChunkSpans spans;
+        if (count <= 0) {
+            return spans;
+        }
+        auto row_at = [&](int64_t i) {
+            return offsets != nullptr ? offsets[i] : begin + i;
+        };
+        auto num_rows = static_cast<int64_t>(NumRows());
+        AssertInfo(row_at(0) >= 0 && row_at(count - 1) < num_rows,
+                   "rows [{}, {}] are out of range, num_rows: {}",
+                   row_at(0),
+                   row_at(count - 1),
+                   num_rows);
+        AssertInfo(offsets == nullptr || std::is_sorted(offsets,
+                                                        offsets + count),
+                   "offsets of a span access must be ascending");
+        const auto& rows_until_chunk = GetNumRowsUntilChunk();
+        for (int64_t i = 0; i < count;) {
+            auto row = row_at(i);
+            // the last chunk starting at or before `row`, skipping empty ones
+            int64_t chunk_id = std::upper_bound(rows_until_chunk.begin(),
+                                                rows_until_chunk.end(),
+                                                row) -
+                               rows_until_chunk.begin() - 1;
+            auto chunk_end = rows_until_chunk[chunk_id + 1];
+            auto end = offsets != nullptr
+                           ? std::lower_bound(
+                                 offsets + i, offsets + count, chunk_end) -
+                                 offsets
+                           : std::min(count, chunk_end - begin);
+            spans.push_back(
+                ChunkSpan{chunk_id, rows_until_chunk[chunk_id], i, end});
+            i = end;
+        }
+        return spans;
+    }
+
+    // Offsets of one bulk read grouped by chunk. cids are the distinct
+    // chunks in ascending order, and the rows of cids[c] are the input
+    // positions order[chunk_begin[c]] .. order[chunk_begin[c + 1] - 1],
+    // ascending by offset. offsets_in_chunk is indexed by input position.
+    struct OffsetsByChunk {
+        std::vector<milvus::cachinglayer::cid_t> cids;
+        std::vector<int64_t> chunk_begin;
+        std::vector<int64_t> order;
+        std::vector<int64_t> offsets_in_chunk;
+    };
+
+    OffsetsByChunk
+    GroupOffsetsByChunk(const int64_t* offsets, int64_t count) const {
+        auto [row_cids, offsets_in_chunk] = ToChunkIdAndOffset(offsets, count);
+        OffsetsByChunk grouped;
+        grouped.order.resize(count);
+        std::iota(grouped.order.begin(), grouped.order.end(), 0);
+        // offsets of a retrieve usually come sorted, search results do not
+        if (!std::is_sorted(offsets, offsets + count)) {
+            std::sort(grouped.order.begin(),
+                      grouped.order.end(),
+                      [offsets](int64_t a, int64_t b) {
+                          return offsets[a] < offsets[b];
+                      });
+        }
+        for (int64_t k = 0; k < count; k++) {
+            auto cid = row_cids[grouped.order[k]];
+            if (grouped.cids.empty() || grouped.cids.back() != cid) {
+                grouped.cids.push_back(cid);
+                grouped.chunk_begin.push_back(k);
+            }
+        }
+        grouped.chunk_begin.push_back(count);
+        grouped.offsets_in_chunk = std::move(offsets_in_chunk);
+        return grouped;
+    }
+
     std::pair<std::vector<milvus::cachinglayer::cid_t>, std::vector<uint32_t>>
     ToChunkIdAndOffset(const uint32_t* offsets, int64_t count) const {
         AssertInfo(offsets != nullptr, "Offsets cannot be nullptr");
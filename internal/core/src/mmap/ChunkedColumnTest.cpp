@@ -250,4 +250,129 @@ TEST(test_chunked_column, test_nullable_all_null) {
     }
 }
 
+TEST(test_chunked_column, test_bulk_value_at_unsorted_offsets) {
+    // rows hold their own global offset, spread over three chunks
+    std::vector<int64_t> num_rows_per_chunk = {10, 20, 30};
+    auto num_chunks = num_rows_per_chunk.size();
+    std::vector<std::vector<int64_t>> buffers(num_chunks);
+    std::vector<std::unique_ptr<Chunk>> chunks;
+    int64_t total_rows = 0;
+    for (size_t i = 0; i < num_chunks; ++i) {
+        auto row_num = num_rows_per_chunk[i];
+        for (int64_t j = 0; j < row_num; ++j) {
+            buffers[i].push_back(total_rows++);
+        }
+        auto chunk_mmap_guard =
+            std::make_shared<ChunkMmapGuard>(nullptr, 0, "");
+        auto chunk = std::make_unique<FixedWidthChunk>(
+            row_num,
+            1,
+            reinterpret_cast<char*>(buffers[i].data()),
+            buffers[i].size() * sizeof(int64_t),
+            sizeof(int64_t),
+            false,
+            chunk_mmap_guard);
+        chunks.push_back(std::move(chunk));
+    }
+    auto translator = std::make_unique<TestChunkTranslator>(
+        num_rows_per_chunk, "test_bulk_unsorted", std::move(chunks));
+    FieldMeta field_meta(
+        FieldName("test"), FieldId(1), DataType::INT64, false, std::nullopt);
+    auto slot =
+        cachinglayer::Manager::GetInstance().CreateCacheSlot<milvus::Chunk>(
+            std::move(translator), nullptr);
+    ChunkedColumn column(std::move(slot), field_meta);
+
+    // out of order, hopping between chunks, with a repeated offset
+    std::vector<int64_t> offsets = {59, 3, 25, 10, 3, 47, 0, 29, 30, 9};
+    std::vector<int64_t> values(offsets.size(), -1);
+    column.BulkPrimitiveValueAt(
+        nullptr, values.data(), offsets.data(), offsets.size());
+    EXPECT_EQ(values, offsets);
+
+    std::vector<int64_t> seen(offsets.size(), -1);
+    column.BulkValueAt(
+        nullptr,
+        [&seen](const char* value, size_t i) {
+            seen[i] = *reinterpret_cast<const int64_t*>(value);
+        },
+        offsets.data(),
+        offsets.size());
+    EXPECT_EQ(seen, offsets);
+}
+
+TEST(test_chunked_column, test_spans_by_chunk) {
+    // rows hold their own global offset, spread over three chunks
+    std::vector<int64_t> num_rows_per_chunk = {10, 20, 30};
+    auto num_chunks = num_rows_per_chunk.size();
+    std::vector<std::vector<int64_t>> buffers(num_chunks);
+    std::vector<std::unique_ptr<Chunk>> chunks;
+    int64_t total_rows = 0;
+    for (size_t i = 0; i < num_chunks; ++i) {
+        auto row_num = num_rows_per_chunk[i];
+        for (int64_t j = 0; j < row_num; ++j) {
+            buffers[i].push_back(total_rows++);
+        }
+        auto chunk_mmap_guard =
+            std::make_shared<ChunkMmapGuard>(nullptr, 0, "");
+        auto chunk = std::make_unique<FixedWidthChunk>(
+            row_num,
+            1,
+            reinterpret_cast<char*>(buffers[i].data()),
+            buffers[i].size() * sizeof(int64_t),
+            sizeof(int64_t),
+            false,
+            chunk_mmap_guard);
+        chunks.push_back(std::move(chunk));
+    }
+    auto translator = std::make_unique<TestChunkTranslator>(
+        num_rows_per_chunk, "test_spans", std::move(chunks));
+    FieldMeta field_meta(
+        FieldName("test"), FieldId(1), DataType::INT64, false, std::nullopt);
+    auto slot =
+        cachinglayer::Manager::GetInstance().CreateCacheSlot<milvus::Chunk>(
+            std::move(translator), nullptr);
+    ChunkedColumn column(std::move(slot), field_meta);
+
+    auto read = [](const ChunkSpan& span, int64_t offset) {
+        return static_cast<const int64_t*>(
+            span.span.data())[offset - span.rows_before];
+    };
+
+    // a range crossing all the chunks
+    auto pw_range = column.SpansInRange(nullptr, 5, 50);
+    const auto& range = pw_range.get();
+    ASSERT_EQ(range.size(), 3u);
+    EXPECT_EQ(range[0].chunk_id, 0);
+    EXPECT_EQ(range[0].begin, 0);
+    EXPECT_EQ(range[0].end, 5);
+    EXPECT_EQ(range[1].rows_before, 10);
+    EXPECT_EQ(range[1].end, 25);
+    EXPECT_EQ(range[2].end, 50);
+    for (const auto& span : range) {
+        for (auto i = span.begin; i < span.end; ++i) {
+            EXPECT_EQ(read(span, 5 + i), 5 + i);
+        }
+    }
+
+    // sorted offsets skipping the middle chunk, with a repeated offset
+    std::vector<int64_t> offsets = {0, 3, 3, 9, 30, 47, 59};
+    auto pw_offsets =
+        column.SpansByOffsets(nullptr, offsets.data(), offsets.size());
+    const auto& by_offsets = pw_offsets.get();
+    ASSERT_EQ(by_offsets.size(), 2u);
+    EXPECT_EQ(by_offsets[0].chunk_id, 0);
+    EXPECT_EQ(by_offsets[0].end, 4);
+    EXPECT_EQ(by_offsets[1].chunk_id, 2);
+    EXPECT_EQ(by_offsets[1].rows_before, 30);
+    EXPECT_EQ(by_offsets[1].end, static_cast<int64_t>(offsets.size()));
+    for (const auto& span : by_offsets) {
+        for (auto i = span.begin; i < span.end; ++i) {
+            EXPECT_EQ(read(span, offsets[i]), offsets[i]);
+        }
+    }
+
+    EXPECT_TRUE(column.SpansByOffsets(nullptr, nullptr, 0).get().empty());
+}
+
 }  // namespace milvus
@@ -103,6 +103,20 @@ class VirtualPKChunkedColumn : public ChunkedColumnInterface {
             SpanBase(materialized_pks_.data(), num_rows_, sizeof(int64_t)));
     }
 
+    PinWrapper<ChunkSpans>
+    SpansInRange(milvus::OpContext* op_ctx,
+                 int64_t begin,
+                 int64_t count) const override {
+        return FillSpans(SplitRowsByChunk(nullptr, begin, count));
+    }
+
+    PinWrapper<ChunkSpans>
+    SpansByOffsets(milvus::OpContext* op_ctx,
+                   const int64_t* offsets,
+                   int64_t count) const override {
+        return FillSpans(SplitRowsByChunk(offsets, 0, count));
+    }
+
     void
     PrefetchChunks(milvus::OpContext* op_ctx,
                    const std::vector<int64_t>& chunk_ids) const override {
@@ -267,6 +281,16 @@ class VirtualPKChunkedColumn : public ChunkedColumnInterface {
         return shifted_segment_id_ | (offset & 0xFFFFFFFF);
     }
 
+    PinWrapper<ChunkSpans>
+    FillSpans(ChunkSpans spans) const {
+        EnsureMaterialized();
+        for (auto& span : spans) {
+            span.span =
+                SpanBase(materialized_pks_.data(), num_rows_, sizeof(int64_t));
+        }
+        return PinWrapper<ChunkSpans>(std::move(spans));
+    }
+
     void
     EnsureMaterialized() const {
         std::call_once(materialize_once_, [this]() {
@@ -0,0 +1,54 @@
+// Copyright 2025 Zilliz
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <cstdlib>
+#include <memory>
+#include <thread>
+
+#include "monitor/jemalloc_stats_c.h"
+
+TEST(JemallocStatsTest, BindsPoolThreadsOnlyWhenEnabled) {
+    SetJemallocArenaPerPool(false);
+    EXPECT_FALSE(BindThreadToJemallocArena(JEMALLOC_ARENA_BUILD));
+    EXPECT_FALSE(GetJemallocArenaStats(JEMALLOC_ARENA_BUILD).success);
+    EXPECT_FALSE(BindThreadToJemallocArena(JEMALLOC_ARENA_POOL_NUM));
+    EXPECT_FALSE(GetJemallocArenaStats(JEMALLOC_ARENA_POOL_NUM).success);
+
+    SetJemallocArenaPerPool(true);
+    bool bound = false;
+    std::thread worker([&bound]() {
+        bound = BindThreadToJemallocArena(JEMALLOC_ARENA_BUILD);
+        auto buffer = std::make_unique<char[]>(1 << 20);
+        buffer[0] = 1;
+    });
+    worker.join();
+    SetJemallocArenaPerPool(false);
+
+    // the arena stays around, with its stats, once a pool created it
+    auto stats = GetJemallocArenaStats(JEMALLOC_ARENA_BUILD);
+    EXPECT_EQ(stats.success, bound);
+    EXPECT_EQ(stats.success, GetJemallocStats().success);
+    if (stats.success) {
+        EXPECT_GE(stats.mapped, stats.active);
+    }
+}
+
+TEST(JemallocStatsTest, HeapProfileNeedsProfiling) {
+    // nothing to dump unless jemalloc was started with prof:true
+    auto enabled = SetJemallocHeapProfileActive(false, -1);
+    if (!enabled) {
+        EXPECT_FALSE(DumpJemallocHeapProfile(nullptr));
+    }
+}
@@ -241,6 +241,91 @@ DEFINE_PROMETHEUS_HISTOGRAM_WITH_BUCKETS(internal_core_expr_filter_ratio,
                                          internal_core_search_latency,
                                          filterRatioLabels,
                                          ratioBuckets)
+
+// expression bitmaps of one query, see exec::BitmapPool
+std::map<std::string, std::string> queryBitmapAllocatedLabels{
+    {"type", "allocated"}};
+std::map<std::string, std::string> queryBitmapReusedLabels{
+    {"type", "reused"}};
+DEFINE_PROMETHEUS_HISTOGRAM_FAMILY(
+    internal_core_query_bitmap_bytes,
+    "[cpp]bytes of expression bitmaps allocated and reused by one query")
+DEFINE_PROMETHEUS_HISTOGRAM_WITH_BUCKETS(
+    internal_core_query_bitmap_bytes_allocated,
+    internal_core_query_bitmap_bytes,
+    queryBitmapAllocatedLabels,
+    bytesBuckets)
+DEFINE_PROMETHEUS_HISTOGRAM_WITH_BUCKETS(
+    internal_core_query_bitmap_bytes_reused,
+    internal_core_query_bitmap_bytes,
+    queryBitmapReusedLabels,
+    bytesBuckets)
+
+// query memory tracking, see exec::MemoryTracker
+std::map<std::string, std::string> execMemoryUsedLabels{{"type", "used"}};
+std::map<std::string, std::string> queryMemoryPeakLabels{{"type", "peak"}};
+std::map<std::string, std::string> queryMemoryAdmissionLabels{
+    {"type", "admission"}};
+std::map<std::string, std::string> queryMemoryLimitLabels{{"type", "limit"}};
+DEFINE_PROMETHEUS_GAUGE_FAMILY(internal_core_exec_memory_bytes,
+                               "[cpp]bytes held by the executing queries")
+DEFINE_PROMETHEUS_GAUGE(internal_core_exec_memory_bytes_used,
+                        internal_core_exec_memory_bytes,
+                        execMemoryUsedLabels)
+DEFINE_PROMETHEUS_HISTOGRAM_FAMILY(internal_core_query_memory_bytes,
+                                   "[cpp]bytes held by one query at its peak")
+DEFINE_PROMETHEUS_HISTOGRAM_WITH_BUCKETS(internal_core_query_memory_bytes_peak,
+                                         internal_core_query_memory_bytes,
+                                         queryMemoryPeakLabels,
+                                         bytesBuckets)
+DEFINE_PROMETHEUS_COUNTER_FAMILY(
+    internal_core_query_memory_rejected_total,
+    "[cpp]queries failed for the memory budget of the node or the query")
+DEFINE_PROMETHEUS_COUNTER(internal_core_query_memory_rejected_total_admission,
+                          internal_core_query_memory_rejected_total,
+                          queryMemoryAdmissionLabels)
+DEFINE_PROMETHEUS_COUNTER(internal_core_query_memory_rejected_total_limit,
+                          internal_core_query_memory_rejected_total,
+                          queryMemoryLimitLabels)
+
+// stages of the segcore queries, see SCOPE_SEGCORE_STAGE_METRIC
+std::map<std::string, std::string> segcoreStagePlanParseLabels{
+    {"stage", "plan_parse"}};
+std::map<std::string, std::string> segcoreStageFilterLabels{
+    {"stage", "filter"}};
+std::map<std::string, std::string> segcoreStageVectorSearchLabels{
+    {"stage", "vector_search"}};
+std::map<std::string, std::string> segcoreStageMvccLabels{{"stage", "mvcc"}};
+std::map<std::string, std::string> segcoreStageResultFillLabels{
+    {"stage", "result_fill"}};
+DEFINE_PROMETHEUS_HISTOGRAM_FAMILY(internal_core_stage_duration_seconds,
+                                   "[cpp]duration of the stages of queries")
+DEFINE_PROMETHEUS_HISTOGRAM_WITH_BUCKETS(
+    internal_core_stage_duration_seconds_plan_parse,
+    internal_core_stage_duration_seconds,
+    segcoreStagePlanParseLabels,
+    secondsBuckets)
+DEFINE_PROMETHEUS_HISTOGRAM_WITH_BUCKETS(
+    internal_core_stage_duration_seconds_filter,
+    internal_core_stage_duration_seconds,
+    segcoreStageFilterLabels,
+    secondsBuckets)
+DEFINE_PROMETHEUS_HISTOGRAM_WITH_BUCKETS(
+    internal_core_stage_duration_seconds_vector_search,
+    internal_core_stage_duration_seconds,
+    segcoreStageVectorSearchLabels,
+    secondsBuckets)
+DEFINE_PROMETHEUS_HISTOGRAM_WITH_BUCKETS(
+    internal_core_stage_duration_seconds_mvcc,
+    internal_core_stage_duration_seconds,
+    segcoreStageMvccLabels,
+    secondsBuckets)
+DEFINE_PROMETHEUS_HISTOGRAM_WITH_BUCKETS(
+    internal_core_stage_duration_seconds_result_fill,
+    internal_core_stage_duration_seconds,
+    segcoreStageResultFillLabels,
+    secondsBuckets)
+
 // mmap metrics
 std::map<std::string, std::string> mmapAllocatedSpaceAnonLabel = {
     {"type", "anon"}};
@@ -471,6 +556,177 @@ DEFINE_PROMETHEUS_HISTOGRAM_WITH_BUCKETS(
     lowPoolLabel,
     secondsBuckets);
 
+// expr result cache tier metrics
+std::map<std::string, std::string> exprCacheMemoryHitLabels{
+    {"type", "memory_hit"}};
+std::map<std::string, std::string> exprCacheDiskHitLabels{
+    {"type", "disk_hit"}};
+std::map<std::string, std::string> exprCacheMissLabels{{"type", "miss"}};
+std::map<std::string, std::string> exprCachePromoteLabels{
+    {"type", "promote"}};
+std::map<std::string, std::string> exprCacheDemoteLabels{{"type", "demote"}};
+std::map<std::string, std::string> exprCacheRangeReuseLabels{
+    {"type", "range_reuse"}};
+DEFINE_PROMETHEUS_COUNTER_FAMILY(internal_core_expr_cache,
+                                 "[cpp]expr result cache tier access count");
+DEFINE_PROMETHEUS_COUNTER(internal_core_expr_cache_memory_hit,
+                          internal_core_expr_cache,
+                          exprCacheMemoryHitLabels);
+DEFINE_PROMETHEUS_COUNTER(internal_core_expr_cache_disk_hit,
+                          internal_core_expr_cache,
+                          exprCacheDiskHitLabels);
+DEFINE_PROMETHEUS_COUNTER(internal_core_expr_cache_miss,
+                          internal_core_expr_cache,
+                          exprCacheMissLabels);
+DEFINE_PROMETHEUS_COUNTER(internal_core_expr_cache_promote,
+                          internal_core_expr_cache,
+                          exprCachePromoteLabels);
+DEFINE_PROMETHEUS_COUNTER(internal_core_expr_cache_demote,
+                          internal_core_expr_cache,
+                          exprCacheDemoteLabels);
+DEFINE_PROMETHEUS_COUNTER(internal_core_expr_cache_range_reuse,
+                          internal_core_expr_cache,
+                          exprCacheRangeReuseLabels);
+
+// search result cache metrics
+std::map<std::string, std::string> searchResultCacheHitLabels{
+    {"type", "hit"}};
+std::map<std::string, std::string> searchResultCacheMissLabels{
+    {"type", "miss"}};
+DEFINE_PROMETHEUS_COUNTER_FAMILY(internal_core_search_result_cache,
+                                 "[cpp]sealed segment search result cache");
+DEFINE_PROMETHEUS_COUNTER(internal_core_search_result_cache_hit,
+                          internal_core_search_result_cache,
+                          searchResultCacheHitLabels);
+DEFINE_PROMETHEUS_COUNTER(internal_core_search_result_cache_miss,
+                          internal_core_search_result_cache,
+                          searchResultCacheMissLabels);
+
+// diskann node cache budget metrics
+std::map<std::string, std::string> diskAnnCacheReservedLabels{
+    {"type", "reserved"}};
+std::map<std::string, std::string> diskAnnCacheFullLabels{{"type", "full"}};
+std::map<std::string, std::string> diskAnnCacheTrimmedLabels{
+    {"type", "trimmed"}};
+std::map<std::string, std::string> diskAnnCacheRejectedLabels{
+    {"type", "rejected"}};
+DEFINE_PROMETHEUS_GAUGE_FAMILY(
+    internal_core_diskann_cache_bytes,
+    "[cpp]bytes of the node wide budget held by diskann node caches");
+DEFINE_PROMETHEUS_GAUGE(internal_core_diskann_cache_bytes_reserved,
+                        internal_core_diskann_cache_bytes,
+                        diskAnnCacheReservedLabels);
+DEFINE_PROMETHEUS_COUNTER_FAMILY(
+    internal_core_diskann_cache_admission,
+    "[cpp]diskann node caches admitted under the node wide budget");
+DEFINE_PROMETHEUS_COUNTER(internal_core_diskann_cache_admission_full,
+                          internal_core_diskann_cache_admission,
+                          diskAnnCacheFullLabels);
+DEFINE_PROMETHEUS_COUNTER(internal_core_diskann_cache_admission_trimmed,
+                          internal_core_diskann_cache_admission,
+                          diskAnnCacheTrimmedLabels);
+DEFINE_PROMETHEUS_COUNTER(internal_core_diskann_cache_admission_rejected,
+                          internal_core_diskann_cache_admission,
+                          diskAnnCacheRejectedLabels);
+
+// caching layer cell load metrics, by translator
+std::map<std::string, std::string> cellLoadChunkLabels{
+    {"translator", "chunk"}};
+std::map<std::string, std::string> cellLoadGroupChunkLabels{
+    {"translator", "group_chunk"}};
+std::map<std::string, std::string> cellLoadManifestGroupLabels{
+    {"translator", "manifest_group"}};
+std::map<std::string, std::string> cellLoadSealedIndexLabels{
+    {"translator", "sealed_index"}};
+DEFINE_PROMETHEUS_COUNTER_FAMILY(
+    internal_core_cache_cell_load_total,
+    "[cpp]caching layer cells loaded on a miss, by translator");
+DEFINE_PROMETHEUS_COUNTER(internal_core_cache_cell_load_total_chunk,
+                          internal_core_cache_cell_load_total,
+                          cellLoadChunkLabels);
+DEFINE_PROMETHEUS_COUNTER(internal_core_cache_cell_load_total_group_chunk,
+                          internal_core_cache_cell_load_total,
+                          cellLoadGroupChunkLabels);
+DEFINE_PROMETHEUS_COUNTER(internal_core_cache_cell_load_total_manifest_group,
+                          internal_core_cache_cell_load_total,
+                          cellLoadManifestGroupLabels);
+DEFINE_PROMETHEUS_COUNTER(internal_core_cache_cell_load_total_sealed_index,
+                          internal_core_cache_cell_load_total,
+                          cellLoadSealedIndexLabels);
+DEFINE_PROMETHEUS_COUNTER_FAMILY(
+    internal_core_cache_cell_load_bytes,
+    "[cpp]caching layer bytes loaded on a miss, by translator");
+DEFINE_PROMETHEUS_COUNTER(internal_core_cache_cell_load_bytes_chunk,
+                          internal_core_cache_cell_load_bytes,
+                          cellLoadChunkLabels);
+DEFINE_PROMETHEUS_COUNTER(internal_core_cache_cell_load_bytes_group_chunk,
+                          internal_core_cache_cell_load_bytes,
+                          cellLoadGroupChunkLabels);
+DEFINE_PROMETHEUS_COUNTER(internal_core_cache_cell_load_bytes_manifest_group,
+                          internal_core_cache_cell_load_bytes,
+                          cellLoadManifestGroupLabels);
+DEFINE_PROMETHEUS_COUNTER(internal_core_cache_cell_load_bytes_sealed_index,
+                          internal_core_cache_cell_load_bytes,
+                          cellLoadSealedIndexLabels);
+DEFINE_PROMETHEUS_HISTOGRAM_FAMILY(
+    internal_core_cache_cell_load_duration_seconds,
+    "[cpp]caching layer cell load duration, by translator");
+DEFINE_PROMETHEUS_HISTOGRAM_WITH_BUCKETS(
+    internal_core_cache_cell_load_duration_seconds_chunk,
+    internal_core_cache_cell_load_duration_seconds,
+    cellLoadChunkLabels,
+    secondsBuckets);
+DEFINE_PROMETHEUS_HISTOGRAM_WITH_BUCKETS(
+    internal_core_cache_cell_load_duration_seconds_group_chunk,
+    internal_core_cache_cell_load_duration_seconds,
+    cellLoadGroupChunkLabels,
+    secondsBuckets);
+DEFINE_PROMETHEUS_HISTOGRAM_WITH_BUCKETS(
+    internal_core_cache_cell_load_duration_seconds_manifest_group,
+    internal_core_cache_cell_load_duration_seconds,
+    cellLoadManifestGroupLabels,
+    secondsBuckets);
+DEFINE_PROMETHEUS_HISTOGRAM_WITH_BUCKETS(
+    internal_core_cache_cell_load_duration_seconds_sealed_index,
+    internal_core_cache_cell_load_duration_seconds,
+    cellLoadSealedIndexLabels,
+    secondsBuckets);
+
+// whole remote object read metrics, labelled by the bound of the object size
+std::map<std::string, std::string> objectRead16KbLabels{{"size", "16kb"}};
+std::map<std::string, std::string> objectRead256KbLabels{{"size", "256kb"}};
+std::map<std::string, std::string> objectRead4MbLabels{{"size", "4mb"}};
+std::map<std::string, std::string> objectReadLargeLabels{{"size", "large"}};
+DEFINE_PROMETHEUS_HISTOGRAM_FAMILY(
+    internal_storage_object_read_duration_seconds,
+    "[cpp]duration of whole remote object reads, by object size");
+DEFINE_PROMETHEUS_HISTOGRAM_WITH_BUCKETS(
+    internal_storage_object_read_duration_seconds_16kb,
+    internal_storage_object_read_duration_seconds,
+    objectRead16KbLabels,
+    secondsBuckets);
+DEFINE_PROMETHEUS_HISTOGRAM_WITH_BUCKETS(
+    internal_storage_object_read_duration_seconds_256kb,
+    internal_storage_object_read_duration_seconds,
+    objectRead256KbLabels,
+    secondsBuckets);
+DEFINE_PROMETHEUS_HISTOGRAM_WITH_BUCKETS(
+    internal_storage_object_read_duration_seconds_4mb,
+    internal_storage_object_read_duration_seconds,
+    objectRead4MbLabels,
+    secondsBuckets);
+DEFINE_PROMETHEUS_HISTOGRAM_WITH_BUCKETS(
+    internal_storage_object_read_duration_seconds_large,
+    internal_storage_object_read_duration_seconds,
+    objectReadLargeLabels,
+    secondsBuckets);
+DEFINE_PROMETHEUS_COUNTER_FAMILY(
+    internal_storage_object_read_coalesced,
+    "[cpp]remote object reads served by a read of the same object in flight");
+DEFINE_PROMETHEUS_COUNTER(internal_storage_object_read_coalesced_all,
+                          internal_storage_object_read_coalesced,
+                          {});
+
 DEFINE_PROMETHEUS_GAUGE_FAMILY(internal_arrow_io_pool_capacity,
                                "[cpp]arrow io thread pool capacity");
 DEFINE_PROMETHEUS_GAUGE(internal_arrow_io_pool_capacity_all,
@@ -68,6 +68,23 @@ DECLARE_PROMETHEUS_HISTOGRAM(internal_core_search_get_target_entry_latency);
 DECLARE_PROMETHEUS_HISTOGRAM(internal_core_search_latency_random_sample);
 DECLARE_PROMETHEUS_HISTOGRAM(internal_core_optimize_expr_latency);
 DECLARE_PROMETHEUS_HISTOGRAM(internal_core_expr_filter_ratio);
+DECLARE_PROMETHEUS_HISTOGRAM_FAMILY(internal_core_query_bitmap_bytes);
+DECLARE_PROMETHEUS_HISTOGRAM(internal_core_query_bitmap_bytes_allocated);
+DECLARE_PROMETHEUS_HISTOGRAM(internal_core_query_bitmap_bytes_reused);
+DECLARE_PROMETHEUS_GAUGE_FAMILY(internal_core_exec_memory_bytes);
+DECLARE_PROMETHEUS_GAUGE(internal_core_exec_memory_bytes_used);
+DECLARE_PROMETHEUS_HISTOGRAM_FAMILY(internal_core_query_memory_bytes);
+DECLARE_PROMETHEUS_HISTOGRAM(internal_core_query_memory_bytes_peak);
+DECLARE_PROMETHEUS_COUNTER_FAMILY(internal_core_query_memory_rejected_total);
+DECLARE_PROMETHEUS_COUNTER(internal_core_query_memory_rejected_total_admission);
+DECLARE_PROMETHEUS_COUNTER(internal_core_query_memory_rejected_total_limit);
+DECLARE_PROMETHEUS_HISTOGRAM_FAMILY(internal_core_stage_duration_seconds);
+DECLARE_PROMETHEUS_HISTOGRAM(internal_core_stage_duration_seconds_plan_parse);
+DECLARE_PROMETHEUS_HISTOGRAM(internal_core_stage_duration_seconds_filter);
+DECLARE_PROMETHEUS_HISTOGRAM(
+    internal_core_stage_duration_seconds_vector_search);
+DECLARE_PROMETHEUS_HISTOGRAM(internal_core_stage_duration_seconds_mvcc);
+DECLARE_PROMETHEUS_HISTOGRAM(internal_core_stage_duration_seconds_result_fill);
 
 // async cgo metrics
 DECLARE_PROMETHEUS_HISTOGRAM_FAMILY(internal_cgo_queue_duration_seconds);
@@ -145,6 +162,64 @@ DECLARE_PROMETHEUS_HISTOGRAM(internal_json_stats_latency_shredding);
 DECLARE_PROMETHEUS_HISTOGRAM(internal_json_stats_latency_shared);
 DECLARE_PROMETHEUS_HISTOGRAM(internal_json_stats_latency_load);
 
+// expr result cache tier metrics
+DECLARE_PROMETHEUS_COUNTER_FAMILY(internal_core_expr_cache);
+DECLARE_PROMETHEUS_COUNTER(internal_core_expr_cache_memory_hit);
+DECLARE_PROMETHEUS_COUNTER(internal_core_expr_cache_disk_hit);
+DECLARE_PROMETHEUS_COUNTER(internal_core_expr_cache_miss);
+DECLARE_PROMETHEUS_COUNTER(internal_core_expr_cache_promote);
+DECLARE_PROMETHEUS_COUNTER(internal_core_expr_cache_demote);
+DECLARE_PROMETHEUS_COUNTER(internal_core_expr_cache_range_reuse);
+
+// search result cache metrics
+DECLARE_PROMETHEUS_COUNTER_FAMILY(internal_core_search_result_cache);
+DECLARE_PROMETHEUS_COUNTER(internal_core_search_result_cache_hit);
+DECLARE_PROMETHEUS_COUNTER(internal_core_search_result_cache_miss);
+
+// node wide diskann node cache budget, see index::DiskAnnCacheBudget
+DECLARE_PROMETHEUS_GAUGE_FAMILY(internal_core_diskann_cache_bytes);
+DECLARE_PROMETHEUS_GAUGE(internal_core_diskann_cache_bytes_reserved);
+DECLARE_PROMETHEUS_COUNTER_FAMILY(internal_core_diskann_cache_admission);
+DECLARE_PROMETHEUS_COUNTER(internal_core_diskann_cache_admission_full);
+DECLARE_PROMETHEUS_COUNTER(internal_core_diskann_cache_admission_trimmed);
+DECLARE_PROMETHEUS_COUNTER(internal_core_diskann_cache_admission_rejected);
+
+// caching layer cell load metrics, by translator
+DECLARE_PROMETHEUS_COUNTER_FAMILY(internal_core_cache_cell_load_total);
+DECLARE_PROMETHEUS_COUNTER(internal_core_cache_cell_load_total_chunk);
+DECLARE_PROMETHEUS_COUNTER(internal_core_cache_cell_load_total_group_chunk);
+DECLARE_PROMETHEUS_COUNTER(internal_core_cache_cell_load_total_manifest_group);
+DECLARE_PROMETHEUS_COUNTER(internal_core_cache_cell_load_total_sealed_index);
+DECLARE_PROMETHEUS_COUNTER_FAMILY(internal_core_cache_cell_load_bytes);
+DECLARE_PROMETHEUS_COUNTER(internal_core_cache_cell_load_bytes_chunk);
+DECLARE_PROMETHEUS_COUNTER(internal_core_cache_cell_load_bytes_group_chunk);
+DECLARE_PROMETHEUS_COUNTER(internal_core_cache_cell_load_bytes_manifest_group);
+DECLARE_PROMETHEUS_COUNTER(internal_core_cache_cell_load_bytes_sealed_index);
+DECLARE_PROMETHEUS_HISTOGRAM_FAMILY(
+    internal_core_cache_cell_load_duration_seconds);
+DECLARE_PROMETHEUS_HISTOGRAM(
+    internal_core_cache_cell_load_duration_seconds_chunk);
+DECLARE_PROMETHEUS_HISTOGRAM(
+    internal_core_cache_cell_load_duration_seconds_group_chunk);
+DECLARE_PROMETHEUS_HISTOGRAM(
+    internal_core_cache_cell_load_duration_seconds_manifest_group);
+DECLARE_PROMETHEUS_HISTOGRAM(
+    internal_core_cache_cell_load_duration_seconds_sealed_index);
+
+// whole remote object reads, by object size
+DECLARE_PROMETHEUS_HISTOGRAM_FAMILY(
+    internal_storage_object_read_duration_seconds);
+DECLARE_PROMETHEUS_HISTOGRAM(
+    internal_storage_object_read_duration_seconds_16kb);
+DECLARE_PROMETHEUS_HISTOGRAM(
+    internal_storage_object_read_duration_seconds_256kb);
+DECLARE_PROMETHEUS_HISTOGRAM(
+    internal_storage_object_read_duration_seconds_4mb);
+DECLARE_PROMETHEUS_HISTOGRAM(
+    internal_storage_object_read_duration_seconds_large);
+DECLARE_PROMETHEUS_COUNTER_FAMILY(internal_storage_object_read_coalesced);
+DECLARE_PROMETHEUS_COUNTER(internal_storage_object_read_coalesced_all);
+
 // json filter performance metrics
 DECLARE_PROMETHEUS_HISTOGRAM_FAMILY(internal_json_filter_latency);
 DECLARE_PROMETHEUS_HISTOGRAM(internal_json_filter_latency_bruteforce);
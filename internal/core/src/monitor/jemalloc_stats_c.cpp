@@ -14,8 +14,11 @@
 
 #include "monitor/jemalloc_stats_c.h"
 
+#include <atomic>
 #include <cstddef>
+#include <cstdio>
 #include <cstring>
+#include <mutex>
 
 #ifdef __linux__
 #include <dlfcn.h>
@@ -111,3 +114,179 @@ GetJemallocStats() {
 
     return stats;
 }
+
+// whether pool threads bind to arenas of their own
+static std::atomic<bool> arena_per_pool{false};
+
+// serializes the creation of the pool arenas
+static std::mutex arena_mutex;
+
+// arena index + 1 of every pool, 0 while the pool has no arena yet
+static std::atomic<unsigned> pool_arenas[JEMALLOC_ARENA_POOL_NUM];
+
+static bool
+is_valid_pool(JemallocArenaPool pool) {
+    return pool >= 0 && pool < JEMALLOC_ARENA_POOL_NUM;
+}
+
+// the arena of `pool`, created by the first caller
+static bool
+get_or_create_arena(mallctl_t mallctl_fn,
+                    JemallocArenaPool pool,
+                    unsigned* arena) {
+    auto index = pool_arenas[pool].load(std::memory_order_acquire);
+    if (index == 0) {
+        std::lock_guard<std::mutex> lock(arena_mutex);
+        index = pool_arenas[pool].load(std::memory_order_relaxed);
+        if (index == 0) {
+            unsigned created = 0;
+            size_t sz = sizeof(created);
+            if (mallctl_fn("arenas.create", &created, &sz, nullptr, 0) != 0) {
+                return false;
+            }
+            index = created + 1;
+            pool_arenas[pool].store(index, std::memory_order_release);
+        }
+    }
+    *arena = index - 1;
+    return true;
+}
+
+// reads the size_t statistic `name` of `arena`
+static bool
+read_arena_stat(mallctl_t mallctl_fn,
+                unsigned arena,
+                const char* name,
+                size_t* value) {
+    char key[64];
+    std::snprintf(key, sizeof(key), "stats.arenas.%u.%s", arena, name);
+    size_t sz = sizeof(size_t);
+    return mallctl_fn(key, value, &sz, nullptr, 0) == 0;
+}
+
+// whether jemalloc was started with heap profiling enabled
+static bool
+is_profiling_enabled(mallctl_t mallctl_fn) {
+    bool enabled = false;
+    size_t sz = sizeof(enabled);
+    return mallctl_fn("opt.prof", &enabled, &sz, nullptr, 0) == 0 && enabled;
+}
+
+void
+SetJemallocArenaPerPool(bool enable) {
+    arena_per_pool.store(enable);
+}
+
+bool
+BindThreadToJemallocArena(JemallocArenaPool pool) {
+    mallctl_t mallctl_fn = get_mallctl();
+    if (mallctl_fn == nullptr || !arena_per_pool.load() ||
+        !is_valid_pool(pool)) {
+        return false;
+    }
+    unsigned arena = 0;
+    if (!get_or_create_arena(mallctl_fn, pool, &arena)) {
+        return false;
+    }
+    return mallctl_fn(
+               "thread.arena", nullptr, nullptr, &arena, sizeof(arena)) == 0;
+}
+
+JemallocArenaStats
+GetJemallocArenaStats(JemallocArenaPool pool) {
+    JemallocArenaStats stats;
+    std::memset(&stats, 0, sizeof(JemallocArenaStats));
+    stats.success = false;
+
+    mallctl_t mallctl_fn = get_mallctl();
+    if (mallctl_fn == nullptr || !is_valid_pool(pool)) {
+        return stats;
+    }
+    // only report arenas the pools asked for, never create one here
+    auto index = pool_arenas[pool].load(std::memory_order_acquire);
+    if (index == 0) {
+        return stats;
+    }
+    unsigned arena = index - 1;
+
+    uint64_t epoch = 1;
+    size_t epoch_sz = sizeof(epoch);
+    if (mallctl_fn("epoch", &epoch, &epoch_sz, &epoch, epoch_sz) != 0) {
+        return stats;
+    }
+
+    size_t page = 0;
+    size_t sz = sizeof(page);
+    if (mallctl_fn("arenas.page", &page, &sz, nullptr, 0) != 0) {
+        return stats;
+    }
+
+    unsigned threads = 0;
+    char key[64];
+    std::snprintf(key, sizeof(key), "stats.arenas.%u.nthreads", arena);
+    sz = sizeof(threads);
+    if (mallctl_fn(key, &threads, &sz, nullptr, 0) != 0) {
+        return stats;
+    }
+
+    size_t small = 0;
+    size_t large = 0;
+    size_t pactive = 0;
+    size_t pdirty = 0;
+    size_t pmuzzy = 0;
+    size_t resident = 0;
+    size_t mapped = 0;
+    size_t retained = 0;
+    if (!read_arena_stat(mallctl_fn, arena, "small.allocated", &small) ||
+        !read_arena_stat(mallctl_fn, arena, "large.allocated", &large) ||
+        !read_arena_stat(mallctl_fn, arena, "pactive", &pactive) ||
+        !read_arena_stat(mallctl_fn, arena, "pdirty", &pdirty) ||
+        !read_arena_stat(mallctl_fn, arena, "pmuzzy", &pmuzzy) ||
+        !read_arena_stat(mallctl_fn, arena, "resident", &resident) ||
+        !read_arena_stat(mallctl_fn, arena, "mapped", &mapped) ||
+        !read_arena_stat(mallctl_fn, arena, "retained", &retained)) {
+        return stats;
+    }
+
+    stats.arena = arena;
+    stats.threads = threads;
+    stats.allocated = static_cast<uint64_t>(small + large);
+    stats.active = static_cast<uint64_t>(pactive * page);
+    stats.dirty = static_cast<uint64_t>(pdirty * page);
+    stats.muzzy = static_cast<uint64_t>(pmuzzy * page);
+    stats.resident = static_cast<uint64_t>(resident);
+    stats.mapped = static_cast<uint64_t>(mapped);
+    stats.retained = static_cast<uint64_t>(retained);
+    stats.success = true;
+
+    return stats;
+}
+
+bool
+SetJemallocHeapProfileActive(bool active, int32_t lg_sample) {
+    mallctl_t mallctl_fn = get_mallctl();
+    if (mallctl_fn == nullptr || !is_profiling_enabled(mallctl_fn)) {
+        return false;
+    }
+    if (lg_sample >= 0) {
+        size_t sample = static_cast<size_t>(lg_sample);
+        if (mallctl_fn(
+                "prof.reset", nullptr, nullptr, &sample, sizeof(sample)) != 0) {
+            return false;
+        }
+    }
+    return mallctl_fn(
+               "prof.active", nullptr, nullptr, &active, sizeof(active)) == 0;
+}
+
+bool
+DumpJemallocHeapProfile(const char* path) {
+    mallctl_t mallctl_fn = get_mallctl();
+    if (mallctl_fn == nullptr || !is_profiling_enabled(mallctl_fn)) {
+        return false;
+    }
+    if (path == nullptr) {
+        return mallctl_fn("prof.dump", nullptr, nullptr, nullptr, 0) == 0;
+    }
+    return mallctl_fn("prof.dump", nullptr, nullptr, &path, sizeof(path)) == 0;
+}
@@ -44,6 +44,61 @@ typedef struct {
 JemallocStats
 GetJemallocStats();
 
+// Thread pools that can allocate from a jemalloc arena of their own, so the
+// fragmentation of long lived segment data loaded by one pool and of the
+// short lived buffers of searches and index builds do not mix
+typedef enum {
+    JEMALLOC_ARENA_LOAD = 0,
+    JEMALLOC_ARENA_SEARCH = 1,
+    JEMALLOC_ARENA_BUILD = 2,
+    JEMALLOC_ARENA_POOL_NUM = 3,
+} JemallocArenaPool;
+
+// JemallocArenaStats contains the statistics of the arena of one pool
+// All sizes are in bytes
+typedef struct {
+    uint32_t arena;      // Index of the arena in jemalloc
+    uint32_t threads;    // Threads currently bound to the arena
+    uint64_t allocated;  // Bytes of small and large allocations
+    uint64_t active;     // Bytes in active pages
+    uint64_t dirty;      // Bytes in unused dirty pages, not yet purged
+    uint64_t muzzy;      // Bytes in unused pages given back lazily
+    uint64_t resident;   // Bytes in physically resident data pages
+    uint64_t mapped;     // Bytes in virtual memory mappings
+    uint64_t retained;   // Bytes in retained virtual memory mappings
+
+    // Status flags
+    bool success;  // Whether the pool has an arena and stats were retrieved
+} JemallocArenaStats;
+
+// Enables or disables an arena per pool, off by default. Only the threads
+// started while it is enabled bind to the arena of their pool, so it should
+// be set before the pools start.
+void
+SetJemallocArenaPerPool(bool enable);
+
+// Binds the calling thread to the arena of `pool`, creating the arena on
+// first use. Returns false when jemalloc is not available, arenas per pool
+// are disabled or the arena could not be created.
+bool
+BindThreadToJemallocArena(JemallocArenaPool pool);
+
+JemallocArenaStats
+GetJemallocArenaStats(JemallocArenaPool pool);
+
+// Starts or stops sampling allocations for heap profiles. A non-negative
+// `lg_sample` also resets the collected samples and sets the average bytes
+// between samples to 2^lg_sample. Returns false when jemalloc was not
+// started with profiling enabled (MALLOC_CONF=prof:true).
+bool
+SetJemallocHeapProfileActive(bool active, int32_t lg_sample);
+
+// Dumps the sampled heap profile to `path` or, when `path` is null, to a
+// file named after the prof_prefix of jemalloc. Returns false when
+// profiling is not enabled or the dump failed.
+bool
+DumpJemallocHeapProfile(const char* path);
+
 #ifdef __cplusplus
 }
 #endif
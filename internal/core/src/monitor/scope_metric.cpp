@@ -1,11 +1,18 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <chrono>
+#include <map>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <utility>
 
 #include "common/PrometheusClient.h"
 #include "glog/logging.h"
 #include "log/Log.h"
 #include "prometheus/family.h"
+#include "prometheus/gauge.h"
 #include "prometheus/histogram.h"
 #include "scope_metric.h"
 
@@ -58,4 +65,220 @@ FuncScopeMetric::~FuncScopeMetric() {
     auto& hist = GetHistogram(std::move(func_));
     hist.Observe(duration_sec);
 }
-}  // namespace milvus::monitor
\ No newline at end of file
+
+namespace {
+
+constexpr size_t kSegmentTypes = 4;
+constexpr size_t kApis = static_cast<size_t>(SegcoreApi::Count);
+constexpr size_t kWarmups = static_cast<size_t>(SegcoreWarmup::Count);
+
+const char*
+ApiLabel(SegcoreApi api) {
+    switch (api) {
+        case SegcoreApi::Search:
+            return "search";
+        case SegcoreApi::Retrieve:
+            return "retrieve";
+        case SegcoreApi::Insert:
+            return "insert";
+        case SegcoreApi::Delete:
+            return "delete";
+        case SegcoreApi::LoadFieldData:
+            return "load_field_data";
+        case SegcoreApi::LoadIndex:
+            return "load_index";
+        default:
+            return "unknown";
+    }
+}
+
+const char*
+SegmentTypeLabel(size_t segment_type) {
+    switch (segment_type) {
+        case Growing:
+            return "growing";
+        case Sealed:
+            return "sealed";
+        case Indexing:
+            return "indexing";
+        default:
+            return "invalid";
+    }
+}
+
+const char*
+WarmupLabel(SegcoreWarmup warmup) {
+    switch (warmup) {
+        case SegcoreWarmup::Default:
+            return "default";
+        case SegcoreWarmup::Disable:
+            return "disable";
+        case SegcoreWarmup::Sync:
+            return "sync";
+        case SegcoreWarmup::Async:
+            return "async";
+        default:
+            return "none";
+    }
+}
+
+// the histogram of one combination of labels, added to the family the first
+// time it is observed so that the calls only look up an array
+prometheus::Histogram&
+GetApiHistogram(SegcoreApi api,
+                SegmentType segment_type,
+                bool mmap,
+                SegcoreWarmup warmup) {
+    static auto& hist_family =
+        prometheus::BuildHistogram()
+            .Name("milvus_segcore_api_duration_seconds")
+            .Help("Duration of segcore C API calls by segment type and mode")
+            .Register(getPrometheusClient().GetRegistry());
+    static std::array<std::atomic<prometheus::Histogram*>,
+                      kApis * kSegmentTypes * 2 * kWarmups>
+        histograms{};
+
+    auto api_index = std::min(static_cast<size_t>(api), kApis - 1);
+    auto type_index = static_cast<size_t>(segment_type) < kSegmentTypes
+                          ? static_cast<size_t>(segment_type)
+                          : static_cast<size_t>(Invalid);
+    auto warmup_index = std::min(static_cast<size_t>(warmup), kWarmups - 1);
+    auto& slot = histograms[((api_index * kSegmentTypes + type_index) * 2 +
+                             (mmap ? 1 : 0)) *
+                                kWarmups +
+                            warmup_index];
+    auto* histogram = slot.load(std::memory_order_acquire);
+    if (histogram == nullptr) {
+        // adding the same labels twice returns the same histogram
+        histogram = &hist_family.Add(
+            {{"api", ApiLabel(api)},
+             {"segment_type", SegmentTypeLabel(type_index)},
+             {"mmap", mmap ? "true" : "false"},
+             {"warmup", WarmupLabel(static_cast<SegcoreWarmup>(warmup_index))}},
+            cgoCallDurationbuckets);
+        slot.store(histogram, std::memory_order_release);
+    }
+    return *histogram;
+}
+
+}  // namespace
+
+SegcoreWarmup
+ParseSegcoreWarmup(std::string_view policy) {
+    if (policy == "disable") {
+        return SegcoreWarmup::Disable;
+    }
+    if (policy == "sync") {
+        return SegcoreWarmup::Sync;
+    }
+    if (policy == "async") {
+        return SegcoreWarmup::Async;
+    }
+    return SegcoreWarmup::Default;
+}
+
+SegcoreApiScopeMetric::SegcoreApiScopeMetric(SegcoreApi api,
+                                             SegmentType segment_type,
+                                             bool mmap,
+                                             SegcoreWarmup warmup)
+    : histogram_(&GetApiHistogram(api, segment_type, mmap, warmup)),
+      start_(std::chrono::steady_clock::now()) {
+}
+
+SegcoreApiScopeMetric::~SegcoreApiScopeMetric() {
+    histogram_->Observe(std::chrono::duration<double>(
+                            std::chrono::steady_clock::now() - start_)
+                            .count());
+}
+
+HistogramScopeMetric::HistogramScopeMetric(prometheus::Histogram& histogram)
+    : histogram_(histogram), start_(std::chrono::steady_clock::now()) {
+}
+
+HistogramScopeMetric::~HistogramScopeMetric() {
+    histogram_.Observe(std::chrono::duration<double>(
+                           std::chrono::steady_clock::now() - start_)
+                           .count());
+}
+
+namespace {
+
+const prometheus::Histogram::BucketBoundaries ipcBuckets = {
+    0.25, 0.5, 0.75, 1.0, 1.5, 2.0, 2.5, 3.0, 4.0};
+const prometheus::Histogram::BucketBoundaries mpkiBuckets = {
+    0.1, 0.5, 1.0, 2.0, 5.0, 10.0, 20.0, 50.0, 100.0};
+
+struct OperatorPerfHistograms {
+    prometheus::Histogram* ipc;
+    prometheus::Histogram* llc_mpki;
+    prometheus::Histogram* branch_mpki;
+};
+
+// the histograms of one operator type, added the first time it is observed
+const OperatorPerfHistograms&
+GetOperatorPerfHistograms(const std::string& operator_type) {
+    static auto& ipc_family =
+        prometheus::BuildHistogram()
+            .Name("milvus_core_operator_ipc")
+            .Help("Instructions per cycle of sampled query operator runs")
+            .Register(getPrometheusClient().GetRegistry());
+    static auto& llc_family =
+        prometheus::BuildHistogram()
+            .Name("milvus_core_operator_llc_mpki")
+            .Help("Last level cache misses per thousand instructions of "
+                  "sampled query operator runs")
+            .Register(getPrometheusClient().GetRegistry());
+    static auto& branch_family =
+        prometheus::BuildHistogram()
+            .Name("milvus_core_operator_branch_mpki")
+            .Help("Branch misses per thousand instructions of sampled query "
+                  "operator runs")
+            .Register(getPrometheusClient().GetRegistry());
+    static std::mutex mutex;
+    static std::unordered_map<std::string, OperatorPerfHistograms> histograms;
+
+    std::lock_guard lock(mutex);
+    auto it = histograms.find(operator_type);
+    if (it == histograms.end()) {
+        std::map<std::string, std::string> labels{
+            {"operator", operator_type}};
+        it = histograms
+                 .emplace(operator_type,
+                          OperatorPerfHistograms{
+                              &ipc_family.Add(labels, ipcBuckets),
+                              &llc_family.Add(labels, mpkiBuckets),
+                              &branch_family.Add(labels, mpkiBuckets)})
+                 .first;
+    }
+    return it->second;
+}
+
+}  // namespace
+
+void
+ObserveOperatorPerfCounters(const std::string& operator_type,
+                            int64_t instructions,
+                            int64_t cycles,
+                            int64_t llc_misses,
+                            int64_t branch_misses) {
+    if (instructions <= 0 || cycles <= 0) {
+        return;
+    }
+    const auto& histograms = GetOperatorPerfHistograms(operator_type);
+    auto kilo_instructions = instructions / 1000.0;
+    histograms.ipc->Observe(static_cast<double>(instructions) / cycles);
+    histograms.llc_mpki->Observe(llc_misses / kilo_instructions);
+    histograms.branch_mpki->Observe(branch_misses / kilo_instructions);
+}
+
+void
+SetBitsetKernelImplementation(const std::string& implementation) {
+    static auto& family =
+        prometheus::BuildGauge()
+            .Name("milvus_core_bitset_kernel_implementation")
+            .Help("Implementation the bitset kernels dispatch to, set to 1")
+            .Register(getPrometheusClient().GetRegistry());
+    family.Add({{"implementation", implementation}}).Set(1);
+}
+
+}  // namespace milvus::monitor
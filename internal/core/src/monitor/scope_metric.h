@@ -13,10 +13,27 @@
 
 #include <chrono>
 #include <string>
+#include <string_view>
+
+#include "common/type_c.h"
+
+namespace prometheus {
+class Histogram;
+}  // namespace prometheus
 
 #define SCOPE_CGO_CALL_METRIC() \
     ::milvus::monitor::FuncScopeMetric _scope_metric(__func__)
 
+// times a segcore C API call, see SegcoreApiScopeMetric
+#define SCOPE_SEGCORE_API_METRIC(api, segment_type, mmap, warmup) \
+    ::milvus::monitor::SegcoreApiScopeMetric _segcore_api_metric( \
+        api, segment_type, mmap, warmup)
+
+// times a stage of a query into one of the
+// internal_core_stage_duration_seconds histograms
+#define SCOPE_SEGCORE_STAGE_METRIC(histogram) \
+    ::milvus::monitor::HistogramScopeMetric _segcore_stage_metric(histogram)
+
 namespace milvus::monitor {
 
 class FuncScopeMetric {
@@ -30,4 +47,86 @@ class FuncScopeMetric {
     std::chrono::high_resolution_clock::time_point start_;
 };
 
+enum class SegcoreApi {
+    Search = 0,
+    Retrieve,
+    Insert,
+    Delete,
+    LoadFieldData,
+    LoadIndex,
+    Count,
+};
+
+// the warmup policy of a load, None for the calls that load nothing
+enum class SegcoreWarmup {
+    None = 0,
+    Default,
+    Disable,
+    Sync,
+    Async,
+    Count,
+};
+
+// the warmup of a "disable", "sync" or "async" policy, Default for the
+// empty policy that follows the global config
+SegcoreWarmup
+ParseSegcoreWarmup(std::string_view policy);
+
+// Observes the duration of a segcore C API call into
+// milvus_segcore_api_duration_seconds, labeled by the api, the type of the
+// segment, whether the data it reads or loads is mmapped and the warmup of
+// loads, so the calls of every kind of segment are told apart.
+class SegcoreApiScopeMetric {
+ public:
+    SegcoreApiScopeMetric(SegcoreApi api,
+                          SegmentType segment_type,
+                          bool mmap,
+                          SegcoreWarmup warmup);
+
+    ~SegcoreApiScopeMetric();
+
+    SegcoreApiScopeMetric(const SegcoreApiScopeMetric&) = delete;
+    SegcoreApiScopeMetric&
+    operator=(const SegcoreApiScopeMetric&) = delete;
+
+ private:
+    prometheus::Histogram* histogram_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+// Observes the seconds from its construction to its destruction into
+// `histogram`.
+class HistogramScopeMetric {
+ public:
+    explicit HistogramScopeMetric(prometheus::Histogram& histogram);
+
+    ~HistogramScopeMetric();
+
+    HistogramScopeMetric(const HistogramScopeMetric&) = delete;
+    HistogramScopeMetric&
+    operator=(const HistogramScopeMetric&) = delete;
+
+ private:
+    prometheus::Histogram& histogram_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+// Observes the hardware counters of one sampled operator run, labeled by the
+// operator: its instructions per cycle into milvus_core_operator_ipc and its
+// last level cache and branch misses per thousand instructions into
+// milvus_core_operator_llc_mpki and milvus_core_operator_branch_mpki. A run
+// without counted cycles or instructions is not observed.
+void
+ObserveOperatorPerfCounters(const std::string& operator_type,
+                            int64_t instructions,
+                            int64_t cycles,
+                            int64_t llc_misses,
+                            int64_t branch_misses);
+
+// Sets milvus_core_bitset_kernel_implementation{implementation} to 1, the
+// implementation the bitset kernels of this process dispatch to, so nodes
+// running the element-wise fallback can be found.
+void
+SetBitsetKernelImplementation(const std::string& implementation);
+
 }  // namespace milvus::monitor
\ No newline at end of file
@@ -19,6 +19,7 @@
 #include <stdint.h>
 #include <algorithm>
 #include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -316,18 +317,30 @@ class ElementFilterBitsNode : public PlanNode {
     const std::string struct_name_;
 };
 
+// The single ORDER BY key and limit of the rows a ProjectNode feeds to an
+// OrderByNode.
+struct IndexOrderedProject {
+    FieldId field_id;
+    bool ascending;
+    int64_t limit;
+};
+
 class ProjectNode : public PlanNode {
  public:
     ProjectNode(const PlanNodeId& id,
                 std::vector<FieldId>&& field_ids,
                 std::vector<std::string>&& field_names,
                 std::vector<milvus::DataType>&& field_types,
-                std::vector<PlanNodePtr> sources = std::vector<PlanNodePtr>{})
+                std::vector<PlanNodePtr> sources = std::vector<PlanNodePtr>{},
+                bool pushdown_chunk_min_max = false,
+                std::optional<IndexOrderedProject> index_ordered = std::nullopt)
         : PlanNode(id),
           sources_(std::move(sources)),
           field_ids_(std::move(field_ids)),
           output_type_(std::make_shared<RowType>(std::move(field_names),
-                                                 std::move(field_types))) {
+                                                 std::move(field_types))),
+          pushdown_chunk_min_max_(pushdown_chunk_min_max),
+          index_ordered_(index_ordered) {
     }
 
     std::vector<PlanNodePtr>
@@ -356,10 +369,29 @@ class ProjectNode : public PlanNode {
         return field_ids_;
     }
 
+    // Set when the only consumer is a global aggregation of count(*),
+    // min() and max() over the projected fields: fully visible chunks of a
+    // sealed segment are then answered from their skip index min/max
+    // instead of being materialized.
+    bool
+    PushdownChunkMinMax() const {
+        return pushdown_chunk_min_max_;
+    }
+
+    // Set when the consumer is an ORDER BY of one non-nullable field with a
+    // limit: a sealed segment whose index keeps the rows of the field sorted
+    // then projects only the first `limit` visible rows in index order.
+    const std::optional<IndexOrderedProject>&
+    IndexOrdered() const {
+        return index_ordered_;
+    }
+
  private:
     const std::vector<PlanNodePtr> sources_;
     const std::vector<FieldId> field_ids_;
     const RowTypePtr output_type_;
+    const bool pushdown_chunk_min_max_;
+    const std::optional<IndexOrderedProject> index_ordered_;
 };
 
 class MvccNode : public PlanNode {
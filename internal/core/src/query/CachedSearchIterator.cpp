@@ -84,7 +84,14 @@ CachedSearchIterator::InitializeChunkedIterators(
     const milvus::DataType& data_type,
     const GetChunkDataFunc& get_chunk_data) {
     int64_t offset = 0;
-    chunked_heaps_.resize(nq_);
+    // a heap holds at most one pending result per chunk
+    chunked_heaps_.reserve(nq_);
+    for (size_t query_idx = 0; query_idx < nq_; ++query_idx) {
+        std::vector<IterIdDisIdPair> storage;
+        storage.reserve(num_chunks_);
+        chunked_heaps_.emplace_back(IterIdDisIdPairComparator{},
+                                    std::move(storage));
+    }
     for (int64_t chunk_id = 0; chunk_id < num_chunks_; ++chunk_id) {
         auto [chunk_data, chunk_size] = get_chunk_data(chunk_id);
         auto sub_data = query::dataset::RawDataset{
@@ -130,15 +137,17 @@ CachedSearchIterator::CachedSearchIterator(
     Init(search_info);
 
     // VECTOR_ARRAY element-level search: growing stores each row as a
-    // separate VectorArray with its own backing allocation, so we must
-    // flatten per-chunk into a contiguous buffer that knowhere can read.
-    // array_offsets_ != nullptr is the element-level signal (multi-search-
-    // multi emb-list iterator is rejected upstream, so we don't branch on
-    // it here).
+    // separate VectorArray with its own backing allocation, knowhere reads
+    // the flat chunks kept alongside them, or a per-chunk copy for rows not
+    // flattened yet. array_offsets_ != nullptr is the element-level signal
+    // (multi-search-multi emb-list iterator is rejected upstream, so we
+    // don't branch on it here).
     const bool is_element_level = search_info.array_offsets_ != nullptr;
-    if (is_element_level) {
-        chunk_buffers_.reserve(num_chunks_);
-    }
+    const auto* flat_vector_array =
+        is_element_level
+            ? dynamic_cast<const segcore::ConcurrentVector<VectorArray>*>(
+                  vec_data)
+            : nullptr;
 
     iterators_.reserve(nq_ * num_chunks_);
     InitializeChunkedIterators(
@@ -147,8 +156,12 @@ CachedSearchIterator::CachedSearchIterator(
         index_info,
         bitset,
         data_type,
-        [this, &vec_data, vec_size_per_chunk, row_count, is_element_level](
-            int64_t chunk_id) {
+        [this,
+         &vec_data,
+         vec_size_per_chunk,
+         row_count,
+         is_element_level,
+         flat_vector_array](int64_t chunk_id) {
             const void* chunk_data = vec_data->get_chunk_data(chunk_id);
             // no need to store a PinWrapper for growing, because vec_data is guaranteed to not be evicted.
             int64_t chunk_size = std::min(
@@ -156,6 +169,15 @@ CachedSearchIterator::CachedSearchIterator(
             if (!is_element_level) {
                 return std::make_pair(chunk_data, chunk_size);
             }
+            if (flat_vector_array != nullptr) {
+                // lives as long as vec_data, like the chunk data
+                auto flat = flat_vector_array->get_flat_chunk(chunk_id);
+                if (flat.rows >= chunk_size) {
+                    auto elements =
+                        static_cast<int64_t>(flat.offsets[chunk_size]);
+                    return std::make_pair(flat.data, elements);
+                }
+            }
 
             auto va_ptr = reinterpret_cast<const VectorArray*>(chunk_data);
             int64_t total_bytes = 0;
@@ -248,10 +270,20 @@ CachedSearchIterator::NextBatch(const SearchInfo& search_info,
     search_result.seg_offsets_.resize(nq_ * batch_size_);
     search_result.distances_.resize(nq_ * batch_size_);
 
+    auto last_bound = ConvertIncomingDistance(
+        search_info.iterator_v2_info_.value().last_bound);
+    auto radius = ConvertIncomingDistance(
+        index::GetValueFromConfig<float>(search_info.search_params_, RADIUS));
+    auto range_filter =
+        ConvertIncomingDistance(index::GetValueFromConfig<float>(
+            search_info.search_params_, RANGE_FILTER));
+
     for (size_t query_idx = 0; query_idx < nq_; ++query_idx) {
-        auto rst = GetBatchedNextResults(query_idx, search_info);
-        WriteSingleQuerySearchResult(
-            search_result, query_idx, rst, search_info.round_decimal_);
+        GetBatchedNextResults(query_idx, last_bound, radius, range_filter);
+        WriteSingleQuerySearchResult(search_result,
+                                     query_idx,
+                                     batch_buffer_,
+                                     search_info.round_decimal_);
     }
 }
 
@@ -326,19 +358,14 @@ CachedSearchIterator::MergeChunksResults(
     }
 }
 
-std::vector<CachedSearchIterator::DisIdPair>
-CachedSearchIterator::GetBatchedNextResults(size_t query_idx,
-                                            const SearchInfo& search_info) {
-    auto last_bound = ConvertIncomingDistance(
-        search_info.iterator_v2_info_.value().last_bound);
-    auto radius = ConvertIncomingDistance(
-        index::GetValueFromConfig<float>(search_info.search_params_, RADIUS));
-    auto range_filter =
-        ConvertIncomingDistance(index::GetValueFromConfig<float>(
-            search_info.search_params_, RANGE_FILTER));
-
-    std::vector<DisIdPair> rst;
-    rst.reserve(batch_size_);
+void
+CachedSearchIterator::GetBatchedNextResults(
+    size_t query_idx,
+    const std::optional<float>& last_bound,
+    const std::optional<float>& radius,
+    const std::optional<float>& range_filter) {
+    auto& rst = batch_buffer_;
+    rst.clear();
 
     if (num_chunks_ == 1) {
         auto& iterator = iterators_[query_idx];
@@ -360,7 +387,6 @@ CachedSearchIterator::GetBatchedNextResults(size_t query_idx,
     while (rst.size() < batch_size_) {
         rst.emplace_back(1.0f / 0.0f, -1);
     }
-    return rst;
 }
 
 void
@@ -401,6 +427,7 @@ CachedSearchIterator::Init(const SearchInfo& search_info) {
                   "Batch size is 0, cannot initialize iterator");
     }
     batch_size_ = iterator_v2_info.batch_size;
+    batch_buffer_.reserve(batch_size_);
 
     if (search_info.metric_type_.empty()) {
         ThrowInfo(ErrorCode::UnexpectedError,
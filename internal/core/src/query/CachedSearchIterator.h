@@ -45,7 +45,10 @@ namespace milvus::query {
 // It does not care about TopK in search_info
 // The topk in SearchResult will be set to the batch_size for compatibility
 //
-// TODO: introduce the pool of results in the near future
+// The per-query heaps and the batch buffer are kept across NextBatch calls
+// and only reallocated when they outgrow their storage, so paging through
+// results does not allocate on every page.
+//
 // TODO: replace VectorIterator class
 class CachedSearchIterator {
  public:
@@ -96,8 +99,9 @@ class CachedSearchIterator {
     std::vector<milvus::cachinglayer::PinWrapper<const void*>> pin_wrappers_;
     // used only for growing segment with VECTOR_ARRAY element-level search:
     // knowhere needs a contiguous flat buffer, but growing stores each row as
-    // a separate VectorArray with its own backing allocation, so we flatten
-    // per-chunk here and keep the buffers alive alongside the iterators.
+    // a separate VectorArray with its own backing allocation. Chunks whose
+    // rows are not all flattened by the vector yet are flattened here and
+    // the buffers kept alive alongside the iterators.
     std::vector<std::unique_ptr<uint8_t[]>> chunk_buffers_;
     int64_t batch_size_ = 0;
     std::vector<knowhere::IndexNode::IteratorPtr> iterators_;
@@ -118,6 +122,8 @@ class CachedSearchIterator {
                                     std::vector<IterIdDisIdPair>,
                                     IterIdDisIdPairComparator>>
         chunked_heaps_;
+    // results of the query being collected, reused across queries and calls
+    std::vector<DisIdPair> batch_buffer_;
 
     inline bool
     IsValid(const DisIdPair& result,
@@ -172,8 +178,12 @@ class CachedSearchIterator {
     void
     ValidateSearchInfo(const SearchInfo& search_info);
 
-    std::vector<DisIdPair>
-    GetBatchedNextResults(size_t query_idx, const SearchInfo& search_info);
+    // fills batch_buffer_ with the next batch_size_ results of a query
+    void
+    GetBatchedNextResults(size_t query_idx,
+                          const std::optional<float>& last_bound,
+                          const std::optional<float>& radius,
+                          const std::optional<float>& range_filter);
 
     void
     WriteSingleQuerySearchResult(SearchResult& search_result,
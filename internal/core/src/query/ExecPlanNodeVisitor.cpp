@@ -17,8 +17,11 @@
 #include <string>
 #include <utility>
 
+#include "common/Common.h"
+#include "common/PinCache.h"
 #include "common/Tracer.h"
 #include "common/protobuf_utils.h"
+#include "exec/MemoryTracker.h"
 #include "exec/Task.h"
 #include "fmt/core.h"
 #include "glog/logging.h"
@@ -29,6 +32,7 @@
 #include "plan/PlanNode.h"
 #include "query/PlanImpl.h"
 #include "query/PlanProto.h"
+#include "segcore/SegcoreConfig.h"
 #include "segcore/SegmentInterface.h"
 #include "segcore/Utils.h"
 
@@ -44,6 +48,128 @@ empty_search_result(int64_t num_queries, bool element_level = false) {
     return final_result;
 }
 
+// The pks of a retrieve whose whole filter is `pk in [...]`, such a retrieve
+// resolves them to offsets directly instead of building and scanning a
+// bitset of the segment. nullopt for any other plan.
+static std::optional<std::vector<PkType>>
+PointLookupPks(const RetrievePlanNode& node, const Schema& schema) {
+    if (node.has_order_by_ || node.query_iterator_cursor_.has_value() ||
+        node.plan_options_.explain_analyze) {
+        return std::nullopt;
+    }
+    // an entity ttl adds a filter on the ttl field when the plan executes
+    auto pk_field_id = schema.get_primary_field_id();
+    if (!pk_field_id.has_value() || schema.get_ttl_field_id().has_value()) {
+        return std::nullopt;
+    }
+    auto mvcc =
+        std::dynamic_pointer_cast<const plan::MvccNode>(node.plannodes_);
+    if (mvcc == nullptr || mvcc->sources().size() != 1) {
+        return std::nullopt;
+    }
+    auto filter = std::dynamic_pointer_cast<const plan::FilterBitsNode>(
+        mvcc->sources()[0]);
+    if (filter == nullptr || !filter->sources().empty()) {
+        return std::nullopt;
+    }
+    auto term =
+        std::dynamic_pointer_cast<const expr::TermFilterExpr>(filter->filter());
+    if (term == nullptr || term->is_in_field_ ||
+        term->column_.element_level_ || !term->column_.nested_path_.empty() ||
+        term->column_.field_id_ != pk_field_id.value()) {
+        return std::nullopt;
+    }
+
+    std::vector<PkType> pks;
+    pks.reserve(term->vals_.size());
+    auto pk_type = schema[pk_field_id.value()].get_data_type();
+    for (const auto& val : term->vals_) {
+        if (pk_type == DataType::INT64 &&
+            val.val_case() == proto::plan::GenericValue::kInt64Val) {
+            pks.emplace_back(val.int64_val());
+        } else if (pk_type == DataType::VARCHAR &&
+                   val.val_case() == proto::plan::GenericValue::kStringVal) {
+            pks.emplace_back(val.string_val());
+        } else {
+            return std::nullopt;
+        }
+    }
+    return pks;
+}
+
+std::optional<std::string>
+ExecPlanNodeVisitor::SharedPrefilterKey(const VectorPlanNode& node) {
+    // EXPLAIN ANALYZE reports the operators each search ran
+    if (node.plan_options_.explain_analyze) {
+        return std::nullopt;
+    }
+    // an element level pre-filter leaves state in the query context, only
+    // a plain filter and the MVCC masks are shared
+    auto mvcc = std::dynamic_pointer_cast<const plan::MvccNode>(
+        ProtoParser::ExtractFilterOnlyPlan(node.plannodes_));
+    if (mvcc == nullptr || mvcc->sources().size() > 1) {
+        return std::nullopt;
+    }
+    if (!mvcc->sources().empty()) {
+        auto filter = std::dynamic_pointer_cast<const plan::FilterBitsNode>(
+            mvcc->sources()[0]);
+        if (filter == nullptr || !filter->sources().empty()) {
+            return std::nullopt;
+        }
+    }
+    return mvcc->ToString();
+}
+
+std::shared_ptr<const exec::SharedPrefilter>
+ExecPlanNodeVisitor::EvalSharedPrefilter(const VectorPlanNode& node) {
+    auto segment =
+        dynamic_cast<const segcore::SegmentInternalInterface*>(&segment_);
+    AssertInfo(segment, "support SegmentSmallIndex Only");
+    auto active_count = segment->get_active_count(timestamp_);
+    if (active_count == 0) {
+        return nullptr;
+    }
+
+    auto prefilter_plan = ProtoParser::ExtractFilterOnlyPlan(node.plannodes_);
+    AssertInfo(prefilter_plan != nullptr, "search plan has no pre-filter");
+    auto plan_fragment = plan::PlanFragment(prefilter_plan);
+    auto query_context = std::make_shared<milvus::exec::QueryContext>(
+        DEAFULT_QUERY_ID,
+        segment,
+        active_count,
+        timestamp_,
+        collection_ttl_timestamp_,
+        consistency_level_,
+        node.plan_options_,
+        std::make_shared<milvus::exec::QueryConfig>(),
+        nullptr,
+        std::unordered_map<std::string,
+                           std::shared_ptr<milvus::exec::BaseConfig>>(),
+        entity_ttl_physical_time_us_);
+    if (enable_expr_cache_) {
+        query_context->set_enable_expr_cache(true);
+        query_context->set_enable_sub_expr_cache_write(false);
+    }
+    query_context->set_search_executor(search_executor_);
+    auto op_context = milvus::OpContext(cancel_token_);
+    query_context->set_op_context(&op_context);
+    // cells the batches pin again stay pinned until the query ends
+    PinCache pin_cache(&op_context, QUERY_PIN_CACHE_CAPACITY.load());
+    PinCache::Scope pin_cache_scope(&pin_cache);
+    query_context->set_pin_cache(&pin_cache);
+
+    auto result = ExecuteTask(plan_fragment, query_context);
+    AssertInfo(result != nullptr && result->childrens().size() == 1,
+               "pre-filter of the search returned no bitset");
+    auto bits =
+        std::dynamic_pointer_cast<ColumnVector>(result->childrens()[0]);
+    AssertInfo(bits != nullptr, "failed to cast to ColumnVector");
+    auto prefilter = std::make_shared<exec::SharedPrefilter>();
+    prefilter->bits = std::move(bits);
+    prefilter->all_rows_visible = query_context->get_all_rows_visible();
+    return prefilter;
+}
+
 RowVectorPtr
 ExecPlanNodeVisitor::ExecuteTask(
     plan::PlanFragment& plan,
@@ -51,6 +177,9 @@ ExecPlanNodeVisitor::ExecuteTask(
     tracer::AutoSpan span("ExecuteTask", tracer::GetRootSpan(), true);
     span.GetSpan()->SetAttribute("active_count",
                                  query_context->get_active_count());
+    // turn the query away before it allocates when the node is at its
+    // memory budget
+    milvus::exec::MemoryTracker::Process().CheckAdmission();
 
     LOG_DEBUG("plannode: {}, active_count: {}, timestamp: {}",
               plan.plan_node_->ToString(),
@@ -104,6 +233,13 @@ ExecPlanNodeVisitor::ExecuteTask(
             ret = result;
         }
     }
+    if (query_context->explain_analyze()) {
+        query_context->add_explain_analyze_result(fmt::format(
+            "segment={} active_count={}\n{}",
+            query_context->get_segment()->get_segment_id(),
+            query_context->get_active_count(),
+            task->ExplainAnalyze()));
+    }
     span.GetSpan()->SetAttribute("total_rows", processed_num);
     span.GetSpan()->SetAttribute("matched_rows",
                                  ret ? processed_num - ret->nullCount() : 0);
@@ -277,6 +413,29 @@ ExecPlanNodeVisitor::visit(RetrievePlanNode& node) {
 
     auto active_count = segment->get_active_count(timestamp_);
 
+    // Retrieve by pks: look the rows up and check their visibility one by
+    // one, the collection ttl and a disabled visibility filter need the
+    // masks of the whole segment
+    if (collection_ttl_timestamp_ == 0 &&
+        segcore::SegcoreConfig::default_config()
+            .get_visibility_filter_enabled()) {
+        if (auto pks = PointLookupPks(node, segment->get_schema())) {
+            if (auto offsets = segment->VisiblePkOffsets(*pks, timestamp_)) {
+                tracer::AutoSpan _("Point Lookup Pk", tracer::GetRootSpan());
+                auto limit = node.limit_;
+                if (limit != segcore::Unlimited && limit != segcore::NoLimit &&
+                    static_cast<int64_t>(offsets->size()) > limit) {
+                    offsets->resize(limit);
+                    retrieve_result.has_more_result = true;
+                }
+                retrieve_result.total_data_cnt_ = active_count;
+                retrieve_result.result_offsets_ = std::move(*offsets);
+                retrieve_result_opt_ = std::move(retrieve_result);
+                return;
+            }
+        }
+    }
+
     // Get plan
     auto plan = plan::PlanFragment(node.plannodes_);
 
@@ -296,13 +455,20 @@ ExecPlanNodeVisitor::visit(RetrievePlanNode& node) {
         entity_ttl_physical_time_us_);
 
     // Set op context to query context
+    query_context->set_search_executor(search_executor_);
     auto op_context = milvus::OpContext(cancel_token_);
     query_context->set_op_context(&op_context);
+    // cells the batches pin again stay pinned until the query ends
+    PinCache pin_cache(&op_context, QUERY_PIN_CACHE_CAPACITY.load());
+    PinCache::Scope pin_cache_scope(&pin_cache);
+    query_context->set_pin_cache(&pin_cache);
 
     // Do task execution
     auto result = ExecuteTask(plan, query_context);
     setupRetrieveResult(
         result, op_context, node, retrieve_result, segment, query_context);
+    retrieve_result_opt_->explain_analyze_ =
+        query_context->get_explain_analyze_result();
 }
 
 void
@@ -450,8 +616,13 @@ ExecPlanNodeVisitor::visit(VectorPlanNode& node) {
                 query_context->set_enable_sub_expr_cache_write(false);
             }
 
+            query_context->set_search_executor(search_executor_);
             auto op_context = milvus::OpContext(cancel_token_);
             query_context->set_op_context(&op_context);
+            // cells the batches pin again stay pinned until the query ends
+            PinCache pin_cache(&op_context, QUERY_PIN_CACHE_CAPACITY.load());
+            PinCache::Scope pin_cache_scope(&pin_cache);
+            query_context->set_pin_cache(&pin_cache);
 
             auto result = ExecuteTask(plan_fragment, query_context);
 
@@ -503,14 +674,22 @@ ExecPlanNodeVisitor::visit(VectorPlanNode& node) {
 
     query_context->set_search_info(node.search_info_);
     query_context->set_placeholder_group(placeholder_group_);
+    if (shared_prefilter_ != nullptr) {
+        query_context->set_shared_prefilter(shared_prefilter_);
+    }
     if (enable_expr_cache_) {
         query_context->set_enable_expr_cache(true);
         query_context->set_enable_sub_expr_cache_write(false);
     }
 
     // Set op context to query context
+    query_context->set_search_executor(search_executor_);
     auto op_context = milvus::OpContext(cancel_token_);
     query_context->set_op_context(&op_context);
+    // cells the batches pin again stay pinned until the query ends
+    PinCache pin_cache(&op_context, QUERY_PIN_CACHE_CAPACITY.load());
+    PinCache::Scope pin_cache_scope(&pin_cache);
+    query_context->set_pin_cache(&pin_cache);
 
     // Do plan fragment task work
     auto result = ExecuteTask(plan, query_context);
@@ -521,6 +700,8 @@ ExecPlanNodeVisitor::visit(VectorPlanNode& node) {
         op_context.storage_usage.scanned_cold_bytes.load();
     search_result_opt_->search_storage_cost_.scanned_total_bytes =
         op_context.storage_usage.scanned_total_bytes.load();
+    search_result_opt_->explain_analyze_ =
+        query_context->get_explain_analyze_result();
 }
 
 }  // namespace milvus::query
@@ -16,6 +16,7 @@
 #include <iostream>
 #include <memory>
 #include <optional>
+#include <string>
 #include <type_traits>
 #include <vector>
 
@@ -145,6 +146,32 @@ class ExecPlanNodeVisitor : public PlanNodeVisitor {
         return enable_expr_cache_;
     }
 
+    // The executor the operators spread their work over, nullptr for the
+    // global search executor.
+    ExecPlanNodeVisitor&
+    SetSearchExecutor(folly::CPUThreadPoolExecutor* executor) {
+        search_executor_ = executor;
+        return *this;
+    }
+
+    // The pre-filter of a search, its FilterBitsNode and MvccNode, as a key
+    // equal for the plans computing the same bitset on a segment. nullopt
+    // when the plan has no such pre-filter to share.
+    static std::optional<std::string>
+    SharedPrefilterKey(const VectorPlanNode& node);
+
+    // Runs the pre-filter of `node` alone, nullptr when the segment has no
+    // rows visible at the timestamp
+    std::shared_ptr<const exec::SharedPrefilter>
+    EvalSharedPrefilter(const VectorPlanNode& node);
+
+    // searches then start from `prefilter` instead of evaluating their own
+    ExecPlanNodeVisitor&
+    SetSharedPrefilter(std::shared_ptr<const exec::SharedPrefilter> prefilter) {
+        shared_prefilter_ = std::move(prefilter);
+        return *this;
+    }
+
     static RowVectorPtr
     ExecuteTask(plan::PlanFragment& plan,
                 std::shared_ptr<milvus::exec::QueryContext> query_context);
@@ -173,8 +200,16 @@ class ExecPlanNodeVisitor : public PlanNodeVisitor {
     bool expr_use_pk_index_ = false;
     bool filter_only_ = false;
     bool enable_expr_cache_ = false;
+    std::shared_ptr<const exec::SharedPrefilter> shared_prefilter_{nullptr};
+    folly::CPUThreadPoolExecutor* search_executor_{nullptr};
 };
 
+// Fills `data_array`, created by CreateScalarDataArray for the size and type
+// of `column_vector`, with its values and validity.
+void
+fillDataArrayFromColumnVector(const ColumnVectorPtr& column_vector,
+                              DataArray& data_array);
+
 // for test use only
 inline BitsetType
 ExecuteQueryExpr(std::shared_ptr<milvus::plan::PlanNode> plannode,
@@ -0,0 +1,301 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include "query/MaxSimSearch.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <queue>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "common/EasyAssert.h"
+#include "common/HalfConvert.h"
+#include "common/Utils.h"
+
+namespace milvus::query {
+
+namespace {
+
+// independent partial sums per query vector, wide enough to be vectorized
+constexpr int64_t kLanes = 8;
+// query vectors scored together against each row vector
+constexpr int64_t kQueryTile = 4;
+// rows are scored in blocks of at least this many vectors
+constexpr int64_t kBlockVectors = 256;
+
+// out[t] = <queries[t], x> for the kTile query vectors
+template <int64_t kTile>
+void
+DotTile(const float* const* queries, const float* x, int64_t dim, float* out) {
+    float acc[kTile][kLanes] = {};
+    int64_t k = 0;
+    for (; k + kLanes <= dim; k += kLanes) {
+        for (int64_t t = 0; t < kTile; ++t) {
+            for (int64_t l = 0; l < kLanes; ++l) {
+                acc[t][l] += queries[t][k + l] * x[k + l];
+            }
+        }
+    }
+    for (int64_t t = 0; t < kTile; ++t) {
+        float sum = 0;
+        for (int64_t l = 0; l < kLanes; ++l) {
+            sum += acc[t][l];
+        }
+        for (int64_t r = k; r < dim; ++r) {
+            sum += queries[t][r] * x[r];
+        }
+        out[t] = sum;
+    }
+}
+
+float
+InverseNorm(const float* x, int64_t dim) {
+    float norm = 0;
+    DotTile<1>(&x, x, dim, &norm);
+    return norm > 0 ? 1.0f / std::sqrt(norm) : 0.0f;
+}
+
+// sum over the query vectors of their largest similarity with the row
+// vectors, `scales` holds the inverse norms of the row vectors for cosine
+float
+MaxSimScore(const float* query,
+            int64_t query_vectors,
+            const float* row,
+            int64_t row_vectors,
+            const float* scales,
+            int64_t dim,
+            std::vector<float>& maxima) {
+    maxima.assign(query_vectors, -std::numeric_limits<float>::infinity());
+    for (int64_t t0 = 0; t0 < query_vectors; t0 += kQueryTile) {
+        const auto tile = std::min(kQueryTile, query_vectors - t0);
+        const float* tile_queries[kQueryTile];
+        for (int64_t t = 0; t < tile; ++t) {
+            tile_queries[t] = query + (t0 + t) * dim;
+        }
+        float dots[kQueryTile];
+        for (int64_t j = 0; j < row_vectors; ++j) {
+            const auto* x = row + j * dim;
+            if (tile == kQueryTile) {
+                DotTile<kQueryTile>(tile_queries, x, dim, dots);
+            } else {
+                for (int64_t t = 0; t < tile; ++t) {
+                    DotTile<1>(tile_queries + t, x, dim, dots + t);
+                }
+            }
+            const auto scale = scales == nullptr ? 1.0f : scales[j];
+            for (int64_t t = 0; t < tile; ++t) {
+                maxima[t0 + t] = std::max(maxima[t0 + t], dots[t] * scale);
+            }
+        }
+    }
+    float score = 0;
+    for (auto maximum : maxima) {
+        score += maximum;
+    }
+    return score;
+}
+
+using ScoredRow = std::pair<float, int64_t>;
+
+// orders the best rows first: higher scores, then lower offsets
+struct BetterRow {
+    bool
+    operator()(const ScoredRow& a, const ScoredRow& b) const {
+        return a.first > b.first || (a.first == b.first && a.second < b.second);
+    }
+};
+
+// the worst of the kept rows on top
+using TopRows =
+    std::priority_queue<ScoredRow, std::vector<ScoredRow>, BetterRow>;
+
+}  // namespace
+
+bool
+UseMaxSimKernel(const dataset::SearchDataset& query_ds,
+                const dataset::RawDataset& raw_ds,
+                const MetricType& metric_type,
+                DataType element_type) {
+    return (element_type == DataType::VECTOR_FLOAT ||
+            element_type == DataType::VECTOR_FLOAT16 ||
+            element_type == DataType::VECTOR_BFLOAT16) &&
+           query_ds.query_offsets != nullptr &&
+           raw_ds.raw_data_offsets != nullptr &&
+           (IsMetricType(metric_type, knowhere::metric::MAX_SIM_IP) ||
+            IsMetricType(metric_type, knowhere::metric::MAX_SIM_COSINE));
+}
+
+namespace {
+
+template <typename T>
+void
+MaxSimSearchImpl(const dataset::SearchDataset& query_ds,
+                 const dataset::RawDataset& raw_ds,
+                 const MetricType& metric_type,
+                 const BitsetView& bitset,
+                 int64_t* offsets,
+                 float* distances) {
+    constexpr bool kFloat = std::is_same_v<T, float>;
+    const auto dim = raw_ds.dim;
+    const auto nq = query_ds.num_queries;
+    const auto topk = query_ds.topk;
+    const bool cosine =
+        IsMetricType(metric_type, knowhere::metric::MAX_SIM_COSINE);
+    const auto* rows = static_cast<const T*>(raw_ds.raw_data);
+    const auto* row_offsets = raw_ds.raw_data_offsets;
+    const auto* query_offsets = query_ds.query_offsets;
+
+    // the query vectors are widened and normalized once, the row vectors as
+    // their block is scored
+    const auto* queries = static_cast<const float*>(query_ds.query_data);
+    std::vector<float> widened;
+    if (!kFloat || cosine) {
+        const auto query_vectors = static_cast<int64_t>(query_offsets[nq]);
+        widened.resize(query_vectors * dim);
+        ConvertToFloat(static_cast<const T*>(query_ds.query_data),
+                       widened.data(),
+                       widened.size());
+        if (cosine) {
+            for (int64_t v = 0; v < query_vectors; ++v) {
+                auto* x = widened.data() + v * dim;
+                const auto scale = InverseNorm(x, dim);
+                std::transform(x, x + dim, x, [scale](float value) {
+                    return value * scale;
+                });
+            }
+        }
+        queries = widened.data();
+    }
+
+    std::vector<TopRows> top(nq);
+    std::vector<float> scales;
+    std::vector<float> maxima;
+    std::vector<int64_t> block;
+    // the vectors of the block as floats, for half precision rows
+    std::vector<float> block_data;
+    int64_t row = 0;
+    while (row < raw_ds.num_raw_data) {
+        // the unfiltered rows of the next block
+        block.clear();
+        const auto first_vector = static_cast<int64_t>(row_offsets[row]);
+        while (row < raw_ds.num_raw_data &&
+               static_cast<int64_t>(row_offsets[row]) - first_vector <
+                   kBlockVectors) {
+            const auto id = raw_ds.begin_id + row;
+            const bool filtered = !bitset.empty() &&
+                                  id < static_cast<int64_t>(bitset.size()) &&
+                                  bitset.test(id);
+            if (!filtered && row_offsets[row + 1] > row_offsets[row]) {
+                block.push_back(row);
+            }
+            ++row;
+        }
+        if (block.empty()) {
+            continue;
+        }
+        const auto block_vectors =
+            static_cast<int64_t>(row_offsets[row]) - first_vector;
+        const float* block_rows;
+        if constexpr (kFloat) {
+            block_rows = rows + first_vector * dim;
+        } else {
+            block_data.resize(block_vectors * dim);
+            ConvertToFloat(rows + first_vector * dim,
+                           block_data.data(),
+                           block_data.size());
+            block_rows = block_data.data();
+        }
+        if (cosine) {
+            scales.resize(block_vectors);
+            for (int64_t v = 0; v < block_vectors; ++v) {
+                scales[v] = InverseNorm(block_rows + v * dim, dim);
+            }
+        }
+        for (int64_t q = 0; q < nq; ++q) {
+            const auto* query = queries + query_offsets[q] * dim;
+            const auto query_vectors =
+                static_cast<int64_t>(query_offsets[q + 1] - query_offsets[q]);
+            if (query_vectors == 0) {
+                continue;
+            }
+            auto& heap = top[q];
+            for (auto r : block) {
+                const auto begin =
+                    static_cast<int64_t>(row_offsets[r]) - first_vector;
+                const auto score = MaxSimScore(
+                    query,
+                    query_vectors,
+                    block_rows + begin * dim,
+                    static_cast<int64_t>(row_offsets[r + 1] - row_offsets[r]),
+                    cosine ? scales.data() + begin : nullptr,
+                    dim,
+                    maxima);
+                ScoredRow scored{score, raw_ds.begin_id + r};
+                if (static_cast<int64_t>(heap.size()) < topk) {
+                    heap.push(scored);
+                } else if (BetterRow{}(scored, heap.top())) {
+                    heap.pop();
+                    heap.push(scored);
+                }
+            }
+        }
+    }
+
+    for (int64_t q = 0; q < nq; ++q) {
+        auto& heap = top[q];
+        // popped worst first
+        for (auto slot = static_cast<int64_t>(heap.size()) - 1; slot >= 0;
+             --slot) {
+            offsets[q * topk + slot] = heap.top().second;
+            distances[q * topk + slot] = heap.top().first;
+            heap.pop();
+        }
+    }
+}
+
+}  // namespace
+
+void
+MaxSimSearch(const dataset::SearchDataset& query_ds,
+             const dataset::RawDataset& raw_ds,
+             const MetricType& metric_type,
+             DataType element_type,
+             const BitsetView& bitset,
+             int64_t* offsets,
+             float* distances) {
+    AssertInfo(query_ds.dim == raw_ds.dim,
+               "query dim {} differs from the data dim {}",
+               query_ds.dim,
+               raw_ds.dim);
+    switch (element_type) {
+        case DataType::VECTOR_FLOAT:
+            MaxSimSearchImpl<float>(
+                query_ds, raw_ds, metric_type, bitset, offsets, distances);
+            break;
+        case DataType::VECTOR_FLOAT16:
+            MaxSimSearchImpl<float16>(
+                query_ds, raw_ds, metric_type, bitset, offsets, distances);
+            break;
+        case DataType::VECTOR_BFLOAT16:
+            MaxSimSearchImpl<bfloat16>(
+                query_ds, raw_ds, metric_type, bitset, offsets, distances);
+            break;
+        default:
+            ThrowInfo(ErrorCode::Unsupported,
+                      "max sim search of {} vectors",
+                      element_type);
+    }
+}
+
+}  // namespace milvus::query
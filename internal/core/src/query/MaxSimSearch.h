@@ -0,0 +1,51 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#pragma once
+
+#include <cstdint>
+
+#include "common/BitsetView.h"
+#include "common/Types.h"
+#include "query/helper.h"
+
+namespace milvus::query {
+
+// Whether MaxSimSearch serves a brute force search: embedding lists of
+// float, float16 or bfloat16 vectors searched by embedding lists with
+// MAX_SIM_IP or MAX_SIM_COSINE.
+bool
+UseMaxSimKernel(const dataset::SearchDataset& query_ds,
+                const dataset::RawDataset& raw_ds,
+                const MetricType& metric_type,
+                DataType element_type);
+
+// Top-k brute force search of the embedding lists of raw_ds by the ones of
+// query_ds. The score of a list is the sum, over the query vectors, of their
+// largest similarity with its vectors.
+//
+// The rows are scored in blocks that stay in cache while every query goes
+// through them, four query vectors at a time against each row vector, and
+// the per query vector maxima are kept as the similarities are computed
+// instead of materializing them. Rows set in `bitset`, at begin_id + row,
+// are skipped. Half precision vectors are widened a block at a time as it is
+// scored. Writes num_queries * topk offsets and distances, best first;
+// slots past the rows found are left as they are.
+void
+MaxSimSearch(const dataset::SearchDataset& query_ds,
+             const dataset::RawDataset& raw_ds,
+             const MetricType& metric_type,
+             DataType element_type,
+             const BitsetView& bitset,
+             int64_t* offsets,
+             float* distances);
+
+}  // namespace milvus::query
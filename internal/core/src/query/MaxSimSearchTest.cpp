@@ -0,0 +1,254 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "common/BitsetView.h"
+#include "common/Types.h"
+#include "query/MaxSimSearch.h"
+#include "query/helper.h"
+
+using namespace milvus;
+using namespace milvus::query;
+
+namespace {
+
+constexpr int64_t kDim = 19;
+
+struct EmbLists {
+    std::vector<float> vectors;
+    std::vector<size_t> offsets{0};
+};
+
+EmbLists
+RandomLists(int64_t count, int64_t max_vectors, std::mt19937& gen) {
+    std::uniform_int_distribution<int64_t> length(0, max_vectors);
+    std::normal_distribution<float> value;
+    EmbLists lists;
+    for (int64_t i = 0; i < count; ++i) {
+        auto n = length(gen);
+        for (int64_t j = 0; j < n * kDim; ++j) {
+            lists.vectors.push_back(value(gen));
+        }
+        lists.offsets.push_back(lists.offsets.back() + n);
+    }
+    return lists;
+}
+
+float
+Similarity(const float* a, const float* b, bool cosine) {
+    double dot = 0, norm_a = 0, norm_b = 0;
+    for (int64_t k = 0; k < kDim; ++k) {
+        dot += a[k] * b[k];
+        norm_a += a[k] * a[k];
+        norm_b += b[k] * b[k];
+    }
+    return cosine ? dot / std::sqrt(norm_a * norm_b) : dot;
+}
+
+float
+ReferenceScore(const EmbLists& queries,
+               int64_t q,
+               const EmbLists& rows,
+               int64_t r,
+               bool cosine) {
+    float score = 0;
+    for (auto i = queries.offsets[q]; i < queries.offsets[q + 1]; ++i) {
+        float best = -std::numeric_limits<float>::infinity();
+        for (auto j = rows.offsets[r]; j < rows.offsets[r + 1]; ++j) {
+            best = std::max(best,
+                            Similarity(queries.vectors.data() + i * kDim,
+                                       rows.vectors.data() + j * kDim,
+                                       cosine));
+        }
+        score += best;
+    }
+    return score;
+}
+
+}  // namespace
+
+TEST(MaxSimSearch, MatchesPairwiseScores) {
+    std::mt19937 gen(42);
+    constexpr int64_t kRows = 300;
+    constexpr int64_t kQueries = 3;
+    constexpr int64_t kTopk = 7;
+    constexpr int64_t kBeginId = 100;
+    auto rows = RandomLists(kRows, 12, gen);
+    auto queries = RandomLists(kQueries, 9, gen);
+    // every query has vectors
+    queries.offsets = {0, 1, 5, 14};
+    queries.vectors.resize(14 * kDim, 0.5f);
+
+    // filter every third row
+    TargetBitmap filter(kBeginId + kRows, false);
+    for (int64_t r = 0; r < kRows; r += 3) {
+        filter[kBeginId + r] = true;
+    }
+
+    dataset::SearchDataset query_ds{knowhere::metric::MAX_SIM_IP,
+                                    kQueries,
+                                    kTopk,
+                                    -1,
+                                    kDim,
+                                    queries.vectors.data(),
+                                    queries.offsets.data()};
+    dataset::RawDataset raw_ds{
+        kBeginId, kDim, kRows, rows.vectors.data(), rows.offsets.data()};
+    ASSERT_TRUE(UseMaxSimKernel(query_ds,
+                                raw_ds,
+                                knowhere::metric::MAX_SIM_IP,
+                                DataType::VECTOR_FLOAT));
+    ASSERT_FALSE(UseMaxSimKernel(
+        query_ds, raw_ds, knowhere::metric::L2, DataType::VECTOR_FLOAT));
+
+    for (bool cosine : {false, true}) {
+        const auto metric = cosine ? knowhere::metric::MAX_SIM_COSINE
+                                   : knowhere::metric::MAX_SIM_IP;
+        std::vector<int64_t> offsets(kQueries * kTopk, -1);
+        std::vector<float> distances(kQueries * kTopk, 0);
+        MaxSimSearch(query_ds,
+                     raw_ds,
+                     metric,
+                     DataType::VECTOR_FLOAT,
+                     BitsetView(filter),
+                     offsets.data(),
+                     distances.data());
+
+        for (int64_t q = 0; q < kQueries; ++q) {
+            std::vector<std::pair<float, int64_t>> expected;
+            for (int64_t r = 0; r < kRows; ++r) {
+                if (r % 3 != 0 && rows.offsets[r + 1] > rows.offsets[r]) {
+                    expected.emplace_back(
+                        ReferenceScore(queries, q, rows, r, cosine), r);
+                }
+            }
+            std::sort(expected.begin(), expected.end(), [](auto a, auto b) {
+                return a.first > b.first;
+            });
+            for (int64_t k = 0; k < kTopk; ++k) {
+                auto id = offsets[q * kTopk + k];
+                ASSERT_GE(id, kBeginId);
+                auto row = id - kBeginId;
+                EXPECT_NE(row % 3, 0);
+                EXPECT_NEAR(distances[q * kTopk + k],
+                            ReferenceScore(queries, q, rows, row, cosine),
+                            1e-3);
+                EXPECT_NEAR(
+                    distances[q * kTopk + k], expected[k].first, 1e-3);
+            }
+        }
+    }
+}
+
+TEST(MaxSimSearch, LeavesSlotsPastTheRowsFound) {
+    EmbLists rows;
+    rows.offsets = {0, 2, 3};
+    rows.vectors.assign(3 * kDim, 1.0f);
+    EmbLists queries;
+    queries.offsets = {0, 2};
+    queries.vectors.assign(2 * kDim, 1.0f);
+
+    dataset::SearchDataset query_ds{knowhere::metric::MAX_SIM_IP,
+                                    1,
+                                    4,
+                                    -1,
+                                    kDim,
+                                    queries.vectors.data(),
+                                    queries.offsets.data()};
+    dataset::RawDataset raw_ds{
+        0, kDim, 2, rows.vectors.data(), rows.offsets.data()};
+    std::vector<int64_t> offsets(4, -1);
+    std::vector<float> distances(4, 0);
+    MaxSimSearch(query_ds,
+                 raw_ds,
+                 knowhere::metric::MAX_SIM_IP,
+                 DataType::VECTOR_FLOAT,
+                 BitsetView{},
+                 offsets.data(),
+                 distances.data());
+    // equal scores, the lower offset first
+    EXPECT_EQ(offsets[0], 0);
+    EXPECT_EQ(offsets[1], 1);
+    EXPECT_FLOAT_EQ(distances[0], 2 * kDim);
+    EXPECT_FLOAT_EQ(distances[1], 2 * kDim);
+    EXPECT_EQ(offsets[2], -1);
+    EXPECT_EQ(offsets[3], -1);
+}
+
+TEST(MaxSimSearch, WidensHalfPrecisionVectors) {
+    std::mt19937 gen(7);
+    constexpr int64_t kRows = 600;
+    constexpr int64_t kTopk = 5;
+    auto rows = RandomLists(kRows, 6, gen);
+    auto queries = RandomLists(2, 4, gen);
+    queries.offsets = {0, 3, 7};
+    queries.vectors.resize(7 * kDim, 0.25f);
+
+    // the float reference searches the values the half types hold
+    auto search = [&](const void* row_data,
+                      const void* query_data,
+                      DataType element_type) {
+        dataset::SearchDataset query_ds{knowhere::metric::MAX_SIM_COSINE,
+                                        2,
+                                        kTopk,
+                                        -1,
+                                        kDim,
+                                        query_data,
+                                        queries.offsets.data()};
+        dataset::RawDataset raw_ds{
+            0, kDim, kRows, row_data, rows.offsets.data()};
+        EXPECT_TRUE(UseMaxSimKernel(query_ds,
+                                    raw_ds,
+                                    knowhere::metric::MAX_SIM_COSINE,
+                                    element_type));
+        std::vector<int64_t> offsets(2 * kTopk, -1);
+        std::vector<float> distances(2 * kTopk, 0);
+        MaxSimSearch(query_ds,
+                     raw_ds,
+                     knowhere::metric::MAX_SIM_COSINE,
+                     element_type,
+                     BitsetView{},
+                     offsets.data(),
+                     distances.data());
+        return std::make_pair(offsets, distances);
+    };
+    auto check = [&](auto half) {
+        using Half = decltype(half);
+        std::vector<Half> half_rows(rows.vectors.begin(), rows.vectors.end());
+        std::vector<Half> half_queries(queries.vectors.begin(),
+                                       queries.vectors.end());
+        std::vector<float> row_values(half_rows.begin(), half_rows.end());
+        std::vector<float> query_values(half_queries.begin(),
+                                        half_queries.end());
+        auto element_type = std::is_same_v<Half, float16>
+                                ? DataType::VECTOR_FLOAT16
+                                : DataType::VECTOR_BFLOAT16;
+        auto [offsets, distances] =
+            search(half_rows.data(), half_queries.data(), element_type);
+        auto [expected_offsets, expected_distances] = search(
+            row_values.data(), query_values.data(), DataType::VECTOR_FLOAT);
+        EXPECT_EQ(offsets, expected_offsets);
+        for (int64_t k = 0; k < 2 * kTopk; ++k) {
+            EXPECT_NEAR(distances[k], expected_distances[k], 1e-4);
+        }
+    };
+    check(float16{});
+    check(bfloat16{});
+}
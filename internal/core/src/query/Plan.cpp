@@ -19,6 +19,7 @@
 #include <cstddef>
 #include <limits>
 #include <map>
+#include <openssl/sha.h>
 #include <string>
 #include <utility>
 #include <vector>
@@ -32,15 +33,33 @@
 #include "knowhere/emb_list_utils.h"
 #include "common/protobuf_utils.h"
 #include "fmt/core.h"
+#include "google/protobuf/arena.h"
 #include "google/protobuf/io/coded_stream.h"
 #include "google/protobuf/io/zero_copy_stream_impl_lite.h"
 #include "pb/common.pb.h"
 #include "pb/plan.pb.h"
 #include "query/PlanImpl.h"
 #include "query/PlanNode.h"
+#include "segcore/SearchResultCache.h"
 
 namespace milvus::query {
 
+namespace {
+
+// the key of the search result cache, skipped while the cache is off since
+// placeholder groups of a large nq take a while to digest
+std::optional<BlobDigest>
+DigestForResultCache(const void* blob, int64_t size) {
+    if (!segcore::SearchResultCache::IsEnabled()) {
+        return std::nullopt;
+    }
+    BlobDigest digest;
+    SHA256(static_cast<const unsigned char*>(blob), size, digest.data());
+    return digest;
+}
+
+}  // namespace
+
 // deprecated
 std::unique_ptr<PlaceholderGroup>
 ParsePlaceholderGroup(const Plan* plan,
@@ -124,6 +143,7 @@ ParsePlaceholderGroup(const Plan* plan,
                       const uint8_t* blob,
                       const int64_t blob_len) {
     auto result = std::make_unique<PlaceholderGroup>();
+    result->blob_digest_ = DigestForResultCache(blob, blob_len);
     milvus::proto::common::PlaceholderGroup ph_group;
     auto ok = ph_group.ParseFromArray(blob, blob_len);
     Assert(ok);
@@ -250,9 +270,16 @@ CreateSearchPlanByExpr(SchemaPtr schema,
                        const void* serialized_expr_plan,
                        const int64_t size) {
     // Note: serialized_expr_plan is of binary format
-    proto::plan::PlanNode plan_node;
-    ParsePlanNodeProto(plan_node, serialized_expr_plan, size);
-    return ProtoParser(std::move(schema)).CreatePlan(plan_node);
+    // the plan proto only lives until the plan is created from it, so its
+    // sub-messages and strings, e.g. the values of a large IN list, are
+    // parsed into an arena freed at once
+    google::protobuf::Arena arena;
+    auto plan_node =
+        google::protobuf::Arena::Create<proto::plan::PlanNode>(&arena);
+    ParsePlanNodeProto(*plan_node, serialized_expr_plan, size);
+    auto plan = ProtoParser(std::move(schema)).CreatePlan(*plan_node);
+    plan->plan_digest_ = DigestForResultCache(serialized_expr_plan, size);
+    return plan;
 }
 
 std::unique_ptr<Plan>
@@ -265,9 +292,11 @@ std::unique_ptr<RetrievePlan>
 CreateRetrievePlanByExpr(SchemaPtr schema,
                          const void* serialized_expr_plan,
                          const int64_t size) {
-    proto::plan::PlanNode plan_node;
-    ParsePlanNodeProto(plan_node, serialized_expr_plan, size);
-    return ProtoParser(std::move(schema)).CreateRetrievePlan(plan_node);
+    google::protobuf::Arena arena;
+    auto plan_node =
+        google::protobuf::Arena::Create<proto::plan::PlanNode>(&arena);
+    ParsePlanNodeProto(*plan_node, serialized_expr_plan, size);
+    return ProtoParser(std::move(schema)).CreateRetrievePlan(*plan_node);
 }
 
 int64_t
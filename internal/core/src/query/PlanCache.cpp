@@ -0,0 +1,164 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "query/PlanCache.h"
+
+#include <string_view>
+
+#include "common/Common.h"
+#include "query/Plan.h"
+#include "query/PlanNode.h"
+#include "xxhash.h"
+
+namespace milvus::query {
+
+namespace {
+
+// a plan of its own sharing the expression tree of `plan`, the callers go on
+// to set fields of the search info
+std::unique_ptr<Plan>
+CopyPlan(const Plan& plan) {
+    auto copy = std::make_unique<Plan>(plan.schema_);
+    copy->plan_node_ = std::make_unique<VectorPlanNode>(*plan.plan_node_);
+    copy->tag2field_ = plan.tag2field_;
+    copy->target_entries_ = plan.target_entries_;
+    copy->target_dynamic_fields_ = plan.target_dynamic_fields_;
+    copy->plan_digest_ = plan.plan_digest_;
+    copy->extra_info_opt_ = plan.extra_info_opt_;
+    return copy;
+}
+
+std::unique_ptr<RetrievePlan>
+CopyPlan(const RetrievePlan& plan) {
+    auto copy = std::make_unique<RetrievePlan>(plan.schema_);
+    if (plan.plan_node_) {
+        copy->plan_node_ =
+            std::make_unique<RetrievePlanNode>(*plan.plan_node_);
+    }
+    copy->field_ids_ = plan.field_ids_;
+    copy->target_dynamic_fields_ = plan.target_dynamic_fields_;
+    return copy;
+}
+
+}  // namespace
+
+std::unique_ptr<Plan>
+PlanCache::GetSearchPlan(const SchemaPtr& schema,
+                         const void* blob,
+                         int64_t size) {
+    auto capacity = PLAN_CACHE_CAPACITY.load();
+    if (capacity <= 0) {
+        return CreateSearchPlanByExpr(schema, blob, size);
+    }
+    std::string_view bytes(static_cast<const char*>(blob), size);
+    Key key{false, XXH64(blob, size, 0)};
+    std::shared_ptr<const Plan> cached;
+    {
+        std::lock_guard lck(mutex_);
+        if (auto entry = Lookup(key, schema, bytes)) {
+            cached = entry->search;
+        }
+    }
+    if (cached) {
+        return CopyPlan(*cached);
+    }
+
+    auto plan = CreateSearchPlanByExpr(schema, blob, size);
+    Entry entry;
+    entry.bytes = std::string(bytes);
+    entry.schema = schema;
+    entry.search = CopyPlan(*plan);
+    Insert(key, std::move(entry), capacity);
+    return plan;
+}
+
+std::unique_ptr<RetrievePlan>
+PlanCache::GetRetrievePlan(const SchemaPtr& schema,
+                           const void* blob,
+                           int64_t size) {
+    auto capacity = PLAN_CACHE_CAPACITY.load();
+    if (capacity <= 0) {
+        return CreateRetrievePlanByExpr(schema, blob, size);
+    }
+    std::string_view bytes(static_cast<const char*>(blob), size);
+    Key key{true, XXH64(blob, size, 0)};
+    std::shared_ptr<const RetrievePlan> cached;
+    {
+        std::lock_guard lck(mutex_);
+        if (auto entry = Lookup(key, schema, bytes)) {
+            cached = entry->retrieve;
+        }
+    }
+    if (cached) {
+        return CopyPlan(*cached);
+    }
+
+    auto plan = CreateRetrievePlanByExpr(schema, blob, size);
+    Entry entry;
+    entry.bytes = std::string(bytes);
+    entry.schema = schema;
+    entry.retrieve = CopyPlan(*plan);
+    Insert(key, std::move(entry), capacity);
+    return plan;
+}
+
+size_t
+PlanCache::size() const {
+    std::lock_guard lck(mutex_);
+    return entries_.size();
+}
+
+void
+PlanCache::Clear() {
+    std::lock_guard lck(mutex_);
+    entries_.clear();
+    lru_.clear();
+}
+
+const PlanCache::Entry*
+PlanCache::Lookup(const Key& key,
+                  const SchemaPtr& schema,
+                  std::string_view bytes) {
+    auto it = entries_.find(key);
+    if (it == entries_.end()) {
+        return nullptr;
+    }
+    auto& entry = it->second->second;
+    // a colliding hash or an older schema, the new plan replaces it
+    if (entry.schema != schema || entry.bytes != bytes) {
+        return nullptr;
+    }
+    lru_.splice(lru_.end(), lru_, it->second);
+    return &entry;
+}
+
+void
+PlanCache::Insert(const Key& key, Entry entry, int64_t capacity) {
+    std::lock_guard lck(mutex_);
+    auto it = entries_.find(key);
+    if (it != entries_.end()) {
+        lru_.erase(it->second);
+        entries_.erase(it);
+    }
+    while (!lru_.empty() && static_cast<int64_t>(lru_.size()) >= capacity) {
+        entries_.erase(lru_.front().first);
+        lru_.pop_front();
+    }
+    lru_.emplace_back(key, std::move(entry));
+    entries_.emplace(key, std::prev(lru_.end()));
+}
+
+}  // namespace milvus::query
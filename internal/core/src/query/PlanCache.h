@@ -0,0 +1,79 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "common/Schema.h"
+#include "query/PlanImpl.h"
+
+namespace milvus::query {
+
+// The parsed plans of a collection by their serialized bytes. A workload
+// runs a few hundred distinct query templates at most, each parsed again
+// for every request; a hit copies the cached plan instead, sharing its
+// immutable expression tree, so only the per-request fields are new.
+//
+// An entry is bound to the schema it was parsed with, a schema update
+// parses the plan again. The capacity in entries is PLAN_CACHE_CAPACITY,
+// 0 parses every plan.
+class PlanCache {
+ public:
+    std::unique_ptr<Plan>
+    GetSearchPlan(const SchemaPtr& schema, const void* blob, int64_t size);
+
+    std::unique_ptr<RetrievePlan>
+    GetRetrievePlan(const SchemaPtr& schema, const void* blob, int64_t size);
+
+    size_t
+    size() const;
+
+    void
+    Clear();
+
+ private:
+    struct Entry {
+        std::string bytes;
+        SchemaPtr schema;
+        std::shared_ptr<const Plan> search;
+        std::shared_ptr<const RetrievePlan> retrieve;
+    };
+    // is a retrieve plan, hash of the bytes
+    using Key = std::pair<bool, uint64_t>;
+
+    // the cached entry of `key` for these bytes and schema, nullptr if none,
+    // with mutex_ held
+    const Entry*
+    Lookup(const Key& key, const SchemaPtr& schema, std::string_view bytes);
+
+    void
+    Insert(const Key& key, Entry entry, int64_t capacity);
+
+    mutable std::mutex mutex_;
+    // least recently used first
+    std::list<std::pair<Key, Entry>> lru_;
+    std::map<Key, std::list<std::pair<Key, Entry>>::iterator> entries_;
+};
+
+}  // namespace milvus::query
@@ -0,0 +1,143 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+#include "common/Common.h"
+#include "common/Schema.h"
+#include "common/Types.h"
+#include "knowhere/comp/index_param.h"
+#include "pb/plan.pb.h"
+#include "query/PlanCache.h"
+#include "query/PlanImpl.h"
+#include "query/PlanNode.h"
+
+using milvus::query::PlanCache;
+
+namespace {
+
+milvus::SchemaPtr
+BuildSchema() {
+    auto schema = std::make_shared<milvus::Schema>();
+    schema->AddDebugField(
+        "fakevec", milvus::DataType::VECTOR_FLOAT, 16, knowhere::metric::L2);
+    auto i64_fid = schema->AddDebugField("age", milvus::DataType::INT64);
+    schema->set_primary_field_id(i64_fid);
+    return schema;
+}
+
+std::string
+SearchPlanBytes(int64_t topk) {
+    milvus::proto::plan::PlanNode plan_node;
+    auto* vector_anns = plan_node.mutable_vector_anns();
+    vector_anns->set_vector_type(milvus::proto::plan::VectorType::FloatVector);
+    vector_anns->set_placeholder_tag("$0");
+    vector_anns->set_field_id(100);
+    auto* query_info = vector_anns->mutable_query_info();
+    query_info->set_topk(topk);
+    query_info->set_round_decimal(-1);
+    query_info->set_search_params("{}");
+    return plan_node.SerializeAsString();
+}
+
+std::string
+RetrievePlanBytes() {
+    milvus::proto::plan::PlanNode plan_node;
+    auto* query = plan_node.mutable_query();
+    query->mutable_predicates()->mutable_always_true_expr();
+    query->set_limit(10);
+    plan_node.add_output_field_ids(101);
+    return plan_node.SerializeAsString();
+}
+
+class PlanCacheTest : public ::testing::Test {
+ protected:
+    void
+    TearDown() override {
+        milvus::PLAN_CACHE_CAPACITY.store(milvus::DEFAULT_PLAN_CACHE_CAPACITY);
+    }
+};
+
+}  // namespace
+
+TEST_F(PlanCacheTest, CopiesCachedSearchPlans) {
+    PlanCache cache;
+    auto schema = BuildSchema();
+    auto bytes = SearchPlanBytes(10);
+
+    auto first = cache.GetSearchPlan(schema, bytes.data(), bytes.size());
+    first->plan_node_->search_info_.metric_type_ = knowhere::metric::IP;
+    auto second = cache.GetSearchPlan(schema, bytes.data(), bytes.size());
+    EXPECT_EQ(cache.size(), 1);
+    // the expression tree is shared, the search info is the request's own
+    EXPECT_EQ(first->plan_node_->plannodes_, second->plan_node_->plannodes_);
+    EXPECT_EQ(second->plan_node_->search_info_.topk_, 10);
+    EXPECT_TRUE(second->plan_node_->search_info_.metric_type_.empty());
+    EXPECT_EQ(first->plan_digest_, second->plan_digest_);
+
+    // other bytes and other schemas parse again
+    auto other_bytes = SearchPlanBytes(20);
+    auto other = cache.GetSearchPlan(schema, other_bytes.data(),
+                                     other_bytes.size());
+    EXPECT_EQ(other->plan_node_->search_info_.topk_, 20);
+    EXPECT_EQ(cache.size(), 2);
+    auto new_schema = BuildSchema();
+    auto reparsed = cache.GetSearchPlan(new_schema, bytes.data(), bytes.size());
+    EXPECT_NE(reparsed->plan_node_->plannodes_,
+              second->plan_node_->plannodes_);
+    EXPECT_EQ(reparsed->schema_, new_schema);
+    EXPECT_EQ(cache.size(), 2);
+}
+
+TEST_F(PlanCacheTest, CachesRetrievePlansApart) {
+    PlanCache cache;
+    auto schema = BuildSchema();
+    auto bytes = RetrievePlanBytes();
+
+    auto first = cache.GetRetrievePlan(schema, bytes.data(), bytes.size());
+    auto second = cache.GetRetrievePlan(schema, bytes.data(), bytes.size());
+    EXPECT_EQ(cache.size(), 1);
+    EXPECT_EQ(first->plan_node_->plannodes_, second->plan_node_->plannodes_);
+    EXPECT_EQ(second->field_ids_, first->field_ids_);
+    EXPECT_EQ(second->plan_node_->limit_, first->plan_node_->limit_);
+}
+
+TEST_F(PlanCacheTest, EvictsLeastRecentlyUsed) {
+    milvus::PLAN_CACHE_CAPACITY.store(2);
+    PlanCache cache;
+    auto schema = BuildSchema();
+    auto a = SearchPlanBytes(1);
+    auto b = SearchPlanBytes(2);
+    auto c = SearchPlanBytes(3);
+
+    auto plan_a = cache.GetSearchPlan(schema, a.data(), a.size());
+    cache.GetSearchPlan(schema, b.data(), b.size());
+    // a is used again, so b goes for c
+    cache.GetSearchPlan(schema, a.data(), a.size());
+    cache.GetSearchPlan(schema, c.data(), c.size());
+    EXPECT_EQ(cache.size(), 2);
+    EXPECT_EQ(cache.GetSearchPlan(schema, a.data(), a.size())
+                  ->plan_node_->plannodes_,
+              plan_a->plan_node_->plannodes_);
+
+    milvus::PLAN_CACHE_CAPACITY.store(0);
+    cache.Clear();
+    cache.GetSearchPlan(schema, a.data(), a.size());
+    EXPECT_EQ(cache.size(), 0);
+}
@@ -11,6 +11,8 @@
 
 #pragma once
 
+#include <array>
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <optional>
@@ -29,6 +31,8 @@ namespace milvus::query {
 
 using Json = nlohmann::json;
 
+using BlobDigest = std::array<uint8_t, 32>;
+
 struct ExtractedPlanInfo {
  public:
     explicit ExtractedPlanInfo(int64_t size) : involved_fields_(size) {
@@ -59,6 +63,11 @@ struct Plan {
     std::map<std::string, FieldId> tag2field_;  // PlaceholderName -> FieldId
     std::vector<FieldId> target_entries_;
     std::vector<std::string> target_dynamic_fields_;
+    // SHA-256 of the serialized plan, only computed while the search result
+    // cache is enabled and the plan is built from bytes
+    std::optional<BlobDigest> plan_digest_;
+    // search executor of the collection, empty for the global one
+    std::string search_pool_;
     void
     check_identical(Plan& other);
 
@@ -124,12 +133,17 @@ struct RetrievePlan {
     std::unique_ptr<RetrievePlanNode> plan_node_;
     std::vector<FieldId> field_ids_;
     std::vector<std::string> target_dynamic_fields_;
+    // search executor of the collection, empty for the global one
+    std::string search_pool_;
 };
 
 using PlanPtr = std::unique_ptr<Plan>;
 
 struct PlaceholderGroup : std::vector<Placeholder> {
     using std::vector<Placeholder>::vector;
+    // SHA-256 of the serialized placeholder group, only computed while the
+    // search result cache is enabled
+    std::optional<BlobDigest> blob_digest_;
 };
 
 }  // namespace milvus::query
@@ -30,6 +30,9 @@ class PlanNodeVisitor;
 
 struct PlanOptions {
     bool expr_use_json_stats = true;
+    // collect per-operator runtime stats and return them as an EXPLAIN
+    // ANALYZE style tree with the search/retrieve result
+    bool explain_analyze = false;
 };
 
 // Base of all Nodes
@@ -69,6 +72,12 @@ struct RetrievePlanNode : PlanNode {
     // Field IDs for pipeline columns in the same order as the ProjectNode output.
     // Used by FillOrderByResult to set field_id on DataArrays produced by the pipeline.
     std::vector<FieldId> pipeline_field_ids_;
+    // Number of leading pipeline columns (pk and ORDER BY fields) the
+    // cross-segment merge needs; the columns after them are output only.
+    // With ignore_non_pk, Retrieve returns just these and RetrieveByOffsets
+    // fetches the rest for the offsets that survive the merge. 0 means all
+    // pipeline columns lead.
+    int64_t order_by_column_count_ = 0;
     std::optional<QueryIteratorCursor> query_iterator_cursor_;
 };
 
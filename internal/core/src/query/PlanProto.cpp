@@ -61,8 +61,10 @@ ProtoParser::PlanOptionsFromProto(
     const proto::plan::PlanOption& plan_option_proto,
     PlanOptions& plan_options) {
     plan_options.expr_use_json_stats = plan_option_proto.expr_use_json_stats();
-    LOG_TRACE("plan_options.expr_use_json_stats: {}",
-              plan_options.expr_use_json_stats);
+    plan_options.explain_analyze = plan_option_proto.explain_analyze();
+    LOG_TRACE("plan_options.expr_use_json_stats: {}, explain_analyze: {}",
+              plan_options.expr_use_json_stats,
+              plan_options.explain_analyze);
 }
 
 expr::TypedExprPtr
@@ -235,6 +237,10 @@ getAggregateOpName(planpb::AggregateOp op) {
             return "min";
         case planpb::max:
             return "max";
+        case planpb::approx_count_distinct:
+            return KApproxCountDistinct;
+        case planpb::approx_percentile:
+            return KApproxPercentile;
         default:
             ThrowInfo(OpTypeInvalid, "Unknown op type for aggregation");
     }
@@ -341,6 +347,41 @@ ProcessAggregates(const proto::plan::QueryPlanNode& query,
     }
 }
 
+// Helper function to decide whether a global aggregation can be answered
+// from per-chunk skip index min/max: only count(*), min and max over
+// integer and varchar fields, with at least one min or max.
+bool
+CanPushdownChunkMinMax(
+    const std::vector<expr::FieldAccessTypeExprPtr>& groupingKeys,
+    const std::vector<std::string>& agg_names,
+    const std::vector<plan::AggregationNode::Aggregate>& aggregates) {
+    if (!groupingKeys.empty()) {
+        return false;
+    }
+    bool has_min_max = false;
+    for (size_t i = 0; i < agg_names.size(); i++) {
+        const auto& input_types = aggregates[i].rawInputTypes_;
+        if (agg_names[i] == KCount && input_types.empty()) {
+            continue;
+        }
+        if (agg_names[i] != KMin && agg_names[i] != KMax) {
+            return false;
+        }
+        switch (input_types.at(0)) {
+            case DataType::INT8:
+            case DataType::INT16:
+            case DataType::INT32:
+            case DataType::INT64:
+            case DataType::VARCHAR:
+                has_min_max = true;
+                break;
+            default:
+                return false;
+        }
+    }
+    return has_min_max;
+}
+
 // Helper function to build ProjectNode and AggregationNode
 plan::PlanNodePtr
 BuildProjectAndAggregationNodes(
@@ -366,7 +407,8 @@ BuildProjectAndAggregationNodes(
             std::move(project_field_id_list),
             std::move(project_name_list),
             std::move(project_type_list),
-            sources);
+            sources,
+            CanPushdownChunkMinMax(groupingKeys, agg_names, aggregates));
     }
 
     // Build AggregationNode
@@ -379,14 +421,53 @@ BuildProjectAndAggregationNodes(
         std::move(aggregates),
         agg_sources);
 }
+// Helper function to decide whether the ORDER BY rows can be projected in
+// the order of a sorted scalar index: a single non-nullable key of a type
+// such an index is built for, with a limit, over document level rows.
+std::optional<plan::IndexOrderedProject>
+IndexOrderedProjectFor(const proto::plan::QueryPlanNode& query,
+                       const SchemaPtr& schema,
+                       bool is_element_level) {
+    if (is_element_level || query.order_by_fields_size() != 1 ||
+        query.limit() <= 0) {
+        return std::nullopt;
+    }
+    const auto& order_by_field = query.order_by_fields(0);
+    auto field_id = FieldId(order_by_field.field_id());
+    const auto& field_meta = (*schema)[field_id];
+    if (field_meta.is_nullable()) {
+        return std::nullopt;
+    }
+    switch (field_meta.get_data_type()) {
+        case DataType::INT8:
+        case DataType::INT16:
+        case DataType::INT32:
+        case DataType::INT64:
+        case DataType::FLOAT:
+        case DataType::DOUBLE:
+        case DataType::VARCHAR:
+        case DataType::STRING:
+            return plan::IndexOrderedProject{
+                field_id, order_by_field.ascending(), query.limit()};
+        default:
+            return std::nullopt;
+    }
+}
+
 // Helper function to build ProjectNode for ORDER BY queries.
-// Returns {ProjectNode, deferred_field_ids, pipeline_field_ids}.
+// Returns {ProjectNode, deferred_field_ids, pipeline_field_ids,
+// order_by_column_count}.
 // deferred_field_ids is empty for single-project mode (all columns materialized
 // in the first project), or non-empty for two-project mode (variable-width
 // non-sort output columns deferred until after TopK).
 // pipeline_field_ids mirrors project_ids so FillOrderByResult can stamp
 // the correct field_id on each DataArray produced by the pipeline.
-std::tuple<plan::PlanNodePtr, std::vector<FieldId>, std::vector<FieldId>>
+// order_by_column_count is the number of leading [pk, orderby_fields]
+// columns.
+std::tuple<plan::PlanNodePtr,
+           std::vector<FieldId>,
+           std::vector<FieldId>,
+           int64_t>
 BuildOrderByProjectNode(const proto::plan::QueryPlanNode& query,
                         const planpb::PlanNode& plan_node_proto,
                         const SchemaPtr& schema,
@@ -421,6 +502,8 @@ BuildOrderByProjectNode(const proto::plan::QueryPlanNode& query,
         }
     }
 
+    auto order_by_column_count = static_cast<int64_t>(project_ids.size());
+
     // Collect non-sort output fields and check for variable-width types.
     // Skip system fields (RowFieldID, TimestampFieldID) — they are handled
     // separately in FillTargetEntry and must not enter the pipeline.
@@ -473,14 +556,18 @@ BuildOrderByProjectNode(const proto::plan::QueryPlanNode& query,
     // Save pipeline field IDs before moving project_ids into ProjectNode.
     auto pipeline_field_ids = project_ids;
 
-    auto plannode =
-        std::make_shared<plan::ProjectNode>(milvus::plan::GetNextPlanNodeId(),
-                                            std::move(project_ids),
-                                            std::move(project_names),
-                                            std::move(project_types),
-                                            sources);
-    return {
-        plannode, std::move(deferred_field_ids), std::move(pipeline_field_ids)};
+    auto plannode = std::make_shared<plan::ProjectNode>(
+        milvus::plan::GetNextPlanNodeId(),
+        std::move(project_ids),
+        std::move(project_names),
+        std::move(project_types),
+        sources,
+        false,
+        IndexOrderedProjectFor(query, schema, is_element_level));
+    return {plannode,
+            std::move(deferred_field_ids),
+            std::move(pipeline_field_ids),
+            order_by_column_count};
 }
 
 // Helper function to build OrderByNode with sorting keys.
@@ -833,7 +920,7 @@ ProtoParser::RetrievePlanNodeFromProto(
             bool has_aggregation =
                 (group_by_field_count > 0 || agg_functions_count > 0);
             if (!has_aggregation) {
-                auto [project, deferred, pipeline_ids] =
+                auto [project, deferred, pipeline_ids, order_by_columns] =
                     BuildOrderByProjectNode(query,
                                             plan_node_proto,
                                             schema,
@@ -843,6 +930,7 @@ ProtoParser::RetrievePlanNodeFromProto(
                 sources = std::vector<milvus::plan::PlanNodePtr>{plannode};
                 plan_node->deferred_field_ids_ = std::move(deferred);
                 plan_node->pipeline_field_ids_ = std::move(pipeline_ids);
+                plan_node->order_by_column_count_ = order_by_columns;
             }
             plannode = BuildOrderByNode(query, schema, sources);
             plan_node->has_order_by_ = true;
@@ -14,12 +14,14 @@
 #include <cstdint>
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "SearchBruteForce.h"
 #include "SubSearchResult.h"
+#include "common/Common.h"
 #include "common/Consts.h"
 #include "common/EasyAssert.h"
 #include "common/FieldMeta.h"
@@ -38,6 +40,9 @@
 #include "knowhere/sparse_utils.h"
 #include "log/Log.h"
 #include "nlohmann/json.hpp"
+#include "query/MaxSimSearch.h"
+#include "query/SparseChunkPostings.h"
+#include "query/VectorKernels.h"
 #include "query/helper.h"
 
 namespace milvus::query {
@@ -149,6 +154,13 @@ PrepareBFDataSet(const dataset::SearchDataset& query_ds,
     return std::make_pair(query_dataset, base_dataset);
 };
 
+knowhere::expected<std::vector<knowhere::IndexNode::IteratorPtr>>
+DispatchBruteForceIteratorByDataType(const knowhere::DataSetPtr& base_dataset,
+                                     const knowhere::DataSetPtr& query_dataset,
+                                     const knowhere::Json& config,
+                                     const BitsetView& bitset,
+                                     milvus::DataType data_type);
+
 SubSearchResult
 BruteForceSearch(const dataset::SearchDataset& query_ds,
                  const dataset::RawDataset& raw_ds,
@@ -187,6 +199,44 @@ BruteForceSearch(const dataset::SearchDataset& query_ds,
                                   search_cfg[RANGE_FILTER],
                                   search_info.metric_type_);
         }
+        auto scan_limit = RANGE_SEARCH_STREAM_SCAN_LIMIT.load();
+        if (scan_limit > 0 && query_ds.query_offsets == nullptr &&
+            raw_ds.raw_data_offsets == nullptr) {
+            // brute force iterators yield candidates in exact distance
+            // order, so each query keeps only its topk in a bounded heap
+            // instead of materializing the whole range
+            auto iterators = DispatchBruteForceIteratorByDataType(
+                base_dataset, query_dataset, search_cfg, bitset, data_type);
+            if (!iterators.has_value()) {
+                ThrowInfo(KnowhereError,
+                          "Brute force range search iterator fail: {}, {}",
+                          KnowhereStatusString(iterators.error()),
+                          iterators.what());
+            }
+            std::optional<float> range_filter;
+            if (search_cfg.contains(RANGE_FILTER)) {
+                range_filter = search_cfg[RANGE_FILTER].get<float>();
+            }
+            auto result =
+                StreamRangeSearchResult(iterators.value(),
+                                        topk,
+                                        search_cfg[RADIUS].get<float>(),
+                                        range_filter,
+                                        query_ds.metric_type,
+                                        scan_limit,
+                                        true);
+            milvus::tracer::AddEvent("StreamRangeSearchResult");
+            milvus::fastmem::FastMemcpy(
+                sub_result.get_offsets(),
+                GetDatasetIDs(result),
+                nq * topk * sizeof(*sub_result.get_offsets()));
+            milvus::fastmem::FastMemcpy(
+                sub_result.get_distances(),
+                GetDatasetDistance(result),
+                nq * topk * sizeof(*sub_result.get_distances()));
+            sub_result.round_values();
+            return sub_result;
+        }
         knowhere::expected<knowhere::DataSetPtr> res;
         if (data_type == DataType::VECTOR_FLOAT) {
             res = knowhere::BruteForce::RangeSearch<float>(
@@ -233,7 +283,49 @@ BruteForceSearch(const dataset::SearchDataset& query_ds,
             nq * topk * sizeof(*sub_result.get_distances()));
     } else {
         knowhere::Status stat;
-        if (data_type == DataType::VECTOR_FLOAT) {
+        if (UseMaxSimKernel(
+                query_ds, raw_ds, search_info.metric_type_, data_type)) {
+            MaxSimSearch(query_ds,
+                         raw_ds,
+                         search_info.metric_type_,
+                         data_type,
+                         bitset,
+                         sub_result.mutable_offsets().data(),
+                         sub_result.mutable_distances().data());
+            stat = knowhere::Status::success;
+        } else if (UseVectorKernel(query_ds,
+                                   raw_ds,
+                                   search_info.metric_type_,
+                                   data_type)) {
+            VectorKernelSearch(query_ds,
+                               raw_ds,
+                               search_info.metric_type_,
+                               data_type,
+                               bitset,
+                               sub_result.mutable_offsets().data(),
+                               sub_result.mutable_distances().data());
+            stat = knowhere::Status::success;
+        } else if (data_type == DataType::VECTOR_SPARSE_U32_F32 &&
+                   raw_ds.sparse_postings != nullptr &&
+                   IsMetricType(search_info.metric_type_,
+                                knowhere::metric::IP)) {
+            // term at a time over the postings the owner keeps, instead of
+            // a dot product per row
+            auto queries = static_cast<
+                const knowhere::sparse::SparseRow<SparseValueType>*>(
+                query_ds.query_data);
+            for (int64_t i = 0; i < nq; ++i) {
+                raw_ds.sparse_postings->Search(
+                    queries[i],
+                    raw_ds.num_raw_data,
+                    topk,
+                    raw_ds.begin_id,
+                    bitset,
+                    sub_result.mutable_offsets().data() + i * topk,
+                    sub_result.mutable_distances().data() + i * topk);
+            }
+            stat = knowhere::Status::success;
+        } else if (data_type == DataType::VECTOR_FLOAT) {
             stat = knowhere::BruteForce::SearchWithBuf<float>(
                 base_dataset,
                 query_dataset,
@@ -50,6 +50,7 @@
 #include "segcore/ConcurrentVector.h"
 #include "segcore/FieldIndexing.h"
 #include "segcore/InsertRecord.h"
+#include "segcore/SearchIteratorRegistry.h"
 #include "segcore/SegmentGrowingImpl.h"
 
 namespace milvus::query {
@@ -140,8 +141,7 @@ SearchOnGrowing(const segcore::SegmentGrowingImpl& segment,
                                 op_context,
                                 search_result);
     } else {
-        std::shared_lock<std::shared_mutex> read_chunk_mutex(
-            segment.get_chunk_mutex());
+        auto chunk_reader = segment.get_chunk_read_gate().Enter();
         // check SyncDataWithIndex() again, in case the vector chunks has been removed.
         if (segment.get_indexing_record().SyncDataWithIndex(field.get_id())) {
             AssertInfo(data_type != DataType::VECTOR_ARRAY,
@@ -235,14 +235,47 @@ SearchOnGrowing(const segcore::SegmentGrowingImpl& segment,
                        "embedding list (multi-search-multi) iterator is not "
                        "supported on vector array fields");
 
-            CachedSearchIterator cached_iter(search_dataset,
-                                             vec_ptr,
-                                             active_count,
-                                             info,
-                                             index_info,
-                                             search_bitset,
-                                             iter_data_type);
-            cached_iter.NextBatch(info, search_result);
+            if (segcore::SearchIteratorRegistry::IsRegistrable(
+                    info, query_offsets, iter_data_type, search_bitset)) {
+                auto query_bytes =
+                    num_queries * GetDataTypeSize(iter_data_type, dim);
+                // brute force iterators keep a distance per row
+                auto iterator_bytes = static_cast<size_t>(
+                    active_count * (sizeof(float) + sizeof(int64_t)));
+                // the raw vectors stay until the segment is released, which
+                // erases its entries
+                segcore::SearchIteratorRegistry::Instance().NextBatch(
+                    segment.get_segment_id(),
+                    info,
+                    query_data,
+                    query_bytes,
+                    search_bitset,
+                    iterator_bytes,
+                    [&](const void* query,
+                        const BitsetView& iterator_bitset,
+                        std::vector<std::shared_ptr<void>>& pins) {
+                        auto iterator_dataset = search_dataset;
+                        iterator_dataset.query_data = query;
+                        return std::make_unique<CachedSearchIterator>(
+                            iterator_dataset,
+                            vec_ptr,
+                            active_count,
+                            info,
+                            index_info,
+                            iterator_bitset,
+                            iter_data_type);
+                    },
+                    search_result);
+            } else {
+                CachedSearchIterator cached_iter(search_dataset,
+                                                 vec_ptr,
+                                                 active_count,
+                                                 info,
+                                                 index_info,
+                                                 search_bitset,
+                                                 iter_data_type);
+                cached_iter.NextBatch(info, search_result);
+            }
             FinalizeVectorSearchOffsets(
                 search_result, offset_mapping, info.array_offsets_.get());
             return;
@@ -256,7 +289,22 @@ SearchOnGrowing(const segcore::SegmentGrowingImpl& segment,
         // because ArrayOffsets maps global element IDs to row IDs.
         int64_t cumulative_element_offset = 0;
 
+        // growing VECTOR_ARRAY rows are flattened as they are inserted
+        const auto* flat_vector_array =
+            data_type == DataType::VECTOR_ARRAY
+                ? dynamic_cast<const segcore::ConcurrentVector<VectorArray>*>(
+                      vec_ptr)
+                : nullptr;
+        const auto* sparse_vector =
+            data_type == DataType::VECTOR_SPARSE_U32_F32 &&
+                    IsMetricType(info.metric_type_, knowhere::metric::IP)
+                ? dynamic_cast<
+                      const segcore::ConcurrentVector<SparseFloatVector>*>(
+                      vec_ptr)
+                : nullptr;
+
         std::vector<size_t> offsets;
+        ChunkResultMerger chunk_merger(final_qr);
         for (int chunk_id = current_chunk_id; chunk_id < max_chunk;
              ++chunk_id) {
             auto chunk_data = vec_ptr->get_chunk_data(chunk_id);
@@ -268,14 +316,37 @@ SearchOnGrowing(const segcore::SegmentGrowingImpl& segment,
 
             query::dataset::RawDataset sub_data;
             std::unique_ptr<uint8_t[]> buf = nullptr;
+            std::shared_ptr<const query::SparseChunkPostings> postings;
+            auto flat = flat_vector_array != nullptr
+                            ? flat_vector_array->get_flat_chunk(chunk_id)
+                            : segcore::FlatVectorArrayChunk::View{};
             if (data_type != DataType::VECTOR_ARRAY) {
                 sub_data = query::dataset::RawDataset{
                     row_begin, dim, size_per_chunk, chunk_data};
+                if (sparse_vector != nullptr && !use_vector_iterator) {
+                    postings = sparse_vector->get_chunk_postings(
+                        chunk_id, size_per_chunk);
+                    sub_data.sparse_postings = postings.get();
+                }
+            } else if (flat.rows >= size_per_chunk) {
+                // the elements of the rows are already in one buffer, the
+                // offsets of the first size_per_chunk rows hold for them
+                if (is_element_level_search) {
+                    auto count =
+                        static_cast<int64_t>(flat.offsets[size_per_chunk]);
+                    sub_data = query::dataset::RawDataset{
+                        cumulative_element_offset, dim, count, flat.data};
+                    cumulative_element_offset += count;
+                } else {
+                    sub_data = query::dataset::RawDataset{row_begin,
+                                                          dim,
+                                                          size_per_chunk,
+                                                          flat.data,
+                                                          flat.offsets};
+                }
             } else {
-                // TODO(SpadeA): For VectorArray(Embedding List), data is
-                // discreted stored in FixedVector which means we will copy the
-                // data to a contiguous memory buffer. This is inefficient and
-                // will be optimized in the future.
+                // rows still being inserted behind a missing one are not
+                // flat yet, copy the elements to a contiguous buffer
                 auto vec_ptr = reinterpret_cast<const VectorArray*>(chunk_data);
                 auto size = 0;
                 for (int i = 0; i < size_per_chunk; ++i) {
@@ -337,17 +408,17 @@ SearchOnGrowing(const segcore::SegmentGrowingImpl& segment,
                                                                iter_data_type);
                 final_qr.merge(sub_qr);
             } else {
-                auto sub_qr = BruteForceSearch(search_dataset,
-                                               sub_data,
-                                               info,
-                                               index_info,
-                                               search_bitset,
-                                               iter_data_type,
-                                               element_type,
-                                               op_context);
-                final_qr.merge(sub_qr);
+                chunk_merger.add(BruteForceSearch(search_dataset,
+                                                  sub_data,
+                                                  info,
+                                                  index_info,
+                                                  search_bitset,
+                                                  iter_data_type,
+                                                  element_type,
+                                                  op_context));
             }
         }
+        chunk_merger.flush();
         if (use_vector_iterator) {
             bool larger_is_closer = PositivelyRelated(info.metric_type_);
             // Element-level search skips row-level mapping (element IDs are
@@ -386,4 +457,181 @@ SearchOnGrowing(const segcore::SegmentGrowingImpl& segment,
     }
 }
 
+
+bool
+SearchOnGrowingSegments(
+    const std::vector<const segcore::SegmentGrowingImpl*>& segments,
+    const SearchInfo& info,
+    const void* query_data,
+    int64_t num_queries,
+    Timestamp timestamp,
+    const std::vector<BitsetView>& bitsets,
+    milvus::OpContext* op_context,
+    std::vector<SearchResult>& results) {
+    AssertInfo(segments.size() == bitsets.size(),
+               "{} segments searched with {} bitsets",
+               segments.size(),
+               bitsets.size());
+    if (segments.empty() || info.iterator_v2_info_.has_value() ||
+        info.array_offsets_ != nullptr ||
+        milvus::exec::UseVectorIterator(info) ||
+        info.metric_type_ == knowhere::metric::BM25 ||
+        info.metric_type_ == knowhere::metric::MHJACCARD) {
+        return false;
+    }
+    auto vecfield_id = info.field_id_;
+    auto& field = segments[0]->get_schema()[vecfield_id];
+    auto data_type = field.get_data_type();
+    if (!IsVectorDataType(data_type) || data_type == DataType::VECTOR_ARRAY ||
+        data_type == DataType::VECTOR_SPARSE_U32_F32) {
+        return false;
+    }
+    CheckBruteForceSearchParam(field, info);
+    auto dim = field.get_dim();
+    auto row_bytes = static_cast<int64_t>(GetDataTypeSize(data_type, dim));
+
+    // the rows of segment i are numbered from bases[i] on, the interim index
+    // may drop the raw chunks unless a reader is inside the gate
+    std::vector<std::unique_ptr<segcore::ChunkReadGate::Reader>> readers;
+    std::vector<const segcore::VectorBase*> vectors;
+    std::vector<int64_t> bases;
+    readers.reserve(segments.size());
+    vectors.reserve(segments.size());
+    bases.reserve(segments.size() + 1);
+    bases.push_back(0);
+    for (size_t i = 0; i < segments.size(); ++i) {
+        auto segment = segments[i];
+        readers.push_back(std::make_unique<segcore::ChunkReadGate::Reader>(
+            segment->get_chunk_read_gate()));
+        if (segment->get_indexing_record().SyncDataWithIndex(vecfield_id)) {
+            return false;
+        }
+        auto vec_ptr = segment->get_insert_record().get_data_base(vecfield_id);
+        if (vec_ptr->get_offset_mapping().IsEnabled()) {
+            return false;
+        }
+        auto active_count = segment->get_active_count(timestamp);
+        if (!bitsets[i].empty()) {
+            active_count = std::min(int64_t(bitsets[i].size()), active_count);
+        }
+        vectors.push_back(vec_ptr);
+        bases.push_back(bases.back() + active_count);
+    }
+    auto total_count = bases.back();
+
+    // knowhere tests the bits of the ids the rows are given, the filters of
+    // the segments are laid out like their rows
+    TargetBitmap fused_bitset;
+    fused_bitset.reserve(total_count);
+    bool filtered = false;
+    for (size_t i = 0; i < segments.size(); ++i) {
+        auto count = bases[i + 1] - bases[i];
+        if (bitsets[i].empty()) {
+            fused_bitset.resize(fused_bitset.size() + count, false);
+            continue;
+        }
+        fused_bitset.append(TargetBitmapView(
+            const_cast<uint8_t*>(bitsets[i].data()), count));
+        filtered = true;
+    }
+    BitsetView search_bitset =
+        filtered ? BitsetView(fused_bitset) : BitsetView{};
+
+    auto topk = info.topk_;
+    auto metric_type = info.metric_type_;
+    SubSearchResult final_qr(
+        num_queries, topk, metric_type, info.round_decimal_);
+    dataset::SearchDataset search_dataset{metric_type,
+                                          num_queries,
+                                          topk,
+                                          info.round_decimal_,
+                                          dim,
+                                          query_data};
+    std::map<std::string, std::string> index_info;
+    ChunkResultMerger chunk_merger(final_qr);
+
+    // the chunks of the segments are copied one after the other into
+    // batches, each searched by one brute force call
+    constexpr int64_t kFusedBatchBytes = 64 << 20;
+    auto batch_capacity = std::max<int64_t>(
+        1, std::min(total_count, kFusedBatchBytes / row_bytes));
+    std::unique_ptr<uint8_t[]> batch;
+    int64_t batch_begin = 0;
+    int64_t batch_rows = 0;
+    auto flush = [&]() {
+        if (batch_rows == 0) {
+            return;
+        }
+        auto sub_data =
+            dataset::RawDataset{batch_begin, dim, batch_rows, batch.get()};
+        chunk_merger.add(BruteForceSearch(search_dataset,
+                                          sub_data,
+                                          info,
+                                          index_info,
+                                          search_bitset,
+                                          data_type,
+                                          field.get_element_type(),
+                                          op_context));
+        batch_begin += batch_rows;
+        batch_rows = 0;
+    };
+    if (total_count > 0) {
+        batch = std::make_unique<uint8_t[]>(batch_capacity * row_bytes);
+    }
+    for (size_t i = 0; i < segments.size(); ++i) {
+        auto vec_ptr = vectors[i];
+        auto size_per_chunk = vec_ptr->get_size_per_chunk();
+        auto count = bases[i + 1] - bases[i];
+        for (int64_t row = 0; row < count;) {
+            auto chunk_id = row / size_per_chunk;
+            auto in_chunk = row % size_per_chunk;
+            auto rows = std::min({size_per_chunk - in_chunk,
+                                  count - row,
+                                  batch_capacity - batch_rows});
+            auto chunk_data = static_cast<const uint8_t*>(
+                vec_ptr->get_chunk_data(chunk_id));
+            milvus::fastmem::FastMemcpy(batch.get() + batch_rows * row_bytes,
+                                        chunk_data + in_chunk * row_bytes,
+                                        rows * row_bytes);
+            batch_rows += rows;
+            row += rows;
+            if (batch_rows == batch_capacity) {
+                flush();
+            }
+        }
+    }
+    flush();
+    chunk_merger.flush();
+
+    // a hit goes to the segment its id falls in, keeping the order of the
+    // hits of each query
+    results.clear();
+    results.resize(segments.size());
+    for (auto& result : results) {
+        result.seg_offsets_.assign(num_queries * topk, INVALID_SEG_OFFSET);
+        result.distances_.assign(num_queries * topk,
+                                 SubSearchResult::init_value(metric_type));
+        result.unity_topK_ = topk;
+        result.total_nq_ = num_queries;
+    }
+    const auto& offsets = final_qr.mutable_offsets();
+    const auto& distances = final_qr.mutable_distances();
+    std::vector<int64_t> filled(segments.size());
+    for (int64_t q = 0; q < num_queries; ++q) {
+        std::fill(filled.begin(), filled.end(), 0);
+        for (int64_t k = 0; k < topk; ++k) {
+            auto id = offsets[q * topk + k];
+            if (id == INVALID_SEG_OFFSET) {
+                continue;
+            }
+            auto i = std::upper_bound(bases.begin(), bases.end() - 1, id) -
+                     bases.begin() - 1;
+            auto pos = q * topk + filled[i]++;
+            results[i].seg_offsets_[pos] = id - bases[i];
+            results[i].distances_[pos] = distances[q * topk + k];
+        }
+    }
+    return true;
+}
+
 }  // namespace milvus::query
@@ -13,6 +13,7 @@
 
 #include <stdint.h>
 #include <cstddef>
+#include <vector>
 
 #include "common/BitsetView.h"
 #include "common/OpContext.h"
@@ -34,4 +35,23 @@ SearchOnGrowing(const segcore::SegmentGrowingImpl& segment,
                 milvus::OpContext* op_context,
                 SearchResult& search_result);
 
+// Searches several small growing segments of one collection as if their
+// raw vectors were one segment: the rows are numbered one segment after the
+// other, searched in few brute force calls sharing one top-k heap per query,
+// and the hits are split back into one result per segment. `bitsets` holds
+// the filter of each segment, an empty view keeps all of its rows.
+// Returns false, leaving `results` untouched, when a segment or the search
+// needs SearchOnGrowing: an interim index, nullable or sparse vectors,
+// embedding lists, iterators and group by.
+bool
+SearchOnGrowingSegments(
+    const std::vector<const segcore::SegmentGrowingImpl*>& segments,
+    const SearchInfo& info,
+    const void* query_data,
+    int64_t num_queries,
+    Timestamp timestamp,
+    const std::vector<BitsetView>& bitsets,
+    milvus::OpContext* op_context,
+    std::vector<SearchResult>& results);
+
 }  // namespace milvus::query
@@ -13,12 +13,14 @@
 #include <algorithm>
 #include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <optional>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "bitset/detail/element_wise.h"
 #include "cachinglayer/CacheSlot.h"
 #include "cachinglayer/Utils.h"
 #include "common/ArrayOffsets.h"
@@ -44,14 +46,17 @@
 #include "query/SearchOnSealed.h"
 #include "query/SubSearchResult.h"
 #include "query/Utils.h"
+#include "query/VectorChunkBound.h"
 #include "query/helper.h"
 #include "segcore/SealedIndexingRecord.h"
+#include "segcore/SearchIteratorRegistry.h"
 
 namespace milvus::query {
 
 void
 SearchOnSealedIndex(const Schema& schema,
                     const segcore::SealedIndexingRecord& record,
+                    int64_t segment_id,
                     const SearchInfo& search_info,
                     const void* query_data,
                     const size_t* query_offsets,
@@ -123,9 +128,39 @@ SearchOnSealedIndex(const Schema& schema,
     }
 
     if (search_info.iterator_v2_info_.has_value()) {
-        CachedSearchIterator cached_iter(
-            *vec_index, dataset, search_info, search_bitset);
-        cached_iter.NextBatch(search_info, search_result);
+        if (segcore::SearchIteratorRegistry::IsRegistrable(
+                search_info,
+                query_offsets,
+                field.get_data_type(),
+                search_bitset)) {
+            auto query_bytes =
+                num_queries * GetDataTypeSize(field.get_data_type(), dim);
+            // roughly the visited set of a graph walk
+            auto iterator_bytes = static_cast<size_t>(vec_index->Count() / 8);
+            segcore::SearchIteratorRegistry::Instance().NextBatch(
+                segment_id,
+                search_info,
+                query_data,
+                query_bytes,
+                search_bitset,
+                iterator_bytes,
+                [&](const void* query,
+                    const BitsetView& iterator_bitset,
+                    std::vector<std::shared_ptr<void>>& pins) {
+                    auto query_ds =
+                        knowhere::GenDataSet(num_queries, dim, query);
+                    pins.push_back(field_indexing);
+                    pins.push_back(accessor);
+                    pins.push_back(query_ds);
+                    return std::make_unique<CachedSearchIterator>(
+                        *vec_index, query_ds, search_info, iterator_bitset);
+                },
+                search_result);
+        } else {
+            CachedSearchIterator cached_iter(
+                *vec_index, dataset, search_info, search_bitset);
+            cached_iter.NextBatch(search_info, search_result);
+        }
         FinalizeVectorSearchOffsets(
             search_result, offset_mapping, search_info.array_offsets_.get());
         return;
@@ -159,9 +194,116 @@ SearchOnSealedIndex(const Schema& schema,
     search_result.unity_topK_ = topK;
 }
 
+// The filter must let through at most 1/kGatherSearchMaxAllowedRatio of the
+// rows for the search to gather them instead of scanning every chunk
+constexpr int64_t kGatherSearchMaxAllowedRatio = 16;
+// Bytes of vectors gathered into one brute force batch
+constexpr int64_t kGatherSearchBatchBytes = 8 << 20;
+
+// Brute force over only the rows `bitview` lets through: their vectors are
+// copied out of the pinned chunks into batches of contiguous rows, each of
+// which is searched without a bitset. With a filter that removes nearly the
+// whole segment this replaces a pass over every chunk, testing the bitset
+// row by row, with a walk over the set words of the bitset. Returns false,
+// leaving `final_qr` untouched, when the filter is not selective enough.
+static bool
+GatherSearchOnSealedColumn(ChunkedColumnInterface* column,
+                           const std::vector<PinWrapper<Chunk*>>& chunks,
+                           bool has_offset_mapping,
+                           const dataset::SearchDataset& query_dataset,
+                           const SearchInfo& search_info,
+                           const std::map<std::string, std::string>& index_info,
+                           const BitsetView& bitview,
+                           DataType data_type,
+                           DataType element_type,
+                           milvus::OpContext* op_context,
+                           SubSearchResult& final_qr) {
+    using BitsetPolicy = bitset::detail::ElementWiseBitsetPolicy<uint8_t>;
+    if (bitview.empty() || bitview.has_out_ids()) {
+        return false;
+    }
+    const auto* bits = bitview.data();
+    const auto num_rows = static_cast<int64_t>(bitview.size());
+    const auto allowed =
+        num_rows - static_cast<int64_t>(BitsetPolicy::op_count(
+                       bits, 0, static_cast<size_t>(num_rows)));
+    if (allowed * kGatherSearchMaxAllowedRatio > num_rows) {
+        return false;
+    }
+
+    std::vector<int64_t> chunk_ends(chunks.size());
+    int64_t total = 0;
+    for (size_t i = 0; i < chunks.size(); ++i) {
+        total += has_offset_mapping ? column->GetValidCountInChunk(i)
+                                    : column->chunk_row_nums(i);
+        chunk_ends[i] = total;
+    }
+    if (total != num_rows) {
+        return false;
+    }
+
+    const auto dim = query_dataset.dim;
+    const auto row_bytes =
+        static_cast<int64_t>(GetDataTypeSize(data_type, dim));
+    const auto batch_rows = std::max<int64_t>(
+        1, std::min(allowed, kGatherSearchBatchBytes / row_bytes));
+    std::vector<uint8_t> buffer(batch_rows * row_bytes);
+    std::vector<int64_t> batch_offsets;
+    batch_offsets.reserve(batch_rows);
+
+    ChunkResultMerger chunk_merger(final_qr);
+    auto search_batch = [&]() {
+        auto raw_dataset = dataset::RawDataset{
+            0, dim, static_cast<int64_t>(batch_offsets.size()), buffer.data()};
+        auto sub_qr = BruteForceSearch(query_dataset,
+                                       raw_dataset,
+                                       search_info,
+                                       index_info,
+                                       BitsetView{},
+                                       data_type,
+                                       element_type,
+                                       op_context);
+        for (auto& offset : sub_qr.mutable_offsets()) {
+            if (offset != INVALID_SEG_OFFSET) {
+                offset = batch_offsets[offset];
+            }
+        }
+        chunk_merger.add(std::move(sub_qr));
+        batch_offsets.clear();
+    };
+
+    size_t chunk_id = 0;
+    auto row = BitsetPolicy::op_find(bits, 0, num_rows, 0, false);
+    while (row.has_value()) {
+        auto offset = static_cast<int64_t>(row.value());
+        while (chunk_ends[chunk_id] <= offset) {
+            ++chunk_id;
+        }
+        auto chunk_begin = chunk_id == 0 ? 0 : chunk_ends[chunk_id - 1];
+        const auto* src = reinterpret_cast<const uint8_t*>(
+                              chunks[chunk_id].get()->Data()) +
+                          (offset - chunk_begin) * row_bytes;
+        std::memcpy(
+            buffer.data() + batch_offsets.size() * row_bytes, src, row_bytes);
+        batch_offsets.push_back(offset);
+        if (static_cast<int64_t>(batch_offsets.size()) == batch_rows) {
+            search_batch();
+        }
+        row = offset + 1 < num_rows
+                  ? BitsetPolicy::op_find(bits, 0, num_rows, offset + 1, false)
+                  : std::nullopt;
+    }
+    if (!batch_offsets.empty()) {
+        search_batch();
+    }
+    chunk_merger.flush();
+    return true;
+}
+
 void
 SearchOnSealedColumn(const Schema& schema,
                      ChunkedColumnInterface* column,
+                     int64_t segment_id,
                      const SearchInfo& search_info,
                      const std::map<std::string, std::string>& index_info,
                      const void* query_data,
@@ -170,7 +312,8 @@ SearchOnSealedColumn(const Schema& schema,
                      int64_t row_count,
                      const BitsetView& bitview,
                      milvus::OpContext* op_context,
-                     SearchResult& result) {
+                     SearchResult& result,
+                     VectorChunkBounds* chunk_bounds) {
     auto field_id = search_info.field_id_;
     auto& field = schema[field_id];
 
@@ -243,13 +386,43 @@ SearchOnSealedColumn(const Schema& schema,
                    "embedding list (multi-search-multi) iterator is not "
                    "supported on vector array fields");
 
-        CachedSearchIterator cached_iter(column,
-                                         query_dataset,
-                                         search_info,
-                                         index_info,
-                                         search_bitview,
-                                         data_type);
-        cached_iter.NextBatch(search_info, result);
+        if (segcore::SearchIteratorRegistry::IsRegistrable(
+                search_info, query_offsets, data_type, search_bitview)) {
+            auto query_bytes = num_queries * GetDataTypeSize(data_type, dim);
+            // brute force iterators keep a distance per row
+            auto iterator_bytes = static_cast<size_t>(
+                row_count * (sizeof(float) + sizeof(int64_t)));
+            segcore::SearchIteratorRegistry::Instance().NextBatch(
+                segment_id,
+                search_info,
+                query_data,
+                query_bytes,
+                search_bitview,
+                iterator_bytes,
+                [&](const void* query,
+                    const BitsetView& iterator_bitset,
+                    std::vector<std::shared_ptr<void>>& pins) {
+                    // the iterator pins the chunks it reads itself
+                    auto iterator_dataset = query_dataset;
+                    iterator_dataset.query_data = query;
+                    return std::make_unique<CachedSearchIterator>(
+                        column,
+                        iterator_dataset,
+                        search_info,
+                        index_info,
+                        iterator_bitset,
+                        data_type);
+                },
+                result);
+        } else {
+            CachedSearchIterator cached_iter(column,
+                                             query_dataset,
+                                             search_info,
+                                             index_info,
+                                             search_bitview,
+                                             data_type);
+            cached_iter.NextBatch(search_info, result);
+        }
         FinalizeVectorSearchOffsets(
             result, offset_mapping, search_info.array_offsets_.get());
         return;
@@ -264,14 +437,62 @@ SearchOnSealedColumn(const Schema& schema,
                              search_info.metric_type_,
                              search_info.round_decimal_);
 
-    auto offset = 0;
     auto vector_chunks = column->GetAllChunks(op_context);
-    for (int i = 0; i < num_chunk; ++i) {
+    const bool gathered =
+        !use_vector_iterator && !is_element_level_search &&
+        data_type != DataType::VECTOR_ARRAY &&
+        data_type != DataType::VECTOR_SPARSE_U32_F32 &&
+        GatherSearchOnSealedColumn(column,
+                                   vector_chunks,
+                                   has_offset_mapping,
+                                   query_dataset,
+                                   search_info,
+                                   index_info,
+                                   search_bitview,
+                                   data_type,
+                                   element_type,
+                                   op_context,
+                                   final_qr);
+
+    auto chunk_rows = [&](int i) {
+        return has_offset_mapping ? column->GetValidCountInChunk(i)
+                                  : column->chunk_row_nums(i);
+    };
+    // a chunk whose ball of vectors lies beyond the top-k of every query
+    // can't change the result, range searches and rounded distances aside
+    const std::vector<VectorChunkBound>* bounds = nullptr;
+    if (chunk_bounds != nullptr && !gathered && !use_vector_iterator &&
+        !is_element_level_search && num_chunk > 1 &&
+        data_type == DataType::VECTOR_FLOAT && query_offsets == nullptr &&
+        !search_info.search_params_.contains(RADIUS) &&
+        (IsMetricType(search_info.metric_type_, knowhere::metric::L2) ||
+         IsMetricType(search_info.metric_type_, knowhere::metric::IP) ||
+         IsMetricType(search_info.metric_type_, knowhere::metric::COSINE))) {
+        bounds = &chunk_bounds->Get([&]() {
+            std::vector<VectorChunkBound> bounds;
+            bounds.reserve(num_chunk);
+            for (int i = 0; i < num_chunk; ++i) {
+                auto data = reinterpret_cast<const float*>(
+                    vector_chunks[i].get()->Data());
+                bounds.emplace_back(
+                    ComputeVectorChunkBound(data, chunk_rows(i), dim));
+            }
+            return bounds;
+        });
+    }
+
+    ChunkResultMerger chunk_merger(final_qr);
+    auto offset = 0;
+    for (int i = 0; i < num_chunk && !gathered; ++i) {
         const auto& pw = vector_chunks[i];
         auto vec_data = pw.get()->Data();
-        auto chunk_size = column->chunk_row_nums(i);
-        if (has_offset_mapping) {
-            chunk_size = column->GetValidCountInChunk(i);
+        auto chunk_size = chunk_rows(i);
+        if (bounds != nullptr) {
+            chunk_merger.flush();
+            if (CanSkipChunk((*bounds)[i], query_dataset, final_qr)) {
+                offset += chunk_size;
+                continue;
+            }
         }
 
         // For element-level search, get element count from VectorArrayOffsets
@@ -307,18 +528,18 @@ SearchOnSealedColumn(const Schema& schema,
                                                            data_type);
             final_qr.merge(sub_qr);
         } else {
-            auto sub_qr = BruteForceSearch(query_dataset,
-                                           raw_dataset,
-                                           search_info,
-                                           index_info,
-                                           search_bitview,
-                                           data_type,
-                                           element_type,
-                                           op_context);
-            final_qr.merge(sub_qr);
+            chunk_merger.add(BruteForceSearch(query_dataset,
+                                              raw_dataset,
+                                              search_info,
+                                              index_info,
+                                              search_bitview,
+                                              data_type,
+                                              element_type,
+                                              op_context));
         }
         offset += chunk_size;
     }
+    chunk_merger.flush();
     if (use_vector_iterator) {
         bool larger_is_closer = PositivelyRelated(search_info.metric_type_);
         // Element-level search skips row-level mapping (element IDs are
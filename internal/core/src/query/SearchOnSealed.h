@@ -23,6 +23,7 @@
 #include "common/Schema.h"
 #include "common/protobuf_utils.h"
 #include "mmap/ChunkedColumnInterface.h"
+#include "query/VectorChunkBound.h"
 #include "segcore/SealedIndexingRecord.h"
 
 namespace milvus::query {
@@ -30,6 +31,7 @@ namespace milvus::query {
 void
 SearchOnSealedIndex(const Schema& schema,
                     const segcore::SealedIndexingRecord& record,
+                    int64_t segment_id,
                     const SearchInfo& search_info,
                     const void* query_data,
                     const size_t* query_offsets,
@@ -41,6 +43,7 @@ SearchOnSealedIndex(const Schema& schema,
 void
 SearchOnSealedColumn(const Schema& schema,
                      ChunkedColumnInterface* column,
+                     int64_t segment_id,
                      const SearchInfo& search_info,
                      const std::map<std::string, std::string>& index_info,
                      const void* query_data,
@@ -49,6 +52,7 @@ SearchOnSealedColumn(const Schema& schema,
                      int64_t row_count,
                      const BitsetView& bitset,
                      milvus::OpContext* op_context,
-                     SearchResult& result);
+                     SearchResult& result,
+                     VectorChunkBounds* chunk_bounds = nullptr);
 
 }  // namespace milvus::query
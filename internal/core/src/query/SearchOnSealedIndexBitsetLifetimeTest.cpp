@@ -250,6 +250,7 @@ TEST(SearchOnSealedIndexBitsetLifetime,
     SearchResult search_result;
     SearchOnSealedIndex(*schema,
                         indexing_record,
+                        kSegmentID,
                         search_info,
                         query.data(),
                         nullptr,
@@ -301,6 +302,7 @@ TEST(SearchOnSealedIndexCancellation, PinVectorIndexUsesCallerOpContext) {
     SearchResult search_result;
     SearchOnSealedIndex(*schema,
                         indexing_record,
+                        kSegmentID,
                         search_info,
                         vectors.data(),
                         nullptr,
@@ -353,6 +355,7 @@ TEST(SearchOnSealedIndexNullableNoFilter,
     SearchResult search_result;
     SearchOnSealedIndex(*schema,
                         indexing_record,
+                        kSegmentID,
                         search_info,
                         vectors.data(),
                         nullptr,
@@ -407,6 +410,7 @@ TEST(SearchOnSealedIndexNullableIteratorNoFilter,
     SearchResult search_result;
     SearchOnSealedIndex(*schema,
                         indexing_record,
+                        kSegmentID,
                         search_info,
                         vectors.data(),
                         nullptr,
@@ -514,6 +518,7 @@ TEST(SearchOnSealedColumnBitsetLifetime,
     SearchResult search_result;
     SearchOnSealedColumn(*schema,
                          column.get(),
+                         kSegmentID,
                          search_info,
                          std::map<std::string, std::string>{},
                          vectors.data(),
@@ -0,0 +1,189 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include "query/SparseChunkPostings.h"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <utility>
+
+#include "common/EasyAssert.h"
+
+namespace milvus::query {
+
+namespace {
+
+enum RowState : uint8_t {
+    kUnseen = 0,
+    kCandidate = 1,
+    kFiltered = 2,
+};
+
+struct QueryDim {
+    size_t dim_index;
+    float weight;
+    // the most the dimension adds to a row
+    float bound;
+};
+
+}  // namespace
+
+SparseChunkPostings::SparseChunkPostings(const SparseRow* rows,
+                                         int64_t num_rows)
+    : num_rows_(num_rows) {
+    AssertInfo(num_rows <= std::numeric_limits<uint32_t>::max(),
+               "sparse chunk of {} rows is too large",
+               num_rows);
+    // (dimension, row) of every value, grouped by dimension
+    std::vector<std::pair<uint32_t, uint32_t>> entries;
+    size_t total = 0;
+    for (int64_t r = 0; r < num_rows; ++r) {
+        total += rows[r].size();
+    }
+    entries.reserve(total);
+    for (int64_t r = 0; r < num_rows; ++r) {
+        for (size_t i = 0; i < rows[r].size(); ++i) {
+            entries.emplace_back(rows[r][i].id, static_cast<uint32_t>(r));
+        }
+    }
+    // rows are appended ascending, a stable sort keeps them so
+    std::stable_sort(
+        entries.begin(), entries.end(), [](const auto& a, const auto& b) {
+            return a.first < b.first;
+        });
+
+    posting_rows_.reserve(total);
+    posting_values_.reserve(total);
+    // the position in its row of the next value of each row
+    std::vector<uint32_t> cursor(num_rows, 0);
+    for (const auto& [dim, row] : entries) {
+        if (dims_.empty() || dims_.back() != dim) {
+            dims_.push_back(dim);
+            posting_begin_.push_back(posting_rows_.size());
+            max_values_.push_back(0);
+        }
+        // row values are ascending by dimension, so they come in order
+        auto value = rows[row][cursor[row]++].val;
+        posting_rows_.push_back(row);
+        posting_values_.push_back(value);
+        max_values_.back() = std::max(max_values_.back(), value);
+    }
+    posting_begin_.push_back(posting_rows_.size());
+}
+
+size_t
+SparseChunkPostings::memory_bytes() const {
+    return dims_.capacity() * sizeof(uint32_t) +
+           posting_begin_.capacity() * sizeof(uint32_t) +
+           posting_rows_.capacity() * sizeof(uint32_t) +
+           posting_values_.capacity() * sizeof(float) +
+           max_values_.capacity() * sizeof(float);
+}
+
+void
+SparseChunkPostings::Search(const SparseRow& query,
+                            int64_t row_count,
+                            int64_t topk,
+                            int64_t begin_id,
+                            const BitsetView& bitset,
+                            int64_t* offsets,
+                            float* distances) const {
+    if (topk <= 0) {
+        return;
+    }
+    std::vector<QueryDim> query_dims;
+    query_dims.reserve(query.size());
+    for (size_t i = 0; i < query.size(); ++i) {
+        auto element = query[i];
+        auto it = std::lower_bound(dims_.begin(), dims_.end(), element.id);
+        if (it == dims_.end() || *it != element.id || element.val == 0) {
+            continue;
+        }
+        auto index = static_cast<size_t>(it - dims_.begin());
+        query_dims.push_back(
+            {index, element.val, element.val * max_values_[index]});
+    }
+    std::sort(query_dims.begin(),
+              query_dims.end(),
+              [](const auto& a, const auto& b) { return a.bound > b.bound; });
+    // remaining[i] is the most dimensions i.. add to a row
+    std::vector<float> remaining(query_dims.size() + 1, 0);
+    for (auto i = static_cast<int64_t>(query_dims.size()) - 1; i >= 0; --i) {
+        remaining[i] = remaining[i + 1] + query_dims[i].bound;
+    }
+
+    const auto bitset_size = static_cast<int64_t>(bitset.size());
+    row_count = std::min(row_count, num_rows_);
+    std::vector<float> scores(row_count, 0);
+    std::vector<uint8_t> states(row_count, kUnseen);
+    std::vector<uint32_t> candidates;
+    std::vector<float> kth;
+    bool admit = true;
+    for (size_t i = 0; i < query_dims.size(); ++i) {
+        const auto& query_dim = query_dims[i];
+        const auto begin = posting_begin_[query_dim.dim_index];
+        const auto end = posting_begin_[query_dim.dim_index + 1];
+        for (auto p = begin; p < end; ++p) {
+            const auto row = posting_rows_[p];
+            if (row >= row_count) {
+                break;
+            }
+            if (states[row] == kUnseen) {
+                if (!admit) {
+                    continue;
+                }
+                const auto id = begin_id + row;
+                if (id < bitset_size && bitset.test(id)) {
+                    states[row] = kFiltered;
+                    continue;
+                }
+                states[row] = kCandidate;
+                candidates.push_back(row);
+            }
+            if (states[row] == kCandidate) {
+                scores[row] += query_dim.weight * posting_values_[p];
+            }
+        }
+        if (admit && static_cast<int64_t>(candidates.size()) >= topk) {
+            // an unseen row scores at most remaining[i + 1], strictly below
+            // the k-th best it cannot make it, even by a tie
+            kth.clear();
+            for (auto row : candidates) {
+                kth.push_back(scores[row]);
+            }
+            std::nth_element(kth.begin(),
+                             kth.begin() + topk - 1,
+                             kth.end(),
+                             std::greater<>());
+            admit = !(kth[topk - 1] > remaining[i + 1]);
+        }
+    }
+
+    auto better = [&](uint32_t a, uint32_t b) {
+        return scores[a] > scores[b] || (scores[a] == scores[b] && a < b);
+    };
+    auto found = std::min<int64_t>(topk, candidates.size());
+    std::partial_sort(candidates.begin(),
+                      candidates.begin() + found,
+                      candidates.end(),
+                      better);
+    for (int64_t k = 0; k < found; ++k) {
+        const auto row = candidates[k];
+        if (scores[row] <= 0) {
+            break;
+        }
+        offsets[k] = begin_id + row;
+        distances[k] = scores[row];
+    }
+}
+
+}  // namespace milvus::query
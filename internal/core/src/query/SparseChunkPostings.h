@@ -0,0 +1,73 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "common/BitsetView.h"
+#include "common/Types.h"
+#include "knowhere/sparse_utils.h"
+
+namespace milvus::query {
+
+// An inverted index of the rows of a sparse vector chunk, for brute force
+// search: for every dimension, the rows with a value there and the values.
+//
+// Search evaluates a query a dimension at a time into per row score
+// accumulators instead of a dot product per row, so rows sharing no
+// dimension with the query cost nothing. Dimensions are taken by their
+// largest possible contribution, and once the k-th best score is above what
+// the remaining dimensions could add to an unseen row, no new rows are
+// admitted (max-score pruning). The results are exact.
+class SparseChunkPostings {
+ public:
+    using SparseRow = knowhere::sparse::SparseRow<SparseValueType>;
+
+    SparseChunkPostings(const SparseRow* rows, int64_t num_rows);
+
+    int64_t
+    num_rows() const {
+        return num_rows_;
+    }
+
+    size_t
+    memory_bytes() const;
+
+    // Inner product top-k of the first `row_count` rows with `query`, best
+    // first with equal scores by lower row. Rows set in `bitset`, at
+    // begin_id + row, and rows scoring 0 are left out, slots past the rows
+    // found are left as they are. Result offsets are begin_id + row.
+    void
+    Search(const SparseRow& query,
+           int64_t row_count,
+           int64_t topk,
+           int64_t begin_id,
+           const BitsetView& bitset,
+           int64_t* offsets,
+           float* distances) const;
+
+ private:
+    int64_t num_rows_{0};
+    // the dimensions with a value in some row, ascending
+    std::vector<uint32_t> dims_;
+    // the postings of dims_[i] are [posting_begin_[i], posting_begin_[i + 1]),
+    // by ascending row
+    std::vector<uint32_t> posting_begin_;
+    std::vector<uint32_t> posting_rows_;
+    std::vector<float> posting_values_;
+    // the largest value of each dimension
+    std::vector<float> max_values_;
+};
+
+}  // namespace milvus::query
@@ -0,0 +1,140 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <map>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "common/BitsetView.h"
+#include "common/Types.h"
+#include "knowhere/sparse_utils.h"
+#include "query/SparseChunkPostings.h"
+
+using milvus::query::SparseChunkPostings;
+using SparseRow = SparseChunkPostings::SparseRow;
+
+namespace {
+
+// rows over `dim` dimensions, every value set with probability `density`
+std::vector<SparseRow>
+RandomRows(int64_t rows, uint32_t dim, double density, uint32_t seed) {
+    std::mt19937 gen(seed);
+    std::bernoulli_distribution set(density);
+    std::uniform_real_distribution<float> value(0.01, 1);
+    std::vector<SparseRow> result;
+    for (int64_t r = 0; r < rows; ++r) {
+        std::map<uint32_t, float> values;
+        for (uint32_t d = 0; d < dim; ++d) {
+            if (set(gen)) {
+                values[d] = value(gen);
+            }
+        }
+        SparseRow row(values.size());
+        size_t j = 0;
+        for (auto [d, v] : values) {
+            row.set_at(j++, d, v);
+        }
+        result.push_back(std::move(row));
+    }
+    return result;
+}
+
+// the rows under row_count not filtered out scoring above 0, best first
+std::vector<std::pair<float, int64_t>>
+SearchRef(const std::vector<SparseRow>& rows,
+          const SparseRow& query,
+          int64_t row_count,
+          int64_t topk,
+          const milvus::TargetBitmap& filtered) {
+    std::vector<std::pair<float, int64_t>> scores;
+    for (int64_t r = 0; r < row_count; ++r) {
+        auto score = rows[r].dot(query);
+        if (!filtered[r] && score > 0) {
+            scores.emplace_back(score, r);
+        }
+    }
+    std::sort(scores.begin(), scores.end(), [](auto& a, auto& b) {
+        return a.first > b.first || (a.first == b.first && a.second < b.second);
+    });
+    scores.resize(std::min<size_t>(scores.size(), topk));
+    return scores;
+}
+
+}  // namespace
+
+TEST(SparseChunkPostingsTest, MatchesRowWiseSearch) {
+    constexpr int64_t kRows = 2000;
+    constexpr int64_t kTopk = 10;
+    auto rows = RandomRows(kRows, 300, 0.02, 1);
+    auto queries = RandomRows(20, 300, 0.05, 2);
+    SparseChunkPostings postings(rows.data(), kRows);
+    EXPECT_EQ(postings.num_rows(), kRows);
+    EXPECT_GT(postings.memory_bytes(), size_t{0});
+
+    milvus::TargetBitmap filtered(kRows, false);
+    for (int64_t r = 0; r < kRows; r += 3) {
+        filtered[r] = true;
+    }
+    milvus::BitsetView bitset(filtered);
+    milvus::TargetBitmap none(kRows, false);
+    for (auto row_count : {kRows, kRows / 2}) {
+        for (const auto& query : queries) {
+            for (auto filter : {false, true}) {
+                std::vector<int64_t> offsets(kTopk, -1);
+                std::vector<float> distances(
+                    kTopk, std::numeric_limits<float>::lowest());
+                postings.Search(query,
+                                row_count,
+                                kTopk,
+                                0,
+                                filter ? bitset : milvus::BitsetView{},
+                                offsets.data(),
+                                distances.data());
+                auto expected = SearchRef(
+                    rows, query, row_count, kTopk, filter ? filtered : none);
+                for (int64_t k = 0; k < kTopk; ++k) {
+                    if (k >= static_cast<int64_t>(expected.size())) {
+                        EXPECT_EQ(offsets[k], -1);
+                        continue;
+                    }
+                    EXPECT_EQ(offsets[k], expected[k].second);
+                    EXPECT_NEAR(distances[k], expected[k].first, 1e-5);
+                }
+            }
+        }
+    }
+}
+
+TEST(SparseChunkPostingsTest, OffsetsRowsByBeginId) {
+    auto rows = RandomRows(100, 20, 0.3, 3);
+    SparseChunkPostings postings(rows.data(), rows.size());
+    // the bitset covers the rows of every chunk, this one starts at 1000
+    milvus::TargetBitmap filtered(1100, false);
+    filtered[1000] = true;
+    milvus::BitsetView bitset(filtered);
+
+    std::vector<int64_t> offsets(200, -1);
+    std::vector<float> distances(200, 0);
+    postings.Search(
+        rows[0], 100, 200, 1000, bitset, offsets.data(), distances.data());
+    EXPECT_EQ(std::count(offsets.begin(), offsets.end(), 1000), 0);
+    for (auto offset : offsets) {
+        EXPECT_TRUE(offset == -1 || (offset > 1000 && offset < 1100));
+    }
+    EXPECT_TRUE(std::is_sorted(
+        distances.begin(), distances.end(), std::greater<>()));
+}
@@ -9,14 +9,18 @@
 // is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
 // or implied. See the License for the specific language governing permissions and limitations under the License
 
+#include <algorithm>
 #include <cmath>
+#include <future>
 #include <iterator>
 #include <string>
 
 #include "common/FastMem.h"
 
 #include "common/EasyAssert.h"
+#include "folly/ScopeGuard.h"
 #include "query/SubSearchResult.h"
+#include "storage/ThreadPools.h"
 
 namespace milvus::query {
 
@@ -81,6 +85,146 @@ SubSearchResult::merge_impl(const SubSearchResult& right) {
     }
 }
 
+template <bool is_desc>
+void
+SubSearchResult::merge_many_impl(const std::vector<SubSearchResult>& others,
+                                 int64_t qn_begin,
+                                 int64_t qn_end) {
+    // source 0 is this result, source i + 1 is others[i]; on equal
+    // distances the lower source wins, as the left side does in merge_impl
+    struct Head {
+        float distance;
+        size_t source;
+    };
+    // std heaps keep the largest element on top: order the worst first
+    auto worse = [](const Head& a, const Head& b) {
+        if (a.distance != b.distance) {
+            return is_desc ? a.distance < b.distance
+                           : a.distance > b.distance;
+        }
+        return a.source > b.source;
+    };
+
+    const auto num_sources = others.size() + 1;
+    std::vector<const int64_t*> src_ids(num_sources);
+    std::vector<const float*> src_distances(num_sources);
+    std::vector<int64_t> cursors(num_sources);
+    std::vector<Head> heap;
+    heap.reserve(num_sources);
+    std::vector<float> buf_distances(topk_);
+    std::vector<int64_t> buf_ids(topk_);
+    const auto invalid_distance = init_value(metric_type_);
+
+    auto push_head = [&](size_t src) {
+        auto cursor = cursors[src];
+        if (cursor < topk_ && src_ids[src][cursor] != INVALID_SEG_OFFSET) {
+            heap.push_back({src_distances[src][cursor], src});
+            std::push_heap(heap.begin(), heap.end(), worse);
+        }
+    };
+
+    for (int64_t qn = qn_begin; qn < qn_end; ++qn) {
+        auto offset = qn * topk_;
+        src_ids[0] = this->get_offsets() + offset;
+        src_distances[0] = this->get_distances() + offset;
+        for (size_t i = 0; i < others.size(); ++i) {
+            src_ids[i + 1] = others[i].get_ids() + offset;
+            src_distances[i + 1] = others[i].get_distances() + offset;
+        }
+        std::fill(cursors.begin(), cursors.end(), 0);
+        heap.clear();
+        for (size_t src = 0; src < num_sources; ++src) {
+            push_head(src);
+        }
+
+        int64_t filled = 0;
+        for (; filled < topk_ && !heap.empty(); ++filled) {
+            std::pop_heap(heap.begin(), heap.end(), worse);
+            auto best = heap.back();
+            heap.pop_back();
+            buf_distances[filled] = best.distance;
+            buf_ids[filled] = src_ids[best.source][cursors[best.source]];
+            ++cursors[best.source];
+            push_head(best.source);
+        }
+        std::fill(buf_ids.begin() + filled, buf_ids.end(), INVALID_SEG_OFFSET);
+        std::fill(buf_distances.begin() + filled,
+                  buf_distances.end(),
+                  invalid_distance);
+        milvus::fastmem::FastMemcpy(this->get_distances() + offset,
+                                    buf_distances.data(),
+                                    topk_ * sizeof(float));
+        milvus::fastmem::FastMemcpy(this->get_offsets() + offset,
+                                    buf_ids.data(),
+                                    topk_ * sizeof(int64_t));
+    }
+}
+
+template <bool is_desc>
+void
+SubSearchResult::merge_many_parallel(
+    const std::vector<SubSearchResult>& others) {
+    const int64_t entries =
+        num_queries_ * topk_ * static_cast<int64_t>(others.size() + 1);
+    const int64_t num_tasks =
+        std::min(num_queries_, entries / kParallelMergeEntriesPerTask);
+    if (num_tasks <= 1) {
+        merge_many_impl<is_desc>(others, 0, num_queries_);
+        return;
+    }
+
+    // the queries are independent: each task owns a range of them
+    auto& pool = ThreadPools::GetThreadPool(milvus::ThreadPoolPriority::MIDDLE);
+    std::vector<std::future<void>> futures;
+    futures.reserve(num_tasks);
+    auto futures_guard = folly::makeGuard([&futures]() {
+        for (auto& f : futures) {
+            if (f.valid()) {
+                try {
+                    f.get();
+                } catch (...) {
+                }
+            }
+        }
+    });
+    const auto per_task = upper_div(num_queries_, num_tasks);
+    for (int64_t begin = 0; begin < num_queries_; begin += per_task) {
+        auto end = std::min(num_queries_, begin + per_task);
+        futures.emplace_back(pool.Submit([this, &others, begin, end] {
+            merge_many_impl<is_desc>(others, begin, end);
+        }));
+    }
+    for (auto& future : futures) {
+        future.get();
+    }
+}
+
+void
+SubSearchResult::merge(const std::vector<SubSearchResult>& others) {
+    bool has_iterators = false;
+    for (const auto& other : others) {
+        AssertInfo(metric_type_ == other.metric_type_,
+                   "[SubSearchResult]Metric type check failed when merge");
+        has_iterators |= !other.chunk_iterators_.empty();
+    }
+    if (has_iterators) {
+        for (const auto& other : others) {
+            merge(other);
+        }
+        return;
+    }
+    for (const auto& other : others) {
+        AssertInfo(num_queries_ == other.num_queries_,
+                   "[SubSearchResult]Nq check failed");
+        AssertInfo(topk_ == other.topk_, "[SubSearchResult]Topk check failed");
+    }
+    if (PositivelyRelated(metric_type_)) {
+        this->merge_many_parallel<true>(others);
+    } else {
+        this->merge_many_parallel<false>(others);
+    }
+}
+
 void
 SubSearchResult::merge(const SubSearchResult& other) {
     AssertInfo(metric_type_ == other.metric_type_,
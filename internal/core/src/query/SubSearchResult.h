@@ -113,6 +113,11 @@ class SubSearchResult {
     void
     merge(const SubSearchResult& other);
 
+    // Merges `others` into this result in a single pass over each query's
+    // top-k, giving the same result as merging them one by one in order.
+    void
+    merge(const std::vector<SubSearchResult>& others);
+
     const std::vector<knowhere::IndexNode::IteratorPtr>&
     chunk_iterators() {
         return this->chunk_iterators_;
@@ -128,6 +133,21 @@ class SubSearchResult {
     void
     merge_impl(const SubSearchResult& sub_result);
 
+    // merges queries [qn_begin, qn_end) with one heap over the sources
+    template <bool is_desc>
+    void
+    merge_many_impl(const std::vector<SubSearchResult>& others,
+                    int64_t qn_begin,
+                    int64_t qn_end);
+
+    template <bool is_desc>
+    void
+    merge_many_parallel(const std::vector<SubSearchResult>& others);
+
+    // below this many merged entries per task the merge stays on the
+    // calling thread
+    static constexpr int64_t kParallelMergeEntriesPerTask = 1 << 18;
+
  private:
     int64_t num_queries_;
     int64_t topk_;
@@ -138,4 +158,41 @@ class SubSearchResult {
     std::vector<knowhere::IndexNode::IteratorPtr> chunk_iterators_;
 };
 
+// Folds the per-chunk results of a brute force search into `target`.
+// Merging chunk by chunk rewrites every query's top-k once per chunk; the
+// results are instead held back and merged in one k-way pass per query,
+// split across threads by query. Held-back results are bounded by
+// kMaxPendingEntries, past which they are merged early.
+class ChunkResultMerger {
+ public:
+    static constexpr int64_t kMaxPendingEntries = 1 << 21;
+
+    explicit ChunkResultMerger(SubSearchResult& target) : target_(target) {
+    }
+
+    void
+    add(SubSearchResult&& sub_result) {
+        pending_entries_ +=
+            sub_result.get_num_queries() * sub_result.get_topk();
+        pending_.emplace_back(std::move(sub_result));
+        if (pending_entries_ >= kMaxPendingEntries) {
+            flush();
+        }
+    }
+
+    void
+    flush() {
+        if (!pending_.empty()) {
+            target_.merge(pending_);
+            pending_.clear();
+            pending_entries_ = 0;
+        }
+    }
+
+ private:
+    SubSearchResult& target_;
+    std::vector<SubSearchResult> pending_;
+    int64_t pending_entries_ = 0;
+};
+
 }  // namespace milvus::query
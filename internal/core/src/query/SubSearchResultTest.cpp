@@ -141,3 +141,41 @@ TEST(Reduce, SubSearchResult) {
     TestSubSearchResultMerge<queue_type_ip>(knowhere::metric::IP, 4, 16, 1);
     TestSubSearchResultMerge<queue_type_ip>(knowhere::metric::IP, 4, 16, 10);
 }
+
+void
+TestSubSearchResultMergeMany(const int64_t nq,
+                             const int64_t topk,
+                             const int64_t num_chunks) {
+    for (auto metric_type : {knowhere::metric::L2, knowhere::metric::IP}) {
+        SubSearchResult one_by_one(nq, topk, metric_type, 3);
+        SubSearchResult batched(nq, topk, metric_type, 3);
+        ChunkResultMerger merger(batched);
+        for (int i = 0; i < num_chunks; ++i) {
+            auto sub_result = GenSubSearchResult(nq, topk, metric_type, 3);
+            // a chunk with fewer than topk hits leaves an invalid tail
+            if (i % 3 == 1) {
+                for (int n = 0; n < nq; ++n) {
+                    for (int k = topk / 2; k < topk; ++k) {
+                        sub_result->get_offsets()[n * topk + k] =
+                            INVALID_SEG_OFFSET;
+                        sub_result->get_distances()[n * topk + k] =
+                            SubSearchResult::init_value(metric_type);
+                    }
+                }
+            }
+            one_by_one.merge(*sub_result);
+            merger.add(std::move(*sub_result));
+        }
+        merger.flush();
+        EXPECT_EQ(batched.mutable_offsets(), one_by_one.mutable_offsets());
+        EXPECT_EQ(batched.mutable_distances(),
+                  one_by_one.mutable_distances());
+    }
+}
+
+TEST(Reduce, SubSearchResultMergeMany) {
+    TestSubSearchResultMergeMany(8, 10, 19);
+    TestSubSearchResultMergeMany(1, 1, 3);
+    // large enough to be split across threads by query
+    TestSubSearchResultMergeMany(64, 2000, 5);
+}
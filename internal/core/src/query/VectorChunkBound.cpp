@@ -0,0 +1,193 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include "query/VectorChunkBound.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <limits>
+
+#include "common/Consts.h"
+#include "common/Utils.h"
+#include "knowhere/comp/index_param.h"
+
+namespace milvus::query {
+
+namespace {
+
+// the best distance inside a bound, and the magnitude of the distances
+// around it, which the float error of a computed distance scales with
+struct BoundDistance {
+    double best;
+    double scale;
+};
+
+double
+Norm(const float* vec, int64_t dim) {
+    double sum = 0;
+    for (int64_t i = 0; i < dim; i++) {
+        sum += static_cast<double>(vec[i]) * vec[i];
+    }
+    return std::sqrt(sum);
+}
+
+double
+Norm(const std::vector<double>& vec) {
+    double sum = 0;
+    for (auto v : vec) {
+        sum += v * v;
+    }
+    return std::sqrt(sum);
+}
+
+double
+Dot(const float* query, const std::vector<double>& centroid) {
+    double sum = 0;
+    for (size_t i = 0; i < centroid.size(); i++) {
+        sum += query[i] * centroid[i];
+    }
+    return sum;
+}
+
+std::optional<BoundDistance>
+DistanceInBound(const VectorChunkBound& bound,
+                const float* query,
+                int64_t dim,
+                const MetricType& metric_type) {
+    auto query_norm = Norm(query, dim);
+    if (IsMetricType(metric_type, knowhere::metric::L2)) {
+        double sum = 0;
+        for (int64_t i = 0; i < dim; i++) {
+            auto diff = query[i] - bound.centroid[i];
+            sum += diff * diff;
+        }
+        // L2 distances are squared
+        auto gap = std::max(0.0, std::sqrt(sum) - bound.radius);
+        auto reach = query_norm + Norm(bound.centroid) + bound.radius;
+        return BoundDistance{gap * gap, reach * reach};
+    }
+    if (IsMetricType(metric_type, knowhere::metric::IP)) {
+        return BoundDistance{
+            Dot(query, bound.centroid) + query_norm * bound.radius,
+            query_norm * (Norm(bound.centroid) + bound.radius)};
+    }
+    if (IsMetricType(metric_type, knowhere::metric::COSINE)) {
+        if (query_norm == 0 || std::isinf(bound.unit_radius)) {
+            return std::nullopt;
+        }
+        return BoundDistance{
+            Dot(query, bound.unit_centroid) / query_norm + bound.unit_radius,
+            1.0};
+    }
+    return std::nullopt;
+}
+
+}  // namespace
+
+VectorChunkBound
+ComputeVectorChunkBound(const float* data, int64_t rows, int64_t dim) {
+    VectorChunkBound bound;
+    bound.centroid.assign(dim, 0);
+    bound.unit_centroid.assign(dim, 0);
+    if (rows == 0) {
+        return bound;
+    }
+    bool has_zero = false;
+    for (int64_t row = 0; row < rows; row++) {
+        auto vec = data + row * dim;
+        auto norm = Norm(vec, dim);
+        has_zero |= norm == 0;
+        for (int64_t i = 0; i < dim; i++) {
+            bound.centroid[i] += vec[i];
+            if (norm != 0) {
+                bound.unit_centroid[i] += vec[i] / norm;
+            }
+        }
+    }
+    for (int64_t i = 0; i < dim; i++) {
+        bound.centroid[i] /= rows;
+        bound.unit_centroid[i] /= rows;
+    }
+    for (int64_t row = 0; row < rows; row++) {
+        auto vec = data + row * dim;
+        auto norm = Norm(vec, dim);
+        double sum = 0;
+        double unit_sum = 0;
+        for (int64_t i = 0; i < dim; i++) {
+            auto diff = vec[i] - bound.centroid[i];
+            sum += diff * diff;
+            if (norm != 0) {
+                auto unit_diff = vec[i] / norm - bound.unit_centroid[i];
+                unit_sum += unit_diff * unit_diff;
+            }
+        }
+        bound.radius = std::max(bound.radius, std::sqrt(sum));
+        bound.unit_radius = std::max(bound.unit_radius, std::sqrt(unit_sum));
+    }
+    if (has_zero) {
+        bound.unit_radius = std::numeric_limits<double>::infinity();
+    }
+    return bound;
+}
+
+std::optional<double>
+BestDistanceInBound(const VectorChunkBound& bound,
+                    const float* query,
+                    int64_t dim,
+                    const MetricType& metric_type) {
+    auto distance = DistanceInBound(bound, query, dim, metric_type);
+    if (!distance.has_value()) {
+        return std::nullopt;
+    }
+    return distance.value().best;
+}
+
+bool
+CanSkipChunk(const VectorChunkBound& bound,
+             const dataset::SearchDataset& query_ds,
+             const SubSearchResult& result) {
+    auto topk = result.get_topk();
+    if (topk <= 0) {
+        return false;
+    }
+    auto dim = query_ds.dim;
+    bool larger_is_closer = PositivelyRelated(query_ds.metric_type);
+    // a float distance over dim terms is off by up to about dim ulps
+    auto relative_error = 4.0 * dim * FLT_EPSILON;
+    auto rounding = query_ds.round_decimal == -1
+                        ? 0.0
+                        : std::pow(10.0, -query_ds.round_decimal);
+    auto queries = static_cast<const float*>(query_ds.query_data);
+    for (int64_t q = 0; q < query_ds.num_queries; q++) {
+        auto kth = q * topk + topk - 1;
+        if (result.get_ids()[kth] == INVALID_SEG_OFFSET) {
+            return false;
+        }
+        auto distance = DistanceInBound(
+            bound, queries + q * dim, dim, query_ds.metric_type);
+        if (!distance.has_value()) {
+            return false;
+        }
+        auto slack = relative_error * distance.value().scale + rounding;
+        double kth_distance = result.get_distances()[kth];
+        // written so that NaN never skips
+        bool beyond = larger_is_closer
+                          ? distance.value().best + slack < kth_distance
+                          : distance.value().best - slack > kth_distance;
+        if (!beyond) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace milvus::query
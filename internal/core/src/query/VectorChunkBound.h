@@ -0,0 +1,74 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include "common/Types.h"
+#include "query/SubSearchResult.h"
+#include "query/helper.h"
+
+namespace milvus::query {
+
+// A ball holding every vector of a chunk: the mean of the vectors and the
+// distance from it to the farthest one, for the raw vectors and for the
+// vectors normalized as COSINE compares them. Chunks of a clustered segment
+// hold vectors close to each other, so their balls are small and a brute
+// force search can skip most of them.
+struct VectorChunkBound {
+    std::vector<double> centroid;
+    double radius = 0;
+    std::vector<double> unit_centroid;
+    // infinite when the chunk holds a zero vector
+    double unit_radius = 0;
+};
+
+VectorChunkBound
+ComputeVectorChunkBound(const float* data, int64_t rows, int64_t dim);
+
+// The best distance any vector inside `bound` can have to `query` under
+// `metric_type`, std::nullopt for a metric other than L2, IP and COSINE.
+std::optional<double>
+BestDistanceInBound(const VectorChunkBound& bound,
+                    const float* query,
+                    int64_t dim,
+                    const MetricType& metric_type);
+
+// Whether no vector inside `bound` can enter the top-k `result` holds for
+// any of the queries of `query_ds`, allowing for the float error of the
+// distances a brute force search computes and for the rounding of
+// `round_decimal`.
+bool
+CanSkipChunk(const VectorChunkBound& bound,
+             const dataset::SearchDataset& query_ds,
+             const SubSearchResult& result);
+
+// The bounds of the chunks of one vector column, computed by the first
+// search that needs them.
+class VectorChunkBounds {
+ public:
+    template <typename Compute>
+    const std::vector<VectorChunkBound>&
+    Get(Compute&& compute) {
+        std::call_once(once_, [&]() { bounds_ = compute(); });
+        return bounds_;
+    }
+
+ private:
+    std::once_flag once_;
+    std::vector<VectorChunkBound> bounds_;
+};
+
+}  // namespace milvus::query
@@ -0,0 +1,137 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "knowhere/comp/index_param.h"
+#include "query/VectorChunkBound.h"
+
+using milvus::query::BestDistanceInBound;
+using milvus::query::CanSkipChunk;
+using milvus::query::ComputeVectorChunkBound;
+using milvus::query::SubSearchResult;
+
+namespace {
+
+double
+Distance(const float* x,
+         const float* y,
+         int64_t dim,
+         const std::string& metric) {
+    double dot = 0, l2 = 0, x_norm = 0, y_norm = 0;
+    for (int64_t i = 0; i < dim; i++) {
+        dot += x[i] * y[i];
+        l2 += (x[i] - y[i]) * (x[i] - y[i]);
+        x_norm += x[i] * x[i];
+        y_norm += y[i] * y[i];
+    }
+    if (metric == knowhere::metric::L2) {
+        return l2;
+    }
+    if (metric == knowhere::metric::IP) {
+        return dot;
+    }
+    return dot / std::sqrt(x_norm * y_norm);
+}
+
+}  // namespace
+
+TEST(VectorChunkBoundTest, BoundsEveryVector) {
+    const int64_t dim = 24;
+    const int64_t rows = 200;
+    std::mt19937 rng(3);
+    std::normal_distribution<float> noise(0, 0.2);
+    std::vector<float> data(rows * dim);
+    for (int64_t i = 0; i < rows * dim; i++) {
+        // a cluster away from the origin
+        data[i] = 2.0f + noise(rng);
+    }
+    auto bound = ComputeVectorChunkBound(data.data(), rows, dim);
+    EXPECT_GT(bound.radius, 0);
+    EXPECT_FALSE(std::isinf(bound.unit_radius));
+
+    std::normal_distribution<float> query_value(0, 3);
+    for (const std::string metric : {knowhere::metric::L2,
+                                     knowhere::metric::IP,
+                                     knowhere::metric::COSINE}) {
+        bool larger_is_closer = metric != knowhere::metric::L2;
+        for (int round = 0; round < 20; round++) {
+            std::vector<float> query(dim);
+            for (auto& v : query) {
+                v = query_value(rng);
+            }
+            auto best = BestDistanceInBound(bound, query.data(), dim, metric);
+            ASSERT_TRUE(best.has_value());
+            for (int64_t row = 0; row < rows; row++) {
+                auto distance = Distance(
+                    query.data(), data.data() + row * dim, dim, metric);
+                if (larger_is_closer) {
+                    EXPECT_LE(distance, best.value() + 1e-9) << metric;
+                } else {
+                    EXPECT_GE(distance, best.value() - 1e-9) << metric;
+                }
+            }
+        }
+    }
+
+    std::vector<float> query(dim, 1);
+    EXPECT_FALSE(
+        BestDistanceInBound(bound, query.data(), dim, knowhere::metric::BM25)
+            .has_value());
+
+    // COSINE can't bound a zero vector, it has no direction
+    std::fill(data.begin(), data.begin() + dim, 0.0f);
+    auto with_zero = ComputeVectorChunkBound(data.data(), rows, dim);
+    EXPECT_TRUE(std::isinf(with_zero.unit_radius));
+    EXPECT_FALSE(BestDistanceInBound(
+                     with_zero, query.data(), dim, knowhere::metric::COSINE)
+                     .has_value());
+}
+
+TEST(VectorChunkBoundTest, SkipsOnlyChunksBeyondTopk) {
+    const int64_t dim = 4;
+    // four vectors around (10, 10, 10, 10)
+    std::vector<float> data = {10, 10, 10, 10, 11, 10, 10, 10,
+                               10, 11, 10, 10, 10, 10, 11, 10};
+    auto bound = ComputeVectorChunkBound(data.data(), 4, dim);
+
+    std::vector<float> query(dim, 0);
+    milvus::query::dataset::SearchDataset query_ds{
+        knowhere::metric::L2, 1, 2, -1, dim, query.data()};
+    SubSearchResult result(1, 2, knowhere::metric::L2, -1);
+    // the top-k is not full yet
+    EXPECT_FALSE(CanSkipChunk(bound, query_ds, result));
+
+    result.get_offsets()[0] = 0;
+    result.get_offsets()[1] = 1;
+    result.get_distances()[0] = 1;
+    result.get_distances()[1] = 2;
+    EXPECT_TRUE(CanSkipChunk(bound, query_ds, result));
+
+    // the chunk's closest vector beats the second result
+    result.get_distances()[1] = 1000;
+    EXPECT_FALSE(CanSkipChunk(bound, query_ds, result));
+
+    // the nearest vector is at 400, the bound is about 382.1, rounding the
+    // distances to integers may hide a vector as close as 381.5
+    result.get_distances()[1] = 381.5;
+    query_ds.round_decimal = -1;
+    EXPECT_TRUE(CanSkipChunk(bound, query_ds, result));
+    query_ds.round_decimal = 6;
+    EXPECT_TRUE(CanSkipChunk(bound, query_ds, result));
+    query_ds.round_decimal = 0;
+    EXPECT_FALSE(CanSkipChunk(bound, query_ds, result));
+}
@@ -0,0 +1,394 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "query/VectorKernels.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include "common/EasyAssert.h"
+#include "common/Utils.h"
+#include "knowhere/comp/index_param.h"
+#include "query/VectorKernelsImpl.h"
+
+#if defined(__x86_64__)
+#include <cpuid.h>
+#elif defined(__aarch64__) && defined(__linux__)
+#include <sys/auxv.h>
+#ifndef HWCAP_ASIMDDP
+#define HWCAP_ASIMDDP (1 << 20)
+#endif
+#endif
+
+namespace milvus::query {
+
+// ── CPU feature detection ───────────────────────────────────────────────
+
+namespace {
+
+#if defined(__x86_64__)
+// XCR0 tells which SIMD state the OS saves, CPUID alone may report AVX-512
+// in VMs and containers where using it faults
+unsigned int
+xgetbv(unsigned int xcr) {
+    unsigned int eax, edx;
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(xcr));
+    return eax;
+}
+
+bool
+HasAvx512PopcntVnni() {
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx) || !(ecx & (1u << 27))) {
+        return false;
+    }
+    // SSE, AVX, opmask, ZMM_Hi256 and Hi16_ZMM state
+    if ((xgetbv(0) & 0xE6) != 0xE6) {
+        return false;
+    }
+    if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+        return false;
+    }
+    // must match the flags of VectorKernelsAvx512.cpp in CMakeLists.txt
+    constexpr unsigned int kAvx512F = 1u << 16;
+    constexpr unsigned int kAvx512BW = 1u << 30;
+    constexpr unsigned int kAvx512VL = 1u << 31;
+    constexpr unsigned int kAvx512Vnni = 1u << 11;
+    constexpr unsigned int kAvx512Vpopcntdq = 1u << 14;
+    constexpr auto kEbx = kAvx512F | kAvx512BW | kAvx512VL;
+    constexpr auto kEcx = kAvx512Vnni | kAvx512Vpopcntdq;
+    return (ebx & kEbx) == kEbx && (ecx & kEcx) == kEcx;
+}
+#endif
+
+bool
+HasAcceleratedKernels() {
+#if defined(__x86_64__)
+    return HasAvx512PopcntVnni();
+#elif defined(__aarch64__) && defined(__linux__)
+    return (getauxval(AT_HWCAP) & HWCAP_ASIMDDP) != 0;
+#else
+    return false;
+#endif
+}
+
+// -1 until the first call resolves it to DetectVectorKernelLevel().
+std::atomic<int> active_level{-1};
+
+int
+ActiveLevel() {
+    auto level = active_level.load(std::memory_order_relaxed);
+    if (level < 0) {
+        level = static_cast<int>(DetectVectorKernelLevel());
+        active_level.store(level, std::memory_order_relaxed);
+    }
+    return level;
+}
+
+bool
+Accelerated() {
+    return ActiveLevel() >=
+           static_cast<int>(VectorKernelLevel::kAccelerated);
+}
+
+}  // namespace
+
+VectorKernelLevel
+DetectVectorKernelLevel() {
+    static const auto level = HasAcceleratedKernels()
+                                  ? VectorKernelLevel::kAccelerated
+                                  : VectorKernelLevel::kBaseline;
+    return level;
+}
+
+void
+SetVectorKernelLevel(VectorKernelLevel level) {
+    auto capped = std::min(static_cast<int>(level),
+                           static_cast<int>(DetectVectorKernelLevel()));
+    active_level.store(std::max(capped, 0), std::memory_order_relaxed);
+}
+
+VectorKernelLevel
+GetVectorKernelLevel() {
+    return static_cast<VectorKernelLevel>(ActiveLevel());
+}
+
+// ── Baseline implementation ─────────────────────────────────────────────
+
+namespace baseline {
+
+namespace {
+
+// the popcount of the xor, and, or of two codes, 8 bytes at a time
+template <typename Op>
+uint64_t
+CountBits(const uint8_t* a, const uint8_t* b, int64_t size, Op op) {
+    uint64_t count = 0;
+    int64_t k = 0;
+    for (; k + 8 <= size; k += 8) {
+        uint64_t x, y;
+        std::memcpy(&x, a + k, sizeof(x));
+        std::memcpy(&y, b + k, sizeof(y));
+        count += __builtin_popcountll(op(x, y));
+    }
+    for (; k < size; ++k) {
+        count += __builtin_popcount(op(uint64_t(a[k]), uint64_t(b[k])));
+    }
+    return count;
+}
+
+}  // namespace
+
+void
+HammingDistances(const uint8_t* query,
+                 const uint8_t* codes,
+                 int64_t num_rows,
+                 int64_t code_size,
+                 float* out) {
+    for (int64_t i = 0; i < num_rows; ++i) {
+        out[i] = static_cast<float>(
+            CountBits(query,
+                      codes + i * code_size,
+                      code_size,
+                      [](uint64_t x, uint64_t y) { return x ^ y; }));
+    }
+}
+
+void
+JaccardDistances(const uint8_t* query,
+                 const uint8_t* codes,
+                 int64_t num_rows,
+                 int64_t code_size,
+                 float* out) {
+    for (int64_t i = 0; i < num_rows; ++i) {
+        const auto* code = codes + i * code_size;
+        auto both = CountBits(
+            query, code, code_size, [](uint64_t x, uint64_t y) {
+                return x & y;
+            });
+        auto any = CountBits(
+            query, code, code_size, [](uint64_t x, uint64_t y) {
+                return x | y;
+            });
+        out[i] = any == 0 ? 0.0f
+                          : static_cast<float>(any - both) /
+                                static_cast<float>(any);
+    }
+}
+
+void
+Int8InnerProducts(const int8_t* query,
+                  const int8_t* vectors,
+                  int64_t num_rows,
+                  int64_t dim,
+                  float* out) {
+    for (int64_t i = 0; i < num_rows; ++i) {
+        const auto* x = vectors + i * dim;
+        int32_t sum = 0;
+        for (int64_t k = 0; k < dim; ++k) {
+            sum += int32_t(query[k]) * int32_t(x[k]);
+        }
+        out[i] = static_cast<float>(sum);
+    }
+}
+
+}  // namespace baseline
+
+// ── Dispatcher ──────────────────────────────────────────────────────────
+
+void
+HammingDistances(const uint8_t* query,
+                 const uint8_t* codes,
+                 int64_t num_rows,
+                 int64_t code_size,
+                 float* out) {
+#if defined(__x86_64__)
+    if (Accelerated()) {
+        return avx512::HammingDistances(
+            query, codes, num_rows, code_size, out);
+    }
+#elif defined(__aarch64__)
+    if (Accelerated()) {
+        return dotprod::HammingDistances(
+            query, codes, num_rows, code_size, out);
+    }
+#endif
+    baseline::HammingDistances(query, codes, num_rows, code_size, out);
+}
+
+void
+JaccardDistances(const uint8_t* query,
+                 const uint8_t* codes,
+                 int64_t num_rows,
+                 int64_t code_size,
+                 float* out) {
+#if defined(__x86_64__)
+    if (Accelerated()) {
+        return avx512::JaccardDistances(
+            query, codes, num_rows, code_size, out);
+    }
+#elif defined(__aarch64__)
+    if (Accelerated()) {
+        return dotprod::JaccardDistances(
+            query, codes, num_rows, code_size, out);
+    }
+#endif
+    baseline::JaccardDistances(query, codes, num_rows, code_size, out);
+}
+
+void
+Int8InnerProducts(const int8_t* query,
+                  const int8_t* vectors,
+                  int64_t num_rows,
+                  int64_t dim,
+                  float* out) {
+#if defined(__x86_64__)
+    if (Accelerated()) {
+        return avx512::Int8InnerProducts(query, vectors, num_rows, dim, out);
+    }
+#elif defined(__aarch64__)
+    if (Accelerated()) {
+        return dotprod::Int8InnerProducts(query, vectors, num_rows, dim, out);
+    }
+#endif
+    baseline::Int8InnerProducts(query, vectors, num_rows, dim, out);
+}
+
+// ── Search ──────────────────────────────────────────────────────────────
+
+namespace {
+
+// rows scored per block, all queries go through a block before the next
+constexpr int64_t kBlockRows = 1024;
+
+// the key orders rows best first whichever way the metric goes: the
+// distance, negated when smaller is closer
+using ScoredRow = std::pair<float, int64_t>;
+
+// higher keys, then lower offsets
+struct BetterRow {
+    bool
+    operator()(const ScoredRow& a, const ScoredRow& b) const {
+        return a.first > b.first || (a.first == b.first && a.second < b.second);
+    }
+};
+
+// the worst of the kept rows on top
+using TopRows =
+    std::priority_queue<ScoredRow, std::vector<ScoredRow>, BetterRow>;
+
+}  // namespace
+
+bool
+UseVectorKernel(const dataset::SearchDataset& query_ds,
+                const dataset::RawDataset& raw_ds,
+                const MetricType& metric_type,
+                DataType data_type) {
+    if (query_ds.query_offsets != nullptr ||
+        raw_ds.raw_data_offsets != nullptr) {
+        return false;
+    }
+    if (data_type == DataType::VECTOR_BINARY) {
+        return IsMetricType(metric_type, knowhere::metric::HAMMING) ||
+               IsMetricType(metric_type, knowhere::metric::JACCARD);
+    }
+    return data_type == DataType::VECTOR_INT8 &&
+           IsMetricType(metric_type, knowhere::metric::IP);
+}
+
+void
+VectorKernelSearch(const dataset::SearchDataset& query_ds,
+                   const dataset::RawDataset& raw_ds,
+                   const MetricType& metric_type,
+                   DataType data_type,
+                   const BitsetView& bitset,
+                   int64_t* offsets,
+                   float* distances) {
+    AssertInfo(query_ds.dim == raw_ds.dim,
+               "query dim {} differs from the data dim {}",
+               query_ds.dim,
+               raw_ds.dim);
+    AssertInfo(UseVectorKernel(query_ds, raw_ds, metric_type, data_type),
+               "no vector kernel for {} vectors with metric {}",
+               data_type,
+               metric_type);
+    const auto nq = query_ds.num_queries;
+    const auto topk = query_ds.topk;
+    const bool binary = data_type == DataType::VECTOR_BINARY;
+    const bool jaccard =
+        IsMetricType(metric_type, knowhere::metric::JACCARD);
+    // bytes per row, a binary dim counts bits
+    const auto row_size = binary ? raw_ds.dim / 8 : raw_ds.dim;
+    const auto sign = PositivelyRelated(metric_type) ? 1.0f : -1.0f;
+    const auto* rows = static_cast<const uint8_t*>(raw_ds.raw_data);
+    const auto* queries = static_cast<const uint8_t*>(query_ds.query_data);
+
+    std::vector<TopRows> top(nq);
+    std::vector<float> scores(std::min(kBlockRows, raw_ds.num_raw_data));
+    for (int64_t begin = 0; begin < raw_ds.num_raw_data;
+         begin += kBlockRows) {
+        const auto count = std::min(kBlockRows, raw_ds.num_raw_data - begin);
+        const auto* block = rows + begin * row_size;
+        for (int64_t q = 0; q < nq; ++q) {
+            const auto* query = queries + q * row_size;
+            if (!binary) {
+                Int8InnerProducts(reinterpret_cast<const int8_t*>(query),
+                                  reinterpret_cast<const int8_t*>(block),
+                                  count,
+                                  row_size,
+                                  scores.data());
+            } else if (jaccard) {
+                JaccardDistances(query, block, count, row_size, scores.data());
+            } else {
+                HammingDistances(query, block, count, row_size, scores.data());
+            }
+            auto& heap = top[q];
+            for (int64_t j = 0; j < count; ++j) {
+                const auto id = raw_ds.begin_id + begin + j;
+                if (!bitset.empty() &&
+                    id < static_cast<int64_t>(bitset.size()) &&
+                    bitset.test(id)) {
+                    continue;
+                }
+                ScoredRow scored{sign * scores[j], id};
+                if (static_cast<int64_t>(heap.size()) < topk) {
+                    heap.push(scored);
+                } else if (BetterRow{}(scored, heap.top())) {
+                    heap.pop();
+                    heap.push(scored);
+                }
+            }
+        }
+    }
+
+    for (int64_t q = 0; q < nq; ++q) {
+        auto& heap = top[q];
+        // popped worst first
+        for (auto slot = static_cast<int64_t>(heap.size()) - 1; slot >= 0;
+             --slot) {
+            offsets[q * topk + slot] = heap.top().second;
+            distances[q * topk + slot] = sign * heap.top().first;
+            heap.pop();
+        }
+    }
+}
+
+}  // namespace milvus::query
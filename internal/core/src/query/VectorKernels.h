@@ -0,0 +1,98 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <cstdint>
+
+#include "common/BitsetView.h"
+#include "common/Types.h"
+#include "query/helper.h"
+
+namespace milvus::query {
+
+// Instruction set tiers of the binary and int8 distance kernels, in
+// increasing order. kAccelerated is AVX-512 with VPOPCNTDQ and VNNI on
+// x86-64 and the dot product extension (SDOT) on aarch64.
+enum class VectorKernelLevel : int {
+    kBaseline = 0,
+    kAccelerated = 1,
+};
+
+// Best tier supported by the CPU and OS.
+VectorKernelLevel
+DetectVectorKernelLevel();
+
+// Caps the tier used by the kernels, levels above DetectVectorKernelLevel()
+// are clamped. Meant for benchmarks and tests that compare tiers.
+void
+SetVectorKernelLevel(VectorKernelLevel level);
+
+// Tier currently used by the kernels.
+VectorKernelLevel
+GetVectorKernelLevel();
+
+// out[i] = the number of bits the query differs in from the i-th of the
+// num_rows codes of code_size bytes
+void
+HammingDistances(const uint8_t* query,
+                 const uint8_t* codes,
+                 int64_t num_rows,
+                 int64_t code_size,
+                 float* out);
+
+// out[i] = 1 - |query & code| / |query | code| for the i-th code, 0 when
+// both are empty
+void
+JaccardDistances(const uint8_t* query,
+                 const uint8_t* codes,
+                 int64_t num_rows,
+                 int64_t code_size,
+                 float* out);
+
+// out[i] = the inner product of the query and the i-th of the num_rows
+// vectors of dim elements
+void
+Int8InnerProducts(const int8_t* query,
+                  const int8_t* vectors,
+                  int64_t num_rows,
+                  int64_t dim,
+                  float* out);
+
+// Whether VectorKernelSearch serves a brute force search: binary vectors
+// with HAMMING or JACCARD, int8 vectors with IP, neither embedding lists.
+bool
+UseVectorKernel(const dataset::SearchDataset& query_ds,
+                const dataset::RawDataset& raw_ds,
+                const MetricType& metric_type,
+                DataType data_type);
+
+// Top-k brute force search of raw_ds with the kernels above. The rows are
+// scored in blocks that stay in cache while every query goes through them.
+// Rows set in `bitset`, at begin_id + row, are skipped. Writes num_queries
+// * topk offsets and distances, best first; slots past the rows found are
+// left as they are.
+void
+VectorKernelSearch(const dataset::SearchDataset& query_ds,
+                   const dataset::RawDataset& raw_ds,
+                   const MetricType& metric_type,
+                   DataType data_type,
+                   const BitsetView& bitset,
+                   int64_t* offsets,
+                   float* distances);
+
+}  // namespace milvus::query
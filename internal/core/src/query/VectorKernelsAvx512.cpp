@@ -0,0 +1,132 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Compiled with: -mavx512f -mavx512bw -mavx512vl -mavx512vpopcntdq
+// -mavx512vnni (set by CMakeLists.txt)
+
+#if defined(__x86_64__)
+
+#include <immintrin.h>
+
+#include "query/VectorKernelsImpl.h"
+
+namespace milvus::query::avx512 {
+
+namespace {
+
+// the bytes [k, size) of a code, at most 64, zeros past its end
+inline __m512i
+LoadTail(const uint8_t* data, int64_t k, int64_t size) {
+    const auto mask = _cvtu64_mask64(~0ULL >> (64 - (size - k)));
+    return _mm512_maskz_loadu_epi8(mask, data + k);
+}
+
+}  // namespace
+
+void
+HammingDistances(const uint8_t* query,
+                 const uint8_t* codes,
+                 int64_t num_rows,
+                 int64_t code_size,
+                 float* out) {
+    for (int64_t i = 0; i < num_rows; ++i) {
+        const auto* code = codes + i * code_size;
+        auto acc = _mm512_setzero_si512();
+        int64_t k = 0;
+        for (; k + 64 <= code_size; k += 64) {
+            auto x = _mm512_xor_si512(_mm512_loadu_si512(query + k),
+                                      _mm512_loadu_si512(code + k));
+            acc = _mm512_add_epi64(acc, _mm512_popcnt_epi64(x));
+        }
+        if (k < code_size) {
+            auto x = _mm512_xor_si512(LoadTail(query, k, code_size),
+                                      LoadTail(code, k, code_size));
+            acc = _mm512_add_epi64(acc, _mm512_popcnt_epi64(x));
+        }
+        out[i] = static_cast<float>(_mm512_reduce_add_epi64(acc));
+    }
+}
+
+void
+JaccardDistances(const uint8_t* query,
+                 const uint8_t* codes,
+                 int64_t num_rows,
+                 int64_t code_size,
+                 float* out) {
+    for (int64_t i = 0; i < num_rows; ++i) {
+        const auto* code = codes + i * code_size;
+        auto both = _mm512_setzero_si512();
+        auto any = _mm512_setzero_si512();
+        int64_t k = 0;
+        for (; k + 64 <= code_size; k += 64) {
+            auto a = _mm512_loadu_si512(query + k);
+            auto b = _mm512_loadu_si512(code + k);
+            both = _mm512_add_epi64(
+                both, _mm512_popcnt_epi64(_mm512_and_si512(a, b)));
+            any = _mm512_add_epi64(
+                any, _mm512_popcnt_epi64(_mm512_or_si512(a, b)));
+        }
+        if (k < code_size) {
+            auto a = LoadTail(query, k, code_size);
+            auto b = LoadTail(code, k, code_size);
+            both = _mm512_add_epi64(
+                both, _mm512_popcnt_epi64(_mm512_and_si512(a, b)));
+            any = _mm512_add_epi64(
+                any, _mm512_popcnt_epi64(_mm512_or_si512(a, b)));
+        }
+        auto both_count = _mm512_reduce_add_epi64(both);
+        auto any_count = _mm512_reduce_add_epi64(any);
+        out[i] = any_count == 0 ? 0.0f
+                                : static_cast<float>(any_count - both_count) /
+                                      static_cast<float>(any_count);
+    }
+}
+
+void
+Int8InnerProducts(const int8_t* query,
+                  const int8_t* vectors,
+                  int64_t num_rows,
+                  int64_t dim,
+                  float* out) {
+    // VPDPBUSD takes one unsigned operand, the signed elements are widened
+    // to 16 bits for VPDPWSSD instead, 32 of them per instruction
+    for (int64_t i = 0; i < num_rows; ++i) {
+        const auto* x = vectors + i * dim;
+        auto acc = _mm512_setzero_si512();
+        int64_t k = 0;
+        for (; k + 32 <= dim; k += 32) {
+            auto a = _mm512_cvtepi8_epi16(_mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(query + k)));
+            auto b = _mm512_cvtepi8_epi16(_mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(x + k)));
+            acc = _mm512_dpwssd_epi32(acc, a, b);
+        }
+        if (k < dim) {
+            const auto mask = _cvtu32_mask32(~0U >> (32 - (dim - k)));
+            auto a = _mm512_cvtepi8_epi16(
+                _mm256_maskz_loadu_epi8(mask, query + k));
+            auto b =
+                _mm512_cvtepi8_epi16(_mm256_maskz_loadu_epi8(mask, x + k));
+            acc = _mm512_dpwssd_epi32(acc, a, b);
+        }
+        out[i] = static_cast<float>(_mm512_reduce_add_epi32(acc));
+    }
+}
+
+}  // namespace milvus::query::avx512
+
+#endif  // __x86_64__
@@ -0,0 +1,118 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Compiled with: -march=armv8.2-a+dotprod (set by CMakeLists.txt)
+
+#if defined(__aarch64__)
+
+#include <arm_neon.h>
+
+#include "query/VectorKernelsImpl.h"
+
+namespace milvus::query::dotprod {
+
+namespace {
+
+// the bit counts of the 16 bytes summed into the 4 lanes of acc, UDOT by
+// ones adds 4 byte counts per lane without widening steps
+inline uint32x4_t
+AddBitCounts(uint32x4_t acc, uint8x16_t x) {
+    return vdotq_u32(acc, vcntq_u8(x), vdupq_n_u8(1));
+}
+
+inline uint32_t
+TailBitCount(uint8_t x) {
+    return __builtin_popcount(x);
+}
+
+}  // namespace
+
+void
+HammingDistances(const uint8_t* query,
+                 const uint8_t* codes,
+                 int64_t num_rows,
+                 int64_t code_size,
+                 float* out) {
+    for (int64_t i = 0; i < num_rows; ++i) {
+        const auto* code = codes + i * code_size;
+        auto acc = vdupq_n_u32(0);
+        int64_t k = 0;
+        for (; k + 16 <= code_size; k += 16) {
+            acc = AddBitCounts(
+                acc, veorq_u8(vld1q_u8(query + k), vld1q_u8(code + k)));
+        }
+        uint32_t count = vaddvq_u32(acc);
+        for (; k < code_size; ++k) {
+            count += TailBitCount(query[k] ^ code[k]);
+        }
+        out[i] = static_cast<float>(count);
+    }
+}
+
+void
+JaccardDistances(const uint8_t* query,
+                 const uint8_t* codes,
+                 int64_t num_rows,
+                 int64_t code_size,
+                 float* out) {
+    for (int64_t i = 0; i < num_rows; ++i) {
+        const auto* code = codes + i * code_size;
+        auto both = vdupq_n_u32(0);
+        auto any = vdupq_n_u32(0);
+        int64_t k = 0;
+        for (; k + 16 <= code_size; k += 16) {
+            auto a = vld1q_u8(query + k);
+            auto b = vld1q_u8(code + k);
+            both = AddBitCounts(both, vandq_u8(a, b));
+            any = AddBitCounts(any, vorrq_u8(a, b));
+        }
+        uint32_t both_count = vaddvq_u32(both);
+        uint32_t any_count = vaddvq_u32(any);
+        for (; k < code_size; ++k) {
+            both_count += TailBitCount(query[k] & code[k]);
+            any_count += TailBitCount(query[k] | code[k]);
+        }
+        out[i] = any_count == 0 ? 0.0f
+                                : static_cast<float>(any_count - both_count) /
+                                      static_cast<float>(any_count);
+    }
+}
+
+void
+Int8InnerProducts(const int8_t* query,
+                  const int8_t* vectors,
+                  int64_t num_rows,
+                  int64_t dim,
+                  float* out) {
+    for (int64_t i = 0; i < num_rows; ++i) {
+        const auto* x = vectors + i * dim;
+        auto acc = vdupq_n_s32(0);
+        int64_t k = 0;
+        for (; k + 16 <= dim; k += 16) {
+            acc = vdotq_s32(acc, vld1q_s8(query + k), vld1q_s8(x + k));
+        }
+        int32_t sum = vaddvq_s32(acc);
+        for (; k < dim; ++k) {
+            sum += int32_t(query[k]) * int32_t(x[k]);
+        }
+        out[i] = static_cast<float>(sum);
+    }
+}
+
+}  // namespace milvus::query::dotprod
+
+#endif  // __aarch64__
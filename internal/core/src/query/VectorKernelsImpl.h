@@ -0,0 +1,105 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Internal header declaring the per-arch kernels behind VectorKernels.h.
+// Each tier lives in its own file compiled with the flags of its instruction
+// set, see CMakeLists.txt, and VectorKernels.cpp picks one at runtime.
+
+#pragma once
+
+#include <cstdint>
+
+namespace milvus::query {
+
+namespace baseline {
+
+void
+HammingDistances(const uint8_t* query,
+                 const uint8_t* codes,
+                 int64_t num_rows,
+                 int64_t code_size,
+                 float* out);
+
+void
+JaccardDistances(const uint8_t* query,
+                 const uint8_t* codes,
+                 int64_t num_rows,
+                 int64_t code_size,
+                 float* out);
+
+void
+Int8InnerProducts(const int8_t* query,
+                  const int8_t* vectors,
+                  int64_t num_rows,
+                  int64_t dim,
+                  float* out);
+
+}  // namespace baseline
+
+#if defined(__x86_64__)
+namespace avx512 {
+
+void
+HammingDistances(const uint8_t* query,
+                 const uint8_t* codes,
+                 int64_t num_rows,
+                 int64_t code_size,
+                 float* out);
+
+void
+JaccardDistances(const uint8_t* query,
+                 const uint8_t* codes,
+                 int64_t num_rows,
+                 int64_t code_size,
+                 float* out);
+
+void
+Int8InnerProducts(const int8_t* query,
+                  const int8_t* vectors,
+                  int64_t num_rows,
+                  int64_t dim,
+                  float* out);
+
+}  // namespace avx512
+#elif defined(__aarch64__)
+namespace dotprod {
+
+void
+HammingDistances(const uint8_t* query,
+                 const uint8_t* codes,
+                 int64_t num_rows,
+                 int64_t code_size,
+                 float* out);
+
+void
+JaccardDistances(const uint8_t* query,
+                 const uint8_t* codes,
+                 int64_t num_rows,
+                 int64_t code_size,
+                 float* out);
+
+void
+Int8InnerProducts(const int8_t* query,
+                  const int8_t* vectors,
+                  int64_t num_rows,
+                  int64_t dim,
+                  float* out);
+
+}  // namespace dotprod
+#endif
+
+}  // namespace milvus::query
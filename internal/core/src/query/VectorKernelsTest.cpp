@@ -0,0 +1,283 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <bitset>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "common/BitsetView.h"
+#include "common/Types.h"
+#include "query/VectorKernels.h"
+#include "query/helper.h"
+
+using namespace milvus;
+using namespace milvus::query;
+
+namespace {
+
+std::vector<uint8_t>
+RandomBytes(int64_t n, std::mt19937& gen) {
+    std::uniform_int_distribution<int> byte(0, 255);
+    std::vector<uint8_t> bytes(n);
+    for (auto& b : bytes) {
+        b = byte(gen);
+    }
+    return bytes;
+}
+
+std::vector<int8_t>
+RandomInt8(int64_t n, std::mt19937& gen) {
+    std::uniform_int_distribution<int> value(-128, 127);
+    std::vector<int8_t> values(n);
+    for (auto& v : values) {
+        v = value(gen);
+    }
+    return values;
+}
+
+float
+ReferenceHamming(const uint8_t* a, const uint8_t* b, int64_t code_size) {
+    int64_t bits = 0;
+    for (int64_t k = 0; k < code_size; ++k) {
+        bits += std::bitset<8>(a[k] ^ b[k]).count();
+    }
+    return bits;
+}
+
+float
+ReferenceJaccard(const uint8_t* a, const uint8_t* b, int64_t code_size) {
+    int64_t both = 0, any = 0;
+    for (int64_t k = 0; k < code_size; ++k) {
+        both += std::bitset<8>(a[k] & b[k]).count();
+        any += std::bitset<8>(a[k] | b[k]).count();
+    }
+    return any == 0 ? 0 : 1 - static_cast<float>(both) / any;
+}
+
+float
+ReferenceInnerProduct(const int8_t* a, const int8_t* b, int64_t dim) {
+    int64_t dot = 0;
+    for (int64_t k = 0; k < dim; ++k) {
+        dot += a[k] * b[k];
+    }
+    return dot;
+}
+
+// Restores the kernel tier a test changed.
+class VectorKernelLevelGuard {
+ public:
+    VectorKernelLevelGuard() : level_(GetVectorKernelLevel()) {
+    }
+    ~VectorKernelLevelGuard() {
+        SetVectorKernelLevel(level_);
+    }
+
+ private:
+    VectorKernelLevel level_;
+};
+
+}  // namespace
+
+TEST(VectorKernels, LevelsMatchReference) {
+    VectorKernelLevelGuard guard;
+    std::mt19937 gen(42);
+    constexpr int64_t kRows = 37;
+    for (auto level :
+         {VectorKernelLevel::kBaseline, DetectVectorKernelLevel()}) {
+        SetVectorKernelLevel(level);
+        ASSERT_LE(GetVectorKernelLevel(), DetectVectorKernelLevel());
+        // sizes around the 8, 16 and 64 byte steps of the kernels
+        for (int64_t size : {1, 7, 8, 15, 16, 63, 64, 65, 128, 257}) {
+            auto query = RandomBytes(size, gen);
+            auto codes = RandomBytes(kRows * size, gen);
+            std::vector<float> hamming(kRows), jaccard(kRows);
+            HammingDistances(
+                query.data(), codes.data(), kRows, size, hamming.data());
+            JaccardDistances(
+                query.data(), codes.data(), kRows, size, jaccard.data());
+
+            auto int8_query = RandomInt8(size, gen);
+            auto vectors = RandomInt8(kRows * size, gen);
+            std::vector<float> ip(kRows);
+            Int8InnerProducts(
+                int8_query.data(), vectors.data(), kRows, size, ip.data());
+
+            for (int64_t i = 0; i < kRows; ++i) {
+                const auto* code = codes.data() + i * size;
+                EXPECT_EQ(hamming[i],
+                          ReferenceHamming(query.data(), code, size));
+                EXPECT_FLOAT_EQ(jaccard[i],
+                                ReferenceJaccard(query.data(), code, size));
+                EXPECT_EQ(ip[i],
+                          ReferenceInnerProduct(
+                              int8_query.data(), vectors.data() + i * size,
+                              size));
+            }
+        }
+    }
+}
+
+TEST(VectorKernels, JaccardOfEmptyCodesIsZero) {
+    std::vector<uint8_t> zeros(16, 0);
+    float distance = -1;
+    JaccardDistances(zeros.data(), zeros.data(), 1, zeros.size(), &distance);
+    EXPECT_EQ(distance, 0);
+}
+
+TEST(VectorKernels, UseVectorKernel) {
+    std::vector<uint8_t> codes(32);
+    std::vector<size_t> list_offsets{0, 1};
+    dataset::SearchDataset query_ds{
+        knowhere::metric::HAMMING, 1, 1, -1, 128, codes.data()};
+    dataset::RawDataset raw_ds{0, 128, 2, codes.data()};
+    EXPECT_TRUE(UseVectorKernel(query_ds,
+                                raw_ds,
+                                knowhere::metric::HAMMING,
+                                DataType::VECTOR_BINARY));
+    EXPECT_TRUE(UseVectorKernel(query_ds,
+                                raw_ds,
+                                knowhere::metric::JACCARD,
+                                DataType::VECTOR_BINARY));
+    EXPECT_TRUE(UseVectorKernel(
+        query_ds, raw_ds, knowhere::metric::IP, DataType::VECTOR_INT8));
+    EXPECT_FALSE(UseVectorKernel(
+        query_ds, raw_ds, knowhere::metric::L2, DataType::VECTOR_INT8));
+    EXPECT_FALSE(UseVectorKernel(
+        query_ds, raw_ds, knowhere::metric::IP, DataType::VECTOR_FLOAT));
+    EXPECT_FALSE(UseVectorKernel(query_ds,
+                                 raw_ds,
+                                 knowhere::metric::SUBSTRUCTURE,
+                                 DataType::VECTOR_BINARY));
+    raw_ds.raw_data_offsets = list_offsets.data();
+    EXPECT_FALSE(UseVectorKernel(query_ds,
+                                 raw_ds,
+                                 knowhere::metric::HAMMING,
+                                 DataType::VECTOR_BINARY));
+}
+
+TEST(VectorKernels, SearchMatchesPairwiseDistances) {
+    std::mt19937 gen(7);
+    constexpr int64_t kDim = 256;
+    constexpr int64_t kCodeSize = kDim / 8;
+    // more rows than one block of the search
+    constexpr int64_t kRows = 2500;
+    constexpr int64_t kQueries = 3;
+    constexpr int64_t kTopk = 9;
+    constexpr int64_t kBeginId = 100;
+
+    // filter every fifth row
+    TargetBitmap filter(kBeginId + kRows, false);
+    for (int64_t r = 0; r < kRows; r += 5) {
+        filter[kBeginId + r] = true;
+    }
+
+    auto codes = RandomBytes(kRows * kCodeSize, gen);
+    auto code_queries = RandomBytes(kQueries * kCodeSize, gen);
+    auto vectors = RandomInt8(kRows * kDim, gen);
+    auto vector_queries = RandomInt8(kQueries * kDim, gen);
+
+    struct Case {
+        MetricType metric;
+        DataType data_type;
+    };
+    for (const auto& c : {Case{knowhere::metric::HAMMING,
+                               DataType::VECTOR_BINARY},
+                          Case{knowhere::metric::JACCARD,
+                               DataType::VECTOR_BINARY},
+                          Case{knowhere::metric::IP, DataType::VECTOR_INT8}}) {
+        const bool binary = c.data_type == DataType::VECTOR_BINARY;
+        const void* queries =
+            binary ? static_cast<const void*>(code_queries.data())
+                   : vector_queries.data();
+        const void* rows = binary ? static_cast<const void*>(codes.data())
+                                  : vectors.data();
+        auto distance = [&](int64_t q, int64_t r) {
+            if (c.metric == knowhere::metric::HAMMING) {
+                return ReferenceHamming(code_queries.data() + q * kCodeSize,
+                                        codes.data() + r * kCodeSize,
+                                        kCodeSize);
+            }
+            if (c.metric == knowhere::metric::JACCARD) {
+                return ReferenceJaccard(code_queries.data() + q * kCodeSize,
+                                        codes.data() + r * kCodeSize,
+                                        kCodeSize);
+            }
+            return ReferenceInnerProduct(vector_queries.data() + q * kDim,
+                                         vectors.data() + r * kDim,
+                                         kDim);
+        };
+        const bool larger_is_better = c.metric == knowhere::metric::IP;
+
+        dataset::SearchDataset query_ds{
+            c.metric, kQueries, kTopk, -1, kDim, queries};
+        dataset::RawDataset raw_ds{kBeginId, kDim, kRows, rows};
+        ASSERT_TRUE(
+            UseVectorKernel(query_ds, raw_ds, c.metric, c.data_type));
+        std::vector<int64_t> offsets(kQueries * kTopk, -1);
+        std::vector<float> distances(kQueries * kTopk, 0);
+        VectorKernelSearch(query_ds,
+                           raw_ds,
+                           c.metric,
+                           c.data_type,
+                           BitsetView(filter),
+                           offsets.data(),
+                           distances.data());
+
+        for (int64_t q = 0; q < kQueries; ++q) {
+            std::vector<float> expected;
+            for (int64_t r = 0; r < kRows; ++r) {
+                if (r % 5 != 0) {
+                    expected.push_back(distance(q, r));
+                }
+            }
+            std::sort(expected.begin(), expected.end());
+            if (larger_is_better) {
+                std::reverse(expected.begin(), expected.end());
+            }
+            for (int64_t k = 0; k < kTopk; ++k) {
+                auto id = offsets[q * kTopk + k];
+                ASSERT_GE(id, kBeginId);
+                auto row = id - kBeginId;
+                EXPECT_NE(row % 5, 0);
+                EXPECT_FLOAT_EQ(distances[q * kTopk + k], distance(q, row));
+                EXPECT_FLOAT_EQ(distances[q * kTopk + k], expected[k]);
+            }
+        }
+    }
+}
+
+TEST(VectorKernels, SearchLeavesSlotsPastTheRowsFound) {
+    std::vector<int8_t> rows{1, 2, 3, 4};
+    std::vector<int8_t> query{1, 1};
+    dataset::SearchDataset query_ds{
+        knowhere::metric::IP, 1, 4, -1, 2, query.data()};
+    dataset::RawDataset raw_ds{0, 2, 2, rows.data()};
+    std::vector<int64_t> offsets(4, -1);
+    std::vector<float> distances(4, 0);
+    VectorKernelSearch(query_ds,
+                       raw_ds,
+                       knowhere::metric::IP,
+                       DataType::VECTOR_INT8,
+                       BitsetView{},
+                       offsets.data(),
+                       distances.data());
+    EXPECT_EQ(offsets[0], 1);
+    EXPECT_EQ(offsets[1], 0);
+    EXPECT_FLOAT_EQ(distances[0], 7);
+    EXPECT_FLOAT_EQ(distances[1], 3);
+    EXPECT_EQ(offsets[2], -1);
+    EXPECT_EQ(offsets[3], -1);
+}
@@ -18,6 +18,8 @@
 #include "common/Types.h"
 
 namespace milvus::query {
+class SparseChunkPostings;
+
 namespace dataset {
 struct RawDataset {
     int64_t begin_id = 0;
@@ -25,6 +27,8 @@ struct RawDataset {
     int64_t num_raw_data;
     const void* raw_data;
     const size_t* raw_data_offsets = nullptr;
+    // postings of the sparse rows of raw_data, when the owner keeps them
+    const SparseChunkPostings* sparse_postings = nullptr;
 };
 struct SearchDataset {
     knowhere::MetricType metric_type;
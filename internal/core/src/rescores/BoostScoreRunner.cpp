@@ -16,7 +16,10 @@
 
 #include "rescores/BoostScoreRunner.h"
 
+#include <algorithm>
 #include <memory>
+#include <optional>
+#include <vector>
 
 #include "common/EasyAssert.h"
 #include "common/Vector.h"
@@ -29,94 +32,24 @@ namespace milvus::rescores {
 
 namespace {
 
-void
-CopyScoresToBuffers(const std::vector<std::optional<float>>& scores,
-                    float* output_scores,
-                    bool* output_has_score) {
-    for (auto i = 0; i < scores.size(); i++) {
-        output_has_score[i] = scores[i].has_value();
-        output_scores[i] = scores[i].value_or(0.0F);
-    }
+const ColumnVector*
+FilterResult(const std::vector<VectorPtr>& results,
+             size_t index,
+             const expr::TypedExprPtr& filter) {
+    AssertInfo(index < results.size() && results[index] != nullptr,
+               "ComputeFunctionScores: filter expr returned null result, "
+               "filter: {}",
+               filter->ToString());
+    auto col_vec = dynamic_cast<const ColumnVector*>(results[index].get());
+    AssertInfo(col_vec != nullptr,
+               "ComputeFunctionScores: failed to cast result to "
+               "ColumnVector, filter: {}",
+               filter->ToString());
+    return col_vec;
 }
 
 }  // namespace
 
-void
-ComputeScorerScores(exec::ExecContext* exec_context,
-                    OpContext* op_context,
-                    const segcore::SegmentInternalInterface* segment,
-                    const std::shared_ptr<Scorer>& scorer,
-                    FixedVector<int32_t>& offsets,
-                    std::vector<std::optional<float>>& output_scores) {
-    AssertInfo(output_scores.size() == offsets.size(),
-               "scorer score output size {} must match offsets size {}",
-               output_scores.size(),
-               offsets.size());
-
-    auto function_mode = proto::plan::FunctionModeSum;
-    auto filter = scorer->filter();
-    if (!filter) {
-        scorer->batch_score(
-            op_context, segment, function_mode, offsets, output_scores);
-        return;
-    }
-
-    std::vector<expr::TypedExprPtr> filters;
-    filters.emplace_back(filter);
-    auto expr_set = std::make_unique<exec::ExprSet>(filters, exec_context);
-    std::vector<VectorPtr> results;
-    exec::EvalCtx eval_ctx(exec_context);
-
-    const auto& exprs = expr_set->exprs();
-    bool is_native_supported = true;
-    for (const auto& expr : exprs) {
-        is_native_supported =
-            (is_native_supported && (expr->SupportOffsetInput()));
-    }
-
-    if (is_native_supported) {
-        eval_ctx.set_offset_input(&offsets);
-        expr_set->Eval(0, 1, true, eval_ctx, results);
-
-        AssertInfo(!results.empty() && results[0] != nullptr,
-                   "ComputeScorerScores: filter expr returned null result, "
-                   "offsets size: {}, filter: {}",
-                   offsets.size(),
-                   filter->ToString());
-        auto col_vec = std::dynamic_pointer_cast<ColumnVector>(results[0]);
-        AssertInfo(col_vec != nullptr,
-                   "ComputeScorerScores: failed to cast result to "
-                   "ColumnVector, filter: {}",
-                   filter->ToString());
-        auto col_vec_size = col_vec->size();
-        TargetBitmapView bitsetview(col_vec->GetRawData(), col_vec_size);
-        scorer->batch_score(op_context,
-                            segment,
-                            function_mode,
-                            offsets,
-                            bitsetview,
-                            output_scores);
-    } else {
-        expr_set->Eval(0, 1, true, eval_ctx, results);
-
-        AssertInfo(!results.empty() && results[0] != nullptr,
-                   "ComputeScorerScores: filter expr returned null result, "
-                   "filter: {}",
-                   filter->ToString());
-        auto col_vec = std::dynamic_pointer_cast<ColumnVector>(results[0]);
-        AssertInfo(col_vec != nullptr,
-                   "ComputeScorerScores: failed to cast result to "
-                   "ColumnVector, filter: {}",
-                   filter->ToString());
-        TargetBitmap bitset;
-        auto col_vec_size = col_vec->size();
-        TargetBitmapView view(col_vec->GetRawData(), col_vec_size);
-        bitset.append(view);
-        scorer->batch_score(
-            op_context, segment, function_mode, offsets, bitset, output_scores);
-    }
-}
-
 void
 ComputeScorerScores(exec::ExecContext* exec_context,
                     OpContext* op_context,
@@ -125,10 +58,14 @@ ComputeScorerScores(exec::ExecContext* exec_context,
                     FixedVector<int32_t>& offsets,
                     float* output_scores,
                     bool* output_has_score) {
-    std::vector<std::optional<float>> scores(offsets.size());
-    ComputeScorerScores(
-        exec_context, op_context, segment, scorer, offsets, scores);
-    CopyScoresToBuffers(scores, output_scores, output_has_score);
+    ComputeFunctionScores(exec_context,
+                          op_context,
+                          segment,
+                          {scorer},
+                          proto::plan::FunctionModeSum,
+                          offsets,
+                          output_scores,
+                          output_has_score);
 }
 
 void
@@ -138,28 +75,59 @@ ComputeFunctionScores(exec::ExecContext* exec_context,
                       const std::vector<std::shared_ptr<Scorer>>& scorers,
                       proto::plan::FunctionMode function_mode,
                       FixedVector<int32_t>& offsets,
-                      std::vector<std::optional<float>>& output_scores) {
-    AssertInfo(output_scores.size() == offsets.size(),
+                      BoostScores& scores) {
+    AssertInfo(scores.size == offsets.size(),
                "function score output size {} must match offsets size {}",
-               output_scores.size(),
+               scores.size,
                offsets.size());
 
-    for (const auto& scorer : scorers) {
-        std::vector<std::optional<float>> scorer_scores(offsets.size());
-        ComputeScorerScores(
-            exec_context, op_context, segment, scorer, offsets, scorer_scores);
-        for (auto i = 0; i < offsets.size(); i++) {
-            if (!scorer_scores[i].has_value()) {
-                continue;
-            }
-            if (!output_scores[i].has_value()) {
-                output_scores[i] = scorer_scores[i].value();
-            } else {
-                output_scores[i] =
-                    function_score_merge(output_scores[i].value(),
-                                         scorer_scores[i].value(),
-                                         function_mode);
-            }
+    std::vector<expr::TypedExprPtr> filters;
+    std::vector<std::optional<size_t>> filter_index(scorers.size());
+    for (size_t i = 0; i < scorers.size(); i++) {
+        if (auto filter = scorers[i]->filter()) {
+            filter_index[i] = filters.size();
+            filters.emplace_back(std::move(filter));
+        }
+    }
+
+    // the filters that read the candidates alone are evaluated on them,
+    // the others over the whole segment
+    std::vector<VectorPtr> results;
+    std::vector<bool> on_offsets(filters.size());
+    if (!filters.empty()) {
+        exec::ExprSet expr_set(filters, exec_context);
+        exec::EvalCtx offset_ctx(exec_context);
+        offset_ctx.set_offset_input(&offsets);
+        exec::EvalCtx segment_ctx(exec_context);
+        for (size_t i = 0; i < expr_set.size(); i++) {
+            on_offsets[i] = expr_set.expr(i)->SupportOffsetInput();
+            auto& eval_ctx = on_offsets[i] ? offset_ctx : segment_ctx;
+            expr_set.Eval(i, i + 1, true, eval_ctx, results);
+        }
+    }
+
+    for (size_t i = 0; i < scorers.size(); i++) {
+        const auto& scorer = scorers[i];
+        if (!filter_index[i].has_value()) {
+            scorer->batch_score(
+                op_context, segment, function_mode, offsets, nullptr, scores);
+            continue;
+        }
+        auto index = filter_index[i].value();
+        auto col_vec = FilterResult(results, index, filters[index]);
+        TargetBitmapView bitmap(col_vec->GetRawData(), col_vec->size());
+        if (on_offsets[index]) {
+            scorer->batch_score(
+                op_context, segment, function_mode, offsets, &bitmap, scores);
+        } else {
+            auto matches = GatherMatches(bitmap, offsets);
+            auto matches_view = matches.view();
+            scorer->batch_score(op_context,
+                                segment,
+                                function_mode,
+                                offsets,
+                                &matches_view,
+                                scores);
         }
     }
 }
@@ -173,7 +141,9 @@ ComputeFunctionScores(exec::ExecContext* exec_context,
                       FixedVector<int32_t>& offsets,
                       float* output_scores,
                       bool* output_has_score) {
-    std::vector<std::optional<float>> scores(offsets.size());
+    std::fill(output_scores, output_scores + offsets.size(), 0.0F);
+    std::fill(output_has_score, output_has_score + offsets.size(), false);
+    BoostScores scores{output_scores, output_has_score, offsets.size()};
     ComputeFunctionScores(exec_context,
                           op_context,
                           segment,
@@ -181,7 +151,6 @@ ComputeFunctionScores(exec::ExecContext* exec_context,
                           function_mode,
                           offsets,
                           scores);
-    CopyScoresToBuffers(scores, output_scores, output_has_score);
 }
 
 }  // namespace milvus::rescores
@@ -17,7 +17,6 @@
 #pragma once
 
 #include <memory>
-#include <optional>
 #include <vector>
 
 #include "common/OpContext.h"
@@ -32,14 +31,8 @@ class ExecContext;
 
 namespace milvus::rescores {
 
-void
-ComputeScorerScores(exec::ExecContext* exec_context,
-                    OpContext* op_context,
-                    const segcore::SegmentInternalInterface* segment,
-                    const std::shared_ptr<Scorer>& scorer,
-                    FixedVector<int32_t>& offsets,
-                    std::vector<std::optional<float>>& output_scores);
-
+// Scores every candidate offsets[i] by `scorer` alone into the output
+// buffers, output_has_score[i] false for the candidates it doesn't boost.
 void
 ComputeScorerScores(exec::ExecContext* exec_context,
                     OpContext* op_context,
@@ -49,6 +42,9 @@ ComputeScorerScores(exec::ExecContext* exec_context,
                     float* output_scores,
                     bool* output_has_score);
 
+// Merges the boosts of all `scorers` into `scores` under `function_mode`.
+// The filters of the scorers are compiled together and evaluated in a
+// single pass over the candidates before any boost is applied.
 void
 ComputeFunctionScores(exec::ExecContext* exec_context,
                       OpContext* op_context,
@@ -56,7 +52,7 @@ ComputeFunctionScores(exec::ExecContext* exec_context,
                       const std::vector<std::shared_ptr<Scorer>>& scorers,
                       proto::plan::FunctionMode function_mode,
                       FixedVector<int32_t>& offsets,
-                      std::vector<std::optional<float>>& output_scores);
+                      BoostScores& scores);
 
 void
 ComputeFunctionScores(exec::ExecContext* exec_context,
@@ -17,7 +17,6 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
-#include <optional>
 
 #include "Scorer.h"
 #include "Utils.h"
@@ -29,62 +28,99 @@
 
 namespace milvus::rescores {
 
+namespace {
+
+template <proto::plan::FunctionMode Mode>
+inline float
+Merge(float a, float b) {
+    if constexpr (Mode == proto::plan::FunctionModeMultiply) {
+        return a * b;
+    } else {
+        return a + b;
+    }
+}
+
+// branch free, so the loops vectorize across the score buffer
+template <proto::plan::FunctionMode Mode>
 void
-WeightScorer::batch_score(milvus::OpContext* op_ctx,
-                          const segcore::SegmentInternalInterface* segment,
-                          const proto::plan::FunctionMode& mode,
-                          const FixedVector<int32_t>& offsets,
-                          const TargetBitmapView& bitmap,
-                          std::vector<std::optional<float>>& boost_scores) {
-    Assert(bitmap.size() == offsets.size());
-    for (auto i = 0; i < offsets.size(); i++) {
-        if (bitmap[i] > 0) {
-            set_score(boost_scores[i], mode);
+MergeConstantBoost(float boost,
+                   const TargetBitmapView* matches,
+                   BoostScores& scores) {
+    auto* values = scores.scores;
+    auto* has_score = scores.has_score;
+    if (matches == nullptr) {
+        for (size_t i = 0; i < scores.size; i++) {
+            values[i] = has_score[i] ? Merge<Mode>(values[i], boost) : boost;
+            has_score[i] = true;
         }
+        return;
+    }
+    for (size_t i = 0; i < scores.size; i++) {
+        bool match = (*matches)[i];
+        auto merged = has_score[i] ? Merge<Mode>(values[i], boost) : boost;
+        values[i] = match ? merged : values[i];
+        has_score[i] = has_score[i] || match;
     }
 }
 
-void
-WeightScorer::batch_score(milvus::OpContext* op_ctx,
-                          const segcore::SegmentInternalInterface* segment,
-                          const proto::plan::FunctionMode& mode,
-                          const FixedVector<int32_t>& offsets,
-                          const TargetBitmap& bitmap,
-                          std::vector<std::optional<float>>& boost_scores) {
+inline void
+MergeBoost(float boost,
+           size_t i,
+           const proto::plan::FunctionMode& mode,
+           BoostScores& scores) {
+    scores.scores[i] =
+        scores.has_score[i]
+            ? function_score_merge(scores.scores[i], boost, mode)
+            : boost;
+    scores.has_score[i] = true;
+}
+
+}  // namespace
+
+TargetBitmap
+GatherMatches(const TargetBitmapView& bitmap,
+              const FixedVector<int32_t>& offsets) {
+    TargetBitmap matches(offsets.size());
     auto bitmap_size = bitmap.size();
-    for (auto i = 0; i < offsets.size(); i++) {
+    for (size_t i = 0; i < offsets.size(); i++) {
         auto offset = offsets[i];
-        // Bounds check: offset must be within bitmap size.
-        // Race condition: text index may lag behind vector index,
-        // causing offsets to reference rows not yet in text index.
-        if (offset >= 0 && static_cast<size_t>(offset) < bitmap_size) {
-            if (bitmap[offset] > 0) {
-                set_score(boost_scores[i], mode);
-            }
+        if (offset >= 0 && static_cast<size_t>(offset) < bitmap_size &&
+            bitmap[offset]) {
+            matches.set(i);
         }
-        // If offset is out of bounds, treat as "no match" (don't apply boost)
     }
-};
+    return matches;
+}
 
 void
 WeightScorer::batch_score(milvus::OpContext* op_ctx,
                           const segcore::SegmentInternalInterface* segment,
                           const proto::plan::FunctionMode& mode,
                           const FixedVector<int32_t>& offsets,
-                          std::vector<std::optional<float>>& boost_scores) {
-    for (auto i = 0; i < offsets.size(); i++) {
-        set_score(boost_scores[i], mode);
-    }
-};
-
-void
-WeightScorer::set_score(std::optional<float>& score,
-                        const proto::plan::FunctionMode& mode) {
-    if (!score.has_value()) {
-        score = std::make_optional(weight_);
-    } else {
-        score = std::make_optional(
-            function_score_merge(score.value(), weight_, mode));
+                          const TargetBitmapView* matches,
+                          BoostScores& scores) {
+    AssertInfo(scores.size == offsets.size(),
+               "boost score size {} must match offsets size {}",
+               scores.size,
+               offsets.size());
+    AssertInfo(matches == nullptr || matches->size() == offsets.size(),
+               "filter result size {} must match offsets size {}",
+               matches == nullptr ? 0 : matches->size(),
+               offsets.size());
+    switch (mode) {
+        case proto::plan::FunctionModeMultiply:
+            MergeConstantBoost<proto::plan::FunctionModeMultiply>(
+                weight_, matches, scores);
+            break;
+        case proto::plan::FunctionModeSum:
+            MergeConstantBoost<proto::plan::FunctionModeSum>(
+                weight_, matches, scores);
+            break;
+        default:
+            ThrowInfo(ErrorCode::UnexpectedError,
+                      fmt::format("unknown boost function mode: {}:{}",
+                                  proto::plan::FunctionMode_Name(mode),
+                                  static_cast<int>(mode)));
     }
 }
 
@@ -93,46 +129,31 @@ RandomScorer::batch_score(milvus::OpContext* op_ctx,
                           const segcore::SegmentInternalInterface* segment,
                           const proto::plan::FunctionMode& mode,
                           const FixedVector<int32_t>& offsets,
-                          const TargetBitmapView& bitmap,
-                          std::vector<std::optional<float>>& boost_scores) {
-    Assert(bitmap.size() == offsets.size());
+                          const TargetBitmapView* matches,
+                          BoostScores& scores) {
+    AssertInfo(scores.size == offsets.size(),
+               "boost score size {} must match offsets size {}",
+               scores.size,
+               offsets.size());
     FixedVector<int64_t> target_offsets;
-    FixedVector<int> idx;
-    target_offsets.reserve(offsets.size());
-    idx.reserve(offsets.size());
-
-    for (auto i = 0; i < offsets.size(); i++) {
-        if (bitmap[i] > 0) {
-            target_offsets.push_back(static_cast<int64_t>(offsets[i]));
-            idx.push_back(i);
+    if (matches == nullptr) {
+        target_offsets.reserve(offsets.size());
+        for (int offset : offsets) {
+            target_offsets.push_back(static_cast<int64_t>(offset));
         }
-    }
-
-    // skip if empty
-    if (target_offsets.empty()) {
+        random_score(op_ctx, segment, mode, target_offsets, nullptr, scores);
         return;
     }
 
-    random_score(op_ctx, segment, mode, target_offsets, &idx, boost_scores);
-}
-
-void
-RandomScorer::batch_score(milvus::OpContext* op_ctx,
-                          const segcore::SegmentInternalInterface* segment,
-                          const proto::plan::FunctionMode& mode,
-                          const FixedVector<int32_t>& offsets,
-                          const TargetBitmap& bitmap,
-                          std::vector<std::optional<float>>& boost_scores) {
-    FixedVector<int64_t> target_offsets;
+    AssertInfo(matches->size() == offsets.size(),
+               "filter result size {} must match offsets size {}",
+               matches->size(),
+               offsets.size());
     FixedVector<int> idx;
-    target_offsets.reserve(offsets.size());
-    idx.reserve(offsets.size());
-
-    for (auto i = 0; i < offsets.size(); i++) {
-        if (bitmap[offsets[i]] > 0) {
-            target_offsets.push_back(static_cast<int64_t>(offsets[i]));
-            idx.push_back(i);
-        }
+    for (auto i = matches->find_first(); i.has_value();
+         i = matches->find_next(i.value())) {
+        target_offsets.push_back(static_cast<int64_t>(offsets[i.value()]));
+        idx.push_back(static_cast<int>(i.value()));
     }
 
     // skip if empty
@@ -140,23 +161,7 @@ RandomScorer::batch_score(milvus::OpContext* op_ctx,
         return;
     }
 
-    random_score(op_ctx, segment, mode, target_offsets, &idx, boost_scores);
-}
-
-void
-RandomScorer::batch_score(milvus::OpContext* op_ctx,
-                          const segcore::SegmentInternalInterface* segment,
-                          const proto::plan::FunctionMode& mode,
-                          const FixedVector<int32_t>& offsets,
-                          std::vector<std::optional<float>>& boost_scores) {
-    FixedVector<int64_t> target_offsets;
-    target_offsets.reserve(offsets.size());
-
-    for (int offset : offsets) {
-        target_offsets.push_back(static_cast<int64_t>(offset));
-    }
-
-    random_score(op_ctx, segment, mode, target_offsets, nullptr, boost_scores);
+    random_score(op_ctx, segment, mode, target_offsets, &idx, scores);
 }
 
 void
@@ -165,7 +170,7 @@ RandomScorer::random_score(milvus::OpContext* op_ctx,
                            const proto::plan::FunctionMode& mode,
                            const FixedVector<int64_t>& target_offsets,
                            const FixedVector<int>* idx,
-                           std::vector<std::optional<float>>& boost_scores) {
+                           BoostScores& scores) {
     if (field_.get() != -1) {
         auto array = segment->bulk_subscript(
             op_ctx, field_, target_offsets.data(), target_offsets.size());
@@ -179,11 +184,10 @@ RandomScorer::random_score(milvus::OpContext* op_ctx,
             auto a = data.data()[i];
             auto random_score =
                 hash_to_double(MurmurHash3_x64_64_Special(a, seed_));
-            if (idx == nullptr) {
-                set_score(random_score, boost_scores[i], mode);
-            } else {
-                set_score(random_score, boost_scores[idx->at(i)], mode);
-            }
+            MergeBoost(static_cast<float>(random_score) * weight_,
+                       idx == nullptr ? i : (*idx)[i],
+                       mode,
+                       scores);
         }
     } else {
         // if not set field, use offset and seed to hash.
@@ -191,24 +195,12 @@ RandomScorer::random_score(milvus::OpContext* op_ctx,
         for (int i = 0; i < target_offsets.size(); i++) {
             double random_score = hash_to_double(MurmurHash3_x64_64_Special(
                 target_offsets[i] + segment_id, seed_));
-            if (idx == nullptr) {
-                set_score(random_score, boost_scores[i], mode);
-            } else {
-                set_score(random_score, boost_scores[idx->at(i)], mode);
-            }
+            MergeBoost(static_cast<float>(random_score) * weight_,
+                       idx == nullptr ? i : (*idx)[i],
+                       mode,
+                       scores);
         }
     }
 }
 
-void
-RandomScorer::set_score(float random_value,
-                        std::optional<float>& score,
-                        const proto::plan::FunctionMode& mode) {
-    if (!score.has_value()) {
-        score = std::make_optional(random_value * weight_);
-    } else {
-        score = std::make_optional(function_score_merge(
-            score.value(), (random_value * weight_), mode));
-    }
-}
 }  // namespace milvus::rescores
\ No newline at end of file
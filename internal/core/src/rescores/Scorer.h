@@ -16,10 +16,10 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <exception>
 #include <map>
-#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -34,6 +34,22 @@
 #include "segcore/SegmentInterface.h"
 
 namespace milvus::rescores {
+// The boost scores of a batch of candidates, held by the caller as two flat
+// arrays: scores[i] is only meaningful once has_score[i] is set. Scorers
+// merge into them in place.
+struct BoostScores {
+    float* scores;
+    bool* has_score;
+    size_t size;
+};
+
+// matches[i] = bitmap[offsets[i]], for a filter evaluated over the whole
+// segment. An offset past the bitmap doesn't match: the text index may lag
+// behind the vector index, leaving the latest rows out of the bitmap.
+TargetBitmap
+GatherMatches(const TargetBitmapView& bitmap,
+              const FixedVector<int32_t>& offsets);
+
 class Scorer {
  public:
     virtual ~Scorer() = default;
@@ -41,35 +57,15 @@ class Scorer {
     virtual expr::TypedExprPtr
     filter() = 0;
 
-    // filter result of offset[i] was bitmapview[i]
-    // add boost score for idx[i] if bitmap[i] was true
-    virtual void
-    batch_score(milvus::OpContext* op_ctx,
-                const segcore::SegmentInternalInterface* segment,
-                const proto::plan::FunctionMode& mode,
-                const FixedVector<int32_t>& offsets,
-                const TargetBitmapView& bitmap,
-                std::vector<std::optional<float>>& boost_scores) = 0;
-
-    // score by bitmap
-    // filter result of offset[i] was bitmap[offset[i]]
-    // add boost score for idx[i] if bitmap[i] was true
-    virtual void
-    batch_score(milvus::OpContext* op_ctx,
-                const segcore::SegmentInternalInterface* segment,
-                const proto::plan::FunctionMode& mode,
-                const FixedVector<int32_t>& offsets,
-                const TargetBitmap& bitmap,
-                std::vector<std::optional<float>>& boost_scores) = 0;
-
-    // score for all offset
-    // used when no filter
+    // merge the boost of offsets[i] into scores under `mode` for every i
+    // with matches[i] set, for every i when matches is nullptr
     virtual void
     batch_score(milvus::OpContext* op_ctx,
                 const segcore::SegmentInternalInterface* segment,
                 const proto::plan::FunctionMode& mode,
                 const FixedVector<int32_t>& offsets,
-                std::vector<std::optional<float>>& boost_scores) = 0;
+                const TargetBitmapView* matches,
+                BoostScores& scores) = 0;
 
     virtual float
     weight() = 0;
@@ -90,23 +86,8 @@ class WeightScorer : public Scorer {
                 const segcore::SegmentInternalInterface* segment,
                 const proto::plan::FunctionMode& mode,
                 const FixedVector<int32_t>& offsets,
-                const TargetBitmapView& bitmap,
-                std::vector<std::optional<float>>& boost_scores) override;
-
-    void
-    batch_score(milvus::OpContext* op_ctx,
-                const segcore::SegmentInternalInterface* segment,
-                const proto::plan::FunctionMode& mode,
-                const FixedVector<int32_t>& offsets,
-                const TargetBitmap& bitmap,
-                std::vector<std::optional<float>>& boost_scores) override;
-
-    void
-    batch_score(milvus::OpContext* op_ctx,
-                const segcore::SegmentInternalInterface* segment,
-                const proto::plan::FunctionMode& mode,
-                const FixedVector<int32_t>& offsets,
-                std::vector<std::optional<float>>& boost_scores) override;
+                const TargetBitmapView* matches,
+                BoostScores& scores) override;
 
     float
     weight() override {
@@ -114,10 +95,6 @@ class WeightScorer : public Scorer {
     }
 
  private:
-    void
-    set_score(std::optional<float>& old_score,
-              const proto::plan::FunctionMode& mode);
-
     expr::TypedExprPtr filter_;
     float weight_;
 };
@@ -164,23 +141,8 @@ class RandomScorer : public Scorer {
                 const segcore::SegmentInternalInterface* segment,
                 const proto::plan::FunctionMode& mode,
                 const FixedVector<int32_t>& offsets,
-                const TargetBitmapView& bitmap,
-                std::vector<std::optional<float>>& boost_scores) override;
-
-    void
-    batch_score(milvus::OpContext* op_ctx,
-                const segcore::SegmentInternalInterface* segment,
-                const proto::plan::FunctionMode& mode,
-                const FixedVector<int32_t>& offsets,
-                const TargetBitmap& bitmap,
-                std::vector<std::optional<float>>& boost_scores) override;
-
-    void
-    batch_score(milvus::OpContext* op_ctx,
-                const segcore::SegmentInternalInterface* segment,
-                const proto::plan::FunctionMode& mode,
-                const FixedVector<int32_t>& offsets,
-                std::vector<std::optional<float>>& boost_scores) override;
+                const TargetBitmapView* matches,
+                BoostScores& scores) override;
 
     float
     weight() override {
@@ -188,18 +150,15 @@ class RandomScorer : public Scorer {
     }
 
  private:
-    void
-    set_score(float random_value,
-              std::optional<float>& old_score,
-              const proto::plan::FunctionMode& mode);
-
+    // idx[j] is the candidate of target_offsets[j], j itself when idx is
+    // nullptr
     void
     random_score(milvus::OpContext* op_ctx,
                  const segcore::SegmentInternalInterface* segment,
                  const proto::plan::FunctionMode& mode,
                  const FixedVector<int64_t>& target_offsets,
                  const FixedVector<int>* idx,
-                 std::vector<std::optional<float>>& boost_scores);
+                 BoostScores& scores);
 
     expr::TypedExprPtr filter_;
     float weight_;
@@ -0,0 +1,69 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace milvus::segcore {
+
+// Lets the readers of the raw vector chunks of a growing segment go on
+// without a lock, while a writer drops the chunks once an interim index
+// serves the rows.
+//
+// A reader enters, then checks whether the index serves the field, and reads
+// the chunks while inside if it does not. The writer has published that the
+// index serves the field before it asks whether the gate is idle, and drops
+// the chunks only then. Both sides are sequentially consistent, so either
+// the writer sees the reader inside or the reader sees the index.
+class ChunkReadGate {
+ public:
+    class Reader {
+     public:
+        explicit Reader(const ChunkReadGate& gate) : gate_(gate) {
+            gate_.readers_.fetch_add(1);
+        }
+
+        ~Reader() {
+            gate_.readers_.fetch_sub(1);
+        }
+
+        Reader(const Reader&) = delete;
+        Reader&
+        operator=(const Reader&) = delete;
+
+     private:
+        const ChunkReadGate& gate_;
+    };
+
+    [[nodiscard]] Reader
+    Enter() const {
+        return Reader(*this);
+    }
+
+    // no reader is inside, one entering from now on sees what the writer
+    // published before
+    bool
+    Idle() const {
+        return readers_.load() == 0;
+    }
+
+ private:
+    mutable std::atomic<int64_t> readers_{0};
+};
+
+}  // namespace milvus::segcore
@@ -0,0 +1,83 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "segcore/ChunkReadGate.h"
+
+using milvus::segcore::ChunkReadGate;
+
+TEST(ChunkReadGate, IdleOnlyWithoutReaders) {
+    ChunkReadGate gate;
+    EXPECT_TRUE(gate.Idle());
+    {
+        auto reader = gate.Enter();
+        auto other = gate.Enter();
+        EXPECT_FALSE(gate.Idle());
+    }
+    EXPECT_TRUE(gate.Idle());
+}
+
+TEST(ChunkReadGate, ReadersNeverSeeDroppedChunks) {
+    // chunks are dropped once the index serves the rows, a reader that does
+    // not see the index must find them until it leaves
+    for (int round = 0; round < 10; ++round) {
+        ChunkReadGate gate;
+        std::atomic<int> started{0};
+        std::atomic<bool> index_serves{false};
+        std::atomic<bool> chunks_dropped{false};
+        std::atomic<bool> stop{false};
+        std::atomic<bool> violated{false};
+
+        std::vector<std::thread> readers;
+        for (int t = 0; t < 4; ++t) {
+            readers.emplace_back([&]() {
+                started.fetch_add(1);
+                while (!stop.load()) {
+                    auto reader = gate.Enter();
+                    if (index_serves.load()) {
+                        continue;
+                    }
+                    // reading the chunks, they have to stay until it leaves
+                    for (int spin = 0; spin < 100; ++spin) {
+                        if (chunks_dropped.load()) {
+                            violated = true;
+                        }
+                    }
+                }
+            });
+        }
+        while (started.load() < 4) {
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+        index_serves.store(true);
+        while (!chunks_dropped.load()) {
+            if (gate.Idle()) {
+                chunks_dropped.store(true);
+            }
+        }
+        stop.store(true);
+        for (auto& reader : readers) {
+            reader.join();
+        }
+        ASSERT_FALSE(violated.load()) << "round: " << round;
+    }
+}
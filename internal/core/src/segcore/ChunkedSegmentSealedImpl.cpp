@@ -19,6 +19,7 @@
 #include <simdjson.h>
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <cstdint>
 #include <ctime>
 #include <exception>
@@ -29,6 +30,7 @@
 #include <filesystem>
 #include <memory>
 #include <mutex>
+#include <numeric>
 #include <optional>
 #include <ratio>
 #include <set>
@@ -81,7 +83,9 @@
 #include "common/VectorArray.h"
 #include "common/resource_c.h"
 #include "common/type_c.h"
+#include "exec/MorselDispatcher.h"
 #include "folly/Synchronized.h"
+#include "futures/Executor.h"
 #include "geos_c.h"
 #include "glog/logging.h"
 #include "index/Index.h"
@@ -133,7 +137,10 @@
 #include "segcore/storagev1translator/TextMatchIndexTranslator.h"
 #include "segcore/storagev2translator/GroupChunkTranslator.h"
 #include "segcore/storagev2translator/ManifestGroupTranslator.h"
+#include "segcore/SearchIteratorRegistry.h"
+#include "segcore/SearchResultCache.h"
 #include "segcore/TextColumnCache.h"
+#include "storage/EntryStreamUtils.h"
 #include "storage/FileManager.h"
 #include "storage/KeyRetriever.h"
 #include "storage/LocalChunkManager.h"
@@ -310,6 +317,11 @@ ChunkedSegmentSealedImpl::Contain(const PkType& pk) const {
         return insert_record_.contain(pk);
     }
     auto pk_index = PinPkIndex(nullptr);
+    if (auto* pk_filter = get_pk_filter(pk_index.get());
+        pk_filter != nullptr &&
+        !pk_filter->TestHash(pk_filter_hash(pk))) {
+        return false;
+    }
     if (pk_index.get() != nullptr && pk_index.get()->has_pk2offset()) {
         return pk_index.get()->contain(pk);
     }
@@ -416,6 +428,7 @@ ChunkedSegmentSealedImpl::init_storage_v1_pk_index(
     }
     // Build compressed offset->pk for FillPrimaryKeys fast path
     insert_record_.build_offset2pk(data_type, column.get());
+    insert_record_.build_pk_filter(data_type, column.get());
 
     if (!is_sorted_by_pk_) {
         AssertInfo(field_id.get() != -1, "Primary key is -1");
@@ -703,6 +716,7 @@ ChunkedSegmentSealedImpl::LoadColumnGroups(const std::string& manifest_path,
                                                       /*arrow_schema=*/nullptr,
                                                       needed_columns,
                                                       *properties);
+        take_planner_.Reset();
     }
 
     auto reader_create_ms =
@@ -1073,27 +1087,58 @@ ChunkedSegmentSealedImpl::load_column_group_data_internal(
         auto parquet_stats_by_field =
             std::move(metadata.parquet_stats_by_field);
 
-        auto translator =
-            std::make_unique<storagev2translator::GroupChunkTranslator>(
-                get_segment_id(),
-                GroupChunkType::DEFAULT,
-                field_metas,
-                column_group_info,
-                std::move(insert_files),
-                std::move(metadata.row_group_meta_list),
-                info.enable_mmap,
-                mmap_config.GetMmapPopulate(),
+        // Projected loading gives every field of the group its own
+        // translator, so a cell reads and caches only that field's column.
+        // column_groups[i] serves milvus_field_ids[i].
+        bool projected =
+            ENABLE_PROJECTED_GROUP_LOAD.load() && milvus_field_ids.size() > 1;
+        std::vector<std::shared_ptr<ChunkedColumnGroup>> column_groups;
+        column_groups.reserve(milvus_field_ids.size());
+        if (projected) {
+            for (const auto& field_id : milvus_field_ids) {
+                auto translator = std::make_unique<
+                    storagev2translator::GroupChunkTranslator>(
+                    get_segment_id(),
+                    GroupChunkType::DEFAULT,
+                    field_metas,
+                    column_group_info,
+                    insert_files,
+                    std::vector<milvus_storage::RowGroupMetadataVector>(
+                        metadata.row_group_meta_list),
+                    info.enable_mmap,
+                    mmap_config.GetMmapPopulate(),
+                    /* num_fields */ 1,
+                    load_info.load_priority,
+                    info.warmup_policy,
+                    field_id);
+                column_groups.push_back(std::make_shared<ChunkedColumnGroup>(
+                    std::move(translator)));
+            }
+        } else {
+            auto translator =
+                std::make_unique<storagev2translator::GroupChunkTranslator>(
+                    get_segment_id(),
+                    GroupChunkType::DEFAULT,
+                    field_metas,
+                    column_group_info,
+                    std::move(insert_files),
+                    std::move(metadata.row_group_meta_list),
+                    info.enable_mmap,
+                    mmap_config.GetMmapPopulate(),
+                    milvus_field_ids.size(),
+                    load_info.load_priority,
+                    info.warmup_policy);
+            column_groups.assign(
                 milvus_field_ids.size(),
-                load_info.load_priority,
-                info.warmup_policy);
-        auto chunked_column_group =
-            std::make_shared<ChunkedColumnGroup>(std::move(translator));
+                std::make_shared<ChunkedColumnGroup>(std::move(translator)));
+        }
 
         // Create ProxyChunkColumn for each field in this column group
-        for (const auto& field_id : milvus_field_ids) {
+        for (size_t i = 0; i < milvus_field_ids.size(); ++i) {
+            const auto& field_id = milvus_field_ids[i];
             const auto& field_meta = field_metas.at(field_id);
             auto column = std::make_shared<ProxyChunkColumn>(
-                chunked_column_group, field_id, field_meta);
+                column_groups[i], field_id, field_meta);
             auto data_type = field_meta.get_data_type();
             std::optional<ParquetStatistics> statistics_opt;
             auto it = parquet_stats_by_field.find(field_id.get());
@@ -1122,7 +1167,13 @@ ChunkedSegmentSealedImpl::load_column_group_data_internal(
         }
 
         if (column_group_id.get() == DEFAULT_SHORT_COLUMN_GROUP_ID) {
-            stats_.mem_size += chunked_column_group->memory_size();
+            if (projected) {
+                for (const auto& column_group : column_groups) {
+                    stats_.mem_size += column_group->memory_size();
+                }
+            } else {
+                stats_.mem_size += column_groups[0]->memory_size();
+            }
         }
     }
 }
@@ -1203,7 +1254,10 @@ ChunkedSegmentSealedImpl::load_field_data_internal(
                     info.enable_mmap,
                     mmap_config.GetMmapPopulate(),
                     load_info.load_priority,
-                    info.warmup_policy);
+                    info.warmup_policy,
+                    // pk lookups read the raw values
+                    ENABLE_PACKED_INT_CHUNK.load() &&
+                        field_id != schema_->get_primary_field_id());
 
             auto data_type = field_meta.get_data_type();
             auto slot = cachinglayer::Manager::GetInstance().CreateCacheSlot(
@@ -1243,8 +1297,7 @@ ChunkedSegmentSealedImpl::load_system_field_internal(
             FieldName(""), FieldId(0), DataType::INT64, false, std::nullopt);
         std::shared_ptr<milvus::ArrowDataWrapper> r;
         while (data.arrow_reader_channel->pop(r)) {
-            auto array_vec = read_single_column_batches(r->reader);
-            auto chunk = create_chunk(field_meta, array_vec);
+            auto chunk = create_chunk(field_meta, *r);
             auto chunk_ptr = static_cast<FixedWidthChunk*>(chunk.get());
             milvus::fastmem::FastMemcpy(
                 timestamps.data() + offset,
@@ -1290,6 +1343,9 @@ ChunkedSegmentSealedImpl::LoadDeletedRecord(const LoadDeletedRecordInfo& info) {
 
     // step 2: push delete info to delete_record
     deleted_record_.LoadPush(pks, timestamps);
+
+    // step 3: persist delete snapshot for the loaded records
+    deleted_record_.FinishLoad();
 }
 
 void
@@ -1366,10 +1422,83 @@ ChunkedSegmentSealedImpl::prefetch_chunks(
     AssertInfo(get_bit(field_data_ready_bitset_, field_id),
                "Can't get bitset element at " + std::to_string(field_id.get()));
     if (auto column = get_column(field_id)) {
+        RecordWarmupAccess(field_id, WarmupProfile::Target::FIELD);
         column->PrefetchChunks(op_ctx, chunk_ids);
     }
 }
 
+std::future<void>
+ChunkedSegmentSealedImpl::prefetch_chunks_async(
+    milvus::OpContext* op_ctx,
+    FieldId field_id,
+    const std::vector<int64_t>& chunk_ids) const {
+    auto column = get_column(field_id);
+    if (column == nullptr || column->num_chunks() == 0 || chunk_ids.empty()) {
+        return {};
+    }
+    RecordWarmupAccess(field_id, WarmupProfile::Target::FIELD);
+    std::vector<int64_t> ids = chunk_ids;
+    auto& transient_budget =
+        storage::TransientMemoryBudget::GetLoadTransientBudget();
+    auto budget = transient_budget.CapacityBytes();
+    if (budget > 0) {
+        auto chunk_bytes = std::max<size_t>(
+            1, column->DataByteSize() / column->num_chunks());
+        auto max_chunks = std::max<size_t>(1, budget / 2 / chunk_bytes);
+        if (ids.size() > max_chunks) {
+            ids.resize(max_chunks);
+        }
+    }
+    auto& pool = ThreadPools::GetThreadPool(milvus::ThreadPoolPriority::MIDDLE);
+    return pool.Submit(
+        [op_ctx, column = std::move(column), ids = std::move(ids)]() {
+            column->PrefetchChunks(op_ctx, ids);
+        });
+}
+
+std::future<void>
+ChunkedSegmentSealedImpl::PrefetchOutputFields(
+    milvus::OpContext* op_ctx,
+    const std::vector<FieldId>& field_ids,
+    const int64_t* offsets,
+    int64_t count) const {
+    std::vector<std::future<void>> futures;
+    auto& pool = ThreadPools::GetThreadPool(milvus::ThreadPoolPriority::MIDDLE);
+    std::vector<int64_t> valid_offsets;
+    valid_offsets.reserve(count);
+    for (auto field_id : field_ids) {
+        auto column = get_column(field_id);
+        if (column == nullptr || column->num_chunks() == 0) {
+            continue;
+        }
+        if (valid_offsets.empty()) {
+            auto num_rows = static_cast<int64_t>(column->NumRows());
+            for (int64_t i = 0; i < count; i++) {
+                if (offsets[i] >= 0 && offsets[i] < num_rows) {
+                    valid_offsets.push_back(offsets[i]);
+                }
+            }
+            if (valid_offsets.empty()) {
+                break;
+            }
+        }
+        auto [cids, offsets_in_chunk] = column->GetChunkIDsByOffsets(
+            valid_offsets.data(), valid_offsets.size());
+        std::vector<int64_t> chunk_ids(cids.begin(), cids.end());
+        std::sort(chunk_ids.begin(), chunk_ids.end());
+        chunk_ids.erase(std::unique(chunk_ids.begin(), chunk_ids.end()),
+                        chunk_ids.end());
+        futures.push_back(pool.Submit(
+            [op_ctx, column = std::move(column), ids = std::move(chunk_ids)]() {
+                column->PrefetchChunks(op_ctx, ids);
+            }));
+    }
+    return std::async(std::launch::deferred,
+                      [futures = std::move(futures)]() mutable {
+                          storage::WaitAllFutures(futures);
+                      });
+}
+
 void
 ChunkedSegmentSealedImpl::ApplyFieldValidData(
     milvus::OpContext* op_ctx,
@@ -1437,6 +1566,25 @@ ChunkedSegmentSealedImpl::ApplyFieldValidDataByOffsets(
         count);
 }
 
+PinWrapper<ChunkSpans>
+ChunkedSegmentSealedImpl::chunk_spans(milvus::OpContext* op_ctx,
+                                      FieldId field_id,
+                                      const int64_t* offsets,
+                                      int64_t count) const {
+    std::shared_ptr<ChunkedColumnInterface> column;
+    {
+        std::shared_lock lck(mutex_);
+        AssertInfo(
+            get_bit(field_data_ready_bitset_, field_id),
+            "Can't get bitset element at " + std::to_string(field_id.get()));
+        column = get_column(field_id);
+        AssertInfo(column != nullptr,
+                   "chunk_spans only used for chunk column field {}",
+                   field_id.get());
+    }
+    return column->SpansByOffsets(op_ctx, offsets, count);
+}
+
 PinWrapper<SpanBase>
 ChunkedSegmentSealedImpl::chunk_data_impl(milvus::OpContext* op_ctx,
                                           FieldId field_id,
@@ -1499,6 +1647,73 @@ ChunkedSegmentSealedImpl::chunk_string_view_impl(
               "chunk_string_view_impl only used for variable column field ");
 }
 
+PinWrapper<const StringChunk*>
+ChunkedSegmentSealedImpl::dict_string_chunk(milvus::OpContext* op_ctx,
+                                            FieldId field_id,
+                                            int64_t chunk_id) const {
+    std::shared_lock lck(mutex_);
+    if (!IsStringDataType(schema_->operator[](field_id).get_data_type())) {
+        return PinWrapper<const StringChunk*>(nullptr);
+    }
+    auto column = get_column(field_id);
+    if (column == nullptr) {
+        return PinWrapper<const StringChunk*>(nullptr);
+    }
+    auto pw = column->GetChunk(op_ctx, chunk_id);
+    auto chunk = static_cast<const StringChunk*>(pw.get());
+    if (!chunk->IsDictEncoded()) {
+        return PinWrapper<const StringChunk*>(nullptr);
+    }
+    return PinWrapper<const StringChunk*>(std::move(pw), chunk);
+}
+
+PinWrapper<const FixedWidthChunk*>
+ChunkedSegmentSealedImpl::packed_int_chunk(milvus::OpContext* op_ctx,
+                                           FieldId field_id,
+                                           int64_t chunk_id) const {
+    if (!ENABLE_PACKED_INT_CHUNK.load()) {
+        return PinWrapper<const FixedWidthChunk*>(nullptr);
+    }
+    std::shared_lock lck(mutex_);
+    auto data_type = schema_->operator[](field_id).get_data_type();
+    if (data_type != DataType::INT32 && data_type != DataType::INT64 &&
+        data_type != DataType::TIMESTAMPTZ) {
+        return PinWrapper<const FixedWidthChunk*>(nullptr);
+    }
+    auto column = get_column(field_id);
+    if (column == nullptr) {
+        return PinWrapper<const FixedWidthChunk*>(nullptr);
+    }
+    auto pw = column->GetChunk(op_ctx, chunk_id);
+    auto chunk = dynamic_cast<const FixedWidthChunk*>(pw.get());
+    if (chunk == nullptr || !chunk->IsPacked()) {
+        return PinWrapper<const FixedWidthChunk*>(nullptr);
+    }
+    return PinWrapper<const FixedWidthChunk*>(std::move(pw), chunk);
+}
+
+PinWrapper<const Chunk*>
+ChunkedSegmentSealedImpl::constant_chunk(milvus::OpContext* op_ctx,
+                                         FieldId field_id,
+                                         int64_t chunk_id) const {
+    // only the default value fields can hold constant chunks, this spares
+    // the other fields pinning their chunks twice
+    if (!default_value_fields_.rlock()->count(field_id)) {
+        return PinWrapper<const Chunk*>(nullptr);
+    }
+    std::shared_lock lck(mutex_);
+    auto column = get_column(field_id);
+    if (column == nullptr) {
+        return PinWrapper<const Chunk*>(nullptr);
+    }
+    auto pw = column->GetChunk(op_ctx, chunk_id);
+    auto chunk = pw.get();
+    if (chunk == nullptr || !chunk->IsConstant()) {
+        return PinWrapper<const Chunk*>(nullptr);
+    }
+    return PinWrapper<const Chunk*>(std::move(pw), chunk);
+}
+
 PinWrapper<std::pair<std::vector<std::string_view>, FixedVector<bool>>>
 ChunkedSegmentSealedImpl::chunk_string_views_by_offsets(
     milvus::OpContext* op_ctx,
@@ -1626,6 +1841,12 @@ ChunkedSegmentSealedImpl::vector_search(SearchInfo& search_info,
     AssertInfo(field_meta.is_vector(),
                "The meta type of vector field is not vector type");
 
+    RecordWarmupAccess(field_id,
+                       get_bit(binlog_index_bitset_, field_id) ||
+                               get_bit(index_ready_bitset_, field_id)
+                           ? WarmupProfile::Target::INDEX
+                           : WarmupProfile::Target::FIELD);
+
     if (get_bit(binlog_index_bitset_, field_id)) {
         AssertInfo(
             vec_binlog_config_.find(field_id) != vec_binlog_config_.end(),
@@ -1638,6 +1859,7 @@ ChunkedSegmentSealedImpl::vector_search(SearchInfo& search_info,
                        std::to_string(field_id.get()));
         query::SearchOnSealedIndex(*schema_,
                                    vector_indexings_,
+                                   id_,
                                    binlog_search_info,
                                    query_data,
                                    query_offsets,
@@ -1657,6 +1879,7 @@ ChunkedSegmentSealedImpl::vector_search(SearchInfo& search_info,
                        std::to_string(field_id.get()));
         query::SearchOnSealedIndex(*schema_,
                                    vector_indexings_,
+                                   id_,
                                    search_info,
                                    query_data,
                                    query_offsets,
@@ -1683,8 +1906,10 @@ ChunkedSegmentSealedImpl::vector_search(SearchInfo& search_info,
                 col_index_meta_->GetFieldIndexMeta(field_id).GetIndexParams();
         }
 
+        auto chunk_bounds = GetVectorChunkBounds(field_id, vec_data);
         query::SearchOnSealedColumn(*schema_,
                                     vec_data.get(),
+                                    id_,
                                     search_info,
                                     index_info,
                                     query_data,
@@ -1693,11 +1918,192 @@ ChunkedSegmentSealedImpl::vector_search(SearchInfo& search_info,
                                     row_count,
                                     bitset,
                                     op_context,
-                                    output);
+                                    output,
+                                    chunk_bounds.get());
         milvus::tracer::AddEvent("finish_searching_vector_data");
     }
 }
 
+std::shared_ptr<query::VectorChunkBounds>
+ChunkedSegmentSealedImpl::GetVectorChunkBounds(
+    FieldId field_id,
+    const std::shared_ptr<ChunkedColumnInterface>& column) const {
+    return vector_chunk_bounds_.withWLock([&](auto& bounds) {
+        auto& entry = bounds[field_id];
+        if (entry.bounds == nullptr || entry.column.lock() != column) {
+            entry.column = column;
+            entry.bounds = std::make_shared<query::VectorChunkBounds>();
+        }
+        return entry.bounds;
+    });
+}
+
+std::shared_ptr<const TargetBitmap>
+ChunkedSegmentSealedImpl::EntityTTLAliveRows(milvus::OpContext* op_ctx,
+                                             int64_t physical_us) const {
+    auto ttl_field_id = schema_->get_ttl_field_id();
+    if (!ttl_field_id.has_value()) {
+        return nullptr;
+    }
+    auto column = get_column(ttl_field_id.value());
+    if (column == nullptr) {
+        return nullptr;
+    }
+    // built on the first query after the field is loaded into a column, the
+    // concurrent ones wait for it rather than scanning the field themselves
+    auto index = entity_ttl_index_.withWLock([&](auto& entry) {
+        if (entry.index == nullptr || entry.column.lock() != column) {
+            entry.column = column;
+            entry.index = EntityTTLIndex::Build(op_ctx, *column);
+        }
+        return entry.index;
+    });
+    return index->AliveAt(physical_us);
+}
+
+std::optional<std::vector<int64_t>>
+ChunkedSegmentSealedImpl::VisiblePkOffsets(const std::vector<PkType>& pks,
+                                           Timestamp timestamp) const {
+    // external collections have no per-row timestamps to check
+    if (schema_->is_external_collection()) {
+        return std::nullopt;
+    }
+    std::vector<std::pair<size_t, int64_t>> hits;
+    search_pks_batch(pks, [&hits](size_t idx, int64_t offset) {
+        hits.emplace_back(idx, offset);
+    });
+    // the pk order of find_first_n, a pk listed twice hits its rows twice
+    std::sort(hits.begin(), hits.end(), [&pks](const auto& a, const auto& b) {
+        return pks[a.first] != pks[b.first] ? pks[a.first] < pks[b.first]
+                                            : a.second < b.second;
+    });
+    std::vector<int64_t> offsets;
+    offsets.reserve(hits.size());
+    for (const auto& [_, offset] : hits) {
+        if (offsets.empty() || offsets.back() != offset) {
+            offsets.push_back(offset);
+        }
+    }
+    if (offsets.empty()) {
+        return offsets;
+    }
+
+    std::vector<Timestamp> insert_ts(offsets.size());
+    milvus::OpContext op_ctx;
+    bulk_subscript(&op_ctx,
+                   SystemFieldType::Timestamp,
+                   offsets.data(),
+                   offsets.size(),
+                   insert_ts.data());
+    size_t visible = 0;
+    for (size_t i = 0; i < offsets.size(); ++i) {
+        if (insert_ts[i] <= timestamp) {
+            offsets[visible++] = offsets[i];
+        }
+    }
+    offsets.resize(visible);
+    deleted_record_.RemoveDeleted(offsets, timestamp);
+    return offsets;
+}
+
+template <typename T>
+static bool
+column_non_decreasing(milvus::OpContext* op_ctx,
+                      const ChunkedColumnInterface& column) {
+    std::optional<T> last;
+    for (int64_t chunk_id = 0; chunk_id < column.num_chunks(); ++chunk_id) {
+        auto pw = column.GetChunk(op_ctx, chunk_id);
+        // constant and packed chunks have their own kernels, a binary search
+        // over their spans would decode them
+        auto chunk = dynamic_cast<const FixedWidthChunk*>(pw.get());
+        if (chunk == nullptr || chunk->IsConstant() || chunk->IsPacked()) {
+            return false;
+        }
+        auto span = chunk->Span();
+        auto data = static_cast<const T*>(span.data());
+        for (int64_t i = 0; i < span.row_count(); ++i) {
+            if constexpr (std::is_floating_point_v<T>) {
+                if (std::isnan(data[i])) {
+                    return false;
+                }
+            }
+            if (last.has_value() && data[i] < last.value()) {
+                return false;
+            }
+            last = data[i];
+        }
+    }
+    return true;
+}
+
+bool
+ChunkedSegmentSealedImpl::IsFieldSorted(milvus::OpContext* op_ctx,
+                                        FieldId field_id) const {
+    const auto& field_meta = schema_->operator[](field_id);
+    if (field_meta.is_nullable()) {
+        return false;
+    }
+    auto column = get_column(field_id);
+    if (column == nullptr) {
+        return false;
+    }
+    // checked on the first range filter after the field is loaded into a
+    // column, a segment written in sort key order keeps it for every query
+    return field_sorted_.withWLock([&](auto& sorted) {
+        auto& entry = sorted[field_id];
+        if (entry.column.lock() == column) {
+            return entry.sorted;
+        }
+        entry.column = column;
+        switch (field_meta.get_data_type()) {
+            case DataType::INT8:
+                entry.sorted = column_non_decreasing<int8_t>(op_ctx, *column);
+                break;
+            case DataType::INT16:
+                entry.sorted = column_non_decreasing<int16_t>(op_ctx, *column);
+                break;
+            case DataType::INT32:
+                entry.sorted = column_non_decreasing<int32_t>(op_ctx, *column);
+                break;
+            case DataType::INT64:
+            case DataType::TIMESTAMPTZ:
+                entry.sorted = column_non_decreasing<int64_t>(op_ctx, *column);
+                break;
+            case DataType::FLOAT:
+                entry.sorted = column_non_decreasing<float>(op_ctx, *column);
+                break;
+            case DataType::DOUBLE:
+                entry.sorted = column_non_decreasing<double>(op_ctx, *column);
+                break;
+            default:
+                entry.sorted = false;
+        }
+        return entry.sorted;
+    });
+}
+
+std::shared_ptr<const TargetBitmap>
+ChunkedSegmentSealedImpl::SharedMvccMask(int64_t active_count,
+                                         Timestamp timestamp,
+                                         Timestamp collection_ttl) const {
+    // the version before the max delete timestamp, a delete of the version
+    // is in the max
+    MvccMaskCache::Key key{
+        active_count, timestamp, collection_ttl, deleted_record_.version()};
+    // past every insert and delete all timestamps hide the same rows
+    if (timestamp >= get_max_timestamp() &&
+        timestamp >= deleted_record_.max_timestamp()) {
+        key.timestamp = MAX_TIMESTAMP;
+    }
+    return mvcc_mask_cache_.GetOrCompute(key, [&]() {
+        auto mask = std::make_shared<TargetBitmap>(active_count);
+        BitsetTypeView view(*mask);
+        mask_with_timestamps(view, timestamp, collection_ttl);
+        mask_with_delete(view, active_count, timestamp);
+        return std::shared_ptr<const TargetBitmap>(std::move(mask));
+    });
+}
+
 ChunkedSegmentSealedImpl::ValidResult
 ChunkedSegmentSealedImpl::FilterVectorValidOffsetsFromIndex(
     milvus::OpContext* op_ctx,
@@ -1972,6 +2378,11 @@ ChunkedSegmentSealedImpl::DropFieldData(const FieldId field_id) {
     if (column) {
         column->CancelWarmup();
         fields_.wlock()->erase(field_id);
+        default_value_fields_.wlock()->erase(field_id);
+        if (SearchIteratorRegistry::IsEnabled()) {
+            // paused iterators pin chunks of the dropped column
+            SearchIteratorRegistry::Instance().EraseSegment(id_);
+        }
     }
     clear_bit_if_present(field_data_ready_bitset_, field_id);
     if (has_bit_position(binlog_index_bitset_, field_id) &&
@@ -2075,18 +2486,12 @@ ChunkedSegmentSealedImpl::search_pks(BitsetType& bitset,
         auto* pk_cell = pk_index.get();
         AssertInfo(pk_cell != nullptr || !insert_record_.empty_pks(),
                    "primary key index is not ready");
-        for (auto& pk : pks) {
-            if (pk_cell != nullptr) {
-                pk_cell->pk2offset().find_range(
-                    pk,
-                    proto::plan::OpType::Equal,
-                    bitset_view,
-                    [](int64_t offset) { return true; });
-            } else {
-                insert_record_.search_pk_range(
-                    pk, proto::plan::OpType::Equal, bitset_view);
-            }
-        }
+        const auto& pk2offset = pk_cell != nullptr
+                                    ? pk_cell->pk2offset()
+                                    : *insert_record_.pk2offset_;
+        pk2offset.find_batch(pks, [&bitset_view](size_t, int64_t offset) {
+            bitset_view[offset] = true;
+        });
         return;
     }
 
@@ -2159,47 +2564,138 @@ ChunkedSegmentSealedImpl::search_batch_pks(
         return data[offset - ts_chunk_offsets[c]];
     };
 
-    // Virtual PK offset maps can resolve pk -> offset directly by bit-extract.
-    // Avoid the sorted-PK column scan below: external segments synthesize PKs
-    // with VirtualPKChunkedColumn, which intentionally does not support
-    // GetAllChunks().
+    auto timestamp_hit =
+        include_same_ts
+            ? [](Timestamp lhs, Timestamp rhs) { return lhs <= rhs; }
+            : [](Timestamp lhs, Timestamp rhs) { return lhs < rhs; };
+    search_pks_batch(pks, [&](size_t idx, int64_t offset) {
+        auto timestamp = get_timestamp(idx);
+        auto insert_ts = read_ts(offset);
+        if (timestamp_hit(insert_ts, timestamp)) {
+            callback(SegOffset(offset), timestamp);
+        }
+    });
+}
+
+namespace {
+
+// probes per unit of work of a batched pk lookup, pk index lookups of at
+// most this many pks are not worth sorting
+constexpr int64_t kPkBatchMorselSize = 16 * 1024;
+
+using PkBatchHits = std::vector<std::pair<size_t, int64_t>>;
+
+// Probe indices ordered by pk, equal pks keep their input order.
+std::vector<size_t>
+SortPkProbes(const std::vector<PkType>& pks) {
+    std::vector<size_t> order(pks.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&pks](size_t a, size_t b) {
+        return pks[a] < pks[b];
+    });
+    return order;
+}
+
+// Resolves [0, num_probes) in morsels, on the calling thread plus whatever
+// load threads are idle, then reports every hit on the calling thread in
+// probe order.
+void
+ResolvePkProbesInMorsels(
+    int64_t num_probes,
+    const std::function<void(int64_t begin, int64_t end, PkBatchHits& hits)>&
+        resolve,
+    const std::function<void(size_t idx, int64_t offset)>& callback) {
+    auto num_morsels =
+        (num_probes + kPkBatchMorselSize - 1) / kPkBatchMorselSize;
+    std::vector<PkBatchHits> hits(num_morsels);
+    auto* executor = futures::getLoadCPUExecutor();
+    exec::MorselDispatcher::Run(
+        num_probes,
+        kPkBatchMorselSize,
+        static_cast<int32_t>(executor->numThreads()),
+        executor,
+        [&]() {
+            return [&](int64_t begin, int64_t end) {
+                resolve(begin, end, hits[begin / kPkBatchMorselSize]);
+            };
+        });
+    for (const auto& morsel_hits : hits) {
+        for (const auto& [idx, offset] : morsel_hits) {
+            callback(idx, offset);
+        }
+    }
+}
+
+}  // namespace
+
+void
+ChunkedSegmentSealedImpl::search_pks_batch(
+    const std::vector<PkType>& pks,
+    const std::function<void(size_t idx, int64_t offset)>& callback) const {
+    if (pks.empty()) {
+        return;
+    }
+
+    // Virtual PK offset maps resolve pk -> offset directly by bit-extract.
+    // External segments synthesize PKs with VirtualPKChunkedColumn, which
+    // intentionally does not support GetAllChunks().
     if (insert_record_.pk2offset_is_zero_storage()) {
-        auto timestamp_hit =
-            include_same_ts
-                ? [](Timestamp lhs, Timestamp rhs) { return lhs <= rhs; }
-                : [](Timestamp lhs, Timestamp rhs) { return lhs < rhs; };
-        for (size_t i = 0; i < pks.size(); i++) {
-            auto timestamp = get_timestamp(i);
-            for (auto offset : insert_record_.pk2offset_->find(pks[i])) {
-                auto insert_ts = read_ts(offset);
-                if (timestamp_hit(insert_ts, timestamp)) {
-                    callback(SegOffset(offset), timestamp);
-                }
+        insert_record_.pk2offset_->find_batch(pks, callback);
+        return;
+    }
+
+    auto pk_index = PinPkIndex(nullptr);
+    auto* pk_cell = pk_index.get();
+    // Most pks of a streaming delete belong to other segments of the shard,
+    // drop the ones the pk filter rules out before any index or column
+    // lookup.
+    if (auto* pk_filter = get_pk_filter(pk_cell); pk_filter != nullptr) {
+        auto candidates = pk_filter_candidates(*pk_filter, pks);
+        if (candidates.empty()) {
+            return;
+        }
+        if (candidates.size() < pks.size()) {
+            std::vector<PkType> candidate_pks;
+            candidate_pks.reserve(candidates.size());
+            for (auto idx : candidates) {
+                candidate_pks.push_back(pks[idx]);
             }
+            search_candidate_pks_batch(
+                candidate_pks, pk_cell, [&](size_t idx, int64_t offset) {
+                    callback(candidates[idx], offset);
+                });
+            return;
         }
-        return;
     }
+    search_candidate_pks_batch(pks, pk_cell, callback);
+}
 
-    // handle unsorted case
+void
+ChunkedSegmentSealedImpl::search_candidate_pks_batch(
+    const std::vector<PkType>& pks,
+    const storagev2translator::PkIndexCell* pk_cell,
+    const std::function<void(size_t idx, int64_t offset)>& callback) const {
     if (!is_sorted_by_pk_) {
-        auto pk_index = PinPkIndex(nullptr);
-        auto* pk_cell = pk_index.get();
-        auto timestamp_hit =
-            include_same_ts
-                ? [](Timestamp lhs, Timestamp rhs) { return lhs <= rhs; }
-                : [](Timestamp lhs, Timestamp rhs) { return lhs < rhs; };
-        for (size_t i = 0; i < pks.size(); i++) {
-            auto timestamp = get_timestamp(i);
-            auto offsets = pk_cell != nullptr
-                               ? pk_cell->pk2offset().find(pks[i])
-                               : insert_record_.pk2offset_->find(pks[i]);
-            for (auto offset : offsets) {
-                auto insert_ts = read_ts(offset);
-                if (timestamp_hit(insert_ts, timestamp)) {
-                    callback(SegOffset(offset), timestamp);
-                }
-            }
+        const auto& pk2offset = pk_cell != nullptr
+                                    ? pk_cell->pk2offset()
+                                    : *insert_record_.pk2offset_;
+        if (static_cast<int64_t>(pks.size()) <= kPkBatchMorselSize) {
+            pk2offset.find_batch(pks, callback);
+            return;
         }
+        // probing in pk order walks the index front to back instead of
+        // jumping around it
+        auto order = SortPkProbes(pks);
+        ResolvePkProbesInMorsels(
+            order.size(),
+            [&](int64_t begin, int64_t end, PkBatchHits& hits) {
+                for (auto k = begin; k < end; ++k) {
+                    for (auto offset : pk2offset.find(pks[order[k]])) {
+                        hits.emplace_back(order[k], offset);
+                    }
+                }
+            },
+            callback);
         return;
     }
 
@@ -2208,83 +2704,128 @@ ChunkedSegmentSealedImpl::search_batch_pks(
     auto pk_column = get_column(pk_field_id);
     AssertInfo(pk_column != nullptr, "primary key column not loaded");
 
-    auto all_chunk_pins = pk_column->GetAllChunks(nullptr);
-
-    auto timestamp_hit = include_same_ts
-                             ? [](const Timestamp& ts1,
-                                  const Timestamp& ts2) { return ts1 <= ts2; }
-                             : [](const Timestamp& ts1, const Timestamp& ts2) {
-                                   return ts1 < ts2;
-                               };
-
     switch (schema_->get_fields().at(pk_field_id).get_data_type()) {
-        case DataType::INT64: {
-            auto num_chunk = pk_column->num_chunks();
-            for (int i = 0; i < num_chunk; ++i) {
-                const auto& pw = all_chunk_pins[i];
-                auto src =
-                    reinterpret_cast<const int64_t*>(pw.get()->RawData());
-                auto chunk_row_num = pk_column->chunk_row_nums(i);
-                for (size_t j = 0; j < pks.size(); j++) {
-                    // get int64 pks
-                    auto target = std::get<int64_t>(pks[j]);
-                    auto timestamp = get_timestamp(j);
-                    auto it = std::lower_bound(
-                        src,
-                        src + chunk_row_num,
-                        target,
-                        [](const int64_t& elem, const int64_t& value) {
-                            return elem < value;
-                        });
-                    auto num_rows_until_chunk =
-                        pk_column->GetNumRowsUntilChunk(i);
-                    for (; it != src + chunk_row_num && *it == target; ++it) {
-                        auto offset = it - src + num_rows_until_chunk;
-                        auto insert_ts = read_ts(offset);
-                        if (timestamp_hit(insert_ts, timestamp)) {
-                            callback(SegOffset(offset), timestamp);
-                        }
-                    }
-                }
-            }
-
+        case DataType::INT64:
+            search_sorted_pks_batch_impl<int64_t>(pks, pk_column, callback);
             break;
-        }
-        case DataType::VARCHAR: {
-            auto num_chunk = pk_column->num_chunks();
-            for (int i = 0; i < num_chunk; ++i) {
-                // TODO @xiaocai2333, @sunby: chunk need to record the min/max.
-                auto num_rows_until_chunk = pk_column->GetNumRowsUntilChunk(i);
-                const auto& pw = all_chunk_pins[i];
-                auto string_chunk = static_cast<StringChunk*>(pw.get());
-                for (size_t j = 0; j < pks.size(); ++j) {
-                    // get varchar pks
-                    auto& target = std::get<std::string>(pks[j]);
-                    auto timestamp = get_timestamp(j);
-                    auto offset = string_chunk->binary_search_string(target);
-                    for (; offset != -1 && offset < string_chunk->RowNums() &&
-                           string_chunk->operator[](offset) == target;
-                         ++offset) {
-                        auto segment_offset = offset + num_rows_until_chunk;
-                        auto insert_ts = read_ts(segment_offset);
-                        if (timestamp_hit(insert_ts, timestamp)) {
-                            callback(SegOffset(segment_offset), timestamp);
-                        }
-                    }
-                }
-            }
+        case DataType::VARCHAR:
+            search_sorted_pks_batch_impl<std::string>(
+                pks, pk_column, callback);
             break;
-        }
-        default: {
+        default:
             ThrowInfo(
                 DataTypeInvalid,
                 fmt::format(
                     "unsupported type {}",
                     schema_->get_fields().at(pk_field_id).get_data_type()));
-        }
     }
 }
 
+template <typename PK>
+void
+ChunkedSegmentSealedImpl::search_sorted_pks_batch_impl(
+    const std::vector<PkType>& pks,
+    const std::shared_ptr<ChunkedColumnInterface>& pk_column,
+    const std::function<void(size_t idx, int64_t offset)>& callback) const {
+    using PKViewType = std::conditional_t<std::is_same_v<PK, int64_t>,
+                                          int64_t,
+                                          std::string_view>;
+
+    auto all_chunk_pins = pk_column->GetAllChunks(nullptr);
+    const int num_chunk = pk_column->num_chunks();
+    auto get_val_view = [&](int chunk_id, int64_t offset) -> PKViewType {
+        auto& pw = all_chunk_pins[chunk_id];
+        if constexpr (std::is_same_v<PK, int64_t>) {
+            auto src = reinterpret_cast<const int64_t*>(pw.get()->RawData());
+            return src[offset];
+        } else {
+            return static_cast<StringChunk*>(pw.get())->operator[](offset);
+        }
+    };
+    auto probe = [&pks](size_t idx) -> const PK& {
+        return std::get<PK>(pks[idx]);
+    };
+    // first offset in [from, rows) of the chunk with a pk >= target,
+    // doubling the step until it overshoots, then bisecting
+    auto gallop = [&](int chunk_id, int64_t from, const PK& target) {
+        auto rows = pk_column->chunk_row_nums(chunk_id);
+        int64_t lo = from;
+        int64_t hi = from;
+        int64_t step = 1;
+        while (hi < rows && get_val_view(chunk_id, hi) < target) {
+            lo = hi + 1;
+            hi = lo + step;
+            step *= 2;
+        }
+        hi = std::min(hi, rows);
+        while (lo < hi) {
+            auto mid = lo + (hi - lo) / 2;
+            if (get_val_view(chunk_id, mid) < target) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        return lo;
+    };
+
+    auto order = SortPkProbes(pks);
+    ResolvePkProbesInMorsels(
+        order.size(),
+        [&](int64_t begin, int64_t end, PkBatchHits& hits) {
+            // every morsel seeks to its first probe, then only moves forward
+            auto [chunk_id, in_chunk_offset, exact_match] =
+                this->pk_lower_bound<PK>(
+                    probe(order[begin]), pk_column.get(), all_chunk_pins, 0);
+            if (chunk_id == -1) {
+                return;
+            }
+            int64_t pos = in_chunk_offset;
+            size_t prev_hits_begin = 0;
+            for (auto k = begin; k < end; ++k) {
+                const auto& target = probe(order[k]);
+                if (k > begin && target == probe(order[k - 1])) {
+                    // same pk deleted again, reuse the previous match
+                    auto prev_hits_end = hits.size();
+                    for (auto h = prev_hits_begin; h < prev_hits_end; ++h) {
+                        hits.emplace_back(order[k], hits[h].second);
+                    }
+                    prev_hits_begin = prev_hits_end;
+                    continue;
+                }
+                prev_hits_begin = hits.size();
+
+                while (chunk_id < num_chunk) {
+                    auto rows = pk_column->chunk_row_nums(chunk_id);
+                    if (rows > 0 &&
+                        !(get_val_view(chunk_id, rows - 1) < target)) {
+                        break;
+                    }
+                    ++chunk_id;
+                    pos = 0;
+                }
+                if (chunk_id == num_chunk) {
+                    break;
+                }
+                pos = gallop(chunk_id, pos, target);
+
+                // the run of equal pks may continue into the next chunks
+                for (int c = chunk_id; c < num_chunk; ++c) {
+                    auto rows = pk_column->chunk_row_nums(c);
+                    auto base = pk_column->GetNumRowsUntilChunk(c);
+                    auto p = c == chunk_id ? pos : 0;
+                    for (; p < rows && get_val_view(c, p) == target; ++p) {
+                        hits.emplace_back(order[k], base + p);
+                    }
+                    if (p < rows) {
+                        break;
+                    }
+                }
+            }
+        },
+        callback);
+}
+
 void
 ChunkedSegmentSealedImpl::pk_range(milvus::OpContext* op_ctx,
                                    proto::plan::OpType op,
@@ -2576,92 +3117,10 @@ ChunkedSegmentSealedImpl::ChunkedSegmentSealedImpl(
                   // PK search so that deletes with ts < commit_ts can still
                   // find the matching rows. Pass the original delete
                   // timestamp to the callback for correct storage.
-                  if (!is_sorted_by_pk_) {
-                      auto pk_index = PinPkIndex(nullptr);
-                      auto* pk_cell = pk_index.get();
-                      for (size_t i = 0; i < pks.size(); i++) {
-                          auto offsets =
-                              pk_cell != nullptr
-                                  ? pk_cell->pk2offset().find(pks[i])
-                                  : insert_record_.pk2offset_->find(pks[i]);
-                          for (auto offset : offsets) {
-                              callback(SegOffset(offset), timestamps[i]);
-                          }
-                      }
-                  } else {
-                      auto pk_field_id =
-                          schema_->get_primary_field_id().value_or(FieldId(-1));
-                      AssertInfo(pk_field_id.get() != -1, "Primary key is -1");
-                      auto pk_column = get_column(pk_field_id);
-                      AssertInfo(pk_column != nullptr,
-                                 "primary key column not loaded");
-                      auto all_chunk_pins = pk_column->GetAllChunks(nullptr);
-
-                      switch (schema_->get_fields()
-                                  .at(pk_field_id)
-                                  .get_data_type()) {
-                          case DataType::INT64: {
-                              auto num_chunk = pk_column->num_chunks();
-                              for (int i = 0; i < num_chunk; ++i) {
-                                  const auto& pw = all_chunk_pins[i];
-                                  auto src = reinterpret_cast<const int64_t*>(
-                                      pw.get()->RawData());
-                                  auto chunk_row_num =
-                                      pk_column->chunk_row_nums(i);
-                                  auto num_rows_until_chunk =
-                                      pk_column->GetNumRowsUntilChunk(i);
-                                  for (size_t j = 0; j < pks.size(); j++) {
-                                      auto target = std::get<int64_t>(pks[j]);
-                                      auto it = std::lower_bound(
-                                          src, src + chunk_row_num, target);
-                                      for (; it != src + chunk_row_num &&
-                                             *it == target;
-                                           ++it) {
-                                          callback(
-                                              SegOffset(it - src +
-                                                        num_rows_until_chunk),
-                                              timestamps[j]);
-                                      }
-                                  }
-                              }
-                              break;
-                          }
-                          case DataType::VARCHAR: {
-                              auto num_chunk = pk_column->num_chunks();
-                              for (int i = 0; i < num_chunk; ++i) {
-                                  auto num_rows_until_chunk =
-                                      pk_column->GetNumRowsUntilChunk(i);
-                                  const auto& pw = all_chunk_pins[i];
-                                  auto string_chunk =
-                                      static_cast<StringChunk*>(pw.get());
-                                  for (size_t j = 0; j < pks.size(); ++j) {
-                                      auto& target =
-                                          std::get<std::string>(pks[j]);
-                                      auto offset =
-                                          string_chunk->binary_search_string(
-                                              target);
-                                      for (; offset != -1 &&
-                                             offset < string_chunk->RowNums() &&
-                                             string_chunk->operator[](offset) ==
-                                                 target;
-                                           ++offset) {
-                                          callback(
-                                              SegOffset(offset +
-                                                        num_rows_until_chunk),
-                                              timestamps[j]);
-                                      }
-                                  }
-                              }
-                              break;
-                          }
-                          default:
-                              ThrowInfo(DataTypeInvalid,
-                                        fmt::format("unsupported type {}",
-                                                    schema_->get_fields()
-                                                        .at(pk_field_id)
-                                                        .get_data_type()));
-                      }
-                  }
+                  this->search_pks_batch(
+                      pks, [&](size_t idx, int64_t offset) {
+                          callback(SegOffset(offset), timestamps[idx]);
+                      });
               } else {
                   this->search_batch_pks(
                       pks,
@@ -2680,6 +3139,12 @@ ChunkedSegmentSealedImpl::~ChunkedSegmentSealedImpl() {
     // Clean up geometry cache for all fields in this segment
     auto& cache_manager = milvus::exec::SimpleGeometryCacheManager::Instance();
     cache_manager.RemoveSegmentCaches(ctx_, get_segment_id());
+    if (SearchResultCache::IsEnabled()) {
+        SearchResultCache::Instance().EraseSegment(get_segment_id());
+    }
+    if (SearchIteratorRegistry::IsEnabled()) {
+        SearchIteratorRegistry::Instance().EraseSegment(get_segment_id());
+    }
 
     if (ctx_) {
         GEOS_finish_r(ctx_);
@@ -3099,6 +3564,7 @@ ChunkedSegmentSealedImpl::ClearData() {
         index_has_raw_data_.clear();
         num_rows_ = std::nullopt;
         ngram_fields_.wlock()->clear();
+        default_value_fields_.wlock()->clear();
         scalar_indexings_.withWLock([&](auto& scalar_indexings) {
             cancel_and_clear_scalar_indexings(scalar_indexings);
         });
@@ -3850,6 +4316,7 @@ ChunkedSegmentSealedImpl::bulk_subscript(milvus::OpContext* op_ctx,
     if (count == 0) {
         return fill_with_empty(field_id, count);
     }
+    RecordWarmupAccess(field_id, WarmupProfile::Target::FIELD);
 
     // Fast path for int64 PK field: use compressed offset2pk index
     auto pk_field_id = schema_->get_primary_field_id();
@@ -3955,6 +4422,21 @@ ChunkedSegmentSealedImpl::bulk_subscript(
             count);
     }
     auto dst = ret->mutable_scalars()->mutable_json_data()->mutable_data();
+    // keys shredded into typed columns by the json stats are read from
+    // there, without parsing the rows
+    if (!column->IsNullable()) {
+        auto json_stats = GetJsonStats(op_ctx, field_id);
+        if (json_stats != nullptr) {
+            auto sub_jsons = json_stats->BulkExtractSubJson(
+                op_ctx, dynamic_field_names, seg_offsets, count);
+            if (sub_jsons.has_value()) {
+                for (int64_t i = 0; i < count; i++) {
+                    dst->at(i) = std::move((*sub_jsons)[i]);
+                }
+                return ret;
+            }
+        }
+    }
     column->BulkRawJsonAt(
         op_ctx,
         [&](Json json, size_t offset, bool is_valid) {
@@ -4272,6 +4754,62 @@ scan_timestamp_range(const ChunkedColumnInterface& column,
     }
 }
 
+// Helper: the first offset of [beg, end) whose timestamp is after `ts`, or
+// `end`, for a range whose timestamps are non-decreasing. Binary searches
+// the chunk the split falls in.
+static int64_t
+first_timestamp_after(const TimestampData& ts,
+                      int64_t beg,
+                      int64_t end,
+                      Timestamp timestamp) {
+    for (int64_t c = 0; c < ts.num_chunks(); c++) {
+        auto chunk_start = ts.chunk_start_offset(c);
+        auto chunk_end = chunk_start + ts.chunk_row_count(c);
+        auto overlap_beg = std::max(beg, chunk_start);
+        auto overlap_end = std::min(end, chunk_end);
+        if (overlap_beg >= overlap_end) {
+            continue;
+        }
+        auto* data = ts.chunk_data(c);
+        auto it = std::upper_bound(data + (overlap_beg - chunk_start),
+                                   data + (overlap_end - chunk_start),
+                                   timestamp);
+        if (it != data + (overlap_end - chunk_start)) {
+            return chunk_start + (it - data);
+        }
+    }
+    return end;
+}
+
+static int64_t
+first_timestamp_after(const ChunkedColumnInterface& column,
+                      int64_t beg,
+                      int64_t end,
+                      Timestamp timestamp) {
+    auto num_chunks = column.num_chunks();
+    int64_t chunk_start = 0;
+    for (int64_t c = 0; c < num_chunks; c++) {
+        auto chunk_rows = column.chunk_row_nums(c);
+        auto chunk_end = chunk_start + chunk_rows;
+        auto overlap_beg = std::max(beg, chunk_start);
+        auto overlap_end = std::min(end, chunk_end);
+        if (overlap_beg >= overlap_end) {
+            chunk_start = chunk_end;
+            continue;
+        }
+        auto pw = column.DataOfChunk(nullptr, c);
+        auto* data = reinterpret_cast<const Timestamp*>(pw.get());
+        auto it = std::upper_bound(data + (overlap_beg - chunk_start),
+                                   data + (overlap_end - chunk_start),
+                                   timestamp);
+        if (it != data + (overlap_end - chunk_start)) {
+            return chunk_start + (it - data);
+        }
+        chunk_start = chunk_end;
+    }
+    return end;
+}
+
 void
 ChunkedSegmentSealedImpl::mask_with_timestamps(BitsetTypeView& bitset_chunk,
                                                Timestamp timestamp,
@@ -4312,12 +4850,31 @@ ChunkedSegmentSealedImpl::mask_with_timestamps(BitsetTypeView& bitset_chunk,
             scan_timestamp_range(insert_record_.timestamps_, beg, end, pred);
         }
     };
+    // The split of a sorted range [beg, end): rows before it are at most
+    // `ts`, rows from it on are after `ts`.
+    auto do_split = [&](int64_t beg, int64_t end, Timestamp ts) -> int64_t {
+        if (effective_commit_ts) {
+            return *effective_commit_ts > ts ? beg : end;
+        }
+        if (ts_column) {
+            return first_timestamp_after(*ts_column, beg, end, ts);
+        }
+        return first_timestamp_after(insert_record_.timestamps_, beg, end, ts);
+    };
 
     if (collection_ttl > 0) {
         auto range = ts_index_data.get_active_range(collection_ttl);
         if (range.first == range.second && range.first == total_size) {
             bitset_chunk.set();
             return;
+        } else if (ts_index_data.is_active_range_sorted(collection_ttl)) {
+            // TTL bitset: [0, split) = true, [split, size) = false
+            auto split = do_split(range.first, range.second, collection_ttl);
+            BitsetType ttl_mask;
+            ttl_mask.reserve(total_size);
+            ttl_mask.resize(split, true);
+            ttl_mask.resize(total_size, false);
+            bitset_chunk |= ttl_mask;
         } else {
             // TTL bitset: [0, beg) = true, [beg, end) = check, [end, size) = false
             BitsetType ttl_mask;
@@ -4346,14 +4903,20 @@ ChunkedSegmentSealedImpl::mask_with_timestamps(BitsetTypeView& bitset_chunk,
         bitset_chunk.set();
         return;
     }
-    // [0, beg) = false, [beg, end) = check, [end, size) = true
     BitsetType mask;
     mask.reserve(total_size);
-    mask.resize(range.first, false);
-    mask.resize(total_size, true);
-    do_scan(range.first, range.second, [&](int64_t i, Timestamp val) {
-        mask[i] = val > timestamp;
-    });
+    if (ts_index_data.is_active_range_sorted(timestamp)) {
+        // [0, split) = false, [split, size) = true
+        mask.resize(do_split(range.first, range.second, timestamp), false);
+        mask.resize(total_size, true);
+    } else {
+        // [0, beg) = false, [beg, end) = check, [end, size) = true
+        mask.resize(range.first, false);
+        mask.resize(total_size, true);
+        do_scan(range.first, range.second, [&](int64_t i, Timestamp val) {
+            mask[i] = val > timestamp;
+        });
+    }
     bitset_chunk |= mask;
 }
 
@@ -4546,6 +5109,7 @@ ChunkedSegmentSealedImpl::load_field_data_common(
                 }
             }
             fields_.wlock()->insert_or_assign(field_id, column);
+            default_value_fields_.wlock()->erase(field_id);
             LOG_INFO(
                 "Replacing field {} data in segment {}", field_id.get(), id_);
         } else {
@@ -4838,6 +5402,15 @@ ChunkedSegmentSealedImpl::ApplyLoadDiff(milvus::OpContext* op_ctx,
 
     CheckCancellation(op_ctx, id_, "ChunkedSegmentSealedImpl::ApplyLoadDiff()");
 
+    // Column groups and field binlogs are independent of each other, so all
+    // of them are scheduled together, largest first. They only depend on
+    // the indexes above, which decide whether raw data is loaded at all.
+    SegmentLoadScheduler data_scheduler(
+        id_,
+        "field data",
+        LoadInflightLimitBytes(),
+        op_ctx ? op_ctx->cancellation_token : folly::CancellationToken());
+
     // load column groups
     if (diff.load_external_manifest) {
         // External collections: load via manifest path
@@ -4866,6 +5439,7 @@ ChunkedSegmentSealedImpl::ApplyLoadDiff(milvus::OpContext* op_ctx,
                 std::lock_guard<std::mutex> lock(reader_mutex_);
                 reader_ = milvus_storage::api::Reader::create(
                     column_groups, arrow_schema, needed_columns, *properties);
+                take_planner_.Reset();
             }
             // New column group fields
             if (!diff.column_groups_to_load.empty()) {
@@ -4873,14 +5447,18 @@ ChunkedSegmentSealedImpl::ApplyLoadDiff(milvus::OpContext* op_ctx,
                                  properties,
                                  diff.column_groups_to_load,
                                  true,
-                                 op_ctx);
+                                 op_ctx,
+                                 false,
+                                 &data_scheduler);
             }
             if (!diff.column_groups_to_lazyload.empty()) {
                 LoadColumnGroups(column_groups,
                                  properties,
                                  diff.column_groups_to_lazyload,
                                  false,
-                                 op_ctx);
+                                 op_ctx,
+                                 false,
+                                 &data_scheduler);
             }
             // Replace column group fields
             if (!diff.column_groups_to_replace.empty()) {
@@ -4889,7 +5467,8 @@ ChunkedSegmentSealedImpl::ApplyLoadDiff(milvus::OpContext* op_ctx,
                                  diff.column_groups_to_replace,
                                  true,
                                  op_ctx,
-                                 true);
+                                 true,
+                                 &data_scheduler);
             }
             if (!diff.column_groups_to_lazyreplace.empty()) {
                 LoadColumnGroups(column_groups,
@@ -4897,29 +5476,37 @@ ChunkedSegmentSealedImpl::ApplyLoadDiff(milvus::OpContext* op_ctx,
                                  diff.column_groups_to_lazyreplace,
                                  false,
                                  op_ctx,
-                                 true);
+                                 true,
+                                 &data_scheduler);
             }
         }
     }
 
-    CheckCancellation(op_ctx, id_, "ChunkedSegmentSealedImpl::ApplyLoadDiff()");
-
-    // Initialize LOB paths for TEXT fields after any column group loading
-    if (segment_load_info.HasManifestPath()) {
-        InitTextLobPaths(segment_load_info.GetManifestPath());
-    }
-
-    CheckCancellation(op_ctx, id_, "ChunkedSegmentSealedImpl::ApplyLoadDiff()");
-
     // Load new field binlogs
     if (!diff.binlogs_to_load.empty()) {
-        LoadBatchFieldData(trace_ctx, diff.binlogs_to_load, op_ctx);
+        LoadBatchFieldData(trace_ctx,
+                           diff.binlogs_to_load,
+                           op_ctx,
+                           false,
+                           &data_scheduler);
     }
-    CheckCancellation(op_ctx, id_, "ChunkedSegmentSealedImpl::ApplyLoadDiff()");
 
     // Replace field binlogs
     if (!diff.binlogs_to_replace.empty()) {
-        LoadBatchFieldData(trace_ctx, diff.binlogs_to_replace, op_ctx, true);
+        LoadBatchFieldData(trace_ctx,
+                           diff.binlogs_to_replace,
+                           op_ctx,
+                           true,
+                           &data_scheduler);
+    }
+
+    data_scheduler.Run();
+
+    CheckCancellation(op_ctx, id_, "ChunkedSegmentSealedImpl::ApplyLoadDiff()");
+
+    // Initialize LOB paths for TEXT fields after any column group loading
+    if (segment_load_info.HasManifestPath()) {
+        InitTextLobPaths(segment_load_info.GetManifestPath());
     }
 
     CheckCancellation(op_ctx, id_, "ChunkedSegmentSealedImpl::ApplyLoadDiff()");
@@ -5039,6 +5626,7 @@ ChunkedSegmentSealedImpl::fill_empty_field(const FieldMeta& field_meta) {
     auto column = MakeChunkedColumnBase(data_type, std::move(slot), field_meta);
 
     fields_.wlock()->emplace(field_id, column);
+    default_value_fields_.wlock()->insert(field_id);
     set_bit(field_data_ready_bitset_, field_id, true);
     LOG_INFO(
         "fill empty field {} (data type {}) for growing segment {} "
@@ -5190,6 +5778,7 @@ ChunkedSegmentSealedImpl::LoadManifest(const std::string& manifest_path) {
     auto arrow_schema = schema_->ConvertToArrowSchema();
     reader_ = milvus_storage::api::Reader::create(
         column_groups, arrow_schema, nullptr, *properties);
+    take_planner_.Reset();
 
     std::vector<std::pair<int, std::vector<FieldId>>> cg_field_ids;
     for (int i = 0; i < column_groups->size(); ++i) {
@@ -5254,37 +5843,71 @@ ChunkedSegmentSealedImpl::LoadColumnGroups(
     std::vector<std::pair<int, std::vector<FieldId>>>& cg_field_ids,
     bool eager_load,
     milvus::OpContext* op_ctx,
-    bool is_replace) {
-    auto& pool = ThreadPools::GetThreadPool(milvus::ThreadPoolPriority::MIDDLE);
-    std::vector<std::future<void>> load_group_futures;
+    bool is_replace,
+    SegmentLoadScheduler* scheduler) {
+    std::optional<SegmentLoadScheduler> local_scheduler;
+    if (scheduler == nullptr) {
+        local_scheduler.emplace(
+            id_,
+            "column groups",
+            LoadInflightLimitBytes(),
+            op_ctx ? op_ctx->cancellation_token : folly::CancellationToken());
+        scheduler = &local_scheduler.value();
+    }
+    auto load_info = std::atomic_load(&segment_load_info_);
+    auto num_rows = load_info != nullptr ? load_info->GetNumOfRows() : 0;
     for (const auto& pair : cg_field_ids) {
         auto cg_index = pair.first;
         const auto& field_ids = pair.second;
-        auto future = pool.Submit([this,
-                                   column_groups,
-                                   properties,
-                                   cg_index,
-                                   field_ids,
-                                   eager_load,
-                                   op_ctx,
-                                   is_replace]() {
-            // Early exit if cancelled while queued
-            CheckCancellation(op_ctx,
-                              id_,
-                              cg_index,
-                              "ChunkedSegmentSealedImpl::LoadColumnGroup()");
-            LoadColumnGroup(column_groups,
-                            properties,
-                            cg_index,
-                            field_ids,
-                            eager_load,
-                            op_ctx,
-                            is_replace);
-        });
-        load_group_futures.emplace_back(std::move(future));
+        scheduler->Add(fmt::format("cg_{}", cg_index),
+                       EstimateLoadBytes(field_ids, num_rows),
+                       [this,
+                        column_groups,
+                        properties,
+                        cg_index,
+                        field_ids,
+                        eager_load,
+                        op_ctx,
+                        is_replace]() {
+                           // Early exit if cancelled while queued
+                           CheckCancellation(
+                               op_ctx,
+                               id_,
+                               cg_index,
+                               "ChunkedSegmentSealedImpl::LoadColumnGroup()");
+                           LoadColumnGroup(column_groups,
+                                           properties,
+                                           cg_index,
+                                           field_ids,
+                                           eager_load,
+                                           op_ctx,
+                                           is_replace);
+                       });
     }
 
-    storage::WaitAllFutures(load_group_futures);
+    if (local_scheduler.has_value()) {
+        local_scheduler->Run();
+    }
+}
+
+uint64_t
+ChunkedSegmentSealedImpl::LoadInflightLimitBytes() {
+    return storage::TransientMemoryBudget::GetLoadTransientBudget()
+        .CapacityBytes();
+}
+
+uint64_t
+ChunkedSegmentSealedImpl::EstimateLoadBytes(
+    const std::vector<FieldId>& field_ids, int64_t num_rows) const {
+    uint64_t row_bytes = 0;
+    for (auto field_id : field_ids) {
+        auto& field_meta = schema_->operator[](field_id);
+        // a guess, the schema carries no size of sparse rows
+        row_bytes += IsSparseFloatVectorDataType(field_meta.get_data_type())
+                         ? 512
+                         : field_meta.get_sizeof();
+    }
+    return row_bytes * std::max<int64_t>(num_rows, 0);
 }
 
 void
@@ -5498,10 +6121,11 @@ ChunkedSegmentSealedImpl::LoadBatchIndexes(
         field_id_to_index_info,
     milvus::OpContext* op_ctx,
     bool is_replace) {
-    auto& pool = ThreadPools::GetThreadPool(milvus::ThreadPoolPriority::MIDDLE);
-    std::vector<std::future<void>> load_index_futures;
-    load_index_futures.reserve(field_id_to_index_info.size());
-
+    SegmentLoadScheduler scheduler(
+        id_,
+        "indexes",
+        LoadInflightLimitBytes(),
+        op_ctx ? op_ctx->cancellation_token : folly::CancellationToken());
     for (auto& pair : field_id_to_index_info) {
         auto field_id = pair.first;
         AssertInfo(field_exists_in_schema(schema_, field_id),
@@ -5510,32 +6134,37 @@ ChunkedSegmentSealedImpl::LoadBatchIndexes(
         auto& index_infos = pair.second;
         for (auto& load_index_info : index_infos) {
             auto* load_index_info_ptr = &load_index_info;
-            auto future = pool.Submit([this,
-                                       trace_ctx,
-                                       field_id,
-                                       load_index_info_ptr,
-                                       op_ctx,
-                                       is_replace]() mutable -> void {
-                // Early exit if cancelled while queued
-                CheckCancellation(op_ctx, id_, field_id.get(), "LoadIndex");
+            scheduler.Add(
+                fmt::format("index_{}_{}",
+                            field_id.get(),
+                            load_index_info.index_id),
+                std::max<int64_t>(load_index_info.index_size, 0),
+                [this,
+                 trace_ctx,
+                 field_id,
+                 load_index_info_ptr,
+                 op_ctx,
+                 is_replace]() mutable -> void {
+                    // Early exit if cancelled while queued
+                    CheckCancellation(
+                        op_ctx, id_, field_id.get(), "LoadIndex");
 
-                LOG_INFO("Loading index for segment {} field {} with {} files",
-                         id_,
-                         field_id.get(),
-                         load_index_info_ptr->index_files.size());
+                    LOG_INFO(
+                        "Loading index for segment {} field {} with {} files",
+                        id_,
+                        field_id.get(),
+                        load_index_info_ptr->index_files.size());
 
-                // Download & compose index
-                LoadIndexData(trace_ctx, load_index_info_ptr, op_ctx);
+                    // Download & compose index
+                    LoadIndexData(trace_ctx, load_index_info_ptr, op_ctx);
 
-                // Load index into segment
-                LoadIndex(*load_index_info_ptr, is_replace);
-            });
-
-            load_index_futures.push_back(std::move(future));
+                    // Load index into segment
+                    LoadIndex(*load_index_info_ptr, is_replace);
+                });
         }
     }
 
-    storage::WaitAllFutures(load_index_futures);
+    scheduler.Run();
 }
 
 void
@@ -5544,7 +6173,8 @@ ChunkedSegmentSealedImpl::LoadBatchFieldData(
     std::vector<std::pair<std::vector<FieldId>, proto::segcore::FieldBinlog>>&
         field_binlog_to_load,
     milvus::OpContext* op_ctx,
-    bool is_replace) {
+    bool is_replace,
+    SegmentLoadScheduler* scheduler) {
     LOG_INFO("Loading field binlog for {} fields in segment {}",
              field_binlog_to_load.size(),
              id_);
@@ -5669,15 +6299,28 @@ ChunkedSegmentSealedImpl::LoadBatchFieldData(
         field_data_to_load.emplace_back(group_id, load_field_data_info);
     }
 
-    auto& pool = ThreadPools::GetThreadPool(milvus::ThreadPoolPriority::MIDDLE);
-    std::vector<std::future<void>> load_field_futures;
-    load_field_futures.reserve(field_data_to_load.size());
-
+    std::optional<SegmentLoadScheduler> local_scheduler;
+    if (scheduler == nullptr) {
+        local_scheduler.emplace(
+            id_,
+            "field binlogs",
+            LoadInflightLimitBytes(),
+            op_ctx ? op_ctx->cancellation_token : folly::CancellationToken());
+        scheduler = &local_scheduler.value();
+    }
     for (const auto& [field_id, load_field_data_info] : field_data_to_load) {
         // Create local copies to capture in lambda (C++17 compatible)
         const auto field_data = load_field_data_info;
         const auto captured_field_id = field_id;
-        auto future = pool.Submit(
+        uint64_t memory_size = 0;
+        for (auto& [_, info] : field_data.field_infos) {
+            for (auto size : info.memory_sizes) {
+                memory_size += std::max<int64_t>(size, 0);
+            }
+        }
+        scheduler->Add(
+            fmt::format("binlog_{}", field_id.get()),
+            memory_size,
             [this, field_data, captured_field_id, op_ctx, is_replace]()
                 -> void {
                 // Early exit if cancelled while queued
@@ -5687,11 +6330,11 @@ ChunkedSegmentSealedImpl::LoadBatchFieldData(
                                   "ChunkedSegmentSealedImpl::LoadFieldData()");
                 LoadFieldData(field_data, op_ctx, is_replace);
             });
-
-        load_field_futures.push_back(std::move(future));
     }
 
-    storage::WaitAllFutures(load_field_futures);
+    if (local_scheduler.has_value()) {
+        local_scheduler->Run();
+    }
 }
 
 void
@@ -5716,10 +6359,90 @@ ChunkedSegmentSealedImpl::Load(milvus::tracer::TraceContext& trace_ctx,
     LOG_WARN("Load segment {} with diff {}", id_, diff.ToString());
 
     ApplyLoadDiff(op_ctx, mutable_copy, diff);
+    WarmFromProfile(snapshot->GetCollectionID());
 
     LOG_INFO("Successfully loaded segment {} with {} rows", id_, num_rows);
 }
 
+void
+ChunkedSegmentSealedImpl::RecordWarmupAccess(
+    FieldId field_id, WarmupProfile::Target target) const {
+    auto profile = WarmupProfile::Global();
+    if (profile == nullptr) {
+        return;
+    }
+    auto load_info = std::atomic_load(&segment_load_info_);
+    if (load_info == nullptr) {
+        return;
+    }
+    profile->RecordAccess(load_info->GetCollectionID(), field_id, target);
+}
+
+void
+ChunkedSegmentSealedImpl::WarmFromProfile(int64_t collection_id) {
+    auto profile = WarmupProfile::Global();
+    if (profile == nullptr) {
+        return;
+    }
+    auto hot_targets = profile->GetHotTargets(collection_id);
+    if (hot_targets.empty()) {
+        return;
+    }
+
+    // Resolve the columns and index slots here: the task holds them and never
+    // touches the segment, which may be released before the pool runs it.
+    std::vector<std::function<void()>> warmups;
+    for (auto& entry : hot_targets) {
+        if (entry.target == WarmupProfile::Target::FIELD) {
+            auto column = get_column(entry.field_id);
+            if (column == nullptr || column->num_chunks() == 0) {
+                continue;
+            }
+            warmups.emplace_back([column = std::move(column)]() {
+                std::vector<int64_t> chunk_ids(column->num_chunks());
+                std::iota(chunk_ids.begin(), chunk_ids.end(), 0);
+                column->PrefetchChunks(nullptr, chunk_ids);
+            });
+            continue;
+        }
+        index::CacheIndexBasePtr index = nullptr;
+        if (vector_indexings_.is_ready(entry.field_id)) {
+            index = vector_indexings_.get_field_indexing(entry.field_id)
+                        ->indexing_;
+        } else {
+            scalar_indexings_.withRLock([&](auto& indexings) {
+                auto it = indexings.find(entry.field_id);
+                if (it != indexings.end()) {
+                    index = it->second;
+                }
+            });
+        }
+        if (index != nullptr) {
+            warmups.emplace_back([index = std::move(index)]() {
+                SemiInlineGet(index->PinCells(nullptr, {0}));
+            });
+        }
+    }
+    if (warmups.empty()) {
+        return;
+    }
+    LOG_INFO("Warming {} targets of segment {} from the warmup profile",
+             warmups.size(),
+             id_);
+    auto& pool = ThreadPools::GetThreadPool(milvus::ThreadPoolPriority::LOW);
+    pool.Submit([segment_id = id_, warmups = std::move(warmups)]() {
+        for (auto& warmup : warmups) {
+            try {
+                warmup();
+            } catch (std::exception& e) {
+                LOG_WARN("Failed to warm segment {} from the profile: {}",
+                         segment_id,
+                         e.what());
+            }
+        }
+    });
+}
+
 void
 ChunkedSegmentSealedImpl::FillTargetEntry(const query::Plan* plan,
                                           SearchResult& results,
@@ -5746,6 +6469,21 @@ ChunkedSegmentSealedImpl::FillTargetEntry(const query::Plan* plan,
         local_ctx.cancellation_token = op_ctx->cancellation_token;
         local_ctx.runtime_load_priority = op_ctx->runtime_load_priority;
     }
+
+    // Load the cells of all remaining output fields at once rather than
+    // one field after another inside bulk_subscript.
+    std::vector<FieldId> fields_to_fill;
+    for (auto field_id : plan->target_entries_) {
+        if (!used_take || results.output_fields_data_.count(field_id) == 0) {
+            fields_to_fill.push_back(field_id);
+        }
+    }
+    if (fields_to_fill.size() > 1) {
+        PrefetchOutputFields(
+            &local_ctx, fields_to_fill, results.seg_offsets_.data(), size)
+            .get();
+    }
+
     for (auto field_id : plan->target_entries_) {
         // Skip fields already filled by take
         if (used_take && results.output_fields_data_.count(field_id) > 0) {
@@ -6224,7 +6962,30 @@ ChunkedSegmentSealedImpl::ExecuteTake(
         return nullptr;
     }
     auto take_start = std::chrono::high_resolution_clock::now();
-    auto result = reader_->take(unique_offsets, 1, needed_columns);
+    // External segments are usually taken at scattered offsets for the
+    // output of a search, which reader_->take() serves row by row. The
+    // planner reads the row groups holding them in coalesced runs instead
+    // and keeps them briefly for the takes that follow.
+    arrow::Result<std::shared_ptr<arrow::Table>> result =
+        arrow::Status::NotImplemented("take planner is for external segments");
+    if (schema_->is_external_collection() && needed_columns &&
+        !needed_columns->empty()) {
+        result = take_planner_.Take(*reader_,
+                                    unique_offsets,
+                                    *needed_columns,
+                                    ExternalTakePlanner::kReadParallelism);
+        if (!result.ok() && !result.status().IsNotImplemented()) {
+            LOG_WARN(
+                "[TakeAPI] {} planned take failed for segment {}, fall back "
+                "to take(): {}",
+                caller_tag,
+                id_,
+                result.status().ToString());
+        }
+    }
+    if (!result.ok()) {
+        result = reader_->take(unique_offsets, 1, needed_columns);
+    }
     elapsed_ms = std::chrono::duration<double, std::milli>(
                      std::chrono::high_resolution_clock::now() - take_start)
                      .count();
@@ -75,12 +75,18 @@
 #include "pb/plan.pb.h"
 #include "pb/segcore.pb.h"
 #include "query/PlanImpl.h"
+#include "query/VectorChunkBound.h"
+#include "segcore/EntityTTLIndex.h"
+#include "segcore/ExternalTakePlanner.h"
 #include "segcore/IndexConfigGenerator.h"
+#include "segcore/MvccMaskCache.h"
 #include "segcore/InsertRecord.h"
 #include "segcore/SegcoreConfig.h"
 #include "segcore/SegmentInterface.h"
+#include "segcore/SegmentLoadScheduler.h"
 #include "segcore/SegmentLoadInfo.h"
 #include "segcore/Types.h"
+#include "segcore/WarmupProfile.h"
 #include "storage/MmapChunkManager.h"
 #include "segcore/TextColumnCache.h"
 
@@ -156,6 +162,7 @@ class ChunkedSegmentSealedImpl : public SegmentSealed {
         if (iter == scalar_indexings->end()) {
             return {};
         }
+        RecordWarmupAccess(field_id, WarmupProfile::Target::INDEX);
         auto ca = SemiInlineGet(iter->second->PinCells(op_ctx, {0}));
         auto index = ca->get_cell_of(0);
         return {PinWrapper<const index::IndexBase*>(std::move(ca), index)};
@@ -359,6 +366,23 @@ class ChunkedSegmentSealedImpl : public SegmentSealed {
         return insert_record_.timestamp_index_.get_max_timestamp();
     }
 
+    bool
+    is_search_result_cacheable(Timestamp timestamp) const override {
+        auto max_insert_ts = get_max_timestamp();
+        // unknown insert timestamps, can't prove full visibility
+        if (max_insert_ts == 0) {
+            return false;
+        }
+        return timestamp >= max_insert_ts &&
+               timestamp >= deleted_record_.max_timestamp() &&
+               timestamp >= GetCommitTimestamp();
+    }
+
+    int64_t
+    get_delete_version() const override {
+        return deleted_record_.size();
+    }
+
     const Schema&
     get_schema() const override;
 
@@ -417,6 +441,16 @@ class ChunkedSegmentSealedImpl : public SegmentSealed {
         const std::function<void(const SegOffset offset, const Timestamp ts)>&
             callback) const;
 
+    // Calls `callback(i, offset)` for every row whose pk equals pks[i], on
+    // the calling thread. Pks the segment's pk filter rejects are dropped
+    // first. Large batches are sorted once and resolved in pk ranges on idle
+    // load threads: by a galloping merge-join against the column when the
+    // segment is sorted by pk, by sorted probes into the pk index otherwise.
+    void
+    search_pks_batch(
+        const std::vector<PkType>& pks,
+        const std::function<void(size_t idx, int64_t offset)>& callback) const;
+
  public:
     // Non-virtual helper called via dynamic_cast from SegmentInterface.
     // Must be public for cross-class access.
@@ -498,6 +532,27 @@ class ChunkedSegmentSealedImpl : public SegmentSealed {
                     FieldId field_id,
                     const std::vector<int64_t>& chunk_ids) const override;
 
+    // Loads on the MIDDLE pool. Chunks beyond half of the load transient
+    // budget are dropped from the prefetch, so a scan's readahead never
+    // starves the loads it races with.
+    std::future<void>
+    prefetch_chunks_async(
+        milvus::OpContext* op_ctx,
+        FieldId field_id,
+        const std::vector<int64_t>& chunk_ids) const override;
+
+    // Starts loading every cell `field_ids` need to serve `offsets`, one
+    // task per column on the MIDDLE pool so cold cells of different fields
+    // load concurrently, and returns a future that is ready once all of them
+    // are resident. Fields without a loaded column are skipped, offsets out
+    // of range are ignored. op_ctx must outlive the returned future.
+    // Not virtual on purpose, see FillTargetEntry.
+    std::future<void>
+    PrefetchOutputFields(milvus::OpContext* op_ctx,
+                         const std::vector<FieldId>& field_ids,
+                         const int64_t* offsets,
+                         int64_t count) const;
+
     void
     ApplyFieldValidData(milvus::OpContext* op_ctx,
                         FieldId field_id,
@@ -513,6 +568,12 @@ class ChunkedSegmentSealedImpl : public SegmentSealed {
                                  int64_t count,
                                  TargetBitmapView valid_result) const override;
 
+    PinWrapper<ChunkSpans>
+    chunk_spans(milvus::OpContext* op_ctx,
+                FieldId field_id,
+                const int64_t* offsets,
+                int64_t count) const override;
+
  protected:
     // blob and row_count
     PinWrapper<SpanBase>
@@ -541,6 +602,21 @@ class ChunkedSegmentSealedImpl : public SegmentSealed {
         int64_t chunk_id,
         std::optional<std::pair<int64_t, int64_t>> offset_len) const override;
 
+    PinWrapper<const StringChunk*>
+    dict_string_chunk(milvus::OpContext* op_ctx,
+                      FieldId field_id,
+                      int64_t chunk_id) const override;
+
+    PinWrapper<const FixedWidthChunk*>
+    packed_int_chunk(milvus::OpContext* op_ctx,
+                     FieldId field_id,
+                     int64_t chunk_id) const override;
+
+    PinWrapper<const Chunk*>
+    constant_chunk(milvus::OpContext* op_ctx,
+                   FieldId field_id,
+                   int64_t chunk_id) const override;
+
     PinWrapper<std::pair<std::vector<std::string_view>, FixedVector<bool>>>
     chunk_string_views_by_offsets(
         milvus::OpContext* op_ctx,
@@ -827,6 +903,28 @@ class ChunkedSegmentSealedImpl : public SegmentSealed {
         return pk_column->GetNumRowsUntilChunk(chunk_id) + in_chunk_offset;
     }
 
+    // Bloom filter over the segment's pks: the one in the pinned storage v2
+    // pk index cell, else the one storage v1 built in insert_record_.
+    const SplitBlockBloomFilter*
+    get_pk_filter(const storagev2translator::PkIndexCell* pk_cell) const {
+        return pk_cell != nullptr ? pk_cell->pk_filter()
+                                  : insert_record_.pk_filter();
+    }
+
+    // search_pks_batch() once the pk filter has run
+    void
+    search_candidate_pks_batch(
+        const std::vector<PkType>& pks,
+        const storagev2translator::PkIndexCell* pk_cell,
+        const std::function<void(size_t idx, int64_t offset)>& callback) const;
+
+    template <typename PK>
+    void
+    search_sorted_pks_batch_impl(
+        const std::vector<PkType>& pks,
+        const std::shared_ptr<ChunkedColumnInterface>& pk_column,
+        const std::function<void(size_t idx, int64_t offset)>& callback) const;
+
     template <typename PK>
     void
     search_pks_with_two_pointers_impl(
@@ -1190,6 +1288,22 @@ class ChunkedSegmentSealedImpl : public SegmentSealed {
                          Timestamp timestamp,
                          Timestamp collection_ttl) const override;
 
+    std::shared_ptr<const TargetBitmap>
+    EntityTTLAliveRows(milvus::OpContext* op_ctx,
+                       int64_t physical_us) const override;
+
+    bool
+    IsFieldSorted(milvus::OpContext* op_ctx, FieldId field_id) const override;
+
+    std::optional<std::vector<int64_t>>
+    VisiblePkOffsets(const std::vector<PkType>& pks,
+                     Timestamp timestamp) const override;
+
+    std::shared_ptr<const TargetBitmap>
+    SharedMvccMask(int64_t active_count,
+                   Timestamp timestamp,
+                   Timestamp collection_ttl) const override;
+
     void
     vector_search(SearchInfo& search_info,
                   const void* query_data,
@@ -1272,7 +1386,8 @@ class ChunkedSegmentSealedImpl : public SegmentSealed {
                                              proto::segcore::FieldBinlog>>&
                            field_binlog_to_load,
                        milvus::OpContext* op_ctx = nullptr,
-                       bool is_replace = false);
+                       bool is_replace = false,
+                       SegmentLoadScheduler* scheduler = nullptr);
 
     /**
      * @brief Initialize LOB base paths for TEXT fields
@@ -1292,7 +1407,18 @@ class ChunkedSegmentSealedImpl : public SegmentSealed {
         std::vector<std::pair<int, std::vector<FieldId>>>& cg_field_ids,
         bool eager_load,
         milvus::OpContext* op_ctx = nullptr,
-        bool is_replace = false);
+        bool is_replace = false,
+        SegmentLoadScheduler* scheduler = nullptr);
+
+    // Bytes the load tasks of one stage may have in flight together, the
+    // transient load budget; 0 means no limit.
+    static uint64_t
+    LoadInflightLimitBytes();
+
+    // Rough memory size of `num_rows` rows of `field_ids`, from the schema.
+    uint64_t
+    EstimateLoadBytes(const std::vector<FieldId>& field_ids,
+                      int64_t num_rows) const;
 
     // Load column groups from a manifest file path (for external collections)
     void
@@ -1395,6 +1521,23 @@ class ChunkedSegmentSealedImpl : public SegmentSealed {
         milvus::OpContext* op_ctx = nullptr,
         bool is_replace = false);
 
+    // Counts an access to `field_id` in the warmup profile of the
+    // collection, if the profile is enabled.
+    void
+    RecordWarmupAccess(FieldId field_id, WarmupProfile::Target target) const;
+
+    // Warms what the warmup profile of `collection_id` recorded, hottest
+    // first, on the LOW priority pool.
+    void
+    WarmFromProfile(int64_t collection_id);
+
+    // the chunk bounds of the vector field searched without an index,
+    // reset whenever the field is loaded into a new column
+    std::shared_ptr<query::VectorChunkBounds>
+    GetVectorChunkBounds(
+        FieldId field_id,
+        const std::shared_ptr<ChunkedColumnInterface>& column) const;
+
     std::shared_ptr<ChunkedColumnInterface>
     get_column(FieldId field_id) const {
         std::shared_ptr<ChunkedColumnInterface> res;
@@ -1438,6 +1581,7 @@ class ChunkedSegmentSealedImpl : public SegmentSealed {
     void
     SetReaderForTesting(std::unique_ptr<milvus_storage::api::Reader> r) {
         reader_ = std::move(r);
+        take_planner_.Reset();
     }
 
     // Wrappers for protected methods to enable direct unit testing.
@@ -1508,6 +1652,9 @@ class ChunkedSegmentSealedImpl : public SegmentSealed {
     // fields that has ngram index
     folly::Synchronized<std::unordered_set<FieldId>> ngram_fields_;
 
+    // fields filled with their default value, whose chunks are constant
+    folly::Synchronized<std::unordered_set<FieldId>> default_value_fields_;
+
     // scalar field index
     folly::Synchronized<std::unordered_map<FieldId, index::CacheIndexBasePtr>>
         scalar_indexings_;
@@ -1553,6 +1700,32 @@ class ChunkedSegmentSealedImpl : public SegmentSealed {
         fields_;
     std::unordered_set<FieldId> mmap_field_ids_;
 
+    struct VectorChunkBoundsEntry {
+        // the column the bounds were computed from
+        std::weak_ptr<ChunkedColumnInterface> column;
+        std::shared_ptr<query::VectorChunkBounds> bounds;
+    };
+    mutable folly::Synchronized<
+        std::unordered_map<FieldId, VectorChunkBoundsEntry>>
+        vector_chunk_bounds_;
+
+    struct EntityTTLIndexEntry {
+        // the ttl field column the index was built from
+        std::weak_ptr<ChunkedColumnInterface> column;
+        std::shared_ptr<EntityTTLIndex> index;
+    };
+    mutable folly::Synchronized<EntityTTLIndexEntry> entity_ttl_index_;
+
+    struct FieldSortedEntry {
+        // the column the order was checked on
+        std::weak_ptr<ChunkedColumnInterface> column;
+        bool sorted = false;
+    };
+    mutable folly::Synchronized<std::unordered_map<FieldId, FieldSortedEntry>>
+        field_sorted_;
+
+    mutable MvccMaskCache mvcc_mask_cache_;
+
     // only useful in binlog
     IndexMetaPtr col_index_meta_;
     SegcoreConfig segcore_config_;
@@ -1577,6 +1750,9 @@ class ChunkedSegmentSealedImpl : public SegmentSealed {
     // retrieve/search workers can hit the same segment at the same time.
     std::unique_ptr<milvus_storage::api::Reader> reader_;
     mutable std::mutex reader_mutex_;
+    // row group takes of external segments from reader_, guarded by
+    // reader_mutex_ and reset whenever reader_ is replaced
+    mutable ExternalTakePlanner take_planner_;
 
     // ArrayOffsetsSealed for element-level filtering on array fields
     // field_id -> ArrayOffsetsSealed mapping
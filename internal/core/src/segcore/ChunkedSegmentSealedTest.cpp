@@ -22,6 +22,7 @@
 #include <memory>
 #include <numeric>
 #include <optional>
+#include <random>
 #include <set>
 #include <string>
 #include <unordered_map>
@@ -38,6 +39,7 @@
 #include "cachinglayer/Translator.h"
 #include "common/BitsetView.h"
 #include "common/Chunk.h"
+#include "common/Common.h"
 #include "common/Consts.h"
 #include "common/FieldData.h"
 #include "common/FieldDataInterface.h"
@@ -66,6 +68,7 @@
 #include "query/ExecPlanNodeVisitor.h"
 #include "query/SearchOnSealed.h"
 #include "segcore/ChunkedSegmentSealedImpl.h"
+#include "segcore/SearchIteratorRegistry.h"
 #include "segcore/SegcoreConfig.h"
 #include "segcore/SegmentSealed.h"
 #include "segcore/Types.h"
@@ -158,6 +161,7 @@ TEST(test_chunk_segment, TestSearchOnSealed) {
     milvus::OpContext op_context;
     query::SearchOnSealedColumn(*schema,
                                 column.get(),
+                                kSegmentID,
                                 search_info,
                                 index_info,
                                 query_data,
@@ -185,6 +189,7 @@ TEST(test_chunk_segment, TestSearchOnSealed) {
     std::fill(bitset_data, bitset_data + bitset_size, 0);
     query::SearchOnSealedColumn(*schema,
                                 column.get(),
+                                kSegmentID,
                                 search_info,
                                 index_info,
                                 query_data,
@@ -211,6 +216,310 @@ TEST(test_chunk_segment, TestSearchOnSealed) {
     }
 }
 
+TEST(test_chunk_segment, SearchOnSealedColumnSkipsDistantChunks) {
+    int dim = 16;
+    int chunk_num = 4;
+    int chunk_size = 100;
+    int total_row_count = chunk_num * chunk_size;
+    int nq = 2;
+
+    DeferRelease defer;
+    std::default_random_engine rng(42);
+    std::normal_distribution<float> noise(0, 0.1);
+
+    auto schema = std::make_shared<Schema>();
+    auto fakevec_id = schema->AddDebugField(
+        "fakevec", DataType::VECTOR_FLOAT, dim, knowhere::metric::L2);
+    auto field_meta = schema->operator[](fakevec_id);
+
+    // every chunk is a cluster pointing along its own axis, as after
+    // clustering compaction
+    std::vector<std::unique_ptr<Chunk>> chunks;
+    std::vector<int64_t> num_rows_per_chunk;
+    for (int i = 0; i < chunk_num; i++) {
+        num_rows_per_chunk.push_back(chunk_size);
+        auto buf_size = 4 * chunk_size * dim;
+        char* buf = new char[buf_size];
+        defer.AddDefer([buf]() { delete[] buf; });
+        auto vecs = reinterpret_cast<float*>(buf);
+        for (int j = 0; j < chunk_size * dim; j++) {
+            vecs[j] = noise(rng) + (j % dim == i ? 10 : 0);
+        }
+        auto chunk_mmap_guard =
+            std::make_shared<ChunkMmapGuard>(nullptr, 0, "");
+        chunks.emplace_back(std::make_unique<FixedWidthChunk>(
+            chunk_size, dim, buf, buf_size, 4, false, chunk_mmap_guard));
+    }
+    auto translator = std::make_unique<TestChunkTranslator>(
+        num_rows_per_chunk, "", std::move(chunks));
+    auto slot =
+        cachinglayer::Manager::GetInstance().CreateCacheSlot<milvus::Chunk>(
+            std::move(translator), nullptr);
+    auto column = std::make_shared<ChunkedColumn>(std::move(slot), field_meta);
+
+    // one query next to the first cluster, one between the last two
+    std::vector<float> query_data(nq * dim);
+    for (int j = 0; j < nq * dim; j++) {
+        query_data[j] = noise(rng);
+    }
+    query_data[0] += 10;
+    query_data[dim + 2] += 5;
+    query_data[dim + 3] += 5;
+
+    std::vector<uint8_t> bitset_data((total_row_count + 7) / 8, 0);
+    BitsetView bv(bitset_data.data(), total_row_count);
+    auto index_info = std::map<std::string, std::string>{};
+    milvus::OpContext op_context;
+
+    for (const auto& metric : {knowhere::metric::L2,
+                               knowhere::metric::IP,
+                               knowhere::metric::COSINE}) {
+        SearchInfo search_info;
+        search_info.search_params_ =
+            knowhere::Json{{knowhere::meta::METRIC_TYPE, metric}};
+        search_info.field_id_ = fakevec_id;
+        search_info.metric_type_ = metric;
+        search_info.topk_ = 10;
+        search_info.round_decimal_ = -1;
+
+        auto search = [&](query::VectorChunkBounds* bounds) {
+            SearchResult result;
+            query::SearchOnSealedColumn(*schema,
+                                        column.get(),
+                                        kSegmentID,
+                                        search_info,
+                                        index_info,
+                                        query_data.data(),
+                                        nullptr,
+                                        nq,
+                                        total_row_count,
+                                        bv,
+                                        &op_context,
+                                        result,
+                                        bounds);
+            return result;
+        };
+        auto expected = search(nullptr);
+        query::VectorChunkBounds bounds;
+        // the second search reuses the bounds of the first
+        for (int round = 0; round < 2; round++) {
+            auto result = search(&bounds);
+            EXPECT_EQ(result.seg_offsets_, expected.seg_offsets_) << metric;
+            EXPECT_EQ(result.distances_, expected.distances_) << metric;
+        }
+        EXPECT_EQ(
+            bounds.Get([]() { return std::vector<query::VectorChunkBound>{}; })
+                .size(),
+            chunk_num);
+    }
+}
+
+TEST(test_chunk_segment, SearchOnSealedColumnGathersSelectiveFilter) {
+    int dim = 16;
+    int chunk_num = 3;
+    int chunk_size = 100;
+    int total_row_count = chunk_num * chunk_size;
+
+    DeferRelease defer;
+
+    auto schema = std::make_shared<Schema>();
+    auto fakevec_id = schema->AddDebugField(
+        "fakevec", DataType::VECTOR_FLOAT, dim, knowhere::metric::L2);
+    auto field_meta = schema->operator[](fakevec_id);
+
+    std::vector<float> all_rows;
+    std::vector<std::unique_ptr<Chunk>> chunks;
+    std::vector<int64_t> num_rows_per_chunk;
+    for (int i = 0; i < chunk_num; i++) {
+        num_rows_per_chunk.push_back(chunk_size);
+        auto dataset = segcore::DataGen(schema, chunk_size, 42 + i);
+        auto data = dataset.get_col<float>(fakevec_id);
+        all_rows.insert(all_rows.end(), data.begin(), data.end());
+        auto buf_size = 4 * data.size();
+
+        char* buf = new char[buf_size];
+        defer.AddDefer([buf]() { delete[] buf; });
+        memcpy(buf, data.data(), buf_size);
+
+        auto chunk_mmap_guard =
+            std::make_shared<ChunkMmapGuard>(nullptr, 0, "");
+        chunks.emplace_back(std::make_unique<FixedWidthChunk>(
+            chunk_size, dim, buf, buf_size, 4, false, chunk_mmap_guard));
+    }
+
+    auto translator = std::make_unique<TestChunkTranslator>(
+        num_rows_per_chunk, "", std::move(chunks));
+    auto slot =
+        cachinglayer::Manager::GetInstance().CreateCacheSlot<milvus::Chunk>(
+            std::move(translator), nullptr);
+    auto column = std::make_shared<ChunkedColumn>(std::move(slot), field_meta);
+
+    SearchInfo search_info;
+    search_info.search_params_ = knowhere::Json{
+        {knowhere::meta::METRIC_TYPE, knowhere::metric::L2},
+    };
+    search_info.field_id_ = fakevec_id;
+    search_info.metric_type_ = knowhere::metric::L2;
+    search_info.topk_ = 8;
+    search_info.round_decimal_ = -1;
+
+    // 12 rows spread over all chunks pass, few enough to be gathered
+    std::vector<int64_t> allowed = {
+        0, 7, 99, 100, 101, 150, 198, 199, 200, 250, 298, 299};
+    TargetBitmap bitset(total_row_count, true);
+    for (auto offset : allowed) {
+        bitset[offset] = false;
+    }
+    BitsetView bv(bitset);
+
+    auto query_ds = segcore::DataGen(schema, 2, 7);
+    auto query_data = query_ds.get_col<float>(fakevec_id);
+    auto index_info = std::map<std::string, std::string>{};
+    SearchResult search_result;
+    milvus::OpContext op_context;
+    query::SearchOnSealedColumn(*schema,
+                                column.get(),
+                                kSegmentID,
+                                search_info,
+                                index_info,
+                                query_data.data(),
+                                nullptr,
+                                2,
+                                total_row_count,
+                                bv,
+                                &op_context,
+                                search_result);
+
+    ASSERT_EQ(search_result.seg_offsets_.size(), 2 * search_info.topk_);
+    for (int q = 0; q < 2; ++q) {
+        std::vector<std::pair<float, int64_t>> expected;
+        for (auto offset : allowed) {
+            float dist = 0;
+            for (int d = 0; d < dim; ++d) {
+                auto diff =
+                    query_data[q * dim + d] - all_rows[offset * dim + d];
+                dist += diff * diff;
+            }
+            expected.emplace_back(dist, offset);
+        }
+        std::sort(expected.begin(), expected.end());
+        for (int k = 0; k < search_info.topk_; ++k) {
+            auto i = q * search_info.topk_ + k;
+            EXPECT_EQ(search_result.seg_offsets_[i], expected[k].second);
+            EXPECT_NEAR(search_result.distances_[i], expected[k].first, 1e-3);
+        }
+    }
+}
+
+TEST(test_chunk_segment, SearchIteratorPagesResumeFromRegistry) {
+    int dim = 16;
+    int chunk_num = 3;
+    int chunk_size = 100;
+    int total_row_count = chunk_num * chunk_size;
+    uint32_t batch_size = 10;
+
+    DeferRelease defer;
+
+    auto schema = std::make_shared<Schema>();
+    auto fakevec_id = schema->AddDebugField(
+        "fakevec", DataType::VECTOR_FLOAT, dim, knowhere::metric::L2);
+    auto field_meta = schema->operator[](fakevec_id);
+
+    std::vector<std::unique_ptr<Chunk>> chunks;
+    std::vector<int64_t> num_rows_per_chunk;
+    for (int i = 0; i < chunk_num; i++) {
+        num_rows_per_chunk.push_back(chunk_size);
+        auto dataset = segcore::DataGen(schema, chunk_size, 42 + i);
+        auto data = dataset.get_col<float>(fakevec_id);
+        auto buf_size = 4 * data.size();
+
+        char* buf = new char[buf_size];
+        defer.AddDefer([buf]() { delete[] buf; });
+        memcpy(buf, data.data(), buf_size);
+
+        auto chunk_mmap_guard =
+            std::make_shared<ChunkMmapGuard>(nullptr, 0, "");
+        chunks.emplace_back(std::make_unique<FixedWidthChunk>(
+            chunk_size, dim, buf, buf_size, 4, false, chunk_mmap_guard));
+    }
+
+    auto translator = std::make_unique<TestChunkTranslator>(
+        num_rows_per_chunk, "", std::move(chunks));
+    auto slot =
+        cachinglayer::Manager::GetInstance().CreateCacheSlot<milvus::Chunk>(
+            std::move(translator), nullptr);
+    auto column = std::make_shared<ChunkedColumn>(std::move(slot), field_meta);
+
+    auto query_ds = segcore::DataGen(schema, 1, 7);
+    auto query_data = query_ds.get_col<float>(fakevec_id);
+    auto index_info = std::map<std::string, std::string>{};
+    milvus::OpContext op_context;
+
+    auto run_pages = [&](int num_pages) {
+        std::vector<int64_t> offsets;
+        std::optional<float> last_bound;
+        for (int page = 0; page < num_pages; ++page) {
+            SearchInfo search_info;
+            search_info.search_params_ = knowhere::Json{
+                {knowhere::meta::METRIC_TYPE, knowhere::metric::L2},
+            };
+            search_info.field_id_ = fakevec_id;
+            search_info.metric_type_ = knowhere::metric::L2;
+            search_info.topk_ = batch_size;
+            search_info.round_decimal_ = -1;
+            search_info.iterator_v2_info_ =
+                SearchIteratorV2Info{"token", batch_size, last_bound};
+
+            // the query buffer of each page is its own
+            auto page_query = query_data;
+            SearchResult search_result;
+            query::SearchOnSealedColumn(*schema,
+                                        column.get(),
+                                        kSegmentID,
+                                        search_info,
+                                        index_info,
+                                        page_query.data(),
+                                        nullptr,
+                                        1,
+                                        total_row_count,
+                                        BitsetView{},
+                                        &op_context,
+                                        search_result);
+            EXPECT_EQ(search_result.seg_offsets_.size(), batch_size);
+            offsets.insert(offsets.end(),
+                           search_result.seg_offsets_.begin(),
+                           search_result.seg_offsets_.end());
+            last_bound = search_result.distances_.back();
+        }
+        return offsets;
+    };
+
+    auto& registry = segcore::SearchIteratorRegistry::Instance();
+    auto rebuilt = run_pages(5);
+
+    segcore::SearchIteratorRegistry::SetEnabled(true);
+    registry.Configure(64 << 20, 60 * 1000);
+    auto resumed = run_pages(5);
+    EXPECT_EQ(resumed, rebuilt);
+    EXPECT_EQ(std::set<int64_t>(resumed.begin(), resumed.end()).size(),
+              resumed.size());
+    EXPECT_EQ(registry.GetEntryCount(), 1);
+    EXPECT_GT(registry.GetCurrentBytes(), 0);
+
+    EXPECT_EQ(registry.EraseSegment(kSegmentID), 1);
+    EXPECT_EQ(registry.GetEntryCount(), 0);
+    EXPECT_EQ(registry.GetCurrentBytes(), 0);
+
+    // an entry larger than the budget is not kept
+    registry.Configure(16, 60 * 1000);
+    EXPECT_EQ(run_pages(2), std::vector<int64_t>(rebuilt.begin(),
+                                                 rebuilt.begin() + 20));
+    EXPECT_EQ(registry.GetEntryCount(), 0);
+
+    registry.Clear();
+    segcore::SearchIteratorRegistry::SetEnabled(false);
+}
+
 TEST(test_chunk_segment, ReopenSkipsFunctionOutputFieldWithoutData) {
     auto old_schema = std::make_shared<Schema>();
     old_schema->set_schema_version(1);
@@ -367,6 +676,7 @@ TEST(test_chunk_segment, SearchOnSealedColumnBruteForceUsesOriginalTopk) {
     milvus::OpContext op_context;
     query::SearchOnSealedColumn(*schema,
                                 column.get(),
+                                kSegmentID,
                                 search_info,
                                 index_info,
                                 query_data,
@@ -476,6 +786,7 @@ TEST(test_chunk_segment, TestSearchOnSealedWithAllNullVectors) {
     // This should NOT crash and should return empty results
     query::SearchOnSealedColumn(*schema,
                                 column.get(),
+                                kSegmentID,
                                 search_info,
                                 index_info,
                                 query_data.data(),
@@ -578,6 +889,7 @@ TEST(test_chunk_segment, TestSearchIteratorOnSealedWithAllNullVectors) {
     // This should NOT crash - search iterator with all null vectors
     query::SearchOnSealedColumn(*schema,
                                 column.get(),
+                                kSegmentID,
                                 search_info,
                                 index_info,
                                 query_data.data(),
@@ -718,6 +1030,7 @@ TEST(test_chunk_segment, TestSearchIteratorOnSealedWithPartialNullVectors) {
     // Fix 2: TransformOffset converts physical -> logical offsets
     query::SearchOnSealedColumn(*schema,
                                 column.get(),
+                                kSegmentID,
                                 search_info,
                                 index_info,
                                 query_data.data(),
@@ -755,6 +1068,7 @@ TEST(test_chunk_segment, TestSearchIteratorOnSealedWithPartialNullVectors) {
     SearchResult bf_result;
     query::SearchOnSealedColumn(*schema,
                                 column.get(),
+                                kSegmentID,
                                 search_info_bf,
                                 index_info,
                                 query_data.data(),
@@ -899,6 +1213,32 @@ TEST_P(TestChunkSegment, TestSkipNextTermExpr) {
     }
 }
 
+TEST_P(TestChunkSegment, TestScanPrefetchWindow) {
+    EXEC_EVAL_EXPR_BATCH_SIZE.store(4096);
+    SCAN_PREFETCH_WINDOW.store(1);
+
+    auto int64_fid = fields.at("int64");
+    auto future = segment->prefetch_chunks_async(nullptr, int64_fid, {1});
+    ASSERT_TRUE(future.valid());
+    future.get();
+
+    // the scan crosses both chunks in several batches, reading ahead
+    proto::plan::GenericValue v;
+    v.set_int64_val(5000);
+    auto expr = std::make_shared<expr::UnaryRangeFilterExpr>(
+        expr::ColumnInfo(int64_fid, DataType::INT64),
+        proto::plan::OpType::GreaterEqual,
+        v);
+    auto plan =
+        std::make_shared<plan::FilterBitsNode>(DEFAULT_PLANNODE_ID, expr);
+    auto final = query::ExecuteQueryExpr(
+        plan, segment.get(), chunk_num * test_data_count, MAX_TIMESTAMP);
+    EXPECT_EQ(final.count(), chunk_num * test_data_count - 5000);
+
+    SCAN_PREFETCH_WINDOW.store(DEFAULT_SCAN_PREFETCH_WINDOW);
+    EXEC_EVAL_EXPR_BATCH_SIZE.store(DEFAULT_EXEC_EVAL_EXPR_BATCH_SIZE);
+}
+
 TEST_P(TestChunkSegment, TestTermExpr) {
     bool pk_is_string = GetParam();
     // query int64 expr
@@ -1343,3 +1683,114 @@ TEST(TestTTLFieldFilter, TestMaskWithNullableTTLField) {
 
     EXPECT_EQ(expired_count, test_data_count / 4);
 }
+
+TEST(Sealed, LoadDeletedRecordBatch) {
+    using namespace milvus::segcore;
+
+    auto schema = std::make_shared<Schema>();
+    auto pk_fid = schema->AddDebugField("pk", DataType::INT64);
+    schema->AddDebugField("counter", DataType::INT64);
+    schema->set_primary_field_id(pk_fid);
+
+    // every pk appears twice, so the sorted pk column is 0,0,1,1,...
+    constexpr int64_t N = 50000;
+    auto dataset = DataGen(schema, N, 42, 0, 2);
+
+    // more deletes than a single lookup morsel, unsorted, with duplicates
+    // and pks that don't exist in the segment
+    std::vector<int64_t> pks;
+    for (int64_t pk = 0; pk < N / 2; ++pk) {
+        if (pk % 3 != 0) {
+            pks.push_back(pk);
+        }
+    }
+    for (int64_t pk = 0; pk < 1000; ++pk) {
+        pks.push_back(pk * 7 % (N / 2));
+        pks.push_back(N + pk);
+    }
+    std::shuffle(pks.begin(), pks.end(), std::default_random_engine(42));
+    auto ids = std::make_unique<IdArray>();
+    ids->mutable_int_id()->mutable_data()->Add(pks.begin(), pks.end());
+    std::vector<Timestamp> timestamps(pks.size(), N * 2);
+
+    std::vector<bool> deleted(N / 2, false);
+    for (auto pk : pks) {
+        if (pk < N / 2) {
+            deleted[pk] = true;
+        }
+    }
+    auto expected_count = 2 * std::count(deleted.begin(), deleted.end(), true);
+
+    for (bool is_sorted_by_pk : {false, true}) {
+        auto segment = CreateSealedSegment(schema,
+                                           empty_index_meta,
+                                           0,
+                                           SegcoreConfig::default_config(),
+                                           is_sorted_by_pk);
+        LoadGeneratedDataIntoSegment(dataset, segment.get());
+
+        LoadDeletedRecordInfo info = {timestamps.data(),
+                                      ids.get(),
+                                      static_cast<int64_t>(pks.size())};
+        segment->LoadDeletedRecord(info);
+        ASSERT_EQ(segment->get_deleted_count(), expected_count)
+            << "sorted " << is_sorted_by_pk;
+
+        BitsetType bitset(N);
+        BitsetTypeView view(bitset);
+        segment->mask_with_delete(view, N, N * 2);
+        for (int64_t i = 0; i < N; ++i) {
+            ASSERT_EQ(bitset[i], deleted[i / 2])
+                << "row " << i << " sorted " << is_sorted_by_pk;
+        }
+    }
+}
+
+TEST(Sealed, ContainWithPkFilter) {
+    using namespace milvus::segcore;
+
+    for (auto pk_type : {DataType::INT64, DataType::VARCHAR}) {
+        auto schema = std::make_shared<Schema>();
+        auto pk_fid = schema->AddDebugField("pk", pk_type);
+        schema->AddDebugField("counter", DataType::INT64);
+        schema->set_primary_field_id(pk_fid);
+
+        constexpr int64_t N = 10000;
+        auto dataset = DataGen(schema, N);
+        std::vector<PkType> present;
+        std::vector<PkType> absent;
+        if (pk_type == DataType::INT64) {
+            auto pks = dataset.get_col<int64_t>(pk_fid);
+            present.assign(pks.begin(), pks.end());
+            auto max_pk = *std::max_element(pks.begin(), pks.end());
+            for (int64_t i = 1; i <= N; ++i) {
+                absent.emplace_back(max_pk + i);
+            }
+        } else {
+            auto pks = dataset.get_col<std::string>(pk_fid);
+            present.assign(pks.begin(), pks.end());
+            // generated varchar pks are all digits
+            for (int64_t i = 0; i < N; ++i) {
+                absent.emplace_back("absent_" + std::to_string(i));
+            }
+        }
+
+        for (bool is_sorted_by_pk : {false, true}) {
+            auto segment = CreateSealedSegment(schema,
+                                               empty_index_meta,
+                                               0,
+                                               SegcoreConfig::default_config(),
+                                               is_sorted_by_pk);
+            LoadGeneratedDataIntoSegment(dataset, segment.get());
+
+            for (auto& pk : present) {
+                ASSERT_TRUE(segment->Contain(pk))
+                    << "sorted " << is_sorted_by_pk;
+            }
+            for (auto& pk : absent) {
+                ASSERT_FALSE(segment->Contain(pk))
+                    << "sorted " << is_sorted_by_pk;
+            }
+        }
+    }
+}
@@ -20,6 +20,7 @@
 #include "common/IndexMeta.h"
 #include "common/Schema.h"
 #include "pb/schema.pb.h"
+#include "query/PlanCache.h"
 
 namespace milvus::segcore {
 
@@ -80,12 +81,34 @@ class Collection {
         return collection_name_;
     }
 
+    query::PlanCache&
+    get_plan_cache() {
+        return plan_cache_;
+    }
+
+    // Name of the search executor the plans of this collection run on,
+    // empty for the global one, see futures::getNamedSearchCPUExecutor.
+    std::string
+    get_search_pool() {
+        std::shared_lock lock(search_pool_mutex_);
+        return search_pool_;
+    }
+
+    void
+    set_search_pool(const std::string& search_pool) {
+        std::unique_lock lock(search_pool_mutex_);
+        search_pool_ = search_pool;
+    }
+
  private:
     std::string collection_name_;
     SchemaPtr schema_;
     std::shared_mutex schema_mutex_;
     IndexMetaPtr index_meta_;
     std::shared_mutex index_meta_mutex_;
+    query::PlanCache plan_cache_;
+    std::string search_pool_;
+    std::shared_mutex search_pool_mutex_;
 };
 
 using CollectionPtr = std::unique_ptr<Collection>;
@@ -14,10 +14,12 @@
 #include <algorithm>
 #include <cstdint>
 
+#include "common/FastMem.h"
 #include "common/Types.h"
 #include "common/Utils.h"
 #include "fmt/core.h"
 #include "pb/schema.pb.h"
+#include "query/SparseChunkPostings.h"
 #include "simdjson/padded_string.h"
 
 namespace milvus::segcore {
@@ -184,4 +186,158 @@ VectorBase::set_data_raw(ssize_t element_offset,
     }
 }
 
+template <typename T>
+T*
+FlatVectorArrayChunk::Reserve(std::atomic<T*>& data,
+                              size_t& capacity,
+                              size_t used,
+                              size_t size,
+                              std::vector<std::unique_ptr<T[]>>& buffers) {
+    auto current = data.load(std::memory_order_relaxed);
+    if (size <= capacity) {
+        return current;
+    }
+    auto new_capacity =
+        std::max({size, capacity * 2, kMinCapacityBytes / sizeof(T)});
+    auto buffer = std::unique_ptr<T[]>(new T[new_capacity]);
+    if (current != nullptr) {
+        std::copy_n(current, used, buffer.get());
+    }
+    current = buffer.get();
+    buffers.push_back(std::move(buffer));
+    capacity = new_capacity;
+    data.store(current, std::memory_order_release);
+    return current;
+}
+
+void
+FlatVectorArrayChunk::Append(const VectorArray& row) {
+    auto rows = rows_.load(std::memory_order_relaxed);
+    auto offsets = Reserve(
+        offsets_, offsets_capacity_, rows + 1, rows + 2, offsets_buffers_);
+    if (rows == 0) {
+        offsets[0] = 0;
+    }
+    auto size = row.byte_size();
+    auto data =
+        Reserve(data_, data_capacity_, bytes_, bytes_ + size, data_buffers_);
+    if (size > 0) {
+        milvus::fastmem::FastMemcpy(data + bytes_, row.data(), size);
+    }
+    bytes_ += size;
+    offsets[rows + 1] = offsets[rows] + row.length();
+    // publish the row only once it is written
+    rows_.store(rows + 1, std::memory_order_release);
+}
+
+void
+ConcurrentVector<VectorArray>::set_data_raw(ssize_t element_offset,
+                                            const void* source,
+                                            ssize_t element_count) {
+    // rows of the storage the call writes, compacted ones if nulls are not
+    // stored
+    int64_t begin = element_offset;
+    if (use_mapping_storage_) {
+        begin = offset_mapping_.GetValidCount();
+    }
+    ConcurrentVectorImpl<VectorArray, true>::set_data_raw(
+        element_offset, source, element_count);
+    int64_t end = begin + element_count;
+    if (use_mapping_storage_) {
+        end = offset_mapping_.GetValidCount();
+    }
+    if (end > begin) {
+        FlattenRows(begin, end);
+    }
+}
+
+void
+ConcurrentVector<VectorArray>::FlattenRows(int64_t begin, int64_t end) {
+    std::lock_guard<std::mutex> lck(flatten_mutex_);
+    if (begin > flat_rows_) {
+        pending_flat_rows_[begin] = end;
+        return;
+    }
+    auto flatten = [this](int64_t from, int64_t to) {
+        for (auto row = from; row < to; ++row) {
+            auto chunk_id = row / size_per_chunk_;
+            if (chunk_id >= static_cast<int64_t>(flat_chunks_.size())) {
+                std::unique_lock lock(flat_chunks_mutex_);
+                flat_chunks_.push_back(
+                    std::make_unique<FlatVectorArrayChunk>());
+            }
+            flat_chunks_[chunk_id]->Append(*get_physical_element(row));
+        }
+    };
+    if (end > flat_rows_) {
+        flatten(flat_rows_, end);
+        flat_rows_ = end;
+    }
+    while (!pending_flat_rows_.empty() &&
+           pending_flat_rows_.begin()->first <= flat_rows_) {
+        auto pending_end = pending_flat_rows_.begin()->second;
+        pending_flat_rows_.erase(pending_flat_rows_.begin());
+        if (pending_end > flat_rows_) {
+            flatten(flat_rows_, pending_end);
+            flat_rows_ = pending_end;
+        }
+    }
+}
+
+FlatVectorArrayChunk::View
+ConcurrentVector<VectorArray>::get_flat_chunk(ssize_t chunk_id) const {
+    std::shared_lock lock(flat_chunks_mutex_);
+    if (chunk_id >= static_cast<ssize_t>(flat_chunks_.size())) {
+        return {};
+    }
+    return flat_chunks_[chunk_id]->view();
+}
+
+void
+ConcurrentVector<VectorArray>::clear() {
+    std::lock_guard<std::mutex> lck(flatten_mutex_);
+    {
+        std::unique_lock lock(flat_chunks_mutex_);
+        flat_chunks_.clear();
+    }
+    flat_rows_ = 0;
+    pending_flat_rows_.clear();
+    ConcurrentVectorImpl<VectorArray, true>::clear();
+}
+
+std::shared_ptr<const query::SparseChunkPostings>
+ConcurrentVector<SparseFloatVector>::get_chunk_postings(ssize_t chunk_id,
+                                                        int64_t rows) const {
+    std::lock_guard<std::mutex> lck(postings_mutex_);
+    if (chunk_id < static_cast<ssize_t>(chunk_postings_.size()) &&
+        chunk_postings_[chunk_id] != nullptr &&
+        chunk_postings_[chunk_id]->num_rows() >= rows) {
+        return chunk_postings_[chunk_id];
+    }
+    // the tail chunk would be rebuilt on every insert, leave it to the row
+    // wise search until it is full
+    if (rows < this->get_size_per_chunk()) {
+        return nullptr;
+    }
+    auto rows_data = static_cast<const knowhere::sparse::SparseRow<
+        SparseValueType>*>(this->get_chunk_data(chunk_id));
+    auto postings =
+        std::make_shared<const query::SparseChunkPostings>(rows_data, rows);
+    if (chunk_id >= static_cast<ssize_t>(chunk_postings_.size())) {
+        chunk_postings_.resize(chunk_id + 1);
+    }
+    chunk_postings_[chunk_id] = postings;
+    return postings;
+}
+
+void
+ConcurrentVector<SparseFloatVector>::clear() {
+    {
+        std::lock_guard<std::mutex> lck(postings_mutex_);
+        chunk_postings_.clear();
+    }
+    ConcurrentVectorImpl<knowhere::sparse::SparseRow<SparseValueType>,
+                         true>::clear();
+}
+
 }  // namespace milvus::segcore
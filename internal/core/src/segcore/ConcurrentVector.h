@@ -18,6 +18,7 @@
 #include <atomic>
 #include <cassert>
 #include <deque>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <shared_mutex>
@@ -37,81 +38,139 @@
 #include "common/Utils.h"
 #include "mmap/ChunkVector.h"
 
+namespace milvus::query {
+class SparseChunkPostings;
+}  // namespace milvus::query
+
 namespace milvus::segcore {
 
+// Validity of the rows of a nullable field of a growing segment.
+//
+// Appends are serialized among themselves, readers never lock. The rows are
+// kept in one contiguous buffer that doubles when full; a replaced buffer is
+// kept alive until destruction, so pointers handed out by get_chunk_data and
+// readers racing with an append keep reading valid memory. The replaced
+// buffers add up to less than the current one.
 class ThreadSafeValidData {
  public:
     explicit ThreadSafeValidData() = default;
-    explicit ThreadSafeValidData(FixedVector<bool> data)
-        : data_(std::move(data)) {
+    explicit ThreadSafeValidData(FixedVector<bool> data) {
+        auto dst = reserve(data.size());
+        std::copy_n(data.data(), data.size(), dst);
+        length_.store(data.size(), std::memory_order_release);
     }
 
     void
     set_data_raw(const std::vector<FieldDataPtr>& datas) {
-        std::unique_lock<std::shared_mutex> lck(mutex_);
-        auto total = 0;
+        std::lock_guard<std::mutex> lck(append_mutex_);
+        size_t total = 0;
         for (auto& field_data : datas) {
             total += field_data->get_num_rows();
         }
-        if (length_ + total > data_.size()) {
-            data_.resize(length_ + total);
-        }
+        auto length = length_.load(std::memory_order_relaxed);
+        auto dst = reserve(length + total);
 
         for (auto& field_data : datas) {
             auto num_row = field_data->get_num_rows();
             for (size_t i = 0; i < num_row; i++) {
-                data_[length_ + i] = field_data->is_valid(i);
+                dst[length + i] = field_data->is_valid(i);
             }
-            length_ += num_row;
+            length += num_row;
         }
+        // publish the rows only once they are written
+        length_.store(length, std::memory_order_release);
     }
 
     void
     set_data_raw(size_t num_rows,
                  const DataArray* data,
                  const FieldMeta& field_meta) {
-        std::unique_lock<std::shared_mutex> lck(mutex_);
         if (field_meta.is_nullable()) {
-            if (length_ + num_rows > data_.size()) {
-                data_.resize(length_ + num_rows);
-            }
+            std::lock_guard<std::mutex> lck(append_mutex_);
+            auto length = length_.load(std::memory_order_relaxed);
+            auto dst = reserve(length + num_rows);
             auto src = data->valid_data().data();
-            std::copy_n(src, num_rows, data_.data() + length_);
-            length_ += num_rows;
+            std::copy_n(src, num_rows, dst + length);
+            length_.store(length + num_rows, std::memory_order_release);
         }
     }
 
     bool
     is_valid(size_t offset) const {
-        std::shared_lock<std::shared_mutex> lck(mutex_);
-        AssertInfo(offset < length_,
+        // the length is loaded first: a buffer published before it holds
+        // every row below it
+        auto length = length_.load(std::memory_order_acquire);
+        AssertInfo(offset < length,
                    "offset out of range, offset={}, length_={}",
                    offset,
-                   length_);
-        return data_[offset];
+                   length);
+        return data_.load(std::memory_order_acquire)[offset];
     }
 
     bool*
     get_chunk_data(size_t offset) {
-        std::shared_lock<std::shared_mutex> lck(mutex_);
-        AssertInfo(offset < length_,
+        auto length = length_.load(std::memory_order_acquire);
+        AssertInfo(offset < length,
                    "offset out of range, offset={}, length_={}",
                    offset,
-                   length_);
-        return &data_[offset];
+                   length);
+        return data_.load(std::memory_order_acquire) + offset;
+    }
+
+    // Validity of the rows [offset, offset + count), all of which must have
+    // been appended.
+    const bool*
+    get_data_range(size_t offset, size_t count) const {
+        auto length = length_.load(std::memory_order_acquire);
+        AssertInfo(offset + count <= length,
+                   "range out of range, offset={}, count={}, length_={}",
+                   offset,
+                   count,
+                   length);
+        return data_.load(std::memory_order_acquire) + offset;
     }
 
     FixedVector<bool>
     get_data() const {
-        std::shared_lock<std::shared_mutex> lck(mutex_);
-        return data_;
+        auto length = length_.load(std::memory_order_acquire);
+        auto data = data_.load(std::memory_order_acquire);
+        if (data == nullptr) {
+            return FixedVector<bool>{};
+        }
+        return FixedVector<bool>(data, data + length);
     }
 
  private:
-    mutable std::shared_mutex mutex_{};
-    FixedVector<bool> data_;
+    // Makes room for `size` rows and returns the buffer to write them to.
+    // Requires append_mutex_, or exclusive access in the constructor.
+    bool*
+    reserve(size_t size) {
+        auto data = data_.load(std::memory_order_relaxed);
+        if (size <= capacity_) {
+            return data;
+        }
+        auto capacity = std::max({size, capacity_ * 2, kMinCapacity});
+        auto buffer = std::make_unique<bool[]>(capacity);
+        if (data != nullptr) {
+            std::copy_n(
+                data, length_.load(std::memory_order_relaxed), buffer.get());
+        }
+        data = buffer.get();
+        buffers_.push_back(std::move(buffer));
+        capacity_ = capacity;
+        data_.store(data, std::memory_order_release);
+        return data;
+    }
+
+    static constexpr size_t kMinCapacity = 1024;
+
+    std::mutex append_mutex_;
+    std::atomic<bool*> data_{nullptr};
     // number of actual elements
-    size_t length_{0};
+    std::atomic<size_t> length_{0};
+    // written under append_mutex_ only
+    size_t capacity_{0};
+    std::vector<std::unique_ptr<bool[]>> buffers_;
 };
 using ThreadSafeValidDataPtr = std::shared_ptr<ThreadSafeValidData>;
 
@@ -245,7 +304,9 @@ class ConcurrentVectorImpl : public VectorBase {
           elements_per_row_(is_type_entire_row ? 1 : elements_per_row),
           valid_data_ptr_(valid_data_ptr),
           use_mapping_storage_(use_mapping_storage) {
-        chunks_ptr_ = SelectChunkVectorPtr<Type>(mmap_descriptor);
+        // chunks sized to a whole sealed column are never reused
+        chunks_ptr_ = SelectChunkVectorPtr<Type>(
+            mmap_descriptor, size_per_chunk != MAX_ROW_COUNT);
     }
 
     SpanBase
@@ -293,17 +354,12 @@ class ConcurrentVectorImpl : public VectorBase {
         if (use_mapping_storage_) {
             if constexpr (!std::is_same_v<Type, bool>) {
                 storage_offset = offset_mapping_.GetValidCount();
-                // Build valid_data array for offset mapping
-                std::unique_ptr<bool[]> valid_data(new bool[element_count]);
-                for (ssize_t i = 0; i < element_count; ++i) {
-                    bool is_valid =
-                        valid_data_ptr_->is_valid(element_offset + i);
-                    valid_data[i] = is_valid;
-                    if (is_valid) {
-                        valid_count++;
-                    }
-                }
-                offset_mapping_.Append(valid_data.get(),
+                // the validity of the rows is appended before their data
+                auto valid_data = valid_data_ptr_->get_data_range(
+                    element_offset, element_count);
+                valid_count = std::count(
+                    valid_data, valid_data + element_count, true);
+                offset_mapping_.Append(valid_data,
                                        element_count,
                                        element_offset,
                                        storage_offset);
@@ -602,6 +658,63 @@ class ConcurrentVector<Array> : public ConcurrentVectorImpl<Array, true> {
     }
 };
 
+// The elements of the rows of a VectorArray chunk, one after another in a
+// single buffer, as element-level and embedding list search read them.
+//
+// Same scheme as ThreadSafeValidData: rows are appended under the lock of
+// the owner, readers never lock, and replaced buffers stay alive until
+// destruction so a view stays valid while rows are appended.
+class FlatVectorArrayChunk {
+ public:
+    struct View {
+        const void* data = nullptr;
+        // offsets[i] is the first element of the i-th row of the chunk,
+        // offsets[rows] the number of elements
+        const size_t* offsets = nullptr;
+        int64_t rows = 0;
+
+        int64_t
+        element_count() const {
+            return rows == 0 ? 0 : static_cast<int64_t>(offsets[rows]);
+        }
+    };
+
+    View
+    view() const {
+        // the rows are loaded first: buffers published before them hold
+        // every row below them
+        auto rows = rows_.load(std::memory_order_acquire);
+        return {data_.load(std::memory_order_acquire),
+                offsets_.load(std::memory_order_acquire),
+                rows};
+    }
+
+    // Requires the lock of the owner.
+    void
+    Append(const VectorArray& row);
+
+ private:
+    static constexpr size_t kMinCapacityBytes = 4096;
+
+    template <typename T>
+    static T*
+    Reserve(std::atomic<T*>& data,
+            size_t& capacity,
+            size_t used,
+            size_t size,
+            std::vector<std::unique_ptr<T[]>>& buffers);
+
+    std::atomic<uint8_t*> data_{nullptr};
+    std::atomic<size_t*> offsets_{nullptr};
+    std::atomic<int64_t> rows_{0};
+    // written under the lock of the owner only
+    size_t bytes_{0};
+    size_t data_capacity_{0};
+    size_t offsets_capacity_{0};
+    std::vector<std::unique_ptr<uint8_t[]>> data_buffers_;
+    std::vector<std::unique_ptr<size_t[]>> offsets_buffers_;
+};
+
 template <>
 class ConcurrentVector<VectorArray>
     : public ConcurrentVectorImpl<VectorArray, true> {
@@ -619,6 +732,39 @@ class ConcurrentVector<VectorArray>
               valid_data_ptr,
               use_mapping_storage) {
     }
+
+    using ConcurrentVectorImpl<VectorArray, true>::set_data_raw;
+
+    // Also appends the elements of the rows to the flat chunks, once every
+    // row before them is there.
+    void
+    set_data_raw(ssize_t element_offset,
+                 const void* source,
+                 ssize_t element_count) override;
+
+    // The flattened rows of the chunk, from its first row on. Rows being
+    // inserted after a missing one are not there yet.
+    FlatVectorArrayChunk::View
+    get_flat_chunk(ssize_t chunk_id) const;
+
+    void
+    clear() override;
+
+ private:
+    // flattens the rows of the storage [begin, end) once rows up to begin
+    // are flattened
+    void
+    FlattenRows(int64_t begin, int64_t end);
+
+    // serializes flattening, guards flat_rows_ and pending_flat_rows_
+    std::mutex flatten_mutex_;
+    // guards the list of flat chunks, not the chunks
+    mutable std::shared_mutex flat_chunks_mutex_;
+    std::vector<std::unique_ptr<FlatVectorArrayChunk>> flat_chunks_;
+    // rows of the storage flattened, from the first on
+    int64_t flat_rows_{0};
+    // begin -> end of rows stored but waiting for earlier ones
+    std::map<int64_t, int64_t> pending_flat_rows_;
 };
 
 template <>
@@ -650,12 +796,10 @@ class ConcurrentVector<SparseFloatVector>
                 source);
         ssize_t source_count = element_count;
         if (this->use_mapping_storage_) {
-            source_count = 0;
-            for (ssize_t i = 0; i < element_count; ++i) {
-                if (this->valid_data_ptr_->is_valid(element_offset + i)) {
-                    source_count++;
-                }
-            }
+            auto valid_data = this->valid_data_ptr_->get_data_range(
+                element_offset, element_count);
+            source_count =
+                std::count(valid_data, valid_data + element_count, true);
         }
         for (ssize_t i = 0; i < source_count; ++i) {
             dim_ = std::max(dim_, src[i].dim());
@@ -671,8 +815,21 @@ class ConcurrentVector<SparseFloatVector>
         return dim_;
     }
 
+    // The postings of the first `rows` rows of the chunk for brute force
+    // search, or nullptr while the chunk is not full and has not been seen
+    // with that many rows. Built on the first search of a full chunk and
+    // kept, Search of the postings is told how many of their rows to take.
+    std::shared_ptr<const query::SparseChunkPostings>
+    get_chunk_postings(ssize_t chunk_id, int64_t rows) const;
+
+    void
+    clear() override;
+
  private:
     int64_t dim_;
+    mutable std::mutex postings_mutex_;
+    mutable std::vector<std::shared_ptr<const query::SparseChunkPostings>>
+        chunk_postings_;
 };
 
 template <>
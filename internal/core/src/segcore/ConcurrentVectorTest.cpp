@@ -16,12 +16,16 @@
 #include <atomic>
 #include <cstdint>
 #include <random>
+#include <string>
 #include <thread>
 #include <tuple>
 #include <vector>
 
+#include "common/Json.h"
 #include "common/OffsetMapping.h"
+#include "common/VectorArray.h"
 #include "gtest/gtest.h"
+#include "mmap/ChunkPool.h"
 #include "segcore/AckResponder.h"
 #include "segcore/ConcurrentVector.h"
 #include "segcore/SegcoreConfig.h"
@@ -117,3 +121,157 @@ TEST(ConcurrentVector, TestAckSingle) {
     }
     EXPECT_EQ(ack.GetAck(), N);
 }
+
+TEST(ConcurrentVector, ValidDataKeepsHandedOutRangesOnGrowth) {
+    milvus::FieldMeta field_meta(milvus::FieldName("nullable_int"),
+                                 milvus::FieldId(100),
+                                 milvus::DataType::INT64,
+                                 true,
+                                 std::nullopt);
+    ThreadSafeValidData valid_data;
+    std::vector<bool> expected;
+    const bool* first_batch = nullptr;
+    for (int batch = 0; batch < 64; ++batch) {
+        milvus::DataArray data;
+        for (int i = 0; i < 100; ++i) {
+            bool valid = (batch + i) % 3 != 0;
+            data.add_valid_data(valid);
+            expected.push_back(valid);
+        }
+        valid_data.set_data_raw(100, &data, field_meta);
+        if (first_batch == nullptr) {
+            first_batch = valid_data.get_data_range(0, 100);
+        }
+    }
+
+    // the buffer was replaced several times, the first range still reads
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_EQ(first_batch[i], expected[i]);
+    }
+    auto data = valid_data.get_data();
+    ASSERT_EQ(data.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        ASSERT_EQ(data[i], expected[i]);
+        ASSERT_EQ(valid_data.is_valid(i), expected[i]);
+    }
+    EXPECT_ANY_THROW(valid_data.is_valid(expected.size()));
+    EXPECT_ANY_THROW(valid_data.get_data_range(expected.size() - 1, 2));
+}
+
+TEST(ConcurrentVector, ReleasedChunksAreReused) {
+    auto& config = SegcoreConfig::default_config();
+    auto pool_bytes = config.get_growing_chunk_pool_bytes();
+    config.set_growing_chunk_pool_bytes(1 << 20);
+    auto& pool = milvus::GrowingChunkPool<float>::Instance();
+    pool.Clear();
+
+    auto dim = 4;
+    auto size_per_chunk = 32;
+    std::vector<float> rows(size_per_chunk * 2 * dim);
+    for (size_t i = 0; i < rows.size(); ++i) {
+        rows[i] = i + 1;
+    }
+    {
+        ConcurrentVectorImpl<float, false> c_vec(dim, size_per_chunk);
+        c_vec.set_data_raw(0, rows.data(), size_per_chunk * 2);
+        ASSERT_EQ(c_vec.num_chunk(), 2);
+    }
+    EXPECT_EQ(pool.GetChunkCount(), 2);
+
+    {
+        ConcurrentVectorImpl<float, false> c_vec(dim, size_per_chunk);
+        c_vec.set_data_raw(0, rows.data(), 1);
+        ASSERT_EQ(c_vec.num_chunk(), 1);
+        EXPECT_EQ(pool.GetChunkCount(), 1);
+        // a reused chunk reads as a fresh one past the inserted rows
+        auto chunk = static_cast<const float*>(c_vec.get_chunk_data(0));
+        for (int i = 0; i < size_per_chunk * dim; ++i) {
+            ASSERT_EQ(chunk[i], i < dim ? rows[i] : 0);
+        }
+    }
+
+    // sealed-sized chunks are not pooled
+    pool.Clear();
+    {
+        ConcurrentVectorImpl<float, false> c_vec(dim, milvus::MAX_ROW_COUNT);
+        c_vec.set_data_raw(0, rows.data(), size_per_chunk);
+    }
+    EXPECT_EQ(pool.GetChunkCount(), 0);
+
+    config.set_growing_chunk_pool_bytes(0);
+    {
+        ConcurrentVectorImpl<float, false> c_vec(dim, size_per_chunk);
+        c_vec.set_data_raw(0, rows.data(), size_per_chunk);
+    }
+    EXPECT_EQ(pool.GetChunkCount(), 0);
+    config.set_growing_chunk_pool_bytes(pool_bytes);
+}
+
+TEST(ConcurrentVector, JsonRowsOutliveTheirSource) {
+    const int64_t size_per_chunk = 4;
+    ConcurrentVector<milvus::Json> c_vec(size_per_chunk);
+    std::vector<std::string> docs;
+    for (int i = 0; i < 6; ++i) {
+        docs.push_back(R"({"id":)" + std::to_string(i) + "}");
+    }
+    {
+        std::vector<milvus::Json> rows;
+        for (const auto& doc : docs) {
+            rows.emplace_back(simdjson::padded_string(doc));
+        }
+        c_vec.set_data_raw(0, rows.data(), 3);
+        c_vec.set_data_raw(3, rows.data() + 3, 3);
+    }
+    // the rows were copied into the chunks, not the documents they viewed
+    ASSERT_EQ(c_vec.num_chunk(), 2);
+    for (int i = 0; i < 6; ++i) {
+        EXPECT_EQ(c_vec.view_element(i), docs[i]);
+        EXPECT_EQ(c_vec[i].data(), docs[i]);
+        EXPECT_EQ(c_vec[i].at<int64_t>(std::string_view("/id")).value(), i);
+    }
+}
+
+TEST(ConcurrentVector, FlattensVectorArrayRowsInOrder) {
+    const int64_t dim = 2;
+    const int64_t size_per_chunk = 4;
+    const int64_t num_rows = 10;
+    std::vector<milvus::VectorArray> rows;
+    std::vector<std::vector<float>> expected(
+        milvus::upper_div(num_rows, size_per_chunk));
+    for (int64_t i = 0; i < num_rows; ++i) {
+        std::vector<float> elements((i % 3 + 1) * dim);
+        for (size_t j = 0; j < elements.size(); ++j) {
+            elements[j] = i * 100 + j;
+        }
+        auto& chunk = expected[i / size_per_chunk];
+        chunk.insert(chunk.end(), elements.begin(), elements.end());
+        rows.emplace_back(elements.data(),
+                          i % 3 + 1,
+                          dim,
+                          milvus::DataType::VECTOR_FLOAT);
+    }
+
+    ConcurrentVector<milvus::VectorArray> c_vec(dim, size_per_chunk);
+    // the later rows wait for the earlier ones
+    c_vec.set_data_raw(4, rows.data() + 4, num_rows - 4);
+    EXPECT_EQ(c_vec.get_flat_chunk(0).rows, 0);
+    EXPECT_EQ(c_vec.get_flat_chunk(1).rows, 0);
+    c_vec.set_data_raw(0, rows.data(), 4);
+
+    for (size_t chunk_id = 0; chunk_id < expected.size(); ++chunk_id) {
+        auto flat = c_vec.get_flat_chunk(chunk_id);
+        auto begin = static_cast<int64_t>(chunk_id) * size_per_chunk;
+        auto chunk_rows = std::min(size_per_chunk, num_rows - begin);
+        ASSERT_EQ(flat.rows, chunk_rows);
+        ASSERT_EQ(flat.element_count() * dim, expected[chunk_id].size());
+        auto data = static_cast<const float*>(flat.data);
+        for (size_t j = 0; j < expected[chunk_id].size(); ++j) {
+            ASSERT_EQ(data[j], expected[chunk_id][j]);
+        }
+        for (int64_t r = 0; r < chunk_rows; ++r) {
+            auto row = begin + r;
+            EXPECT_EQ(flat.offsets[r + 1] - flat.offsets[r],
+                      rows[row].length());
+        }
+    }
+}
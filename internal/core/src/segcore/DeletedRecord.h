@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <mutex>
@@ -18,7 +19,6 @@
 #include <tuple>
 #include <utility>
 #include <vector>
-#include <folly/ConcurrentSkipList.h>
 
 #include "AckResponder.h"
 #include "common/Common.h"
@@ -27,29 +27,17 @@
 #include "segcore/Record.h"
 #include "segcore/InsertRecord.h"
 #include "segcore/SegmentInterface.h"
+#include "segcore/SortedDeleteList.h"
 #include "ConcurrentVector.h"
 
 namespace milvus::segcore {
 
-using Offset = int32_t;
-
-struct Comparator {
-    bool
-    operator()(const std::pair<Timestamp, Offset>& left,
-               const std::pair<Timestamp, Offset>& right) const {
-        if (left.first == right.first) {
-            return left.second < right.second;
-        }
-        return left.first < right.first;
-    }
-};
-
-// a lock-free list for multi-thread insert && read
-using SortedDeleteList =
-    folly::ConcurrentSkipList<std::pair<Timestamp, Offset>, Comparator>;
-
 static int32_t DELETE_PAIR_SIZE = sizeof(std::pair<Timestamp, Offset>);
 
+// max number of delta layers kept on top of the snapshot base before the
+// oldest half is folded into it
+constexpr size_t DELETE_SNAPSHOT_MAX_LAYERS = 16;
+
 // atomic snapshot for fast path query optimization
 // contains a consistent view of (max_timestamp, deleted_bitset)
 struct DeleteSnapshot {
@@ -65,6 +53,15 @@ struct DeleteSnapshot {
     }
 };
 
+// one layer of the delete snapshot chain, holds only the rows deleted since
+// the previous layer (or the base) instead of a full bitset clone
+struct DeleteSnapshotLayer {
+    Timestamp ts{0};
+    std::vector<Offset> offsets;
+    // next delete record position that follows this layer
+    std::pair<Timestamp, Offset> next_pos;
+};
+
 template <bool is_sealed = false>
 class DeletedRecord {
  public:
@@ -78,7 +75,7 @@ class DeletedRecord {
         : insert_record_(insert_record),
           search_pk_func_(std::move(search_pk_func)),
           segment_id_(segment_id),
-          deleted_lists_(SortedDeleteList::createInstance()) {
+          deleted_lists_(std::make_shared<SortedDeleteList>()) {
     }
 
     ~DeletedRecord() {
@@ -108,7 +105,30 @@ class DeletedRecord {
             max_load_timestamp_ = max_deleted_ts;
         }
 
-        //TODO: add support for dump snapshot when load finished
+        // load deletes are not sorted, entries older than the snapshot
+        // chain would be skipped by Query, so drop the chain and let
+        // FinishLoad rebuild it
+        auto min_deleted_ts =
+            *std::min_element(timestamps, timestamps + pks.size());
+        std::unique_lock<std::shared_mutex> lock(snap_lock_);
+        if (LatestSnapshotTimestampUnlocked() >= min_deleted_ts) {
+            ResetSnapshotsUnlocked();
+        }
+    }
+
+    // persist the snapshot chain and the latest snapshot once all deletes
+    // of a LoadDeletedRecord call have been pushed
+    void
+    FinishLoad() {
+        DumpSnapshot();
+        if (ENABLE_LATEST_DELETE_SNAPSHOT_OPTIMIZATION.load()) {
+            auto snapshot = std::atomic_load(&latest_snapshot_);
+            auto max_ts = max_load_timestamp_;
+            if (snapshot && snapshot->max_ts > max_ts) {
+                max_ts = snapshot->max_ts;
+            }
+            UpdateLatestSnapshot(max_ts);
+        }
     }
 
     // stream push delete timestamps should be sorted outside of the interface
@@ -137,7 +157,8 @@ class DeletedRecord {
         int64_t mem_add = 0;
         Timestamp max_timestamp = 0;
 
-        SortedDeleteList::Accessor accessor(deleted_lists_);
+        std::vector<SortedDeleteList::value_type> entries;
+        entries.reserve(pks.size());
         for (size_t i = 0; i < pks.size(); ++i) {
             auto deleted_ts = timestamps[i];
             if (deleted_ts > max_timestamp) {
@@ -171,7 +192,7 @@ class DeletedRecord {
                 if (insert_ts != 0 && delete_ts <= insert_ts) {
                     return;
                 }
-                accessor.insert(std::make_pair(delete_ts, row_id));
+                entries.emplace_back(delete_ts, row_id);
                 if constexpr (is_sealed) {
                     Assert(deleted_mask_.size() > 0);
                     deleted_mask_.set(row_id);
@@ -183,7 +204,14 @@ class DeletedRecord {
                 removed_num++;
                 mem_add += DELETE_PAIR_SIZE;
             });
+        deleted_lists_->Insert(std::move(entries));
 
+        // max_timestamp_ first, a reader of the new version() sees it as well
+        auto prev_max_ts = max_timestamp_.load();
+        while (prev_max_ts < max_timestamp &&
+               !max_timestamp_.compare_exchange_weak(prev_max_ts,
+                                                     max_timestamp)) {
+        }
         n_.fetch_add(removed_num);
         mem_size_.fetch_add(mem_add);
 
@@ -253,20 +281,29 @@ class DeletedRecord {
         SortedDeleteList::iterator next_iter;
         {
             std::shared_lock<std::shared_mutex> lock(snap_lock_);
-            // find last meeted snapshot
-            if (!snapshots_.empty()) {
-                int loc = snapshots_.size() - 1;
-                while (loc >= 0 && snapshots_[loc].first > query_timestamp) {
-                    loc--;
+            // find last meeted layer, the base is shared by all layers
+            int loc = snapshot_layers_.size() - 1;
+            while (loc >= 0 && snapshot_layers_[loc].ts > query_timestamp) {
+                loc--;
+            }
+            if (loc >= 0 || (snapshot_base_ts_ > 0 &&
+                             snapshot_base_ts_ <= query_timestamp)) {
+                auto or_size = std::min(snapshot_base_.size(), bitset.size());
+                if (or_size > 0) {
+                    bitset.inplace_or(snapshot_base_, or_size);
                 }
-                if (loc >= 0) {
-                    // use lower_bound to relocate the iterator in current accessor
-                    next_iter = accessor.lower_bound(snap_next_pos_[loc]);
-                    auto or_size =
-                        std::min(snapshots_[loc].second.size(), bitset.size());
-                    bitset.inplace_or(snapshots_[loc].second, or_size);
-                    hit_snapshot = true;
+                for (int i = 0; i <= loc; ++i) {
+                    for (auto offset : snapshot_layers_[i].offsets) {
+                        if (static_cast<size_t>(offset) < bitset.size()) {
+                            bitset.set(offset);
+                        }
+                    }
                 }
+                // use lower_bound to relocate the iterator in current accessor
+                next_iter = accessor.lower_bound(
+                    loc >= 0 ? snapshot_layers_[loc].next_pos
+                             : snapshot_base_next_pos_);
+                hit_snapshot = true;
             }
         }
 
@@ -280,17 +317,64 @@ class DeletedRecord {
         }
     }
 
+    // drops the offsets deleted at or before query_timestamp, for a few
+    // offsets of a point lookup where a bitset of the segment costs more
+    // than the lookup itself
+    void
+    RemoveDeleted(std::vector<int64_t>& offsets, Timestamp query_timestamp) {
+        SortedDeleteList::Accessor accessor(deleted_lists_);
+        if (accessor.size() == 0 || offsets.empty()) {
+            return;
+        }
+
+        auto snapshot = std::atomic_load(&latest_snapshot_);
+        if (snapshot && snapshot->max_ts > 0 &&
+            query_timestamp >= snapshot->max_ts) {
+            const auto& deleted = snapshot->bitset;
+            offsets.erase(
+                std::remove_if(offsets.begin(),
+                               offsets.end(),
+                               [&deleted](int64_t offset) {
+                                   return static_cast<size_t>(offset) <
+                                              deleted.size() &&
+                                          deleted[offset];
+                               }),
+                offsets.end());
+            return;
+        }
+
+        std::vector<int64_t> candidates(offsets);
+        std::sort(candidates.begin(), candidates.end());
+        std::vector<int64_t> deleted;
+        for (auto it = accessor.begin();
+             it != accessor.end() && it->first <= query_timestamp;
+             ++it) {
+            if (std::binary_search(
+                    candidates.begin(), candidates.end(), it->second)) {
+                deleted.push_back(it->second);
+            }
+        }
+        if (deleted.empty()) {
+            return;
+        }
+        std::sort(deleted.begin(), deleted.end());
+        offsets.erase(std::remove_if(offsets.begin(),
+                                     offsets.end(),
+                                     [&deleted](int64_t offset) {
+                                         return std::binary_search(
+                                             deleted.begin(),
+                                             deleted.end(),
+                                             offset);
+                                     }),
+                      offsets.end());
+    }
+
     size_t
     GetSnapshotBitsSize() const {
-        auto all_dump_bits = 0;
-        auto next_dump_ts = 0;
         std::shared_lock<std::shared_mutex> lock(snap_lock_);
-        int loc = snapshots_.size() - 1;
-        while (loc >= 0) {
-            if (next_dump_ts != snapshots_[loc].first) {
-                all_dump_bits += snapshots_[loc].second.size();
-            }
-            loc--;
+        size_t all_dump_bits = snapshot_base_.size();
+        for (const auto& layer : snapshot_layers_) {
+            all_dump_bits += layer.offsets.size() * sizeof(Offset) * 8;
         }
         return all_dump_bits;
     }
@@ -302,20 +386,17 @@ class DeletedRecord {
 
         while (total_size - dumped_entry_count_.load() >
                DELETE_DUMP_BATCH_SIZE) {
-            int32_t bitsize = 0;
-            if constexpr (is_sealed) {
-                bitsize = sealed_row_count_;
-            } else {
-                bitsize = insert_record_->row_count();
-            }
-            BitsetType bitmap(bitsize, false);
-
             auto it = accessor.begin();
             Timestamp last_dump_ts = 0;
-            if (!snapshots_.empty()) {
-                it = accessor.lower_bound(snap_next_pos_.back());
-                bitmap.inplace_or(snapshots_.back().second,
-                                  snapshots_.back().second.size());
+            {
+                std::shared_lock<std::shared_mutex> lock(snap_lock_);
+                if (!snapshot_layers_.empty()) {
+                    it = accessor.lower_bound(snapshot_layers_.back().next_pos);
+                    last_dump_ts = snapshot_layers_.back().ts;
+                } else if (snapshot_base_ts_ > 0) {
+                    it = accessor.lower_bound(snapshot_base_next_pos_);
+                    last_dump_ts = snapshot_base_ts_;
+                }
             }
 
             bool need_rebuild = false;
@@ -323,11 +404,13 @@ class DeletedRecord {
                        DELETE_DUMP_BATCH_SIZE &&
                    it != accessor.end()) {
                 Timestamp dump_ts = 0;
+                std::vector<Offset> delta;
+                delta.reserve(DELETE_DUMP_BATCH_SIZE);
 
                 for (auto size = 0;
                      size < DELETE_DUMP_BATCH_SIZE && it != accessor.end();
                      ++it, ++size) {
-                    bitmap.set(it->second);
+                    delta.push_back(it->second);
                     dump_ts = it->first;
                 }
 
@@ -336,7 +419,7 @@ class DeletedRecord {
                     // were inserted before cursor (same timestamp,
                     // smaller row_id), making existing snapshots
                     // incorrect — those deletes are missing from
-                    // the bitmap. Discard all snapshots and rebuild
+                    // the chain. Discard all snapshots and rebuild
                     // from scratch.
                     need_rebuild = true;
                     break;
@@ -344,27 +427,30 @@ class DeletedRecord {
 
                 {
                     std::unique_lock<std::shared_mutex> lock(snap_lock_);
-                    if (dump_ts == last_dump_ts) {
-                        // only update
-                        snapshots_.back().second = bitmap.clone();
-                        snap_next_pos_.back() = *it;
+                    if (dump_ts == last_dump_ts &&
+                        !snapshot_layers_.empty()) {
+                        // only extend the last layer
+                        auto& layer = snapshot_layers_.back();
+                        layer.offsets.insert(
+                            layer.offsets.end(), delta.begin(), delta.end());
+                        layer.next_pos = *it;
                     } else {
-                        // add new snapshot
-                        snapshots_.push_back(
-                            std::make_pair(dump_ts, bitmap.clone()));
-                        snap_next_pos_.push_back(*it);
+                        // add new layer
+                        snapshot_layers_.push_back(
+                            {dump_ts, std::move(delta), *it});
                     }
+                    CompactSnapshotsUnlocked();
                 }
 
                 dumped_entry_count_.fetch_add(DELETE_DUMP_BATCH_SIZE);
                 LOG_INFO(
                     "dump delete record snapshot at ts: {}, cursor: {}, "
                     "total size:{} "
-                    "current snapshot size: {} for segment: {}",
+                    "current snapshot layers: {} for segment: {}",
                     dump_ts,
                     dumped_entry_count_.load(),
                     total_size,
-                    snapshots_.size(),
+                    snapshot_layers_.size(),
                     segment_id_);
                 last_dump_ts = dump_ts;
             }
@@ -372,13 +458,11 @@ class DeletedRecord {
             if (need_rebuild) {
                 {
                     std::unique_lock<std::shared_mutex> lock(snap_lock_);
-                    auto old_size = snapshots_.size();
-                    snapshots_.clear();
-                    snap_next_pos_.clear();
-                    dumped_entry_count_.store(0);
+                    auto old_size = snapshot_layers_.size();
+                    ResetSnapshotsUnlocked();
                     LOG_INFO(
                         "dump delete record snapshot detected elements "
-                        "before cursor, discarded {} snapshots and "
+                        "before cursor, discarded {} snapshot layers and "
                         "rebuilding from scratch, total size: {} "
                         "for segment: {}",
                         old_size,
@@ -403,6 +487,20 @@ class DeletedRecord {
         return mem_size_.load();
     }
 
+    // max timestamp of all pushed deletes
+    Timestamp
+    max_timestamp() const {
+        return max_timestamp_.load();
+    }
+
+    // the count of deletes taken effect, a mask of the deletes stays valid
+    // while it is unchanged; a delete is counted once visible to Query and
+    // to max_timestamp()
+    int64_t
+    version() const {
+        return n_.load();
+    }
+
     void
     set_sealed_row_count(size_t row_count) {
         sealed_row_count_ = row_count;
@@ -418,19 +516,88 @@ class DeletedRecord {
         get_insert_timestamp_func_ = std::move(func);
     }
 
+    // materialize the cumulative bitset of every layer, the base is folded
+    // into the first entry when present
     std::vector<std::pair<Timestamp, BitsetType>>
     get_snapshots() const {
         std::shared_lock<std::shared_mutex> lock(snap_lock_);
         std::vector<std::pair<Timestamp, BitsetType>> snapshots;
-        for (const auto& snap : snapshots_) {
-            snapshots.emplace_back(snap.first, snap.second.clone());
+        BitsetType bitmap = snapshot_base_.clone();
+        if (snapshot_base_ts_ > 0) {
+            snapshots.emplace_back(snapshot_base_ts_, bitmap.clone());
+        }
+        for (const auto& layer : snapshot_layers_) {
+            for (auto offset : layer.offsets) {
+                if (static_cast<size_t>(offset) >= bitmap.size()) {
+                    bitmap.resize(offset + 1);
+                }
+                bitmap.set(offset);
+            }
+            snapshots.emplace_back(layer.ts, bitmap.clone());
         }
         return snapshots;
     }
 
+    size_t
+    get_snapshot_layer_count() const {
+        std::shared_lock<std::shared_mutex> lock(snap_lock_);
+        return snapshot_layers_.size();
+    }
+
+ private:
+    Timestamp
+    LatestSnapshotTimestampUnlocked() const {
+        if (!snapshot_layers_.empty()) {
+            return snapshot_layers_.back().ts;
+        }
+        return snapshot_base_ts_;
+    }
+
+    void
+    ResetSnapshotsUnlocked() {
+        snapshot_base_.clear();
+        snapshot_base_ts_ = 0;
+        snapshot_base_next_pos_ = {};
+        snapshot_layers_.clear();
+        dumped_entry_count_.store(0);
+    }
+
+    // fold the oldest layers into the shared base once the chain gets long,
+    // so Query only applies O(delta) work for timestamps in the recent window.
+    // queries older than the new base fall back to walking the skip list.
+    void
+    CompactSnapshotsUnlocked() {
+        if (snapshot_layers_.size() <= DELETE_SNAPSHOT_MAX_LAYERS) {
+            return;
+        }
+        auto fold = snapshot_layers_.size() - DELETE_SNAPSHOT_MAX_LAYERS / 2;
+        int64_t bitsize = 0;
+        if constexpr (is_sealed) {
+            bitsize = sealed_row_count_;
+        } else {
+            bitsize = insert_record_->row_count();
+        }
+        if (snapshot_base_.size() < static_cast<size_t>(bitsize)) {
+            snapshot_base_.resize(bitsize);
+        }
+        for (size_t i = 0; i < fold; ++i) {
+            for (auto offset : snapshot_layers_[i].offsets) {
+                if (static_cast<size_t>(offset) >= snapshot_base_.size()) {
+                    snapshot_base_.resize(offset + 1);
+                }
+                snapshot_base_.set(offset);
+            }
+        }
+        snapshot_base_ts_ = snapshot_layers_[fold - 1].ts;
+        snapshot_base_next_pos_ = snapshot_layers_[fold - 1].next_pos;
+        snapshot_layers_.erase(snapshot_layers_.begin(),
+                               snapshot_layers_.begin() + fold);
+    }
+
  public:
     std::atomic<int64_t> n_ = 0;
     std::atomic<int64_t> mem_size_ = 0;
+    std::atomic<Timestamp> max_timestamp_ = 0;
     std::conditional_t<is_sealed, InsertRecordSealed, InsertRecordGrowing>*
         insert_record_;
     std::function<void(const std::vector<PkType>& pks,
@@ -445,12 +612,15 @@ class DeletedRecord {
     // used to remove duplicated deleted records for fast access
     BitsetType deleted_mask_;
 
-    // dump snapshot low frequency
+    // dump snapshot low frequency, stored as a shared base bitset plus a
+    // chain of small delta layers on top of it
     mutable std::shared_mutex snap_lock_;
-    std::vector<std::pair<Timestamp, BitsetType>> snapshots_;
-    // next delete record position that follows every snapshot
-    // store position (timestamp, offset)
-    std::vector<std::pair<Timestamp, Offset>> snap_next_pos_;
+    BitsetType snapshot_base_;
+    // timestamp of the last layer folded into the base, 0 if none
+    Timestamp snapshot_base_ts_{0};
+    // next delete record position that follows the base
+    std::pair<Timestamp, Offset> snapshot_base_next_pos_;
+    std::vector<DeleteSnapshotLayer> snapshot_layers_;
     // total number of delete entries that have been incorporated into snapshots
     std::atomic<int64_t> dumped_entry_count_{0};
     // estimated memory size of DeletedRecord, only used for sealed segment
@@ -910,3 +910,86 @@ TEST(DeleteMVCC, SnapshotDumpProgress) {
     ASSERT_EQ(2, snapshots.size());
     ASSERT_EQ(20000, snapshots[1].second.count());
 }
+
+TEST(DeleteMVCC, snapshot_layer_compaction) {
+    using namespace milvus;
+    using namespace milvus::query;
+    using namespace milvus::segcore;
+
+    auto schema = std::make_shared<Schema>();
+    schema->AddDebugField(
+        "fakevec", DataType::VECTOR_FLOAT, 16, knowhere::metric::L2);
+    auto i64_fid = schema->AddDebugField("age", DataType::INT64);
+    schema->set_primary_field_id(i64_fid);
+    auto N = 5000;
+    InsertRecord<false> insert_record(*schema, N);
+    DeletedRecord<false> delete_record(
+        &insert_record,
+        [&insert_record](
+            const std::vector<PkType>& pks,
+            const Timestamp* timestamps,
+            std::function<void(const SegOffset offset, const Timestamp ts)>
+                cb) {
+            for (size_t i = 0; i < pks.size(); ++i) {
+                auto timestamp = timestamps[i];
+                auto offsets = insert_record.search_pk(pks[i], timestamp);
+                for (auto offset : offsets) {
+                    cb(offset, timestamp);
+                }
+            }
+        },
+        0);
+
+    std::vector<int64_t> age_data(N);
+    std::vector<Timestamp> tss(N);
+    for (int i = 0; i < N; ++i) {
+        age_data[i] = i;
+        tss[i] = 0;
+        insert_record.insert_pk(age_data[i], i);
+    }
+    auto insert_offset = insert_record.reserved.fetch_add(N);
+    insert_record.timestamps_.set_data_raw(insert_offset, tss.data(), N);
+    auto field_data = insert_record.get_data_base(i64_fid);
+    field_data->set_data_raw(insert_offset, age_data.data(), N);
+    insert_record.ack_responder_.AddSegment(insert_offset, insert_offset + N);
+
+    auto origin_batch_size = DELETE_DUMP_BATCH_SIZE.load();
+    DELETE_DUMP_BATCH_SIZE.store(100);
+
+    // delete pk i at ts i + 1, one push per 50 rows
+    auto DN = 3000;
+    for (int start = 0; start < DN; start += 50) {
+        std::vector<Timestamp> delete_ts(50);
+        std::vector<PkType> delete_pk(50);
+        for (int i = 0; i < 50; ++i) {
+            delete_pk[i] = age_data[start + i];
+            delete_ts[i] = start + i + 1;
+        }
+        delete_record.StreamPush(delete_pk, delete_ts.data());
+    }
+    ASSERT_EQ(DN, delete_record.size());
+    ASSERT_LE(delete_record.get_snapshot_layer_count(),
+              DELETE_SNAPSHOT_MAX_LAYERS);
+
+    auto snapshots = delete_record.get_snapshots();
+    ASSERT_FALSE(snapshots.empty());
+    // every materialized snapshot is cumulative
+    for (const auto& [ts, bitmap] : snapshots) {
+        ASSERT_EQ(bitmap.count(), ts);
+    }
+
+    // queries before the base, inside the layer window and after the
+    // latest delete must all see exactly the deletes up to query ts
+    for (Timestamp query_timestamp : {1, 150, 1234, 2950, 2999, 4000}) {
+        BitsetType bitsets(N);
+        BitsetTypeView bitsets_view(bitsets);
+        delete_record.Query(bitsets_view, N, query_timestamp);
+        for (int i = 0; i < N; i++) {
+            bool expected = i < DN && i + 1 <= query_timestamp;
+            ASSERT_EQ(bitsets_view[i], expected)
+                << "ts: " << query_timestamp << ", offset: " << i;
+        }
+    }
+
+    DELETE_DUMP_BATCH_SIZE.store(origin_batch_size);
+}
@@ -0,0 +1,95 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "segcore/EntityTTLIndex.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "common/EasyAssert.h"
+
+namespace milvus::segcore {
+
+EntityTTLIndex::EntityTTLIndex(
+    std::vector<std::pair<int64_t, int64_t>> expiries, int64_t num_rows)
+    : num_rows_(num_rows) {
+    AssertInfo(num_rows <= std::numeric_limits<uint32_t>::max(),
+               "too many rows for entity ttl index: {}",
+               num_rows);
+    // by row within an expiry, so the rows expiring together clear as runs
+    std::sort(expiries.begin(), expiries.end());
+    expiries_.reserve(expiries.size());
+    rows_.reserve(expiries.size());
+    for (const auto& [expiry, row] : expiries) {
+        expiries_.push_back(expiry);
+        rows_.push_back(static_cast<uint32_t>(row));
+    }
+}
+
+std::shared_ptr<EntityTTLIndex>
+EntityTTLIndex::Build(milvus::OpContext* op_ctx,
+                      const ChunkedColumnInterface& column) {
+    std::vector<std::pair<int64_t, int64_t>> expiries;
+    expiries.reserve(column.NumRows());
+    int64_t offset = 0;
+    for (int64_t chunk_id = 0; chunk_id < column.num_chunks(); ++chunk_id) {
+        auto pw = column.Span(op_ctx, chunk_id);
+        const auto& span = pw.get();
+        auto data = static_cast<const int64_t*>(span.data());
+        auto valid_data = span.valid_data();
+        for (int64_t i = 0; i < span.row_count(); ++i) {
+            if (valid_data == nullptr || valid_data[i]) {
+                expiries.emplace_back(data[i], offset + i);
+            }
+        }
+        offset += span.row_count();
+    }
+    return std::make_shared<EntityTTLIndex>(std::move(expiries), offset);
+}
+
+std::shared_ptr<const TargetBitmap>
+EntityTTLIndex::AliveAt(int64_t physical_us) {
+    // the rows expiring at or before physical_us
+    size_t expired =
+        std::upper_bound(expiries_.begin(), expiries_.end(), physical_us) -
+        expiries_.begin();
+
+    std::lock_guard lck(mutex_);
+    if (cached_ != nullptr && cached_expired_ == expired) {
+        return cached_;
+    }
+    std::shared_ptr<TargetBitmap> alive;
+    size_t begin = 0;
+    if (cached_ != nullptr && cached_expired_ < expired) {
+        alive = std::make_shared<TargetBitmap>(*cached_);
+        begin = cached_expired_;
+    } else {
+        alive = std::make_shared<TargetBitmap>(num_rows_, true);
+    }
+    for (size_t i = begin; i < expired;) {
+        size_t end = i + 1;
+        while (end < expired && rows_[end] == rows_[end - 1] + 1) {
+            ++end;
+        }
+        alive->reset(rows_[i], end - i);
+        i = end;
+    }
+    cached_ = alive;
+    cached_expired_ = expired;
+    return cached_;
+}
+
+}  // namespace milvus::segcore
@@ -0,0 +1,70 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "common/OpContext.h"
+#include "common/Types.h"
+#include "mmap/ChunkedColumnInterface.h"
+
+namespace milvus::segcore {
+
+// The rows of a sealed segment in the order of their entity TTL expiry, so
+// the rows alive at a time are all rows but a prefix of the order instead of
+// a scan of the TTL column.
+//
+// The alive rows only change when the time crosses an expiry, so the bitmap
+// of the last time asked stays valid up to the next one and is kept. A later
+// time copies it and clears the rows expired since, a run of adjacent rows at
+// once.
+class EntityTTLIndex {
+ public:
+    // (expiry, row) of the rows with an expiry, the others never expire
+    EntityTTLIndex(std::vector<std::pair<int64_t, int64_t>> expiries,
+                   int64_t num_rows);
+
+    // the index of a TTL field column, its null rows never expire
+    static std::shared_ptr<EntityTTLIndex>
+    Build(milvus::OpContext* op_ctx, const ChunkedColumnInterface& column);
+
+    // the rows whose expiry is later than `physical_us` or unset
+    std::shared_ptr<const TargetBitmap>
+    AliveAt(int64_t physical_us);
+
+    int64_t
+    num_rows() const {
+        return num_rows_;
+    }
+
+ private:
+    int64_t num_rows_;
+    // ascending, the expiry of rows_[i]
+    std::vector<int64_t> expiries_;
+    std::vector<uint32_t> rows_;
+
+    std::mutex mutex_;
+    // the alive rows once rows_[0, cached_expired_) expired
+    size_t cached_expired_ = 0;
+    std::shared_ptr<const TargetBitmap> cached_;
+};
+
+}  // namespace milvus::segcore
@@ -0,0 +1,73 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <utility>
+#include <vector>
+
+#include "segcore/EntityTTLIndex.h"
+
+using milvus::segcore::EntityTTLIndex;
+
+namespace {
+
+std::vector<bool>
+Bits(const milvus::TargetBitmap& bitmap) {
+    std::vector<bool> bits;
+    for (size_t i = 0; i < bitmap.size(); ++i) {
+        bits.push_back(bitmap[i]);
+    }
+    return bits;
+}
+
+}  // namespace
+
+TEST(EntityTTLIndexTest, AliveRowsAtTimes) {
+    // rows 2 and 5 have no ttl, rows 0, 1 and 3, 4 expire together
+    EntityTTLIndex index({{300, 0}, {300, 1}, {100, 3}, {100, 4}, {200, 6}},
+                         7);
+    EXPECT_EQ(index.num_rows(), 7);
+
+    auto all = index.AliveAt(50);
+    EXPECT_EQ(all->count(), 7);
+    // expiry is exclusive, no row expires before its time
+    EXPECT_EQ(index.AliveAt(99), all);
+
+    auto at100 = index.AliveAt(100);
+    EXPECT_EQ(Bits(*at100),
+              (std::vector<bool>{true, true, true, false, false, true, true}));
+    // the same bucket, the same bitmap
+    EXPECT_EQ(index.AliveAt(150), at100);
+
+    auto at300 = index.AliveAt(1000);
+    EXPECT_EQ(Bits(*at300),
+              (std::vector<bool>{
+                  false, false, true, false, false, true, false}));
+    // the earlier bitmaps are not touched by later times
+    EXPECT_EQ(at100->count(), 5);
+
+    // back in time builds from all rows again
+    auto again = index.AliveAt(250);
+    EXPECT_EQ(Bits(*again),
+              (std::vector<bool>{true, true, true, false, false, true, false}));
+}
+
+TEST(EntityTTLIndexTest, NoExpiries) {
+    EntityTTLIndex index({}, 3);
+    EXPECT_EQ(index.AliveAt(0)->count(), 3);
+    EXPECT_EQ(index.AliveAt(1LL << 60), index.AliveAt(0));
+}
@@ -0,0 +1,308 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "segcore/ExternalTakePlanner.h"
+
+#include <arrow/array/builder_primitive.h>
+#include <arrow/compute/api_vector.h>
+#include <arrow/util/byte_size.h>
+#include <algorithm>
+#include <future>
+#include <numeric>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "common/Common.h"
+#include "segcore/memory_planner.h"
+#include "storage/ThreadPools.h"
+
+namespace milvus::segcore {
+
+std::vector<TakeChunk>
+PlanTakeChunks(const std::vector<int64_t>& offsets,
+               const std::vector<int64_t>& chunk_row_starts) {
+    std::vector<TakeChunk> plan;
+    if (chunk_row_starts.size() < 2) {
+        return plan;
+    }
+    auto num_chunks = static_cast<int64_t>(chunk_row_starts.size() - 1);
+    for (auto offset : offsets) {
+        if (!plan.empty() && offset < chunk_row_starts[plan.back().chunk + 1]) {
+            plan.back().rows.push_back(offset -
+                                       chunk_row_starts[plan.back().chunk]);
+            continue;
+        }
+        auto it = std::upper_bound(
+            chunk_row_starts.begin(), chunk_row_starts.end(), offset);
+        auto chunk = static_cast<int64_t>(it - chunk_row_starts.begin()) - 1;
+        if (chunk < 0 || chunk >= num_chunks) {
+            continue;
+        }
+        plan.push_back({chunk, {offset - chunk_row_starts[chunk]}});
+    }
+    return plan;
+}
+
+arrow::Result<std::shared_ptr<arrow::Table>>
+ExternalTakePlanner::Take(milvus_storage::api::Reader& reader,
+                          const std::vector<int64_t>& offsets,
+                          const std::vector<std::string>& needed_columns,
+                          uint64_t parallelism) {
+    auto column_groups = reader.get_column_groups();
+    if (!column_groups || offsets.empty()) {
+        return arrow::Status::NotImplemented(
+            "take planner needs the column groups of the reader");
+    }
+
+    // the needed columns of each column group, each taken from the first
+    // group holding it
+    std::unordered_set<std::string> pending(needed_columns.begin(),
+                                            needed_columns.end());
+    std::vector<std::pair<int64_t, std::vector<std::string>>> groups;
+    for (size_t i = 0; i < column_groups->size() && !pending.empty(); ++i) {
+        std::vector<std::string> columns;
+        for (const auto& column : column_groups->at(i)->columns) {
+            if (pending.erase(column) > 0) {
+                columns.push_back(column);
+            }
+        }
+        if (!columns.empty()) {
+            groups.emplace_back(static_cast<int64_t>(i), std::move(columns));
+        }
+    }
+    if (!pending.empty()) {
+        return arrow::Status::KeyError("column ",
+                                       *pending.begin(),
+                                       " is in no column group");
+    }
+
+    std::vector<std::shared_ptr<arrow::Field>> fields;
+    std::vector<std::shared_ptr<arrow::ChunkedArray>> columns;
+    for (const auto& [column_group, group_columns] : groups) {
+        std::string key = std::to_string(column_group);
+        for (const auto& column : group_columns) {
+            key += "/" + column;
+        }
+        ARROW_ASSIGN_OR_RAISE(
+            auto cg_reader,
+            GetColumnGroupReader(reader, column_group, group_columns, key));
+        ARROW_ASSIGN_OR_RAISE(
+            auto table,
+            TakeColumnGroup(
+                *cg_reader, key, offsets, group_columns, parallelism));
+        for (int i = 0; i < table->num_columns(); ++i) {
+            fields.push_back(table->schema()->field(i));
+            columns.push_back(table->column(i));
+        }
+    }
+    return arrow::Table::Make(arrow::schema(std::move(fields)),
+                              std::move(columns));
+}
+
+void
+ExternalTakePlanner::Reset() {
+    column_group_readers_.clear();
+    lru_.clear();
+    cache_.clear();
+    cached_bytes_ = 0;
+}
+
+arrow::Result<ExternalTakePlanner::ColumnGroupReader*>
+ExternalTakePlanner::GetColumnGroupReader(
+    milvus_storage::api::Reader& reader,
+    int64_t column_group,
+    const std::vector<std::string>& columns,
+    const std::string& key) {
+    auto it = column_group_readers_.find(key);
+    if (it != column_group_readers_.end()) {
+        return &it->second;
+    }
+    ARROW_ASSIGN_OR_RAISE(
+        auto chunk_reader,
+        reader.get_chunk_reader(
+            column_group, std::make_shared<std::vector<std::string>>(columns)));
+    ARROW_ASSIGN_OR_RAISE(auto chunk_rows, chunk_reader->get_chunk_rows());
+
+    ColumnGroupReader cg_reader;
+    cg_reader.reader = std::move(chunk_reader);
+    cg_reader.chunk_row_starts.reserve(chunk_rows.size() + 1);
+    cg_reader.chunk_row_starts.push_back(0);
+    for (auto rows : chunk_rows) {
+        cg_reader.chunk_row_starts.push_back(
+            cg_reader.chunk_row_starts.back() + static_cast<int64_t>(rows));
+    }
+    return &column_group_readers_.emplace(key, std::move(cg_reader))
+                .first->second;
+}
+
+arrow::Result<std::shared_ptr<arrow::Table>>
+ExternalTakePlanner::TakeColumnGroup(ColumnGroupReader& cg_reader,
+                                     const std::string& key,
+                                     const std::vector<int64_t>& offsets,
+                                     const std::vector<std::string>& columns,
+                                     uint64_t parallelism) {
+    auto plan = PlanTakeChunks(offsets, cg_reader.chunk_row_starts);
+    size_t planned_rows = 0;
+    for (const auto& chunk : plan) {
+        planned_rows += chunk.rows.size();
+    }
+    if (planned_rows != offsets.size()) {
+        return arrow::Status::IndexError("take offsets beyond the ",
+                                         cg_reader.chunk_row_starts.back(),
+                                         " rows of the column group");
+    }
+    std::vector<std::shared_ptr<arrow::RecordBatch>> decoded(plan.size());
+    std::vector<int64_t> missing;
+    for (size_t i = 0; i < plan.size(); ++i) {
+        decoded[i] = Lookup({key, plan[i].chunk});
+        if (!decoded[i]) {
+            missing.push_back(plan[i].chunk);
+        }
+    }
+
+    if (!missing.empty()) {
+        // each run of adjacent row groups is one get_chunks() call, the long
+        // runs split to spread over `parallelism` reads
+        ParallelDegreeSplitStrategy strategy(
+            std::max<uint64_t>(parallelism, 1));
+        auto blocks = strategy.split(missing);
+        auto& pool =
+            ThreadPools::GetThreadPool(milvus::ThreadPoolPriority::MIDDLE);
+        std::vector<std::future<
+            arrow::Result<std::vector<std::shared_ptr<arrow::RecordBatch>>>>>
+            futures;
+        futures.reserve(blocks.size());
+        for (const auto& block : blocks) {
+            futures.emplace_back(pool.Submit(
+                [chunk_reader = cg_reader.reader.get(), block]() {
+                    std::vector<int64_t> chunk_ids(block.count);
+                    std::iota(chunk_ids.begin(), chunk_ids.end(), block.offset);
+                    return chunk_reader->get_chunks(chunk_ids, 1);
+                }));
+        }
+
+        // wait for every read before failing, the tasks use the chunk reader
+        std::unordered_map<int64_t, std::shared_ptr<arrow::RecordBatch>> read;
+        arrow::Status status;
+        for (size_t b = 0; b < futures.size(); ++b) {
+            auto result = futures[b].get();
+            if (!result.ok()) {
+                status &= result.status();
+                continue;
+            }
+            auto& batches = result.ValueUnsafe();
+            if (static_cast<int64_t>(batches.size()) != blocks[b].count) {
+                status &= arrow::Status::Invalid("read ",
+                                                 batches.size(),
+                                                 " row groups of ",
+                                                 blocks[b].count);
+                continue;
+            }
+            for (int64_t j = 0; j < blocks[b].count; ++j) {
+                read[blocks[b].offset + j] = std::move(batches[j]);
+            }
+        }
+        ARROW_RETURN_NOT_OK(status);
+        for (size_t i = 0; i < plan.size(); ++i) {
+            if (!decoded[i]) {
+                decoded[i] = read.at(plan[i].chunk);
+                Insert({key, plan[i].chunk}, decoded[i]);
+            }
+        }
+    }
+
+    // copy out the requested rows only, the row groups stay as read
+    std::vector<std::shared_ptr<arrow::RecordBatch>> taken;
+    taken.reserve(plan.size());
+    std::shared_ptr<arrow::Schema> schema;
+    for (size_t i = 0; i < plan.size(); ++i) {
+        arrow::Int64Builder indices_builder;
+        ARROW_RETURN_NOT_OK(indices_builder.AppendValues(plan[i].rows));
+        ARROW_ASSIGN_OR_RAISE(auto indices, indices_builder.Finish());
+
+        std::vector<std::shared_ptr<arrow::Field>> fields;
+        std::vector<std::shared_ptr<arrow::Array>> arrays;
+        for (const auto& column : columns) {
+            auto index = decoded[i]->schema()->GetFieldIndex(column);
+            if (index < 0) {
+                return arrow::Status::KeyError(
+                    "column ", column, " is not in row group ", plan[i].chunk);
+            }
+            ARROW_ASSIGN_OR_RAISE(
+                auto array,
+                arrow::compute::Take(*decoded[i]->column(index), *indices));
+            fields.push_back(decoded[i]->schema()->field(index));
+            arrays.push_back(std::move(array));
+        }
+        if (!schema) {
+            schema = arrow::schema(std::move(fields));
+        }
+        taken.push_back(arrow::RecordBatch::Make(
+            schema, plan[i].rows.size(), std::move(arrays)));
+    }
+    if (!schema) {
+        return arrow::Status::IndexError("no row group holds the offsets");
+    }
+    return arrow::Table::FromRecordBatches(schema, taken);
+}
+
+std::shared_ptr<arrow::RecordBatch>
+ExternalTakePlanner::Lookup(const CacheKey& key) {
+    auto it = cache_.find(key);
+    if (it == cache_.end()) {
+        return nullptr;
+    }
+    auto entry = it->second;
+    if (entry->expire_at <= std::chrono::steady_clock::now()) {
+        cached_bytes_ -= entry->bytes;
+        lru_.erase(entry);
+        cache_.erase(it);
+        return nullptr;
+    }
+    lru_.splice(lru_.end(), lru_, entry);
+    return entry->batch;
+}
+
+void
+ExternalTakePlanner::Insert(const CacheKey& key,
+                            std::shared_ptr<arrow::RecordBatch> batch) {
+    auto capacity = EXTERNAL_TAKE_CACHE_CAPACITY.load();
+    auto bytes = static_cast<int64_t>(arrow::util::TotalBufferSize(*batch));
+    if (bytes > capacity || cache_.count(key) > 0) {
+        return;
+    }
+    auto now = std::chrono::steady_clock::now();
+    // the expired entries go first, then the least recently used ones
+    for (auto it = lru_.begin(); it != lru_.end();) {
+        if (it->expire_at > now) {
+            ++it;
+            continue;
+        }
+        cached_bytes_ -= it->bytes;
+        cache_.erase(it->key);
+        it = lru_.erase(it);
+    }
+    while (!lru_.empty() && cached_bytes_ + bytes > capacity) {
+        cached_bytes_ -= lru_.front().bytes;
+        cache_.erase(lru_.front().key);
+        lru_.pop_front();
+    }
+    lru_.push_back({key, std::move(batch), bytes, now + kCacheTtl});
+    cache_.emplace(key, std::prev(lru_.end()));
+    cached_bytes_ += bytes;
+}
+
+}  // namespace milvus::segcore
@@ -0,0 +1,124 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <arrow/record_batch.h>
+#include <arrow/result.h>
+#include <arrow/table.h>
+#include <chrono>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "milvus-storage/reader.h"
+
+namespace milvus::segcore {
+
+// A row group a take reads and the rows it keeps of it.
+struct TakeChunk {
+    int64_t chunk;
+    // offsets within the row group, ascending
+    std::vector<int64_t> rows;
+};
+
+// Maps the ascending, unique segment offsets to the row groups holding them,
+// chunk_row_starts[i] being the first offset of row group i and the last
+// entry the number of rows. The row groups come out ascending.
+std::vector<TakeChunk>
+PlanTakeChunks(const std::vector<int64_t>& offsets,
+               const std::vector<int64_t>& chunk_row_starts);
+
+// Serves the take of an external segment from the row groups of its column
+// groups instead of reader->take() per row: the row groups holding the
+// requested offsets are read in coalesced runs of adjacent ones, in parallel,
+// and only the requested rows are copied out of them. The decoded row groups
+// stay cached for a short while, so the follow-up takes of a search hitting
+// the same row groups don't read them again.
+//
+// Not thread-safe, the segment serializes it with the reader it takes from.
+class ExternalTakePlanner {
+ public:
+    // how long a decoded row group stays cached
+    static constexpr std::chrono::milliseconds kCacheTtl{5000};
+    // the row group reads of a take in flight at once
+    static constexpr uint64_t kReadParallelism = 4;
+
+    // The rows `offsets` (ascending, unique) of `needed_columns` in
+    // `reader`, a table with a column of each name. NotImplemented when the
+    // reader doesn't expose its column groups, the caller falls back to
+    // reader.take() then.
+    arrow::Result<std::shared_ptr<arrow::Table>>
+    Take(milvus_storage::api::Reader& reader,
+         const std::vector<int64_t>& offsets,
+         const std::vector<std::string>& needed_columns,
+         uint64_t parallelism);
+
+    // Drops the chunk readers and the cached row groups, for a new reader.
+    void
+    Reset();
+
+    int64_t
+    cached_bytes() const {
+        return cached_bytes_;
+    }
+
+ private:
+    struct ColumnGroupReader {
+        std::shared_ptr<milvus_storage::api::ChunkReader> reader;
+        std::vector<int64_t> chunk_row_starts;
+    };
+
+    // the row groups of one projection of one column group
+    using CacheKey = std::pair<std::string, int64_t>;
+    struct CacheEntry {
+        CacheKey key;
+        std::shared_ptr<arrow::RecordBatch> batch;
+        int64_t bytes;
+        std::chrono::steady_clock::time_point expire_at;
+    };
+
+    arrow::Result<ColumnGroupReader*>
+    GetColumnGroupReader(milvus_storage::api::Reader& reader,
+                         int64_t column_group,
+                         const std::vector<std::string>& columns,
+                         const std::string& key);
+
+    // the rows of `columns` at `offsets` of one column group
+    arrow::Result<std::shared_ptr<arrow::Table>>
+    TakeColumnGroup(ColumnGroupReader& cg_reader,
+                    const std::string& key,
+                    const std::vector<int64_t>& offsets,
+                    const std::vector<std::string>& columns,
+                    uint64_t parallelism);
+
+    std::shared_ptr<arrow::RecordBatch>
+    Lookup(const CacheKey& key);
+
+    void
+    Insert(const CacheKey& key, std::shared_ptr<arrow::RecordBatch> batch);
+
+    std::map<std::string, ColumnGroupReader> column_group_readers_;
+    // least recently used first
+    std::list<CacheEntry> lru_;
+    std::map<CacheKey, std::list<CacheEntry>::iterator> cache_;
+    int64_t cached_bytes_ = 0;
+};
+
+}  // namespace milvus::segcore
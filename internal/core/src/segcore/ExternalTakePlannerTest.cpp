@@ -0,0 +1,49 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "segcore/ExternalTakePlanner.h"
+
+using milvus::segcore::PlanTakeChunks;
+
+TEST(ExternalTakePlannerTest, PlansRowGroupsOfOffsets) {
+    // row groups of 10, 5 and 20 rows
+    std::vector<int64_t> starts{0, 10, 15, 35};
+
+    auto plan = PlanTakeChunks({0, 3, 9, 15, 34}, starts);
+    ASSERT_EQ(plan.size(), 2);
+    EXPECT_EQ(plan[0].chunk, 0);
+    EXPECT_EQ(plan[0].rows, (std::vector<int64_t>{0, 3, 9}));
+    EXPECT_EQ(plan[1].chunk, 2);
+    EXPECT_EQ(plan[1].rows, (std::vector<int64_t>{0, 19}));
+
+    plan = PlanTakeChunks({10, 14}, starts);
+    ASSERT_EQ(plan.size(), 1);
+    EXPECT_EQ(plan[0].chunk, 1);
+    EXPECT_EQ(plan[0].rows, (std::vector<int64_t>{0, 4}));
+
+    // offsets past the rows are left out
+    plan = PlanTakeChunks({20, 35, 40}, starts);
+    ASSERT_EQ(plan.size(), 1);
+    EXPECT_EQ(plan[0].rows, (std::vector<int64_t>{5}));
+
+    EXPECT_TRUE(PlanTakeChunks({1}, {0}).empty());
+    EXPECT_TRUE(PlanTakeChunks({}, starts).empty());
+}
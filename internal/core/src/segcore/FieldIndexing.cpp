@@ -50,6 +50,7 @@
 #include "storage/ChunkManager.h"
 #include "storage/FileManager.h"
 #include "storage/LocalChunkManagerSingleton.h"
+#include "storage/ThreadPools.h"
 
 namespace milvus::segcore {
 using std::unique_ptr;
@@ -158,6 +159,55 @@ IndexingRecord::AppendingIndex(int64_t reserved_offset,
     }
 }
 
+namespace {
+
+// Calls fn(rows, count) for each piece of rows [begin, end) of a dense
+// ConcurrentVector that lies within one chunk.
+template <typename Fn>
+void
+ForEachDenseRowRange(const VectorBase* field_raw_data,
+                     int64_t begin,
+                     int64_t end,
+                     size_t vec_length,
+                     Fn&& fn) {
+    auto size_per_chunk = field_raw_data->get_size_per_chunk();
+    while (begin < end) {
+        auto chunk_id = begin / size_per_chunk;
+        auto piece_end = std::min(end, (chunk_id + 1) * size_per_chunk);
+        auto chunk_data =
+            static_cast<const char*>(field_raw_data->get_chunk_data(chunk_id));
+        fn(chunk_data + (begin - chunk_id * size_per_chunk) * vec_length,
+           piece_end - begin);
+        begin = piece_end;
+    }
+}
+
+// The first `count` rows of a dense ConcurrentVector in one buffer: the
+// first chunk itself when they fit in it, a copy into `buf` otherwise.
+const char*
+GatherDenseRows(const VectorBase* field_raw_data,
+                int64_t count,
+                size_t vec_length,
+                std::unique_ptr<char[]>& buf) {
+    if (count <= field_raw_data->get_size_per_chunk()) {
+        return static_cast<const char*>(field_raw_data->get_chunk_data(0));
+    }
+    buf = std::make_unique<char[]>(count * vec_length);
+    auto dst = buf.get();
+    ForEachDenseRowRange(
+        field_raw_data,
+        0,
+        count,
+        vec_length,
+        [&](const char* rows, int64_t rows_count) {
+            milvus::fastmem::FastMemcpy(dst, rows, rows_count * vec_length);
+            dst += rows_count * vec_length;
+        });
+    return buf.get();
+}
+
+}  // namespace
+
 VectorFieldIndexing::VectorFieldIndexing(const FieldMeta& field_meta,
                                          const FieldIndexMeta& field_index_meta,
                                          int64_t segment_max_row_count,
@@ -175,6 +225,61 @@ VectorFieldIndexing::VectorFieldIndexing(const FieldMeta& field_meta,
     recreate_index(field_meta.get_data_type(), field_raw_data);
 }
 
+VectorFieldIndexing::~VectorFieldIndexing() {
+    // the build reads the raw data and this index, keep both alive until
+    // it is done
+    if (build_future_.valid()) {
+        build_future_.wait();
+    }
+}
+
+void
+VectorFieldIndexing::build_in_background(const VectorBase* field_raw_data,
+                                         size_t vec_length) {
+    auto dim = get_dim();
+    auto conf = get_build_params(get_data_type());
+    auto build_threshold = get_build_threshold();
+    try {
+        {
+            std::unique_ptr<char[]> data_buf;
+            auto data_ptr = GatherDenseRows(
+                field_raw_data, build_threshold, vec_length, data_buf);
+            auto dataset = knowhere::GenDataSet(build_threshold, dim, data_ptr);
+            index_->BuildWithDataset(dataset, conf);
+            index_cur_.store(build_threshold);
+        }
+        while (true) {
+            int64_t end;
+            {
+                std::lock_guard<std::mutex> lock(build_mutex_);
+                end = pending_end_;
+                if (index_cur_.load() >= end) {
+                    built_ = true;
+                    sync_with_index_.store(true);
+                    building_ = false;
+                    return;
+                }
+            }
+            ForEachDenseRowRange(
+                field_raw_data,
+                index_cur_.load(),
+                end,
+                vec_length,
+                [&](const char* rows, int64_t count) {
+                    auto dataset = knowhere::GenDataSet(count, dim, rows);
+                    index_->AddWithDataset(dataset, conf);
+                    index_cur_.fetch_add(count);
+                });
+        }
+    } catch (std::exception& error) {
+        LOG_ERROR("growing index background build error: {}", error.what());
+        std::lock_guard<std::mutex> lock(build_mutex_);
+        recreate_index(get_data_type(), field_raw_data);
+        index_cur_.store(0);
+        building_ = false;
+    }
+}
+
 void
 VectorFieldIndexing::recreate_index(DataType data_type,
                                     const VectorBase* field_raw_data) {
@@ -411,7 +516,6 @@ VectorFieldIndexing::AppendSegmentIndexDense(int64_t reserved_offset,
                "VECTOR_FLOAT16,VECTOR_BFLOAT16)");
     auto dim = get_dim();
     auto conf = get_build_params(get_data_type());
-    auto size_per_chunk = field_raw_data->get_size_per_chunk();
     auto build_threshold = get_build_threshold();
     bool is_mapping_storage = field_raw_data->is_mapping_storage();
     auto valid_data = field_raw_data->get_valid_data();
@@ -426,40 +530,28 @@ VectorFieldIndexing::AppendSegmentIndexDense(int64_t reserved_offset,
     } else {
         vec_length = dim * sizeof(bfloat16);
     }
+    if (segcore_config_.get_enable_async_interim_index_build() &&
+        valid_data.empty()) {
+        std::lock_guard<std::mutex> lock(build_mutex_);
+        if (building_) {
+            pending_end_ = std::max(pending_end_, reserved_offset + size);
+            return;
+        }
+        if (!built_) {
+            building_ = true;
+            pending_end_ = reserved_offset + size;
+            auto& pool = ThreadPools::GetThreadPool(ThreadPoolPriority::LOW);
+            build_future_ = pool.Submit([this, field_raw_data, vec_length]() {
+                build_in_background(field_raw_data, vec_length);
+            });
+            return;
+        }
+    }
     if (!built_) {
-        const void* data_ptr;
-        std::unique_ptr<char[]> data_buf;
         // Chunk data stores valid vectors compactly for both nullable and non-nullable
-        int64_t start_chunk = 0;
-        int64_t end_chunk = (build_threshold - 1) / size_per_chunk;
-
-        if (start_chunk == end_chunk) {
-            auto chunk_data = static_cast<const char*>(
-                field_raw_data->get_chunk_data(start_chunk));
-            data_ptr = chunk_data;
-        } else {
-            data_buf = std::make_unique<char[]>(build_threshold * vec_length);
-            int64_t actual_copy_count = 0;
-            for (int64_t chunk_id = start_chunk; chunk_id <= end_chunk;
-                 ++chunk_id) {
-                auto chunk_data = static_cast<const char*>(
-                    field_raw_data->get_chunk_data(chunk_id));
-                int64_t copy_start =
-                    std::max((int64_t)0, chunk_id * size_per_chunk);
-                int64_t copy_end =
-                    std::min(build_threshold, (chunk_id + 1) * size_per_chunk);
-                int64_t copy_count = copy_end - copy_start;
-                auto src =
-                    chunk_data +
-                    (copy_start - chunk_id * size_per_chunk) * vec_length;
-                milvus::fastmem::FastMemcpy(
-                    data_buf.get() + actual_copy_count * vec_length,
-                    src,
-                    copy_count * vec_length);
-                actual_copy_count += copy_count;
-            }
-            data_ptr = data_buf.get();
-        }
+        std::unique_ptr<char[]> data_buf;
+        const void* data_ptr = GatherDenseRows(
+            field_raw_data, build_threshold, vec_length, data_buf);
 
         auto dataset = knowhere::GenDataSet(build_threshold, dim, data_ptr);
         try {
@@ -16,8 +16,10 @@
 #include <index/ScalarIndex.h>
 #include <atomic>
 #include <cstdint>
+#include <future>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <type_traits>
 #include <unordered_map>
@@ -57,6 +59,8 @@ class FieldIndexing {
                        !IsSparseFloatVectorDataType(field_meta.get_data_type())
                    ? field_meta.get_dim()
                    : 1),
+          size_per_chunk_(segcore_config.get_field_chunk_rows(
+              field_meta, segcore_config.get_chunk_rows())),
           segcore_config_(segcore_config) {
     }
     FieldIndexing(const FieldIndexing&) = delete;
@@ -121,7 +125,7 @@ class FieldIndexing {
 
     int64_t
     get_size_per_chunk() const {
-        return segcore_config_.get_chunk_rows();
+        return size_per_chunk_;
     }
 
     virtual PinWrapper<index::IndexBase*>
@@ -134,6 +138,7 @@ class FieldIndexing {
     // additional info
     const DataType data_type_;
     const int64_t dim_;
+    const int64_t size_per_chunk_;
     const SegcoreConfig& segcore_config_;
 };
 
@@ -277,6 +282,8 @@ class VectorFieldIndexing : public FieldIndexing {
                                  const SegcoreConfig& segcore_config,
                                  const VectorBase* field_raw_data);
 
+    ~VectorFieldIndexing() override;
+
     void
     AppendSegmentIndexDense(int64_t reserved_offset,
                             int64_t size,
@@ -349,6 +356,13 @@ class VectorFieldIndexing : public FieldIndexing {
  private:
     void
     recreate_index(DataType data_type, const VectorBase* field_raw_data);
+
+    // Builds the index over the first build threshold rows of the raw data,
+    // then adds the rows inserted meanwhile, until it has caught up with
+    // pending_end_. Runs on the LOW thread pool.
+    void
+    build_in_background(const VectorBase* field_raw_data, size_t vec_length);
+
     // current number of rows in index.
     std::atomic<idx_t> index_cur_ = 0;
     // whether the growing index has been built.
@@ -359,6 +373,13 @@ class VectorFieldIndexing : public FieldIndexing {
     std::unique_ptr<VecIndexConfig> config_;
     std::unique_ptr<index::VectorIndex> index_;
     tbb::concurrent_vector<std::unique_ptr<index::VectorIndex>> data_;
+
+    // guards building_ and pending_end_ during a background build: inserts
+    // only push pending_end_ forward and leave their rows to the build
+    std::mutex build_mutex_;
+    bool building_ = false;
+    int64_t pending_end_ = 0;
+    std::future<void> build_future_;
 };
 
 std::unique_ptr<FieldIndexing>
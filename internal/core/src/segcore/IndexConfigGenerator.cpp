@@ -20,6 +20,7 @@
 #include "glog/logging.h"
 #include "knowhere/comp/index_param.h"
 #include "log/Log.h"
+#include "common/Utils.h"
 #include "nlohmann/json.hpp"
 #include "segcore/SegcoreConfig.h"
 
@@ -152,4 +153,24 @@ VecIndexConfig::GetSearchConf(const SearchInfo& searchInfo) {
     return searchParam;
 }
 
+int64_t
+EstimateInterimQuantizedIndexRowBytes(const SegcoreConfig& config,
+                                      int64_t dim) {
+    auto sub_dim = std::max<int64_t>(config.get_sub_dim(), 1);
+    auto code_bytes = (upper_div(dim, sub_dim) + 1) / 2;
+    int64_t refine_bytes = 0;
+    switch (config.get_refine_quant_type()) {
+        case knowhere::RefineType::UINT8_QUANT:
+            refine_bytes = dim;
+            break;
+        case knowhere::RefineType::FLOAT16_QUANT:
+        case knowhere::RefineType::BFLOAT16_QUANT:
+            refine_bytes = dim * 2;
+            break;
+        default:
+            break;
+    }
+    return code_bytes + static_cast<int64_t>(sizeof(int64_t)) + refine_bytes;
+}
+
 }  // namespace milvus::segcore
\ No newline at end of file
@@ -77,4 +77,12 @@ class VecIndexConfig {
 
     knowhere::Json search_params_;
 };
+
+// Bytes per row a dense SCANN_DVR interim index keeps besides the raw vectors
+// it refines from through the data view: the 4-bit PQ code of every sub_dim
+// dimensions and the row id in its inverted list, plus the quantized copy of
+// the vector when the refine type is not DATA_VIEW.
+int64_t
+EstimateInterimQuantizedIndexRowBytes(const SegcoreConfig& config,
+                                      int64_t dim);
 }  // namespace milvus::segcore
\ No newline at end of file
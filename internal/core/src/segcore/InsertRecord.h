@@ -14,11 +14,14 @@
 #include <algorithm>
 #include <numeric>
 #include <cstddef>
+#include <functional>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <optional>
 #include <shared_mutex>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -26,6 +29,7 @@
 #include "TimestampData.h"
 #include "TimestampIndex.h"
 #include "common/ArrayOffsets.h"
+#include "common/BloomFilter.h"
 #include "common/EasyAssert.h"
 #include "common/Schema.h"
 #include "common/TrackingStdAllocator.h"
@@ -46,6 +50,53 @@ constexpr int64_t BruteForceSelectivity = 10;
 
 using Condition = std::function<bool(int64_t)>;
 
+// False positive rate of the per-segment pk filter, about 10 bits per row.
+constexpr double PkFilterFalsePositiveRate = 0.01;
+
+inline uint64_t
+pk_filter_hash(int64_t pk) {
+    return SplitBlockBloomFilter::Hash(&pk, sizeof(pk));
+}
+
+inline uint64_t
+pk_filter_hash(std::string_view pk) {
+    return SplitBlockBloomFilter::Hash(pk);
+}
+
+inline uint64_t
+pk_filter_hash(const PkType& pk) {
+    if (auto int64_pk = std::get_if<int64_t>(&pk)) {
+        return pk_filter_hash(*int64_pk);
+    }
+    if (auto string_pk = std::get_if<std::string>(&pk)) {
+        return pk_filter_hash(std::string_view(*string_pk));
+    }
+    ThrowInfo(DataTypeInvalid, "pk filter requires an int64 or varchar pk");
+    return 0;
+}
+
+// Positions of the pks the filter can't rule out of the segment, in
+// increasing order.
+inline std::vector<size_t>
+pk_filter_candidates(const SplitBlockBloomFilter& filter,
+                     const std::vector<PkType>& pks) {
+    std::vector<uint64_t> hashes(pks.size());
+    for (size_t i = 0; i < pks.size(); ++i) {
+        hashes[i] = pk_filter_hash(pks[i]);
+    }
+    auto passed = std::make_unique<bool[]>(pks.size());
+    auto num_passed =
+        filter.BatchTestHashes(hashes.data(), hashes.size(), passed.get());
+    std::vector<size_t> candidates;
+    candidates.reserve(num_passed);
+    for (size_t i = 0; i < pks.size(); ++i) {
+        if (passed[i]) {
+            candidates.push_back(i);
+        }
+    }
+    return candidates;
+}
+
 // Compressed storage for offset -> int64 PK reverse lookup.
 // Uses global base + per-block base + bitpacked deltas.
 // Block size = 128, O(1) random access within each block.
@@ -242,6 +293,63 @@ class CompressedInt64PkArray {
     std::vector<uint8_t> data_;              // Bitpacked deltas
 };
 
+// One bit per block of kBlockRows rows of a filter result, set when some row
+// of the block passes the filter (a 0 in the filter result). A PK-ordered
+// traversal checks it before the filter result, so rows whose block the
+// filter rejects cost a lookup into a bitmap 4096 times smaller than the
+// filter result. Building it counts the passing rows, which the traversals
+// need anyway.
+class FilterBlockSummary {
+ public:
+    static constexpr int64_t kBlockRows = 4096;
+
+    explicit FilterBlockSummary(const BitsetTypeView& bitset)
+        : size_(bitset.size()),
+          blocks_((bitset.size() + kBlockRows - 1) / kBlockRows) {
+        for (int64_t block = 0; block < static_cast<int64_t>(blocks_.size());
+             ++block) {
+            auto begin = block * kBlockRows;
+            auto rows = std::min(kBlockRows, size_ - begin);
+            auto passed = rows - static_cast<int64_t>(
+                                     bitset.view(begin, rows).count());
+            blocks_[block] = passed > 0;
+            passed_ += passed;
+        }
+    }
+
+    // rows passing the filter
+    int64_t
+    passed() const {
+        return passed_;
+    }
+
+    // false when no row of [begin, end) passes the filter
+    bool
+    may_pass(int64_t begin, int64_t end) const {
+        end = std::min(end, size_);
+        if (begin >= end) {
+            return false;
+        }
+        for (auto block = begin / kBlockRows; block <= (end - 1) / kBlockRows;
+             ++block) {
+            if (blocks_[block]) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool
+    may_pass(int64_t row) const {
+        return row < size_ && blocks_[row / kBlockRows];
+    }
+
+ private:
+    int64_t size_;
+    int64_t passed_ = 0;
+    BitsetType blocks_;
+};
+
 class OffsetMap {
  public:
     virtual ~OffsetMap() = default;
@@ -300,6 +408,20 @@ class OffsetMap {
     is_zero_storage() const {
         return false;
     }
+
+    // Resolves a batch of pks, calling `callback(i, offset)` for every offset
+    // of pks[i], in increasing i. Implementations may overlap the lookups,
+    // e.g. prefetch the next probes while resolving the current one.
+    virtual void
+    find_batch(const std::vector<PkType>& pks,
+               const std::function<void(size_t idx, int64_t offset)>& callback)
+        const {
+        for (size_t i = 0; i < pks.size(); ++i) {
+            for (auto offset : find(pks[i])) {
+                callback(i, offset);
+            }
+        }
+    }
 };
 
 template <typename T>
@@ -453,7 +575,8 @@ class OffsetOrderedMap : public OffsetMap {
     find_first_n_by_index(int64_t limit, const BitsetTypeView& bitset) const {
         int64_t hit_num = 0;  // avoid counting the number everytime.
         auto size = bitset.size();
-        int64_t cnt = size - bitset.count();
+        FilterBlockSummary summary(bitset);
+        int64_t cnt = summary.passed();
         auto more_hit_than_limit = cnt > limit;
         limit = std::min(limit, cnt);
         std::vector<int64_t> seg_offsets;
@@ -469,7 +592,7 @@ class OffsetOrderedMap : public OffsetMap {
                     continue;
                 }
 
-                if (!bitset[seg_offset]) {
+                if (summary.may_pass(seg_offset) && !bitset[seg_offset]) {
                     seg_offsets.push_back(seg_offset);
                     hit_num++;
                     // PK hit, no need to continue traversing offsets with the same PK.
@@ -493,13 +616,14 @@ class OffsetOrderedMap : public OffsetMap {
         auto element_size = static_cast<int64_t>(element_bitset.size());
         // Clamp limit to the actual number of matching elements,
         // same as find_first_n_by_index does for doc-level queries.
-        int64_t cnt = element_size - element_bitset.count();
+        FilterBlockSummary summary(element_bitset);
+        int64_t cnt = summary.passed();
         auto more_hit_than_limit = cnt > limit;
         limit = std::min(limit, cnt);
 
-        // Traverse map_ in PK order
+        // Traverse map_ in PK order, from the cursor on
         std::vector<int32_t> matching_indices;
-        auto it = map_.begin();
+        auto it = begin_at(cursor);
         for (; hit_num < limit && it != map_.end(); ++it) {
             // For each PK, traverse from back to front to obtain the latest offset.
             // Same as find_first_n_by_index: only use the first (newest) offset
@@ -514,8 +638,10 @@ class OffsetOrderedMap : public OffsetMap {
 
                 // Collect all matching element indices for this doc
                 matching_indices.clear();
+                // false when no element of the doc passes the filter
+                auto may_pass = summary.may_pass(first_elem, last_elem);
                 for (int64_t elem_id = first_elem;
-                     elem_id < last_elem && hit_num < limit;
+                     may_pass && elem_id < last_elem && hit_num < limit;
                      ++elem_id) {
                     if (elem_id >= element_size) {
                         continue;
@@ -569,6 +695,17 @@ class OffsetOrderedMap : public OffsetMap {
         return last_pk != nullptr && *last_pk == pk;
     }
 
+    // the pks before the cursor were returned by the earlier pages
+    typename OrderedMap::const_iterator
+    begin_at(const std::optional<QueryIteratorCursor>& cursor) const {
+        if (cursor.has_value()) {
+            if (auto last_pk = std::get_if<T>(&cursor->last_pk)) {
+                return map_.lower_bound(*last_pk);
+            }
+        }
+        return map_.begin();
+    }
+
  private:
     OrderedMap map_;
     mutable std::shared_mutex mtx_;
@@ -738,7 +875,8 @@ class OffsetOrderedArray : public OffsetMap {
     find_first_n_by_index(int64_t limit, const BitsetTypeView& bitset) const {
         int64_t hit_num = 0;  // avoid counting the number everytime.
         auto size = bitset.size();
-        int64_t cnt = size - bitset.count();
+        FilterBlockSummary summary(bitset);
+        int64_t cnt = summary.passed();
         auto more_hit_than_limit = cnt > limit;
         limit = std::min(limit, cnt);
         std::vector<int64_t> seg_offsets;
@@ -751,7 +889,7 @@ class OffsetOrderedArray : public OffsetMap {
                 continue;
             }
 
-            if (!bitset[seg_offset]) {
+            if (summary.may_pass(seg_offset) && !bitset[seg_offset]) {
                 seg_offsets.push_back(seg_offset);
                 hit_num++;
             }
@@ -772,13 +910,14 @@ class OffsetOrderedArray : public OffsetMap {
         auto element_size = static_cast<int64_t>(element_bitset.size());
         // Clamp limit to the actual number of matching elements,
         // same as find_first_n_by_index does for doc-level queries.
-        int64_t cnt = element_size - element_bitset.count();
+        FilterBlockSummary summary(element_bitset);
+        int64_t cnt = summary.passed();
         auto more_hit_than_limit = cnt > limit;
         limit = std::min(limit, cnt);
 
-        // Traverse array_ in PK order (already sorted)
+        // Traverse array_ in PK order (already sorted), from the cursor on
         std::vector<int32_t> matching_indices;
-        auto it = array_.begin();
+        auto it = begin_at(cursor);
         for (; hit_num < limit && it != array_.end(); ++it) {
             auto doc_offset = it->second;
 
@@ -788,6 +927,10 @@ class OffsetOrderedArray : public OffsetMap {
 
             // Collect all matching element indices for this doc
             matching_indices.clear();
+            if (!summary.may_pass(first_elem, last_elem)) {
+                // no element of the doc passes the filter
+                continue;
+            }
             for (int64_t elem_id = first_elem;
                  elem_id < last_elem && hit_num < limit;
                  ++elem_id) {
@@ -829,6 +972,23 @@ class OffsetOrderedArray : public OffsetMap {
                element_offset <= cursor->last_element_offset;
     }
 
+    // the pks before the cursor were returned by the earlier pages
+    typename std::vector<std::pair<T, int32_t>>::const_iterator
+    begin_at(const std::optional<QueryIteratorCursor>& cursor) const {
+        if (cursor.has_value()) {
+            if (auto last_pk = std::get_if<T>(&cursor->last_pk)) {
+                return std::lower_bound(
+                    array_.begin(),
+                    array_.end(),
+                    *last_pk,
+                    [](const std::pair<T, int32_t>& elem, const T& value) {
+                        return elem.first < value;
+                    });
+            }
+        }
+        return array_.begin();
+    }
+
     void
     check_search() const {
         AssertInfo(is_sealed,
@@ -840,6 +1000,571 @@ class OffsetOrderedArray : public OffsetMap {
     std::vector<std::pair<T, int32_t>> array_;
 };
 
+// Fixed-width unsigned integers packed back to back into 64-bit words.
+class BitPackedArray {
+ public:
+    BitPackedArray() = default;
+
+    void
+    init(int64_t num, uint8_t width) {
+        AssertInfo(width <= 64, "bit width {} out of range", width);
+        num_ = num;
+        width_ = width;
+        // one spare word, so a value never straddles past the end
+        words_.assign((static_cast<uint64_t>(num) * width + 63) / 64 + 1, 0);
+        words_.shrink_to_fit();
+    }
+
+    void
+    set(int64_t idx, uint64_t value) {
+        if (width_ == 0) {
+            return;
+        }
+        uint64_t bit = static_cast<uint64_t>(idx) * width_;
+        auto word = bit / 64;
+        auto shift = bit % 64;
+        value &= mask();
+        words_[word] |= value << shift;
+        if (shift + width_ > 64) {
+            words_[word + 1] |= value >> (64 - shift);
+        }
+    }
+
+    uint64_t
+    get(int64_t idx) const {
+        if (width_ == 0) {
+            return 0;
+        }
+        uint64_t bit = static_cast<uint64_t>(idx) * width_;
+        auto word = bit / 64;
+        auto shift = bit % 64;
+        uint64_t value = words_[word] >> shift;
+        if (shift + width_ > 64) {
+            value |= words_[word + 1] << (64 - shift);
+        }
+        return value & mask();
+    }
+
+    void
+    prefetch(int64_t idx) const {
+        if (width_ > 0) {
+            __builtin_prefetch(
+                &words_[static_cast<uint64_t>(idx) * width_ / 64]);
+        }
+    }
+
+    int64_t
+    size() const {
+        return num_;
+    }
+
+    size_t
+    memory_size() const {
+        return words_.capacity() * sizeof(uint64_t);
+    }
+
+ private:
+    uint64_t
+    mask() const {
+        return width_ == 64 ? ~uint64_t(0) : (uint64_t(1) << width_) - 1;
+    }
+
+ private:
+    int64_t num_ = 0;
+    uint8_t width_ = 0;
+    std::vector<uint64_t> words_;
+};
+
+// Elias-Fano encoding of a non-decreasing sequence of n values in [0, U].
+// The low l = floor(log2(U / n)) bits of every value are stored verbatim and
+// the high bits as a unary bucket bitmap of at most 2n + 1 bits, i.e. about
+// 2 + log2(U / n) bits per value. Random access and lower_bound go through
+// select on the bitmap, which is sampled every kSelectSampleRate ones/zeros.
+class EliasFanoSequence {
+ public:
+    static constexpr int64_t kSelectSampleRate = 256;
+
+    EliasFanoSequence() = default;
+
+    // `value_at(i)` must be non-decreasing in i.
+    template <typename ValueAt>
+    void
+    build(int64_t num, ValueAt&& value_at) {
+        *this = EliasFanoSequence();
+        num_ = num;
+        if (num == 0) {
+            return;
+        }
+        uint64_t universe = value_at(num - 1);
+        if (universe / num > 0) {
+            low_bits_ = 63 - __builtin_clzll(universe / num);
+        }
+        low_.init(num, low_bits_);
+        max_high_ = universe >> low_bits_;
+        num_high_bits_ = num + max_high_ + 1;
+        high_.assign((num_high_bits_ + 63) / 64, 0);
+        ones_samples_.reserve((num + kSelectSampleRate - 1) /
+                              kSelectSampleRate);
+
+        uint64_t prev = 0;
+        for (int64_t i = 0; i < num; ++i) {
+            uint64_t value = value_at(i);
+            AssertInfo(value >= prev, "elias-fano input is not sorted");
+            prev = value;
+            low_.set(i, value);
+            uint64_t pos = (value >> low_bits_) + i;
+            high_[pos / 64] |= uint64_t(1) << (pos % 64);
+            if (i % kSelectSampleRate == 0) {
+                ones_samples_.push_back(pos);
+            }
+        }
+
+        // every bucket, the last one included, is terminated by a zero
+        uint64_t zeros = 0;
+        for (size_t w = 0; w < high_.size(); ++w) {
+            auto bits = ~high_[w];
+            if (w + 1 == high_.size() && num_high_bits_ % 64 != 0) {
+                bits &= (uint64_t(1) << (num_high_bits_ % 64)) - 1;
+            }
+            uint64_t count = __builtin_popcountll(bits);
+            uint64_t next = (zeros + kSelectSampleRate - 1) /
+                            kSelectSampleRate * kSelectSampleRate;
+            for (; next < zeros + count; next += kSelectSampleRate) {
+                zeros_samples_.push_back(w * 64 +
+                                         select_in_word(bits, next - zeros));
+            }
+            zeros += count;
+        }
+
+        high_.shrink_to_fit();
+        ones_samples_.shrink_to_fit();
+        zeros_samples_.shrink_to_fit();
+    }
+
+    uint64_t
+    at(int64_t idx) const {
+        return ((select1(idx) - idx) << low_bits_) | low_.get(idx);
+    }
+
+    // Index of the first value >= x, size() if there is none.
+    int64_t
+    lower_bound(uint64_t x) const {
+        if (num_ == 0) {
+            return 0;
+        }
+        uint64_t high = x >> low_bits_;
+        if (high > max_high_) {
+            return num_;
+        }
+        // values of bucket `high` are contiguous and ordered by low bits
+        uint64_t start = high == 0 ? 0 : select0(high - 1) + 1;
+        auto begin = static_cast<int64_t>(start - high);
+        auto end = static_cast<int64_t>(next_zero(start) - high);
+        uint64_t low = x & low_mask();
+        while (begin < end) {
+            auto mid = begin + (end - begin) / 2;
+            if (low_.get(mid) < low) {
+                begin = mid + 1;
+            } else {
+                end = mid;
+            }
+        }
+        return begin;
+    }
+
+    // Warms the cache lines lower_bound(x) is going to touch. The select
+    // samples are small enough to stay cached, so reading them here is cheap.
+    void
+    prefetch(uint64_t x) const {
+        uint64_t high = x >> low_bits_;
+        if (num_ == 0 || high == 0 || high > max_high_) {
+            return;
+        }
+        auto sample = (high - 1) / kSelectSampleRate;
+        auto pos = zeros_samples_[sample];
+        __builtin_prefetch(&high_[pos / 64]);
+        low_.prefetch(pos - sample * kSelectSampleRate);
+    }
+
+    int64_t
+    size() const {
+        return num_;
+    }
+
+    size_t
+    memory_size() const {
+        return low_.memory_size() + high_.capacity() * sizeof(uint64_t) +
+               (ones_samples_.capacity() + zeros_samples_.capacity()) *
+                   sizeof(uint64_t);
+    }
+
+ private:
+    uint64_t
+    low_mask() const {
+        return (uint64_t(1) << low_bits_) - 1;
+    }
+
+    static uint64_t
+    select_in_word(uint64_t bits, uint64_t rank) {
+        for (; rank > 0; --rank) {
+            bits &= bits - 1;
+        }
+        return __builtin_ctzll(bits);
+    }
+
+    // position of the rank-th one of the high bitmap
+    uint64_t
+    select1(int64_t rank) const {
+        auto pos = ones_samples_[rank / kSelectSampleRate];
+        uint64_t remaining = rank % kSelectSampleRate;
+        auto word = pos / 64;
+        auto bits = high_[word] & (~uint64_t(0) << (pos % 64));
+        while (true) {
+            uint64_t count = __builtin_popcountll(bits);
+            if (remaining < count) {
+                return word * 64 + select_in_word(bits, remaining);
+            }
+            remaining -= count;
+            bits = high_[++word];
+        }
+    }
+
+    // position of the rank-th zero of the high bitmap
+    uint64_t
+    select0(uint64_t rank) const {
+        auto pos = zeros_samples_[rank / kSelectSampleRate];
+        uint64_t remaining = rank % kSelectSampleRate;
+        auto word = pos / 64;
+        auto bits = ~high_[word] & (~uint64_t(0) << (pos % 64));
+        while (true) {
+            uint64_t count = __builtin_popcountll(bits);
+            if (remaining < count) {
+                return word * 64 + select_in_word(bits, remaining);
+            }
+            remaining -= count;
+            bits = ~high_[++word];
+        }
+    }
+
+    // position of the first zero at or after `pos`, there always is one
+    // since the last bucket is terminated too
+    uint64_t
+    next_zero(uint64_t pos) const {
+        auto word = pos / 64;
+        auto bits = ~high_[word] & (~uint64_t(0) << (pos % 64));
+        while (bits == 0) {
+            bits = ~high_[++word];
+        }
+        return word * 64 + __builtin_ctzll(bits);
+    }
+
+ private:
+    int64_t num_ = 0;
+    uint8_t low_bits_ = 0;
+    uint64_t max_high_ = 0;
+    uint64_t num_high_bits_ = 0;
+    BitPackedArray low_;
+    std::vector<uint64_t> high_;
+    std::vector<uint64_t> ones_samples_;
+    std::vector<uint64_t> zeros_samples_;
+};
+
+// Sealed-segment pk -> offset index for int64 pks. The sorted pks are
+// Elias-Fano coded relative to the minimum pk and the offsets kept in pk
+// order as a bit-packed permutation. Compared with the 16 bytes per row of
+// OffsetOrderedArray<int64_t>, this takes 2 + log2(range / rows) +
+// log2(rows) bits per row, e.g. ~5 bytes for 1M pks spread over 2^40.
+// Like OffsetOrderedArray, rows are buffered by insert() and the index is
+// built by seal().
+class EliasFanoOffsetArray : public OffsetMap {
+ public:
+    // how many probes ahead find_batch prefetches
+    static constexpr size_t kPrefetchDistance = 8;
+
+    bool
+    contain(const PkType& pk) const override {
+        auto [begin, end] = equal_range(std::get<int64_t>(pk));
+        return begin < end;
+    }
+
+    std::vector<int64_t>
+    find(const PkType& pk) const override {
+        check_search();
+        auto [begin, end] = equal_range(std::get<int64_t>(pk));
+        std::vector<int64_t> offset_vector;
+        offset_vector.reserve(end - begin);
+        for (auto i = begin; i < end; ++i) {
+            offset_vector.push_back(offsets_.get(i));
+        }
+        return offset_vector;
+    }
+
+    void
+    find_batch(const std::vector<PkType>& pks,
+               const std::function<void(size_t idx, int64_t offset)>& callback)
+        const override {
+        check_search();
+        for (size_t i = 0; i < pks.size(); ++i) {
+            if (i + kPrefetchDistance < pks.size()) {
+                prefetch(std::get<int64_t>(pks[i + kPrefetchDistance]));
+            }
+            auto [begin, end] = equal_range(std::get<int64_t>(pks[i]));
+            for (auto j = begin; j < end; ++j) {
+                callback(i, offsets_.get(j));
+            }
+        }
+    }
+
+    void
+    find_range(const PkType& pk,
+               proto::plan::OpType op,
+               BitsetTypeView& bitset,
+               Condition condition) const override {
+        check_search();
+        const auto target = std::get<int64_t>(pk);
+        int64_t begin = 0;
+        int64_t end = pks_.size();
+        if (op == proto::plan::OpType::Equal) {
+            std::tie(begin, end) = equal_range(target);
+        } else if (op == proto::plan::OpType::GreaterEqual) {
+            begin = lower_index(target);
+        } else if (op == proto::plan::OpType::GreaterThan) {
+            begin = upper_index(target);
+        } else if (op == proto::plan::OpType::LessEqual) {
+            end = upper_index(target);
+        } else if (op == proto::plan::OpType::LessThan) {
+            end = lower_index(target);
+        } else {
+            ThrowInfo(ErrorCode::Unsupported,
+                      fmt::format("unsupported op type {}", op));
+        }
+        for (auto i = begin; i < end; ++i) {
+            auto offset = static_cast<int64_t>(offsets_.get(i));
+            if (condition(offset)) {
+                bitset[offset] = true;
+            }
+        }
+    }
+
+    void
+    insert(const PkType& pk, int64_t offset) override {
+        if (is_sealed_) {
+            ThrowInfo(Unsupported,
+                      "EliasFanoOffsetArray could not insert after seal");
+        }
+        pending_.emplace_back(std::get<int64_t>(pk),
+                              static_cast<int32_t>(offset));
+    }
+
+    void
+    seal() override {
+        std::sort(pending_.begin(), pending_.end());
+        auto num = static_cast<int64_t>(pending_.size());
+        base_ = num > 0 ? pending_[0].first : 0;
+        pks_.build(num, [this](int64_t i) {
+            return static_cast<uint64_t>(pending_[i].first) -
+                   static_cast<uint64_t>(base_);
+        });
+
+        int32_t max_offset = 0;
+        for (const auto& [pk, offset] : pending_) {
+            max_offset = std::max(max_offset, offset);
+        }
+        uint8_t width =
+            max_offset == 0 ? 0 : 32 - __builtin_clz(uint32_t(max_offset));
+        offsets_.init(num, width);
+        for (int64_t i = 0; i < num; ++i) {
+            offsets_.set(i, pending_[i].second);
+        }
+
+        std::vector<std::pair<int64_t, int32_t>>().swap(pending_);
+        is_sealed_ = true;
+    }
+
+    bool
+    empty() const override {
+        return pending_.empty() && pks_.size() == 0;
+    }
+
+    std::pair<std::vector<OffsetMap::OffsetType>, bool>
+    find_first_n(int64_t limit, const BitsetTypeView& bitset) const override {
+        check_search();
+
+        if (limit == Unlimited || limit == NoLimit) {
+            limit = pks_.size();
+        }
+
+        int64_t hit_num = 0;
+        auto size = bitset.size();
+        FilterBlockSummary summary(bitset);
+        int64_t cnt = summary.passed();
+        auto more_hit_than_limit = cnt > limit;
+        limit = std::min(limit, cnt);
+        std::vector<int64_t> seg_offsets;
+        seg_offsets.reserve(limit);
+        int64_t i = 0;
+        for (; hit_num < limit && i < pks_.size(); ++i) {
+            auto seg_offset = static_cast<int64_t>(offsets_.get(i));
+            if (seg_offset >= size) {
+                continue;
+            }
+            if (summary.may_pass(seg_offset) && !bitset[seg_offset]) {
+                seg_offsets.push_back(seg_offset);
+                hit_num++;
+            }
+        }
+        return {seg_offsets, more_hit_than_limit && i < pks_.size()};
+    }
+
+    std::tuple<std::vector<int64_t>, std::vector<std::vector<int32_t>>, bool>
+    find_first_n_element(
+        int64_t limit,
+        const BitsetTypeView& element_bitset,
+        const IArrayOffsets* array_offsets,
+        const std::optional<QueryIteratorCursor>& cursor) const override {
+        check_search();
+
+        auto element_size = static_cast<int64_t>(element_bitset.size());
+        if (limit == Unlimited || limit == NoLimit) {
+            limit = element_size;
+        }
+        FilterBlockSummary summary(element_bitset);
+        int64_t cnt = summary.passed();
+        auto more_hit_than_limit = cnt > limit;
+        limit = std::min(limit, cnt);
+
+        // the pks before the cursor were returned by the earlier pages
+        int64_t begin = 0;
+        if (cursor.has_value()) {
+            if (auto last_pk = std::get_if<int64_t>(&cursor->last_pk)) {
+                begin = lower_index(*last_pk);
+            }
+        }
+
+        std::vector<int64_t> doc_offsets;
+        std::vector<std::vector<int32_t>> element_indices;
+        std::vector<int32_t> matching_indices;
+        int64_t hit_num = 0;
+        for (int64_t i = begin; hit_num < limit && i < pks_.size(); ++i) {
+            auto doc_offset = static_cast<int64_t>(offsets_.get(i));
+            auto [first_elem, last_elem] =
+                array_offsets->ElementIDRangeOfRow(doc_offset);
+            if (!summary.may_pass(first_elem, last_elem)) {
+                continue;
+            }
+            matching_indices.clear();
+            for (int64_t elem_id = first_elem;
+                 elem_id < last_elem && hit_num < limit;
+                 ++elem_id) {
+                if (elem_id >= element_size) {
+                    continue;
+                }
+                if (is_skipped_by_cursor(i, elem_id - first_elem, cursor)) {
+                    continue;
+                }
+                if (!element_bitset[elem_id]) {
+                    matching_indices.push_back(
+                        static_cast<int32_t>(elem_id - first_elem));
+                    hit_num++;
+                }
+            }
+            if (!matching_indices.empty()) {
+                doc_offsets.push_back(doc_offset);
+                element_indices.push_back(std::move(matching_indices));
+            }
+        }
+
+        bool has_more = more_hit_than_limit && hit_num >= limit;
+        return {std::move(doc_offsets), std::move(element_indices), has_more};
+    }
+
+    void
+    clear() override {
+        std::vector<std::pair<int64_t, int32_t>>().swap(pending_);
+        pks_ = EliasFanoSequence();
+        offsets_ = BitPackedArray();
+        base_ = 0;
+        is_sealed_ = false;
+    }
+
+    size_t
+    memory_size() const override {
+        return sizeof(*this) + pks_.memory_size() + offsets_.memory_size() +
+               pending_.capacity() * sizeof(std::pair<int64_t, int32_t>);
+    }
+
+ private:
+    int64_t
+    pk_at(int64_t idx) const {
+        return static_cast<int64_t>(static_cast<uint64_t>(base_) +
+                                    pks_.at(idx));
+    }
+
+    // index of the first pk >= target
+    int64_t
+    lower_index(int64_t target) const {
+        if (pks_.size() == 0 || target <= base_) {
+            return 0;
+        }
+        return pks_.lower_bound(static_cast<uint64_t>(target) -
+                                static_cast<uint64_t>(base_));
+    }
+
+    // index of the first pk > target
+    int64_t
+    upper_index(int64_t target) const {
+        if (target == std::numeric_limits<int64_t>::max()) {
+            return pks_.size();
+        }
+        return lower_index(target + 1);
+    }
+
+    std::pair<int64_t, int64_t>
+    equal_range(int64_t target) const {
+        auto begin = lower_index(target);
+        if (begin == pks_.size() || pk_at(begin) != target) {
+            return {begin, begin};
+        }
+        return {begin, upper_index(target)};
+    }
+
+    void
+    prefetch(int64_t target) const {
+        if (target > base_) {
+            pks_.prefetch(static_cast<uint64_t>(target) -
+                          static_cast<uint64_t>(base_));
+        }
+    }
+
+    bool
+    is_skipped_by_cursor(
+        int64_t idx,
+        int64_t element_offset,
+        const std::optional<QueryIteratorCursor>& cursor) const {
+        if (!cursor.has_value()) {
+            return false;
+        }
+        auto last_pk = std::get_if<int64_t>(&cursor->last_pk);
+        return last_pk != nullptr &&
+               element_offset <= cursor->last_element_offset &&
+               *last_pk == pk_at(idx);
+    }
+
+    void
+    check_search() const {
+        AssertInfo(is_sealed_,
+                   "EliasFanoOffsetArray could not search before seal");
+    }
+
+ private:
+    bool is_sealed_ = false;
+    // (pk, offset) rows buffered until seal()
+    std::vector<std::pair<int64_t, int32_t>> pending_;
+    int64_t base_ = 0;
+    EliasFanoSequence pks_;
+    BitPackedArray offsets_;
+};
+
 // VirtualPKOffsetMap is a zero-storage OffsetMap for external collections.
 // Virtual PK = (truncated_segment_id << 32) | offset, so pk→offset is a
 // simple bit-extract: offset = pk & 0xFFFFFFFF. No data structure needed.
@@ -1064,8 +1789,7 @@ class InsertRecordSealed {
                            "Primary key should not be nullable");
                 switch (field_meta.get_data_type()) {
                     case DataType::INT64: {
-                        pk2offset_ =
-                            std::make_unique<OffsetOrderedArray<int64_t>>();
+                        pk2offset_ = std::make_unique<EliasFanoOffsetArray>();
                         is_int64_pk_ = true;
                         break;
                     }
@@ -1253,6 +1977,61 @@ class InsertRecordSealed {
         estimated_memory_size_ += mem;
     }
 
+    // Build the bloom filter over all pks of the segment, consulted before
+    // pk2offset_ or the sorted pk column.
+    void
+    build_pk_filter(milvus::DataType data_type, ChunkedColumnInterface* data) {
+        std::lock_guard lck(shared_mutex_);
+        auto filter = std::make_unique<SplitBlockBloomFilter>(
+            data->NumRows(), PkFilterFalsePositiveRate);
+        auto num_chunk = data->num_chunks();
+        switch (data_type) {
+            case DataType::INT64: {
+                for (int i = 0; i < num_chunk; ++i) {
+                    auto pw = data->DataOfChunk(nullptr, i);
+                    auto pks = reinterpret_cast<const int64_t*>(pw.get());
+                    auto chunk_num_rows = data->chunk_row_nums(i);
+                    for (int j = 0; j < chunk_num_rows; ++j) {
+                        filter->AddHash(pk_filter_hash(pks[j]));
+                    }
+                }
+                break;
+            }
+            case DataType::VARCHAR: {
+                for (int i = 0; i < num_chunk; ++i) {
+                    auto pw = data->StringViews(nullptr, i);
+                    for (auto pk : pw.get().first) {
+                        filter->AddHash(pk_filter_hash(pk));
+                    }
+                }
+                break;
+            }
+            default: {
+                ThrowInfo(DataTypeInvalid,
+                          fmt::format("unsupported primary key data type {}",
+                                      data_type));
+            }
+        }
+        if (pk_filter_) {
+            size_t old_mem = pk_filter_->memory_size();
+            cachinglayer::Manager::GetInstance().RefundLoadedResource(
+                {static_cast<int64_t>(old_mem), 0});
+            estimated_memory_size_ -= old_mem;
+        }
+        pk_filter_ = std::move(filter);
+
+        size_t mem = pk_filter_->memory_size();
+        cachinglayer::Manager::GetInstance().ChargeLoadedResource(
+            {static_cast<int64_t>(mem), 0});
+        estimated_memory_size_ += mem;
+    }
+
+    // nullptr until build_pk_filter() ran
+    const SplitBlockBloomFilter*
+    pk_filter() const {
+        return pk_filter_.get();
+    }
+
     bool
     empty_pks() const {
         std::shared_lock lck(shared_mutex_);
@@ -1320,6 +2099,7 @@ class InsertRecordSealed {
             pk2offset_->clear();
         }
         offset2pk_.reset();
+        pk_filter_.reset();
 
         reserved = 0;
         if (estimated_memory_size_ > 0) {
@@ -1364,6 +2144,8 @@ class InsertRecordSealed {
     std::unique_ptr<OffsetMap> pk2offset_;
     // offset to pk (compressed), only available for int64 PK
     std::unique_ptr<CompressedInt64PkArray> offset2pk_;
+    // bloom filter over all pks, storage v1 only (v2 keeps it in PkIndexCell)
+    std::unique_ptr<SplitBlockBloomFilter> pk_filter_;
     // whether PK type is int64
     bool is_int64_pk_ = false;
     // estimated memory size of InsertRecord, only used for sealed segment
@@ -1565,29 +2347,34 @@ class InsertRecordGrowing {
                     : nullptr;
         }
         if (field_meta.is_vector()) {
+            // dense vectors may size their own chunks, their rows are looked
+            // up through get_size_per_chunk(field_id)
+            auto vec_size_per_chunk =
+                milvus::segcore::SegcoreConfig::default_config()
+                    .get_field_chunk_rows(field_meta, size_per_chunk);
             if (field_meta.get_data_type() == DataType::VECTOR_FLOAT) {
                 this->append_data<FloatVector>(field_id,
                                                field_meta.get_dim(),
-                                               size_per_chunk,
+                                               vec_size_per_chunk,
                                                dense_vec_mmap_descriptor);
                 return;
             } else if (field_meta.get_data_type() == DataType::VECTOR_BINARY) {
                 this->append_data<BinaryVector>(field_id,
                                                 field_meta.get_dim(),
-                                                size_per_chunk,
+                                                vec_size_per_chunk,
                                                 dense_vec_mmap_descriptor);
                 return;
             } else if (field_meta.get_data_type() == DataType::VECTOR_FLOAT16) {
                 this->append_data<Float16Vector>(field_id,
                                                  field_meta.get_dim(),
-                                                 size_per_chunk,
+                                                 vec_size_per_chunk,
                                                  dense_vec_mmap_descriptor);
                 return;
             } else if (field_meta.get_data_type() ==
                        DataType::VECTOR_BFLOAT16) {
                 this->append_data<BFloat16Vector>(field_id,
                                                   field_meta.get_dim(),
-                                                  size_per_chunk,
+                                                  vec_size_per_chunk,
                                                   dense_vec_mmap_descriptor);
                 return;
             } else if (field_meta.get_data_type() ==
@@ -1598,7 +2385,7 @@ class InsertRecordGrowing {
             } else if (field_meta.get_data_type() == DataType::VECTOR_INT8) {
                 this->append_data<Int8Vector>(field_id,
                                               field_meta.get_dim(),
-                                              size_per_chunk,
+                                              vec_size_per_chunk,
                                               dense_vec_mmap_descriptor);
                 return;
             } else if (field_meta.get_data_type() == DataType::VECTOR_ARRAY) {
@@ -1733,6 +2520,15 @@ class InsertRecordGrowing {
         return data_.find(field_id) != data_.end();
     }
 
+    // rows per chunk of `field_id`, fields may differ, see append_field_meta()
+    int64_t
+    get_size_per_chunk(FieldId field_id) const {
+        std::shared_lock<std::shared_mutex> lck(field_map_mutex_);
+        auto it = data_.find(field_id);
+        return it != data_.end() ? it->second->get_size_per_chunk()
+                                 : timestamps_.get_size_per_chunk();
+    }
+
     bool
     is_valid_data_exist(FieldId field_id) const {
         std::shared_lock<std::shared_mutex> lck(field_map_mutex_);
@@ -0,0 +1,230 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <gtest/gtest.h>
+#include <stdint.h>
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "common/Types.h"
+#include "segcore/InsertRecord.h"
+
+using namespace milvus;
+using namespace milvus::segcore;
+
+namespace {
+
+// Loads the same pks into an EliasFanoOffsetArray and the reference
+// OffsetOrderedArray<int64_t>.
+class EliasFanoOffsetArrayTest : public testing::Test {
+ protected:
+    void
+    Load(const std::vector<int64_t>& pks) {
+        pks_ = pks;
+        for (size_t i = 0; i < pks.size(); ++i) {
+            map_.insert(PkType(pks[i]), i);
+            expected_.insert(PkType(pks[i]), i);
+        }
+        map_.seal();
+        expected_.seal();
+    }
+
+    static std::vector<int64_t>
+    Sorted(std::vector<int64_t> offsets) {
+        std::sort(offsets.begin(), offsets.end());
+        return offsets;
+    }
+
+    void
+    CheckFind(int64_t pk) {
+        ASSERT_EQ(Sorted(map_.find(PkType(pk))),
+                  Sorted(expected_.find(PkType(pk))))
+            << "pk " << pk;
+        ASSERT_EQ(map_.contain(PkType(pk)), expected_.contain(PkType(pk)))
+            << "pk " << pk;
+    }
+
+    void
+    CheckRange(int64_t pk, proto::plan::OpType op) {
+        auto n = pks_.size();
+        BitsetType actual(n);
+        BitsetType expected(n);
+        BitsetTypeView actual_view(actual.data(), n);
+        BitsetTypeView expected_view(expected.data(), n);
+        auto odd = [](int64_t offset) { return offset % 2 == 1; };
+        map_.find_range(PkType(pk), op, actual_view, odd);
+        expected_.find_range(PkType(pk), op, expected_view, odd);
+        for (size_t i = 0; i < n; ++i) {
+            ASSERT_EQ(actual[i], expected[i])
+                << "pk " << pk << " op " << op << " offset " << i;
+        }
+    }
+
+    void
+    CheckAll(const std::vector<int64_t>& probes) {
+        for (auto pk : probes) {
+            CheckFind(pk);
+            for (auto op : {proto::plan::OpType::Equal,
+                            proto::plan::OpType::GreaterEqual,
+                            proto::plan::OpType::GreaterThan,
+                            proto::plan::OpType::LessEqual,
+                            proto::plan::OpType::LessThan}) {
+                CheckRange(pk, op);
+            }
+        }
+    }
+
+    std::vector<int64_t> pks_;
+    EliasFanoOffsetArray map_;
+    OffsetOrderedArray<int64_t> expected_;
+};
+
+}  // namespace
+
+TEST(EliasFanoSequence, AtAndLowerBound) {
+    std::default_random_engine er(42);
+    for (uint64_t range : {uint64_t(1),
+                           uint64_t(100),
+                           uint64_t(1) << 20,
+                           uint64_t(1) << 40,
+                           std::numeric_limits<uint64_t>::max()}) {
+        std::vector<uint64_t> values(3000);
+        std::uniform_int_distribution<uint64_t> dist(0, range);
+        for (auto& v : values) {
+            v = dist(er);
+        }
+        std::sort(values.begin(), values.end());
+
+        EliasFanoSequence seq;
+        seq.build(values.size(), [&](int64_t i) { return values[i]; });
+        ASSERT_EQ(seq.size(), values.size());
+        for (size_t i = 0; i < values.size(); ++i) {
+            ASSERT_EQ(seq.at(i), values[i]) << "range " << range;
+        }
+        for (int i = 0; i < 3000; ++i) {
+            auto x = dist(er);
+            auto expected =
+                std::lower_bound(values.begin(), values.end(), x) -
+                values.begin();
+            ASSERT_EQ(seq.lower_bound(x), expected) << "range " << range;
+        }
+        ASSERT_EQ(seq.lower_bound(0), 0);
+    }
+
+    EliasFanoSequence empty;
+    empty.build(0, [](int64_t) { return uint64_t(0); });
+    EXPECT_EQ(empty.lower_bound(123), 0);
+}
+
+TEST_F(EliasFanoOffsetArrayTest, RandomWithDuplicates) {
+    std::default_random_engine er(42);
+    std::uniform_int_distribution<int64_t> dist(-5000, 5000);
+    std::vector<int64_t> pks(10000);
+    for (auto& pk : pks) {
+        pk = dist(er);
+    }
+    Load(pks);
+
+    std::vector<int64_t> probes = {-5001, 5001, 0};
+    for (int i = 0; i < 500; ++i) {
+        probes.push_back(dist(er));
+    }
+    CheckAll(probes);
+}
+
+TEST_F(EliasFanoOffsetArrayTest, Extremes) {
+    Load({std::numeric_limits<int64_t>::max(),
+          std::numeric_limits<int64_t>::min(),
+          0,
+          -1,
+          std::numeric_limits<int64_t>::max(),
+          1});
+    CheckAll({std::numeric_limits<int64_t>::min(),
+              std::numeric_limits<int64_t>::min() + 1,
+              -2,
+              -1,
+              0,
+              1,
+              2,
+              std::numeric_limits<int64_t>::max() - 1,
+              std::numeric_limits<int64_t>::max()});
+}
+
+TEST_F(EliasFanoOffsetArrayTest, FindBatch) {
+    std::vector<int64_t> pks(5000);
+    for (size_t i = 0; i < pks.size(); ++i) {
+        pks[i] = (static_cast<int64_t>(i) * 7919) % 20011;
+    }
+    Load(pks);
+
+    std::vector<PkType> probes;
+    for (int64_t pk = -10; pk < 20021; pk += 3) {
+        probes.emplace_back(pk);
+    }
+    std::vector<std::vector<int64_t>> hits(probes.size());
+    size_t last_idx = 0;
+    map_.find_batch(probes, [&](size_t idx, int64_t offset) {
+        ASSERT_GE(idx, last_idx);
+        last_idx = idx;
+        hits[idx].push_back(offset);
+    });
+    for (size_t i = 0; i < probes.size(); ++i) {
+        ASSERT_EQ(Sorted(hits[i]), Sorted(expected_.find(probes[i])));
+    }
+}
+
+TEST_F(EliasFanoOffsetArrayTest, FindFirstN) {
+    std::vector<int64_t> pks(1000);
+    for (size_t i = 0; i < pks.size(); ++i) {
+        pks[i] = 1000 - static_cast<int64_t>(i);
+    }
+    Load(pks);
+
+    BitsetType bitset(pks.size());
+    for (size_t i = 0; i < pks.size(); i += 3) {
+        bitset.set(i);
+    }
+    BitsetTypeView view(bitset.data(), pks.size());
+    auto [offsets, has_more] = map_.find_first_n(100, view);
+    auto [expected_offsets, expected_more] = expected_.find_first_n(100, view);
+    EXPECT_EQ(offsets, expected_offsets);
+    EXPECT_EQ(has_more, expected_more);
+}
+
+TEST_F(EliasFanoOffsetArrayTest, SmallerThanOrderedArray) {
+    // auto-id style pks: increasing, with small gaps
+    std::vector<int64_t> pks(100000);
+    int64_t pk = (int64_t(1) << 50);
+    std::default_random_engine er(42);
+    std::uniform_int_distribution<int64_t> gap(1, 16);
+    for (auto& p : pks) {
+        pk += gap(er);
+        p = pk;
+    }
+    std::shuffle(pks.begin(), pks.end(), er);
+    Load(pks);
+    EXPECT_LT(map_.memory_size() * 4, expected_.memory_size());
+    CheckAll({pks[0], pks[1], pks[99999], pk + 1, (int64_t(1) << 50)});
+}
+
+TEST(EliasFanoOffsetArray, SearchBeforeSeal) {
+    EliasFanoOffsetArray map;
+    map.insert(PkType(int64_t(1)), 0);
+    EXPECT_FALSE(map.empty());
+    ASSERT_ANY_THROW(map.find(PkType(int64_t(1))));
+    map.seal();
+    ASSERT_ANY_THROW(map.insert(PkType(int64_t(2)), 1));
+    EXPECT_EQ(map.find(PkType(int64_t(1))), std::vector<int64_t>{0});
+    map.clear();
+    EXPECT_TRUE(map.empty());
+}
@@ -11,8 +11,11 @@
 
 #include <gtest/gtest.h>
 #include <stdint.h>
+#include <algorithm>
 #include <random>
 #include <string>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 #include "common/Types.h"
@@ -391,11 +394,95 @@ TYPED_TEST_P(TypedOffsetOrderedArrayTest,
     ASSERT_TRUE(limited_has_more);
 }
 
+TYPED_TEST_P(TypedOffsetOrderedArrayTest, find_first_n_sparse_filter) {
+    // several blocks of the filter summary, only a few rows pass
+    int num = 3 * FilterBlockSummary::kBlockRows + 100;
+    auto data = this->random_generate(num);
+    for (const auto& x : data) {
+        this->insert(x);
+    }
+    this->seal();
+
+    BitsetType bitset(num);
+    bitset.set();
+    std::vector<int64_t> passing = {5, 4200, 4201, num - 1};
+    for (auto offset : passing) {
+        bitset.reset(offset);
+    }
+    std::sort(passing.begin(), passing.end(), [&](int64_t a, int64_t b) {
+        return std::make_pair(data[a], a) < std::make_pair(data[b], b);
+    });
+    BitsetTypeView view(bitset.data(), num);
+
+    auto [offsets, has_more] = this->map_.find_first_n(3, view);
+    ASSERT_EQ(offsets,
+              std::vector<int64_t>(passing.begin(), passing.begin() + 3));
+    ASSERT_TRUE(has_more);
+
+    std::tie(offsets, has_more) = this->map_.find_first_n(Unlimited, view);
+    ASSERT_EQ(offsets, passing);
+    ASSERT_FALSE(has_more);
+
+    FilterBlockSummary summary(view);
+    ASSERT_EQ(summary.passed(), static_cast<int64_t>(passing.size()));
+    ASSERT_TRUE(summary.may_pass(4100));
+    ASSERT_FALSE(summary.may_pass(2 * FilterBlockSummary::kBlockRows));
+    ASSERT_FALSE(summary.may_pass(2 * FilterBlockSummary::kBlockRows,
+                                  3 * FilterBlockSummary::kBlockRows));
+    ASSERT_TRUE(summary.may_pass(2 * FilterBlockSummary::kBlockRows,
+                                 3 * FilterBlockSummary::kBlockRows + 1));
+    ASSERT_FALSE(summary.may_pass(num));
+}
+
+TYPED_TEST_P(TypedOffsetOrderedArrayTest,
+             find_first_n_element_resumes_at_cursor) {
+    auto make_pk = [](int i) {
+        if constexpr (std::is_same_v<std::string, TypeParam>) {
+            return std::to_string(i);
+        } else {
+            return static_cast<TypeParam>(i);
+        }
+    };
+
+    int num = 4;
+    int array_len = 2;
+    for (int i = 0; i < num; i++) {
+        this->insert(make_pk(i));
+    }
+    this->seal();
+
+    std::vector<int32_t> row_to_element_start = {0};
+    for (int doc = 0; doc < num; doc++) {
+        row_to_element_start.push_back(
+            static_cast<int32_t>((doc + 1) * array_len));
+    }
+    auto array_offsets =
+        std::make_shared<ArrayOffsetsSealed>(std::move(row_to_element_start));
+
+    // every element passes, the pks before the cursor were returned by the
+    // earlier pages
+    BitsetType bitset(num * array_len);
+    bitset.reset();
+    BitsetTypeView view(bitset.data(), bitset.size());
+
+    QueryIteratorCursor cursor;
+    cursor.last_pk = make_pk(2);
+    cursor.last_element_offset = 0;
+
+    auto [doc_offsets, elem_indices, has_more] =
+        this->map_.find_first_n_element(10, view, array_offsets.get(), cursor);
+    ASSERT_EQ(doc_offsets, std::vector<int64_t>({2, 3}));
+    ASSERT_EQ(elem_indices[0], std::vector<int32_t>({1}));
+    ASSERT_EQ(elem_indices[1], std::vector<int32_t>({0, 1}));
+}
+
 REGISTER_TYPED_TEST_SUITE_P(TypedOffsetOrderedArrayTest,
                             find_first_n,
                             find_first_n_element,
                             find_first_n_element_has_more,
-                            find_first_n_element_with_iterator_cursor);
+                            find_first_n_element_with_iterator_cursor,
+                            find_first_n_sparse_filter,
+                            find_first_n_element_resumes_at_cursor);
 INSTANTIATE_TYPED_TEST_SUITE_P(Prefix, TypedOffsetOrderedArrayTest, TypeOfPks);
 
 // =====================================================================
@@ -0,0 +1,71 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "segcore/MvccMaskCache.h"
+
+#include <algorithm>
+#include <exception>
+#include <utility>
+
+namespace milvus::segcore {
+
+MvccMaskCache::Mask
+MvccMaskCache::GetOrCompute(const Key& key,
+                            const std::function<Mask()>& compute) {
+    std::promise<Mask> promise;
+    std::shared_future<Mask> computing;
+    uint64_t id = 0;
+    {
+        std::lock_guard lck(mutex_);
+        auto it = std::find_if(
+            entries_.begin(), entries_.end(), [&](const Entry& entry) {
+                return entry.key == key;
+            });
+        if (it != entries_.end()) {
+            entries_.splice(entries_.begin(), entries_, it);
+            computing = it->mask;
+        } else {
+            id = next_id_++;
+            entries_.push_front(Entry{key, id, promise.get_future().share()});
+            if (entries_.size() > kCapacity) {
+                entries_.pop_back();
+            }
+        }
+    }
+    // waited for outside the lock, the other keys go on meanwhile
+    if (computing.valid()) {
+        return computing.get();
+    }
+
+    try {
+        auto mask = compute();
+        promise.set_value(mask);
+        return mask;
+    } catch (...) {
+        promise.set_exception(std::current_exception());
+        std::lock_guard lck(mutex_);
+        entries_.remove_if([&](const Entry& entry) { return entry.id == id; });
+        throw;
+    }
+}
+
+size_t
+MvccMaskCache::size() const {
+    std::lock_guard lck(mutex_);
+    return entries_.size();
+}
+
+}  // namespace milvus::segcore
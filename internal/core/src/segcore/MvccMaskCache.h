@@ -0,0 +1,81 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <list>
+#include <memory>
+#include <mutex>
+
+#include "common/Types.h"
+
+namespace milvus::segcore {
+
+// The rows a segment hides from the queries at a point of its history, by
+// mvcc, deletes and the collection ttl. The concurrent queries of a segment
+// mostly ask at the same point, each would compute the same mask; the first
+// computes it and the others wait for and share it.
+//
+// The few most recent points are kept, a key is only ever computed by one
+// caller at a time.
+class MvccMaskCache {
+ public:
+    using Mask = std::shared_ptr<const TargetBitmap>;
+
+    struct Key {
+        int64_t active_count;
+        // the query timestamp, or MAX_TIMESTAMP past every insert and delete
+        Timestamp timestamp;
+        Timestamp collection_ttl;
+        // the count of deletes applied, grows with every one taking effect
+        int64_t delete_version;
+
+        bool
+        operator==(const Key& other) const {
+            return active_count == other.active_count &&
+                   timestamp == other.timestamp &&
+                   collection_ttl == other.collection_ttl &&
+                   delete_version == other.delete_version;
+        }
+    };
+
+    static constexpr size_t kCapacity = 4;
+
+    // the mask of `key`, by `compute` if no one did; an exception of compute
+    // goes to every caller waiting for it and the key is not kept
+    Mask
+    GetOrCompute(const Key& key, const std::function<Mask()>& compute);
+
+    size_t
+    size() const;
+
+ private:
+    struct Entry {
+        Key key;
+        uint64_t id;
+        std::shared_future<Mask> mask;
+    };
+
+    mutable std::mutex mutex_;
+    // most recently used first
+    std::list<Entry> entries_;
+    uint64_t next_id_ = 0;
+};
+
+}  // namespace milvus::segcore
@@ -0,0 +1,95 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "segcore/MvccMaskCache.h"
+
+using milvus::segcore::MvccMaskCache;
+
+namespace {
+
+MvccMaskCache::Key
+KeyAt(milvus::Timestamp timestamp, int64_t delete_version = 0) {
+    return MvccMaskCache::Key{100, timestamp, 0, delete_version};
+}
+
+}  // namespace
+
+TEST(MvccMaskCacheTest, ConcurrentQueriesShareOneMask) {
+    MvccMaskCache cache;
+    std::atomic<int> computed = 0;
+    std::vector<MvccMaskCache::Mask> masks(8);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < masks.size(); ++i) {
+        threads.emplace_back([&, i]() {
+            masks[i] = cache.GetOrCompute(KeyAt(10), [&]() {
+                computed++;
+                std::this_thread::sleep_for(std::chrono::milliseconds(50));
+                return std::make_shared<const milvus::TargetBitmap>(100);
+            });
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(computed, 1);
+    for (const auto& mask : masks) {
+        EXPECT_EQ(mask, masks[0]);
+    }
+}
+
+TEST(MvccMaskCacheTest, KeysApartAndEvicted) {
+    MvccMaskCache cache;
+    int computed = 0;
+    auto compute = [&]() {
+        computed++;
+        return std::make_shared<const milvus::TargetBitmap>(100);
+    };
+    auto first = cache.GetOrCompute(KeyAt(10), compute);
+    // a new delete makes a new mask at the same timestamp
+    auto deleted = cache.GetOrCompute(KeyAt(10, 1), compute);
+    EXPECT_NE(first, deleted);
+    EXPECT_EQ(cache.GetOrCompute(KeyAt(10), compute), first);
+    EXPECT_EQ(computed, 2);
+
+    for (size_t i = 0; i < MvccMaskCache::kCapacity; ++i) {
+        cache.GetOrCompute(KeyAt(20 + i), compute);
+    }
+    EXPECT_EQ(cache.size(), MvccMaskCache::kCapacity);
+    EXPECT_NE(cache.GetOrCompute(KeyAt(10), compute), first);
+}
+
+TEST(MvccMaskCacheTest, FailuresAreNotKept) {
+    MvccMaskCache cache;
+    EXPECT_THROW(cache.GetOrCompute(KeyAt(10),
+                                    []() -> MvccMaskCache::Mask {
+                                        throw std::runtime_error("failed");
+                                    }),
+                 std::runtime_error);
+    EXPECT_EQ(cache.size(), 0);
+    auto mask = cache.GetOrCompute(KeyAt(10), []() {
+        return std::make_shared<const milvus::TargetBitmap>(100);
+    });
+    EXPECT_NE(mask, nullptr);
+}
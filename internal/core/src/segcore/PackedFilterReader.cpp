@@ -0,0 +1,372 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "segcore/PackedFilterReader.h"
+
+#include <algorithm>
+#include <string>
+#include <utility>
+
+#include "arrow/api.h"
+#include "arrow/compute/api.h"
+#include "common/EasyAssert.h"
+#include "log/Log.h"
+#include "milvus-storage/common/constants.h"
+#include "parquet/metadata.h"
+#include "parquet/types.h"
+#include "storage/KeyRetriever.h"
+
+namespace milvus::segcore {
+
+namespace {
+
+using MinMax =
+    std::pair<std::shared_ptr<arrow::Scalar>, std::shared_ptr<arrow::Scalar>>;
+
+// the min and max of `stats` as scalars of its physical type, the compare
+// functions cast them to the type of the bound
+arrow::Result<MinMax>
+StatsMinMax(const parquet::Statistics& stats) {
+    switch (stats.physical_type()) {
+        case parquet::Type::INT32: {
+            auto& typed = static_cast<const parquet::Int32Statistics&>(stats);
+            return MinMax(
+                std::make_shared<arrow::Int32Scalar>(typed.min()),
+                std::make_shared<arrow::Int32Scalar>(typed.max()));
+        }
+        case parquet::Type::INT64: {
+            auto& typed = static_cast<const parquet::Int64Statistics&>(stats);
+            return MinMax(
+                std::make_shared<arrow::Int64Scalar>(typed.min()),
+                std::make_shared<arrow::Int64Scalar>(typed.max()));
+        }
+        case parquet::Type::FLOAT: {
+            auto& typed = static_cast<const parquet::FloatStatistics&>(stats);
+            return MinMax(
+                std::make_shared<arrow::FloatScalar>(typed.min()),
+                std::make_shared<arrow::FloatScalar>(typed.max()));
+        }
+        case parquet::Type::DOUBLE: {
+            auto& typed = static_cast<const parquet::DoubleStatistics&>(stats);
+            return MinMax(
+                std::make_shared<arrow::DoubleScalar>(typed.min()),
+                std::make_shared<arrow::DoubleScalar>(typed.max()));
+        }
+        case parquet::Type::BYTE_ARRAY: {
+            auto& typed =
+                static_cast<const parquet::ByteArrayStatistics&>(stats);
+            return MinMax(
+                std::make_shared<arrow::StringScalar>(
+                    parquet::ByteArrayToString(typed.min())),
+                std::make_shared<arrow::StringScalar>(
+                    parquet::ByteArrayToString(typed.max())));
+        }
+        default:
+            return arrow::Status::NotImplemented(
+                "no min max of parquet type ",
+                parquet::TypeToString(stats.physical_type()));
+    }
+}
+
+// `function` of two scalars, false when it's null
+arrow::Result<bool>
+CompareScalars(const std::string& function,
+               const std::shared_ptr<arrow::Scalar>& left,
+               const std::shared_ptr<arrow::Scalar>& right) {
+    ARROW_ASSIGN_OR_RAISE(
+        auto result, arrow::compute::CallFunction(function, {left, right}));
+    auto scalar =
+        std::static_pointer_cast<arrow::BooleanScalar>(result.scalar());
+    return scalar->is_valid && scalar->value;
+}
+
+// the rows of `column` within the bounds of `filter`, null rows are null
+arrow::Result<std::shared_ptr<arrow::BooleanArray>>
+EvaluateFilter(const std::shared_ptr<arrow::Array>& column,
+               const PackedReadFilter& filter) {
+    arrow::Datum mask;
+    auto add_bound = [&](const std::shared_ptr<arrow::Scalar>& bound,
+                         const char* function) -> arrow::Status {
+        if (bound == nullptr) {
+            return arrow::Status::OK();
+        }
+        ARROW_ASSIGN_OR_RAISE(
+            auto side, arrow::compute::CallFunction(function, {column, bound}));
+        if (mask.kind() == arrow::Datum::NONE) {
+            mask = std::move(side);
+            return arrow::Status::OK();
+        }
+        ARROW_ASSIGN_OR_RAISE(mask, arrow::compute::And(mask, side));
+        return arrow::Status::OK();
+    };
+    ARROW_RETURN_NOT_OK(add_bound(
+        filter.lower, filter.lower_inclusive ? "greater_equal" : "greater"));
+    ARROW_RETURN_NOT_OK(add_bound(
+        filter.upper, filter.upper_inclusive ? "less_equal" : "less"));
+    if (mask.kind() == arrow::Datum::NONE) {
+        ARROW_ASSIGN_OR_RAISE(
+            auto all,
+            arrow::MakeArrayFromScalar(arrow::BooleanScalar(true),
+                                       column->length()));
+        return std::static_pointer_cast<arrow::BooleanArray>(all);
+    }
+    return std::static_pointer_cast<arrow::BooleanArray>(mask.make_array());
+}
+
+}  // namespace
+
+bool
+RowGroupMayMatch(const parquet::Statistics* stats,
+                 const PackedReadFilter& filter) {
+    if (stats == nullptr || !stats->HasMinMax()) {
+        return true;
+    }
+    auto min_max = StatsMinMax(*stats);
+    if (!min_max.ok()) {
+        return true;
+    }
+    const auto& [min, max] = min_max.ValueOrDie();
+    // the values of the row group lie in [min, max]
+    if (filter.upper != nullptr) {
+        auto below = CompareScalars(
+            filter.upper_inclusive ? "less" : "less_equal", filter.upper, min);
+        if (below.ok() && below.ValueOrDie()) {
+            return false;
+        }
+    }
+    if (filter.lower != nullptr) {
+        auto above = CompareScalars(
+            filter.lower_inclusive ? "greater" : "greater_equal",
+            filter.lower,
+            max);
+        if (above.ok() && above.ValueOrDie()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+PackedFilterReader::PackedFilterReader(milvus_storage::ArrowFileSystemPtr fs,
+                                       const std::vector<std::string>& paths,
+                                       std::shared_ptr<arrow::Schema> schema,
+                                       PackedReadFilter filter,
+                                       int64_t buffer_size)
+    : fs_(std::move(fs)),
+      schema_(std::move(schema)),
+      filter_(std::move(filter)),
+      buffer_size_(buffer_size) {
+    AssertInfo(fs_ != nullptr, "[StorageV2] file system is nullptr");
+    auto filter_schema_index = schema_->GetFieldIndex(filter_.column);
+    AssertInfo(filter_schema_index >= 0,
+               "[StorageV2] filter column {} is not in the read schema",
+               filter_.column);
+
+    for (const auto& path : paths) {
+        auto result = milvus_storage::FileRowGroupReader::Make(
+            fs_,
+            path,
+            milvus_storage::DEFAULT_READ_BUFFER_SIZE,
+            storage::GetReaderProperties(),
+            storage::GetArrowReaderProperties());
+        AssertInfo(result.ok(),
+                   "[StorageV2] Failed to create file row group reader: {}",
+                   result.status().ToString());
+        auto reader = result.ValueOrDie();
+
+        PackedFile file;
+        file.path = path;
+        auto file_schema = reader->schema();
+        std::vector<std::shared_ptr<arrow::Field>> fields;
+        bool has_filter_column = false;
+        for (int i = 0; i < schema_->num_fields(); ++i) {
+            if (file_schema->GetFieldIndex(schema_->field(i)->name()) < 0) {
+                continue;
+            }
+            if (i == filter_schema_index) {
+                has_filter_column = true;
+                filter_file_ = files_.size();
+                filter_index_ = static_cast<int>(fields.size());
+            }
+            fields.push_back(schema_->field(i));
+            file.schema_indexes.push_back(i);
+        }
+
+        auto parquet_metadata = reader->file_metadata()->GetParquetMetadata();
+        file.row_group_starts.push_back(0);
+        for (int rg = 0; rg < parquet_metadata->num_row_groups(); ++rg) {
+            file.row_group_starts.push_back(
+                file.row_group_starts.back() +
+                parquet_metadata->RowGroup(rg)->num_rows());
+        }
+        if (has_filter_column) {
+            auto column = parquet_metadata->schema()->ColumnIndex(
+                filter_.column);
+            AssertInfo(column >= 0,
+                       "[StorageV2] filter column {} is not a leaf of {}",
+                       filter_.column,
+                       path);
+            for (int rg = 0; rg < parquet_metadata->num_row_groups(); ++rg) {
+                auto chunk =
+                    parquet_metadata->RowGroup(rg)->ColumnChunk(column);
+                filter_stats_.push_back(
+                    chunk->is_stats_set() ? chunk->statistics() : nullptr);
+            }
+        }
+
+        auto status = reader->Close();
+        AssertInfo(status.ok(),
+                   "[StorageV2] failed to close file reader of {}: {}",
+                   path,
+                   status.ToString());
+        if (fields.empty()) {
+            continue;
+        }
+        if (!files_.empty()) {
+            AssertInfo(file.row_group_starts.back() ==
+                           files_.front().row_group_starts.back(),
+                       "[StorageV2] packed file {} has {} rows, {} expected",
+                       path,
+                       file.row_group_starts.back(),
+                       files_.front().row_group_starts.back());
+        }
+        file.projection = arrow::schema(fields);
+        files_.push_back(std::move(file));
+    }
+    AssertInfo(filter_index_ >= 0,
+               "[StorageV2] filter column {} is in none of the packed files",
+               filter_.column);
+}
+
+PackedFilterReader::~PackedFilterReader() {
+    auto status = Close();
+    if (!status.ok()) {
+        LOG_WARN("[StorageV2] failed to close packed filter reader: {}",
+                 status.ToString());
+    }
+}
+
+arrow::Result<std::shared_ptr<arrow::RecordBatch>>
+PackedFilterReader::ReadRows(PackedFile& file, int64_t begin, int64_t end) {
+    const auto& starts = file.row_group_starts;
+    // the row groups overlapping [begin, end)
+    int64_t first =
+        std::upper_bound(starts.begin(), starts.end(), begin) - starts.begin() -
+        1;
+    int64_t last =
+        std::lower_bound(starts.begin(), starts.end(), end) - starts.begin();
+    if (file.reader == nullptr) {
+        ARROW_ASSIGN_OR_RAISE(file.reader,
+                              milvus_storage::FileRowGroupReader::Make(
+                                  fs_,
+                                  file.path,
+                                  file.projection,
+                                  buffer_size_,
+                                  storage::GetReaderProperties(),
+                                  storage::GetArrowReaderProperties()));
+    }
+    ARROW_RETURN_NOT_OK(
+        file.reader->SetRowGroupOffsetAndCount(first, last - first));
+    std::vector<std::shared_ptr<arrow::Table>> tables;
+    tables.reserve(last - first);
+    for (auto rg = first; rg < last; ++rg) {
+        std::shared_ptr<arrow::Table> table;
+        ARROW_RETURN_NOT_OK(file.reader->ReadNextRowGroup(&table));
+        tables.push_back(std::move(table));
+    }
+    ARROW_ASSIGN_OR_RAISE(auto table, arrow::ConcatenateTables(tables));
+    return table->Slice(begin - starts[first], end - begin)
+        ->CombineChunksToBatch();
+}
+
+arrow::Status
+PackedFilterReader::ReadNext(std::shared_ptr<arrow::RecordBatch>* batch) {
+    *batch = nullptr;
+    auto& filter_file = files_[filter_file_];
+    const auto& starts = filter_file.row_group_starts;
+    while (next_row_group_ + 1 < starts.size()) {
+        auto rg = next_row_group_++;
+        auto begin = starts[rg];
+        auto end = starts[rg + 1];
+        if (begin == end) {
+            continue;
+        }
+        if (!RowGroupMayMatch(filter_stats_[rg].get(), filter_)) {
+            skipped_row_groups_++;
+            continue;
+        }
+
+        // the filter column first, the other files only for matching rows
+        ARROW_ASSIGN_OR_RAISE(auto filter_rows,
+                              ReadRows(filter_file, begin, end));
+        ARROW_ASSIGN_OR_RAISE(
+            auto mask,
+            EvaluateFilter(filter_rows->column(filter_index_), filter_));
+        auto matches = mask->true_count();
+        if (matches == 0) {
+            continue;
+        }
+
+        auto num_rows = end - begin;
+        std::vector<std::shared_ptr<arrow::Array>> columns(
+            schema_->num_fields());
+        for (size_t f = 0; f < files_.size(); ++f) {
+            auto rows = filter_rows;
+            if (f != filter_file_) {
+                ARROW_ASSIGN_OR_RAISE(rows, ReadRows(files_[f], begin, end));
+            }
+            for (size_t i = 0; i < files_[f].schema_indexes.size(); ++i) {
+                columns[files_[f].schema_indexes[i]] = rows->column(i);
+            }
+        }
+        // fields none of the files hold were added after the write
+        for (int i = 0; i < schema_->num_fields(); ++i) {
+            if (columns[i] == nullptr) {
+                ARROW_ASSIGN_OR_RAISE(
+                    columns[i],
+                    arrow::MakeArrayOfNull(schema_->field(i)->type(),
+                                           num_rows));
+            }
+        }
+        auto rows = arrow::RecordBatch::Make(schema_, num_rows, columns);
+        if (matches == num_rows) {
+            *batch = std::move(rows);
+            return arrow::Status::OK();
+        }
+        ARROW_ASSIGN_OR_RAISE(auto filtered,
+                              arrow::compute::Filter(rows, mask));
+        *batch = filtered.record_batch();
+        return arrow::Status::OK();
+    }
+    return arrow::Status::OK();
+}
+
+arrow::Status
+PackedFilterReader::Close() {
+    arrow::Status status;
+    for (auto& file : files_) {
+        if (file.reader == nullptr) {
+            continue;
+        }
+        auto close_status = file.reader->Close();
+        if (status.ok() && !close_status.ok()) {
+            status = close_status;
+        }
+        file.reader = nullptr;
+    }
+    return status;
+}
+
+}  // namespace milvus::segcore
@@ -0,0 +1,112 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/record_batch.h"
+#include "arrow/scalar.h"
+#include "arrow/status.h"
+#include "arrow/type.h"
+#include "milvus-storage/filesystem/fs.h"
+#include "milvus-storage/format/parquet/file_reader.h"
+#include "parquet/statistics.h"
+
+namespace milvus::segcore {
+
+// The rows of a packed read whose `column` is within [lower, upper], a null
+// bound leaves that side open and an exclusive one drops the rows equal to
+// it. The bounds are of the type of the column.
+struct PackedReadFilter {
+    std::string column;
+    std::shared_ptr<arrow::Scalar> lower;
+    bool lower_inclusive = true;
+    std::shared_ptr<arrow::Scalar> upper;
+    bool upper_inclusive = true;
+};
+
+// Whether a row group whose filter column has `stats` may hold rows of
+// `filter`, true when the stats carry no min and max.
+bool
+RowGroupMayMatch(const parquet::Statistics* stats,
+                 const PackedReadFilter& filter);
+
+// Reads the rows of the packed files `paths` that match a filter, where
+// PackedRecordBatchReader would read every row of them.
+//
+// The row groups of the file holding the filter column are tested against
+// the filter by their parquet statistics first, the ones that can't match
+// are never read. The filter column of the others is read and evaluated, and
+// only the row groups with matching rows read the columns of the other
+// files, filtered to those rows.
+class PackedFilterReader {
+ public:
+    PackedFilterReader(milvus_storage::ArrowFileSystemPtr fs,
+                       const std::vector<std::string>& paths,
+                       std::shared_ptr<arrow::Schema> schema,
+                       PackedReadFilter filter,
+                       int64_t buffer_size);
+
+    ~PackedFilterReader();
+
+    // the next batch of matching rows in `schema`, nullptr once all are read
+    arrow::Status
+    ReadNext(std::shared_ptr<arrow::RecordBatch>* batch);
+
+    arrow::Status
+    Close();
+
+    // row groups of the filter column skipped by their statistics so far
+    int64_t
+    skipped_row_groups() const {
+        return skipped_row_groups_;
+    }
+
+ private:
+    struct PackedFile {
+        std::string path;
+        // the fields of `schema_` this file holds, with their indexes there
+        std::shared_ptr<arrow::Schema> projection;
+        std::vector<int> schema_indexes;
+        // row_group_starts[i] is the first row of row group i, the last
+        // entry the number of rows of the file
+        std::vector<int64_t> row_group_starts;
+        std::shared_ptr<milvus_storage::FileRowGroupReader> reader;
+    };
+
+    // the rows [begin, end) of the projection of `file`
+    arrow::Result<std::shared_ptr<arrow::RecordBatch>>
+    ReadRows(PackedFile& file, int64_t begin, int64_t end);
+
+    milvus_storage::ArrowFileSystemPtr fs_;
+    std::shared_ptr<arrow::Schema> schema_;
+    PackedReadFilter filter_;
+    int64_t buffer_size_;
+    std::vector<PackedFile> files_;
+    // the file holding the filter column, the column's index in its
+    // projection and the statistics of each of its row groups
+    size_t filter_file_ = 0;
+    int filter_index_ = -1;
+    std::vector<std::shared_ptr<parquet::Statistics>> filter_stats_;
+    size_t next_row_group_ = 0;
+    int64_t skipped_row_groups_ = 0;
+};
+
+}  // namespace milvus::segcore
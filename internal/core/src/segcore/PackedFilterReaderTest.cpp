@@ -0,0 +1,191 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <arrow/array/array_primitive.h>
+#include <arrow/array/builder_primitive.h>
+#include <arrow/c/abi.h>
+#include <arrow/c/bridge.h>
+#include <arrow/record_batch.h>
+#include <arrow/scalar.h>
+#include <arrow/type.h>
+#include <arrow/util/key_value_metadata.h>
+#include <parquet/schema.h>
+#include <parquet/statistics.h>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/common_type_c.h"
+#include "gtest/gtest.h"
+#include "milvus-storage/common/constants.h"
+#include "segcore/PackedFilterReader.h"
+#include "segcore/column_groups_c.h"
+#include "segcore/packed_reader_c.h"
+#include "segcore/packed_writer_c.h"
+#include "test_utils/Constants.h"
+
+using milvus::segcore::PackedReadFilter;
+using milvus::segcore::RowGroupMayMatch;
+
+namespace {
+
+std::shared_ptr<parquet::Statistics>
+Int64Stats(const parquet::ColumnDescriptor* descr,
+           const std::vector<int64_t>& values) {
+    auto stats = parquet::MakeStatistics<parquet::Int64Type>(descr);
+    stats->Update(values.data(), values.size(), 0);
+    return stats;
+}
+
+std::shared_ptr<arrow::Array>
+Int64Array(int64_t begin, int64_t end, int64_t scale) {
+    arrow::Int64Builder builder;
+    for (auto i = begin; i < end; ++i) {
+        EXPECT_TRUE(builder.Append(i * scale).ok());
+    }
+    return builder.Finish().ValueOrDie();
+}
+
+}  // namespace
+
+TEST(PackedFilterReaderTest, RowGroupStatsExcludeRanges) {
+    auto node = parquet::schema::PrimitiveNode::Make(
+        "pk", parquet::Repetition::REQUIRED, parquet::Type::INT64);
+    parquet::ColumnDescriptor descr(node, 0, 0);
+    auto stats = Int64Stats(&descr, {10, 15, 20});
+
+    PackedReadFilter filter;
+    filter.column = "pk";
+    EXPECT_TRUE(RowGroupMayMatch(stats.get(), filter));
+
+    filter.lower = std::make_shared<arrow::Int64Scalar>(20);
+    EXPECT_TRUE(RowGroupMayMatch(stats.get(), filter));
+    filter.lower_inclusive = false;
+    EXPECT_FALSE(RowGroupMayMatch(stats.get(), filter));
+
+    filter.lower = nullptr;
+    filter.upper = std::make_shared<arrow::Int64Scalar>(10);
+    EXPECT_TRUE(RowGroupMayMatch(stats.get(), filter));
+    filter.upper_inclusive = false;
+    EXPECT_FALSE(RowGroupMayMatch(stats.get(), filter));
+
+    // an int32 bound is compared with the int64 stats
+    filter.lower = std::make_shared<arrow::Int32Scalar>(12);
+    filter.lower_inclusive = true;
+    filter.upper = std::make_shared<arrow::Int32Scalar>(12);
+    filter.upper_inclusive = true;
+    EXPECT_TRUE(RowGroupMayMatch(stats.get(), filter));
+    filter.lower = filter.upper = std::make_shared<arrow::Int32Scalar>(30);
+    EXPECT_FALSE(RowGroupMayMatch(stats.get(), filter));
+
+    // no stats, no skipping
+    EXPECT_TRUE(RowGroupMayMatch(nullptr, filter));
+}
+
+TEST(PackedFilterReaderTest, ReadsMatchingRowsOfAllColumnGroups) {
+    auto schema = arrow::schema(
+        {arrow::field("pk",
+                      arrow::int64(),
+                      false,
+                      arrow::key_value_metadata(
+                          {milvus_storage::ARROW_FIELD_ID_KEY}, {"100"})),
+         arrow::field("val",
+                      arrow::int64(),
+                      false,
+                      arrow::key_value_metadata(
+                          {milvus_storage::ARROW_FIELD_ID_KEY}, {"101"}))});
+
+    struct ArrowSchema c_write_schema;
+    ASSERT_TRUE(arrow::ExportSchema(*schema, &c_write_schema).ok());
+    std::string pk_path = TestLocalPath + "filter_pk";
+    std::string val_path = TestLocalPath + "filter_val";
+    char* paths[] = {const_cast<char*>(pk_path.c_str()),
+                     const_cast<char*>(val_path.c_str())};
+
+    CColumnSplits cgs = NewCColumnSplits();
+    int pk_group[] = {0};
+    int val_group[] = {1};
+    AddCColumnSplit(cgs, pk_group, 1);
+    AddCColumnSplit(cgs, val_group, 1);
+
+    // a small buffer so that the batches are flushed to row groups of their
+    // own, the rows returned don't depend on it
+    CPackedWriter c_packed_writer = nullptr;
+    auto c_status = NewPackedWriter(
+        &c_write_schema, 1024, paths, 2, 0, cgs, &c_packed_writer, nullptr);
+    ASSERT_EQ(c_status.error_code, 0);
+
+    constexpr int64_t kBatchRows = 1000;
+    for (int64_t batch_id = 0; batch_id < 3; ++batch_id) {
+        auto begin = batch_id * kBatchRows;
+        auto end = begin + kBatchRows;
+        auto batch = arrow::RecordBatch::Make(
+            schema,
+            kBatchRows,
+            {Int64Array(begin, end, 1), Int64Array(begin, end, 2)});
+        struct ArrowSchema c_origin_schema;
+        ASSERT_TRUE(arrow::ExportSchema(*schema, &c_origin_schema).ok());
+        struct ArrowArray carray;
+        struct ArrowSchema cschema;
+        ASSERT_TRUE(arrow::ExportRecordBatch(*batch, &carray, &cschema).ok());
+        struct ArrowArray arrays[] = {carray};
+        struct ArrowSchema array_schemas[] = {cschema};
+        c_status = WriteRecordBatch(
+            c_packed_writer, arrays, array_schemas, &c_origin_schema);
+        ASSERT_EQ(c_status.error_code, 0);
+    }
+    ASSERT_EQ(CloseWriter(c_packed_writer).error_code, 0);
+    FreeCColumnSplits(cgs);
+
+    struct ArrowSchema c_read_schema;
+    ASSERT_TRUE(arrow::ExportSchema(*schema, &c_read_schema).ok());
+    CPackedReadFilter filter{"pk", "1500", true, "1600", false};
+    CPackedFilterReader c_reader = nullptr;
+    c_status = NewPackedFilterReader(
+        paths, 2, &c_read_schema, 1 << 20, &filter, &c_reader, nullptr);
+    ASSERT_EQ(c_status.error_code, 0) << c_status.error_msg;
+
+    std::vector<int64_t> pks;
+    while (true) {
+        CArrowArray c_array = nullptr;
+        CArrowSchema c_schema = nullptr;
+        c_status = ReadNextFiltered(c_reader, &c_array, &c_schema);
+        ASSERT_EQ(c_status.error_code, 0) << c_status.error_msg;
+        if (c_array == nullptr) {
+            break;
+        }
+        auto batch = arrow::ImportRecordBatch(
+                         static_cast<struct ArrowArray*>(c_array),
+                         static_cast<struct ArrowSchema*>(c_schema))
+                         .ValueOrDie();
+        delete static_cast<struct ArrowArray*>(c_array);
+        delete static_cast<struct ArrowSchema*>(c_schema);
+        auto pk =
+            std::static_pointer_cast<arrow::Int64Array>(batch->column(0));
+        auto val =
+            std::static_pointer_cast<arrow::Int64Array>(batch->column(1));
+        for (int64_t i = 0; i < batch->num_rows(); ++i) {
+            EXPECT_EQ(val->Value(i), 2 * pk->Value(i));
+            pks.push_back(pk->Value(i));
+        }
+    }
+    ASSERT_EQ(pks.size(), 100);
+    for (size_t i = 0; i < pks.size(); ++i) {
+        EXPECT_EQ(pks[i], 1500 + static_cast<int64_t>(i));
+    }
+    ASSERT_EQ(CloseFilterReader(c_reader).error_code, 0);
+}
@@ -0,0 +1,238 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "segcore/SearchIteratorRegistry.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
+#include "log/Log.h"
+
+namespace milvus::segcore {
+
+namespace {
+
+// Copies the first min(dst.size(), src.size()) bits of `src` into `dst`.
+void
+CopyBits(const BitsetView& src, TargetBitmap& dst) {
+    auto num_bits = std::min(dst.size(), src.size());
+    auto num_bytes = num_bits / 8;
+    std::memcpy(
+        reinterpret_cast<uint8_t*>(dst.data()), src.data(), num_bytes);
+    for (size_t i = num_bytes * 8; i < num_bits; ++i) {
+        dst[i] = src.test(i);
+    }
+}
+
+// Brings the filter of `entry` up to date with the bitset of the current
+// page. Returns false when the iterator was built without a filter and the
+// page now filters rows, in which case it can't be resumed.
+bool
+RefreshBitset(SearchIteratorRegistry::Entry& entry, const BitsetView& bitset) {
+    if (bitset.empty()) {
+        if (entry.has_bitset) {
+            entry.bitset.reset();
+        }
+        return true;
+    }
+    if (!entry.has_bitset) {
+        return bitset.none();
+    }
+    CopyBits(bitset, entry.bitset);
+    return true;
+}
+
+}  // namespace
+
+std::atomic<bool> SearchIteratorRegistry::enabled_{false};
+
+SearchIteratorRegistry&
+SearchIteratorRegistry::Instance() {
+    static SearchIteratorRegistry instance;
+    return instance;
+}
+
+void
+SearchIteratorRegistry::SetEnabled(bool enabled) {
+    enabled_.store(enabled);
+}
+
+bool
+SearchIteratorRegistry::IsEnabled() {
+    return enabled_.load();
+}
+
+void
+SearchIteratorRegistry::Configure(size_t max_bytes, int64_t ttl_ms) {
+    std::vector<std::unique_ptr<Entry>> evicted;
+    {
+        std::lock_guard lock(mutex_);
+        max_bytes_ = max_bytes;
+        ttl_ = std::chrono::milliseconds(ttl_ms);
+        EvictLocked(Clock::now(), evicted);
+    }
+    LOG_INFO(
+        "search iterator registry configured, max bytes: {}, ttl ms: {}",
+        max_bytes,
+        ttl_ms);
+}
+
+bool
+SearchIteratorRegistry::IsRegistrable(const SearchInfo& search_info,
+                                      const size_t* query_offsets,
+                                      DataType data_type,
+                                      const BitsetView& bitset) {
+    return IsEnabled() && search_info.iterator_v2_info_.has_value() &&
+           !search_info.iterator_v2_info_->token.empty() &&
+           query_offsets == nullptr && search_info.array_offsets_ == nullptr &&
+           data_type != DataType::VECTOR_ARRAY &&
+           data_type != DataType::VECTOR_SPARSE_U32_F32 &&
+           !bitset.has_out_ids();
+}
+
+void
+SearchIteratorRegistry::NextBatch(int64_t segment_id,
+                                  const SearchInfo& search_info,
+                                  const void* query_data,
+                                  size_t query_bytes,
+                                  const BitsetView& bitset,
+                                  size_t iterator_bytes,
+                                  const IteratorCreator& create,
+                                  SearchResult& result) {
+    const auto& iterator_v2_info = search_info.iterator_v2_info_.value();
+    Key key{iterator_v2_info.token, segment_id, search_info.field_id_.get()};
+
+    // the first page of a token always starts over
+    auto entry = Take(key);
+    if (entry != nullptr && (!iterator_v2_info.last_bound.has_value() ||
+                             !RefreshBitset(*entry, bitset))) {
+        entry.reset();
+    }
+
+    if (entry == nullptr) {
+        entry = std::make_unique<Entry>();
+        auto query = static_cast<const uint8_t*>(query_data);
+        entry->query.assign(query, query + query_bytes);
+        if (!bitset.empty()) {
+            entry->has_bitset = true;
+            entry->bitset = TargetBitmap(bitset.size());
+            CopyBits(bitset, entry->bitset);
+        }
+        entry->iterator = create(
+            entry->query.data(),
+            entry->has_bitset ? BitsetView(entry->bitset) : BitsetView{},
+            entry->pins);
+        entry->bytes = sizeof(Entry) + query_bytes +
+                       (entry->bitset.size() + 7) / 8 + iterator_bytes;
+    }
+
+    entry->iterator->NextBatch(search_info, result);
+    Put(key, std::move(entry));
+}
+
+size_t
+SearchIteratorRegistry::EraseSegment(int64_t segment_id) {
+    std::vector<std::unique_ptr<Entry>> evicted;
+    std::lock_guard lock(mutex_);
+    for (auto it = lru_.begin(); it != lru_.end();) {
+        auto next = std::next(it);
+        if (it->first.segment_id == segment_id) {
+            EraseLocked(it, evicted);
+        }
+        it = next;
+    }
+    return evicted.size();
+}
+
+void
+SearchIteratorRegistry::Clear() {
+    LruList lru;
+    std::lock_guard lock(mutex_);
+    entries_.clear();
+    lru.swap(lru_);
+    current_bytes_ = 0;
+}
+
+size_t
+SearchIteratorRegistry::GetCurrentBytes() const {
+    std::lock_guard lock(mutex_);
+    return current_bytes_;
+}
+
+size_t
+SearchIteratorRegistry::GetEntryCount() const {
+    std::lock_guard lock(mutex_);
+    return entries_.size();
+}
+
+std::unique_ptr<SearchIteratorRegistry::Entry>
+SearchIteratorRegistry::Take(const Key& key) {
+    std::vector<std::unique_ptr<Entry>> evicted;
+    std::lock_guard lock(mutex_);
+    auto now = Clock::now();
+    EvictLocked(now, evicted);
+    auto it = entries_.find(key);
+    if (it == entries_.end()) {
+        return nullptr;
+    }
+    auto entry = std::move(it->second->second.entry);
+    current_bytes_ -= entry->bytes;
+    lru_.erase(it->second);
+    entries_.erase(it);
+    return entry;
+}
+
+void
+SearchIteratorRegistry::Put(const Key& key, std::unique_ptr<Entry> entry) {
+    std::vector<std::unique_ptr<Entry>> evicted;
+    std::lock_guard lock(mutex_);
+    if (!IsEnabled() || entry->bytes > max_bytes_) {
+        evicted.push_back(std::move(entry));
+        return;
+    }
+    auto it = entries_.find(key);
+    if (it != entries_.end()) {
+        // a concurrent page of the same token registered first
+        EraseLocked(it->second, evicted);
+    }
+    auto now = Clock::now();
+    current_bytes_ += entry->bytes;
+    lru_.emplace_front(key, Slot{std::move(entry), now});
+    entries_[key] = lru_.begin();
+    EvictLocked(now, evicted);
+}
+
+void
+SearchIteratorRegistry::EraseLocked(
+    LruList::iterator it, std::vector<std::unique_ptr<Entry>>& evicted) {
+    current_bytes_ -= it->second.entry->bytes;
+    evicted.push_back(std::move(it->second.entry));
+    entries_.erase(it->first);
+    lru_.erase(it);
+}
+
+void
+SearchIteratorRegistry::EvictLocked(
+    Clock::time_point now, std::vector<std::unique_ptr<Entry>>& evicted) {
+    // the back is the least recently used, and so also the first to expire
+    while (!lru_.empty() && (current_bytes_ > max_bytes_ ||
+                             now - lru_.back().second.last_used > ttl_)) {
+        EraseLocked(std::prev(lru_.end()), evicted);
+    }
+}
+
+}  // namespace milvus::segcore
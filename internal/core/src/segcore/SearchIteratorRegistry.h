@@ -0,0 +1,186 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "common/BitsetView.h"
+#include "common/QueryInfo.h"
+#include "common/QueryResult.h"
+#include "common/Types.h"
+#include "query/CachedSearchIterator.h"
+
+namespace milvus::segcore {
+
+// Segment-scoped registry of the CachedSearchIterators of paginated searches
+// (search iterator v2).
+//
+// Every page of a search iterator is a separate request carrying the same
+// token and the distance bound of the previous page. Without the registry
+// each page builds its knowhere iterators from scratch, which for a graph
+// index means walking from the entry point again and for brute force means
+// computing every distance again. With it, a page resumes the iterator the
+// previous page of the same token left on the same segment and field.
+//
+// An entry owns everything its iterator reads once the request that built
+// it is gone: a copy of the query vector, a copy of the filter bitset and
+// pins on the index or the chunks. The bitset copy is refreshed from each
+// page's bitset, so iterators that consult it lazily still skip rows deleted
+// in between. Entries expire after `ttl` without a page and the least
+// recently used ones are evicted to stay within the byte budget. Segments
+// drop their entries on release.
+//
+// Thread safety: All methods are thread-safe. An entry is taken out of the
+// registry while a page runs on it, so concurrent pages of the same token
+// never share an iterator.
+class SearchIteratorRegistry {
+ public:
+    struct Key {
+        std::string token;
+        int64_t segment_id{0};
+        int64_t field_id{0};
+
+        bool
+        operator==(const Key& other) const {
+            return segment_id == other.segment_id &&
+                   field_id == other.field_id && token == other.token;
+        }
+    };
+
+    struct KeyHasher {
+        size_t
+        operator()(const Key& k) const noexcept {
+            return std::hash<std::string>()(k.token) * 1315423911u ^
+                   std::hash<int64_t>()(k.segment_id) ^ (k.field_id << 1);
+        }
+    };
+
+    struct Entry {
+        std::vector<uint8_t> query;
+        bool has_bitset{false};
+        TargetBitmap bitset;
+        // keep the index or the chunks the iterator reads loaded
+        std::vector<std::shared_ptr<void>> pins;
+        std::unique_ptr<query::CachedSearchIterator> iterator;
+        size_t bytes{0};
+    };
+
+    // Builds the iterator of a new entry over the entry's copies of the query
+    // and the bitset, adding to `pins` whatever must stay loaded for it.
+    using IteratorCreator =
+        std::function<std::unique_ptr<query::CachedSearchIterator>(
+            const void* query_data,
+            const BitsetView& bitset,
+            std::vector<std::shared_ptr<void>>& pins)>;
+
+    static SearchIteratorRegistry&
+    Instance();
+
+    static void
+    SetEnabled(bool enabled);
+    static bool
+    IsEnabled();
+
+    void
+    Configure(size_t max_bytes, int64_t ttl_ms);
+
+    // Whether pages of this search can be served from the registry: only
+    // dense, single-vector, row-level searches under a token are.
+    static bool
+    IsRegistrable(const SearchInfo& search_info,
+                  const size_t* query_offsets,
+                  DataType data_type,
+                  const BitsetView& bitset);
+
+    // Runs the page `search_info` asks for on `segment_id`. The first page of
+    // a token, or a page whose iterator expired, builds a new entry with
+    // `create`; the entry is registered again for the next page afterwards.
+    // `iterator_bytes` is the estimated memory held by the knowhere
+    // iterators, accounted on top of the copies the entry makes.
+    void
+    NextBatch(int64_t segment_id,
+              const SearchInfo& search_info,
+              const void* query_data,
+              size_t query_bytes,
+              const BitsetView& bitset,
+              size_t iterator_bytes,
+              const IteratorCreator& create,
+              SearchResult& result);
+
+    size_t
+    EraseSegment(int64_t segment_id);
+
+    void
+    Clear();
+
+    size_t
+    GetCurrentBytes() const;
+
+    size_t
+    GetEntryCount() const;
+
+ private:
+    SearchIteratorRegistry() = default;
+
+    using Clock = std::chrono::steady_clock;
+
+    struct Slot {
+        std::unique_ptr<Entry> entry;
+        Clock::time_point last_used;
+    };
+
+    using LruList = std::list<std::pair<Key, Slot>>;
+
+    // Removes and returns the live entry of `key`, nullptr on miss.
+    std::unique_ptr<Entry>
+    Take(const Key& key);
+
+    void
+    Put(const Key& key, std::unique_ptr<Entry> entry);
+
+    // Unlinks `it`, moving its entry to `evicted` so that it is destroyed
+    // outside the lock.
+    void
+    EraseLocked(LruList::iterator it,
+                std::vector<std::unique_ptr<Entry>>& evicted);
+
+    void
+    EvictLocked(Clock::time_point now,
+                std::vector<std::unique_ptr<Entry>>& evicted);
+
+    static std::atomic<bool> enabled_;
+
+    mutable std::mutex mutex_;
+    size_t max_bytes_{256ULL * 1024 * 1024};
+    Clock::duration ttl_{std::chrono::seconds(60)};
+    size_t current_bytes_{0};
+    LruList lru_;
+    std::unordered_map<Key, LruList::iterator, KeyHasher> entries_;
+};
+
+}  // namespace milvus::segcore
@@ -0,0 +1,178 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "segcore/SearchResultCache.h"
+
+#include "log/Log.h"
+#include "monitor/Monitor.h"
+
+namespace milvus::segcore {
+
+std::atomic<bool> SearchResultCache::enabled_{false};
+
+SearchResultCache&
+SearchResultCache::Instance() {
+    static SearchResultCache instance;
+    return instance;
+}
+
+void
+SearchResultCache::SetEnabled(bool enabled) {
+    enabled_.store(enabled);
+}
+
+bool
+SearchResultCache::IsEnabled() {
+    return enabled_.load();
+}
+
+void
+SearchResultCache::Configure(size_t max_bytes, uint8_t admission_threshold) {
+    std::lock_guard lock(mutex_);
+    max_bytes_ = max_bytes;
+    admission_threshold_ = admission_threshold;
+    frequency_tracker_.Reset();
+    EvictLocked();
+    LOG_INFO(
+        "search result cache configured, max bytes: {}, admission "
+        "threshold: {}",
+        max_bytes_,
+        admission_threshold_);
+}
+
+bool
+SearchResultCache::IsCacheable(const SearchResult& result) {
+    return !result.HasGroupBy() && !result.HasIterators() &&
+           !result.element_level_ && result.valid_count_ < 0;
+}
+
+bool
+SearchResultCache::Get(const Key& key,
+                       int64_t delete_version,
+                       SearchResult& result) {
+    if (!IsEnabled()) {
+        return false;
+    }
+    std::lock_guard lock(mutex_);
+    auto it = entries_.find(key);
+    if (it == entries_.end()) {
+        monitor::internal_core_search_result_cache_miss.Increment();
+        return false;
+    }
+    auto& value = it->second->second;
+    if (value.delete_version != delete_version) {
+        // new deletes arrived since the entry was cached
+        EraseLocked(it->second);
+        monitor::internal_core_search_result_cache_miss.Increment();
+        return false;
+    }
+    lru_.splice(lru_.begin(), lru_, it->second);
+
+    result.total_nq_ = value.total_nq;
+    result.unity_topK_ = value.unity_topk;
+    result.total_data_cnt_ = value.total_data_cnt;
+    result.distances_ = value.distances;
+    result.seg_offsets_ = value.seg_offsets;
+    result.topk_per_nq_prefix_sum_ = value.topk_per_nq_prefix_sum;
+    monitor::internal_core_search_result_cache_hit.Increment();
+    return true;
+}
+
+void
+SearchResultCache::Put(const Key& key,
+                       int64_t delete_version,
+                       const SearchResult& result) {
+    if (!IsEnabled() || !IsCacheable(result)) {
+        return;
+    }
+    Value value;
+    value.delete_version = delete_version;
+    value.total_nq = result.total_nq_;
+    value.unity_topk = result.unity_topK_;
+    value.total_data_cnt = result.total_data_cnt_;
+    value.distances = result.distances_;
+    value.seg_offsets = result.seg_offsets_;
+    value.topk_per_nq_prefix_sum = result.topk_per_nq_prefix_sum_;
+    auto bytes = value.bytes();
+
+    std::lock_guard lock(mutex_);
+    if (bytes > max_bytes_) {
+        return;
+    }
+    auto it = entries_.find(key);
+    if (it != entries_.end()) {
+        EraseLocked(it->second);
+    } else if (!frequency_tracker_.RecordAndCheck(
+                   KeyHasher()(key), admission_threshold_)) {
+        return;
+    }
+    lru_.emplace_front(key, std::move(value));
+    entries_[key] = lru_.begin();
+    current_bytes_ += bytes;
+    EvictLocked();
+}
+
+size_t
+SearchResultCache::EraseSegment(int64_t segment_id) {
+    std::lock_guard lock(mutex_);
+    size_t erased = 0;
+    for (auto it = lru_.begin(); it != lru_.end();) {
+        auto next = std::next(it);
+        if (it->first.segment_id == segment_id) {
+            EraseLocked(it);
+            ++erased;
+        }
+        it = next;
+    }
+    return erased;
+}
+
+void
+SearchResultCache::Clear() {
+    std::lock_guard lock(mutex_);
+    lru_.clear();
+    entries_.clear();
+    current_bytes_ = 0;
+    frequency_tracker_.Reset();
+}
+
+size_t
+SearchResultCache::GetCurrentBytes() const {
+    std::lock_guard lock(mutex_);
+    return current_bytes_;
+}
+
+size_t
+SearchResultCache::GetEntryCount() const {
+    std::lock_guard lock(mutex_);
+    return entries_.size();
+}
+
+void
+SearchResultCache::EraseLocked(LruList::iterator it) {
+    current_bytes_ -= it->second.bytes();
+    entries_.erase(it->first);
+    lru_.erase(it);
+}
+
+void
+SearchResultCache::EvictLocked() {
+    while (current_bytes_ > max_bytes_ && !lru_.empty()) {
+        EraseLocked(std::prev(lru_.end()));
+    }
+}
+
+}  // namespace milvus::segcore
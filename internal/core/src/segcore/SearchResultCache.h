@@ -0,0 +1,158 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "common/QueryResult.h"
+#include "common/Types.h"
+#include "exec/expression/ExprCache.h"
+
+namespace milvus::segcore {
+
+// Segment-scoped cache of raw vector search results for sealed segments.
+//
+// Dashboards tend to re-issue the exact same search (same plan, same query
+// vectors) against sealed segments. A sealed segment is immutable except for
+// deletes, so as long as no new delete arrived and the query timestamps see
+// every insert and delete of the segment, the per-segment SearchResult is
+// identical and VectorSearchNode can be skipped entirely.
+//
+// Only the fields produced by the search itself are cached (distances,
+// offsets and per-nq topk); primary keys and output fields are still filled
+// by the regular reduce path.
+//
+// An entry is keyed by the SHA-256 digests of the serialized plan and
+// placeholder group, a hit compares both in full.
+//
+// Thread safety: All methods are thread-safe
+class SearchResultCache {
+ public:
+    using Digest = std::array<uint8_t, 32>;
+
+    struct Key {
+        int64_t segment_id{0};
+        Digest plan_digest{};
+        Digest placeholder_digest{};
+
+        bool
+        operator==(const Key& other) const {
+            return segment_id == other.segment_id &&
+                   plan_digest == other.plan_digest &&
+                   placeholder_digest == other.placeholder_digest;
+        }
+    };
+
+    struct KeyHasher {
+        size_t
+        operator()(const Key& k) const noexcept {
+            // the leading bytes of a digest are as good as any hash
+            uint64_t plan, placeholder;
+            std::memcpy(&plan, k.plan_digest.data(), sizeof(plan));
+            std::memcpy(
+                &placeholder, k.placeholder_digest.data(), sizeof(placeholder));
+            return std::hash<int64_t>()(k.segment_id) * 1315423911u ^ plan ^
+                   (placeholder << 1);
+        }
+    };
+
+    struct Value {
+        // number of applied deletes when the result was cached, any new
+        // delete invalidates the entry
+        int64_t delete_version{0};
+        int64_t total_nq{0};
+        int64_t unity_topk{0};
+        int64_t total_data_cnt{0};
+        std::vector<float> distances;
+        std::vector<int64_t> seg_offsets;
+        std::vector<size_t> topk_per_nq_prefix_sum;
+
+        size_t
+        bytes() const {
+            return sizeof(Value) + distances.size() * sizeof(float) +
+                   seg_offsets.size() * sizeof(int64_t) +
+                   topk_per_nq_prefix_sum.size() * sizeof(size_t);
+        }
+    };
+
+    static SearchResultCache&
+    Instance();
+
+    static void
+    SetEnabled(bool enabled);
+    static bool
+    IsEnabled();
+
+    void
+    Configure(size_t max_bytes, uint8_t admission_threshold);
+
+    // Results with group by, iterators or element-level hits carry state
+    // that can't be replayed from the cached fields.
+    static bool
+    IsCacheable(const SearchResult& result);
+
+    // Fill `result` from the cache when an entry with the same delete
+    // version exists. Returns false on miss.
+    bool
+    Get(const Key& key, int64_t delete_version, SearchResult& result);
+
+    void
+    Put(const Key& key, int64_t delete_version, const SearchResult& result);
+
+    size_t
+    EraseSegment(int64_t segment_id);
+
+    void
+    Clear();
+
+    size_t
+    GetCurrentBytes() const;
+
+    size_t
+    GetEntryCount() const;
+
+ private:
+    SearchResultCache() = default;
+
+    using LruList = std::list<std::pair<Key, Value>>;
+
+    void
+    EraseLocked(LruList::iterator it);
+
+    void
+    EvictLocked();
+
+    static std::atomic<bool> enabled_;
+
+    mutable std::mutex mutex_;
+    size_t max_bytes_{64ULL * 1024 * 1024};
+    uint8_t admission_threshold_{2};
+    size_t current_bytes_{0};
+    LruList lru_;
+    std::unordered_map<Key, LruList::iterator, KeyHasher> entries_;
+    exec::FrequencyTracker frequency_tracker_;
+};
+
+}  // namespace milvus::segcore
@@ -0,0 +1,170 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <vector>
+
+#include "common/QueryResult.h"
+#include "segcore/SearchResultCache.h"
+
+using milvus::SearchResult;
+using milvus::segcore::SearchResultCache;
+
+namespace {
+
+// digests filled with `plan` and `placeholder`
+SearchResultCache::Key
+MakeKey(int64_t segment_id, uint8_t plan, uint8_t placeholder) {
+    SearchResultCache::Key key;
+    key.segment_id = segment_id;
+    key.plan_digest.fill(plan);
+    key.placeholder_digest.fill(placeholder);
+    return key;
+}
+
+SearchResult
+MakeResult(int64_t nq, int64_t topk) {
+    SearchResult result;
+    result.total_nq_ = nq;
+    result.unity_topK_ = topk;
+    result.total_data_cnt_ = 1000;
+    for (int64_t i = 0; i < nq * topk; ++i) {
+        result.distances_.push_back(static_cast<float>(i));
+        result.seg_offsets_.push_back(i * 3);
+    }
+    return result;
+}
+
+class SearchResultCacheTest : public ::testing::Test {
+ protected:
+    void
+    SetUp() override {
+        SearchResultCache::SetEnabled(true);
+        SearchResultCache::Instance().Configure(1 << 20, 1);
+        SearchResultCache::Instance().Clear();
+    }
+
+    void
+    TearDown() override {
+        SearchResultCache::Instance().Clear();
+        SearchResultCache::SetEnabled(false);
+    }
+};
+
+}  // namespace
+
+TEST_F(SearchResultCacheTest, PutGet) {
+    auto& cache = SearchResultCache::Instance();
+    auto key = MakeKey(1, 100, 200);
+    cache.Put(key, 0, MakeResult(2, 10));
+
+    SearchResult result;
+    ASSERT_TRUE(cache.Get(key, 0, result));
+    EXPECT_EQ(result.total_nq_, 2);
+    EXPECT_EQ(result.unity_topK_, 10);
+    EXPECT_EQ(result.total_data_cnt_, 1000);
+    ASSERT_EQ(result.seg_offsets_.size(), 20);
+    EXPECT_EQ(result.seg_offsets_[5], 15);
+    EXPECT_FLOAT_EQ(result.distances_[5], 5.0f);
+
+    SearchResult other;
+    EXPECT_FALSE(cache.Get(MakeKey(1, 100, 201), 0, other));
+    EXPECT_FALSE(cache.Get(MakeKey(2, 100, 200), 0, other));
+}
+
+TEST_F(SearchResultCacheTest, HitComparesWholeDigest) {
+    auto& cache = SearchResultCache::Instance();
+    auto key = MakeKey(1, 100, 200);
+    cache.Put(key, 0, MakeResult(1, 10));
+
+    // same bucket hash, the digests differ past the bytes it reads
+    auto other_plan = key;
+    other_plan.plan_digest.back() ^= 1;
+    auto other_placeholder = key;
+    other_placeholder.placeholder_digest.back() ^= 1;
+    ASSERT_EQ(SearchResultCache::KeyHasher()(key),
+              SearchResultCache::KeyHasher()(other_plan));
+
+    SearchResult result;
+    EXPECT_FALSE(cache.Get(other_plan, 0, result));
+    EXPECT_FALSE(cache.Get(other_placeholder, 0, result));
+    EXPECT_TRUE(cache.Get(key, 0, result));
+}
+
+TEST_F(SearchResultCacheTest, NewDeletesInvalidate) {
+    auto& cache = SearchResultCache::Instance();
+    auto key = MakeKey(1, 100, 200);
+    cache.Put(key, 5, MakeResult(1, 10));
+
+    SearchResult result;
+    EXPECT_FALSE(cache.Get(key, 6, result));
+    // the stale entry is dropped on mismatch
+    EXPECT_EQ(cache.GetEntryCount(), 0);
+    EXPECT_EQ(cache.GetCurrentBytes(), 0);
+}
+
+TEST_F(SearchResultCacheTest, AdmissionThreshold) {
+    auto& cache = SearchResultCache::Instance();
+    cache.Configure(1 << 20, 2);
+    auto key = MakeKey(1, 100, 200);
+
+    cache.Put(key, 0, MakeResult(1, 10));
+    SearchResult result;
+    EXPECT_FALSE(cache.Get(key, 0, result));
+
+    cache.Put(key, 0, MakeResult(1, 10));
+    EXPECT_TRUE(cache.Get(key, 0, result));
+}
+
+TEST_F(SearchResultCacheTest, EvictWithinBudget) {
+    auto& cache = SearchResultCache::Instance();
+    auto entry_bytes = SearchResultCache::Value{}.bytes() +
+                       100 * (sizeof(float) + sizeof(int64_t));
+    cache.Configure(entry_bytes * 2, 1);
+
+    for (uint64_t i = 0; i < 4; ++i) {
+        cache.Put(MakeKey(1, i, 0), 0, MakeResult(1, 100));
+    }
+    EXPECT_EQ(cache.GetEntryCount(), 2);
+    EXPECT_LE(cache.GetCurrentBytes(), entry_bytes * 2);
+
+    // the oldest entries are evicted first
+    SearchResult result;
+    EXPECT_FALSE(cache.Get(MakeKey(1, 0, 0), 0, result));
+    EXPECT_TRUE(cache.Get(MakeKey(1, 3, 0), 0, result));
+}
+
+TEST_F(SearchResultCacheTest, EraseSegment) {
+    auto& cache = SearchResultCache::Instance();
+    cache.Put(MakeKey(1, 100, 0), 0, MakeResult(1, 10));
+    cache.Put(MakeKey(1, 101, 0), 0, MakeResult(1, 10));
+    cache.Put(MakeKey(2, 100, 0), 0, MakeResult(1, 10));
+
+    EXPECT_EQ(cache.EraseSegment(1), 2);
+    EXPECT_EQ(cache.GetEntryCount(), 1);
+
+    SearchResult result;
+    EXPECT_TRUE(cache.Get(MakeKey(2, 100, 0), 0, result));
+}
+
+TEST_F(SearchResultCacheTest, SkipUncacheableResult) {
+    auto& cache = SearchResultCache::Instance();
+    auto result = MakeResult(1, 10);
+    result.valid_count_ = 3;
+    cache.Put(MakeKey(1, 100, 0), 0, result);
+    EXPECT_EQ(cache.GetEntryCount(), 0);
+}
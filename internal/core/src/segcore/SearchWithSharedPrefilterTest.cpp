@@ -0,0 +1,153 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/QueryResult.h"
+#include "common/Schema.h"
+#include "common/Types.h"
+#include "knowhere/comp/index_param.h"
+#include "pb/plan.pb.h"
+#include "query/ExecPlanNodeVisitor.h"
+#include "query/Plan.h"
+#include "query/PlanImpl.h"
+#include "test_utils/DataGen.h"
+#include "test_utils/storage_test_utils.h"
+
+using namespace milvus;
+using namespace milvus::segcore;
+
+namespace {
+
+namespace planpb = proto::plan;
+
+constexpr int64_t kRows = 2000;
+constexpr int64_t kDim = 16;
+constexpr int64_t kNq = 5;
+
+class SearchWithSharedPrefilterTest : public ::testing::Test {
+ protected:
+    void
+    SetUp() override {
+        schema_ = std::make_shared<Schema>();
+        auto pk_fid = schema_->AddDebugField("pk", DataType::INT64);
+        schema_->set_primary_field_id(pk_fid);
+        vec_fid_ = schema_->AddDebugField(
+            "vec", DataType::VECTOR_FLOAT, kDim, knowhere::metric::L2);
+        other_vec_fid_ = schema_->AddDebugField(
+            "other_vec", DataType::VECTOR_FLOAT, kDim, knowhere::metric::IP);
+        counter_fid_ = schema_->AddDebugField("counter", DataType::INT64);
+        auto raw_data = DataGen(schema_, kRows);
+        segment_ = CreateSealedWithFieldDataLoaded(schema_, raw_data);
+
+        // every third row is deleted after all the inserts
+        auto pks = raw_data.get_col<int64_t>(pk_fid);
+        auto ids = std::make_unique<proto::schema::IDs>();
+        for (int64_t i = 0; i < kRows; i += 3) {
+            ids->mutable_int_id()->add_data(pks[i]);
+        }
+        auto deletes = ids->int_id().data_size();
+        std::vector<Timestamp> timestamps(deletes, kRows);
+        segment_->Delete(deletes, ids.get(), timestamps.data());
+    }
+
+    std::unique_ptr<query::Plan>
+    MakePlan(FieldId vec_fid,
+             const std::string& metric_type,
+             int64_t counter_bound) {
+        planpb::PlanNode plan_node;
+        auto* anns = plan_node.mutable_vector_anns();
+        anns->set_vector_type(planpb::VectorType::FloatVector);
+        anns->set_field_id(vec_fid.get());
+        anns->set_placeholder_tag("$0");
+        auto* query_info = anns->mutable_query_info();
+        query_info->set_topk(10);
+        query_info->set_metric_type(metric_type);
+        query_info->set_search_params("{}");
+        query_info->set_round_decimal(-1);
+        auto* unary = anns->mutable_predicates()->mutable_unary_range_expr();
+        auto* column = unary->mutable_column_info();
+        column->set_field_id(counter_fid_.get());
+        column->set_data_type(proto::schema::DataType::Int64);
+        unary->set_op(planpb::OpType::LessThan);
+        unary->mutable_value()->set_int64_val(counter_bound);
+
+        auto plan_bytes = plan_node.SerializeAsString();
+        return query::CreateSearchPlanByExpr(
+            schema_, plan_bytes.data(), plan_bytes.size());
+    }
+
+    std::unique_ptr<query::PlaceholderGroup>
+    MakePlaceholderGroup(const query::Plan* plan, int64_t seed) {
+        auto ph_bytes =
+            CreatePlaceholderGroup(kNq, kDim, seed).SerializeAsString();
+        return query::ParsePlaceholderGroup(plan, ph_bytes);
+    }
+
+    SchemaPtr schema_;
+    FieldId vec_fid_;
+    FieldId other_vec_fid_;
+    FieldId counter_fid_;
+    SegmentSealedUPtr segment_;
+};
+
+}  // namespace
+
+TEST_F(SearchWithSharedPrefilterTest, MatchesSeparateSearches) {
+    auto timestamps = {Timestamp(kRows / 2), Timestamp(kRows + 1)};
+    for (Timestamp ts : timestamps) {
+        // two sub-requests share the filter, the last one has its own
+        std::vector<std::unique_ptr<query::Plan>> plans;
+        plans.push_back(MakePlan(vec_fid_, knowhere::metric::L2, 1000));
+        plans.push_back(MakePlan(other_vec_fid_, knowhere::metric::IP, 1000));
+        plans.push_back(MakePlan(vec_fid_, knowhere::metric::L2, 500));
+        std::vector<std::unique_ptr<query::PlaceholderGroup>> phgs;
+        std::vector<const query::Plan*> plan_ptrs;
+        std::vector<const query::PlaceholderGroup*> phg_ptrs;
+        for (size_t i = 0; i < plans.size(); ++i) {
+            phgs.push_back(MakePlaceholderGroup(plans[i].get(), 1024 + i));
+            plan_ptrs.push_back(plans[i].get());
+            phg_ptrs.push_back(phgs[i].get());
+        }
+
+        auto key = [&](size_t i) {
+            return query::ExecPlanNodeVisitor::SharedPrefilterKey(
+                *plans[i]->plan_node_);
+        };
+        ASSERT_TRUE(key(0).has_value());
+        ASSERT_EQ(key(0), key(1));
+        ASSERT_NE(key(0), key(2));
+
+        auto shared = segment_->SearchWithSharedPrefilter(
+            plan_ptrs, phg_ptrs, ts, folly::CancellationToken(), 0, 0);
+        ASSERT_EQ(shared.size(), plans.size());
+        for (size_t i = 0; i < plans.size(); ++i) {
+            auto separate =
+                segment_->Search(plans[i].get(), phgs[i].get(), ts);
+            ASSERT_EQ(shared[i]->total_nq_, separate->total_nq_);
+            ASSERT_EQ(shared[i]->unity_topK_, separate->unity_topK_);
+            ASSERT_EQ(shared[i]->total_data_cnt_, separate->total_data_cnt_);
+            ASSERT_EQ(shared[i]->seg_offsets_, separate->seg_offsets_)
+                << "plan " << i << " at " << ts;
+            ASSERT_EQ(shared[i]->distances_, separate->distances_)
+                << "plan " << i << " at " << ts;
+        }
+    }
+}
@@ -11,9 +11,11 @@
 
 #include "SegcoreConfig.h"
 
+#include <algorithm>
 #include <exception>
 #include <vector>
 
+#include "common/FieldMeta.h"
 #include "yaml-cpp/yaml.h"
 
 namespace milvus::segcore {
@@ -26,6 +28,27 @@ subnode(const YAML::Node& parent, const std::string& key) {
     return node;
 }
 
+// bounds of the rows of a chunk sized by the chunk target bytes, narrow
+// vectors would otherwise get huge chunks and wide ones a row or two
+constexpr int64_t kMinFieldChunkRows = 128;
+constexpr int64_t kMaxFieldChunkRows = 1 << 20;
+
+int64_t
+SegcoreConfig::get_field_chunk_rows(const FieldMeta& field_meta,
+                                    int64_t chunk_rows) const {
+    auto data_type = field_meta.get_data_type();
+    auto dense_vector = IsDenseFloatVectorDataType(data_type) ||
+                        IsBinaryVectorDataType(data_type) ||
+                        IsIntVectorDataType(data_type);
+    if (chunk_target_bytes_ <= 0 || !dense_vector) {
+        return chunk_rows;
+    }
+    auto row_bytes = std::max<int64_t>(field_meta.get_sizeof(), 1);
+    return std::clamp(chunk_target_bytes_ / row_bytes,
+                      kMinFieldChunkRows,
+                      kMaxFieldChunkRows);
+}
+
 template <typename T, typename Func>
 std::vector<T>
 apply_parser(const YAML::Node& node, Func func) {
@@ -18,6 +18,10 @@
 #include "common/EasyAssert.h"
 #include "knowhere/comp/index_param.h"
 
+namespace milvus {
+class FieldMeta;
+}
+
 namespace milvus::segcore {
 
 class SegcoreConfig {
@@ -42,6 +46,25 @@ class SegcoreConfig {
         chunk_rows_ = chunk_rows;
     }
 
+    // bytes a growing chunk of a dense vector field aims at, 0 to give every
+    // field chunk_rows rows per chunk
+    void
+    set_chunk_target_bytes(int64_t bytes) {
+        chunk_target_bytes_ = bytes;
+    }
+
+    int64_t
+    get_chunk_target_bytes() const {
+        return chunk_target_bytes_;
+    }
+
+    // Rows per growing chunk of `field_meta` in a segment chunked by
+    // `chunk_rows`. Dense vector fields size their chunks to
+    // get_chunk_target_bytes(); the other fields keep `chunk_rows`, the
+    // expressions walk their chunks in lockstep.
+    int64_t
+    get_field_chunk_rows(const FieldMeta& field_meta, int64_t chunk_rows) const;
+
     int64_t
     get_nlist() const {
         return nlist_;
@@ -72,6 +95,18 @@ class SegcoreConfig {
         return enable_interim_segment_index_;
     }
 
+    // build the interim index on a background thread once a growing segment
+    // reaches the build threshold, instead of inline in the insert
+    void
+    set_enable_async_interim_index_build(bool enable) {
+        enable_async_interim_index_build_ = enable;
+    }
+
+    bool
+    get_enable_async_interim_index_build() const {
+        return enable_async_interim_index_build_;
+    }
+
     void
     set_storage_v3_enabled(bool storage_v3_enabled) {
         this->storage_v3_enabled_ = storage_v3_enabled;
@@ -218,6 +253,18 @@ class SegcoreConfig {
         return interim_index_mem_expansion_rate_;
     }
 
+    // bytes of released growing segment chunks kept for reuse by later
+    // growing segments, 0 to free them on release
+    void
+    set_growing_chunk_pool_bytes(int64_t bytes) {
+        growing_chunk_pool_bytes_ = bytes;
+    }
+
+    int64_t
+    get_growing_chunk_pool_bytes() const {
+        return growing_chunk_pool_bytes_;
+    }
+
  private:
     inline static const std::unordered_set<std::string>
         valid_dense_vector_index_type = {
@@ -226,8 +273,10 @@ class SegcoreConfig {
     };
     inline static bool storage_v3_enabled_ = false;
     inline static bool enable_interim_segment_index_ = false;
+    inline static bool enable_async_interim_index_build_ = false;
     inline static bool enable_growing_source_flush_ = false;
     inline static int64_t chunk_rows_ = 32 * 1024;
+    inline static int64_t chunk_target_bytes_ = 0;
     inline static int64_t nlist_ = 100;
     inline static int64_t nprobe_ = 4;
     inline static int64_t sub_dim_ = 2;
@@ -243,6 +292,7 @@ class SegcoreConfig {
     inline static bool prefer_field_data_when_index_has_raw_data_ = false;
     inline static float interim_index_mem_expansion_rate_ = 1.15f;
     inline static int64_t max_group_by_groups_ = kDefaultMaxGroupByGroups;
+    inline static int64_t growing_chunk_pool_bytes_ = 0;
 };
 
 }  // namespace milvus::segcore
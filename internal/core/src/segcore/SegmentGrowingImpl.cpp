@@ -50,6 +50,8 @@
 #include "common/Span.h"
 #include "common/Types.h"
 #include "common/VectorArray.h"
+#include "exec/QueryContext.h"
+#include "futures/Executor.h"
 #include "glog/logging.h"
 #include "index/Index.h"
 #include "index/TextMatchIndex.h"
@@ -66,11 +68,14 @@
 #include "mmap/Types.h"
 #include "pb/schema.pb.h"
 #include "pb/segcore.pb.h"
+#include "plan/PlanNode.h"
+#include "query/ExecPlanNodeVisitor.h"
 #include "query/SearchOnGrowing.h"
 #include "segcore/AckResponder.h"
 #include "segcore/ConcurrentVector.h"
 #include "segcore/DeletedRecord.h"
 #include "segcore/FieldIndexing.h"
+#include "segcore/IndexConfigGenerator.h"
 #include "segcore/InsertRecord.h"
 #include "segcore/SegmentGrowingImpl.h"
 #include "segcore/Utils.h"
@@ -339,10 +344,10 @@ SegmentGrowingImpl::try_remove_chunks(FieldId fieldId) {
     if (IsVectorDataType(data_type)) {
         if (indexing_record_.HasRawData(fieldId)) {
             auto vec_data_base = insert_record_.get_data_base(fieldId);
+            std::unique_lock lck(chunk_remove_mutex_, std::try_to_lock);
             if (vec_data_base && vec_data_base->num_chunk() > 0 &&
-                chunk_mutex_.try_lock()) {
+                lck.owns_lock() && chunk_read_gate_.Idle()) {
                 vec_data_base->clear();
-                chunk_mutex_.unlock();
             }
         }
     }
@@ -375,6 +380,7 @@ SegmentGrowingImpl::EstimateSegmentResourceUsage() const {
     // For vector fields with interim index:
     //   - IVF_FLAT_CC: index stores raw data, so count index_size = raw_size * memExpansionRate (memory)
     //   - SCANN_DVR: index doesn't store raw data, so count raw_size (memory or mmap)
+    //     plus the codes the index keeps in memory
     // For other fields: count raw_size based on mmap setting
     bool interim_index_enabled =
         segcore_config_.get_enable_interim_segment_index();
@@ -439,12 +445,17 @@ SegmentGrowingImpl::EstimateSegmentResourceUsage() const {
                             segcore_config_
                                 .get_interim_index_mem_expansion_rate());
                     } else {
-                        // SCANN_DVR or no interim index
+                        // SCANN_DVR: the index holds quantized codes only and
+                        // refines from the raw vectors, which stay in place
                         if (growing_mmap_enabled) {
                             disk_bytes += field_bytes;
                         } else {
                             memory_bytes += field_bytes;
                         }
+                        memory_bytes += num_rows *
+                                        EstimateInterimQuantizedIndexRowBytes(
+                                            segcore_config_,
+                                            field_meta.get_dim());
                     }
                 }
             } else {
@@ -1197,6 +1208,9 @@ SegmentGrowingImpl::LoadDeletedRecord(const LoadDeletedRecordInfo& info) {
 
     // step 2: push delete info to delete_record
     deleted_record_.LoadPush(pks, timestamps);
+
+    // step 3: persist delete snapshot for the loaded records
+    deleted_record_.FinishLoad();
 }
 
 PinWrapper<SpanBase>
@@ -1394,7 +1408,7 @@ SegmentGrowingImpl::chunk_array_views_by_offsets(
 int64_t
 SegmentGrowingImpl::num_chunk(FieldId field_id) const {
     auto size = get_insert_record().ack_responder_.GetAck();
-    return upper_div(size, segcore_config_.get_chunk_rows());
+    return upper_div(size, insert_record_.get_size_per_chunk(field_id));
 }
 
 DataType
@@ -1440,6 +1454,118 @@ SegmentGrowingImpl::vector_search(SearchInfo& search_info,
                            output);
 }
 
+std::vector<std::unique_ptr<SearchResult>>
+SegmentGrowingImpl::SearchSegments(
+    const std::vector<const SegmentGrowingImpl*>& segments,
+    const query::Plan* plan,
+    const query::PlaceholderGroup* placeholder_group,
+    Timestamp timestamp,
+    const folly::CancellationToken& cancel_token,
+    int32_t consistency_level,
+    Timestamp collection_ttl,
+    int64_t entity_ttl_physical_time_us,
+    bool enable_expr_cache) {
+    AssertInfo(plan != nullptr && placeholder_group != nullptr &&
+                   !placeholder_group->empty(),
+               "search requires a plan and a non-empty placeholder group");
+    std::vector<std::unique_ptr<SearchResult>> results(segments.size());
+    auto& node = *plan->plan_node_;
+    const auto& ph = placeholder_group->at(0);
+
+    // only a plain pre-filter followed by the vector search is fused, its
+    // bitset is all the pipeline would hand to vector_search
+    auto fusable =
+        segments.size() > 1 && !ph.element_level_ &&
+        std::dynamic_pointer_cast<const plan::VectorSearchNode>(
+            node.plannodes_) != nullptr &&
+        query::ExecPlanNodeVisitor::SharedPrefilterKey(node).has_value();
+    if (fusable) {
+        std::vector<std::shared_lock<std::shared_mutex>> locks;
+        std::vector<std::shared_ptr<const exec::SharedPrefilter>> prefilters;
+        std::vector<const SegmentGrowingImpl*> searched;
+        std::vector<size_t> searched_ids;
+        std::vector<BitsetView> bitsets;
+        std::vector<int64_t> data_counts;
+        locks.reserve(segments.size());
+        for (size_t i = 0; i < segments.size(); ++i) {
+            auto segment = segments[i];
+            locks.emplace_back(segment->mutex_);
+            segment->check_search(plan);
+            query::ExecPlanNodeVisitor visitor(*segment,
+                                               timestamp,
+                                               placeholder_group,
+                                               cancel_token,
+                                               consistency_level,
+                                               collection_ttl,
+                                               entity_ttl_physical_time_us);
+            visitor.SetEnableExprCache(enable_expr_cache);
+            visitor.SetSearchExecutor(
+                futures::getNamedSearchCPUExecutor(plan->search_pool_));
+            auto prefilter = visitor.EvalSharedPrefilter(node);
+            BitsetView bitset;
+            int64_t data_count = 0;
+            if (prefilter != nullptr) {
+                data_count = prefilter->bits->size();
+                if (!prefilter->all_rows_visible) {
+                    bitset = BitsetView(static_cast<const uint8_t*>(
+                                            prefilter->bits->GetRawData()),
+                                        data_count);
+                }
+            }
+            if (prefilter == nullptr || (!bitset.empty() && bitset.all())) {
+                auto result = std::make_unique<SearchResult>();
+                result->total_nq_ = ph.num_of_queries_;
+                result->unity_topK_ = 0;
+                result->total_data_cnt_ = data_count;
+                result->segment_ = (void*)segment;
+                results[i] = std::move(result);
+                continue;
+            }
+            prefilters.push_back(std::move(prefilter));
+            searched.push_back(segment);
+            searched_ids.push_back(i);
+            bitsets.push_back(bitset);
+            data_counts.push_back(data_count);
+        }
+
+        std::vector<SearchResult> fused;
+        milvus::OpContext op_context(cancel_token);
+        if (!searched.empty() &&
+            query::SearchOnGrowingSegments(searched,
+                                           node.search_info_,
+                                           ph.get_blob(),
+                                           ph.num_of_queries_,
+                                           timestamp,
+                                           bitsets,
+                                           &op_context,
+                                           fused)) {
+            for (size_t j = 0; j < searched.size(); ++j) {
+                auto result = std::make_unique<SearchResult>(
+                    std::move(fused[j]));
+                result->total_data_cnt_ = data_counts[j];
+                result->segment_ = (void*)searched[j];
+                results[searched_ids[j]] = std::move(result);
+            }
+        }
+    }
+
+    // Search takes the segment lock of its own again
+    for (size_t i = 0; i < segments.size(); ++i) {
+        if (results[i] == nullptr) {
+            results[i] = segments[i]->Search(plan,
+                                             placeholder_group,
+                                             timestamp,
+                                             cancel_token,
+                                             consistency_level,
+                                             collection_ttl,
+                                             entity_ttl_physical_time_us,
+                                             false,
+                                             enable_expr_cache);
+        }
+    }
+    return results;
+}
+
 template <typename SetOutput>
 void
 SegmentGrowingImpl::bulk_subscript_text_impl(FieldId field_id,
@@ -1822,11 +1948,10 @@ SegmentGrowingImpl::bulk_subscript_sparse_float_vector_impl(
         return;
     }
     {
-        std::lock_guard<std::shared_mutex> guard(chunk_mutex_);
-        // check again after lock to make sure: if index has finished building
-        // after the above check but before we grabbed the lock, we should grab
-        // from index as the data in chunk may have been removed in
-        // try_remove_chunks.
+        auto reader = chunk_read_gate_.Enter();
+        // check again once entered: if index has finished building after the
+        // above check, we should grab from index as the data in chunk may
+        // have been removed in try_remove_chunks.
         if (!indexing_record_.SyncDataWithIndex(field_id)) {
             // copy from raw data
             SparseRowsToProto(
@@ -1840,7 +1965,7 @@ SegmentGrowingImpl::bulk_subscript_sparse_float_vector_impl(
                 output);
             return;
         }
-        // else: release lock and copy from index
+        // else: leave and copy from index
     }
     indexing_record_.GetDataFromIndex(field_id, seg_offsets, count, 0, output);
 }
@@ -1905,11 +2030,10 @@ SegmentGrowingImpl::bulk_subscript_impl(milvus::OpContext* op_ctx,
         return;
     }
     {
-        std::lock_guard<std::shared_mutex> guard(chunk_mutex_);
-        // check again after lock to make sure: if index has finished building
-        // after the above check but before we grabbed the lock, we should grab
-        // from index as the data in chunk may have been removed in
-        // try_remove_chunks.
+        auto reader = chunk_read_gate_.Enter();
+        // check again once entered: if index has finished building after the
+        // above check, we should grab from index as the data in chunk may
+        // have been removed in try_remove_chunks.
         if (!indexing_record_.HasRawData(field_id)) {
             auto output_base = reinterpret_cast<char*>(output_raw);
             for (int i = 0; i < count; ++i) {
@@ -1920,7 +2044,7 @@ SegmentGrowingImpl::bulk_subscript_impl(milvus::OpContext* op_ctx,
             }
             return;
         }
-        // else: release lock and copy from index
+        // else: leave and copy from index
     }
     indexing_record_.GetDataFromIndex(
         field_id, seg_offsets, count, element_sizeof, output_raw);
@@ -2438,13 +2562,14 @@ SegmentGrowingImpl::BulkGetJsonData(
 void
 SegmentGrowingImpl::LazyCheckSchema(SchemaPtr sch, milvus::OpContext* op_ctx) {
     (void)op_ctx;
-    if (sch->get_schema_version() > schema_->get_schema_version()) {
+    auto current = std::atomic_load(&schema_);
+    if (sch->get_schema_version() > current->get_schema_version()) {
         LOG_INFO(
             "lazy check schema segment {} found newer schema version, "
             "current "
             "schema version {}, new schema version {}",
             id_,
-            schema_->get_schema_version(),
+            current->get_schema_version(),
             sch->get_schema_version());
         Reopen(sch);
     }
@@ -2452,22 +2577,42 @@ SegmentGrowingImpl::LazyCheckSchema(SchemaPtr sch, milvus::OpContext* op_ctx) {
 
 void
 SegmentGrowingImpl::Reopen(SchemaPtr sch) {
-    std::unique_lock lck(sch_mutex_);
+    // one reopen fills the added fields, the others wait for it and find
+    // the schema already published
+    std::lock_guard reopen_lck(reopen_mutex_);
+    auto current = std::atomic_load(&schema_);
 
     // double check condition, avoid multiple assignment
-    if (sch->get_schema_version() > schema_->get_schema_version()) {
-        auto absent_fields = sch->AbsentFields(*schema_);
+    if (sch->get_schema_version() > current->get_schema_version()) {
+        auto absent_fields = sch->AbsentFields(*current);
 
+        // The added fields are filled for the rows present now without
+        // sch_mutex_: inserts go on with the old schema, which does not
+        // write them, and readers of the old schema do not see them.
+        auto filled_rows = insert_record_.row_count();
         for (const auto& field_meta : *absent_fields) {
             if (sch->is_function_output(field_meta.get_id())) {
                 continue;
             }
-            fill_empty_field(field_meta);
+            fill_empty_field(field_meta, 0, filled_rows);
         }
 
-        schema_ = sch;
-
+        // only the rows inserted meanwhile are filled with inserts held off,
+        // then the new schema is published at once
+        std::unique_lock lck(sch_mutex_);
         auto row_count = insert_record_.row_count();
+        for (const auto& field_meta : *absent_fields) {
+            if (sch->is_function_output(field_meta.get_id())) {
+                continue;
+            }
+            fill_empty_field(field_meta, filled_rows, row_count);
+        }
+
+        // get_schema() hands out references, the schema they point to stays
+        // alive with the segment
+        retired_schemas_.push_back(current);
+        std::atomic_store(&schema_, sch);
+
         for (const auto& field_meta : *absent_fields) {
             if (sch->is_function_output(field_meta.get_id())) {
                 continue;
@@ -2753,27 +2898,41 @@ SegmentGrowingImpl::LoadColumnGroup(
 
 void
 SegmentGrowingImpl::fill_empty_field(const FieldMeta& field_meta) {
+    fill_empty_field(field_meta, 0, insert_record_.row_count());
+}
+
+void
+SegmentGrowingImpl::fill_empty_field(const FieldMeta& field_meta,
+                                     int64_t begin,
+                                     int64_t end) {
     auto field_id = field_meta.get_id();
-    LOG_INFO("start fill empty field {} (data type {}) for growing segment {}",
-             field_meta.get_data_type(),
-             field_id.get(),
-             id_);
+    LOG_INFO(
+        "start fill empty field {} (data type {}) rows [{}, {}) for growing "
+        "segment {}",
+        field_meta.get_data_type(),
+        field_id.get(),
+        begin,
+        end,
+        id_);
     // append meta only needed when schema is old
     // loading old segment with new schema will have meta appended
     if (!insert_record_.is_data_exist(field_id)) {
         insert_record_.append_field_meta(
             field_id, field_meta, size_per_chunk(), mmap_descriptor_);
     }
+    if (end <= begin) {
+        return;
+    }
 
-    auto total_row_num = insert_record_.row_count();
-
-    auto data = bulk_subscript_not_exist_field(field_meta, total_row_num);
+    auto num_rows = end - begin;
+    auto data = bulk_subscript_not_exist_field(field_meta, num_rows);
+    // the validity is appended, the rows before `begin` are filled already
     if (insert_record_.is_valid_data_exist(field_id)) {
         insert_record_.get_valid_data(field_id)->set_data_raw(
-            total_row_num, data.get(), field_meta);
+            num_rows, data.get(), field_meta);
     }
     insert_record_.get_data_base(field_id)->set_data_raw(
-        0, total_row_num, data.get(), field_meta);
+        begin, num_rows, data.get(), field_meta);
 
     LOG_INFO("fill empty field {} (data type {}) for growing segment {} done",
              field_meta.get_data_type(),
@@ -28,6 +28,7 @@
 #include <vector>
 
 #include "AckResponder.h"
+#include "ChunkReadGate.h"
 #include "ConcurrentVector.h"
 #include "DeletedRecord.h"
 #include "FieldIndexing.h"
@@ -72,6 +73,7 @@
 #include "pb/schema.pb.h"
 #include "pb/segcore.pb.h"
 #include "query/PlanImpl.h"
+#include "segcore/SearchIteratorRegistry.h"
 #include "segcore/SegcoreConfig.h"
 #include "segcore/SegmentInterface.h"
 #include "storage/MmapChunkManager.h"
@@ -208,9 +210,9 @@ class SegmentGrowingImpl : public SegmentGrowing {
         return insert_record_.timestamp_index_.get_max_timestamp();
     }
 
-    std::shared_mutex&
-    get_chunk_mutex() const {
-        return chunk_mutex_;
+    const ChunkReadGate&
+    get_chunk_read_gate() const {
+        return chunk_read_gate_;
     }
 
     const Schema&
@@ -228,7 +230,7 @@ class SegmentGrowingImpl : public SegmentGrowing {
     int64_t
     num_chunk_data(FieldId field_id) const final {
         auto size = get_insert_record().ack_responder_.GetAck();
-        return upper_div(size, segcore_config_.get_chunk_rows());
+        return upper_div(size, insert_record_.get_size_per_chunk(field_id));
     }
 
     // deprecated
@@ -240,6 +242,8 @@ class SegmentGrowingImpl : public SegmentGrowing {
                 .get());
     }
 
+    // rows per chunk of the scalar fields, dense vector fields may size
+    // their chunks by bytes, see SegcoreConfig::get_field_chunk_rows()
     int64_t
     size_per_chunk() const final {
         return segcore_config_.get_chunk_rows();
@@ -247,18 +251,18 @@ class SegmentGrowingImpl : public SegmentGrowing {
 
     int64_t
     chunk_size(FieldId field_id, int64_t chunk_id) const final {
-        return segcore_config_.get_chunk_rows();
+        return insert_record_.get_size_per_chunk(field_id);
     }
 
     std::pair<int64_t, int64_t>
     get_chunk_by_offset(FieldId field_id, int64_t offset) const override {
-        auto size_per_chunk = segcore_config_.get_chunk_rows();
+        auto size_per_chunk = insert_record_.get_size_per_chunk(field_id);
         return {offset / size_per_chunk, offset % size_per_chunk};
     }
 
     int64_t
     num_rows_until_chunk(FieldId field_id, int64_t chunk_id) const override {
-        return chunk_id * segcore_config_.get_chunk_rows();
+        return chunk_id * insert_record_.get_size_per_chunk(field_id);
     }
 
     void
@@ -456,6 +460,10 @@ class SegmentGrowingImpl : public SegmentGrowing {
         auto& cache_manager =
             milvus::exec::SimpleGeometryCacheManager::Instance();
         cache_manager.RemoveSegmentCaches(ctx_, get_segment_id());
+        // paused search iterators read the raw vectors of this segment
+        if (SearchIteratorRegistry::IsEnabled()) {
+            SearchIteratorRegistry::Instance().EraseSegment(get_segment_id());
+        }
 
         if (ctx_) {
             GEOS_finish_r(ctx_);
@@ -493,6 +501,22 @@ class SegmentGrowingImpl : public SegmentGrowing {
                   milvus::OpContext* op_context,
                   SearchResult& output) const override;
 
+    // Searches small growing segments of one collection with one plan, their
+    // raw vectors searched together by query::SearchOnGrowingSegments after
+    // the pre-filter ran on each. Plans the pipeline has to run, and the
+    // segments the fused search does not take, are searched one by one.
+    // Returns one result per segment, in order.
+    static std::vector<std::unique_ptr<SearchResult>>
+    SearchSegments(const std::vector<const SegmentGrowingImpl*>& segments,
+                   const query::Plan* plan,
+                   const query::PlaceholderGroup* placeholder_group,
+                   Timestamp timestamp,
+                   const folly::CancellationToken& cancel_token,
+                   int32_t consistency_level,
+                   Timestamp collection_ttl,
+                   int64_t entity_ttl_physical_time_us,
+                   bool enable_expr_cache);
+
     DataType
     GetFieldDataType(FieldId fieldId) const override;
 
@@ -747,6 +771,11 @@ class SegmentGrowingImpl : public SegmentGrowing {
     void
     fill_empty_field(const FieldMeta& field_meta);
 
+    // fills the rows [begin, end) of a field absent from them with its
+    // default or null values, appending the field first if it is new
+    void
+    fill_empty_field(const FieldMeta& field_meta, int64_t begin, int64_t end);
+
     void
     EnsureArrayOffsetsForStructField(const FieldMeta& field_meta,
                                      int64_t row_count);
@@ -836,13 +865,24 @@ class SegmentGrowingImpl : public SegmentGrowing {
  private:
     storage::MmapChunkDescriptorPtr mmap_descriptor_ = nullptr;
     SegcoreConfig segcore_config_;
+    // published by Reopen() with std::atomic_store
     SchemaPtr schema_;
+    // the schemas replaced by Reopen(), kept for the references get_schema()
+    // handed out before
+    std::vector<SchemaPtr> retired_schemas_;
+    // serializes Reopen(), which fills the added fields before taking
+    // sch_mutex_
+    std::mutex reopen_mutex_;
     IndexMetaPtr index_meta_;
 
     // inserted fields data and row_ids, timestamps
     InsertRecord<false> insert_record_;
 
-    mutable std::shared_mutex chunk_mutex_;
+    // readers of the raw vector chunks, which try_remove_chunks() drops once
+    // the interim index serves them; removals serialize on
+    // chunk_remove_mutex_
+    ChunkReadGate chunk_read_gate_;
+    std::mutex chunk_remove_mutex_;
 
     // small indexes for every chunk
     IndexingRecord indexing_record_;
@@ -12,6 +12,7 @@
 #include <folly/FBVector.h>
 #include <gtest/gtest.h>
 #include <algorithm>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <map>
@@ -19,6 +20,7 @@
 #include <optional>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -580,6 +582,65 @@ TEST(GrowingIndexNullableVectorTest,
     EXPECT_TRUE(found_exact_query_row);
 }
 
+TEST(GrowingIndexAsyncBuildTest, CatchesUpWithInsertsDuringBuild) {
+    constexpr int64_t dim = 4;
+    constexpr int64_t batch = 600;
+    constexpr int64_t num_batches = 4;
+
+    auto schema = std::make_shared<Schema>();
+    auto pk = schema->AddDebugField("pk", DataType::INT64);
+    auto vec = schema->AddDebugField(
+        "embeddings", DataType::VECTOR_FLOAT, dim, knowhere::metric::L2);
+    schema->set_primary_field_id(pk);
+
+    std::map<std::string, std::string> index_params = {
+        {"index_type", knowhere::IndexEnum::INDEX_FAISS_IVFFLAT},
+        {"metric_type", knowhere::metric::L2},
+        {"nlist", "16"}};
+    std::map<std::string, std::string> type_params = {
+        {"dim", std::to_string(dim)}};
+    FieldIndexMeta field_index_meta(
+        vec, std::move(index_params), std::move(type_params));
+
+    auto& config = SegcoreConfig::default_config();
+    ScopedSegcoreConfigRestore config_restore(config);
+    InterimIndexConfigForTest interim_config;
+    interim_config.chunk_rows = 1024;
+    interim_config.nlist = 16;
+    interim_config.dense_vector_interim_index_type =
+        knowhere::IndexEnum::INDEX_FAISS_IVFFLAT_CC;
+    ApplyInterimIndexConfigForTest(interim_config, config);
+    config.set_enable_async_interim_index_build(true);
+
+    std::map<FieldId, FieldIndexMeta> field_map = {{vec, field_index_meta}};
+    IndexMetaPtr meta =
+        std::make_shared<CollectionIndexMeta>(batch, std::move(field_map));
+    auto segment = CreateGrowingSegment(schema, meta, 1, config);
+    auto segment_impl = dynamic_cast<SegmentGrowingImpl*>(segment.get());
+    ASSERT_NE(segment_impl, nullptr);
+    const auto& indexing_record = segment_impl->get_indexing_record();
+    ASSERT_TRUE(indexing_record.is_in(vec));
+
+    // the second batch crosses the build threshold (nlist * 39 rows) and
+    // starts the build, the later ones may land while it is still running
+    for (int64_t i = 0; i < num_batches; ++i) {
+        auto dataset = DataGen(schema, batch, 42 + i, i * batch);
+        auto offset = segment->PreInsert(batch);
+        segment->Insert(offset,
+                        batch,
+                        dataset.row_ids_.data(),
+                        dataset.timestamps_.data(),
+                        dataset.raw_);
+    }
+
+    for (int i = 0; i < 3000 && !indexing_record.SyncDataWithIndex(vec); ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    ASSERT_TRUE(indexing_record.SyncDataWithIndex(vec));
+    auto index = indexing_record.get_field_indexing(vec).get_segment_indexing();
+    EXPECT_EQ(index.get()->Count(), batch * num_batches);
+}
+
 TEST_P(GrowingIndexTest, MissIndexMeta) {
     auto& config = SegcoreConfig::default_config();
     ScopedSegcoreConfigRestore config_restore(config);
@@ -55,6 +55,7 @@
 #include "query/Plan.h"
 #include "query/PlanNode.h"
 #include "segcore/ConcurrentVector.h"
+#include "segcore/IndexConfigGenerator.h"
 #include "segcore/InsertRecord.h"
 #include "segcore/SegcoreConfig.h"
 #include "segcore/SegmentGrowing.h"
@@ -210,6 +211,56 @@ TEST(Growing, MissingStructArrayOffsetsReturnsEmptyForOldRows) {
     }
 }
 
+TEST(Growing, ReopenFillsRowsInsertedMeanwhile) {
+    auto old_schema = std::make_shared<Schema>();
+    old_schema->set_schema_version(1);
+    auto pk = old_schema->AddDebugField("pk", DataType::INT64);
+    old_schema->set_primary_field_id(pk);
+    auto segment = CreateGrowingSegment(old_schema, empty_index_meta);
+    auto* segment_impl = dynamic_cast<SegmentGrowingImpl*>(segment.get());
+    ASSERT_NE(segment_impl, nullptr);
+
+    constexpr int64_t batch_rows = 1000;
+    constexpr int64_t num_batches = 20;
+    segment->PreInsert(batch_rows * num_batches);
+    auto insert_batch = [&](int64_t batch) {
+        auto dataset = DataGen(
+            old_schema, batch_rows, 42 + batch, batch * batch_rows);
+        segment->Insert(batch * batch_rows,
+                        batch_rows,
+                        dataset.row_ids_.data(),
+                        dataset.timestamps_.data(),
+                        dataset.raw_);
+    };
+    insert_batch(0);
+
+    auto new_schema = std::make_shared<Schema>();
+    new_schema->set_schema_version(2);
+    new_schema->AddField(
+        FieldName("pk"), pk, DataType::INT64, false, std::nullopt);
+    new_schema->set_primary_field_id(pk);
+    auto added = FieldId(pk.get() + 1);
+    new_schema->AddField(
+        FieldName("added"), added, DataType::INT64, true, std::nullopt);
+
+    // inserts with the old schema go on while the added field is filled
+    std::thread inserter([&]() {
+        for (int64_t batch = 1; batch < num_batches; ++batch) {
+            insert_batch(batch);
+        }
+    });
+    segment->Reopen(new_schema);
+    inserter.join();
+
+    EXPECT_EQ(segment->get_schema().get_schema_version(), 2);
+    auto& insert_record = segment_impl->get_insert_record();
+    auto valid = insert_record.get_valid_data(added)->get_data();
+    ASSERT_EQ(valid.size(), batch_rows * num_batches);
+    for (size_t i = 0; i < valid.size(); ++i) {
+        ASSERT_FALSE(valid[i]) << "i: " << i;
+    }
+}
+
 class GrowingTest
     : public ::testing::TestWithParam<
           std::tuple</*index type*/ std::string, knowhere::MetricType>> {
@@ -1658,6 +1709,29 @@ TEST(Growing, ResourceEstimationAfterInsert) {
     EXPECT_GE(resource.memory_bytes, expected_min_size);
 }
 
+TEST(Growing, InterimQuantizedIndexRowBytes) {
+    auto& config = SegcoreConfig::default_config();
+    auto origin_sub_dim = config.get_sub_dim();
+
+    // 128 dims in sub-vectors of 2: 64 4-bit codes, 32 bytes, plus the id
+    config.set_sub_dim(2);
+    config.set_refine_quant_type("NONE");
+    EXPECT_EQ(EstimateInterimQuantizedIndexRowBytes(config, 128), 32 + 8);
+    config.set_refine_quant_type("UINT8");
+    EXPECT_EQ(EstimateInterimQuantizedIndexRowBytes(config, 128),
+              32 + 8 + 128);
+    config.set_refine_quant_type("FLOAT16");
+    EXPECT_EQ(EstimateInterimQuantizedIndexRowBytes(config, 128),
+              32 + 8 + 256);
+    // an odd number of sub-vectors still takes a whole byte for the last
+    config.set_sub_dim(4);
+    config.set_refine_quant_type("NONE");
+    EXPECT_EQ(EstimateInterimQuantizedIndexRowBytes(config, 12), 2 + 8);
+
+    // NONE (refine from the data view) is the default
+    config.set_sub_dim(origin_sub_dim);
+}
+
 TEST(Growing, ResourceIncrementsWithMoreInserts) {
     auto schema = std::make_shared<Schema>();
     auto dim = 128;
@@ -1817,3 +1891,175 @@ TEST(Growing, MultipleFieldsResourceEstimation) {
                            N * sizeof(Timestamp);
     EXPECT_GE(resource.memory_bytes, min_expected);
 }
+
+TEST(Growing, SearchSegmentsMatchesSearchOnEach) {
+    constexpr int64_t dim = 16;
+    constexpr int64_t topk = 10;
+    constexpr int64_t num_queries = 4;
+    auto schema = std::make_shared<Schema>();
+    schema->AddDebugField(
+        "embeddings", DataType::VECTOR_FLOAT, dim, knowhere::metric::L2);
+    auto pk_fid = schema->AddDebugField("pk", DataType::INT64);
+    schema->set_primary_field_id(pk_fid);
+
+    // an empty segment in the middle leaves the numbering of the others
+    std::vector<SegmentGrowingPtr> owned;
+    std::vector<const SegmentGrowingImpl*> segments;
+    for (int64_t rows : {120, 0, 300, 45}) {
+        auto segment = CreateGrowingSegment(schema, empty_index_meta);
+        if (rows > 0) {
+            auto dataset = DataGen(schema, rows, 42 + owned.size());
+            segment->PreInsert(rows);
+            segment->Insert(0,
+                            rows,
+                            dataset.row_ids_.data(),
+                            dataset.timestamps_.data(),
+                            dataset.raw_);
+        }
+        segments.push_back(dynamic_cast<SegmentGrowingImpl*>(segment.get()));
+        owned.push_back(std::move(segment));
+    }
+
+    ScopedSchemaHandle schema_handle(*schema);
+    auto plan_str = schema_handle.ParseSearch(
+        "pk >= 30", "embeddings", topk, knowhere::metric::L2, "{}", -1);
+    auto plan =
+        CreateSearchPlanByExpr(schema, plan_str.data(), plan_str.size());
+    auto ph_group_raw = CreatePlaceholderGroup(num_queries, dim, 1024);
+    auto ph_group =
+        ParsePlaceholderGroup(plan.get(), ph_group_raw.SerializeAsString());
+
+    folly::CancellationToken cancel_token;
+    auto results = SegmentGrowingImpl::SearchSegments(segments,
+                                                      plan.get(),
+                                                      ph_group.get(),
+                                                      MAX_TIMESTAMP,
+                                                      cancel_token,
+                                                      0,
+                                                      0,
+                                                      0,
+                                                      false);
+    ASSERT_EQ(results.size(), segments.size());
+
+    // the hits of each query over all segments, best first
+    using Hit = std::tuple<float, size_t, int64_t>;
+    auto collect = [&](const std::vector<const SearchResult*>& per_segment) {
+        std::vector<std::vector<Hit>> hits(num_queries);
+        for (size_t i = 0; i < per_segment.size(); ++i) {
+            auto result = per_segment[i];
+            for (int64_t q = 0; q < num_queries; ++q) {
+                for (int64_t k = 0; k < result->unity_topK_; ++k) {
+                    auto pos = q * result->unity_topK_ + k;
+                    if (result->seg_offsets_[pos] != INVALID_SEG_OFFSET) {
+                        hits[q].emplace_back(result->distances_[pos],
+                                             i,
+                                             result->seg_offsets_[pos]);
+                    }
+                }
+            }
+        }
+        for (auto& query_hits : hits) {
+            std::sort(query_hits.begin(), query_hits.end());
+            if (query_hits.size() > static_cast<size_t>(topk)) {
+                query_hits.resize(topk);
+            }
+        }
+        return hits;
+    };
+
+    std::vector<std::unique_ptr<SearchResult>> expected_results;
+    std::vector<const SearchResult*> expected;
+    std::vector<const SearchResult*> fused;
+    for (size_t i = 0; i < segments.size(); ++i) {
+        ASSERT_EQ(results[i]->segment_, (void*)segments[i]);
+        expected_results.push_back(
+            segments[i]->Search(plan.get(), ph_group.get(), MAX_TIMESTAMP));
+        expected.push_back(expected_results.back().get());
+        fused.push_back(results[i].get());
+    }
+    auto expected_hits = collect(expected);
+    auto fused_hits = collect(fused);
+    for (int64_t q = 0; q < num_queries; ++q) {
+        ASSERT_EQ(fused_hits[q].size(), static_cast<size_t>(topk));
+        ASSERT_EQ(fused_hits[q].size(), expected_hits[q].size());
+        for (size_t k = 0; k < fused_hits[q].size(); ++k) {
+            auto [distance, segment, offset] = fused_hits[q][k];
+            auto [expected_distance, expected_segment, expected_offset] =
+                expected_hits[q][k];
+            EXPECT_NEAR(distance, expected_distance, 1e-4);
+            EXPECT_EQ(segment, expected_segment);
+            EXPECT_EQ(offset, expected_offset);
+            EXPECT_GE(offset, 30);
+        }
+    }
+}
+
+TEST(Growing, VectorChunksSizedByTargetBytes) {
+    constexpr int64_t dim = 16;
+    constexpr int64_t topk = 10;
+    constexpr int64_t num_queries = 4;
+    constexpr int64_t N = 2000;
+    auto& config = SegcoreConfig::default_config();
+    auto chunk_rows = config.get_chunk_rows();
+    auto chunk_target_bytes = config.get_chunk_target_bytes();
+    config.set_chunk_rows(1024);
+
+    auto schema = std::make_shared<Schema>();
+    auto vec_fid = schema->AddDebugField(
+        "embeddings", DataType::VECTOR_FLOAT, dim, knowhere::metric::L2);
+    auto pk_fid = schema->AddDebugField("pk", DataType::INT64);
+    schema->set_primary_field_id(pk_fid);
+    auto dataset = DataGen(schema, N);
+    auto create = [&](int64_t target_bytes) {
+        config.set_chunk_target_bytes(target_bytes);
+        auto segment = CreateGrowingSegment(schema, empty_index_meta);
+        segment->PreInsert(N);
+        segment->Insert(0,
+                        N,
+                        dataset.row_ids_.data(),
+                        dataset.timestamps_.data(),
+                        dataset.raw_);
+        return segment;
+    };
+    auto uniform = create(0);
+    // 256 rows of the vector field per chunk, the pk keeps 1024
+    auto sized = create(256 * dim * sizeof(float));
+    config.set_chunk_rows(chunk_rows);
+    config.set_chunk_target_bytes(chunk_target_bytes);
+
+    auto segment = dynamic_cast<SegmentGrowingImpl*>(sized.get());
+    EXPECT_EQ(segment->chunk_size(pk_fid, 0), 1024);
+    EXPECT_EQ(segment->num_chunk_data(pk_fid), 2);
+    EXPECT_EQ(segment->chunk_size(vec_fid, 0), 256);
+    EXPECT_EQ(segment->num_chunk_data(vec_fid), 8);
+    EXPECT_EQ(segment->num_rows_until_chunk(vec_fid, 3), 768);
+    auto [chunk_id, offset_in_chunk] =
+        segment->get_chunk_by_offset(vec_fid, 1000);
+    EXPECT_EQ(chunk_id, 3);
+    EXPECT_EQ(offset_in_chunk, 232);
+
+    auto raw = dataset.get_col<float>(vec_fid);
+    auto span =
+        segment->chunk_data<milvus::FloatVector>(nullptr, vec_fid, chunk_id);
+    for (int64_t i = 0; i < dim; ++i) {
+        ASSERT_EQ(span.get().data()[offset_in_chunk * dim + i],
+                  raw[1000 * dim + i]);
+    }
+
+    // searches walk the vector chunks and the filter on the pk chunks
+    ScopedSchemaHandle schema_handle(*schema);
+    auto plan_str = schema_handle.ParseSearch(
+        "pk >= 30", "embeddings", topk, knowhere::metric::L2, "{}", -1);
+    auto plan =
+        CreateSearchPlanByExpr(schema, plan_str.data(), plan_str.size());
+    auto ph_group_raw = CreatePlaceholderGroup(num_queries, dim, 1024);
+    auto ph_group =
+        ParsePlaceholderGroup(plan.get(), ph_group_raw.SerializeAsString());
+    auto expected = uniform->Search(plan.get(), ph_group.get(), MAX_TIMESTAMP);
+    auto result = sized->Search(plan.get(), ph_group.get(), MAX_TIMESTAMP);
+    ASSERT_EQ(result->seg_offsets_.size(), expected->seg_offsets_.size());
+    for (size_t i = 0; i < result->seg_offsets_.size(); ++i) {
+        EXPECT_EQ(result->seg_offsets_[i], expected->seg_offsets_[i]);
+        EXPECT_NEAR(result->distances_[i], expected->distances_[i], 1e-4);
+    }
+}
@@ -19,6 +19,7 @@
 #include <map>
 #include <ratio>
 #include <type_traits>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "ChunkedSegmentSealedImpl.h"
@@ -36,8 +37,10 @@
 #include "common/Utils.h"
 #include "expr/ITypeExpr.h"
 #include "fmt/core.h"
+#include "futures/Executor.h"
 #include "futures/Future.h"
 #include "monitor/Monitor.h"
+#include "monitor/scope_metric.h"
 #include "pb/schema.pb.h"
 #include "plan/PlanNode.h"
 #include "plan/PlanNodeIdGenerator.h"
@@ -46,6 +49,7 @@
 #include "query/PlanImpl.h"
 #include "query/PlanNode.h"
 #include "segcore/ConcurrentVector.h"
+#include "segcore/SearchResultCache.h"
 
 namespace milvus::segcore {
 
@@ -92,6 +96,8 @@ void
 SegmentInternalInterface::FillTargetEntry(const query::Plan* plan,
                                           SearchResult& results,
                                           milvus::OpContext* op_ctx) const {
+    SCOPE_SEGCORE_STAGE_METRIC(
+        milvus::monitor::internal_core_stage_duration_seconds_result_fill);
     std::shared_lock lck(mutex_);
     AssertInfo(plan, "empty plan");
     auto size = results.distances_.size();
@@ -149,6 +155,34 @@ SegmentInternalInterface::Search(
     milvus::tracer::AddEvent("obtained_segment_lock_mutex");
 
     check_search(plan);
+
+    // repeated searches on a sealed segment reuse the previous result as
+    // long as no new deletes arrived, ttl makes visibility time dependent.
+    // EXPLAIN ANALYZE always runs the pipeline to report real stats.
+    std::optional<SearchResultCache::Key> cache_key;
+    int64_t delete_version = 0;
+    if (SearchResultCache::IsEnabled() && !filter_only &&
+        !plan->plan_node_->plan_options_.explain_analyze &&
+        plan->plan_digest_.has_value() && placeholder_group != nullptr &&
+        placeholder_group->blob_digest_.has_value() && collection_ttl == 0 &&
+        entity_ttl_physical_time_us == 0 &&
+        !plan->plan_node_->search_info_.has_group_by() &&
+        !plan->plan_node_->search_info_.iterator_v2_info_.has_value() &&
+        is_search_result_cacheable(timestamp)) {
+        cache_key =
+            SearchResultCache::Key{get_segment_id(),
+                                   plan->plan_digest_.value(),
+                                   placeholder_group->blob_digest_.value()};
+        delete_version = get_delete_version();
+        auto results = std::make_unique<SearchResult>();
+        if (SearchResultCache::Instance().Get(
+                cache_key.value(), delete_version, *results)) {
+            milvus::tracer::AddEvent("search_result_cache_hit");
+            results->segment_ = (void*)this;
+            return results;
+        }
+    }
+
     query::ExecPlanNodeVisitor visitor(*this,
                                        timestamp,
                                        placeholder_group,
@@ -158,9 +192,78 @@ SegmentInternalInterface::Search(
                                        entity_ttl_physical_time_us);
     visitor.SetFilterOnly(filter_only);
     visitor.SetEnableExprCache(enable_expr_cache);
+    visitor.SetSearchExecutor(
+        futures::getNamedSearchCPUExecutor(plan->search_pool_));
     auto results = std::make_unique<SearchResult>();
     *results = visitor.get_moved_result(*plan->plan_node_);
     results->segment_ = (void*)this;
+    if (cache_key.has_value() && !cancel_token.isCancellationRequested()) {
+        SearchResultCache::Instance().Put(
+            cache_key.value(), delete_version, *results);
+    }
+    return results;
+}
+
+std::vector<std::unique_ptr<SearchResult>>
+SegmentInternalInterface::SearchWithSharedPrefilter(
+    const std::vector<const query::Plan*>& plans,
+    const std::vector<const query::PlaceholderGroup*>& placeholder_groups,
+    Timestamp timestamp,
+    const folly::CancellationToken& cancel_token,
+    int32_t consistency_level,
+    Timestamp collection_ttl,
+    int64_t entity_ttl_physical_time_us,
+    bool enable_expr_cache) const {
+    AssertInfo(plans.size() == placeholder_groups.size(),
+               "{} search plans for {} placeholder groups",
+               plans.size(),
+               placeholder_groups.size());
+    std::shared_lock lck(mutex_);
+    milvus::tracer::AddEvent("obtained_segment_lock_mutex");
+
+    // only a pre-filter used by several plans is evaluated on its own
+    std::vector<std::optional<std::string>> keys;
+    keys.reserve(plans.size());
+    std::unordered_map<std::string, int> uses;
+    for (auto plan : plans) {
+        check_search(plan);
+        auto key = query::ExecPlanNodeVisitor::SharedPrefilterKey(
+            *plan->plan_node_);
+        if (key.has_value()) {
+            uses[key.value()]++;
+        }
+        keys.push_back(std::move(key));
+    }
+
+    std::unordered_map<std::string,
+                       std::shared_ptr<const exec::SharedPrefilter>>
+        prefilters;
+    std::vector<std::unique_ptr<SearchResult>> results;
+    results.reserve(plans.size());
+    for (size_t i = 0; i < plans.size(); ++i) {
+        query::ExecPlanNodeVisitor visitor(*this,
+                                           timestamp,
+                                           placeholder_groups[i],
+                                           cancel_token,
+                                           consistency_level,
+                                           collection_ttl,
+                                           entity_ttl_physical_time_us);
+        visitor.SetEnableExprCache(enable_expr_cache);
+        visitor.SetSearchExecutor(
+            futures::getNamedSearchCPUExecutor(plans[i]->search_pool_));
+        if (keys[i].has_value() && uses[keys[i].value()] > 1) {
+            auto [it, inserted] = prefilters.try_emplace(keys[i].value());
+            if (inserted) {
+                milvus::tracer::AddEvent("eval_shared_prefilter");
+                it->second = visitor.EvalSharedPrefilter(*plans[i]->plan_node_);
+            }
+            visitor.SetSharedPrefilter(it->second);
+        }
+        auto result = std::make_unique<SearchResult>();
+        *result = visitor.get_moved_result(*plans[i]->plan_node_);
+        result->segment_ = (void*)this;
+        results.push_back(std::move(result));
+    }
     return results;
 }
 
@@ -216,10 +319,13 @@ SegmentInternalInterface::Retrieve(tracer::TraceContext* trace_ctx,
                                        consistency_level,
                                        collection_ttl,
                                        entity_ttl_physical_time_us);
+    visitor.SetSearchExecutor(
+        futures::getNamedSearchCPUExecutor(plan->search_pool_));
     auto retrieve_results = visitor.get_retrieve_result(*plan->plan_node_);
 
     retrieve_results.segment_ = (void*)this;
     results->set_has_more_result(retrieve_results.has_more_result);
+    results->set_explain_analyze(std::move(retrieve_results.explain_analyze_));
     results->set_scanned_remote_bytes(
         retrieve_results.retrieve_storage_cost_.scanned_remote_bytes);
     results->set_scanned_total_bytes(
@@ -243,6 +349,8 @@ SegmentInternalInterface::Retrieve(tracer::TraceContext* trace_ctx,
     // Element-level query support: serialize element_level flag and element_indices
     if (retrieve_results.element_level_) {
         results->set_element_level(true);
+        results->mutable_element_indices()->Reserve(
+            retrieve_results.element_indices_.size());
         // element_indices_ is vector<vector<int32_t>>, serialize each doc's indices
         for (const auto& indices : retrieve_results.element_indices_) {
             auto* elem_indices = results->add_element_indices();
@@ -276,7 +384,7 @@ SegmentInternalInterface::Retrieve(tracer::TraceContext* trace_ctx,
         //
         // Aggregation + ORDER BY does NOT set pipeline_field_ids_ and produces
         // final columns directly, falling through to FillTargetEntryDirectly.
-        FillOrderByResult(plan, results, retrieve_results);
+        FillOrderByResult(plan, results, retrieve_results, ignore_non_pk);
     } else {
         FillTargetEntryDirectly(trace_ctx, results, retrieve_results);
     }
@@ -287,6 +395,8 @@ SegmentInternalInterface::Retrieve(tracer::TraceContext* trace_ctx,
                                 .count();
     milvus::monitor::internal_core_retrieve_get_target_entry_latency.Observe(
         get_entry_cost / 1000);
+    milvus::monitor::internal_core_stage_duration_seconds_result_fill.Observe(
+        get_entry_cost / 1e6);
 
     milvus::futures::throwIfCancelled(cancel_token);
     return results;
@@ -298,6 +408,8 @@ SegmentInternalInterface::FillTargetEntryDirectly(
     const std::unique_ptr<proto::segcore::RetrieveResults>& results,
     RetrieveResult& retrieveResult) const {
     auto fields_data = results->mutable_fields_data();
+    fields_data->Reserve(fields_data->size() +
+                         retrieveResult.field_data_.size());
     for (auto& field_data : retrieveResult.field_data_) {
         auto* allocated_data = new DataArray(std::move(field_data));
         fields_data->AddAllocated(allocated_data);
@@ -305,11 +417,53 @@ SegmentInternalInterface::FillTargetEntryDirectly(
     retrieveResult.field_data_.clear();
 }
 
+namespace {
+
+// Pipeline columns that only carry output, i.e. come after the leading pk
+// and ORDER BY columns.
+bool
+IsOrderByOutputColumn(const query::RetrievePlanNode& plan_node, size_t i) {
+    auto leading = plan_node.order_by_column_count_;
+    return leading > 0 && static_cast<int64_t>(i) >= leading;
+}
+
+// Fetches one ORDER BY output field that the pipeline did not materialize.
+std::unique_ptr<DataArray>
+BulkSubscriptOrderByField(const SegmentInternalInterface& segment,
+                          milvus::OpContext* op_ctx,
+                          const query::RetrievePlan* plan,
+                          FieldId field_id,
+                          const int64_t* offsets,
+                          int64_t size) {
+    std::unique_ptr<DataArray> col;
+    auto dynamic_field_id = plan->schema_->get_dynamic_field_id();
+    auto& field_meta = plan->schema_->operator[](field_id);
+    if (dynamic_field_id.has_value() && dynamic_field_id.value() == field_id &&
+        !plan->target_dynamic_fields_.empty()) {
+        // Dynamic subfield projection.
+        col = segment.bulk_subscript(
+            op_ctx, field_id, offsets, size, plan->target_dynamic_fields_);
+    } else if (!segment.is_field_exist(field_id)) {
+        // Field absent in this segment (schema evolution).
+        col = segment.bulk_subscript_not_exist_field(field_meta, size);
+    } else {
+        col = segment.bulk_subscript(op_ctx, field_id, offsets, size);
+    }
+    if (field_meta.get_data_type() == DataType::ARRAY) {
+        col->mutable_scalars()->mutable_array_data()->set_element_type(
+            proto::schema::DataType(field_meta.get_element_type()));
+    }
+    return col;
+}
+
+}  // namespace
+
 void
 SegmentInternalInterface::FillOrderByResult(
     const query::RetrievePlan* plan,
     const std::unique_ptr<proto::segcore::RetrieveResults>& results,
-    RetrieveResult& retrieveResult) const {
+    RetrieveResult& retrieveResult,
+    bool ignore_non_pk) const {
     auto fields_data = results->mutable_fields_data();
     auto& deferred = plan->plan_node_->deferred_field_ids_;
 
@@ -350,6 +504,9 @@ SegmentInternalInterface::FillOrderByResult(
         if (i == segment_offset_col_idx || i == element_index_col_idx) {
             continue;
         }
+        if (ignore_non_pk && IsOrderByOutputColumn(*plan->plan_node_, i)) {
+            continue;
+        }
         auto* data = new DataArray(std::move(retrieveResult.field_data_[i]));
         data->set_field_id(pipeline_ids[i].get());
         fields_data->AddAllocated(data);
@@ -389,32 +546,15 @@ SegmentInternalInterface::FillOrderByResult(
     milvus::OpContext op_ctx;
 
     // Two-project mode: bulk-fetch deferred fields using segment offsets.
-    if (!deferred.empty()) {
-        auto dynamic_field_id = plan->schema_->get_dynamic_field_id();
+    // A two-phase retrieve fetches them later, only for the merged top-N.
+    if (!ignore_non_pk) {
         for (auto& field_id : deferred) {
-            std::unique_ptr<DataArray> col;
-            if (dynamic_field_id.has_value() &&
-                dynamic_field_id.value() == field_id &&
-                !plan->target_dynamic_fields_.empty()) {
-                // Dynamic subfield projection.
-                col = bulk_subscript(&op_ctx,
-                                     field_id,
-                                     offset_data.data(),
-                                     topk_count,
-                                     plan->target_dynamic_fields_);
-            } else if (!is_field_exist(field_id)) {
-                // Field absent in this segment (schema evolution).
-                auto& field_meta = plan->schema_->operator[](field_id);
-                col = bulk_subscript_not_exist_field(field_meta, topk_count);
-            } else {
-                col = bulk_subscript(
-                    &op_ctx, field_id, offset_data.data(), topk_count);
-            }
-            auto& field_meta = plan->schema_->operator[](field_id);
-            if (field_meta.get_data_type() == DataType::ARRAY) {
-                col->mutable_scalars()->mutable_array_data()->set_element_type(
-                    proto::schema::DataType(field_meta.get_element_type()));
-            }
+            auto col = BulkSubscriptOrderByField(*this,
+                                                 &op_ctx,
+                                                 plan,
+                                                 field_id,
+                                                 offset_data.data(),
+                                                 topk_count);
             fields_data->AddAllocated(col.release());
         }
     }
@@ -470,6 +610,7 @@ SegmentInternalInterface::FillOrderByResult(
             } else if (pk_type == DataType::VARCHAR) {
                 auto str_ids = ids->mutable_str_id();
                 auto& src = pk_data.scalars().string_data();
+                str_ids->mutable_data()->Reserve(src.data_size());
                 for (int i = 0; i < src.data_size(); ++i) {
                     *(str_ids->mutable_data()->Add()) = src.data(i);
                 }
@@ -478,6 +619,40 @@ SegmentInternalInterface::FillOrderByResult(
     }
 }
 
+void
+SegmentInternalInterface::FillOrderByOutputFields(
+    const query::RetrievePlan* plan,
+    const std::unique_ptr<proto::segcore::RetrieveResults>& results,
+    const int64_t* offsets,
+    int64_t size,
+    milvus::OpContext* op_ctx) const {
+    auto fields_data = results->mutable_fields_data();
+    const auto& plan_node = *plan->plan_node_;
+    const auto& pipeline_ids = plan_node.pipeline_field_ids_;
+    for (size_t i = 0; i < pipeline_ids.size(); i++) {
+        auto field_id = pipeline_ids[i];
+        if (field_id == SegmentOffsetFieldID ||
+            field_id == ElementIndexFieldID ||
+            !IsOrderByOutputColumn(plan_node, i)) {
+            continue;
+        }
+        auto col = BulkSubscriptOrderByField(
+            *this, op_ctx, plan, field_id, offsets, size);
+        fields_data->AddAllocated(col.release());
+    }
+    for (auto field_id : plan_node.deferred_field_ids_) {
+        auto col = BulkSubscriptOrderByField(
+            *this, op_ctx, plan, field_id, offsets, size);
+        fields_data->AddAllocated(col.release());
+    }
+    results->set_scanned_remote_bytes(
+        results->scanned_remote_bytes() +
+        op_ctx->storage_usage.scanned_cold_bytes.load());
+    results->set_scanned_total_bytes(
+        results->scanned_total_bytes() +
+        op_ctx->storage_usage.scanned_total_bytes.load());
+}
+
 void
 SegmentInternalInterface::FillTargetEntry(
     tracer::TraceContext* trace_ctx,
@@ -506,6 +681,7 @@ SegmentInternalInterface::FillTargetEntry(
     }
 
     auto fields_data = results->mutable_fields_data();
+    fields_data->Reserve(fields_data->size() + plan->field_ids_.size());
     auto ids = results->mutable_ids();
     auto pk_field_id = plan->schema_->get_primary_field_id();
 
@@ -583,6 +759,7 @@ SegmentInternalInterface::FillTargetEntry(
                 case DataType::VARCHAR: {
                     auto str_ids = ids->mutable_str_id();
                     auto& src_data = col_data->scalars().string_data();
+                    str_ids->mutable_data()->Reserve(src_data.data_size());
                     for (auto i = 0; i < src_data.data_size(); ++i) {
                         *(str_ids->mutable_data()->Add()) = src_data.data(i);
                     }
@@ -630,8 +807,15 @@ SegmentInternalInterface::Retrieve(
     // path so RetrieveByOffsets on external fields can short-circuit.
     milvus::OpContext fte_op_ctx;
     fte_op_ctx.cancellation_token = cancel_token;
-    FillTargetEntry(
-        trace_ctx, Plan, results, offsets, size, false, false, &fte_op_ctx);
+    if (Plan->plan_node_ && Plan->plan_node_->has_order_by_ &&
+        !Plan->plan_node_->pipeline_field_ids_.empty()) {
+        // second phase of a two-phase ORDER BY retrieve, the first one
+        // already returned the pk and ORDER BY columns
+        FillOrderByOutputFields(Plan, results, offsets, size, &fte_op_ctx);
+    } else {
+        FillTargetEntry(
+            trace_ctx, Plan, results, offsets, size, false, false, &fte_op_ctx);
+    }
     std::chrono::high_resolution_clock::time_point get_target_entry_end =
         std::chrono::high_resolution_clock::now();
     double get_entry_cost = std::chrono::duration<double, std::micro>(
@@ -639,6 +823,8 @@ SegmentInternalInterface::Retrieve(
                                 .count();
     milvus::monitor::internal_core_retrieve_get_target_entry_latency.Observe(
         get_entry_cost / 1000);
+    milvus::monitor::internal_core_stage_duration_seconds_result_fill.Observe(
+        get_entry_cost / 1e6);
     return results;
 }
 
@@ -19,6 +19,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <future>
 #include <memory>
 #include <optional>
 #include <shared_mutex>
@@ -353,6 +354,17 @@ class SegmentInternalInterface : public SegmentInterface {
         // do nothing
     }
 
+    // Starts loading `chunk_ids` of `field_id` in the background. The
+    // returned future, invalid if there is nothing to load, is ready once
+    // they are resident; it holds load errors, which the caller may ignore
+    // since a later pin loads the chunk again. op_ctx must outlive it.
+    virtual std::future<void>
+    prefetch_chunks_async(milvus::OpContext* op_ctx,
+                          FieldId field_id,
+                          const std::vector<int64_t>& chunk_ids) const {
+        return {};
+    }
+
     // Apply field nullability to an already-initialized valid_result bitmap.
     // Implementations only clear invalid rows and leave valid rows unchanged.
     virtual void
@@ -463,6 +475,34 @@ class SegmentInternalInterface : public SegmentInterface {
         }
     }
 
+    // The chunk of a string field if it is dictionary encoded, nullptr
+    // otherwise, for kernels that evaluate the dictionary instead of rows.
+    virtual PinWrapper<const StringChunk*>
+    dict_string_chunk(milvus::OpContext* op_ctx,
+                      FieldId field_id,
+                      int64_t chunk_id) const {
+        return PinWrapper<const StringChunk*>(nullptr);
+    }
+
+    // The chunk of an integer field if it is bit-packed, nullptr otherwise,
+    // for kernels that decode only the rows they read.
+    virtual PinWrapper<const FixedWidthChunk*>
+    packed_int_chunk(milvus::OpContext* op_ctx,
+                     FieldId field_id,
+                     int64_t chunk_id) const {
+        return PinWrapper<const FixedWidthChunk*>(nullptr);
+    }
+
+    // The chunk of a field if all its rows hold the value of the first row,
+    // as when the field is filled with its default value, nullptr otherwise,
+    // for kernels that evaluate the first row for the whole chunk.
+    virtual PinWrapper<const Chunk*>
+    constant_chunk(milvus::OpContext* op_ctx,
+                   FieldId field_id,
+                   int64_t chunk_id) const {
+        return PinWrapper<const Chunk*>(nullptr);
+    }
+
     // union(segment_id, field_id) as unique id
     virtual std::string
     GetUniqueFieldId(int64_t field_id) const {
@@ -484,6 +524,21 @@ class SegmentInternalInterface : public SegmentInterface {
            bool filter_only = false,
            bool enable_expr_cache = false) const override;
 
+    // Searches `plans` on the segment, the i-th one with the i-th
+    // placeholder group, as the sub-requests of a hybrid search do. The
+    // plans carrying the same filter evaluate it and the MVCC masks once
+    // and search against the shared bitset.
+    std::vector<std::unique_ptr<SearchResult>>
+    SearchWithSharedPrefilter(
+        const std::vector<const query::Plan*>& plans,
+        const std::vector<const query::PlaceholderGroup*>& placeholder_groups,
+        Timestamp timestamp,
+        const folly::CancellationToken& cancel_token,
+        int32_t consistency_level,
+        Timestamp collection_ttl,
+        int64_t entity_ttl_physical_time_us = 0,
+        bool enable_expr_cache = false) const;
+
     void
     FillPrimaryKeys(const query::Plan* plan,
                     SearchResult& results,
@@ -609,6 +664,16 @@ class SegmentInternalInterface : public SegmentInterface {
                      int64_t ins_barrier,
                      Timestamp timestamp) const = 0;
 
+    // mask_with_timestamps and mask_with_delete of the first `active_count`
+    // rows at once, shared by the queries at the same point of the segment;
+    // nullptr when the segment computes them per query
+    virtual std::shared_ptr<const TargetBitmap>
+    SharedMvccMask(int64_t active_count,
+                   Timestamp timestamp,
+                   Timestamp collection_ttl) const {
+        return nullptr;
+    }
+
     // count of chunk that has raw data
     virtual int64_t
     num_chunk_data(FieldId field_id) const = 0;
@@ -622,6 +687,31 @@ class SegmentInternalInterface : public SegmentInterface {
                          Timestamp timestamp,
                          Timestamp collection_ttl) const = 0;
 
+    // the rows not expired by entity ttl at `physical_us`, from an index of
+    // the ttl field; nullptr when the segment has none, the ttl field is
+    // evaluated as a filter then
+    virtual std::shared_ptr<const TargetBitmap>
+    EntityTTLAliveRows(milvus::OpContext* op_ctx, int64_t physical_us) const {
+        return nullptr;
+    }
+
+    // whether the loaded rows of a numeric field are non-decreasing in
+    // segment offset order, so a range filter on it is a binary search over
+    // its chunks rather than a scan
+    virtual bool
+    IsFieldSorted(milvus::OpContext* op_ctx, FieldId field_id) const {
+        return false;
+    }
+
+    // the offsets of the rows holding one of `pks` that are visible at
+    // `timestamp`, in the pk order find_first_n returns; nullopt when the
+    // segment cannot resolve pks to offsets without a bitset of its rows
+    virtual std::optional<std::vector<int64_t>>
+    VisiblePkOffsets(const std::vector<PkType>& pks,
+                     Timestamp timestamp) const {
+        return std::nullopt;
+    }
+
     // count of chunks
     virtual int64_t
     num_chunk(FieldId field_id) const = 0;
@@ -642,6 +732,20 @@ class SegmentInternalInterface : public SegmentInterface {
     virtual Timestamp
     get_max_timestamp() const = 0;
 
+    // whether a search at `timestamp` sees every insert and delete of the
+    // segment, so that its result only changes when new deletes arrive
+    virtual bool
+    is_search_result_cacheable(Timestamp timestamp) const {
+        return false;
+    }
+
+    // monotonic version of the applied deletes, must be read without
+    // taking the segment mutex
+    virtual int64_t
+    get_delete_version() const {
+        return 0;
+    }
+
     /**
      * search offset by possible pk values and mvcc timestamp
      *
@@ -695,12 +799,26 @@ class SegmentInternalInterface : public SegmentInterface {
         RetrieveResult& retrieveResult) const;
 
     // ORDER BY path: move sorted columns, late-materialize deferred fields,
-    // and populate PK-based IDs for proxy reduce.
+    // and populate PK-based IDs for proxy reduce. With ignore_non_pk only
+    // the leading pk and ORDER BY columns are returned, the output-only
+    // ones are left to FillOrderByOutputFields.
     void
     FillOrderByResult(
         const query::RetrievePlan* plan,
         const std::unique_ptr<proto::segcore::RetrieveResults>& results,
-        RetrieveResult& retrieveResult) const;
+        RetrieveResult& retrieveResult,
+        bool ignore_non_pk) const;
+
+    // Second phase of a two-phase ORDER BY retrieve: fetches the output-only
+    // columns, in pipeline order and then deferred order, for the offsets
+    // that survived the cross-segment merge.
+    void
+    FillOrderByOutputFields(
+        const query::RetrievePlan* plan,
+        const std::unique_ptr<proto::segcore::RetrieveResults>& results,
+        const int64_t* offsets,
+        int64_t size,
+        milvus::OpContext* op_ctx) const;
 
     void
     FillTargetEntry(
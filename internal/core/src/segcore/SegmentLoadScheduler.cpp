@@ -0,0 +1,175 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "segcore/SegmentLoadScheduler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <utility>
+
+#include "common/EasyAssert.h"
+#include "common/Numa.h"
+#include "fmt/format.h"
+#include "folly/ScopeGuard.h"
+#include "log/Log.h"
+#include "storage/ThreadPools.h"
+#include "storage/Util.h"
+
+namespace milvus::segcore {
+
+SegmentLoadScheduler::SegmentLoadScheduler(int64_t segment_id,
+                                           std::string stage,
+                                           uint64_t inflight_limit_bytes,
+                                           folly::CancellationToken
+                                               cancellation_token)
+    : segment_id_(segment_id),
+      stage_(std::move(stage)),
+      inflight_limit_bytes_(inflight_limit_bytes),
+      cancellation_token_(std::move(cancellation_token)) {
+}
+
+void
+SegmentLoadScheduler::Add(std::string name,
+                          uint64_t bytes,
+                          std::function<void()> task) {
+    tasks_.push_back(Task{std::move(name), bytes, std::move(task)});
+}
+
+void
+SegmentLoadScheduler::Run() {
+    timeline_.clear();
+    if (tasks_.empty()) {
+        return;
+    }
+    auto tasks = std::move(tasks_);
+    tasks_.clear();
+    std::stable_sort(
+        tasks.begin(), tasks.end(), [](const Task& a, const Task& b) {
+            return a.bytes > b.bytes;
+        });
+    timeline_.reserve(tasks.size());
+    for (auto& task : tasks) {
+        timeline_.push_back(TaskTiming{task.name, task.bytes, -1, -1});
+    }
+
+    auto home_node = NumaTopology::Get().HomeNode(segment_id_);
+    auto start = std::chrono::steady_clock::now();
+    auto elapsed_us = [start]() {
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+                   std::chrono::steady_clock::now() - start)
+            .count();
+    };
+
+    // Everything below is shared with the pool tasks by reference, which
+    // is safe as all of them finish before WaitAllFutures returns.
+    std::mutex mutex;
+    std::condition_variable cv;
+    uint64_t inflight_bytes = 0;
+    size_t running = 0;
+    bool failed = false;
+    // wakes the wait for room below
+    folly::CancellationCallback on_cancel(cancellation_token_, [&]() {
+        std::lock_guard<std::mutex> lock(mutex);
+        cv.notify_all();
+    });
+
+    auto& pool = ThreadPools::GetThreadPool(milvus::ThreadPoolPriority::MIDDLE);
+    std::vector<std::future<void>> futures;
+    futures.reserve(tasks.size());
+    for (size_t i = 0; i < tasks.size(); i++) {
+        auto bytes = tasks[i].bytes;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            cv.wait(lock, [&]() {
+                if (failed || cancellation_token_.isCancellationRequested()) {
+                    return true;
+                }
+                return running == 0 || inflight_limit_bytes_ == 0 ||
+                       inflight_bytes + bytes <= inflight_limit_bytes_;
+            });
+            if (failed || cancellation_token_.isCancellationRequested()) {
+                break;
+            }
+            inflight_bytes += bytes;
+            running++;
+        }
+        futures.push_back(pool.Submit([&, i, bytes, home_node]() {
+            auto finish = folly::makeGuard([&, i, bytes]() {
+                if (timeline_[i].start_us >= 0) {
+                    timeline_[i].end_us = elapsed_us();
+                }
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    inflight_bytes -= bytes;
+                    running--;
+                }
+                cv.notify_all();
+            });
+            if (cancellation_token_.isCancellationRequested()) {
+                return;
+            }
+            timeline_[i].start_us = elapsed_us();
+            // the pool threads are shared by all segments, so only what the
+            // task allocates is steered to the home node of the segment
+            ScopedPreferredNode preferred_node(home_node);
+            try {
+                tasks[i].run();
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(mutex);
+                failed = true;
+                throw;
+            }
+        }));
+    }
+    storage::WaitAllFutures(futures);
+
+    uint64_t total_bytes = 0;
+    std::string timeline;
+    for (auto& timing : timeline_) {
+        total_bytes += timing.bytes;
+        timeline += fmt::format(" {}[{}B]@{}+{}ms",
+                                timing.name,
+                                timing.bytes,
+                                timing.start_us / 1000,
+                                (timing.end_us - timing.start_us) / 1000);
+    }
+    LOG_INFO(
+        "Segment {} loaded {} in {}ms: {} tasks, {} bytes, inflight limit {} "
+        "bytes, timeline:{}",
+        segment_id_,
+        stage_,
+        elapsed_us() / 1000,
+        timeline_.size(),
+        total_bytes,
+        inflight_limit_bytes_,
+        timeline);
+
+    auto skipped = std::any_of(
+        timeline_.begin(), timeline_.end(), [](const TaskTiming& timing) {
+            return timing.start_us < 0;
+        });
+    if (skipped) {
+        ThrowInfo(ErrorCode::FollyCancel,
+                  "Loading {} of segment {} cancelled",
+                  stage_,
+                  segment_id_);
+    }
+}
+
+}  // namespace milvus::segcore
@@ -0,0 +1,98 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "folly/CancellationToken.h"
+
+namespace milvus::segcore {
+
+// Runs the independent load tasks of one stage of a segment load, e.g. all
+// its indexes, or all its column groups and field binlogs, on the MIDDLE
+// priority pool.
+//
+// Tasks are started largest first, so the longest ones do not end up
+// starting last and stretching the stage. While `inflight_limit_bytes` is
+// not 0, a task only starts once the estimated bytes of the running ones
+// leave room for it, though one task always runs. Run() records when each
+// task started and finished, and logs the timeline of the stage.
+//
+// Once `cancellation_token` is cancelled no more tasks are started, the ones
+// still queued on the pool are dropped without running, and Run() throws
+// FollyCancel after the running ones finish.
+//
+// Tasks prefer the memory of the segment's home NUMA node, if it has one.
+//
+// Not thread-safe: tasks are added and run from one thread.
+class SegmentLoadScheduler {
+ public:
+    struct TaskTiming {
+        std::string name;
+        uint64_t bytes;
+        // since the start of Run(), in microseconds
+        int64_t start_us;
+        int64_t end_us;
+    };
+
+    SegmentLoadScheduler(int64_t segment_id,
+                         std::string stage,
+                         uint64_t inflight_limit_bytes,
+                         folly::CancellationToken cancellation_token =
+                             folly::CancellationToken());
+
+    // `bytes` is the estimated size of what the task loads, 0 if unknown.
+    void
+    Add(std::string name, uint64_t bytes, std::function<void()> task);
+
+    size_t
+    size() const {
+        return tasks_.size();
+    }
+
+    // Runs every added task and waits for them. Once a task fails no more
+    // are started, and the first failure is rethrown after the running ones
+    // finish.
+    void
+    Run();
+
+    // The tasks of the last Run() in the order they were submitted; a task
+    // that never started has start_us and end_us of -1.
+    const std::vector<TaskTiming>&
+    timeline() const {
+        return timeline_;
+    }
+
+ private:
+    struct Task {
+        std::string name;
+        uint64_t bytes;
+        std::function<void()> run;
+    };
+
+    int64_t segment_id_;
+    std::string stage_;
+    uint64_t inflight_limit_bytes_;
+    folly::CancellationToken cancellation_token_;
+    std::vector<Task> tasks_;
+    std::vector<TaskTiming> timeline_;
+};
+
+}  // namespace milvus::segcore
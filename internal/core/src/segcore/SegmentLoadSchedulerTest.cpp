@@ -0,0 +1,123 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "common/EasyAssert.h"
+#include "folly/CancellationToken.h"
+#include "segcore/SegmentLoadScheduler.h"
+
+using namespace milvus::segcore;
+
+TEST(SegmentLoadScheduler, StartsLargestFirst) {
+    // a limit below every task runs them one at a time
+    SegmentLoadScheduler scheduler(1, "test", 1);
+    std::mutex mutex;
+    std::vector<std::string> order;
+    for (auto [name, bytes] : std::vector<std::pair<std::string, uint64_t>>{
+             {"small", 10}, {"unknown", 0}, {"large", 1000}, {"mid", 100}}) {
+        scheduler.Add(name, bytes, [&, name = name]() {
+            std::lock_guard<std::mutex> lock(mutex);
+            order.push_back(name);
+        });
+    }
+    EXPECT_EQ(scheduler.size(), 4);
+    scheduler.Run();
+    EXPECT_EQ(scheduler.size(), 0);
+
+    std::vector<std::string> expected{"large", "mid", "small", "unknown"};
+    EXPECT_EQ(order, expected);
+    auto& timeline = scheduler.timeline();
+    ASSERT_EQ(timeline.size(), 4);
+    for (size_t i = 0; i < timeline.size(); i++) {
+        EXPECT_EQ(timeline[i].name, expected[i]);
+        EXPECT_GE(timeline[i].start_us, 0);
+        EXPECT_GE(timeline[i].end_us, timeline[i].start_us);
+        if (i > 0) {
+            EXPECT_GE(timeline[i].start_us, timeline[i - 1].end_us);
+        }
+    }
+}
+
+TEST(SegmentLoadScheduler, KeepsInflightBytesWithinLimit) {
+    SegmentLoadScheduler scheduler(1, "test", 250);
+    std::atomic<uint64_t> inflight{0};
+    std::atomic<uint64_t> max_inflight{0};
+    for (int i = 0; i < 8; i++) {
+        scheduler.Add(std::to_string(i), 100, [&]() {
+            auto now = inflight.fetch_add(100) + 100;
+            auto seen = max_inflight.load();
+            while (now > seen &&
+                   !max_inflight.compare_exchange_weak(seen, now)) {
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            inflight.fetch_sub(100);
+        });
+    }
+    scheduler.Run();
+    EXPECT_LE(max_inflight.load(), 200);
+    EXPECT_GE(max_inflight.load(), 100);
+}
+
+TEST(SegmentLoadScheduler, StopsAfterFailure) {
+    SegmentLoadScheduler scheduler(1, "test", 1);
+    std::atomic<int> runs{0};
+    scheduler.Add("fails", 100, [&]() {
+        runs++;
+        throw std::runtime_error("load failed");
+    });
+    for (int i = 0; i < 4; i++) {
+        scheduler.Add(std::to_string(i), 10, [&]() { runs++; });
+    }
+    EXPECT_THROW(scheduler.Run(), std::runtime_error);
+    EXPECT_EQ(runs.load(), 1);
+    EXPECT_EQ(scheduler.timeline().back().start_us, -1);
+}
+
+TEST(SegmentLoadScheduler, StopsStartingTasksOnCancellation) {
+    folly::CancellationSource source;
+    SegmentLoadScheduler scheduler(1, "test", 1, source.getToken());
+    std::atomic<int> runs{0};
+    scheduler.Add("cancels", 100, [&]() {
+        runs++;
+        source.requestCancellation();
+    });
+    for (int i = 0; i < 4; i++) {
+        scheduler.Add(std::to_string(i), 10, [&]() { runs++; });
+    }
+    try {
+        scheduler.Run();
+        FAIL() << "expected cancellation";
+    } catch (const milvus::SegcoreError& e) {
+        EXPECT_EQ(e.get_error_code(), milvus::ErrorCode::FollyCancel);
+    }
+    EXPECT_EQ(runs.load(), 1);
+    auto& timeline = scheduler.timeline();
+    EXPECT_GE(timeline.front().end_us, 0);
+    for (size_t i = 1; i < timeline.size(); i++) {
+        EXPECT_EQ(timeline[i].start_us, -1);
+        EXPECT_EQ(timeline[i].end_us, -1);
+    }
+}
@@ -22,6 +22,7 @@
 #include "index/Index.h"
 #include "index/JsonScalarIndexWrapper.h"
 #include "index/JsonFlatIndex.h"
+#include "mmap/ChunkedColumnInterface.h"
 #include "pb/index_cgo_msg.pb.h"
 #include "pb/segcore.pb.h"
 #include "segcore/InsertRecord.h"
@@ -185,6 +186,15 @@ class SegmentSealed : public SegmentInternalInterface {
     virtual void
     RemoveJsonStats(FieldId field_id) = 0;
 
+    // Spans of the chunks holding the ascending `offsets` of a fixed width
+    // field, every chunk is pinned once, see
+    // ChunkedColumnInterface::SpansByOffsets().
+    virtual PinWrapper<ChunkSpans>
+    chunk_spans(milvus::OpContext* op_ctx,
+                FieldId field_id,
+                const int64_t* offsets,
+                int64_t count) const = 0;
+
     SegmentType
     type() const override {
         return SegmentType::Sealed;
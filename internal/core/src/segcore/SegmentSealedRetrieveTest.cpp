@@ -582,3 +582,72 @@ TEST_P(RetrieveTest, Delete) {
         }
     }
 }
+
+TEST_P(RetrieveTest, PointLookupByPk) {
+    auto schema = std::make_shared<Schema>();
+    auto fid_64 = schema->AddDebugField("i64", DataType::INT64);
+    auto DIM = 16;
+    schema->AddDebugField("vector_64", data_type, DIM, metric_type);
+    schema->set_primary_field_id(fid_64);
+
+    int64_t N = 100;
+    auto dataset = DataGen(schema, N, 42, 0, 2);
+    auto segment = CreateSealedWithFieldDataLoaded(schema, dataset);
+    auto i64_col = dataset.get_col<int64_t>(fid_64);
+
+    // pks present twice, a duplicated request and a pk that does not exist
+    std::vector<PkType> pks{i64_col[40], i64_col[2], i64_col[2], int64_t(-1)};
+    std::vector<int64_t> deleted{i64_col[2]};
+    auto ids = std::make_unique<IdArray>();
+    ids->mutable_int_id()->mutable_data()->Add(deleted.begin(), deleted.end());
+    std::vector<Timestamp> delete_ts{Timestamp(N + 10)};
+    segment->Delete(1, ids.get(), delete_ts.data());
+
+    auto expected = [&](Timestamp ts) {
+        std::vector<std::pair<int64_t, int64_t>> hits;
+        for (int64_t i = 0; i < N; ++i) {
+            auto pk = i64_col[i];
+            bool requested = std::find(pks.begin(), pks.end(), PkType(pk)) !=
+                             pks.end();
+            bool removed = pk == deleted[0] && ts >= delete_ts[0];
+            if (requested && !removed && dataset.timestamps_[i] <= ts) {
+                hits.emplace_back(pk, i);
+            }
+        }
+        std::sort(hits.begin(), hits.end());
+        std::vector<int64_t> offsets;
+        for (auto& [pk, offset] : hits) {
+            offsets.push_back(offset);
+        }
+        return offsets;
+    };
+
+    for (Timestamp ts : {Timestamp(3), Timestamp(N), Timestamp(N + 20)}) {
+        auto offsets = segment->VisiblePkOffsets(pks, ts);
+        ASSERT_TRUE(offsets.has_value());
+        ASSERT_EQ(offsets.value(), expected(ts));
+
+        std::vector<proto::plan::GenericValue> values;
+        for (auto& pk : pks) {
+            proto::plan::GenericValue val;
+            val.set_int64_val(std::get<int64_t>(pk));
+            values.push_back(val);
+        }
+        auto term_expr = std::make_shared<milvus::expr::TermFilterExpr>(
+            milvus::expr::ColumnInfo(
+                fid_64, DataType::INT64, std::vector<std::string>()),
+            values);
+        auto plan = std::make_unique<query::RetrievePlan>(schema);
+        plan->plan_node_ = std::make_unique<query::RetrievePlanNode>();
+        plan->plan_node_->plannodes_ =
+            milvus::test::CreateRetrievePlanByExpr(term_expr);
+        plan->field_ids_ = {fid_64};
+        auto retrieve_results =
+            RetrieveUsingDefaultOutputSize(segment.get(), plan.get(), ts);
+        auto& pk_data = retrieve_results->fields_data(0).scalars().long_data();
+        ASSERT_EQ(pk_data.data_size(), offsets->size());
+        for (int i = 0; i < pk_data.data_size(); ++i) {
+            ASSERT_EQ(pk_data.data(i), i64_col[offsets->at(i)]);
+        }
+    }
+}
@@ -0,0 +1,291 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <folly/ConcurrentSkipList.h>
+
+#include "common/Types.h"
+
+namespace milvus::segcore {
+
+using Offset = int32_t;
+
+struct Comparator {
+    bool
+    operator()(const std::pair<Timestamp, Offset>& left,
+               const std::pair<Timestamp, Offset>& right) const {
+        if (left.first == right.first) {
+            return left.second < right.second;
+        }
+        return left.first < right.first;
+    }
+};
+
+// delete records sorted by (timestamp, offset) for multi-thread insert &&
+// read. Deletes mostly arrive in timestamp order, they are appended to
+// chunks without a node allocation per entry, only the few sorting before
+// the last appended one go to a lock-free skip list. Readers merge both.
+class SortedDeleteList {
+ public:
+    using value_type = std::pair<Timestamp, Offset>;
+
+ private:
+    using OutOfOrderList = folly::ConcurrentSkipList<value_type, Comparator>;
+
+    // chunks grow from a small first one, most segments see few deletes
+    static constexpr size_t kFirstChunkCapacity = 64;
+    static constexpr size_t kMaxChunkCapacity = 4096;
+
+    struct Chunk {
+        Chunk(size_t base, size_t capacity)
+            : base(base),
+              capacity(capacity),
+              entries(std::make_unique<value_type[]>(capacity)) {
+        }
+
+        // position of the first entry in the whole append buffer
+        size_t base;
+        size_t capacity;
+        std::unique_ptr<value_type[]> entries;
+        std::atomic<Chunk*> next{nullptr};
+    };
+
+ public:
+    class Accessor;
+
+    class iterator {
+     public:
+        iterator() = default;
+
+        const value_type&
+        operator*() const {
+            return *Current();
+        }
+
+        const value_type*
+        operator->() const {
+            return Current();
+        }
+
+        iterator&
+        operator++() {
+            if (FromChunk()) {
+                ++pos_;
+                if (pos_ < end_ && pos_ == chunk_->base + chunk_->capacity) {
+                    chunk_ = chunk_->next.load(std::memory_order_acquire);
+                }
+            } else {
+                ++out_of_order_;
+            }
+            return *this;
+        }
+
+        iterator
+        operator++(int) {
+            auto prev = *this;
+            ++*this;
+            return prev;
+        }
+
+        bool
+        good() const {
+            return pos_ < end_ || out_of_order_.good();
+        }
+
+        bool
+        operator==(const iterator& other) const {
+            return pos_ == other.pos_ && out_of_order_ == other.out_of_order_;
+        }
+
+        bool
+        operator!=(const iterator& other) const {
+            return !(*this == other);
+        }
+
+     private:
+        friend class Accessor;
+
+        iterator(const Chunk* chunk,
+                 size_t pos,
+                 size_t end,
+                 OutOfOrderList::iterator out_of_order)
+            : chunk_(chunk),
+              pos_(pos),
+              end_(end),
+              out_of_order_(out_of_order) {
+        }
+
+        bool
+        FromChunk() const {
+            return pos_ < end_ &&
+                   (!out_of_order_.good() ||
+                    !Comparator()(*out_of_order_,
+                                  chunk_->entries[pos_ - chunk_->base]));
+        }
+
+        const value_type*
+        Current() const {
+            return FromChunk() ? &chunk_->entries[pos_ - chunk_->base]
+                               : &*out_of_order_;
+        }
+
+        const Chunk* chunk_{nullptr};
+        size_t pos_{0};
+        size_t end_{0};
+        OutOfOrderList::iterator out_of_order_;
+    };
+
+    // sees the entries appended before it is created, and the out of order
+    // ones as they are inserted, like the skip list accessor did
+    class Accessor {
+     public:
+        explicit Accessor(const std::shared_ptr<SortedDeleteList>& list)
+            : list_(list),
+              out_of_order_(list->out_of_order_),
+              end_(list->appended_.load(std::memory_order_acquire)),
+              head_(end_ > 0 ? list->head_.load(std::memory_order_acquire)
+                             : nullptr) {
+        }
+
+        size_t
+        size() const {
+            return end_ + out_of_order_.size();
+        }
+
+        iterator
+        begin() {
+            return iterator(head_, 0, end_, out_of_order_.begin());
+        }
+
+        iterator
+        end() {
+            return iterator(nullptr, end_, end_, out_of_order_.end());
+        }
+
+        // first entry not less than key
+        iterator
+        lower_bound(const value_type& key) {
+            const Chunk* chunk = head_;
+            size_t pos = end_;
+            while (chunk != nullptr) {
+                auto count = std::min(chunk->capacity, end_ - chunk->base);
+                const value_type* first = chunk->entries.get();
+                if (!Comparator()(first[count - 1], key)) {
+                    pos = chunk->base +
+                          (std::lower_bound(
+                               first, first + count, key, Comparator()) -
+                           first);
+                    break;
+                }
+                if (chunk->base + count == end_) {
+                    break;
+                }
+                chunk = chunk->next.load(std::memory_order_acquire);
+            }
+            return iterator(pos < end_ ? chunk : nullptr,
+                            pos,
+                            end_,
+                            out_of_order_.lower_bound(key));
+        }
+
+     private:
+        std::shared_ptr<SortedDeleteList> list_;
+        OutOfOrderList::Accessor out_of_order_;
+        size_t end_;
+        const Chunk* head_;
+    };
+
+    SortedDeleteList() : out_of_order_(OutOfOrderList::createInstance()) {
+    }
+
+    ~SortedDeleteList() {
+        auto chunk = head_.load(std::memory_order_relaxed);
+        while (chunk != nullptr) {
+            auto next = chunk->next.load(std::memory_order_relaxed);
+            delete chunk;
+            chunk = next;
+        }
+    }
+
+    SortedDeleteList(const SortedDeleteList&) = delete;
+
+    SortedDeleteList&
+    operator=(const SortedDeleteList&) = delete;
+
+    // the entries not less than the last appended one are appended and
+    // published at once, the rest are inserted into the skip list
+    void
+    Insert(std::vector<value_type>&& entries) {
+        if (entries.empty()) {
+            return;
+        }
+        if (!std::is_sorted(entries.begin(), entries.end(), Comparator())) {
+            std::sort(entries.begin(), entries.end(), Comparator());
+        }
+
+        std::lock_guard<std::mutex> lock(write_mutex_);
+        auto count = appended_.load(std::memory_order_relaxed);
+        auto first = entries.begin();
+        if (count > 0) {
+            const auto& last = tail_->entries[count - 1 - tail_->base];
+            first = std::lower_bound(
+                entries.begin(), entries.end(), last, Comparator());
+            if (first != entries.begin()) {
+                OutOfOrderList::Accessor accessor(out_of_order_);
+                for (auto it = entries.begin(); it != first; ++it) {
+                    accessor.insert(*it);
+                }
+            }
+        }
+
+        for (auto it = first; it != entries.end(); ++it) {
+            if (tail_ == nullptr) {
+                tail_ = new Chunk(0, kFirstChunkCapacity);
+                head_.store(tail_, std::memory_order_release);
+            } else if (count == tail_->base + tail_->capacity) {
+                auto chunk = new Chunk(
+                    count, std::min(tail_->capacity * 2, kMaxChunkCapacity));
+                tail_->next.store(chunk, std::memory_order_release);
+                tail_ = chunk;
+            }
+            tail_->entries[count - tail_->base] = *it;
+            ++count;
+        }
+        appended_.store(count, std::memory_order_release);
+    }
+
+ private:
+    std::mutex write_mutex_;
+    std::atomic<Chunk*> head_{nullptr};
+    // only touched by the writer holding write_mutex_
+    Chunk* tail_{nullptr};
+    // published count of appended entries
+    std::atomic<size_t> appended_{0};
+    std::shared_ptr<OutOfOrderList> out_of_order_;
+};
+
+}  // namespace milvus::segcore
@@ -0,0 +1,111 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "segcore/SortedDeleteList.h"
+
+using namespace milvus;
+using namespace milvus::segcore;
+
+namespace {
+
+std::vector<SortedDeleteList::value_type>
+Collect(SortedDeleteList::Accessor& accessor) {
+    std::vector<SortedDeleteList::value_type> result;
+    for (auto it = accessor.begin(); it != accessor.end(); ++it) {
+        result.push_back(*it);
+    }
+    return result;
+}
+
+}  // namespace
+
+TEST(SortedDeleteList, AppendAcrossChunks) {
+    auto list = std::make_shared<SortedDeleteList>();
+    std::vector<SortedDeleteList::value_type> expected;
+    for (int batch = 0; batch < 20; ++batch) {
+        std::vector<SortedDeleteList::value_type> entries;
+        for (int i = 999; i >= 0; --i) {
+            entries.emplace_back(batch + 1, batch * 1000 + i);
+        }
+        expected.insert(expected.end(), entries.begin(), entries.end());
+        list->Insert(std::move(entries));
+    }
+    std::sort(expected.begin(), expected.end(), Comparator());
+
+    SortedDeleteList::Accessor accessor(list);
+    ASSERT_EQ(accessor.size(), expected.size());
+    ASSERT_EQ(Collect(accessor), expected);
+
+    for (auto pos : {0, 63, 64, 191, 192, 4095, 12345, 19999}) {
+        auto it = accessor.lower_bound(expected[pos]);
+        ASSERT_TRUE(it.good());
+        ASSERT_EQ(*it, expected[pos]);
+    }
+    ASSERT_TRUE(accessor.lower_bound({21, 0}) == accessor.end());
+    ASSERT_FALSE(accessor.lower_bound({21, 0}).good());
+}
+
+TEST(SortedDeleteList, MergeOutOfOrder) {
+    auto list = std::make_shared<SortedDeleteList>();
+    std::vector<SortedDeleteList::value_type> expected;
+    std::vector<SortedDeleteList::value_type> all;
+    for (int i = 0; i < 5000; ++i) {
+        all.emplace_back(i / 3 + 1, i);
+    }
+    std::mt19937 rng(42);
+    std::shuffle(all.begin(), all.end(), rng);
+    for (size_t begin = 0; begin < all.size(); begin += 100) {
+        std::vector<SortedDeleteList::value_type> entries(
+            all.begin() + begin, all.begin() + begin + 100);
+        list->Insert(std::move(entries));
+    }
+    expected = all;
+    std::sort(expected.begin(), expected.end(), Comparator());
+
+    SortedDeleteList::Accessor accessor(list);
+    ASSERT_EQ(accessor.size(), expected.size());
+    ASSERT_EQ(Collect(accessor), expected);
+
+    for (size_t pos = 0; pos < expected.size(); pos += 97) {
+        auto it = accessor.lower_bound(expected[pos]);
+        for (size_t i = pos; i < std::min(pos + 10, expected.size()); ++i) {
+            ASSERT_EQ(*it++, expected[i]);
+        }
+    }
+}
+
+TEST(SortedDeleteList, AccessorSeesPublishedEntries) {
+    auto list = std::make_shared<SortedDeleteList>();
+    list->Insert({{1, 0}, {2, 1}});
+    SortedDeleteList::Accessor before(list);
+    list->Insert({{3, 2}});
+
+    ASSERT_EQ(before.size(), 2);
+    ASSERT_EQ(Collect(before).back(), std::make_pair(Timestamp(2), Offset(1)));
+
+    SortedDeleteList::Accessor after(list);
+    ASSERT_EQ(after.size(), 3);
+    ASSERT_TRUE(after.lower_bound({2, 2}).good());
+    ASSERT_EQ(after.lower_bound({2, 2})->first, 3);
+}
@@ -0,0 +1,267 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "segcore/TextLobSpillover.h"
+
+#include <zdict.h>
+
+#include <algorithm>
+#include <numeric>
+
+namespace milvus::segcore {
+
+namespace {
+
+struct DCtxDeleter {
+    void
+    operator()(ZSTD_DCtx* ctx) const {
+        ZSTD_freeDCtx(ctx);
+    }
+};
+
+// reads decompress with a context of their thread
+ZSTD_DCtx*
+ThreadDCtx() {
+    thread_local std::unique_ptr<ZSTD_DCtx, DCtxDeleter> dctx(
+        ZSTD_createDCtx());
+    return dctx.get();
+}
+
+}  // namespace
+
+std::string
+TextLobSpillover::WriteAndEncode(const char* data, size_t size) {
+    std::lock_guard<std::mutex> lock(write_mutex_);
+
+    AssertInfo(size <= std::numeric_limits<uint32_t>::max(),
+               "TEXT value too large for LOB spillover: {} bytes (max 4GB)",
+               size);
+
+    std::string compressed;
+    TextLobRef ref;
+    ref.offset = current_offset_;
+    ref.flags = Compress(data, size, compressed);
+    if (ref.flags != TextLobRef::kUncompressed) {
+        data = compressed.data();
+        size = compressed.size();
+    }
+    ref.size = static_cast<uint32_t>(size);
+
+    size_t total_written = 0;
+    while (total_written < size) {
+        ssize_t n = ::pwrite(fd_,
+                             data + total_written,
+                             size - total_written,
+                             current_offset_ + total_written);
+        AssertInfo(n > 0,
+                   "Failed to pwrite to LOB spillover file: {} at offset {}",
+                   path_,
+                   current_offset_ + total_written);
+        total_written += n;
+    }
+
+    current_offset_ += size;
+    return ref.Encode();
+}
+
+uint32_t
+TextLobSpillover::Compress(const char* data, size_t size, std::string& stored) {
+    if (size < kMinCompressSize) {
+        return TextLobRef::kUncompressed;
+    }
+    if (sampling_) {
+        Sample(data, size);
+    }
+    if (cctx_ == nullptr) {
+        cctx_.reset(ZSTD_createCCtx());
+        AssertInfo(cctx_ != nullptr, "Failed to create zstd context");
+    }
+    stored.resize(ZSTD_compressBound(size));
+    size_t n;
+    if (cdict_ != nullptr) {
+        n = ZSTD_compress_usingCDict(cctx_.get(),
+                                     stored.data(),
+                                     stored.size(),
+                                     data,
+                                     size,
+                                     cdict_.get());
+    } else {
+        n = ZSTD_compressCCtx(cctx_.get(),
+                              stored.data(),
+                              stored.size(),
+                              data,
+                              size,
+                              kCompressionLevel);
+    }
+    // incompressible texts are kept as they are
+    if (ZSTD_isError(n) || n >= size) {
+        return TextLobRef::kUncompressed;
+    }
+    stored.resize(n);
+    return cdict_ != nullptr ? TextLobRef::kZstdDict : TextLobRef::kZstd;
+}
+
+void
+TextLobSpillover::Sample(const char* data, size_t size) {
+    samples_.append(data, size);
+    sample_sizes_.push_back(size);
+    if (samples_.size() < kDictSampleBytes) {
+        return;
+    }
+    sampling_ = false;
+    std::string dict(kDictCapacity, '\0');
+    auto n = ZDICT_trainFromBuffer(dict.data(),
+                                   dict.size(),
+                                   samples_.data(),
+                                   sample_sizes_.data(),
+                                   sample_sizes_.size());
+    std::string().swap(samples_);
+    std::vector<size_t>().swap(sample_sizes_);
+    // too few or too different samples, the texts are compressed alone
+    if (ZDICT_isError(n)) {
+        return;
+    }
+    std::unique_ptr<ZSTD_CDict, ZstdDeleter> cdict(
+        ZSTD_createCDict(dict.data(), n, kCompressionLevel));
+    std::unique_ptr<ZSTD_DDict, ZstdDeleter> ddict(
+        ZSTD_createDDict(dict.data(), n));
+    if (cdict == nullptr || ddict == nullptr) {
+        return;
+    }
+    cdict_ = std::move(cdict);
+    ddict_owner_ = std::move(ddict);
+    ddict_.store(ddict_owner_.get(), std::memory_order_release);
+}
+
+void
+TextLobSpillover::PRead(uint64_t offset, size_t size, char* dst) const {
+    size_t total_read = 0;
+    while (total_read < size) {
+        ssize_t n = ::pread(
+            fd_, dst + total_read, size - total_read, offset + total_read);
+        AssertInfo(n > 0,
+                   "Failed to pread from LOB spillover file: {} at "
+                   "offset {}, size {}, read so far {}",
+                   path_,
+                   offset + total_read,
+                   size - total_read,
+                   total_read);
+        total_read += n;
+    }
+}
+
+std::string
+TextLobSpillover::DecodeStored(const TextLobRef& ref,
+                               const char* stored) const {
+    if (ref.flags == TextLobRef::kUncompressed) {
+        return std::string(stored, ref.size);
+    }
+    AssertInfo(ref.flags == TextLobRef::kZstd ||
+                   ref.flags == TextLobRef::kZstdDict,
+               "Unknown TextLobRef flags {} in LOB spillover file: {}",
+               ref.flags,
+               path_);
+    auto size = ZSTD_getFrameContentSize(stored, ref.size);
+    AssertInfo(size != ZSTD_CONTENTSIZE_UNKNOWN &&
+                   size != ZSTD_CONTENTSIZE_ERROR,
+               "Invalid zstd frame at offset {} of LOB spillover file: {}",
+               ref.offset,
+               path_);
+    std::string text(size, '\0');
+    size_t n;
+    if (ref.flags == TextLobRef::kZstdDict) {
+        auto ddict = ddict_.load(std::memory_order_acquire);
+        AssertInfo(ddict != nullptr,
+                   "LOB spillover file {} has no dictionary",
+                   path_);
+        n = ZSTD_decompress_usingDDict(
+            ThreadDCtx(), text.data(), text.size(), stored, ref.size, ddict);
+    } else {
+        n = ZSTD_decompressDCtx(
+            ThreadDCtx(), text.data(), text.size(), stored, ref.size);
+    }
+    AssertInfo(!ZSTD_isError(n) && n == size,
+               "Failed to decompress text at offset {} of LOB spillover "
+               "file {}: {}",
+               ref.offset,
+               path_,
+               ZSTD_isError(n) ? ZSTD_getErrorName(n) : "size mismatch");
+    return text;
+}
+
+std::string
+TextLobSpillover::DecodeAndRead(std::string_view ref_str) {
+    TextLobRef ref = TextLobRef::Decode(ref_str);
+    if (ref.flags == TextLobRef::kUncompressed) {
+        std::string text(ref.size, '\0');
+        PRead(ref.offset, ref.size, text.data());
+        return text;
+    }
+    std::string stored(ref.size, '\0');
+    PRead(ref.offset, ref.size, stored.data());
+    return DecodeStored(ref, stored.data());
+}
+
+std::vector<std::string>
+TextLobSpillover::DecodeAndReadBatch(
+    const std::vector<std::string_view>& ref_strs) {
+    std::vector<TextLobRef> refs;
+    refs.reserve(ref_strs.size());
+    for (const auto& ref_str : ref_strs) {
+        refs.push_back(TextLobRef::Decode(ref_str));
+    }
+    std::vector<size_t> order(refs.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return refs[a].offset < refs[b].offset;
+    });
+
+    std::vector<std::string> results(refs.size());
+    std::string buffer;
+    size_t i = 0;
+    while (i < order.size()) {
+        // the refs read with the next pread are [i, j)
+        const auto begin = refs[order[i]].offset;
+        auto end = begin + refs[order[i]].size;
+        size_t j = i + 1;
+        while (j < order.size()) {
+            const auto& next = refs[order[j]];
+            const auto next_end =
+                std::max(end, next.offset + static_cast<uint64_t>(next.size));
+            if (next.offset > end + kCoalesceGap ||
+                next_end - begin > kMaxCoalescedRead) {
+                break;
+            }
+            end = next_end;
+            ++j;
+        }
+        if (j == i + 1 && refs[order[i]].flags == TextLobRef::kUncompressed) {
+            results[order[i]] = DecodeAndRead(ref_strs[order[i]]);
+            ++i;
+            continue;
+        }
+        buffer.resize(end - begin);
+        PRead(begin, buffer.size(), buffer.data());
+        for (; i < j; ++i) {
+            const auto& ref = refs[order[i]];
+            results[order[i]] =
+                DecodeStored(ref, buffer.data() + (ref.offset - begin));
+        }
+    }
+    return results;
+}
+
+}  // namespace milvus::segcore
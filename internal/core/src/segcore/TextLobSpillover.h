@@ -27,8 +27,10 @@
 #include <filesystem>
 
 #include <atomic>
+#include <memory>
 #include <fcntl.h>
 #include <unistd.h>
+#include <zstd.h>
 
 #include "common/EasyAssert.h"
 #include "common/FieldMeta.h"
@@ -42,16 +44,24 @@ namespace milvus::segcore {
  *
  * Layout:
  *   - offset (8 bytes): position in the LOB file
- *   - size (4 bytes): length of the text data
- *   - flags (4 bytes): reserved for future use (e.g., compression)
+ *   - size (4 bytes): length of the stored bytes
+ *   - flags (4 bytes): how the text is stored (kUncompressed, kZstd or
+ *     kZstdDict)
  */
 struct TextLobRef {
     uint64_t offset;  // Position in LOB file
-    uint32_t size;    // Length of text data
-    uint32_t flags;   // Reserved (0 = uncompressed)
+    uint32_t size;    // Length of stored data
+    uint32_t flags;   // 0 = uncompressed
 
     static constexpr size_t kEncodedSize = 16;
 
+    // the text bytes as they are
+    static constexpr uint32_t kUncompressed = 0;
+    // a zstd frame of the text
+    static constexpr uint32_t kZstd = 1;
+    // a zstd frame of the text compressed with the dictionary of the file
+    static constexpr uint32_t kZstdDict = 2;
+
     // Encode reference to binary string for storage in ConcurrentVector
     std::string
     Encode() const {
@@ -89,8 +99,17 @@ struct TextLobRef {
  *   - pread: lock-free (POSIX guarantees pread is thread-safe)
  *   - pwrite + pread concurrent: safe (both operate on kernel page cache)
  *
- * File format: simple binary append (raw text bytes concatenated)
+ * File format: simple binary append (stored text bytes concatenated)
  *   [text1_bytes][text2_bytes][text3_bytes]...
+ *
+ * Texts of at least kMinCompressSize bytes are stored as zstd frames when
+ * that makes them smaller. The first texts are kept as samples, and once
+ * kDictSampleBytes of them are seen a dictionary is trained from them; the
+ * texts written after it are compressed with it, which suits many small
+ * similar documents much better than compressing each alone. The
+ * dictionary lives as long as the file.
+ *
+ * Batch reads sort the refs by offset and read nearby ones with one pread.
  */
 class TextLobSpillover {
  public:
@@ -134,6 +153,16 @@ class TextLobSpillover {
     TextLobSpillover&
     operator=(TextLobSpillover&&) = delete;
 
+    // texts shorter than this are stored as they are
+    static constexpr size_t kMinCompressSize = 128;
+    // sampled bytes a dictionary is trained from
+    static constexpr size_t kDictSampleBytes = 1 << 20;
+    static constexpr size_t kDictCapacity = 32 << 10;
+    static constexpr int kCompressionLevel = 3;
+    // refs at most this far apart are read with one pread
+    static constexpr uint64_t kCoalesceGap = 16 << 10;
+    static constexpr uint64_t kMaxCoalescedRead = 4 << 20;
+
     /**
      * Write text and return encoded reference string.
      * The returned string can be stored in ConcurrentVector<std::string>.
@@ -145,35 +174,7 @@ class TextLobSpillover {
     }
 
     std::string
-    WriteAndEncode(const char* data, size_t size) {
-        std::lock_guard<std::mutex> lock(write_mutex_);
-
-        AssertInfo(size <= std::numeric_limits<uint32_t>::max(),
-                   "TEXT value too large for LOB spillover: {} bytes (max 4GB)",
-                   size);
-
-        TextLobRef ref;
-        ref.offset = current_offset_;
-        ref.size = static_cast<uint32_t>(size);
-        ref.flags = 0;
-
-        size_t total_written = 0;
-        while (total_written < size) {
-            ssize_t n = ::pwrite(fd_,
-                                 data + total_written,
-                                 size - total_written,
-                                 current_offset_ + total_written);
-            AssertInfo(
-                n > 0,
-                "Failed to pwrite to LOB spillover file: {} at offset {}",
-                path_,
-                current_offset_ + total_written);
-            total_written += n;
-        }
-
-        current_offset_ += size;
-        return ref.Encode();
-    }
+    WriteAndEncode(const char* data, size_t size);
 
     /**
      * Read text using encoded reference string.
@@ -181,24 +182,13 @@ class TextLobSpillover {
      * is immediately visible in the kernel page cache).
      */
     std::string
-    DecodeAndRead(std::string_view ref_str) {
-        TextLobRef ref = TextLobRef::Decode(ref_str);
-        return PRead(ref.offset, ref.size);
-    }
+    DecodeAndRead(std::string_view ref_str);
 
     /**
-     * Batch read: pread all refs. No flush needed.
+     * Batch read, nearby refs coalesced into one pread. No flush needed.
      */
     std::vector<std::string>
-    DecodeAndReadBatch(const std::vector<std::string_view>& ref_strs) {
-        std::vector<std::string> results;
-        results.reserve(ref_strs.size());
-        for (const auto& ref_str : ref_strs) {
-            TextLobRef ref = TextLobRef::Decode(ref_str);
-            results.push_back(PRead(ref.offset, ref.size));
-        }
-        return results;
-    }
+    DecodeAndReadBatch(const std::vector<std::string_view>& ref_strs);
 
     const std::string&
     GetPath() const {
@@ -225,26 +215,37 @@ class TextLobSpillover {
     }
 
  private:
-    std::string
-    PRead(uint64_t offset, uint32_t size) {
-        std::string result(size, '\0');
-        size_t total_read = 0;
-        while (total_read < size) {
-            ssize_t n = ::pread(fd_,
-                                result.data() + total_read,
-                                size - total_read,
-                                offset + total_read);
-            AssertInfo(n > 0,
-                       "Failed to pread from LOB spillover file: {} at "
-                       "offset {}, size {}, read so far {}",
-                       path_,
-                       offset + total_read,
-                       size - total_read,
-                       total_read);
-            total_read += n;
+    struct ZstdDeleter {
+        void
+        operator()(ZSTD_CCtx* ctx) const {
+            ZSTD_freeCCtx(ctx);
         }
-        return result;
-    }
+        void
+        operator()(ZSTD_CDict* dict) const {
+            ZSTD_freeCDict(dict);
+        }
+        void
+        operator()(ZSTD_DDict* dict) const {
+            ZSTD_freeDDict(dict);
+        }
+    };
+
+    // reads size bytes at offset into dst
+    void
+    PRead(uint64_t offset, size_t size, char* dst) const;
+
+    // the text of `ref` from its stored bytes
+    std::string
+    DecodeStored(const TextLobRef& ref, const char* stored) const;
+
+    // the stored bytes of a text and their flags, under write_mutex_
+    uint32_t
+    Compress(const char* data, size_t size, std::string& stored);
+
+    // keeps the text as a dictionary sample, trains the dictionary once
+    // enough are kept, under write_mutex_
+    void
+    Sample(const char* data, size_t size);
 
     static std::atomic<uint64_t>&
     InstanceCounter() {
@@ -273,6 +274,18 @@ class TextLobSpillover {
     int fd_;
     std::mutex write_mutex_;
     uint64_t current_offset_;
+
+    // guarded by write_mutex_
+    std::unique_ptr<ZSTD_CCtx, ZstdDeleter> cctx_;
+    std::unique_ptr<ZSTD_CDict, ZstdDeleter> cdict_;
+    std::string samples_;
+    std::vector<size_t> sample_sizes_;
+    bool sampling_{true};
+
+    // set once before the first text compressed with the dictionary is
+    // written, read lock-free
+    std::unique_ptr<ZSTD_DDict, ZstdDeleter> ddict_owner_;
+    std::atomic<const ZSTD_DDict*> ddict_{nullptr};
 };
 
 }  // namespace milvus::segcore
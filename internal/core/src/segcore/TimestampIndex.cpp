@@ -36,12 +36,16 @@ TimestampIndex::build_with(const Timestamp* timestamps, int64_t size) {
     prefix_sums.push_back(offset);
     std::vector<Timestamp> timestamp_barriers;
     timestamp_barriers.reserve(num_slice + 1);
+    std::vector<bool> sorted_slices;
+    sorted_slices.reserve(num_slice);
     Timestamp last_max_v = 0;
     for (int slice_id = 0; slice_id < num_slice; ++slice_id) {
         auto length = lengths_[slice_id];
         auto [min_v, max_v] = std::minmax_element(timestamps + offset,
                                                   timestamps + offset + length);
         Assert(last_max_v <= *min_v);
+        sorted_slices.push_back(
+            std::is_sorted(timestamps + offset, timestamps + offset + length));
         offset += length;
         prefix_sums.push_back(offset);
         timestamp_barriers.push_back(*min_v);
@@ -58,6 +62,7 @@ TimestampIndex::build_with(const Timestamp* timestamps, int64_t size) {
     this->min_timestamp_ = min_ts;
     this->max_timestamp_ = last_max_v;
     this->timestamp_barriers_ = std::move(timestamp_barriers);
+    this->sorted_slices_ = std::move(sorted_slices);
 }
 
 std::pair<int64_t, int64_t>
@@ -77,6 +82,21 @@ TimestampIndex::get_active_range(Timestamp query_timestamp) const {
     return {start_locs_[block_id], start_locs_[block_id + 1]};
 }
 
+bool
+TimestampIndex::is_active_range_sorted(Timestamp query_timestamp) const {
+    if (query_timestamp >= max_timestamp_ ||
+        query_timestamp < min_timestamp_) {
+        // empty range
+        return true;
+    }
+    auto iter = std::upper_bound(timestamp_barriers_.begin(),
+                                 timestamp_barriers_.end(),
+                                 query_timestamp);
+    int block_id = (iter - timestamp_barriers_.begin()) - 1;
+    Assert(0 <= block_id && block_id < sorted_slices_.size());
+    return sorted_slices_[block_id];
+}
+
 std::vector<int64_t>
 GenerateFakeSlices(const Timestamp* timestamps,
                    int64_t size,
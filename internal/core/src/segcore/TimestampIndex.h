@@ -32,11 +32,18 @@ class TimestampIndex {
     std::pair<int64_t, int64_t>
     get_active_range(Timestamp query_timestamp) const;
 
+    // Whether the timestamps of the range get_active_range returns are
+    // non-decreasing, so a binary search splits it into an OK prefix and a
+    // not OK suffix instead of checking every row.
+    bool
+    is_active_range_sorted(Timestamp query_timestamp) const;
+
     size_t
     memory_size() const {
         return sizeof(*this) + lengths_.size() * sizeof(int64_t) +
                start_locs_.size() * sizeof(int64_t) +
-               timestamp_barriers_.size() * sizeof(Timestamp);
+               timestamp_barriers_.size() * sizeof(Timestamp) +
+               sorted_slices_.size() / 8;
     }
 
     Timestamp
@@ -54,6 +61,8 @@ class TimestampIndex {
     Timestamp max_timestamp_;
     // numSlice + 1
     std::vector<Timestamp> timestamp_barriers_;
+    // numSlice, whether the timestamps of the slice are non-decreasing
+    std::vector<bool> sorted_slices_;
 };
 
 std::vector<int64_t>
@@ -10,6 +10,7 @@
 // or implied. See the License for the specific language governing permissions and limitations under the License
 
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <cstdint>
 #include <utility>
 #include <vector>
@@ -70,4 +71,34 @@ TEST(TimestampIndex, Naive) {
     range = index.get_active_range(query_ts);
     ASSERT_EQ(range.first, 8);
     ASSERT_EQ(range.second, 8);
+
+    ASSERT_TRUE(index.is_active_range_sorted(1));
+    ASSERT_FALSE(index.is_active_range_sorted(11));
+    ASSERT_FALSE(index.is_active_range_sorted(21));
+    // empty ranges
+    ASSERT_TRUE(index.is_active_range_sorted(0));
+    ASSERT_TRUE(index.is_active_range_sorted(22));
+}
+
+TEST(TimestampIndex, SortedSlices) {
+    // mostly monotonic, with one slice out of order
+    std::vector<Timestamp> timestamps;
+    for (Timestamp i = 0; i < 100; ++i) {
+        timestamps.push_back(i * 10);
+    }
+    std::swap(timestamps[51], timestamps[52]);
+    auto lengths = GenerateFakeSlices(timestamps.data(), timestamps.size(), 8);
+    TimestampIndex index;
+    index.set_length_meta(lengths);
+    index.build_with(timestamps.data(), timestamps.size());
+
+    for (Timestamp query_ts = 0; query_ts < 1000; query_ts += 5) {
+        auto [beg, end] = index.get_active_range(query_ts);
+        bool sorted = std::is_sorted(timestamps.begin() + beg,
+                                     timestamps.begin() + end);
+        ASSERT_EQ(index.is_active_range_sorted(query_ts), sorted);
+        if (query_ts >= 500 && query_ts < 530) {
+            ASSERT_FALSE(sorted);
+        }
+    }
 }
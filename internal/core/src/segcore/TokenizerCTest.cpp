@@ -86,3 +86,61 @@ TEST(CTokenizer, Default) {
 
     free_tokenizer(tokenizer);
 }
+
+TEST(CTokenizer, TokenizeBatch) {
+    auto analyzer_params = R"({"tokenizer": "standard"})";
+    CTokenizer tokenizer;
+    {
+        auto status = create_tokenizer(analyzer_params, "", &tokenizer);
+        ASSERT_EQ(milvus::ErrorCode::Success, status.error_code);
+    }
+
+    std::vector<std::string> texts{"football, basketball", "", "swimming"};
+    std::string data;
+    std::vector<uint32_t> text_offsets{0};
+    for (const auto& text : texts) {
+        data += text;
+        text_offsets.push_back(data.size());
+    }
+
+    CTokenBatch batch;
+    auto status = tokenize_batch(
+        tokenizer, data.data(), text_offsets.data(), texts.size(), &batch);
+    ASSERT_EQ(milvus::ErrorCode::Success, status.error_code);
+    ASSERT_EQ(batch.num_tokens, 3);
+    EXPECT_EQ(batch.token_counts[0], 2);
+    EXPECT_EQ(batch.token_counts[1], 0);
+    EXPECT_EQ(batch.token_counts[2], 1);
+    std::vector<std::string> refs{"football", "basketball", "swimming"};
+    for (uint32_t i = 0; i < batch.num_tokens; i++) {
+        EXPECT_EQ(refs[i],
+                  std::string(batch.data + batch.token_offsets[i],
+                              batch.token_offsets[i + 1] -
+                                  batch.token_offsets[i]));
+    }
+    free_token_batch(batch);
+    free_tokenizer(tokenizer);
+}
+
+TEST(CTokenizer, SharesPrototypes) {
+    auto analyzer_params = R"({"tokenizer": "standard"})";
+    CTokenizer first;
+    CTokenizer second;
+    ASSERT_EQ(milvus::ErrorCode::Success,
+              create_tokenizer(analyzer_params, "", &first).error_code);
+    ASSERT_EQ(milvus::ErrorCode::Success,
+              create_tokenizer(analyzer_params, "", &second).error_code);
+    // clones of one prototype, yet tokenizers of their own
+    ASSERT_NE(first, second);
+    free_tokenizer(first);
+
+    std::string text("football");
+    auto token_stream =
+        create_token_stream(second, text.c_str(), text.length());
+    ASSERT_TRUE(token_stream_advance(token_stream));
+    auto token = token_stream_get_token(token_stream);
+    ASSERT_EQ(text, std::string(token));
+    free_token(const_cast<char*>(token));
+    free_token_stream(token_stream);
+    free_tokenizer(second);
+}
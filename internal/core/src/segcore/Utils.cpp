@@ -15,6 +15,7 @@
 #include <cxxabi.h>
 #include <folly/ExceptionWrapper.h>
 #include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <cstdint>
 #include <exception>
@@ -37,6 +38,7 @@
 #include "common/FieldDataInterface.h"
 #include "common/FieldMeta.h"
 #include "common/JsonCastType.h"
+#include "common/Tracepoint.h"
 #include "common/TypeTraits.h"
 #include "common/Types.h"
 #include "common/Utils.h"
@@ -51,6 +53,7 @@
 #include "knowhere/sparse_utils.h"
 #include "log/Log.h"
 #include "milvus-storage/filesystem/fs.h"
+#include "monitor/Monitor.h"
 #include "nlohmann/json.hpp"
 #include "parquet/arrow/reader.h"
 #include "pb/schema.pb.h"
@@ -1469,6 +1472,56 @@ getCellDataType(bool is_vector, bool is_index) {
     }
 }
 
+void
+RecordCellLoad(CellLoadTranslator translator,
+               size_t num_cells,
+               int64_t num_bytes,
+               std::chrono::steady_clock::time_point start) {
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    MILVUS_TRACEPOINT(
+        cache_miss,
+        static_cast<int>(translator),
+        num_cells,
+        num_bytes,
+        std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    auto seconds = std::chrono::duration<double>(elapsed).count();
+    switch (translator) {
+        case CellLoadTranslator::CHUNK:
+            monitor::internal_core_cache_cell_load_total_chunk.Increment(
+                num_cells);
+            monitor::internal_core_cache_cell_load_bytes_chunk.Increment(
+                num_bytes);
+            monitor::internal_core_cache_cell_load_duration_seconds_chunk
+                .Observe(seconds);
+            break;
+        case CellLoadTranslator::GROUP_CHUNK:
+            monitor::internal_core_cache_cell_load_total_group_chunk.Increment(
+                num_cells);
+            monitor::internal_core_cache_cell_load_bytes_group_chunk.Increment(
+                num_bytes);
+            monitor::internal_core_cache_cell_load_duration_seconds_group_chunk
+                .Observe(seconds);
+            break;
+        case CellLoadTranslator::MANIFEST_GROUP:
+            monitor::internal_core_cache_cell_load_total_manifest_group
+                .Increment(num_cells);
+            monitor::internal_core_cache_cell_load_bytes_manifest_group
+                .Increment(num_bytes);
+            monitor::
+                internal_core_cache_cell_load_duration_seconds_manifest_group
+                    .Observe(seconds);
+            break;
+        case CellLoadTranslator::SEALED_INDEX:
+            monitor::internal_core_cache_cell_load_total_sealed_index
+                .Increment(num_cells);
+            monitor::internal_core_cache_cell_load_bytes_sealed_index
+                .Increment(num_bytes);
+            monitor::internal_core_cache_cell_load_duration_seconds_sealed_index
+                .Observe(seconds);
+            break;
+    }
+}
+
 void
 LoadIndexData(milvus::tracer::TraceContext& ctx,
               milvus::segcore::LoadIndexInfo* load_index_info,
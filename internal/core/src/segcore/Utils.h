@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <memory>
 #include <cstdlib>
 #include <string>
@@ -194,6 +195,23 @@ getCacheWarmupPolicy(const std::string& warmup_policy,
 milvus::cachinglayer::CellDataType
 getCellDataType(bool is_vector, bool is_index);
 
+// Translators whose cell loads are reported by RecordCellLoad.
+enum class CellLoadTranslator {
+    CHUNK,
+    GROUP_CHUNK,
+    MANIFEST_GROUP,
+    SEALED_INDEX,
+};
+
+// Reports one get_cells() call, i.e. the caching layer missed on
+// `num_cells` cells of `num_bytes` estimated bytes and loaded them since
+// `start`. Together the counters give each translator's reload cost.
+void
+RecordCellLoad(CellLoadTranslator translator,
+               size_t num_cells,
+               int64_t num_bytes,
+               std::chrono::steady_clock::time_point start);
+
 void
 LoadIndexData(milvus::tracer::TraceContext& ctx,
               milvus::segcore::LoadIndexInfo* load_index_info,
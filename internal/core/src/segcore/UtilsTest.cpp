@@ -13,6 +13,7 @@
 #include <folly/FBVector.h>
 #include <array>
 #include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
@@ -30,6 +31,7 @@
 #include "common/protobuf_utils.h"
 #include "gtest/gtest.h"
 #include "knowhere/comp/index_param.h"
+#include "monitor/Monitor.h"
 #include "pb/schema.pb.h"
 #include "query/Utils.h"
 #include "segcore/AckResponder.h"
@@ -595,3 +597,25 @@ TEST(UtilSegcore, CheckCancellationCancelAfterCheck) {
     EXPECT_THROW(CheckCancellation(&op_ctx, 123, "TestOperation"),
                  SegcoreError);
 }
+
+TEST(UtilSegcore, RecordCellLoad) {
+    using namespace milvus;
+    using namespace milvus::segcore;
+
+    auto& cells = monitor::internal_core_cache_cell_load_total_group_chunk;
+    auto& bytes = monitor::internal_core_cache_cell_load_bytes_group_chunk;
+    auto& index_cells =
+        monitor::internal_core_cache_cell_load_total_sealed_index;
+    auto cells_before = cells.Value();
+    auto bytes_before = bytes.Value();
+    auto index_cells_before = index_cells.Value();
+
+    RecordCellLoad(CellLoadTranslator::GROUP_CHUNK,
+                   3,
+                   4096,
+                   std::chrono::steady_clock::now());
+    EXPECT_EQ(cells.Value() - cells_before, 3);
+    EXPECT_EQ(bytes.Value() - bytes_before, 4096);
+    // other translators are counted separately
+    EXPECT_EQ(index_cells.Value(), index_cells_before);
+}
@@ -0,0 +1,251 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "segcore/WarmupProfile.h"
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <utility>
+
+#include "common/EasyAssert.h"
+#include "fmt/format.h"
+#include "log/Log.h"
+#include "storage/ThreadPools.h"
+
+namespace milvus::segcore {
+
+namespace {
+
+constexpr const char* kProfileFileSuffix = ".profile";
+constexpr const char* kTmpFileSuffix = ".tmp";
+constexpr int64_t kFlushIntervalSec = 10;
+
+std::shared_ptr<WarmupProfile> global_profile = nullptr;
+
+}  // namespace
+
+WarmupProfile::WarmupProfile(std::string root, int64_t window_sec)
+    : root_(std::move(root)), window_sec_(window_sec) {
+    std::error_code ec;
+    std::filesystem::create_directories(root_, ec);
+    AssertInfo(!ec,
+               "Failed to create warmup profile directory {}: {}",
+               root_,
+               ec.message());
+    Recover();
+}
+
+std::shared_ptr<WarmupProfile>
+WarmupProfile::Global() {
+    // read on every pinned field, so no lock
+    return std::atomic_load(&global_profile);
+}
+
+void
+WarmupProfile::InitGlobal(const std::string& root, int64_t window_sec) {
+    std::shared_ptr<WarmupProfile> profile = nullptr;
+    if (window_sec > 0) {
+        profile = std::make_shared<WarmupProfile>(root, window_sec);
+    }
+    std::atomic_store(&global_profile, std::move(profile));
+}
+
+int64_t
+WarmupProfile::NowSec() {
+    // wall clock, the profiles outlive the process
+    return std::chrono::duration_cast<std::chrono::seconds>(
+               std::chrono::system_clock::now().time_since_epoch())
+        .count();
+}
+
+std::string
+WarmupProfile::ProfilePath(int64_t collection_id) const {
+    return fmt::format("{}/{}{}", root_, collection_id, kProfileFileSuffix);
+}
+
+void
+WarmupProfile::RecordAccess(int64_t collection_id,
+                            FieldId field_id,
+                            Target target) {
+    auto now = NowSec();
+    bool submit_flush = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto& profile = profiles_[collection_id];
+        auto& entry = profile
+                          .try_emplace(
+                              Key{field_id.get(), static_cast<int>(target)},
+                              Entry{field_id, target, 0, now})
+                          .first->second;
+        entry.hits++;
+        entry.last_access_sec = now;
+        dirty_.insert(collection_id);
+        if (!flush_pending_ && now - last_flush_sec_ >= kFlushIntervalSec) {
+            flush_pending_ = true;
+            submit_flush = true;
+        }
+    }
+    if (!submit_flush) {
+        return;
+    }
+    auto self = weak_from_this();
+    if (self.expired()) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        flush_pending_ = false;
+        return;
+    }
+    auto& pool = ThreadPools::GetThreadPool(milvus::ThreadPoolPriority::LOW);
+    pool.Submit([self = std::move(self)]() {
+        if (auto profile = self.lock()) {
+            profile->Flush();
+        }
+    });
+}
+
+std::vector<WarmupProfile::Entry>
+WarmupProfile::GetHotTargets(int64_t collection_id) const {
+    std::vector<Entry> entries;
+    auto expire_before = NowSec() - window_sec_;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = profiles_.find(collection_id);
+        if (it == profiles_.end()) {
+            return entries;
+        }
+        for (auto& [key, entry] : it->second) {
+            if (entry.last_access_sec >= expire_before) {
+                entries.push_back(entry);
+            }
+        }
+    }
+    std::sort(
+        entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+            if (a.hits != b.hits) {
+                return a.hits > b.hits;
+            }
+            return a.last_access_sec > b.last_access_sec;
+        });
+    return entries;
+}
+
+void
+WarmupProfile::Flush() {
+    std::lock_guard<std::mutex> flush_lock(flush_mutex_);
+    std::vector<std::pair<int64_t, CollectionProfile>> changed;
+    auto now = NowSec();
+    auto expire_before = now - window_sec_;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto collection_id : dirty_) {
+            auto it = profiles_.find(collection_id);
+            if (it == profiles_.end()) {
+                continue;
+            }
+            auto& profile = it->second;
+            for (auto entry = profile.begin(); entry != profile.end();) {
+                if (entry->second.last_access_sec < expire_before) {
+                    entry = profile.erase(entry);
+                } else {
+                    ++entry;
+                }
+            }
+            changed.emplace_back(collection_id, profile);
+        }
+        dirty_.clear();
+        last_flush_sec_ = now;
+        flush_pending_ = false;
+    }
+    for (auto& [collection_id, profile] : changed) {
+        Write(collection_id, profile);
+    }
+}
+
+void
+WarmupProfile::Write(int64_t collection_id,
+                     const CollectionProfile& profile) const {
+    auto path = ProfilePath(collection_id);
+    std::error_code ec;
+    if (profile.empty()) {
+        std::filesystem::remove(path, ec);
+        return;
+    }
+    auto tmp = path + kTmpFileSuffix;
+    {
+        std::ofstream out(tmp, std::ios::trunc);
+        for (auto& [key, entry] : profile) {
+            out << entry.field_id.get() << ' '
+                << static_cast<int>(entry.target) << ' ' << entry.hits << ' '
+                << entry.last_access_sec << '\n';
+        }
+        if (!out.good()) {
+            LOG_WARN("Failed to write warmup profile {}", tmp);
+            std::filesystem::remove(tmp, ec);
+            return;
+        }
+    }
+    std::filesystem::rename(tmp, path, ec);
+    if (ec) {
+        LOG_WARN("Failed to publish warmup profile {}: {}", path, ec.message());
+        std::filesystem::remove(tmp, ec);
+    }
+}
+
+void
+WarmupProfile::Recover() {
+    auto expire_before = NowSec() - window_sec_;
+    std::error_code ec;
+    for (auto& dirent : std::filesystem::directory_iterator(root_, ec)) {
+        auto& file = dirent.path();
+        if (file.extension() == kTmpFileSuffix) {
+            // a profile a crashed process never published
+            std::filesystem::remove(file, ec);
+            continue;
+        }
+        if (file.extension() != kProfileFileSuffix) {
+            continue;
+        }
+        int64_t collection_id;
+        try {
+            collection_id = std::stoll(file.stem().string());
+        } catch (std::exception&) {
+            continue;
+        }
+        CollectionProfile profile;
+        std::ifstream in(file);
+        int64_t field_id, hits, last_access_sec;
+        int target;
+        while (in >> field_id >> target >> hits >> last_access_sec) {
+            if ((target != static_cast<int>(Target::FIELD) &&
+                 target != static_cast<int>(Target::INDEX)) ||
+                last_access_sec < expire_before) {
+                continue;
+            }
+            profile[Key{field_id, target}] = Entry{FieldId(field_id),
+                                                   static_cast<Target>(target),
+                                                   hits,
+                                                   last_access_sec};
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        profiles_[collection_id] = std::move(profile);
+    }
+    LOG_INFO("Recovered warmup profiles of {} collections under {}",
+             profiles_.size(),
+             root_);
+}
+
+}  // namespace milvus::segcore
@@ -0,0 +1,118 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "common/Types.h"
+
+namespace milvus::segcore {
+
+// Per-collection record of the fields and indexes that queries pinned,
+// replayed when a segment of the collection is loaded so the data production
+// traffic actually touches is warmed first instead of whatever the static
+// warmup policy selects.
+//
+// Accesses are counted per (field, target) with the time of the last one;
+// targets not accessed within `window_sec` are forgotten. The profile of a
+// collection is one text file `<collection_id>.profile` under `root`,
+// published by a rename, and a profile created on an existing root picks up
+// the files left there, so it survives restarts.
+//
+// Thread safety: All methods are thread-safe.
+class WarmupProfile : public std::enable_shared_from_this<WarmupProfile> {
+ public:
+    enum class Target : int {
+        FIELD = 0,
+        INDEX = 1,
+    };
+
+    struct Entry {
+        FieldId field_id;
+        Target target;
+        int64_t hits;
+        int64_t last_access_sec;
+    };
+
+    WarmupProfile(std::string root, int64_t window_sec);
+
+    WarmupProfile(const WarmupProfile&) = delete;
+    WarmupProfile&
+    operator=(const WarmupProfile&) = delete;
+
+    // The process-wide profile, nullptr unless InitGlobal enabled one.
+    static std::shared_ptr<WarmupProfile>
+    Global();
+
+    // Creates the process-wide profile, 0 window disables it.
+    static void
+    InitGlobal(const std::string& root, int64_t window_sec);
+
+    // Counts one access to `field_id` of `collection_id`. Changed profiles
+    // are written back in the background at most every few seconds.
+    void
+    RecordAccess(int64_t collection_id, FieldId field_id, Target target);
+
+    // The targets of `collection_id` accessed within the window, hottest
+    // first.
+    std::vector<Entry>
+    GetHotTargets(int64_t collection_id) const;
+
+    // Writes every profile changed since the last flush.
+    void
+    Flush();
+
+ private:
+    using Key = std::pair<int64_t, int>;
+    // (field id, target) -> entry
+    using CollectionProfile = std::map<Key, Entry>;
+
+    static int64_t
+    NowSec();
+
+    std::string
+    ProfilePath(int64_t collection_id) const;
+
+    // Loads the profiles already under root_, dropping expired entries.
+    void
+    Recover();
+
+    void
+    Write(int64_t collection_id, const CollectionProfile& profile) const;
+
+    std::string root_;
+    int64_t window_sec_;
+
+    mutable std::mutex mutex_;
+    std::unordered_map<int64_t, CollectionProfile> profiles_;
+    std::set<int64_t> dirty_;
+    int64_t last_flush_sec_{0};
+    bool flush_pending_{false};
+
+    // serializes writers of the files under root_
+    std::mutex flush_mutex_;
+};
+
+}  // namespace milvus::segcore
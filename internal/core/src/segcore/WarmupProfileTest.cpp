@@ -0,0 +1,128 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "segcore/WarmupProfile.h"
+
+using namespace milvus;
+using namespace milvus::segcore;
+
+class WarmupProfileTest : public testing::Test {
+ protected:
+    void
+    SetUp() override {
+        root_ = std::filesystem::temp_directory_path() /
+                ("warmup-profile-test-" + std::to_string(::getpid()));
+        std::filesystem::remove_all(root_);
+    }
+
+    void
+    TearDown() override {
+        std::filesystem::remove_all(root_);
+    }
+
+    static int64_t
+    NowSec() {
+        return std::chrono::duration_cast<std::chrono::seconds>(
+                   std::chrono::system_clock::now().time_since_epoch())
+            .count();
+    }
+
+    std::filesystem::path root_;
+};
+
+TEST_F(WarmupProfileTest, OrdersHottestFirst) {
+    // not owned by a shared_ptr, so nothing is flushed in the background
+    WarmupProfile profile(root_.string(), 3600);
+    for (int i = 0; i < 3; i++) {
+        profile.RecordAccess(1, FieldId(101), WarmupProfile::Target::INDEX);
+    }
+    profile.RecordAccess(1, FieldId(102), WarmupProfile::Target::FIELD);
+    profile.RecordAccess(1, FieldId(101), WarmupProfile::Target::FIELD);
+    profile.RecordAccess(1, FieldId(101), WarmupProfile::Target::FIELD);
+    profile.RecordAccess(2, FieldId(201), WarmupProfile::Target::FIELD);
+
+    auto hot = profile.GetHotTargets(1);
+    ASSERT_EQ(hot.size(), 3);
+    EXPECT_EQ(hot[0].field_id, FieldId(101));
+    EXPECT_EQ(hot[0].target, WarmupProfile::Target::INDEX);
+    EXPECT_EQ(hot[0].hits, 3);
+    EXPECT_EQ(hot[1].field_id, FieldId(101));
+    EXPECT_EQ(hot[1].target, WarmupProfile::Target::FIELD);
+    EXPECT_EQ(hot[2].field_id, FieldId(102));
+
+    EXPECT_EQ(profile.GetHotTargets(2).size(), 1);
+    EXPECT_TRUE(profile.GetHotTargets(3).empty());
+}
+
+TEST_F(WarmupProfileTest, SurvivesRestart) {
+    {
+        WarmupProfile profile(root_.string(), 3600);
+        profile.RecordAccess(1, FieldId(101), WarmupProfile::Target::INDEX);
+        profile.RecordAccess(1, FieldId(101), WarmupProfile::Target::INDEX);
+        profile.RecordAccess(1, FieldId(102), WarmupProfile::Target::FIELD);
+        profile.Flush();
+    }
+    EXPECT_TRUE(std::filesystem::exists(root_ / "1.profile"));
+    // a profile a crashed process never published
+    std::ofstream(root_ / "2.profile.tmp") << "100 0 1 1";
+
+    WarmupProfile profile(root_.string(), 3600);
+    EXPECT_FALSE(std::filesystem::exists(root_ / "2.profile.tmp"));
+    auto hot = profile.GetHotTargets(1);
+    ASSERT_EQ(hot.size(), 2);
+    EXPECT_EQ(hot[0].field_id, FieldId(101));
+    EXPECT_EQ(hot[0].target, WarmupProfile::Target::INDEX);
+    EXPECT_EQ(hot[0].hits, 2);
+    EXPECT_EQ(hot[1].field_id, FieldId(102));
+    EXPECT_TRUE(profile.GetHotTargets(2).empty());
+}
+
+TEST_F(WarmupProfileTest, ForgetsAccessesOutsideWindow) {
+    std::filesystem::create_directories(root_);
+    auto now = NowSec();
+    {
+        std::ofstream out(root_ / "1.profile");
+        out << "101 0 50 " << now - 7200 << "\n";
+        out << "102 1 5 " << now - 60 << "\n";
+        // unknown target
+        out << "103 7 5 " << now << "\n";
+    }
+
+    WarmupProfile profile(root_.string(), 3600);
+    auto hot = profile.GetHotTargets(1);
+    ASSERT_EQ(hot.size(), 1);
+    EXPECT_EQ(hot[0].field_id, FieldId(102));
+    EXPECT_EQ(hot[0].target, WarmupProfile::Target::INDEX);
+
+    profile.RecordAccess(1, FieldId(102), WarmupProfile::Target::INDEX);
+    EXPECT_EQ(profile.GetHotTargets(1)[0].hits, 6);
+}
+
+TEST_F(WarmupProfileTest, DisabledByZeroWindow) {
+    WarmupProfile::InitGlobal(root_.string(), 0);
+    EXPECT_EQ(WarmupProfile::Global(), nullptr);
+    WarmupProfile::InitGlobal(root_.string(), 3600);
+    EXPECT_NE(WarmupProfile::Global(), nullptr);
+    WarmupProfile::InitGlobal(root_.string(), 0);
+    EXPECT_EQ(WarmupProfile::Global(), nullptr);
+}
@@ -100,3 +100,11 @@ GetCollectionName(CCollection collection) {
     auto col = static_cast<milvus::segcore::Collection*>(collection);
     return strdup(col->get_collection_name().data());
 }
+
+void
+SetCollectionSearchPool(CCollection collection, const char* search_pool) {
+    SCOPE_CGO_CALL_METRIC();
+
+    auto col = static_cast<milvus::segcore::Collection*>(collection);
+    col->set_search_pool(search_pool);
+}
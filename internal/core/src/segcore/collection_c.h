@@ -48,6 +48,12 @@ DeleteCollection(CCollection collection);
 const char*
 GetCollectionName(CCollection collection);
 
+// Pins the searches and queries of `collection` to the search executor
+// `search_pool`, set up with executor_set_named_search_thread_num. An empty
+// name moves them back to the global executor.
+void
+SetCollectionSearchPool(CCollection collection, const char* search_pool);
+
 #ifdef __cplusplus
 }
 #endif
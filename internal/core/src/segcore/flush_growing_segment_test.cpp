@@ -1002,6 +1002,105 @@ TEST_F(FlushGrowingSegmentTest, FlushNullableScalarTypesPartialRangeRoundTrip) {
     FreeFlushResult(&result);
 }
 
+// the validity and bool bitmaps are packed from a range that neither starts
+// nor ends on a byte boundary
+TEST_F(FlushGrowingSegmentTest, FlushUnalignedRangePacksBitmaps) {
+    auto schema = std::make_shared<Schema>();
+    auto pk_fid = schema->AddDebugField("pk", DataType::INT64);
+    auto bool_fid = schema->AddDebugField("bool_field", DataType::BOOL, true);
+    auto str_fid = schema->AddDebugField("str_field", DataType::VARCHAR, true);
+    auto json_fid = schema->AddDebugField("json_field", DataType::JSON, true);
+    schema->set_primary_field_id(pk_fid);
+
+    auto segment = CreateGrowingSegment(schema, empty_index_meta);
+    ASSERT_NE(segment, nullptr);
+
+    constexpr int N = 21;
+    std::vector<int64_t> row_ids(N);
+    std::vector<Timestamp> timestamps(N);
+    std::vector<int64_t> pks(N);
+    bool bool_values[N];
+    bool valid_data[N];
+    std::vector<std::string> str_values(N);
+    std::vector<std::string> json_values(N);
+    for (int i = 0; i < N; i++) {
+        row_ids[i] = i;
+        timestamps[i] = 100 + i;
+        pks[i] = 1000 + i;
+        bool_values[i] = i % 2 == 0;
+        valid_data[i] = i % 3 != 0;
+        str_values[i] = std::string(i, 'x');
+        json_values[i] = R"({"k":)" + std::to_string(i) + "}";
+    }
+
+    auto insert_data = std::make_unique<InsertRecordProto>();
+    insert_data->set_num_rows(N);
+    insert_data->mutable_fields_data()->AddAllocated(
+        CreateDataArrayFrom(pks.data(), nullptr, N, (*schema)[pk_fid])
+            .release());
+    insert_data->mutable_fields_data()->AddAllocated(
+        CreateDataArrayFrom(bool_values, valid_data, N, (*schema)[bool_fid])
+            .release());
+    insert_data->mutable_fields_data()->AddAllocated(
+        CreateDataArrayFrom(
+            str_values.data(), valid_data, N, (*schema)[str_fid])
+            .release());
+    insert_data->mutable_fields_data()->AddAllocated(
+        CreateDataArrayFrom(
+            json_values.data(), valid_data, N, (*schema)[json_fid])
+            .release());
+
+    segment->PreInsert(N);
+    segment->Insert(0, N, row_ids.data(), timestamps.data(), insert_data.get());
+
+    CFlushConfig config{};
+    std::string segment_path = test_dir_ + "/segment_unaligned_bitmaps";
+    config.segment_path = segment_path.c_str();
+    config.read_version = -1;
+    config.retry_limit = 3;
+    config.text_field_ids = nullptr;
+    config.text_lob_paths = nullptr;
+    config.num_text_columns = 0;
+
+    CFlushResult result{};
+    constexpr int64_t start = 3;
+    constexpr int64_t end = 20;
+    auto status =
+        FlushGrowingSegmentData(segment.get(), start, end, &config, &result);
+    ASSERT_EQ(status.error_code, Success) << status.error_msg;
+    ASSERT_EQ(result.num_rows, end - start);
+
+    auto bool_datas = ReadFlushedFieldData(
+        segment_path, result, bool_fid, DataType::BOOL, true, 0);
+    auto str_datas = ReadFlushedFieldData(
+        segment_path, result, str_fid, DataType::VARCHAR, true, 0);
+    auto json_datas = ReadFlushedFieldData(
+        segment_path, result, json_fid, DataType::JSON, true, 0);
+    ASSERT_EQ(bool_datas.size(), 1);
+    ASSERT_EQ(str_datas.size(), 1);
+    ASSERT_EQ(json_datas.size(), 1);
+    for (int64_t row = start; row < end; row++) {
+        auto i = row - start;
+        ASSERT_EQ(bool_datas[0]->is_valid(i), valid_data[row]) << row;
+        ASSERT_EQ(str_datas[0]->is_valid(i), valid_data[row]) << row;
+        ASSERT_EQ(json_datas[0]->is_valid(i), valid_data[row]) << row;
+        if (!valid_data[row]) {
+            continue;
+        }
+        EXPECT_EQ(*static_cast<const bool*>(bool_datas[0]->RawValue(i)),
+                  bool_values[row])
+            << row;
+        EXPECT_EQ(*static_cast<const std::string*>(str_datas[0]->RawValue(i)),
+                  str_values[row]);
+        EXPECT_EQ(std::string(
+                      static_cast<const Json*>(json_datas[0]->RawValue(i))
+                          ->data()),
+                  json_values[row]);
+    }
+
+    FreeFlushResult(&result);
+}
+
 TEST_F(FlushGrowingSegmentTest, FlushVectorArrayRoundTrip) {
     auto schema = std::make_shared<Schema>();
     auto pk_fid = schema->AddDebugField("pk", DataType::INT64);
@@ -196,12 +196,13 @@ ReadFileRowGroupBlock(const milvus_storage::ArrowFileSystemPtr& fs,
                       const std::string& file,
                       int64_t rg_offset,
                       int64_t rg_count,
-                      int64_t reader_memory_limit) {
+                      int64_t reader_memory_limit,
+                      const std::shared_ptr<arrow::Schema>& schema) {
     ARROW_ASSIGN_OR_RAISE(auto reader,
                           milvus_storage::FileRowGroupReader::Make(
                               fs,
                               file,
-                              nullptr,
+                              schema,
                               reader_memory_limit,
                               milvus::storage::GetReaderProperties(),
                               milvus::storage::GetArrowReaderProperties()));
@@ -641,18 +642,23 @@ ReleaseCellLoadResultBudget(
 
 BatchReaderFactory
 MakeFileReaderFactory(std::vector<std::string> remote_files,
-                      milvus_storage::ArrowFileSystemPtr fs) {
+                      milvus_storage::ArrowFileSystemPtr fs,
+                      std::shared_ptr<arrow::Schema> schema) {
     auto files =
         std::make_shared<std::vector<std::string>>(std::move(remote_files));
-    return [files, fs](size_t batch_key,
-                       int64_t rg_offset,
-                       int64_t total_rg_count,
-                       int64_t reader_memory_limit,
-                       uint64_t /*read_parallelism*/)
+    return [files, fs, schema](size_t batch_key,
+                               int64_t rg_offset,
+                               int64_t total_rg_count,
+                               int64_t reader_memory_limit,
+                               uint64_t /*read_parallelism*/)
                -> arrow::Result<std::vector<std::shared_ptr<arrow::Table>>> {
         const auto& file = (*files)[batch_key];
-        return ReadFileRowGroupBlock(
-            fs, file, rg_offset, total_rg_count, reader_memory_limit);
+        return ReadFileRowGroupBlock(fs,
+                                     file,
+                                     rg_offset,
+                                     total_rg_count,
+                                     reader_memory_limit,
+                                     schema);
     };
 }
 
@@ -223,11 +223,13 @@ ReleaseCellLoadResultBudget(
  * FileRowGroupReader. This factory uses one reader for the requested contiguous
  * row group range and leaves row group internals to the storage/Arrow reader.
  * The returned factory owns a copy of remote_files, so the caller's vector
- * need not outlive the factory.
+ * need not outlive the factory. A non-null `schema` projects the read to its
+ * columns.
  */
 BatchReaderFactory
 MakeFileReaderFactory(std::vector<std::string> remote_files,
-                      milvus_storage::ArrowFileSystemPtr fs);
+                      milvus_storage::ArrowFileSystemPtr fs,
+                      std::shared_ptr<arrow::Schema> schema = nullptr);
 
 /**
  * Creates a BatchReaderFactory that reads from a ChunkReader via batch
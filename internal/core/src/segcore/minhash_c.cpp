@@ -11,6 +11,11 @@
 
 #include "segcore/minhash_c.h"
 
+#include <exception>
+
+#include "arrow/array/array_binary.h"
+#include "arrow/buffer.h"
+#include "common/EasyAssert.h"
 #include "minhash/MinHashComputer.h"
 #include "minhash/MinHashHook.h"
 
@@ -49,3 +54,37 @@ ComputeMinHashFromTexts(const char** texts,
         num_hashes,
         signatures);
 }
+
+CStatus
+ComputeMinHashBinaryVectors(const char* texts,
+                            const int64_t* text_offsets,
+                            int64_t num_texts,
+                            void* tokenizer_ptr,
+                            int32_t shingle_size,
+                            const uint64_t* perm_a,
+                            const uint64_t* perm_b,
+                            int hash_func,
+                            int32_t num_hashes,
+                            uint8_t* binary_vectors) {
+    try {
+        milvus::minhash::minhash_hook_init();
+
+        // view the caller's buffers as an arrow array, without copying
+        arrow::LargeStringArray array(
+            num_texts,
+            arrow::Buffer::Wrap(text_offsets, num_texts + 1),
+            arrow::Buffer::Wrap(texts, text_offsets[num_texts]));
+        milvus::minhash::ComputeBinaryVectorsFromArrow(
+            array,
+            tokenizer_ptr,
+            shingle_size,
+            perm_a,
+            perm_b,
+            (milvus::minhash::HashFunction)hash_func,
+            num_hashes,
+            binary_vectors);
+        return milvus::SuccessCStatus();
+    } catch (std::exception& e) {
+        return milvus::FailureCStatus(&e);
+    }
+}
@@ -14,6 +14,8 @@
 
 #include <stdint.h>
 
+#include "common/type_c.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -36,6 +38,21 @@ ComputeMinHashFromTexts(const char** texts,
                         int32_t num_hashes,
                         uint32_t* signatures);
 
+// Computes the signatures of num_texts texts, text i being
+// texts[text_offsets[i], text_offsets[i + 1]), into binary_vectors,
+// num_hashes * 4 bytes per text.
+CStatus
+ComputeMinHashBinaryVectors(const char* texts,
+                            const int64_t* text_offsets,
+                            int64_t num_texts,
+                            void* tokenizer_ptr,
+                            int32_t shingle_size,
+                            const uint64_t* perm_a,
+                            const uint64_t* perm_b,
+                            int hash_func,
+                            int32_t num_hashes,
+                            uint8_t* binary_vectors);
+
 #ifdef __cplusplus
 }
 #endif
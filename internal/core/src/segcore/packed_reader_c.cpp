@@ -30,6 +30,7 @@
 #include "milvus-storage/filesystem/fs.h"
 #include "milvus-storage/packed/reader.h"
 #include "monitor/scope_metric.h"
+#include "segcore/PackedFilterReader.h"
 #include "storage/KeyRetriever.h"
 #include "storage/PluginLoader.h"
 #include "storage/StorageV2FSCache.h"
@@ -196,3 +197,124 @@ CloseReader(CPackedReader c_packed_reader) {
         return milvus::FailureCStatus(&e);
     }
 }
+
+CStatus
+NewPackedFilterReader(char** paths,
+                      int64_t num_paths,
+                      struct ArrowSchema* schema,
+                      const int64_t buffer_size,
+                      const CPackedReadFilter* filter,
+                      CPackedFilterReader* c_reader,
+                      CPluginContext* c_plugin_context) {
+    SCOPE_CGO_CALL_METRIC();
+
+    try {
+        if (filter == nullptr || filter->column == nullptr) {
+            return milvus::FailureCStatus(milvus::ErrorCode::UnexpectedError,
+                                          "[StorageV2] filter has no column");
+        }
+        auto truePaths = std::vector<std::string>(paths, paths + num_paths);
+        auto trueFs = milvus::segcore::GetDefaultArrowFileSystem();
+        if (!trueFs) {
+            return milvus::FailureCStatus(
+                milvus::ErrorCode::FileReadFailed,
+                "[StorageV2] Failed to get filesystem");
+        }
+        auto trueSchema = arrow::ImportSchema(schema).ValueOrDie();
+
+        milvus::segcore::PackedReadFilter read_filter;
+        read_filter.column = filter->column;
+        auto field = trueSchema->GetFieldByName(read_filter.column);
+        if (field == nullptr) {
+            return milvus::FailureCStatus(
+                milvus::ErrorCode::UnexpectedError,
+                "[StorageV2] filter column " + read_filter.column +
+                    " is not in the read schema");
+        }
+        auto parse_bound = [&field](const char* text) {
+            std::shared_ptr<arrow::Scalar> bound;
+            if (text != nullptr) {
+                auto result = arrow::Scalar::Parse(field->type(), text);
+                AssertInfo(result.ok(),
+                           "[StorageV2] invalid filter bound {}: {}",
+                           text,
+                           result.status().ToString());
+                bound = result.ValueOrDie();
+            }
+            return bound;
+        };
+        read_filter.lower = parse_bound(filter->lower);
+        read_filter.lower_inclusive = filter->lower_inclusive;
+        read_filter.upper = parse_bound(filter->upper);
+        read_filter.upper_inclusive = filter->upper_inclusive;
+
+        auto plugin_ptr =
+            milvus::storage::PluginLoader::GetInstance().getCipherPlugin();
+        if (plugin_ptr != nullptr && c_plugin_context != nullptr) {
+            plugin_ptr->Update(c_plugin_context->ez_id,
+                               c_plugin_context->collection_id,
+                               std::string(c_plugin_context->key));
+        }
+
+        auto reader = std::make_unique<milvus::segcore::PackedFilterReader>(
+            trueFs, truePaths, trueSchema, std::move(read_filter), buffer_size);
+        *c_reader = reader.release();
+        return milvus::SuccessCStatus();
+    } catch (std::exception& e) {
+        return milvus::FailureCStatus(&e);
+    }
+}
+
+CStatus
+ReadNextFiltered(CPackedFilterReader c_reader,
+                 CArrowArray* out_array,
+                 CArrowSchema* out_schema) {
+    SCOPE_CGO_CALL_METRIC();
+
+    try {
+        auto reader =
+            static_cast<milvus::segcore::PackedFilterReader*>(c_reader);
+        std::shared_ptr<arrow::RecordBatch> record_batch;
+        auto status = reader->ReadNext(&record_batch);
+        if (!status.ok()) {
+            return milvus::FailureCStatus(milvus::ErrorCode::FileReadFailed,
+                                          status.ToString());
+        }
+        if (record_batch == nullptr) {
+            // end of file
+            return milvus::SuccessCStatus();
+        }
+        std::unique_ptr<ArrowArray> arr = std::make_unique<ArrowArray>();
+        std::unique_ptr<ArrowSchema> schema = std::make_unique<ArrowSchema>();
+        status =
+            arrow::ExportRecordBatch(*record_batch, arr.get(), schema.get());
+        if (!status.ok()) {
+            return milvus::FailureCStatus(milvus::ErrorCode::FileReadFailed,
+                                          status.ToString());
+        }
+        *out_array = arr.release();
+        *out_schema = schema.release();
+        return milvus::SuccessCStatus();
+    } catch (std::exception& e) {
+        return milvus::FailureCStatus(&e);
+    }
+}
+
+CStatus
+CloseFilterReader(CPackedFilterReader c_reader) {
+    SCOPE_CGO_CALL_METRIC();
+
+    try {
+        auto reader =
+            static_cast<milvus::segcore::PackedFilterReader*>(c_reader);
+        auto status = reader->Close();
+        delete reader;
+        if (!status.ok()) {
+            return milvus::FailureCStatus(milvus::ErrorCode::FileReadFailed,
+                                          status.ToString());
+        }
+        return milvus::SuccessCStatus();
+    } catch (std::exception& e) {
+        return milvus::FailureCStatus(&e);
+    }
+}
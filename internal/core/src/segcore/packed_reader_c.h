@@ -18,6 +18,7 @@
 extern "C" {
 #endif
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #include "common/common_type_c.h"
@@ -77,6 +78,55 @@ ReadNext(CPackedReader c_packed_reader,
 CStatus
 CloseReader(CPackedReader c_packed_reader);
 
+typedef void* CPackedFilterReader;
+
+/**
+ * @brief A range on one column of a filtered packed read, an equality is a
+ *        range whose bounds are equal and inclusive.
+ *
+ * The bounds are the text of a value of the column's type, NULL leaves that
+ * side unbounded.
+ */
+typedef struct CPackedReadFilter {
+    const char* column;
+    const char* lower;
+    bool lower_inclusive;
+    const char* upper;
+    bool upper_inclusive;
+} CPackedReadFilter;
+
+/**
+ * @brief Open a packed reader that only returns the rows matching `filter`.
+ *        The row groups whose statistics exclude the filter are skipped, the
+ *        columns of the other files are read for matching row groups only.
+ *
+ * @param paths The packed files to read.
+ * @param schema The schema of the columns to read, holding the filter column.
+ * @param buffer_size The max buffer size of each file reader.
+ * @param filter The filter of the rows to return.
+ * @param c_reader The output pointer of the reader.
+ */
+CStatus
+NewPackedFilterReader(char** paths,
+                      int64_t num_paths,
+                      struct ArrowSchema* schema,
+                      const int64_t buffer_size,
+                      const CPackedReadFilter* filter,
+                      CPackedFilterReader* c_reader,
+                      CPluginContext* c_plugin_context);
+
+/**
+ * @brief Read the next record batch of matching rows, out_array is left
+ *        untouched once all of them are read.
+ */
+CStatus
+ReadNextFiltered(CPackedFilterReader c_reader,
+                 CArrowArray* out_array,
+                 CArrowSchema* out_schema);
+
+CStatus
+CloseFilterReader(CPackedFilterReader c_reader);
+
 #ifdef __cplusplus
 }
 #endif
@@ -24,6 +24,8 @@
 #include "common/QueryInfo.h"
 #include "common/Schema.h"
 #include "common/Types.h"
+#include "monitor/Monitor.h"
+#include "monitor/scope_metric.h"
 #include "query/Plan.h"
 #include "query/PlanImpl.h"
 #include "query/PlanNode.h"
@@ -36,11 +38,13 @@ CreateSearchPlanByExpr(CCollection c_col,
                        const void* serialized_expr_plan,
                        const int64_t size,
                        CSearchPlan* res_plan) {
+    SCOPE_SEGCORE_STAGE_METRIC(
+        milvus::monitor::internal_core_stage_duration_seconds_plan_parse);
     auto col = static_cast<milvus::segcore::Collection*>(c_col);
     auto schema = col->get_schema();
 
     try {
-        auto res = milvus::query::CreateSearchPlanByExpr(
+        auto res = col->get_plan_cache().GetSearchPlan(
             schema, serialized_expr_plan, size);
         auto col_index_meta = col->get_index_meta();
         auto field_id = milvus::query::GetFieldID(res.get());
@@ -63,6 +67,7 @@ CreateSearchPlanByExpr(CCollection c_col,
             col_index_meta->GetFieldIndexMeta(milvus::FieldId(field_id));
         res->plan_node_->search_info_.metric_type_ =
             field_index_meta.GeMetricType();
+        res->search_pool_ = col->get_search_pool();
 
         auto status = CStatus();
         status.error_code = milvus::Success;
@@ -90,6 +95,8 @@ ParsePlaceholderGroup(CSearchPlan c_plan,
                       const void* placeholder_group_blob,
                       const int64_t blob_size,
                       CPlaceholderGroup* res_placeholder_group) {
+    SCOPE_SEGCORE_STAGE_METRIC(
+        milvus::monitor::internal_core_stage_duration_seconds_plan_parse);
     auto plan = (milvus::query::Plan*)c_plan;
 
     try {
@@ -169,11 +176,14 @@ CreateRetrievePlanByExpr(CCollection c_col,
                          const void* serialized_expr_plan,
                          const int64_t size,
                          CRetrievePlan* res_plan) {
+    SCOPE_SEGCORE_STAGE_METRIC(
+        milvus::monitor::internal_core_stage_duration_seconds_plan_parse);
     auto col = static_cast<milvus::segcore::Collection*>(c_col);
 
     try {
-        auto res = milvus::query::CreateRetrievePlanByExpr(
+        auto res = col->get_plan_cache().GetRetrievePlan(
             col->get_schema(), serialized_expr_plan, size);
+        res->search_pool_ = col->get_search_pool();
 
         auto status = CStatus();
         status.error_code = milvus::Success;
@@ -202,15 +212,37 @@ DeleteRetrievePlan(CRetrievePlan c_plan) {
     delete plan;
 }
 
+// An ORDER BY plan whose pipeline has columns past the pk and ORDER BY keys
+// or deferred fields; element level plans return one row per element.
+static bool
+HasOrderByOutputColumns(const milvus::query::RetrievePlanNode& plan_node) {
+    auto leading = plan_node.order_by_column_count_;
+    if (leading <= 0) {
+        return false;
+    }
+    const auto& pipeline_ids = plan_node.pipeline_field_ids_;
+    bool has_output = !plan_node.deferred_field_ids_.empty();
+    for (size_t i = 0; i < pipeline_ids.size(); i++) {
+        if (pipeline_ids[i] == milvus::ElementIndexFieldID) {
+            return false;
+        }
+        if (pipeline_ids[i] != milvus::SegmentOffsetFieldID &&
+            static_cast<int64_t>(i) >= leading) {
+            has_output = true;
+        }
+    }
+    return has_output;
+}
+
 bool
 ShouldIgnoreNonPk(CRetrievePlan c_plan) {
     auto plan = static_cast<milvus::query::RetrievePlan*>(c_plan);
-    // ORDER BY queries must not use two-phase retrieval: the pipeline
-    // returns data in a positional layout [pk, orderby, remaining] that
-    // the Go-side Remap depends on.  RetrieveByOffsets would re-fetch
-    // via FillTargetEntry in field_ids_ order, breaking that layout.
+    // ORDER BY retrieves in two phases when it has output columns: Retrieve
+    // with ignore_non_pk returns [pk, orderby], the QueryNode merges the
+    // segments on the ORDER BY keys, and RetrieveByOffsets fetches the
+    // remaining columns of the merged top rows only.
     if (plan->plan_node_ && plan->plan_node_->has_order_by_) {
-        return false;
+        return HasOrderByOutputColumns(*plan->plan_node_);
     }
     auto pk_field = plan->schema_->get_primary_field_id();
     auto only_contain_pk = pk_field.has_value() &&
@@ -0,0 +1,212 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "segcore/reduce/AggregationReduce.h"
+
+#include <string>
+#include <utility>
+
+#include "common/EasyAssert.h"
+#include "common/Types.h"
+#include "common/Utils.h"
+#include "common/Vector.h"
+#include "exec/operator/query-agg/PartialAggregateMerge.h"
+#include "plan/PlanNode.h"
+#include "query/ExecPlanNodeVisitor.h"
+#include "segcore/Utils.h"
+
+namespace milvus::segcore {
+
+namespace {
+
+template <typename T, typename Values>
+ColumnVectorPtr
+ColumnFromValues(DataType type, const Values& values, const DataArray& data) {
+    auto column = std::make_shared<ColumnVector>(type, values.size());
+    // the validity of a column without nulls may be left out
+    bool has_validity = data.valid_data_size() == values.size();
+    for (int i = 0; i < values.size(); i++) {
+        if (has_validity && !data.valid_data(i)) {
+            column->nullAt(i);
+        } else {
+            column->SetValueAt<T>(i, static_cast<T>(values[i]));
+        }
+    }
+    return column;
+}
+
+ColumnVectorPtr
+ColumnFromDataArray(const DataArray& data, DataType type) {
+    const auto& scalars = data.scalars();
+    switch (type) {
+        case DataType::BOOL:
+            return ColumnFromValues<bool>(
+                type, scalars.bool_data().data(), data);
+        case DataType::INT8:
+            return ColumnFromValues<int8_t>(
+                type, scalars.int_data().data(), data);
+        case DataType::INT16:
+            return ColumnFromValues<int16_t>(
+                type, scalars.int_data().data(), data);
+        case DataType::INT32:
+            return ColumnFromValues<int32_t>(
+                type, scalars.int_data().data(), data);
+        case DataType::INT64:
+            return ColumnFromValues<int64_t>(
+                type, scalars.long_data().data(), data);
+        case DataType::TIMESTAMPTZ:
+            return ColumnFromValues<int64_t>(
+                type, scalars.timestamptz_data().data(), data);
+        case DataType::FLOAT:
+            return ColumnFromValues<float>(
+                type, scalars.float_data().data(), data);
+        case DataType::DOUBLE:
+            return ColumnFromValues<double>(
+                type, scalars.double_data().data(), data);
+        case DataType::VARCHAR:
+        case DataType::STRING:
+            return ColumnFromValues<std::string>(
+                type, scalars.string_data().data(), data);
+        default:
+            ThrowInfo(DataTypeInvalid,
+                      "unsupported partial aggregation column type {}",
+                      type);
+    }
+}
+
+RowVectorPtr
+ToRowVector(const proto::segcore::RetrieveResults& result,
+            const RowTypePtr& type) {
+    AssertInfo(result.fields_data_size() ==
+                   static_cast<int>(type->column_count()),
+               "partial aggregation result has {} columns, expected {}",
+               result.fields_data_size(),
+               type->column_count());
+    std::vector<VectorPtr> columns;
+    columns.reserve(type->column_count());
+    for (size_t i = 0; i < type->column_count(); i++) {
+        columns.push_back(
+            ColumnFromDataArray(result.fields_data(i), type->column_type(i)));
+    }
+    return std::make_shared<RowVector>(std::move(columns));
+}
+
+bool
+IsMergeableColumnType(DataType type) {
+    switch (type) {
+        case DataType::BOOL:
+        case DataType::INT8:
+        case DataType::INT16:
+        case DataType::INT32:
+        case DataType::INT64:
+        case DataType::TIMESTAMPTZ:
+        case DataType::FLOAT:
+        case DataType::DOUBLE:
+        case DataType::VARCHAR:
+        case DataType::STRING:
+            return true;
+        default:
+            return false;
+    }
+}
+
+}  // namespace
+
+bool
+CanMergeAggregationRetrieveResults(const query::RetrievePlan& plan) {
+    if (plan.plan_node_ == nullptr) {
+        return false;
+    }
+    auto node = std::dynamic_pointer_cast<const plan::AggregationNode>(
+        plan.plan_node_->plannodes_);
+    if (node == nullptr) {
+        return false;
+    }
+    for (const auto& aggregate : node->aggregates()) {
+        const auto& name = aggregate.call_->fun_name();
+        if (name != KCount && name != KSum && name != KMin && name != KMax &&
+            name != KApproxCountDistinct && name != KApproxPercentile) {
+            return false;
+        }
+    }
+    const auto& type = node->output_type();
+    for (size_t i = 0; i < type->column_count(); i++) {
+        if (!IsMergeableColumnType(type->column_type(i))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::unique_ptr<proto::segcore::RetrieveResults>
+MergeAggregationRetrieveResults(
+    const query::RetrievePlan& plan,
+    const std::vector<proto::segcore::RetrieveResults>& results,
+    int32_t parallelism,
+    folly::CPUThreadPoolExecutor* executor) {
+    auto node = std::dynamic_pointer_cast<const plan::AggregationNode>(
+        plan.plan_node_->plannodes_);
+    if (node == nullptr) {
+        ThrowInfo(Unsupported,
+                  "only the results of a plan ending in its aggregation can "
+                  "be merged");
+    }
+    const auto& type = node->output_type();
+    auto merged = std::make_unique<proto::segcore::RetrieveResults>();
+    std::vector<RowVectorPtr> partials;
+    partials.reserve(results.size());
+    for (const auto& result : results) {
+        partials.push_back(ToRowVector(result, type));
+        merged->set_all_retrieve_count(merged->all_retrieve_count() +
+                                       result.all_retrieve_count());
+        merged->set_has_more_result(merged->has_more_result() ||
+                                    result.has_more_result());
+        merged->set_scanned_remote_bytes(merged->scanned_remote_bytes() +
+                                         result.scanned_remote_bytes());
+        merged->set_scanned_total_bytes(merged->scanned_total_bytes() +
+                                        result.scanned_total_bytes());
+        if (!result.explain_analyze().empty()) {
+            if (!merged->explain_analyze().empty()) {
+                merged->mutable_explain_analyze()->push_back('\n');
+            }
+            merged->mutable_explain_analyze()->append(
+                result.explain_analyze());
+        }
+    }
+
+    auto groups =
+        exec::MergePartialAggregates(*node, partials, parallelism, executor);
+    for (size_t i = 0; i < type->column_count(); i++) {
+        auto data_type = type->column_type(i);
+        auto* data_array = merged->add_fields_data();
+        CreateScalarDataArray(*data_array, 0, data_type, data_type, true);
+        for (const auto& part : groups) {
+            auto column =
+                std::dynamic_pointer_cast<ColumnVector>(part->child(i));
+            AssertInfo(column != nullptr,
+                       "merged aggregation column {} must be a column vector",
+                       i);
+            DataArray part_array;
+            CreateScalarDataArray(
+                part_array, column->size(), data_type, data_type, true);
+            query::fillDataArrayFromColumnVector(column, part_array);
+            data_array->MergeFrom(part_array);
+        }
+    }
+    return merged;
+}
+
+}  // namespace milvus::segcore
@@ -0,0 +1,48 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <folly/executors/CPUThreadPoolExecutor.h>
+
+#include "pb/segcore.pb.h"
+#include "query/PlanImpl.h"
+
+namespace milvus::segcore {
+
+// Whether MergeAggregationRetrieveResults can merge the results of `plan`:
+// the plan must end in its aggregation, every aggregate must have a
+// mergeable partial state and every column a type the merge reads back.
+bool
+CanMergeAggregationRetrieveResults(const query::RetrievePlan& plan);
+
+// Merges the retrieve results of one GROUP BY plan on several segments into
+// one result of the same layout, see exec::MergePartialAggregates. The
+// plan must end in its aggregation: an ORDER BY ... LIMIT over the groups
+// of each segment already dropped groups the merge would need, so such
+// results are left to the reducer.
+std::unique_ptr<proto::segcore::RetrieveResults>
+MergeAggregationRetrieveResults(
+    const query::RetrievePlan& plan,
+    const std::vector<proto::segcore::RetrieveResults>& results,
+    int32_t parallelism,
+    folly::CPUThreadPoolExecutor* executor);
+
+}  // namespace milvus::segcore
@@ -18,8 +18,13 @@
 #include <numeric>
 #include <optional>
 #include <queue>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
 #include <vector>
 
+#include "ankerl/unordered_dense.h"
 #include "common/Consts.h"
 #include "common/EasyAssert.h"
 #include "common/FieldMeta.h"
@@ -34,10 +39,157 @@
 #include "log/Log.h"
 #include "query/PlanImpl.h"
 #include "segcore/SegmentInterface.h"
+#include "segcore/Utils.h"
 #include "storage/ThreadPools.h"
 
 namespace milvus::segcore {
 
+namespace {
+
+// the rows of one query in one segment not merged yet
+struct MergeCursor {
+    const SearchResult* search_result;
+    int32_t segment_index;
+    size_t offset;
+    size_t offset_end;
+};
+
+template <typename Pk>
+Pk
+PkAt(const SearchResult* search_result, size_t offset) {
+    if constexpr (std::is_same_v<Pk, std::string_view>) {
+        return std::get<std::string>(search_result->primary_keys_[offset]);
+    } else {
+        return std::get<Pk>(search_result->primary_keys_[offset]);
+    }
+}
+
+// A tournament tree over the cursors of one query. The root holds the cursor
+// whose row comes first and every inner node the loser of its match, so
+// taking a row replays only the matches on the path of its cursor: log2 of
+// the segments comparisons per row, however many segments there are. Rows
+// come by score DESC, equal scores by PK ASC and then by segment, the order
+// the Go reduce merges in.
+template <typename Pk>
+class TournamentMerge {
+ public:
+    explicit TournamentMerge(std::vector<MergeCursor> cursors)
+        : cursors_(std::move(cursors)), losers_(cursors_.size()) {
+        if (!cursors_.empty()) {
+            winner_ = Play(1);
+        }
+    }
+
+    bool
+    Done() const {
+        return cursors_.empty() || Exhausted(winner_);
+    }
+
+    const MergeCursor&
+    Top() const {
+        return cursors_[winner_];
+    }
+
+    void
+    Pop() {
+        cursors_[winner_].offset++;
+        auto winner = winner_;
+        for (auto node = (winner + cursors_.size()) / 2; node > 0; node /= 2) {
+            if (Before(losers_[node], winner)) {
+                std::swap(losers_[node], winner);
+            }
+        }
+        winner_ = winner;
+    }
+
+ private:
+    bool
+    Exhausted(size_t i) const {
+        return cursors_[i].offset == cursors_[i].offset_end;
+    }
+
+    bool
+    Before(size_t a, size_t b) const {
+        if (Exhausted(a) || Exhausted(b)) {
+            return !Exhausted(a);
+        }
+        auto& x = cursors_[a];
+        auto& y = cursors_[b];
+        auto diff = x.search_result->distances_[x.offset] -
+                    y.search_result->distances_[y.offset];
+        if (std::fabs(diff) >= EPSILON) {
+            return diff > 0;
+        }
+        auto x_pk = PkAt<Pk>(x.search_result, x.offset);
+        auto y_pk = PkAt<Pk>(y.search_result, y.offset);
+        if (x_pk != y_pk) {
+            return x_pk < y_pk;
+        }
+        return a < b;
+    }
+
+    // the leaves are the nodes [n, 2n), one per cursor
+    size_t
+    Play(size_t node) {
+        auto n = cursors_.size();
+        if (node >= n) {
+            return node - n;
+        }
+        auto left = Play(2 * node);
+        auto right = Play(2 * node + 1);
+        if (Before(right, left)) {
+            losers_[node] = left;
+            return right;
+        }
+        losers_[node] = right;
+        return left;
+    }
+
+    std::vector<MergeCursor> cursors_;
+    std::vector<size_t> losers_;
+    size_t winner_ = 0;
+};
+
+// a PK and, for element-level search, an element index
+template <typename Pk>
+using DedupKey = std::pair<Pk, int32_t>;
+
+struct DedupKeyHash {
+    template <typename Pk>
+    uint64_t
+    operator()(const DedupKey<Pk>& key) const {
+        return ankerl::unordered_dense::hash<Pk>{}(key.first) ^
+               (static_cast<uint64_t>(key.second) * 0x9E3779B97F4A7C15ULL);
+    }
+};
+
+template <typename Pk>
+void
+MergeOneNQ(std::vector<MergeCursor> cursors,
+           int64_t topk,
+           std::vector<ReducedRow>& rows) {
+    TournamentMerge<Pk> merge(std::move(cursors));
+    ankerl::unordered_dense::set<DedupKey<Pk>, DedupKeyHash> seen;
+    seen.reserve(topk);
+    rows.reserve(topk);
+    while (static_cast<int64_t>(rows.size()) < topk && !merge.Done()) {
+        auto& cursor = merge.Top();
+        auto search_result = cursor.search_result;
+        auto element_index =
+            search_result->element_level_
+                ? search_result->element_indices_[cursor.offset]
+                : -1;
+        if (seen.emplace(PkAt<Pk>(search_result, cursor.offset), element_index)
+                .second) {
+            rows.push_back({cursor.segment_index,
+                            static_cast<int64_t>(cursor.offset)});
+        }
+        merge.Pop();
+    }
+}
+
+}  // namespace
+
 void
 ReduceHelper::Initialize() {
     AssertInfo(search_results_.size() > 0, "empty search result");
@@ -93,6 +245,87 @@ ReduceHelper::PreReduce() {
     FillPrimaryKey();
 }
 
+std::vector<std::vector<ReducedRow>>
+ReduceHelper::Reduce() {
+    AssertInfo(!plan_->plan_node_->search_info_.has_group_by(),
+               "native reduce is not supported for group_by");
+    PreReduce();
+
+    tracer::AutoSpan span("ReduceHelper::Reduce", tracer::GetRootSpan());
+    // the tournament breaks ties by PK, the rows of one segment have to come
+    // in that order too
+    for (auto search_result : search_results_) {
+        SortEqualScoresByPks(search_result);
+    }
+
+    std::vector<std::vector<ReducedRow>> rows(total_nq_);
+    constexpr int64_t kMergeQueriesPerTask = 16;
+    if (num_segments_ == 0) {
+        return rows;
+    }
+    if (total_nq_ <= kMergeQueriesPerTask) {
+        MergeQueries(0, total_nq_, rows);
+        return rows;
+    }
+    auto& pool = ThreadPools::GetThreadPool(milvus::ThreadPoolPriority::MIDDLE);
+    std::vector<std::future<void>> futures;
+    for (int64_t begin = 0; begin < total_nq_; begin += kMergeQueriesPerTask) {
+        auto end = std::min(total_nq_, begin + kMergeQueriesPerTask);
+        futures.emplace_back(pool.Submit(
+            [this, begin, end, &rows] { MergeQueries(begin, end, rows); }));
+    }
+    auto futures_guard = folly::makeGuard([&futures]() {
+        for (auto& f : futures) {
+            if (f.valid()) {
+                try {
+                    f.get();
+                } catch (...) {
+                }
+            }
+        }
+    });
+    for (auto& future : futures) {
+        future.get();
+    }
+    return rows;
+}
+
+void
+ReduceHelper::MergeQueries(int64_t query_begin,
+                           int64_t query_end,
+                           std::vector<std::vector<ReducedRow>>& rows) const {
+    auto pk_type = DataType::INT64;
+    auto pk_field_id = plan_->schema_->get_primary_field_id();
+    if (pk_field_id.has_value()) {
+        pk_type = plan_->schema_->operator[](pk_field_id.value())
+                      .get_data_type();
+    }
+    for (int64_t qi = query_begin; qi < query_end; ++qi) {
+        auto slice_index = std::upper_bound(slice_nqs_prefix_sum_.begin(),
+                                            slice_nqs_prefix_sum_.end(),
+                                            qi) -
+                           slice_nqs_prefix_sum_.begin() - 1;
+        std::vector<MergeCursor> cursors;
+        cursors.reserve(num_segments_);
+        for (int i = 0; i < num_segments_; i++) {
+            auto search_result = search_results_[i];
+            auto offset_beg = search_result->topk_per_nq_prefix_sum_[qi];
+            auto offset_end = search_result->topk_per_nq_prefix_sum_[qi + 1];
+            if (offset_beg == offset_end) {
+                continue;
+            }
+            cursors.push_back({search_result, i, offset_beg, offset_end});
+        }
+        if (pk_type == DataType::VARCHAR) {
+            MergeOneNQ<std::string_view>(
+                std::move(cursors), slice_topKs_[slice_index], rows[qi]);
+        } else {
+            MergeOneNQ<int64_t>(
+                std::move(cursors), slice_topKs_[slice_index], rows[qi]);
+        }
+    }
+}
+
 bool
 ReduceHelper::CanUseGlobalRefine() const {
     if (placeholder_group_ == nullptr || placeholder_group_->empty()) {
@@ -368,17 +601,21 @@ ReduceHelper::RefineOneSegment(SearchResult* search_result,
                                bool is_negated,
                                int64_t dim,
                                int64_t element_size,
-                               const char* dense_blob) {
+                               const char* dense_blob,
+                               int64_t query_begin,
+                               int64_t query_end) {
     auto segment = static_cast<SegmentInterface*>(search_result->segment_);
-    auto nq = search_result->total_nq_;
     std::vector<size_t> indices;
     std::vector<float> new_distances;
+    std::vector<size_t> label_order;
+    std::vector<int64_t> sorted_offsets;
+    std::vector<float> sorted_distances;
     auto query_dataset = std::make_shared<knowhere::DataSet>();
     query_dataset->SetRows(1);
     query_dataset->SetDim(dim);
     query_dataset->SetTensorBeginId(0);
     query_dataset->SetIsOwner(false);
-    for (int64_t qi = 0; qi < nq; ++qi) {
+    for (int64_t qi = query_begin; qi < query_end; ++qi) {
         auto nq_begin = search_result->topk_per_nq_prefix_sum_[qi];
         auto nq_end = search_result->topk_per_nq_prefix_sum_[qi + 1];
         auto count = nq_end - nq_begin;
@@ -392,13 +629,26 @@ ReduceHelper::RefineOneSegment(SearchResult* search_result,
         auto result_count = static_cast<size_t>(count);
         auto* offsets = &search_result->seg_offsets_[nq_begin];
         new_distances.resize(result_count);
+        // the candidates come in distance order; fetched in offset order the
+        // raw vectors are read front to back, so mmap'd and cached refine
+        // data is walked sequentially instead of at random
+        label_order.resize(result_count);
+        std::iota(label_order.begin(), label_order.end(), 0);
+        std::sort(label_order.begin(),
+                  label_order.end(),
+                  [&](size_t a, size_t b) { return offsets[a] < offsets[b]; });
+        sorted_offsets.resize(result_count);
+        for (size_t i = 0; i < result_count; ++i) {
+            sorted_offsets[i] = offsets[label_order[i]];
+        }
+        sorted_distances.resize(result_count);
         bool ok = segment->CalcDistByIDs(op_ctx_,
                                          field_id,
                                          query_dataset,
-                                         offsets,
+                                         sorted_offsets.data(),
                                          count,
                                          is_cosine,
-                                         new_distances.data());
+                                         sorted_distances.data());
         if (!ok) {
             LOG_WARN(
                 "failed to refine distances by ids, keep approximate "
@@ -410,6 +660,9 @@ ReduceHelper::RefineOneSegment(SearchResult* search_result,
                 count);
             continue;
         }
+        for (size_t i = 0; i < result_count; ++i) {
+            new_distances[label_order[i]] = sorted_distances[i];
+        }
 
         if (is_negated) {
             for (auto& d : new_distances) {
@@ -452,32 +705,47 @@ ReduceHelper::RefineDistances() {
     auto element_size = milvus::GetDataTypeSize(field.get_data_type(), dim);
     auto dense_blob = static_cast<const char*>(placeholder.get_blob());
 
-    if (num_segments_ > 1) {
+    // one task per segment and run of queries: a few segments with a large
+    // nq still spread over the pool, and a task fetching raw vectors from
+    // one segment overlaps with others computing distances
+    constexpr int64_t kRefineQueriesPerTask = 16;
+    struct RefineTask {
+        SearchResult* search_result;
+        int64_t query_begin;
+        int64_t query_end;
+    };
+    std::vector<RefineTask> tasks;
+    for (auto& search_result : search_results_) {
+        if (!IsSearchResultRefineEnabled(search_result)) {
+            continue;
+        }
+        auto nq = search_result->total_nq_;
+        for (int64_t begin = 0; begin < nq; begin += kRefineQueriesPerTask) {
+            tasks.push_back({search_result,
+                             begin,
+                             std::min(nq, begin + kRefineQueriesPerTask)});
+        }
+    }
+
+    auto run_task = [&](const RefineTask& task) {
+        RefineOneSegment(task.search_result,
+                         field_id,
+                         is_cosine,
+                         is_negated,
+                         dim,
+                         element_size,
+                         dense_blob,
+                         task.query_begin,
+                         task.query_end);
+    };
+    if (tasks.size() > 1) {
         auto& pool =
             ThreadPools::GetThreadPool(milvus::ThreadPoolPriority::MIDDLE);
         std::vector<std::future<void>> futures;
-        futures.reserve(num_segments_);
-        for (auto& search_result : search_results_) {
-            if (!IsSearchResultRefineEnabled(search_result)) {
-                continue;
-            }
-            auto future = pool.Submit([this,
-                                       search_result,
-                                       field_id,
-                                       is_cosine,
-                                       is_negated,
-                                       dim,
-                                       element_size,
-                                       dense_blob] {
-                RefineOneSegment(search_result,
-                                 field_id,
-                                 is_cosine,
-                                 is_negated,
-                                 dim,
-                                 element_size,
-                                 dense_blob);
-            });
-            futures.emplace_back(std::move(future));
+        futures.reserve(tasks.size());
+        for (const auto& task : tasks) {
+            futures.emplace_back(
+                pool.Submit([&run_task, task] { run_task(task); }));
         }
         auto futures_guard = folly::makeGuard([&futures]() {
             for (auto& f : futures) {
@@ -492,15 +760,8 @@ ReduceHelper::RefineDistances() {
         for (auto& future : futures) {
             future.get();
         }
-    } else if (num_segments_ == 1 &&
-               IsSearchResultRefineEnabled(search_results_[0])) {
-        RefineOneSegment(search_results_[0],
-                         field_id,
-                         is_cosine,
-                         is_negated,
-                         dim,
-                         element_size,
-                         dense_blob);
+    } else if (tasks.size() == 1) {
+        run_task(tasks[0]);
     }
 }
 
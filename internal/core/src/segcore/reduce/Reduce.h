@@ -25,6 +25,13 @@
 
 namespace milvus::segcore {
 
+// One row of a reduced query: the index of the SearchResult it comes from and
+// its position in that SearchResult.
+struct ReducedRow {
+    int32_t segment_index;
+    int64_t position;
+};
+
 class ReduceHelper {
  public:
     explicit ReduceHelper(
@@ -52,6 +59,15 @@ class ReduceHelper {
     virtual void
     PreReduce();
 
+    // Reduce runs PreReduce, then merges the results every query has in the
+    // segments into the top-k of its slice, keeping the first row of each PK
+    // (of each PK and element index for element-level search). The rows of
+    // query qi are returned in order at index qi; segment indices refer to
+    // the search results left after PreReduce dropped the empty ones.
+    // Group-by results are not supported.
+    std::vector<std::vector<ReducedRow>>
+    Reduce();
+
     int64_t
     GetAllSearchCount() const {
         int64_t all_search_count = 0;
@@ -80,6 +96,12 @@ class ReduceHelper {
     void
     ResetMergeState();
 
+    // merges the results of queries [query_begin, query_end)
+    void
+    MergeQueries(int64_t query_begin,
+                 int64_t query_end,
+                 std::vector<std::vector<ReducedRow>>& rows) const;
+
     void
     RefineDistances();
 
@@ -89,6 +111,7 @@ class ReduceHelper {
     virtual bool
     IsSearchResultRefineEnabled(SearchResult* search_result) const;
 
+    // refines the results of queries [query_begin, query_end) of one segment
     void
     RefineOneSegment(SearchResult* search_result,
                      FieldId field_id,
@@ -96,7 +119,9 @@ class ReduceHelper {
                      bool is_negated,
                      int64_t dim,
                      int64_t element_size,
-                     const char* dense_blob);
+                     const char* dense_blob,
+                     int64_t query_begin,
+                     int64_t query_end);
 
     void
     ApplyRefinedOrderForOneNQ(SearchResult* search_result,
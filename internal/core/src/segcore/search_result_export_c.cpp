@@ -488,9 +488,10 @@ FieldDataToArrow(const std::string& field_name,
         "unsupported scalar type in Arrow export");
 }
 
-// Build Arrow RecordBatch from a SearchResult that has been filtered and had PKs filled.
-// extra_fields contains additional field data to include (e.g., for L0 rerank).
-// The plan provides schema and group-by metadata.
+// Build Arrow RecordBatch from rows [begin, end) of a SearchResult that has
+// been filtered and had PKs filled.
+// extra_fields contains additional field data of those rows to include (e.g.,
+// for L0 rerank). The plan provides schema and group-by metadata.
 arrow::Result<std::shared_ptr<arrow::RecordBatch>>
 BuildSearchResultBatch(
     SearchResult* search_result,
@@ -498,9 +499,11 @@ BuildSearchResultBatch(
     const int64_t* extra_field_ids,
     int64_t num_extra_fields,
     const std::map<milvus::FieldId, std::unique_ptr<milvus::DataArray>>&
-        extra_fields) {
+        extra_fields,
+    size_t begin,
+    size_t end) {
     auto& schema = plan->schema_;
-    auto total_valid = search_result->seg_offsets_.size();
+    auto total_valid = end - begin;
 
     // Collect fields and arrays
     std::vector<std::shared_ptr<arrow::Field>> fields;
@@ -511,7 +514,7 @@ BuildSearchResultBatch(
         if (search_result->pk_type_ == milvus::DataType::INT64) {
             arrow::Int64Builder id_builder;
             ARROW_RETURN_NOT_OK(id_builder.Reserve(total_valid));
-            for (size_t i = 0; i < total_valid; ++i) {
+            for (size_t i = begin; i < end; ++i) {
                 auto& pk = search_result->primary_keys_[i];
                 id_builder.UnsafeAppend(std::get<int64_t>(pk));
             }
@@ -521,7 +524,7 @@ BuildSearchResultBatch(
             arrays.push_back(id_array);
         } else {
             arrow::StringBuilder id_builder;
-            for (size_t i = 0; i < total_valid; ++i) {
+            for (size_t i = begin; i < end; ++i) {
                 auto& pk = search_result->primary_keys_[i];
                 ARROW_RETURN_NOT_OK(
                     id_builder.Append(std::get<std::string>(pk)));
@@ -537,7 +540,7 @@ BuildSearchResultBatch(
     {
         arrow::FloatBuilder score_builder;
         ARROW_RETURN_NOT_OK(score_builder.Reserve(total_valid));
-        for (size_t i = 0; i < total_valid; ++i) {
+        for (size_t i = begin; i < end; ++i) {
             score_builder.UnsafeAppend(search_result->distances_[i]);
         }
         std::shared_ptr<arrow::Array> score_array;
@@ -550,7 +553,7 @@ BuildSearchResultBatch(
     {
         arrow::Int64Builder seg_offset_builder;
         ARROW_RETURN_NOT_OK(seg_offset_builder.Reserve(total_valid));
-        for (size_t i = 0; i < total_valid; ++i) {
+        for (size_t i = begin; i < end; ++i) {
             seg_offset_builder.UnsafeAppend(search_result->seg_offsets_[i]);
         }
         std::shared_ptr<arrow::Array> seg_offset_array;
@@ -569,12 +572,13 @@ BuildSearchResultBatch(
                    "composite_group_by_values_");
         auto& composite = search_result->composite_group_by_values_.value();
         AssertInfo(
-            composite.size() == total_valid,
+            composite.size() == search_result->seg_offsets_.size(),
             "composite_group_by_values_ size {} does not match seg_offsets_ "
             "size {}",
             composite.size(),
-            total_valid);
-        for (const auto& key : composite) {
+            search_result->seg_offsets_.size());
+        for (size_t i = begin; i < end; ++i) {
+            const auto& key = composite[i];
             AssertInfo(key.Size() == group_by_infos.size(),
                        "group_by value count {} does not match group_by field "
                        "count {}",
@@ -586,9 +590,9 @@ BuildSearchResultBatch(
              ++field_idx) {
             const auto& group_by_info = group_by_infos[field_idx];
             std::vector<milvus::GroupByValueType> field_values;
-            field_values.reserve(composite.size());
-            for (const auto& key : composite) {
-                field_values.push_back(key[field_idx]);
+            field_values.reserve(total_valid);
+            for (size_t i = begin; i < end; ++i) {
+                field_values.push_back(composite[i][field_idx]);
             }
             ARROW_ASSIGN_OR_RAISE(
                 auto gb_arr,
@@ -607,13 +611,14 @@ BuildSearchResultBatch(
     // element_indices_ is int32 and aligned with seg_offsets_ after compaction.
     if (search_result->element_level_) {
         AssertInfo(
-            search_result->element_indices_.size() == total_valid,
+            search_result->element_indices_.size() ==
+                search_result->seg_offsets_.size(),
             "element_indices_ size {} does not match seg_offsets_ size {}",
             search_result->element_indices_.size(),
-            total_valid);
+            search_result->seg_offsets_.size());
         arrow::Int32Builder ei_builder;
         ARROW_RETURN_NOT_OK(ei_builder.Reserve(total_valid));
-        for (size_t i = 0; i < total_valid; ++i) {
+        for (size_t i = begin; i < end; ++i) {
             ei_builder.UnsafeAppend(search_result->element_indices_[i]);
         }
         std::shared_ptr<arrow::Array> ei_array;
@@ -702,6 +707,55 @@ PopulateChunkSizes(SearchResult* search_result,
     return milvus::SuccessCStatus();
 }
 
+// Whether a SearchResult holds rows to export, checking that the rows of a
+// non-empty one are split into their NQ chunks.
+bool
+HasRowsToExport(const SearchResult* search_result) {
+    if (search_result->unity_topK_ == 0 ||
+        search_result->seg_offsets_.empty()) {
+        return false;
+    }
+    AssertInfo(search_result->topk_per_nq_prefix_sum_.size() ==
+                   static_cast<size_t>(search_result->total_nq_ + 1),
+               "topk_per_nq_prefix_sum_ size {} does not match total_nq {}",
+               search_result->topk_per_nq_prefix_sum_.size(),
+               search_result->total_nq_);
+    return search_result->get_total_result_count() > 0;
+}
+
+// Read the extra fields of rows [begin, end) of a SearchResult, accumulating
+// the storage cost into it.
+std::map<milvus::FieldId, std::unique_ptr<milvus::DataArray>>
+ReadExtraFields(SearchResult* search_result,
+                const int64_t* extra_field_ids,
+                int64_t num_extra_fields,
+                size_t begin,
+                size_t end,
+                const folly::CancellationToken& cancel_token) {
+    std::map<milvus::FieldId, std::unique_ptr<milvus::DataArray>> extra_fields;
+    if (num_extra_fields <= 0 || extra_field_ids == nullptr || begin == end) {
+        return extra_fields;
+    }
+    auto segment = static_cast<milvus::segcore::SegmentInternalInterface*>(
+        search_result->segment_);
+    milvus::OpContext op_ctx(cancel_token);
+    for (int64_t i = 0; i < num_extra_fields; i++) {
+        milvus::futures::throwIfCancelled(cancel_token);
+        auto field_id = milvus::FieldId(extra_field_ids[i]);
+        auto field_data =
+            segment->bulk_subscript(&op_ctx,
+                                    field_id,
+                                    search_result->seg_offsets_.data() + begin,
+                                    end - begin);
+        extra_fields[field_id] = std::move(field_data);
+    }
+    search_result->search_storage_cost_.scanned_remote_bytes +=
+        op_ctx.storage_usage.scanned_cold_bytes.load();
+    search_result->search_storage_cost_.scanned_total_bytes +=
+        op_ctx.storage_usage.scanned_total_bytes.load();
+    return extra_fields;
+}
+
 CStatus
 BuildSearchResultFullBatch(CSearchResult c_search_result,
                            CSearchPlan c_plan,
@@ -727,8 +781,7 @@ BuildSearchResultFullBatch(CSearchResult c_search_result,
             search_result, out_chunk_sizes, out_num_chunks);
     };
 
-    if (search_result->unity_topK_ == 0 ||
-        search_result->seg_offsets_.empty()) {
+    if (!HasRowsToExport(search_result)) {
         auto empty_batch_result =
             BuildEmptyBatch(plan,
                             extra_field_ids,
@@ -743,54 +796,25 @@ BuildSearchResultFullBatch(CSearchResult c_search_result,
         return export_chunk_sizes();
     }
 
-    AssertInfo(search_result->topk_per_nq_prefix_sum_.size() ==
-                   static_cast<size_t>(search_result->total_nq_ + 1),
-               "topk_per_nq_prefix_sum_ size {} does not match total_nq {}",
-               search_result->topk_per_nq_prefix_sum_.size(),
-               search_result->total_nq_);
-
-    if (search_result->get_total_result_count() == 0) {
-        auto empty_batch_result =
-            BuildEmptyBatch(plan,
-                            extra_field_ids,
-                            num_extra_fields,
-                            search_result->element_level_);
-        if (!empty_batch_result.ok()) {
-            return milvus::FailureCStatus(
-                milvus::ErrorCode::UnexpectedError,
-                empty_batch_result.status().ToString());
-        }
-        *out_batch = *empty_batch_result;
-        return export_chunk_sizes();
-    }
-
-    auto segment = static_cast<milvus::segcore::SegmentInternalInterface*>(
-        search_result->segment_);
-
     milvus::futures::throwIfCancelled(cancel_token);
     { milvus::segcore::SortEqualScoresByPks(search_result); }
 
-    std::map<milvus::FieldId, std::unique_ptr<milvus::DataArray>> extra_fields;
-    if (num_extra_fields > 0 && extra_field_ids != nullptr &&
-        search_result->get_total_result_count() > 0) {
-        auto size = search_result->seg_offsets_.size();
-        milvus::OpContext op_ctx(cancel_token);
-        for (int64_t i = 0; i < num_extra_fields; i++) {
-            milvus::futures::throwIfCancelled(cancel_token);
-            auto field_id = milvus::FieldId(extra_field_ids[i]);
-            auto field_data = segment->bulk_subscript(
-                &op_ctx, field_id, search_result->seg_offsets_.data(), size);
-            extra_fields[field_id] = std::move(field_data);
-        }
-        search_result->search_storage_cost_.scanned_remote_bytes +=
-            op_ctx.storage_usage.scanned_cold_bytes.load();
-        search_result->search_storage_cost_.scanned_total_bytes +=
-            op_ctx.storage_usage.scanned_total_bytes.load();
-    }
+    auto size = search_result->seg_offsets_.size();
+    auto extra_fields = ReadExtraFields(search_result,
+                                        extra_field_ids,
+                                        num_extra_fields,
+                                        0,
+                                        size,
+                                        cancel_token);
 
     milvus::futures::throwIfCancelled(cancel_token);
-    auto batch_result = BuildSearchResultBatch(
-        search_result, plan, extra_field_ids, num_extra_fields, extra_fields);
+    auto batch_result = BuildSearchResultBatch(search_result,
+                                               plan,
+                                               extra_field_ids,
+                                               num_extra_fields,
+                                               extra_fields,
+                                               0,
+                                               size);
     if (!batch_result.ok()) {
         return milvus::FailureCStatus(milvus::ErrorCode::UnexpectedError,
                                       batch_result.status().ToString());
@@ -799,6 +823,112 @@ BuildSearchResultFullBatch(CSearchResult c_search_result,
     return export_chunk_sizes();
 }
 
+// The rows a batch of a streaming export gathers at least, in whole NQ
+// chunks, so that a result of many small NQs isn't read one batch per NQ.
+constexpr size_t kArrowStreamBatchRows = 4096;
+
+// Builds the batches of a streaming export as they are read. Each batch holds
+// the rows of a run of whole NQ chunks, and the extra fields are read for
+// those rows only, so the field data of one batch is alive at a time instead
+// of the whole result's. The SearchResult and the plan must outlive the
+// reader.
+class SearchResultBatchReader : public arrow::RecordBatchReader {
+ public:
+    SearchResultBatchReader(SearchResult* search_result,
+                            milvus::query::Plan* plan,
+                            std::vector<int64_t> extra_field_ids,
+                            std::shared_ptr<arrow::Schema> schema,
+                            folly::CancellationToken cancel_token)
+        : search_result_(search_result),
+          plan_(plan),
+          extra_field_ids_(std::move(extra_field_ids)),
+          schema_(std::move(schema)),
+          cancel_token_(std::move(cancel_token)) {
+        bounds_.push_back(0);
+        if (!HasRowsToExport(search_result_)) {
+            // one empty batch, as the full export returns
+            empty_ = true;
+            return;
+        }
+        const auto& prefix = search_result_->topk_per_nq_prefix_sum_;
+        AssertInfo(prefix.back() == search_result_->seg_offsets_.size(),
+                   "topk_per_nq_prefix_sum_ total {} does not match "
+                   "seg_offsets_ size {}",
+                   prefix.back(),
+                   search_result_->seg_offsets_.size());
+        for (size_t nq = 1; nq < prefix.size(); nq++) {
+            if (prefix[nq] - bounds_.back() >= kArrowStreamBatchRows ||
+                nq + 1 == prefix.size()) {
+                bounds_.push_back(prefix[nq]);
+            }
+        }
+        milvus::segcore::SortEqualScoresByPks(search_result_);
+    }
+
+    std::shared_ptr<arrow::Schema>
+    schema() const override {
+        return schema_;
+    }
+
+    arrow::Status
+    ReadNext(std::shared_ptr<arrow::RecordBatch>* batch) override {
+        if (empty_) {
+            empty_ = false;
+            ARROW_ASSIGN_OR_RAISE(*batch,
+                                  arrow::RecordBatch::MakeEmpty(schema_));
+            return arrow::Status::OK();
+        }
+        if (next_ + 1 >= bounds_.size()) {
+            *batch = nullptr;
+            return arrow::Status::OK();
+        }
+        auto begin = bounds_[next_];
+        auto end = bounds_[next_ + 1];
+        try {
+            milvus::futures::throwIfCancelled(cancel_token_);
+            auto extra_fields = ReadExtraFields(search_result_,
+                                                extra_field_ids_.data(),
+                                                extra_field_ids_.size(),
+                                                begin,
+                                                end,
+                                                cancel_token_);
+            ARROW_ASSIGN_OR_RAISE(
+                *batch,
+                BuildSearchResultBatch(search_result_,
+                                       plan_,
+                                       extra_field_ids_.data(),
+                                       extra_field_ids_.size(),
+                                       extra_fields,
+                                       begin,
+                                       end));
+        } catch (folly::FutureCancellation& e) {
+            return arrow::Status::Cancelled(e.what());
+        } catch (std::exception& e) {
+            return arrow::Status::UnknownError(e.what());
+        }
+        if (!(*batch)->schema()->Equals(*schema_)) {
+            return arrow::Status::Invalid(
+                "search result batch schema ",
+                (*batch)->schema()->ToString(),
+                " does not match the stream schema ",
+                schema_->ToString());
+        }
+        next_++;
+        return arrow::Status::OK();
+    }
+
+ private:
+    SearchResult* search_result_;
+    milvus::query::Plan* plan_;
+    std::vector<int64_t> extra_field_ids_;
+    std::shared_ptr<arrow::Schema> schema_;
+    folly::CancellationToken cancel_token_;
+    // the rows of batch i are [bounds_[i], bounds_[i + 1])
+    std::vector<size_t> bounds_;
+    size_t next_ = 0;
+    bool empty_ = false;
+};
+
 }  // namespace
 
 CStatus
@@ -862,190 +992,271 @@ ExportSearchResultAsArrowRecordBatch(CSearchResult c_search_result,
 }
 
 CStatus
-FillOutputFieldsOrderedImpl(CSearchResult* search_results,
-                            int64_t num_search_results,
-                            CSearchPlan c_plan,
-                            const int32_t* result_seg_indices,
-                            const int64_t* result_seg_offsets,
-                            int64_t total_rows,
-                            CProto* out_result,
-                            const folly::CancellationToken& cancel_token) {
+ExportSearchResultAsArrowStream(CSearchResult c_search_result,
+                                CSearchPlan c_plan,
+                                const int64_t* extra_field_ids,
+                                int64_t num_extra_fields,
+                                ArrowArrayStream* out_stream,
+                                int64_t** out_chunk_sizes,
+                                int64_t* out_num_chunks,
+                                void* cancellation_source) {
     SCOPE_CGO_CALL_METRIC();
 
     try {
-        AssertEmptyCProto(out_result);
+        AssertInfo(out_stream != nullptr, "null ArrowArrayStream output");
+        AssertInfo(out_stream->release == nullptr,
+                   "ArrowArrayStream output must be empty before export");
+        AssertInfo(out_chunk_sizes != nullptr, "null chunk sizes output");
+        AssertInfo(out_num_chunks != nullptr, "null chunk size count output");
+        *out_chunk_sizes = nullptr;
+        *out_num_chunks = 0;
+        auto cancel_token = folly::CancellationToken();
+        if (cancellation_source != nullptr) {
+            auto source =
+                static_cast<folly::CancellationSource*>(cancellation_source);
+            cancel_token = source->getToken();
+        }
+        milvus::futures::throwIfCancelled(cancel_token);
+        auto search_result = static_cast<SearchResult*>(c_search_result);
         auto plan = static_cast<milvus::query::Plan*>(c_plan);
-        milvus::OpContext op_ctx(cancel_token);
+        AssertInfo(search_result != nullptr, "null search result");
+        AssertInfo(plan != nullptr, "null search plan");
 
-        if (plan->target_entries_.empty()) {
-            return milvus::SuccessCStatus();
+        auto empty_batch_result =
+            BuildEmptyBatch(plan,
+                            extra_field_ids,
+                            num_extra_fields,
+                            search_result->element_level_);
+        if (!empty_batch_result.ok()) {
+            return milvus::FailureCStatus(
+                milvus::ErrorCode::UnexpectedError,
+                empty_batch_result.status().ToString());
         }
-
-        // When total_rows is 0 but target_entries_ is non-empty, produce a
-        // SearchResultData proto with properly typed but empty FieldData
-        // entries for each output field. The delegator-side reduce
-        // (ReduceSearchResultData) uses searchResultData[0].FieldsData
-        // length to initialize the output structure; if we return nullptr
-        // here, the output FieldsData has 0 entries, causing an
-        // index-out-of-range panic when merging with non-empty results.
-        if (total_rows == 0) {
-            auto& schema = plan->schema_;
-            auto result_data =
-                std::make_unique<milvus::proto::schema::SearchResultData>();
-            for (auto& field_id : plan->target_entries_) {
-                auto& field_meta = schema->operator[](field_id);
-                auto field_data =
-                    field_meta.is_vector()
-                        ? milvus::segcore::CreateEmptyVectorDataArray(
-                              0, field_meta)
-                        : milvus::segcore::CreateEmptyScalarDataArray(
-                              0, field_meta);
-                field_data->set_field_name(field_meta.get_name().get());
-                SetFieldDataElementTypeIfNeeded(field_data.get(), field_meta);
-                result_data->mutable_fields_data()->AddAllocated(
-                    field_data.release());
-            }
-            return SerializeSearchResultDataToCProto(
-                *result_data,
-                out_result,
-                "failed to allocate for empty field data proto",
-                "failed to serialize empty field data proto");
+        auto reader = std::make_shared<SearchResultBatchReader>(
+            search_result,
+            plan,
+            extra_field_ids == nullptr
+                ? std::vector<int64_t>()
+                : std::vector<int64_t>(extra_field_ids,
+                                       extra_field_ids + num_extra_fields),
+            (*empty_batch_result)->schema(),
+            cancel_token);
+
+        auto status =
+            PopulateChunkSizes(search_result, out_chunk_sizes, out_num_chunks);
+        if (status.error_code != 0) {
+            return status;
         }
-
-        std::unordered_map<int32_t, std::vector<std::pair<int64_t, int64_t>>>
-            seg_groups;
-        for (int64_t i = 0; i < total_rows; i++) {
-            seg_groups[result_seg_indices[i]].emplace_back(
-                i, result_seg_offsets[i]);
+        ChunkSizesPtr chunk_sizes_guard(*out_chunk_sizes);
+        auto export_status = arrow::ExportRecordBatchReader(reader, out_stream);
+        if (!export_status.ok()) {
+            *out_chunk_sizes = nullptr;
+            *out_num_chunks = 0;
+            return milvus::FailureCStatus(milvus::ErrorCode::UnexpectedError,
+                                          export_status.ToString());
         }
+        chunk_sizes_guard.release();
+        return milvus::SuccessCStatus();
+    } catch (folly::FutureCancellation& e) {
+        return milvus::FailureCStatus(milvus::ErrorCode::FollyCancel, e.what());
+    } catch (std::exception& e) {
+        return milvus::FailureCStatus(&e);
+    }
+}
 
-        struct SegResult {
-            SearchResult temp_result;
-            std::vector<int64_t> result_positions;
-        };
-        std::unordered_map<int32_t, SegResult> seg_results;
-
-        for (auto& [seg_idx, pairs] : seg_groups) {
-            AssertInfo(seg_idx >= 0 && seg_idx < num_search_results,
-                       "seg_idx {} out of range [0, {})",
-                       seg_idx,
-                       num_search_results);
-            auto sr = static_cast<SearchResult*>(search_results[seg_idx]);
+// Append the output fields of the given rows, in the order of the rows, to
+// result_data. With no rows every output field is appended empty but typed.
+void
+FillOrderedOutputFields(CSearchResult* search_results,
+                        int64_t num_search_results,
+                        milvus::query::Plan* plan,
+                        const int32_t* result_seg_indices,
+                        const int64_t* result_seg_offsets,
+                        int64_t total_rows,
+                        milvus::OpContext& op_ctx,
+                        milvus::proto::schema::SearchResultData& result_data) {
+    if (total_rows == 0) {
+        auto& schema = plan->schema_;
+        for (auto& field_id : plan->target_entries_) {
+            auto& field_meta = schema->operator[](field_id);
+            auto field_data =
+                field_meta.is_vector()
+                    ? milvus::segcore::CreateEmptyVectorDataArray(0, field_meta)
+                    : milvus::segcore::CreateEmptyScalarDataArray(0,
+                                                                  field_meta);
+            field_data->set_field_name(field_meta.get_name().get());
+            SetFieldDataElementTypeIfNeeded(field_data.get(), field_meta);
+            result_data.mutable_fields_data()->AddAllocated(
+                field_data.release());
+        }
+        return;
+    }
 
-            auto& seg_res = seg_results[seg_idx];
-            seg_res.temp_result.segment_ = sr->segment_;
-            seg_res.result_positions.reserve(pairs.size());
+    std::unordered_map<int32_t, std::vector<std::pair<int64_t, int64_t>>>
+        seg_groups;
+    for (int64_t i = 0; i < total_rows; i++) {
+        seg_groups[result_seg_indices[i]].emplace_back(i,
+                                                       result_seg_offsets[i]);
+    }
 
-            for (auto& [pos, offset] : pairs) {
-                seg_res.temp_result.seg_offsets_.push_back(offset);
-                seg_res.result_positions.push_back(pos);
-            }
-            seg_res.temp_result.distances_.resize(pairs.size(), 0.0f);
+    struct SegResult {
+        SearchResult temp_result;
+        std::vector<int64_t> result_positions;
+    };
+    std::unordered_map<int32_t, SegResult> seg_results;
+
+    for (auto& [seg_idx, pairs] : seg_groups) {
+        AssertInfo(seg_idx >= 0 && seg_idx < num_search_results,
+                   "seg_idx {} out of range [0, {})",
+                   seg_idx,
+                   num_search_results);
+        auto sr = static_cast<SearchResult*>(search_results[seg_idx]);
+
+        auto& seg_res = seg_results[seg_idx];
+        seg_res.temp_result.segment_ = sr->segment_;
+        seg_res.result_positions.reserve(pairs.size());
+
+        for (auto& [pos, offset] : pairs) {
+            seg_res.temp_result.seg_offsets_.push_back(offset);
+            seg_res.result_positions.push_back(pos);
         }
+        seg_res.temp_result.distances_.resize(pairs.size(), 0.0f);
+    }
 
-        if (seg_results.size() > 1) {
-            auto& pool = milvus::ThreadPools::GetThreadPool(
-                milvus::ThreadPoolPriority::MIDDLE);
-            std::vector<std::future<void>> futures;
-            futures.reserve(seg_results.size());
-            for (auto& [seg_idx, seg_res] : seg_results) {
-                auto sr = static_cast<SearchResult*>(search_results[seg_idx]);
-                auto segment =
-                    static_cast<milvus::segcore::SegmentInternalInterface*>(
-                        sr->segment_);
-                auto* seg_res_ptr = &seg_res;
-                futures.emplace_back(
-                    pool.Submit([segment, plan, seg_res_ptr, &op_ctx] {
-                        segment->FillTargetEntry(
-                            plan, seg_res_ptr->temp_result, &op_ctx);
-                    }));
-            }
-            auto futures_guard = folly::makeGuard([&futures]() {
-                for (auto& f : futures) {
-                    if (f.valid()) {
-                        try {
-                            f.get();
-                        } catch (...) {
-                        }
-                    }
-                }
-            });
-            for (auto& future : futures) {
-                future.get();
-            }
-        } else if (seg_results.size() == 1) {
-            auto& [seg_idx, seg_res] = *seg_results.begin();
+    if (seg_results.size() > 1) {
+        auto& pool = milvus::ThreadPools::GetThreadPool(
+            milvus::ThreadPoolPriority::MIDDLE);
+        std::vector<std::future<void>> futures;
+        futures.reserve(seg_results.size());
+        for (auto& [seg_idx, seg_res] : seg_results) {
             auto sr = static_cast<SearchResult*>(search_results[seg_idx]);
             auto segment =
                 static_cast<milvus::segcore::SegmentInternalInterface*>(
                     sr->segment_);
-            segment->FillTargetEntry(plan, seg_res.temp_result, &op_ctx);
+            auto* seg_res_ptr = &seg_res;
+            futures.emplace_back(
+                pool.Submit([segment, plan, seg_res_ptr, &op_ctx] {
+                    segment->FillTargetEntry(
+                        plan, seg_res_ptr->temp_result, &op_ctx);
+                }));
+        }
+        auto futures_guard = folly::makeGuard([&futures]() {
+            for (auto& f : futures) {
+                if (f.valid()) {
+                    try {
+                        f.get();
+                    } catch (...) {
+                    }
+                }
+            }
+        });
+        for (auto& future : futures) {
+            future.get();
         }
+    } else if (seg_results.size() == 1) {
+        auto& [seg_idx, seg_res] = *seg_results.begin();
+        auto sr = static_cast<SearchResult*>(search_results[seg_idx]);
+        auto segment = static_cast<milvus::segcore::SegmentInternalInterface*>(
+            sr->segment_);
+        segment->FillTargetEntry(plan, seg_res.temp_result, &op_ctx);
+    }
 
-        // Write storage cost back to original search results
-        for (auto& [seg_idx, seg_res] : seg_results) {
-            auto sr = static_cast<SearchResult*>(search_results[seg_idx]);
-            sr->search_storage_cost_.scanned_remote_bytes +=
-                seg_res.temp_result.search_storage_cost_.scanned_remote_bytes;
-            sr->search_storage_cost_.scanned_total_bytes +=
-                seg_res.temp_result.search_storage_cost_.scanned_total_bytes;
+    // Write storage cost back to original search results
+    for (auto& [seg_idx, seg_res] : seg_results) {
+        auto sr = static_cast<SearchResult*>(search_results[seg_idx]);
+        sr->search_storage_cost_.scanned_remote_bytes +=
+            seg_res.temp_result.search_storage_cost_.scanned_remote_bytes;
+        sr->search_storage_cost_.scanned_total_bytes +=
+            seg_res.temp_result.search_storage_cost_.scanned_total_bytes;
+    }
+
+    std::vector<milvus::segcore::MergeBase> result_pairs(total_rows);
+    for (auto& [seg_idx, seg_res] : seg_results) {
+        for (size_t i = 0; i < seg_res.result_positions.size(); i++) {
+            auto pos = seg_res.result_positions[i];
+            result_pairs[pos] = {&seg_res.temp_result.output_fields_data_, i};
         }
+    }
 
-        std::vector<milvus::segcore::MergeBase> result_pairs(total_rows);
-        for (auto& [seg_idx, seg_res] : seg_results) {
+    // For nullable vector fields, FillTargetEntry compacts the vector
+    // buffer via FilterVectorValidOffsets (null rows dropped), while the
+    // valid_data bitmap keeps its logical length. MergeDataArray reads
+    // vectors at physical_offset = getValidDataOffset(), which falls back
+    // to the logical offset unless we set it. Compute the per-row physical
+    // offset = count of valid rows preceding this one, mirroring the
+    // logic in master's reduce/Reduce.cpp.
+    for (auto& [seg_idx, seg_res] : seg_results) {
+        for (auto field_id : plan->target_entries_) {
+            auto& field_meta = plan->schema_->operator[](field_id);
+            if (!field_meta.is_vector() || !field_meta.is_nullable()) {
+                continue;
+            }
+            auto it = seg_res.temp_result.output_fields_data_.find(field_id);
+            if (it == seg_res.temp_result.output_fields_data_.end()) {
+                continue;
+            }
+            auto& field_data = it->second;
+            if (field_data->valid_data_size() == 0) {
+                continue;
+            }
+            int64_t valid_idx = 0;
             for (size_t i = 0; i < seg_res.result_positions.size(); i++) {
                 auto pos = seg_res.result_positions[i];
-                result_pairs[pos] = {&seg_res.temp_result.output_fields_data_,
-                                     i};
-            }
-        }
-
-        // For nullable vector fields, FillTargetEntry compacts the vector
-        // buffer via FilterVectorValidOffsets (null rows dropped), while the
-        // valid_data bitmap keeps its logical length. MergeDataArray reads
-        // vectors at physical_offset = getValidDataOffset(), which falls back
-        // to the logical offset unless we set it. Compute the per-row physical
-        // offset = count of valid rows preceding this one, mirroring the
-        // logic in master's reduce/Reduce.cpp.
-        for (auto& [seg_idx, seg_res] : seg_results) {
-            for (auto field_id : plan->target_entries_) {
-                auto& field_meta = plan->schema_->operator[](field_id);
-                if (!field_meta.is_vector() || !field_meta.is_nullable()) {
-                    continue;
-                }
-                auto it =
-                    seg_res.temp_result.output_fields_data_.find(field_id);
-                if (it == seg_res.temp_result.output_fields_data_.end()) {
-                    continue;
-                }
-                auto& field_data = it->second;
-                if (field_data->valid_data_size() == 0) {
-                    continue;
-                }
-                int64_t valid_idx = 0;
-                for (size_t i = 0; i < seg_res.result_positions.size(); i++) {
-                    auto pos = seg_res.result_positions[i];
-                    result_pairs[pos].setValidDataOffset(field_id, valid_idx);
-                    if (field_data->valid_data(i)) {
-                        valid_idx++;
-                    }
+                result_pairs[pos].setValidDataOffset(field_id, valid_idx);
+                if (field_data->valid_data(i)) {
+                    valid_idx++;
                 }
             }
         }
+    }
 
-        auto result_data =
-            std::make_unique<milvus::proto::schema::SearchResultData>();
-        for (auto field_id : plan->target_entries_) {
-            auto& field_meta = plan->schema_->operator[](field_id);
-            auto field_data =
-                milvus::segcore::MergeDataArray(result_pairs, field_meta);
-            SetFieldDataElementTypeIfNeeded(field_data.get(), field_meta);
-            result_data->mutable_fields_data()->AddAllocated(
-                field_data.release());
+    for (auto field_id : plan->target_entries_) {
+        auto& field_meta = plan->schema_->operator[](field_id);
+        auto field_data =
+            milvus::segcore::MergeDataArray(result_pairs, field_meta);
+        SetFieldDataElementTypeIfNeeded(field_data.get(), field_meta);
+        result_data.mutable_fields_data()->AddAllocated(field_data.release());
+    }
+}
+
+CStatus
+FillOutputFieldsOrderedImpl(CSearchResult* search_results,
+                            int64_t num_search_results,
+                            CSearchPlan c_plan,
+                            const int32_t* result_seg_indices,
+                            const int64_t* result_seg_offsets,
+                            int64_t total_rows,
+                            CProto* out_result,
+                            const folly::CancellationToken& cancel_token) {
+    SCOPE_CGO_CALL_METRIC();
+
+    try {
+        AssertEmptyCProto(out_result);
+        auto plan = static_cast<milvus::query::Plan*>(c_plan);
+        milvus::OpContext op_ctx(cancel_token);
+
+        if (plan->target_entries_.empty()) {
+            return milvus::SuccessCStatus();
         }
 
+        // When total_rows is 0 but target_entries_ is non-empty, produce a
+        // SearchResultData proto with properly typed but empty FieldData
+        // entries for each output field. The delegator-side reduce
+        // (ReduceSearchResultData) uses searchResultData[0].FieldsData
+        // length to initialize the output structure; if we return nullptr
+        // here, the output FieldsData has 0 entries, causing an
+        // index-out-of-range panic when merging with non-empty results.
+        milvus::proto::schema::SearchResultData result_data;
+        FillOrderedOutputFields(search_results,
+                                num_search_results,
+                                plan,
+                                result_seg_indices,
+                                result_seg_offsets,
+                                total_rows,
+                                op_ctx,
+                                result_data);
         return SerializeSearchResultDataToCProto(
-            *result_data,
+            result_data,
             out_result,
             "failed to allocate memory for proto serialization",
             "failed to serialize SearchResultData proto");
@@ -1086,6 +1297,138 @@ FillOutputFieldsOrdered(CSearchResult* search_results,
                                        folly::CancellationToken());
 }
 
+// Whether an output field of this type has an Arrow form the Go side reads
+// back into a FieldData.
+bool
+IsArrowOutputField(const milvus::FieldMeta& field_meta) {
+    switch (field_meta.get_data_type()) {
+        case milvus::DataType::BOOL:
+        case milvus::DataType::INT8:
+        case milvus::DataType::INT16:
+        case milvus::DataType::INT32:
+        case milvus::DataType::INT64:
+        case milvus::DataType::FLOAT:
+        case milvus::DataType::DOUBLE:
+        case milvus::DataType::STRING:
+        case milvus::DataType::VARCHAR:
+        case milvus::DataType::TEXT:
+            return true;
+        default:
+            return false;
+    }
+}
+
+CStatus
+FillOutputFieldsOrderedAsArrowImpl(
+    CSearchResult* search_results,
+    int64_t num_search_results,
+    CSearchPlan c_plan,
+    const int32_t* result_seg_indices,
+    const int64_t* result_seg_offsets,
+    int64_t total_rows,
+    ArrowSchema* out_schema,
+    ArrowArray* out_array,
+    bool* exported,
+    const folly::CancellationToken& cancel_token) {
+    SCOPE_CGO_CALL_METRIC();
+
+    try {
+        AssertInfo(out_schema != nullptr, "null ArrowSchema output");
+        AssertInfo(out_array != nullptr, "null ArrowArray output");
+        AssertInfo(out_schema->release == nullptr,
+                   "ArrowSchema output must be empty before export");
+        AssertInfo(out_array->release == nullptr,
+                   "ArrowArray output must be empty before export");
+        AssertInfo(exported != nullptr, "null exported output");
+        *exported = false;
+        auto plan = static_cast<milvus::query::Plan*>(c_plan);
+        auto& schema = plan->schema_;
+        for (auto field_id : plan->target_entries_) {
+            if (!IsArrowOutputField(schema->operator[](field_id))) {
+                return milvus::SuccessCStatus();
+            }
+        }
+
+        milvus::OpContext op_ctx(cancel_token);
+        milvus::proto::schema::SearchResultData result_data;
+        FillOrderedOutputFields(search_results,
+                                num_search_results,
+                                plan,
+                                result_seg_indices,
+                                result_seg_offsets,
+                                total_rows,
+                                op_ctx,
+                                result_data);
+
+        std::vector<std::shared_ptr<arrow::Field>> fields;
+        std::vector<std::shared_ptr<arrow::Array>> arrays;
+        for (size_t i = 0; i < plan->target_entries_.size(); i++) {
+            auto field_id = plan->target_entries_[i];
+            auto& field_meta = schema->operator[](field_id);
+            auto name = std::string(field_meta.get_name().get());
+            auto result =
+                FieldDataToArrow(name, result_data.fields_data(i), total_rows);
+            if (!result.ok()) {
+                return milvus::FailureCStatus(
+                    milvus::ErrorCode::UnexpectedError,
+                    result.status().ToString());
+            }
+            auto [field, arr] = *result;
+            fields.push_back(MilvusField(field->name(),
+                                         field->type(),
+                                         field_meta.is_nullable(),
+                                         field_id,
+                                         field_meta.get_data_type()));
+            arrays.push_back(arr);
+        }
+        auto batch =
+            arrow::RecordBatch::Make(arrow::schema(fields), total_rows, arrays);
+        auto export_status =
+            arrow::ExportRecordBatch(*batch, out_array, out_schema);
+        if (!export_status.ok()) {
+            ReleaseArrowArrayIfNeeded(out_array);
+            ReleaseArrowSchemaIfNeeded(out_schema);
+            return milvus::FailureCStatus(milvus::ErrorCode::UnexpectedError,
+                                          export_status.ToString());
+        }
+        *exported = true;
+        return milvus::SuccessCStatus();
+    } catch (folly::FutureCancellation& e) {
+        return milvus::FailureCStatus(milvus::ErrorCode::FollyCancel, e.what());
+    } catch (std::exception& e) {
+        return milvus::FailureCStatus(&e);
+    }
+}
+
+CStatus
+FillOutputFieldsOrderedAsArrow(CSearchResult* search_results,
+                               int64_t num_search_results,
+                               CSearchPlan c_plan,
+                               const int32_t* result_seg_indices,
+                               const int64_t* result_seg_offsets,
+                               int64_t total_rows,
+                               ArrowSchema* out_schema,
+                               ArrowArray* out_array,
+                               bool* exported,
+                               void* cancellation_source) {
+    auto cancel_token = folly::CancellationToken();
+    if (cancellation_source != nullptr) {
+        auto source =
+            static_cast<folly::CancellationSource*>(cancellation_source);
+        cancel_token = source->getToken();
+    }
+    return FillOutputFieldsOrderedAsArrowImpl(search_results,
+                                              num_search_results,
+                                              c_plan,
+                                              result_seg_indices,
+                                              result_seg_offsets,
+                                              total_rows,
+                                              out_schema,
+                                              out_array,
+                                              exported,
+                                              cancel_token);
+}
+
 void
 GetSearchResultMetadata(CSearchResult c_search_result,
                         bool* has_group_by,
@@ -1191,3 +1534,185 @@ PrepareSearchResultsForExport(CTraceContext c_trace,
                                              all_search_count,
                                              folly::CancellationToken());
 }
+
+CStatus
+ReduceSearchResultsAndFillDataImpl(
+    CTraceContext c_trace,
+    CSearchPlan c_plan,
+    CPlaceholderGroup c_placeholder_group,
+    CSearchResult* c_search_results,
+    int64_t num_segments,
+    int64_t* slice_nqs,
+    int64_t num_slices,
+    int64_t* slice_topKs,
+    CProto* out_results,
+    int64_t* all_search_count,
+    const folly::CancellationToken& cancel_token) {
+    SCOPE_CGO_CALL_METRIC();
+
+    // the slices serialized so far, freed if a later one fails
+    int64_t filled = 0;
+    bool succeeded = false;
+    auto results_guard = folly::makeGuard([&]() {
+        if (succeeded) {
+            return;
+        }
+        for (int64_t i = 0; i < filled; ++i) {
+            free(const_cast<void*>(out_results[i].proto_blob));
+            out_results[i].proto_blob = nullptr;
+            out_results[i].proto_size = 0;
+        }
+    });
+    try {
+        AssertInfo(num_segments > 0, "num_segments must be greater than 0");
+        AssertInfo(num_slices > 0, "num_slices must be greater than 0");
+        AssertInfo(out_results != nullptr, "null CProto outputs");
+        for (int64_t i = 0; i < num_slices; ++i) {
+            AssertEmptyCProto(&out_results[i]);
+        }
+
+        auto plan = static_cast<milvus::query::Plan*>(c_plan);
+        auto placeholder_group =
+            static_cast<const milvus::query::PlaceholderGroup*>(
+                c_placeholder_group);
+        auto trace_ctx = milvus::tracer::TraceContext{
+            c_trace.traceID, c_trace.spanID, c_trace.traceFlags};
+        std::vector<milvus::SearchResult*> search_results;
+        search_results.reserve(num_segments);
+        for (int64_t i = 0; i < num_segments; ++i) {
+            AssertInfo(c_search_results[i] != nullptr,
+                       "null search result at index {}",
+                       i);
+            search_results.push_back(
+                static_cast<milvus::SearchResult*>(c_search_results[i]));
+        }
+
+        milvus::OpContext op_ctx(cancel_token);
+        milvus::segcore::ReduceHelper helper(search_results,
+                                             plan,
+                                             placeholder_group,
+                                             slice_nqs,
+                                             slice_topKs,
+                                             num_slices,
+                                             &trace_ctx,
+                                             &op_ctx);
+        // search_results is left with the non-empty results, the ones the
+        // rows refer to
+        auto rows = helper.Reduce();
+        auto search_count = helper.GetAllSearchCount();
+        if (all_search_count != nullptr) {
+            *all_search_count = search_count;
+        }
+        std::vector<CSearchResult> reduced(search_results.begin(),
+                                           search_results.end());
+
+        auto pk_field_id = plan->schema_->get_primary_field_id();
+        bool is_varchar_pk =
+            pk_field_id.has_value() &&
+            plan->schema_->operator[](pk_field_id.value()).get_data_type() ==
+                milvus::DataType::VARCHAR;
+        bool element_level =
+            std::any_of(search_results.begin(),
+                        search_results.end(),
+                        [](SearchResult* sr) { return sr->element_level_; });
+
+        int64_t nq_begin = 0;
+        for (int64_t slice = 0; slice < num_slices; ++slice) {
+            auto nq_end = nq_begin + slice_nqs[slice];
+            milvus::proto::schema::SearchResultData result_data;
+            result_data.set_num_queries(slice_nqs[slice]);
+            result_data.set_top_k(slice_topKs[slice]);
+            result_data.set_all_search_count(search_count);
+            auto ids = result_data.mutable_ids();
+            std::vector<int32_t> seg_indices;
+            std::vector<int64_t> seg_offsets;
+            for (auto qi = nq_begin; qi < nq_end; ++qi) {
+                result_data.add_topks(rows[qi].size());
+                for (auto& row : rows[qi]) {
+                    auto sr = search_results[row.segment_index];
+                    auto& pk = sr->primary_keys_[row.position];
+                    if (is_varchar_pk) {
+                        ids->mutable_str_id()->add_data(
+                            std::get<std::string>(pk));
+                    } else {
+                        ids->mutable_int_id()->add_data(std::get<int64_t>(pk));
+                    }
+                    result_data.add_scores(sr->distances_[row.position]);
+                    if (element_level) {
+                        result_data.mutable_element_indices()->add_data(
+                            sr->element_indices_[row.position]);
+                    }
+                    seg_indices.push_back(row.segment_index);
+                    seg_offsets.push_back(sr->seg_offsets_[row.position]);
+                }
+            }
+            if (!plan->target_entries_.empty()) {
+                FillOrderedOutputFields(reduced.data(),
+                                        reduced.size(),
+                                        plan,
+                                        seg_indices.data(),
+                                        seg_offsets.data(),
+                                        seg_indices.size(),
+                                        op_ctx,
+                                        result_data);
+            }
+            auto status = SerializeSearchResultDataToCProto(
+                result_data,
+                &out_results[slice],
+                "failed to allocate memory for proto serialization",
+                "failed to serialize SearchResultData proto");
+            if (status.error_code != 0) {
+                return status;
+            }
+            filled++;
+            nq_begin = nq_end;
+        }
+        succeeded = true;
+        return milvus::SuccessCStatus();
+    } catch (folly::FutureCancellation& e) {
+        return milvus::FailureCStatus(milvus::ErrorCode::FollyCancel, e.what());
+    } catch (std::exception& e) {
+        return milvus::FailureCStatus(&e);
+    }
+}
+
+CStatus
+ReduceSearchResultsAndFillData(CTraceContext c_trace,
+                               CSearchPlan c_plan,
+                               CPlaceholderGroup c_placeholder_group,
+                               CSearchResult* c_search_results,
+                               int64_t num_segments,
+                               int64_t* slice_nqs,
+                               int64_t num_slices,
+                               int64_t* slice_topKs,
+                               CProto* out_results,
+                               int64_t* all_search_count,
+                               void* cancellation_source) {
+    if (cancellation_source != nullptr) {
+        auto source =
+            static_cast<folly::CancellationSource*>(cancellation_source);
+        return ReduceSearchResultsAndFillDataImpl(c_trace,
+                                                  c_plan,
+                                                  c_placeholder_group,
+                                                  c_search_results,
+                                                  num_segments,
+                                                  slice_nqs,
+                                                  num_slices,
+                                                  slice_topKs,
+                                                  out_results,
+                                                  all_search_count,
+                                                  source->getToken());
+    }
+
+    return ReduceSearchResultsAndFillDataImpl(c_trace,
+                                              c_plan,
+                                              c_placeholder_group,
+                                              c_search_results,
+                                              num_segments,
+                                              slice_nqs,
+                                              num_slices,
+                                              slice_topKs,
+                                              out_results,
+                                              all_search_count,
+                                              folly::CancellationToken());
+}
@@ -24,6 +24,7 @@ extern "C" {
 // Forward declarations for Arrow C Data Interface
 struct ArrowSchema;
 struct ArrowArray;
+struct ArrowArrayStream;
 
 // Export a per-segment SearchResult as one full Arrow RecordBatch for the
 // segment. The caller receives the per-NQ row counts in out_chunk_sizes and
@@ -42,6 +43,26 @@ ExportSearchResultAsArrowRecordBatch(CSearchResult c_search_result,
                                      int64_t* out_num_chunks,
                                      void* cancellation_source);
 
+// Export a per-segment SearchResult as a stream of Arrow RecordBatches, each
+// holding the rows of a run of whole NQ chunks. A batch, and the extra fields
+// of its rows, is only built when the stream is read, so the whole segment's
+// field data never has to be alive at once. All batches share the schema of
+// the stream; an empty result streams one empty batch. The caller receives
+// the per-NQ row counts in out_chunk_sizes and must free them with free().
+// Caller owns out_stream and must release it through the Arrow C Stream
+// Interface; c_search_result and c_plan, and the cancellation source when
+// given, must outlive it. cancellation_source may be null; otherwise it must
+// point to a folly::CancellationSource created by NewLoadCancellationSource().
+CStatus
+ExportSearchResultAsArrowStream(CSearchResult c_search_result,
+                                CSearchPlan c_plan,
+                                const int64_t* extra_field_ids,
+                                int64_t num_extra_fields,
+                                struct ArrowArrayStream* out_stream,
+                                int64_t** out_chunk_sizes,
+                                int64_t* out_num_chunks,
+                                void* cancellation_source);
+
 // Fill output fields for multiple segments in a single call, producing
 // results in the specified output order.
 //
@@ -65,6 +86,27 @@ FillOutputFieldsOrdered(CSearchResult* search_results,
                         CProto* out_result,
                         void* cancellation_source);
 
+// Fill the same output fields as FillOutputFieldsOrdered, in the same order,
+// but export them as one Arrow RecordBatch with a column per output field
+// instead of a serialized proto, so neither side has to encode or decode the
+// field data. Every column carries the milvus.field_id and milvus.data_type
+// metadata. Only bool, integer, float, double and string fields have an Arrow
+// form: when an output field of another type is requested, nothing is filled
+// and exported is set to false so the caller can use FillOutputFieldsOrdered.
+// Caller owns out_schema/out_array once exported is true and must release
+// them through the Arrow C Data Interface.
+CStatus
+FillOutputFieldsOrderedAsArrow(CSearchResult* search_results,
+                               int64_t num_search_results,
+                               CSearchPlan c_plan,
+                               const int32_t* result_seg_indices,
+                               const int64_t* result_seg_offsets,
+                               int64_t total_rows,
+                               struct ArrowSchema* out_schema,
+                               struct ArrowArray* out_array,
+                               bool* exported,
+                               void* cancellation_source);
+
 // Run the pre-export phase of reduce across all per-segment SearchResults:
 // filter invalid rows, optionally apply Global Refine (truncate + refine),
 // and fill primary keys. Mutates the passed SearchResults in place; the
@@ -89,6 +131,29 @@ PrepareSearchResultsForExport(CTraceContext c_trace,
                               int64_t* all_search_count,
                               void* cancellation_source);
 
+// Run the whole reduce across all per-segment SearchResults in one call,
+// without exporting them: the pre-export phase of
+// PrepareSearchResultsForExport, then a per-NQ tournament merge of the
+// segments into each slice's top-k that keeps the first row of every PK (of
+// every PK and element index for element-level search), then output field
+// filling as FillOutputFieldsOrdered does. NQs are merged in parallel.
+// Writes the serialized SearchResultData of slice i into out_results[i]; the
+// caller passes num_slices empty CProtos and owns their proto_blob after a
+// successful call. Group-by searches are not supported and fail.
+// Writes the sum of total_data_cnt_ values into all_search_count when non-null.
+CStatus
+ReduceSearchResultsAndFillData(CTraceContext c_trace,
+                               CSearchPlan c_plan,
+                               CPlaceholderGroup c_placeholder_group,
+                               CSearchResult* c_search_results,
+                               int64_t num_segments,
+                               int64_t* slice_nqs,
+                               int64_t num_slices,
+                               int64_t* slice_topKs,
+                               CProto* out_results,
+                               int64_t* all_search_count,
+                               void* cancellation_source);
+
 // Read post-search metadata from a SearchResult in a single CGO call.
 // All four outputs are populated unconditionally:
 //   - has_group_by: true when the plan enabled group-by and the
@@ -96,9 +161,11 @@ PrepareSearchResultsForExport(CTraceContext c_trace,
 //     seg_offsets_/distances_
 //   - group_size: the configured per-group cap (0 when group-by is disabled)
 //   - scanned_remote_bytes / scanned_total_bytes: storage cost accumulated by
-//     the segment search itself, by ExportSearchResultAsArrowRecordBatch when
-//     reading extra fields, and by FillOutputFieldsOrdered during late
-//     materialization. Caller should invoke this after all those phases.
+//     the segment search itself, by ExportSearchResultAsArrowRecordBatch and
+//     the ExportSearchResultAsArrowStream batches when reading extra fields,
+//     and by FillOutputFieldsOrdered and FillOutputFieldsOrderedAsArrow
+//     during late materialization. Caller should invoke this after all those
+//     phases.
 void
 GetSearchResultMetadata(CSearchResult c_search_result,
                         bool* has_group_by,
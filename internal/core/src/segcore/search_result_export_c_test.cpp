@@ -1133,6 +1133,133 @@ TEST(SearchResultExport, ExportSearchResultAsArrowRecordBatch_ExtraFieldIds) {
     EXPECT_EQ(extra_field->name(), "extra_i64");
 }
 
+TEST(SearchResultExport, ExportSearchResultAsArrowStream_BatchesWholeChunks) {
+    using namespace milvus;
+    using namespace milvus::segcore;
+
+    auto schema = std::make_shared<Schema>();
+    auto pk_fid = schema->AddDebugField("pk", DataType::INT64);
+    schema->set_primary_field_id(pk_fid);
+    auto extra_fid = schema->AddDebugField("extra_i64", DataType::INT64);
+    auto vec_fid = schema->AddDebugField(
+        "fakevec", DataType::VECTOR_FLOAT, 16, knowhere::metric::L2);
+
+    const int64_t N = 6000;
+    auto raw_data = DataGen(schema, N, /*seed=*/1);
+    auto segment = CreateSealedWithFieldDataLoaded(schema, raw_data);
+    auto extra_values = raw_data.get_col<int64_t>(extra_fid);
+
+    auto plan_bytes = BuildSimpleVectorSearchPlan(vec_fid, /*topk=*/4096);
+    auto plan = milvus::query::CreateSearchPlanByExpr(
+        schema, plan_bytes.data(), plan_bytes.size());
+
+    // the first NQ fills a batch, the other two share the second one
+    SearchResult sr;
+    sr.total_nq_ = 3;
+    sr.unity_topK_ = 4096;
+    sr.pk_type_ = DataType::INT64;
+    sr.segment_ = segment.get();
+    sr.topk_per_nq_prefix_sum_ = {0, 4096, 4100, 6000};
+    for (int64_t i = 0; i < N; i++) {
+        // descending within every NQ
+        sr.seg_offsets_.push_back(N - 1 - i);
+        sr.distances_.push_back(static_cast<float>(N - i));
+        sr.primary_keys_.push_back(PkType(N - 1 - i));
+    }
+
+    int64_t extra_fields[] = {extra_fid.get()};
+    ArrowArrayStream stream{};
+    int64_t* chunk_sizes = nullptr;
+    int64_t num_chunks = 0;
+    auto status = ExportSearchResultAsArrowStream(
+        reinterpret_cast<CSearchResult>(&sr),
+        reinterpret_cast<CSearchPlan>(plan.get()),
+        extra_fields,
+        1,
+        &stream,
+        &chunk_sizes,
+        &num_chunks,
+        nullptr);
+    [[maybe_unused]] auto chunk_sizes_guard = AdoptChunkSizes(chunk_sizes);
+    ASSERT_EQ(status.error_code, 0) << status.error_msg;
+    ASSERT_EQ(num_chunks, 3);
+    EXPECT_EQ(chunk_sizes[0], 4096);
+    EXPECT_EQ(chunk_sizes[1], 4);
+    EXPECT_EQ(chunk_sizes[2], 1900);
+
+    auto reader_result = arrow::ImportRecordBatchReader(&stream);
+    ASSERT_TRUE(reader_result.ok()) << reader_result.status().ToString();
+    auto reader = *reader_result;
+    ASSERT_EQ(reader->schema()->num_fields(), 4);
+    EXPECT_EQ(reader->schema()->field(3)->name(), "extra_i64");
+
+    std::vector<int64_t> batch_rows;
+    int64_t row = 0;
+    while (true) {
+        auto batch_result = reader->Next();
+        ASSERT_TRUE(batch_result.ok()) << batch_result.status().ToString();
+        auto batch = *batch_result;
+        if (batch == nullptr) {
+            break;
+        }
+        batch_rows.push_back(batch->num_rows());
+        auto ids =
+            std::static_pointer_cast<arrow::Int64Array>(batch->column(0));
+        auto offsets =
+            std::static_pointer_cast<arrow::Int64Array>(batch->column(2));
+        auto extra =
+            std::static_pointer_cast<arrow::Int64Array>(batch->column(3));
+        for (int64_t i = 0; i < batch->num_rows(); i++, row++) {
+            ASSERT_EQ(ids->Value(i), N - 1 - row);
+            ASSERT_EQ(offsets->Value(i), N - 1 - row);
+            ASSERT_EQ(extra->Value(i), extra_values[N - 1 - row]);
+        }
+    }
+    EXPECT_EQ(batch_rows, (std::vector<int64_t>{4096, 1904}));
+    EXPECT_GT(sr.search_storage_cost_.scanned_total_bytes, 0);
+}
+
+TEST(SearchResultExport, ExportSearchResultAsArrowStream_EmptyResult) {
+    auto schema = std::make_shared<Schema>();
+    auto pk_fid = schema->AddDebugField("pk", DataType::INT64);
+    schema->set_primary_field_id(pk_fid);
+    Plan plan(schema);
+    plan.plan_node_ = std::make_unique<VectorPlanNode>();
+
+    SearchResult sr;
+    sr.total_nq_ = 2;
+    sr.unity_topK_ = 0;
+    sr.element_level_ = true;
+
+    ArrowArrayStream stream{};
+    int64_t* chunk_sizes = nullptr;
+    int64_t num_chunks = 0;
+    auto status =
+        ExportSearchResultAsArrowStream(reinterpret_cast<CSearchResult>(&sr),
+                                        reinterpret_cast<CSearchPlan>(&plan),
+                                        nullptr,
+                                        0,
+                                        &stream,
+                                        &chunk_sizes,
+                                        &num_chunks,
+                                        nullptr);
+    [[maybe_unused]] auto chunk_sizes_guard = AdoptChunkSizes(chunk_sizes);
+    ASSERT_EQ(status.error_code, 0) << status.error_msg;
+    ASSERT_EQ(num_chunks, 2);
+    EXPECT_EQ(chunk_sizes[0], 0);
+    EXPECT_EQ(chunk_sizes[1], 0);
+
+    auto reader_result = arrow::ImportRecordBatchReader(&stream);
+    ASSERT_TRUE(reader_result.ok()) << reader_result.status().ToString();
+    auto batches_result = (*reader_result)->ToRecordBatches();
+    ASSERT_TRUE(batches_result.ok()) << batches_result.status().ToString();
+    ASSERT_EQ(batches_result->size(), 1);
+    EXPECT_EQ((*batches_result)[0]->num_rows(), 0);
+    ASSERT_EQ((*batches_result)[0]->num_columns(), 4);
+    EXPECT_EQ((*batches_result)[0]->schema()->field(3)->name(),
+              "$element_indices");
+}
+
 TEST(SearchResultExport, FillOutputFieldsOrdered_Basic) {
     using namespace milvus;
     using namespace milvus::segcore;
@@ -1256,6 +1383,102 @@ TEST(SearchResultExport,
     free(const_cast<void*>(c_proto.proto_blob));
 }
 
+TEST(SearchResultExport, FillOutputFieldsOrderedAsArrow_FollowsRowOrder) {
+    using namespace milvus;
+    using namespace milvus::segcore;
+
+    auto schema = std::make_shared<Schema>();
+    auto pk_fid = schema->AddDebugField("pk", DataType::INT64);
+    schema->set_primary_field_id(pk_fid);
+    auto long_fid = schema->AddDebugField("output_i64", DataType::INT64);
+    auto str_fid = schema->AddDebugField("output_str", DataType::VARCHAR);
+    auto vec_fid = schema->AddDebugField(
+        "fakevec", DataType::VECTOR_FLOAT, 16, knowhere::metric::L2);
+
+    auto raw_data_a = DataGen(schema, 4, /*seed=*/1);
+    auto raw_data_b = DataGen(schema, 4, /*seed=*/2);
+    auto segment_a = CreateSealedWithFieldDataLoaded(schema, raw_data_a);
+    auto segment_b = CreateSealedWithFieldDataLoaded(schema, raw_data_b);
+    auto longs_a = raw_data_a.get_col<int64_t>(long_fid);
+    auto longs_b = raw_data_b.get_col<int64_t>(long_fid);
+    auto strs_a = raw_data_a.get_col<std::string>(str_fid);
+    auto strs_b = raw_data_b.get_col<std::string>(str_fid);
+
+    auto plan_bytes = BuildSimpleVectorSearchPlan(vec_fid, /*topk=*/2);
+    auto plan = milvus::query::CreateSearchPlanByExpr(
+        schema, plan_bytes.data(), plan_bytes.size());
+    plan->target_entries_.push_back(long_fid);
+    plan->target_entries_.push_back(str_fid);
+
+    SearchResult sr_a;
+    sr_a.segment_ = segment_a.get();
+    SearchResult sr_b;
+    sr_b.segment_ = segment_b.get();
+    std::vector<CSearchResult> c_results = {
+        reinterpret_cast<CSearchResult>(&sr_a),
+        reinterpret_cast<CSearchResult>(&sr_b)};
+    int32_t seg_indices[] = {1, 0, 1, 0};
+    int64_t seg_offsets[] = {3, 2, 0, 1};
+
+    ArrowSchema c_schema{};
+    ArrowArray c_array{};
+    bool exported = false;
+    auto status = FillOutputFieldsOrderedAsArrow(
+        c_results.data(),
+        c_results.size(),
+        reinterpret_cast<CSearchPlan>(plan.get()),
+        seg_indices,
+        seg_offsets,
+        /*total_rows=*/4,
+        &c_schema,
+        &c_array,
+        &exported,
+        nullptr);
+    ASSERT_EQ(status.error_code, 0) << status.error_msg;
+    ASSERT_TRUE(exported);
+    auto batch_result = ImportExportedRecordBatch(&c_array, &c_schema);
+    ASSERT_TRUE(batch_result.ok()) << batch_result.status().ToString();
+    auto batch = *batch_result;
+    ASSERT_EQ(batch->num_rows(), 4);
+    ASSERT_EQ(batch->num_columns(), 2);
+    EXPECT_EQ(batch->schema()->field(0)->name(), "output_i64");
+    EXPECT_EQ(batch->schema()->field(0)->metadata()->Get("milvus.field_id"),
+              std::to_string(long_fid.get()));
+    EXPECT_EQ(batch->schema()->field(1)->metadata()->Get("milvus.data_type"),
+              std::to_string(static_cast<int32_t>(DataType::VARCHAR)));
+
+    auto longs = std::static_pointer_cast<arrow::Int64Array>(batch->column(0));
+    auto strs = std::static_pointer_cast<arrow::StringArray>(batch->column(1));
+    EXPECT_EQ(longs->Value(0), longs_b[3]);
+    EXPECT_EQ(longs->Value(1), longs_a[2]);
+    EXPECT_EQ(longs->Value(2), longs_b[0]);
+    EXPECT_EQ(longs->Value(3), longs_a[1]);
+    EXPECT_EQ(strs->GetString(0), strs_b[3]);
+    EXPECT_EQ(strs->GetString(1), strs_a[2]);
+    EXPECT_EQ(strs->GetString(2), strs_b[0]);
+    EXPECT_EQ(strs->GetString(3), strs_a[1]);
+
+    // a vector output field has no Arrow form, nothing is exported
+    plan->target_entries_.push_back(vec_fid);
+    ArrowSchema vec_schema{};
+    ArrowArray vec_array{};
+    status = FillOutputFieldsOrderedAsArrow(
+        c_results.data(),
+        c_results.size(),
+        reinterpret_cast<CSearchPlan>(plan.get()),
+        seg_indices,
+        seg_offsets,
+        /*total_rows=*/4,
+        &vec_schema,
+        &vec_array,
+        &exported,
+        nullptr);
+    ASSERT_EQ(status.error_code, 0) << status.error_msg;
+    EXPECT_FALSE(exported);
+    EXPECT_EQ(vec_schema.release, nullptr);
+    EXPECT_EQ(vec_array.release, nullptr);
+}
+
 // ---------------------------------------------------------------------------
 // PrepareSearchResultsForExport — CGO entry for the pre-export reduce phase
 // (filter invalid rows + optional Global Refine truncate/refine + fill PKs).
@@ -1412,6 +1635,109 @@ TEST(SearchResultExport, PrepareSearchResultsForExport_FillsPrimaryKeys) {
     EXPECT_EQ(sr_b.topk_per_nq_prefix_sum_[1], 3);
 }
 
+TEST(SearchResultExport, ReduceSearchResultsAndFillData_MergesSegments) {
+    using namespace milvus;
+    using namespace milvus::segcore;
+
+    int dim = 16;
+    auto schema = std::make_shared<Schema>();
+    auto pk_fid = schema->AddDebugField("pk", DataType::INT64);
+    schema->set_primary_field_id(pk_fid);
+    auto output_fid = schema->AddDebugField("output_i64", DataType::INT64);
+    auto vec_fid = schema->AddDebugField(
+        "fakevec", DataType::VECTOR_FLOAT, dim, knowhere::metric::L2);
+
+    // both segments hold the same rows, so equal offsets are equal PKs
+    size_t N = 20;
+    auto raw_data = DataGen(schema, N, /*seed=*/1);
+    auto seg_a = CreateSealedWithFieldDataLoaded(schema, raw_data);
+    auto seg_b = CreateSealedWithFieldDataLoaded(schema, raw_data);
+    auto pks = raw_data.get_col<int64_t>(pk_fid);
+    auto outputs = raw_data.get_col<int64_t>(output_fid);
+
+    auto plan_bytes = BuildSimpleVectorSearchPlan(vec_fid, /*topk=*/3);
+    auto plan = milvus::query::CreateSearchPlanByExpr(
+        schema, plan_bytes.data(), plan_bytes.size());
+    plan->target_entries_.push_back(output_fid);
+    auto ph_group_raw = CreatePlaceholderGroup(2, dim, 1024);
+    auto ph_group = milvus::query::ParsePlaceholderGroup(
+        plan.get(), ph_group_raw.SerializeAsString());
+
+    SearchResult sr_a;
+    sr_a.total_nq_ = 2;
+    sr_a.unity_topK_ = 3;
+    sr_a.total_data_cnt_ = N;
+    sr_a.segment_ = seg_a.get();
+    sr_a.seg_offsets_ = {0, 2, 4, 1, INVALID_SEG_OFFSET, INVALID_SEG_OFFSET};
+    sr_a.distances_ = {9.0f, 5.0f, 1.0f, 7.0f, 0.0f, 0.0f};
+
+    SearchResult sr_b;
+    sr_b.total_nq_ = 2;
+    sr_b.unity_topK_ = 3;
+    sr_b.total_data_cnt_ = N;
+    sr_b.segment_ = seg_b.get();
+    sr_b.seg_offsets_ = {
+        2, 3, INVALID_SEG_OFFSET, 5, INVALID_SEG_OFFSET, INVALID_SEG_OFFSET};
+    sr_b.distances_ = {5.0f, 4.0f, 0.0f, 8.0f, 0.0f, 0.0f};
+
+    std::vector<CSearchResult> c_results = {
+        reinterpret_cast<CSearchResult>(&sr_a),
+        reinterpret_cast<CSearchResult>(&sr_b)};
+    // one NQ per slice, the second one asks for its top-1 only
+    int64_t slice_nqs[] = {1, 1};
+    int64_t slice_topks[] = {3, 1};
+    CTraceContext trace{0, 0, 0};
+    CProto c_protos[2] = {};
+    int64_t all_search_count = 0;
+    auto status = ReduceSearchResultsAndFillData(
+        trace,
+        reinterpret_cast<CSearchPlan>(plan.get()),
+        reinterpret_cast<CPlaceholderGroup>(ph_group.get()),
+        c_results.data(),
+        c_results.size(),
+        slice_nqs,
+        /*num_slices=*/2,
+        slice_topks,
+        c_protos,
+        &all_search_count,
+        nullptr);
+    ASSERT_EQ(status.error_code, 0) << status.error_msg;
+    EXPECT_EQ(all_search_count, 2 * N);
+
+    std::vector<milvus::proto::schema::SearchResultData> slices(2);
+    for (int i = 0; i < 2; i++) {
+        ASSERT_TRUE(slices[i].ParseFromArray(c_protos[i].proto_blob,
+                                             c_protos[i].proto_size));
+        free(const_cast<void*>(c_protos[i].proto_blob));
+    }
+
+    // offset 2 of the second segment is a duplicate of the first's
+    auto& first = slices[0];
+    EXPECT_EQ(first.num_queries(), 1);
+    EXPECT_EQ(first.top_k(), 3);
+    ASSERT_EQ(first.topks_size(), 1);
+    EXPECT_EQ(first.topks(0), 3);
+    std::vector<int64_t> expected_offsets = {0, 2, 3};
+    std::vector<float> expected_scores = {9.0f, 5.0f, 4.0f};
+    ASSERT_EQ(first.ids().int_id().data_size(), 3);
+    ASSERT_EQ(first.fields_data_size(), 1);
+    auto& first_outputs = first.fields_data(0).scalars().long_data();
+    ASSERT_EQ(first_outputs.data_size(), 3);
+    for (int i = 0; i < 3; i++) {
+        EXPECT_EQ(first.ids().int_id().data(i), pks[expected_offsets[i]]);
+        EXPECT_FLOAT_EQ(first.scores(i), expected_scores[i]);
+        EXPECT_EQ(first_outputs.data(i), outputs[expected_offsets[i]]);
+    }
+
+    auto& second = slices[1];
+    ASSERT_EQ(second.topks_size(), 1);
+    EXPECT_EQ(second.topks(0), 1);
+    ASSERT_EQ(second.ids().int_id().data_size(), 1);
+    EXPECT_EQ(second.ids().int_id().data(0), pks[5]);
+    EXPECT_FLOAT_EQ(second.scores(0), 8.0f);
+    EXPECT_EQ(second.fields_data(0).scalars().long_data().data(0), outputs[5]);
+}
+
 // ---------------------------------------------------------------------------
 // Global Refine — synthetic-data tests
 //
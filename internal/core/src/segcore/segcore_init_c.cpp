@@ -16,23 +16,43 @@
 #include <mutex>
 #include <string>
 
+#include "bitset/detail/platform/dynamic.h"
 #include "cachinglayer/Manager.h"
 #include "common/EasyAssert.h"
 #include "common/FastMem.h"
 #include "config/ConfigKnowhere.h"
 #include "glog/logging.h"
 #include "log/Log.h"
+#include "monitor/scope_metric.h"
 #include "pthread.h"
 #include "segcore/SegcoreConfig.h"
+#include "segcore/WarmupProfile.h"
 #include "segcore/segcore_init_c.h"
 
 namespace milvus::segcore {
 
 std::once_flag close_glog_once;
 
+// The bitset kernels pick their implementation when the library is loaded,
+// before logging is set up, so it is reported here.
+static void
+ReportBitsetKernels() {
+    auto implementation = bitset::detail::dynamic_implementation();
+    if (bitset::detail::dynamic_implementation_limited_by_build()) {
+        LOG_WARN(
+            "bitset kernels use the {} implementation, the CPU supports SVE "
+            "but this build has no SVE kernels",
+            implementation);
+    } else {
+        LOG_INFO("bitset kernels use the {} implementation", implementation);
+    }
+    monitor::SetBitsetKernelImplementation(implementation);
+}
+
 extern "C" void
 SegcoreInit(const char* conf_file) {
     milvus::config::KnowhereInitImpl(conf_file);
+    ReportBitsetKernels();
 }
 
 // TODO merge small index config into one config map, including enable/disable small_index
@@ -43,6 +63,13 @@ SegcoreSetChunkRows(const int64_t value) {
     config.set_chunk_rows(value);
 }
 
+extern "C" void
+SegcoreSetChunkTargetBytes(const int64_t value) {
+    milvus::segcore::SegcoreConfig& config =
+        milvus::segcore::SegcoreConfig::default_config();
+    config.set_chunk_target_bytes(value);
+}
+
 extern "C" void
 SegcoreSetEnableInterminSegmentIndex(const bool value) {
     milvus::segcore::SegcoreConfig& config =
@@ -136,6 +163,13 @@ SegcoreSetDenseVectorInterminIndexRefineWithQuantFlag(const bool value) {
     config.set_refine_with_quant_flag(value);
 }
 
+extern "C" void
+SegcoreSetEnableAsyncInterimIndexBuild(const bool value) {
+    milvus::segcore::SegcoreConfig& config =
+        milvus::segcore::SegcoreConfig::default_config();
+    config.set_enable_async_interim_index_build(value);
+}
+
 extern "C" void
 SegcoreSetInterimIndexMemExpansionRate(const float value) {
     milvus::segcore::SegcoreConfig& config =
@@ -150,6 +184,13 @@ SegcoreSetMaxGroupByGroups(const int64_t value) {
     config.set_max_group_by_groups(value);
 }
 
+extern "C" void
+SegcoreSetGrowingChunkPoolBytes(const int64_t value) {
+    milvus::segcore::SegcoreConfig& config =
+        milvus::segcore::SegcoreConfig::default_config();
+    config.set_growing_chunk_pool_bytes(value);
+}
+
 extern "C" void
 SegcoreSetSubDim(const int64_t value) {
     milvus::segcore::SegcoreConfig& config =
@@ -312,4 +353,19 @@ UpdateTieredStorageConfig(
          vectorIndexCacheWarmupPolicy});
 }
 
+extern "C" CStatus
+SegcoreInitWarmupProfile(const char* path, const int64_t window_sec) {
+    try {
+        if (window_sec < 0) {
+            return milvus::FailureCStatus(
+                milvus::ConfigInvalid,
+                "warmup profile window must be non-negative");
+        }
+        WarmupProfile::InitGlobal(path, window_sec);
+        return milvus::SuccessCStatus();
+    } catch (std::exception& e) {
+        return milvus::FailureCStatus(&e);
+    }
+}
+
 }  // namespace milvus::segcore
@@ -26,6 +26,9 @@ SegcoreInit(const char*);
 void
 SegcoreSetChunkRows(const int64_t);
 
+void
+SegcoreSetChunkTargetBytes(const int64_t);
+
 void
 SegcoreSetEnableInterminSegmentIndex(const bool);
 
@@ -65,12 +68,18 @@ SegcoreSetDenseVectorInterminIndexRefineQuantType(const char*);
 void
 SegcoreSetDenseVectorInterminIndexRefineWithQuantFlag(const bool);
 
+void
+SegcoreSetEnableAsyncInterimIndexBuild(const bool);
+
 void
 SegcoreSetInterimIndexMemExpansionRate(const float);
 
 void
 SegcoreSetMaxGroupByGroups(const int64_t);
 
+void
+SegcoreSetGrowingChunkPoolBytes(const int64_t);
+
 // return value must be freed by the caller
 char*
 SegcoreSetSimdType(const char*);
@@ -153,6 +162,9 @@ UpdateTieredStorageConfig(const int64_t loading_timeout_ms,
                           const CacheWarmupPolicy scalarIndexCacheWarmupPolicy,
                           const CacheWarmupPolicy vectorIndexCacheWarmupPolicy);
 
+CStatus
+SegcoreInitWarmupProfile(const char* path, const int64_t window_sec);
+
 #ifdef __cplusplus
 }
 #endif
@@ -16,11 +16,13 @@
 #include <folly/ExceptionWrapper.h>
 #include <folly/Try.h>
 #include <folly/futures/Promise.h>
+#include <algorithm>
 #include <cstring>
 #include <exception>
 #include <functional>
 #include <limits>
 #include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -32,6 +34,7 @@
 #include "common/Consts.h"
 #include "common/EasyAssert.h"
 #include "common/LoadInfo.h"
+#include "common/Numa.h"
 #include "common/OpContext.h"
 #include "common/QueryInfo.h"
 #include "common/QueryResult.h"
@@ -49,6 +52,7 @@
 #include "folly/futures/Future.h"
 #include "futures/Executor.h"
 #include "futures/Future.h"
+#include "futures/QueryTaskScheduler.h"
 #include "glog/logging.h"
 #include "index/Meta.h"
 #include "index/json_stats/JsonKeyStats.h"
@@ -71,6 +75,7 @@
 #include "segcore/SegmentGrowingImpl.h"
 #include "segcore/SegmentInterface.h"
 #include "segcore/TextLobSpillover.h"
+#include "segcore/reduce/AggregationReduce.h"
 #include "segcore/SegmentSealed.h"
 #include "segcore/Types.h"
 #include "storage/FileManager.h"
@@ -187,6 +192,55 @@ NewSegmentWithLoadInfo(CCollection collection,
     }
 }
 
+// The NUMA node whose executors load and search `segment`, -1 for the
+// global executors.
+int
+SegmentHomeNode(const milvus::segcore::SegmentInterface* segment) {
+    return milvus::NumaTopology::Get().HomeNode(segment->get_segment_id());
+}
+
+// What a search or retrieve of `query_id` on `segment` runs on, the search
+// executor `search_pool` of its collection when one is set up.
+folly::Executor::KeepAlive<>
+GetQueryExecutor(const milvus::segcore::SegmentInterface* segment,
+                 int64_t query_id,
+                 int64_t deadline_us,
+                 const std::string& search_pool) {
+    auto executor = milvus::futures::getNamedSearchCPUExecutor(search_pool);
+    if (executor == nullptr) {
+        executor =
+            milvus::futures::getSearchCPUExecutor(SegmentHomeNode(segment));
+    }
+    if (!milvus::ENABLE_FAIR_QUERY_SCHEDULING.load()) {
+        return folly::getKeepAliveToken(executor);
+    }
+    return milvus::futures::QueryTaskScheduler::ForExecutor(executor)
+        .GetExecutor(query_id, deadline_us);
+}
+
+// Whether `segment` keeps `field_id` mmapped, labels the api metrics.
+bool
+IsMmapField(const milvus::segcore::SegmentInterface* segment,
+            std::optional<milvus::FieldId> field_id) {
+    auto internal_segment =
+        dynamic_cast<const milvus::segcore::SegmentInternalInterface*>(
+            segment);
+    return internal_segment != nullptr && field_id.has_value() &&
+           internal_segment->is_mmap_field(field_id.value());
+}
+
+// Abandons a search or retrieve whose request deadline passed while it was
+// queued, its caller has given up on it already.
+void
+CheckQueryDeadline(int64_t query_id, int64_t deadline_us) {
+    if (deadline_us > 0 &&
+        milvus::futures::QueryTaskScheduler::NowUs() >= deadline_us) {
+        ThrowInfo(milvus::FollyCancel,
+                  "query {} passed its deadline before it started",
+                  query_id);
+    }
+}
+
 milvus::SchemaPtr
 ParseReopenSchema(const void* schema_blob,
                   const int64_t schema_length,
@@ -222,7 +276,7 @@ AsyncReopenSegment(CTraceContext c_trace,
             static_cast<milvus::segcore::SegmentInterface*>(c_segment);
 
         auto future = milvus::futures::Future<bool>::async(
-            milvus::futures::getLoadCPUExecutor(),
+            milvus::futures::getLoadCPUExecutor(SegmentHomeNode(segment)),
             milvus::futures::ExecutePriority::NORMAL,
             [c_trace,
              segment,
@@ -306,7 +360,7 @@ AsyncSegmentLoad(CTraceContext c_trace, CSegmentInterface c_segment) {
     auto segment = static_cast<milvus::segcore::SegmentInterface*>(c_segment);
 
     auto future = milvus::futures::Future<bool>::async(
-        milvus::futures::getLoadCPUExecutor(),
+        milvus::futures::getLoadCPUExecutor(SegmentHomeNode(segment)),
         milvus::futures::ExecutePriority::NORMAL,
         [c_trace, segment](folly::CancellationToken cancel_token) -> bool* {
             auto trace_ctx = milvus::tracer::TraceContext{
@@ -355,6 +409,17 @@ GetSearchResultValidCount(CSearchResult search_result) {
     return res->valid_count_;
 }
 
+const char*
+GetSearchResultExplainAnalyze(CSearchResult search_result, int64_t* size) {
+    auto res = static_cast<milvus::SearchResult*>(search_result);
+    if (res == nullptr) {
+        *size = 0;
+        return nullptr;
+    }
+    *size = static_cast<int64_t>(res->explain_analyze_.size());
+    return res->explain_analyze_.data();
+}
+
 //////////////////////////////    public C API wrappers    //////////////////////////////
 
 CFuture*  // Future<milvus::SearchResult*>
@@ -367,13 +432,16 @@ AsyncSearch(CTraceContext c_trace,
             uint64_t collection_ttl,
             uint64_t entity_ttl_physical_time_us,
             bool filter_only,
-            bool enable_expr_cache) {
+            bool enable_expr_cache,
+            int64_t query_id,
+            int64_t deadline_us) {
     auto segment = static_cast<milvus::segcore::SegmentInterface*>(c_segment);
     auto plan = static_cast<milvus::query::Plan*>(c_plan);
     auto phg_ptr = reinterpret_cast<const milvus::query::PlaceholderGroup*>(
         c_placeholder_group);
     auto future = milvus::futures::Future<milvus::SearchResult>::async(
-        milvus::futures::getSearchCPUExecutor(),
+        GetQueryExecutor(
+            segment, query_id, deadline_us, plan->search_pool_),
         milvus::futures::ExecutePriority::HIGH,
         [c_trace,
          segment,
@@ -384,7 +452,10 @@ AsyncSearch(CTraceContext c_trace,
          collection_ttl,
          entity_ttl_physical_time_us,
          filter_only,
-         enable_expr_cache](folly::CancellationToken cancel_token) {
+         enable_expr_cache,
+         query_id,
+         deadline_us](folly::CancellationToken cancel_token) {
+            CheckQueryDeadline(query_id, deadline_us);
             // save trace context into search_info
             auto& trace_ctx = plan->plan_node_->search_info_.trace_ctx_;
             trace_ctx.traceID = c_trace.traceID;
@@ -404,6 +475,11 @@ AsyncSearch(CTraceContext c_trace,
             auto internal_segment =
                 static_cast<milvus::segcore::SegmentInternalInterface*>(
                     segment);
+            SCOPE_SEGCORE_API_METRIC(
+                milvus::monitor::SegcoreApi::Search,
+                segment->type(),
+                IsMmapField(segment, target_vector_field_id),
+                milvus::monitor::SegcoreWarmup::None);
             std::unique_ptr<milvus::SearchResult> search_result;
             if (!filter_only &&
                 !internal_segment->FieldAccessible(target_vector_field_id)) {
@@ -439,6 +515,285 @@ AsyncSearch(CTraceContext c_trace,
         static_cast<milvus::futures::IFuture*>(future.release())));
 }
 
+namespace {
+// the results of AsyncSearchWithSharedFilter, one per plan
+using SearchResultBatch = std::vector<std::unique_ptr<milvus::SearchResult>>;
+}  // namespace
+
+CFuture*  // Future<CSearchResultBatch>
+AsyncSearchWithSharedFilter(CTraceContext c_trace,
+                            CSegmentInterface c_segment,
+                            const CSearchPlan* c_plans,
+                            const CPlaceholderGroup* c_placeholder_groups,
+                            int64_t num_plans,
+                            uint64_t timestamp,
+                            int32_t consistency_level,
+                            uint64_t collection_ttl,
+                            uint64_t entity_ttl_physical_time_us,
+                            bool enable_expr_cache,
+                            int64_t query_id,
+                            int64_t deadline_us) {
+    auto segment = static_cast<milvus::segcore::SegmentInterface*>(c_segment);
+    std::vector<milvus::query::Plan*> plans;
+    std::vector<const milvus::query::PlaceholderGroup*> phgs;
+    for (int64_t i = 0; i < num_plans; ++i) {
+        plans.push_back(static_cast<milvus::query::Plan*>(c_plans[i]));
+        phgs.push_back(
+            reinterpret_cast<const milvus::query::PlaceholderGroup*>(
+                c_placeholder_groups[i]));
+    }
+    auto search_pool =
+        plans.empty() ? std::string() : plans.front()->search_pool_;
+    auto future = milvus::futures::Future<SearchResultBatch>::async(
+        GetQueryExecutor(segment, query_id, deadline_us, search_pool),
+        milvus::futures::ExecutePriority::HIGH,
+        [c_trace,
+         segment,
+         plans = std::move(plans),
+         phgs = std::move(phgs),
+         timestamp,
+         consistency_level,
+         collection_ttl,
+         entity_ttl_physical_time_us,
+         enable_expr_cache,
+         query_id,
+         deadline_us](folly::CancellationToken cancel_token) {
+            CheckQueryDeadline(query_id, deadline_us);
+            AssertInfo(!plans.empty(), "search requires at least one plan");
+            for (auto plan : plans) {
+                auto& trace_ctx = plan->plan_node_->search_info_.trace_ctx_;
+                trace_ctx.traceID = c_trace.traceID;
+                trace_ctx.spanID = c_trace.spanID;
+                trace_ctx.traceFlags = c_trace.traceFlags;
+            }
+            auto span = milvus::tracer::StartSpan(
+                "SegCoreSearchWithSharedFilter",
+                &plans[0]->plan_node_->search_info_.trace_ctx_);
+            milvus::tracer::SetRootSpan(span);
+
+            milvus::OpContext op_ctx(cancel_token);
+            auto internal_segment =
+                static_cast<milvus::segcore::SegmentInternalInterface*>(
+                    segment);
+            // a plan whose vector field is not accessible gets an empty
+            // result, as in AsyncSearch
+            std::vector<const milvus::query::Plan*> searched_plans;
+            std::vector<const milvus::query::PlaceholderGroup*> searched_phgs;
+            std::vector<size_t> searched;
+            for (size_t i = 0; i < plans.size(); ++i) {
+                AssertInfo(phgs[i] != nullptr && !phgs[i]->empty(),
+                           "search requires non-empty placeholder group");
+                segment->LazyCheckSchema(plans[i]->schema_, &op_ctx);
+                auto field_id = plans[i]->plan_node_->search_info_.field_id_;
+                if (internal_segment->FieldAccessible(field_id)) {
+                    searched_plans.push_back(plans[i]);
+                    searched_phgs.push_back(phgs[i]);
+                    searched.push_back(i);
+                }
+            }
+            SCOPE_SEGCORE_API_METRIC(
+                milvus::monitor::SegcoreApi::Search,
+                segment->type(),
+                IsMmapField(segment,
+                            plans[0]->plan_node_->search_info_.field_id_),
+                milvus::monitor::SegcoreWarmup::None);
+
+            auto batch = std::make_unique<SearchResultBatch>(plans.size());
+            auto results = internal_segment->SearchWithSharedPrefilter(
+                searched_plans,
+                searched_phgs,
+                timestamp,
+                cancel_token,
+                consistency_level,
+                collection_ttl,
+                entity_ttl_physical_time_us,
+                enable_expr_cache);
+            for (size_t i = 0; i < searched.size(); ++i) {
+                (*batch)[searched[i]] = std::move(results[i]);
+            }
+            for (size_t i = 0; i < plans.size(); ++i) {
+                auto& search_result = (*batch)[i];
+                if (search_result == nullptr) {
+                    search_result = std::make_unique<milvus::SearchResult>();
+                    search_result->total_nq_ =
+                        milvus::query::GetNumOfQueries(phgs[i]);
+                    search_result->unity_topK_ = 0;
+                    search_result->total_data_cnt_ = 0;
+                }
+                if (!milvus::PositivelyRelated(
+                        plans[i]->plan_node_->search_info_.metric_type_)) {
+                    for (auto& dis : search_result->distances_) {
+                        dis *= -1;
+                    }
+                }
+            }
+            span->End();
+            milvus::tracer::CloseRootSpan();
+
+            return batch.release();
+        });
+
+    return static_cast<CFuture*>(static_cast<void*>(
+        static_cast<milvus::futures::IFuture*>(future.release())));
+}
+
+CFuture*  // Future<CSearchResultBatch>
+AsyncSearchSegments(CTraceContext c_trace,
+                    const CSegmentInterface* c_segments,
+                    int64_t num_segments,
+                    CSearchPlan c_plan,
+                    CPlaceholderGroup c_placeholder_group,
+                    uint64_t timestamp,
+                    int32_t consistency_level,
+                    uint64_t collection_ttl,
+                    uint64_t entity_ttl_physical_time_us,
+                    bool enable_expr_cache,
+                    int64_t query_id,
+                    int64_t deadline_us) {
+    std::vector<milvus::segcore::SegmentInterface*> segments;
+    for (int64_t i = 0; i < num_segments; ++i) {
+        segments.push_back(
+            static_cast<milvus::segcore::SegmentInterface*>(c_segments[i]));
+    }
+    auto plan = static_cast<milvus::query::Plan*>(c_plan);
+    auto phg_ptr = reinterpret_cast<const milvus::query::PlaceholderGroup*>(
+        c_placeholder_group);
+    AssertInfo(!segments.empty(), "search requires at least one segment");
+    auto future = milvus::futures::Future<SearchResultBatch>::async(
+        GetQueryExecutor(
+            segments.front(), query_id, deadline_us, plan->search_pool_),
+        milvus::futures::ExecutePriority::HIGH,
+        [c_trace,
+         segments = std::move(segments),
+         plan,
+         phg_ptr,
+         timestamp,
+         consistency_level,
+         collection_ttl,
+         entity_ttl_physical_time_us,
+         enable_expr_cache,
+         query_id,
+         deadline_us](folly::CancellationToken cancel_token) {
+            CheckQueryDeadline(query_id, deadline_us);
+            auto& trace_ctx = plan->plan_node_->search_info_.trace_ctx_;
+            trace_ctx.traceID = c_trace.traceID;
+            trace_ctx.spanID = c_trace.spanID;
+            trace_ctx.traceFlags = c_trace.traceFlags;
+            auto span =
+                milvus::tracer::StartSpan("SegCoreSearchSegments", &trace_ctx);
+            milvus::tracer::SetRootSpan(span);
+            AssertInfo(phg_ptr != nullptr && !phg_ptr->empty(),
+                       "search requires non-empty placeholder group");
+            auto target_vector_field_id =
+                plan->plan_node_->search_info_.field_id_;
+
+            milvus::OpContext op_ctx(cancel_token);
+            auto batch = std::make_unique<SearchResultBatch>(segments.size());
+            std::vector<const milvus::segcore::SegmentGrowingImpl*> growing;
+            std::vector<size_t> growing_ids;
+            for (size_t i = 0; i < segments.size(); ++i) {
+                auto segment = segments[i];
+                segment->LazyCheckSchema(plan->schema_, &op_ctx);
+                auto internal_segment =
+                    static_cast<milvus::segcore::SegmentInternalInterface*>(
+                        segment);
+                // a vector field not accessible gets an empty result, as in
+                // AsyncSearch
+                if (!internal_segment->FieldAccessible(
+                        target_vector_field_id)) {
+                    continue;
+                }
+                auto growing_segment = dynamic_cast<
+                    const milvus::segcore::SegmentGrowingImpl*>(segment);
+                if (growing_segment != nullptr) {
+                    growing.push_back(growing_segment);
+                    growing_ids.push_back(i);
+                    continue;
+                }
+                SCOPE_SEGCORE_API_METRIC(
+                    milvus::monitor::SegcoreApi::Search,
+                    segment->type(),
+                    IsMmapField(segment, target_vector_field_id),
+                    milvus::monitor::SegcoreWarmup::None);
+                (*batch)[i] = segment->Search(plan,
+                                              phg_ptr,
+                                              timestamp,
+                                              cancel_token,
+                                              consistency_level,
+                                              collection_ttl,
+                                              entity_ttl_physical_time_us,
+                                              false,
+                                              enable_expr_cache);
+            }
+            if (!growing.empty()) {
+                SCOPE_SEGCORE_API_METRIC(milvus::monitor::SegcoreApi::Search,
+                                         SegmentType::Growing,
+                                         false,
+                                         milvus::monitor::SegcoreWarmup::None);
+                auto results =
+                    milvus::segcore::SegmentGrowingImpl::SearchSegments(
+                        growing,
+                        plan,
+                        phg_ptr,
+                        timestamp,
+                        cancel_token,
+                        consistency_level,
+                        collection_ttl,
+                        entity_ttl_physical_time_us,
+                        enable_expr_cache);
+                for (size_t i = 0; i < growing.size(); ++i) {
+                    (*batch)[growing_ids[i]] = std::move(results[i]);
+                }
+            }
+            for (auto& search_result : *batch) {
+                if (search_result == nullptr) {
+                    search_result = std::make_unique<milvus::SearchResult>();
+                    search_result->total_nq_ =
+                        milvus::query::GetNumOfQueries(phg_ptr);
+                    search_result->unity_topK_ = 0;
+                    search_result->total_data_cnt_ = 0;
+                }
+                if (!milvus::PositivelyRelated(
+                        plan->plan_node_->search_info_.metric_type_)) {
+                    for (auto& dis : search_result->distances_) {
+                        dis *= -1;
+                    }
+                }
+            }
+            span->End();
+            milvus::tracer::CloseRootSpan();
+
+            return batch.release();
+        });
+
+    return static_cast<CFuture*>(static_cast<void*>(
+        static_cast<milvus::futures::IFuture*>(future.release())));
+}
+
+int64_t
+GetSearchResultBatchSize(CSearchResultBatch batch) {
+    auto results = static_cast<SearchResultBatch*>(batch);
+    return results == nullptr ? 0 : static_cast<int64_t>(results->size());
+}
+
+CSearchResult
+TakeSearchResultFromBatch(CSearchResultBatch batch, int64_t index) {
+    auto results = static_cast<SearchResultBatch*>(batch);
+    if (results == nullptr || index < 0 ||
+        index >= static_cast<int64_t>(results->size())) {
+        return nullptr;
+    }
+    return (*results)[index].release();
+}
+
+void
+DeleteSearchResultBatch(CSearchResultBatch batch) {
+    SCOPE_CGO_CALL_METRIC();
+
+    auto results = static_cast<SearchResultBatch*>(batch);
+    delete results;
+}
+
 void
 DeleteRetrieveResult(CRetrieveResult* retrieve_result) {
     delete[] static_cast<uint8_t*>(
@@ -475,11 +830,14 @@ AsyncRetrieve(CTraceContext c_trace,
               bool ignore_non_pk,
               int32_t consistency_level,
               uint64_t collection_ttl,
-              uint64_t entity_ttl_physical_time_us) {
+              uint64_t entity_ttl_physical_time_us,
+              int64_t query_id,
+              int64_t deadline_us) {
     auto segment = static_cast<milvus::segcore::SegmentInterface*>(c_segment);
     auto plan = static_cast<const milvus::query::RetrievePlan*>(c_plan);
     auto future = milvus::futures::Future<CRetrieveResult>::async(
-        milvus::futures::getSearchCPUExecutor(),
+        GetQueryExecutor(
+            segment, query_id, deadline_us, plan->search_pool_),
         milvus::futures::ExecutePriority::HIGH,
         [c_trace,
          segment,
@@ -489,13 +847,21 @@ AsyncRetrieve(CTraceContext c_trace,
          ignore_non_pk,
          consistency_level,
          collection_ttl,
-         entity_ttl_physical_time_us](folly::CancellationToken cancel_token) {
+         entity_ttl_physical_time_us,
+         query_id,
+         deadline_us](folly::CancellationToken cancel_token) {
+            CheckQueryDeadline(query_id, deadline_us);
             auto trace_ctx = milvus::tracer::TraceContext{
                 c_trace.traceID, c_trace.spanID, c_trace.traceFlags};
             milvus::tracer::AutoSpan span("SegCoreRetrieve", &trace_ctx, true);
 
             milvus::OpContext op_ctx(cancel_token);
             segment->LazyCheckSchema(plan->schema_, &op_ctx);
+            SCOPE_SEGCORE_API_METRIC(
+                milvus::monitor::SegcoreApi::Retrieve,
+                segment->type(),
+                IsMmapField(segment, plan->schema_->get_primary_field_id()),
+                milvus::monitor::SegcoreWarmup::None);
 
             auto retrieve_result =
                 segment->Retrieve(&trace_ctx,
@@ -520,15 +886,19 @@ AsyncRetrieveByOffsets(CTraceContext c_trace,
                        CSegmentInterface c_segment,
                        CRetrievePlan c_plan,
                        int64_t* offsets,
-                       int64_t len) {
+                       int64_t len,
+                       int64_t query_id,
+                       int64_t deadline_us) {
     auto segment = static_cast<milvus::segcore::SegmentInterface*>(c_segment);
     auto plan = static_cast<const milvus::query::RetrievePlan*>(c_plan);
 
     auto future = milvus::futures::Future<CRetrieveResult>::async(
-        milvus::futures::getSearchCPUExecutor(),
+        GetQueryExecutor(
+            segment, query_id, deadline_us, plan->search_pool_),
         milvus::futures::ExecutePriority::HIGH,
-        [c_trace, segment, plan, offsets, len](
+        [c_trace, segment, plan, offsets, len, query_id, deadline_us](
             folly::CancellationToken cancel_token) {
+            CheckQueryDeadline(query_id, deadline_us);
             auto trace_ctx = milvus::tracer::TraceContext{
                 c_trace.traceID, c_trace.spanID, c_trace.traceFlags};
             milvus::tracer::AutoSpan span(
@@ -536,6 +906,11 @@ AsyncRetrieveByOffsets(CTraceContext c_trace,
 
             milvus::OpContext op_ctx(cancel_token);
             segment->LazyCheckSchema(plan->schema_, &op_ctx);
+            SCOPE_SEGCORE_API_METRIC(
+                milvus::monitor::SegcoreApi::Retrieve,
+                segment->type(),
+                IsMmapField(segment, plan->schema_->get_primary_field_id()),
+                milvus::monitor::SegcoreWarmup::None);
 
             auto retrieve_result =
                 segment->Retrieve(&trace_ctx, plan, offsets, len, cancel_token);
@@ -547,6 +922,48 @@ AsyncRetrieveByOffsets(CTraceContext c_trace,
         static_cast<milvus::futures::IFuture*>(future.release())));
 }
 
+bool
+CanMergeAggregationRetrieveResults(CRetrievePlan c_plan) {
+    auto plan = static_cast<const milvus::query::RetrievePlan*>(c_plan);
+    return milvus::segcore::CanMergeAggregationRetrieveResults(*plan);
+}
+
+CStatus
+MergeAggregationRetrieveResults(CRetrievePlan c_plan,
+                                const CRetrieveResult* results,
+                                int64_t num_results,
+                                int64_t parallelism,
+                                CRetrieveResult** merged) {
+    SCOPE_CGO_CALL_METRIC();
+
+    try {
+        auto plan = static_cast<const milvus::query::RetrievePlan*>(c_plan);
+        std::vector<milvus::proto::segcore::RetrieveResults> partials(
+            num_results);
+        for (int64_t i = 0; i < num_results; i++) {
+            AssertInfo(partials[i].ParsePartialFromArray(
+                           results[i].proto_blob, results[i].proto_size),
+                       "failed to parse the {}-th retrieve result",
+                       i);
+        }
+        auto executor =
+            milvus::futures::getNamedSearchCPUExecutor(plan->search_pool_);
+        if (executor == nullptr) {
+            executor = milvus::futures::getSearchCPUExecutor();
+        }
+        auto result = milvus::segcore::MergeAggregationRetrieveResults(
+            *plan,
+            partials,
+            static_cast<int32_t>(std::clamp<int64_t>(
+                parallelism, 1, std::numeric_limits<int32_t>::max())),
+            executor);
+        *merged = CreateLeakedCRetrieveResultFromProto(std::move(result));
+        return milvus::SuccessCStatus();
+    } catch (std::exception& e) {
+        return milvus::FailureCStatus(&e);
+    }
+}
+
 int64_t
 GetMemoryUsageInBytes(CSegmentInterface c_segment) {
     SCOPE_CGO_CALL_METRIC();
@@ -621,6 +1038,10 @@ Insert(CSegmentInterface c_segment,
                    "insert data length ({}) exceeds max int",
                    data_info_len);
         auto segment = static_cast<milvus::segcore::SegmentGrowing*>(c_segment);
+        SCOPE_SEGCORE_API_METRIC(milvus::monitor::SegcoreApi::Insert,
+                                 segment->type(),
+                                 false,
+                                 milvus::monitor::SegcoreWarmup::None);
         auto insert_record_proto =
             std::make_unique<milvus::InsertRecordProto>();
         auto suc =
@@ -660,6 +1081,10 @@ Delete(CSegmentInterface c_segment,
     SCOPE_CGO_CALL_METRIC();
 
     auto segment = static_cast<milvus::segcore::SegmentInterface*>(c_segment);
+    SCOPE_SEGCORE_API_METRIC(milvus::monitor::SegcoreApi::Delete,
+                             segment->type(),
+                             false,
+                             milvus::monitor::SegcoreWarmup::None);
     auto pks = std::make_unique<milvus::proto::schema::IDs>();
     auto suc = pks->ParseFromArray(ids, ids_size);
     AssertInfo(suc, "failed to parse pks from ids");
@@ -682,6 +1107,17 @@ LoadFieldData(CSegmentInterface c_segment,
             reinterpret_cast<milvus::segcore::SegmentInterface*>(c_segment);
         AssertInfo(segment != nullptr, "segment conversion failed");
         auto load_info = (LoadFieldDataInfo*)c_load_field_data_info;
+        bool mmap = false;
+        std::string_view warmup_policy;
+        for (const auto& [_, field_info] : load_info->field_infos) {
+            mmap = mmap || field_info.enable_mmap;
+            warmup_policy = field_info.warmup_policy;
+        }
+        SCOPE_SEGCORE_API_METRIC(
+            milvus::monitor::SegcoreApi::LoadFieldData,
+            segment->type(),
+            mmap,
+            milvus::monitor::ParseSegcoreWarmup(warmup_policy));
         segment->LoadFieldData(*load_info);
         return milvus::SuccessCStatus();
     } catch (std::exception& e) {
@@ -725,6 +1161,12 @@ UpdateSealedSegmentIndex(CSegmentInterface c_segment,
         AssertInfo(segment != nullptr, "segment conversion failed");
         auto load_index_info =
             static_cast<milvus::segcore::LoadIndexInfo*>(c_load_index_info);
+        SCOPE_SEGCORE_API_METRIC(
+            milvus::monitor::SegcoreApi::LoadIndex,
+            segment->type(),
+            load_index_info->enable_mmap,
+            milvus::monitor::ParseSegcoreWarmup(
+                load_index_info->warmup_policy));
         segment->LoadIndex(*load_index_info);
         return milvus::SuccessCStatus();
     } catch (std::exception& e) {
@@ -1282,6 +1724,71 @@ BuildSparseFloatVectorArrayForChunk(const FieldInfo& field_info,
     return builder.Finish();
 }
 
+// build the arrow validity bitmap of the rows [offset, offset + num_rows)
+// from the validity of the growing segment in one pass, nullptr when the
+// field has no ValidData
+arrow::Status
+BuildValidityBitmap(const milvus::segcore::ThreadSafeValidDataPtr& valid_data,
+                    int64_t offset,
+                    int64_t num_rows,
+                    std::shared_ptr<arrow::Buffer>* null_bitmap,
+                    int64_t* null_count) {
+    *null_bitmap = nullptr;
+    *null_count = 0;
+    if (!valid_data || num_rows == 0) {
+        return arrow::Status::OK();
+    }
+    const bool* valid = valid_data->get_data_range(offset, num_rows);
+    ARROW_ASSIGN_OR_RAISE(auto bitmap_buffer,
+                          arrow::AllocateBuffer((num_rows + 7) / 8));
+    uint8_t* dst = bitmap_buffer->mutable_data();
+    std::memset(dst, 0, bitmap_buffer->size());
+    int64_t valid_count = 0;
+    for (int64_t i = 0; i < num_rows; i++) {
+        dst[i >> 3] |= static_cast<uint8_t>(valid[i]) << (i & 7);
+        valid_count += valid[i];
+    }
+    *null_count = num_rows - valid_count;
+    *null_bitmap = std::move(bitmap_buffer);
+    return arrow::Status::OK();
+}
+
+// Build a string or binary array of the rows [offset, offset + num_rows),
+// `view(offset)` gives the bytes of a valid row. The views are taken in a
+// first pass so the value bytes are reserved once rather than grown row by
+// row.
+template <typename BuilderType, typename ViewFn>
+arrow::Result<std::shared_ptr<arrow::Array>>
+BuildBinaryArrayForChunk(
+    int64_t offset,
+    int64_t num_rows,
+    const milvus::segcore::ThreadSafeValidDataPtr& valid_data,
+    ViewFn&& view) {
+    const bool* valid =
+        valid_data && num_rows > 0
+            ? valid_data->get_data_range(offset, num_rows)
+            : nullptr;
+    std::vector<std::string_view> views(num_rows);
+    int64_t data_size = 0;
+    for (int64_t i = 0; i < num_rows; i++) {
+        if (valid == nullptr || valid[i]) {
+            views[i] = view(offset + i);
+            data_size += views[i].size();
+        }
+    }
+    BuilderType builder;
+    ARROW_RETURN_NOT_OK(builder.Reserve(num_rows));
+    ARROW_RETURN_NOT_OK(builder.ReserveData(data_size));
+    for (int64_t i = 0; i < num_rows; i++) {
+        if (valid == nullptr || valid[i]) {
+            builder.UnsafeAppend(views[i]);
+        } else {
+            builder.UnsafeAppendNull();
+        }
+    }
+    return builder.Finish();
+}
+
 // build Arrow Array for a single chunk of fixed-size data (zero-copy when possible)
 // this wraps the chunk data directly without copying
 template <typename ArrayType>
@@ -1296,26 +1803,10 @@ WrapChunkAsArrowArray(const void* chunk_data,
         static_cast<const uint8_t*>(chunk_data), num_rows * element_size);
 
     // build validity bitmap if needed
-    std::shared_ptr<arrow::Buffer> null_bitmap = nullptr;
+    std::shared_ptr<arrow::Buffer> null_bitmap;
     int64_t null_count = 0;
-
-    if (valid_data) {
-        int64_t bitmap_bytes = (num_rows + 7) / 8;
-        ARROW_ASSIGN_OR_RAISE(auto bitmap_buffer,
-                              arrow::AllocateBuffer(bitmap_bytes));
-        uint8_t* dst = bitmap_buffer->mutable_data();
-        std::memset(dst, 0, bitmap_bytes);
-
-        for (int64_t i = 0; i < num_rows; i++) {
-            bool is_valid = valid_data->is_valid(validity_offset + i);
-            if (is_valid) {
-                dst[i / 8] |= (1 << (i % 8));
-            } else {
-                null_count++;
-            }
-        }
-        null_bitmap = std::move(bitmap_buffer);
-    }
+    ARROW_RETURN_NOT_OK(BuildValidityBitmap(
+        valid_data, validity_offset, num_rows, &null_bitmap, &null_count));
 
     return std::make_shared<ArrayType>(
         num_rows, data_buffer, null_bitmap, null_count);
@@ -1335,26 +1826,10 @@ WrapChunkAsFixedSizeBinaryArray(
         static_cast<const uint8_t*>(chunk_data), num_rows * byte_width);
 
     // build validity bitmap if needed
-    std::shared_ptr<arrow::Buffer> null_bitmap = nullptr;
+    std::shared_ptr<arrow::Buffer> null_bitmap;
     int64_t null_count = 0;
-
-    if (valid_data) {
-        int64_t bitmap_bytes = (num_rows + 7) / 8;
-        ARROW_ASSIGN_OR_RAISE(auto bitmap_buffer,
-                              arrow::AllocateBuffer(bitmap_bytes));
-        uint8_t* dst = bitmap_buffer->mutable_data();
-        std::memset(dst, 0, bitmap_bytes);
-
-        for (int64_t i = 0; i < num_rows; i++) {
-            bool is_valid = valid_data->is_valid(validity_offset + i);
-            if (is_valid) {
-                dst[i / 8] |= (1 << (i % 8));
-            } else {
-                null_count++;
-            }
-        }
-        null_bitmap = std::move(bitmap_buffer);
-    }
+    ARROW_RETURN_NOT_OK(BuildValidityBitmap(
+        valid_data, validity_offset, num_rows, &null_bitmap, &null_count));
 
     return std::make_shared<arrow::FixedSizeBinaryArray>(
         data_type, num_rows, data_buffer, null_bitmap, null_count);
@@ -1367,21 +1842,10 @@ BuildStringArrayForChunk(
     int64_t start_offset,
     int64_t num_rows,
     const milvus::segcore::ThreadSafeValidDataPtr& valid_data) {
-    arrow::StringBuilder builder;
-    ARROW_RETURN_NOT_OK(builder.Reserve(num_rows));
-
-    for (int64_t i = 0; i < num_rows; i++) {
-        int64_t offset = start_offset + i;
-        if (valid_data && !valid_data->is_valid(offset)) {
-            ARROW_RETURN_NOT_OK(builder.AppendNull());
-        } else {
-            auto str_view = string_vec->view_element(offset);
-            ARROW_RETURN_NOT_OK(
-                builder.Append(str_view.data(), str_view.length()));
-        }
-    }
-
-    return builder.Finish();
+    return BuildBinaryArrayForChunk<arrow::StringBuilder>(
+        start_offset, num_rows, valid_data, [string_vec](int64_t offset) {
+            return string_vec->view_element(offset);
+        });
 }
 
 // build TEXT array for a chunk when spillover is enabled
@@ -1484,19 +1948,24 @@ BuildBoolArrayForChunk(
     int64_t num_rows,
     const milvus::segcore::ThreadSafeValidDataPtr& valid_data,
     int64_t validity_offset) {
+    // arrow packs booleans into bits, growing segments keep a byte per row
     const uint8_t* bool_data = static_cast<const uint8_t*>(chunk_data);
-    arrow::BooleanBuilder builder;
-    ARROW_RETURN_NOT_OK(builder.Reserve(num_rows));
-
+    ARROW_ASSIGN_OR_RAISE(auto values_buffer,
+                          arrow::AllocateBuffer((num_rows + 7) / 8));
+    uint8_t* dst = values_buffer->mutable_data();
+    std::memset(dst, 0, values_buffer->size());
     for (int64_t i = 0; i < num_rows; i++) {
-        if (valid_data && !valid_data->is_valid(validity_offset + i)) {
-            ARROW_RETURN_NOT_OK(builder.AppendNull());
-        } else {
-            ARROW_RETURN_NOT_OK(builder.Append(bool_data[i] != 0));
-        }
+        dst[i >> 3] |= static_cast<uint8_t>(bool_data[i] != 0) << (i & 7);
     }
 
-    return builder.Finish();
+    std::shared_ptr<arrow::Buffer> null_bitmap;
+    int64_t null_count = 0;
+    ARROW_RETURN_NOT_OK(BuildValidityBitmap(
+        valid_data, validity_offset, num_rows, &null_bitmap, &null_count));
+    return std::make_shared<arrow::BooleanArray>(num_rows,
+                                                 std::move(values_buffer),
+                                                 null_bitmap,
+                                                 null_count);
 }
 
 // build Arrow Array for a single chunk based on data type
@@ -1612,19 +2081,13 @@ BuildArrayForChunk(const FieldInfo& field_info,
                 return arrow::Status::Invalid(
                     "Expected ConcurrentVector<Json>");
             }
-            arrow::BinaryBuilder builder;
-            ARROW_RETURN_NOT_OK(builder.Reserve(num_rows));
-            for (int64_t i = 0; i < num_rows; i++) {
-                int64_t offset = global_offset + i;
-                if (field_info.valid_data &&
-                    !field_info.valid_data->is_valid(offset)) {
-                    ARROW_RETURN_NOT_OK(builder.AppendNull());
-                } else {
-                    auto sv = json_vec->view_element(offset);
-                    ARROW_RETURN_NOT_OK(builder.Append(sv.data(), sv.length()));
-                }
-            }
-            return builder.Finish();
+            return BuildBinaryArrayForChunk<arrow::BinaryBuilder>(
+                global_offset,
+                num_rows,
+                field_info.valid_data,
+                [json_vec](int64_t offset) {
+                    return json_vec->view_element(offset);
+                });
         }
 
         case milvus::DataType::ARRAY: {
@@ -1661,19 +2124,13 @@ BuildArrayForChunk(const FieldInfo& field_info,
                 return arrow::Status::Invalid(
                     "Expected ConcurrentVector<std::string> for GEOMETRY");
             }
-            arrow::BinaryBuilder builder;
-            ARROW_RETURN_NOT_OK(builder.Reserve(num_rows));
-            for (int64_t i = 0; i < num_rows; i++) {
-                int64_t offset = global_offset + i;
-                if (field_info.valid_data &&
-                    !field_info.valid_data->is_valid(offset)) {
-                    ARROW_RETURN_NOT_OK(builder.AppendNull());
-                } else {
-                    auto wkb = geometry_vec->view_element(offset);
-                    ARROW_RETURN_NOT_OK(builder.Append(wkb.data(), wkb.size()));
-                }
-            }
-            return builder.Finish();
+            return BuildBinaryArrayForChunk<arrow::BinaryBuilder>(
+                global_offset,
+                num_rows,
+                field_info.valid_data,
+                [geometry_vec](int64_t offset) {
+                    return geometry_vec->view_element(offset);
+                });
         }
 
         case milvus::DataType::VECTOR_FLOAT:
@@ -27,6 +27,7 @@ extern "C" {
 #include "segcore/plan_c.h"
 
 typedef void* CSearchResult;
+typedef void* CSearchResultBatch;
 typedef CProto CRetrieveResult;
 
 //////////////////////////////    common interfaces    //////////////////////////////
@@ -157,6 +158,16 @@ DeleteSearchResult(CSearchResult search_result);
 int64_t
 GetSearchResultValidCount(CSearchResult search_result);
 
+/**
+ * @brief Get the EXPLAIN ANALYZE text of a search result
+ * @param search_result: The search result of one segment
+ * @param size: Set to the size of the text
+ * @return the text, owned by the search result; empty unless the plan asked
+ * for explain_analyze
+ */
+const char*
+GetSearchResultExplainAnalyze(CSearchResult search_result, int64_t* size);
+
 /**
  * @brief Execute search on a segment
  *
@@ -181,7 +192,72 @@ AsyncSearch(CTraceContext c_trace,
             uint64_t collection_ttl,
             uint64_t entity_ttl_physical_time_us,
             bool filter_only,
-            bool enable_expr_cache);
+            bool enable_expr_cache,
+            int64_t query_id,
+            int64_t deadline_us);
+
+/**
+ * @brief Execute the sub-requests of a hybrid search on a segment
+ *
+ * The i-th plan searches the i-th placeholder group. Plans carrying the same
+ * filter evaluate it and the MVCC masks once for all of them.
+ *
+ * @param c_plans: num_plans search plans
+ * @param c_placeholder_groups: num_plans placeholder groups
+ * @return CFuture* Future that resolves to a CSearchResultBatch holding one
+ *         SearchResult per plan, in order
+ */
+CFuture*  // Future<CSearchResultBatch>
+AsyncSearchWithSharedFilter(CTraceContext c_trace,
+                            CSegmentInterface c_segment,
+                            const CSearchPlan* c_plans,
+                            const CPlaceholderGroup* c_placeholder_groups,
+                            int64_t num_plans,
+                            uint64_t timestamp,
+                            int32_t consistency_level,
+                            uint64_t collection_ttl,
+                            uint64_t entity_ttl_physical_time_us,
+                            bool enable_expr_cache,
+                            int64_t query_id,
+                            int64_t deadline_us);
+
+/**
+ * @brief Execute one search on several segments of a collection
+ *
+ * Growing segments small enough to have no interim index are searched
+ * together, their raw vectors scanned as one segment by a single brute
+ * force pass, the other segments are searched one by one as by AsyncSearch.
+ *
+ * @param c_segments: num_segments segments of the collection of c_plan
+ * @return CFuture* Future that resolves to a CSearchResultBatch holding one
+ *         SearchResult per segment, in order
+ */
+CFuture*  // Future<CSearchResultBatch>
+AsyncSearchSegments(CTraceContext c_trace,
+                    const CSegmentInterface* c_segments,
+                    int64_t num_segments,
+                    CSearchPlan c_plan,
+                    CPlaceholderGroup c_placeholder_group,
+                    uint64_t timestamp,
+                    int32_t consistency_level,
+                    uint64_t collection_ttl,
+                    uint64_t entity_ttl_physical_time_us,
+                    bool enable_expr_cache,
+                    int64_t query_id,
+                    int64_t deadline_us);
+
+int64_t
+GetSearchResultBatchSize(CSearchResultBatch batch);
+
+/**
+ * @brief Take the search result of the index-th plan out of the batch, the
+ * caller releases it with DeleteSearchResult
+ */
+CSearchResult
+TakeSearchResultFromBatch(CSearchResultBatch batch, int64_t index);
+
+void
+DeleteSearchResultBatch(CSearchResultBatch batch);
 
 void
 DeleteRetrieveResult(CRetrieveResult* retrieve_result);
@@ -195,14 +271,39 @@ AsyncRetrieve(CTraceContext c_trace,
               bool ignore_non_pk,
               int32_t consistency_level,
               uint64_t collection_ttl,
-              uint64_t entity_ttl_physical_time_us);
+              uint64_t entity_ttl_physical_time_us,
+              int64_t query_id,
+              int64_t deadline_us);
 
 CFuture*  // Future<CRetrieveResult>
 AsyncRetrieveByOffsets(CTraceContext c_trace,
                        CSegmentInterface c_segment,
                        CRetrievePlan c_plan,
                        int64_t* offsets,
-                       int64_t len);
+                       int64_t len,
+                       int64_t query_id,
+                       int64_t deadline_us);
+
+/**
+ * @brief Whether MergeAggregationRetrieveResults can merge the retrieve
+ * results of `c_plan`.
+ */
+bool
+CanMergeAggregationRetrieveResults(CRetrievePlan c_plan);
+
+/**
+ * @brief Merge the retrieve results of one GROUP BY plan on several segments
+ * into one result of the same layout, so the node hands the reducer one
+ * partial instead of one per segment. The groups are hash partitioned and
+ * merged on up to `parallelism` threads. The inputs stay with the caller,
+ * `merged` is released with DeleteRetrieveResult.
+ */
+CStatus
+MergeAggregationRetrieveResults(CRetrievePlan c_plan,
+                                const CRetrieveResult* results,
+                                int64_t num_results,
+                                int64_t parallelism,
+                                CRetrieveResult** merged);
 
 int64_t
 GetMemoryUsageInBytes(CSegmentInterface c_segment);
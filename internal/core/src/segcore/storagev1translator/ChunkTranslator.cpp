@@ -11,6 +11,7 @@
 
 #include "segcore/storagev1translator/ChunkTranslator.h"
 
+#include <chrono>
 #include <filesystem>
 #include <memory>
 #include <string>
@@ -76,7 +77,8 @@ ChunkTranslator::ChunkTranslator(
     bool use_mmap,
     bool mmap_populate,
     milvus::proto::common::LoadPriority load_priority,
-    const std::string& warmup_policy)
+    const std::string& warmup_policy,
+    bool pack_int_chunks)
     : segment_id_(segment_id),
       field_id_(field_data_info.field_id),
       field_meta_(field_meta),
@@ -98,7 +100,8 @@ ChunkTranslator::ChunkTranslator(
                 /* is_index */ false,
                 /* in_load_list*/ field_data_info.in_load_list),
             /* support_eviction */ true),
-      load_priority_(load_priority) {
+      load_priority_(load_priority),
+      pack_int_chunks_(pack_int_chunks) {
     AssertInfo(!SystemProperty::Instance().IsSystem(FieldId(field_id_)),
                "ChunkTranslator not supported for system field");
     meta_.num_rows_until_chunk_.push_back(0);
@@ -161,6 +164,7 @@ ChunkTranslator::get_cells(
         std::pair<milvus::cachinglayer::cid_t, std::unique_ptr<milvus::Chunk>>>
         cells;
     cells.reserve(cids.size());
+    auto start = std::chrono::steady_clock::now();
 
     std::vector<std::string> remote_files;
     remote_files.reserve(cids.size());
@@ -186,9 +190,10 @@ ChunkTranslator::get_cells(
             // this relies on the fact that channel is blocked when there is no data to pop
             bool popped = channel->pop(r);
             AssertInfo(popped, "failed to pop arrow reader from channel");
-            arrow::ArrayVector array_vec =
-                read_single_column_batches(r->reader);
-            chunk = create_chunk(field_meta_, array_vec);
+            chunk = create_chunk(field_meta_, *r);
+            if (pack_int_chunks_) {
+                chunk = pack_int_chunk(field_meta_, std::move(chunk));
+            }
         } else {
             // we don't know the resulting file size beforehand, thus using a separate file for each chunk.
             auto filepath =
@@ -206,17 +211,29 @@ ChunkTranslator::get_cells(
             std::shared_ptr<milvus::ArrowDataWrapper> r;
             bool popped = channel->pop(r);
             AssertInfo(popped, "failed to pop arrow reader from channel");
-            arrow::ArrayVector array_vec =
-                read_single_column_batches(r->reader);
             chunk = create_chunk(field_meta_,
-                                 array_vec,
+                                 *r,
                                  mmap_populate_,
                                  filepath.string(),
                                  load_priority_);
+            if (pack_int_chunks_) {
+                chunk = pack_int_chunk(field_meta_,
+                                       std::move(chunk),
+                                       mmap_populate_,
+                                       filepath.string(),
+                                       load_priority_);
+            }
+            advise_chunk_access(field_meta_, *chunk);
         }
         cells.emplace_back(cid, std::move(chunk));
     }
 
+    int64_t num_bytes = 0;
+    for (auto cid : cids) {
+        auto usage = estimated_byte_size_of_cell(cid).first;
+        num_bytes += usage.memory_bytes + usage.file_bytes;
+    }
+    RecordCellLoad(CellLoadTranslator::CHUNK, cells.size(), num_bytes, start);
     return cells;
 }
 
@@ -66,7 +66,8 @@ class ChunkTranslator : public milvus::cachinglayer::Translator<milvus::Chunk> {
                     bool use_mmap,
                     bool mmap_populate,
                     milvus::proto::common::LoadPriority load_priority,
-                    const std::string& warmup_policy);
+                    const std::string& warmup_policy,
+                    bool pack_int_chunks = false);
 
     size_t
     num_cells() const override;
@@ -111,6 +112,8 @@ class ChunkTranslator : public milvus::cachinglayer::Translator<milvus::Chunk> {
     std::string mmap_dir_path_;
     milvus::proto::common::LoadPriority load_priority_{
         milvus::proto::common::LoadPriority::HIGH};
+    // re-encode integer chunks with pack_int_chunk
+    bool pack_int_chunks_;
 };
 
 }  // namespace milvus::segcore::storagev1translator
@@ -212,13 +212,7 @@ std::pair<milvus::cachinglayer::ResourceUsage,
           milvus::cachinglayer::ResourceUsage>
 DefaultValueChunkTranslator::estimated_byte_size_of_cell(
     milvus::cachinglayer::cid_t cid) const {
-    // TODO: actually only the first cell is used, other cells share the same buffer,
-    // but for now we estimate the same size for all cells
-    auto value_size = this->value_size();
-    auto rows_begin = meta_.num_rows_until_chunk_[cid];
-    auto rows_end = meta_.num_rows_until_chunk_[cid + 1];
-    auto rows = rows_end - rows_begin;
-    auto cell_bytes = value_size * rows;
+    auto cell_bytes = static_cast<int64_t>(charged_size_of_cell(cid));
     if (use_mmap_) {
         return {{0, cell_bytes}, {0, 0}};
     } else {
@@ -231,6 +225,24 @@ DefaultValueChunkTranslator::key() const {
     return key_;
 }
 
+size_t
+DefaultValueChunkTranslator::charged_size_of_cell(
+    milvus::cachinglayer::cid_t cid) const {
+    // The cells share the primary and the tail buffers, built once, so the
+    // first cell and the tail cell carry them; a cell itself only holds its
+    // parsed validity when the field is nullable.
+    auto rows = meta_.num_rows_until_chunk_[cid + 1] -
+                meta_.num_rows_until_chunk_[cid];
+    size_t size = field_meta_.is_nullable() ? rows : 0;
+    if (cid == 0 && primary_buffer_.has_value()) {
+        size += primary_buffer_->size;
+    }
+    if (cid + 1 == num_cells() && tail_buffer_.has_value()) {
+        size += tail_buffer_->size;
+    }
+    return size;
+}
+
 milvus::ChunkBuffer
 DefaultValueChunkTranslator::build_buffer_for_rows(
     int64_t num_rows, const std::string& suffix) const {
@@ -323,6 +335,7 @@ DefaultValueChunkTranslator::get_cells(
                     field_meta_, primary_buffer_.value(), 0);
             }
         }
+        chunk->MarkConstant(charged_size_of_cell(cid));
         res.emplace_back(cid, std::move(chunk));
     }
 
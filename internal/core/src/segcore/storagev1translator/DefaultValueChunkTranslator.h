@@ -78,6 +78,11 @@ class DefaultValueChunkTranslator
     milvus::ChunkBuffer
     build_buffer_for_rows(int64_t num_rows, const std::string& suffix) const;
 
+    // Bytes a cell charges for its chunk, the shared buffers are charged
+    // once, to the first and to the tail cell.
+    size_t
+    charged_size_of_cell(milvus::cachinglayer::cid_t cid) const;
+
     // total rows of this field in the segment
     int64_t total_rows_{0};
 
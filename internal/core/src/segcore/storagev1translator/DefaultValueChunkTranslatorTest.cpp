@@ -575,18 +575,30 @@ TEST_P(DefaultValueChunkTranslatorTest, TestEstimatedByteSizeMultipleCells) {
     auto translator = std::make_unique<DefaultValueChunkTranslator>(
         segment_id_, field_meta, field_data_info, use_mmap, true);
 
+    // the cells share one buffer, which only the first cell charges
     size_t num_cells = translator->num_cells();
-    if (num_cells > 1) {
-        for (size_t i = 0; i < num_cells; ++i) {
-            auto [usage, peak_usage] =
-                translator->estimated_byte_size_of_cell(i);
-            if (use_mmap) {
-                EXPECT_GT(usage.file_bytes, 0);
-            } else {
-                EXPECT_GT(usage.memory_bytes, 0);
-            }
+    ASSERT_GT(num_cells, 1);
+    for (size_t i = 0; i < num_cells; ++i) {
+        auto [usage, peak_usage] = translator->estimated_byte_size_of_cell(i);
+        auto bytes = use_mmap ? usage.file_bytes : usage.memory_bytes;
+        if (i == 0) {
+            EXPECT_GT(bytes, 0);
+            EXPECT_LE(bytes, DefaultValueChunkTranslator::kTargetCellBytes);
+        } else {
+            EXPECT_EQ(bytes, 0);
         }
     }
+
+    std::vector<cachinglayer::cid_t> cids = {0, 1};
+    auto cells = translator->get_cells(nullptr, cids);
+    ASSERT_EQ(cells.size(), 2);
+    for (auto& [cid, chunk] : cells) {
+        EXPECT_TRUE(chunk->IsConstant());
+        auto [usage, peak_usage] = translator->estimated_byte_size_of_cell(cid);
+        auto charged = chunk->CellByteSize();
+        EXPECT_EQ(charged.memory_bytes, usage.memory_bytes);
+        EXPECT_EQ(charged.file_bytes, usage.file_bytes);
+    }
 }
 
 // Parameterized test with both mmap modes
@@ -1,5 +1,6 @@
 #include "segcore/storagev1translator/SealedIndexTranslator.h"
 
+#include <chrono>
 #include <filesystem>
 #include <utility>
 
@@ -151,6 +152,7 @@ std::vector<std::pair<milvus::cachinglayer::cid_t,
 SealedIndexTranslator::get_cells(milvus::OpContext* ctx,
                                  const std::vector<cid_t>& cids) {
     int64_t segment_id = std::stoll(index_load_info_.segment_id);
+    auto start = std::chrono::steady_clock::now();
 
     std::unique_ptr<milvus::index::IndexBase> index =
         milvus::index::IndexFactory::GetInstance().CreateIndex(
@@ -196,6 +198,11 @@ SealedIndexTranslator::get_cells(milvus::OpContext* ctx,
     std::vector<std::pair<cid_t, std::unique_ptr<milvus::index::IndexBase>>>
         result;
     result.emplace_back(std::make_pair(0, std::move(index)));
+    RecordCellLoad(CellLoadTranslator::SEALED_INDEX,
+                   result.size(),
+                   load_resource_request_.final_memory_cost +
+                       load_resource_request_.final_disk_cost,
+                   start);
     return result;
 }
 
@@ -19,6 +19,7 @@
 #include <assert.h>
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <filesystem>
 #include <limits>
@@ -45,6 +46,7 @@
 #include "milvus-storage/common/config.h"
 #include "milvus-storage/common/constants.h"
 #include "milvus-storage/filesystem/fs.h"
+#include "milvus-storage/format/parquet/file_reader.h"
 #include "mmap/Types.h"
 #include "segcore/InsertRecord.h"
 #include "segcore/Utils.h"
@@ -75,12 +77,19 @@ GroupChunkTranslator::GroupChunkTranslator(
     bool mmap_populate,
     int64_t num_fields,
     milvus::proto::common::LoadPriority load_priority,
-    const std::string& warmup_policy)
+    const std::string& warmup_policy,
+    std::optional<FieldId> projected_field)
     : segment_id_(segment_id),
       group_chunk_type_(group_chunk_type),
       key_([&]() {
           switch (group_chunk_type) {
               case GroupChunkType::DEFAULT:
+                  if (projected_field.has_value()) {
+                      return fmt::format("seg_{}_cg_{}_{}",
+                                         segment_id,
+                                         column_group_info.field_id,
+                                         projected_field->get());
+                  }
                   return fmt::format(
                       "seg_{}_cg_{}", segment_id, column_group_info.field_id);
               case GroupChunkType::JSON_KEY_STATS:
@@ -94,7 +103,17 @@ GroupChunkTranslator::GroupChunkTranslator(
                                      column_group_info.field_id);
           }
       }()),
-      field_metas_(field_metas),
+      field_metas_([&]() {
+          if (!projected_field.has_value()) {
+              return field_metas;
+          }
+          auto it = field_metas.find(*projected_field);
+          AssertInfo(it != field_metas.end(),
+                     "[StorageV2] projected field {} not in column group {}",
+                     projected_field->get(),
+                     column_group_info.field_id);
+          return std::unordered_map<FieldId, FieldMeta>{*it};
+      }()),
       column_group_info_(column_group_info),
       insert_files_(std::move(insert_files)),
       row_group_meta_list_(std::move(row_group_meta_list)),
@@ -135,7 +154,8 @@ GroupChunkTranslator::GroupChunkTranslator(
                                        return field.second.get_data_type() ==
                                               DataType::ARRAY;
                                    })),
-      load_priority_(load_priority) {
+      load_priority_(load_priority),
+      projected_field_(projected_field) {
     // Build prefix sum for O(1) lookup in get_cid_from_file_and_row_group_index
     file_row_group_prefix_sum_.reserve(row_group_meta_list_.size() + 1);
     file_row_group_prefix_sum_.push_back(
@@ -198,6 +218,29 @@ GroupChunkTranslator::GroupChunkTranslator(
         meta_.chunk_memory_size_.push_back(cell_size);
     }
 
+    // Row group metadata only sizes the whole group, so a projected cell is
+    // charged the projected field's share of it, weighted by the fields'
+    // fixed widths.
+    if (projected_field_.has_value() && field_metas.size() > 1) {
+        auto weight_of = [](const FieldMeta& field_meta) -> int64_t {
+            // sparse vectors have no fixed width, take a typical row
+            return IsSparseFloatVectorDataType(field_meta.get_data_type())
+                       ? 512
+                       : field_meta.get_sizeof();
+        };
+        int64_t total_weight = 0;
+        for (const auto& [fid, field_meta] : field_metas) {
+            total_weight += weight_of(field_meta);
+        }
+        auto weight = weight_of(field_metas_.begin()->second);
+        for (auto& cell_size : meta_.chunk_memory_size_) {
+            cell_size = std::max<int64_t>(
+                1,
+                static_cast<int64_t>(static_cast<double>(cell_size) * weight /
+                                     total_weight));
+        }
+    }
+
     AssertInfo(
         meta_.num_rows_until_chunk_.back() == column_group_info_.row_count,
         fmt::format(
@@ -315,6 +358,7 @@ GroupChunkTranslator::get_cells(milvus::OpContext* ctx,
                                 const std::vector<cachinglayer::cid_t>& cids) {
     // Check for cancellation before loading group chunks
     CheckCancellation(ctx, segment_id_, "GroupChunkTranslator::get_cells()");
+    auto start = std::chrono::steady_clock::now();
 
     std::vector<std::pair<milvus::cachinglayer::cid_t,
                           std::unique_ptr<milvus::GroupChunk>>>
@@ -354,7 +398,8 @@ GroupChunkTranslator::get_cells(milvus::OpContext* ctx,
                             milvus::segcore::kChannelCapacityMultiplier));
     auto fs = milvus::segcore::GetDefaultArrowFileSystem();
 
-    auto factory = milvus::segcore::MakeFileReaderFactory(insert_files_, fs);
+    auto factory = milvus::segcore::MakeFileReaderFactory(
+        insert_files_, fs, projected_schema());
     auto finalize_cell =
         [this](const std::vector<std::shared_ptr<arrow::Table>>& tables,
                int64_t cid) {
@@ -439,6 +484,12 @@ GroupChunkTranslator::get_cells(milvus::OpContext* ctx,
         cells.emplace_back(cid, std::move(it->second));
     }
 
+    int64_t num_bytes = 0;
+    for (auto cid : cids) {
+        num_bytes += meta_.chunk_memory_size_[cid];
+    }
+    RecordCellLoad(
+        CellLoadTranslator::GROUP_CHUNK, cells.size(), num_bytes, start);
     return cells;
 }
 
@@ -544,10 +595,59 @@ GroupChunkTranslator::load_group_chunk(
                                     mmap_populate_,
                                     filepath.string(),
                                     load_priority_);
+        for (size_t i = 0; i < field_ids.size(); ++i) {
+            advise_chunk_access(field_metas[i], *chunks.at(field_ids[i]));
+        }
     }
     return std::make_unique<milvus::GroupChunk>(chunks);
 }
 
+std::shared_ptr<arrow::Schema>
+GroupChunkTranslator::projected_schema() {
+    if (!projected_field_.has_value() || insert_files_.empty()) {
+        return nullptr;
+    }
+    std::call_once(projected_schema_once_, [this]() {
+        auto fs = milvus::segcore::GetDefaultArrowFileSystem();
+        auto result = milvus_storage::FileRowGroupReader::Make(
+            fs,
+            insert_files_[0],
+            milvus_storage::DEFAULT_READ_BUFFER_SIZE,
+            milvus::storage::GetReaderProperties(),
+            milvus::storage::GetArrowReaderProperties());
+        AssertInfo(result.ok(),
+                   "[StorageV2] translator {} failed to create file row "
+                   "group reader: {}",
+                   key_,
+                   result.status().ToString());
+        auto reader = result.ValueOrDie();
+        auto file_schema = reader->schema();
+        auto field_id = std::to_string(projected_field_->get());
+        for (int i = 0; i < file_schema->num_fields(); ++i) {
+            const auto& metadata = file_schema->field(i)->metadata();
+            if (metadata != nullptr &&
+                metadata->Contains(milvus_storage::ARROW_FIELD_ID_KEY) &&
+                metadata->Get(milvus_storage::ARROW_FIELD_ID_KEY)
+                        .ValueOrDie() == field_id) {
+                projected_schema_ =
+                    arrow::schema({file_schema->field(i)->Copy()});
+                break;
+            }
+        }
+        auto status = reader->Close();
+        AssertInfo(status.ok(),
+                   "[StorageV2] translator {} failed to close file reader: {}",
+                   key_,
+                   status.ToString());
+        AssertInfo(projected_schema_ != nullptr,
+                   "[StorageV2] translator {} field {} not found in file {}",
+                   key_,
+                   field_id,
+                   insert_files_[0]);
+    });
+    return projected_schema_;
+}
+
 int64_t
 GroupChunkTranslator::loading_overhead_bytes(int64_t cell_size) const {
     if (!has_array_field_) {
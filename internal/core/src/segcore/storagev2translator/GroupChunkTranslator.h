@@ -18,6 +18,8 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <unordered_map>
 
 #include "cachinglayer/Translator.h"
@@ -34,6 +36,9 @@ namespace milvus::segcore::storagev2translator {
 class GroupChunkTranslator
     : public milvus::cachinglayer::Translator<milvus::GroupChunk> {
  public:
+    // With `projected_field` set, the translator serves only that field of
+    // the column group: cells read just its column from the row groups, are
+    // sized by its share of the group and are cached under a per-field key.
     GroupChunkTranslator(
         int64_t segment_id,
         GroupChunkType group_chunk_type,
@@ -46,7 +51,8 @@ class GroupChunkTranslator
         bool mmap_populate,
         int64_t num_fields,
         milvus::proto::common::LoadPriority load_priority,
-        const std::string& warmup_policy);
+        const std::string& warmup_policy,
+        std::optional<FieldId> projected_field = std::nullopt);
 
     ~GroupChunkTranslator() override;
 
@@ -100,6 +106,11 @@ class GroupChunkTranslator
     int64_t
     loading_overhead_bytes(int64_t cell_size) const;
 
+    // Arrow schema holding only the projected column, read once from the
+    // first insert file. nullptr when the translator is not projected.
+    std::shared_ptr<arrow::Schema>
+    projected_schema();
+
     int64_t segment_id_;
     GroupChunkType group_chunk_type_{GroupChunkType::DEFAULT};
     std::string key_;
@@ -116,6 +127,9 @@ class GroupChunkTranslator
     bool has_array_field_{false};
     milvus::proto::common::LoadPriority load_priority_{
         milvus::proto::common::LoadPriority::HIGH};
+    std::optional<FieldId> projected_field_;
+    std::once_flag projected_schema_once_;
+    std::shared_ptr<arrow::Schema> projected_schema_;
 };
 
 }  // namespace milvus::segcore::storagev2translator
@@ -37,6 +37,7 @@
 #include "common/Types.h"
 #include "common/protobuf_utils.h"
 #include "filemanager/InputStream.h"
+#include "fmt/core.h"
 #include "gtest/gtest.h"
 #include "milvus-storage/common/config.h"
 #include "milvus-storage/common/metadata.h"
@@ -421,6 +422,78 @@ TEST_P(GroupChunkTranslatorTest, TestMultipleFiles) {
     }
 }
 
+TEST_P(GroupChunkTranslatorTest, TestProjectedField) {
+    auto temp_dir =
+        std::filesystem::path(TestLocalPath) / "gctt_test_projected_field";
+    std::filesystem::create_directory(temp_dir);
+
+    auto use_mmap = GetParam();
+    std::unordered_map<FieldId, FieldMeta> field_metas = schema_->get_fields();
+    auto column_group_info = FieldDataInfo(0, 3000, temp_dir.string());
+    auto metadata = LoadGroupChunkMetadata(paths_, {}, "test_group_chunk");
+    auto projected_field = schema_->get_primary_field_id().value();
+
+    auto full_translator = std::make_unique<GroupChunkTranslator>(
+        segment_id_,
+        GroupChunkType::DEFAULT,
+        field_metas,
+        column_group_info,
+        paths_,
+        std::vector<milvus_storage::RowGroupMetadataVector>(
+            metadata.row_group_meta_list),
+        use_mmap,
+        true,
+        schema_->get_field_ids().size(),
+        milvus::proto::common::LoadPriority::LOW,
+        /* warmup_policy */ "");
+    auto translator = std::make_unique<GroupChunkTranslator>(
+        segment_id_,
+        GroupChunkType::DEFAULT,
+        field_metas,
+        column_group_info,
+        paths_,
+        std::move(metadata.row_group_meta_list),
+        use_mmap,
+        true,
+        1,
+        milvus::proto::common::LoadPriority::LOW,
+        /* warmup_policy */ "",
+        projected_field);
+
+    EXPECT_EQ(translator->key(),
+              fmt::format("seg_0_cg_0_{}", projected_field.get()));
+    ASSERT_EQ(translator->num_cells(), full_translator->num_cells());
+
+    // a projected cell is charged only a share of the whole group
+    for (size_t i = 0; i < translator->num_cells(); ++i) {
+        auto usage = translator->estimated_byte_size_of_cell(i).first;
+        auto full_usage = full_translator->estimated_byte_size_of_cell(i).first;
+        if (use_mmap) {
+            EXPECT_GT(usage.file_bytes, 0);
+            EXPECT_LT(usage.file_bytes, full_usage.file_bytes);
+        } else {
+            EXPECT_GT(usage.memory_bytes, 0);
+            EXPECT_LT(usage.memory_bytes, full_usage.memory_bytes);
+        }
+    }
+
+    std::vector<cachinglayer::cid_t> cids;
+    for (size_t i = 0; i < translator->num_cells(); ++i) {
+        cids.push_back(i);
+    }
+    auto cells = translator->get_cells(nullptr, cids);
+    ASSERT_EQ(cells.size(), cids.size());
+    int64_t num_rows = 0;
+    for (const auto& [cid, cell] : cells) {
+        EXPECT_EQ(cell->GetChunks().size(), 1);
+        ASSERT_TRUE(cell->HasChunk(projected_field));
+        num_rows += cell->GetChunk(projected_field)->RowNums();
+    }
+    EXPECT_EQ(num_rows, 3000);
+
+    std::filesystem::remove_all(temp_dir);
+}
+
 INSTANTIATE_TEST_SUITE_P(GroupChunkTranslatorTest,
                          GroupChunkTranslatorTest,
                          testing::Bool());
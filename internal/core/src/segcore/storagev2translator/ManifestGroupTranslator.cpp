@@ -17,6 +17,7 @@
 #include "segcore/storagev2translator/ManifestGroupTranslator.h"
 
 #include <algorithm>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
@@ -266,6 +267,7 @@ ManifestGroupTranslator::get_cells(
     const std::vector<milvus::cachinglayer::cid_t>& cids) {
     // Check for cancellation before loading group chunks
     CheckCancellation(ctx, segment_id_, "ManifestGroupTranslator::get_cells()");
+    auto start = std::chrono::steady_clock::now();
 
     std::vector<std::pair<milvus::cachinglayer::cid_t,
                           std::unique_ptr<milvus::GroupChunk>>>
@@ -390,6 +392,12 @@ ManifestGroupTranslator::get_cells(
         cells.emplace_back(cid, std::move(it->second));
     }
 
+    int64_t num_bytes = 0;
+    for (auto cid : cids) {
+        num_bytes += meta_.chunk_memory_size_[cid];
+    }
+    RecordCellLoad(
+        CellLoadTranslator::MANIFEST_GROUP, cells.size(), num_bytes, start);
     return cells;
 }
 
@@ -54,7 +54,7 @@ std::unique_ptr<OffsetMap>
 create_offset_map(DataType data_type) {
     switch (data_type) {
         case DataType::INT64:
-            return std::make_unique<OffsetOrderedArray<int64_t>>();
+            return std::make_unique<EliasFanoOffsetArray>();
         case DataType::VARCHAR:
             return std::make_unique<OffsetOrderedArray<std::string>>();
         default:
@@ -93,6 +93,8 @@ estimate_pk_index_bytes(DataType data_type,
                       "unsupported primary key data type {}",
                       data_type);
     }
+    base += static_cast<int64_t>(SplitBlockBloomFilter::MemorySizeFor(
+        num_rows, PkFilterFalsePositiveRate));
     return std::max<int64_t>(base, 1024);
 }
 
@@ -106,13 +108,16 @@ TimestampIndexCell::TimestampIndexCell(TimestampIndex timestamp_index,
 
 PkIndexCell::PkIndexCell(std::unique_ptr<OffsetMap> pk2offset,
                          std::unique_ptr<CompressedInt64PkArray> offset2pk,
+                         std::unique_ptr<SplitBlockBloomFilter> pk_filter,
                          bool is_int64_pk)
     : pk2offset_(std::move(pk2offset)),
       offset2pk_(std::move(offset2pk)),
+      pk_filter_(std::move(pk_filter)),
       is_int64_pk_(is_int64_pk),
       byte_size_{
           static_cast<int64_t>((pk2offset_ ? pk2offset_->memory_size() : 0) +
-                               (offset2pk_ ? offset2pk_->memory_size() : 0)),
+                               (offset2pk_ ? offset2pk_->memory_size() : 0) +
+                               (pk_filter_ ? pk_filter_->memory_size() : 0)),
           0} {
 }
 
@@ -274,6 +279,8 @@ PkIndexTranslator::get_cells(milvus::OpContext* ctx,
 
     std::unique_ptr<OffsetMap> pk2offset;
     std::unique_ptr<CompressedInt64PkArray> offset2pk;
+    auto pk_filter = std::make_unique<SplitBlockBloomFilter>(
+        column_->NumRows(), PkFilterFalsePositiveRate);
 
     auto num_chunks = column_->num_chunks();
     std::vector<int64_t> chunk_ids(num_chunks);
@@ -295,6 +302,7 @@ PkIndexTranslator::get_cells(milvus::OpContext* ctx,
                 for (int64_t j = 0; j < chunk_num_rows; ++j) {
                     auto pk = pks[j];
                     all_pks.push_back(pk);
+                    pk_filter->AddHash(pk_filter_hash(pk));
                     if (pk2offset) {
                         pk2offset->insert(pk, offset);
                     }
@@ -313,6 +321,7 @@ PkIndexTranslator::get_cells(milvus::OpContext* ctx,
                 auto pw = column_->StringViews(ctx, i);
                 auto& pks = pw.get().first;
                 for (auto pk : pks) {
+                    pk_filter->AddHash(pk_filter_hash(pk));
                     if (pk2offset) {
                         pk2offset->insert(std::string(pk), offset);
                     }
@@ -338,6 +347,7 @@ PkIndexTranslator::get_cells(milvus::OpContext* ctx,
         0,
         std::make_unique<PkIndexCell>(std::move(pk2offset),
                                       std::move(offset2pk),
+                                      std::move(pk_filter),
                                       data_type_ == DataType::INT64));
     return result;
 }
@@ -51,6 +51,7 @@ class PkIndexCell {
  public:
     PkIndexCell(std::unique_ptr<OffsetMap> pk2offset,
                 std::unique_ptr<CompressedInt64PkArray> offset2pk,
+                std::unique_ptr<SplitBlockBloomFilter> pk_filter,
                 bool is_int64_pk);
 
     bool
@@ -71,6 +72,13 @@ class PkIndexCell {
         return pk2offset_->contain(pk);
     }
 
+    // Bloom filter over all pks of the segment, built for sorted segments
+    // too. A pk it rejects is not in the segment.
+    const SplitBlockBloomFilter*
+    pk_filter() const {
+        return pk_filter_.get();
+    }
+
     const OffsetMap&
     pk2offset() const {
         AssertInfo(pk2offset_ != nullptr,
@@ -96,6 +104,7 @@ class PkIndexCell {
  private:
     std::unique_ptr<OffsetMap> pk2offset_;
     std::unique_ptr<CompressedInt64PkArray> offset2pk_;
+    std::unique_ptr<SplitBlockBloomFilter> pk_filter_;
     bool is_int64_pk_{false};
     cachinglayer::ResourceUsage byte_size_;
 };
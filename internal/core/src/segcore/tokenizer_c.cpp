@@ -11,10 +11,14 @@
 
 #include "segcore/tokenizer_c.h"
 
+#include <cstdlib>
+#include <cstring>
 #include <exception>
 #include <map>
 #include <memory>
+#include <new>
 #include <string>
+#include <vector>
 
 #include "common/EasyAssert.h"
 #include "common/FieldMeta.h"
@@ -39,8 +43,7 @@ create_tokenizer(const char* params,
                  const char* extra_info,
                  CTokenizer* tokenizer) {
     try {
-        auto impl =
-            std::make_unique<milvus::tantivy::Tokenizer>(params, extra_info);
+        auto impl = milvus::tantivy::TokenizerCache::Create(params, extra_info);
         *tokenizer = impl.release();
         return milvus::SuccessCStatus();
     } catch (std::exception& e) {
@@ -71,6 +74,60 @@ create_token_stream(CTokenizer tokenizer, const char* text, uint32_t text_len) {
     return impl->CreateTokenStream(std::string(text, text_len)).release();
 }
 
+CStatus
+tokenize_batch(CTokenizer tokenizer,
+               const char* texts,
+               const uint32_t* text_offsets,
+               uint32_t num_texts,
+               CTokenBatch* batch) {
+    try {
+        auto impl = reinterpret_cast<milvus::tantivy::Tokenizer*>(tokenizer);
+        std::string data;
+        std::vector<uint32_t> token_offsets{0};
+        std::vector<uint32_t> token_counts;
+        token_counts.reserve(num_texts);
+        for (uint32_t i = 0; i < num_texts; i++) {
+            auto token_stream = impl->CreateTokenStream(
+                std::string(texts + text_offsets[i],
+                            text_offsets[i + 1] - text_offsets[i]));
+            uint32_t count = 0;
+            while (token_stream->advance()) {
+                auto token = token_stream->get_token_no_copy();
+                data.append(token);
+                free_rust_string(token);
+                token_offsets.push_back(static_cast<uint32_t>(data.size()));
+                count++;
+            }
+            token_counts.push_back(count);
+        }
+
+        auto copy = [](const void* src, size_t bytes) {
+            auto dst = malloc(bytes == 0 ? 1 : bytes);
+            if (dst == nullptr) {
+                throw std::bad_alloc();
+            }
+            memcpy(dst, src, bytes);
+            return dst;
+        };
+        batch->data = static_cast<char*>(copy(data.data(), data.size()));
+        batch->token_offsets = static_cast<uint32_t*>(copy(
+            token_offsets.data(), token_offsets.size() * sizeof(uint32_t)));
+        batch->token_counts = static_cast<uint32_t*>(copy(
+            token_counts.data(), token_counts.size() * sizeof(uint32_t)));
+        batch->num_tokens = token_offsets.size() - 1;
+        return milvus::SuccessCStatus();
+    } catch (std::exception& e) {
+        return milvus::FailureCStatus(&e);
+    }
+}
+
+void
+free_token_batch(CTokenBatch batch) {
+    free(batch.data);
+    free(batch.token_offsets);
+    free(batch.token_counts);
+}
+
 CValidateResult
 validate_tokenizer(const char* params, const char* extra_info) {
     try {
@@ -48,6 +48,29 @@ validate_tokenizer(const char* params, const char* extra_info);
 CTokenStream
 create_token_stream(CTokenizer tokenizer, const char* text, uint32_t text_len);
 
+// The tokens of a batch of texts, back to back.
+typedef struct CTokenBatch {
+    char* data;
+    // token i is data[token_offsets[i], token_offsets[i + 1])
+    uint32_t* token_offsets;
+    // the number of tokens of each text, in order
+    uint32_t* token_counts;
+    uint32_t num_tokens;
+} CTokenBatch;
+
+// Tokenizes `num_texts` texts in one call, text i is
+// texts[text_offsets[i], text_offsets[i + 1]). The batch must be freed by
+// free_token_batch.
+CStatus
+tokenize_batch(CTokenizer tokenizer,
+               const char* texts,
+               const uint32_t* text_offsets,
+               uint32_t num_texts,
+               CTokenBatch* batch);
+
+void
+free_token_batch(CTokenBatch batch);
+
 CStatus
 validate_text_schema(const uint8_t* field_schema, uint64_t length);
 
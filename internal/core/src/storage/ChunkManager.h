@@ -24,6 +24,20 @@
 
 namespace milvus::storage {
 
+/**
+ * @brief Version of a stored object: its size and, where the storage
+ * reports one, its ETag. An empty etag means unknown.
+ */
+struct ObjectVersion {
+    uint64_t size{0};
+    std::string etag;
+
+    bool
+    operator==(const ObjectVersion& other) const {
+        return size == other.size && etag == other.etag;
+    }
+};
+
 /**
  * @brief This ChunkManager is abstract interface for milvus that
  * used to manager operation and interaction with storage
@@ -47,6 +61,16 @@ class ChunkManager {
     virtual uint64_t
     Size(const std::string& filepath) = 0;
 
+    /**
+     * @brief Get file version, the size and the ETag if the storage has one
+     * @param filepath
+     * @return ObjectVersion
+     */
+    virtual ObjectVersion
+    GetObjectVersion(const std::string& filepath) {
+        return ObjectVersion{Size(filepath), ""};
+    }
+
     /**
      * @brief Read file to buffer
      * @param filepath
@@ -16,8 +16,10 @@
 
 #include <arrow/array.h>
 #include <arrow/builder.h>
+#include <arrow/io/memory.h>
 #include <folly/FBVector.h>
 #include <gtest/gtest.h>
+#include <parquet/file_reader.h>
 #include <simdjson.h>
 #include <string.h>
 #include <algorithm>
@@ -28,10 +30,12 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
 #include "common/Array.h"
+#include "common/Common.h"
 #include "common/EasyAssert.h"
 #include "common/FieldData.h"
 #include "common/FieldDataInterface.h"
@@ -53,6 +57,7 @@
 #include "storage/IndexData.h"
 #include "storage/InsertData.h"
 #include "storage/PayloadReader.h"
+#include "storage/PayloadWriter.h"
 #include "storage/Types.h"
 #include "storage/Util.h"
 #include "test_utils/Constants.h"
@@ -2037,3 +2042,83 @@ TEST(storage, InsertDataJsonFillWithNull) {
     ASSERT_EQ(new_payload->get_null_count(), size);
     ASSERT_EQ(*new_payload->ValidData(), *valid_data);
 }
+
+namespace {
+
+std::vector<parquet::Encoding::type>
+PayloadEncodings(const std::vector<uint8_t>& payload) {
+    auto reader = parquet::ParquetFileReader::Open(
+        std::make_shared<arrow::io::BufferReader>(payload.data(),
+                                                  payload.size()));
+    return reader->metadata()->RowGroup(0)->ColumnChunk(0)->encodings();
+}
+
+bool
+HasEncoding(const std::vector<parquet::Encoding::type>& encodings,
+            parquet::Encoding::type encoding) {
+    return std::find(encodings.begin(), encodings.end(), encoding) !=
+           encodings.end();
+}
+
+}  // namespace
+
+TEST(storage, PayloadWriterChoosesFloatEncodingByCardinality) {
+    constexpr int rows = 10000;
+    std::vector<float> distinct(rows);
+    std::vector<float> repeated(rows);
+    for (int i = 0; i < rows; ++i) {
+        distinct[i] = i * 0.37F;
+        repeated[i] = static_cast<float>(i % 4);
+    }
+    auto write = [](const std::vector<float>& values) {
+        milvus::storage::PayloadWriter writer(DataType::FLOAT, false);
+        writer.add_payload(
+            {DataType::FLOAT,
+             reinterpret_cast<const uint8_t*>(values.data()),
+             nullptr,
+             static_cast<int64_t>(values.size()),
+             std::nullopt,
+             false});
+        writer.finish();
+        return writer.get_payload_buffer();
+    };
+
+    auto split = PayloadEncodings(write(distinct));
+    EXPECT_TRUE(HasEncoding(split, parquet::Encoding::BYTE_STREAM_SPLIT));
+    EXPECT_FALSE(HasEncoding(split, parquet::Encoding::RLE_DICTIONARY));
+    auto dictionary = PayloadEncodings(write(repeated));
+    EXPECT_TRUE(HasEncoding(dictionary, parquet::Encoding::RLE_DICTIONARY));
+
+    milvus::ENABLE_ADAPTIVE_PAYLOAD_ENCODING.store(false);
+    auto fixed = PayloadEncodings(write(distinct));
+    milvus::ENABLE_ADAPTIVE_PAYLOAD_ENCODING.store(true);
+    EXPECT_FALSE(HasEncoding(fixed, parquet::Encoding::BYTE_STREAM_SPLIT));
+}
+
+TEST(storage, PayloadWriterAddsBinaryPayloadsAtOnce) {
+    std::vector<std::string> strings = {"a", "", "bcd", "ignored", "ef"};
+    std::vector<std::string_view> values(strings.begin(), strings.end());
+    uint8_t valid_data[] = {0x17};  // rows 0,1,2,4 valid; row 3 null.
+
+    milvus::storage::PayloadWriter writer(DataType::VARCHAR, true);
+    writer.add_binary_payloads(values, valid_data);
+    writer.add_one_string_payload("gh", 2);
+    ASSERT_EQ(writer.get_payload_length(), 6);
+    writer.finish();
+    auto& payload = writer.get_payload_buffer();
+
+    milvus::storage::PayloadReader reader(
+        payload.data(), payload.size(), DataType::VARCHAR, true);
+    auto field_data = reader.get_field_data();
+    ASSERT_EQ(field_data->get_num_rows(), 6);
+    ASSERT_EQ(field_data->get_null_count(), 1);
+    EXPECT_FALSE(field_data->is_valid(3));
+    std::vector<std::string> expected = {"a", "", "bcd", "", "ef", "gh"};
+    for (size_t i = 0; i < expected.size(); ++i) {
+        if (i == 3) {
+            continue;
+        }
+        EXPECT_EQ(*static_cast<const std::string*>(field_data->RawValue(i)),
+                  expected[i]);
+    }
+}
@@ -349,55 +349,71 @@ DiskFileManagerImpl::CacheIndexToDiskInternal(
              index_slices.size(),
              local_index_prefix);
 
+    // the slices are fetched max_parallel_degree at a time across files, so
+    // that an index of many small files, like a tantivy index, isn't
+    // fetched one file after another
+    uint64_t max_parallel_degree =
+        uint64_t(DEFAULT_FIELD_MAX_MEMORY_LIMIT / FILE_SLICE_SIZE.load());
+    std::vector<std::string> batch_remote_files;
+    std::vector<std::string> batch_local_files;
+    batch_remote_files.reserve(max_parallel_degree);
+    batch_local_files.reserve(max_parallel_degree);
+
+    std::string local_index_file_name;
+    std::unique_ptr<storage::FileWriter> file_writer;
+    auto finishIndexFile = [&]() {
+        if (file_writer == nullptr) {
+            return;
+        }
+        file_writer->Finish();
+        file_writer.reset();
+        local_paths_.emplace_back(local_index_file_name);
+        // TODO: remove this log when #45590 is solved
+        LOG_INFO("CacheIndexToDisk: cached file {}", local_index_file_name);
+    };
+    auto appendIndexFiles = [&]() {
+        auto index_chunks_futures =
+            GetObjectData(rcm_.get(),
+                          batch_remote_files,
+                          milvus::PriorityForLoad(priority));
+        size_t chunk_idx = 0;
+        storage::ProcessFuturesInOrder(
+            index_chunks_futures,
+            [&](std::unique_ptr<DataCodec> chunk_codec) {
+                const auto& local_file = batch_local_files[chunk_idx++];
+                if (file_writer == nullptr ||
+                    local_file != local_index_file_name) {
+                    finishIndexFile();
+                    local_index_file_name = local_file;
+                    local_chunk_manager->CreateFile(local_index_file_name);
+                    file_writer = std::make_unique<storage::FileWriter>(
+                        local_index_file_name,
+                        storage::io::GetPriorityFromLoadPriority(priority));
+                }
+                file_writer->Write(chunk_codec->PayloadData(),
+                                   chunk_codec->PayloadSize());
+            });
+        batch_remote_files.clear();
+        batch_local_files.clear();
+    };
+
     for (auto& slices : index_slices) {
         auto prefix = slices.first;
-        auto local_index_file_name =
+        auto local_file =
             local_index_prefix + prefix.substr(prefix.find_last_of('/') + 1);
-        local_chunk_manager->CreateFile(local_index_file_name);
-
-        // Get the remote files
-        std::vector<std::string> batch_remote_files;
-        batch_remote_files.reserve(slices.second.size());
-
-        uint64_t max_parallel_degree =
-            uint64_t(DEFAULT_FIELD_MAX_MEMORY_LIMIT / FILE_SLICE_SIZE.load());
-
-        {
-            auto file_writer = storage::FileWriter(
-                local_index_file_name,
-                storage::io::GetPriorityFromLoadPriority(priority));
-            auto appendIndexFiles = [&]() {
-                auto index_chunks_futures =
-                    GetObjectData(rcm_.get(),
-                                  batch_remote_files,
-                                  milvus::PriorityForLoad(priority));
-                storage::ProcessFuturesInOrder(
-                    index_chunks_futures,
-                    [&](std::unique_ptr<DataCodec> chunk_codec) {
-                        file_writer.Write(chunk_codec->PayloadData(),
-                                          chunk_codec->PayloadSize());
-                    });
-                batch_remote_files.clear();
-            };
-
-            for (int& iter : slices.second) {
-                auto origin_file = prefix + "_" + std::to_string(iter);
-                batch_remote_files.push_back(origin_file);
-
-                if (batch_remote_files.size() == max_parallel_degree) {
-                    appendIndexFiles();
-                }
-            }
-            if (batch_remote_files.size() > 0) {
+        for (int& iter : slices.second) {
+            batch_remote_files.push_back(prefix + "_" + std::to_string(iter));
+            batch_local_files.push_back(local_file);
+
+            if (batch_remote_files.size() == max_parallel_degree) {
                 appendIndexFiles();
             }
-            file_writer.Finish();
         }
-
-        local_paths_.emplace_back(local_index_file_name);
-        // TODO: remove this log when #45590 is solved
-        LOG_INFO("CacheIndexToDisk: cached file {}", local_index_file_name);
     }
+    if (batch_remote_files.size() > 0) {
+        appendIndexFiles();
+    }
+    finishIndexFile();
 }
 
 void
@@ -505,66 +521,48 @@ DiskFileManagerImpl::cache_raw_data_to_disk_internal(const Config& config) {
     uint64_t total_num_rows = 0;
     bool nullable = false;
 
-    // get batch raw data from s3 and write batch data to disk file
-    // TODO: load and write of different batches at the same time
-    std::vector<std::string> batch_files;
-
     // file format
     // num_rows(uint32) | dim(uint32) | index_data ([]uint8_t)
     uint32_t num_rows = 0;
     uint32_t dim = 0;
     int64_t write_offset = sizeof(num_rows) + sizeof(dim);
 
-    auto FetchRawData = [&]() {
-        auto field_datas = GetObjectData(rcm_.get(), batch_files);
-        storage::ProcessFuturesInOrder(
-            field_datas, [&](std::unique_ptr<DataCodec> codec) {
-                auto field_data = codec->GetFieldData();
-                num_rows += uint32_t(field_data->get_valid_rows());
-
-                if (valid_data_path.has_value() && field_data->IsNullable()) {
-                    nullable = true;
-                    auto rows = field_data->get_num_rows();
-                    if (rows > 0) {
-                        auto new_size = (total_num_rows + rows + 7) / 8;
-                        if (new_size >
-                            static_cast<int64_t>(valid_bitmap.size())) {
-                            valid_bitmap.resize(new_size, 0);
-                        }
-                        for (int64_t i = 0; i < rows; ++i) {
-                            if (field_data->is_valid(i)) {
-                                set_bit(valid_bitmap, total_num_rows + i);
-                            }
+    // get batch raw data from s3 and write batch data to disk file, under
+    // the index build memory budget when there is one
+    // TODO: load and write of different batches at the same time
+    FetchFieldDataInBatches(
+        rcm_.get(),
+        remote_files,
+        INDEX_BUILD_MEMORY_BUDGET.load(),
+        [&](FieldDataPtr field_data) {
+            num_rows += uint32_t(field_data->get_valid_rows());
+
+            if (valid_data_path.has_value() && field_data->IsNullable()) {
+                nullable = true;
+                auto rows = field_data->get_num_rows();
+                if (rows > 0) {
+                    auto new_size = (total_num_rows + rows + 7) / 8;
+                    if (new_size > static_cast<int64_t>(valid_bitmap.size())) {
+                        valid_bitmap.resize(new_size, 0);
+                    }
+                    for (int64_t i = 0; i < rows; ++i) {
+                        if (field_data->is_valid(i)) {
+                            set_bit(valid_bitmap, total_num_rows + i);
                         }
-                        total_num_rows += rows;
                     }
+                    total_num_rows += rows;
                 }
+            }
 
-                cache_raw_data_to_disk_common<DataType>(
-                    field_data,
-                    local_chunk_manager,
-                    local_data_path,
-                    file_created,
-                    dim,
-                    write_offset,
-                    is_vector_array ? &offsets : nullptr);
-            });
-    };
-
-    auto parallel_degree =
-        uint64_t(DEFAULT_FIELD_MAX_MEMORY_LIMIT / FILE_SLICE_SIZE);
-    for (auto& file : remote_files) {
-        if (batch_files.size() >= parallel_degree) {
-            FetchRawData();
-            batch_files.clear();
-        }
-
-        batch_files.emplace_back(file);
-    }
-
-    if (batch_files.size() > 0) {
-        FetchRawData();
-    }
+            cache_raw_data_to_disk_common<DataType>(
+                field_data,
+                local_chunk_manager,
+                local_data_path,
+                file_created,
+                dim,
+                write_offset,
+                is_vector_array ? &offsets : nullptr);
+        });
 
     // For vector arrays, num_rows should be the total flattened vector count,
     // not the number of emb_lists, because DiskANN reads this from the data file header.
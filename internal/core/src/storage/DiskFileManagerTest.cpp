@@ -1955,3 +1955,50 @@ TEST_F(DiskAnnFileManagerTest, StringIndexSortV3Roundtrip) {
         EXPECT_EQ(val.value(), "str_000");
     }
 }
+
+TEST_F(DiskAnnFileManagerTest, FetchFieldDataInBatchesKeepsFileOrder) {
+    const int64_t dim = 16;
+    const int64_t rows_per_file = 50;
+    const int64_t num_files = 5;
+    FieldDataMeta field_data_meta = {1, 2, 3, 100};
+
+    std::vector<std::string> remote_files;
+    for (int64_t file = 0; file < num_files; ++file) {
+        std::vector<float> vec_data(rows_per_file * dim,
+                                    static_cast<float>(file));
+        auto field_data = storage::CreateFieldData(
+            DataType::VECTOR_FLOAT, DataType::NONE, false, dim);
+        field_data->FillFieldData(vec_data.data(), rows_per_file);
+        auto payload_reader =
+            std::make_shared<milvus::storage::PayloadReader>(field_data);
+        storage::InsertData insert_data(payload_reader);
+        insert_data.SetFieldDataMeta(field_data_meta);
+        insert_data.SetTimestamps(0, 100);
+        auto serialized_data =
+            insert_data.Serialize(storage::StorageType::Remote);
+        auto path = TestLocalPath + "diskann/fetch_in_batches/" +
+                    std::to_string(file);
+        cm_->Write(path, serialized_data.data(), serialized_data.size());
+        remote_files.push_back(path);
+    }
+
+    // a budget of two files and no budget both hand over every file in order
+    auto file_bytes = rows_per_file * dim * sizeof(float);
+    for (int64_t budget : {int64_t(2 * file_bytes), int64_t(0)}) {
+        std::vector<float> firsts;
+        FetchFieldDataInBatches(
+            cm_.get(), remote_files, budget, [&](FieldDataPtr field_data) {
+                EXPECT_EQ(field_data->get_num_rows(), rows_per_file);
+                firsts.push_back(
+                    static_cast<const float*>(field_data->Data())[0]);
+            });
+        ASSERT_EQ(firsts.size(), num_files);
+        for (int64_t file = 0; file < num_files; ++file) {
+            EXPECT_EQ(firsts[file], static_cast<float>(file));
+        }
+    }
+
+    for (auto& path : remote_files) {
+        cm_->Remove(path);
+    }
+}
@@ -313,13 +313,17 @@ BaseEventData::Serialize() {
             case DataType::VARCHAR:
             case DataType::STRING:
             case DataType::TEXT: {
+                std::vector<std::string_view> values;
+                values.reserve(field_data->get_num_rows());
                 for (size_t offset = 0; offset < field_data->get_num_rows();
                      ++offset) {
-                    auto str = static_cast<const std::string*>(
-                        field_data->RawValue(offset));
-                    auto size = field_data->is_valid(offset) ? str->size() : -1;
-                    payload_writer->add_one_string_payload(str->c_str(), size);
+                    values.emplace_back(*static_cast<const std::string*>(
+                        field_data->RawValue(offset)));
                 }
+                payload_writer->add_binary_payloads(
+                    values,
+                    field_data->IsNullable() ? field_data->ValidData()
+                                             : nullptr);
                 break;
             }
             case DataType::ARRAY: {
@@ -339,17 +343,18 @@ BaseEventData::Serialize() {
                 break;
             }
             case DataType::JSON: {
+                std::vector<std::string_view> values;
+                values.reserve(field_data->get_num_rows());
                 for (size_t offset = 0; offset < field_data->get_num_rows();
                      ++offset) {
-                    auto string_view =
+                    values.push_back(
                         static_cast<const Json*>(field_data->RawValue(offset))
-                            ->data();
-                    auto size =
-                        field_data->is_valid(offset) ? string_view.size() : -1;
-                    payload_writer->add_one_binary_payload(
-                        reinterpret_cast<const uint8_t*>(string_view.data()),
-                        size);
+                            ->data());
                 }
+                payload_writer->add_binary_payloads(
+                    values,
+                    field_data->IsNullable() ? field_data->ValidData()
+                                             : nullptr);
                 break;
             }
             case DataType::GEOMETRY: {
@@ -204,9 +204,13 @@ class FileManagerImpl : public milvus::FileManager {
         return OpenOutputStream(local_full_file_path, /*is_index_file=*/true);
     }
 
+    // Reads of the returned stream throw FollyCancel once
+    // `cancellation_token` is cancelled.
     std::shared_ptr<InputStream>
     OpenInputStream(const std::string& local_full_file_path,
-                    bool is_index_file) {
+                    bool is_index_file,
+                    folly::CancellationToken cancellation_token =
+                        folly::CancellationToken()) {
         AssertInfo(fs_, "fs_ is nullptr, cannot open input stream");
         auto local_file_name = GetFileName(local_full_file_path);
         auto remote_file_path = is_index_file ? GetRemoteIndexObjectPrefix()
@@ -218,7 +222,8 @@ class FileManagerImpl : public milvus::FileManager {
                    remote_file.status().ToString());
         return std::static_pointer_cast<milvus::InputStream>(
             std::make_shared<milvus::storage::RemoteInputStream>(
-                std::move(remote_file.ValueOrDie())));
+                std::move(remote_file.ValueOrDie()),
+                std::move(cancellation_token)));
     }
 
     std::shared_ptr<OutputStream>
@@ -266,8 +271,7 @@ class FileManagerImpl : public milvus::FileManager {
                     fs_,
                     cipher_plugin,
                     plugin_context_->ez_id,
-                    plugin_context_->collection_id,
-                    GetLocalTempDir());
+                    plugin_context_->collection_id);
             }
         }
         return std::make_unique<IndexEntryDirectStreamWriter>(
@@ -341,16 +345,6 @@ class FileManagerImpl : public milvus::FileManager {
         return boost::filesystem::path(filepath).filename().string();
     }
 
-    std::string
-    GetLocalTempDir() const {
-        auto local_cm =
-            LocalChunkManagerSingleton::GetInstance().GetChunkManager();
-        if (local_cm) {
-            return local_cm->GetRootPath();
-        }
-        return "";
-    }
-
  protected:
     // collection meta
     FieldDataMeta field_meta_;
@@ -21,6 +21,7 @@
 #include <folly/futures/Future.h>
 #include <folly/futures/Promise.h>
 #include <sys/stat.h>
+#include <sys/uio.h>
 #include <unistd.h>
 #include <cassert>
 #include <cstdlib>
@@ -32,6 +33,7 @@
 #include "folly/Unit.h"
 #include "folly/futures/Future.h"
 #include "folly/futures/Promise.h"
+#include "storage/EntryStreamUtils.h"
 #include "storage/FileWriter.h"
 
 namespace milvus::storage {
@@ -62,19 +64,23 @@ PWriteAll(int fd, const void* data, size_t nbyte, size_t file_offset) {
     return true;
 }
 
+// Splits `nbyte` into the parts the rate limiter grants in turn and calls
+// `write(done, part)` for each, `done` being the bytes granted before it.
+// Throws FollyCancel before a part once `cancellation_token` is cancelled.
+template <typename WriteFn>
 void
-PositionedWriteWithRateLimit(int fd,
-                             const std::string& filename,
-                             io::WriteRateLimiter& rate_limiter,
-                             io::Priority priority,
-                             size_t alignment_bytes,
-                             const void* data,
-                             size_t nbyte,
-                             size_t file_offset) {
+ForEachRateLimitedPart(io::WriteRateLimiter& rate_limiter,
+                       io::Priority priority,
+                       size_t alignment_bytes,
+                       size_t nbyte,
+                       const folly::CancellationToken& cancellation_token,
+                       WriteFn&& write) {
     size_t bytes_to_write = nbyte;
+    size_t done = 0;
     int32_t empty_loops = 0;
     int64_t total_wait_us = 0;
     while (bytes_to_write != 0) {
+        ThrowIfCancelled(cancellation_token, "Rate limited file write");
         auto allowed_bytes =
             rate_limiter.Acquire(bytes_to_write, alignment_bytes, priority);
         if (allowed_bytes == 0) {
@@ -92,18 +98,40 @@ PositionedWriteWithRateLimit(int fd,
                 continue;
             }
         }
-        if (!PWriteAll(fd, data, allowed_bytes, file_offset)) {
-            ThrowInfo(ErrorCode::FileWriteFailed,
-                      "Failed to write to file: {}, error: {}",
-                      filename,
-                      strerror(errno));
-        }
-        file_offset += allowed_bytes;
+        write(done, allowed_bytes);
+        done += allowed_bytes;
         bytes_to_write -= allowed_bytes;
-        data = static_cast<const char*>(data) + allowed_bytes;
     }
 }
 
+void
+PositionedWriteWithRateLimit(
+    int fd,
+    const std::string& filename,
+    io::WriteRateLimiter& rate_limiter,
+    io::Priority priority,
+    size_t alignment_bytes,
+    const void* data,
+    size_t nbyte,
+    size_t file_offset,
+    const folly::CancellationToken& cancellation_token) {
+    auto src = static_cast<const char*>(data);
+    ForEachRateLimitedPart(
+        rate_limiter,
+        priority,
+        alignment_bytes,
+        nbyte,
+        cancellation_token,
+        [&](size_t done, size_t part) {
+            if (!PWriteAll(fd, src + done, part, file_offset + done)) {
+                ThrowInfo(ErrorCode::FileWriteFailed,
+                          "Failed to write to file: {}, error: {}",
+                          filename,
+                          strerror(errno));
+            }
+        });
+}
+
 size_t
 RoundUpToAlignment(size_t size) {
     return (size + FileWriter::ALIGNMENT_MASK) & ~FileWriter::ALIGNMENT_MASK;
@@ -111,16 +139,24 @@ RoundUpToAlignment(size_t size) {
 
 }  // namespace
 
-FileWriter::FileWriter(std::string filename, io::Priority priority)
+FileWriter::FileWriter(std::string filename,
+                       io::Priority priority,
+                       folly::CancellationToken cancellation_token)
     : filename_(std::move(filename)),
       priority_(priority),
-      rate_limiter_(io::WriteRateLimiter::GetInstance()) {
+      rate_limiter_(io::WriteRateLimiter::GetInstance()),
+      cancellation_token_(std::move(cancellation_token)) {
     // high priority always use buffered mode, otherwise use the global mode
     auto mode =
         priority_ == io::Priority::HIGH ? WriteMode::BUFFERED : GetMode();
 
-    use_direct_io_ = mode == WriteMode::DIRECT;
-    use_writer_pool_ = FileWriteWorkerPool::GetInstance().HasPool();
+    // io_uring mode writes with direct io too, and falls back to plain
+    // direct io where io_uring is unavailable
+    use_direct_io_ = mode == WriteMode::DIRECT || mode == WriteMode::IO_URING;
+    use_io_uring_ =
+        mode == WriteMode::IO_URING && io::IoUring::IsSupported();
+    use_writer_pool_ =
+        !use_io_uring_ && FileWriteWorkerPool::GetInstance().HasPool();
 
     // allocate an internal aligned buffer for both modes to batch writes
     size_t buf_size = GetBufferSize();
@@ -174,16 +210,40 @@ FileWriter::~FileWriter() {
 
 void
 FileWriter::Cleanup() noexcept {
+    // writes still in flight read the ring buffers
+    if (ring_ != nullptr) {
+        uint64_t index = 0;
+        int32_t res = 0;
+        while (ring_->InFlight() > 0 && ring_->Reap(index, res, true)) {
+        }
+        ring_.reset();
+    }
     if (fd_ != -1) {
         close(fd_);
         fd_ = -1;
     }
-    if (aligned_buf_ != nullptr) {
+    if (!ring_buffers_.empty()) {
+        for (auto buffer : ring_buffers_) {
+            free(buffer);
+        }
+        ring_buffers_.clear();
+        aligned_buf_ = nullptr;
+    } else if (aligned_buf_ != nullptr) {
         free(aligned_buf_);
         aligned_buf_ = nullptr;
     }
 }
 
+void
+FileWriter::CheckCancelled() {
+    if (cancellation_token_.isCancellationRequested()) {
+        Cleanup();
+        ThrowInfo(ErrorCode::FollyCancel,
+                  "Writing file {} cancelled",
+                  filename_);
+    }
+}
+
 bool
 FileWriter::PositionedWrite(const void* data,
                             size_t nbyte,
@@ -204,7 +264,8 @@ FileWriter::PositionedWriteWithCheck(const void* data,
                                      alignment_bytes,
                                      data,
                                      nbyte,
-                                     file_offset);
+                                     file_offset,
+                                     cancellation_token_);
     } catch (...) {
         Cleanup();
         throw;
@@ -275,6 +336,12 @@ FileWriter::Write(const void* data, size_t nbyte) {
         offset_ += nbyte;
         return;
     }
+    CheckCancelled();
+
+    if (use_io_uring_) {
+        WriteWithIoUring(data, nbyte);
+        return;
+    }
 
     if (!use_writer_pool_) {
         WriteInternal(data, nbyte);
@@ -299,6 +366,7 @@ FileWriter::Write(const void* data, size_t nbyte) {
         try {
             future.wait();
         } catch (const std::exception& e) {
+            CheckCancelled();
             Cleanup();
             ThrowInfo(ErrorCode::FileWriteFailed,
                       "Failed to write to file: {}, error: {}",
@@ -310,6 +378,145 @@ FileWriter::Write(const void* data, size_t nbyte) {
     }
 }
 
+void
+FileWriter::WriteWithIoUring(const void* data, size_t nbyte) {
+    // the writes complete asynchronously, so the data always goes through
+    // the ring buffers instead of being written from `data` in place
+    const char* src = static_cast<const char*>(data);
+    while (nbyte != 0) {
+        size_t copy_size = std::min(nbyte, capacity_ - offset_);
+        milvus::fastmem::FastMemcpy(
+            static_cast<char*>(aligned_buf_) + offset_, src, copy_size);
+        offset_ += copy_size;
+        src += copy_size;
+        nbyte -= copy_size;
+        if (offset_ == capacity_) {
+            SubmitToIoUring();
+        }
+    }
+}
+
+bool
+FileWriter::SetupIoUring() {
+    ring_ = io::IoUring::Create(IO_URING_QUEUE_DEPTH);
+    if (ring_ == nullptr) {
+        return false;
+    }
+    ring_buffers_.push_back(aligned_buf_);
+    while (ring_buffers_.size() < IO_URING_QUEUE_DEPTH) {
+        auto buffer = aligned_alloc(ALIGNMENT_BYTES, capacity_);
+        if (buffer == nullptr) {
+            // fewer buffers only keep fewer writes in flight
+            break;
+        }
+        ring_buffers_.push_back(buffer);
+    }
+    std::vector<iovec> iovecs;
+    for (auto buffer : ring_buffers_) {
+        iovecs.push_back(iovec{buffer, capacity_});
+    }
+    ring_fixed_buffers_ = ring_->RegisterBuffers(iovecs);
+    ring_pending_.resize(ring_buffers_.size());
+    for (unsigned i = 1; i < ring_buffers_.size(); ++i) {
+        free_ring_buffers_.push_back(i);
+    }
+    ring_buffer_index_ = 0;
+    return true;
+}
+
+void
+FileWriter::SubmitToIoUring() {
+    if (ring_ == nullptr && !SetupIoUring()) {
+        LOG_WARN("Failed to set up io_uring for file: {}, use direct io",
+                 filename_);
+        use_io_uring_ = false;
+        PositionedWriteWithCheck(aligned_buf_, capacity_, file_size_);
+        file_size_ += capacity_;
+        offset_ = 0;
+        return;
+    }
+
+    // the rate limiter grants whole buffers before they are queued
+    ForEachRateLimitedPart(rate_limiter_,
+                           priority_,
+                           ALIGNMENT_BYTES,
+                           capacity_,
+                           cancellation_token_,
+                           [](size_t, size_t) {});
+    auto index = ring_buffer_index_;
+    ring_pending_[index] = PendingWrite{file_size_, capacity_};
+    auto queued =
+        ring_->PrepareWrite(fd_,
+                            aligned_buf_,
+                            capacity_,
+                            file_size_,
+                            index,
+                            ring_fixed_buffers_ ? static_cast<int>(index) : -1);
+    AssertInfo(queued, "io_uring submission queue of {} is full", filename_);
+    file_size_ += capacity_;
+    offset_ = 0;
+
+    // recycle the buffers whose writes are done, submitting the queued ones
+    // in batches, and wait for a write only when every buffer is in use
+    while (ReapIoUring(false)) {
+    }
+    if (free_ring_buffers_.empty()) {
+        ReapIoUring(true);
+    } else if (ring_->Queued() >= IO_URING_SUBMIT_BATCH) {
+        auto ret = ring_->Submit();
+        if (ret < 0) {
+            Cleanup();
+            ThrowInfo(ErrorCode::FileWriteFailed,
+                      "Failed to submit writes of file: {}, error: {}",
+                      filename_,
+                      strerror(-ret));
+        }
+    }
+    ring_buffer_index_ = free_ring_buffers_.back();
+    free_ring_buffers_.pop_back();
+    aligned_buf_ = ring_buffers_[ring_buffer_index_];
+}
+
+bool
+FileWriter::ReapIoUring(bool wait) {
+    uint64_t index = 0;
+    int32_t res = 0;
+    if (!ring_->Reap(index, res, wait) && res == 0) {
+        return false;
+    }
+    if (res < 0) {
+        Cleanup();
+        ThrowInfo(ErrorCode::FileWriteFailed,
+                  "Failed to write to file: {}, error: {}",
+                  filename_,
+                  strerror(-res));
+    }
+    // a short write is legal, finish it synchronously
+    const auto& pending = ring_pending_[index];
+    auto written = static_cast<size_t>(res);
+    if (written < pending.nbyte &&
+        !PWriteAll(fd_,
+                   static_cast<char*>(ring_buffers_[index]) + written,
+                   pending.nbyte - written,
+                   pending.file_offset + written)) {
+        auto err = errno;
+        Cleanup();
+        ThrowInfo(ErrorCode::FileWriteFailed,
+                  "Failed to write to file: {}, error: {}",
+                  filename_,
+                  strerror(err));
+    }
+    free_ring_buffers_.push_back(index);
+    return true;
+}
+
+void
+FileWriter::DrainIoUring() {
+    while (ring_ != nullptr && ring_->InFlight() > 0) {
+        ReapIoUring(true);
+    }
+}
+
 void
 FileWriter::FlushWithDirectIO() {
     size_t nearest_aligned_offset =
@@ -342,6 +549,10 @@ FileWriter::FlushWithBufferedIO() {
 
 size_t
 FileWriter::Finish() {
+    CheckCancelled();
+    // the buffers queued to the ring precede the tail in the file
+    DrainIoUring();
+
     // if the aligned buffer is not empty, we should flush it to the file
     if (offset_ != 0) {
         auto promise = std::make_shared<folly::Promise<folly::Unit>>();
@@ -364,6 +575,7 @@ FileWriter::Finish() {
             try {
                 future.wait();
             } catch (const std::exception& e) {
+                CheckCancelled();
                 Cleanup();
                 ThrowInfo(ErrorCode::FileWriteFailed,
                           "Failed to flush file: {}, error: {}",
@@ -386,16 +598,19 @@ FileWriter::Finish() {
     return file_size_;
 }
 
-PositionedFileWriter::PositionedFileWriter(std::string filename,
-                                           size_t file_size,
-                                           io::Priority priority)
+PositionedFileWriter::PositionedFileWriter(
+    std::string filename,
+    size_t file_size,
+    io::Priority priority,
+    folly::CancellationToken cancellation_token)
     : filename_(std::move(filename)),
       file_size_(file_size),
       mode_(priority == io::Priority::HIGH ? FileWriter::WriteMode::BUFFERED
                                            : FileWriter::GetMode()),
-      use_direct_io_(mode_ == FileWriter::WriteMode::DIRECT),
+      use_direct_io_(mode_ != FileWriter::WriteMode::BUFFERED),
       priority_(priority),
-      rate_limiter_(io::WriteRateLimiter::GetInstance()) {
+      rate_limiter_(io::WriteRateLimiter::GetInstance()),
+      cancellation_token_(std::move(cancellation_token)) {
     auto open_flags = O_CREAT | O_RDWR | O_TRUNC;
     if (use_direct_io_) {
 #ifndef __APPLE__
@@ -441,8 +656,15 @@ void
 PositionedFileWriter::WriteBufferedAt(size_t file_offset,
                                       const void* data,
                                       size_t size) {
-    PositionedWriteWithRateLimit(
-        fd_, filename_, rate_limiter_, priority_, 1, data, size, file_offset);
+    PositionedWriteWithRateLimit(fd_,
+                                 filename_,
+                                 rate_limiter_,
+                                 priority_,
+                                 1,
+                                 data,
+                                 size,
+                                 file_offset,
+                                 cancellation_token_);
 }
 
 void
@@ -476,7 +698,8 @@ PositionedFileWriter::WriteDirectAlignedAt(size_t file_offset,
                                      FileWriter::ALIGNMENT_BYTES,
                                      data,
                                      size,
-                                     file_offset);
+                                     file_offset,
+                                     cancellation_token_);
         return;
     }
 
@@ -500,7 +723,8 @@ PositionedFileWriter::WriteDirectAlignedAt(size_t file_offset,
                                  FileWriter::ALIGNMENT_BYTES,
                                  aligned_data_ptr,
                                  write_size,
-                                 file_offset);
+                                 file_offset,
+                                 cancellation_token_);
 }
 
 void
@@ -549,9 +773,10 @@ size_t FileWriter::buffer_size_ = DEFAULT_BUFFER_SIZE;
 
 void
 FileWriter::SetMode(WriteMode mode) {
-    if (mode != WriteMode::BUFFERED && mode != WriteMode::DIRECT) {
+    if (mode != WriteMode::BUFFERED && mode != WriteMode::DIRECT &&
+        mode != WriteMode::IO_URING) {
         LOG_WARN(
-            "Invalid write mode: {}, expected: BUFFERED or DIRECT, "
+            "Invalid write mode: {}, expected: BUFFERED, DIRECT or IO_URING, "
             "set to BUFFERED",
             static_cast<int>(mode));
         mode = WriteMode::BUFFERED;
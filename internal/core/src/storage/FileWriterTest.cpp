@@ -14,6 +14,7 @@
 #include <algorithm>
 #include <chrono>
 #include <cstdlib>
+#include <chrono>
 #include <cstring>
 #include <filesystem>
 #include <fstream>
@@ -25,6 +26,7 @@
 #include <vector>
 
 #include "common/EasyAssert.h"
+#include "folly/CancellationToken.h"
 #include "gtest/gtest.h"
 #include "storage/FileWriter.h"
 #include "test_utils/Constants.h"
@@ -658,13 +660,39 @@ TEST_F(FileWriterTest, LargeBufferSizeWriteWithDirectIO) {
 
 // Tese config FileWriterConfig with unknown mode
 TEST_F(FileWriterTest, UnknownModeWriteWithDirectIO) {
-    uint8_t mode = 2;
+    uint8_t mode = 3;
     EXPECT_NO_THROW({
         FileWriter::SetMode(static_cast<FileWriter::WriteMode>(mode));
         FileWriter::SetBufferSize(kBufferSize);
     });
 }
 
+// Test io_uring mode, which falls back to direct io without io_uring
+TEST_F(FileWriterTest, WriteWithIoUring) {
+    FileWriter::SetMode(FileWriter::WriteMode::IO_URING);
+    FileWriter::SetBufferSize(kBufferSize);
+
+    std::string filename = (test_dir_ / "io_uring.txt").string();
+    FileWriter writer(filename);
+    // enough buffers to wait for the ring, written in uneven pieces
+    std::vector<char> data(3 * FileWriter::IO_URING_QUEUE_DEPTH * kBufferSize +
+                           123);
+    std::generate(data.begin(), data.end(), std::rand);
+    size_t written = 0;
+    for (size_t piece = 1; written < data.size(); piece = piece * 3 + 1) {
+        auto size = std::min(piece, data.size() - written);
+        writer.Write(data.data() + written, size);
+        written += size;
+    }
+    EXPECT_EQ(writer.Finish(), data.size());
+
+    std::ifstream file(filename, std::ios::binary);
+    std::vector<char> read_data((std::istreambuf_iterator<char>(file)),
+                                std::istreambuf_iterator<char>());
+    EXPECT_EQ(read_data, data);
+    FileWriter::SetMode(FileWriter::WriteMode::BUFFERED);
+}
+
 TEST_F(FileWriterTest, HalfAlignedDataWriteWithDirectIO) {
     const size_t aligned_buffer_size = 2 * kBufferSize;
     std::string filename = (test_dir_ / "half_aligned_buffer.txt").string();
@@ -1150,3 +1178,57 @@ TEST_F(FileWriterTest, ConfigChangeDuringFileWriterOperations) {
                          std::istreambuf_iterator<char>());
     EXPECT_EQ(content2, test_data2);
 }
+
+TEST_F(FileWriterTest, CancelledWriterStopsWriting) {
+    FileWriter::SetMode(FileWriter::WriteMode::BUFFERED);
+    FileWriter::SetBufferSize(kBufferSize);
+    std::vector<char> data(4 * kBufferSize, 'a');
+
+    folly::CancellationSource source;
+    std::string filename = (test_dir_ / "cancelled.txt").string();
+    FileWriter writer(filename, io::Priority::MIDDLE, source.getToken());
+    writer.Write(data.data(), data.size());
+    source.requestCancellation();
+    try {
+        writer.Write(data.data(), data.size());
+        FAIL() << "expected cancellation";
+    } catch (const SegcoreError& e) {
+        EXPECT_EQ(e.get_error_code(), ErrorCode::FollyCancel);
+    }
+    EXPECT_EQ(std::filesystem::file_size(filename), data.size());
+}
+
+TEST_F(FileWriterTest, CancellationEndsRateLimiterWait) {
+    FileWriter::SetMode(FileWriter::WriteMode::BUFFERED);
+    FileWriter::SetBufferSize(kBufferSize);
+    // 4KB per 100ms, the write below would take seconds
+    auto& limiter = io::WriteRateLimiter::GetInstance();
+    limiter.Configure(/*refill_period_us*/ 100000,
+                      /*avg_bps*/ 4096 * 10,
+                      /*max_burst_bps*/ 4096 * 10,
+                      /*high*/ 1,
+                      /*middle*/ 1,
+                      /*low*/ 1);
+    std::vector<char> data(64 * kBufferSize, 'a');
+
+    folly::CancellationSource source;
+    std::string filename = (test_dir_ / "cancelled_rate_limited.txt").string();
+    std::thread canceller([&source]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        source.requestCancellation();
+    });
+    auto start = std::chrono::steady_clock::now();
+    {
+        PositionedFileWriter writer(
+            filename, data.size(), io::Priority::MIDDLE, source.getToken());
+        try {
+            writer.WriteAt(0, data.data(), data.size());
+            FAIL() << "expected cancellation";
+        } catch (const SegcoreError& e) {
+            EXPECT_EQ(e.get_error_code(), ErrorCode::FollyCancel);
+        }
+    }
+    canceller.join();
+    EXPECT_LT(std::chrono::steady_clock::now() - start,
+              std::chrono::seconds(1));
+}
@@ -30,9 +30,20 @@
 namespace milvus::storage {
 
 IndexEntryDirectStreamWriter::IndexEntryDirectStreamWriter(
-    std::shared_ptr<milvus::OutputStream> output, size_t read_buf_size)
-    : output_(std::move(output)), read_buf_(read_buf_size) {
+    std::shared_ptr<milvus::OutputStream> output,
+    size_t buffer_size,
+    size_t max_buffers)
+    : output_(std::move(output)),
+      buffer_size_(std::max<size_t>(buffer_size, 1)),
+      max_buffers_(std::max<size_t>(max_buffers, 1)) {
     output_->Write(MILVUS_V3_MAGIC, MILVUS_V3_MAGIC_SIZE);
+    uploader_ = std::thread([this]() { UploadLoop(); });
+}
+
+IndexEntryDirectStreamWriter::~IndexEntryDirectStreamWriter() {
+    if (uploader_.joinable()) {
+        StopUpload();
+    }
 }
 
 void
@@ -43,7 +54,7 @@ IndexEntryDirectStreamWriter::WriteEntry(const std::string& name,
     CheckDuplicateName(name);
 
     uint32_t crc = Crc32cValue(data, size);
-    output_->Write(data, size);
+    Append(data, size);
     dir_entries_.push_back({name, current_offset_, size, crc});
     current_offset_ += size;
 }
@@ -59,13 +70,16 @@ IndexEntryDirectStreamWriter::WriteEntry(const std::string& name,
     size_t entry_start = current_offset_;
     uint32_t crc = 0;
 
+    // read straight into the buffers queued for upload
     while (remaining > 0) {
-        size_t to_read = std::min(remaining, read_buf_.size());
+        auto& buffer = Current();
+        char* dst = buffer.data.get() + buffer.size;
+        size_t to_read = std::min(remaining, buffer_size_ - buffer.size);
         size_t chunk_read = 0;
 
         while (chunk_read < to_read) {
             ssize_t bytes_read =
-                ::read(fd, read_buf_.data() + chunk_read, to_read - chunk_read);
+                ::read(fd, dst + chunk_read, to_read - chunk_read);
             if (bytes_read == -1 && errno == EINTR) {
                 continue;
             }
@@ -75,8 +89,11 @@ IndexEntryDirectStreamWriter::WriteEntry(const std::string& name,
             chunk_read += bytes_read;
         }
 
-        crc = Crc32cUpdate(crc, read_buf_.data(), chunk_read);
-        output_->Write(read_buf_.data(), chunk_read);
+        crc = Crc32cUpdate(crc, dst, chunk_read);
+        buffer.size += chunk_read;
+        if (buffer.size == buffer_size_) {
+            Submit();
+        }
         current_offset_ += chunk_read;
         remaining -= chunk_read;
     }
@@ -84,6 +101,110 @@ IndexEntryDirectStreamWriter::WriteEntry(const std::string& name,
     dir_entries_.push_back({name, entry_start, size, crc});
 }
 
+void
+IndexEntryDirectStreamWriter::Append(const void* data, size_t size) {
+    auto src = static_cast<const char*>(data);
+    while (size > 0) {
+        auto& buffer = Current();
+        auto n = std::min(size, buffer_size_ - buffer.size);
+        milvus::fastmem::FastMemcpy(buffer.data.get() + buffer.size, src, n);
+        buffer.size += n;
+        src += n;
+        size -= n;
+        if (buffer.size == buffer_size_) {
+            Submit();
+        }
+    }
+}
+
+IndexEntryDirectStreamWriter::Buffer&
+IndexEntryDirectStreamWriter::Current() {
+    if (current_.data != nullptr) {
+        return current_;
+    }
+    std::unique_lock lck(mutex_);
+    cv_.wait(lck, [&]() {
+        return upload_error_ != nullptr || !free_buffers_.empty() ||
+               allocated_buffers_ < max_buffers_;
+    });
+    if (upload_error_ != nullptr) {
+        std::rethrow_exception(upload_error_);
+    }
+    if (!free_buffers_.empty()) {
+        current_ = std::move(free_buffers_.back());
+        free_buffers_.pop_back();
+    } else {
+        current_.data.reset(new char[buffer_size_]);
+        ++allocated_buffers_;
+    }
+    current_.size = 0;
+    return current_;
+}
+
+void
+IndexEntryDirectStreamWriter::Submit() {
+    if (current_.data == nullptr || current_.size == 0) {
+        return;
+    }
+    {
+        std::lock_guard lck(mutex_);
+        queued_buffers_.push_back(std::move(current_));
+    }
+    current_ = Buffer();
+    cv_.notify_all();
+}
+
+void
+IndexEntryDirectStreamWriter::StopUpload() {
+    {
+        std::lock_guard lck(mutex_);
+        stopping_ = true;
+    }
+    cv_.notify_all();
+    uploader_.join();
+}
+
+void
+IndexEntryDirectStreamWriter::CheckUploadError() {
+    std::lock_guard lck(mutex_);
+    if (upload_error_ != nullptr) {
+        std::rethrow_exception(upload_error_);
+    }
+}
+
+void
+IndexEntryDirectStreamWriter::UploadLoop() {
+    std::unique_lock lck(mutex_);
+    while (true) {
+        cv_.wait(lck, [&]() { return stopping_ || !queued_buffers_.empty(); });
+        if (queued_buffers_.empty()) {
+            return;
+        }
+        auto buffer = std::move(queued_buffers_.front());
+        queued_buffers_.pop_front();
+        // after a failure the buffers only go back to the pool
+        auto failed = upload_error_ != nullptr;
+        lck.unlock();
+
+        std::exception_ptr error;
+        if (!failed) {
+            try {
+                output_->Write(buffer.data.get(), buffer.size);
+            } catch (...) {
+                error = std::current_exception();
+            }
+        }
+
+        lck.lock();
+        if (error != nullptr && upload_error_ == nullptr) {
+            upload_error_ = error;
+        }
+        buffer.size = 0;
+        free_buffers_.push_back(std::move(buffer));
+        cv_.notify_all();
+    }
+}
+
 void
 IndexEntryDirectStreamWriter::Finish() {
     AssertInfo(!finished_, "Finish() has already been called");
@@ -91,7 +212,7 @@ IndexEntryDirectStreamWriter::Finish() {
     // Write __meta__ entry as the last entry in Data Region
     std::string meta_str = meta_json_.dump();
     uint32_t meta_crc = Crc32cValue(meta_str.data(), meta_str.size());
-    output_->Write(meta_str.data(), meta_str.size());
+    Append(meta_str.data(), meta_str.size());
     dir_entries_.push_back({MILVUS_V3_META_ENTRY_NAME,
                             current_offset_,
                             meta_str.size(),
@@ -111,7 +232,7 @@ IndexEntryDirectStreamWriter::Finish() {
     }
 
     std::string dir_str = dir_json.dump();
-    output_->Write(dir_str.data(), dir_str.size());
+    Append(dir_str.data(), dir_str.size());
 
     // Write 32-byte Footer:
     // [2B version][22B reserved][4B meta_entry_size][4B directory_table_size]
@@ -125,7 +246,10 @@ IndexEntryDirectStreamWriter::Finish() {
     milvus::fastmem::FastMemcpy(footer + 24, &meta_size_u32, sizeof(uint32_t));
     milvus::fastmem::FastMemcpy(footer + 28, &dir_size_u32, sizeof(uint32_t));
 
-    output_->Write(footer, MILVUS_V3_FOOTER_SIZE);
+    Append(footer, MILVUS_V3_FOOTER_SIZE);
+    Submit();
+    StopUpload();
+    CheckUploadError();
 
     total_bytes_written_ = MILVUS_V3_MAGIC_SIZE + current_offset_ +
                            dir_str.size() + MILVUS_V3_FOOTER_SIZE;
@@ -16,9 +16,14 @@
 
 #pragma once
 
+#include <condition_variable>
 #include <cstddef>
+#include <deque>
+#include <exception>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "storage/IndexEntryWriter.h"
@@ -26,11 +31,21 @@
 
 namespace milvus::storage {
 
+// Writes the entries to `output` from an upload thread: WriteEntry() copies
+// an entry into buffers of `buffer_size` bytes and returns once they are
+// queued, so the caller serializes the next entries while the previous ones
+// upload. At most `max_buffers` buffers are held, a writer that gets ahead
+// of the upload waits for one to drain.
 class IndexEntryDirectStreamWriter : public IndexEntryWriter {
  public:
+    static constexpr size_t kDefaultMaxBuffers = 4;
+
     explicit IndexEntryDirectStreamWriter(
         std::shared_ptr<milvus::OutputStream> output,
-        size_t read_buf_size = 16 * 1024 * 1024);
+        size_t buffer_size = 16 * 1024 * 1024,
+        size_t max_buffers = kDefaultMaxBuffers);
+
+    ~IndexEntryDirectStreamWriter() override;
 
     void
     WriteEntry(const std::string& name, const void* data, size_t size) override;
@@ -44,8 +59,48 @@ class IndexEntryDirectStreamWriter : public IndexEntryWriter {
     }
 
  private:
+    struct Buffer {
+        std::unique_ptr<char[]> data;
+        size_t size = 0;
+    };
+
+    // copies `size` bytes into the buffers queued for upload
+    void
+    Append(const void* data, size_t size);
+
+    // the buffer being filled, waiting for a free one if none is
+    Buffer&
+    Current();
+
+    // queues the buffer being filled for upload
+    void
+    Submit();
+
+    // waits for the upload thread to write every queued buffer
+    void
+    StopUpload();
+
+    // rethrows the failure of the upload thread, if any
+    void
+    CheckUploadError();
+
+    void
+    UploadLoop();
+
     std::shared_ptr<milvus::OutputStream> output_;
-    std::vector<char> read_buf_;
+    size_t buffer_size_;
+    size_t max_buffers_;
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::vector<Buffer> free_buffers_;
+    std::deque<Buffer> queued_buffers_;
+    size_t allocated_buffers_ = 0;
+    bool stopping_ = false;
+    std::exception_ptr upload_error_;
+    Buffer current_;
+    std::thread uploader_;
+
     std::vector<DirectoryEntry> dir_entries_;
     size_t current_offset_ = 0;
     size_t total_bytes_written_ = 0;
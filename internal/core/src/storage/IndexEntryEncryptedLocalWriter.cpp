@@ -16,7 +16,6 @@
 
 #include "storage/IndexEntryEncryptedLocalWriter.h"
 
-#include <fcntl.h>
 #include <unistd.h>
 #include <cerrno>
 #include <cstring>
@@ -24,9 +23,6 @@
 #include <utility>
 #include <vector>
 
-#include <boost/uuid/random_generator.hpp>
-#include <boost/uuid/uuid_io.hpp>
-
 #include "common/EasyAssert.h"
 #include "common/FastMem.h"
 #include "folly/ScopeGuard.h"
@@ -43,7 +39,6 @@ IndexEntryEncryptedLocalWriter::IndexEntryEncryptedLocalWriter(
     std::shared_ptr<plugin::ICipherPlugin> cipher_plugin,
     int64_t ez_id,
     int64_t collection_id,
-    const std::string& temp_dir,
     size_t slice_size)
     : remote_path_(remote_path),
       fs_(std::move(fs)),
@@ -61,32 +56,13 @@ IndexEntryEncryptedLocalWriter::IndexEntryEncryptedLocalWriter(
         cipher_plugin_->GetEncryptor(ez_id_, collection_id_);
     edek_ = std::move(edek);
 
-    auto uuid = boost::uuids::random_generator()();
-    std::string dir = temp_dir.empty() ? "/tmp" : temp_dir;
-    local_path_ = dir + "/milvus_enc_" + boost::uuids::to_string(uuid);
-
-    local_fd_ = ::open(local_path_.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0600);
-    AssertInfo(
-        local_fd_ != -1, "Failed to create temp file: {}", strerror(errno));
-
-    try {
-        auto written =
-            ::write(local_fd_, MILVUS_V3_MAGIC, MILVUS_V3_MAGIC_SIZE);
-        AssertInfo(written == static_cast<ssize_t>(MILVUS_V3_MAGIC_SIZE),
-                   "Failed to write magic number");
-    } catch (...) {
-        ::close(local_fd_);
-        local_fd_ = -1;
-        ::unlink(local_path_.c_str());
-        throw;
-    }
-}
-
-IndexEntryEncryptedLocalWriter::~IndexEntryEncryptedLocalWriter() {
-    if (local_fd_ != -1) {
-        ::close(local_fd_);
-        ::unlink(local_path_.c_str());
-    }
+    auto result = fs_->OpenOutputStream(remote_path_);
+    AssertInfo(result.ok(),
+               "Failed to open remote output stream: {}",
+               result.status().ToString());
+    output_ =
+        std::make_shared<RemoteOutputStream>(std::move(result.ValueOrDie()));
+    output_->Write(MILVUS_V3_MAGIC, MILVUS_V3_MAGIC_SIZE);
 }
 
 void
@@ -98,12 +74,11 @@ IndexEntryEncryptedLocalWriter::WriteEntry(const std::string& name,
     EncryptAndWriteSlices(name, reinterpret_cast<const uint8_t*>(data), size);
 }
 
-static std::string
-ReadExact(int fd, size_t len) {
-    std::string buf(len, '\0');
+static void
+ReadExact(int fd, uint8_t* dest, size_t len) {
     size_t total_read = 0;
     while (total_read < len) {
-        ssize_t n = ::read(fd, buf.data() + total_read, len - total_read);
+        ssize_t n = ::read(fd, dest + total_read, len - total_read);
         if (n == -1 && errno == EINTR) {
             continue;
         }
@@ -111,7 +86,6 @@ ReadExact(int fd, size_t len) {
             n > 0, "Failed to read from file descriptor: {}", strerror(errno));
         total_read += n;
     }
-    return buf;
 }
 
 void
@@ -120,84 +94,67 @@ IndexEntryEncryptedLocalWriter::WriteEntry(const std::string& name,
                                            size_t size) {
     AssertInfo(!finished_, "Cannot write after Finish() has been called");
     CheckDuplicateName(name);
-
-    std::vector<SliceMeta> slices;
-    const size_t W = std::max(static_cast<size_t>(pool_.GetMaxThreadNum()),
-                              static_cast<size_t>(1));
-    std::deque<std::future<std::string>> pending;
-    size_t remaining = size;
-    uint32_t crc = 0;
-
-    while (remaining > 0 || !pending.empty()) {
-        // Fill the sliding window: read one slice from fd and submit encryption
-        while (pending.size() < W && remaining > 0) {
-            size_t len = std::min(remaining, slice_size_);
-            auto slice_data = ReadExact(fd, len);
-            crc = Crc32cUpdate(
-                crc, reinterpret_cast<const uint8_t*>(slice_data.data()), len);
-            pending.push_back(pool_.Submit([this, s = std::move(slice_data)]() {
-                auto [enc, unused_edek] =
-                    cipher_plugin_->GetEncryptor(ez_id_, collection_id_);
-                return enc->Encrypt(s);
-            }));
-            remaining -= len;
-        }
-        // Drain the oldest completed future
-        if (!pending.empty()) {
-            auto encrypted = pending.front().get();
-            pending.pop_front();
-            auto written =
-                ::write(local_fd_, encrypted.data(), encrypted.size());
-            AssertInfo(written == static_cast<ssize_t>(encrypted.size()),
-                       "Failed to write encrypted slice");
-            slices.push_back(
-                {current_offset_, static_cast<uint64_t>(encrypted.size())});
-            current_offset_ += encrypted.size();
-        }
-    }
-    dir_entries_.push_back(
-        {name, static_cast<uint64_t>(size), crc, std::move(slices)});
+    EncryptAndWriteSlices(name, size, [fd](uint8_t* dest, size_t len) {
+        ReadExact(fd, dest, len);
+    });
 }
 
 void
 IndexEntryEncryptedLocalWriter::EncryptAndWriteSlices(const std::string& name,
                                                       const uint8_t* data,
                                                       size_t size) {
+    size_t read_offset = 0;
+    EncryptAndWriteSlices(
+        name, size, [data, &read_offset](uint8_t* dest, size_t len) {
+            milvus::fastmem::FastMemcpy(dest, data + read_offset, len);
+            read_offset += len;
+        });
+}
+
+void
+IndexEntryEncryptedLocalWriter::EncryptAndWriteSlices(
+    const std::string& name,
+    size_t size,
+    const std::function<void(uint8_t* dest, size_t len)>& read_slice) {
     std::vector<SliceMeta> slices;
     const size_t W = std::max(static_cast<size_t>(pool_.GetMaxThreadNum()),
                               static_cast<size_t>(1));
     std::deque<std::future<std::string>> pending;
+    // the encryption tasks capture `this`, wait for them before unwinding
+    auto drain_pending = folly::makeGuard([&pending]() {
+        for (auto& future : pending) {
+            if (future.valid()) {
+                future.wait();
+            }
+        }
+    });
     size_t remaining = size;
-    size_t read_offset = 0;
     uint32_t crc = 0;
 
     while (remaining > 0 || !pending.empty()) {
+        // keep up to W slices encrypting while the oldest one is uploaded
         while (pending.size() < W && remaining > 0) {
             size_t len = std::min(remaining, slice_size_);
-            crc = Crc32cUpdate(crc, data + read_offset, len);
-            auto slice_data = std::string(
-                reinterpret_cast<const char*>(data + read_offset), len);
+            std::string slice_data(len, '\0');
+            auto* dest = reinterpret_cast<uint8_t*>(slice_data.data());
+            read_slice(dest, len);
+            crc = Crc32cUpdate(crc, dest, len);
             pending.push_back(pool_.Submit([this, s = std::move(slice_data)]() {
                 auto [enc, unused_edek] =
                     cipher_plugin_->GetEncryptor(ez_id_, collection_id_);
                 return enc->Encrypt(s);
             }));
-            read_offset += len;
             remaining -= len;
         }
-        if (!pending.empty()) {
-            auto encrypted = pending.front().get();
-            pending.pop_front();
-            auto written =
-                ::write(local_fd_, encrypted.data(), encrypted.size());
-            AssertInfo(written == static_cast<ssize_t>(encrypted.size()),
-                       "Failed to write encrypted slice");
-            slices.push_back(
-                {current_offset_, static_cast<uint64_t>(encrypted.size())});
-            current_offset_ += encrypted.size();
-        }
+        auto encrypted = pending.front().get();
+        pending.pop_front();
+        output_->Write(encrypted.data(), encrypted.size());
+        slices.push_back(
+            {current_offset_, static_cast<uint64_t>(encrypted.size())});
+        current_offset_ += encrypted.size();
     }
-    dir_entries_.push_back({name, size, crc, std::move(slices)});
+    dir_entries_.push_back(
+        {name, static_cast<uint64_t>(size), crc, std::move(slices)});
 }
 
 void
@@ -237,9 +194,7 @@ IndexEntryEncryptedLocalWriter::Finish() {
     dir_json["__ez_id__"] = std::to_string(ez_id_);
 
     auto dir_str = dir_json.dump();
-    auto written = ::write(local_fd_, dir_str.data(), dir_str.size());
-    AssertInfo(written == static_cast<ssize_t>(dir_str.size()),
-               "Failed to write directory table");
+    output_->Write(dir_str.data(), dir_str.size());
 
     // Write 32-byte Footer
     uint8_t footer[MILVUS_V3_FOOTER_SIZE] = {};
@@ -251,56 +206,12 @@ IndexEntryEncryptedLocalWriter::Finish() {
     milvus::fastmem::FastMemcpy(footer + 24, &meta_size_u32, sizeof(uint32_t));
     milvus::fastmem::FastMemcpy(footer + 28, &dir_size_u32, sizeof(uint32_t));
 
-    written = ::write(local_fd_, footer, MILVUS_V3_FOOTER_SIZE);
-    AssertInfo(written == static_cast<ssize_t>(MILVUS_V3_FOOTER_SIZE),
-               "Failed to write footer");
-
-    ::close(local_fd_);
-    local_fd_ = -1;
+    output_->Write(footer, MILVUS_V3_FOOTER_SIZE);
+    output_->Close();
 
     total_bytes_written_ = MILVUS_V3_MAGIC_SIZE + current_offset_ +
                            dir_str.size() + MILVUS_V3_FOOTER_SIZE;
-
-    auto cleanup_local_file =
-        folly::makeGuard([this]() { ::unlink(local_path_.c_str()); });
-    UploadLocalFile();
-
     finished_ = true;
 }
 
-void
-IndexEntryEncryptedLocalWriter::UploadLocalFile() {
-    auto result = fs_->OpenOutputStream(remote_path_);
-    AssertInfo(result.ok(),
-               "Failed to open remote output stream: {}",
-               result.status().ToString());
-    auto remote_stream =
-        std::make_shared<RemoteOutputStream>(std::move(result.ValueOrDie()));
-
-    int read_fd = ::open(local_path_.c_str(), O_RDONLY);
-    AssertInfo(
-        read_fd != -1, "Failed to open local file for upload: {}", local_path_);
-    auto close_read_fd = folly::makeGuard([read_fd]() { ::close(read_fd); });
-
-    constexpr size_t kBufSize = 16 * 1024 * 1024;
-    std::vector<char> buf(kBufSize);
-    while (true) {
-        ssize_t n = ::read(read_fd, buf.data(), kBufSize);
-        if (n > 0) {
-            remote_stream->Write(buf.data(), n);
-        } else if (n == 0) {
-            break;  // EOF
-        } else {
-            if (errno == EINTR) {
-                continue;
-            }
-            ThrowInfo(ErrorCode::UnexpectedError,
-                      fmt::format("Failed to read local file {}: {}",
-                                  local_path_,
-                                  strerror(errno)));
-        }
-    }
-    remote_stream->Close();
-}
-
 }  // namespace milvus::storage
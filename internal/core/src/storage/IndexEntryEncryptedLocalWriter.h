@@ -19,11 +19,13 @@
 #include <cstddef>
 #include <cstdint>
 #include <deque>
+#include <functional>
 #include <future>
 #include <memory>
 #include <string>
 #include <vector>
 
+#include "filemanager/OutputStream.h"
 #include "storage/IndexEntryWriter.h"
 #include "storage/plugin/PluginInterface.h"
 #include "storage/ThreadPools.h"
@@ -31,6 +33,10 @@
 
 namespace milvus::storage {
 
+// Encrypts entries slice by slice on the MIDDLE pool and streams the
+// ciphertext to the remote file in order while the following slices are
+// still being encrypted, so no plaintext or ciphertext copy of the whole
+// file is staged on local disk.
 class IndexEntryEncryptedLocalWriter : public IndexEntryWriter {
  public:
     IndexEntryEncryptedLocalWriter(
@@ -39,9 +45,8 @@ class IndexEntryEncryptedLocalWriter : public IndexEntryWriter {
         std::shared_ptr<plugin::ICipherPlugin> cipher_plugin,
         int64_t ez_id,
         int64_t collection_id,
-        const std::string& temp_dir = "",
         size_t slice_size = 16 * 1024 * 1024);
-    ~IndexEntryEncryptedLocalWriter();
+    ~IndexEntryEncryptedLocalWriter() = default;
 
     void
     WriteEntry(const std::string& name, const void* data, size_t size) override;
@@ -60,8 +65,13 @@ class IndexEntryEncryptedLocalWriter : public IndexEntryWriter {
                           const uint8_t* data,
                           size_t size);
 
+    // `read_slice(dest, len)` fills the next `len` plaintext bytes of the
+    // entry, up to the pool size of slices are encrypted at once
     void
-    UploadLocalFile();
+    EncryptAndWriteSlices(
+        const std::string& name,
+        size_t size,
+        const std::function<void(uint8_t* dest, size_t len)>& read_slice);
 
     std::string remote_path_;
     milvus_storage::ArrowFileSystemPtr fs_;
@@ -72,8 +82,7 @@ class IndexEntryEncryptedLocalWriter : public IndexEntryWriter {
     size_t slice_size_;
 
     ThreadPool& pool_;
-    std::string local_path_;
-    int local_fd_ = -1;
+    std::shared_ptr<milvus::OutputStream> output_;
     size_t current_offset_ = 0;
     size_t total_bytes_written_ = 0;
     bool finished_ = false;
@@ -16,7 +16,6 @@
 
 #include "storage/IndexEntryReader.h"
 
-#include <fcntl.h>
 #include <unistd.h>
 #include <algorithm>
 #include <cerrno>
@@ -34,6 +33,8 @@
 
 #include "common/EasyAssert.h"
 #include "common/FastMem.h"
+#include "common/Tracepoint.h"
+#include "folly/ScopeGuard.h"
 #include "nlohmann/json.hpp"
 #include "storage/EntryStreamUtils.h"
 #include "storage/Crc32cUtil.h"
@@ -670,141 +671,105 @@ IndexEntryReader::ReadEncryptedEntry(const EntryMeta& meta) {
 }
 
 IndexEntryReader::EntryDownloadState
-IndexEntryReader::PrepareEntryDownload(const std::string& name,
-                                       const std::string& local_path,
-                                       const EntryMeta& meta) {
+IndexEntryReader::PrepareEntryDownload(
+    const std::string& name,
+    const std::string& local_path,
+    const EntryMeta& meta,
+    io::Priority write_priority,
+    size_t state_idx,
+    std::vector<EntryDownloadRange>& ranges) {
     CheckCancelled("IndexEntryReader::PrepareEntryDownload");
     constexpr size_t kRangeSize = 16 * 1024 * 1024;
 
-    int fd = ::open(local_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0600);
-    AssertInfo(fd != -1, "Failed to create file: {}", local_path);
-
     EntryDownloadState state;
     state.name = name;
-    state.fd = fd;
-
-    try {
-        if (meta.encrypted) {
-            state.expected_crc = meta.enc.crc32;
-            state.range_crcs.resize(meta.enc.slices.size());
-            auto trc_ret = ::ftruncate(fd, meta.enc.original_size);
-            AssertInfo(trc_ret == 0,
-                       "Failed to ftruncate file {}: {}",
-                       local_path,
-                       strerror(errno));
-        } else {
-            state.expected_crc = meta.plain.crc32;
-            size_t num_ranges = (meta.plain.size + kRangeSize - 1) / kRangeSize;
-            state.range_crcs.resize(num_ranges);
-        }
-    } catch (...) {
-        ::close(fd);
-        throw;
-    }
-
-    return state;
-}
-
-void
-IndexEntryReader::SubmitEntryDownloadTasks(
-    const EntryMeta& meta,
-    EntryDownloadState& state,
-    std::vector<std::future<void>>& futures) {
-    constexpr size_t kRangeSize = 16 * 1024 * 1024;
-    auto& pool = ThreadPools::GetThreadPool(priority_);
-    auto cancellation_token = cancellation_token_;
 
     if (meta.encrypted) {
         const auto& em = meta.enc;
-        size_t output_offset = 0;
+        state.expected_crc = em.crc32;
+        state.range_crcs.resize(em.slices.size());
+        state.writer = std::make_unique<PositionedFileWriter>(
+            local_path, em.original_size, write_priority, cancellation_token_);
 
+        size_t output_offset = 0;
         for (size_t i = 0; i < em.slices.size(); i++) {
-            const auto& slice = em.slices[i];
-            size_t this_output_offset = output_offset;
-            size_t remaining = em.original_size - output_offset;
-            size_t plain_len = std::min(remaining, slice_size_);
+            AssertInfo(output_offset < em.original_size,
+                       "Encrypted slice {} exceeds original entry size {}",
+                       i,
+                       em.original_size);
+            size_t plain_len =
+                std::min(em.original_size - output_offset, slice_size_);
+            ranges.push_back({state_idx,
+                              i,
+                              true,
+                              em.slices[i].offset,
+                              em.slices[i].size,
+                              output_offset,
+                              plain_len});
             output_offset += plain_len;
-
-            futures.push_back(pool.Submit([this,
-                                           slice,
-                                           fd = state.fd,
-                                           this_output_offset,
-                                           plain_len,
-                                           i,
-                                           &state,
-                                           cancellation_token]() {
-                ThrowIfCancelled(cancellation_token,
-                                 "IndexEntryReader::ReadEntriesToFiles");
-                std::vector<uint8_t> cipher(slice.size);
-                size_t n = input_->ReadAt(cipher.data(),
-                                          MILVUS_V3_MAGIC_SIZE + slice.offset,
-                                          slice.size);
-                ThrowIfCancelled(cancellation_token,
-                                 "IndexEntryReader::ReadEntriesToFiles");
-                AssertInfo(n == slice.size, "Failed to read encrypted slice");
-
-                auto dec =
-                    cipher_plugin_->GetDecryptor(ez_id_, collection_id_, edek_);
-                auto plain = dec->Decrypt(cipher.data(), cipher.size());
-
-                AssertInfo(plain.size() == plain_len,
-                           "Decrypted size mismatch: expected {}, got {}",
-                           plain_len,
-                           plain.size());
-                ThrowIfCancelled(cancellation_token,
-                                 "IndexEntryReader::ReadEntriesToFiles");
-                auto written = ::pwrite(
-                    fd, plain.data(), plain.size(), this_output_offset);
-                AssertInfo(written == static_cast<ssize_t>(plain.size()),
-                           "Failed to pwrite");
-                state.range_crcs[i] = {
-                    Crc32cValue(reinterpret_cast<const uint8_t*>(plain.data()),
-                                plain.size()),
-                    plain.size()};
-            }));
         }
     } else {
         const auto& pm = meta.plain;
-        size_t remaining = pm.size;
-        size_t file_offset = 0;
-        size_t src_offset = pm.offset;
-        size_t range_idx = 0;
-
-        while (remaining > 0) {
-            size_t len = std::min(remaining, kRangeSize);
-            size_t this_file_offset = file_offset;
-            size_t this_src_offset = src_offset;
-            size_t this_range_idx = range_idx;
-
-            futures.push_back(pool.Submit([this,
-                                           this_src_offset,
-                                           len,
-                                           fd = state.fd,
-                                           this_file_offset,
-                                           this_range_idx,
-                                           &state,
-                                           cancellation_token]() {
-                ThrowIfCancelled(cancellation_token,
-                                 "IndexEntryReader::ReadEntriesToFiles");
-                std::vector<uint8_t> buf(len);
-                size_t n = input_->ReadAt(
-                    buf.data(), MILVUS_V3_MAGIC_SIZE + this_src_offset, len);
-                ThrowIfCancelled(cancellation_token,
-                                 "IndexEntryReader::ReadEntriesToFiles");
-                AssertInfo(n == len, "Failed to read data for file");
-                auto written = ::pwrite(fd, buf.data(), len, this_file_offset);
-                AssertInfo(written == static_cast<ssize_t>(len),
-                           "Failed to pwrite");
-                state.range_crcs[this_range_idx] = {
-                    Crc32cValue(buf.data(), len), len};
-            }));
-
-            remaining -= len;
-            file_offset += len;
-            src_offset += len;
-            range_idx++;
+        state.expected_crc = pm.crc32;
+        size_t num_ranges = (pm.size + kRangeSize - 1) / kRangeSize;
+        state.range_crcs.resize(num_ranges);
+        state.writer = std::make_unique<PositionedFileWriter>(
+            local_path, pm.size, write_priority, cancellation_token_);
+
+        for (size_t i = 0; i < num_ranges; i++) {
+            size_t output_offset = i * kRangeSize;
+            size_t len = std::min(pm.size - output_offset, kRangeSize);
+            ranges.push_back({state_idx,
+                              i,
+                              false,
+                              pm.offset + output_offset,
+                              len,
+                              output_offset,
+                              len});
         }
     }
+
+    return state;
+}
+
+void
+IndexEntryReader::DownloadEntryRange(const EntryDownloadRange& range,
+                                     EntryDownloadState& state) {
+    ThrowIfCancelled(cancellation_token_,
+                     "IndexEntryReader::ReadEntriesToFiles");
+    std::vector<uint8_t> buf(range.src_len);
+    MILVUS_TRACEPOINT(index_download_start, range.src_offset, range.src_len);
+    size_t n = input_->ReadAt(
+        buf.data(), MILVUS_V3_MAGIC_SIZE + range.src_offset, range.src_len);
+    MILVUS_TRACEPOINT(index_download_end, range.src_offset, n);
+    ThrowIfCancelled(cancellation_token_,
+                     "IndexEntryReader::ReadEntriesToFiles");
+
+    if (range.encrypted) {
+        AssertInfo(n == range.src_len, "Failed to read encrypted slice");
+        auto dec = cipher_plugin_->GetDecryptor(ez_id_, collection_id_, edek_);
+        auto plain = dec->Decrypt(buf.data(), buf.size());
+        AssertInfo(plain.size() == range.output_len,
+                   "Decrypted size mismatch: expected {}, got {}",
+                   range.output_len,
+                   plain.size());
+        // free the ciphertext before the write, which may stall on a
+        // rate limiter
+        std::vector<uint8_t>().swap(buf);
+        state.range_crcs[range.range_idx] = {
+            Crc32cValue(reinterpret_cast<const uint8_t*>(plain.data()),
+                        plain.size()),
+            plain.size()};
+        ThrowIfCancelled(cancellation_token_,
+                         "IndexEntryReader::ReadEntriesToFiles");
+        state.writer->WriteAt(range.output_offset, plain.data(), plain.size());
+        return;
+    }
+
+    AssertInfo(n == range.src_len, "Failed to read data for file");
+    state.range_crcs[range.range_idx] = {Crc32cValue(buf.data(), buf.size()),
+                                         buf.size()};
+    state.writer->WriteAt(range.output_offset, buf.data(), buf.size());
 }
 
 void
@@ -824,8 +789,8 @@ IndexEntryReader::FinalizeEntryDownload(EntryDownloadState& state) {
                Crc32cToHex(state.expected_crc),
                Crc32cToHex(combined_crc));
 
-    ::close(state.fd);
-    state.fd = -1;
+    state.writer->Finish();
+    state.writer.reset();
 }
 
 IndexEntryReader::EntryStreamDownloadState
@@ -851,14 +816,17 @@ IndexEntryReader::PrepareEntryStreamDownload(const std::string& name,
     if (meta.encrypted) {
         state.expected_crc = meta.enc.crc32;
         state.range_crcs.resize(meta.enc.slices.size());
-        state.writer = std::make_unique<PositionedFileWriter>(
-            local_path, meta.enc.original_size, write_priority);
+        state.writer =
+            std::make_unique<PositionedFileWriter>(local_path,
+                                                   meta.enc.original_size,
+                                                   write_priority,
+                                                   cancellation_token_);
     } else {
         state.expected_crc = meta.plain.crc32;
         state.range_crcs.resize(
             PlainStreamSliceCount(meta.plain.size, slice_size));
         state.writer = std::make_unique<PositionedFileWriter>(
-            local_path, meta.plain.size, write_priority);
+            local_path, meta.plain.size, write_priority, cancellation_token_);
     }
     return state;
 }
@@ -999,80 +967,121 @@ void
 IndexEntryReader::ReadEntryToFile(const std::string& name,
                                   const std::string& local_path) {
     CheckCancelled("IndexEntryReader::ReadEntryToFile");
-    auto it = entry_index_.find(name);
-    AssertInfo(it != entry_index_.end(), "Entry not found: {}", name);
-    const auto& meta = it->second;
-
-    auto state = PrepareEntryDownload(name, local_path, meta);
-    try {
-        std::vector<std::future<void>> futures;
-        SubmitEntryDownloadTasks(meta, state, futures);
-
-        std::exception_ptr first_error = nullptr;
-        DrainFutures(futures, first_error);
-        if (first_error) {
-            std::rethrow_exception(first_error);
-        }
-
-        FinalizeEntryDownload(state);
-    } catch (...) {
-        if (state.fd != -1) {
-            ::close(state.fd);
-        }
-        throw;
-    }
+    ReadEntriesToFiles({{name, local_path}});
 }
 
 void
 IndexEntryReader::ReadEntriesToFiles(
-    const std::vector<std::pair<std::string, std::string>>& name_path_pairs) {
+    const std::vector<std::pair<std::string, std::string>>& name_path_pairs,
+    io::Priority write_priority) {
     CheckCancelled("IndexEntryReader::ReadEntriesToFiles");
     if (name_path_pairs.empty()) {
         return;
     }
 
-    // Prepare all download states
     std::vector<EntryDownloadState> states;
     states.reserve(name_path_pairs.size());
+    std::vector<EntryDownloadRange> ranges;
+    std::vector<size_t> entry_sizes;
+    entry_sizes.reserve(name_path_pairs.size());
+    for (const auto& [name, path] : name_path_pairs) {
+        auto it = entry_index_.find(name);
+        AssertInfo(it != entry_index_.end(), "Entry not found: {}", name);
+        const auto& meta = it->second;
+        entry_sizes.push_back(meta.encrypted ? meta.enc.original_size
+                                             : meta.plain.size);
+        states.push_back(PrepareEntryDownload(
+            name, path, meta, write_priority, states.size(), ranges));
+    }
 
-    // Helper to close all open fds in states
-    auto close_all_fds = [&states]() {
-        for (auto& s : states) {
-            if (s.fd != -1) {
-                ::close(s.fd);
-                s.fd = -1;
+    // Largest entries first: they bound the total time, while the ranges of
+    // small entries fill in behind them. Ranges of an entry stay in order.
+    std::stable_sort(ranges.begin(),
+                     ranges.end(),
+                     [&entry_sizes](const EntryDownloadRange& a,
+                                    const EntryDownloadRange& b) {
+                         return entry_sizes[a.state_idx] >
+                                entry_sizes[b.state_idx];
+                     });
+
+    // Each task releases the budget of its range once the range is written,
+    // so completions are consumed out of order. This thread only blocks on
+    // the budget while none of its own ranges are in flight, and otherwise
+    // waits for its oldest range, so it never waits on budget that only
+    // other callers' queued tasks could return.
+    auto& pool = ThreadPools::GetThreadPool(priority_);
+    auto& budget = TransientMemoryBudget::GetLoadTransientBudget();
+    auto cancellation_token = cancellation_token_;
+    std::deque<std::future<void>> in_flight;
+    std::exception_ptr first_error = nullptr;
+
+    auto waitOldest = [&]() {
+        auto future = std::move(in_flight.front());
+        in_flight.pop_front();
+        try {
+            future.get();
+        } catch (...) {
+            if (!first_error) {
+                first_error = std::current_exception();
             }
         }
     };
 
-    try {
-        for (const auto& [name, path] : name_path_pairs) {
-            auto it = entry_index_.find(name);
-            AssertInfo(it != entry_index_.end(), "Entry not found: {}", name);
-            states.push_back(PrepareEntryDownload(name, path, it->second));
-        }
-
-        // Submit ALL tasks for ALL entries at once (avoids thread pool deadlock)
-        std::vector<std::future<void>> all_futures;
-        for (size_t i = 0; i < name_path_pairs.size(); i++) {
-            const auto& meta = entry_index_.at(name_path_pairs[i].first);
-            SubmitEntryDownloadTasks(meta, states[i], all_futures);
+    for (const auto& range : ranges) {
+        size_t budget_bytes =
+            range.encrypted
+                ? EncryptedStreamBudgetBytes(range.src_len, range.output_len)
+                : range.src_len;
+        while (!first_error && !budget.TryAcquire(budget_bytes)) {
+            if (!in_flight.empty()) {
+                waitOldest();
+                continue;
+            }
+            if (!budget.AcquireUntil(budget_bytes, [&cancellation_token]() {
+                    return cancellation_token.isCancellationRequested();
+                })) {
+                try {
+                    ThrowIfCancelled(cancellation_token,
+                                     "IndexEntryReader::ReadEntriesToFiles");
+                } catch (...) {
+                    first_error = std::current_exception();
+                }
+                continue;
+            }
+            break;
         }
-
-        // Wait for ALL tasks to complete
-        std::exception_ptr first_error = nullptr;
-        DrainFutures(all_futures, first_error);
         if (first_error) {
-            std::rethrow_exception(first_error);
+            break;
         }
 
-        // Verify CRCs and close all file descriptors
-        for (auto& state : states) {
-            FinalizeEntryDownload(state);
+        try {
+            auto& state = states[range.state_idx];
+            in_flight.push_back(pool.Submit(
+                [this, &range, &state, &budget, budget_bytes]() {
+                    auto release_budget =
+                        folly::makeGuard([&budget, budget_bytes]() {
+                            budget.Release(budget_bytes);
+                        });
+                    DownloadEntryRange(range, state);
+                }));
+        } catch (...) {
+            budget.Release(budget_bytes);
+            first_error = std::current_exception();
+            break;
         }
-    } catch (...) {
-        close_all_fds();
-        throw;
+    }
+
+    while (!in_flight.empty()) {
+        waitOldest();
+    }
+    if (first_error) {
+        // the writers close their files as the states go away
+        std::rethrow_exception(first_error);
+    }
+
+    // Verify CRCs and close all files
+    for (auto& state : states) {
+        FinalizeEntryDownload(state);
     }
 }
 
@@ -1082,7 +1091,7 @@ IndexEntryReader::ReadEntryStreamToFile(const std::string& name,
                                         io::Priority write_priority) {
     CheckCancelled("IndexEntryReader::ReadEntryStreamToFile");
     AssertInfo(HasEntry(name), "Entry not found: {}", name);
-    auto writer = FileWriter(local_path, write_priority);
+    auto writer = FileWriter(local_path, write_priority, cancellation_token_);
     ReadEntryStream(name, [&writer](const uint8_t* data, size_t len) {
         writer.Write(data, len);
     });
@@ -62,9 +62,14 @@ class IndexEntryReader {
     void
     ReadEntryToFile(const std::string& name, const std::string& local_path);
 
+    /// Download entries to local files. Ranged reads of all entries share
+    /// the thread pool, the largest entries first, and each range is CRC'd
+    /// and written at its offset as soon as it arrives, in any order. The
+    /// global TransientMemoryBudget bounds the bytes read but not written yet.
     void
-    ReadEntriesToFiles(const std::vector<std::pair<std::string, std::string>>&
-                           name_path_pairs);
+    ReadEntriesToFiles(
+        const std::vector<std::pair<std::string, std::string>>& name_path_pairs,
+        io::Priority write_priority = io::Priority::MIDDLE);
 
     void
     ReadEntryStreamToFile(const std::string& name,
@@ -187,11 +192,23 @@ class IndexEntryReader {
 
     struct EntryDownloadState {
         std::string name;
-        int fd;
+        std::unique_ptr<PositionedFileWriter> writer;
         uint32_t expected_crc;
         std::vector<RangeCrc> range_crcs;
     };
 
+    // One ranged read of an entry, written to its file at `output_offset`
+    struct EntryDownloadRange {
+        size_t state_idx;
+        size_t range_idx;
+        bool encrypted;
+        // offset and size in the packed file, past the magic
+        uint64_t src_offset;
+        size_t src_len;
+        size_t output_offset;
+        size_t output_len;
+    };
+
     struct EntryStreamDownloadState {
         std::string name;
         std::unique_ptr<PositionedFileWriter> writer;
@@ -200,18 +217,21 @@ class IndexEntryReader {
     };
 
     // Prepare download state for an entry (open file, allocate CRC vector)
+    // and append its ranges to `ranges`
     EntryDownloadState
     PrepareEntryDownload(const std::string& name,
                          const std::string& local_path,
-                         const EntryMeta& meta);
+                         const EntryMeta& meta,
+                         io::Priority write_priority,
+                         size_t state_idx,
+                         std::vector<EntryDownloadRange>& ranges);
 
-    // Submit download tasks for an entry to the futures vector (does not wait)
+    // Read, CRC and write one range of an entry
     void
-    SubmitEntryDownloadTasks(const EntryMeta& meta,
-                             EntryDownloadState& state,
-                             std::vector<std::future<void>>& futures);
+    DownloadEntryRange(const EntryDownloadRange& range,
+                       EntryDownloadState& state);
 
-    // Verify CRC and close file descriptor
+    // Verify CRC and close the file
     void
     FinalizeEntryDownload(EntryDownloadState& state);
 
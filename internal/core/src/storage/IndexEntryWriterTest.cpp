@@ -19,6 +19,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <filesystem>
 #include <fstream>
 #include <future>
 #include <limits>
@@ -483,6 +484,40 @@ TEST_F(IndexEntryWriterV3Test, MultipleEntriesRoundtrip) {
     VerifyPattern(data_entry.data, data_size);
 }
 
+TEST_F(IndexEntryWriterV3Test, EntriesLargerThanBufferPoolRoundtrip) {
+    const std::string file_path = kV3FilePath + "_small_pool";
+    const size_t entry_size = 3 * 1024 * 1024 + 17;
+    auto data = GeneratePattern(entry_size);
+
+    std::string tmp_relative = "small_pool_source.bin";
+    std::string tmp_absolute = GetRootPath() + "/" + tmp_relative;
+    {
+        auto tmp_out = CreateOutputStream(tmp_relative);
+        tmp_out->Write(data.data(), data.size());
+        tmp_out->Close();
+    }
+    int fd = ::open(tmp_absolute.c_str(), O_RDONLY);
+    ASSERT_NE(fd, -1) << "Failed to open temp file: " << strerror(errno);
+
+    // two 64KB buffers hold a small part of every entry at a time
+    {
+        auto output = CreateOutputStream(file_path);
+        IndexEntryDirectStreamWriter writer(output, 64 * 1024, 2);
+        writer.WriteEntry("memory_entry", data.data(), data.size());
+        writer.WriteEntry("fd_entry", fd, entry_size);
+        writer.Finish();
+        EXPECT_EQ(static_cast<int64_t>(writer.GetTotalBytesWritten()),
+                  GetFileSize(file_path));
+    }
+    ::close(fd);
+
+    auto input = CreateInputStream(file_path);
+    int64_t file_size = GetFileSize(file_path);
+    auto reader = IndexEntryReader::Open(input, file_size);
+    VerifyPattern(reader->ReadEntry("memory_entry").data, entry_size);
+    VerifyPattern(reader->ReadEntry("fd_entry").data, entry_size);
+}
+
 TEST_F(IndexEntryWriterV3Test, DuplicateNameThrows) {
     const std::string file_path = kV3FilePath + "_dup";
     auto data = GeneratePattern(64);
@@ -817,6 +852,67 @@ TEST_F(IndexEntryWriterV3Test, ReadEntriesToFilesMultiRangeParallel) {
     ::unlink(file_c.c_str());
 }
 
+TEST_F(IndexEntryWriterV3Test, ReadEntriesToFilesBoundsInflightBytes) {
+    IndexEntryStreamConfigGuard guard;
+    const std::string file_path = kV3FilePath + "_bounded_files";
+    const size_t range_size = 16 * 1024 * 1024;
+    const size_t size_a = 2 * range_size;
+    const size_t size_b = 3 * range_size;
+    auto data_a = GeneratePattern(size_a);
+    auto data_b = GeneratePattern(size_b);
+
+    {
+        auto output = CreateOutputStream(file_path);
+        IndexEntryDirectStreamWriter writer(output);
+        writer.WriteEntry("entry_a", data_a.data(), data_a.size());
+        writer.WriteEntry("entry_b", data_b.data(), data_b.size());
+        writer.Finish();
+    }
+
+    std::string file_a = GetRootPath() + "/bounded_a.bin";
+    std::string file_b = GetRootPath() + "/bounded_b.bin";
+    std::vector<std::pair<std::string, std::string>> pairs = {
+        {"entry_a", file_a}, {"entry_b", file_b}};
+
+    auto verify_file = [](const std::string& path, size_t expected_size) {
+        std::ifstream ifs(path, std::ios::binary | std::ios::ate);
+        ASSERT_TRUE(ifs.is_open()) << "Failed to open: " << path;
+        size_t read_size = ifs.tellg();
+        ASSERT_EQ(read_size, expected_size);
+        ifs.seekg(0);
+        std::vector<uint8_t> buf(read_size);
+        ifs.read(reinterpret_cast<char*>(buf.data()), read_size);
+        VerifyPattern(buf, expected_size);
+    };
+
+    int64_t file_size = GetFileSize(file_path);
+    auto read_files = [&](size_t budget_bytes) {
+        milvus::SetLoadTransientBudgetBytes(
+            static_cast<int64_t>(budget_bytes));
+        auto input = std::make_shared<TrackingDelayedInputStream>(
+            CreateInputStream(file_path),
+            range_size,
+            std::chrono::milliseconds(20));
+        auto reader = IndexEntryReader::Open(input, file_size);
+        input->EnableTracking();
+        reader->ReadEntriesToFiles(pairs);
+        verify_file(file_a, size_a);
+        verify_file(file_b, size_b);
+        return input->MaxActiveReads();
+    };
+
+    // a budget of one range keeps a single range in flight
+    EXPECT_EQ(read_files(range_size), 1);
+
+    if (milvus::ThreadPools::GetThreadPool(milvus::ThreadPoolPriority::HIGH)
+            .GetMaxThreadNum() > 1) {
+        EXPECT_GT(read_files(0), 1);
+    }
+
+    ::unlink(file_a.c_str());
+    ::unlink(file_b.c_str());
+}
+
 // =============================================================================
 // Edge Case Tests: Directory Table and Meta Entry size boundaries
 // =============================================================================
@@ -958,7 +1054,6 @@ TEST_F(IndexEntryEncryptedV3Test, EncryptedSmallEntryRoundtrip) {
                                               mock_cipher_,
                                               /*ez_id=*/1,
                                               /*collection_id=*/100,
-                                              GetRootPath(),
                                               slice_size);
         writer.WriteEntry("enc_entry", data.data(), data.size());
         writer.Finish();
@@ -977,7 +1072,6 @@ TEST_F(IndexEntryEncryptedV3Test, EncryptedWriterRejectsUnalignedSliceSize) {
                                                        mock_cipher_,
                                                        /*ez_id=*/1,
                                                        /*collection_id=*/100,
-                                                       GetRootPath(),
                                                        1024),
                  milvus::SegcoreError);
 }
@@ -995,7 +1089,6 @@ TEST_F(IndexEntryEncryptedV3Test, EncryptedMultiSliceEntry) {
                                               mock_cipher_,
                                               /*ez_id=*/1,
                                               /*collection_id=*/100,
-                                              GetRootPath(),
                                               slice_size);
         writer.WriteEntry("large_enc", data.data(), data.size());
         writer.Finish();
@@ -1025,7 +1118,6 @@ TEST_F(IndexEntryEncryptedV3Test, EncryptedMultipleEntriesMultiSlice) {
                                               mock_cipher_,
                                               /*ez_id=*/1,
                                               /*collection_id=*/100,
-                                              GetRootPath(),
                                               slice_size);
         writer.WriteEntry("entry_a", data_a.data(), data_a.size());
         writer.WriteEntry("entry_b", data_b.data(), data_b.size());
@@ -1051,7 +1143,6 @@ TEST_F(IndexEntryEncryptedV3Test, EncryptedLargeMetaMultiSlice) {
                                               mock_cipher_,
                                               /*ez_id=*/1,
                                               /*collection_id=*/100,
-                                              GetRootPath(),
                                               slice_size);
         writer.WriteEntry("data", data.data(), data.size());
 
@@ -1090,7 +1181,6 @@ TEST_F(IndexEntryEncryptedV3Test, EncryptedFdEntryMultiSlice) {
                                               mock_cipher_,
                                               /*ez_id=*/1,
                                               /*collection_id=*/100,
-                                              GetRootPath(),
                                               slice_size);
         writer.WriteEntry("fd_entry", fd, entry_size);
         writer.Finish();
@@ -1104,6 +1194,38 @@ TEST_F(IndexEntryEncryptedV3Test, EncryptedFdEntryMultiSlice) {
     ::unlink(tmp_absolute.c_str());
 }
 
+TEST_F(IndexEntryEncryptedV3Test, EncryptedWriterStreamsWithoutLocalCopy) {
+    const std::string file_path = kV3FilePath + "_enc_streamed";
+    const size_t slice_size = kStreamSliceAlignment;
+    auto data_a = GeneratePattern(7 * slice_size + 3);
+    auto data_b = GeneratePattern(0);
+
+    size_t total_bytes = 0;
+    {
+        IndexEntryEncryptedLocalWriter writer(file_path,
+                                              fs_,
+                                              mock_cipher_,
+                                              /*ez_id=*/1,
+                                              /*collection_id=*/100,
+                                              slice_size);
+        writer.WriteEntry("a", data_a.data(), data_a.size());
+        writer.WriteEntry("b", data_b.data(), data_b.size());
+        writer.Finish();
+        total_bytes = writer.GetTotalBytesWritten();
+    }
+
+    auto info = fs_->GetFileInfo(file_path);
+    ASSERT_TRUE(info.ok());
+    EXPECT_EQ(info.ValueOrDie().size(), total_bytes);
+
+    // the slices were streamed to the remote file, nothing was staged
+    for (const auto& entry :
+         std::filesystem::directory_iterator(GetRootPath())) {
+        EXPECT_EQ(entry.path().filename().string().rfind("milvus_enc_", 0),
+                  std::string::npos);
+    }
+}
+
 // ---- ReadEntryStream tests ----
 
 TEST_F(IndexEntryWriterV3Test, ReadEntryStreamLarge) {
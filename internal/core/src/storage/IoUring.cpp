@@ -0,0 +1,394 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/IoUring.h"
+
+#include <errno.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstring>
+
+#include "common/EasyAssert.h"
+#include "log/Log.h"
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter) && \
+    defined(__NR_io_uring_register)
+#define MILVUS_WITH_IO_URING 1
+#endif
+#endif
+
+namespace milvus::storage::io {
+
+#ifdef MILVUS_WITH_IO_URING
+
+namespace {
+
+unsigned*
+RingField(void* ring, uint32_t offset) {
+    return reinterpret_cast<unsigned*>(static_cast<char*>(ring) + offset);
+}
+
+}  // namespace
+
+std::unique_ptr<IoUring>
+IoUring::Create(unsigned entries) {
+    io_uring_params params;
+    std::memset(&params, 0, sizeof(params));
+    int ring_fd = syscall(__NR_io_uring_setup, entries, &params);
+    if (ring_fd < 0) {
+        return nullptr;
+    }
+
+    std::unique_ptr<IoUring> ring(new IoUring());
+    ring->ring_fd_ = ring_fd;
+    ring->sq_entries_ = params.sq_entries;
+    ring->sq_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    ring->cq_size_ =
+        params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    bool single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (single_mmap) {
+        ring->sq_size_ = ring->cq_size_ =
+            std::max(ring->sq_size_, ring->cq_size_);
+    }
+
+    auto map = [ring_fd](size_t size, off_t offset) -> void* {
+        auto ptr = mmap(nullptr,
+                        size,
+                        PROT_READ | PROT_WRITE,
+                        MAP_SHARED | MAP_POPULATE,
+                        ring_fd,
+                        offset);
+        return ptr == MAP_FAILED ? nullptr : ptr;
+    };
+    ring->sq_ptr_ = map(ring->sq_size_, IORING_OFF_SQ_RING);
+    if (ring->sq_ptr_ == nullptr) {
+        return nullptr;
+    }
+    if (single_mmap) {
+        ring->cq_ptr_ = ring->sq_ptr_;
+    } else {
+        ring->cq_ptr_ = map(ring->cq_size_, IORING_OFF_CQ_RING);
+        if (ring->cq_ptr_ == nullptr) {
+            return nullptr;
+        }
+    }
+    ring->sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+    ring->sqes_ = map(ring->sqes_size_, IORING_OFF_SQES);
+    if (ring->sqes_ == nullptr) {
+        return nullptr;
+    }
+
+    ring->sq_head_ = RingField(ring->sq_ptr_, params.sq_off.head);
+    ring->sq_tail_ = RingField(ring->sq_ptr_, params.sq_off.tail);
+    ring->sq_mask_ = RingField(ring->sq_ptr_, params.sq_off.ring_mask);
+    ring->sq_array_ = RingField(ring->sq_ptr_, params.sq_off.array);
+    ring->cq_head_ = RingField(ring->cq_ptr_, params.cq_off.head);
+    ring->cq_tail_ = RingField(ring->cq_ptr_, params.cq_off.tail);
+    ring->cq_mask_ = RingField(ring->cq_ptr_, params.cq_off.ring_mask);
+    ring->cqes_ = static_cast<char*>(ring->cq_ptr_) + params.cq_off.cqes;
+    return ring;
+}
+
+IoUring::~IoUring() {
+    if (sqes_ != nullptr) {
+        munmap(sqes_, sqes_size_);
+    }
+    if (cq_ptr_ != nullptr && cq_ptr_ != sq_ptr_) {
+        munmap(cq_ptr_, cq_size_);
+    }
+    if (sq_ptr_ != nullptr) {
+        munmap(sq_ptr_, sq_size_);
+    }
+    if (ring_fd_ != -1) {
+        close(ring_fd_);
+    }
+}
+
+bool
+IoUring::RegisterBuffers(const std::vector<iovec>& buffers) {
+    return syscall(__NR_io_uring_register,
+                   ring_fd_,
+                   IORING_REGISTER_BUFFERS,
+                   buffers.data(),
+                   buffers.size()) == 0;
+}
+
+bool
+IoUring::Prepare(uint8_t opcode,
+                 int fd,
+                 const void* buf,
+                 unsigned len,
+                 uint64_t offset,
+                 uint64_t user_data,
+                 int buf_index) {
+    // the tail is only written by us, the head by the kernel
+    auto tail = *sq_tail_;
+    auto head = __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+    // completions are not reaped by the kernel for us: never keep more
+    // requests in flight than the submission queue holds, so the completion
+    // queue (at least as large) can't overflow
+    if (tail - head >= sq_entries_ || in_flight_ >= sq_entries_) {
+        return false;
+    }
+    auto index = tail & *sq_mask_;
+    auto sqe = static_cast<io_uring_sqe*>(sqes_) + index;
+    std::memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = opcode;
+    sqe->fd = fd;
+    sqe->addr = reinterpret_cast<uint64_t>(buf);
+    sqe->len = len;
+    sqe->off = offset;
+    sqe->user_data = user_data;
+    if (buf_index >= 0) {
+        sqe->buf_index = static_cast<uint16_t>(buf_index);
+    }
+    sq_array_[index] = index;
+    __atomic_store_n(sq_tail_, tail + 1, __ATOMIC_RELEASE);
+    ++to_submit_;
+    ++in_flight_;
+    return true;
+}
+
+bool
+IoUring::PrepareWrite(int fd,
+                      const void* buf,
+                      unsigned len,
+                      uint64_t offset,
+                      uint64_t user_data,
+                      int buf_index) {
+    return Prepare(buf_index >= 0 ? IORING_OP_WRITE_FIXED : IORING_OP_WRITE,
+                   fd,
+                   buf,
+                   len,
+                   offset,
+                   user_data,
+                   buf_index);
+}
+
+bool
+IoUring::PrepareRead(
+    int fd, void* buf, unsigned len, uint64_t offset, uint64_t user_data) {
+    return Prepare(IORING_OP_READ, fd, buf, len, offset, user_data, -1);
+}
+
+int
+IoUring::Submit() {
+    while (to_submit_ > 0) {
+        int ret = syscall(
+            __NR_io_uring_enter, ring_fd_, to_submit_, 0, 0, nullptr, 0);
+        if (ret < 0) {
+            if (errno == EINTR || errno == EAGAIN) {
+                continue;
+            }
+            return -errno;
+        }
+        to_submit_ -= std::min<unsigned>(ret, to_submit_);
+    }
+    return 0;
+}
+
+bool
+IoUring::Reap(uint64_t& user_data, int32_t& res, bool wait) {
+    while (true) {
+        // the tail is only written by the kernel, the head by us
+        auto head = *cq_head_;
+        auto tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+        if (head != tail) {
+            auto cqe = static_cast<io_uring_cqe*>(cqes_) + (head & *cq_mask_);
+            user_data = cqe->user_data;
+            res = cqe->res;
+            __atomic_store_n(cq_head_, head + 1, __ATOMIC_RELEASE);
+            --in_flight_;
+            return true;
+        }
+        if (!wait || in_flight_ == 0) {
+            res = 0;
+            return false;
+        }
+        int ret = syscall(__NR_io_uring_enter,
+                          ring_fd_,
+                          to_submit_,
+                          1,
+                          IORING_ENTER_GETEVENTS,
+                          nullptr,
+                          0);
+        if (ret < 0 && errno != EINTR && errno != EAGAIN) {
+            res = -errno;
+            return false;
+        }
+        if (ret > 0) {
+            to_submit_ -= std::min<unsigned>(ret, to_submit_);
+        }
+    }
+}
+
+#else
+
+std::unique_ptr<IoUring>
+IoUring::Create(unsigned entries) {
+    return nullptr;
+}
+
+IoUring::~IoUring() = default;
+
+bool
+IoUring::RegisterBuffers(const std::vector<iovec>& buffers) {
+    return false;
+}
+
+bool
+IoUring::Prepare(uint8_t opcode,
+                 int fd,
+                 const void* buf,
+                 unsigned len,
+                 uint64_t offset,
+                 uint64_t user_data,
+                 int buf_index) {
+    return false;
+}
+
+bool
+IoUring::PrepareWrite(int fd,
+                      const void* buf,
+                      unsigned len,
+                      uint64_t offset,
+                      uint64_t user_data,
+                      int buf_index) {
+    return false;
+}
+
+bool
+IoUring::PrepareRead(
+    int fd, void* buf, unsigned len, uint64_t offset, uint64_t user_data) {
+    return false;
+}
+
+int
+IoUring::Submit() {
+    return -ENOSYS;
+}
+
+bool
+IoUring::Reap(uint64_t& user_data, int32_t& res, bool wait) {
+    res = -ENOSYS;
+    return false;
+}
+
+#endif
+
+bool
+IoUring::IsSupported() {
+    static const bool supported = [] {
+        auto supported = Create(1) != nullptr;
+        LOG_INFO("io_uring is {}supported", supported ? "" : "not ");
+        return supported;
+    }();
+    return supported;
+}
+
+std::optional<size_t>
+IoUringReadAt(int fd,
+              void* buf,
+              size_t size,
+              size_t offset,
+              size_t piece_size) {
+    auto ring = IoUring::Create(32);
+    if (ring == nullptr) {
+        return std::nullopt;
+    }
+    auto dst = static_cast<char*>(buf);
+    auto num_pieces = (size + piece_size - 1) / piece_size;
+    // bytes read by each piece, a short piece marks the end of the file
+    std::vector<size_t> done(num_pieces, 0);
+    size_t next = 0;
+    int failed_errno = 0;
+    while ((next < num_pieces || ring->InFlight() > 0) && failed_errno == 0) {
+        while (next < num_pieces) {
+            auto len = std::min(piece_size, size - next * piece_size);
+            if (!ring->PrepareRead(fd,
+                                   dst + next * piece_size,
+                                   len,
+                                   offset + next * piece_size,
+                                   next)) {
+                break;
+            }
+            ++next;
+        }
+        auto ret = ring->Submit();
+        if (ret < 0) {
+            failed_errno = -ret;
+            break;
+        }
+        uint64_t piece = 0;
+        int32_t res = 0;
+        if (!ring->Reap(piece, res, true)) {
+            failed_errno = res < 0 ? -res : EIO;
+            break;
+        }
+        do {
+            if (res < 0) {
+                failed_errno = -res;
+                break;
+            }
+            done[piece] = res;
+        } while (ring->Reap(piece, res, false));
+    }
+    if (failed_errno != 0) {
+        // drain what is still in flight before the buffer goes away
+        uint64_t piece = 0;
+        int32_t res = 0;
+        while (ring->InFlight() > 0 && ring->Reap(piece, res, true)) {
+        }
+        ThrowInfo(ErrorCode::FileReadFailed,
+                  "Failed to read file with io_uring, error: {}",
+                  strerror(failed_errno));
+    }
+
+    size_t bytes_read = 0;
+    for (size_t piece = 0; piece < num_pieces; ++piece) {
+        auto len = std::min(piece_size, size - piece * piece_size);
+        // a short read is rare but legal, finish the piece synchronously
+        while (done[piece] < len) {
+            auto ret = pread(fd,
+                             dst + piece * piece_size + done[piece],
+                             len - done[piece],
+                             offset + piece * piece_size + done[piece]);
+            if (ret < 0 && errno == EINTR) {
+                continue;
+            }
+            if (ret < 0) {
+                ThrowInfo(ErrorCode::FileReadFailed,
+                          "Failed to read file, error: {}",
+                          strerror(errno));
+            }
+            if (ret == 0) {
+                break;
+            }
+            done[piece] += ret;
+        }
+        bytes_read += done[piece];
+        if (done[piece] < len) {
+            break;
+        }
+    }
+    return bytes_read;
+}
+
+}  // namespace milvus::storage::io
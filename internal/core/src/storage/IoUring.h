@@ -0,0 +1,143 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <sys/uio.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace milvus::storage::io {
+
+/**
+ * IoUring is a minimal io_uring instance driven through the raw syscalls, so
+ * that no liburing is needed. It queues reads and writes, submits them in one
+ * io_uring_enter, and reaps completions from the shared completion ring
+ * without a syscall when they are already there.
+ *
+ * An IoUring is owned by one thread at a time and is not thread-safe.
+ * Create returns nullptr where io_uring is unavailable, e.g. a non-Linux
+ * build, an old kernel or a seccomp profile that blocks it; callers then
+ * fall back to blocking pread/pwrite.
+ */
+class IoUring {
+ public:
+    static std::unique_ptr<IoUring>
+    Create(unsigned entries);
+
+    // Whether Create succeeds on this host, probed once.
+    static bool
+    IsSupported();
+
+    ~IoUring();
+
+    IoUring(const IoUring&) = delete;
+    IoUring&
+    operator=(const IoUring&) = delete;
+
+    // Registers `buffers` with the kernel for PrepareWrite with a buffer
+    // index, which skips pinning the pages on every write. Returns false if
+    // the kernel refuses, e.g. over RLIMIT_MEMLOCK.
+    bool
+    RegisterBuffers(const std::vector<iovec>& buffers);
+
+    // Queue a write or read of `len` bytes at `offset`, returning false if
+    // the submission queue is full. `buf_index` selects a registered buffer
+    // that `buf` lies in, -1 for none.
+    bool
+    PrepareWrite(int fd,
+                 const void* buf,
+                 unsigned len,
+                 uint64_t offset,
+                 uint64_t user_data,
+                 int buf_index = -1);
+
+    bool
+    PrepareRead(
+        int fd, void* buf, unsigned len, uint64_t offset, uint64_t user_data);
+
+    // Submits the queued requests. Returns 0 or a negative errno.
+    int
+    Submit();
+
+    // Pops a completion, waiting for one if `wait` is set and none is ready.
+    // Returns false when there is none (or on error, with `res` set to the
+    // negative errno).
+    bool
+    Reap(uint64_t& user_data, int32_t& res, bool wait);
+
+    // requests submitted or queued whose completion was not reaped yet
+    unsigned
+    InFlight() const {
+        return in_flight_;
+    }
+
+    // requests queued but not submitted yet
+    unsigned
+    Queued() const {
+        return to_submit_;
+    }
+
+    unsigned
+    Entries() const {
+        return sq_entries_;
+    }
+
+ private:
+    IoUring() = default;
+
+    bool
+    Prepare(uint8_t opcode,
+            int fd,
+            const void* buf,
+            unsigned len,
+            uint64_t offset,
+            uint64_t user_data,
+            int buf_index);
+
+    int ring_fd_{-1};
+    void* sq_ptr_{nullptr};
+    size_t sq_size_{0};
+    void* cq_ptr_{nullptr};
+    size_t cq_size_{0};
+    void* sqes_{nullptr};
+    size_t sqes_size_{0};
+
+    unsigned* sq_head_{nullptr};
+    unsigned* sq_tail_{nullptr};
+    unsigned* sq_mask_{nullptr};
+    unsigned* sq_array_{nullptr};
+    unsigned* cq_head_{nullptr};
+    unsigned* cq_tail_{nullptr};
+    unsigned* cq_mask_{nullptr};
+    void* cqes_{nullptr};
+    unsigned sq_entries_{0};
+
+    unsigned to_submit_{0};
+    unsigned in_flight_{0};
+};
+
+// Reads `size` bytes at `offset` of `fd` into `buf` as `piece_size` reads
+// kept in flight together. Returns the bytes read, which are short only at
+// the end of the file, or nullopt if io_uring is unavailable. Throws
+// FileReadFailed on an I/O error.
+std::optional<size_t>
+IoUringReadAt(int fd, void* buf, size_t size, size_t offset, size_t piece_size);
+
+}  // namespace milvus::storage::io
@@ -19,6 +19,8 @@
 #include "boost/filesystem/directory.hpp"
 #include "log/Log.h"
 
+#include <fcntl.h>
+#include <unistd.h>
 #include <boost/filesystem.hpp>
 #include <boost/system/error_code.hpp>
 #include <fstream>
@@ -26,6 +28,9 @@
 
 #include "common/EasyAssert.h"
 #include "common/Exception.h"
+#include "folly/ScopeGuard.h"
+#include "storage/FileWriter.h"
+#include "storage/IoUring.h"
 
 namespace milvus::storage {
 
@@ -93,6 +98,25 @@ LocalChunkManager::Read(const std::string& filepath,
                         uint64_t offset,
                         void* buf,
                         uint64_t size) {
+    // with io_uring writes, large reads are also split into reads that are
+    // kept in flight together
+    if (FileWriter::GetMode() == FileWriter::WriteMode::IO_URING &&
+        size > FileWriter::GetBufferSize() && io::IoUring::IsSupported()) {
+        int fd = open(filepath.c_str(), O_RDONLY);
+        if (fd == -1) {
+            ThrowInfo(FileOpenFailed,
+                      "Error: open local file '{}' failed, {}",
+                      filepath,
+                      strerror(errno));
+        }
+        auto close_fd = folly::makeGuard([fd]() { close(fd); });
+        auto bytes_read = io::IoUringReadAt(
+            fd, buf, size, offset, FileWriter::GetBufferSize());
+        if (bytes_read.has_value()) {
+            return bytes_read.value();
+        }
+    }
+
     std::ifstream infile;
     infile.open(filepath.data(), std::ios_base::binary);
     if (infile.fail()) {
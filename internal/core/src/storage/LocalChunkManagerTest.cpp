@@ -13,12 +13,15 @@
 #include <stdint.h>
 #include <stdlib.h>
 #include <time.h>
+#include <algorithm>
 #include <iostream>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include "storage/ChunkManager.h"
+#include "storage/FileWriter.h"
 #include "storage/LocalChunkManager.h"
 #include "storage/LocalChunkManagerSingleton.h"
 
@@ -222,6 +225,34 @@ TEST_F(LocalChunkManagerTest, ReadOffset) {
     EXPECT_EQ(exist, false);
 }
 
+TEST_F(LocalChunkManagerTest, ReadOffsetWithIoUring) {
+    auto lcm = LocalChunkManagerSingleton::GetInstance().GetChunkManager();
+    string test_dir = lcm->GetRootPath() + "/local-test-dir";
+    string file = test_dir + "/test-read-io-uring";
+    lcm->CreateFile(file);
+
+    // several buffers, so the read is split into pieces kept in flight
+    std::vector<uint8_t> data(10 * 4096 + 123);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<uint8_t>(i * 31 + 7);
+    }
+    lcm->Write(file, data.data(), data.size());
+
+    auto mode = FileWriter::GetMode();
+    auto buffer_size = FileWriter::GetBufferSize();
+    FileWriter::SetMode(FileWriter::WriteMode::IO_URING);
+    FileWriter::SetBufferSize(4096);
+
+    std::vector<uint8_t> read_data(data.size());
+    auto size = lcm->Read(file, 5, read_data.data(), data.size());
+    EXPECT_EQ(size, data.size() - 5);
+    EXPECT_TRUE(std::equal(data.begin() + 5, data.end(), read_data.begin()));
+
+    FileWriter::SetMode(mode);
+    FileWriter::SetBufferSize(buffer_size);
+    lcm->RemoveDir(test_dir);
+}
+
 TEST_F(LocalChunkManagerTest, GetSizeOfDir) {
     auto lcm = LocalChunkManagerSingleton::GetInstance().GetChunkManager();
     auto test_dir = lcm->GetRootPath() + "/local-test-dir";
@@ -0,0 +1,433 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/LocalObjectCache.h"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <utility>
+
+#include "common/EasyAssert.h"
+#include "fmt/format.h"
+#include "folly/ScopeGuard.h"
+#include "log/Log.h"
+#include "xxhash.h"
+
+namespace milvus::storage {
+
+namespace {
+
+constexpr uint32_t kCacheFileMagic = 0x314f434d;  // "MOC1"
+constexpr const char* kCacheFileSuffix = ".obj";
+constexpr const char* kTmpFileSuffix = ".tmp";
+
+std::shared_ptr<LocalObjectCache> global_cache = nullptr;
+std::mutex global_cache_mutex;
+
+bool
+ReadFully(int fd, void* buf, size_t len, off_t offset) {
+    auto dst = static_cast<char*>(buf);
+    while (len > 0) {
+        auto ret = ::pread(fd, dst, len, offset);
+        if (ret < 0 && errno == EINTR) {
+            continue;
+        }
+        if (ret <= 0) {
+            return false;
+        }
+        dst += ret;
+        len -= ret;
+        offset += ret;
+    }
+    return true;
+}
+
+bool
+WriteFully(int fd, const void* buf, size_t len) {
+    auto src = static_cast<const char*>(buf);
+    while (len > 0) {
+        auto ret = ::write(fd, src, len);
+        if (ret < 0 && errno == EINTR) {
+            continue;
+        }
+        if (ret <= 0) {
+            return false;
+        }
+        src += ret;
+        len -= ret;
+    }
+    return true;
+}
+
+size_t
+HeaderSize(const std::string& key) {
+    return 2 * sizeof(uint32_t) + key.size();
+}
+
+// Reads the key from the header of the cache file `fd`, empty if the file
+// is not a cache file.
+std::string
+ReadHeaderKey(int fd) {
+    uint32_t header[2];
+    if (!ReadFully(fd, header, sizeof(header), 0) ||
+        header[0] != kCacheFileMagic) {
+        return "";
+    }
+    std::string key(header[1], '\0');
+    if (!ReadFully(fd, key.data(), key.size(), sizeof(header))) {
+        return "";
+    }
+    return key;
+}
+
+// The remote path of a cache key, see MakeKey.
+std::string
+PathOfKey(const std::string& key) {
+    auto end = key.find('\n');
+    return end == std::string::npos ? "" : key.substr(0, end);
+}
+
+}  // namespace
+
+LocalObjectCache::LocalObjectCache(std::string root, uint64_t capacity_bytes)
+    : root_(std::move(root)), capacity_bytes_(capacity_bytes) {
+    std::error_code ec;
+    std::filesystem::create_directories(root_, ec);
+    AssertInfo(!ec,
+               "Failed to create local object cache directory {}: {}",
+               root_,
+               ec.message());
+    Recover();
+}
+
+std::shared_ptr<LocalObjectCache>
+LocalObjectCache::Global() {
+    std::lock_guard<std::mutex> lock(global_cache_mutex);
+    return global_cache;
+}
+
+void
+LocalObjectCache::InitGlobal(const std::string& root, uint64_t capacity_bytes) {
+    std::shared_ptr<LocalObjectCache> cache = nullptr;
+    if (capacity_bytes > 0) {
+        cache = std::make_shared<LocalObjectCache>(root, capacity_bytes);
+    }
+    std::lock_guard<std::mutex> lock(global_cache_mutex);
+    global_cache = std::move(cache);
+}
+
+std::string
+LocalObjectCache::MakeKey(const std::string& path,
+                          const ObjectVersion& version) {
+    return fmt::format("{}\n{}\n{}", path, version.size, version.etag);
+}
+
+void
+LocalObjectCache::Recover() {
+    struct Found {
+        std::filesystem::file_time_type mtime;
+        std::string key;
+        std::string file;
+        uint64_t bytes;
+    };
+    std::vector<Found> found;
+    std::error_code ec;
+    for (const auto& dirent : std::filesystem::directory_iterator(root_, ec)) {
+        if (!dirent.is_regular_file(ec)) {
+            continue;
+        }
+        auto file = dirent.path().string();
+        if (dirent.path().extension() != kCacheFileSuffix) {
+            // copies a crashed process did not publish
+            if (dirent.path().extension() == kTmpFileSuffix) {
+                std::filesystem::remove(dirent.path(), ec);
+            }
+            continue;
+        }
+        int fd = ::open(file.c_str(), O_RDONLY);
+        if (fd == -1) {
+            continue;
+        }
+        auto key = ReadHeaderKey(fd);
+        ::close(fd);
+        auto file_size = dirent.file_size(ec);
+        if (key.empty() || ec || file_size < HeaderSize(key)) {
+            std::filesystem::remove(dirent.path(), ec);
+            continue;
+        }
+        auto bytes = file_size - HeaderSize(key);
+        found.push_back(Found{dirent.last_write_time(ec),
+                              std::move(key),
+                              std::move(file),
+                              bytes});
+    }
+    std::sort(found.begin(), found.end(), [](const Found& a, const Found& b) {
+        return a.mtime < b.mtime;
+    });
+
+    std::vector<std::string> unlinked;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& entry : found) {
+            auto path = PathOfKey(entry.key);
+            auto it = entries_.find(path);
+            if (it != entries_.end()) {
+                // an older version of the same object
+                EraseLocked(it->second, unlinked);
+            }
+            used_bytes_ += entry.bytes;
+            lru_.emplace_front(path,
+                               Entry{std::move(entry.key),
+                                     std::move(entry.file),
+                                     entry.bytes});
+            entries_[path] = lru_.begin();
+        }
+        while (used_bytes_ > capacity_bytes_ && !lru_.empty()) {
+            EraseLocked(std::prev(lru_.end()), unlinked);
+        }
+    }
+    for (auto& file : unlinked) {
+        ::unlink(file.c_str());
+    }
+    LOG_INFO(
+        "Local object cache at {} recovered {} objects of {} bytes, "
+        "capacity {} bytes",
+        root_,
+        GetEntryCount(),
+        GetUsedBytes(),
+        capacity_bytes_);
+}
+
+bool
+LocalObjectCache::Read(const std::string& path,
+                       const ObjectVersion& version,
+                       uint64_t offset,
+                       void* buf,
+                       uint64_t len) {
+    auto key = MakeKey(path, version);
+    std::string file;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = entries_.find(path);
+        if (it == entries_.end() || it->second->second.key != key ||
+            offset + len > it->second->second.bytes) {
+            return false;
+        }
+        file = it->second->second.file;
+        lru_.splice(lru_.begin(), lru_, it->second);
+    }
+
+    // an evicted file stays readable through a descriptor opened before
+    int fd = ::open(file.c_str(), O_RDONLY);
+    if (fd == -1) {
+        Remove(path);
+        return false;
+    }
+    auto close_fd = folly::makeGuard([fd]() { ::close(fd); });
+    if (ReadHeaderKey(fd) != key ||
+        !ReadFully(fd, buf, len, HeaderSize(key) + offset)) {
+        LOG_WARN("Drop corrupted local object cache file {} of {}", file, path);
+        Remove(path);
+        return false;
+    }
+    // the modification time orders the copies after a restart
+    ::futimens(fd, nullptr);
+    return true;
+}
+
+void
+LocalObjectCache::Put(const std::string& path,
+                      const ObjectVersion& version,
+                      const void* data,
+                      uint64_t len) {
+    if (len != version.size || len > capacity_bytes_) {
+        return;
+    }
+    auto key = MakeKey(path, version);
+    auto name =
+        fmt::format("{:016x}", XXH64(key.data(), key.size(), 0));
+    auto file = fmt::format("{}/{}{}", root_, name, kCacheFileSuffix);
+    auto tmp_file = fmt::format(
+        "{}/{}.{}{}", root_, name, next_tmp_id_.fetch_add(1), kTmpFileSuffix);
+
+    int fd = ::open(tmp_file.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0600);
+    if (fd == -1) {
+        LOG_WARN("Failed to create local object cache file {}: {}",
+                 tmp_file,
+                 strerror(errno));
+        return;
+    }
+    uint32_t header[2] = {kCacheFileMagic, static_cast<uint32_t>(key.size())};
+    bool written = WriteFully(fd, header, sizeof(header)) &&
+                   WriteFully(fd, key.data(), key.size()) &&
+                   WriteFully(fd, data, len);
+    ::close(fd);
+    if (!written || ::rename(tmp_file.c_str(), file.c_str()) != 0) {
+        LOG_WARN("Failed to write local object cache file {}: {}",
+                 file,
+                 strerror(errno));
+        ::unlink(tmp_file.c_str());
+        return;
+    }
+
+    std::vector<std::string> unlinked;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = entries_.find(path);
+        if (it != entries_.end()) {
+            if (it->second->second.file == file) {
+                // the rename replaced this very copy
+                auto lru_it = it->second;
+                used_bytes_ -= lru_it->second.bytes;
+                entries_.erase(it);
+                lru_.erase(lru_it);
+            } else {
+                EraseLocked(it->second, unlinked);
+            }
+        }
+        while (used_bytes_ + len > capacity_bytes_ && !lru_.empty()) {
+            EraseLocked(std::prev(lru_.end()), unlinked);
+        }
+        used_bytes_ += len;
+        lru_.emplace_front(path, Entry{std::move(key), file, len});
+        entries_[path] = lru_.begin();
+    }
+    for (auto& victim : unlinked) {
+        ::unlink(victim.c_str());
+    }
+}
+
+void
+LocalObjectCache::Remove(const std::string& path) {
+    std::vector<std::string> unlinked;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = entries_.find(path);
+        if (it == entries_.end()) {
+            return;
+        }
+        EraseLocked(it->second, unlinked);
+    }
+    for (auto& file : unlinked) {
+        ::unlink(file.c_str());
+    }
+}
+
+uint64_t
+LocalObjectCache::GetUsedBytes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return used_bytes_;
+}
+
+size_t
+LocalObjectCache::GetEntryCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+}
+
+void
+LocalObjectCache::EraseLocked(LruList::iterator it,
+                              std::vector<std::string>& unlinked) {
+    used_bytes_ -= it->second.bytes;
+    unlinked.push_back(std::move(it->second.file));
+    entries_.erase(it->first);
+    lru_.erase(it);
+}
+
+CachingChunkManager::CachingChunkManager(
+    ChunkManagerPtr remote, std::shared_ptr<LocalObjectCache> cache)
+    : remote_(std::move(remote)), cache_(std::move(cache)) {
+    AssertInfo(remote_ != nullptr && cache_ != nullptr,
+               "CachingChunkManager needs a remote chunk manager and a cache");
+}
+
+bool
+CachingChunkManager::Exist(const std::string& filepath) {
+    return remote_->Exist(filepath);
+}
+
+uint64_t
+CachingChunkManager::Size(const std::string& filepath) {
+    return remote_->Size(filepath);
+}
+
+ObjectVersion
+CachingChunkManager::GetObjectVersion(const std::string& filepath) {
+    return remote_->GetObjectVersion(filepath);
+}
+
+uint64_t
+CachingChunkManager::Read(const std::string& filepath,
+                          void* buf,
+                          uint64_t len) {
+    auto version = remote_->GetObjectVersion(filepath);
+    if (len == version.size && cache_->Read(filepath, version, 0, buf, len)) {
+        return len;
+    }
+    auto bytes_read = remote_->Read(filepath, buf, len);
+    // only whole objects are cached
+    if (bytes_read == version.size) {
+        cache_->Put(filepath, version, buf, bytes_read);
+    }
+    return bytes_read;
+}
+
+uint64_t
+CachingChunkManager::Read(const std::string& filepath,
+                          uint64_t offset,
+                          void* buf,
+                          uint64_t len) {
+    auto version = remote_->GetObjectVersion(filepath);
+    if (cache_->Read(filepath, version, offset, buf, len)) {
+        return len;
+    }
+    return remote_->Read(filepath, offset, buf, len);
+}
+
+void
+CachingChunkManager::Write(const std::string& filepath,
+                           void* buf,
+                           uint64_t len) {
+    cache_->Remove(filepath);
+    remote_->Write(filepath, buf, len);
+}
+
+void
+CachingChunkManager::Write(const std::string& filepath,
+                           uint64_t offset,
+                           void* buf,
+                           uint64_t len) {
+    cache_->Remove(filepath);
+    remote_->Write(filepath, offset, buf, len);
+}
+
+std::vector<std::string>
+CachingChunkManager::ListWithPrefix(const std::string& filepath) {
+    return remote_->ListWithPrefix(filepath);
+}
+
+void
+CachingChunkManager::Remove(const std::string& filepath) {
+    cache_->Remove(filepath);
+    remote_->Remove(filepath);
+}
+
+}  // namespace milvus::storage
@@ -0,0 +1,193 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "storage/ChunkManager.h"
+
+namespace milvus::storage {
+
+// Persistent local disk cache of whole remote objects.
+//
+// An object is cached under its remote path together with its version, the
+// size and the ETag the object store reports, so a cached copy is only
+// served while the remote object is unchanged. Each copy is one file under
+// `root` that starts with a header holding the full key; the file name is
+// just a hash of the key. Files are published by a rename, so a crash never
+// leaves a partial copy that looks valid, and a cache created on an existing
+// root picks up every copy left there, which turns the loads after a
+// restart into local reads.
+//
+// The least recently used copies are evicted to stay within
+// `capacity_bytes`.
+//
+// Thread safety: All methods are thread-safe.
+class LocalObjectCache {
+ public:
+    LocalObjectCache(std::string root, uint64_t capacity_bytes);
+
+    LocalObjectCache(const LocalObjectCache&) = delete;
+    LocalObjectCache&
+    operator=(const LocalObjectCache&) = delete;
+
+    // The process-wide cache, nullptr unless InitGlobal enabled one.
+    static std::shared_ptr<LocalObjectCache>
+    Global();
+
+    // Creates the process-wide cache, 0 capacity disables it.
+    static void
+    InitGlobal(const std::string& root, uint64_t capacity_bytes);
+
+    // Reads `len` bytes at `offset` of the cached copy of `path` into `buf`.
+    // Returns false, reading nothing, if no copy of `version` is cached.
+    bool
+    Read(const std::string& path,
+         const ObjectVersion& version,
+         uint64_t offset,
+         void* buf,
+         uint64_t len);
+
+    // Caches `data` as the copy of `path` at `version`, replacing an older
+    // one. Objects larger than the capacity are not cached. Failures to
+    // write only cost the copy.
+    void
+    Put(const std::string& path,
+        const ObjectVersion& version,
+        const void* data,
+        uint64_t len);
+
+    // Drops the copy of `path`, if any.
+    void
+    Remove(const std::string& path);
+
+    uint64_t
+    GetUsedBytes() const;
+
+    size_t
+    GetEntryCount() const;
+
+    const std::string&
+    GetRoot() const {
+        return root_;
+    }
+
+ private:
+    struct Entry {
+        std::string key;
+        std::string file;
+        uint64_t bytes;
+    };
+
+    using LruList = std::list<std::pair<std::string, Entry>>;
+
+    static std::string
+    MakeKey(const std::string& path, const ObjectVersion& version);
+
+    // Indexes the copies already under root_, oldest first.
+    void
+    Recover();
+
+    void
+    EraseLocked(LruList::iterator it, std::vector<std::string>& unlinked);
+
+    std::string root_;
+    uint64_t capacity_bytes_;
+    std::atomic<uint64_t> next_tmp_id_{0};
+
+    mutable std::mutex mutex_;
+    uint64_t used_bytes_{0};
+    // most recently used first, by remote path
+    LruList lru_;
+    std::unordered_map<std::string, LruList::iterator> entries_;
+};
+
+// ChunkManager serving the whole-object reads of `remote` from a
+// LocalObjectCache. Every read checks the object version with `remote`
+// first, which costs a metadata request but never serves a stale copy;
+// writes and removes go to `remote` and drop the cached copy.
+class CachingChunkManager : public ChunkManager {
+ public:
+    CachingChunkManager(ChunkManagerPtr remote,
+                        std::shared_ptr<LocalObjectCache> cache);
+
+    bool
+    Exist(const std::string& filepath) override;
+
+    uint64_t
+    Size(const std::string& filepath) override;
+
+    ObjectVersion
+    GetObjectVersion(const std::string& filepath) override;
+
+    uint64_t
+    Read(const std::string& filepath, void* buf, uint64_t len) override;
+
+    void
+    Write(const std::string& filepath, void* buf, uint64_t len) override;
+
+    uint64_t
+    Read(const std::string& filepath,
+         uint64_t offset,
+         void* buf,
+         uint64_t len) override;
+
+    void
+    Write(const std::string& filepath,
+          uint64_t offset,
+          void* buf,
+          uint64_t len) override;
+
+    std::vector<std::string>
+    ListWithPrefix(const std::string& filepath) override;
+
+    void
+    Remove(const std::string& filepath) override;
+
+    std::string
+    GetName() const override {
+        return remote_->GetName();
+    }
+
+    std::string
+    GetRootPath() const override {
+        return remote_->GetRootPath();
+    }
+
+    std::string
+    GetBucketName() const override {
+        return remote_->GetBucketName();
+    }
+
+    const ChunkManagerPtr&
+    GetRemote() const {
+        return remote_;
+    }
+
+ private:
+    ChunkManagerPtr remote_;
+    std::shared_ptr<LocalObjectCache> cache_;
+};
+
+}  // namespace milvus::storage
@@ -0,0 +1,267 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "storage/LocalObjectCache.h"
+
+using namespace milvus::storage;
+
+namespace {
+
+// In-memory remote storage counting the reads that reach it.
+class FakeRemoteChunkManager : public ChunkManager {
+ public:
+    bool
+    Exist(const std::string& filepath) override {
+        return objects_.count(filepath) > 0;
+    }
+
+    uint64_t
+    Size(const std::string& filepath) override {
+        return objects_.at(filepath).data.size();
+    }
+
+    ObjectVersion
+    GetObjectVersion(const std::string& filepath) override {
+        auto& object = objects_.at(filepath);
+        return ObjectVersion{object.data.size(), object.etag};
+    }
+
+    uint64_t
+    Read(const std::string& filepath, void* buf, uint64_t len) override {
+        return Read(filepath, 0, buf, len);
+    }
+
+    void
+    Write(const std::string& filepath, void* buf, uint64_t len) override {
+        auto& object = objects_[filepath];
+        object.data.assign(static_cast<char*>(buf),
+                           static_cast<char*>(buf) + len);
+        object.etag = std::to_string(++next_etag_);
+    }
+
+    uint64_t
+    Read(const std::string& filepath,
+         uint64_t offset,
+         void* buf,
+         uint64_t len) override {
+        ++reads_;
+        auto& data = objects_.at(filepath).data;
+        len = std::min<uint64_t>(len, data.size() - offset);
+        std::memcpy(buf, data.data() + offset, len);
+        return len;
+    }
+
+    void
+    Write(const std::string& filepath,
+          uint64_t offset,
+          void* buf,
+          uint64_t len) override {
+        Write(filepath, buf, len);
+    }
+
+    std::vector<std::string>
+    ListWithPrefix(const std::string& filepath) override {
+        return {};
+    }
+
+    void
+    Remove(const std::string& filepath) override {
+        objects_.erase(filepath);
+    }
+
+    std::string
+    GetName() const override {
+        return "FakeRemoteChunkManager";
+    }
+
+    std::string
+    GetRootPath() const override {
+        return "";
+    }
+
+    std::string
+    GetBucketName() const override {
+        return "";
+    }
+
+    int reads_{0};
+
+ private:
+    struct Object {
+        std::vector<char> data;
+        std::string etag;
+    };
+    std::map<std::string, Object> objects_;
+    int next_etag_{0};
+};
+
+std::string
+ReadAll(ChunkManager& cm, const std::string& path) {
+    std::string data(cm.Size(path), '\0');
+    EXPECT_EQ(cm.Read(path, data.data(), data.size()), data.size());
+    return data;
+}
+
+}  // namespace
+
+class LocalObjectCacheTest : public testing::Test {
+ protected:
+    void
+    SetUp() override {
+        root_ = std::filesystem::temp_directory_path() /
+                ("local-object-cache-test-" + std::to_string(::getpid()));
+        std::filesystem::remove_all(root_);
+        remote_ = std::make_shared<FakeRemoteChunkManager>();
+    }
+
+    void
+    TearDown() override {
+        std::filesystem::remove_all(root_);
+    }
+
+    void
+    Put(const std::string& path, std::string data) {
+        remote_->Write(path, data.data(), data.size());
+    }
+
+    std::filesystem::path root_;
+    std::shared_ptr<FakeRemoteChunkManager> remote_;
+};
+
+TEST_F(LocalObjectCacheTest, ServesRepeatedReadsLocally) {
+    auto cache = std::make_shared<LocalObjectCache>(root_.string(), 1 << 20);
+    CachingChunkManager cm(remote_, cache);
+    Put("a/1", "hello world");
+
+    EXPECT_EQ(ReadAll(cm, "a/1"), "hello world");
+    EXPECT_EQ(remote_->reads_, 1);
+    EXPECT_EQ(ReadAll(cm, "a/1"), "hello world");
+    EXPECT_EQ(remote_->reads_, 1);
+    EXPECT_EQ(cache->GetEntryCount(), 1);
+    EXPECT_EQ(cache->GetUsedBytes(), 11);
+
+    char part[5];
+    EXPECT_EQ(cm.Read("a/1", 6, part, sizeof(part)), sizeof(part));
+    EXPECT_EQ(std::string(part, sizeof(part)), "world");
+    EXPECT_EQ(remote_->reads_, 1);
+}
+
+TEST_F(LocalObjectCacheTest, ChangedObjectsAreReadAgain) {
+    auto cache = std::make_shared<LocalObjectCache>(root_.string(), 1 << 20);
+    CachingChunkManager cm(remote_, cache);
+    Put("a/1", "first");
+    EXPECT_EQ(ReadAll(cm, "a/1"), "first");
+
+    // same size, new ETag, written behind the cache's back
+    Put("a/1", "other");
+    EXPECT_EQ(ReadAll(cm, "a/1"), "other");
+    EXPECT_EQ(remote_->reads_, 2);
+    EXPECT_EQ(cache->GetEntryCount(), 1);
+
+    std::string data = "third";
+    cm.Write("a/1", data.data(), data.size());
+    EXPECT_EQ(cache->GetEntryCount(), 0);
+    EXPECT_EQ(ReadAll(cm, "a/1"), "third");
+
+    cm.Remove("a/1");
+    EXPECT_EQ(cache->GetEntryCount(), 0);
+    EXPECT_EQ(cache->GetUsedBytes(), 0);
+}
+
+TEST_F(LocalObjectCacheTest, EvictsLeastRecentlyUsed) {
+    auto cache = std::make_shared<LocalObjectCache>(root_.string(), 20);
+    CachingChunkManager cm(remote_, cache);
+    Put("a/1", std::string(8, '1'));
+    Put("a/2", std::string(8, '2'));
+    Put("a/3", std::string(8, '3'));
+    Put("a/big", std::string(21, 'b'));
+
+    ReadAll(cm, "a/1");
+    ReadAll(cm, "a/2");
+    ReadAll(cm, "a/1");
+    ReadAll(cm, "a/3");
+    EXPECT_EQ(cache->GetEntryCount(), 2);
+    EXPECT_EQ(cache->GetUsedBytes(), 16);
+
+    remote_->reads_ = 0;
+    ReadAll(cm, "a/1");
+    ReadAll(cm, "a/3");
+    EXPECT_EQ(remote_->reads_, 0);
+    ReadAll(cm, "a/2");
+    EXPECT_EQ(remote_->reads_, 1);
+
+    // larger than the whole cache
+    ReadAll(cm, "a/big");
+    ReadAll(cm, "a/big");
+    EXPECT_EQ(remote_->reads_, 3);
+    EXPECT_LE(cache->GetUsedBytes(), 20);
+}
+
+TEST_F(LocalObjectCacheTest, RecoversCopiesAfterRestart) {
+    Put("a/1", "persisted");
+    Put("a/2", "dropped");
+    {
+        auto cache =
+            std::make_shared<LocalObjectCache>(root_.string(), 1 << 20);
+        CachingChunkManager cm(remote_, cache);
+        ReadAll(cm, "a/1");
+        ReadAll(cm, "a/2");
+    }
+    // a copy a crashed process never published
+    std::ofstream(root_ / "0123456789abcdef.0.tmp") << "partial";
+    Put("a/2", "changed");
+
+    auto cache = std::make_shared<LocalObjectCache>(root_.string(), 1 << 20);
+    EXPECT_EQ(cache->GetEntryCount(), 2);
+    EXPECT_FALSE(std::filesystem::exists(root_ / "0123456789abcdef.0.tmp"));
+
+    CachingChunkManager cm(remote_, cache);
+    remote_->reads_ = 0;
+    EXPECT_EQ(ReadAll(cm, "a/1"), "persisted");
+    EXPECT_EQ(remote_->reads_, 0);
+    EXPECT_EQ(ReadAll(cm, "a/2"), "changed");
+    EXPECT_EQ(remote_->reads_, 1);
+
+    // a smaller capacity evicts on recovery
+    cache.reset();
+    auto smaller = std::make_shared<LocalObjectCache>(root_.string(), 10);
+    EXPECT_EQ(smaller->GetEntryCount(), 1);
+    EXPECT_LE(smaller->GetUsedBytes(), 10);
+}
+
+TEST_F(LocalObjectCacheTest, CorruptedCopiesAreDropped) {
+    auto cache = std::make_shared<LocalObjectCache>(root_.string(), 1 << 20);
+    CachingChunkManager cm(remote_, cache);
+    Put("a/1", "hello world");
+    ReadAll(cm, "a/1");
+
+    for (auto& dirent : std::filesystem::directory_iterator(root_)) {
+        std::filesystem::resize_file(dirent.path(), 4);
+    }
+    EXPECT_EQ(ReadAll(cm, "a/1"), "hello world");
+    EXPECT_EQ(remote_->reads_, 2);
+}
@@ -216,6 +216,20 @@ MemFileManagerImpl::cache_raw_data_to_memory_internal(const Config& config) {
     return field_datas;
 }
 
+void
+MemFileManagerImpl::CacheRawDataToMemoryInBatches(
+    const Config& config,
+    int64_t memory_budget,
+    const std::function<void(FieldDataPtr)>& consume) {
+    auto insert_files = index::GetValueFromConfig<std::vector<std::string>>(
+        config, INSERT_FILES_KEY);
+    AssertInfo(insert_files.has_value(),
+               "insert file paths is empty when build index");
+    auto remote_files = insert_files.value();
+    SortByPath(remote_files);
+    FetchFieldDataInBatches(rcm_.get(), remote_files, memory_budget, consume);
+}
+
 std::vector<FieldDataPtr>
 MemFileManagerImpl::cache_raw_data_to_memory_storage_v2(const Config& config) {
     auto data_type = index::GetValueFromConfig<DataType>(config, DATA_TYPE_KEY);
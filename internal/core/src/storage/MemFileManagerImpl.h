@@ -17,6 +17,7 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <map>
 #include <string>
 #include <vector>
@@ -63,6 +64,15 @@ class MemFileManagerImpl : public FileManagerImpl {
     std::vector<FieldDataPtr>
     CacheRawDataToMemory(const Config& config);
 
+    // Hands the field datas of the insert files to `consume` in order,
+    // fetching them under `memory_budget` bytes at a time instead of
+    // caching them all, storage v1 only.
+    void
+    CacheRawDataToMemoryInBatches(
+        const Config& config,
+        int64_t memory_budget,
+        const std::function<void(FieldDataPtr)>& consume);
+
     bool
     AddFile(const BinarySet& binary_set);
 
@@ -14,10 +14,15 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+#include <string>
+#include <unordered_set>
+
 #include "arrow/api.h"
 #include "arrow/array/array_base.h"
 #include "arrow/array/builder_base.h"
 #include "arrow/util/type_fwd.h"
+#include "common/Common.h"
 #include "common/EasyAssert.h"
 #include "common/Types.h"
 #include "parquet/arrow/writer.h"
@@ -28,6 +33,71 @@
 
 namespace milvus::storage {
 
+namespace {
+
+// rows the encoding of a column is chosen by
+constexpr int64_t kEncodingSampleRows = 4096;
+// a column with more distinct values among its sample than this share gains
+// nothing from a dictionary, parquet would build one only to fall back to
+// plain pages once it overflows
+constexpr double kDictionaryMaxDistinctRatio = 0.5;
+
+// the share of distinct values among the first rows of `array`
+template <typename ArrayType>
+double
+SampleDistinctRatio(const ArrayType& array) {
+    auto rows = std::min<int64_t>(array.length(), kEncodingSampleRows);
+    std::unordered_set<decltype(array.GetView(0))> distinct;
+    int64_t valid = 0;
+    for (int64_t i = 0; i < rows; ++i) {
+        if (array.IsValid(i)) {
+            distinct.insert(array.GetView(i));
+            valid++;
+        }
+    }
+    return valid == 0 ? 0 : static_cast<double>(distinct.size()) / valid;
+}
+
+// Floats of high cardinality are written byte stream split, which lays the
+// n-th bytes of all values next to each other for zstd to find the shared
+// exponents, strings and binaries of high cardinality are written plain.
+// Everything else keeps the dictionary encoding parquet defaults to.
+void
+SetColumnEncoding(parquet::WriterProperties::Builder& builder,
+                  const std::string& column,
+                  const arrow::Array& array) {
+    double distinct_ratio = 0;
+    bool is_float = false;
+    switch (array.type_id()) {
+        case arrow::Type::FLOAT:
+            distinct_ratio = SampleDistinctRatio(
+                static_cast<const arrow::FloatArray&>(array));
+            is_float = true;
+            break;
+        case arrow::Type::DOUBLE:
+            distinct_ratio = SampleDistinctRatio(
+                static_cast<const arrow::DoubleArray&>(array));
+            is_float = true;
+            break;
+        case arrow::Type::STRING:
+        case arrow::Type::BINARY:
+            distinct_ratio = SampleDistinctRatio(
+                static_cast<const arrow::BinaryArray&>(array));
+            break;
+        default:
+            return;
+    }
+    if (distinct_ratio <= kDictionaryMaxDistinctRatio) {
+        return;
+    }
+    builder.disable_dictionary(column);
+    if (is_float) {
+        builder.encoding(column, parquet::Encoding::BYTE_STREAM_SPLIT);
+    }
+}
+
+}  // namespace
+
 // create payload writer for numeric data type
 PayloadWriter::PayloadWriter(const DataType column_type, bool nullable)
     : column_type_(column_type), nullable_(nullable) {
@@ -92,6 +162,20 @@ PayloadWriter::add_one_binary_payload(const uint8_t* data, int length) {
     rows_.fetch_add(1);
 }
 
+void
+PayloadWriter::add_binary_payloads(const std::vector<std::string_view>& values,
+                                   const uint8_t* valid_data) {
+    AssertInfo(output_ == nullptr, "payload writer has been finished");
+    AssertInfo(milvus::IsStringDataType(column_type_) ||
+                   milvus::IsBinaryDataType(column_type_) ||
+                   milvus::IsSparseFloatVectorDataType(column_type_),
+               "mismatch data type");
+    AssertInfo(nullable_ || valid_data == nullptr,
+               "valid_data is given for a not nullable column");
+    AddBinariesToArrowBuilder(builder_, values, valid_data);
+    rows_.fetch_add(values.size());
+}
+
 void
 PayloadWriter::add_payload(const Payload& raw_data) {
     AssertInfo(output_ == nullptr, "payload writer has been finished");
@@ -128,14 +212,18 @@ PayloadWriter::finish() {
         arrow_properties = arrow_props_builder.build();
     }
 
+    parquet::WriterProperties::Builder writer_props_builder;
+    writer_props_builder.compression(arrow::Compression::ZSTD)
+        ->compression_level(3);
+    if (ENABLE_ADAPTIVE_PAYLOAD_ENCODING.load()) {
+        SetColumnEncoding(
+            writer_props_builder, schema_->field(0)->name(), *array);
+    }
     ast = parquet::arrow::WriteTable(*table,
                                      mem_pool,
                                      output_,
                                      1024 * 1024 * 1024,
-                                     parquet::WriterProperties::Builder()
-                                         .compression(arrow::Compression::ZSTD)
-                                         ->compression_level(3)
-                                         ->build(),
+                                     writer_props_builder.build(),
                                      arrow_properties);
     AssertInfo(ast.ok(), ast.ToString());
 }
@@ -20,6 +20,7 @@
 #include <atomic>
 #include <memory>
 #include <optional>
+#include <string_view>
 #include <vector>
 
 #include "arrow/array/builder_base.h"
@@ -48,6 +49,12 @@ class PayloadWriter {
     void
     add_one_binary_payload(const uint8_t* data, int length);
 
+    // adds a column of string or binary rows in one call, see
+    // AddBinariesToArrowBuilder
+    void
+    add_binary_payloads(const std::vector<std::string_view>& values,
+                        const uint8_t* valid_data);
+
     void
     finish();
 
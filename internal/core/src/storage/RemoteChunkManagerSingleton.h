@@ -17,6 +17,7 @@
 #pragma once
 
 #include "storage/ChunkManager.h"
+#include "storage/LocalObjectCache.h"
 #include "storage/Util.h"
 
 namespace milvus::storage {
@@ -41,6 +42,10 @@ class RemoteChunkManagerSingleton {
     Init(const StorageConfig& storage_config) {
         if (rcm_ == nullptr) {
             rcm_ = CreateChunkManager(storage_config);
+            auto cache = LocalObjectCache::Global();
+            if (cache != nullptr && storage_config.storage_type != "local") {
+                rcm_ = std::make_shared<CachingChunkManager>(rcm_, cache);
+            }
         }
     }
 
@@ -1,26 +1,38 @@
 #include <unistd.h>
 #include <algorithm>
+#include <atomic>
 #include <cerrno>
 #include <chrono>
+#include <condition_variable>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <thread>
 #include <utility>
 #include <vector>
 #include "log/Log.h"
 
+#include <folly/executors/thread_factory/NamedThreadFactory.h>
+
 #include "RemoteInputStream.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "common/Consts.h"
 #include "common/EasyAssert.h"
+#include "storage/EntryStreamUtils.h"
 
 namespace milvus::storage {
 namespace {
 
 constexpr int kRemoteInputStreamMaxReadRetries = 5;
+constexpr size_t kPartAlignment = 64 * 1024;
+constexpr size_t kMinObservedPartSize = 1024 * 1024;
+constexpr double kThroughputWeight = 0.2;
 constexpr const char* kFailedFlushResponseStreamError =
     "Failed to flush response stream";
 
@@ -37,13 +49,16 @@ ReadWithRetry(const char* operation,
               size_t size,
               size_t file_size,
               size_t offset,
+              const folly::CancellationToken& cancellation_token,
               ReadFunc&& read_func,
               ResetFunc&& reset_func) {
     auto result = read_func();
     int retries = 0;
     int64_t sleep_ms = 1;
+    // a cancelled read keeps its error, the caller throws FollyCancel
     for (int retry = 1; !result.ok() && IsRetryableReadError(result.status()) &&
-                        retry <= kRemoteInputStreamMaxReadRetries;
+                        retry <= kRemoteInputStreamMaxReadRetries &&
+                        !cancellation_token.isCancellationRequested();
          ++retry) {
         retries = retry;
         LOG_WARN(
@@ -101,11 +116,437 @@ ReadWithRetry(const char* operation,
     return result;
 }
 
+using Clock = std::chrono::steady_clock;
+using PartReader = std::function<arrow::Result<int64_t>(
+    void* out, size_t offset, size_t size)>;
+
+// hedging tiny parts only doubles the requests
+constexpr auto kMinHedgeDelay = std::chrono::milliseconds(20);
+constexpr auto kHedgePollInterval = std::chrono::milliseconds(5);
+constexpr auto kStalledPartDelay = std::chrono::milliseconds(100);
+
+// One read split into parts. The reading thread calls Start, which hands
+// parts to the worker pool, and Wait, which reads the parts no worker
+// claimed yet, hedges stragglers and collects the result. The workers never
+// wait for anything but their own reads, so a read queued behind others on
+// a busy pool is late but always completes.
+//
+// Without hedging the parts are read straight into the destination and Wait
+// returns once every part is in. With hedging a losing read can't be
+// cancelled and may finish after Wait returned, so every read goes to its
+// own buffer and only the first one of a part is copied to the destination.
+//
+// Once `cancellation_token` is cancelled no more parts are claimed, and Wait
+// throws as soon as no running read writes into the destination, which with
+// hedging is right away.
+class ParallelRangeRead
+    : public std::enable_shared_from_this<ParallelRangeRead> {
+ public:
+    ParallelRangeRead(PartReader reader,
+                      void* data,
+                      size_t offset,
+                      size_t size,
+                      size_t part_size,
+                      double hedge_ratio,
+                      folly::CancellationToken cancellation_token)
+        : reader_(std::move(reader)),
+          data_(static_cast<uint8_t*>(data)),
+          offset_(offset),
+          hedge_ratio_(hedge_ratio),
+          cancellation_token_(std::move(cancellation_token)) {
+        for (size_t start = 0; start < size; start += part_size) {
+            parts_.push_back(
+                Part{offset + start, std::min(part_size, size - start)});
+        }
+    }
+
+    void
+    Start(RemoteReadWorkerPool& pool, int nr_workers) {
+        auto helpers =
+            std::min<size_t>(parts_.size() - 1, std::max(nr_workers, 0));
+        for (size_t i = 0; i < helpers; ++i) {
+            auto self = shared_from_this();
+            if (!pool.AddTask([self]() { self->RunParts(); })) {
+                break;
+            }
+            helpers_++;
+        }
+    }
+
+    // Returns the bytes read, short only at the end of the object.
+    size_t
+    Wait() {
+        // a hedging reader stays free to watch the parts of its workers
+        if (hedge_ratio_ <= 0 || helpers_ == 0) {
+            RunParts();
+        }
+
+        folly::CancellationCallback on_cancel(cancellation_token_, [this]() {
+            std::lock_guard<std::mutex> lock(mutex_);
+            cv_.notify_all();
+        });
+        auto& pool = RemoteReadWorkerPool::GetInstance();
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (parts_done_ < parts_.size() || copying_ > 0) {
+            if (cancellation_token_.isCancellationRequested()) {
+                // without hedging the running reads write into data_
+                if (copying_ == 0 && (hedge_ratio_ > 0 || reading_ == 0)) {
+                    break;
+                }
+                cv_.wait(lock);
+                continue;
+            }
+            if (hedge_ratio_ > 0) {
+                // the workers were dropped by a reconfiguration or are busy
+                // with other reads, read the next part here
+                if (next_part_.load() < parts_.size() &&
+                    Clock::now() - last_progress_ > kStalledPartDelay) {
+                    last_progress_ = Clock::now();
+                    lock.unlock();
+                    RunPart();
+                    lock.lock();
+                    continue;
+                }
+                auto part = FindStraggler(pool.ThroughputBytesPerSecond());
+                if (part < parts_.size()) {
+                    parts_[part].hedged = true;
+                    lock.unlock();
+                    ReadPart(part);
+                    lock.lock();
+                    continue;
+                }
+                cv_.wait_for(lock, kHedgePollInterval);
+            } else {
+                cv_.wait(lock);
+            }
+        }
+        finished_ = true;
+        ThrowIfCancelled(cancellation_token_,
+                         "RemoteInputStream parallel read");
+
+        for (auto& part : parts_) {
+            if (!part.status.ok()) {
+                ThrowInfo(ErrorCode::UnexpectedError,
+                          "Failed to read from remote input stream, "
+                          "operation: parallel read, offset: {}, size: {}, "
+                          "error: {}",
+                          part.offset,
+                          part.size,
+                          part.status.ToString());
+            }
+        }
+        size_t bytes_read = 0;
+        for (auto& part : parts_) {
+            bytes_read += part.bytes_read;
+            if (part.bytes_read < part.size) {
+                break;
+            }
+        }
+        return bytes_read;
+    }
+
+ private:
+    struct Part {
+        size_t offset;
+        size_t size;
+        Clock::time_point start{};
+        bool started{false};
+        bool hedged{false};
+        bool done{false};
+        int running{0};
+        size_t bytes_read{0};
+        arrow::Status status{};
+    };
+
+    void
+    RunParts() {
+        while (RunPart()) {
+        }
+    }
+
+    // Reads the next unclaimed part, returns false if there is none or the
+    // read is cancelled.
+    bool
+    RunPart() {
+        if (cancellation_token_.isCancellationRequested()) {
+            return false;
+        }
+        auto part = next_part_.fetch_add(1);
+        if (part >= parts_.size()) {
+            return false;
+        }
+        ReadPart(part);
+        return true;
+    }
+
+    // The first running part that outlived its expected duration and is not
+    // hedged yet, parts_.size() if none.
+    size_t
+    FindStraggler(double throughput_bps) const {
+        if (throughput_bps <= 0) {
+            return parts_.size();
+        }
+        auto now = Clock::now();
+        for (size_t i = 0; i < parts_.size(); ++i) {
+            const auto& part = parts_[i];
+            if (!part.started || part.done || part.hedged) {
+                continue;
+            }
+            auto expected = std::chrono::duration<double>(
+                hedge_ratio_ * part.size / throughput_bps);
+            auto delay = std::max<Clock::duration>(
+                std::chrono::duration_cast<Clock::duration>(expected),
+                kMinHedgeDelay);
+            if (now - part.start > delay) {
+                return i;
+            }
+        }
+        return parts_.size();
+    }
+
+    void
+    ReadPart(size_t index) {
+        Part* part = &parts_[index];
+        auto start = Clock::now();
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (part->done || cancellation_token_.isCancellationRequested()) {
+                return;
+            }
+            if (!part->started) {
+                part->started = true;
+                part->start = start;
+                last_progress_ = start;
+            }
+            part->running++;
+            reading_++;
+        }
+
+        std::vector<uint8_t> buffer;
+        void* out = data_ + (part->offset - offset_);
+        if (hedge_ratio_ > 0) {
+            buffer.resize(part->size);
+            out = buffer.data();
+        }
+        auto result = reader_(out, part->offset, part->size);
+        if (result.ok()) {
+            RemoteReadWorkerPool::GetInstance().ObservePart(
+                result.ValueOrDie(), Clock::now() - start);
+        }
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        part->running--;
+        reading_--;
+        if (part->done) {
+            // the other read of this part won, a cancelled Wait may wait for
+            // this one
+            cv_.notify_all();
+            return;
+        }
+        if (!result.ok()) {
+            part->status = result.status();
+            if (part->running > 0) {
+                // the other read may still succeed
+                cv_.notify_all();
+                return;
+            }
+        } else {
+            part->status = arrow::Status::OK();
+            part->bytes_read = result.ValueOrDie();
+        }
+        part->done = true;
+        parts_done_++;
+        last_progress_ = Clock::now();
+        if (result.ok() && !buffer.empty() && !finished_) {
+            copying_++;
+            lock.unlock();
+            std::memcpy(data_ + (part->offset - offset_),
+                        buffer.data(),
+                        part->bytes_read);
+            lock.lock();
+            copying_--;
+        }
+        cv_.notify_all();
+    }
+
+    PartReader reader_;
+    uint8_t* data_;
+    size_t offset_;
+    double hedge_ratio_;
+    folly::CancellationToken cancellation_token_;
+    std::vector<Part> parts_;
+    std::atomic<size_t> next_part_{0};
+    size_t helpers_{0};
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    size_t parts_done_{0};
+    // reads of parts running
+    size_t reading_{0};
+    // when a part last started or completed
+    Clock::time_point last_progress_{Clock::now()};
+    // parts being copied to data_ by a winning hedged read
+    size_t copying_{0};
+    // Wait returned, data_ may be gone
+    bool finished_{false};
+};
+
+// Splits [offset, offset + size) of `remote_file` into parts and starts
+// fetching them, the caller must Wait for the returned read.
+std::shared_ptr<ParallelRangeRead>
+StartParallelRead(const std::shared_ptr<arrow::io::RandomAccessFile>& file,
+                  size_t file_size,
+                  void* data,
+                  size_t offset,
+                  size_t size,
+                  const folly::CancellationToken& cancellation_token) {
+    auto& pool = RemoteReadWorkerPool::GetInstance();
+    auto config = pool.GetConfig();
+    auto read = std::make_shared<ParallelRangeRead>(
+        [file, file_size, cancellation_token](
+            void* out, size_t offset, size_t size) {
+            return ReadWithRetry(
+                "parallel read at offset",
+                size,
+                file_size,
+                offset,
+                cancellation_token,
+                [&file, offset, size, out]() {
+                    return file->ReadAt(offset, size, out);
+                },
+                []() { return arrow::Status::OK(); });
+        },
+        data,
+        offset,
+        size,
+        pool.PartSize(size),
+        config.hedge_ratio,
+        cancellation_token);
+    read->Start(pool, config.nr_workers);
+    return read;
+}
+
 }  // namespace
 
+void
+RemoteReadWorkerPool::Configure(const RemoteParallelReadConfig& config) {
+    auto nr_workers = std::clamp(
+        config.nr_workers,
+        0,
+        static_cast<int>(std::max(1u, std::thread::hardware_concurrency())));
+    AssertInfo(config.min_part_size > 0 &&
+                   config.min_part_size <= config.max_part_size,
+               "Invalid remote read part size, min: {}, max: {}",
+               config.min_part_size,
+               config.max_part_size);
+    AssertInfo(config.hedge_ratio >= 0,
+               "Invalid remote read hedge ratio: {}",
+               config.hedge_ratio);
+
+    std::shared_ptr<folly::CPUThreadPoolExecutor> old_executor = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (nr_workers != config_.nr_workers) {
+            old_executor = std::move(executor_);
+            if (nr_workers > 0) {
+                executor_ = std::make_shared<folly::CPUThreadPoolExecutor>(
+                    nr_workers,
+                    std::make_shared<folly::NamedThreadFactory>(
+                        "MILVUS_RM_RD_"));
+            }
+        }
+        config_ = config;
+        config_.nr_workers = nr_workers;
+    }
+    // reads whose parts are dropped here read them on their own thread
+    if (old_executor != nullptr) {
+        old_executor->stop();
+        old_executor->join();
+    }
+    LOG_INFO(
+        "Set remote parallel read, workers: {}, part size: [{}, {}], hedge "
+        "ratio: {}",
+        nr_workers,
+        config.min_part_size,
+        config.max_part_size,
+        config.hedge_ratio);
+}
+
+RemoteParallelReadConfig
+RemoteReadWorkerPool::GetConfig() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return config_;
+}
+
+bool
+RemoteReadWorkerPool::ShouldSplit(size_t size) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return config_.nr_workers > 0 && size >= 2 * config_.min_part_size;
+}
+
+size_t
+RemoteReadWorkerPool::PartSize(size_t size) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    // start small, a throughput estimate comes with the first parts
+    auto part_size = static_cast<double>(config_.min_part_size);
+    if (throughput_bps_ > 0) {
+        part_size = throughput_bps_ * kTargetPartSeconds;
+    }
+    // spread every read over all the workers and the reading thread
+    auto spread = (size + config_.nr_workers) / (config_.nr_workers + 1);
+    part_size = std::min(part_size, static_cast<double>(spread));
+    auto part = std::clamp(static_cast<size_t>(part_size),
+                           config_.min_part_size,
+                           config_.max_part_size);
+    return (part + kPartAlignment - 1) / kPartAlignment * kPartAlignment;
+}
+
+void
+RemoteReadWorkerPool::ObservePart(size_t bytes, Clock::duration elapsed) {
+    auto seconds = std::chrono::duration<double>(elapsed).count();
+    // tiny or instant reads tell nothing about the throughput
+    if (bytes < kMinObservedPartSize || seconds <= 0) {
+        return;
+    }
+    auto bps = bytes / seconds;
+    std::lock_guard<std::mutex> lock(mutex_);
+    throughput_bps_ = throughput_bps_ == 0
+                          ? bps
+                          : (1 - kThroughputWeight) * throughput_bps_ +
+                                kThroughputWeight * bps;
+}
+
+double
+RemoteReadWorkerPool::ThroughputBytesPerSecond() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return throughput_bps_;
+}
+
+bool
+RemoteReadWorkerPool::AddTask(std::function<void()> task) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (executor_ == nullptr) {
+        return false;
+    }
+    executor_->add(std::move(task));
+    return true;
+}
+
+RemoteReadWorkerPool::~RemoteReadWorkerPool() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (executor_ != nullptr) {
+        executor_->stop();
+        executor_->join();
+        executor_ = nullptr;
+    }
+}
+
+
 RemoteInputStream::RemoteInputStream(
-    std::shared_ptr<arrow::io::RandomAccessFile>&& remote_file)
-    : remote_file_(std::move(remote_file)) {
+    std::shared_ptr<arrow::io::RandomAccessFile>&& remote_file,
+    folly::CancellationToken cancellation_token)
+    : remote_file_(std::move(remote_file)),
+      cancellation_token_(std::move(cancellation_token)) {
     auto status = remote_file_->GetSize();
     AssertInfo(status.ok(), "Failed to get size of remote file");
     file_size_ = static_cast<size_t>(status.ValueOrDie());
@@ -113,14 +554,27 @@ RemoteInputStream::RemoteInputStream(
 
 size_t
 RemoteInputStream::Read(void* data, size_t size) {
+    ThrowIfCancelled(cancellation_token_, "RemoteInputStream read");
     auto offset = static_cast<int64_t>(Tell());
+    auto position = static_cast<size_t>(offset);
+    if (position < file_size_ &&
+        RemoteReadWorkerPool::GetInstance().ShouldSplit(
+            std::min(size, file_size_ - position))) {
+        auto bytes_read = ParallelReadAt(data, position, size);
+        AssertInfo(Seek(offset + bytes_read),
+                   "Failed to seek remote input stream to {}",
+                   position + bytes_read);
+        return bytes_read;
+    }
     auto status = ReadWithRetry(
         "read",
         size,
         file_size_,
         offset,
+        cancellation_token_,
         [this, size, data]() { return remote_file_->Read(size, data); },
         [this, offset]() { return remote_file_->Seek(offset); });
+    ThrowIfCancelled(cancellation_token_, "RemoteInputStream read");
     AssertInfo(
         status.ok(),
         "Failed to read from remote input stream, operation: read, offset: {}, "
@@ -134,15 +588,23 @@ RemoteInputStream::Read(void* data, size_t size) {
 
 size_t
 RemoteInputStream::ReadAt(void* data, size_t offset, size_t size) {
+    ThrowIfCancelled(cancellation_token_, "RemoteInputStream read at offset");
+    if (offset < file_size_ &&
+        RemoteReadWorkerPool::GetInstance().ShouldSplit(
+            std::min(size, file_size_ - offset))) {
+        return ParallelReadAt(data, offset, size);
+    }
     auto status = ReadWithRetry(
         "read at offset",
         size,
         file_size_,
         offset,
+        cancellation_token_,
         [this, offset, size, data]() {
             return remote_file_->ReadAt(offset, size, data);
         },
         []() { return arrow::Status::OK(); });
+    ThrowIfCancelled(cancellation_token_, "RemoteInputStream read at offset");
     AssertInfo(status.ok(),
                "Failed to read from remote input stream, operation: read at "
                "offset, offset: {}, size: {}, file size: {}, error: {}",
@@ -155,12 +617,16 @@ RemoteInputStream::ReadAt(void* data, size_t offset, size_t size) {
 
 size_t
 RemoteInputStream::Read(int fd, size_t size) {
+    if (RemoteReadWorkerPool::GetInstance().ShouldSplit(size)) {
+        return ParallelReadToFile(fd, size);
+    }
     size_t read_batch_size =
         std::min(size, static_cast<size_t>(DEFAULT_INDEX_FILE_SLICE_SIZE));
     size_t rest_size = size;
     std::vector<uint8_t> data(read_batch_size);
 
     while (rest_size > 0) {
+        ThrowIfCancelled(cancellation_token_, "RemoteInputStream read to file");
         size_t read_size = std::min(rest_size, read_batch_size);
         auto offset = static_cast<int64_t>(Tell());
         auto status = ReadWithRetry(
@@ -168,10 +634,12 @@ RemoteInputStream::Read(int fd, size_t size) {
             read_size,
             file_size_,
             offset,
+            cancellation_token_,
             [this, read_size, &data]() {
                 return remote_file_->Read(read_size, data.data());
             },
             [this, offset]() { return remote_file_->Seek(offset); });
+        ThrowIfCancelled(cancellation_token_, "RemoteInputStream read to file");
         AssertInfo(status.ok(),
                    "Failed to read from remote input stream, operation: read "
                    "to file, offset: {}, size: {}, rest size: {}, file size: "
@@ -209,6 +677,85 @@ RemoteInputStream::Read(int fd, size_t size) {
     return size;
 }
 
+size_t
+RemoteInputStream::ParallelReadAt(void* data, size_t offset, size_t size) {
+    size = std::min(size, file_size_ - offset);
+    return StartParallelRead(remote_file_,
+                             file_size_,
+                             data,
+                             offset,
+                             size,
+                             cancellation_token_)
+        ->Wait();
+}
+
+size_t
+RemoteInputStream::ParallelReadToFile(int fd, size_t size) {
+    auto& pool = RemoteReadWorkerPool::GetInstance();
+    auto offset = Tell();
+    auto batch_size = std::max(
+        pool.PartSize(size) * (pool.GetConfig().nr_workers + 1),
+        static_cast<size_t>(DEFAULT_INDEX_FILE_SLICE_SIZE));
+    batch_size = std::min(batch_size, size);
+
+    // read ahead: the next batch downloads while this one is written
+    std::vector<uint8_t> current(batch_size);
+    std::vector<uint8_t> next(batch_size);
+    size_t done = 0;
+    auto pending = StartParallelRead(remote_file_,
+                                     file_size_,
+                                     current.data(),
+                                     offset,
+                                     batch_size,
+                                     cancellation_token_);
+    try {
+        while (pending != nullptr) {
+            auto len = std::min(batch_size, size - done);
+            auto bytes_read = pending->Wait();
+            pending = nullptr;
+            AssertInfo(bytes_read == len,
+                       "Failed to read from remote input stream, operation: "
+                       "parallel read to file, offset: {}, size: {}, bytes "
+                       "read: {}, file size: {}",
+                       offset + done,
+                       len,
+                       bytes_read,
+                       file_size_);
+            if (done + len < size) {
+                auto next_len = std::min(batch_size, size - done - len);
+                pending = StartParallelRead(remote_file_,
+                                            file_size_,
+                                            next.data(),
+                                            offset + done + len,
+                                            next_len,
+                                            cancellation_token_);
+            }
+            ssize_t ret = ::write(fd, current.data(), len);
+            AssertInfo(ret == static_cast<ssize_t>(len),
+                       "Failed to write to file");
+            std::swap(current, next);
+            done += len;
+        }
+    } catch (...) {
+        // the parts of the next batch still write into `next`
+        if (pending != nullptr) {
+            try {
+                pending->Wait();
+            } catch (...) {
+            }
+        }
+        throw;
+    }
+    AssertInfo(Seek(offset + size),
+               "Failed to seek remote input stream to {}",
+               offset + size);
+
+    auto fsync_ret = ::fsync(fd);
+    int saved_errno = errno;
+    AssertInfo(fsync_ret == 0, "Failed to fsync file, errno: {}", saved_errno);
+    return size;
+}
+
 size_t
 RemoteInputStream::Tell() const {
     auto status = remote_file_->Tell();
@@ -13,17 +13,96 @@
 
 #include <stddef.h>
 #include <stdint.h>
+#include <chrono>
+#include <functional>
 #include <memory>
+#include <mutex>
+
+#include <folly/CancellationToken.h>
+#include <folly/executors/CPUThreadPoolExecutor.h>
 
 #include "arrow/io/interfaces.h"
 #include "filemanager/InputStream.h"
 
 namespace milvus::storage {
 
+struct RemoteParallelReadConfig {
+    // workers fetching parts besides the reading thread, 0 disables
+    // parallel reads
+    int nr_workers{0};
+    size_t min_part_size{8 * 1024 * 1024};
+    size_t max_part_size{64 * 1024 * 1024};
+    // a part still running after hedge_ratio times its expected duration is
+    // read again, whichever read finishes first wins; 0 disables hedging
+    double hedge_ratio{0};
+};
+
+// Process-wide workers and settings of the parallel reads of
+// RemoteInputStream.
+//
+// Reads of at least two minimum parts are split into byte ranges fetched
+// concurrently by the workers and the reading thread itself, so that large
+// binlogs and index files are not capped by the throughput of one object
+// store connection. The part size adapts to the throughput observed on
+// completed parts: parts are sized to take about kTargetPartSeconds, which
+// amortizes the request latency without leaving one slow part at the tail.
+class RemoteReadWorkerPool {
+ public:
+    static constexpr double kTargetPartSeconds = 0.25;
+
+    RemoteReadWorkerPool() = default;
+
+    static RemoteReadWorkerPool&
+    GetInstance() {
+        static RemoteReadWorkerPool instance;
+        return instance;
+    }
+
+    void
+    Configure(const RemoteParallelReadConfig& config);
+
+    RemoteParallelReadConfig
+    GetConfig() const;
+
+    // Whether a read of `size` bytes is split into parts.
+    bool
+    ShouldSplit(size_t size) const;
+
+    // The part size of a read of `size` bytes.
+    size_t
+    PartSize(size_t size) const;
+
+    // Records that a part of `bytes` bytes took `elapsed`.
+    void
+    ObservePart(size_t bytes, std::chrono::steady_clock::duration elapsed);
+
+    // Throughput of one ranged read, 0 before any part completed.
+    double
+    ThroughputBytesPerSecond() const;
+
+    // Runs `task` on a worker, returns false if there is none.
+    bool
+    AddTask(std::function<void()> task);
+
+    ~RemoteReadWorkerPool();
+
+ private:
+    mutable std::mutex mutex_;
+    RemoteParallelReadConfig config_;
+    double throughput_bps_{0};
+    std::shared_ptr<folly::CPUThreadPoolExecutor> executor_{nullptr};
+};
+
+// Reads of a RemoteInputStream opened with a cancellation token throw
+// FollyCancel once it is cancelled: a parallel read stops handing out its
+// parts and returns as soon as the requests already sent are done with its
+// buffer, a sequential read stops between batches and retries.
 class RemoteInputStream : public milvus::InputStream {
  public:
     explicit RemoteInputStream(
-        std::shared_ptr<arrow::io::RandomAccessFile>&& remote_file);
+        std::shared_ptr<arrow::io::RandomAccessFile>&& remote_file,
+        folly::CancellationToken cancellation_token =
+            folly::CancellationToken());
 
     ~RemoteInputStream() override = default;
 
@@ -49,8 +128,16 @@ class RemoteInputStream : public milvus::InputStream {
     Seek(int64_t offset) override;
 
  private:
+    // Reads [offset, offset + size) in parts, see RemoteReadWorkerPool.
+    size_t
+    ParallelReadAt(void* data, size_t offset, size_t size);
+
+    size_t
+    ParallelReadToFile(int fd, size_t size);
+
     size_t file_size_;
     std::shared_ptr<arrow::io::RandomAccessFile> remote_file_;
+    folly::CancellationToken cancellation_token_;
 };
 
 }  // namespace milvus::storage
\ No newline at end of file
@@ -25,12 +25,17 @@
 #include <arrow/status.h>
 
 #include <array>
+#include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
+#include "common/Consts.h"
 #include "common/EasyAssert.h"
 #include "storage/RemoteInputStream.h"
 
@@ -212,6 +217,142 @@ class PipeFile {
     int fds_[2] = {-1, -1};
 };
 
+// Thread-safe file of `size` pattern bytes whose reads take `delay`, except
+// the first read at `slow_offset` which takes `slow_delay`.
+class PatternRandomAccessFile : public arrow::io::RandomAccessFile {
+ public:
+    PatternRandomAccessFile(int64_t size,
+                            std::chrono::milliseconds delay,
+                            int64_t slow_offset = -1,
+                            std::chrono::milliseconds slow_delay = {})
+        : size_(size),
+          delay_(delay),
+          slow_offset_(slow_offset),
+          slow_delay_(slow_delay) {
+    }
+
+    static uint8_t
+    ByteAt(int64_t offset) {
+        return static_cast<uint8_t>(offset % 251);
+    }
+
+    arrow::Status
+    Close() override {
+        return arrow::Status::OK();
+    }
+
+    arrow::Result<int64_t>
+    Tell() const override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return position_;
+    }
+
+    bool
+    closed() const override {
+        return false;
+    }
+
+    arrow::Status
+    Seek(int64_t position) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        position_ = position;
+        return arrow::Status::OK();
+    }
+
+    arrow::Result<int64_t>
+    Read(int64_t nbytes, void* out) override {
+        int64_t position;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            position = position_;
+        }
+        auto result = ReadAt(position, nbytes, out);
+        if (result.ok()) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            position_ += result.ValueOrDie();
+        }
+        return result;
+    }
+
+    arrow::Result<std::shared_ptr<arrow::Buffer>>
+    Read(int64_t) override {
+        return arrow::Status::NotImplemented("buffer reads are not needed");
+    }
+
+    arrow::Result<int64_t>
+    ReadAt(int64_t position, int64_t nbytes, void* out) override {
+        read_calls_++;
+        auto active = active_reads_.fetch_add(1) + 1;
+        auto max_active = max_active_reads_.load();
+        while (active > max_active &&
+               !max_active_reads_.compare_exchange_weak(max_active, active)) {
+        }
+        bool slow = position == slow_offset_ && !slow_read_done_.exchange(true);
+        std::this_thread::sleep_for(slow ? slow_delay_ : delay_);
+
+        auto bytes = std::max<int64_t>(0, std::min(nbytes, size_ - position));
+        auto* data = static_cast<uint8_t*>(out);
+        for (int64_t i = 0; i < bytes; ++i) {
+            data[i] = ByteAt(position + i);
+        }
+        active_reads_.fetch_sub(1);
+        return bytes;
+    }
+
+    arrow::Result<int64_t>
+    GetSize() override {
+        return size_;
+    }
+
+    int
+    read_calls() const {
+        return read_calls_.load();
+    }
+
+    int
+    max_active_reads() const {
+        return max_active_reads_.load();
+    }
+
+ private:
+    int64_t size_;
+    std::chrono::milliseconds delay_;
+    int64_t slow_offset_;
+    std::chrono::milliseconds slow_delay_;
+    mutable std::mutex mutex_;
+    int64_t position_ = 0;
+    std::atomic<int> read_calls_{0};
+    std::atomic<int> active_reads_{0};
+    std::atomic<int> max_active_reads_{0};
+    std::atomic<bool> slow_read_done_{false};
+};
+
+// Restores the process-wide parallel read config on scope exit.
+class RemoteParallelReadConfigGuard {
+ public:
+    explicit RemoteParallelReadConfigGuard(
+        const RemoteParallelReadConfig& config)
+        : saved_(RemoteReadWorkerPool::GetInstance().GetConfig()) {
+        RemoteReadWorkerPool::GetInstance().Configure(config);
+    }
+
+    ~RemoteParallelReadConfigGuard() {
+        RemoteReadWorkerPool::GetInstance().Configure(saved_);
+    }
+
+ private:
+    RemoteParallelReadConfig saved_;
+};
+
+void
+ExpectPattern(const std::vector<uint8_t>& data, int64_t offset) {
+    for (size_t i = 0; i < data.size(); ++i) {
+        if (data[i] != PatternRandomAccessFile::ByteAt(offset + i)) {
+            FAIL() << "Mismatch at offset " << offset + i;
+        }
+    }
+}
+
 arrow::Status
 InternalFailedFlushStatus() {
     return arrow::Status::IOError(
@@ -413,5 +554,108 @@ TEST(RemoteInputStreamTest, RetriesFailedFlushNonIoError) {
     EXPECT_EQ(file_ptr->read_calls(), 2);
 }
 
+TEST(RemoteInputStreamTest, ParallelReadsSplitIntoConcurrentParts) {
+    constexpr size_t kPartSize = 64 * 1024;
+    RemoteParallelReadConfigGuard guard({2, kPartSize, kPartSize, 0});
+    constexpr int64_t kFileSize = 16 * kPartSize + 100;
+    auto file = std::make_shared<PatternRandomAccessFile>(
+        kFileSize, std::chrono::milliseconds(5));
+    auto* file_ptr = file.get();
+    RemoteInputStream stream(std::move(file));
+
+    std::vector<uint8_t> data(kFileSize);
+    EXPECT_EQ(stream.ReadAt(data.data(), 0, data.size()), data.size());
+    ExpectPattern(data, 0);
+    EXPECT_EQ(file_ptr->read_calls(), 17);
+    EXPECT_GT(file_ptr->max_active_reads(), 1);
+
+    // a read past the end returns the bytes up to the end
+    std::vector<uint8_t> tail(4 * kPartSize);
+    auto offset = kFileSize - 3 * kPartSize;
+    EXPECT_EQ(stream.ReadAt(tail.data(), offset, tail.size()), 3 * kPartSize);
+    tail.resize(3 * kPartSize);
+    ExpectPattern(tail, offset);
+
+    // sequential reads advance the position
+    ASSERT_TRUE(stream.Seek(10));
+    std::vector<uint8_t> head(2 * kPartSize);
+    EXPECT_EQ(stream.Read(head.data(), head.size()), head.size());
+    ExpectPattern(head, 10);
+    EXPECT_EQ(stream.Tell(), 10 + head.size());
+}
+
+TEST(RemoteInputStreamTest, ParallelReadToFileReadsAhead) {
+    constexpr size_t kPartSize = 1024 * 1024;
+    RemoteParallelReadConfigGuard guard({2, kPartSize, kPartSize, 0});
+    // several batches of DEFAULT_INDEX_FILE_SLICE_SIZE plus a short one
+    const int64_t file_size = 2 * DEFAULT_INDEX_FILE_SLICE_SIZE + 12345;
+    auto file = std::make_shared<PatternRandomAccessFile>(
+        file_size, std::chrono::milliseconds(0));
+    RemoteInputStream stream(std::move(file));
+    TempFile temp_file;
+    ASSERT_GE(temp_file.fd(), 0);
+
+    EXPECT_EQ(stream.Read(temp_file.fd(), file_size), file_size);
+    EXPECT_EQ(stream.Tell(), file_size);
+
+    std::vector<uint8_t> written(file_size);
+    ASSERT_EQ(::pread(temp_file.fd(), written.data(), file_size, 0),
+              file_size);
+    ExpectPattern(written, 0);
+}
+
+TEST(RemoteInputStreamTest, ParallelReadHedgesStragglerPart) {
+    constexpr size_t kPartSize = 1024 * 1024;
+    RemoteParallelReadConfigGuard guard({2, kPartSize, kPartSize, 1});
+    constexpr int64_t kFileSize = 4 * kPartSize;
+    auto file = std::make_shared<PatternRandomAccessFile>(
+        kFileSize,
+        std::chrono::milliseconds(0),
+        0,
+        std::chrono::milliseconds(1000));
+    auto* file_ptr = file.get();
+    RemoteInputStream stream(std::move(file));
+
+    std::vector<uint8_t> data(kFileSize);
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_EQ(stream.ReadAt(data.data(), 0, data.size()), data.size());
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    ExpectPattern(data, 0);
+    // the first part was read again instead of waiting for the slow read
+    EXPECT_LT(elapsed, std::chrono::milliseconds(500));
+    EXPECT_EQ(file_ptr->read_calls(), 5);
+}
+
+TEST(RemoteInputStreamTest, CancelledParallelReadStopsReadingParts) {
+    constexpr size_t kPartSize = 64 * 1024;
+    RemoteParallelReadConfigGuard guard({2, kPartSize, kPartSize, 0});
+    constexpr int64_t kFileSize = 32 * kPartSize;
+    auto file = std::make_shared<PatternRandomAccessFile>(
+        kFileSize, std::chrono::milliseconds(20));
+    auto* file_ptr = file.get();
+    folly::CancellationSource source;
+    RemoteInputStream stream(std::move(file), source.getToken());
+
+    std::thread canceller([&source]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        source.requestCancellation();
+    });
+    std::vector<uint8_t> data(kFileSize);
+    try {
+        stream.ReadAt(data.data(), 0, data.size());
+        FAIL() << "expected cancellation";
+    } catch (const SegcoreError& e) {
+        EXPECT_EQ(e.get_error_code(), ErrorCode::FollyCancel);
+    }
+    canceller.join();
+    // the parts not claimed before the cancellation are never read
+    EXPECT_LT(file_ptr->read_calls(), 32);
+
+    // a cancelled stream reads nothing more
+    auto read_calls = file_ptr->read_calls();
+    EXPECT_THROW(stream.ReadAt(data.data(), 0, kPartSize), SegcoreError);
+    EXPECT_EQ(file_ptr->read_calls(), read_calls);
+}
+
 }  // namespace
 }  // namespace milvus::storage
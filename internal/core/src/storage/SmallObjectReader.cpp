@@ -0,0 +1,168 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/SmallObjectReader.h"
+
+#include <algorithm>
+#include <exception>
+#include <utility>
+
+#include <folly/executors/thread_factory/NamedThreadFactory.h>
+
+#include "common/EasyAssert.h"
+#include "log/Log.h"
+#include "monitor/Monitor.h"
+
+namespace milvus::storage {
+
+namespace {
+
+// bounds of the size labels of the read duration histograms
+constexpr size_t k16Kb = 16 * 1024;
+constexpr size_t k256Kb = 256 * 1024;
+constexpr size_t k4Mb = 4 * 1024 * 1024;
+
+// keeps the thread count sane whatever the configuration says
+constexpr int kMaxWorkers = 1024;
+
+RemoteObject
+ReadSmallObject(ChunkManager* chunk_manager,
+                const std::string& path,
+                size_t max_object_size) {
+    auto start = std::chrono::steady_clock::now();
+    RemoteObject object;
+    object.size = chunk_manager->Size(path);
+    if (object.size > max_object_size) {
+        return object;
+    }
+    object.data = std::shared_ptr<uint8_t[]>(new uint8_t[object.size]);
+    chunk_manager->Read(path, object.data.get(), object.size);
+    SmallObjectReader::ObserveRead(object.size,
+                                   std::chrono::steady_clock::now() - start);
+    return object;
+}
+
+}  // namespace
+
+void
+SmallObjectReader::Configure(int nr_workers, size_t max_object_size) {
+    nr_workers = std::clamp(nr_workers, 0, kMaxWorkers);
+    if (max_object_size == 0) {
+        nr_workers = 0;
+    }
+    std::shared_ptr<folly::CPUThreadPoolExecutor> old_executor = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (nr_workers != nr_workers_) {
+            old_executor = std::move(executor_);
+            if (nr_workers > 0) {
+                executor_ = std::make_shared<folly::CPUThreadPoolExecutor>(
+                    nr_workers,
+                    std::make_shared<folly::NamedThreadFactory>(
+                        "MILVUS_SM_RD_"));
+            }
+        }
+        nr_workers_ = nr_workers;
+        max_object_size_ = max_object_size;
+    }
+    // the reads already queued finish on the old workers
+    if (old_executor != nullptr) {
+        old_executor->join();
+    }
+    LOG_INFO("Set small object read, workers: {}, max object size: {}",
+             nr_workers,
+             max_object_size);
+}
+
+bool
+SmallObjectReader::Enabled() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return executor_ != nullptr;
+}
+
+std::shared_future<RemoteObject>
+SmallObjectReader::Read(ChunkManager* chunk_manager, const std::string& path) {
+    auto key = chunk_manager->GetBucketName() + "/" + path;
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = inflight_.find(key);
+    if (it != inflight_.end()) {
+        milvus::monitor::internal_storage_object_read_coalesced_all.Increment();
+        return it->second;
+    }
+    AssertInfo(executor_ != nullptr, "Small object reads are disabled");
+
+    auto promise = std::make_shared<std::promise<RemoteObject>>();
+    auto future = promise->get_future().share();
+    inflight_.emplace(key, future);
+    executor_->add([this,
+                    chunk_manager,
+                    path,
+                    key = std::move(key),
+                    promise = std::move(promise),
+                    max_object_size = max_object_size_]() {
+        RemoteObject object;
+        std::exception_ptr error = nullptr;
+        try {
+            object = ReadSmallObject(chunk_manager, path, max_object_size);
+        } catch (...) {
+            error = std::current_exception();
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            inflight_.erase(key);
+        }
+        if (error != nullptr) {
+            promise->set_exception(error);
+        } else {
+            promise->set_value(std::move(object));
+        }
+    });
+    return future;
+}
+
+void
+SmallObjectReader::ObserveRead(size_t bytes,
+                               std::chrono::steady_clock::duration elapsed) {
+    auto seconds = std::chrono::duration<double>(elapsed).count();
+    if (bytes <= k16Kb) {
+        milvus::monitor::internal_storage_object_read_duration_seconds_16kb
+            .Observe(seconds);
+    } else if (bytes <= k256Kb) {
+        milvus::monitor::internal_storage_object_read_duration_seconds_256kb
+            .Observe(seconds);
+    } else if (bytes <= k4Mb) {
+        milvus::monitor::internal_storage_object_read_duration_seconds_4mb
+            .Observe(seconds);
+    } else {
+        milvus::monitor::internal_storage_object_read_duration_seconds_large
+            .Observe(seconds);
+    }
+}
+
+SmallObjectReader::~SmallObjectReader() {
+    std::shared_ptr<folly::CPUThreadPoolExecutor> executor = nullptr;
+    {
+        // the running reads take the lock when they finish
+        std::lock_guard<std::mutex> lock(mutex_);
+        executor = std::move(executor_);
+    }
+    if (executor != nullptr) {
+        executor->stop();
+        executor->join();
+    }
+}
+
+}  // namespace milvus::storage
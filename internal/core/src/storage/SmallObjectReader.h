@@ -0,0 +1,91 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <folly/executors/CPUThreadPoolExecutor.h>
+
+#include "storage/ChunkManager.h"
+
+namespace milvus::storage {
+
+// A whole remote object. `data` is nullptr when the object was larger than
+// what SmallObjectReader reads, then only `size` is set.
+struct RemoteObject {
+    std::shared_ptr<uint8_t[]> data{nullptr};
+    size_t size{0};
+};
+
+// Process-wide reader of small whole objects, e.g. the binlogs of segments
+// produced by frequent flushes, which are a few KB per field.
+//
+// Fetching such an object is bound by the request latency, not by the
+// bandwidth, so the reads of all concurrent loads are queued to their own
+// workers, whose number is set far above the CPU bound load pools, and the
+// loading threads only wait for the bytes and decode them. Reads of an
+// object already in flight share that read. An object found to be larger
+// than `max_object_size` is left to the caller, which reads it with the
+// ranged reads meant for big objects.
+//
+// Thread safety: All methods are thread-safe.
+class SmallObjectReader {
+ public:
+    SmallObjectReader() = default;
+
+    static SmallObjectReader&
+    GetInstance() {
+        static SmallObjectReader instance;
+        return instance;
+    }
+
+    // 0 workers or 0 max_object_size disables the reader.
+    void
+    Configure(int nr_workers, size_t max_object_size);
+
+    bool
+    Enabled() const;
+
+    // Starts reading `path`, or joins the read of it in flight.
+    // `chunk_manager` must outlive the returned future.
+    std::shared_future<RemoteObject>
+    Read(ChunkManager* chunk_manager, const std::string& path);
+
+    // Records that reading a whole object of `bytes` bytes took `elapsed`.
+    static void
+    ObserveRead(size_t bytes, std::chrono::steady_clock::duration elapsed);
+
+    ~SmallObjectReader();
+
+ private:
+    mutable std::mutex mutex_;
+    int nr_workers_{0};
+    size_t max_object_size_{0};
+    std::shared_ptr<folly::CPUThreadPoolExecutor> executor_{nullptr};
+    // by bucket and path
+    std::unordered_map<std::string, std::shared_future<RemoteObject>>
+        inflight_;
+};
+
+}  // namespace milvus::storage
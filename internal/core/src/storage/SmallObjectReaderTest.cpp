@@ -0,0 +1,203 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "storage/SmallObjectReader.h"
+
+using namespace milvus::storage;
+
+namespace {
+
+// In-memory remote storage counting the reads that reach it. Size() blocks
+// while the storage is held, so reads can be kept in flight.
+class FakeRemoteChunkManager : public ChunkManager {
+ public:
+    bool
+    Exist(const std::string& filepath) override {
+        return objects_.count(filepath) > 0;
+    }
+
+    uint64_t
+    Size(const std::string& filepath) override {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [this]() { return !held_; });
+        return objects_.at(filepath).size();
+    }
+
+    uint64_t
+    Read(const std::string& filepath, void* buf, uint64_t len) override {
+        return Read(filepath, 0, buf, len);
+    }
+
+    void
+    Write(const std::string& filepath, void* buf, uint64_t len) override {
+        objects_[filepath].assign(static_cast<char*>(buf),
+                                  static_cast<char*>(buf) + len);
+    }
+
+    uint64_t
+    Read(const std::string& filepath,
+         uint64_t offset,
+         void* buf,
+         uint64_t len) override {
+        ++reads_;
+        auto& data = objects_.at(filepath);
+        len = std::min<uint64_t>(len, data.size() - offset);
+        std::memcpy(buf, data.data() + offset, len);
+        return len;
+    }
+
+    void
+    Write(const std::string& filepath,
+          uint64_t offset,
+          void* buf,
+          uint64_t len) override {
+        Write(filepath, buf, len);
+    }
+
+    std::vector<std::string>
+    ListWithPrefix(const std::string& filepath) override {
+        return {};
+    }
+
+    void
+    Remove(const std::string& filepath) override {
+        objects_.erase(filepath);
+    }
+
+    std::string
+    GetName() const override {
+        return "FakeRemoteChunkManager";
+    }
+
+    std::string
+    GetRootPath() const override {
+        return "";
+    }
+
+    std::string
+    GetBucketName() const override {
+        return "bucket";
+    }
+
+    void
+    Put(const std::string& path, std::string data) {
+        Write(path, data.data(), data.size());
+    }
+
+    void
+    Hold(bool held) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            held_ = held;
+        }
+        cv_.notify_all();
+    }
+
+    std::atomic<int> reads_{0};
+
+ private:
+    std::map<std::string, std::vector<char>> objects_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool held_{false};
+};
+
+std::string
+ToString(const RemoteObject& object) {
+    return std::string(reinterpret_cast<const char*>(object.data.get()),
+                       object.size);
+}
+
+}  // namespace
+
+class SmallObjectReaderTest : public testing::Test {
+ protected:
+    void
+    TearDown() override {
+        SmallObjectReader::GetInstance().Configure(0, 0);
+    }
+
+    FakeRemoteChunkManager remote_;
+};
+
+TEST_F(SmallObjectReaderTest, ReadsSmallObjects) {
+    auto& reader = SmallObjectReader::GetInstance();
+    reader.Configure(4, 16);
+    ASSERT_TRUE(reader.Enabled());
+    remote_.Put("a/1", "hello");
+    remote_.Put("a/2", "");
+
+    auto object = reader.Read(&remote_, "a/1").get();
+    EXPECT_EQ(ToString(object), "hello");
+    auto empty = reader.Read(&remote_, "a/2").get();
+    EXPECT_NE(empty.data, nullptr);
+    EXPECT_EQ(empty.size, 0);
+    EXPECT_EQ(remote_.reads_, 2);
+}
+
+TEST_F(SmallObjectReaderTest, LeavesLargeObjectsToCaller) {
+    auto& reader = SmallObjectReader::GetInstance();
+    reader.Configure(4, 16);
+    remote_.Put("a/big", std::string(17, 'b'));
+
+    auto object = reader.Read(&remote_, "a/big").get();
+    EXPECT_EQ(object.data, nullptr);
+    EXPECT_EQ(object.size, 17);
+    EXPECT_EQ(remote_.reads_, 0);
+}
+
+TEST_F(SmallObjectReaderTest, CoalescesReadsInFlight) {
+    auto& reader = SmallObjectReader::GetInstance();
+    reader.Configure(4, 16);
+    remote_.Put("a/1", "hello");
+    remote_.Put("a/2", "world");
+
+    remote_.Hold(true);
+    auto first = reader.Read(&remote_, "a/1");
+    auto second = reader.Read(&remote_, "a/1");
+    auto other = reader.Read(&remote_, "a/2");
+    remote_.Hold(false);
+
+    EXPECT_EQ(ToString(first.get()), "hello");
+    EXPECT_EQ(ToString(second.get()), "hello");
+    EXPECT_EQ(ToString(other.get()), "world");
+    EXPECT_EQ(remote_.reads_, 2);
+
+    // done reads are not kept
+    reader.Read(&remote_, "a/1").get();
+    EXPECT_EQ(remote_.reads_, 3);
+}
+
+TEST_F(SmallObjectReaderTest, PropagatesFailuresAndDisables) {
+    auto& reader = SmallObjectReader::GetInstance();
+    reader.Configure(4, 16);
+    EXPECT_ANY_THROW(reader.Read(&remote_, "missing").get());
+
+    reader.Configure(0, 16);
+    EXPECT_FALSE(reader.Enabled());
+    reader.Configure(4, 0);
+    EXPECT_FALSE(reader.Enabled());
+}
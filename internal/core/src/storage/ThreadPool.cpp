@@ -17,6 +17,7 @@
 #include "ThreadPool.h"
 
 #include <chrono>
+#include <cmath>
 
 #include "log/Log.h"
 #include "storage/SafeQueue.h"
@@ -26,6 +27,7 @@ namespace milvus {
 int CPU_NUM = DEFAULT_CPU_NUM;
 std::atomic<int> THREAD_POOL_MAX_THREADS_SIZE(
     DEFAULT_THREAD_POOL_MAX_THREADS_SIZE);
+std::atomic<float> BACKGROUND_THREAD_POOL_CPU_SHARE(0);
 
 std::atomic<float> HIGH_PRIORITY_THREAD_CORE_COEFFICIENT(
     DEFAULT_HIGH_PRIORITY_THREAD_CORE_COEFFICIENT);
@@ -66,6 +68,69 @@ SetThreadPoolMaxThreadsSize(const int size) {
     LOG_INFO("set thread pool max threads size: {}", size);
 }
 
+void
+SetBackgroundThreadPoolCpuShare(const float share) {
+    BACKGROUND_THREAD_POOL_CPU_SHARE.store(std::max(0.0f, share));
+    LOG_INFO("set background thread pool cpu share: {}",
+             BACKGROUND_THREAD_POOL_CPU_SHARE.load());
+}
+
+namespace {
+thread_local bool in_background_task = false;
+}  // namespace
+
+int
+BackgroundCpuShare::Slots() {
+    auto share = BACKGROUND_THREAD_POOL_CPU_SHARE.load();
+    if (share <= 0) {
+        return 0;
+    }
+    return std::max(1, static_cast<int>(std::round(CPU_NUM * share)));
+}
+
+bool
+BackgroundCpuShare::TryAcquire(bool low_priority) {
+    auto slots = Slots();
+    auto now = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (slots == 0 || running_ < slots) {
+        if (!low_priority) {
+            running_++;
+            return true;
+        }
+        auto middle_waiting = now - middle_denied_at_ < kMiddleWaitingWindow;
+        auto aged = low_denied_since_.has_value() &&
+                    now - low_denied_since_.value() >= kAgingThreshold;
+        if (slots == 0 || !middle_waiting || aged) {
+            running_++;
+            low_denied_since_.reset();
+            return true;
+        }
+    }
+    if (!low_priority) {
+        middle_denied_at_ = now;
+    } else if (!low_denied_since_.has_value()) {
+        low_denied_since_ = now;
+    }
+    return false;
+}
+
+void
+BackgroundCpuShare::Release() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    running_--;
+}
+
+bool
+BackgroundCpuShare::InBackgroundTask() {
+    return in_background_task;
+}
+
+void
+BackgroundCpuShare::SetInBackgroundTask(bool in_task) {
+    in_background_task = in_task;
+}
+
 void
 ThreadPool::Init() {
     std::lock_guard<std::mutex> lock(mutex_);
@@ -114,6 +179,9 @@ ThreadPool::Worker() {
     std::function<void()> func;
     bool dequeue;
     SetThreadName(name_);
+    if (arena_pool_ != JEMALLOC_ARENA_POOL_NUM) {
+        BindThreadToJemallocArena(arena_pool_);
+    }
     while (!shutdown_) {
         std::unique_lock<std::mutex> lock(mutex_);
         idle_threads_size_++;
@@ -123,10 +191,32 @@ ThreadPool::Worker() {
         if (metric_active_) {
             metric_active_->Set(current_threads_size_ - idle_threads_size_);
         }
-        auto is_timeout = !condition_lock_.wait_for(
-            lock, std::chrono::seconds(WAIT_SECONDS), [this]() {
-                return shutdown_ || !work_queue_.empty();
-            });
+        // a gated task is taken only once it got a slot of the cpu share
+        bool gated = false;
+        auto ready = [this, &gated]() {
+            if (shutdown_ || !work_queue_.empty()) {
+                return true;
+            }
+            gated = !gated_queue_.empty() &&
+                    cpu_share_->TryAcquire(low_cpu_share_);
+            return gated;
+        };
+        auto deadline = std::chrono::steady_clock::now() +
+                        std::chrono::seconds(WAIT_SECONDS);
+        bool is_timeout = false;
+        while (!ready()) {
+            auto wake_at = deadline;
+            if (!gated_queue_.empty()) {
+                wake_at = std::min(
+                    deadline,
+                    std::chrono::steady_clock::now() + GATE_POLL_INTERVAL);
+            }
+            condition_lock_.wait_until(lock, wake_at);
+            if (std::chrono::steady_clock::now() >= deadline) {
+                is_timeout = !ready();
+                break;
+            }
+        }
         idle_threads_size_--;
         if (metric_idle_) {
             metric_idle_->Set(idle_threads_size_);
@@ -134,7 +224,7 @@ ThreadPool::Worker() {
         if (metric_active_) {
             metric_active_->Set(current_threads_size_ - idle_threads_size_);
         }
-        if (work_queue_.empty()) {
+        if (!gated && work_queue_.empty()) {
             // Dynamic reduce thread number
             if (shutdown_) {
                 current_threads_size_--;
@@ -158,18 +248,24 @@ ThreadPool::Worker() {
                 continue;
             }
         }
-        dequeue = work_queue_.dequeue(func);
+        dequeue =
+            gated ? gated_queue_.dequeue(func) : work_queue_.dequeue(func);
         if (metric_queue_depth_) {
-            metric_queue_depth_->Set(work_queue_.size());
+            metric_queue_depth_->Set(QueueSize());
         }
         lock.unlock();
         if (dequeue) {
+            // what this task submits to the background pools is not gated
+            BackgroundCpuShare::SetInBackgroundTask(cpu_share_ != nullptr);
             func();
             func = nullptr;
             if (metric_completed_) {
                 metric_completed_->Increment();
             }
         }
+        if (gated) {
+            cpu_share_->Release();
+        }
     }
 }
 };  // namespace milvus
@@ -27,6 +27,7 @@
 #include <future>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <ostream>
 #include <string>
 #include <thread>
@@ -40,6 +41,7 @@
 #include "SafeQueue.h"
 #include "glog/logging.h"
 #include "log/Log.h"
+#include "monitor/jemalloc_stats_c.h"
 
 namespace milvus {
 
@@ -57,6 +59,9 @@ extern std::atomic<float> LOW_PRIORITY_THREAD_CORE_COEFFICIENT;
 
 extern int CPU_NUM;
 extern std::atomic<int> THREAD_POOL_MAX_THREADS_SIZE;
+// share of the cores the tasks of the MIDDLE and LOW pools may use at once,
+// 0 for no cap
+extern std::atomic<float> BACKGROUND_THREAD_POOL_CPU_SHARE;
 
 void
 SetHighPriorityThreadCoreCoefficient(const float coefficient);
@@ -73,10 +78,72 @@ InitCpuNum(const int core);
 void
 SetThreadPoolMaxThreadsSize(const int size);
 
+void
+SetBackgroundThreadPoolCpuShare(const float share);
+
+// Admission of the tasks of the background pools, i.e. loads and warmups,
+// to BACKGROUND_THREAD_POOL_CPU_SHARE of the cores, so that however many
+// threads these pools grow to they leave the rest of the cores to the
+// search executor.
+//
+// A free slot goes to MIDDLE tasks before LOW ones, though once LOW tasks
+// have been denied for kAgingThreshold one of them takes the next slot, so
+// that warmups still progress under a steady stream of loads. A task
+// submitted from within a background task bypasses the cap, as its parent
+// holds a slot while it waits for it.
+class BackgroundCpuShare {
+ public:
+    static constexpr auto kAgingThreshold = std::chrono::seconds(1);
+    // how long a denied MIDDLE task keeps LOW tasks out, well above the
+    // interval gated workers poll at
+    static constexpr auto kMiddleWaitingWindow = std::chrono::milliseconds(50);
+
+    static BackgroundCpuShare&
+    GetInstance() {
+        static BackgroundCpuShare instance;
+        return instance;
+    }
+
+    // The number of background tasks that may run at once, 0 if unlimited.
+    static int
+    Slots();
+
+    // Takes a slot if the task may run now, to be given back by Release.
+    bool
+    TryAcquire(bool low_priority);
+
+    void
+    Release();
+
+    int
+    Running() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return running_;
+    }
+
+    // Whether the calling thread runs a task of a background pool.
+    static bool
+    InBackgroundTask();
+
+    static void
+    SetInBackgroundTask(bool in_task);
+
+ private:
+    mutable std::mutex mutex_;
+    int running_{0};
+    std::chrono::steady_clock::time_point middle_denied_at_{};
+    std::optional<std::chrono::steady_clock::time_point> low_denied_since_;
+};
+
 class ThreadPool {
  public:
-    explicit ThreadPool(const float thread_core_coefficient, std::string name)
-        : shutdown_(false), name_(std::move(name)) {
+    // `arena_pool` is the jemalloc arena the workers allocate from when
+    // arenas per pool are enabled, JEMALLOC_ARENA_POOL_NUM for the default
+    explicit ThreadPool(
+        const float thread_core_coefficient,
+        std::string name,
+        JemallocArenaPool arena_pool = JEMALLOC_ARENA_POOL_NUM)
+        : shutdown_(false), name_(std::move(name)), arena_pool_(arena_pool) {
         idle_threads_size_ = 0;
         current_threads_size_ = 0;
         min_threads_size_ = 1;
@@ -160,12 +227,16 @@ class ThreadPool {
             observe_execute();
         };
 
-        work_queue_.enqueue(wrap_func);
+        if (cpu_share_ != nullptr && !BackgroundCpuShare::InBackgroundTask()) {
+            gated_queue_.enqueue(wrap_func);
+        } else {
+            work_queue_.enqueue(wrap_func);
+        }
         if (metric_submitted_) {
             metric_submitted_->Increment();
         }
         if (metric_queue_depth_) {
-            metric_queue_depth_->Set(work_queue_.size());
+            metric_queue_depth_->Set(QueueSize());
         }
 
         std::lock_guard<std::mutex> lock(mutex_);
@@ -173,7 +244,7 @@ class ThreadPool {
         if (idle_threads_size_ > 0) {
             condition_lock_.notify_one();
         }
-        if (work_queue_.size() > static_cast<size_t>(idle_threads_size_) &&
+        if (QueueSize() > static_cast<size_t>(idle_threads_size_) &&
             current_threads_size_ < max_threads_size_.load()) {
             // Dynamic increase thread number
             std::thread t(&ThreadPool::Worker, this);
@@ -191,6 +262,20 @@ class ThreadPool {
     void
     FinishThreads();
 
+    size_t
+    QueueSize() {
+        return work_queue_.size() + gated_queue_.size();
+    }
+
+    // Gates the tasks submitted from outside the background pools by
+    // `cpu_share`, asking for slots of `low_priority`.
+    void
+    SetCpuShare(BackgroundCpuShare* cpu_share, bool low_priority) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        cpu_share_ = cpu_share;
+        low_cpu_share_ = low_priority;
+    }
+
     void
     Resize(int new_size) {
         //no need to hold mutex here as we don't require
@@ -234,7 +319,7 @@ class ThreadPool {
             metric_idle_->Set(idle_threads_size_);
         }
         if (metric_queue_depth_) {
-            metric_queue_depth_->Set(work_queue_.size());
+            metric_queue_depth_->Set(QueueSize());
         }
     }
 
@@ -245,12 +330,20 @@ class ThreadPool {
     std::atomic<int> max_threads_size_;
     bool shutdown_;
     static constexpr size_t WAIT_SECONDS = 2;
+    // a free slot of the cpu share notifies no pool, so workers with gated
+    // tasks queued poll for one
+    static constexpr auto GATE_POLL_INTERVAL = std::chrono::milliseconds(10);
     SafeQueue<std::function<void()>> work_queue_;
+    // tasks waiting for a slot of cpu_share_
+    SafeQueue<std::function<void()>> gated_queue_;
+    BackgroundCpuShare* cpu_share_{nullptr};
+    bool low_cpu_share_{false};
     std::unordered_map<std::thread::id, std::thread> threads_;
     SafeQueue<std::thread::id> need_finish_threads_;
     std::mutex mutex_;
     std::condition_variable condition_lock_;
     std::string name_;
+    JemallocArenaPool arena_pool_;
 
     // Prometheus metrics (set via SetMetrics, nullptr if not wired)
     prometheus::Gauge* metric_capacity_{nullptr};
@@ -15,7 +15,12 @@
 // limitations under the License.
 
 #include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <future>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include "storage/ThreadPool.h"
@@ -31,6 +36,11 @@ class ThreadPoolTest : public testing::Test {
         // Reset to default max threads size
         SetThreadPoolMaxThreadsSize(16);
     }
+
+    void
+    TearDown() override {
+        SetBackgroundThreadPoolCpuShare(0);
+    }
 };
 
 TEST_F(ThreadPoolTest, ResizeWithinBounds) {
@@ -138,4 +148,80 @@ TEST_F(ThreadPoolTest, DynamicMaxThreadsSizeUpdate) {
     EXPECT_EQ(pool.GetMaxThreadNum(), 8);
 }
 
+TEST_F(ThreadPoolTest, CpuShareGrantsMiddleBeforeLow) {
+    SetBackgroundThreadPoolCpuShare(0);
+    BackgroundCpuShare share;
+    EXPECT_EQ(BackgroundCpuShare::Slots(), 0);
+    EXPECT_TRUE(share.TryAcquire(true));
+    share.Release();
+
+    // CPU_NUM=4, 2 slots
+    SetBackgroundThreadPoolCpuShare(0.5);
+    EXPECT_EQ(BackgroundCpuShare::Slots(), 2);
+    EXPECT_TRUE(share.TryAcquire(false));
+    EXPECT_TRUE(share.TryAcquire(false));
+    EXPECT_FALSE(share.TryAcquire(false));
+    EXPECT_FALSE(share.TryAcquire(true));
+    EXPECT_EQ(share.Running(), 2);
+
+    // the waiting MIDDLE task gets the freed slot
+    share.Release();
+    EXPECT_FALSE(share.TryAcquire(true));
+    EXPECT_TRUE(share.TryAcquire(false));
+
+    // without MIDDLE tasks waiting LOW ones run
+    std::this_thread::sleep_for(BackgroundCpuShare::kMiddleWaitingWindow);
+    share.Release();
+    EXPECT_TRUE(share.TryAcquire(true));
+    share.Release();
+    share.Release();
+    EXPECT_EQ(share.Running(), 0);
+}
+
+TEST_F(ThreadPoolTest, CpuShareAgesLowTasks) {
+    // CPU_NUM=4, 1 slot
+    SetBackgroundThreadPoolCpuShare(0.25);
+    BackgroundCpuShare share;
+    EXPECT_TRUE(share.TryAcquire(false));
+    EXPECT_FALSE(share.TryAcquire(true));
+
+    std::this_thread::sleep_for(BackgroundCpuShare::kAgingThreshold);
+    EXPECT_FALSE(share.TryAcquire(false));
+    share.Release();
+    // denied for long enough, the LOW task goes before the MIDDLE one
+    EXPECT_TRUE(share.TryAcquire(true));
+    EXPECT_FALSE(share.TryAcquire(false));
+    share.Release();
+}
+
+TEST_F(ThreadPoolTest, CpuShareCapsRunningTasks) {
+    // CPU_NUM=4, 1 slot
+    SetBackgroundThreadPoolCpuShare(0.25);
+    BackgroundCpuShare share;
+    ThreadPool pool(1.0, "test_pool");
+    pool.SetCpuShare(&share, false);
+
+    std::atomic<int> running{0};
+    std::atomic<int> max_running{0};
+    std::vector<std::future<int>> futures;
+    for (int i = 0; i < 8; i++) {
+        futures.push_back(pool.Submit([&, i]() {
+            auto now = running.fetch_add(1) + 1;
+            auto seen = max_running.load();
+            while (now > seen &&
+                   !max_running.compare_exchange_weak(seen, now)) {
+            }
+            // nested tasks do not wait for the slot their parent holds
+            auto nested = pool.Submit([i]() { return i; });
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            running.fetch_sub(1);
+            return nested.get();
+        }));
+    }
+    for (int i = 0; i < 8; i++) {
+        EXPECT_EQ(futures[i].get(), i);
+    }
+    EXPECT_EQ(max_running.load(), 1);
+}
+
 }  // namespace milvus
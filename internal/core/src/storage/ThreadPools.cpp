@@ -60,8 +60,13 @@ ThreadPools::GetThreadPool(milvus::ThreadPoolPriority priority) {
                 break;
         }
         std::string name = name_map()[priority];
+        // the middle pool builds indexes and reduces, the others load
+        auto arena_pool = priority == milvus::ThreadPoolPriority::MIDDLE
+                              ? JEMALLOC_ARENA_BUILD
+                              : JEMALLOC_ARENA_LOAD;
         auto result = thread_pool_map.emplace(
-            priority, std::make_unique<ThreadPool>(coefficient, name));
+            priority,
+            std::make_unique<ThreadPool>(coefficient, name, arena_pool));
         auto& pool = *(result.first->second);
         switch (priority) {
             case HIGH:
@@ -88,6 +93,7 @@ ThreadPools::GetThreadPool(milvus::ThreadPoolPriority priority) {
                         internal_storage_pool_queue_duration_seconds_middle,
                     &monitor::
                         internal_storage_pool_execute_duration_seconds_middle);
+                pool.SetCpuShare(&BackgroundCpuShare::GetInstance(), false);
                 break;
             case LOW:
                 pool.SetMetrics(
@@ -100,6 +106,7 @@ ThreadPools::GetThreadPool(milvus::ThreadPoolPriority priority) {
                     &monitor::internal_storage_pool_queue_duration_seconds_low,
                     &monitor::
                         internal_storage_pool_execute_duration_seconds_low);
+                pool.SetCpuShare(&BackgroundCpuShare::GetInstance(), true);
                 break;
         }
         return pool;
@@ -14,6 +14,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <chrono>
 #include <filesystem>
 #include <memory>
 #include "common/FastMem.h"
@@ -50,6 +51,7 @@
 #include "storage/LocalChunkManager.h"
 #include "storage/MemFileManagerImpl.h"
 #include "storage/minio/MinioChunkManager.h"
+#include "storage/SmallObjectReader.h"
 #include "storage/Types.h"
 #include "storage/Util.h"
 #include "common/Common.h"
@@ -446,6 +448,39 @@ AddOneBinaryToArrowBuilder(std::shared_ptr<arrow::ArrayBuilder> builder,
         ast.ok(), "append value to arrow builder failed: {}", ast.ToString());
 }
 
+void
+AddBinariesToArrowBuilder(std::shared_ptr<arrow::ArrayBuilder> builder,
+                          const std::vector<std::string_view>& values,
+                          const uint8_t* valid_data) {
+    AssertInfo(builder != nullptr, "empty arrow builder");
+    // StringBuilder is a BinaryBuilder holding utf8
+    auto binary_builder =
+        std::dynamic_pointer_cast<arrow::BinaryBuilder>(builder);
+    AssertInfo(binary_builder != nullptr,
+               "builder must be a string or binary builder");
+    auto is_valid = [valid_data](size_t i) {
+        return valid_data == nullptr ||
+               ((valid_data[i >> 3] >> (i & 0x07)) & 1);
+    };
+    int64_t data_size = 0;
+    for (size_t i = 0; i < values.size(); ++i) {
+        if (is_valid(i)) {
+            data_size += values[i].size();
+        }
+    }
+    auto ast = binary_builder->Reserve(values.size());
+    AssertInfo(ast.ok(), "reserve arrow builder failed: {}", ast.ToString());
+    ast = binary_builder->ReserveData(data_size);
+    AssertInfo(ast.ok(), "reserve arrow builder failed: {}", ast.ToString());
+    for (size_t i = 0; i < values.size(); ++i) {
+        if (is_valid(i)) {
+            binary_builder->UnsafeAppend(values[i]);
+        } else {
+            binary_builder->UnsafeAppendNull();
+        }
+    }
+}
+
 std::shared_ptr<arrow::ArrayBuilder>
 CreateArrowBuilder(DataType data_type) {
     switch (static_cast<DataType>(data_type)) {
@@ -1026,20 +1061,46 @@ GetObjectData(ChunkManager* remote_chunk_manager,
     std::vector<std::future<std::unique_ptr<DataCodec>>> futures;
     futures.reserve(remote_files.size());
 
+    // Start every read on the small object workers right away, the pool
+    // tasks below then only wait for the bytes and decode them.
+    auto& small_object_reader = SmallObjectReader::GetInstance();
+    std::vector<std::shared_future<RemoteObject>> objects(remote_files.size());
+    if (small_object_reader.Enabled()) {
+        for (size_t i = 0; i < remote_files.size(); i++) {
+            objects[i] =
+                small_object_reader.Read(remote_chunk_manager, remote_files[i]);
+        }
+    }
+
     auto DownloadAndDeserialize = [](ChunkManager* chunk_manager,
                                      bool is_field_data,
-                                     const std::string file) {
-        // TODO remove this Size() cost
-        auto fileSize = chunk_manager->Size(file);
-        auto buf = std::shared_ptr<uint8_t[]>(new uint8_t[fileSize]);
-        chunk_manager->Read(file, buf.get(), fileSize);
-        auto res = DeserializeFileData(buf, fileSize, is_field_data);
+                                     const std::string file,
+                                     std::shared_future<RemoteObject> read) {
+        RemoteObject object;
+        if (read.valid()) {
+            object = read.get();
+        }
+        if (object.data == nullptr) {
+            auto start = std::chrono::steady_clock::now();
+            if (!read.valid()) {
+                // TODO remove this Size() cost
+                object.size = chunk_manager->Size(file);
+            }
+            object.data = std::shared_ptr<uint8_t[]>(new uint8_t[object.size]);
+            chunk_manager->Read(file, object.data.get(), object.size);
+            SmallObjectReader::ObserveRead(
+                object.size, std::chrono::steady_clock::now() - start);
+        }
+        auto res = DeserializeFileData(object.data, object.size, is_field_data);
         return res;
     };
 
-    for (auto& file : remote_files) {
-        futures.emplace_back(pool.Submit(
-            DownloadAndDeserialize, remote_chunk_manager, is_field_data, file));
+    for (size_t i = 0; i < remote_files.size(); i++) {
+        futures.emplace_back(pool.Submit(DownloadAndDeserialize,
+                                         remote_chunk_manager,
+                                         is_field_data,
+                                         remote_files[i],
+                                         objects[i]));
     }
     return futures;
 }
@@ -1374,6 +1435,39 @@ FetchFieldData(ChunkManager* cm, const std::vector<std::string>& remote_files) {
     return field_datas;
 }
 
+void
+FetchFieldDataInBatches(ChunkManager* cm,
+                        const std::vector<std::string>& remote_files,
+                        int64_t memory_budget,
+                        const std::function<void(FieldDataPtr)>& consume) {
+    auto parallel_degree = std::max<int64_t>(
+        1, DEFAULT_FIELD_MAX_MEMORY_LIMIT / FILE_SLICE_SIZE.load());
+    int64_t largest_field_data = 0;
+    size_t next = 0;
+    while (next < remote_files.size()) {
+        int64_t batch_size = parallel_degree;
+        if (memory_budget > 0) {
+            batch_size =
+                largest_field_data == 0
+                    ? 1
+                    : std::clamp<int64_t>(memory_budget / largest_field_data,
+                                          1,
+                                          parallel_degree);
+        }
+        auto end = std::min(remote_files.size(), next + batch_size);
+        std::vector<std::string> batch_files(remote_files.begin() + next,
+                                             remote_files.begin() + end);
+        auto fds = GetObjectData(cm, batch_files);
+        ProcessFuturesInOrder(fds, [&](std::unique_ptr<DataCodec> codec) {
+            auto field_data = codec->GetFieldData();
+            largest_field_data = std::max<int64_t>(
+                largest_field_data, static_cast<int64_t>(field_data->Size()));
+            consume(std::move(field_data));
+        });
+        next = end;
+    }
+}
+
 std::vector<FieldDataPtr>
 GetFieldDatasFromStorageV2(std::vector<std::vector<std::string>>& remote_files,
                            int64_t field_id,
@@ -22,11 +22,13 @@
 #include <cstdint>
 #include <cstring>
 #include <exception>
+#include <functional>
 #include <future>
 #include <map>
 #include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
@@ -74,6 +76,15 @@ AddOneBinaryToArrowBuilder(std::shared_ptr<arrow::ArrayBuilder> builder,
                            const uint8_t* data,
                            int length);
 
+// Appends `values` to a string or binary builder at once: the offsets and the
+// value bytes are reserved up front, so a column costs two allocations rather
+// than a growth and a status check per row. The rows whose bit is unset in
+// `valid_data` are appended as null, nullptr means all of them are valid.
+void
+AddBinariesToArrowBuilder(std::shared_ptr<arrow::ArrayBuilder> builder,
+                          const std::vector<std::string_view>& values,
+                          const uint8_t* valid_data);
+
 std::shared_ptr<arrow::ArrayBuilder>
 CreateArrowBuilder(DataType data_type);
 
@@ -366,6 +377,17 @@ using DataTypeToOffsetMap =
 std::vector<FieldDataPtr>
 FetchFieldData(ChunkManager* cm, const std::vector<std::string>& batch_files);
 
+// Fetches `remote_files` a batch at a time and hands their field datas to
+// `consume` in order. With a positive `memory_budget` the first batch is one
+// file and the next ones take as many files as the budget holds going by
+// the largest field data so far, otherwise batches take a fixed number of
+// files as FetchFieldData does.
+void
+FetchFieldDataInBatches(ChunkManager* cm,
+                        const std::vector<std::string>& remote_files,
+                        int64_t memory_budget,
+                        const std::function<void(FieldDataPtr)>& consume);
+
 inline void
 SortByPath(std::vector<std::string>& paths) {
     std::sort(paths.begin(),
@@ -469,6 +469,11 @@ MinioChunkManager::Size(const std::string& filepath) {
     return GetObjectSize(default_bucket_name_, filepath);
 }
 
+ObjectVersion
+MinioChunkManager::GetObjectVersion(const std::string& filepath) {
+    return GetObjectVersion(default_bucket_name_, filepath);
+}
+
 bool
 MinioChunkManager::Exist(const std::string& filepath) {
     return ObjectExists(default_bucket_name_, filepath);
@@ -603,6 +608,12 @@ MinioChunkManager::ObjectExists(const std::string& bucket_name,
 uint64_t
 MinioChunkManager::GetObjectSize(const std::string& bucket_name,
                                  const std::string& object_name) {
+    return GetObjectVersion(bucket_name, object_name).size;
+}
+
+ObjectVersion
+MinioChunkManager::GetObjectVersion(const std::string& bucket_name,
+                                    const std::string& object_name) {
     Aws::S3::Model::HeadObjectRequest request;
     request.SetBucket(bucket_name.c_str());
     request.SetKey(object_name.c_str());
@@ -623,7 +634,9 @@ MinioChunkManager::GetObjectSize(const std::string& bucket_name,
                      object_name);
     }
     milvus::monitor::internal_storage_op_count_stat_suc.Increment();
-    return outcome.GetResult().GetContentLength();
+    const auto& result = outcome.GetResult();
+    return ObjectVersion{static_cast<uint64_t>(result.GetContentLength()),
+                         std::string(result.GetETag().c_str())};
 }
 
 bool
@@ -146,6 +146,9 @@ class MinioChunkManager : public ChunkManager {
     virtual uint64_t
     Size(const std::string& filepath);
 
+    virtual ObjectVersion
+    GetObjectVersion(const std::string& filepath);
+
     virtual uint64_t
     Read(const std::string& filepath,
          uint64_t offset,
@@ -214,6 +217,9 @@ class MinioChunkManager : public ChunkManager {
     uint64_t
     GetObjectSize(const std::string& bucket_name,
                   const std::string& object_name);
+    ObjectVersion
+    GetObjectVersion(const std::string& bucket_name,
+                     const std::string& object_name);
     bool
     DeleteObject(const std::string& bucket_name,
                  const std::string& object_name);
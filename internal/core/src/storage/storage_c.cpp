@@ -26,9 +26,12 @@
 #include "storage/FileWriter.h"
 #include "storage/LocalChunkManager.h"
 #include "storage/LocalChunkManagerSingleton.h"
+#include "storage/LocalObjectCache.h"
 #include "storage/MmapManager.h"
 #include "storage/PluginLoader.h"
 #include "storage/RemoteChunkManagerSingleton.h"
+#include "storage/RemoteInputStream.h"
+#include "storage/SmallObjectReader.h"
 #include "storage/ThreadPools.h"
 #include "storage/KeyRetriever.h"
 #include "storage/Types.h"
@@ -151,6 +154,11 @@ InitDiskFileWriterConfig(CDiskWriteConfig c_disk_write_config) {
             // and it will try to find a proper and valid buffer size
             milvus::storage::FileWriter::SetBufferSize(
                 c_disk_write_config.buffer_size_kb * 1024);  // convert to bytes
+        } else if (mode_str == "io_uring") {
+            milvus::storage::FileWriter::SetMode(
+                milvus::storage::FileWriter::WriteMode::IO_URING);
+            milvus::storage::FileWriter::SetBufferSize(
+                c_disk_write_config.buffer_size_kb * 1024);  // convert to bytes
         } else if (mode_str == "buffered") {
             milvus::storage::FileWriter::SetMode(
                 milvus::storage::FileWriter::WriteMode::BUFFERED);
@@ -199,6 +207,57 @@ InitArrowReaderConfig(CArrowReaderConfig c_arrow_reader_config) {
     }
 }
 
+CStatus
+InitRemoteReadConfig(CRemoteReadConfig c_remote_read_config) {
+    try {
+        if (c_remote_read_config.min_part_size_bytes <= 0 ||
+            c_remote_read_config.max_part_size_bytes <
+                c_remote_read_config.min_part_size_bytes) {
+            return milvus::FailureCStatus(
+                milvus::ConfigInvalid,
+                "remote read part sizes must be positive with min <= max");
+        }
+        if (c_remote_read_config.hedge_ratio < 0) {
+            return milvus::FailureCStatus(
+                milvus::ConfigInvalid,
+                "remote read hedge ratio must be non-negative");
+        }
+        if (c_remote_read_config.small_object_threads < 0 ||
+            c_remote_read_config.small_object_max_bytes < 0) {
+            return milvus::FailureCStatus(
+                milvus::ConfigInvalid,
+                "small object read threads and size must be non-negative");
+        }
+        milvus::storage::RemoteParallelReadConfig config;
+        config.nr_workers = c_remote_read_config.nr_threads;
+        config.min_part_size = c_remote_read_config.min_part_size_bytes;
+        config.max_part_size = c_remote_read_config.max_part_size_bytes;
+        config.hedge_ratio = c_remote_read_config.hedge_ratio;
+        milvus::storage::RemoteReadWorkerPool::GetInstance().Configure(config);
+        milvus::storage::SmallObjectReader::GetInstance().Configure(
+            c_remote_read_config.small_object_threads,
+            c_remote_read_config.small_object_max_bytes);
+        return milvus::SuccessCStatus();
+    } catch (std::exception& e) {
+        return milvus::FailureCStatus(&e);
+    }
+}
+
+CStatus
+InitLocalObjectCache(const char* path, int64_t capacity_bytes) {
+    try {
+        if (capacity_bytes < 0) {
+            return milvus::FailureCStatus(
+                milvus::ConfigInvalid,
+                "local object cache capacity must be non-negative");
+        }
+        milvus::storage::LocalObjectCache::InitGlobal(path, capacity_bytes);
+        return milvus::SuccessCStatus();
+    } catch (std::exception& e) {
+        return milvus::FailureCStatus(&e);
+    }
+}
+
 void
 CleanRemoteChunkManagerSingleton() {
     milvus::storage::RemoteChunkManagerSingleton::GetInstance().Release();
@@ -48,6 +48,14 @@ InitDiskFileWriterConfig(CDiskWriteConfig c_disk_write_config);
 CStatus
 InitArrowReaderConfig(CArrowReaderConfig c_arrow_reader_config);
 
+CStatus
+InitRemoteReadConfig(CRemoteReadConfig c_remote_read_config);
+
+// Must be called before InitRemoteChunkManagerSingleton to take effect,
+// capacity 0 disables the cache.
+CStatus
+InitLocalObjectCache(const char* path, int64_t capacity_bytes);
+
 // Plugin related APIs
 CStatus
 InitPluginLoader(const char* plugin_path);
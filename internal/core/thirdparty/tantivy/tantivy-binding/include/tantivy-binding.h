@@ -456,6 +456,12 @@ RustResult tantivy_index_add_string_by_single_segment_writer(void *ptr,
                                                              const uint8_t *s,
                                                              uintptr_t len);
 
+RustResult tantivy_index_add_strings(void *ptr,
+                                     const uint8_t *const *array,
+                                     const uintptr_t *str_lens,
+                                     uintptr_t len,
+                                     int64_t offset_begin);
+
 RustResult tantivy_index_add_json_key_stats_data_by_batch(void *ptr,
                                                           const char *const *keys,
                                                           const int64_t *const *json_offsets,
@@ -113,6 +113,35 @@ mod tests {
         assert_eq!(res, vec![2, 4, 5].into_iter().collect::<HashSet<u32>>());
     }
 
+    #[test]
+    fn test_ngram_writer_with_threads() {
+        let dir = TempDir::new().unwrap();
+        let mut writer = IndexWriterWrapper::create_ngram_writer(
+            "test",
+            dir.path().to_str().unwrap(),
+            2,
+            3,
+            4,
+            4 * 15000000,
+        )
+        .unwrap();
+
+        let words = ["university", "economics", "history", "basics"];
+        for i in 0..10000 {
+            writer.add(words[i % words.len()], Some(i as i64)).unwrap();
+        }
+
+        writer.commit().unwrap();
+
+        let reader = writer.create_reader(set_bitset).unwrap();
+        let mut res: HashSet<u32> = HashSet::new();
+        reader
+            .ngram_match_query("ic", 2, 3, &mut res as *mut _ as *mut c_void)
+            .unwrap();
+        let expected: HashSet<u32> = (0..10000u32).filter(|i| i % 2 == 1).collect();
+        assert_eq!(res, expected);
+    }
+
     #[test]
     fn test_ngram_writer_chinese() {
         let dir = TempDir::new().unwrap();
@@ -8,7 +8,7 @@ use crate::{
     index_reader_c::SetBitsetFn,
     index_writer::IndexWriterWrapper,
     ptr_to_str,
-    util::{create_binding, free_binding},
+    util::{create_binding, free_binding, ptr_len_to_str},
     TantivyIndexVersion,
 };
 
@@ -429,6 +429,29 @@ pub extern "C" fn tantivy_index_add_string_by_single_segment_writer(
     unsafe { (*real).add::<&str>(s, None).into() }
 }
 
+// Adds `len` strings given by their pointers and lengths in one call, the
+// i-th string as the doc `offset_begin + i`.
+#[no_mangle]
+pub extern "C" fn tantivy_index_add_strings(
+    ptr: *mut c_void,
+    array: *const *const u8,
+    str_lens: *const usize,
+    len: usize,
+    offset_begin: i64,
+) -> RustResult {
+    let real = ptr as *mut IndexWriterWrapper;
+    unsafe {
+        let ptrs = convert_to_rust_slice!(array, len);
+        let lens = convert_to_rust_slice!(str_lens, len);
+        (0..len)
+            .try_for_each(|i| {
+                let s = ptr_len_to_str(ptrs[i], lens[i])?;
+                (*real).add::<&str>(s, Some(offset_begin + i as i64))
+            })
+            .into()
+    }
+}
+
 #[no_mangle]
 pub extern "C" fn tantivy_index_add_json_key_stats_data_by_batch(
     ptr: *mut c_void,
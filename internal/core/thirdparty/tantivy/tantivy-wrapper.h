@@ -317,18 +317,21 @@ struct TantivyIndexWrapper {
         }
 
         if constexpr (std::is_same_v<T, std::string>) {
-            // TODO: not very efficient, a lot of overhead due to rust-ffi call.
+            // pass the strings in one rust-ffi call instead of one per row
+            std::vector<const uint8_t*> ptrs;
+            std::vector<uintptr_t> lens;
+            ptrs.reserve(len);
+            lens.reserve(len);
             for (uintptr_t i = 0; i < len; i++) {
                 const auto& s = static_cast<const std::string*>(array)[i];
-                auto res = RustResultWrapper(tantivy_index_add_string(
-                    writer_,
-                    reinterpret_cast<const uint8_t*>(s.data()),
-                    s.size(),
-                    offset_begin + i));
-                AssertInfo(res.result_->success,
-                           "failed to add string: {}",
-                           res.result_->error);
+                ptrs.push_back(reinterpret_cast<const uint8_t*>(s.data()));
+                lens.push_back(s.size());
             }
+            auto res = RustResultWrapper(tantivy_index_add_strings(
+                writer_, ptrs.data(), lens.data(), len, offset_begin));
+            AssertInfo(res.result_->success,
+                       "failed to add strings: {}",
+                       res.result_->error);
             return;
         }
 
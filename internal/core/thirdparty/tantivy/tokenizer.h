@@ -1,5 +1,11 @@
 #pragma once
 
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
 #include "tantivy-binding.h"
 #include "rust-binding.h"
 #include "rust-hashmap.h"
@@ -70,6 +76,105 @@ struct Tokenizer {
     void* ptr_;
 };
 
+// Analyzers built from the same params share one prototype, so the
+// dictionaries of heavy tokenizers such as jieba or lindera are loaded once
+// instead of once per tokenizer created. Tokenizers handed out are clones
+// of the prototype, as an analyzer must not be used by two threads at once.
+class TokenizerCache {
+ public:
+    // A tokenizer of its own for `params`.
+    static std::unique_ptr<Tokenizer>
+    Create(const std::string& params, const std::string& extra_info) {
+        return Prototype(params, extra_info)->Clone();
+    }
+
+    // The tokenizer of the calling thread for `params`, valid until the
+    // thread calls ThreadLocal again.
+    static Tokenizer&
+    ThreadLocal(const std::string& params, const std::string& extra_info) {
+        thread_local ThreadCache cache;
+        auto generation = Instance().generation.load();
+        if (cache.generation != generation) {
+            cache.tokenizers.clear();
+            cache.generation = generation;
+        }
+        auto key = Key(params, extra_info);
+        auto it = cache.tokenizers.find(key);
+        if (it == cache.tokenizers.end()) {
+            if (cache.tokenizers.size() >= kMaxEntries) {
+                cache.tokenizers.clear();
+            }
+            it = cache.tokenizers
+                     .emplace(std::move(key), Create(params, extra_info))
+                     .first;
+        }
+        return *it->second;
+    }
+
+    // Drops every prototype and thread tokenizer, the analyzer options
+    // they were built with changed.
+    static void
+    Clear() {
+        auto& instance = Instance();
+        std::lock_guard<std::mutex> lock(instance.mutex);
+        instance.prototypes.clear();
+        instance.generation++;
+    }
+
+ private:
+    // bounds the cached analyzers, a collection has a handful of them
+    static constexpr size_t kMaxEntries = 64;
+
+    struct Registry {
+        std::mutex mutex;
+        std::unordered_map<std::string, std::shared_ptr<Tokenizer>>
+            prototypes;
+        std::atomic<uint64_t> generation{0};
+    };
+
+    struct ThreadCache {
+        uint64_t generation{0};
+        std::unordered_map<std::string, std::unique_ptr<Tokenizer>>
+            tokenizers;
+    };
+
+    static Registry&
+    Instance() {
+        static Registry registry;
+        return registry;
+    }
+
+    static std::string
+    Key(const std::string& params, const std::string& extra_info) {
+        std::string key = params;
+        key.push_back('\0');
+        key.append(extra_info);
+        return key;
+    }
+
+    static std::shared_ptr<Tokenizer>
+    Prototype(const std::string& params, const std::string& extra_info) {
+        auto& instance = Instance();
+        auto key = Key(params, extra_info);
+        {
+            std::lock_guard<std::mutex> lock(instance.mutex);
+            auto it = instance.prototypes.find(key);
+            if (it != instance.prototypes.end()) {
+                return it->second;
+            }
+        }
+        // built out of the lock, loading a dictionary takes a while
+        auto prototype = std::make_shared<Tokenizer>(std::string(params),
+                                                     std::string(extra_info));
+        std::lock_guard<std::mutex> lock(instance.mutex);
+        if (instance.prototypes.size() >= kMaxEntries) {
+            instance.prototypes.clear();
+        }
+        return instance.prototypes.emplace(std::move(key), prototype)
+            .first->second;
+    }
+};
+
 inline void
 set_tokenizer_options(std::string&& params) {
     auto shared_params = std::make_shared<std::string>(params);
@@ -78,6 +183,7 @@ set_tokenizer_options(std::string&& params) {
     AssertInfo(res.result_->success,
                "Set analyzer option failed: {}",
                res.result_->error);
+    TokenizerCache::Clear();
 }
 
 inline std::pair<int64_t*, size_t>
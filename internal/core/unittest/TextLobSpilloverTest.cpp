@@ -13,6 +13,7 @@
 
 #include <filesystem>
 #include <string>
+#include <string_view>
 #include <thread>
 #include <vector>
 
@@ -180,3 +181,86 @@ TEST_F(TextLobSpilloverTest, EmptyText) {
 
     ASSERT_EQ(read_back, "");
 }
+
+namespace {
+
+// similar documents, compressible alone and much more with a dictionary
+std::string
+Document(int i) {
+    return "{\"title\": \"document " + std::to_string(i) +
+           "\", \"body\": \"the quick brown fox jumps over the lazy dog, "
+           "item " +
+           std::to_string(i * 7919 % 1000) +
+           " of the catalog is in stock\", \"tags\": [\"animal\", "
+           "\"story\", \"" +
+           std::to_string(i % 13) + "\"]}";
+}
+
+}  // namespace
+
+TEST_F(TextLobSpilloverTest, CompressesWithTrainedDictionary) {
+    TextLobSpillover spillover(12345, FieldId(100), test_dir_);
+
+    std::vector<std::string> texts;
+    std::vector<std::string> refs;
+    size_t raw_bytes = 0;
+    while (raw_bytes < TextLobSpillover::kDictSampleBytes) {
+        texts.push_back(Document(texts.size()));
+        refs.push_back(spillover.WriteAndEncode(texts.back()));
+        raw_bytes += texts.back().size();
+    }
+    ASSERT_GE(texts.front().size(), TextLobSpillover::kMinCompressSize);
+    EXPECT_EQ(TextLobRef::Decode(refs.front()).flags, TextLobRef::kZstd);
+
+    // the texts after the samples are compressed with the dictionary
+    auto sampled_usage = spillover.GetDiskUsage();
+    size_t dict_raw_bytes = 0;
+    for (int i = 0; i < 1000; i++) {
+        texts.push_back(Document(texts.size()));
+        refs.push_back(spillover.WriteAndEncode(texts.back()));
+        dict_raw_bytes += texts.back().size();
+        ASSERT_EQ(TextLobRef::Decode(refs.back()).flags,
+                  TextLobRef::kZstdDict);
+    }
+    EXPECT_LT(spillover.GetDiskUsage() - sampled_usage, dict_raw_bytes / 4);
+
+    for (size_t i = 0; i < texts.size(); i += 97) {
+        ASSERT_EQ(spillover.DecodeAndRead(refs[i]), texts[i]);
+    }
+}
+
+TEST_F(TextLobSpilloverTest, BatchReadMatchesSingleReads) {
+    TextLobSpillover spillover(12345, FieldId(100), test_dir_);
+
+    std::vector<std::string> texts;
+    std::vector<std::string> refs;
+    for (int i = 0; i < 20000; i++) {
+        // short and incompressible ones among the documents
+        if (i % 5 == 0) {
+            texts.push_back("short " + std::to_string(i));
+        } else {
+            texts.push_back(Document(i));
+        }
+        refs.push_back(spillover.WriteAndEncode(texts.back()));
+    }
+    std::string large(TextLobSpillover::kMaxCoalescedRead + 1, 'A');
+    texts.push_back(large);
+    refs.push_back(spillover.WriteAndEncode(large));
+
+    // out of order, repeated and far apart refs
+    std::vector<size_t> picked;
+    for (size_t i = 0; i < texts.size(); i += 7) {
+        picked.push_back((i * 7919) % texts.size());
+    }
+    picked.push_back(picked.front());
+    picked.push_back(texts.size() - 1);
+    std::vector<std::string_view> batch;
+    for (auto i : picked) {
+        batch.emplace_back(refs[i]);
+    }
+    auto results = spillover.DecodeAndReadBatch(batch);
+    ASSERT_EQ(results.size(), picked.size());
+    for (size_t k = 0; k < picked.size(); k++) {
+        ASSERT_EQ(results[k], texts[picked[k]]) << "ref " << picked[k];
+    }
+}
@@ -29,6 +29,7 @@
 #include "common/TracerBase.h"
 #include "common/Types.h"
 #include "common/protobuf_utils.h"
+#include "exec/operator/Utils.h"
 #include "filemanager/InputStream.h"
 #include "gtest/gtest.h"
 #include "index/Index.h"
@@ -432,3 +433,21 @@ TEST(IterativeFilter, GrowingIndex) {
             *search_result, *search_result2, topK, num_queries);
     }
 }
+
+TEST(IterativeFilter, NextBatchSizeFollowsPassRate) {
+    using milvus::exec::kMaxIterativeFilterBatchGrowth;
+    using milvus::exec::NextIterativeFilterBatchSize;
+    // nothing seen yet: pull exactly what is missing
+    EXPECT_EQ(NextIterativeFilterBatchSize(10, 0, 0), 10);
+    // everything passed
+    EXPECT_EQ(NextIterativeFilterBatchSize(10, 10, 10), 10);
+    // one in four passed, 6 missing -> 24 candidates
+    EXPECT_EQ(NextIterativeFilterBatchSize(6, 16, 4), 24);
+    EXPECT_EQ(NextIterativeFilterBatchSize(3, 10, 1), 30);
+    // nothing passed, and pass rates below 1/64 are capped
+    EXPECT_EQ(NextIterativeFilterBatchSize(10, 10, 0),
+              10 * kMaxIterativeFilterBatchGrowth);
+    EXPECT_EQ(NextIterativeFilterBatchSize(10, 100000, 1),
+              10 * kMaxIterativeFilterBatchGrowth);
+    EXPECT_EQ(NextIterativeFilterBatchSize(0, 10, 10), 0);
+}
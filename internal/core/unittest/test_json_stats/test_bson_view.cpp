@@ -381,4 +381,131 @@ TEST_F(BsonViewTest, GetValueFromBsonViewTest) {
     bson_destroy(&doc);
 }
 
+TEST_F(BsonViewTest, IterateAllTypesTest) {
+    bson_t doc;
+    bson_init(&doc);
+    bson_append_double(&doc, "double", -1, 2.5);
+    bson_append_utf8(&doc, "string", -1, "text", -1);
+    bson_t nested;
+    bson_append_document_begin(&doc, "document", -1, &nested);
+    bson_append_int32(&nested, "inner", -1, 7);
+    bson_append_document_end(&doc, &nested);
+    bson_t arr;
+    bson_append_array_begin(&doc, "array", -1, &arr);
+    bson_append_int64(&arr, "0", -1, 8);
+    bson_append_array_end(&doc, &arr);
+    const uint8_t blob[] = {1, 2, 3};
+    bson_append_binary(&doc, "binary", -1, BSON_SUBTYPE_BINARY, blob, 3);
+    bson_append_bool(&doc, "bool", -1, false);
+    bson_append_null(&doc, "null", -1);
+    bson_append_int32(&doc, "int32", -1, -3);
+    bson_append_int64(&doc, "int64", -1, 1LL << 40);
+
+    const uint8_t* data = bson_get_data(&doc);
+    milvus::bson::document_view view(data, doc.len);
+    std::vector<std::string> keys;
+    for (auto&& e : view) {
+        keys.emplace_back(e.key());
+        auto value = e.get_value();
+        switch (e.type()) {
+            case milvus::bson::type::k_double:
+                EXPECT_EQ(e.get_double().value, 2.5);
+                break;
+            case milvus::bson::type::k_string:
+                EXPECT_EQ(e.get_string().value, "text");
+                break;
+            case milvus::bson::type::k_document: {
+                auto inner = value.get_document().value;
+                auto it = inner.begin();
+                ASSERT_NE(it, inner.end());
+                EXPECT_EQ(it->key(), "inner");
+                EXPECT_EQ(it->get_int32().value, 7);
+                EXPECT_EQ(++it, inner.end());
+                break;
+            }
+            case milvus::bson::type::k_array:
+                EXPECT_EQ(BsonView::GetNthElementInArray<int64_t>(
+                              value.get_array().value.data(), 0),
+                          8);
+                break;
+            case milvus::bson::type::k_bool:
+                EXPECT_FALSE(e.get_bool().value);
+                break;
+            case milvus::bson::type::k_int32:
+                EXPECT_EQ(e.get_int32().value, -3);
+                break;
+            case milvus::bson::type::k_int64:
+                EXPECT_EQ(e.get_int64().value, 1LL << 40);
+                break;
+            default:
+                break;
+        }
+    }
+    std::vector<std::string> expected = {"double",
+                                         "string",
+                                         "document",
+                                         "array",
+                                         "binary",
+                                         "bool",
+                                         "null",
+                                         "int32",
+                                         "int64"};
+    EXPECT_EQ(keys, expected);
+
+    // a buffer whose length does not match its header is not iterated
+    milvus::bson::document_view truncated(data, doc.len - 1);
+    EXPECT_EQ(truncated.begin(), truncated.end());
+
+    // iteration stops at an element running past the end of the document
+    std::vector<uint8_t> corrupt(data, data + doc.len);
+    // the length of "text"
+    corrupt[4 + 1 + 7 + 8 + 1 + 7] = 0x7f;
+    milvus::bson::document_view corrupt_view(corrupt.data(), corrupt.size());
+    keys.clear();
+    for (auto&& e : corrupt_view) {
+        keys.emplace_back(e.key());
+    }
+    EXPECT_EQ(keys, std::vector<std::string>{"double"});
+
+    bson_destroy(&doc);
+}
+
+TEST_F(BsonViewTest, GetNthElementSkipsNestedValuesTest) {
+    bson_t arr;
+    bson_init(&arr);
+    bson_append_null(&arr, "0", -1);
+    bson_t nested;
+    bson_append_document_begin(&arr, "1", -1, &nested);
+    bson_append_utf8(&nested, "k", -1, "v", -1);
+    bson_append_document_end(&arr, &nested);
+    bson_t sub;
+    bson_append_array_begin(&arr, "2", -1, &sub);
+    bson_append_int64(&sub, "0", -1, 1);
+    bson_append_array_end(&arr, &sub);
+    for (int i = 3; i < 12; i++) {
+        bson_append_int64(&arr, std::to_string(i).c_str(), -1, i * 10);
+    }
+
+    const uint8_t* data = bson_get_data(&arr);
+    for (int i = 3; i < 12; i++) {
+        auto value = BsonView::GetNthElementInArray<int64_t>(data, i);
+        ASSERT_TRUE(value.has_value()) << i;
+        EXPECT_EQ(value.value(), i * 10);
+    }
+    auto field = BsonView::FindNthElementInArray(data, 11);
+    ASSERT_TRUE(field.has_value());
+    EXPECT_EQ(field.value().key, "11");
+    EXPECT_EQ(BsonView::GetValueFromField<double>(field.value()), std::nullopt);
+
+    auto sub_array =
+        BsonView::GetNthElementInArray<milvus::bson::array_view>(data, 2);
+    ASSERT_TRUE(sub_array.has_value());
+    EXPECT_EQ(BsonView::GetNthElementInArray<int64_t>(sub_array->data(), 0), 1);
+
+    EXPECT_FALSE(BsonView::GetNthElementInArray<int64_t>(data, 0));
+    EXPECT_FALSE(BsonView::FindNthElementInArray(data, 12).has_value());
+
+    bson_destroy(&arr);
+}
+
 }  // namespace milvus::index
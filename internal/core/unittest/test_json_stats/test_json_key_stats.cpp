@@ -334,6 +334,48 @@ TEST_P(JsonKeyStatsTest, TestExecutorForShreddingData) {
     }
 }
 
+TEST_P(JsonKeyStatsTest, TestShreddingDataSkipIndex) {
+    auto field_name = index_->GetShreddingField("/int", JSONType::INT64);
+    ASSERT_FALSE(field_name.empty());
+
+    // counts the rows greater than `lower`, and the chunks actually read
+    auto run = [&](int64_t lower, int& chunks_read) {
+        TargetBitmap res(size_);
+        TargetBitmap valid_res(size_, true);
+        TargetBitmapView res_view(res);
+        TargetBitmapView valid_res_view(valid_res);
+        auto func = [&chunks_read, lower](const int64_t* data,
+                                          const bool* valid_data,
+                                          const int size,
+                                          TargetBitmapView res,
+                                          TargetBitmapView valid_res) {
+            ++chunks_read;
+            for (int i = 0; i < size; i++) {
+                res[i] = valid_data[i] && data[i] > lower;
+            }
+        };
+        auto skip_func = [lower](const SkipIndex& skip_index,
+                                 FieldId field_id,
+                                 int chunk_id) {
+            return skip_index.CanSkipUnaryRange<int64_t>(
+                field_id, chunk_id, OpType::GreaterThan, lower);
+        };
+        auto processed_size = index_->ExecutorForShreddingData<int64_t>(
+            nullptr, field_name, func, skip_func, res_view, valid_res_view);
+        EXPECT_EQ(processed_size, size_);
+        return res.count();
+    };
+
+    int chunks_read = 0;
+    EXPECT_EQ(run(0, chunks_read), nullable_ ? 400 : 800);
+    EXPECT_GT(chunks_read, 0);
+
+    // every generated value is below 2^32, so every chunk is skipped
+    chunks_read = 0;
+    EXPECT_EQ(run(int64_t(1) << 32, chunks_read), 0);
+    EXPECT_EQ(chunks_read, 0);
+}
+
 TEST_P(JsonKeyStatsTest, TestGetShreddingFields) {
     std::string pointer = "/int";
     auto fields = index_->GetShreddingFields(pointer);
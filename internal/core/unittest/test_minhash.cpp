@@ -16,6 +16,7 @@
 #include <string>
 #include <vector>
 
+#include "arrow/builder.h"
 #include "gtest/gtest.h"
 #include "minhash/MinHashComputer.h"
 #include "minhash/MinHashHook.h"
@@ -499,6 +500,61 @@ TEST_F(MinHashTest, BatchProcessingTest) {
     }
 }
 
+// Test the arrow batch API against per-text computation
+TEST_F(MinHashTest, ComputeBinaryVectorsFromArrowTest) {
+    // enough rows for several blocks hashed in parallel
+    const int64_t num_texts = 5000;
+    int32_t shingle_size = 3;
+    std::vector<std::string> text_strings;
+    arrow::StringBuilder builder;
+    for (int64_t i = 0; i < num_texts; i++) {
+        if (i % 97 == 0) {
+            text_strings.emplace_back();
+            ASSERT_TRUE(builder.AppendNull().ok());
+            continue;
+        }
+        text_strings.push_back("document " + std::to_string(i * 7919) +
+                               std::string(i % 13, 'x'));
+        ASSERT_TRUE(builder.Append(text_strings.back()).ok());
+    }
+    std::shared_ptr<arrow::Array> array;
+    ASSERT_TRUE(builder.Finish(&array).ok());
+
+    std::vector<const char*> texts;
+    std::vector<int32_t> text_lengths;
+    for (const auto& s : text_strings) {
+        texts.push_back(s.c_str());
+        text_lengths.push_back(s.size());
+    }
+    std::vector<uint32_t> expected(num_texts * num_hashes_);
+    ComputeFromTextsDirectly(texts.data(),
+                             text_lengths.data(),
+                             num_texts,
+                             nullptr,
+                             shingle_size,
+                             perm_a_.data(),
+                             perm_b_.data(),
+                             HashFunction::XXHASH64,
+                             num_hashes_,
+                             expected.data());
+
+    std::vector<uint8_t> binary_vectors(num_texts * num_hashes_ * 4);
+    ComputeBinaryVectorsFromArrow(*array,
+                                  nullptr,
+                                  shingle_size,
+                                  perm_a_.data(),
+                                  perm_b_.data(),
+                                  HashFunction::XXHASH64,
+                                  num_hashes_,
+                                  binary_vectors.data());
+    for (int64_t i = 0; i < num_texts * num_hashes_; i++) {
+        const uint8_t* bytes = binary_vectors.data() + i * 4;
+        uint32_t sig = bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) |
+                       (static_cast<uint32_t>(bytes[3]) << 24);
+        ASSERT_EQ(sig, expected[i]) << "hash " << i;
+    }
+}
+
 // Test comparing native implementation with current SIMD implementation
 TEST_F(MinHashTest, NativeVsCurrentSIMDTest) {
     const char* texts[] = {"hello world test document",
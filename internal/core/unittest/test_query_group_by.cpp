@@ -10,8 +10,12 @@
 // or implied. See the License for the specific language governing permissions and limitations under the License
 
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <filesystem>
 #include <map>
 #include <set>
+#include <string>
+#include <tuple>
 #include <vector>
 #include "test_utils/DataGen.h"
 #include "segcore/SegmentSealed.h"
@@ -1532,3 +1536,149 @@ TEST(HashTableRehashTest, TestHashTableRehashMultipleRounds) {
             << "Group " << i << " not found after multiple rehashes";
     }
 }
+
+TEST_P(QueryAggTest, GroupBySpillMatchesInMemory) {
+    auto int8_id = field_map_[int8_field];
+    auto str_id = field_map_[string_field];
+    auto make_plan = [&]() {
+        std::vector<milvus::plan::PlanNodePtr> sources;
+        PlanNodePtr mvcc_node = std::make_shared<milvus::plan::MvccNode>(
+            milvus::plan::GetNextPlanNodeId(), sources);
+        sources = std::vector<milvus::plan::PlanNodePtr>{mvcc_node};
+        PlanNodePtr project_node = std::make_shared<milvus::plan::ProjectNode>(
+            milvus::plan::GetNextPlanNodeId(),
+            std::vector<FieldId>{int8_id, str_id},
+            std::vector<std::string>{int8_field, string_field},
+            std::vector<DataType>{DataType::INT8, DataType::VARCHAR},
+            sources);
+        sources = std::vector<milvus::plan::PlanNodePtr>{project_node};
+        std::vector<expr::FieldAccessTypeExprPtr> groupingKeys;
+        groupingKeys.emplace_back(
+            std::make_shared<const expr::FieldAccessTypeExpr>(
+                DataType::INT8, int8_field, int8_id));
+        std::string agg_name = "count";
+        std::vector<plan::AggregationNode::Aggregate> aggregates;
+        auto call = std::make_shared<const expr::CallExpr>(
+            agg_name, std::vector<expr::TypedExprPtr>{}, nullptr);
+        aggregates.emplace_back(plan::AggregationNode::Aggregate{call});
+        aggregates.back().resultType_ =
+            GetAggResultType(agg_name, DataType::NONE);
+        PlanNodePtr agg_node = std::make_shared<plan::AggregationNode>(
+            milvus::plan::GetNextPlanNodeId(),
+            std::move(groupingKeys),
+            std::vector<std::string>{agg_name},
+            std::move(aggregates),
+            sources);
+        return createRetrievePlan(schema_, agg_node, num_rows_);
+    };
+    // "<key or null>:<count>" per group, sorted
+    auto run = [&]() {
+        auto plan = make_plan();
+        auto results = segment_->Retrieve(
+            nullptr, plan.get(), MAX_TIMESTAMP, DEFAULT_MAX_OUTPUT_SIZE, false);
+        EXPECT_EQ(results->fields_data_size(), 2);
+        const auto& keys = results->fields_data(0);
+        const auto& counts = results->fields_data(1).scalars().long_data();
+        std::vector<std::string> groups;
+        for (int i = 0; i < counts.data_size(); i++) {
+            bool valid = keys.valid_data_size() == 0 || keys.valid_data(i);
+            groups.push_back(
+                (valid ? std::to_string(keys.scalars().int_data().data(i))
+                       : std::string("null")) +
+                ":" + std::to_string(counts.data(i)));
+        }
+        std::sort(groups.begin(), groups.end());
+        return groups;
+    };
+
+    auto expected = run();
+    ASSERT_FALSE(expected.empty());
+
+    // two rows per input batch and a one byte budget: every batch after the
+    // first spills the rows of the groups it didn't see yet
+    auto batch_size = EXEC_EVAL_EXPR_BATCH_SIZE.load();
+    auto spill_dir = std::filesystem::temp_directory_path() / "agg_spill";
+    EXEC_EVAL_EXPR_BATCH_SIZE.store(2);
+    SetDefaultExecSpillConfig(1, spill_dir.string());
+    auto spilled = run();
+    SetDefaultExecSpillConfig(0, "");
+    EXEC_EVAL_EXPR_BATCH_SIZE.store(batch_size);
+
+    EXPECT_EQ(spilled, expected);
+    EXPECT_TRUE(std::filesystem::is_empty(spill_dir));
+}
+
+TEST_P(QueryAggTest, GlobalMinMaxChunkPushdownMatchesScan) {
+    auto int32_id = field_map_[int32_field];
+    auto int64_id = field_map_[int64_field];
+    auto str_id = field_map_[string_field];
+    // the sealed chunk has metrics, so fully visible runs take the pushdown
+    ASSERT_TRUE(segment_->GetSkipIndex()
+                    .GetChunkMinMax(nullptr, str_id, 0)
+                    .has_value());
+
+    auto make_plan = [&](bool pushdown) {
+        std::vector<milvus::plan::PlanNodePtr> sources;
+        PlanNodePtr mvcc_node = std::make_shared<milvus::plan::MvccNode>(
+            milvus::plan::GetNextPlanNodeId(), sources);
+        sources = std::vector<milvus::plan::PlanNodePtr>{mvcc_node};
+        PlanNodePtr project_node = std::make_shared<milvus::plan::ProjectNode>(
+            milvus::plan::GetNextPlanNodeId(),
+            std::vector<FieldId>{int32_id, int64_id, str_id},
+            std::vector<std::string>{int32_field, int64_field, string_field},
+            std::vector<DataType>{
+                DataType::INT32, DataType::INT64, DataType::VARCHAR},
+            sources,
+            pushdown);
+        sources = std::vector<milvus::plan::PlanNodePtr>{project_node};
+
+        // count(*), min(int64), max(int64), min(string), max(int32)
+        std::vector<std::tuple<std::string, std::string, FieldId, DataType>>
+            calls = {{"count", "", FieldId(0), DataType::NONE},
+                     {"min", int64_field, int64_id, DataType::INT64},
+                     {"max", int64_field, int64_id, DataType::INT64},
+                     {"min", string_field, str_id, DataType::VARCHAR},
+                     {"max", int32_field, int32_id, DataType::INT32}};
+        std::vector<plan::AggregationNode::Aggregate> aggregates;
+        std::vector<std::string> agg_names;
+        for (const auto& [name, field_name, field_id, type] : calls) {
+            std::vector<expr::TypedExprPtr> inputs;
+            if (type != DataType::NONE) {
+                inputs.emplace_back(std::make_shared<expr::FieldAccessTypeExpr>(
+                    type, field_name, field_id));
+            }
+            auto call =
+                std::make_shared<const expr::CallExpr>(name, inputs, nullptr);
+            aggregates.emplace_back(plan::AggregationNode::Aggregate{call});
+            if (type != DataType::NONE) {
+                aggregates.back().rawInputTypes_.emplace_back(type);
+            }
+            aggregates.back().resultType_ = GetAggResultType(name, type);
+            agg_names.push_back(name);
+        }
+        PlanNodePtr agg_node = std::make_shared<plan::AggregationNode>(
+            milvus::plan::GetNextPlanNodeId(),
+            std::vector<expr::FieldAccessTypeExprPtr>{},
+            std::move(agg_names),
+            std::move(aggregates),
+            sources);
+        return createRetrievePlan(schema_, agg_node, num_rows_);
+    };
+    auto run = [&](bool pushdown, Timestamp timestamp) {
+        auto plan = make_plan(pushdown);
+        auto results = segment_->Retrieve(
+            nullptr, plan.get(), timestamp, DEFAULT_MAX_OUTPUT_SIZE, false);
+        EXPECT_EQ(results->fields_data_size(), 5);
+        std::vector<std::string> columns;
+        for (const auto& field_data : results->fields_data()) {
+            columns.push_back(field_data.SerializeAsString());
+        }
+        return columns;
+    };
+
+    // all rows visible: the chunk is answered from its metrics
+    EXPECT_EQ(run(true, MAX_TIMESTAMP), run(false, MAX_TIMESTAMP));
+    // rows past the timestamp are hidden: the chunk is partially covered and
+    // scanned
+    EXPECT_EQ(run(true, num_rows_ / 2), run(false, num_rows_ / 2));
+}
@@ -27,6 +27,7 @@
 #include "query/PlanImpl.h"
 #include "query/PlanNode.h"
 #include "query/PlanProto.h"
+#include "segcore/plan_c.h"
 
 using namespace milvus;
 using namespace milvus::segcore;
@@ -582,6 +583,77 @@ TEST_P(QueryOrderByTest, OrderByWithDeferredFields) {
     EXPECT_GT(count, 0);
 }
 
+TEST_P(QueryOrderByTest, TwoPhaseRetrieveFetchesOutputFieldsByOffsets) {
+    // pipeline [pk, int64 (sort), int32 (output only)], double deferred
+    std::vector<FieldId> pipeline_ids;
+    auto top_node = buildOrderByPlan(int64_field,
+                                     {string_field, int64_field, int32_field},
+                                     true,
+                                     false,
+                                     10,
+                                     pipeline_ids);
+    auto double_fid = field_map_[double_field];
+    auto plan = createOrderByPlan(top_node, 10, pipeline_ids, {double_fid});
+    plan->plan_node_->order_by_column_count_ = 2;
+
+    auto single = segment_->Retrieve(
+        nullptr, plan.get(), MAX_TIMESTAMP, DEFAULT_MAX_OUTPUT_SIZE, false);
+    ASSERT_EQ(single->fields_data_size(), 4);
+
+    // phase one: only the pk and the sort key, with offsets and ids
+    auto first = segment_->Retrieve(
+        nullptr, plan.get(), MAX_TIMESTAMP, DEFAULT_MAX_OUTPUT_SIZE, true);
+    ASSERT_EQ(first->fields_data_size(), 2);
+    EXPECT_EQ(first->fields_data(0).SerializeAsString(),
+              single->fields_data(0).SerializeAsString());
+    EXPECT_EQ(first->fields_data(1).SerializeAsString(),
+              single->fields_data(1).SerializeAsString());
+    EXPECT_EQ(first->ids().SerializeAsString(),
+              single->ids().SerializeAsString());
+    ASSERT_EQ(first->offset_size(), 10);
+
+    // phase two: the output only columns for the surviving offsets
+    std::vector<int64_t> offsets(first->offset().begin(),
+                                 first->offset().end());
+    auto second = segment_->Retrieve(
+        nullptr, plan.get(), offsets.data(), offsets.size());
+    ASSERT_EQ(second->fields_data_size(), 2);
+    EXPECT_EQ(second->fields_data(0).field_id(),
+              field_map_[int32_field].get());
+    EXPECT_EQ(second->fields_data(1).field_id(), double_fid.get());
+    EXPECT_EQ(second->fields_data(0).scalars().SerializeAsString(),
+              single->fields_data(2).scalars().SerializeAsString());
+    EXPECT_EQ(second->fields_data(1).scalars().SerializeAsString(),
+              single->fields_data(3).scalars().SerializeAsString());
+}
+
+TEST_P(QueryOrderByTest, ShouldIgnoreNonPkWithOutputColumns) {
+    // [pk, int64 (sort)] only: nothing is left for a second phase
+    std::vector<FieldId> sort_only_ids;
+    auto sort_only_node = buildOrderByPlan(int64_field,
+                                           {string_field, int64_field},
+                                           true,
+                                           false,
+                                           10,
+                                           sort_only_ids);
+    auto sort_only = createOrderByPlan(sort_only_node, 10, sort_only_ids);
+    sort_only->plan_node_->order_by_column_count_ = 2;
+    EXPECT_FALSE(ShouldIgnoreNonPk(sort_only.get()));
+
+    // [pk, int64 (sort), int32 (output only)], double deferred
+    std::vector<FieldId> pipeline_ids;
+    auto top_node = buildOrderByPlan(int64_field,
+                                     {string_field, int64_field, int32_field},
+                                     true,
+                                     false,
+                                     10,
+                                     pipeline_ids);
+    auto plan = createOrderByPlan(
+        top_node, 10, pipeline_ids, {field_map_[double_field]});
+    plan->plan_node_->order_by_column_count_ = 2;
+    EXPECT_TRUE(ShouldIgnoreNonPk(plan.get()));
+}
+
 TEST_P(QueryOrderByTest, OrderByInt16Asc) {
     auto nullable = GetParam();
     std::vector<FieldId> pipeline_ids;
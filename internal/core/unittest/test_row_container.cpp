@@ -134,3 +134,40 @@ TEST_F(RowContainerTest, ExtractColumnVectorCopiesStringValues) {
     EXPECT_EQ(output->ValueAt<std::string>(1), "beta");
     EXPECT_EQ(output->ValueAt<std::string>(2), "gamma");
 }
+
+TEST_F(RowContainerTest, SerializeRowRoundTrip) {
+    RowContainer rows({DataType::INT64, DataType::VARCHAR}, {});
+    auto ints = CreateInt64Column({7, 8, 9});
+    auto strs = CreateStringColumn({"", "beta", "gamma"});
+    ints->nullAt(1);
+    strs->nullAt(2);
+    for (size_t i = 0; i < ints->size(); ++i) {
+        auto row = rows.newRow();
+        rows.store(ints, i, row, 0);
+        rows.store(strs, i, row, 1);
+    }
+    EXPECT_GT(rows.estimatedBytes(), 0);
+
+    std::string buffer;
+    for (auto row : rows.allRows()) {
+        rows.serializeRow(row, buffer);
+    }
+    RowContainer copy({DataType::INT64, DataType::VARCHAR}, {});
+    const char* in = buffer.data();
+    for (size_t i = 0; i < rows.allRows().size(); ++i) {
+        copy.deserializeRow(in);
+    }
+    ASSERT_EQ(in, buffer.data() + buffer.size());
+    EXPECT_EQ(copy.estimatedBytes(), rows.estimatedBytes());
+
+    auto out_ints = ExtractColumn(copy, 0);
+    auto out_strs = ExtractColumn(copy, 1);
+    ASSERT_EQ(out_ints->size(), 3);
+    EXPECT_EQ(out_ints->ValueAt<int64_t>(0), 7);
+    EXPECT_FALSE(out_ints->ValidAt(1));
+    EXPECT_EQ(out_ints->ValueAt<int64_t>(2), 9);
+    EXPECT_EQ(out_strs->ValueAt<std::string>(0), "");
+    EXPECT_EQ(out_strs->ValueAt<std::string>(1), "beta");
+    EXPECT_FALSE(out_strs->ValidAt(2));
+    EXPECT_FALSE(RowContainer::canSpill({DataType::JSON}));
+}
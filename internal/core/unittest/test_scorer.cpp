@@ -25,6 +25,7 @@
 #include "pb/plan.pb.h"
 #include "rescores/BoostScoreRunner.h"
 #include "rescores/Scorer.h"
+#include "rescores/Utils.h"
 
 using namespace milvus;
 using namespace milvus::rescores;
@@ -47,41 +48,19 @@ class StaticScorer : public Scorer {
                 const segcore::SegmentInternalInterface* segment,
                 const proto::plan::FunctionMode& mode,
                 const FixedVector<int32_t>& offsets,
-                const TargetBitmapView& bitmap,
-                std::vector<std::optional<float>>& boost_scores) override {
+                const TargetBitmapView* matches,
+                BoostScores& scores) override {
         for (auto i = 0; i < offsets.size(); ++i) {
-            if (bitmap[i] && scores_[i].has_value()) {
-                boost_scores[i] = scores_[i];
-            }
-        }
-    }
-
-    void
-    batch_score(milvus::OpContext* op_ctx,
-                const segcore::SegmentInternalInterface* segment,
-                const proto::plan::FunctionMode& mode,
-                const FixedVector<int32_t>& offsets,
-                const TargetBitmap& bitmap,
-                std::vector<std::optional<float>>& boost_scores) override {
-        for (auto i = 0; i < offsets.size(); ++i) {
-            auto offset = offsets[i];
-            if (offset >= 0 && static_cast<size_t>(offset) < bitmap.size() &&
-                bitmap[offset] && scores_[i].has_value()) {
-                boost_scores[i] = scores_[i];
-            }
-        }
-    }
-
-    void
-    batch_score(milvus::OpContext* op_ctx,
-                const segcore::SegmentInternalInterface* segment,
-                const proto::plan::FunctionMode& mode,
-                const FixedVector<int32_t>& offsets,
-                std::vector<std::optional<float>>& boost_scores) override {
-        for (auto i = 0; i < offsets.size(); ++i) {
-            if (scores_[i].has_value()) {
-                boost_scores[i] = scores_[i];
+            if ((matches != nullptr && !(*matches)[i]) ||
+                !scores_[i].has_value()) {
+                continue;
             }
+            scores.scores[i] =
+                scores.has_score[i]
+                    ? function_score_merge(
+                          scores.scores[i], scores_[i].value(), mode)
+                    : scores_[i].value();
+            scores.has_score[i] = true;
         }
     }
 
@@ -107,7 +86,7 @@ class WeightScorerTest : public ::testing::Test {
     std::unique_ptr<WeightScorer> scorer_;
 };
 
-// Test: TargetBitmap batch_score with valid offsets (all within bitmap bounds)
+// Test: matches of a filter over the whole segment, offsets within bounds
 TEST_F(WeightScorerTest, BatchScoreTargetBitmapValidOffsets) {
     TargetBitmap bitmap(100);
     bitmap.set(10);
@@ -116,21 +95,26 @@ TEST_F(WeightScorerTest, BatchScoreTargetBitmapValidOffsets) {
 
     // Offsets that are all within bitmap bounds
     FixedVector<int32_t> offsets = {10, 20, 50, 90};
-    std::vector<std::optional<float>> boost_scores(offsets.size(),
-                                                   std::nullopt);
+    std::vector<float> values(offsets.size(), 0.0F);
+    auto has_score = std::make_unique<bool[]>(offsets.size());
+    BoostScores scores{values.data(), has_score.get(), offsets.size()};
 
     proto::plan::FunctionMode mode = proto::plan::FunctionMode::FunctionModeSum;
 
-    scorer_->batch_score(nullptr, nullptr, mode, offsets, bitmap, boost_scores);
+    auto matches = GatherMatches(bitmap.view(), offsets);
+    auto matches_view = matches.view();
+    scorer_->batch_score(
+        nullptr, nullptr, mode, offsets, &matches_view, scores);
 
     // Positions 10, 50, 90 should have scores (they are set in bitmap)
-    EXPECT_TRUE(boost_scores[0].has_value());
-    EXPECT_FALSE(boost_scores[1].has_value());
-    EXPECT_TRUE(boost_scores[2].has_value());
-    EXPECT_TRUE(boost_scores[3].has_value());
+    EXPECT_TRUE(has_score[0]);
+    EXPECT_FALSE(has_score[1]);
+    EXPECT_TRUE(has_score[2]);
+    EXPECT_TRUE(has_score[3]);
+    EXPECT_FLOAT_EQ(values[0], 2.0F);
 }
 
-// Test: TargetBitmap batch_score with out-of-bounds offsets (should NOT crash)
+// Test: matches of offsets out of the bitmap (should NOT crash)
 TEST_F(WeightScorerTest, BatchScoreTargetBitmapOutOfBoundsOffsets) {
     // Create a small bitmap of size 50
     TargetBitmap bitmap(50);
@@ -140,23 +124,51 @@ TEST_F(WeightScorerTest, BatchScoreTargetBitmapOutOfBoundsOffsets) {
     // Offsets where some are OUT OF BOUNDS (>= 50)
     // This simulates the race condition where text index lags behind vector index
     FixedVector<int32_t> offsets = {10, 40, 60, 100, 200};
-    std::vector<std::optional<float>> boost_scores(offsets.size(),
-                                                   std::nullopt);
+    std::vector<float> values(offsets.size(), 0.0F);
+    auto has_score = std::make_unique<bool[]>(offsets.size());
+    BoostScores scores{values.data(), has_score.get(), offsets.size()};
 
     proto::plan::FunctionMode mode = proto::plan::FunctionMode::FunctionModeSum;
 
     // Should NOT crash! Out-of-bounds offsets should be safely skipped
-    ASSERT_NO_THROW(scorer_->batch_score(
-        nullptr, nullptr, mode, offsets, bitmap, boost_scores));
+    TargetBitmap matches;
+    ASSERT_NO_THROW(matches = GatherMatches(bitmap.view(), offsets));
+    auto matches_view = matches.view();
+    scorer_->batch_score(
+        nullptr, nullptr, mode, offsets, &matches_view, scores);
 
     // In-bounds offsets should be scored correctly
-    EXPECT_TRUE(boost_scores[0].has_value());
-    EXPECT_TRUE(boost_scores[1].has_value());
+    EXPECT_TRUE(has_score[0]);
+    EXPECT_TRUE(has_score[1]);
 
     // Out-of-bounds offsets should NOT have scores (safely skipped)
-    EXPECT_FALSE(boost_scores[2].has_value());
-    EXPECT_FALSE(boost_scores[3].has_value());
-    EXPECT_FALSE(boost_scores[4].has_value());
+    EXPECT_FALSE(has_score[2]);
+    EXPECT_FALSE(has_score[3]);
+    EXPECT_FALSE(has_score[4]);
+}
+
+// Test: merging into existing scores under both function modes
+TEST_F(WeightScorerTest, BatchScoreMergesExistingScores) {
+    FixedVector<int32_t> offsets = {0, 1, 2};
+    TargetBitmap matches(offsets.size());
+    matches.set(0);
+    matches.set(2);
+    auto matches_view = matches.view();
+
+    for (auto mode : {proto::plan::FunctionModeSum,
+                      proto::plan::FunctionModeMultiply}) {
+        std::vector<float> values = {3.0F, 4.0F, 0.0F};
+        bool has_score[] = {true, true, false};
+        BoostScores scores{values.data(), has_score, offsets.size()};
+        scorer_->batch_score(
+            nullptr, nullptr, mode, offsets, &matches_view, scores);
+
+        EXPECT_FLOAT_EQ(values[0],
+                        mode == proto::plan::FunctionModeSum ? 5.0F : 6.0F);
+        EXPECT_FLOAT_EQ(values[1], 4.0F);
+        EXPECT_FLOAT_EQ(values[2], 2.0F);
+        EXPECT_TRUE(has_score[2]);
+    }
 }
 
 TEST(BoostScoreRunnerTest, ComputeScorerScoresNoFilterCopiesToBuffers) {
@@ -206,22 +218,23 @@ TEST(BoostScoreRunnerTest, ComputeFunctionScoresMergesAndSkipsNulls) {
     EXPECT_TRUE(has_scores[2]);
     EXPECT_FLOAT_EQ(scores[2], 4.0F);
 
-    std::vector<std::optional<float>> optional_scores(offsets.size(),
-                                                      std::nullopt);
+    std::vector<float> values(offsets.size(), 0.0F);
+    auto has_score = std::make_unique<bool[]>(offsets.size());
+    BoostScores multiplied{values.data(), has_score.get(), offsets.size()};
     ComputeFunctionScores(nullptr,
                           nullptr,
                           nullptr,
                           scorers,
                           proto::plan::FunctionModeMultiply,
                           offsets,
-                          optional_scores);
-
-    ASSERT_TRUE(optional_scores[0].has_value());
-    EXPECT_FLOAT_EQ(optional_scores[0].value(), 6.0F);
-    ASSERT_TRUE(optional_scores[1].has_value());
-    EXPECT_FLOAT_EQ(optional_scores[1].value(), 5.0F);
-    ASSERT_TRUE(optional_scores[2].has_value());
-    EXPECT_FLOAT_EQ(optional_scores[2].value(), 4.0F);
+                          multiplied);
+
+    ASSERT_TRUE(has_score[0]);
+    EXPECT_FLOAT_EQ(values[0], 6.0F);
+    ASSERT_TRUE(has_score[1]);
+    EXPECT_FLOAT_EQ(values[1], 5.0F);
+    ASSERT_TRUE(has_score[2]);
+    EXPECT_FLOAT_EQ(values[2], 4.0F);
 }
 
 TEST(BoostScoreRunnerTest, ComputeFunctionScoresRejectsMismatchedOutputSize) {
@@ -229,7 +242,9 @@ TEST(BoostScoreRunnerTest, ComputeFunctionScoresRejectsMismatchedOutputSize) {
         std::make_shared<WeightScorer>(nullptr, 2.0F),
     };
     FixedVector<int32_t> offsets = {0, 1};
-    std::vector<std::optional<float>> scores(1, std::nullopt);
+    std::vector<float> values(1, 0.0F);
+    bool has_score[1] = {false};
+    BoostScores scores{values.data(), has_score, values.size()};
 
     EXPECT_THROW(ComputeFunctionScores(nullptr,
                                        nullptr,
@@ -3763,3 +3763,40 @@ TEST(SealedSegmentReopen, TextIndexCreatedWipedByReopen) {
     EXPECT_TRUE(
         sealed->TestGetSegmentLoadInfo()->HasTextIndexCreated(text_fid));
 }
+
+TEST(Sealed, PrefetchOutputFields) {
+    auto schema = std::make_shared<Schema>();
+    auto vec_id = schema->AddDebugField(
+        "fakevec", DataType::VECTOR_FLOAT, 4, knowhere::metric::L2);
+    auto pk_id = schema->AddDebugField("pk", DataType::INT64);
+    auto double_id = schema->AddDebugField("double", DataType::DOUBLE);
+    auto str_id = schema->AddDebugField("str", DataType::VARCHAR);
+    schema->set_primary_field_id(pk_id);
+
+    auto N = 1000;
+    auto dataset = DataGen(schema, N);
+    auto segment = CreateSealedWithFieldDataLoaded(schema, dataset);
+    segment->DropFieldData(str_id);
+    auto* sealed = dynamic_cast<ChunkedSegmentSealedImpl*>(segment.get());
+    ASSERT_NE(sealed, nullptr);
+
+    // out of range offsets and fields without a column are skipped
+    std::vector<int64_t> offsets = {N - 1, 7, -1, 512, N, 7, 0};
+    milvus::OpContext op_ctx;
+    sealed
+        ->PrefetchOutputFields(&op_ctx,
+                               {pk_id, double_id, str_id, vec_id},
+                               offsets.data(),
+                               offsets.size())
+        .get();
+
+    std::vector<int64_t> valid_offsets = {N - 1, 7, 512, 7, 0};
+    auto pk_data = dataset.get_col<int64_t>(pk_id);
+    auto col = sealed->bulk_subscript(
+        &op_ctx, pk_id, valid_offsets.data(), valid_offsets.size());
+    auto& long_data = col->scalars().long_data();
+    ASSERT_EQ(long_data.data_size(), valid_offsets.size());
+    for (size_t i = 0; i < valid_offsets.size(); i++) {
+        EXPECT_EQ(long_data.data(i), pk_data[valid_offsets[i]]);
+    }
+}
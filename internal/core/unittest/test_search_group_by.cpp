@@ -610,6 +610,145 @@ TEST(GroupBY, ElementLevelKeepsElementIndices) {
     ASSERT_EQ(distances, (std::vector<float>{0.1F, 0.2F, 0.4F, 0.5F, 0.6F}));
 }
 
+TEST(GroupBY, LateCloserRowDisplacesFartherRowOfFullGroup) {
+    auto schema = std::make_shared<Schema>();
+    auto pk_fid = schema->AddDebugField("id", DataType::INT64);
+    auto int32_fid = schema->AddDebugField("int32", DataType::INT32);
+    schema->AddDebugField(
+        "embeddings", DataType::VECTOR_FLOAT, 4, knowhere::metric::L2);
+    schema->set_primary_field_id(pk_fid);
+
+    size_t N = 16;
+    auto raw_data = DataGen(schema, N, 42, 0, 4);
+    auto segment = CreateGrowingSegment(schema, empty_index_meta);
+    segment->PreInsert(N);
+    segment->Insert(0,
+                    N,
+                    raw_data.row_ids_.data(),
+                    raw_data.timestamps_.data(),
+                    raw_data.raw_);
+    auto* growing = dynamic_cast<SegmentGrowingImpl*>(segment.get());
+    ASSERT_NE(growing, nullptr);
+
+    // three rows sharing one group-by value
+    auto values = raw_data.get_col<int32_t>(int32_fid);
+    std::vector<int64_t> rows;
+    for (size_t i = 0; i < N && rows.size() < 3; i++) {
+        if (values[i] == values[0]) {
+            rows.push_back(static_cast<int64_t>(i));
+        }
+    }
+    ASSERT_EQ(rows.size(), 3);
+
+    SearchInfo search_info;
+    search_info.topk_ = 10;
+    search_info.group_size_ = 2;
+    search_info.metric_type_ = knowhere::metric::L2;
+    search_info.group_by_field_ids_.push_back(int32_fid);
+
+    // the iterator is only approximately ordered, the third row of the group
+    // comes last but is the closest one
+    std::vector<std::shared_ptr<VectorIterator>> iterators{
+        std::make_shared<FixedVectorIterator>(
+            std::vector<std::pair<int64_t, float>>{
+                {rows[0], 0.5F},
+                {rows[1], 0.6F},
+                {rows[2], 0.1F},
+            })};
+
+    OpContext op_context;
+    std::vector<CompositeGroupKey> group_by_values;
+    std::vector<int64_t> seg_offsets;
+    std::vector<float> distances;
+    std::vector<size_t> topk_per_nq_prefix_sum;
+    SearchGroupBy(&op_context,
+                  iterators,
+                  search_info,
+                  group_by_values,
+                  *growing,
+                  seg_offsets,
+                  distances,
+                  topk_per_nq_prefix_sum);
+
+    ASSERT_EQ(seg_offsets, (std::vector<int64_t>{rows[2], rows[0]}));
+    ASSERT_EQ(distances, (std::vector<float>{0.1F, 0.5F}));
+    ASSERT_EQ(topk_per_nq_prefix_sum, (std::vector<size_t>{0, 2}));
+    ASSERT_EQ(group_by_values.size(), 2);
+    ASSERT_EQ(group_by_values[0], group_by_values[1]);
+}
+
+TEST(GroupBY, CompositeGroupByMapStopsFetchingOnceFull) {
+    CompositeGroupByMap strict_map(2, 3, true, knowhere::metric::IP);
+    EXPECT_EQ(strict_map.MinPushesToEnough(), 6);
+    CompositeGroupKey key_a;
+    key_a.Add(int64_t(1));
+    CompositeGroupKey key_b;
+    key_b.Add(int64_t(2));
+    EXPECT_EQ(strict_map.Push(key_a, 0.5F, 0), 0);
+    EXPECT_EQ(strict_map.Push(key_a, 0.4F, 1), 1);
+    EXPECT_EQ(strict_map.Push(key_a, 0.3F, 2), 2);
+    EXPECT_EQ(strict_map.MinPushesToEnough(), 3);
+    // IP: larger is closer, 0.9 displaces the 0.3 row of the full group
+    EXPECT_EQ(strict_map.Push(key_a, 0.9F, 3), 2);
+    EXPECT_EQ(strict_map.Push(key_a, 0.1F, 3), -1);
+    EXPECT_EQ(strict_map.MinPushesToEnough(), 3);
+    EXPECT_FALSE(strict_map.IsGroupResEnough());
+
+    CompositeGroupByMap map(2, 3, false, knowhere::metric::L2);
+    EXPECT_EQ(map.MinPushesToEnough(), 2);
+    EXPECT_EQ(map.Push(key_a, 0.5F, 0), 0);
+    EXPECT_EQ(map.MinPushesToEnough(), 1);
+    EXPECT_EQ(map.Push(key_b, 0.6F, 1), 1);
+    EXPECT_TRUE(map.IsGroupResEnough());
+}
+
+TEST(GroupBY, MultiFieldNormalizedKeysMatchCompositeKeys) {
+    auto schema = std::make_shared<Schema>();
+    auto pk_fid = schema->AddDebugField("id", DataType::INT64);
+    auto int8_fid = schema->AddDebugField("int8", DataType::INT8, true);
+    auto bool_fid = schema->AddDebugField("bool", DataType::BOOL);
+    auto int32_fid = schema->AddDebugField("int32", DataType::INT32);
+    schema->AddDebugField(
+        "embeddings", DataType::VECTOR_FLOAT, 4, knowhere::metric::L2);
+    schema->set_primary_field_id(pk_fid);
+
+    size_t N = 64;
+    auto raw_data = DataGen(schema, N, 42, 0, 4);
+    auto segment = CreateGrowingSegment(schema, empty_index_meta);
+    segment->PreInsert(N);
+    segment->Insert(0,
+                    N,
+                    raw_data.row_ids_.data(),
+                    raw_data.timestamps_.data(),
+                    raw_data.raw_);
+
+    OpContext op_context;
+    MultiFieldDataGetter getter(
+        &op_context, *segment, {int8_fid, bool_fid, int32_fid});
+    ASSERT_TRUE(getter.HasNormalizedKeys());
+    std::vector<int64_t> offsets(N);
+    for (size_t i = 0; i < N; i++) {
+        offsets[i] = static_cast<int64_t>(N - 1 - i);
+    }
+    std::vector<CompositeGroupKey> keys;
+    getter.GetBatch(offsets.data(), N, keys);
+    std::vector<uint64_t> normalized_keys;
+    getter.GetNormalizedBatch(offsets.data(), N, normalized_keys);
+    ASSERT_EQ(normalized_keys.size(), N);
+    for (size_t i = 0; i < N; i++) {
+        ASSERT_EQ(getter.DecodeNormalizedKey(normalized_keys[i]), keys[i]);
+        for (size_t j = 0; j < i; j++) {
+            ASSERT_EQ(normalized_keys[i] == normalized_keys[j],
+                      keys[i] == keys[j]);
+        }
+    }
+
+    // an int64 value has too many IDs to be packed
+    MultiFieldDataGetter wide_getter(
+        &op_context, *segment, {int8_fid, pk_fid});
+    EXPECT_FALSE(wide_getter.HasNormalizedKeys());
+}
+
 TEST(GroupBY, SearchGroupByNodeKeepsElementIndices) {
     int dim = 4;
     auto schema = std::make_shared<Schema>();
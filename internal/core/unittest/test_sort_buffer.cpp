@@ -12,6 +12,7 @@
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <filesystem>
 #include <memory>
 #include <random>
 #include <vector>
@@ -19,6 +20,7 @@
 #include "common/Types.h"
 #include "common/Vector.h"
 #include "exec/SortBuffer.h"
+#include "exec/Spill.h"
 
 using namespace milvus;
 using namespace milvus::exec;
@@ -1151,3 +1153,135 @@ TEST_F(SortBufferTest, NonSortColumnPreserved) {
     EXPECT_EQ(raw[1], "two");
     EXPECT_EQ(raw[2], "three");
 }
+
+TEST_F(SortBufferTest, SpillMatchesInMemorySort) {
+    // Runs spilled every few batches must merge into the in-memory order,
+    // with and without a limit too large for the top-N heap
+    auto dir = std::filesystem::temp_directory_path() / "sort_buffer_spill";
+    SpillConfig spill_config;
+    spill_config.memory_limit = 256 << 10;
+    spill_config.directory = dir.string();
+
+    std::vector<DataType> column_types = {DataType::INT64, DataType::VARCHAR};
+    std::vector<SortKeyInfo> sort_keys = {SortKeyInfo(0, false),
+                                          SortKeyInfo(1)};
+    std::default_random_engine er(42);
+    std::uniform_int_distribution<int64_t> dist(0, 500);
+    std::vector<std::vector<ColumnVectorPtr>> batches;
+    for (int batch = 0; batch < 300; ++batch) {
+        std::vector<int64_t> ints(257);
+        std::vector<std::string> strs(257);
+        for (size_t i = 0; i < ints.size(); ++i) {
+            ints[i] = dist(er);
+            strs[i] = "s" + std::to_string(dist(er));
+        }
+        auto int_col = CreateInt64Column(ints);
+        if (batch % 7 == 0) {
+            int_col->nullAt(batch % 257);
+        }
+        batches.push_back({int_col, CreateStringColumn(strs)});
+    }
+
+    for (int64_t limit : {int64_t(-1), SortBuffer::kMaxTopNLimit + 1}) {
+        SortBuffer in_memory(column_types, sort_keys, limit);
+        SortBuffer spilled(column_types, sort_keys, limit, spill_config);
+        for (const auto& columns : batches) {
+            in_memory.AddRows(columns, 257);
+            spilled.AddRows(columns, 257);
+        }
+        in_memory.NoMoreInput();
+        spilled.NoMoreInput();
+        ASSERT_FALSE(spilled.IsTopN());
+        ASSERT_GT(spilled.NumSpilledRuns(), 1);
+        EXPECT_EQ(in_memory.NumSpilledRuns(), 0);
+
+        while (in_memory.HasOutput()) {
+            ASSERT_TRUE(spilled.HasOutput());
+            auto expected = in_memory.GetOutput(300);
+            auto actual = spilled.GetOutput(300);
+            for (size_t col = 0; col < expected.size(); ++col) {
+                auto e = std::dynamic_pointer_cast<ColumnVector>(expected[col]);
+                auto a = std::dynamic_pointer_cast<ColumnVector>(actual[col]);
+                ASSERT_EQ(a->size(), e->size());
+                for (size_t i = 0; i < e->size(); ++i) {
+                    ASSERT_EQ(a->ValidAt(i), e->ValidAt(i));
+                    if (!e->ValidAt(i)) {
+                        continue;
+                    }
+                    if (col == 0) {
+                        ASSERT_EQ(a->ValueAt<int64_t>(i),
+                                  e->ValueAt<int64_t>(i));
+                    } else {
+                        ASSERT_EQ(a->ValueAt<std::string>(i),
+                                  e->ValueAt<std::string>(i));
+                    }
+                }
+            }
+        }
+        EXPECT_FALSE(spilled.HasOutput());
+        EXPECT_EQ(spilled.NumOutputRows(), in_memory.NumOutputRows());
+    }
+    // runs are removed once merged
+    EXPECT_TRUE(std::filesystem::is_empty(dir));
+}
+
+TEST_F(SortBufferTest, TopNMatchesFullSort) {
+    // Few distinct first keys so most candidates tie on them and are
+    // decided by the second key, strings exercise reusing the candidate row
+    std::vector<DataType> column_types = {DataType::INT64, DataType::VARCHAR};
+    std::vector<SortKeyInfo> sort_keys = {SortKeyInfo(0, false, true),
+                                          SortKeyInfo(1)};
+    std::default_random_engine er(42);
+    std::uniform_int_distribution<int64_t> dist(0, 50);
+    std::vector<std::vector<ColumnVectorPtr>> batches;
+    for (int batch = 0; batch < 20; ++batch) {
+        std::vector<int64_t> ints(500);
+        std::vector<std::string> strs(500);
+        for (size_t i = 0; i < ints.size(); ++i) {
+            ints[i] = dist(er);
+            strs[i] = "s" + std::to_string(dist(er) * 1000 + i);
+        }
+        auto int_col = CreateInt64Column(ints);
+        int_col->nullAt(batch * 7);
+        batches.push_back({int_col, CreateStringColumn(strs)});
+    }
+
+    SortBuffer full(column_types, sort_keys);
+    full.AddRows(batches[0], 500);
+    SortBuffer top_n(column_types, sort_keys, 37);
+    ASSERT_TRUE(top_n.IsTopN());
+    ASSERT_FALSE(full.IsTopN());
+    for (size_t b = 0; b < batches.size(); ++b) {
+        if (b > 0) {
+            full.AddRows(batches[b], 500);
+        }
+        if (b % 2 == 0) {
+            top_n.AddRows(batches[b], 500);
+        } else {
+            for (vector_size_t i = 0; i < 500; ++i) {
+                top_n.AddRow(batches[b], i);
+            }
+        }
+    }
+    full.NoMoreInput();
+    top_n.NoMoreInput();
+    EXPECT_EQ(top_n.NumInputRows(), full.NumInputRows());
+
+    auto expected = full.GetOutput(37);
+    auto actual = top_n.GetOutput(100);
+    EXPECT_FALSE(top_n.HasOutput());
+    auto e_int = std::dynamic_pointer_cast<ColumnVector>(expected[0]);
+    auto a_int = std::dynamic_pointer_cast<ColumnVector>(actual[0]);
+    auto e_str = std::dynamic_pointer_cast<ColumnVector>(expected[1]);
+    auto a_str = std::dynamic_pointer_cast<ColumnVector>(actual[1]);
+    ASSERT_EQ(a_int->size(), 37);
+    for (size_t i = 0; i < 37; ++i) {
+        ASSERT_EQ(a_int->ValidAt(i), e_int->ValidAt(i)) << "row " << i;
+        if (e_int->ValidAt(i)) {
+            ASSERT_EQ(a_int->ValueAt<int64_t>(i), e_int->ValueAt<int64_t>(i));
+        }
+        ASSERT_EQ(a_str->ValueAt<std::string>(i),
+                  e_str->ValueAt<std::string>(i))
+            << "row " << i;
+    }
+}
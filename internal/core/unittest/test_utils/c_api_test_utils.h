@@ -251,7 +251,9 @@ CSearch(CSegmentInterface c_segment,
                               0,
                               0,
                               filter_only,
-                              false);
+                              false,
+                              0,
+                              0);
     auto futurePtr = static_cast<milvus::futures::IFuture*>(
         static_cast<void*>(static_cast<CFuture*>(future)));
 
@@ -294,6 +296,8 @@ CRetrieve(CSegmentInterface c_segment,
                                 false,
                                 0,
                                 0,
+                                0,
+                                0,
                                 0);
     auto futurePtr = static_cast<milvus::futures::IFuture*>(
         static_cast<void*>(static_cast<CFuture*>(future)));
@@ -321,7 +325,8 @@ CRetrieveByOffsets(CSegmentInterface c_segment,
                    int64_t* offsets,
                    int64_t len,
                    CRetrieveResult** result) {
-    auto future = AsyncRetrieveByOffsets({}, c_segment, c_plan, offsets, len);
+    auto future =
+        AsyncRetrieveByOffsets({}, c_segment, c_plan, offsets, len, 0, 0);
     auto futurePtr = static_cast<milvus::futures::IFuture*>(
         static_cast<void*>(static_cast<CFuture*>(future)));
 
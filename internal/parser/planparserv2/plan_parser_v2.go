@@ -36,6 +36,9 @@ var (
 
 type ExprParams struct {
 	UseJSONStats bool
+	// ExplainAnalyze asks segcore to return the per-operator runtime stats
+	// of every segment with the results.
+	ExplainAnalyze bool
 }
 
 func ParseExprParams(vals map[string]*schemapb.TemplateValue) *ExprParams {
@@ -47,6 +50,9 @@ func ParseExprParams(vals map[string]*schemapb.TemplateValue) *ExprParams {
 		if v, ok := vals[common.ExprUseJSONStatsKey]; ok && v != nil {
 			ep.UseJSONStats = v.GetBoolVal()
 		}
+		if v, ok := vals[common.ExplainAnalyzeKey]; ok && v != nil {
+			ep.ExplainAnalyze = v.GetBoolVal()
+		}
 	}
 	return ep
 }
@@ -207,6 +213,7 @@ func CreateRetrievePlanArgs(schema *typeutil.SchemaHelper, exprStr string, exprT
 		},
 		PlanOptions: &planpb.PlanOption{
 			ExprUseJsonStats: exprParams.UseJSONStats,
+			ExplainAnalyze:   exprParams.ExplainAnalyze,
 		},
 	}
 	return planNode, nil
@@ -304,6 +311,7 @@ func CreateSearchPlanArgs(schema *typeutil.SchemaHelper, exprStr string, vectorF
 		ScoreOption: options,
 		PlanOptions: &planpb.PlanOption{
 			ExprUseJsonStats: exprParams.UseJSONStats,
+			ExplainAnalyze:   exprParams.ExplainAnalyze,
 		},
 	}
 	return planNode, nil
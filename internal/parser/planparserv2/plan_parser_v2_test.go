@@ -1312,6 +1312,19 @@ func TestCreateRetrievePlan(t *testing.T) {
 	assert.NoError(t, err)
 }
 
+func TestCreateRetrievePlan_ExplainAnalyze(t *testing.T) {
+	schema := newTestSchemaHelper(t)
+	plan, err := CreateRetrievePlan(schema, "Int64Field > 0", nil)
+	assert.NoError(t, err)
+	assert.False(t, plan.GetPlanOptions().GetExplainAnalyze())
+
+	plan, err = CreateRetrievePlan(schema, "Int64Field > 0", map[string]*schemapb.TemplateValue{
+		common.ExplainAnalyzeKey: {Val: &schemapb.TemplateValue_BoolVal{BoolVal: true}},
+	})
+	assert.NoError(t, err)
+	assert.True(t, plan.GetPlanOptions().GetExplainAnalyze())
+}
+
 func TestCreateSearchPlan(t *testing.T) {
 	schema := newTestSchemaHelper(t)
 	_, err := CreateSearchPlan(schema, `$meta["A"] != 10`, "FloatVectorField", &planpb.QueryInfo{
@@ -43,8 +43,13 @@ func (reducer *MilvusAggReducer) Reduce(results []*internalpb.RetrieveResults) (
 		if len(indices) == 0 {
 			return nil, merr.WrapErrParameterInvalidMsg("no indices found for output field at index %d", i)
 		} else if len(indices) == 1 {
-			// Single index: direct copy (non-avg aggregation or group-by field)
-			reOrganizedFieldDatas[i] = reducedFieldDatas[indices[0]]
+			// Single index: direct copy (non-avg aggregation or group-by field),
+			// approximate aggregates finalize their sketch
+			fieldData, err := reducer.outputMap.FinalizeAt(i, reducedFieldDatas[indices[0]])
+			if err != nil {
+				return nil, merr.Wrapf(err, "failed to finalize field %s", reducer.outputMap.NameAt(i))
+			}
+			reOrganizedFieldDatas[i] = fieldData
 			reOrganizedFieldDatas[i].FieldName = reducer.outputMap.NameAt(i)
 		} else if len(indices) == 2 {
 			// Two indices: avg aggregation (sum and count)
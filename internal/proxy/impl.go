@@ -3148,6 +3148,7 @@ func (node *Proxy) search(ctx context.Context, request *milvuspb.SearchRequest,
 		})
 		SetReportValue(qt.result.GetStatus(), v)
 		SetStorageCost(qt.result.GetStatus(), qt.storageCost)
+		SetExplainAnalyze(qt.result.GetStatus(), qt.explainAnalyze)
 		if merr.Ok(qt.result.GetStatus()) {
 			metrics.ProxyReportValue.WithLabelValues(nodeID, hookutil.OpTypeSearch, dbName, username).Add(float64(v))
 		}
@@ -3378,6 +3379,7 @@ func (node *Proxy) hybridSearch(ctx context.Context, request *milvuspb.HybridSea
 		})
 		SetReportValue(qt.result.GetStatus(), v)
 		SetStorageCost(qt.result.GetStatus(), qt.storageCost)
+		SetExplainAnalyze(qt.result.GetStatus(), qt.explainAnalyze)
 		if merr.Ok(qt.result.GetStatus()) {
 			metrics.ProxyReportValue.WithLabelValues(nodeID, hookutil.OpTypeHybridSearch, dbName, username).Add(float64(v))
 		}
@@ -3891,6 +3893,7 @@ func (node *Proxy) Query(ctx context.Context, request *milvuspb.QueryRequest) (*
 	})
 	SetReportValue(res.Status, v)
 	SetStorageCost(res.Status, storageCost)
+	SetExplainAnalyze(res.Status, qt.explainAnalyze)
 	metrics.ProxyReportValue.WithLabelValues(nodeID, hookutil.OpTypeQuery, request.DbName, username).Add(float64(v))
 
 	if mlog.LevelEnabled(mlog.DebugLevel) && matchCountRule(request.OutputFields) {
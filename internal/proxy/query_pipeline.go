@@ -283,7 +283,11 @@ func newReduceByGroupsOperator(
 			if len(indices) == 0 {
 				return nil, merr.WrapErrParameterInvalidMsg("no indices found for output field '%s'", outputMap.NameAt(i))
 			} else if len(indices) == 1 {
-				reOrganizedFieldDatas[i] = reducedFieldDatas[indices[0]]
+				fieldData, err := outputMap.FinalizeAt(i, reducedFieldDatas[indices[0]])
+				if err != nil {
+					return nil, err
+				}
+				reOrganizedFieldDatas[i] = fieldData
 				reOrganizedFieldDatas[i].FieldName = outputMap.NameAt(i)
 			} else if len(indices) == 2 {
 				sumFieldData := reducedFieldDatas[indices[0]]
@@ -346,7 +350,11 @@ func newAggRemapOperator(outputMap *agg.AggregationFieldMap) queryutil.Operator
 			if len(indices) == 0 {
 				return nil, merr.WrapErrParameterInvalidMsg("no indices found for output field '%s'", outputMap.NameAt(i))
 			} else if len(indices) == 1 {
-				remapped[i] = rawFields[indices[0]]
+				fieldData, err := outputMap.FinalizeAt(i, rawFields[indices[0]])
+				if err != nil {
+					return nil, err
+				}
+				remapped[i] = fieldData
 				remapped[i].FieldName = outputMap.NameAt(i)
 			} else if len(indices) == 2 {
 				avgFieldData, err := agg.ComputeAvgFromSumAndCount(rawFields[indices[0]], rawFields[indices[1]])
@@ -86,6 +86,7 @@ type queryTask struct {
 	mustUsePartitionKey  bool
 	resolvedTimezoneStr  string
 	storageCost          segcore.StorageCost
+	explainAnalyze       string
 	aggregationFieldMap  *agg.AggregationFieldMap
 }
 
@@ -201,7 +202,7 @@ func validateOrderByFieldsWithGroupBy(
 		fieldName := strings.ToLower(strings.TrimSpace(parts[0]))
 
 		// Reject aggregate expressions — not yet supported
-		if isAgg, _, _ := agg.MatchAggregationExpression(fieldName); isAgg {
+		if isAgg, _, _, _ := agg.MatchAggregationExpression(fieldName); isAgg {
 			return merr.WrapErrParameterInvalidMsg(
 				"ORDER BY on aggregate expression '%s' is not yet supported",
 				fieldName,
@@ -949,6 +950,7 @@ func (t *queryTask) PostExecute(ctx context.Context) error {
 	t.allQueryCnt = 0
 	t.totalRelatedDataSize = 0
 	t.storageCost = segcore.StorageCost{}
+	explainAnalyze := make([]string, 0)
 	select {
 	case <-t.TraceCtx().Done():
 		log.Warn(ctx, "proxy", mlog.Int64("Query: wait to finish failed, timeout!, msgID:", t.ID()))
@@ -962,9 +964,13 @@ func (t *queryTask) PostExecute(ctx context.Context) error {
 			t.storageCost.ScannedTotalBytes += res.GetScannedTotalBytes()
 			t.totalRelatedDataSize += res.GetCostAggregation().GetTotalRelatedDataSize()
 			log.Debug(ctx, "proxy receives one query result", mlog.Int64("sourceID", res.GetBase().GetSourceID()))
+			if res.GetExplainAnalyze() != "" {
+				explainAnalyze = append(explainAnalyze, res.GetExplainAnalyze())
+			}
 			return true
 		})
 	}
+	t.explainAnalyze = strings.Join(explainAnalyze, "\n")
 
 	metrics.ProxyDecodeResultLatency.WithLabelValues(strconv.FormatInt(paramtable.GetNodeID(), 10), t.getQueryLabel()).Observe(0.0)
 	tr.CtxRecord(ctx, "reduceResultStart")
@@ -115,8 +115,9 @@ type searchTask struct {
 	// if the user explicitly set pk field in output fields, we add it back to the result.
 	userRequestedPkFieldExplicitly bool
 
-	storageCost  segcore.StorageCost
-	traceEnabled bool
+	storageCost    segcore.StorageCost
+	explainAnalyze string
+	traceEnabled   bool
 
 	aggCtx *search_agg.SearchAggregationContext
 
@@ -1288,6 +1289,7 @@ func (t *searchTask) PostExecute(ctx context.Context) error {
 	isTopkReduce := false
 	isRecallEvaluation := false
 	storageCost := segcore.StorageCost{}
+	explainAnalyze := make([]string, 0)
 	for _, r := range toReduceResults {
 		if r.GetIsTopkReduce() {
 			isTopkReduce = true
@@ -1301,9 +1303,13 @@ func (t *searchTask) PostExecute(ctx context.Context) error {
 		}
 		storageCost.ScannedRemoteBytes += r.GetScannedRemoteBytes()
 		storageCost.ScannedTotalBytes += r.GetScannedTotalBytes()
+		if r.GetExplainAnalyze() != "" {
+			explainAnalyze = append(explainAnalyze, r.GetExplainAnalyze())
+		}
 	}
 
 	t.isTopkReduce = isTopkReduce
+	t.explainAnalyze = strings.Join(explainAnalyze, "\n")
 	t.isRecallEvaluation = isRecallEvaluation
 
 	// call pipeline
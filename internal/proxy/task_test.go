@@ -880,6 +880,22 @@ func TestTranslateOutputFields(t *testing.T) {
 		_, _, _, _, _, err = translateOutputFields([]string{idFieldName, floatVectorFieldName, ""}, schema, true)
 		assert.Error(t, err)
 	})
+
+	t.Run("approximate aggregates", func(t *testing.T) {
+		_, userOutputFields, _, aggregates, _, err := translateOutputFields([]string{"approx_count_distinct(timestamp)", "approx_percentile(timestamp, 0.95)"}, schema, false)
+		assert.NoError(t, err)
+		assert.ElementsMatch(t, []string{"approx_count_distinct(timestamp)", "approx_percentile(timestamp, 0.95)"}, userOutputFields)
+		assert.Len(t, aggregates, 2)
+		assert.Equal(t, "approx_count_distinct", aggregates[0].Name())
+		assert.Equal(t, "approx_percentile", aggregates[1].Name())
+		assert.Equal(t, int64(1), aggregates[1].FieldID())
+		assert.Equal(t, 0.95, aggregates[1].ToPB().GetPercentile())
+
+		_, _, _, _, _, err = translateOutputFields([]string{"approx_percentile(timestamp)"}, schema, false)
+		assert.Error(t, err)
+		_, _, _, _, _, err = translateOutputFields([]string{"approx_count_distinct(timestamp, 0.5)"}, schema, false)
+		assert.Error(t, err)
+	})
 }
 
 func TestTranslateOutputFields_StructArrayField(t *testing.T) {
@@ -1663,9 +1663,9 @@ func translateOutputFields(outputFields []string, schema *schemaInfo, removePkFi
 			}
 			useAllDyncamicFields = true
 		} else {
-			if isAgg, aggregateName, aggFieldName := agg.MatchAggregationExpression(outputFieldName); isAgg {
+			if isAgg, aggregateName, aggFieldName, aggArgument := agg.MatchAggregationExpression(outputFieldName); isAgg {
 				if aggField, ok := allFieldNameMap[aggFieldName]; ok {
-					aggFuncs, aggErr := agg.NewAggregate(aggregateName, aggField.GetFieldID(), outputFieldName, aggField.GetDataType())
+					aggFuncs, aggErr := agg.NewAggregateWithArgument(aggregateName, aggField.GetFieldID(), outputFieldName, aggField.GetDataType(), aggArgument)
 					if aggErr != nil {
 						return nil, nil, nil, nil, false, aggErr
 					}
@@ -1678,7 +1678,7 @@ func translateOutputFields(outputFields []string, schema *schemaInfo, removePkFi
 					if err := agg.ValidateAggFieldType(aggregateName, schemapb.DataType_None); err != nil {
 						return nil, nil, nil, nil, false, err
 					}
-					aggFuncs, aggErr := agg.NewAggregate(aggregateName, 0, outputFieldName, schemapb.DataType_None)
+					aggFuncs, aggErr := agg.NewAggregateWithArgument(aggregateName, 0, outputFieldName, schemapb.DataType_None, aggArgument)
 					if aggErr != nil {
 						return nil, nil, nil, nil, false, aggErr
 					}
@@ -2838,6 +2838,23 @@ func SetStorageCost(status *commonpb.Status, storageCost segcore.StorageCost) {
 	status.ExtraInfo["cache_hit_ratio"] = strconv.FormatFloat(cacheHitRatio, 'f', -1, 64)
 }
 
+// SetExplainAnalyze returns the EXPLAIN ANALYZE trees of the request to the
+// client in the extra info of its status, next to the storage cost.
+func SetExplainAnalyze(status *commonpb.Status, explainAnalyze string) {
+	if explainAnalyze == "" {
+		return
+	}
+	if !merr.Ok(status) {
+		return
+	}
+	if status.ExtraInfo == nil {
+		status.ExtraInfo = make(map[string]string)
+		// set report_value to 0 for compatibility, see SetStorageCost
+		status.ExtraInfo["report_value"] = strconv.Itoa(0)
+	}
+	status.ExtraInfo["explain_analyze"] = explainAnalyze
+}
+
 func GetCostValue(status *commonpb.Status) int {
 	if status == nil || status.ExtraInfo == nil {
 		return 0
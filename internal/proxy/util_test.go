@@ -2636,6 +2636,27 @@ func TestGetCostValue(t *testing.T) {
 	})
 }
 
+func TestSetExplainAnalyze(t *testing.T) {
+	t.Run("empty explain", func(t *testing.T) {
+		status := merr.Success()
+		SetExplainAnalyze(status, "")
+		assert.Nil(t, status.ExtraInfo)
+	})
+
+	t.Run("failed status", func(t *testing.T) {
+		status := merr.Status(merr.ErrServiceNotReady)
+		SetExplainAnalyze(status, "segment=1 search")
+		assert.Nil(t, status.ExtraInfo)
+	})
+
+	t.Run("success", func(t *testing.T) {
+		status := merr.Success()
+		SetExplainAnalyze(status, "segment=1 search\nsegment=2 search")
+		assert.Equal(t, "segment=1 search\nsegment=2 search", status.ExtraInfo["explain_analyze"])
+		assert.Equal(t, 0, GetCostValue(status))
+	})
+}
+
 func TestValidateLoadFieldsList(t *testing.T) {
 	type testCase struct {
 		tag       string
@@ -25,8 +25,11 @@ import (
 	"github.com/milvus-io/milvus-proto/go-api/v3/schemapb"
 	"github.com/milvus-io/milvus/internal/util/queryutil"
 	"github.com/milvus-io/milvus/internal/util/reduce"
+	"github.com/milvus-io/milvus/internal/util/reduce/orderby"
 	"github.com/milvus-io/milvus/internal/util/segcore"
+	"github.com/milvus-io/milvus/pkg/v3/common"
 	"github.com/milvus-io/milvus/pkg/v3/mlog"
+	"github.com/milvus-io/milvus/pkg/v3/proto/internalpb"
 	"github.com/milvus-io/milvus/pkg/v3/proto/segcorepb"
 	"github.com/milvus-io/milvus/pkg/v3/util/conc"
 	"github.com/milvus-io/milvus/pkg/v3/util/merr"
@@ -47,6 +50,9 @@ type MergedResultWithOffsets struct {
 	IDs          *schemapb.IDs
 	Selections   []OffsetSelection
 	ElementLevel bool // true if results are element-level
+	// SortFields holds the phase-one columns of an ORDER BY merge
+	// ([pk, orderby..., system fields]) in selection order; nil otherwise.
+	SortFields []*schemapb.FieldData
 }
 
 // NewMergeByPKWithOffsetsOperator creates an operator that performs PK-ordered
@@ -181,10 +187,108 @@ func NewMergeByPKWithOffsetsOperator(
 	})
 }
 
+// NewMergeByOrderByWithOffsetsOperator creates an operator that merges the
+// phase-one ORDER BY results ([pk, orderby..., system fields]) of all segments
+// on the ORDER BY keys, with the same pk+timestamp deduplication and topK
+// limit as the one-phase DeduplicatePK → OrderByLimit reduce, tracking the
+// segment offset of every surviving row for later field data retrieval.
+//
+// Input[0]: []*segcorepb.RetrieveResults (valid results with offsets and timestamps)
+// Output[0]: *MergedResultWithOffsets (PKs + offset selections + sort columns, ORDER BY sorted)
+func NewMergeByOrderByWithOffsetsOperator(
+	orderByFields []*orderby.OrderByField,
+	topK int64,
+	maxOutputSize int64,
+	schema *schemapb.CollectionSchema,
+) queryutil.Operator {
+	return queryutil.NewLambdaOperator(queryutil.OpMergeByOrderBy, func(ctx context.Context, span trace.Span, inputs ...any) ([]any, error) {
+		results := inputs[0].([]*segcorepb.RetrieveResults)
+
+		// Resolve the selection of every pk up front, using the tie rule of
+		// DeduplicatePK: the first row wins unless a later one is newer.
+		type pkEntry struct {
+			sel OffsetSelection
+			ts  int64
+		}
+		pkMap := make(map[any]pkEntry)
+		internalResults := make([]*internalpb.RetrieveResults, 0, len(results))
+		for i, r := range results {
+			tr, err := NewTimestampedRetrieveResult(r)
+			if err != nil {
+				return nil, merr.Wrap(err, "failed to create timestamped result")
+			}
+			size := typeutil.GetSizeOfIDs(r.GetIds())
+			for j := 0; j < size; j++ {
+				pk := typeutil.GetPK(r.GetIds(), int64(j))
+				ts := tr.Timestamps[j]
+				if entry, ok := pkMap[pk]; ok && (ts == 0 || ts <= entry.ts) {
+					continue
+				}
+				pkMap[pk] = pkEntry{
+					sel: OffsetSelection{SegmentIndex: i, Offset: r.GetOffset()[j]},
+					ts:  ts,
+				}
+			}
+			internalResults = append(internalResults, &internalpb.RetrieveResults{
+				Ids:        r.GetIds(),
+				FieldsData: r.GetFieldsData(),
+			})
+		}
+
+		outs, err := queryutil.NewDeduplicatePKOperator(maxOutputSize, schema).Run(ctx, span, internalResults)
+		if err != nil {
+			return nil, err
+		}
+		outs, err = queryutil.NewOrderByLimitOperator(orderByFields, topK).Run(ctx, span, outs[0])
+		if err != nil {
+			return nil, err
+		}
+		top := outs[0].(*internalpb.RetrieveResults)
+
+		size := typeutil.GetSizeOfIDs(top.GetIds())
+		selections := make([]OffsetSelection, 0, size)
+		for j := 0; j < size; j++ {
+			pk := typeutil.GetPK(top.GetIds(), int64(j))
+			selections = append(selections, pkMap[pk].sel)
+		}
+
+		ids := top.GetIds()
+		if ids == nil {
+			ids = &schemapb.IDs{}
+		}
+		return []any{&MergedResultWithOffsets{
+			IDs:        ids,
+			Selections: selections,
+			SortFields: top.GetFieldsData(),
+		}}, nil
+	})
+}
+
+// withSortFields lays out an ORDER BY two-phase result like the one-phase
+// one: [pk, orderby..., fetched columns..., system fields].
+func withSortFields(ret *segcorepb.RetrieveResults, merged *MergedResultWithOffsets) *segcorepb.RetrieveResults {
+	if len(merged.SortFields) == 0 {
+		return ret
+	}
+	fieldsData := make([]*schemapb.FieldData, 0, len(merged.SortFields)+len(ret.GetFieldsData()))
+	var systemFields []*schemapb.FieldData
+	for _, fd := range merged.SortFields {
+		if common.IsSystemField(fd.GetFieldId()) {
+			systemFields = append(systemFields, fd)
+			continue
+		}
+		fieldsData = append(fieldsData, fd)
+	}
+	fieldsData = append(fieldsData, ret.GetFieldsData()...)
+	ret.FieldsData = append(fieldsData, systemFields...)
+	return ret
+}
+
 // NewFetchFieldsDataOperator creates an operator that retrieves full field data
 // from segments using offset-based retrieval. This is the second stage of the
 // IgnoreNonPk pipeline: after PK merge + dedup + topK, fetch actual field data
-// only for the selected rows.
+// only for the selected rows. For an ORDER BY merge the sort columns of phase
+// one are laid out around the fetched ones.
 //
 // Input[0]: *MergedResultWithOffsets
 // Output[0]: *segcorepb.RetrieveResults (with IDs and full FieldsData)
@@ -202,7 +306,7 @@ func NewFetchFieldsDataOperator(
 		}
 
 		if len(merged.Selections) == 0 {
-			return []any{ret}, nil
+			return []any{withSortFields(ret, merged)}, nil
 		}
 
 		// Group selections by segment index
@@ -248,7 +352,7 @@ func NewFetchFieldsDataOperator(
 		}
 
 		if ret.FieldsData == nil {
-			return []any{ret}, nil
+			return []any{withSortFields(ret, merged)}, nil
 		}
 
 		// Build FieldsData in PK-sorted order (matching selections order)
@@ -287,6 +391,6 @@ func NewFetchFieldsDataOperator(
 			}
 		}
 
-		return []any{ret}, nil
+		return []any{withSortFields(ret, merged)}, nil
 	})
 }
@@ -43,8 +43,13 @@ import (
 //	IgnoreNonPk=true (plain query, multi-segment):
 //	  [MergeByPKWithOffsets(topK)] → [FetchFieldsData] → output
 //
+//	IgnoreNonPk=true (ORDER BY, multi-segment):
+//	  [MergeByOrderByWithOffsets(topK)] → [FetchFieldsData] → output
+//
 //	Plain / ORDER BY / GROUP BY / GROUP BY+ORDER BY:
-//	  Uses BuildQueryReducePipeline (see pipeline_builders.go)
+//	  Uses BuildQueryReducePipeline (see pipeline_builders.go). GROUP BY
+//	  partials the plan lets segcore merge arrive already merged from
+//	  retrieveOnSegments.
 func RunQNQueryPipeline(
 	ctx context.Context,
 	req *querypb.QueryRequest,
@@ -66,7 +71,7 @@ func RunQNQueryPipeline(
 	var err error
 
 	if retrievePlan.IsIgnoreNonPk() {
-		pipeline, msg, err = buildIgnoreNonPkPipeline(req, segcoreResults, segments, manager, retrievePlan)
+		pipeline, msg, err = buildIgnoreNonPkPipeline(req, schema, segcoreResults, segments, manager, retrievePlan)
 	} else {
 		pipeline, msg, err = buildStandardQNPipeline(req, schema, plan, segcoreResults)
 	}
@@ -85,9 +90,11 @@ func RunQNQueryPipeline(
 }
 
 // buildIgnoreNonPkPipeline builds the two-phase pipeline for IgnoreNonPk=true:
-// [MergeByPKWithOffsets(topK)] → [FetchFieldsData] → output
+// [MergeByPKWithOffsets(topK)] → [FetchFieldsData] → output, merging on the
+// ORDER BY keys instead of the pk when the query has an ORDER BY.
 func buildIgnoreNonPkPipeline(
 	req *querypb.QueryRequest,
+	schema *schemapb.CollectionSchema,
 	segcoreResults []*segcorepb.RetrieveResults,
 	segments []Segment,
 	manager *Manager,
@@ -96,6 +103,13 @@ func buildIgnoreNonPkPipeline(
 	topK := req.GetReq().GetLimit()
 	reduceType := reduce.ToReduceType(req.GetReq().GetReduceType())
 
+	orderByFields, err := orderby.ConvertFromPlanOrderByFields(
+		req.GetReq().GetOrderByFields(), schema,
+	)
+	if err != nil {
+		return nil, nil, merr.Wrap(err, "failed to convert ORDER BY fields")
+	}
+
 	// Filter valid results (with offsets and non-zero PKs) and corresponding segments
 	validResults := make([]*segcorepb.RetrieveResults, 0, len(segcoreResults))
 	validSegments := make([]Segment, 0, len(segments))
@@ -109,11 +123,20 @@ func buildIgnoreNonPkPipeline(
 	}
 
 	builder := queryutil.NewPipelineBuilder(queryutil.PipelineNameQNIgnoreNonPk)
-	builder.Add(queryutil.OpMergeByPKOffsets,
-		[]string{queryutil.PipelineInput},
-		[]string{queryutil.ChannelMerged},
-		NewMergeByPKWithOffsetsOperator(topK, reduceType),
-	)
+	if len(orderByFields) > 0 {
+		maxOutputSize := paramtable.Get().QuotaConfig.MaxOutputSize.GetAsInt64()
+		builder.Add(queryutil.OpMergeByOrderBy,
+			[]string{queryutil.PipelineInput},
+			[]string{queryutil.ChannelMerged},
+			NewMergeByOrderByWithOffsetsOperator(orderByFields, topK, maxOutputSize, schema),
+		)
+	} else {
+		builder.Add(queryutil.OpMergeByPKOffsets,
+			[]string{queryutil.PipelineInput},
+			[]string{queryutil.ChannelMerged},
+			NewMergeByPKWithOffsetsOperator(topK, reduceType),
+		)
+	}
 	builder.Add(queryutil.OpFetchFields,
 		[]string{queryutil.ChannelMerged},
 		[]string{queryutil.PipelineOutput},
@@ -232,6 +255,7 @@ func extractSegcoreResult(
 		HasMoreResult:      anyFieldTrue(segcoreResults, func(r *segcorepb.RetrieveResults) bool { return r.GetHasMoreResult() }),
 		ScannedRemoteBytes: sumInt64Field(segcoreResults, func(r *segcorepb.RetrieveResults) int64 { return r.GetScannedRemoteBytes() }),
 		ScannedTotalBytes:  sumInt64Field(segcoreResults, func(r *segcorepb.RetrieveResults) int64 { return r.GetScannedTotalBytes() }),
+		ExplainAnalyze:     joinStringField(segcoreResults, func(r *segcorepb.RetrieveResults) string { return r.GetExplainAnalyze() }),
 	}
 
 	// Only fill empty fields when result has no data at all.
@@ -293,6 +317,7 @@ func RunDelegatorQueryPipeline(
 	output.HasMoreResult = anyFieldTrueInternal(results, func(r *internalpb.RetrieveResults) bool { return r.GetHasMoreResult() })
 	output.ScannedRemoteBytes = sumInt64FieldInternal(results, func(r *internalpb.RetrieveResults) int64 { return r.GetScannedRemoteBytes() })
 	output.ScannedTotalBytes = sumInt64FieldInternal(results, func(r *internalpb.RetrieveResults) int64 { return r.GetScannedTotalBytes() })
+	output.ExplainAnalyze = joinStringFieldInternal(results, func(r *internalpb.RetrieveResults) string { return r.GetExplainAnalyze() })
 
 	// Only fill empty fields when result has no data at all (same guard as QN level).
 	if len(output.GetFieldsData()) == 0 {
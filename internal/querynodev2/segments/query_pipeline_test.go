@@ -28,6 +28,7 @@ import (
 	"github.com/milvus-io/milvus-proto/go-api/v3/schemapb"
 	"github.com/milvus-io/milvus/internal/util/queryutil"
 	"github.com/milvus-io/milvus/internal/util/segcore"
+	"github.com/milvus-io/milvus/pkg/v3/common"
 	"github.com/milvus-io/milvus/pkg/v3/proto/internalpb"
 	"github.com/milvus-io/milvus/pkg/v3/proto/planpb"
 	"github.com/milvus-io/milvus/pkg/v3/proto/querypb"
@@ -320,6 +321,87 @@ func TestRunQNQueryPipeline(t *testing.T) {
 		assert.Equal(t, int64(5), out.GetAllRetrieveCount())
 	})
 
+	t.Run("ignore non pk order by path", func(t *testing.T) {
+		req := &querypb.QueryRequest{Req: &internalpb.RetrieveRequest{
+			Limit:          3,
+			OutputFieldsId: []int64{100, 101, 200},
+			OrderByFields:  []*planpb.OrderByField{{FieldId: 101, Ascending: false}},
+		}}
+		rp := &segcore.RetrievePlan{}
+		rp.SetIgnoreNonPk(true)
+
+		makeColorField := func(vals []string) *schemapb.FieldData {
+			return &schemapb.FieldData{
+				FieldId:   200,
+				FieldName: "color",
+				Type:      schemapb.DataType_VarChar,
+				Field: &schemapb.FieldData_Scalars{
+					Scalars: &schemapb.ScalarField{
+						Data: &schemapb.ScalarField_StringData{StringData: &schemapb.StringArray{Data: vals}},
+					},
+				},
+			}
+		}
+
+		// The second phase must run, and only for the merged top rows.
+		seg0 := NewMockSegment(t)
+		seg1 := NewMockSegment(t)
+		seg0.EXPECT().DatabaseName().Return("default").Maybe()
+		seg0.EXPECT().ResourceGroup().Return("rg").Maybe()
+		seg1.EXPECT().DatabaseName().Return("default").Maybe()
+		seg1.EXPECT().ResourceGroup().Return("rg").Maybe()
+		seg0.EXPECT().RetrieveByOffsets(mock.Anything, mock.AnythingOfType("*segcore.RetrievePlanWithOffsets")).
+			RunAndReturn(func(ctx context.Context, plan *segcore.RetrievePlanWithOffsets) (*segcorepb.RetrieveResults, error) {
+				assert.Equal(t, []int64{10}, plan.Offsets)
+				return &segcorepb.RetrieveResults{
+					FieldsData: []*schemapb.FieldData{makeColorField([]string{"a"})},
+				}, nil
+			}).Once()
+		seg1.EXPECT().RetrieveByOffsets(mock.Anything, mock.AnythingOfType("*segcore.RetrievePlanWithOffsets")).
+			RunAndReturn(func(ctx context.Context, plan *segcore.RetrievePlanWithOffsets) (*segcorepb.RetrieveResults, error) {
+				assert.Equal(t, []int64{20, 21}, plan.Offsets)
+				return &segcorepb.RetrieveResults{
+					FieldsData: []*schemapb.FieldData{makeColorField([]string{"c", "b"})},
+				}, nil
+			}).Once()
+
+		// Phase one: [pk, age, timestamp]; pk 2 is newer in segment 1.
+		segcoreResults := []*segcorepb.RetrieveResults{
+			{
+				Ids:    makeInternalIntIDs([]int64{1, 2}),
+				Offset: []int64{10, 11},
+				FieldsData: []*schemapb.FieldData{
+					makeInt64Field(100, "pk", []int64{1, 2}),
+					makeInt64Field(101, "age", []int64{50, 10}),
+					makeSegcoreTsField([]int64{100, 100}),
+				},
+				AllRetrieveCount: 2,
+			},
+			{
+				Ids:    makeInternalIntIDs([]int64{3, 2}),
+				Offset: []int64{20, 21},
+				FieldsData: []*schemapb.FieldData{
+					makeInt64Field(100, "pk", []int64{3, 2}),
+					makeInt64Field(101, "age", []int64{40, 30}),
+					makeSegcoreTsField([]int64{100, 200}),
+				},
+				AllRetrieveCount: 2,
+			},
+		}
+
+		out, err := RunQNQueryPipeline(ctx, req, schema, plan, segcoreResults, []Segment{seg0, seg1}, nil, rp)
+		require.NoError(t, err)
+		assert.Equal(t, []int64{1, 3, 2}, out.GetIds().GetIntId().GetData())
+		require.Len(t, out.GetFieldsData(), 4)
+		assert.Equal(t, int64(100), out.GetFieldsData()[0].GetFieldId())
+		assert.Equal(t, []int64{1, 3, 2}, out.GetFieldsData()[0].GetScalars().GetLongData().GetData())
+		assert.Equal(t, []int64{50, 40, 30}, out.GetFieldsData()[1].GetScalars().GetLongData().GetData())
+		assert.Equal(t, []string{"a", "c", "b"}, out.GetFieldsData()[2].GetScalars().GetStringData().GetData())
+		assert.Equal(t, int64(common.TimeStampField), out.GetFieldsData()[3].GetFieldId())
+		assert.Equal(t, []int64{100, 100, 200}, out.GetFieldsData()[3].GetScalars().GetLongData().GetData())
+		assert.Equal(t, int64(4), out.GetAllRetrieveCount())
+	})
+
 	t.Run("all empty segcore results", func(t *testing.T) {
 		req := &querypb.QueryRequest{Req: &internalpb.RetrieveRequest{Limit: 2, OutputFieldsId: []int64{100}}}
 		rp := &segcore.RetrievePlan{}
@@ -130,6 +130,7 @@ func ReduceSearchResults(ctx context.Context, results []*internalpb.SearchResult
 	searchResults.IsRecallEvaluation = isRecallEvaluation
 	searchResults.ScannedRemoteBytes = storageCost.ScannedRemoteBytes
 	searchResults.ScannedTotalBytes = storageCost.ScannedTotalBytes
+	searchResults.ExplainAnalyze = joinStringFieldSearch(results, func(r *internalpb.SearchResults) string { return r.GetExplainAnalyze() })
 	return searchResults, nil
 }
 
@@ -184,6 +185,7 @@ func ReduceAdvancedSearchResults(ctx context.Context, results []*internalpb.Sear
 	searchResults.IsTopkReduce = isTopkReduce
 	searchResults.ScannedRemoteBytes = storageCost.ScannedRemoteBytes
 	searchResults.ScannedTotalBytes = storageCost.ScannedTotalBytes
+	searchResults.ExplainAnalyze = joinStringFieldSearch(results, func(r *internalpb.SearchResults) string { return r.GetExplainAnalyze() })
 	return searchResults, nil
 }
 
@@ -20,7 +20,10 @@ import (
 	"context"
 	"sync"
 
+	"go.opentelemetry.io/otel"
+
 	"github.com/milvus-io/milvus-proto/go-api/v3/commonpb"
+	"github.com/milvus-io/milvus/internal/util/segcore"
 	"github.com/milvus-io/milvus/internal/util/streamrpc"
 	"github.com/milvus-io/milvus/pkg/v3/metrics"
 	"github.com/milvus-io/milvus/pkg/v3/mlog"
@@ -35,7 +38,9 @@ import (
 )
 
 type RetrieveSegmentResult struct {
-	Result  *segcorepb.RetrieveResults
+	Result *segcorepb.RetrieveResults
+	// Segment is nil when Result holds the merged GROUP BY partials of
+	// several segments, see retrieveAndMergeAggregationOnSegments.
 	Segment Segment
 }
 
@@ -51,6 +56,10 @@ func retrieveOnSegments(ctx context.Context, mgr *Manager, segments []Segment, s
 		label = metrics.GrowingSegmentLabel
 	}
 
+	if shouldMergeAggregationInSegcore(req, segments, plan) {
+		return retrieveAndMergeAggregationOnSegments(ctx, mgr, segments, label, plan)
+	}
+
 	retriever := func(ctx context.Context, s Segment) error {
 		tr := timerecord.NewTimeRecorder("retrieveOnSegments")
 		result, err := s.Retrieve(ctx, plan)
@@ -99,12 +108,72 @@ func retrieveOnSegments(ctx context.Context, mgr *Manager, segments []Segment, s
 	return results, nil
 }
 
+// shouldMergeAggregationInSegcore reports whether the GROUP BY partials of the
+// segments are merged in segcore: the merge is enabled, the plan allows it and
+// every segment is a local segment with a segcore result to hand over.
+func shouldMergeAggregationInSegcore(req *querypb.QueryRequest, segments []Segment, plan *RetrievePlan) bool {
+	hasAggregation := len(req.GetReq().GetGroupByFieldIds()) > 0 || len(req.GetReq().GetAggregates()) > 0
+	if !hasAggregation || len(segments) <= 1 ||
+		paramtable.Get().QueryNodeCfg.AggregationMergeParallelism.GetAsInt64() <= 0 ||
+		!plan.CanMergeAggregationResults() {
+		return false
+	}
+	for _, s := range segments {
+		if _, ok := s.(*LocalSegment); !ok {
+			return false
+		}
+	}
+	return true
+}
+
+// retrieveAndMergeAggregationOnSegments retrieves the GROUP BY partials of the
+// segments and merges them in segcore before decoding, so the node decodes
+// and reduces one partial instead of one per segment.
+func retrieveAndMergeAggregationOnSegments(ctx context.Context, mgr *Manager, segments []Segment, label string, plan *RetrievePlan) ([]RetrieveSegmentResult, error) {
+	var mu sync.Mutex
+	partials := make([]*segcore.RetrieveResult, 0, len(segments))
+	defer func() {
+		for _, partial := range partials {
+			partial.Release()
+		}
+	}()
+
+	retriever := func(ctx context.Context, s Segment) error {
+		tr := timerecord.NewTimeRecorder("retrieveOnSegments")
+		result, err := s.(*LocalSegment).RetrieveSegcoreResult(ctx, plan)
+		if err != nil {
+			return err
+		}
+		mu.Lock()
+		partials = append(partials, result)
+		mu.Unlock()
+		metrics.QueryNodeSQSegmentLatency.WithLabelValues(paramtable.GetStringNodeID(),
+			contextutil.GetQueryLabel(ctx), label).Observe(float64(tr.ElapseSpan().Microseconds()) / 1000.0)
+		return nil
+	}
+
+	err := doOnSegments(ctx, mgr, segments, retriever)
+	if err != nil {
+		return nil, err
+	}
+
+	_, span := otel.Tracer(typeutil.QueryNodeRole).Start(ctx, "merge-segcore-aggregation-results")
+	defer span.End()
+	merged, err := segcore.MergeAggregationRetrieveResults(plan, partials,
+		paramtable.Get().QueryNodeCfg.AggregationMergeParallelism.GetAsInt64())
+	if err != nil {
+		return nil, merr.Wrap(err, "failed to merge aggregation results of segments")
+	}
+	return []RetrieveSegmentResult{{Result: merged}}, nil
+}
+
 // shouldEnableIgnoreNonPk determines whether to use two-phase retrieval
 // (first fetch PKs only, then fetch full field data for selected rows).
 //
-// Note: ORDER BY queries are excluded at the C++ layer — ShouldIgnoreNonPk()
-// in plan_c.cpp returns false when has_order_by_=true, so planShouldIgnoreNonPk
-// is already false for ORDER BY. No explicit !hasOrderBy check is needed here.
+// Note: ORDER BY queries are decided at the C++ layer — ShouldIgnoreNonPk()
+// in plan_c.cpp returns true only when the plan has output columns beyond the
+// pk and ORDER BY keys; buildIgnoreNonPkPipeline then merges on the ORDER BY
+// keys. No explicit hasOrderBy check is needed here.
 func shouldEnableIgnoreNonPk(req *querypb.QueryRequest, segmentNum int, planShouldIgnoreNonPk bool) bool {
 	hasGroupBy := len(req.GetReq().GetGroupByFieldIds()) > 0 || len(req.GetReq().GetAggregates()) > 0
 	return !hasGroupBy && segmentNum > 1 && req.GetReq().GetLimit() != typeutil.Unlimited && planShouldIgnoreNonPk
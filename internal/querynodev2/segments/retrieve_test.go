@@ -24,6 +24,7 @@ import (
 
 	"github.com/stretchr/testify/assert"
 	"github.com/stretchr/testify/suite"
+	"google.golang.org/protobuf/proto"
 
 	"github.com/milvus-io/milvus-proto/go-api/v3/schemapb"
 	"github.com/milvus-io/milvus/internal/mocks/util/mock_segcore"
@@ -35,6 +36,7 @@ import (
 	"github.com/milvus-io/milvus/pkg/v3/proto/internalpb"
 	"github.com/milvus-io/milvus/pkg/v3/proto/planpb"
 	"github.com/milvus-io/milvus/pkg/v3/proto/querypb"
+	"github.com/milvus-io/milvus/pkg/v3/proto/segcorepb"
 	"github.com/milvus-io/milvus/pkg/v3/util/merr"
 	"github.com/milvus-io/milvus/pkg/v3/util/paramtable"
 )
@@ -629,6 +631,85 @@ func (suite *RetrieveSuite) TestRetrieveStreamWithFilter() {
 	}
 }
 
+func (suite *RetrieveSuite) TestRetrieveGroupByMergesSegments() {
+	int8FieldID := int64(103)
+	groupBy := []int64{int8FieldID}
+	aggs := []*planpb.Aggregate{{Op: planpb.AggregateOp_count}}
+	planNode := &planpb.PlanNode{
+		Node: &planpb.PlanNode_Query{
+			Query: &planpb.QueryPlanNode{
+				GroupByFieldIds: groupBy,
+				Aggregates:      aggs,
+				Limit:           -1,
+			},
+		},
+	}
+	planBytes, err := proto.Marshal(planNode)
+	suite.Require().NoError(err)
+	plan, err := segcore.NewRetrievePlan(suite.collection.GetCCollection(), planBytes, 1000, 100, 0, 0, 0)
+	suite.Require().NoError(err)
+	defer plan.Delete()
+	suite.True(plan.CanMergeAggregationResults())
+
+	req := &querypb.QueryRequest{
+		Req: &internalpb.RetrieveRequest{
+			CollectionID:       suite.collectionID,
+			PartitionIDs:       []int64{suite.partitionID},
+			Limit:              -1,
+			SerializedExprPlan: planBytes,
+			GroupByFieldIds:    groupBy,
+			Aggregates:         aggs,
+		},
+	}
+
+	groupCounts := func(result *segcorepb.RetrieveResults) map[int32]int64 {
+		suite.Require().Len(result.GetFieldsData(), 2)
+		keys := result.GetFieldsData()[0].GetScalars().GetIntData().GetData()
+		counts := result.GetFieldsData()[1].GetScalars().GetLongData().GetData()
+		suite.Require().Len(counts, len(keys))
+		groups := make(map[int32]int64, len(keys))
+		for i, key := range keys {
+			_, ok := groups[key]
+			suite.False(ok, "group %d is returned twice", key)
+			groups[key] = counts[i]
+		}
+		return groups
+	}
+	reduce := func(results []RetrieveSegmentResult) *segcorepb.RetrieveResults {
+		segcoreResults := make([]*segcorepb.RetrieveResults, 0, len(results))
+		for _, r := range results {
+			segcoreResults = append(segcoreResults, r.Result)
+		}
+		out, err := RunQNQueryPipeline(suite.ctx, req, suite.schema, planNode, segcoreResults, nil, suite.manager, plan)
+		suite.Require().NoError(err)
+		return out
+	}
+	segments := []Segment{suite.sealed, suite.growing}
+
+	paramtable.Get().Save(paramtable.Get().QueryNodeCfg.AggregationMergeParallelism.Key, "2")
+	defer paramtable.Get().Reset(paramtable.Get().QueryNodeCfg.AggregationMergeParallelism.Key)
+	merged, err := retrieveOnSegments(suite.ctx, suite.manager, segments, SegmentTypeSealed, plan, req)
+	suite.Require().NoError(err)
+	suite.Require().Len(merged, 1)
+	suite.Nil(merged[0].Segment)
+	mergedGroups := groupCounts(merged[0].Result)
+	total := int64(0)
+	for _, count := range mergedGroups {
+		total += count
+	}
+	suite.EqualValues(200, total)
+	out := reduce(merged)
+	suite.Equal(mergedGroups, groupCounts(out))
+
+	paramtable.Get().Save(paramtable.Get().QueryNodeCfg.AggregationMergeParallelism.Key, "0")
+	unmerged, err := retrieveOnSegments(suite.ctx, suite.manager, segments, SegmentTypeSealed, plan, req)
+	suite.Require().NoError(err)
+	suite.Len(unmerged, 2)
+	unmergedOut := reduce(unmerged)
+	suite.Equal(mergedGroups, groupCounts(unmergedOut))
+	suite.Equal(unmergedOut.GetAllRetrieveCount(), out.GetAllRetrieveCount())
+}
+
 func (suite *RetrieveSuite) TestRetrieveNonExistSegment() {
 	plan, err := mock_segcore.GenSimpleRetrievePlan(suite.collection.GetCCollection())
 	suite.NoError(err)
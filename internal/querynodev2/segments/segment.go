@@ -798,14 +798,25 @@ func (s *LocalSegment) retrieve(ctx context.Context, plan *segcore.RetrievePlan,
 	return result, nil
 }
 
-func (s *LocalSegment) Retrieve(ctx context.Context, plan *segcore.RetrievePlan) (*segcorepb.RetrieveResults, error) {
-	log := mlog.WithLazy(
+func (s *LocalSegment) retrieveLogger(plan *segcore.RetrievePlan) *mlog.Logger {
+	return mlog.WithLazy(
 		mlog.FieldCollectionID(s.Collection()),
 		mlog.FieldPartitionID(s.Partition()),
 		mlog.FieldSegmentID(s.ID()),
 		mlog.Uint64("mvcc", plan.Timestamp),
 		mlog.String("segmentType", s.segmentType.String()),
 	)
+}
+
+// RetrieveSegcoreResult retrieves like Retrieve but returns the result still
+// serialized by segcore, so the results of several segments can be merged in
+// segcore before one of them is decoded. The caller releases the result.
+func (s *LocalSegment) RetrieveSegcoreResult(ctx context.Context, plan *segcore.RetrievePlan) (*segcore.RetrieveResult, error) {
+	return s.retrieve(ctx, plan, s.retrieveLogger(plan))
+}
+
+func (s *LocalSegment) Retrieve(ctx context.Context, plan *segcore.RetrievePlan) (*segcorepb.RetrieveResults, error) {
+	log := s.retrieveLogger(plan)
 
 	result, err := s.retrieve(ctx, plan, log)
 	if err != nil {
@@ -17,6 +17,8 @@
 package segments
 
 import (
+	"strings"
+
 	"github.com/milvus-io/milvus/pkg/v3/proto/internalpb"
 	"github.com/milvus-io/milvus/pkg/v3/proto/segcorepb"
 )
@@ -60,3 +62,35 @@ func anyFieldTrueInternal(results []*internalpb.RetrieveResults, getter func(*in
 	}
 	return false
 }
+
+// joinStringField joins the non-empty values, such as the EXPLAIN ANALYZE
+// trees of several segments, one per line.
+func joinStringField(results []*segcorepb.RetrieveResults, getter func(*segcorepb.RetrieveResults) string) string {
+	values := make([]string, 0, len(results))
+	for _, r := range results {
+		if r != nil && getter(r) != "" {
+			values = append(values, getter(r))
+		}
+	}
+	return strings.Join(values, "\n")
+}
+
+func joinStringFieldInternal(results []*internalpb.RetrieveResults, getter func(*internalpb.RetrieveResults) string) string {
+	values := make([]string, 0, len(results))
+	for _, r := range results {
+		if r != nil && getter(r) != "" {
+			values = append(values, getter(r))
+		}
+	}
+	return strings.Join(values, "\n")
+}
+
+func joinStringFieldSearch(results []*internalpb.SearchResults, getter func(*internalpb.SearchResults) string) string {
+	values := make([]string, 0, len(results))
+	for _, r := range results {
+		if r != nil && getter(r) != "" {
+			values = append(values, getter(r))
+		}
+	}
+	return strings.Join(values, "\n")
+}
@@ -129,3 +129,33 @@ func TestAnyFieldTrueInternal_WithNil(t *testing.T) {
 func TestAnyFieldTrueInternal_Empty(t *testing.T) {
 	assert.False(t, anyFieldTrueInternal(nil, func(r *internalpb.RetrieveResults) bool { return r.GetHasMoreResult() }))
 }
+
+func TestJoinStringField(t *testing.T) {
+	results := []*segcorepb.RetrieveResults{
+		{ExplainAnalyze: "segment 1"},
+		nil,
+		{},
+		{ExplainAnalyze: "segment 2"},
+	}
+	assert.Equal(t, "segment 1\nsegment 2", joinStringField(results, func(r *segcorepb.RetrieveResults) string { return r.GetExplainAnalyze() }))
+	assert.Equal(t, "", joinStringField(nil, func(r *segcorepb.RetrieveResults) string { return r.GetExplainAnalyze() }))
+}
+
+func TestJoinStringFieldInternal(t *testing.T) {
+	results := []*internalpb.RetrieveResults{
+		{ExplainAnalyze: "node 1"},
+		nil,
+		{ExplainAnalyze: "node 2"},
+	}
+	assert.Equal(t, "node 1\nnode 2", joinStringFieldInternal(results, func(r *internalpb.RetrieveResults) string { return r.GetExplainAnalyze() }))
+}
+
+func TestJoinStringFieldSearch(t *testing.T) {
+	results := []*internalpb.SearchResults{
+		{ExplainAnalyze: "worker 1"},
+		nil,
+		{},
+		{ExplainAnalyze: "worker 2"},
+	}
+	assert.Equal(t, "worker 1\nworker 2", joinStringFieldSearch(results, func(r *internalpb.SearchResults) string { return r.GetExplainAnalyze() }))
+}
@@ -19,6 +19,7 @@
 package tasks
 
 import (
+	"io"
 	"strconv"
 
 	"github.com/apache/arrow/go/v17/arrow"
@@ -38,6 +39,43 @@ func dataFrameFromArrowRecordBatch(rec arrow.Record, chunkSizes []int64) (*chain
 	if rec == nil {
 		return nil, merr.WrapErrServiceInternal("nil Arrow record batch")
 	}
+	return dataFrameFromArrowRecordBatches(rec.Schema(), []arrow.Record{rec}, chunkSizes)
+}
+
+// arrowRecordStream is the part of segcore.SearchResultArrowStream a
+// DataFrame is imported from.
+type arrowRecordStream interface {
+	Schema() *arrow.Schema
+	ChunkSizes() []int64
+	Next() (arrow.Record, error)
+}
+
+// dataFrameFromArrowStream reads every record of stream into a DataFrame with
+// one chunk per logical NQ chunk. The records must hold whole chunks.
+func dataFrameFromArrowStream(stream arrowRecordStream) (*chain.DataFrame, error) {
+	var recs []arrow.Record
+	defer func() {
+		for _, rec := range recs {
+			rec.Release()
+		}
+	}()
+	for {
+		rec, err := stream.Next()
+		if err == io.EOF {
+			break
+		}
+		if err != nil {
+			return nil, err
+		}
+		recs = append(recs, rec)
+	}
+	return dataFrameFromArrowRecordBatches(stream.Schema(), recs, stream.ChunkSizes())
+}
+
+// dataFrameFromArrowRecordBatches slices the records, which share schema,
+// into a DataFrame with one chunk per entry of chunkSizes. A chunk may not
+// span two records.
+func dataFrameFromArrowRecordBatches(schema *arrow.Schema, recs []arrow.Record, chunkSizes []int64) (*chain.DataFrame, error) {
 	if len(chunkSizes) == 0 {
 		return nil, merr.WrapErrServiceInternal("empty Arrow RecordBatch chunk sizes")
 	}
@@ -49,19 +87,43 @@ func dataFrameFromArrowRecordBatch(rec arrow.Record, chunkSizes []int64) (*chain
 		}
 		totalRows += size
 	}
-	if totalRows != rec.NumRows() {
-		return nil, merr.WrapErrServiceInternalMsg("Arrow record batch row count %d does not match chunk sizes total %d", rec.NumRows(), totalRows)
+	var recRows int64
+	for _, rec := range recs {
+		recRows += rec.NumRows()
+	}
+	if totalRows != recRows {
+		return nil, merr.WrapErrServiceInternalMsg("Arrow record batch row count %d does not match chunk sizes total %d", recRows, totalRows)
+	}
+
+	// the record each chunk is sliced from, and the chunk's offset in it
+	chunkRecs := make([]int, len(chunkSizes))
+	chunkOffsets := make([]int64, len(chunkSizes))
+	recIdx := 0
+	var offset int64
+	for i, size := range chunkSizes {
+		for recIdx < len(recs) && offset+size > recs[recIdx].NumRows() {
+			if offset != recs[recIdx].NumRows() {
+				return nil, merr.WrapErrServiceInternalMsg("Arrow chunk %d spans the end of record batch %d", i, recIdx)
+			}
+			recIdx++
+			offset = 0
+		}
+		if recIdx == len(recs) {
+			return nil, merr.WrapErrServiceInternalMsg("no Arrow record batch holds chunk %d", i)
+		}
+		chunkRecs[i] = recIdx
+		chunkOffsets[i] = offset
+		offset += size
 	}
 
-	numCols := int(rec.NumCols())
+	numCols := schema.NumFields()
 	builder := chain.NewDataFrameBuilder()
 	defer builder.Release()
 	builder.SetChunkSizes(chunkSizes)
 
 	for colIdx := 0; colIdx < numCols; colIdx++ {
-		field := rec.Schema().Field(colIdx)
+		field := schema.Field(colIdx)
 		colName := field.Name
-		fullChunk := rec.Column(colIdx)
 		chunks := make([]arrow.Array, len(chunkSizes))
 		nullable := field.Nullable
 		releaseChunks := func() {
@@ -72,13 +134,12 @@ func dataFrameFromArrowRecordBatch(rec arrow.Record, chunkSizes []int64) (*chain
 			}
 		}
 
-		var offset int64
 		for i, size := range chunkSizes {
-			chunks[i] = array.NewSlice(fullChunk, offset, offset+size)
+			begin := chunkOffsets[i]
+			chunks[i] = array.NewSlice(recs[chunkRecs[i]].Column(colIdx), begin, begin+size)
 			if chunks[i].NullN() > 0 {
 				nullable = true
 			}
-			offset += size
 		}
 		builder.SetFieldNullable(colName, nullable)
 		if fieldID, ok, err := fieldMetadataInt64(field.Metadata, arrowMetadataFieldIDKey); err != nil {
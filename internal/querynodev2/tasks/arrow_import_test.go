@@ -19,6 +19,7 @@
 package tasks
 
 import (
+	"io"
 	"strconv"
 	"testing"
 
@@ -139,3 +140,72 @@ func TestDataFrameFromArrowRecordBatch_ReleasesRetainedChunksOnMetadataError(t *
 
 	rec.Release()
 }
+
+// fakeRecordStream serves records the way segcore.SearchResultArrowStream does.
+type fakeRecordStream struct {
+	schema     *arrow.Schema
+	recs       []arrow.Record
+	chunkSizes []int64
+}
+
+func (s *fakeRecordStream) Schema() *arrow.Schema {
+	return s.schema
+}
+
+func (s *fakeRecordStream) ChunkSizes() []int64 {
+	return s.chunkSizes
+}
+
+func (s *fakeRecordStream) Next() (arrow.Record, error) {
+	if len(s.recs) == 0 {
+		return nil, io.EOF
+	}
+	rec := s.recs[0]
+	s.recs = s.recs[1:]
+	return rec, nil
+}
+
+func TestDataFrameFromArrowStream_SlicesChunksAcrossRecords(t *testing.T) {
+	pool := memory.NewCheckedAllocator(memory.NewGoAllocator())
+	defer pool.AssertSize(t, 0)
+
+	schema := arrow.NewSchema([]arrow.Field{
+		{Name: "$seg_offset", Type: arrow.PrimitiveTypes.Int64},
+	}, nil)
+	makeRecord := func(values ...int64) arrow.Record {
+		builder := array.NewInt64Builder(pool)
+		builder.AppendValues(values, nil)
+		arr := builder.NewArray()
+		builder.Release()
+		defer arr.Release()
+		return array.NewRecord(schema, []arrow.Array{arr}, int64(arr.Len()))
+	}
+
+	stream := &fakeRecordStream{
+		schema:     schema,
+		recs:       []arrow.Record{makeRecord(1, 2, 3), makeRecord(4, 5)},
+		chunkSizes: []int64{2, 1, 0, 2},
+	}
+	df, err := dataFrameFromArrowStream(stream)
+	require.NoError(t, err)
+	defer df.Release()
+	assert.Equal(t, []int64{2, 1, 0, 2}, df.ChunkSizes())
+
+	col := df.Column("$seg_offset")
+	require.NotNil(t, col)
+	var values []int64
+	for i := 0; i < 4; i++ {
+		values = append(values, col.Chunk(i).(*array.Int64).Int64Values()...)
+	}
+	assert.Equal(t, []int64{1, 2, 3, 4, 5}, values)
+
+	// a chunk can't start in one record and end in the next
+	stream = &fakeRecordStream{
+		schema:     schema,
+		recs:       []arrow.Record{makeRecord(1, 2, 3), makeRecord(4, 5)},
+		chunkSizes: []int64{2, 2, 1},
+	}
+	_, err = dataFrameFromArrowStream(stream)
+	require.Error(t, err)
+	assert.Contains(t, err.Error(), "spans the end of record batch 0")
+}
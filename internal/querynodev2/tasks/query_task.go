@@ -157,7 +157,8 @@ func (t *QueryTask) Execute() error {
 		return err
 	}
 
-	relatedDataSize := lo.Reduce(querySegments, func(acc int64, seg segments.Segment, _ int) int64 {
+	// the results of a GROUP BY merged in segcore do not map to one segment
+	relatedDataSize := lo.Reduce(pinnedSegments, func(acc int64, seg segments.Segment, _ int) int64 {
 		return acc + segments.GetSegmentRelatedDataSize(seg)
 	}, 0)
 
@@ -178,6 +179,7 @@ func (t *QueryTask) Execute() error {
 		ScannedTotalBytes:  reducedResult.GetScannedTotalBytes(),
 		ElementLevel:       reducedResult.GetElementLevel(),
 		ElementIndices:     convertSegcoreElementIndicesToInternal(reducedResult.GetElementIndices()),
+		ExplainAnalyze:     reducedResult.GetExplainAnalyze(),
 	}
 	return nil
 }
@@ -262,6 +262,14 @@ func (t *SearchTask) Execute() error {
 	// measured the reduce metric off tr.
 	reduceTR := timerecord.NewTimeRecorder("reduce")
 
+	if t.useNativeReduce() {
+		if err := t.executeNativeReduce(results, searchReq, metricType, tr, relatedDataSize); err != nil {
+			return err
+		}
+		t.observeReduceLatency(reduceTR)
+		return nil
+	}
+
 	// Mutates results in place; must run before Arrow export.
 	allSearchCount, err := segcore.PrepareSearchResultsForExport(
 		t.ctx,
@@ -298,16 +306,21 @@ func (t *SearchTask) Execute() error {
 		return err
 	}
 
-	// Reduce metric covers the full Go-reduce pipeline (Arrow export +
-	// heap merge + Late Materialization + proto marshal), aligned with the
-	// legacy C++ reduce-and-fill boundary so A/B comparisons are meaningful.
+	t.observeReduceLatency(reduceTR)
+	return nil
+}
+
+// observeReduceLatency records the reduce metric. It covers the full reduce
+// pipeline (Arrow export + heap merge + Late Materialization + proto marshal
+// for the Go reduce, the single native call otherwise), aligned with the
+// legacy C++ reduce-and-fill boundary so A/B comparisons are meaningful.
+func (t *SearchTask) observeReduceLatency(reduceTR *timerecord.TimeRecorder) {
 	metrics.QueryNodeReduceLatency.WithLabelValues(
 		fmt.Sprint(t.GetNodeID()),
 		metrics.SearchLabel,
 		metrics.ReduceSegments,
 		metrics.BatchReduce).
 		Observe(float64(reduceTR.RecordSpan().Microseconds()) / 1000.0)
-	return nil
 }
 
 func emptySearchResultData(nq, topK int64) *schemapb.SearchResultData {
@@ -21,6 +21,7 @@ package tasks
 import (
 	"context"
 	"fmt"
+	"strings"
 
 	"github.com/apache/arrow/go/v17/arrow"
 	"github.com/apache/arrow/go/v17/arrow/array"
@@ -35,11 +36,12 @@ import (
 	"github.com/milvus-io/milvus/pkg/v3/mlog"
 	"github.com/milvus-io/milvus/pkg/v3/proto/internalpb"
 	"github.com/milvus-io/milvus/pkg/v3/util/merr"
+	"github.com/milvus-io/milvus/pkg/v3/util/paramtable"
 	"github.com/milvus-io/milvus/pkg/v3/util/timerecord"
 )
 
 // exportSearchResultsAsArrow exports per-segment SearchResults as Arrow DataFrames
-// via the Arrow C Stream Interface (one RecordBatch per NQ).
+// via the Arrow C Stream Interface (each RecordBatch holds whole NQ chunks).
 // Each DataFrame contains $id, $score, $seg_offset columns, optional $group_by
 // and $element_indices columns, plus any extra fields, with one chunk per NQ
 // query. Arrow field metadata is preserved so group-by and extra fields keep
@@ -63,14 +65,7 @@ func (t *SearchTask) exportSearchResultsAsArrow(
 	}()
 
 	exportOne := func(ctx context.Context, idx int, result *segments.SearchResult) error {
-		record, chunkSizes, err := segcore.ExportSearchResultAsArrowRecordBatch(ctx, result, plan, extraFieldIDs)
-		if err != nil {
-			mlog.Warn(ctx, "failed to export search result as Arrow", mlog.Err(err))
-			return err
-		}
-		defer record.Release()
-
-		df, err := dataFrameFromArrowRecordBatch(record, chunkSizes)
+		df, err := exportSearchResultAsDataFrame(ctx, result, plan, extraFieldIDs)
 		if err != nil {
 			return err
 		}
@@ -99,6 +94,30 @@ func (t *SearchTask) exportSearchResultsAsArrow(
 	return segDFs, nil
 }
 
+// exportSearchResultAsDataFrame streams one per-segment SearchResult out of
+// C++ as Arrow RecordBatches of whole NQ chunks, so C++ only materializes the
+// extra fields of one batch at a time, and imports them as a DataFrame.
+func exportSearchResultAsDataFrame(
+	ctx context.Context,
+	result *segments.SearchResult,
+	plan *segcore.SearchPlan,
+	extraFieldIDs []int64,
+) (*chain.DataFrame, error) {
+	stream, err := segcore.ExportSearchResultAsArrowStream(ctx, result, plan, extraFieldIDs)
+	if err != nil {
+		mlog.Warn(ctx, "failed to export search result as Arrow", mlog.Err(err))
+		return nil, err
+	}
+	defer stream.Release()
+
+	df, err := dataFrameFromArrowStream(stream)
+	if err != nil {
+		mlog.Warn(ctx, "failed to read search result Arrow stream", mlog.Err(err))
+		return nil, err
+	}
+	return df, nil
+}
+
 // executeGoReduce performs the search reduce pipeline entirely in Go:
 //  1. heapMergeReduce (k-way merge with PK dedup, optionally GroupBy-aware)
 //  2. Late Materialization (read output fields from segments)
@@ -153,6 +172,7 @@ func (t *SearchTask) executeGoReduce(
 	}
 
 	t.attributeStorageCost(results)
+	t.attachExplainAnalyze(results)
 	return nil
 }
 
@@ -191,6 +211,7 @@ func (t *SearchTask) executeGoReduceFastPath(
 	}
 
 	t.attributeStorageCost(results)
+	t.attachExplainAnalyze(results)
 	return nil
 }
 
@@ -253,6 +274,25 @@ func (t *SearchTask) attributeStorageCost(results []*segments.SearchResult) {
 	}
 }
 
+// attachExplainAnalyze hands the EXPLAIN ANALYZE trees of the searched
+// segments, one per line, to every sub-task: they all searched the same
+// segments.
+func (t *SearchTask) attachExplainAnalyze(results []*segments.SearchResult) {
+	trees := make([]string, 0, len(results))
+	for _, r := range results {
+		if tree := r.ExplainAnalyze(); tree != "" {
+			trees = append(trees, tree)
+		}
+	}
+	if len(trees) == 0 {
+		return
+	}
+	explainAnalyze := strings.Join(trees, "\n")
+	for i := range t.originNqs {
+		t.subTaskAt(i).result.ExplainAnalyze = explainAnalyze
+	}
+}
+
 func (t *SearchTask) buildReducedResult(
 	i int,
 	reduceResult *mergeResult,
@@ -279,7 +319,18 @@ func (t *SearchTask) buildReducedResult(
 	if err := lateMaterializeOutputFields(t.ctx, results, plan, reduceResult.Sources, searchResultData); err != nil {
 		return err
 	}
+	return t.setSliceResult(i, searchResultData, metricType, tr, relatedDataSize)
+}
 
+// setSliceResult encodes the reduced SearchResultData of the i-th sub-task
+// and assigns it to that task.
+func (t *SearchTask) setSliceResult(
+	i int,
+	searchResultData *schemapb.SearchResultData,
+	metricType string,
+	tr *timerecord.TimeRecorder,
+	relatedDataSize int64,
+) error {
 	searchResults, err := segments.EncodeSearchResultData(t.ctx, searchResultData, t.originNqs[i], t.originTopks[i], metricType)
 	if err != nil {
 		return err
@@ -328,7 +379,9 @@ func (t *SearchTask) buildSlicedResult(
 
 // lateMaterializeOutputFields reads output fields from C++ segments in a single
 // CGO call and assembles them into the final SearchResultData. C++ does the
-// per-segment FillTargetEntry + MergeDataArray scatter + serialize.
+// per-segment FillTargetEntry + MergeDataArray scatter + serialize, or hands
+// the fields over as Arrow columns when queryNode.search.enableArrowOutputFields
+// is set and every output field has an Arrow form.
 func lateMaterializeOutputFields(
 	ctx context.Context,
 	results []*segments.SearchResult,
@@ -352,6 +405,17 @@ func lateMaterializeOutputFields(
 		}
 	}
 
+	if paramtable.Get().QueryNodeCfg.EnableArrowOutputFields.GetAsBool() {
+		fieldsData, ok, err := materializeOutputFieldsAsArrow(ctx, results, plan, segIndices, segOffsets)
+		if err != nil {
+			return err
+		}
+		if ok {
+			searchResultData.FieldsData = fieldsData
+			return nil
+		}
+	}
+
 	protoBytes, err := segcore.FillOutputFieldsOrdered(ctx, results, plan, segIndices, segOffsets)
 	if err != nil {
 		return err
@@ -368,6 +432,48 @@ func lateMaterializeOutputFields(
 	return nil
 }
 
+// materializeOutputFieldsAsArrow reads the output fields as one Arrow record
+// and converts its columns into FieldData, skipping the proto round trip of
+// FillOutputFieldsOrdered. It returns false when some output field has no
+// Arrow form and the proto has to be used.
+func materializeOutputFieldsAsArrow(
+	ctx context.Context,
+	results []*segments.SearchResult,
+	plan *segcore.SearchPlan,
+	segIndices []int32,
+	segOffsets []int64,
+) ([]*schemapb.FieldData, bool, error) {
+	rec, ok, err := segcore.FillOutputFieldsOrderedAsArrow(ctx, results, plan, segIndices, segOffsets)
+	if err != nil || !ok {
+		return nil, ok, err
+	}
+	defer rec.Release()
+	if rec.NumCols() == 0 {
+		return nil, true, nil
+	}
+
+	df, err := dataFrameFromArrowRecordBatch(rec, []int64{rec.NumRows()})
+	if err != nil {
+		return nil, false, err
+	}
+	defer df.Release()
+	data, err := chain.ToSearchResultData(df)
+	if err != nil {
+		return nil, false, err
+	}
+	// the proto carries the validity of a nullable field even when no row is
+	// null, the DataFrame export drops it then
+	for i, fieldData := range data.FieldsData {
+		if rec.Schema().Field(i).Nullable && fieldData.ValidData == nil {
+			fieldData.ValidData = make([]bool, rec.NumRows())
+			for j := range fieldData.ValidData {
+				fieldData.ValidData[j] = true
+			}
+		}
+	}
+	return data.FieldsData, true, nil
+}
+
 // extractSlice extracts a sub-range of NQ chunks from a mergeResult and
 // enforces the per-slice row limit: each NQ chunk is truncated to at most
 // maxRowsPerNQ rows. It is valid for standard topK and for group-by with
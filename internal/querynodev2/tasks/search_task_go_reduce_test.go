@@ -121,12 +121,14 @@ func TestExportSearchResultsAsArrowReleasesCompletedDataFramesOnMultiSegmentErro
 		return record
 	}
 
-	mocker := mockey.Mock(segcore.ExportSearchResultAsArrowRecordBatch).To(
-		func(ctx context.Context, result *segcore.SearchResult, plan *segcore.SearchPlan, extraFieldIDs []int64) (arrow.Record, []int64, error) {
+	mocker := mockey.Mock(exportSearchResultAsDataFrame).To(
+		func(ctx context.Context, result *segcore.SearchResult, plan *segcore.SearchPlan, extraFieldIDs []int64) (*chain.DataFrame, error) {
 			if result == failResult {
-				return nil, nil, injectedErr
+				return nil, injectedErr
 			}
-			return makeRecord(), []int64{2}, nil
+			record := makeRecord()
+			defer record.Release()
+			return dataFrameFromArrowRecordBatch(record, []int64{2})
 		},
 	).Build()
 	defer mocker.UnPatch()
@@ -317,11 +319,7 @@ func runGoReducePipeline(t *testing.T, ts *testSegments) (*mergeResult, []*chain
 
 	segDFs := make([]*chain.DataFrame, 0, len(ts.searchResults))
 	for _, res := range ts.searchResults {
-		record, chunkSizes, err := segcore.ExportSearchResultAsArrowRecordBatch(context.Background(), res, plan, nil)
-		require.NoError(t, err)
-		defer record.Release()
-
-		df, err := dataFrameFromArrowRecordBatch(record, chunkSizes)
+		df, err := exportSearchResultAsDataFrame(context.Background(), res, plan, nil)
 		require.NoError(t, err)
 		segDFs = append(segDFs, df)
 	}
@@ -460,6 +458,45 @@ func TestLateMaterializeOutputFields(t *testing.T) {
 	t.Logf("Late Mat OK: %d output fields, %d total rows", len(searchResultData.FieldsData), totalRows)
 }
 
+func TestLateMaterializeOutputFields_Arrow(t *testing.T) {
+	// 103=Int32, 104=Float have an Arrow form
+	outputFieldIDs := []int64{103, 104}
+	ts := setupTestSegments(t, 2, 2000, setupOpts{NQ: 2, TopK: 10, OutputFieldIDs: outputFieldIDs})
+	defer ts.cleanup()
+
+	reduceResult, segDFs := runGoReducePipeline(t, ts)
+	defer func() {
+		reduceResult.DF.Release()
+		for _, df := range segDFs {
+			df.Release()
+		}
+	}()
+	plan := ts.searchReq.Plan()
+
+	protoData, err := marshalReduceResult(reduceResult)
+	require.NoError(t, err)
+	require.NoError(t, lateMaterializeOutputFields(context.Background(), ts.searchResults, plan, reduceResult.Sources, protoData))
+
+	key := paramtable.Get().QueryNodeCfg.EnableArrowOutputFields.Key
+	original := paramtable.Get().QueryNodeCfg.EnableArrowOutputFields.GetValue()
+	defer paramtable.Get().Save(key, original)
+	paramtable.Get().Save(key, "true")
+
+	arrowData, err := marshalReduceResult(reduceResult)
+	require.NoError(t, err)
+	require.NoError(t, lateMaterializeOutputFields(context.Background(), ts.searchResults, plan, reduceResult.Sources, arrowData))
+
+	require.Len(t, arrowData.FieldsData, len(protoData.FieldsData))
+	for i, fd := range arrowData.FieldsData {
+		expected := protoData.FieldsData[i]
+		assert.Equal(t, expected.GetFieldId(), fd.GetFieldId())
+		assert.Equal(t, expected.GetType(), fd.GetType())
+		assert.Equal(t, expected.GetFieldName(), fd.GetFieldName())
+		assert.True(t, proto.Equal(expected.GetScalars(), fd.GetScalars()),
+			"field %d differs from the proto path", fd.GetFieldId())
+	}
+}
+
 func TestLateMaterializeOutputFields_NoOutputFields(t *testing.T) {
 	// No output fields in the plan
 	ts := setupTestSegments(t, 2, 2000, setupOpts{NQ: 1, TopK: 5})
@@ -1193,6 +1230,70 @@ func TestExecuteGoReduceHonorsEnableResultZeroCopy(t *testing.T) {
 	assert.Equal(t, allSearchCount, res.ResultData.GetAllSearchCount())
 }
 
+func TestExecuteNativeReduce(t *testing.T) {
+	const (
+		numSegments = 3
+		msgLength   = 200
+		nq          = 2
+		topK        = 5
+	)
+
+	zeroCopyKey := paramtable.Get().QueryNodeCfg.EnableResultZeroCopy.Key
+	originalZeroCopy := paramtable.Get().QueryNodeCfg.EnableResultZeroCopy.GetValue()
+	defer paramtable.Get().Save(zeroCopyKey, originalZeroCopy)
+	paramtable.Get().Save(zeroCopyKey, "true")
+
+	ts := setupTestSegments(t, numSegments, msgLength, setupOpts{
+		NQ:   nq,
+		TopK: topK,
+	})
+	defer ts.cleanup()
+
+	ctx := context.Background()
+	queryReq, err := mock_segcore.GenQueryRequest(
+		ts.collection.GetCCollection(), ts.segIDs, nq, topK, testCollectionID)
+	require.NoError(t, err)
+	task := NewSearchTask(ctx, ts.collection, ts.manager, queryReq, 1)
+
+	nativeKey := paramtable.Get().QueryNodeCfg.EnableNativeReduce.Key
+	originalNative := paramtable.Get().QueryNodeCfg.EnableNativeReduce.GetValue()
+	defer paramtable.Get().Save(nativeKey, originalNative)
+	paramtable.Get().Save(nativeKey, "false")
+	assert.False(t, task.useNativeReduce())
+	paramtable.Get().Save(nativeKey, "true")
+	assert.True(t, task.useNativeReduce())
+
+	tr := timerecord.NewTimeRecorder("native-reduce-test")
+	require.NoError(t, task.executeNativeReduce(ts.searchResults, ts.searchReq, "IP", tr, 0))
+
+	res := task.SearchResult()
+	require.NotNil(t, res)
+	require.NotNil(t, res.ResultData)
+	data := res.ResultData
+	assert.Equal(t, int64(nq), data.NumQueries)
+	assert.Equal(t, int64(topK), data.TopK)
+	assert.Positive(t, data.GetAllSearchCount())
+	require.Len(t, data.Topks, nq)
+
+	ids := data.GetIds().GetIntId().GetData()
+	offset := 0
+	for _, n := range data.Topks {
+		require.LessOrEqual(t, n, int64(topK))
+		seen := make(map[int64]struct{}, n)
+		for j := offset; j < offset+int(n); j++ {
+			_, dup := seen[ids[j]]
+			assert.False(t, dup, "duplicate pk %d", ids[j])
+			seen[ids[j]] = struct{}{}
+			if j > offset {
+				assert.GreaterOrEqual(t, data.Scores[j-1], data.Scores[j])
+			}
+		}
+		offset += int(n)
+	}
+	assert.Len(t, ids, offset)
+	assert.Len(t, data.Scores, offset)
+}
+
 // TestExecuteNullableVectorOutput regression-tests the MergeBase physical
 // offset handling in FillOutputFieldsOrdered. When a nullable vector field is
 // in the output set, FillTargetEntry compacts the vector buffer (null rows
@@ -0,0 +1,79 @@
+/*
+ * Licensed to the LF AI & Data foundation under one
+ * or more contributor license agreements. See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership. The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package tasks
+
+import (
+	"github.com/milvus-io/milvus/internal/querynodev2/segments"
+	"github.com/milvus-io/milvus/internal/util/segcore"
+	"github.com/milvus-io/milvus/pkg/v3/mlog"
+	"github.com/milvus-io/milvus/pkg/v3/util/paramtable"
+	"github.com/milvus-io/milvus/pkg/v3/util/timerecord"
+)
+
+// useNativeReduce reports whether the reduce of this task runs entirely in
+// C++ (queryNode.search.enableNativeReduce). The native reduce merges the
+// segment scores as they are, so group-by searches and searches with boost
+// scorers keep the Go pipeline.
+func (t *SearchTask) useNativeReduce() bool {
+	if !paramtable.Get().QueryNodeCfg.EnableNativeReduce.GetAsBool() {
+		return false
+	}
+	plan, err := extractPlanWithScorers(t.req.GetReq().GetSerializedExprPlan())
+	if err != nil || plan == nil {
+		return false
+	}
+	queryInfo := plan.GetVectorAnns().GetQueryInfo()
+	if queryInfo.GetGroupByFieldId() > 0 || len(queryInfo.GetGroupByFieldIds()) > 0 {
+		return false
+	}
+	return len(plan.GetScorers()) == 0
+}
+
+// executeNativeReduce reduces the per-segment SearchResults and fills their
+// output fields in a single CGO call, instead of exporting them as Arrow,
+// merging them in Go and calling back into C++ for Late Materialization.
+func (t *SearchTask) executeNativeReduce(
+	results []*segments.SearchResult,
+	searchReq *segcore.SearchRequest,
+	metricType string,
+	tr *timerecord.TimeRecorder,
+	relatedDataSize int64,
+) error {
+	resultData, allSearchCount, err := segcore.ReduceSearchResultsAndFillData(
+		t.ctx,
+		searchReq.Plan(),
+		searchReq.PlaceholderGroup(),
+		results,
+		t.originNqs,
+		t.originTopks,
+	)
+	if err != nil {
+		mlog.Warn(t.ctx, "failed to reduce search results natively", mlog.Err(err))
+		return err
+	}
+	for i, searchResultData := range resultData {
+		searchResultData.AllSearchCount = allSearchCount
+		if err := t.setSliceResult(i, searchResultData, metricType, tr, relatedDataSize); err != nil {
+			return err
+		}
+	}
+	t.attributeStorageCost(results)
+	t.attachExplainAnalyze(results)
+	return nil
+}
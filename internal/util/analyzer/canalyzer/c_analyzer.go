@@ -15,7 +15,10 @@ import (
 	_ "github.com/milvus-io/milvus/internal/util/cgo"
 )
 
-var _ interfaces.Analyzer = (*CAnalyzer)(nil)
+var (
+	_ interfaces.Analyzer       = (*CAnalyzer)(nil)
+	_ interfaces.BatchTokenizer = (*CAnalyzer)(nil)
+)
 
 type CAnalyzer struct {
 	ptr C.CTokenizer
@@ -34,6 +37,47 @@ func (impl *CAnalyzer) NewTokenStream(text string) interfaces.TokenStream {
 	return NewCTokenStream(ptr)
 }
 
+// BatchTokenize tokenizes all texts with a single cgo call.
+func (impl *CAnalyzer) BatchTokenize(texts []string, fn func(i int, token string)) error {
+	if len(texts) == 0 {
+		return nil
+	}
+	size := 0
+	for _, text := range texts {
+		size += len(text)
+	}
+	// one spare byte keeps the buffer non nil when every text is empty
+	data := make([]byte, 0, size+1)
+	offsets := make([]uint32, len(texts)+1)
+	for i, text := range texts {
+		data = append(data, text...)
+		offsets[i+1] = uint32(len(data))
+	}
+
+	var batch C.CTokenBatch
+	status := C.tokenize_batch(impl.ptr,
+		(*C.char)(unsafe.Pointer(unsafe.SliceData(data))),
+		(*C.uint32_t)(unsafe.Pointer(&offsets[0])),
+		(C.uint32_t)(len(texts)),
+		&batch)
+	if err := HandleCStatus(&status, "failed to tokenize batch"); err != nil {
+		return err
+	}
+	defer C.free_token_batch(batch)
+
+	tokenOffsets := unsafe.Slice((*uint32)(unsafe.Pointer(batch.token_offsets)), int(batch.num_tokens)+1)
+	counts := unsafe.Slice((*uint32)(unsafe.Pointer(batch.token_counts)), len(texts))
+	token := 0
+	for i, count := range counts {
+		for j := uint32(0); j < count; j++ {
+			start, end := tokenOffsets[token], tokenOffsets[token+1]
+			fn(i, unsafe.String((*byte)(unsafe.Add(unsafe.Pointer(batch.data), start)), int(end-start)))
+			token++
+		}
+	}
+	return nil
+}
+
 func (impl *CAnalyzer) Clone() (interfaces.Analyzer, error) {
 	var newptr C.CTokenizer
 	status := C.clone_tokenizer(&impl.ptr, &newptr)
@@ -16,3 +16,11 @@ type Analyzer interface {
 	Clone() (Analyzer, error)
 	Destroy()
 }
+
+// BatchTokenizer is implemented by analyzers that can tokenize many texts
+// in one call instead of one token stream per text.
+type BatchTokenizer interface {
+	// BatchTokenize calls fn with the index of the text and each of its
+	// tokens, in order. The token is only valid during the call.
+	BatchTokenize(texts []string, fn func(i int, token string)) error
+}
@@ -27,6 +27,7 @@ import (
 	"github.com/milvus-io/milvus-proto/go-api/v3/milvuspb"
 	"github.com/milvus-io/milvus-proto/go-api/v3/schemapb"
 	"github.com/milvus-io/milvus/internal/util/analyzer"
+	"github.com/milvus-io/milvus/internal/util/analyzer/interfaces"
 	"github.com/milvus-io/milvus/pkg/v3/config"
 	"github.com/milvus-io/milvus/pkg/v3/mlog"
 	"github.com/milvus-io/milvus/pkg/v3/util/conc"
@@ -178,6 +179,10 @@ func (v *BM25FunctionRunner) run(data []string, dst []map[uint32]float32) error
 	}
 	defer tokenizer.Destroy()
 
+	if batch, ok := tokenizer.(interfaces.BatchTokenizer); ok {
+		return runBatch(batch, data, dst)
+	}
+
 	for i := 0; i < len(data); i++ {
 		if len(data[i]) == 0 {
 			dst[i] = map[uint32]float32{}
@@ -201,6 +206,20 @@ func (v *BM25FunctionRunner) run(data []string, dst []map[uint32]float32) error
 	return nil
 }
 
+// runBatch is run for analyzers tokenizing the whole batch in one call.
+func runBatch(tokenizer interfaces.BatchTokenizer, data []string, dst []map[uint32]float32) error {
+	for i := range data {
+		if !typeutil.IsUTF8(data[i]) {
+			return merr.WrapErrParameterInvalidMsg("string data must be utf8 format: %v", data[i])
+		}
+		dst[i] = map[uint32]float32{}
+	}
+	return tokenizer.BatchTokenize(data, func(i int, token string) {
+		// TODO More Hash Option
+		dst[i][typeutil.HashString2LessUint32(token)] += 1
+	})
+}
+
 func (v *BM25FunctionRunner) BatchRun(inputs ...any) ([]any, error) {
 	v.mu.RLock()
 	defer v.mu.RUnlock()
@@ -302,42 +302,6 @@ func ValidateMinHashFunction(collSchema *schemapb.CollectionSchema, funSchema *s
 	return nil
 }
 
-func (m *MinHashFunctionRunner) run(data []string, dst [][]byte) error {
-	// Clone the appropriate tokenizer based on mode
-	var wordTokenizer analyzer.Analyzer
-	var err error
-
-	if !m.useCharToken {
-		// Word-level mode: use word tokenizer
-		wordTokenizer, err = m.tokenizer.Clone()
-		if err != nil {
-			return err
-		}
-		defer wordTokenizer.Destroy()
-	}
-
-	// Phase 1 & 2: Generate hashes and compute MinHash signatures
-	var allSignatures [][]uint32
-	// Everything happens in C++ to eliminate ALL CGO overhead:
-	// - Tokenization/character processing in C++
-	// - Shingle generation in C++
-	// - Base hash computation in C++
-	// - MinHash signature computation with rotation-based SIMD in C++
-
-	var tokenizerPtr unsafe.Pointer
-	if !m.useCharToken {
-		// Word-level: get C tokenizer pointer
-		tokenizerPtr = getTokenizerPtr(wordTokenizer)
-	}
-	// Char-level: tokenizerPtr is nil, C++ will process characters directly
-	allSignatures = m.batchComputeMinHashFromTexts(data, tokenizerPtr)
-
-	// Phase 3: Batch convert to binary vectors
-	batchSignatureToBinaryVector(allSignatures, dst)
-
-	return nil
-}
-
 func (m *MinHashFunctionRunner) BatchRun(inputs ...any) ([]any, error) {
 	m.mu.RLock()
 	defer m.mu.RUnlock()
@@ -355,44 +319,25 @@ func (m *MinHashFunctionRunner) BatchRun(inputs ...any) ([]any, error) {
 		return nil, merr.WrapErrParameterInvalidMsg("MinHash function input not string list")
 	}
 
-	rowNum := len(text)
-	signatures := make([][]byte, rowNum)
-
-	concurrency := 8
-	if rowNum < concurrency {
-		concurrency = rowNum
-	}
-	wg := sync.WaitGroup{}
-	errCh := make(chan error, concurrency)
-
-	for i, j := 0, 0; i < concurrency && j < rowNum; i++ {
-		start := j
-		end := start + rowNum/concurrency
-		if i < rowNum%concurrency {
-			end += 1
-		}
-
-		wg.Add(1)
-		go func() {
-			defer wg.Done()
-			err := m.run(text[start:end], signatures[start:end])
-			if err != nil {
-				errCh <- err
-			}
-		}()
-		j = end
-	}
-
-	wg.Wait()
-	close(errCh)
-
-	for err := range errCh {
+	// Char-level: tokenizerPtr is nil, C++ will process characters directly
+	var tokenizerPtr unsafe.Pointer
+	if !m.useCharToken {
+		// Word-level mode: the C++ workers clone this tokenizer again
+		wordTokenizer, err := m.tokenizer.Clone()
 		if err != nil {
 			return nil, err
 		}
+		defer wordTokenizer.Destroy()
+		tokenizerPtr = getTokenizerPtr(wordTokenizer)
 	}
 
-	return []any{buildBinaryVectorFieldData(signatures)}, nil
+	// Tokenization, shingling, hashing and the SIMD signature computation all
+	// run in C++ across its thread pool, writing the binary vectors in place
+	vectors, err := m.computeBinaryVectors(text, tokenizerPtr)
+	if err != nil {
+		return nil, err
+	}
+	return []any{buildBinaryVectorFieldData(vectors, int64(m.numHashes*32))}, nil
 }
 
 func (v *MinHashFunctionRunner) GetSchema() *schemapb.FunctionSchema {
@@ -419,66 +364,42 @@ func (m *MinHashFunctionRunner) Close() {
 	}
 }
 
-func (m *MinHashFunctionRunner) batchComputeMinHashFromTexts(texts []string, tokenizerPtr unsafe.Pointer) [][]uint32 {
+func (m *MinHashFunctionRunner) computeBinaryVectors(texts []string, tokenizerPtr unsafe.Pointer) ([]byte, error) {
+	vectors := make([]byte, len(texts)*m.numHashes*4)
 	if len(texts) == 0 {
-		return nil
+		return vectors, nil
 	}
 
-	// Prepare text data - calculate total bytes needed
-	totalBytes := 0
+	size := 0
 	for _, text := range texts {
-		totalBytes += len(text)
+		size += len(text)
 	}
-
-	// Allocate buffer for all texts
-	cBuffer := C.malloc(C.size_t(totalBytes))
-	defer C.free(cBuffer)
-
-	// Prepare pointer and length arrays
-	cTexts := make([]unsafe.Pointer, len(texts))
-	textLengths := make([]int32, len(texts))
-
-	// Copy texts into buffer
-	cBufferSlice := unsafe.Slice((*byte)(cBuffer), totalBytes)
-	bufferOffset := 0
+	// one spare byte keeps the buffer non nil when every text is empty
+	data := make([]byte, 0, size+1)
+	offsets := make([]int64, len(texts)+1)
 	for i, text := range texts {
-		textLen := len(text)
-		if textLen > 0 {
-			copy(cBufferSlice[bufferOffset:bufferOffset+textLen], text)
-			cTexts[i] = unsafe.Pointer(&cBufferSlice[bufferOffset])
-		} else {
-			cTexts[i] = nil
-		}
-		textLengths[i] = int32(textLen)
-		bufferOffset += textLen
+		data = append(data, text...)
+		offsets[i+1] = int64(len(data))
 	}
 
-	// Allocate output buffer (flattened)
-	flatSignatures := make([]uint32, len(texts)*m.numHashes)
-
-	// Call C++ end-to-end implementation
-	C.ComputeMinHashFromTexts(
-		(**C.char)(unsafe.Pointer(&cTexts[0])),
-		(*C.int32_t)(unsafe.Pointer(&textLengths[0])),
-		C.int32_t(len(texts)),
+	status := C.ComputeMinHashBinaryVectors(
+		(*C.char)(unsafe.Pointer(unsafe.SliceData(data))),
+		(*C.int64_t)(unsafe.Pointer(&offsets[0])),
+		C.int64_t(len(texts)),
 		tokenizerPtr,
 		C.int32_t(m.shingleSize),
 		(*C.uint64_t)(unsafe.Pointer(&m.permA[0])),
 		(*C.uint64_t)(unsafe.Pointer(&m.permB[0])),
-		C.int32_t(m.hashFunc),
+		C.int(m.hashFunc),
 		C.int32_t(m.numHashes),
-		(*C.uint32_t)(unsafe.Pointer(&flatSignatures[0])),
+		(*C.uint8_t)(unsafe.Pointer(&vectors[0])),
 	)
-
-	// Convert flattened output to [][]uint32 using slicing (zero-copy view)
-	signatures := make([][]uint32, len(texts))
-	for i := 0; i < len(texts); i++ {
-		start := i * m.numHashes
-		end := start + m.numHashes
-		signatures[i] = flatSignatures[start:end]
+	if status.error_code != 0 {
+		errorMsg := C.GoString(status.error_msg)
+		C.free(unsafe.Pointer(status.error_msg))
+		return nil, merr.SegcoreError(int32(status.error_code), errorMsg)
 	}
-
-	return signatures
+	return vectors, nil
 }
 
 // helper function to get analyzer params
@@ -527,58 +448,14 @@ func signatureToBinaryVector(signature []uint32) []byte {
 	return result
 }
 
-// batchSignatureToBinaryVector converts multiple signatures to binary vectors in batch
-// This improves cache locality and reduces function call overhead
-func batchSignatureToBinaryVector(signatures [][]uint32, dst [][]byte) {
-	if len(signatures) == 0 {
-		return
-	}
-
-	signatureByteLen := len(signatures[0]) * 4
-
-	for batchIdx := 0; batchIdx < len(signatures); batchIdx++ {
-		signature := signatures[batchIdx]
-		result := make([]byte, signatureByteLen)
-
-		i := 0
-
-		for ; i+4 <= len(signature); i += 4 {
-			offset := i * 4
-			binary.LittleEndian.PutUint32(result[offset:], signature[i])
-			binary.LittleEndian.PutUint32(result[offset+4:], signature[i+1])
-			binary.LittleEndian.PutUint32(result[offset+8:], signature[i+2])
-			binary.LittleEndian.PutUint32(result[offset+12:], signature[i+3])
-		}
-
-		// Handle remaining elements
-		for ; i < len(signature); i++ {
-			offset := i * 4
-			binary.LittleEndian.PutUint32(result[offset:], signature[i])
-		}
-
-		dst[batchIdx] = result
-	}
-}
-
-func buildBinaryVectorFieldData(signatures [][]byte) *schemapb.FieldData {
-	var dim int64
-	var flatData []byte
-
-	if len(signatures) > 0 {
-		dim = int64(len(signatures[0]) * 8)
-		flatData = make([]byte, 0, len(signatures)*len(signatures[0]))
-		for _, sig := range signatures {
-			flatData = append(flatData, sig...)
-		}
-	}
-
+func buildBinaryVectorFieldData(vectors []byte, dim int64) *schemapb.FieldData {
 	return &schemapb.FieldData{
 		Type: schemapb.DataType_BinaryVector,
 		Field: &schemapb.FieldData_Vectors{
 			Vectors: &schemapb.VectorField{
 				Dim: dim,
 				Data: &schemapb.VectorField_BinaryVector{
-					BinaryVector: flatData,
+					BinaryVector: vectors,
 				},
 			},
 		},
@@ -507,6 +507,35 @@ func InitArrowReaderConfig(params *paramtable.ComponentParam) error {
 	return HandleCStatus(&status, "InitArrowReaderConfig failed")
 }
 
+func InitRemoteReadConfig(params *paramtable.ComponentParam) error {
+	remoteReadConfig := C.CRemoteReadConfig{
+		nr_threads:             C.int(params.CommonCfg.RemoteReadNumThreads.GetAsInt()),
+		min_part_size_bytes:    C.int64_t(params.CommonCfg.RemoteReadMinPartSizeKb.GetAsInt64() * 1024),
+		max_part_size_bytes:    C.int64_t(params.CommonCfg.RemoteReadMaxPartSizeKb.GetAsInt64() * 1024),
+		hedge_ratio:            C.double(params.CommonCfg.RemoteReadHedgeRatio.GetAsFloat()),
+		small_object_threads:   C.int(params.CommonCfg.RemoteReadSmallObjectNumThreads.GetAsInt()),
+		small_object_max_bytes: C.int64_t(params.CommonCfg.RemoteReadSmallObjectMaxSizeKb.GetAsInt64() * 1024),
+	}
+	status := C.InitRemoteReadConfig(remoteReadConfig)
+	return HandleCStatus(&status, "InitRemoteReadConfig failed")
+}
+
+func InitLocalObjectCache(params *paramtable.ComponentParam) error {
+	cPath := C.CString(pathutil.GetPath(pathutil.ObjectCachePath, 0))
+	defer C.free(unsafe.Pointer(cPath))
+	cCapacity := C.int64_t(params.QueryNodeCfg.LocalObjectCacheCapacityMb.GetAsInt64() * 1024 * 1024)
+	status := C.InitLocalObjectCache(cPath, cCapacity)
+	return HandleCStatus(&status, "InitLocalObjectCache failed")
+}
+
+func InitWarmupProfile(params *paramtable.ComponentParam) error {
+	cPath := C.CString(pathutil.GetPath(pathutil.WarmupProfilePath, 0))
+	defer C.free(unsafe.Pointer(cPath))
+	cWindow := C.int64_t(params.QueryNodeCfg.WarmupProfileWindowHours.GetAsInt64() * 3600)
+	status := C.SegcoreInitWarmupProfile(cPath, cWindow)
+	return HandleCStatus(&status, "InitWarmupProfile failed")
+}
+
 var coreParamCallbackInitOnce sync.Once
 
 func SetupCoreConfigChangelCallback() {
@@ -706,6 +735,9 @@ func InitInterminIndexConfig(params *paramtable.ComponentParam) error {
 	memExpansionRate := C.float(params.QueryNodeCfg.InterimIndexMemExpandRate.GetAsFloat())
 	C.SegcoreSetInterimIndexMemExpansionRate(memExpansionRate)
 
+	asyncBuild := C.bool(params.QueryNodeCfg.InterimIndexAsyncBuild.GetAsBool())
+	C.SegcoreSetEnableAsyncInterimIndexBuild(asyncBuild)
+
 	nlist := C.int64_t(params.QueryNodeCfg.InterimIndexNlist.GetAsInt64())
 	C.SegcoreSetNlist(nlist)
 
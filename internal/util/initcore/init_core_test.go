@@ -149,6 +149,25 @@ func TestInitArrowReaderConfig(t *testing.T) {
 	assert.NoError(t, InitArrowReaderConfig(pt))
 }
 
+func TestInitRemoteReadConfig(t *testing.T) {
+	paramtable.Init()
+	pt := paramtable.Get()
+
+	assert.NoError(t, InitRemoteReadConfig(pt))
+
+	assert.NoError(t, pt.Save(pt.CommonCfg.RemoteReadNumThreads.Key, "4"))
+	assert.NoError(t, pt.Save(pt.CommonCfg.RemoteReadHedgeRatio.Key, "3"))
+	assert.NoError(t, InitRemoteReadConfig(pt))
+
+	assert.NoError(t, pt.Save(pt.CommonCfg.RemoteReadMinPartSizeKb.Key, "0"))
+	assert.Error(t, InitRemoteReadConfig(pt))
+
+	pt.Reset(pt.CommonCfg.RemoteReadNumThreads.Key)
+	pt.Reset(pt.CommonCfg.RemoteReadHedgeRatio.Key)
+	pt.Reset(pt.CommonCfg.RemoteReadMinPartSizeKb.Key)
+	assert.NoError(t, InitRemoteReadConfig(pt))
+}
+
 func TestUpdateLoadTransientBudgetBytes(t *testing.T) {
 	assert.NotPanics(t, func() {
 		UpdateLoadTransientBudgetBytes(0)
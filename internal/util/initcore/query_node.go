@@ -72,9 +72,15 @@ func doInitQueryNodeOnce(ctx context.Context) error {
 	cChunkRows := C.int64_t(paramtable.Get().QueryNodeCfg.ChunkRows.GetAsInt64())
 	C.SegcoreSetChunkRows(cChunkRows)
 
+	cChunkTargetBytes := C.int64_t(paramtable.Get().QueryNodeCfg.ChunkTargetSize.GetAsInt64() * 1024 * 1024)
+	C.SegcoreSetChunkTargetBytes(cChunkTargetBytes)
+
 	cMaxGroupByGroups := C.int64_t(paramtable.Get().CommonCfg.GroupByMaxGroups.GetAsInt64())
 	C.SegcoreSetMaxGroupByGroups(cMaxGroupByGroups)
 
+	cGrowingChunkPoolBytes := C.int64_t(paramtable.Get().QueryNodeCfg.GrowingChunkPoolSize.GetAsInt64() * 1024 * 1024)
+	C.SegcoreSetGrowingChunkPoolBytes(cGrowingChunkPoolBytes)
+
 	visibilityEnabled := paramtable.Get().CommonCfg.VisibilityFilterEnabled.GetAsBool()
 	bloomEnabled := paramtable.Get().CommonCfg.BloomFilterEnabled.GetAsBool()
 	C.SegcoreSetVisibilityFilterEnabled(C.bool(visibilityEnabled))
@@ -116,6 +122,8 @@ func doInitQueryNodeOnce(ctx context.Context) error {
 	C.SetLowPriorityThreadCoreCoefficient(cLowPriorityThreadCoreCoefficient)
 	cThreadPoolMaxThreadsSize := C.int(paramtable.Get().CommonCfg.ThreadPoolMaxThreadsSize.GetAsInt())
 	C.SetThreadPoolMaxThreadsSize(cThreadPoolMaxThreadsSize)
+	cBackgroundThreadPoolCPUShare := C.float(paramtable.Get().CommonCfg.BackgroundThreadPoolCPUShare.GetAsFloat())
+	C.SetBackgroundThreadPoolCpuShare(cBackgroundThreadPoolCPUShare)
 
 	cCPUNum := C.int(hardware.GetCPUNum())
 	C.InitCpuNum(cCPUNum)
@@ -131,6 +139,12 @@ func doInitQueryNodeOnce(ctx context.Context) error {
 	cExprBatchSize := C.int64_t(paramtable.Get().QueryNodeCfg.ExprEvalBatchSize.GetAsInt64())
 	C.SetDefaultExprEvalBatchSize(cExprBatchSize)
 
+	C.SetDefaultFilterMorselParallelism(C.int64_t(paramtable.Get().QueryNodeCfg.FilterMorselParallelism.GetAsInt64()),
+		C.int64_t(paramtable.Get().QueryNodeCfg.FilterMorselRows.GetAsInt64()))
+	C.SetDefaultSearchNqSliceParallelism(C.int64_t(paramtable.Get().QueryNodeCfg.SearchNqSliceParallelism.GetAsInt64()),
+		C.int64_t(paramtable.Get().QueryNodeCfg.SearchNqSliceSize.GetAsInt64()))
+	C.SetDefaultRangeSearchStreamScanLimit(C.int64_t(paramtable.Get().QueryNodeCfg.RangeSearchStreamScanLimit.GetAsInt64()))
+
 	cDeleteDumpBatchSize := C.int64_t(paramtable.Get().QueryNodeCfg.DeleteDumpBatchSize.GetAsInt64())
 	C.SetDefaultDeleteDumpBatchSize(cDeleteDumpBatchSize)
 
@@ -168,6 +182,16 @@ func doInitQueryNodeOnce(ctx context.Context) error {
 	C.SetStorageV2CellTargetSizeBytes(cStorageV2CellTargetSizeBytes)
 	enableParquetStatsSkipIndex := paramtable.Get().CommonCfg.ParquetStatsSkipIndex.GetAsBool()
 	C.SetDefaultEnableParquetStatsSkipIndex(C.bool(enableParquetStatsSkipIndex))
+	C.SetDefaultEnablePackedIntChunk(C.bool(paramtable.Get().QueryNodeCfg.PackedIntChunkEnabled.GetAsBool()))
+	C.SetDefaultEnableMmapAccessAdvice(C.bool(paramtable.Get().QueryNodeCfg.MmapAccessAdviceEnabled.GetAsBool()))
+	C.SetDefaultEnableChunkHugePage(C.bool(paramtable.Get().QueryNodeCfg.ChunkHugePageEnabled.GetAsBool()))
+	C.SetDefaultEnableProjectedGroupLoad(C.bool(paramtable.Get().QueryNodeCfg.ProjectedColumnGroupLoadEnabled.GetAsBool()))
+	C.SetDefaultEnableNumaAwareExecution(C.bool(paramtable.Get().QueryNodeCfg.NumaAwareExecutionEnabled.GetAsBool()))
+	C.SetDefaultEnableFairQueryScheduling(C.bool(paramtable.Get().QueryNodeCfg.FairQuerySchedulingEnabled.GetAsBool()))
+	C.SetDefaultScanPrefetchWindow(C.int64_t(paramtable.Get().QueryNodeCfg.ScanPrefetchWindow.GetAsInt64()))
+	C.SetDefaultTantivyResultCacheCapacity(C.int64_t(paramtable.Get().QueryNodeCfg.TantivyResultCacheCapacity.GetAsInt64()))
+	C.SetDefaultQueryGeometryCacheCapacity(C.int64_t(paramtable.Get().QueryNodeCfg.QueryGeometryCacheCapacity.GetAsInt64()))
+	C.SetDefaultJsonDocCacheCapacity(C.int64_t(paramtable.Get().QueryNodeCfg.JsonDocCacheCapacity.GetAsInt64()))
 
 	err := InitArrowReaderConfig(paramtable.Get())
 	if err != nil {
@@ -180,6 +204,16 @@ func doInitQueryNodeOnce(ctx context.Context) error {
 		return err
 	}
 
+	err = InitLocalObjectCache(paramtable.Get())
+	if err != nil {
+		return err
+	}
+
+	err = InitWarmupProfile(paramtable.Get())
+	if err != nil {
+		return err
+	}
+
 	err = InitRemoteChunkManager(paramtable.Get())
 	if err != nil {
 		return err
@@ -190,6 +224,11 @@ func doInitQueryNodeOnce(ctx context.Context) error {
 		return err
 	}
 
+	err = InitRemoteReadConfig(paramtable.Get())
+	if err != nil {
+		return err
+	}
+
 	err = InitStorageV2FileSystem(paramtable.Get())
 	if err != nil {
 		return err
@@ -239,6 +239,8 @@ func gatherJemallocMetrics() map[string]*dto.MetricFamily {
 		result[m.name] = createGaugeFamily(m.name, m.help, float64(m.value))
 	}
 
+	gatherJemallocArenaMetrics(result)
+
 	// Update cache with fresh metrics
 	jemallocMetricsCache.Lock()
 	jemallocMetricsCache.metrics = result
@@ -250,3 +252,56 @@ func gatherJemallocMetrics() map[string]*dto.MetricFamily {
 
 	return result
 }
+
+// gatherJemallocArenaMetrics adds the stats of the arenas of the thread pools,
+// labeled by pool, when arenas per pool are enabled
+func gatherJemallocArenaMetrics(result map[string]*dto.MetricFamily) {
+	gaugeType := dto.MetricType_GAUGE
+	pools := []struct {
+		pool C.JemallocArenaPool
+		name string
+	}{
+		{C.JEMALLOC_ARENA_LOAD, "load"},
+		{C.JEMALLOC_ARENA_SEARCH, "search"},
+		{C.JEMALLOC_ARENA_BUILD, "build"},
+	}
+	for _, p := range pools {
+		cStats := C.GetJemallocArenaStats(p.pool)
+		if !bool(cStats.success) {
+			continue
+		}
+		metrics := []struct {
+			name  string
+			help  string
+			value uint64
+		}{
+			{"milvus_jemalloc_arena_allocated_bytes", "Bytes allocated from the jemalloc arena of the pool", uint64(cStats.allocated)},
+			{"milvus_jemalloc_arena_active_bytes", "Bytes in active pages of the jemalloc arena of the pool", uint64(cStats.active)},
+			{"milvus_jemalloc_arena_dirty_bytes", "Bytes in unused dirty pages of the jemalloc arena of the pool", uint64(cStats.dirty)},
+			{"milvus_jemalloc_arena_muzzy_bytes", "Bytes in unused muzzy pages of the jemalloc arena of the pool", uint64(cStats.muzzy)},
+			{"milvus_jemalloc_arena_resident_bytes", "Bytes in resident pages of the jemalloc arena of the pool", uint64(cStats.resident)},
+			{"milvus_jemalloc_arena_mapped_bytes", "Bytes in virtual memory mappings of the jemalloc arena of the pool", uint64(cStats.mapped)},
+			{"milvus_jemalloc_arena_retained_bytes", "Bytes in retained virtual memory of the jemalloc arena of the pool", uint64(cStats.retained)},
+			{"milvus_jemalloc_arena_threads", "Threads bound to the jemalloc arena of the pool", uint64(cStats.threads)},
+		}
+		for _, m := range metrics {
+			family, ok := result[m.name]
+			if !ok {
+				family = &dto.MetricFamily{
+					Name: proto.String(m.name),
+					Help: proto.String(m.help),
+					Type: &gaugeType,
+				}
+				result[m.name] = family
+			}
+			family.Metric = append(family.Metric, &dto.Metric{
+				Label: []*dto.LabelPair{
+					{Name: proto.String("pool"), Value: proto.String(p.name)},
+				},
+				Gauge: &dto.Gauge{
+					Value: proto.Float64(float64(m.value)),
+				},
+			})
+		}
+	}
+}
@@ -18,15 +18,19 @@ const (
 	RootCachePath
 	FileResourcePath
 	ExprCachePath
+	ObjectCachePath
+	WarmupProfilePath
 )
 
 const (
-	CachePathPrefix        = "cache"
-	GrowingMMapPathPrefix  = "growing_mmap"
-	LocalChunkPathPrefix   = "local_chunk"
-	BM25PathPrefix         = "bm25"
-	FileResourcePathPrefix = "file_resource"
-	ExprCachePathPrefix    = "expr_cache"
+	CachePathPrefix         = "cache"
+	GrowingMMapPathPrefix   = "growing_mmap"
+	LocalChunkPathPrefix    = "local_chunk"
+	BM25PathPrefix          = "bm25"
+	FileResourcePathPrefix  = "file_resource"
+	ExprCachePathPrefix     = "expr_cache"
+	ObjectCachePathPrefix   = "object_cache"
+	WarmupProfilePathPrefix = "warmup_profile"
 )
 
 func GetPath(pathType PathType, nodeID int64) string {
@@ -44,6 +48,12 @@ func GetPath(pathType PathType, nodeID int64) string {
 		path = filepath.Join(path, fmt.Sprintf("%d", nodeID), FileResourcePathPrefix)
 	case ExprCachePath:
 		path = filepath.Join(path, fmt.Sprintf("%d", nodeID), ExprCachePathPrefix)
+	case ObjectCachePath:
+		// shared by the nodes of every restart, so not under a node id
+		path = filepath.Join(path, ObjectCachePathPrefix)
+	case WarmupProfilePath:
+		// kept across restarts like the object cache
+		path = filepath.Join(path, WarmupProfilePathPrefix)
 	case RootCachePath:
 	}
 	mlog.Info(context.TODO(), "Get path for", mlog.Any("pathType", pathType), mlog.FieldNodeID(nodeID), mlog.String("path", path))
@@ -28,6 +28,7 @@ const (
 	OpReduceByPKTS     = "reduce_by_pk_ts"
 	OpReduceByGroups   = "reduce_by_groups"
 	OpMergeByPKOffsets = "merge_by_pk_offsets"
+	OpMergeByOrderBy   = "merge_by_orderby_offsets"
 	OpDeduplicatePK    = "deduplicate_pk"
 	OpConcatAndCheckPK = "concat_and_check_pk"
 	OpOrderByLimit     = "orderby_limit"
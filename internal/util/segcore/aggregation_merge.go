@@ -0,0 +1,87 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package segcore
+
+/*
+#cgo pkg-config: milvus_core
+
+#include "segcore/plan_c.h"
+#include "segcore/segment_c.h"
+*/
+import "C"
+
+import (
+	"runtime"
+
+	"github.com/milvus-io/milvus/pkg/v3/proto/segcorepb"
+	"github.com/milvus-io/milvus/pkg/v3/util/merr"
+)
+
+// CanMergeAggregationResults reports whether MergeAggregationRetrieveResults
+// can merge the per-segment results of the plan: it must end in its GROUP BY
+// aggregation and only use aggregates with mergeable partial states.
+func (plan *RetrievePlan) CanMergeAggregationResults() bool {
+	if plan == nil || plan.cRetrievePlan == nil {
+		return false
+	}
+	defer runtime.KeepAlive(plan)
+	return bool(C.CanMergeAggregationRetrieveResults(plan.cRetrievePlan))
+}
+
+// MergeAggregationRetrieveResults merges the per-segment retrieve results of
+// one GROUP BY plan into one result of the same layout, so the reducer gets
+// one partial per node instead of one per segment. The results are handed to
+// segcore as they came out of Retrieve and only the merged one is decoded in
+// Go. The groups are merged on up to parallelism threads of the search pool.
+// The inputs stay with the caller.
+func MergeAggregationRetrieveResults(
+	plan *RetrievePlan,
+	results []*RetrieveResult,
+	parallelism int64,
+) (*segcorepb.RetrieveResults, error) {
+	if plan == nil || plan.cRetrievePlan == nil {
+		return nil, merr.WrapErrParameterInvalidMsg("nil retrieve plan")
+	}
+	if len(results) == 0 {
+		return nil, merr.WrapErrParameterInvalidMsg("empty retrieve results")
+	}
+
+	cResults := make([]C.CRetrieveResult, len(results))
+	for i, r := range results {
+		if r == nil || r.cRetrieveResult == nil {
+			return nil, merr.WrapErrParameterInvalidMsg("nil retrieve result")
+		}
+		cResults[i] = *r.cRetrieveResult
+	}
+
+	var cMerged *C.CRetrieveResult
+	status := C.MergeAggregationRetrieveResults(
+		plan.cRetrievePlan,
+		&cResults[0],
+		C.int64_t(len(cResults)),
+		C.int64_t(parallelism),
+		&cMerged,
+	)
+	runtime.KeepAlive(plan)
+	runtime.KeepAlive(results)
+	if err := ConsumeCStatusIntoError(&status); err != nil {
+		return nil, err
+	}
+	merged := &RetrieveResult{cRetrieveResult: cMerged}
+	defer merged.Release()
+	return merged.GetResult()
+}
@@ -21,6 +21,8 @@ package segcore
 */
 import "C"
 
+import "unsafe"
+
 // JemallocStats represents comprehensive jemalloc memory statistics
 // All sizes are in bytes
 type JemallocStats struct {
@@ -58,3 +60,30 @@ func GetJemallocStats() JemallocStats {
 		Success:       bool(cStats.success),
 	}
 }
+
+// SetJemallocArenaPerPool enables or disables a jemalloc arena per thread pool
+// (load, search and index build). It only affects the pool threads started
+// after the call, so it should be called before the pools start.
+func SetJemallocArenaPerPool(enable bool) {
+	C.SetJemallocArenaPerPool(C.bool(enable))
+}
+
+// SetJemallocHeapProfileActive starts or stops sampling allocations for heap
+// profiles. A non-negative lgSample also resets the samples and sets the
+// average bytes between samples to 2^lgSample. It returns false when jemalloc
+// was not started with profiling enabled (MALLOC_CONF=prof:true).
+func SetJemallocHeapProfileActive(active bool, lgSample int32) bool {
+	return bool(C.SetJemallocHeapProfileActive(C.bool(active), C.int32_t(lgSample)))
+}
+
+// DumpJemallocHeapProfile dumps the sampled heap profile to path, or to a file
+// named after the prof_prefix of jemalloc when path is empty. It returns false
+// when profiling is not enabled or the dump failed.
+func DumpJemallocHeapProfile(path string) bool {
+	if path == "" {
+		return bool(C.DumpJemallocHeapProfile(nil))
+	}
+	cPath := C.CString(path)
+	defer C.free(unsafe.Pointer(cPath))
+	return bool(C.DumpJemallocHeapProfile(cPath))
+}
@@ -31,6 +31,7 @@ import (
 	"runtime"
 	"unsafe"
 
+	"github.com/milvus-io/milvus-proto/go-api/v3/schemapb"
 	"github.com/milvus-io/milvus/pkg/v3/util/merr"
 )
 
@@ -110,3 +111,90 @@ func PrepareSearchResultsForExport(
 	}
 	return int64(allSearchCount), nil
 }
+
+// ReduceSearchResultsAndFillData runs the whole reduce of the per-segment
+// SearchResults in C++: the pre-export phase of PrepareSearchResultsForExport,
+// a per-NQ merge of the segments into each slice's topK with PK dedup, and
+// output field filling. It returns one SearchResultData per slice, with Ids,
+// Scores, Topks, ElementIndices and FieldsData set, and the sum of the
+// results' total_data_cnt_ values. Group-by searches are not supported.
+func ReduceSearchResultsAndFillData(
+	ctx context.Context,
+	plan *SearchPlan,
+	placeholderGroup unsafe.Pointer,
+	searchResults []*SearchResult,
+	sliceNQs []int64,
+	sliceTopKs []int64,
+) ([]*schemapb.SearchResultData, int64, error) {
+	if err := ctx.Err(); err != nil {
+		return nil, 0, err
+	}
+	if plan == nil || plan.cSearchPlan == nil {
+		return nil, 0, merr.WrapErrParameterInvalidMsg("nil search plan")
+	}
+	if placeholderGroup == nil {
+		return nil, 0, merr.WrapErrParameterInvalidMsg("nil placeholder group")
+	}
+	if len(searchResults) == 0 {
+		return nil, 0, merr.WrapErrParameterInvalidMsg("empty search results")
+	}
+	if len(sliceNQs) == 0 || len(sliceNQs) != len(sliceTopKs) {
+		return nil, 0, merr.WrapErrParameterInvalidMsg("unaligned slice nqs (%d) and topks (%d)",
+			len(sliceNQs), len(sliceTopKs))
+	}
+
+	cResults := make([]C.CSearchResult, len(searchResults))
+	for i, r := range searchResults {
+		if r == nil {
+			return nil, 0, merr.WrapErrParameterInvalidMsg("nil search result at index %d", i)
+		}
+		cResults[i] = r.cSearchResult
+	}
+
+	traceCtx := ParseCTraceContext(ctx)
+	defer runtime.KeepAlive(traceCtx)
+
+	guard := NewCancellationGuard(ctx)
+	defer guard.Close()
+
+	cProtos := make([]C.CProto, len(sliceNQs))
+	var allSearchCount C.int64_t
+	status := C.ReduceSearchResultsAndFillData(
+		traceCtx.ctx,
+		plan.cSearchPlan,
+		C.CPlaceholderGroup(placeholderGroup),
+		&cResults[0],
+		C.int64_t(len(searchResults)),
+		(*C.int64_t)(unsafe.Pointer(&sliceNQs[0])),
+		C.int64_t(len(sliceNQs)),
+		(*C.int64_t)(unsafe.Pointer(&sliceTopKs[0])),
+		&cProtos[0],
+		&allSearchCount,
+		guard.Source(),
+	)
+	runtime.KeepAlive(cResults)
+	runtime.KeepAlive(searchResults)
+	runtime.KeepAlive(plan)
+	runtime.KeepAlive(sliceNQs)
+	runtime.KeepAlive(sliceTopKs)
+	if err := ConsumeCStatusIntoError(&status); err != nil {
+		return nil, 0, err
+	}
+	defer func() {
+		for i := range cProtos {
+			C.free(unsafe.Pointer(cProtos[i].proto_blob))
+		}
+	}()
+
+	resultData := make([]*schemapb.SearchResultData, len(cProtos))
+	for i := range cProtos {
+		resultData[i] = &schemapb.SearchResultData{}
+		if cProtos[i].proto_size == 0 {
+			continue
+		}
+		if err := unmarshalCProto(&cProtos[i], resultData[i]); err != nil {
+			return nil, 0, err
+		}
+	}
+	return resultData, int64(allSearchCount), nil
+}
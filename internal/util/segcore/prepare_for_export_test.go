@@ -164,3 +164,32 @@ func TestFillOutputFieldsOrdered_NilResultInSlice(t *testing.T) {
 	require.Error(t, err)
 	require.Contains(t, err.Error(), "nil search result at index 0")
 }
+
+func TestReduceSearchResultsAndFillData_UnalignedSlices(t *testing.T) {
+	plan := segcore.NewDummySearchPlanForTest(t)
+	_, _, err := segcore.ReduceSearchResultsAndFillData(
+		context.Background(),
+		plan,
+		segcore.NewDummyPlaceholderGroupForTest(),
+		[]*segcore.SearchResult{{}},
+		[]int64{1, 1},
+		[]int64{10},
+	)
+	require.Error(t, err)
+	require.ErrorIs(t, err, merr.ErrParameterInvalid)
+	require.Contains(t, err.Error(), "unaligned slice nqs")
+}
+
+func TestReduceSearchResultsAndFillData_NilResultInSlice(t *testing.T) {
+	plan := segcore.NewDummySearchPlanForTest(t)
+	_, _, err := segcore.ReduceSearchResultsAndFillData(
+		context.Background(),
+		plan,
+		segcore.NewDummyPlaceholderGroupForTest(),
+		[]*segcore.SearchResult{nil},
+		[]int64{1},
+		[]int64{10},
+	)
+	require.Error(t, err)
+	require.Contains(t, err.Error(), "nil search result at index 0")
+}
@@ -56,6 +56,17 @@ func (r *SearchResult) ValidCount() int64 {
 	return int64(C.GetSearchResultValidCount(r.cSearchResult))
 }
 
+// ExplainAnalyze returns the per-operator stats of the segment search, empty
+// unless the plan asked for EXPLAIN ANALYZE.
+func (r *SearchResult) ExplainAnalyze() string {
+	var size C.int64_t
+	data := C.GetSearchResultExplainAnalyze(r.cSearchResult, &size)
+	if size == 0 {
+		return ""
+	}
+	return C.GoStringN(data, C.int(size))
+}
+
 type RetrieveResult struct {
 	cRetrieveResult *C.CRetrieveResult
 }
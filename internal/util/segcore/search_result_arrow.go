@@ -56,6 +56,19 @@ struct ArrowArray {
 
 #endif  // ARROW_C_DATA_INTERFACE
 
+#ifndef ARROW_C_STREAM_INTERFACE
+#define ARROW_C_STREAM_INTERFACE
+
+struct ArrowArrayStream {
+    int (*get_schema)(struct ArrowArrayStream*, struct ArrowSchema* out);
+    int (*get_next)(struct ArrowArrayStream*, struct ArrowArray* out);
+    const char* (*get_last_error)(struct ArrowArrayStream*);
+    void (*release)(struct ArrowArrayStream*);
+    void* private_data;
+};
+
+#endif  // ARROW_C_STREAM_INTERFACE
+
 static inline void
 MilvusGoArrowSchemaRelease(struct ArrowSchema* schema) {
     if (schema != NULL && schema->release != NULL) {
@@ -86,6 +99,40 @@ ExportSearchResultAsArrowRecordBatch(CSearchResult c_search_result,
                                      int64_t* out_num_chunks,
                                      void* cancellation_source);
 
+static inline int
+MilvusGoArrowArrayStreamGetSchema(struct ArrowArrayStream* stream,
+                                  struct ArrowSchema* out) {
+    return stream->get_schema(stream, out);
+}
+
+static inline int
+MilvusGoArrowArrayStreamGetNext(struct ArrowArrayStream* stream,
+                                struct ArrowArray* out) {
+    return stream->get_next(stream, out);
+}
+
+static inline const char*
+MilvusGoArrowArrayStreamGetLastError(struct ArrowArrayStream* stream) {
+    return stream->get_last_error(stream);
+}
+
+static inline void
+MilvusGoArrowArrayStreamRelease(struct ArrowArrayStream* stream) {
+    if (stream != NULL && stream->release != NULL) {
+        stream->release(stream);
+    }
+}
+
+CStatus
+ExportSearchResultAsArrowStream(CSearchResult c_search_result,
+                                CSearchPlan c_plan,
+                                const int64_t* extra_field_ids,
+                                int64_t num_extra_fields,
+                                struct ArrowArrayStream* out_stream,
+                                int64_t** out_chunk_sizes,
+                                int64_t* out_num_chunks,
+                                void* cancellation_source);
+
 CStatus
 FillOutputFieldsOrdered(CSearchResult* search_results,
                         int64_t num_search_results,
@@ -96,6 +143,18 @@ FillOutputFieldsOrdered(CSearchResult* search_results,
                         CProto* out_result,
                         void* cancellation_source);
 
+CStatus
+FillOutputFieldsOrderedAsArrow(CSearchResult* search_results,
+                               int64_t num_search_results,
+                               CSearchPlan c_plan,
+                               const int32_t* result_seg_indices,
+                               const int64_t* result_seg_offsets,
+                               int64_t total_rows,
+                               struct ArrowSchema* out_schema,
+                               struct ArrowArray* out_array,
+                               bool* exported,
+                               void* cancellation_source);
+
 void
 GetSearchResultMetadata(CSearchResult c_search_result,
                         bool* has_group_by,
@@ -107,6 +166,7 @@ import "C"
 
 import (
 	"context"
+	"io"
 	"runtime"
 	"unsafe"
 
@@ -187,6 +247,139 @@ func ExportSearchResultAsArrowRecordBatch(ctx context.Context, result *SearchRes
 	return rec, chunkSizes, nil
 }
 
+// SearchResultArrowStream reads a per-segment C++ SearchResult as Arrow
+// RecordBatches, each holding the rows of a run of whole NQ chunks. C++ builds
+// every batch, reading its extra fields, only when Next asks for it. The
+// caller must call Release once done reading.
+type SearchResultArrowStream struct {
+	ctx        context.Context
+	cStream    C.struct_ArrowArrayStream
+	schema     *arrow.Schema
+	chunkSizes []int64
+	guard      *CancellationGuard
+	result     *SearchResult
+	plan       *SearchPlan
+}
+
+// ExportSearchResultAsArrowStream exports a per-segment C++ SearchResult as a
+// stream of Arrow RecordBatches, with row counts for each logical NQ chunk.
+// result and plan are kept alive until the stream is released.
+func ExportSearchResultAsArrowStream(ctx context.Context, result *SearchResult, plan *SearchPlan, extraFieldIDs []int64) (*SearchResultArrowStream, error) {
+	if err := ctx.Err(); err != nil {
+		return nil, err
+	}
+	if result == nil {
+		return nil, merr.WrapErrParameterInvalidMsg("nil search result")
+	}
+	if plan == nil || plan.cSearchPlan == nil {
+		return nil, merr.WrapErrParameterInvalidMsg("nil search plan")
+	}
+
+	var extraPtr *C.int64_t
+	if len(extraFieldIDs) > 0 {
+		extraPtr = (*C.int64_t)(unsafe.Pointer(&extraFieldIDs[0]))
+	}
+
+	stream := &SearchResultArrowStream{
+		ctx:    ctx,
+		guard:  NewCancellationGuard(ctx),
+		result: result,
+		plan:   plan,
+	}
+	var chunkSizesPtr *C.int64_t
+	var numChunks C.int64_t
+	status := C.ExportSearchResultAsArrowStream(
+		result.cSearchResult,
+		plan.cSearchPlan,
+		extraPtr,
+		C.int64_t(len(extraFieldIDs)),
+		&stream.cStream,
+		&chunkSizesPtr,
+		&numChunks,
+		stream.guard.Source(),
+	)
+	runtime.KeepAlive(extraFieldIDs)
+	if err := ConsumeCStatusIntoError(&status); err != nil {
+		if chunkSizesPtr != nil {
+			C.free(unsafe.Pointer(chunkSizesPtr))
+		}
+		stream.Release()
+		return nil, err
+	}
+	if chunkSizesPtr == nil || numChunks <= 0 {
+		stream.Release()
+		return nil, merr.WrapErrServiceInternal("missing Arrow stream chunk sizes")
+	}
+	cChunkSizes := unsafe.Slice((*int64)(unsafe.Pointer(chunkSizesPtr)), int(numChunks))
+	stream.chunkSizes = append([]int64(nil), cChunkSizes...)
+	C.free(unsafe.Pointer(chunkSizesPtr))
+
+	var cSchema C.struct_ArrowSchema
+	if code := C.MilvusGoArrowArrayStreamGetSchema(&stream.cStream, &cSchema); code != 0 {
+		err := stream.lastError("failed to get Arrow stream schema")
+		stream.Release()
+		return nil, err
+	}
+	schema, err := cdata.ImportCArrowSchema((*cdata.CArrowSchema)(unsafe.Pointer(&cSchema)))
+	C.MilvusGoArrowSchemaRelease(&cSchema)
+	if err != nil {
+		stream.Release()
+		return nil, merr.WrapErrServiceInternal("failed to import Arrow schema", err.Error())
+	}
+	stream.schema = schema
+	return stream, nil
+}
+
+// Schema returns the schema every record of the stream has.
+func (s *SearchResultArrowStream) Schema() *arrow.Schema {
+	return s.schema
+}
+
+// ChunkSizes returns the row counts of the logical NQ chunks.
+func (s *SearchResultArrowStream) ChunkSizes() []int64 {
+	return s.chunkSizes
+}
+
+// Next returns the next record of the stream, or io.EOF after the last one.
+// The caller is responsible for releasing the returned record.
+func (s *SearchResultArrowStream) Next() (arrow.Record, error) {
+	var cArray C.struct_ArrowArray
+	if code := C.MilvusGoArrowArrayStreamGetNext(&s.cStream, &cArray); code != 0 {
+		return nil, s.lastError("failed to read Arrow stream")
+	}
+	if C.MilvusGoArrowArrayIsReleased(&cArray) != 0 {
+		return nil, io.EOF
+	}
+	rec, err := cdata.ImportCRecordBatchWithSchema((*cdata.CArrowArray)(unsafe.Pointer(&cArray)), s.schema)
+	if err != nil {
+		C.MilvusGoArrowArrayRelease(&cArray)
+		return nil, merr.WrapErrServiceInternal("failed to import Arrow RecordBatch", err.Error())
+	}
+	return rec, nil
+}
+
+// Release releases the C++ stream. Records already read stay valid.
+func (s *SearchResultArrowStream) Release() {
+	C.MilvusGoArrowArrayStreamRelease(&s.cStream)
+	if s.guard != nil {
+		s.guard.Close()
+		s.guard = nil
+	}
+	runtime.KeepAlive(s.result)
+	runtime.KeepAlive(s.plan)
+}
+
+func (s *SearchResultArrowStream) lastError(msg string) error {
+	if err := s.ctx.Err(); err != nil {
+		return err
+	}
+	detail := "unknown error"
+	if cErr := C.MilvusGoArrowArrayStreamGetLastError(&s.cStream); cErr != nil {
+		detail = C.GoString(cErr)
+	}
+	return merr.WrapErrServiceInternal(msg, detail)
+}
+
 // FillOutputFieldsOrdered reads output fields from multiple segments in a single CGO call,
 // producing results in the specified output order.
 // Storage cost is accumulated in the original SearchResult objects.
@@ -264,3 +457,92 @@ func FillOutputFieldsOrdered(
 	C.free(cProto.proto_blob)
 	return goBytes, nil
 }
+
+// FillOutputFieldsOrderedAsArrow reads the same output fields as
+// FillOutputFieldsOrdered, in the same order, as one Arrow record with a column
+// per output field carrying the milvus.field_id and milvus.data_type metadata,
+// so the field data is neither serialized in C++ nor unmarshaled here.
+// It returns a nil record and false when an output field has no Arrow form
+// (vectors, arrays, JSON and the like); the caller then falls back to
+// FillOutputFieldsOrdered. The caller is responsible for releasing the record.
+func FillOutputFieldsOrderedAsArrow(
+	ctx context.Context,
+	results []*SearchResult,
+	plan *SearchPlan,
+	segIndices []int32,
+	segOffsets []int64,
+) (arrow.Record, bool, error) {
+	if err := ctx.Err(); err != nil {
+		return nil, false, err
+	}
+	if plan == nil || plan.cSearchPlan == nil {
+		return nil, false, merr.WrapErrParameterInvalidMsg("nil search plan")
+	}
+	if len(results) == 0 {
+		return nil, false, merr.WrapErrParameterInvalidMsg("empty search results")
+	}
+	if len(segIndices) != len(segOffsets) {
+		return nil, false, merr.WrapErrParameterInvalidMsg("unaligned segment indices (%d) and offsets (%d)",
+			len(segIndices), len(segOffsets))
+	}
+
+	cResults := make([]C.CSearchResult, len(results))
+	for i, r := range results {
+		if r == nil {
+			return nil, false, merr.WrapErrParameterInvalidMsg("nil search result at index %d", i)
+		}
+		cResults[i] = r.cSearchResult
+	}
+
+	var segIndicesPtr *C.int32_t
+	var segOffsetsPtr *C.int64_t
+	if len(segIndices) > 0 {
+		segIndicesPtr = (*C.int32_t)(unsafe.Pointer(&segIndices[0]))
+		segOffsetsPtr = (*C.int64_t)(unsafe.Pointer(&segOffsets[0]))
+	}
+
+	guard := NewCancellationGuard(ctx)
+	defer guard.Close()
+
+	var cSchema C.struct_ArrowSchema
+	var cArray C.struct_ArrowArray
+	var exported C.bool
+	status := C.FillOutputFieldsOrderedAsArrow(
+		&cResults[0],
+		C.int64_t(len(results)),
+		plan.cSearchPlan,
+		segIndicesPtr,
+		segOffsetsPtr,
+		C.int64_t(len(segIndices)),
+		&cSchema,
+		&cArray,
+		&exported,
+		guard.Source(),
+	)
+	runtime.KeepAlive(segIndices)
+	runtime.KeepAlive(segOffsets)
+	runtime.KeepAlive(cResults)
+	runtime.KeepAlive(results)
+	runtime.KeepAlive(plan)
+	if err := ConsumeCStatusIntoError(&status); err != nil {
+		C.MilvusGoArrowSchemaRelease(&cSchema)
+		C.MilvusGoArrowArrayRelease(&cArray)
+		return nil, false, err
+	}
+	if !bool(exported) {
+		return nil, false, nil
+	}
+
+	schema, err := cdata.ImportCArrowSchema((*cdata.CArrowSchema)(unsafe.Pointer(&cSchema)))
+	C.MilvusGoArrowSchemaRelease(&cSchema)
+	if err != nil {
+		C.MilvusGoArrowArrayRelease(&cArray)
+		return nil, false, merr.WrapErrServiceInternal("failed to import Arrow schema", err.Error())
+	}
+	rec, err := cdata.ImportCRecordBatchWithSchema((*cdata.CArrowArray)(unsafe.Pointer(&cArray)), schema)
+	if err != nil {
+		C.MilvusGoArrowArrayRelease(&cArray)
+		return nil, false, merr.WrapErrServiceInternal("failed to import Arrow RecordBatch", err.Error())
+	}
+	return rec, true, nil
+}
@@ -26,6 +26,26 @@ func TestExportSearchResultAsArrowRecordBatchValidation(t *testing.T) {
 	assert.Contains(t, err.Error(), "nil search plan")
 }
 
+func TestExportSearchResultAsArrowStreamValidation(t *testing.T) {
+	stream, err := ExportSearchResultAsArrowStream(context.Background(), nil, nil, nil)
+	require.Error(t, err)
+	assert.Nil(t, stream)
+	assert.ErrorIs(t, err, merr.ErrParameterInvalid)
+	assert.Contains(t, err.Error(), "nil search result")
+
+	stream, err = ExportSearchResultAsArrowStream(context.Background(), &SearchResult{}, nil, nil)
+	require.Error(t, err)
+	assert.Nil(t, stream)
+	assert.ErrorIs(t, err, merr.ErrParameterInvalid)
+	assert.Contains(t, err.Error(), "nil search plan")
+
+	ctx, cancel := context.WithCancel(context.Background())
+	cancel()
+	stream, err = ExportSearchResultAsArrowStream(ctx, &SearchResult{}, nil, nil)
+	assert.ErrorIs(t, err, context.Canceled)
+	assert.Nil(t, stream)
+}
+
 func TestFillOutputFieldsOrderedValidation(t *testing.T) {
 	blob, err := FillOutputFieldsOrdered(context.Background(), []*SearchResult{{}}, nil, nil, nil)
 	require.Error(t, err)
@@ -52,3 +72,32 @@ func TestFillOutputFieldsOrderedValidation(t *testing.T) {
 	assert.ErrorIs(t, err, merr.ErrParameterInvalid)
 	assert.Contains(t, err.Error(), "nil search result at index 0")
 }
+
+func TestFillOutputFieldsOrderedAsArrowValidation(t *testing.T) {
+	rec, exported, err := FillOutputFieldsOrderedAsArrow(context.Background(), []*SearchResult{{}}, nil, nil, nil)
+	require.Error(t, err)
+	assert.Nil(t, rec)
+	assert.False(t, exported)
+	assert.ErrorIs(t, err, merr.ErrParameterInvalid)
+	assert.Contains(t, err.Error(), "nil search plan")
+
+	plan := NewDummySearchPlanForTest(t)
+	rec, exported, err = FillOutputFieldsOrderedAsArrow(context.Background(), nil, plan, nil, nil)
+	require.Error(t, err)
+	assert.Nil(t, rec)
+	assert.False(t, exported)
+	assert.Contains(t, err.Error(), "empty search results")
+
+	rec, exported, err = FillOutputFieldsOrderedAsArrow(context.Background(), []*SearchResult{{}}, plan, []int32{0}, nil)
+	require.Error(t, err)
+	assert.Nil(t, rec)
+	assert.False(t, exported)
+	assert.Contains(t, err.Error(), "unaligned segment indices")
+
+	ctx, cancel := context.WithCancel(context.Background())
+	cancel()
+	rec, exported, err = FillOutputFieldsOrderedAsArrow(ctx, []*SearchResult{{}}, plan, nil, nil)
+	assert.ErrorIs(t, err, context.Canceled)
+	assert.Nil(t, rec)
+	assert.False(t, exported)
+}
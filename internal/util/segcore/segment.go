@@ -136,6 +136,15 @@ func (s *cSegmentImpl) HasFieldData(fieldID int64) bool {
 	return bool(ret)
 }
 
+// deadlineUs returns the deadline of ctx in microseconds since the unix epoch, 0 if it has none.
+// Segcore orders the tasks of concurrent queries by it and drops the ones queued past it.
+func deadlineUs(ctx context.Context) int64 {
+	if deadline, ok := ctx.Deadline(); ok {
+		return deadline.UnixMicro()
+	}
+	return 0
+}
+
 // Search requests a search on the segment.
 // If searchReq.FilterOnly() is true, only executes the filter and returns valid_count (Stage 1 of two-stage search).
 func (s *cSegmentImpl) Search(ctx context.Context, searchReq *SearchRequest) (*SearchResult, error) {
@@ -163,6 +172,8 @@ func (s *cSegmentImpl) Search(ctx context.Context, searchReq *SearchRequest) (*S
 				C.uint64_t(physicalTimeUs),
 				C.bool(searchReq.filterOnly),
 				C.bool(searchReq.enableExprCache),
+				C.int64_t(searchReq.msgID),
+				C.int64_t(deadlineUs(ctx)),
 			))
 		},
 		cgo.WithName("search"),
@@ -202,6 +213,8 @@ func (s *cSegmentImpl) Retrieve(ctx context.Context, plan *RetrievePlan) (*Retri
 				C.int32_t(plan.consistencyLevel),
 				C.uint64_t(plan.collectionTTL),
 				C.uint64_t(physicalTimeUs),
+				C.int64_t(plan.msgID),
+				C.int64_t(deadlineUs(ctx)),
 			))
 		},
 		cgo.WithName("retrieve"),
@@ -234,6 +247,8 @@ func (s *cSegmentImpl) RetrieveByOffsets(ctx context.Context, plan *RetrievePlan
 				plan.cRetrievePlan,
 				(*C.int64_t)(unsafe.Pointer(&plan.Offsets[0])),
 				C.int64_t(len(plan.Offsets)),
+				C.int64_t(plan.msgID),
+				C.int64_t(deadlineUs(ctx)),
 			))
 		},
 		cgo.WithName("retrieve-by-offsets"),
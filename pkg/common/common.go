@@ -124,9 +124,22 @@ const (
 	// - JSON path index supports STL_SORT / BITMAP / HYBRID (in addition to
 	//   the existing INVERTED / NGRAM)
 	// - On-disk file format is unchanged from v3
+	//
+	// Scalar index engine version 5:
+	// - STL_SORT string index stores its sorted dictionary front coded
+	//   (StringIndexSort serialization version 2)
+	//
+	// Scalar index engine version 6:
+	// - STL_SORT string index encodes each posting list as raw, bit packed
+	//   gaps or roaring, whichever is smallest (StringIndexSort
+	//   serialization version 3)
+	//
+	// Scalar index engine version 7:
+	// - RTREE index is built as a packed Hilbert R-tree that is mapped on
+	//   load (index_file.prt instead of a serialized boost rtree)
 	MinimalScalarIndexEngineVersion = int32(0)
-	CurrentScalarIndexEngineVersion = int32(4)
-	MaximumScalarIndexEngineVersion = int32(4)
+	CurrentScalarIndexEngineVersion = int32(7)
+	MaximumScalarIndexEngineVersion = int32(7)
 
 	// MinScalarIndexVersionForJsonPathMultiType is the minimum scalar index
 	// engine version that supports STL_SORT / BITMAP / HYBRID on JSON fields.
@@ -242,6 +255,7 @@ const (
 // expr query params
 const (
 	ExprUseJSONStatsKey = "expr_use_json_stats"
+	ExplainAnalyzeKey   = "explain_analyze"
 )
 
 // Doc-in-doc-out
@@ -238,10 +238,17 @@ type commonConfig struct {
 	LowPriorityThreadCoreCoefficient    ParamItem `refreshable:"true"`
 	BM25LoadThreadCoreCoefficient       ParamItem `refreshable:"true"`
 	ThreadPoolMaxThreadsSize            ParamItem `refreshable:"true"`
+	BackgroundThreadPoolCPUShare        ParamItem `refreshable:"false"`
 	ArrowIOThreadPoolCoefficient        ParamItem `refreshable:"true"`
 	ArrowIOThreadPoolMaxCapacity        ParamItem `refreshable:"true"`
 	ArrowReaderHoleSizeLimitBytes       ParamItem `refreshable:"true"`
 	ArrowReaderRangeSizeLimitBytes      ParamItem `refreshable:"true"`
+	RemoteReadNumThreads                ParamItem `refreshable:"false"`
+	RemoteReadMinPartSizeKb             ParamItem `refreshable:"false"`
+	RemoteReadMaxPartSizeKb             ParamItem `refreshable:"false"`
+	RemoteReadHedgeRatio                ParamItem `refreshable:"false"`
+	RemoteReadSmallObjectNumThreads     ParamItem `refreshable:"false"`
+	RemoteReadSmallObjectMaxSizeKb      ParamItem `refreshable:"false"`
 	EnableMaterializedView              ParamItem `refreshable:"false"`
 	BuildIndexThreadPoolRatio           ParamItem `refreshable:"false"`
 	MaxDegree                           ParamItem `refreshable:"true"`
@@ -738,6 +745,17 @@ This configuration is only used by querynode and indexnode, it selects CPU instr
 	}
 	p.ThreadPoolMaxThreadsSize.Init(base.mgr)
 
+	p.BackgroundThreadPoolCPUShare = ParamItem{
+		Key:          "common.threadCoreCoefficient.backgroundCpuShare",
+		Version:      "3.0.0",
+		DefaultValue: "0",
+		Doc: "Share of the cores the tasks of the middle and low priority pools, i.e. segment loads and warmups, " +
+			"may use at once on a query node, so that they leave the rest to searches. " +
+			"Middle priority tasks get a free core first. 0 means no cap",
+		Export: false,
+	}
+	p.BackgroundThreadPoolCPUShare.Init(base.mgr)
+
 	p.ArrowIOThreadPoolCoefficient = ParamItem{
 		Key:          "common.arrow.ioThreadPoolCoefficient",
 		Version:      "3.0.0",
@@ -792,13 +810,77 @@ This configuration is only used by querynode and indexnode, it selects CPU instr
 	}
 	p.ArrowReaderRangeSizeLimitBytes.Init(base.mgr)
 
+	p.RemoteReadNumThreads = ParamItem{
+		Key:          "common.remoteRead.numThreads",
+		Version:      "3.0.0",
+		DefaultValue: "0",
+		Doc: `Number of workers fetching the parts of large reads from remote storage concurrently. ` +
+			`Reads of index files and binlogs of at least two minimum parts are split into byte ranges ` +
+			`fetched in parallel, since one object-store connection is capped well below the network ` +
+			`bandwidth. 0 disables parallel reads.`,
+		Export: false,
+	}
+	p.RemoteReadNumThreads.Init(base.mgr)
+
+	p.RemoteReadMinPartSizeKb = ParamItem{
+		Key:          "common.remoteRead.minPartSizeKb",
+		Version:      "3.0.0",
+		DefaultValue: "8192",
+		Doc: `Minimum size in KB of a part of a parallel remote read. Parts are sized from the ` +
+			`observed throughput between the minimum and the maximum part size.`,
+		Export: false,
+	}
+	p.RemoteReadMinPartSizeKb.Init(base.mgr)
+
+	p.RemoteReadMaxPartSizeKb = ParamItem{
+		Key:          "common.remoteRead.maxPartSizeKb",
+		Version:      "3.0.0",
+		DefaultValue: "65536",
+		Doc:          `Maximum size in KB of a part of a parallel remote read.`,
+		Export:       false,
+	}
+	p.RemoteReadMaxPartSizeKb.Init(base.mgr)
+
+	p.RemoteReadHedgeRatio = ParamItem{
+		Key:          "common.remoteRead.hedgeRatio",
+		Version:      "3.0.0",
+		DefaultValue: "0",
+		Doc: `A part of a parallel remote read still running after hedgeRatio times its expected ` +
+			`duration is requested again, and the first response wins. 0 disables hedged requests.`,
+		Export: false,
+	}
+	p.RemoteReadHedgeRatio.Init(base.mgr)
+
+	p.RemoteReadSmallObjectNumThreads = ParamItem{
+		Key:          "common.remoteRead.smallObject.numThreads",
+		Version:      "3.0.0",
+		DefaultValue: "0",
+		Doc: `Threads reading whole small binlogs and index files for all concurrent loads, apart ` +
+			`from the load pools. Small objects are bound by request latency, so this can be set ` +
+			`well above the CPU count; concurrent reads of the same object are served by one ` +
+			`request. 0 reads them on the load pools.`,
+		Export: false,
+	}
+	p.RemoteReadSmallObjectNumThreads.Init(base.mgr)
+
+	p.RemoteReadSmallObjectMaxSizeKb = ParamItem{
+		Key:          "common.remoteRead.smallObject.maxSizeKb",
+		Version:      "3.0.0",
+		DefaultValue: "256",
+		Doc: `Largest object in KB read by the small object threads, larger ones are read by the ` +
+			`load pools.`,
+		Export: false,
+	}
+	p.RemoteReadSmallObjectMaxSizeKb.Init(base.mgr)
+
 	p.DiskWriteMode = ParamItem{
 		Key:          "common.diskWriteMode",
 		Version:      "2.6.0",
 		DefaultValue: "buffered",
 		Doc: `This parameter controls the write mode of the local disk, which is used to write temporary data downloaded from remote storage.
 Currently, only QueryNode uses 'common.diskWrite*' parameters. Support for other components will be added in the future.
-The options include 'direct' and 'buffered'. The default value is 'buffered'.`,
+The options include 'direct', 'buffered' and 'io_uring'. The default value is 'buffered'.
+'io_uring' writes with direct I/O through io_uring, and falls back to 'direct' where io_uring is unavailable.`,
 		Export: true,
 	}
 	p.DiskWriteMode.Init(base.mgr)
@@ -3554,6 +3636,8 @@ type queryNodeConfig struct {
 	KnowhereFetchThreadPoolSize   ParamItem `refreshable:"true"`
 	KnowhereThreadPoolSize        ParamItem `refreshable:"true"`
 	ChunkRows                     ParamItem `refreshable:"false"`
+	ChunkTargetSize               ParamItem `refreshable:"false"`
+	GrowingChunkPoolSize          ParamItem `refreshable:"false"`
 	EnableInterminSegmentIndex    ParamItem `refreshable:"false"`
 	InterimIndexNlist             ParamItem `refreshable:"false"`
 	InterimIndexNProbe            ParamItem `refreshable:"false"`
@@ -3565,6 +3649,7 @@ type queryNodeConfig struct {
 	DenseVectorInterminIndexType  ParamItem `refreshable:"false"`
 	InterimIndexMemExpandRate     ParamItem `refreshable:"false"`
 	InterimIndexBuildParallelRate ParamItem `refreshable:"false"`
+	InterimIndexAsyncBuild        ParamItem `refreshable:"false"`
 	MultipleChunkedEnable         ParamItem `refreshable:"false"` // Deprecated
 	EnableGeometryCache           ParamItem `refreshable:"false"`
 
@@ -3633,7 +3718,11 @@ type queryNodeConfig struct {
 	CPURatio              ParamItem `refreshable:"true"`
 	GracefulStopTimeout   ParamItem `refreshable:"false"`
 
-	EnableResultZeroCopy ParamItem `refreshable:"true"`
+	EnableResultZeroCopy    ParamItem `refreshable:"true"`
+	EnableNativeReduce      ParamItem `refreshable:"true"`
+	EnableArrowOutputFields ParamItem `refreshable:"true"`
+
+	AggregationMergeParallelism ParamItem `refreshable:"true"`
 
 	// tsafe
 	MaxTimestampLag           ParamItem `refreshable:"true"`
@@ -3671,10 +3760,56 @@ type queryNodeConfig struct {
 	// are packed into cells so rgs_per_cell * avg_rg_size ≈ this value.
 	StorageV2CellTargetSizeBytes ParamItem `refreshable:"true"`
 
+	// Capacity of the local disk cache of whole remote objects, kept across
+	// segments and restarts.
+	LocalObjectCacheCapacityMb ParamItem `refreshable:"false"`
+
+	// Whether sealed integer chunks are loaded bit-packed.
+	PackedIntChunkEnabled ParamItem `refreshable:"false"`
+
+	// madvise hints for mmapped chunks and huge pages for in-memory ones.
+	MmapAccessAdviceEnabled ParamItem `refreshable:"false"`
+	ChunkHugePageEnabled    ParamItem `refreshable:"false"`
+
+	// Load each field of a multi-field column group as its own cache entry.
+	ProjectedColumnGroupLoadEnabled ParamItem `refreshable:"false"`
+
+	// Whether segments are loaded and searched on the NUMA node they are homed on.
+	NumaAwareExecutionEnabled ParamItem `refreshable:"false"`
+
+	// Whether segcore shares the search executor fairly between concurrent queries.
+	FairQuerySchedulingEnabled ParamItem `refreshable:"false"`
+
+	// Chunks a sealed segment scan keeps loading ahead of itself.
+	ScanPrefetchWindow ParamItem `refreshable:"false"`
+
+	// Bytes of query results each sealed inverted index caches.
+	TantivyResultCacheCapacity ParamItem `refreshable:"false"`
+
+	// Bytes of parsed and prepared query geometries each query thread caches.
+	QueryGeometryCacheCapacity ParamItem `refreshable:"false"`
+
+	// Bytes of parsed JSON documents a filter shares between its predicates.
+	JsonDocCacheCapacity ParamItem `refreshable:"false"`
+
+	// Hours of field and index accesses replayed as warmup on segment load.
+	WarmupProfileWindowHours ParamItem `refreshable:"false"`
+
 	EnableWorkerSQCostMetrics ParamItem `refreshable:"true"`
 
 	ExprEvalBatchSize ParamItem `refreshable:"false"`
 
+	// Threads evaluating the filter of one sealed segment in morsels.
+	FilterMorselParallelism ParamItem `refreshable:"false"`
+	FilterMorselRows        ParamItem `refreshable:"false"`
+
+	// Threads searching the queries of one sealed segment in nq slices.
+	SearchNqSliceParallelism ParamItem `refreshable:"false"`
+	SearchNqSliceSize        ParamItem `refreshable:"false"`
+
+	// Candidates a range search streams at most per query.
+	RangeSearchStreamScanLimit ParamItem `refreshable:"false"`
+
 	// delete snapshot dump batch size
 	DeleteDumpBatchSize ParamItem `refreshable:"false"`
 
@@ -4146,6 +4281,24 @@ If set to 0, time based eviction is disabled.`,
 	}
 	p.ChunkRows.Init(base.mgr)
 
+	p.ChunkTargetSize = ParamItem{
+		Key:          "queryNode.segcore.chunkTargetSize",
+		Version:      "3.0.0",
+		DefaultValue: "0",
+		Doc:          "MB a growing segment chunk of a dense vector field aims at, its rows per chunk derive from the vector width. 0 uses chunkRows for every field",
+		Export:       true,
+	}
+	p.ChunkTargetSize.Init(base.mgr)
+
+	p.GrowingChunkPoolSize = ParamItem{
+		Key:          "queryNode.segcore.growingChunkPoolSize",
+		Version:      "3.0.0",
+		DefaultValue: "0",
+		Doc:          "MB of released growing segment chunks kept for reuse by later growing segments, 0 frees them on release",
+		Export:       true,
+	}
+	p.GrowingChunkPoolSize.Init(base.mgr)
+
 	p.EnableInterminSegmentIndex = ParamItem{
 		Key:          "queryNode.segcore.interimIndex.enableIndex",
 		Version:      "2.0.0",
@@ -4221,6 +4374,15 @@ This defaults to true, indicating that Milvus creates temporary index for growin
 	}
 	p.InterimIndexBuildParallelRate.Init(base.mgr)
 
+	p.InterimIndexAsyncBuild = ParamItem{
+		Key:          "queryNode.segcore.interimIndex.asyncBuild",
+		Version:      "3.0.0",
+		DefaultValue: "true",
+		Doc:          "build the interim index of a growing segment on a background thread, searches use brute force until it has caught up",
+		Export:       true,
+	}
+	p.InterimIndexAsyncBuild.Init(base.mgr)
+
 	p.MultipleChunkedEnable = ParamItem{
 		Key:          "queryNode.segcore.multipleChunkedEnable",
 		Version:      "2.0.0",
@@ -4564,6 +4726,35 @@ Max read concurrency must greater than or equal to 1, and less than or equal to
 	}
 	p.EnableResultZeroCopy.Init(base.mgr)
 
+	p.EnableNativeReduce = ParamItem{
+		Key:          "queryNode.search.enableNativeReduce",
+		Version:      "3.0.0",
+		DefaultValue: "false",
+		Doc:          "When true, the worker merges segment search results and fills output fields in a single C++ call instead of the Go reduce pipeline. Searches with group-by or boost scorers always use the Go reduce.",
+		Export:       true,
+	}
+	p.EnableNativeReduce.Init(base.mgr)
+
+	p.EnableArrowOutputFields = ParamItem{
+		Key:          "queryNode.search.enableArrowOutputFields",
+		Version:      "3.0.0",
+		DefaultValue: "false",
+		Doc:          "When true, the worker reads the output fields of the reduced search results from C++ as Arrow columns instead of a serialized proto. Output fields without an Arrow form, such as vectors, arrays and JSON, always use the proto.",
+		Export:       true,
+	}
+	p.EnableArrowOutputFields.Init(base.mgr)
+
+	p.AggregationMergeParallelism = ParamItem{
+		Key:          "queryNode.query.aggregationMergeParallelism",
+		Version:      "3.0.0",
+		DefaultValue: "0",
+		Doc: "Number of threads the worker merges the GROUP BY results of its segments on in C++, " +
+			"before decoding them, so that it returns one partial result instead of one per segment. " +
+			"0, the default, leaves the merge to the Go reduce.",
+		Export: false,
+	}
+	p.AggregationMergeParallelism.Init(base.mgr)
+
 	p.CPURatio = ParamItem{
 		Key:          "queryNode.scheduler.cpuRatio",
 		Version:      "2.0.0",
@@ -4851,6 +5042,143 @@ user-task-polling:
 	}
 	p.StorageV2CellTargetSizeBytes.Init(base.mgr)
 
+	p.LocalObjectCacheCapacityMb = ParamItem{
+		Key:          "queryNode.localObjectCache.capacityMb",
+		Version:      "3.0.0",
+		DefaultValue: "0",
+		Doc: `Capacity in MB of the local disk cache of binlogs and index files read from remote ` +
+			`storage. Copies are kept under localStorage.path across segments and restarts, checked ` +
+			`against the size and ETag of the remote object before use, and the least recently ` +
+			`used ones are evicted. 0 disables the cache.`,
+		Export: false,
+	}
+	p.LocalObjectCacheCapacityMb.Init(base.mgr)
+
+	p.PackedIntChunkEnabled = ParamItem{
+		Key:          "queryNode.segcore.packedIntChunk.enabled",
+		Version:      "3.0.0",
+		DefaultValue: "false",
+		Doc: `Whether INT32, INT64 and TIMESTAMPTZ fields of sealed segments are loaded as ` +
+			`frame-of-reference bit-packed chunks, in memory and in mmap files, when that is ` +
+			`smaller than the raw values. Filters decode only the rows of each batch; reading a ` +
+			`chunk's raw values decodes it once and keeps the decoded copy.`,
+		Export: false,
+	}
+	p.PackedIntChunkEnabled.Init(base.mgr)
+
+	p.MmapAccessAdviceEnabled = ParamItem{
+		Key:          "queryNode.mmap.accessAdvice.enabled",
+		Version:      "3.0.0",
+		DefaultValue: "false",
+		Doc: `Whether mmapped chunks of sealed segments tell the kernel how they are read: ` +
+			`vector chunks are gathered row by row and get no read-ahead, scalar chunks are ` +
+			`scanned and get aggressive read-ahead, and prefetched chunks are read ahead at once.`,
+		Export: false,
+	}
+	p.MmapAccessAdviceEnabled.Init(base.mgr)
+
+	p.ChunkHugePageEnabled = ParamItem{
+		Key:          "queryNode.segcore.chunkHugePage.enabled",
+		Version:      "3.0.0",
+		DefaultValue: "false",
+		Doc: `Whether in-memory chunks of sealed segments of at least 2 MB are backed by ` +
+			`transparent huge pages, which cuts TLB misses on large vector columns at the ` +
+			`cost of up to one partly used huge page per chunk.`,
+		Export: false,
+	}
+	p.ChunkHugePageEnabled.Init(base.mgr)
+
+	p.ProjectedColumnGroupLoadEnabled = ParamItem{
+		Key:          "queryNode.segcore.projectedColumnGroupLoad.enabled",
+		Version:      "3.0.0",
+		DefaultValue: "false",
+		Doc: `Whether each field of a storage v2 column group holding several fields is ` +
+			`loaded and cached on its own: a cell then reads only that field's column from ` +
+			`the row groups, so touching one field no longer loads or pins its neighbours.`,
+		Export: false,
+	}
+	p.ProjectedColumnGroupLoadEnabled.Init(base.mgr)
+
+	p.NumaAwareExecutionEnabled = ParamItem{
+		Key:          "queryNode.segcore.numaAware.enabled",
+		Version:      "3.0.0",
+		DefaultValue: "false",
+		Doc: `Whether each sealed segment gets a home NUMA node on hosts with several nodes: ` +
+			`its loading threads are bound to that node so its memory is allocated there, and ` +
+			`its searches and retrieves run on executor threads bound to that node.`,
+		Export: false,
+	}
+	p.NumaAwareExecutionEnabled.Init(base.mgr)
+
+	p.FairQuerySchedulingEnabled = ParamItem{
+		Key:          "queryNode.segcore.fairQueryScheduling.enabled",
+		Version:      "3.0.0",
+		DefaultValue: "false",
+		Doc: `Whether the segment tasks of concurrent searches and queries share the segcore ` +
+			`search executor fairly: the query that has started the fewest tasks runs next, ` +
+			`ties go to the earliest deadline, and tasks whose request deadline passed while ` +
+			`queued run first so they are dropped at once. Otherwise tasks run in submission order.`,
+		Export: false,
+	}
+	p.FairQuerySchedulingEnabled.Init(base.mgr)
+
+	p.ScanPrefetchWindow = ParamItem{
+		Key:          "queryNode.segcore.scanPrefetchWindow",
+		Version:      "3.0.0",
+		DefaultValue: "0",
+		Doc: `Number of chunks an expression scanning a sealed segment loads ahead of itself ` +
+			`in the background, so cold chunks of tiered storage load while the current ones ` +
+			`are evaluated. 0 instead pins every chunk the scan needs before it starts.`,
+		Export: false,
+	}
+	p.ScanPrefetchWindow.Init(base.mgr)
+
+	p.TantivyResultCacheCapacity = ParamItem{
+		Key:          "queryNode.segcore.tantivyResultCache.capacity",
+		Version:      "3.0.0",
+		DefaultValue: "0",
+		Doc: `Bytes of compressed query results each sealed inverted index keeps, so a term, ` +
+			`range or prefix filter repeated across requests skips tantivy. The least recently ` +
+			`used results are evicted first and the cache is dropped when the index is reloaded. ` +
+			`0 disables it.`,
+		Export: false,
+	}
+	p.TantivyResultCacheCapacity.Init(base.mgr)
+
+	p.QueryGeometryCacheCapacity = ParamItem{
+		Key:          "queryNode.segcore.queryGeometryCache.capacity",
+		Version:      "3.0.0",
+		DefaultValue: "4194304",
+		Doc: `Bytes of parsed and prepared filter geometries each query thread keeps, so a spatial ` +
+			`filter repeated across batches and requests does not parse and prepare its geometry ` +
+			`again. The least recently used geometries are evicted first. 0 disables it.`,
+		Export: false,
+	}
+	p.QueryGeometryCacheCapacity.Init(base.mgr)
+
+	p.JsonDocCacheCapacity = ParamItem{
+		Key:          "queryNode.segcore.jsonDocCache.capacity",
+		Version:      "3.0.0",
+		DefaultValue: "67108864",
+		Doc: `Bytes of parsed JSON documents a filter keeps while evaluating a batch, so several ` +
+			`predicates on the same JSON field parse each row once instead of once per predicate. ` +
+			`Rows past the limit are parsed by every predicate again. 0 disables it.`,
+		Export: false,
+	}
+	p.JsonDocCacheCapacity.Init(base.mgr)
+
+	p.WarmupProfileWindowHours = ParamItem{
+		Key:          "queryNode.segcore.warmupProfile.windowHours",
+		Version:      "3.0.0",
+		DefaultValue: "0",
+		Doc: `Hours of query access a per-collection warmup profile remembers. The fields and ` +
+			`indexes queries pinned within the window are recorded under localStorage.path and, ` +
+			`when a segment of the collection is loaded, warmed first in the background, ` +
+			`hottest first. 0 disables the profile.`,
+		Export: false,
+	}
+	p.WarmupProfileWindowHours.Init(base.mgr)
+
 	p.EnableWorkerSQCostMetrics = ParamItem{
 		Key:          "queryNode.enableWorkerSQCostMetrics",
 		Version:      "2.3.0",
@@ -4867,6 +5195,56 @@ user-task-polling:
 	}
 	p.ExprEvalBatchSize.Init(base.mgr)
 
+	p.FilterMorselParallelism = ParamItem{
+		Key:          "queryNode.segcore.filterMorsel.parallelism",
+		Version:      "3.0.0",
+		DefaultValue: "1",
+		Doc: `Max threads of the search pool evaluating the filter of one sealed segment. The rows ` +
+			`are split into morsels of filterMorsel.rows that idle threads pick up. 1 evaluates ` +
+			`the filter on the query thread only.`,
+		Export: false,
+	}
+	p.FilterMorselParallelism.Init(base.mgr)
+
+	p.FilterMorselRows = ParamItem{
+		Key:          "queryNode.segcore.filterMorsel.rows",
+		Version:      "3.0.0",
+		DefaultValue: "65536",
+		Doc:          "Rows of one filter morsel, rounded to whole expr eval batches.",
+		Export:       false,
+	}
+	p.FilterMorselRows.Init(base.mgr)
+
+	p.SearchNqSliceParallelism = ParamItem{
+		Key:          "queryNode.segcore.searchNqSlice.parallelism",
+		Version:      "3.0.0",
+		DefaultValue: "1",
+		Doc: `Max threads of the search pool searching the queries of one sealed segment. A ` +
+			`search of at least twice searchNqSlice.size queries is split into slices searched ` +
+			`in parallel. 1 searches all queries in one call.`,
+		Export: false,
+	}
+	p.SearchNqSliceParallelism.Init(base.mgr)
+
+	p.SearchNqSliceSize = ParamItem{
+		Key:          "queryNode.segcore.searchNqSlice.size",
+		Version:      "3.0.0",
+		DefaultValue: "1024",
+		Doc:          "Min queries of one nq slice of a sealed segment search.",
+		Export:       false,
+	}
+	p.SearchNqSliceSize.Init(base.mgr)
+
+	p.RangeSearchStreamScanLimit = ParamItem{
+		Key:          "queryNode.segcore.rangeSearch.streamScanLimit",
+		Version:      "3.0.0",
+		DefaultValue: "0",
+		Doc: "Candidates a range search pulls at most per query from the index iterators, keeping only the topk found so far. " +
+			"A query stops earlier once its topk stop improving. 0 collects the whole range with a knowhere range search.",
+		Export: false,
+	}
+	p.RangeSearchStreamScanLimit.Init(base.mgr)
+
 	p.DeleteDumpBatchSize = ParamItem{
 		Key:          "queryNode.segcore.deleteDumpBatchSize",
 		Version:      "2.6.2",
@@ -4900,7 +5278,7 @@ user-task-polling:
 		Key:          "queryNode.exprCache.mode",
 		Version:      "3.0.0",
 		DefaultValue: "disk",
-		Doc:          "cache mode: 'disk' (sealed segments only, pread/pwrite + fixed slots) or 'memory' (sealed and growing segments, malloc + Clock + compression)",
+		Doc:          "cache mode: 'disk' (sealed segments only, pread/pwrite + fixed slots), 'memory' (sealed and growing segments, malloc + Clock + compression) or 'hybrid' (memory tier whose sealed segment evictions are demoted to the disk tier, hot disk hits are promoted back)",
 		Export:       true,
 	}
 	p.ExprResCacheMode.Init(base.mgr)
@@ -64,6 +64,23 @@ func TestComponentParam(t *testing.T) {
 		assert.Equal(t, "queryNode.search.enableResultZeroCopy", params.QueryNodeCfg.EnableResultZeroCopy.Key)
 	})
 
+	t.Run("query node native reduce config", func(t *testing.T) {
+		assert.Equal(t, "queryNode.search.enableNativeReduce", params.QueryNodeCfg.EnableNativeReduce.Key)
+		assert.False(t, params.QueryNodeCfg.EnableNativeReduce.GetAsBool())
+		assert.Equal(t, "queryNode.search.enableArrowOutputFields", params.QueryNodeCfg.EnableArrowOutputFields.Key)
+		assert.False(t, params.QueryNodeCfg.EnableArrowOutputFields.GetAsBool())
+	})
+
+	t.Run("query node aggregation merge config", func(t *testing.T) {
+		assert.Equal(t, "queryNode.query.aggregationMergeParallelism", params.QueryNodeCfg.AggregationMergeParallelism.Key)
+		assert.EqualValues(t, 0, params.QueryNodeCfg.AggregationMergeParallelism.GetAsInt64())
+	})
+
+	t.Run("query node range search stream config", func(t *testing.T) {
+		assert.Equal(t, "queryNode.segcore.rangeSearch.streamScanLimit", params.QueryNodeCfg.RangeSearchStreamScanLimit.Key)
+		assert.EqualValues(t, 0, params.QueryNodeCfg.RangeSearchStreamScanLimit.GetAsInt64())
+	})
+
 	t.Run("test commonConfig", func(t *testing.T) {
 		Params := &params.CommonCfg
 